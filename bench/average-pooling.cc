@@ -14,6 +14,8 @@
 #include <random>
 #include <vector>
 
+#include <fp16.h>
+
 #include <xnnpack.h>
 
 #include <benchmark/benchmark.h>
@@ -107,6 +109,167 @@ static void xnnpack_average_pooling_qu8(benchmark::State& state, const char* net
 }
 #endif  // XNN_NO_QU8_OPERATORS
 
+#ifndef XNN_NO_QS8_OPERATORS
+static void xnnpack_average_pooling_qs8(benchmark::State& state, const char* net) {
+  const size_t batch_size = state.range(0);
+  const size_t input_height = state.range(1);
+  const size_t input_width = state.range(2);
+  const size_t pooling_size = state.range(3);
+  const size_t padding_size = state.range(4);
+  const size_t stride = state.range(5);
+  const size_t channels = state.range(6);
+
+  std::random_device random_device;
+  auto rng = std::mt19937(random_device());
+  auto i8rng = std::bind(
+    std::uniform_int_distribution<int32_t>(std::numeric_limits<int8_t>::min(), std::numeric_limits<int8_t>::max()),
+    std::ref(rng));
+
+  const size_t output_height = (2 * padding_size + input_height - pooling_size) / stride + 1;
+  const size_t output_width = (2 * padding_size + input_width - pooling_size) / stride + 1;
+
+  std::vector<int8_t> input(batch_size * input_height * input_width * channels + XNN_EXTRA_BYTES / sizeof(int8_t));
+  std::generate(input.begin(), input.end(), std::ref(i8rng));
+  std::vector<int8_t> output(batch_size * output_height * output_width * channels);
+  std::fill(output.begin(), output.end(), 0xA5);
+
+  xnn_status status = xnn_initialize(nullptr /* allocator */);
+  if (status != xnn_status_success) {
+    state.SkipWithError("failed to initialize XNNPACK");
+    return;
+  }
+
+  xnn_operator_t pooling_op = nullptr;
+  status = xnn_create_average_pooling2d_nhwc_qs8(
+    padding_size, padding_size, padding_size, padding_size,
+    pooling_size, pooling_size,
+    stride, stride,
+    channels, channels /* input pixel stride */, channels /* output pixel stride */,
+    -1 /* input zero point */, 0.75f /* input scale */,
+    -1 /* output zero point */, 1.25f /* output scale */,
+    -128, 127,
+    0 /* flags */, &pooling_op);
+  if (status != xnn_status_success) {
+    state.SkipWithError("failed to create Average Pooling operator");
+    return;
+  }
+
+  status = xnn_setup_average_pooling2d_nhwc_qs8(
+    pooling_op,
+    batch_size, input_height, input_width,
+    input.data(), output.data(),
+    nullptr /* thread pool */);
+  if (status != xnn_status_success) {
+    state.SkipWithError("failed to setup Average Pooling operator");
+    return;
+  }
+
+  for (auto _ : state) {
+    status = xnn_run_operator(pooling_op, nullptr /* thread pool */);
+    if (status != xnn_status_success) {
+      state.SkipWithError("failed to run Average Pooling operator");
+      return;
+    }
+  }
+
+  status = xnn_delete_operator(pooling_op);
+  if (status != xnn_status_success) {
+    state.SkipWithError("failed to delete Average Pooling operator");
+    return;
+  }
+  pooling_op = nullptr;
+
+  const uint64_t cpu_frequency = benchmark::utils::GetCurrentCpuFrequency();
+  if (cpu_frequency != 0) {
+    state.counters["cpufreq"] = cpu_frequency;
+  }
+
+  state.counters["bytes"] = benchmark::Counter(
+    uint64_t(state.iterations()) *
+      batch_size * (input_height * input_width + output_height * output_width) * channels * sizeof(int8_t),
+    benchmark::Counter::kIsRate);
+}
+#endif  // XNN_NO_QS8_OPERATORS
+
+#ifndef XNN_NO_F16_OPERATORS
+static void xnnpack_average_pooling_f16(benchmark::State& state, const char* net) {
+  const size_t batch_size = state.range(0);
+  const size_t input_height = state.range(1);
+  const size_t input_width = state.range(2);
+  const size_t pooling_size = state.range(3);
+  const size_t padding_size = state.range(4);
+  const size_t stride = state.range(5);
+  const size_t channels = state.range(6);
+
+  std::random_device random_device;
+  auto rng = std::mt19937(random_device());
+  auto f32rng = std::bind(std::uniform_real_distribution<float>(), std::ref(rng));
+  auto f16rng = std::bind(fp16_ieee_from_fp32_value, f32rng);
+
+  const size_t output_height = (2 * padding_size + input_height - pooling_size) / stride + 1;
+  const size_t output_width = (2 * padding_size + input_width - pooling_size) / stride + 1;
+
+  std::vector<uint16_t> input(batch_size * input_height * input_width * channels + XNN_EXTRA_BYTES / sizeof(uint16_t));
+  std::generate(input.begin(), input.end(), std::ref(f16rng));
+  std::vector<uint16_t> output(batch_size * output_height * output_width * channels);
+  std::fill(output.begin(), output.end(), UINT16_C(0x7E00) /* NaN */);
+
+  xnn_status status = xnn_initialize(nullptr /* allocator */);
+  if (status != xnn_status_success) {
+    state.SkipWithError("failed to initialize XNNPACK");
+    return;
+  }
+
+  xnn_operator_t pooling_op = nullptr;
+  status = xnn_create_average_pooling2d_nhwc_f16(
+    padding_size, padding_size, padding_size, padding_size,
+    pooling_size, pooling_size,
+    stride, stride,
+    channels, channels /* input pixel stride */, channels /* output pixel stride */,
+    -std::numeric_limits<float>::infinity(), std::numeric_limits<float>::infinity(),
+    0 /* flags */, &pooling_op);
+  if (status != xnn_status_success) {
+    state.SkipWithError("failed to create Average Pooling operator");
+    return;
+  }
+
+  status = xnn_setup_average_pooling2d_nhwc_f16(
+    pooling_op,
+    batch_size, input_height, input_width,
+    input.data(), output.data(),
+    nullptr /* thread pool */);
+  if (status != xnn_status_success) {
+    state.SkipWithError("failed to setup Average Pooling operator");
+    return;
+  }
+
+  for (auto _ : state) {
+    status = xnn_run_operator(pooling_op, nullptr /* thread pool */);
+    if (status != xnn_status_success) {
+      state.SkipWithError("failed to run Average Pooling operator");
+      return;
+    }
+  }
+
+  status = xnn_delete_operator(pooling_op);
+  if (status != xnn_status_success) {
+    state.SkipWithError("failed to delete Average Pooling operator");
+    return;
+  }
+  pooling_op = nullptr;
+
+  const uint64_t cpu_frequency = benchmark::utils::GetCurrentCpuFrequency();
+  if (cpu_frequency != 0) {
+    state.counters["cpufreq"] = cpu_frequency;
+  }
+
+  state.counters["bytes"] = benchmark::Counter(
+    uint64_t(state.iterations()) *
+      batch_size * (input_height * input_width + output_height * output_width) * channels * sizeof(uint16_t),
+    benchmark::Counter::kIsRate);
+}
+#endif  // XNN_NO_F16_OPERATORS
+
 static void xnnpack_average_pooling_f32(benchmark::State& state, const char* net) {
   const size_t batch_size = state.range(0);
   const size_t input_height = state.range(1);
@@ -411,6 +574,24 @@ BENCHMARK_CAPTURE(xnnpack_average_pooling_qu8, shufflenet_v1_g4, "ShuffleNet v1
 BENCHMARK_CAPTURE(xnnpack_average_pooling_qu8, shufflenet_v1_g8, "ShuffleNet v1 (8 groups)")->Apply(ShuffleNetV1G8)->UseRealTime();
 #endif  // XNN_NO_QU8_OPERATORS
 
+#ifndef XNN_NO_QS8_OPERATORS
+BENCHMARK_CAPTURE(xnnpack_average_pooling_qs8, imagenet, "ImageNet")->Apply(ImageNet)->UseRealTime();
+BENCHMARK_CAPTURE(xnnpack_average_pooling_qs8, shufflenet_v1_g1, "ShuffleNet v1 (1 group)")->Apply(ShuffleNetV1G1)->UseRealTime();
+BENCHMARK_CAPTURE(xnnpack_average_pooling_qs8, shufflenet_v1_g2, "ShuffleNet v1 (2 groups)")->Apply(ShuffleNetV1G2)->UseRealTime();
+BENCHMARK_CAPTURE(xnnpack_average_pooling_qs8, shufflenet_v1_g3, "ShuffleNet v1 (3 groups)")->Apply(ShuffleNetV1G3)->UseRealTime();
+BENCHMARK_CAPTURE(xnnpack_average_pooling_qs8, shufflenet_v1_g4, "ShuffleNet v1 (4 groups)")->Apply(ShuffleNetV1G4)->UseRealTime();
+BENCHMARK_CAPTURE(xnnpack_average_pooling_qs8, shufflenet_v1_g8, "ShuffleNet v1 (8 groups)")->Apply(ShuffleNetV1G8)->UseRealTime();
+#endif  // XNN_NO_QS8_OPERATORS
+
+#ifndef XNN_NO_F16_OPERATORS
+BENCHMARK_CAPTURE(xnnpack_average_pooling_f16, imagenet, "ImageNet")->Apply(ImageNet)->UseRealTime();
+BENCHMARK_CAPTURE(xnnpack_average_pooling_f16, shufflenet_v1_g1, "ShuffleNet v1 (1 group)")->Apply(ShuffleNetV1G1)->UseRealTime();
+BENCHMARK_CAPTURE(xnnpack_average_pooling_f16, shufflenet_v1_g2, "ShuffleNet v1 (2 groups)")->Apply(ShuffleNetV1G2)->UseRealTime();
+BENCHMARK_CAPTURE(xnnpack_average_pooling_f16, shufflenet_v1_g3, "ShuffleNet v1 (3 groups)")->Apply(ShuffleNetV1G3)->UseRealTime();
+BENCHMARK_CAPTURE(xnnpack_average_pooling_f16, shufflenet_v1_g4, "ShuffleNet v1 (4 groups)")->Apply(ShuffleNetV1G4)->UseRealTime();
+BENCHMARK_CAPTURE(xnnpack_average_pooling_f16, shufflenet_v1_g8, "ShuffleNet v1 (8 groups)")->Apply(ShuffleNetV1G8)->UseRealTime();
+#endif  // XNN_NO_F16_OPERATORS
+
 #ifndef XNNPACK_BENCHMARK_NO_MAIN
 BENCHMARK_MAIN();
 #endif
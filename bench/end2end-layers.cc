@@ -0,0 +1,148 @@
+// Copyright 2022 Google LLC
+//
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree.
+
+// Per-layer execution times of the end-to-end models. Every operator of the model is timed separately, and reported as
+// a "L<index>" counter in microseconds, so the effect of work partitioning on individual layers can be compared across
+// thread counts and across builds of the library.
+
+#include <chrono>
+#include <cstdio>
+#include <memory>
+#include <vector>
+
+#include <xnnpack.h>
+
+#include <benchmark/benchmark.h>
+
+#include "bench/utils.h"
+#include "models/models.h"
+
+
+static void End2EndLayersBenchmark(
+  benchmark::State& state,
+  models::ExecutionPlanFactory model_factory)
+{
+  if (xnn_initialize(nullptr /* allocator */) != xnn_status_success) {
+    state.SkipWithError("failed to initialize XNNPACK");
+    return;
+  }
+
+  const size_t num_threads = state.range(0);
+  std::unique_ptr<pthreadpool, decltype(&pthreadpool_destroy)> threadpool(
+    pthreadpool_create(num_threads), pthreadpool_destroy);
+
+  auto execution_plan = model_factory(threadpool.get());
+  if (execution_plan.empty()) {
+    state.SkipWithError("failed to create a model");
+    return;
+  }
+
+  std::vector<double> layer_seconds(execution_plan.size());
+  for (auto _ : state) {
+    for (size_t i = 0; i < execution_plan.size(); i++) {
+      const auto start = std::chrono::high_resolution_clock::now();
+      xnn_status status = xnn_run_operator(execution_plan[i].get(), threadpool.get());
+      const auto end = std::chrono::high_resolution_clock::now();
+      if (status != xnn_status_success) {
+        state.SkipWithError("failed to run a model");
+        return;
+      }
+      layer_seconds[i] += std::chrono::duration<double>(end - start).count();
+    }
+  }
+
+  for (size_t i = 0; i < execution_plan.size(); i++) {
+    char name[16];
+    snprintf(name, sizeof(name), "L%03zu", i);
+    state.counters[name] = benchmark::Counter(layer_seconds[i] * 1.0e+6, benchmark::Counter::kAvgIterations);
+  }
+
+  const uint64_t cpu_frequency = benchmark::utils::GetCurrentCpuFrequency();
+  if (cpu_frequency != 0) {
+    state.counters["cpufreq"] = cpu_frequency;
+  }
+}
+
+// Thread counts from a single thread up to a large server, regardless of the number of cores of the host processor,
+// to expose over-splitting of small layers.
+static void PartitioningThreads(benchmark::internal::Benchmark* benchmark) {
+  benchmark->ArgName("T");
+  for (int64_t t : {1, 2, 4, 8, 16}) {
+    benchmark->Arg(t);
+  }
+}
+
+static void FP32MobileNetV1(benchmark::State& state) {
+  End2EndLayersBenchmark(state, models::FP32MobileNetV1);
+}
+
+static void FP32MobileNetV2(benchmark::State& state) {
+  End2EndLayersBenchmark(state, models::FP32MobileNetV2);
+}
+
+static void FP32MobileNetV3Large(benchmark::State& state) {
+  End2EndLayersBenchmark(state, models::FP32MobileNetV3Large);
+}
+
+static void FP32MobileNetV3Small(benchmark::State& state) {
+  End2EndLayersBenchmark(state, models::FP32MobileNetV3Small);
+}
+
+static void FP32Sparse80MobileNetV1(benchmark::State& state) {
+  End2EndLayersBenchmark(state, [](pthreadpool_t threadpool) {
+    return models::FP32SparseMobileNetV1(0.8f, threadpool);
+  });
+}
+
+static void FP32Sparse80MobileNetV2(benchmark::State& state) {
+  End2EndLayersBenchmark(state, [](pthreadpool_t threadpool) {
+    return models::FP32SparseMobileNetV2(0.8f, threadpool);
+  });
+}
+
+static void FP16MobileNetV1(benchmark::State& state) {
+  End2EndLayersBenchmark(state, models::FP16MobileNetV1);
+}
+
+static void FP16MobileNetV2(benchmark::State& state) {
+  End2EndLayersBenchmark(state, models::FP16MobileNetV2);
+}
+
+static void QS8MobileNetV1(benchmark::State& state) {
+  End2EndLayersBenchmark(state, models::QS8MobileNetV1);
+}
+
+static void QS8MobileNetV2(benchmark::State& state) {
+  End2EndLayersBenchmark(state, models::QS8MobileNetV2);
+}
+
+static void QU8MobileNetV1(benchmark::State& state) {
+  End2EndLayersBenchmark(state, models::QU8MobileNetV1);
+}
+
+static void QU8MobileNetV2(benchmark::State& state) {
+  End2EndLayersBenchmark(state, models::QU8MobileNetV2);
+}
+
+BENCHMARK(FP32MobileNetV1)->Apply(PartitioningThreads)->Unit(benchmark::kMicrosecond)->UseRealTime();
+BENCHMARK(FP32MobileNetV2)->Apply(PartitioningThreads)->Unit(benchmark::kMicrosecond)->UseRealTime();
+BENCHMARK(FP32MobileNetV3Large)->Apply(PartitioningThreads)->Unit(benchmark::kMicrosecond)->UseRealTime();
+BENCHMARK(FP32MobileNetV3Small)->Apply(PartitioningThreads)->Unit(benchmark::kMicrosecond)->UseRealTime();
+
+BENCHMARK(FP32Sparse80MobileNetV1)->Apply(PartitioningThreads)->Unit(benchmark::kMicrosecond)->UseRealTime();
+BENCHMARK(FP32Sparse80MobileNetV2)->Apply(PartitioningThreads)->Unit(benchmark::kMicrosecond)->UseRealTime();
+
+BENCHMARK(FP16MobileNetV1)->Apply(PartitioningThreads)->Unit(benchmark::kMicrosecond)->UseRealTime();
+BENCHMARK(FP16MobileNetV2)->Apply(PartitioningThreads)->Unit(benchmark::kMicrosecond)->UseRealTime();
+
+BENCHMARK(QS8MobileNetV1)->Apply(PartitioningThreads)->Unit(benchmark::kMicrosecond)->UseRealTime();
+BENCHMARK(QS8MobileNetV2)->Apply(PartitioningThreads)->Unit(benchmark::kMicrosecond)->UseRealTime();
+
+BENCHMARK(QU8MobileNetV1)->Apply(PartitioningThreads)->Unit(benchmark::kMicrosecond)->UseRealTime();
+BENCHMARK(QU8MobileNetV2)->Apply(PartitioningThreads)->Unit(benchmark::kMicrosecond)->UseRealTime();
+
+#ifndef XNNPACK_BENCHMARK_NO_MAIN
+BENCHMARK_MAIN();
+#endif
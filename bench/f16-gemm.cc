@@ -178,6 +178,10 @@ static void GEMMBenchmark(benchmark::State& state,
     GEMMBenchmark(state, xnn_f16_gemm_minmax_ukernel_1x16__neonfp16arith_ld64, 1, 16, 1, 1,
       xnn_init_f16_scaleminmax_neon_params, benchmark::utils::CheckNEONFP16ARITH);
   }
+  static void f16_gemm_1x16__neonfp16arith_ld64_acc4(benchmark::State& state, const char* net) {
+    GEMMBenchmark(state, xnn_f16_gemm_minmax_ukernel_1x16__neonfp16arith_ld64_acc4, 1, 16, 1, 1,
+      xnn_init_f16_scaleminmax_neon_params, benchmark::utils::CheckNEONFP16ARITH);
+  }
   static void f16_gemm_4x16__neonfp16arith_ld64(benchmark::State& state, const char* net) {
     GEMMBenchmark(state, xnn_f16_gemm_minmax_ukernel_4x16__neonfp16arith_ld64, 4, 16, 1, 1,
       xnn_init_f16_scaleminmax_neon_params, benchmark::utils::CheckNEONFP16ARITH);
@@ -196,6 +200,7 @@ static void GEMMBenchmark(benchmark::State& state,
   BENCHMARK_GEMM(f16_gemm_6x8__neonfp16arith_ld64)
   BENCHMARK_GEMM(f16_gemm_8x8__neonfp16arith_ld64)
   BENCHMARK_GEMM(f16_gemm_1x16__neonfp16arith_ld64)
+  BENCHMARK_GEMM(f16_gemm_1x16__neonfp16arith_ld64_acc4)
   BENCHMARK_GEMM(f16_gemm_4x16__neonfp16arith_ld64)
   BENCHMARK_GEMM(f16_gemm_6x16__neonfp16arith_ld64)
   BENCHMARK_GEMM(f16_gemm_8x16__neonfp16arith_ld64)
@@ -226,6 +231,10 @@ static void GEMMBenchmark(benchmark::State& state,
     GEMMBenchmark(state, xnn_f16_gemm_minmax_ukernel_1x16__avx2_broadcast, 1, 16, 1, 1,
       xnn_init_f16_scaleminmax_avx_params, benchmark::utils::CheckAVX2);
   }
+  static void f16_gemm_1x16__avx2_broadcast_acc4(benchmark::State& state, const char* net) {
+    GEMMBenchmark(state, xnn_f16_gemm_minmax_ukernel_1x16__avx2_broadcast_acc4, 1, 16, 1, 1,
+      xnn_init_f16_scaleminmax_avx_params, benchmark::utils::CheckAVX2);
+  }
   static void f16_gemm_3x16__avx2_broadcast(benchmark::State& state, const char* net) {
     GEMMBenchmark(state, xnn_f16_gemm_minmax_ukernel_3x16__avx2_broadcast, 3, 16, 1, 1,
       xnn_init_f16_scaleminmax_avx_params, benchmark::utils::CheckAVX2);
@@ -245,6 +254,7 @@ static void GEMMBenchmark(benchmark::State& state,
   BENCHMARK_GEMM(f16_gemm_6x8__avx2_broadcast)
   BENCHMARK_GEMM(f16_gemm_7x8__avx2_broadcast)
   BENCHMARK_GEMM(f16_gemm_1x16__avx2_broadcast)
+  BENCHMARK_GEMM(f16_gemm_1x16__avx2_broadcast_acc4)
   BENCHMARK_GEMM(f16_gemm_3x16__avx2_broadcast)
   BENCHMARK_GEMM(f16_gemm_4x16__avx2_broadcast)
   BENCHMARK_GEMM(f16_gemm_5x16__avx2_broadcast)
@@ -730,6 +730,10 @@ static void GEMMBenchmark(benchmark::State& state,
     GEMMBenchmark(state, xnn_f32_gemm_minmax_ukernel_6x8__neon_lane_ld128, 6, 8, 1, 1,
       xnn_init_f32_minmax_scalar_params, benchmark::utils::CheckNEON);
   }
+  static void f32_gemm_1x8__neon_dup_acc4(benchmark::State& state, const char* net) {
+    GEMMBenchmark(state, xnn_f32_gemm_minmax_ukernel_1x8__neon_dup_acc4, 1, 8, 1, 1,
+      xnn_init_f32_minmax_scalar_params, benchmark::utils::CheckNEON);
+  }
   static void f32_gemm_1x8__neonfma_dup_ld64(benchmark::State& state, const char* net) {
     GEMMBenchmark(state, xnn_f32_gemm_minmax_ukernel_1x8__neonfma_dup_ld64, 1, 8, 1, 1,
       xnn_init_f32_minmax_scalar_params, benchmark::utils::CheckNEONFMA);
@@ -750,6 +754,10 @@ static void GEMMBenchmark(benchmark::State& state,
     GEMMBenchmark(state, xnn_f32_gemm_minmax_ukernel_6x8__neonfma_dup_ld128, 6, 8, 1, 1,
       xnn_init_f32_minmax_scalar_params, benchmark::utils::CheckNEONFMA);
   }
+  static void f32_gemm_1x8__neonfma_dup_acc4(benchmark::State& state, const char* net) {
+    GEMMBenchmark(state, xnn_f32_gemm_minmax_ukernel_1x8__neonfma_dup_acc4, 1, 8, 1, 1,
+      xnn_init_f32_minmax_scalar_params, benchmark::utils::CheckNEONFMA);
+  }
   static void f32_gemm_1x8s4__neon(benchmark::State& state, const char* net) {
     GEMMBenchmark(state, xnn_f32_gemm_minmax_ukernel_1x8s4__neon, 1, 8, 1, 4,
       xnn_init_f32_minmax_scalar_params, benchmark::utils::CheckNEON);
@@ -797,12 +805,14 @@ static void GEMMBenchmark(benchmark::State& state,
   BENCHMARK_GEMM(f32_gemm_5x8__neon_lane_ld64)
   BENCHMARK_GEMM(f32_gemm_6x8__neon_lane_ld64)
   BENCHMARK_GEMM(f32_gemm_6x8__neon_lane_ld128)
+  BENCHMARK_GEMM(f32_gemm_1x8__neon_dup_acc4)
 
   BENCHMARK_GEMM(f32_gemm_1x8__neonfma_dup_ld64)
   BENCHMARK_GEMM(f32_gemm_4x8__neonfma_dup_ld128)
   BENCHMARK_GEMM(f32_gemm_4x8__neonfma_dup_ld64)
   BENCHMARK_GEMM(f32_gemm_6x8__neonfma_dup_ld64)
   BENCHMARK_GEMM(f32_gemm_6x8__neonfma_dup_ld128)
+  BENCHMARK_GEMM(f32_gemm_1x8__neonfma_dup_acc4)
 
   BENCHMARK_GEMM(f32_gemm_1x8s4__neon)
   BENCHMARK_GEMM(f32_gemm_4x8s4__neon)
@@ -844,6 +854,10 @@ static void GEMMBenchmark(benchmark::State& state,
     GEMMBenchmark(state, xnn_f32_gemm_minmax_ukernel_8x16__avx512f_broadcast, 8, 16, 1, 1,
       xnn_init_f32_minmax_scalar_params, benchmark::utils::CheckAVX512F);
   }
+  static void f32_gemm_1x16__avx512f_broadcast_acc4(benchmark::State& state, const char* net) {
+    GEMMBenchmark(state, xnn_f32_gemm_minmax_ukernel_1x16__avx512f_broadcast_acc4, 1, 16, 1, 1,
+      xnn_init_f32_minmax_scalar_params, benchmark::utils::CheckAVX512F);
+  }
 
   static void f32_gemm_1x8__fma3_broadcast(benchmark::State& state, const char* net) {
     GEMMBenchmark(state, xnn_f32_gemm_minmax_ukernel_1x8__fma3_broadcast, 1, 8, 1, 1,
@@ -885,6 +899,10 @@ static void GEMMBenchmark(benchmark::State& state,
     GEMMBenchmark(state, xnn_f32_gemm_minmax_ukernel_5x16__fma3_broadcast, 5, 16, 1, 1,
       xnn_init_f32_minmax_avx_params, benchmark::utils::CheckFMA3);
   }
+  static void f32_gemm_1x16__fma3_broadcast_acc4(benchmark::State& state, const char* net) {
+    GEMMBenchmark(state, xnn_f32_gemm_minmax_ukernel_1x16__fma3_broadcast_acc4, 1, 16, 1, 1,
+      xnn_init_f32_minmax_avx_params, benchmark::utils::CheckFMA3);
+  }
 
   static void f32_gemm_1x16s4__fma3_broadcast(benchmark::State& state, const char* net) {
     GEMMBenchmark(state, xnn_f32_gemm_minmax_ukernel_1x16s4__fma3_broadcast, 1, 16, 1, 4,
@@ -939,6 +957,10 @@ static void GEMMBenchmark(benchmark::State& state,
     GEMMBenchmark(state, xnn_f32_gemm_minmax_ukernel_5x16__avx_broadcast, 5, 16, 1, 1,
       xnn_init_f32_minmax_avx_params, benchmark::utils::CheckAVX);
   }
+  static void f32_gemm_1x16__avx_broadcast_acc4(benchmark::State& state, const char* net) {
+    GEMMBenchmark(state, xnn_f32_gemm_minmax_ukernel_1x16__avx_broadcast_acc4, 1, 16, 1, 1,
+      xnn_init_f32_minmax_avx_params, benchmark::utils::CheckAVX);
+  }
 
   static void f32_gemm_1x8__sse2_dup(benchmark::State& state, const char* net) {
     GEMMBenchmark(state, xnn_f32_gemm_minmax_ukernel_1x8__sse2_dup, 1, 8, 1, 1,
@@ -990,6 +1012,10 @@ static void GEMMBenchmark(benchmark::State& state,
     GEMMBenchmark(state, xnn_f32_gemm_minmax_ukernel_5x8__sse_dup, 5, 8, 1, 1,
       xnn_init_f32_minmax_sse_params);
   }
+  static void f32_gemm_1x8__sse_dup_acc4(benchmark::State& state, const char* net) {
+    GEMMBenchmark(state, xnn_f32_gemm_minmax_ukernel_1x8__sse_dup_acc4, 1, 8, 1, 1,
+      xnn_init_f32_minmax_sse_params);
+  }
 
   static void f32_gemm_1x8s4__sse(benchmark::State& state, const char* net) {
     GEMMBenchmark(state, xnn_f32_gemm_minmax_ukernel_1x8s4__sse, 1, 8, 1, 4,
@@ -1023,6 +1049,7 @@ static void GEMMBenchmark(benchmark::State& state,
   BENCHMARK_GEMM(f32_gemm_6x16__avx512f_broadcast)
   BENCHMARK_GEMM(f32_gemm_7x16__avx512f_broadcast)
   BENCHMARK_GEMM(f32_gemm_8x16__avx512f_broadcast)
+  BENCHMARK_GEMM(f32_gemm_1x16__avx512f_broadcast_acc4)
 
   BENCHMARK_GEMM(f32_gemm_1x8__fma3_broadcast)
   BENCHMARK_GEMM(f32_gemm_4x8__fma3_broadcast)
@@ -1034,6 +1061,7 @@ static void GEMMBenchmark(benchmark::State& state,
   BENCHMARK_GEMM(f32_gemm_3x16__fma3_broadcast)
   BENCHMARK_GEMM(f32_gemm_4x16__fma3_broadcast)
   BENCHMARK_GEMM(f32_gemm_5x16__fma3_broadcast)
+  BENCHMARK_GEMM(f32_gemm_1x16__fma3_broadcast_acc4)
 
   BENCHMARK_GEMM(f32_gemm_1x16s4__fma3_broadcast)
   BENCHMARK_GEMM(f32_gemm_3x16s4__fma3_broadcast)
@@ -1049,6 +1077,7 @@ static void GEMMBenchmark(benchmark::State& state,
   BENCHMARK_GEMM(f32_gemm_3x16__avx_broadcast)
   BENCHMARK_GEMM(f32_gemm_4x16__avx_broadcast)
   BENCHMARK_GEMM(f32_gemm_5x16__avx_broadcast)
+  BENCHMARK_GEMM(f32_gemm_1x16__avx_broadcast_acc4)
 
   BENCHMARK_GEMM(f32_gemm_1x8__sse2_dup)
   BENCHMARK_GEMM(f32_gemm_3x8__sse2_dup)
@@ -1064,6 +1093,7 @@ static void GEMMBenchmark(benchmark::State& state,
   BENCHMARK_GEMM(f32_gemm_3x8__sse_dup)
   BENCHMARK_GEMM(f32_gemm_4x8__sse_dup)
   BENCHMARK_GEMM(f32_gemm_5x8__sse_dup)
+  BENCHMARK_GEMM(f32_gemm_1x8__sse_dup_acc4)
 
   BENCHMARK_GEMM(f32_gemm_1x8s4__sse)
   BENCHMARK_GEMM(f32_gemm_3x8s4__sse)
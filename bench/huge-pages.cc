@@ -0,0 +1,166 @@
+// Copyright 2022 Google LLC
+//
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree.
+
+// Inference on a Runtime with hundreds of megabytes of packed weights, with the weights and the workspace allocated in
+// regular pages (default) or in transparent huge pages (XNN_FLAG_HUGE_PAGES). Streaming of weights through the GEMM
+// micro-kernels touches a new 4 KB page every few cache lines, and huge pages take the TLB misses off the critical path.
+
+#include <algorithm>
+#include <array>
+#include <functional>
+#include <limits>
+#include <memory>
+#include <random>
+#include <vector>
+
+#include <xnnpack.h>
+
+#include <benchmark/benchmark.h>
+
+#include "bench/utils.h"
+
+
+// Create a Subgraph with a stack of F32 Fully Connected Nodes of the same size, which does not own the weights.
+static xnn_subgraph_t CreateFullyConnectedStack(
+  size_t batch_size, size_t num_layers, size_t channels,
+  const std::vector<float>& kernel, const std::vector<float>& bias)
+{
+  xnn_subgraph_t subgraph = nullptr;
+  if (xnn_create_subgraph(2 /* external value IDs */, 0 /* flags */, &subgraph) != xnn_status_success) {
+    return nullptr;
+  }
+
+  const std::array<size_t, 2> activation_dims = {{batch_size, channels}};
+  const std::array<size_t, 2> kernel_dims = {{channels, channels}};
+  const std::array<size_t, 1> bias_dims = {{channels}};
+
+  uint32_t input_id = XNN_INVALID_VALUE_ID;
+  if (xnn_define_tensor_value(
+        subgraph, xnn_datatype_fp32, activation_dims.size(), activation_dims.data(), nullptr,
+        0 /* external ID */, XNN_VALUE_FLAG_EXTERNAL_INPUT, &input_id) != xnn_status_success)
+  {
+    xnn_delete_subgraph(subgraph);
+    return nullptr;
+  }
+  for (size_t i = 0; i < num_layers; i++) {
+    uint32_t kernel_id = XNN_INVALID_VALUE_ID;
+    uint32_t bias_id = XNN_INVALID_VALUE_ID;
+    uint32_t output_id = XNN_INVALID_VALUE_ID;
+    const bool last_layer = i + 1 == num_layers;
+    if (xnn_define_tensor_value(
+          subgraph, xnn_datatype_fp32, kernel_dims.size(), kernel_dims.data(), kernel.data() + i * channels * channels,
+          XNN_INVALID_VALUE_ID, 0 /* flags */, &kernel_id) != xnn_status_success ||
+        xnn_define_tensor_value(
+          subgraph, xnn_datatype_fp32, bias_dims.size(), bias_dims.data(), bias.data() + i * channels,
+          XNN_INVALID_VALUE_ID, 0 /* flags */, &bias_id) != xnn_status_success ||
+        xnn_define_tensor_value(
+          subgraph, xnn_datatype_fp32, activation_dims.size(), activation_dims.data(), nullptr,
+          last_layer ? 1 : XNN_INVALID_VALUE_ID, last_layer ? XNN_VALUE_FLAG_EXTERNAL_OUTPUT : 0,
+          &output_id) != xnn_status_success ||
+        xnn_define_fully_connected(
+          subgraph, -std::numeric_limits<float>::infinity(), std::numeric_limits<float>::infinity(),
+          input_id, kernel_id, bias_id, output_id, 0 /* flags */) != xnn_status_success)
+    {
+      xnn_delete_subgraph(subgraph);
+      return nullptr;
+    }
+    input_id = output_id;
+  }
+  return subgraph;
+}
+
+static void FullyConnectedStack(benchmark::State& state, uint32_t flags) {
+  if (xnn_initialize(nullptr /* allocator */) != xnn_status_success) {
+    state.SkipWithError("failed to initialize XNNPACK");
+    return;
+  }
+
+  const size_t num_threads = state.range(0);
+  const size_t batch_size = state.range(1);
+  const size_t num_layers = state.range(2);
+  const size_t channels = state.range(3);
+
+  std::random_device random_device;
+  auto rng = std::mt19937(random_device());
+  auto f32rng = std::bind(std::uniform_real_distribution<float>(-1.0f, 1.0f), std::ref(rng));
+
+  std::vector<float> kernel(num_layers * channels * channels);
+  std::vector<float> bias(num_layers * channels);
+  std::generate(kernel.begin(), kernel.end(), std::ref(f32rng));
+  std::generate(bias.begin(), bias.end(), std::ref(f32rng));
+  std::vector<float> input(batch_size * channels + XNN_EXTRA_BYTES / sizeof(float));
+  std::vector<float> output(batch_size * channels);
+  std::generate(input.begin(), input.end(), std::ref(f32rng));
+
+  std::unique_ptr<pthreadpool, decltype(&pthreadpool_destroy)> threadpool(
+    pthreadpool_create(num_threads), pthreadpool_destroy);
+
+  std::unique_ptr<xnn_subgraph, decltype(&xnn_delete_subgraph)> subgraph(
+    CreateFullyConnectedStack(batch_size, num_layers, channels, kernel, bias), xnn_delete_subgraph);
+  if (subgraph == nullptr) {
+    state.SkipWithError("failed to create a subgraph");
+    return;
+  }
+
+  xnn_runtime_t runtime = nullptr;
+  if (xnn_create_runtime_v3(subgraph.get(), nullptr /* workspace */, threadpool.get(), flags, &runtime) !=
+      xnn_status_success)
+  {
+    state.SkipWithError("failed to create a runtime");
+    return;
+  }
+  std::unique_ptr<xnn_runtime, decltype(&xnn_delete_runtime)> auto_runtime(runtime, xnn_delete_runtime);
+
+  const std::array<xnn_external_value, 2> external_values = {{
+    xnn_external_value{0, input.data()},
+    xnn_external_value{1, output.data()},
+  }};
+  if (xnn_setup_runtime(runtime, external_values.size(), external_values.data()) != xnn_status_success) {
+    state.SkipWithError("failed to setup a runtime");
+    return;
+  }
+
+  for (auto _ : state) {
+    if (xnn_invoke_runtime(runtime) != xnn_status_success) {
+      state.SkipWithError("failed to invoke a runtime");
+      return;
+    }
+  }
+
+  state.counters["bytes"] = benchmark::Counter(
+    uint64_t(state.iterations()) * kernel.size() * sizeof(float),
+    benchmark::Counter::kIsRate);
+
+  const uint64_t cpu_frequency = benchmark::utils::GetCurrentCpuFrequency();
+  if (cpu_frequency != 0) {
+    state.counters["cpufreq"] = cpu_frequency;
+  }
+}
+
+static void FullyConnectedStackArguments(benchmark::internal::Benchmark* benchmark) {
+  benchmark->ArgNames({"T", "B", "L", "C"});
+  for (int64_t t : {1, 4}) {
+    for (int64_t b : {1, 16}) {
+      // 6 layers of 4096x4096 F32 weights are 384 MB of packed weights.
+      benchmark->Args({t, b, 6, 4096});
+      benchmark->Args({t, b, 24, 1024});
+    }
+  }
+}
+
+static void FP32FullyConnectedStack(benchmark::State& state) {
+  FullyConnectedStack(state, 0 /* flags */);
+}
+
+static void FP32FullyConnectedStackHugePages(benchmark::State& state) {
+  FullyConnectedStack(state, XNN_FLAG_HUGE_PAGES);
+}
+
+BENCHMARK(FP32FullyConnectedStack)->Apply(FullyConnectedStackArguments)->Unit(benchmark::kMillisecond)->UseRealTime();
+BENCHMARK(FP32FullyConnectedStackHugePages)->Apply(FullyConnectedStackArguments)->Unit(benchmark::kMillisecond)->UseRealTime();
+
+#ifndef XNNPACK_BENCHMARK_NO_MAIN
+BENCHMARK_MAIN();
+#endif
@@ -0,0 +1,143 @@
+// Copyright 2022 Google LLC
+//
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree.
+
+// Memory footprint of the end-to-end models: bytes allocated by XNNPACK for the operators of a model after their
+// creation and setup, by memory category. Time is not the metric of interest in this benchmark, the counters are.
+
+#include <array>
+#include <memory>
+
+#include <xnnpack.h>
+
+#include <benchmark/benchmark.h>
+
+#include "bench/utils.h"
+#include "models/models.h"
+
+
+static const std::array<const char*, XNN_NUM_MEMORY_CATEGORIES> kMemoryCategoryNames = {{
+  "other",
+  "packed_weights",
+  "workspace",
+  "indirection",
+  "zero_buffer",
+  "scratch",
+  "code",
+}};
+
+static void MemoryFootprintBenchmark(
+  benchmark::State& state,
+  models::ExecutionPlanFactory model_factory)
+{
+  if (xnn_initialize(nullptr /* allocator */) != xnn_status_success) {
+    state.SkipWithError("failed to initialize XNNPACK");
+    return;
+  }
+
+  xnn_memory_usage usage_before = { };
+  xnn_memory_usage usage_after = { };
+  for (auto _ : state) {
+    xnn_get_memory_usage(&usage_before);
+    auto execution_plan = model_factory(nullptr /* threadpool */);
+    if (execution_plan.empty()) {
+      state.SkipWithError("failed to create a model");
+      return;
+    }
+    xnn_get_memory_usage(&usage_after);
+  }
+
+  for (size_t i = 0; i < XNN_NUM_MEMORY_CATEGORIES; i++) {
+    state.counters[kMemoryCategoryNames[i]] =
+      benchmark::Counter(double(usage_after.current_bytes[i] - usage_before.current_bytes[i]),
+        benchmark::Counter::kDefaults, benchmark::Counter::kIs1024);
+  }
+  state.counters["total"] = benchmark::Counter(
+    double(usage_after.current_total_bytes - usage_before.current_total_bytes),
+    benchmark::Counter::kDefaults, benchmark::Counter::kIs1024);
+}
+
+static void FP32MobileNetV1(benchmark::State& state) {
+  MemoryFootprintBenchmark(state, models::FP32MobileNetV1);
+}
+
+static void FP32MobileNetV2(benchmark::State& state) {
+  MemoryFootprintBenchmark(state, models::FP32MobileNetV2);
+}
+
+static void FP32MobileNetV3Large(benchmark::State& state) {
+  MemoryFootprintBenchmark(state, models::FP32MobileNetV3Large);
+}
+
+static void FP32MobileNetV3Small(benchmark::State& state) {
+  MemoryFootprintBenchmark(state, models::FP32MobileNetV3Small);
+}
+
+static void FP32Sparse80MobileNetV1(benchmark::State& state) {
+  MemoryFootprintBenchmark(state, [](pthreadpool_t threadpool) {
+    return models::FP32SparseMobileNetV1(0.8f, threadpool);
+  });
+}
+
+static void FP32Sparse80MobileNetV2(benchmark::State& state) {
+  MemoryFootprintBenchmark(state, [](pthreadpool_t threadpool) {
+    return models::FP32SparseMobileNetV2(0.8f, threadpool);
+  });
+}
+
+static void FP16MobileNetV1(benchmark::State& state) {
+  MemoryFootprintBenchmark(state, models::FP16MobileNetV1);
+}
+
+static void FP16MobileNetV2(benchmark::State& state) {
+  MemoryFootprintBenchmark(state, models::FP16MobileNetV2);
+}
+
+static void QC8MobileNetV1(benchmark::State& state) {
+  MemoryFootprintBenchmark(state, models::QC8MobileNetV1);
+}
+
+static void QC8MobileNetV2(benchmark::State& state) {
+  MemoryFootprintBenchmark(state, models::QC8MobileNetV2);
+}
+
+static void QS8MobileNetV1(benchmark::State& state) {
+  MemoryFootprintBenchmark(state, models::QS8MobileNetV1);
+}
+
+static void QS8MobileNetV2(benchmark::State& state) {
+  MemoryFootprintBenchmark(state, models::QS8MobileNetV2);
+}
+
+static void QU8MobileNetV1(benchmark::State& state) {
+  MemoryFootprintBenchmark(state, models::QU8MobileNetV1);
+}
+
+static void QU8MobileNetV2(benchmark::State& state) {
+  MemoryFootprintBenchmark(state, models::QU8MobileNetV2);
+}
+
+BENCHMARK(FP32MobileNetV1)->Unit(benchmark::kMillisecond)->Iterations(1);
+BENCHMARK(FP32MobileNetV2)->Unit(benchmark::kMillisecond)->Iterations(1);
+BENCHMARK(FP32MobileNetV3Large)->Unit(benchmark::kMillisecond)->Iterations(1);
+BENCHMARK(FP32MobileNetV3Small)->Unit(benchmark::kMillisecond)->Iterations(1);
+
+BENCHMARK(FP32Sparse80MobileNetV1)->Unit(benchmark::kMillisecond)->Iterations(1);
+BENCHMARK(FP32Sparse80MobileNetV2)->Unit(benchmark::kMillisecond)->Iterations(1);
+
+BENCHMARK(FP16MobileNetV1)->Unit(benchmark::kMillisecond)->Iterations(1);
+BENCHMARK(FP16MobileNetV2)->Unit(benchmark::kMillisecond)->Iterations(1);
+
+BENCHMARK(QC8MobileNetV1)->Unit(benchmark::kMillisecond)->Iterations(1);
+BENCHMARK(QC8MobileNetV2)->Unit(benchmark::kMillisecond)->Iterations(1);
+
+BENCHMARK(QS8MobileNetV1)->Unit(benchmark::kMillisecond)->Iterations(1);
+BENCHMARK(QS8MobileNetV2)->Unit(benchmark::kMillisecond)->Iterations(1);
+
+BENCHMARK(QU8MobileNetV1)->Unit(benchmark::kMillisecond)->Iterations(1);
+BENCHMARK(QU8MobileNetV2)->Unit(benchmark::kMillisecond)->Iterations(1);
+
+#ifndef XNNPACK_BENCHMARK_NO_MAIN
+BENCHMARK_MAIN();
+#endif
@@ -24,6 +24,10 @@ extern "C" {
 /// Note: XNNPACK reads, but never writes beyond array bounds.
 #define XNN_EXTRA_BYTES 16
 
+/// Alignment, in bytes, of caller-owned packed weights passed to the xnn_pack_*_weights and
+/// xnn_create_*_with_packed_weights functions.
+#define XNN_PACKED_WEIGHTS_ALIGNMENT 64
+
 /// Maximum number of dimensions in tensor shape.
 #define XNN_MAX_TENSOR_DIMS 6
 
@@ -72,6 +76,68 @@ extern "C" {
 /// Yield worker threads of the thread pool to the system scheduler after the inference.
 #define XNN_FLAG_YIELD_WORKERS 0x00000010
 
+/// Run all operators of a Runtime in a single thread pool dispatch, with worker threads waiting for the completion of
+/// every operator instead of being woken up for every operator.
+#define XNN_FLAG_PERSISTENT_PARALLEL_REGION 0x00000020
+
+/// Benchmark candidate micro-kernels and tile sizes on the actual shape of the weights when creating an operator (or
+/// all eligible operators of a Runtime), and use the fastest candidate.
+///
+/// Note: the first creation of an operator with a given shape is substantially slower. Decisions are remembered for the
+/// lifetime of the process, and can be persisted across restarts with @ref xnn_save_autotuning_cache and
+/// @ref xnn_load_autotuning_cache. Currently only F32 Fully Connected and F32 Convolution operators are autotuned.
+/// On x86, most candidate micro-kernels are only built with the XNNPACK_ENABLE_AUTOTUNE_CANDIDATES CMake option (or
+/// --define=xnn_enable_autotune_candidates=true in Bazel); otherwise operators keep the default micro-kernels when
+/// there is no alternative to benchmark.
+#define XNN_FLAG_AUTOTUNE 0x00000040
+
+/// Defer packing of the weights of an operator until its first setup, and pack them in parallel on the thread pool
+/// passed to the setup function.
+///
+/// Note: the kernel and bias passed to the create function must stay valid until the first setup. Currently only
+/// Fully Connected operators with non-transposed weights and GEMM/IGEMM-based Convolution operators defer packing, and
+/// other operators pack their weights in the create function regardless of this flag.
+#define XNN_FLAG_DEFER_PACKING 0x00000080
+
+/// Store the indirection buffer of an operator as 32-bit offsets from the input rather than as pointers, halving its
+/// size on 64-bit systems at the cost of expanding one output tile of offsets before every micro-kernel call.
+///
+/// Note: the flag is ignored on 32-bit systems and for inputs larger than 4 GB. Currently only IGEMM-based Convolution
+/// operators use compact indirection buffers.
+#define XNN_FLAG_COMPACT_INDIRECTION 0x00000100
+
+/// Allocate large buffers of an operator (or of all eligible operators and the workspace of a Runtime) in memory
+/// aligned to huge pages, and advise the operating system to back it with transparent huge pages, which reduces TLB
+/// misses when streaming hundreds of megabytes of weights.
+///
+/// Note: huge pages are a hint, and the memory silently falls back to regular pages if the operating system does not
+/// support transparent huge pages or has none available. Currently only the packed weights of Fully Connected and
+/// Convolution operators and Runtime workspaces use huge pages, and only on Linux and Android.
+#define XNN_FLAG_HUGE_PAGES 0x00000200
+
+/// Pad by reflecting the input around its first and last elements, which are not repeated: [1, 2, 3] padded with 2
+/// elements on each side becomes [3, 2, 1, 2, 3, 2, 1]. The padding in every dimension must be smaller than the size
+/// of the dimension.
+///
+/// Note: Pad operators require exactly one of the padding mode flags. Convolution operators apply the padding mode to
+/// their implicit padding through the indirection buffer, and don't materialize the padded input.
+#define XNN_FLAG_REFLECT_PADDING 0x00000400
+
+/// Pad by mirroring the input including its first and last elements: [1, 2, 3] padded with 2 elements on each side
+/// becomes [2, 1, 1, 2, 3, 3, 2]. The padding in every dimension must not exceed the size of the dimension.
+#define XNN_FLAG_SYMMETRIC_PADDING 0x00000800
+
+/// Pad by replicating the first and last elements of the input: [1, 2, 3] padded with 2 elements on each side becomes
+/// [1, 1, 1, 2, 3, 3, 3].
+#define XNN_FLAG_EDGE_PADDING 0x00001000
+
+/// Make a 1D Convolution operator stateful: every setup call passes the next chunk of an unbounded input sequence, and
+/// the operator retains the input frames still needed by future outputs, so that each chunk computes only new outputs.
+///
+/// Note: the left padding of a streaming operator specifies the number of zero frames which precede the sequence, and
+/// the right padding must be zero.
+#define XNN_FLAG_STREAMING 0x00002000
+
 /// Status code for any XNNPACK function call.
 enum xnn_status {
   /// The call succeeded, and all output arguments now contain valid data.
@@ -154,6 +220,68 @@ enum xnn_status xnn_initialize(const struct xnn_allocator* allocator);
 /// @retval xnn_status_success - deinitialization call succeeded.
 enum xnn_status xnn_deinitialize(void);
 
+/// Load micro-kernel selection decisions, previously saved with @ref xnn_save_autotuning_cache, into the autotuning
+/// cache of the process. Operators created with XNN_FLAG_AUTOTUNE for the loaded shapes reuse the decisions instead
+/// of benchmarking. Decisions saved on a processor with a different set of candidate micro-kernels are ignored.
+///
+/// @param path - path to the file with the saved decisions.
+///
+/// @retval xnn_status_success - the decisions were loaded, or ignored as made for a different processor.
+/// @retval xnn_status_uninitialized - XNNPACK is not initialized.
+/// @retval xnn_status_invalid_parameter - the file can not be read, or it is not a valid autotuning cache.
+/// @retval xnn_status_out_of_memory - failed to allocate memory for the loaded decisions.
+enum xnn_status xnn_load_autotuning_cache(const char* path);
+
+/// Save all micro-kernel selection decisions made or loaded by the process to a file.
+///
+/// @param path - path to the file to write. An existing file is overwritten.
+///
+/// @retval xnn_status_success - the decisions were saved.
+/// @retval xnn_status_uninitialized - XNNPACK is not initialized.
+/// @retval xnn_status_invalid_parameter - the file can not be written.
+enum xnn_status xnn_save_autotuning_cache(const char* path);
+
+/// Categories of memory allocated by XNNPACK, for memory accounting.
+enum xnn_memory_category {
+  /// Operator, Subgraph, and Runtime descriptors, and other memory not covered by a specific category.
+  xnn_memory_category_other = 0,
+  /// Weights packed into the layout of the micro-kernels, and lookup tables.
+  xnn_memory_category_packed_weights,
+  /// Workspaces of Runtimes, which hold intermediate tensors.
+  xnn_memory_category_workspace,
+  /// Indirection buffers of convolution, deconvolution, pooling, and resize operators.
+  xnn_memory_category_indirection,
+  /// Zero buffers which implicit padding points to.
+  xnn_memory_category_zero_buffer,
+  /// Scratch memory for intermediate results inside operators.
+  xnn_memory_category_scratch,
+  /// Executable memory of JIT-generated micro-kernels.
+  xnn_memory_category_code,
+};
+
+/// Number of memory categories in enum xnn_memory_category.
+#define XNN_NUM_MEMORY_CATEGORIES 7
+
+/// Memory allocated by XNNPACK, in bytes, by category (indexed by enum xnn_memory_category) and in total.
+struct xnn_memory_usage {
+  /// Memory currently allocated.
+  size_t current_bytes[XNN_NUM_MEMORY_CATEGORIES];
+  /// Maximum of the memory allocated at any time.
+  size_t peak_bytes[XNN_NUM_MEMORY_CATEGORIES];
+  /// Total memory currently allocated.
+  size_t current_total_bytes;
+  /// Maximum of the total memory allocated at any time, which can be less than the sum of peaks of categories.
+  size_t peak_total_bytes;
+};
+
+/// Query the memory allocated by XNNPACK in the whole process, through the allocator passed to @ref xnn_initialize or
+/// by mapping executable memory for JIT-generated micro-kernels.
+///
+/// Note: memory owned by the caller, such as pre-packed weights and static tensors of Subgraphs, is not included.
+///
+/// @param usage_out - pointer to the structure that will be filled with the memory usage upon successful return.
+enum xnn_status xnn_get_memory_usage(struct xnn_memory_usage* usage_out);
+
 /// Subgraph is an abstract representation of a neural network model.
 /// Subgraph objects are used to define Values (tensors) and Nodes (operators) comprising the model.
 typedef struct xnn_subgraph* xnn_subgraph_t;
@@ -494,6 +622,27 @@ enum xnn_status xnn_define_depth_to_space(
   uint32_t block_size,
   uint32_t flags);
 
+/// Define a Space To Depth Node and add it to a Subgraph.
+///
+/// The Space To Depth Node rearranges blocks of spatial data into depth (a reverse transform to Depth To Space). Each
+/// non-overlapping square of input pixels with side @a block_size is folded into a single output pixel, with channels
+/// ordered by block row, block column, and input channel. The output depth is therefore @a block_size x @a block_size
+/// times larger than that of the input.
+///
+/// @param subgraph - a Subgraph object that will own the created Node.
+/// @param input_id - Value ID for the input tensor. The input tensor must be a 4D tensor defined in the @a subgraph
+///                   with [N, OH * block_size, OW * block_size, IC] dimensions.
+/// @param output_id - Value ID for the output tensor. The output tensor must be a 4D tensor defined in the @a subgraph
+///                    with [N, OH, OW, IC * block_size * block_size] dimensions.
+/// @param block_size - the size of the spatial block.
+/// @param flags - binary features of the Space To Depth Node. No supported flags are currently defined.
+enum xnn_status xnn_define_space_to_depth(
+  xnn_subgraph_t subgraph,
+  uint32_t input_id,
+  uint32_t output_id,
+  uint32_t block_size,
+  uint32_t flags);
+
 /// Define a 2D Global Average Pooling Node and add it to a Subgraph.
 ///
 /// @param subgraph - a Subgraph object that will own the created Node.
@@ -536,7 +685,9 @@ enum xnn_status xnn_define_global_average_pooling_2d(
 /// @param output_id - Value ID for the output tensor. The output tensor must be a 4D tensor defined in the @a subgraph
 ///                    with [N, OH, OW, channels] dimensions.
 /// @param flags - binary features of the 2D Average Pooling Node. The only currently supported values is
-///                XNN_FLAG_TENSORFLOW_SAME_PADDING.
+///                XNN_FLAG_TENSORFLOW_SAME_PADDING. Nodes with quantized input and output tensors support neither
+///                XNN_FLAG_TENSORFLOW_SAME_PADDING nor explicit padding, because quantized operators would count the
+///                padding in the average.
 enum xnn_status xnn_define_average_pooling_2d(
   xnn_subgraph_t subgraph,
   uint32_t input_padding_top,
@@ -906,6 +1057,101 @@ enum xnn_status xnn_define_static_constant_pad(
   uint32_t output_id,
   uint32_t flags);
 
+/// Define a Pad Node with static padding specification and a reflect, symmetric, or edge padding mode, and add it to a
+/// Subgraph.
+///
+/// @param subgraph - a Subgraph object that will own the created Node.
+/// @param pre_paddings - number of padding elements to insert before input elements for every dimension. This array
+///                       must have as many elements as the the number of dimensions in the input tensor.
+/// @param post_paddings - number of padding elements to insert after input elements for every dimension. This array
+///                        must have as many elements as the the number of dimensions in the input tensor.
+/// @param input_id - Value ID for the input tensor. The input tensor must be defined in the @a subgraph.
+/// @param output_id - Value ID for the output tensor. The output tensor must be defined in the @a subgraph, and its
+///                    shape must match the shape of the input tensor with padding.
+/// @param flags - binary features of the Pad Node. Exactly one of XNN_FLAG_REFLECT_PADDING, XNN_FLAG_SYMMETRIC_PADDING,
+///                and XNN_FLAG_EDGE_PADDING must be specified. When the Node pads only the spatial dimensions of a 4D
+///                tensor consumed by a single Convolution 2D or Depthwise Convolution 2D Node, it is fused into the
+///                indirection buffer of the Convolution.
+enum xnn_status xnn_define_static_pad(
+  xnn_subgraph_t subgraph,
+  const size_t* pre_paddings,
+  const size_t* post_paddings,
+  uint32_t input_id,
+  uint32_t output_id,
+  uint32_t flags);
+
+/// Define a Reduce Maximum Node with static reduction axes specification and add it to a Subgraph.
+///
+/// @param subgraph - a Subgraph object that will own the created Node.
+/// @param num_reduction_axes - number of axes along which the reduction is computed.
+/// @param reduction_axes - axes along which the reduction is computed, in strictly ascending order.
+/// @param input_id - Value ID for the input tensor. The input tensor must be defined in the @a subgraph.
+/// @param output_id - Value ID for the output tensor. The output tensor must be defined in the @a subgraph, and it
+///                    must have as many elements as the non-reduced dimensions of the input tensor. The reduced
+///                    dimensions may either be omitted from the output shape or kept with size 1.
+/// @param flags - binary features of the Reduce Maximum Node. No supported flags are currently defined.
+enum xnn_status xnn_define_static_reduce_max(
+  xnn_subgraph_t subgraph,
+  size_t num_reduction_axes,
+  const size_t* reduction_axes,
+  uint32_t input_id,
+  uint32_t output_id,
+  uint32_t flags);
+
+/// Define a Reduce Mean Node with static reduction axes specification and add it to a Subgraph.
+///
+/// @param subgraph - a Subgraph object that will own the created Node.
+/// @param num_reduction_axes - number of axes along which the reduction is computed.
+/// @param reduction_axes - axes along which the reduction is computed, in strictly ascending order.
+/// @param input_id - Value ID for the input tensor. The input tensor must be defined in the @a subgraph.
+/// @param output_id - Value ID for the output tensor. The output tensor must be defined in the @a subgraph, and it
+///                    must have as many elements as the non-reduced dimensions of the input tensor. The reduced
+///                    dimensions may either be omitted from the output shape or kept with size 1.
+/// @param flags - binary features of the Reduce Mean Node. No supported flags are currently defined.
+enum xnn_status xnn_define_static_reduce_mean(
+  xnn_subgraph_t subgraph,
+  size_t num_reduction_axes,
+  const size_t* reduction_axes,
+  uint32_t input_id,
+  uint32_t output_id,
+  uint32_t flags);
+
+/// Define a Reduce Minimum Node with static reduction axes specification and add it to a Subgraph.
+///
+/// @param subgraph - a Subgraph object that will own the created Node.
+/// @param num_reduction_axes - number of axes along which the reduction is computed.
+/// @param reduction_axes - axes along which the reduction is computed, in strictly ascending order.
+/// @param input_id - Value ID for the input tensor. The input tensor must be defined in the @a subgraph.
+/// @param output_id - Value ID for the output tensor. The output tensor must be defined in the @a subgraph, and it
+///                    must have as many elements as the non-reduced dimensions of the input tensor. The reduced
+///                    dimensions may either be omitted from the output shape or kept with size 1.
+/// @param flags - binary features of the Reduce Minimum Node. No supported flags are currently defined.
+enum xnn_status xnn_define_static_reduce_min(
+  xnn_subgraph_t subgraph,
+  size_t num_reduction_axes,
+  const size_t* reduction_axes,
+  uint32_t input_id,
+  uint32_t output_id,
+  uint32_t flags);
+
+/// Define a Reduce Sum Node with static reduction axes specification and add it to a Subgraph.
+///
+/// @param subgraph - a Subgraph object that will own the created Node.
+/// @param num_reduction_axes - number of axes along which the reduction is computed.
+/// @param reduction_axes - axes along which the reduction is computed, in strictly ascending order.
+/// @param input_id - Value ID for the input tensor. The input tensor must be defined in the @a subgraph.
+/// @param output_id - Value ID for the output tensor. The output tensor must be defined in the @a subgraph, and it
+///                    must have as many elements as the non-reduced dimensions of the input tensor. The reduced
+///                    dimensions may either be omitted from the output shape or kept with size 1.
+/// @param flags - binary features of the Reduce Sum Node. No supported flags are currently defined.
+enum xnn_status xnn_define_static_reduce_sum(
+  xnn_subgraph_t subgraph,
+  size_t num_reduction_axes,
+  const size_t* reduction_axes,
+  uint32_t input_id,
+  uint32_t output_id,
+  uint32_t flags);
+
 /// Define a Reshape Node with static shape specification and add it to a Subgraph.
 ///
 /// @param subgraph - a Subgraph object that will own the created Node.
@@ -942,6 +1188,54 @@ enum xnn_status xnn_define_static_resize_bilinear_2d(
   uint32_t output_id,
   uint32_t flags);
 
+/// Define a 2D Resize Nearest Neighbor Node with static output height & width specification and add it to a Subgraph.
+///
+/// @param subgraph - a Subgraph object that will own the created Node.
+/// @param new_height - height dimension of the output tensor.
+/// @param new_width - width dimension of the output tensor.
+/// @param input_id - Value ID for the input tensor. The input tensor must be a 4D tensor defined in the @a subgraph
+///                   with [N, H, W, C] dimensions.
+/// @param output_id - Value ID for the output tensor. The output tensor must be a 4D tensor defined in the @a subgraph
+///                    with [N, new_height, new_width, C] dimensions.
+/// @param flags - binary features of the 2D Resize Nearest Neighbor Node. The only currently supported values are
+///                XNN_FLAG_TENSORFLOW_LEGACY_MODE and XNN_FLAG_ALIGN_CORNERS, which are mutually exclusive.
+enum xnn_status xnn_define_static_resize_nearest_2d(
+  xnn_subgraph_t subgraph,
+  size_t new_height,
+  size_t new_width,
+  uint32_t input_id,
+  uint32_t output_id,
+  uint32_t flags);
+
+/// Define a Slice Node with static slicing specification and add it to a Subgraph.
+///
+/// Along every dimension i, the output tensor takes sizes[i] elements of the input tensor, starting at offsets[i] and
+/// advancing by strides[i] elements. When the Runtime can prove the slice to be a contiguous block of memory within the
+/// input tensor, and the output tensor is not an external output, the Node is elided and the output tensor aliases the
+/// input tensor without a copy.
+///
+/// @param subgraph - a Subgraph object that will own the created Node.
+/// @param num_dims - number of dimensions in the input and output tensors.
+/// @param offsets - index of the first input element along every dimension. This array must have @a num_dims
+///                  elements.
+/// @param sizes - number of output elements along every dimension. This array must have @a num_dims elements.
+/// @param strides - distance, in input elements, between consecutive output elements along every dimension. This array
+///                  must have @a num_dims non-zero elements, or be NULL to slice with unit strides.
+/// @param input_id - Value ID for the input tensor. The input tensor must be an N-dimensional tensor defined in the
+///                   @a subgraph with @a num_dims dimensions.
+/// @param output_id - Value ID for the output tensor. The output tensor must be an N-dimensional tensor defined in the
+///                    @a subgraph with @a num_dims dimensions, and its shape must match @a sizes.
+/// @param flags - binary features of the Slice Node. No supported flags are currently defined.
+enum xnn_status xnn_define_static_slice(
+  xnn_subgraph_t subgraph,
+  size_t num_dims,
+  const size_t* offsets,
+  const size_t* sizes,
+  const size_t* strides,
+  uint32_t input_id,
+  uint32_t output_id,
+  uint32_t flags);
+
 /// Define a PReLU (Parametric ReLU) Node and add it to a Subgraph.
 ///
 /// @param subgraph - a Subgraph object that will own the created Node.
@@ -1137,9 +1431,47 @@ enum xnn_status xnn_define_square_root(
   uint32_t output_id,
   uint32_t flags);
 
+/// Workspace is a memory arena for intermediate values of Runtime objects. A single Workspace can be shared by multiple
+/// Runtime objects which are never invoked concurrently, e.g. models executed one after another on the same thread.
+typedef struct xnn_workspace* xnn_workspace_t;
+
+/// Create a Workspace object. The Workspace is initially empty, and grows to the largest requirement of the Runtime
+/// objects created with it.
+///
+/// @param workspace_out - pointer to the variable that will be initialized with a handle to the Workspace object upon
+///                        successful return.
+enum xnn_status xnn_create_workspace(xnn_workspace_t* workspace_out);
+
+/// Release the reference to a Workspace object held by the caller. The memory of the Workspace is released when the
+/// caller and all Runtime objects using the Workspace released it.
+///
+/// @param workspace - the Workspace object to release.
+enum xnn_status xnn_release_workspace(xnn_workspace_t workspace);
+
 /// Runtime is a combination of an execution plan for subgraph Nodes and a memory manager for subgraph Values.
 typedef struct xnn_runtime* xnn_runtime_t;
 
+/// Create a Runtime object from a subgraph, with intermediate values held in a Workspace object.
+///
+/// @param subgraph - a Subgraph object with all Values and Nodes that would be handled by the runtime. No Values or
+///                   Nodes can be added to the runtime once it is constructed.
+/// @param workspace - a Workspace object to hold intermediate values of the runtime. If the Workspace is too small for
+///                    the runtime, it is reallocated, and runtimes already using it are re-bound to the new memory. If
+///                    the workspace is NULL, the runtime allocates a private workspace.
+/// @param threadpool - the thread pool to be used for parallelisation of computations in the runtime. If the thread
+///                     pool is NULL, the computation would run on the caller thread without parallelization.
+/// @param flags - binary features of the runtime. The supported values are the same as for
+///                @ref xnn_create_runtime_v2.
+/// @param runtime_out - pointer to the variable that will be initialized with a handle to the Runtime object upon
+///                      successful return. Once constructed, the Runtime object is independent of the Subgraph object
+///                      used to create it.
+enum xnn_status xnn_create_runtime_v3(
+  xnn_subgraph_t subgraph,
+  xnn_workspace_t workspace,
+  pthreadpool_t threadpool,
+  uint32_t flags,
+  xnn_runtime_t* runtime_out);
+
 /// Create a Runtime object from a subgraph.
 ///
 /// @param subgraph - a Subgraph object with all Values and Nodes that would be handled by the runtime. No Values or
@@ -1147,9 +1479,22 @@ typedef struct xnn_runtime* xnn_runtime_t;
 /// @param threadpool - the thread pool to be used for parallelisation of computations in the runtime. If the thread
 ///                     pool is NULL, the computation would run on the caller thread without parallelization.
 /// @param flags - binary features of the runtime. The only currently supported values are
-///                XNN_FLAG_HINT_SPARSE_INFERENCE, XNN_FLAG_HINT_FP16_INFERENCE, XNN_FLAG_FORCE_FP16_INFERENCE, and
-///                XNN_FLAG_YIELD_WORKERS. If XNN_FLAG_YIELD_WORKERS is specified, worker threads would be yielded to
-///                the system scheduler after processing the last operator in the Runtime.
+///                XNN_FLAG_HINT_SPARSE_INFERENCE, XNN_FLAG_HINT_FP16_INFERENCE, XNN_FLAG_FORCE_FP16_INFERENCE,
+///                XNN_FLAG_YIELD_WORKERS, XNN_FLAG_PERSISTENT_PARALLEL_REGION, XNN_FLAG_AUTOTUNE,
+///                XNN_FLAG_DEFER_PACKING, XNN_FLAG_COMPACT_INDIRECTION, and XNN_FLAG_HUGE_PAGES. If
+///                XNN_FLAG_YIELD_WORKERS is specified, worker threads would be yielded to the system scheduler after
+///                processing the last operator in the Runtime. If XNN_FLAG_PERSISTENT_PARALLEL_REGION is specified,
+///                @ref xnn_invoke_runtime would dispatch the thread pool only once and keep all worker threads
+///                busy-waiting between operators, which reduces latency for small inputs at the cost of spinning worker
+///                threads. The flag is ignored if the thread pool has a single thread. If XNN_FLAG_AUTOTUNE is
+///                specified, the micro-kernels of Fully Connected and Convolution Nodes are selected by benchmarking.
+///                Weights of Fully Connected and Convolution Nodes are packed in parallel on the thread pool before
+///                the Runtime is returned, or, if XNN_FLAG_DEFER_PACKING is specified, in the first
+///                @ref xnn_setup_runtime, so that static data of the subgraph must stay valid until then.
+///                Convolution Nodes with the same input shape, kernel size, stride, dilation, and padding share one
+///                indirection buffer, which XNN_FLAG_COMPACT_INDIRECTION further compacts.
+///                If XNN_FLAG_HUGE_PAGES is specified, the workspace and the packed weights of Fully Connected and
+///                Convolution Nodes are allocated in huge pages.
 /// @param runtime_out - pointer to the variable that will be initialized with a handle to the Runtime object upon
 ///                      successful return. Once constructed, the Runtime object is independent of the Subgraph object
 ///                      used to create it.
@@ -1163,6 +1508,56 @@ enum xnn_status xnn_create_runtime(
   xnn_subgraph_t subgraph,
   xnn_runtime_t* runtime_out);
 
+/// Create a Runtime object which shares operators' packed weights with an existing Runtime.
+///
+/// The clone has its own workspace for intermediate tensors, its own bindings of external values, and its own setup
+/// state of every operator, so the original Runtime and any number of its clones can be setup and invoked concurrently
+/// from different threads. Packed weights, lookup tables, and static tensors are not duplicated, and the memory cost of
+/// the clone is dominated by its workspace. If the Runtime was created with XNN_FLAG_DEFER_PACKING and was not setup
+/// yet, its weights are packed on the thread pool of the clone before they are shared, and the Runtime must not be
+/// setup concurrently with this call.
+///
+/// @param runtime - a Runtime object created with @ref xnn_create_runtime, @ref xnn_create_runtime_v2, or
+///                  @ref xnn_create_runtime_v3. The Runtime must not be deleted before all its clones are deleted. The
+///                  clone always gets a private workspace, even if the Runtime uses a shared Workspace.
+/// @param threadpool - the thread pool to be used for parallelisation of computations in the clone. If the thread pool
+///                     is NULL, the computation would run on the caller thread without parallelization.
+/// @param flags - binary features of the clone. The only currently supported values are
+///                XNN_FLAG_PERSISTENT_PARALLEL_REGION and XNN_FLAG_HUGE_PAGES, which allocates the workspace of the
+///                clone in huge pages.
+/// @param runtime_out - pointer to the variable that will be initialized with a handle to the cloned Runtime object
+///                      upon successful return. External values of the clone must be specified via
+///                      @ref xnn_setup_runtime before it can be invoked.
+enum xnn_status xnn_clone_runtime(
+  xnn_runtime_t runtime,
+  pthreadpool_t threadpool,
+  uint32_t flags,
+  xnn_runtime_t* runtime_out);
+
+/// Query the size of the memory arena a Runtime needs for its intermediate values.
+///
+/// @param runtime - a Runtime object created with @ref xnn_create_runtime, @ref xnn_create_runtime_v2, or
+///                  @ref xnn_create_runtime_v3.
+/// @param workspace_size_out - pointer to the variable that will be initialized with the size in bytes of the
+///                             workspace required by the runtime upon successful return.
+enum xnn_status xnn_get_runtime_workspace_size(
+  xnn_runtime_t runtime,
+  size_t* workspace_size_out);
+
+/// Query the memory allocated by XNNPACK for a Runtime: its descriptors, its workspace, and the buffers of its
+/// operators.
+///
+/// Note: a workspace shared by several Runtimes is counted in full for each of them, and memory shared with the
+/// Runtime a clone was created from (packed weights, lookup tables, and JIT-generated code) is counted only for the
+/// original Runtime. Peak memory usage of a Runtime is sampled when it is created and setup, and by this function.
+///
+/// @param runtime - a Runtime object created with @ref xnn_create_runtime, @ref xnn_create_runtime_v2,
+///                  @ref xnn_create_runtime_v3, or @ref xnn_clone_runtime.
+/// @param usage_out - pointer to the structure that will be filled with the memory usage upon successful return.
+enum xnn_status xnn_get_runtime_memory_usage(
+  xnn_runtime_t runtime,
+  struct xnn_memory_usage* usage_out);
+
 struct xnn_external_value {
   uint32_t id;
   void* data;
@@ -1201,6 +1596,20 @@ enum xnn_status xnn_run_operator(
 enum xnn_status xnn_delete_operator(
   xnn_operator_t op);
 
+/// Setup the residual tensor for an operator with a fused residual addition.
+///
+/// The residual tensor has the same shape and layout as the output of the operator, and must not alias the output.
+/// This function must be called before the operator-specific setup function, and the residual pointer is retained
+/// across subsequent setup calls.
+///
+/// @param op - a Convolution or Fully Connected operator with a residual addition fused via xnn_fuse_residual_add_*.
+/// @param residual - pointer to the residual tensor.
+/// @param residual_stride - stride, in elements, between consecutive pixels (rows) of the residual tensor.
+enum xnn_status xnn_setup_residual_add(
+  xnn_operator_t op,
+  const void* residual,
+  size_t residual_stride);
+
 #ifndef XNN_NO_F32_OPERATORS
 
 enum xnn_status xnn_create_abs_nc_f32(
@@ -1327,6 +1736,54 @@ enum xnn_status xnn_setup_clamp_nc_f32(
   float* output,
   pthreadpool_t threadpool);
 
+/// Create a 1D Convolution operator over the width dimension of an NWC tensor.
+///
+/// The kernel has [groups * group_output_channels, kernel_width, group_input_channels] layout, and the operator
+/// computes the same result as a 2D Convolution with a 1-pixel high input and kernel.
+///
+/// With XNN_FLAG_STREAMING, the input of every setup call is the next chunk of the input sequence, and the output
+/// contains the outputs which become computable with this chunk: the concatenation of the outputs of all calls equals
+/// the output of a non-streaming operator applied to the concatenation of all input chunks, with input_padding_left zero
+/// frames before the first chunk. Streaming operators support subsampling up to the dilated kernel width, and need a new
+/// setup call for every chunk.
+enum xnn_status xnn_create_convolution1d_nwc_f32(
+  uint32_t input_padding_left,
+  uint32_t input_padding_right,
+  uint32_t kernel_width,
+  uint32_t subsampling,
+  uint32_t dilation,
+  uint32_t groups,
+  size_t group_input_channels,
+  size_t group_output_channels,
+  size_t input_channel_stride,
+  size_t output_channel_stride,
+  const float* kernel,
+  const float* bias,
+  float output_min,
+  float output_max,
+  uint32_t flags,
+  xnn_operator_t* convolution_op_out);
+
+/// Setup a 1D Convolution operator for a batch of input sequences.
+///
+/// @param input_width - number of frames in every input sequence, or, for streaming operators, in the next chunk of
+///                      every input sequence.
+/// @param output_width - optional pointer to the number of frames which the operator writes to every output sequence.
+///                       Streaming operators may produce a different number of frames for each chunk, including zero.
+enum xnn_status xnn_setup_convolution1d_nwc_f32(
+  xnn_operator_t convolution_op,
+  size_t batch_size,
+  size_t input_width,
+  const float* input,
+  float* output,
+  size_t* output_width,
+  pthreadpool_t threadpool);
+
+/// Reset the state of a streaming 1D Convolution operator to the beginning of new input sequences. The batch size may
+/// change only after a reset.
+enum xnn_status xnn_reset_convolution1d_nwc_f32(
+  xnn_operator_t convolution_op);
+
 enum xnn_status xnn_create_convolution2d_nhwc_f32(
   uint32_t input_padding_top,
   uint32_t input_padding_right,
@@ -1350,6 +1807,67 @@ enum xnn_status xnn_create_convolution2d_nhwc_f32(
   uint32_t flags,
   xnn_operator_t* convolution_op_out);
 
+/// Pack the weights of a F32 Convolution operator into caller-owned memory, for later creation of operators with
+/// xnn_create_convolution2d_nhwc_f32_with_packed_weights without repacking, e.g. from a file mapped into memory and
+/// shared across processes. Other parameters have the same meaning as in xnn_create_convolution2d_nhwc_f32, and the
+/// flags must match the flags passed at creation.
+///
+/// @param packed_weights - memory for the packed weights, aligned to XNN_PACKED_WEIGHTS_ALIGNMENT bytes, or NULL to
+///                         only compute the size and fingerprint of the packed weights.
+/// @param packed_weights_size - on input, the size of the memory pointed to by packed_weights in bytes. On output, the
+///                              size of the packed weights in bytes.
+/// @param packed_weights_fingerprint - on output, the fingerprint of the packed weights layout, which depends on the
+///                                     operator configuration and on the micro-kernels selected for the processor.
+enum xnn_status xnn_pack_convolution2d_nhwc_f32_weights(
+  uint32_t input_padding_top,
+  uint32_t input_padding_right,
+  uint32_t input_padding_bottom,
+  uint32_t input_padding_left,
+  uint32_t kernel_height,
+  uint32_t kernel_width,
+  uint32_t subsampling_height,
+  uint32_t subsampling_width,
+  uint32_t dilation_height,
+  uint32_t dilation_width,
+  uint32_t groups,
+  size_t group_input_channels,
+  size_t group_output_channels,
+  const float* kernel,
+  const float* bias,
+  uint32_t flags,
+  void* packed_weights,
+  size_t* packed_weights_size,
+  uint64_t* packed_weights_fingerprint);
+
+/// Create a F32 Convolution operator that uses packed weights and their fingerprint produced by
+/// xnn_pack_convolution2d_nhwc_f32_weights, without copying them. The packed weights must stay valid and unmodified for
+/// the lifetime of the operator, and of any Runtime sharing it, and the operator never writes to them. Creation fails
+/// with xnn_status_unsupported_parameter if the fingerprint does not match the operator configuration on this
+/// processor, in which case the caller should repack the original weights.
+enum xnn_status xnn_create_convolution2d_nhwc_f32_with_packed_weights(
+  uint32_t input_padding_top,
+  uint32_t input_padding_right,
+  uint32_t input_padding_bottom,
+  uint32_t input_padding_left,
+  uint32_t kernel_height,
+  uint32_t kernel_width,
+  uint32_t subsampling_height,
+  uint32_t subsampling_width,
+  uint32_t dilation_height,
+  uint32_t dilation_width,
+  uint32_t groups,
+  size_t group_input_channels,
+  size_t group_output_channels,
+  size_t input_channel_stride,
+  size_t output_channel_stride,
+  const void* packed_weights,
+  size_t packed_weights_size,
+  uint64_t packed_weights_fingerprint,
+  float output_min,
+  float output_max,
+  uint32_t flags,
+  xnn_operator_t* convolution_op_out);
+
 enum xnn_status xnn_setup_convolution2d_nhwc_f32(
   xnn_operator_t convolution_op,
   size_t batch_size,
@@ -1359,6 +1877,38 @@ enum xnn_status xnn_setup_convolution2d_nhwc_f32(
   float* output,
   pthreadpool_t threadpool);
 
+/// Create an operator which executes an inverted bottleneck block (1x1 expansion Convolution, Depthwise Convolution,
+/// and 1x1 projection Convolution) depth-first, in strips of output rows, without materializing the full intermediate
+/// tensors.
+///
+/// On success, the new operator takes ownership of the three Convolution operators, and they must not be used or
+/// deleted by the caller. On failure, the ownership stays with the caller.
+///
+/// @param expand_op - an ungrouped 1x1 Convolution (NHWC, F32) operator with unit stride and no padding.
+/// @param depthwise_op - a depthwise Convolution (NHWC, F32) operator with a depth multiplier of 1 and a number of
+///                       groups equal to the number of output channels of @a expand_op. The operator must use zero
+///                       padding: reflect, symmetric, and edge padding modes are not supported.
+/// @param project_op - an ungrouped 1x1 Convolution (NHWC, F32) operator with unit stride and no padding, and a number
+///                     of input channels equal to the number of groups of @a depthwise_op.
+/// @param flags - binary features of the operator. No supported flags are currently defined.
+/// @param inverted_bottleneck_op_out - pointer to the variable that will be initialized with a handle to the operator
+///                                     upon successful return.
+enum xnn_status xnn_create_inverted_bottleneck_nhwc_f32(
+  xnn_operator_t expand_op,
+  xnn_operator_t depthwise_op,
+  xnn_operator_t project_op,
+  uint32_t flags,
+  xnn_operator_t* inverted_bottleneck_op_out);
+
+enum xnn_status xnn_setup_inverted_bottleneck_nhwc_f32(
+  xnn_operator_t inverted_bottleneck_op,
+  size_t batch_size,
+  size_t input_height,
+  size_t input_width,
+  const float* input,
+  float* output,
+  pthreadpool_t threadpool);
+
 enum xnn_status xnn_create_deconvolution2d_nhwc_f32(
   uint32_t output_padding_top,
   uint32_t output_padding_right,
@@ -1451,6 +2001,45 @@ enum xnn_status xnn_create_fully_connected_nc_f32(
   uint32_t flags,
   xnn_operator_t* fully_connected_op_out);
 
+/// Pack the weights of a F32 Fully Connected operator into caller-owned memory, for later creation of operators with
+/// xnn_create_fully_connected_nc_f32_with_packed_weights without repacking, e.g. from a file mapped into memory and
+/// shared across processes. Other parameters have the same meaning as in xnn_create_fully_connected_nc_f32, and the
+/// flags must match the flags passed at creation.
+///
+/// @param packed_weights - memory for the packed weights, aligned to XNN_PACKED_WEIGHTS_ALIGNMENT bytes, or NULL to
+///                         only compute the size and fingerprint of the packed weights.
+/// @param packed_weights_size - on input, the size of the memory pointed to by packed_weights in bytes. On output, the
+///                              size of the packed weights in bytes.
+/// @param packed_weights_fingerprint - on output, the fingerprint of the packed weights layout, which depends on the
+///                                     operator configuration and on the micro-kernels selected for the processor.
+enum xnn_status xnn_pack_fully_connected_nc_f32_weights(
+  size_t input_channels,
+  size_t output_channels,
+  const float* kernel,
+  const float* bias,
+  uint32_t flags,
+  void* packed_weights,
+  size_t* packed_weights_size,
+  uint64_t* packed_weights_fingerprint);
+
+/// Create a F32 Fully Connected operator that uses packed weights and their fingerprint produced by
+/// xnn_pack_fully_connected_nc_f32_weights, without copying them. The packed weights must stay valid and unmodified for
+/// the lifetime of the operator, and of any Runtime sharing it, and the operator never writes to them. Creation fails
+/// with xnn_status_unsupported_parameter if the fingerprint does not match the operator configuration on this
+/// processor, in which case the caller should repack the original weights.
+enum xnn_status xnn_create_fully_connected_nc_f32_with_packed_weights(
+  size_t input_channels,
+  size_t output_channels,
+  size_t input_stride,
+  size_t output_stride,
+  const void* packed_weights,
+  size_t packed_weights_size,
+  uint64_t packed_weights_fingerprint,
+  float output_min,
+  float output_max,
+  uint32_t flags,
+  xnn_operator_t* fully_connected_op_out);
+
 enum xnn_status xnn_setup_fully_connected_nc_f32(
   xnn_operator_t fully_connected_op,
   size_t batch_size,
@@ -1458,6 +2047,17 @@ enum xnn_status xnn_setup_fully_connected_nc_f32(
   float* output,
   pthreadpool_t threadpool);
 
+/// Fuse addition of a residual tensor into the output of a GEMM-based Convolution or Fully Connected operator.
+///
+/// The operator would compute output := clamp(op(input) + residual, output_min, output_max), where op(input) is the
+/// result of the operator, including its own output clamping. The residual tensor is specified via
+/// xnn_setup_residual_add. Only Convolution operators that use GEMM, IGEMM, or direct convolution micro-kernels support
+/// this fusion.
+enum xnn_status xnn_fuse_residual_add_f32(
+  xnn_operator_t op,
+  float output_min,
+  float output_max);
+
 enum xnn_status xnn_create_global_average_pooling_nwc_f32(
   size_t channels,
   size_t input_stride,
@@ -1504,6 +2104,24 @@ enum xnn_status xnn_setup_leaky_relu_nc_f32(
   float* output,
   pthreadpool_t threadpool);
 
+/// Reduction operators (Max, Mean, Min, Sum) compute the output by reducing the input tensor along the reduction axes,
+/// given in strictly ascending order. The output tensor has the shape of the input tensor with the reduced dimensions
+/// removed (or, equivalently, set to 1). F16 and QS8 reductions support only reduction axes that are adjacent after
+/// removing dimensions of size 1, and fail at setup with xnn_status_unsupported_parameter otherwise.
+enum xnn_status xnn_create_max_nd_f32(
+  uint32_t flags,
+  xnn_operator_t* max_op_out);
+
+enum xnn_status xnn_setup_max_nd_f32(
+  xnn_operator_t max_op,
+  size_t num_reduction_axes,
+  const size_t* reduction_axes,
+  size_t num_input_dims,
+  const size_t* input_shape,
+  const float* input,
+  float* output,
+  pthreadpool_t threadpool);
+
 enum xnn_status xnn_create_max_pooling2d_nhwc_f32(
   uint32_t input_padding_top,
   uint32_t input_padding_right,
@@ -1547,15 +2165,43 @@ enum xnn_status xnn_setup_maximum_nd_f32(
   float* output,
   pthreadpool_t threadpool);
 
-enum xnn_status xnn_create_minimum_nd_f32(
+enum xnn_status xnn_create_mean_nd_f32(
   uint32_t flags,
-  xnn_operator_t* minimum_op_out);
+  xnn_operator_t* mean_op_out);
 
-enum xnn_status xnn_setup_minimum_nd_f32(
-  xnn_operator_t minimum_op,
-  size_t num_input1_dims,
-  const size_t* input1_shape,
-  size_t num_input2_dims,
+enum xnn_status xnn_setup_mean_nd_f32(
+  xnn_operator_t mean_op,
+  size_t num_reduction_axes,
+  const size_t* reduction_axes,
+  size_t num_input_dims,
+  const size_t* input_shape,
+  const float* input,
+  float* output,
+  pthreadpool_t threadpool);
+
+enum xnn_status xnn_create_min_nd_f32(
+  uint32_t flags,
+  xnn_operator_t* min_op_out);
+
+enum xnn_status xnn_setup_min_nd_f32(
+  xnn_operator_t min_op,
+  size_t num_reduction_axes,
+  const size_t* reduction_axes,
+  size_t num_input_dims,
+  const size_t* input_shape,
+  const float* input,
+  float* output,
+  pthreadpool_t threadpool);
+
+enum xnn_status xnn_create_minimum_nd_f32(
+  uint32_t flags,
+  xnn_operator_t* minimum_op_out);
+
+enum xnn_status xnn_setup_minimum_nd_f32(
+  xnn_operator_t minimum_op,
+  size_t num_input1_dims,
+  const size_t* input1_shape,
+  size_t num_input2_dims,
   const size_t* input2_shape,
   const float* input1,
   const float* input2,
@@ -1732,6 +2378,20 @@ enum xnn_status xnn_setup_subtract_nd_f32(
   float* output,
   pthreadpool_t threadpool);
 
+enum xnn_status xnn_create_sum_nd_f32(
+  uint32_t flags,
+  xnn_operator_t* sum_op_out);
+
+enum xnn_status xnn_setup_sum_nd_f32(
+  xnn_operator_t sum_op,
+  size_t num_reduction_axes,
+  const size_t* reduction_axes,
+  size_t num_input_dims,
+  const size_t* input_shape,
+  const float* input,
+  float* output,
+  pthreadpool_t threadpool);
+
 enum xnn_status xnn_create_truncation_nc_f32(
   size_t channels,
   size_t input_stride,
@@ -1831,6 +2491,20 @@ enum xnn_status xnn_setup_constant_pad_nd_x32(
   void* output,
   pthreadpool_t threadpool);
 
+enum xnn_status xnn_create_pad_nd_x32(
+  uint32_t flags,
+  xnn_operator_t* pad_op_out);
+
+enum xnn_status xnn_setup_pad_nd_x32(
+  xnn_operator_t pad_op,
+  size_t num_dims,
+  const size_t* input_shape,
+  const size_t* pre_padding,
+  const size_t* post_padding,
+  const void* input,
+  void* output,
+  pthreadpool_t threadpool);
+
 enum xnn_status xnn_create_copy_nc_x32(
   size_t channels,
   size_t input_stride,
@@ -1879,6 +2553,56 @@ enum xnn_status xnn_setup_depth_to_space_nchw2nhwc_x32(
   void* output,
   pthreadpool_t threadpool);
 
+enum xnn_status xnn_create_resize_nearest2d_nhwc_x32(
+  size_t channels,
+  size_t input_pixel_stride,
+  size_t output_pixel_stride,
+  uint32_t flags,
+  xnn_operator_t* resize_op_out);
+
+enum xnn_status xnn_setup_resize_nearest2d_nhwc_x32(
+  xnn_operator_t resize_op,
+  size_t batch_size,
+  size_t input_height,
+  size_t input_width,
+  size_t output_height,
+  size_t output_width,
+  const void* input,
+  void* output,
+  pthreadpool_t threadpool);
+
+enum xnn_status xnn_create_slice_nd_x32(
+  uint32_t flags,
+  xnn_operator_t* slice_op_out);
+
+enum xnn_status xnn_setup_slice_nd_x32(
+  xnn_operator_t slice_op,
+  size_t num_dims,
+  const size_t* input_shape,
+  const size_t* offsets,
+  const size_t* sizes,
+  const size_t* strides,
+  const void* input,
+  void* output,
+  pthreadpool_t threadpool);
+
+enum xnn_status xnn_create_space_to_depth_nhwc_x32(
+  size_t input_channels,
+  size_t input_channel_stride,
+  size_t output_channel_stride,
+  uint32_t block_size,
+  uint32_t flags,
+  xnn_operator_t* space_to_depth_op_out);
+
+enum xnn_status xnn_setup_space_to_depth_nhwc_x32(
+  xnn_operator_t space_to_depth_op,
+  size_t batch_size,
+  size_t input_height,
+  size_t input_width,
+  const void* input,
+  void* output,
+  pthreadpool_t threadpool);
+
 enum xnn_status xnn_create_unpooling2d_nhwc_x32(
   uint32_t input_padding_top,
   uint32_t input_padding_right,
@@ -1923,6 +2647,32 @@ enum xnn_status xnn_setup_add_nd_f16(
   void* output,
   pthreadpool_t threadpool);
 
+enum xnn_status xnn_create_average_pooling2d_nhwc_f16(
+  uint32_t input_padding_top,
+  uint32_t input_padding_right,
+  uint32_t input_padding_bottom,
+  uint32_t input_padding_left,
+  uint32_t pooling_height,
+  uint32_t pooling_width,
+  uint32_t stride_height,
+  uint32_t stride_width,
+  size_t channels,
+  size_t input_pixel_stride,
+  size_t output_pixel_stride,
+  float output_min,
+  float output_max,
+  uint32_t flags,
+  xnn_operator_t* average_pooling_op_out);
+
+enum xnn_status xnn_setup_average_pooling2d_nhwc_f16(
+  xnn_operator_t average_pooling_op,
+  size_t batch_size,
+  size_t input_height,
+  size_t input_width,
+  const void* input,
+  void* output,
+  pthreadpool_t threadpool);
+
 enum xnn_status xnn_create_clamp_nc_f16(
   size_t channels,
   size_t input_stride,
@@ -2024,6 +2774,14 @@ enum xnn_status xnn_setup_fully_connected_nc_f16(
   void* output,
   pthreadpool_t threadpool);
 
+/// Fuse addition of a residual tensor into the output of a GEMM-based Convolution or Fully Connected operator.
+///
+/// See xnn_fuse_residual_add_f32 for details.
+enum xnn_status xnn_fuse_residual_add_f16(
+  xnn_operator_t op,
+  float output_min,
+  float output_max);
+
 enum xnn_status xnn_create_global_average_pooling_nwc_f16(
   size_t channels,
   size_t input_stride,
@@ -2098,6 +2856,20 @@ enum xnn_status xnn_setup_max_pooling2d_nhwc_f16(
   void* output,
   pthreadpool_t threadpool);
 
+enum xnn_status xnn_create_mean_nd_f16(
+  uint32_t flags,
+  xnn_operator_t* mean_op_out);
+
+enum xnn_status xnn_setup_mean_nd_f16(
+  xnn_operator_t mean_op,
+  size_t num_reduction_axes,
+  const size_t* reduction_axes,
+  size_t num_input_dims,
+  const size_t* input_shape,
+  const void* input,
+  void* output,
+  pthreadpool_t threadpool);
+
 enum xnn_status xnn_create_multiply_nd_f16(
   float output_min,
   float output_max,
@@ -2148,6 +2920,20 @@ enum xnn_status xnn_setup_resize_bilinear2d_nhwc_f16(
   void* output,
   pthreadpool_t threadpool);
 
+enum xnn_status xnn_create_sum_nd_f16(
+  uint32_t flags,
+  xnn_operator_t* sum_op_out);
+
+enum xnn_status xnn_setup_sum_nd_f16(
+  xnn_operator_t sum_op,
+  size_t num_reduction_axes,
+  const size_t* reduction_axes,
+  size_t num_input_dims,
+  const size_t* input_shape,
+  const void* input,
+  void* output,
+  pthreadpool_t threadpool);
+
 #endif  // XNN_NO_F16_OPERATORS
 
 #ifndef XNN_NO_X16_OPERATORS
@@ -2167,6 +2953,20 @@ enum xnn_status xnn_setup_constant_pad_nd_x16(
   void* output,
   pthreadpool_t threadpool);
 
+enum xnn_status xnn_create_pad_nd_x16(
+  uint32_t flags,
+  xnn_operator_t* pad_op_out);
+
+enum xnn_status xnn_setup_pad_nd_x16(
+  xnn_operator_t pad_op,
+  size_t num_dims,
+  const size_t* input_shape,
+  const size_t* pre_padding,
+  const size_t* post_padding,
+  const void* input,
+  void* output,
+  pthreadpool_t threadpool);
+
 enum xnn_status xnn_create_copy_nc_x16(
   size_t channels,
   size_t input_stride,
@@ -2181,6 +2981,56 @@ enum xnn_status xnn_setup_copy_nc_x16(
   void* output,
   pthreadpool_t threadpool);
 
+enum xnn_status xnn_create_resize_nearest2d_nhwc_x16(
+  size_t channels,
+  size_t input_pixel_stride,
+  size_t output_pixel_stride,
+  uint32_t flags,
+  xnn_operator_t* resize_op_out);
+
+enum xnn_status xnn_setup_resize_nearest2d_nhwc_x16(
+  xnn_operator_t resize_op,
+  size_t batch_size,
+  size_t input_height,
+  size_t input_width,
+  size_t output_height,
+  size_t output_width,
+  const void* input,
+  void* output,
+  pthreadpool_t threadpool);
+
+enum xnn_status xnn_create_slice_nd_x16(
+  uint32_t flags,
+  xnn_operator_t* slice_op_out);
+
+enum xnn_status xnn_setup_slice_nd_x16(
+  xnn_operator_t slice_op,
+  size_t num_dims,
+  const size_t* input_shape,
+  const size_t* offsets,
+  const size_t* sizes,
+  const size_t* strides,
+  const void* input,
+  void* output,
+  pthreadpool_t threadpool);
+
+enum xnn_status xnn_create_space_to_depth_nhwc_x16(
+  size_t input_channels,
+  size_t input_channel_stride,
+  size_t output_channel_stride,
+  uint32_t block_size,
+  uint32_t flags,
+  xnn_operator_t* space_to_depth_op_out);
+
+enum xnn_status xnn_setup_space_to_depth_nhwc_x16(
+  xnn_operator_t space_to_depth_op,
+  size_t batch_size,
+  size_t input_height,
+  size_t input_width,
+  const void* input,
+  void* output,
+  pthreadpool_t threadpool);
+
 #endif  // XNN_NO_X16_OPERATORS
 
 #ifndef XNN_NO_QC8_OPERATORS
@@ -2249,6 +3099,36 @@ enum xnn_status xnn_setup_add_nd_qs8(
   int8_t* output,
   pthreadpool_t threadpool);
 
+enum xnn_status xnn_create_average_pooling2d_nhwc_qs8(
+  uint32_t input_padding_top,
+  uint32_t input_padding_right,
+  uint32_t input_padding_bottom,
+  uint32_t input_padding_left,
+  uint32_t pooling_height,
+  uint32_t pooling_width,
+  uint32_t stride_height,
+  uint32_t stride_width,
+  size_t channels,
+  size_t input_pixel_stride,
+  size_t output_pixel_stride,
+  int8_t input_zero_point,
+  float input_scale,
+  int8_t output_zero_point,
+  float output_scale,
+  int8_t output_min,
+  int8_t output_max,
+  uint32_t flags,
+  xnn_operator_t* average_pooling_op_out);
+
+enum xnn_status xnn_setup_average_pooling2d_nhwc_qs8(
+  xnn_operator_t average_pooling_op,
+  size_t batch_size,
+  size_t input_height,
+  size_t input_width,
+  const int8_t* input,
+  int8_t* output,
+  pthreadpool_t threadpool);
+
 enum xnn_status xnn_create_convolution2d_nhwc_qs8(
   uint32_t input_padding_top,
   uint32_t input_padding_right,
@@ -2277,6 +3157,73 @@ enum xnn_status xnn_create_convolution2d_nhwc_qs8(
   uint32_t flags,
   xnn_operator_t* convolution_op_out);
 
+/// Pack the weights of a QS8 Convolution operator into caller-owned memory, for later creation of operators with
+/// xnn_create_convolution2d_nhwc_qs8_with_packed_weights without repacking, e.g. from a file mapped into memory and
+/// shared across processes. Other parameters have the same meaning as in xnn_create_convolution2d_nhwc_qs8, and the
+/// flags must match the flags passed at creation.
+///
+/// @param packed_weights - memory for the packed weights, aligned to XNN_PACKED_WEIGHTS_ALIGNMENT bytes, or NULL to
+///                         only compute the size and fingerprint of the packed weights.
+/// @param packed_weights_size - on input, the size of the memory pointed to by packed_weights in bytes. On output, the
+///                              size of the packed weights in bytes.
+/// @param packed_weights_fingerprint - on output, the fingerprint of the packed weights layout, which depends on the
+///                                     operator configuration and on the micro-kernels selected for the processor.
+enum xnn_status xnn_pack_convolution2d_nhwc_qs8_weights(
+  uint32_t input_padding_top,
+  uint32_t input_padding_right,
+  uint32_t input_padding_bottom,
+  uint32_t input_padding_left,
+  uint32_t kernel_height,
+  uint32_t kernel_width,
+  uint32_t subsampling_height,
+  uint32_t subsampling_width,
+  uint32_t dilation_height,
+  uint32_t dilation_width,
+  uint32_t groups,
+  size_t group_input_channels,
+  size_t group_output_channels,
+  int8_t input_zero_point,
+  const int8_t* kernel,
+  const int32_t* bias,
+  uint32_t flags,
+  void* packed_weights,
+  size_t* packed_weights_size,
+  uint64_t* packed_weights_fingerprint);
+
+/// Create a QS8 Convolution operator that uses packed weights and their fingerprint produced by
+/// xnn_pack_convolution2d_nhwc_qs8_weights, without copying them. The packed weights must stay valid and unmodified for
+/// the lifetime of the operator, and of any Runtime sharing it, and the operator never writes to them. Creation fails
+/// with xnn_status_unsupported_parameter if the fingerprint does not match the operator configuration on this
+/// processor, in which case the caller should repack the original weights.
+enum xnn_status xnn_create_convolution2d_nhwc_qs8_with_packed_weights(
+  uint32_t input_padding_top,
+  uint32_t input_padding_right,
+  uint32_t input_padding_bottom,
+  uint32_t input_padding_left,
+  uint32_t kernel_height,
+  uint32_t kernel_width,
+  uint32_t subsampling_height,
+  uint32_t subsampling_width,
+  uint32_t dilation_height,
+  uint32_t dilation_width,
+  uint32_t groups,
+  size_t group_input_channels,
+  size_t group_output_channels,
+  size_t input_channel_stride,
+  size_t output_channel_stride,
+  int8_t input_zero_point,
+  float input_scale,
+  float kernel_scale,
+  const void* packed_weights,
+  size_t packed_weights_size,
+  uint64_t packed_weights_fingerprint,
+  int8_t output_zero_point,
+  float output_scale,
+  int8_t output_min,
+  int8_t output_max,
+  uint32_t flags,
+  xnn_operator_t* convolution_op_out);
+
 enum xnn_status xnn_setup_convolution2d_nhwc_qs8(
   xnn_operator_t convolution_op,
   size_t batch_size,
@@ -2363,6 +3310,51 @@ enum xnn_status xnn_create_fully_connected_nc_qs8(
   uint32_t flags,
   xnn_operator_t* fully_connected_op_out);
 
+/// Pack the weights of a QS8 Fully Connected operator into caller-owned memory, for later creation of operators with
+/// xnn_create_fully_connected_nc_qs8_with_packed_weights without repacking, e.g. from a file mapped into memory and
+/// shared across processes. Other parameters have the same meaning as in xnn_create_fully_connected_nc_qs8, and the
+/// flags must match the flags passed at creation.
+///
+/// @param packed_weights - memory for the packed weights, aligned to XNN_PACKED_WEIGHTS_ALIGNMENT bytes, or NULL to
+///                         only compute the size and fingerprint of the packed weights.
+/// @param packed_weights_size - on input, the size of the memory pointed to by packed_weights in bytes. On output, the
+///                              size of the packed weights in bytes.
+/// @param packed_weights_fingerprint - on output, the fingerprint of the packed weights layout, which depends on the
+///                                     operator configuration and on the micro-kernels selected for the processor.
+enum xnn_status xnn_pack_fully_connected_nc_qs8_weights(
+  size_t input_channels,
+  size_t output_channels,
+  int8_t input_zero_point,
+  const int8_t* kernel,
+  const int32_t* bias,
+  uint32_t flags,
+  void* packed_weights,
+  size_t* packed_weights_size,
+  uint64_t* packed_weights_fingerprint);
+
+/// Create a QS8 Fully Connected operator that uses packed weights and their fingerprint produced by
+/// xnn_pack_fully_connected_nc_qs8_weights, without copying them. The packed weights must stay valid and unmodified for
+/// the lifetime of the operator, and of any Runtime sharing it, and the operator never writes to them. Creation fails
+/// with xnn_status_unsupported_parameter if the fingerprint does not match the operator configuration on this
+/// processor, in which case the caller should repack the original weights.
+enum xnn_status xnn_create_fully_connected_nc_qs8_with_packed_weights(
+  size_t input_channels,
+  size_t output_channels,
+  size_t input_stride,
+  size_t output_stride,
+  int8_t input_zero_point,
+  float input_scale,
+  float kernel_scale,
+  const void* packed_weights,
+  size_t packed_weights_size,
+  uint64_t packed_weights_fingerprint,
+  int8_t output_zero_point,
+  float output_scale,
+  int8_t output_min,
+  int8_t output_max,
+  uint32_t flags,
+  xnn_operator_t* fully_connected_op_out);
+
 enum xnn_status xnn_setup_fully_connected_nc_qs8(
   xnn_operator_t fully_connected_op,
   size_t batch_size,
@@ -2370,6 +3362,22 @@ enum xnn_status xnn_setup_fully_connected_nc_qs8(
   int8_t* output,
   pthreadpool_t threadpool);
 
+/// Fuse addition of a residual tensor into the output of a GEMM-based Convolution or Fully Connected operator.
+///
+/// The output of the operator is requantized with its own parameters before the addition, and input_zero_point and
+/// input_scale must match the output quantization parameters specified when the operator was created. Both QS8 and
+/// QC8 Convolution operators are supported. See xnn_fuse_residual_add_f32 for details.
+enum xnn_status xnn_fuse_residual_add_qs8(
+  xnn_operator_t op,
+  int8_t input_zero_point,
+  float input_scale,
+  int8_t residual_zero_point,
+  float residual_scale,
+  int8_t output_zero_point,
+  float output_scale,
+  int8_t output_min,
+  int8_t output_max);
+
 enum xnn_status xnn_create_global_average_pooling_nwc_qs8(
   size_t channels,
   size_t input_stride,
@@ -2391,6 +3399,24 @@ enum xnn_status xnn_setup_global_average_pooling_nwc_qs8(
   int8_t* output,
   pthreadpool_t threadpool);
 
+enum xnn_status xnn_create_mean_nd_qs8(
+  int8_t input_zero_point,
+  float input_scale,
+  int8_t output_zero_point,
+  float output_scale,
+  uint32_t flags,
+  xnn_operator_t* mean_op_out);
+
+enum xnn_status xnn_setup_mean_nd_qs8(
+  xnn_operator_t mean_op,
+  size_t num_reduction_axes,
+  const size_t* reduction_axes,
+  size_t num_input_dims,
+  const size_t* input_shape,
+  const int8_t* input,
+  int8_t* output,
+  pthreadpool_t threadpool);
+
 enum xnn_status xnn_create_multiply_nd_qs8(
   int8_t input1_zero_point,
   float input1_scale,
@@ -2457,6 +3483,24 @@ enum xnn_status xnn_setup_subtract_nd_qs8(
   int8_t* output,
   pthreadpool_t threadpool);
 
+enum xnn_status xnn_create_sum_nd_qs8(
+  int8_t input_zero_point,
+  float input_scale,
+  int8_t output_zero_point,
+  float output_scale,
+  uint32_t flags,
+  xnn_operator_t* sum_op_out);
+
+enum xnn_status xnn_setup_sum_nd_qs8(
+  xnn_operator_t sum_op,
+  size_t num_reduction_axes,
+  const size_t* reduction_axes,
+  size_t num_input_dims,
+  const size_t* input_shape,
+  const int8_t* input,
+  int8_t* output,
+  pthreadpool_t threadpool);
+
 enum xnn_status xnn_create_tanh_nc_qs8(
   size_t channels,
   size_t input_stride,
@@ -2637,6 +3681,20 @@ enum xnn_status xnn_setup_fully_connected_nc_qu8(
   uint8_t* output,
   pthreadpool_t threadpool);
 
+/// Fuse addition of a residual tensor into the output of a GEMM-based Convolution or Fully Connected operator.
+///
+/// See xnn_fuse_residual_add_qs8 for details.
+enum xnn_status xnn_fuse_residual_add_qu8(
+  xnn_operator_t op,
+  uint8_t input_zero_point,
+  float input_scale,
+  uint8_t residual_zero_point,
+  float residual_scale,
+  uint8_t output_zero_point,
+  float output_scale,
+  uint8_t output_min,
+  uint8_t output_max);
+
 enum xnn_status xnn_create_global_average_pooling_nwc_qu8(
   size_t channels,
   size_t input_stride,
@@ -2962,6 +4020,70 @@ enum xnn_status xnn_setup_constant_pad_nd_x8(
   void* output,
   pthreadpool_t threadpool);
 
+enum xnn_status xnn_create_pad_nd_x8(
+  uint32_t flags,
+  xnn_operator_t* pad_op_out);
+
+enum xnn_status xnn_setup_pad_nd_x8(
+  xnn_operator_t pad_op,
+  size_t num_dims,
+  const size_t* input_shape,
+  const size_t* pre_padding,
+  const size_t* post_padding,
+  const void* input,
+  void* output,
+  pthreadpool_t threadpool);
+
+enum xnn_status xnn_create_resize_nearest2d_nhwc_x8(
+  size_t channels,
+  size_t input_pixel_stride,
+  size_t output_pixel_stride,
+  uint32_t flags,
+  xnn_operator_t* resize_op_out);
+
+enum xnn_status xnn_setup_resize_nearest2d_nhwc_x8(
+  xnn_operator_t resize_op,
+  size_t batch_size,
+  size_t input_height,
+  size_t input_width,
+  size_t output_height,
+  size_t output_width,
+  const void* input,
+  void* output,
+  pthreadpool_t threadpool);
+
+enum xnn_status xnn_create_slice_nd_x8(
+  uint32_t flags,
+  xnn_operator_t* slice_op_out);
+
+enum xnn_status xnn_setup_slice_nd_x8(
+  xnn_operator_t slice_op,
+  size_t num_dims,
+  const size_t* input_shape,
+  const size_t* offsets,
+  const size_t* sizes,
+  const size_t* strides,
+  const void* input,
+  void* output,
+  pthreadpool_t threadpool);
+
+enum xnn_status xnn_create_space_to_depth_nhwc_x8(
+  size_t input_channels,
+  size_t input_channel_stride,
+  size_t output_channel_stride,
+  uint32_t block_size,
+  uint32_t flags,
+  xnn_operator_t* space_to_depth_op_out);
+
+enum xnn_status xnn_setup_space_to_depth_nhwc_x8(
+  xnn_operator_t space_to_depth_op,
+  size_t batch_size,
+  size_t input_height,
+  size_t input_width,
+  const void* input,
+  void* output,
+  pthreadpool_t threadpool);
+
 #endif  // XNN_NO_X8_OPERATORS
 
 #ifndef XNN_NO_CVT_OPERATORS
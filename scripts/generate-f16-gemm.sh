@@ -49,6 +49,9 @@ tools/xngen src/f16-gemm/neonfp16arith-ld64.c.in -D MR=4 -D NR=16 -D INC=1 -o sr
 tools/xngen src/f16-gemm/neonfp16arith-ld64.c.in -D MR=6 -D NR=16 -D INC=1 -o src/f16-gemm/gen-inc/6x16inc-minmax-neonfp16arith-ld64.c &
 tools/xngen src/f16-gemm/neonfp16arith-ld64.c.in -D MR=8 -D NR=16 -D INC=1 -o src/f16-gemm/gen-inc/8x16inc-minmax-neonfp16arith-ld64.c &
 
+### GEMV micro-kernels
+tools/xngen src/f16-gemm/gemv-neonfp16arith-ld64.c.in -D NR=16 -D ACCUMULATORS=4 -o src/f16-gemm/gen/1x16-minmax-neonfp16arith-ld64-acc4.c &
+
 ################################### x86 AVX2 ###################################
 tools/xngen src/f16-gemm/avx2-broadcast.c.in -D MR=1 -D NR=8  -o src/f16-gemm/gen/1x8-minmax-avx2-broadcast.c &
 tools/xngen src/f16-gemm/avx2-broadcast.c.in -D MR=4 -D NR=8  -o src/f16-gemm/gen/4x8-minmax-avx2-broadcast.c &
@@ -61,6 +64,8 @@ tools/xngen src/f16-gemm/avx2-broadcast.c.in -D MR=3 -D NR=16 -o src/f16-gemm/ge
 tools/xngen src/f16-gemm/avx2-broadcast.c.in -D MR=4 -D NR=16 -o src/f16-gemm/gen/4x16-minmax-avx2-broadcast.c &
 tools/xngen src/f16-gemm/avx2-broadcast.c.in -D MR=5 -D NR=16 -o src/f16-gemm/gen/5x16-minmax-avx2-broadcast.c &
 
+tools/xngen src/f16-gemm/gemv-avx2-broadcast.c.in -D NR=16 -D ACCUMULATORS=4 -o src/f16-gemm/gen/1x16-minmax-avx2-broadcast-acc4.c &
+
 ################################## Unit tests #################################
 tools/generate-gemm-test.py --spec test/f16-gemm-minmax.yaml --output test/f16-gemm-minmax.cc &
 
@@ -181,6 +181,10 @@ tools/xngen src/f32-gemm/neon-shuffle.c.in   -D MR=8 -D NR=8  -D FMA=0 -D INC=1
 tools/xngen src/f32-gemm/neon-shuffle.c.in   -D MR=8 -D NR=8  -D FMA=1 -D INC=0 -o src/f32-gemm/gen/8x8s4-minmax-neonfma.c &
 tools/xngen src/f32-gemm/neon-shuffle.c.in   -D MR=8 -D NR=8  -D FMA=1 -D INC=1 -o src/f32-gemm/gen-inc/8x8s4inc-minmax-neonfma.c &
 
+### GEMV micro-kernels
+tools/xngen src/f32-gemm/gemv-neon-dup.c.in  -D NR=8  -D FMA=0 -D ACCUMULATORS=4 -o src/f32-gemm/gen/1x8-minmax-neon-dup-acc4.c &
+tools/xngen src/f32-gemm/gemv-neon-dup.c.in  -D NR=8  -D FMA=1 -D ACCUMULATORS=4 -o src/f32-gemm/gen/1x8-minmax-neonfma-dup-acc4.c &
+
 ################################## WAsm SIMD ##################################
 ### LOAD1+BROADCAST micro-kernels
 tools/xngen src/f32-gemm/wasmsimd-loadsplat.c.in -D MR=1 -D NR=8 -D X86=0 -D INC=0 -D ACTIVATION=MINMAX -o src/f32-gemm/gen/1x8-minmax-wasmsimd-arm-loadsplat.c &
@@ -346,6 +350,9 @@ tools/xngen src/f32-gemm/sse-shuffle.c.in -D MR=5 -D NR=8 -D INC=1 -o src/f32-ge
 ### MRx2 micro-kernels
 tools/xngen src/f32-gemm/MRx2c4-sse.c.in -D MR=4 -D NR=2 -o src/f32-gemm/gen/4x2c4-minmax-sse.c &
 
+### GEMV micro-kernels
+tools/xngen src/f32-gemm/gemv-sse-dup.c.in -D NR=8 -D ACCUMULATORS=4 -o src/f32-gemm/gen/1x8-minmax-sse-dup-acc4.c &
+
 ################################### x86 AVX ###################################
 ### AVX+BROADCAST micro-kernels
 tools/xngen src/f32-gemm/avx-broadcast.c.in -D MR=1 -D NR=8 -D FMA=0 -D INC=0 -o src/f32-gemm/gen/1x8-minmax-avx-broadcast.c &
@@ -374,6 +381,8 @@ tools/xngen src/f32-gemm/avx-broadcast.c.in -D MR=4 -D NR=16 -D FMA=0 -D INC=1 -
 
 tools/xngen src/f32-gemm/avx-broadcast.c.in -D MR=5 -D NR=16 -D FMA=0 -D INC=0 -o src/f32-gemm/gen/5x16-minmax-avx-broadcast.c &
 tools/xngen src/f32-gemm/avx-broadcast.c.in -D MR=5 -D NR=16 -D FMA=0 -D INC=1 -o src/f32-gemm/gen-inc/5x16inc-minmax-avx-broadcast.c &
+
+tools/xngen src/f32-gemm/gemv-avx-broadcast.c.in -D NR=16 -D FMA=0 -D ACCUMULATORS=4 -o src/f32-gemm/gen/1x16-minmax-avx-broadcast-acc4.c &
 ### FMA3+BROADCAST micro-kernels
 tools/xngen src/f32-gemm/avx-broadcast.c.in -D MR=1 -D NR=8 -D FMA=3 -D INC=0 -o src/f32-gemm/gen/1x8-minmax-fma3-broadcast.c &
 tools/xngen src/f32-gemm/avx-broadcast.c.in -D MR=1 -D NR=8 -D FMA=3 -D INC=1 -o src/f32-gemm/gen-inc/1x8inc-minmax-fma3-broadcast.c &
@@ -417,6 +426,8 @@ tools/xngen src/f32-gemm/avx-shuffle4.c.in -D MR=4 -D NR=16 -D FMA=3 -D INC=1 -o
 tools/xngen src/f32-gemm/avx-shuffle4.c.in -D MR=5 -D NR=16 -D FMA=3 -D INC=0 -o src/f32-gemm/gen/5x16s4-minmax-fma3-broadcast.c &
 tools/xngen src/f32-gemm/avx-shuffle4.c.in -D MR=5 -D NR=16 -D FMA=3 -D INC=1 -o src/f32-gemm/gen-inc/5x16s4inc-minmax-fma3-broadcast.c &
 
+tools/xngen src/f32-gemm/gemv-avx-broadcast.c.in -D NR=16 -D FMA=3 -D ACCUMULATORS=4 -o src/f32-gemm/gen/1x16-minmax-fma3-broadcast-acc4.c &
+
 ################################# x86 AVX-512 #################################
 ### AVX512F+BROADCAST micro-kernels
 tools/xngen src/f32-gemm/avx512-broadcast.c.in -D MR=1 -D NR=16 -D INC=0 -o src/f32-gemm/gen/1x16-minmax-avx512f-broadcast.c &
@@ -437,6 +448,8 @@ tools/xngen src/f32-gemm/avx512-broadcast.c.in -D MR=7 -D NR=16 -D INC=1 -o src/
 tools/xngen src/f32-gemm/avx512-broadcast.c.in -D MR=8 -D NR=16 -D INC=0 -o src/f32-gemm/gen/8x16-minmax-avx512f-broadcast.c &
 tools/xngen src/f32-gemm/avx512-broadcast.c.in -D MR=8 -D NR=16 -D INC=1 -o src/f32-gemm/gen-inc/8x16inc-minmax-avx512f-broadcast.c &
 
+tools/xngen src/f32-gemm/gemv-avx512-broadcast.c.in -D NR=16 -D ACCUMULATORS=4 -o src/f32-gemm/gen/1x16-minmax-avx512f-broadcast-acc4.c &
+
 ################################## Unit tests #################################
 tools/generate-gemm-test.py --spec test/f32-gemm.yaml --output test/f32-gemm.cc --output test/f32-gemm-2.cc &
 tools/generate-gemm-test.py --spec test/f32-gemm-relu.yaml --output test/f32-gemm-relu.cc --output test/f32-gemm-relu-2.cc &
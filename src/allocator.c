@@ -9,9 +9,13 @@
 #ifdef __ANDROID__
   #include <malloc.h>
 #endif
+#if defined(__linux__)
+  #include <sys/mman.h>
+#endif
 
 #include <xnnpack/allocator.h>
 #include <xnnpack/common.h>
+#include <xnnpack/math.h>
 
 
 extern int posix_memalign(void **memptr, size_t alignment, size_t size);
@@ -65,3 +69,90 @@ const struct xnn_allocator xnn_default_allocator = {
   .aligned_allocate = xnn_aligned_allocate,
   .aligned_deallocate = xnn_aligned_deallocate,
 };
+
+void* xnn_allocate_huge_simd_memory(enum xnn_memory_category category, size_t memory_size) {
+#if defined(__linux__) && defined(MADV_HUGEPAGE)
+  const size_t allocation_size = XNN_SIMD_ALLOCATION_HEADER_SIZE + memory_size;
+  if (allocation_size >= XNN_HUGE_PAGE_SIZE) {
+    void* allocation_pointer = xnn_params.allocator.aligned_allocate(
+      xnn_params.allocator.context, XNN_HUGE_PAGE_SIZE, allocation_size);
+    if (allocation_pointer != NULL) {
+      // Only whole huge pages inside the allocation are advised, the tail stays in regular pages. The advice is a hint:
+      // if transparent huge pages are disabled, or no huge pages are available, the memory is backed by regular pages.
+      madvise(allocation_pointer, round_down_po2(allocation_size, XNN_HUGE_PAGE_SIZE), MADV_HUGEPAGE);
+      return xnn_init_allocation_header(allocation_pointer, XNN_SIMD_ALLOCATION_HEADER_SIZE, memory_size, category);
+    }
+  }
+#endif  // defined(__linux__) && defined(MADV_HUGEPAGE)
+  return xnn_allocate_tagged_simd_memory(category, memory_size);
+}
+
+// Global memory accounting, updated atomically where the compiler supports it.
+static size_t current_memory_bytes[XNN_NUM_MEMORY_CATEGORIES];
+static size_t peak_memory_bytes[XNN_NUM_MEMORY_CATEGORIES];
+static size_t current_total_memory_bytes;
+static size_t peak_total_memory_bytes;
+
+#if defined(__GNUC__) || defined(__clang__)
+  static size_t add_memory_bytes(size_t* counter, size_t memory_size) {
+    return __atomic_add_fetch(counter, memory_size, __ATOMIC_RELAXED);
+  }
+
+  static void subtract_memory_bytes(size_t* counter, size_t memory_size) {
+    __atomic_sub_fetch(counter, memory_size, __ATOMIC_RELAXED);
+  }
+
+  static size_t load_memory_bytes(const size_t* counter) {
+    return __atomic_load_n(counter, __ATOMIC_RELAXED);
+  }
+
+  static void update_peak_memory_bytes(size_t* peak, size_t memory_size) {
+    size_t old_peak = __atomic_load_n(peak, __ATOMIC_RELAXED);
+    while (memory_size > old_peak &&
+           !__atomic_compare_exchange_n(peak, &old_peak, memory_size, true, __ATOMIC_RELAXED, __ATOMIC_RELAXED))
+    {
+    }
+  }
+#else
+  static size_t add_memory_bytes(size_t* counter, size_t memory_size) {
+    return *counter += memory_size;
+  }
+
+  static void subtract_memory_bytes(size_t* counter, size_t memory_size) {
+    *counter -= memory_size;
+  }
+
+  static size_t load_memory_bytes(const size_t* counter) {
+    return *counter;
+  }
+
+  static void update_peak_memory_bytes(size_t* peak, size_t memory_size) {
+    if (memory_size > *peak) {
+      *peak = memory_size;
+    }
+  }
+#endif
+
+void xnn_account_memory_allocation(enum xnn_memory_category category, size_t memory_size) {
+  assert((size_t) category < XNN_NUM_MEMORY_CATEGORIES);
+  const size_t category_bytes = add_memory_bytes(&current_memory_bytes[category], memory_size);
+  update_peak_memory_bytes(&peak_memory_bytes[category], category_bytes);
+  const size_t total_bytes = add_memory_bytes(&current_total_memory_bytes, memory_size);
+  update_peak_memory_bytes(&peak_total_memory_bytes, total_bytes);
+}
+
+void xnn_account_memory_release(enum xnn_memory_category category, size_t memory_size) {
+  assert((size_t) category < XNN_NUM_MEMORY_CATEGORIES);
+  subtract_memory_bytes(&current_memory_bytes[category], memory_size);
+  subtract_memory_bytes(&current_total_memory_bytes, memory_size);
+}
+
+enum xnn_status xnn_get_memory_usage(struct xnn_memory_usage* usage_out) {
+  for (size_t i = 0; i < XNN_NUM_MEMORY_CATEGORIES; i++) {
+    usage_out->current_bytes[i] = load_memory_bytes(&current_memory_bytes[i]);
+    usage_out->peak_bytes[i] = load_memory_bytes(&peak_memory_bytes[i]);
+  }
+  usage_out->current_total_bytes = load_memory_bytes(&current_total_memory_bytes);
+  usage_out->peak_total_bytes = load_memory_bytes(&peak_total_memory_bytes);
+  return xnn_status_success;
+}
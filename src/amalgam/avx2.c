@@ -7,6 +7,7 @@
 
 #include <immintrin.h>
 
+#include <xnnpack/avgpool.h>
 #include <xnnpack/common.h>
 #include <xnnpack/dwconv.h>
 #include <xnnpack/gemm.h>
@@ -19,6 +20,142 @@
 #include <xnnpack/vunary.h>
 
 
+void xnn_f16_gemm_minmax_ukernel_1x16__avx2_broadcast_acc4(
+    size_t mr,
+    size_t nc,
+    size_t kc,
+    const void*restrict a,
+    size_t a_stride,
+    const void*restrict w,
+    void*restrict c,
+    size_t cm_stride,
+    size_t cn_stride,
+    const union xnn_f16_scaleminmax_params params[restrict XNN_MIN_ELEMENTS(1)])
+{
+  assert(mr != 0);
+  assert(mr <= 1);
+  assert(nc != 0);
+  assert(kc != 0);
+  assert(kc % sizeof(uint16_t) == 0);
+  assert(a != NULL);
+  assert(w != NULL);
+  assert(c != NULL);
+
+  const uint16_t* a0 = a;
+  uint16_t* c0 = c;
+
+  do {
+    __m256 vacc0x01234567 = _mm256_cvtph_ps(_mm_load_si128((const __m128i*) w));
+    __m256 vacc0x89ABCDEF = _mm256_cvtph_ps(_mm_load_si128((const __m128i*) ((const uint16_t*) w + 8)));
+    __m256 vacc1x01234567 = _mm256_setzero_ps();
+    __m256 vacc1x89ABCDEF = _mm256_setzero_ps();
+    __m256 vacc2x01234567 = _mm256_setzero_ps();
+    __m256 vacc2x89ABCDEF = _mm256_setzero_ps();
+    __m256 vacc3x01234567 = _mm256_setzero_ps();
+    __m256 vacc3x89ABCDEF = _mm256_setzero_ps();
+    w = (const uint16_t*) w + 16;
+
+    size_t k = kc;
+    for (; k >= 4 * sizeof(uint16_t); k -= 4 * sizeof(uint16_t)) {
+      _mm_prefetch((const char*) ((const uint16_t*) w + 512), _MM_HINT_T0);
+      _mm_prefetch((const char*) ((const uint16_t*) w + 544), _MM_HINT_T0);
+
+      const __m256 va0c0 = _mm256_cvtph_ps(_mm_set1_epi16((short) a0[0]));
+      const __m256 va0c1 = _mm256_cvtph_ps(_mm_set1_epi16((short) a0[1]));
+      const __m256 va0c2 = _mm256_cvtph_ps(_mm_set1_epi16((short) a0[2]));
+      const __m256 va0c3 = _mm256_cvtph_ps(_mm_set1_epi16((short) a0[3]));
+      a0 += 4;
+
+      const __m256 vb01234567c0 = _mm256_cvtph_ps(_mm_load_si128((const __m128i*) ((const uint16_t*) w + 0)));
+      const __m256 vb89ABCDEFc0 = _mm256_cvtph_ps(_mm_load_si128((const __m128i*) ((const uint16_t*) w + 8)));
+      const __m256 vb01234567c1 = _mm256_cvtph_ps(_mm_load_si128((const __m128i*) ((const uint16_t*) w + 16)));
+      const __m256 vb89ABCDEFc1 = _mm256_cvtph_ps(_mm_load_si128((const __m128i*) ((const uint16_t*) w + 24)));
+      const __m256 vb01234567c2 = _mm256_cvtph_ps(_mm_load_si128((const __m128i*) ((const uint16_t*) w + 32)));
+      const __m256 vb89ABCDEFc2 = _mm256_cvtph_ps(_mm_load_si128((const __m128i*) ((const uint16_t*) w + 40)));
+      const __m256 vb01234567c3 = _mm256_cvtph_ps(_mm_load_si128((const __m128i*) ((const uint16_t*) w + 48)));
+      const __m256 vb89ABCDEFc3 = _mm256_cvtph_ps(_mm_load_si128((const __m128i*) ((const uint16_t*) w + 56)));
+      w = (const uint16_t*) w + 64;
+
+      vacc0x01234567 = _mm256_cvtph_ps(_mm256_cvtps_ph(_mm256_fmadd_ps(va0c0, vb01234567c0, vacc0x01234567), _MM_FROUND_NO_EXC));
+      vacc0x89ABCDEF = _mm256_cvtph_ps(_mm256_cvtps_ph(_mm256_fmadd_ps(va0c0, vb89ABCDEFc0, vacc0x89ABCDEF), _MM_FROUND_NO_EXC));
+      vacc1x01234567 = _mm256_cvtph_ps(_mm256_cvtps_ph(_mm256_fmadd_ps(va0c1, vb01234567c1, vacc1x01234567), _MM_FROUND_NO_EXC));
+      vacc1x89ABCDEF = _mm256_cvtph_ps(_mm256_cvtps_ph(_mm256_fmadd_ps(va0c1, vb89ABCDEFc1, vacc1x89ABCDEF), _MM_FROUND_NO_EXC));
+      vacc2x01234567 = _mm256_cvtph_ps(_mm256_cvtps_ph(_mm256_fmadd_ps(va0c2, vb01234567c2, vacc2x01234567), _MM_FROUND_NO_EXC));
+      vacc2x89ABCDEF = _mm256_cvtph_ps(_mm256_cvtps_ph(_mm256_fmadd_ps(va0c2, vb89ABCDEFc2, vacc2x89ABCDEF), _MM_FROUND_NO_EXC));
+      vacc3x01234567 = _mm256_cvtph_ps(_mm256_cvtps_ph(_mm256_fmadd_ps(va0c3, vb01234567c3, vacc3x01234567), _MM_FROUND_NO_EXC));
+      vacc3x89ABCDEF = _mm256_cvtph_ps(_mm256_cvtps_ph(_mm256_fmadd_ps(va0c3, vb89ABCDEFc3, vacc3x89ABCDEF), _MM_FROUND_NO_EXC));
+    }
+    for (; k != 0; k -= sizeof(uint16_t)) {
+      const __m256 va0 = _mm256_cvtph_ps(_mm_set1_epi16((short) *a0));
+      a0 += 1;
+
+      const __m256 vb01234567 = _mm256_cvtph_ps(_mm_load_si128((const __m128i*) ((const uint16_t*) w + 0)));
+      const __m256 vb89ABCDEF = _mm256_cvtph_ps(_mm_load_si128((const __m128i*) ((const uint16_t*) w + 8)));
+      w = (const uint16_t*) w + 16;
+
+      vacc0x01234567 = _mm256_cvtph_ps(_mm256_cvtps_ph(_mm256_fmadd_ps(va0, vb01234567, vacc0x01234567), _MM_FROUND_NO_EXC));
+      vacc0x89ABCDEF = _mm256_cvtph_ps(_mm256_cvtps_ph(_mm256_fmadd_ps(va0, vb89ABCDEF, vacc0x89ABCDEF), _MM_FROUND_NO_EXC));
+    }
+    // Add up all accumulators to vacc0
+    vacc0x01234567 = _mm256_cvtph_ps(_mm256_cvtps_ph(_mm256_add_ps(vacc0x01234567, vacc1x01234567), _MM_FROUND_NO_EXC));
+    vacc0x89ABCDEF = _mm256_cvtph_ps(_mm256_cvtps_ph(_mm256_add_ps(vacc0x89ABCDEF, vacc1x89ABCDEF), _MM_FROUND_NO_EXC));
+    vacc2x01234567 = _mm256_cvtph_ps(_mm256_cvtps_ph(_mm256_add_ps(vacc2x01234567, vacc3x01234567), _MM_FROUND_NO_EXC));
+    vacc2x89ABCDEF = _mm256_cvtph_ps(_mm256_cvtps_ph(_mm256_add_ps(vacc2x89ABCDEF, vacc3x89ABCDEF), _MM_FROUND_NO_EXC));
+    vacc0x01234567 = _mm256_cvtph_ps(_mm256_cvtps_ph(_mm256_add_ps(vacc0x01234567, vacc2x01234567), _MM_FROUND_NO_EXC));
+    vacc0x89ABCDEF = _mm256_cvtph_ps(_mm256_cvtps_ph(_mm256_add_ps(vacc0x89ABCDEF, vacc2x89ABCDEF), _MM_FROUND_NO_EXC));
+
+    const __m256 vscale = _mm256_load_ps(params->avx.scale);
+    vacc0x01234567 = _mm256_cvtph_ps(_mm256_cvtps_ph(_mm256_mul_ps(vacc0x01234567, vscale), _MM_FROUND_NO_EXC));
+    vacc0x89ABCDEF = _mm256_cvtph_ps(_mm256_cvtps_ph(_mm256_mul_ps(vacc0x89ABCDEF, vscale), _MM_FROUND_NO_EXC));
+
+    const __m256 vmin = _mm256_load_ps(params->avx.min);
+    vacc0x01234567 = _mm256_max_ps(vacc0x01234567, vmin);
+    vacc0x89ABCDEF = _mm256_max_ps(vacc0x89ABCDEF, vmin);
+
+    const __m256 vmax = _mm256_load_ps(params->avx.max);
+    vacc0x01234567 = _mm256_min_ps(vacc0x01234567, vmax);
+    vacc0x89ABCDEF = _mm256_min_ps(vacc0x89ABCDEF, vmax);
+
+    if XNN_LIKELY(nc >= 16) {
+      _mm_storeu_si128((__m128i*) c0, _mm256_cvtps_ph(vacc0x01234567, _MM_FROUND_NO_EXC));
+      _mm_storeu_si128((__m128i*) (c0 + 8), _mm256_cvtps_ph(vacc0x89ABCDEF, _MM_FROUND_NO_EXC));
+      c0 = (uint16_t*) ((uintptr_t) c0 + cn_stride);
+
+      a0 = (const uint16_t*) ((uintptr_t) a0 - kc);
+
+      nc -= 16;
+    } else {
+      __m128i vh0x01234567 = _mm256_cvtps_ph(vacc0x01234567, _MM_FROUND_NO_EXC);
+      if (nc & 8) {
+        _mm_storeu_si128((__m128i*) c0, vh0x01234567);
+
+        vh0x01234567 = _mm256_cvtps_ph(vacc0x89ABCDEF, _MM_FROUND_NO_EXC);
+
+        c0 += 8;
+      }
+      if (nc & 4) {
+        _mm_storel_epi64((__m128i*) c0, vh0x01234567);
+
+        vh0x01234567 = _mm_unpackhi_epi64(vh0x01234567, vh0x01234567);
+
+        c0 += 4;
+      }
+      if (nc & 2) {
+        _mm_storeu_si32(c0, vh0x01234567);
+
+        vh0x01234567 = _mm_srli_epi64(vh0x01234567, 32);
+
+        c0 += 2;
+      }
+      if (nc & 1) {
+        *c0 = (uint16_t) _mm_extract_epi16(vh0x01234567, 0);
+      }
+
+      nc = 0;
+    }
+  } while (nc != 0);
+}
+
 void xnn_f16_gemm_minmax_ukernel_1x16__avx2_broadcast(
     size_t mr,
     size_t nc,
@@ -2907,6 +3044,599 @@ void xnn_qc8_igemm_minmax_fp32_ukernel_3x8c8__avx2(
   } while (nc != 0);
 }
 
+void xnn_qs8_avgpool_minmax_fp32_ukernel_9p8x__avx2_c16(
+    size_t output_pixels,
+    size_t kernel_elements,
+    size_t channels,
+    const int8_t** input,
+    size_t input_offset,
+    const int8_t* zero,
+    int32_t* buffer,
+    int8_t* output,
+    size_t input_increment,
+    size_t output_increment,
+    const union xnn_qs8_avgpool_minmax_params params[restrict XNN_MIN_ELEMENTS(1)]) XNN_OOB_READS
+{
+  assert(output_pixels != 0);
+  assert(kernel_elements > 9);
+  assert(channels != 0);
+
+  const __m256i vinit_bias = _mm256_load_si256((const __m256i*) params->fp32_avx2.init_bias);
+  const __m256 vscale = _mm256_load_ps(params->fp32_avx2.scale);
+  const __m256 voutput_max_less_zero_point = _mm256_load_ps(params->fp32_avx2.output_max_less_zero_point);
+  const __m256i voutput_zero_point = _mm256_load_si256((const __m256i*) params->fp32_avx2.output_zero_point);
+  const __m128i voutput_min = _mm_load_si128((const __m128i*) params->fp32_avx2.output_min);
+  do {
+    // First pass.
+    {
+      const int8_t* i0 = *input++;
+      assert(i0 != NULL);
+      if XNN_UNPREDICTABLE(i0 != zero) {
+        i0 = (const int8_t*) ((uintptr_t) i0 + input_offset);
+      }
+      const int8_t* i1 = *input++;
+      assert(i1 != NULL);
+      if XNN_UNPREDICTABLE(i1 != zero) {
+        i1 = (const int8_t*) ((uintptr_t) i1 + input_offset);
+      }
+      const int8_t* i2 = *input++;
+      assert(i2 != NULL);
+      if XNN_UNPREDICTABLE(i2 != zero) {
+        i2 = (const int8_t*) ((uintptr_t) i2 + input_offset);
+      }
+      const int8_t* i3 = *input++;
+      assert(i3 != NULL);
+      if XNN_UNPREDICTABLE(i3 != zero) {
+        i3 = (const int8_t*) ((uintptr_t) i3 + input_offset);
+      }
+      const int8_t* i4 = *input++;
+      assert(i4 != NULL);
+      if XNN_UNPREDICTABLE(i4 != zero) {
+        i4 = (const int8_t*) ((uintptr_t) i4 + input_offset);
+      }
+      const int8_t* i5 = *input++;
+      assert(i5 != NULL);
+      if XNN_UNPREDICTABLE(i5 != zero) {
+        i5 = (const int8_t*) ((uintptr_t) i5 + input_offset);
+      }
+      const int8_t* i6 = *input++;
+      assert(i6 != NULL);
+      if XNN_UNPREDICTABLE(i6 != zero) {
+        i6 = (const int8_t*) ((uintptr_t) i6 + input_offset);
+      }
+      const int8_t* i7 = *input++;
+      assert(i7 != NULL);
+      if XNN_UNPREDICTABLE(i7 != zero) {
+        i7 = (const int8_t*) ((uintptr_t) i7 + input_offset);
+      }
+      const int8_t* i8 = *input++;
+      assert(i8 != NULL);
+      if XNN_UNPREDICTABLE(i8 != zero) {
+        i8 = (const int8_t*) ((uintptr_t) i8 + input_offset);
+      }
+
+      int32_t* b = buffer;
+      for (size_t c = 0; c < channels; c += 16) {
+        const __m256i vxi0 = _mm256_cvtepi8_epi16(_mm_loadu_si128((const __m128i*) i0));
+        i0 += 16;
+        const __m256i vxi1 = _mm256_cvtepi8_epi16(_mm_loadu_si128((const __m128i*) i1));
+        i1 += 16;
+        const __m256i vxi2 = _mm256_cvtepi8_epi16(_mm_loadu_si128((const __m128i*) i2));
+        i2 += 16;
+        const __m256i vxi3 = _mm256_cvtepi8_epi16(_mm_loadu_si128((const __m128i*) i3));
+        i3 += 16;
+        const __m256i vxi4 = _mm256_cvtepi8_epi16(_mm_loadu_si128((const __m128i*) i4));
+        i4 += 16;
+        const __m256i vxi5 = _mm256_cvtepi8_epi16(_mm_loadu_si128((const __m128i*) i5));
+        i5 += 16;
+        const __m256i vxi6 = _mm256_cvtepi8_epi16(_mm_loadu_si128((const __m128i*) i6));
+        i6 += 16;
+        const __m256i vxi7 = _mm256_cvtepi8_epi16(_mm_loadu_si128((const __m128i*) i7));
+        i7 += 16;
+        const __m256i vxi8 = _mm256_cvtepi8_epi16(_mm_loadu_si128((const __m128i*) i8));
+        i8 += 16;
+
+        __m256i vsum = _mm256_add_epi16(vxi0, vxi1);
+        vsum = _mm256_add_epi16(vsum, vxi2);
+        vsum = _mm256_add_epi16(vsum, vxi3);
+        vsum = _mm256_add_epi16(vsum, vxi4);
+        vsum = _mm256_add_epi16(vsum, vxi5);
+        vsum = _mm256_add_epi16(vsum, vxi6);
+        vsum = _mm256_add_epi16(vsum, vxi7);
+        vsum = _mm256_add_epi16(vsum, vxi8);
+
+        __m256i vacc01234567 = _mm256_cvtepi16_epi32(_mm256_castsi256_si128(vsum));
+        __m256i vacc89ABCDEF = _mm256_cvtepi16_epi32(_mm256_extracti128_si256(vsum, 1));
+        vacc01234567 = _mm256_add_epi32(vacc01234567, vinit_bias);
+        vacc89ABCDEF = _mm256_add_epi32(vacc89ABCDEF, vinit_bias);
+
+        _mm256_store_si256((__m256i*) b, vacc01234567);
+        _mm256_store_si256((__m256i*) (b + 8), vacc89ABCDEF);
+        b += 16;
+      }
+    }
+
+    size_t k = kernel_elements;
+    // Intermediate passes.
+    for (k -= 9; k > 8; k -= 8) {
+      const int8_t* i0 = *input++;
+      assert(i0 != NULL);
+      if XNN_UNPREDICTABLE(i0 != zero) {
+        i0 = (const int8_t*) ((uintptr_t) i0 + input_offset);
+      }
+      const int8_t* i1 = *input++;
+      assert(i1 != NULL);
+      if XNN_UNPREDICTABLE(i1 != zero) {
+        i1 = (const int8_t*) ((uintptr_t) i1 + input_offset);
+      }
+      const int8_t* i2 = *input++;
+      assert(i2 != NULL);
+      if XNN_UNPREDICTABLE(i2 != zero) {
+        i2 = (const int8_t*) ((uintptr_t) i2 + input_offset);
+      }
+      const int8_t* i3 = *input++;
+      assert(i3 != NULL);
+      if XNN_UNPREDICTABLE(i3 != zero) {
+        i3 = (const int8_t*) ((uintptr_t) i3 + input_offset);
+      }
+      const int8_t* i4 = *input++;
+      assert(i4 != NULL);
+      if XNN_UNPREDICTABLE(i4 != zero) {
+        i4 = (const int8_t*) ((uintptr_t) i4 + input_offset);
+      }
+      const int8_t* i5 = *input++;
+      assert(i5 != NULL);
+      if XNN_UNPREDICTABLE(i5 != zero) {
+        i5 = (const int8_t*) ((uintptr_t) i5 + input_offset);
+      }
+      const int8_t* i6 = *input++;
+      assert(i6 != NULL);
+      if XNN_UNPREDICTABLE(i6 != zero) {
+        i6 = (const int8_t*) ((uintptr_t) i6 + input_offset);
+      }
+      const int8_t* i7 = *input++;
+      assert(i7 != NULL);
+      if XNN_UNPREDICTABLE(i7 != zero) {
+        i7 = (const int8_t*) ((uintptr_t) i7 + input_offset);
+      }
+
+      int32_t* b = buffer;
+      for (size_t c = 0; c < channels; c += 16) {
+        const __m256i vxi0 = _mm256_cvtepi8_epi16(_mm_loadu_si128((const __m128i*) i0));
+        i0 += 16;
+        const __m256i vxi1 = _mm256_cvtepi8_epi16(_mm_loadu_si128((const __m128i*) i1));
+        i1 += 16;
+        const __m256i vxi2 = _mm256_cvtepi8_epi16(_mm_loadu_si128((const __m128i*) i2));
+        i2 += 16;
+        const __m256i vxi3 = _mm256_cvtepi8_epi16(_mm_loadu_si128((const __m128i*) i3));
+        i3 += 16;
+        const __m256i vxi4 = _mm256_cvtepi8_epi16(_mm_loadu_si128((const __m128i*) i4));
+        i4 += 16;
+        const __m256i vxi5 = _mm256_cvtepi8_epi16(_mm_loadu_si128((const __m128i*) i5));
+        i5 += 16;
+        const __m256i vxi6 = _mm256_cvtepi8_epi16(_mm_loadu_si128((const __m128i*) i6));
+        i6 += 16;
+        const __m256i vxi7 = _mm256_cvtepi8_epi16(_mm_loadu_si128((const __m128i*) i7));
+        i7 += 16;
+
+        __m256i vsum = _mm256_add_epi16(vxi0, vxi1);
+        vsum = _mm256_add_epi16(vsum, vxi2);
+        vsum = _mm256_add_epi16(vsum, vxi3);
+        vsum = _mm256_add_epi16(vsum, vxi4);
+        vsum = _mm256_add_epi16(vsum, vxi5);
+        vsum = _mm256_add_epi16(vsum, vxi6);
+        vsum = _mm256_add_epi16(vsum, vxi7);
+
+        __m256i vacc01234567 = _mm256_cvtepi16_epi32(_mm256_castsi256_si128(vsum));
+        __m256i vacc89ABCDEF = _mm256_cvtepi16_epi32(_mm256_extracti128_si256(vsum, 1));
+        vacc01234567 = _mm256_add_epi32(vacc01234567, _mm256_load_si256((const __m256i*) b));
+        vacc89ABCDEF = _mm256_add_epi32(vacc89ABCDEF, _mm256_load_si256((const __m256i*) (b + 8)));
+
+        _mm256_store_si256((__m256i*) b, vacc01234567);
+        _mm256_store_si256((__m256i*) (b + 8), vacc89ABCDEF);
+        b += 16;
+      }
+    }
+
+    // Last pass.
+    {
+      const int8_t* i0 = input[0];
+      assert(i0 != NULL);
+      const int8_t* i1 = input[1];
+      const int8_t* i2 = input[2];
+      const int8_t* i3 = input[3];
+      const int8_t* i4 = input[4];
+      const int8_t* i5 = input[5];
+      const int8_t* i6 = input[6];
+      const int8_t* i7 = input[7];
+      input = (const int8_t**) ((uintptr_t) input + input_increment);
+      if (k < 2) {
+        i1 = zero;
+      }
+      assert(i1 != NULL);
+      if (k <= 2) {
+        i2 = zero;
+      }
+      assert(i2 != NULL);
+      if (k < 4) {
+        i3 = zero;
+      }
+      assert(i3 != NULL);
+      if (k <= 4) {
+        i4 = zero;
+      }
+      assert(i4 != NULL);
+      if (k < 6) {
+        i5 = zero;
+      }
+      assert(i5 != NULL);
+      if (k <= 6) {
+        i6 = zero;
+      }
+      assert(i6 != NULL);
+      if (k < 8) {
+        i7 = zero;
+      }
+      assert(i7 != NULL);
+      if XNN_UNPREDICTABLE(i0 != zero) {
+        i0 = (const int8_t*) ((uintptr_t) i0 + input_offset);
+      }
+      if XNN_UNPREDICTABLE(i1 != zero) {
+        i1 = (const int8_t*) ((uintptr_t) i1 + input_offset);
+      }
+      if XNN_UNPREDICTABLE(i2 != zero) {
+        i2 = (const int8_t*) ((uintptr_t) i2 + input_offset);
+      }
+      if XNN_UNPREDICTABLE(i3 != zero) {
+        i3 = (const int8_t*) ((uintptr_t) i3 + input_offset);
+      }
+      if XNN_UNPREDICTABLE(i4 != zero) {
+        i4 = (const int8_t*) ((uintptr_t) i4 + input_offset);
+      }
+      if XNN_UNPREDICTABLE(i5 != zero) {
+        i5 = (const int8_t*) ((uintptr_t) i5 + input_offset);
+      }
+      if XNN_UNPREDICTABLE(i6 != zero) {
+        i6 = (const int8_t*) ((uintptr_t) i6 + input_offset);
+      }
+      if XNN_UNPREDICTABLE(i7 != zero) {
+        i7 = (const int8_t*) ((uintptr_t) i7 + input_offset);
+      }
+
+      int32_t* b = buffer;
+      size_t c = channels;
+      for (; c >= 16; c -= 16) {
+        const __m256i vxi0 = _mm256_cvtepi8_epi16(_mm_loadu_si128((const __m128i*) i0));
+        i0 += 16;
+        const __m256i vxi1 = _mm256_cvtepi8_epi16(_mm_loadu_si128((const __m128i*) i1));
+        i1 += 16;
+        const __m256i vxi2 = _mm256_cvtepi8_epi16(_mm_loadu_si128((const __m128i*) i2));
+        i2 += 16;
+        const __m256i vxi3 = _mm256_cvtepi8_epi16(_mm_loadu_si128((const __m128i*) i3));
+        i3 += 16;
+        const __m256i vxi4 = _mm256_cvtepi8_epi16(_mm_loadu_si128((const __m128i*) i4));
+        i4 += 16;
+        const __m256i vxi5 = _mm256_cvtepi8_epi16(_mm_loadu_si128((const __m128i*) i5));
+        i5 += 16;
+        const __m256i vxi6 = _mm256_cvtepi8_epi16(_mm_loadu_si128((const __m128i*) i6));
+        i6 += 16;
+        const __m256i vxi7 = _mm256_cvtepi8_epi16(_mm_loadu_si128((const __m128i*) i7));
+        i7 += 16;
+
+        __m256i vsum = _mm256_add_epi16(vxi0, vxi1);
+        vsum = _mm256_add_epi16(vsum, vxi2);
+        vsum = _mm256_add_epi16(vsum, vxi3);
+        vsum = _mm256_add_epi16(vsum, vxi4);
+        vsum = _mm256_add_epi16(vsum, vxi5);
+        vsum = _mm256_add_epi16(vsum, vxi6);
+        vsum = _mm256_add_epi16(vsum, vxi7);
+
+        __m256i vacc01234567 = _mm256_cvtepi16_epi32(_mm256_castsi256_si128(vsum));
+        __m256i vacc89ABCDEF = _mm256_cvtepi16_epi32(_mm256_extracti128_si256(vsum, 1));
+        vacc01234567 = _mm256_add_epi32(vacc01234567, _mm256_load_si256((const __m256i*) b));
+        vacc89ABCDEF = _mm256_add_epi32(vacc89ABCDEF, _mm256_load_si256((const __m256i*) (b + 8)));
+        b += 16;
+
+        __m256 vfpacc01234567 = _mm256_cvtepi32_ps(vacc01234567);
+        __m256 vfpacc89ABCDEF = _mm256_cvtepi32_ps(vacc89ABCDEF);
+
+        vfpacc01234567 = _mm256_mul_ps(vfpacc01234567, vscale);
+        vfpacc89ABCDEF = _mm256_mul_ps(vfpacc89ABCDEF, vscale);
+
+        vfpacc01234567 = _mm256_min_ps(vfpacc01234567, voutput_max_less_zero_point);
+        vfpacc89ABCDEF = _mm256_min_ps(vfpacc89ABCDEF, voutput_max_less_zero_point);
+
+        vacc01234567 = _mm256_cvtps_epi32(vfpacc01234567);
+        vacc89ABCDEF = _mm256_cvtps_epi32(vfpacc89ABCDEF);
+
+        const __m256i vout012389AB4567CDEF = _mm256_adds_epi16(_mm256_packs_epi32(vacc01234567, vacc89ABCDEF), voutput_zero_point);
+
+        __m128i vout0123456789ABCDEF = _mm_shuffle_epi32(_mm_packs_epi16(_mm256_castsi256_si128(vout012389AB4567CDEF), _mm256_extracti128_si256(vout012389AB4567CDEF, 1)), _MM_SHUFFLE(3, 1, 2, 0));
+        vout0123456789ABCDEF = _mm_max_epi8(vout0123456789ABCDEF, voutput_min);
+
+        _mm_storeu_si128((__m128i*) output, vout0123456789ABCDEF);
+        output += 16;
+      }
+      if (c != 0) {
+        const __m256i vxi0 = _mm256_cvtepi8_epi16(_mm_loadu_si128((const __m128i*) i0));
+        const __m256i vxi1 = _mm256_cvtepi8_epi16(_mm_loadu_si128((const __m128i*) i1));
+        const __m256i vxi2 = _mm256_cvtepi8_epi16(_mm_loadu_si128((const __m128i*) i2));
+        const __m256i vxi3 = _mm256_cvtepi8_epi16(_mm_loadu_si128((const __m128i*) i3));
+        const __m256i vxi4 = _mm256_cvtepi8_epi16(_mm_loadu_si128((const __m128i*) i4));
+        const __m256i vxi5 = _mm256_cvtepi8_epi16(_mm_loadu_si128((const __m128i*) i5));
+        const __m256i vxi6 = _mm256_cvtepi8_epi16(_mm_loadu_si128((const __m128i*) i6));
+        const __m256i vxi7 = _mm256_cvtepi8_epi16(_mm_loadu_si128((const __m128i*) i7));
+
+        __m256i vsum = _mm256_add_epi16(vxi0, vxi1);
+        vsum = _mm256_add_epi16(vsum, vxi2);
+        vsum = _mm256_add_epi16(vsum, vxi3);
+        vsum = _mm256_add_epi16(vsum, vxi4);
+        vsum = _mm256_add_epi16(vsum, vxi5);
+        vsum = _mm256_add_epi16(vsum, vxi6);
+        vsum = _mm256_add_epi16(vsum, vxi7);
+
+        __m256i vacc01234567 = _mm256_cvtepi16_epi32(_mm256_castsi256_si128(vsum));
+        __m256i vacc89ABCDEF = _mm256_cvtepi16_epi32(_mm256_extracti128_si256(vsum, 1));
+        vacc01234567 = _mm256_add_epi32(vacc01234567, _mm256_load_si256((const __m256i*) b));
+        vacc89ABCDEF = _mm256_add_epi32(vacc89ABCDEF, _mm256_load_si256((const __m256i*) (b + 8)));
+
+        __m256 vfpacc01234567 = _mm256_cvtepi32_ps(vacc01234567);
+        __m256 vfpacc89ABCDEF = _mm256_cvtepi32_ps(vacc89ABCDEF);
+
+        vfpacc01234567 = _mm256_mul_ps(vfpacc01234567, vscale);
+        vfpacc89ABCDEF = _mm256_mul_ps(vfpacc89ABCDEF, vscale);
+
+        vfpacc01234567 = _mm256_min_ps(vfpacc01234567, voutput_max_less_zero_point);
+        vfpacc89ABCDEF = _mm256_min_ps(vfpacc89ABCDEF, voutput_max_less_zero_point);
+
+        vacc01234567 = _mm256_cvtps_epi32(vfpacc01234567);
+        vacc89ABCDEF = _mm256_cvtps_epi32(vfpacc89ABCDEF);
+
+        const __m256i vout012389AB4567CDEF = _mm256_adds_epi16(_mm256_packs_epi32(vacc01234567, vacc89ABCDEF), voutput_zero_point);
+
+        __m128i vout0123456789ABCDEF = _mm_shuffle_epi32(_mm_packs_epi16(_mm256_castsi256_si128(vout012389AB4567CDEF), _mm256_extracti128_si256(vout012389AB4567CDEF, 1)), _MM_SHUFFLE(3, 1, 2, 0));
+        vout0123456789ABCDEF = _mm_max_epi8(vout0123456789ABCDEF, voutput_min);
+
+        if (c & 8) {
+          _mm_storel_epi64((__m128i*) output, vout0123456789ABCDEF);
+          vout0123456789ABCDEF = _mm_unpackhi_epi64(vout0123456789ABCDEF, vout0123456789ABCDEF);
+          output += 8;
+        }
+        if (c & 4) {
+          *((uint32_t*) output) = (uint32_t) _mm_cvtsi128_si32(vout0123456789ABCDEF);
+          vout0123456789ABCDEF = _mm_srli_epi64(vout0123456789ABCDEF, 32);
+          output += 4;
+        }
+        if (c & 2) {
+          *((uint16_t*) output) = (uint16_t) _mm_extract_epi16(vout0123456789ABCDEF, 0);
+          vout0123456789ABCDEF = _mm_srli_epi32(vout0123456789ABCDEF, 16);
+          output += 2;
+        }
+        if (c & 1) {
+          *output = (int8_t) _mm_extract_epi8(vout0123456789ABCDEF, 0);
+          output += 1;
+        }
+      }
+    }
+    output = (int8_t*) ((uintptr_t) output + output_increment);
+  } while (--output_pixels != 0);
+}
+
+void xnn_qs8_avgpool_minmax_fp32_ukernel_9x__avx2_c16(
+    size_t output_pixels,
+    size_t kernel_elements,
+    size_t channels,
+    const int8_t** input,
+    size_t input_offset,
+    const int8_t* zero,
+    int8_t* output,
+    size_t input_increment,
+    size_t output_increment,
+    const union xnn_qs8_avgpool_minmax_params params[restrict XNN_MIN_ELEMENTS(1)]) XNN_OOB_READS
+{
+  assert(output_pixels != 0);
+  assert(kernel_elements != 0);
+  assert(kernel_elements <= 9);
+  assert(channels != 0);
+
+  const __m256i vinit_bias = _mm256_load_si256((const __m256i*) params->fp32_avx2.init_bias);
+  const __m256 vscale = _mm256_load_ps(params->fp32_avx2.scale);
+  const __m256 voutput_max_less_zero_point = _mm256_load_ps(params->fp32_avx2.output_max_less_zero_point);
+  const __m256i voutput_zero_point = _mm256_load_si256((const __m256i*) params->fp32_avx2.output_zero_point);
+  const __m128i voutput_min = _mm_load_si128((const __m128i*) params->fp32_avx2.output_min);
+  do {
+    const int8_t* i0 = input[0];
+    assert(i0 != NULL);
+    const int8_t* i1 = input[1];
+    const int8_t* i2 = input[2];
+    const int8_t* i3 = input[3];
+    const int8_t* i4 = input[4];
+    const int8_t* i5 = input[5];
+    const int8_t* i6 = input[6];
+    const int8_t* i7 = input[7];
+    const int8_t* i8 = input[8];
+    input = (const int8_t**) ((uintptr_t) input + input_increment);
+    if (kernel_elements < 2) {
+      i1 = zero;
+    }
+    assert(i1 != NULL);
+    if (kernel_elements <= 2) {
+      i2 = zero;
+    }
+    assert(i2 != NULL);
+    if (kernel_elements < 4) {
+      i3 = zero;
+    }
+    assert(i3 != NULL);
+    if (kernel_elements <= 4) {
+      i4 = zero;
+    }
+    assert(i4 != NULL);
+    if (kernel_elements < 6) {
+      i5 = zero;
+    }
+    assert(i5 != NULL);
+    if (kernel_elements <= 6) {
+      i6 = zero;
+    }
+    assert(i6 != NULL);
+    if (kernel_elements < 8) {
+      i7 = zero;
+    }
+    assert(i7 != NULL);
+    if (kernel_elements <= 8) {
+      i8 = zero;
+    }
+    assert(i8 != NULL);
+    if XNN_UNPREDICTABLE(i0 != zero) {
+      i0 = (const int8_t*) ((uintptr_t) i0 + input_offset);
+    }
+    if XNN_UNPREDICTABLE(i1 != zero) {
+      i1 = (const int8_t*) ((uintptr_t) i1 + input_offset);
+    }
+    if XNN_UNPREDICTABLE(i2 != zero) {
+      i2 = (const int8_t*) ((uintptr_t) i2 + input_offset);
+    }
+    if XNN_UNPREDICTABLE(i3 != zero) {
+      i3 = (const int8_t*) ((uintptr_t) i3 + input_offset);
+    }
+    if XNN_UNPREDICTABLE(i4 != zero) {
+      i4 = (const int8_t*) ((uintptr_t) i4 + input_offset);
+    }
+    if XNN_UNPREDICTABLE(i5 != zero) {
+      i5 = (const int8_t*) ((uintptr_t) i5 + input_offset);
+    }
+    if XNN_UNPREDICTABLE(i6 != zero) {
+      i6 = (const int8_t*) ((uintptr_t) i6 + input_offset);
+    }
+    if XNN_UNPREDICTABLE(i7 != zero) {
+      i7 = (const int8_t*) ((uintptr_t) i7 + input_offset);
+    }
+    if XNN_UNPREDICTABLE(i8 != zero) {
+      i8 = (const int8_t*) ((uintptr_t) i8 + input_offset);
+    }
+
+    size_t c = channels;
+    for (; c >= 16; c -= 16) {
+      const __m256i vxi0 = _mm256_cvtepi8_epi16(_mm_loadu_si128((const __m128i*) i0));
+      i0 += 16;
+      const __m256i vxi1 = _mm256_cvtepi8_epi16(_mm_loadu_si128((const __m128i*) i1));
+      i1 += 16;
+      const __m256i vxi2 = _mm256_cvtepi8_epi16(_mm_loadu_si128((const __m128i*) i2));
+      i2 += 16;
+      const __m256i vxi3 = _mm256_cvtepi8_epi16(_mm_loadu_si128((const __m128i*) i3));
+      i3 += 16;
+      const __m256i vxi4 = _mm256_cvtepi8_epi16(_mm_loadu_si128((const __m128i*) i4));
+      i4 += 16;
+      const __m256i vxi5 = _mm256_cvtepi8_epi16(_mm_loadu_si128((const __m128i*) i5));
+      i5 += 16;
+      const __m256i vxi6 = _mm256_cvtepi8_epi16(_mm_loadu_si128((const __m128i*) i6));
+      i6 += 16;
+      const __m256i vxi7 = _mm256_cvtepi8_epi16(_mm_loadu_si128((const __m128i*) i7));
+      i7 += 16;
+      const __m256i vxi8 = _mm256_cvtepi8_epi16(_mm_loadu_si128((const __m128i*) i8));
+      i8 += 16;
+
+      __m256i vsum = _mm256_add_epi16(vxi0, vxi1);
+      vsum = _mm256_add_epi16(vsum, vxi2);
+      vsum = _mm256_add_epi16(vsum, vxi3);
+      vsum = _mm256_add_epi16(vsum, vxi4);
+      vsum = _mm256_add_epi16(vsum, vxi5);
+      vsum = _mm256_add_epi16(vsum, vxi6);
+      vsum = _mm256_add_epi16(vsum, vxi7);
+      vsum = _mm256_add_epi16(vsum, vxi8);
+
+      __m256i vacc01234567 = _mm256_cvtepi16_epi32(_mm256_castsi256_si128(vsum));
+      __m256i vacc89ABCDEF = _mm256_cvtepi16_epi32(_mm256_extracti128_si256(vsum, 1));
+      vacc01234567 = _mm256_add_epi32(vacc01234567, vinit_bias);
+      vacc89ABCDEF = _mm256_add_epi32(vacc89ABCDEF, vinit_bias);
+
+      __m256 vfpacc01234567 = _mm256_cvtepi32_ps(vacc01234567);
+      __m256 vfpacc89ABCDEF = _mm256_cvtepi32_ps(vacc89ABCDEF);
+
+      vfpacc01234567 = _mm256_mul_ps(vfpacc01234567, vscale);
+      vfpacc89ABCDEF = _mm256_mul_ps(vfpacc89ABCDEF, vscale);
+
+      vfpacc01234567 = _mm256_min_ps(vfpacc01234567, voutput_max_less_zero_point);
+      vfpacc89ABCDEF = _mm256_min_ps(vfpacc89ABCDEF, voutput_max_less_zero_point);
+
+      vacc01234567 = _mm256_cvtps_epi32(vfpacc01234567);
+      vacc89ABCDEF = _mm256_cvtps_epi32(vfpacc89ABCDEF);
+
+      const __m256i vout012389AB4567CDEF = _mm256_adds_epi16(_mm256_packs_epi32(vacc01234567, vacc89ABCDEF), voutput_zero_point);
+
+      __m128i vout0123456789ABCDEF = _mm_shuffle_epi32(_mm_packs_epi16(_mm256_castsi256_si128(vout012389AB4567CDEF), _mm256_extracti128_si256(vout012389AB4567CDEF, 1)), _MM_SHUFFLE(3, 1, 2, 0));
+      vout0123456789ABCDEF = _mm_max_epi8(vout0123456789ABCDEF, voutput_min);
+
+      _mm_storeu_si128((__m128i*) output, vout0123456789ABCDEF);
+      output += 16;
+    }
+    if (c != 0) {
+      const __m256i vxi0 = _mm256_cvtepi8_epi16(_mm_loadu_si128((const __m128i*) i0));
+      const __m256i vxi1 = _mm256_cvtepi8_epi16(_mm_loadu_si128((const __m128i*) i1));
+      const __m256i vxi2 = _mm256_cvtepi8_epi16(_mm_loadu_si128((const __m128i*) i2));
+      const __m256i vxi3 = _mm256_cvtepi8_epi16(_mm_loadu_si128((const __m128i*) i3));
+      const __m256i vxi4 = _mm256_cvtepi8_epi16(_mm_loadu_si128((const __m128i*) i4));
+      const __m256i vxi5 = _mm256_cvtepi8_epi16(_mm_loadu_si128((const __m128i*) i5));
+      const __m256i vxi6 = _mm256_cvtepi8_epi16(_mm_loadu_si128((const __m128i*) i6));
+      const __m256i vxi7 = _mm256_cvtepi8_epi16(_mm_loadu_si128((const __m128i*) i7));
+      const __m256i vxi8 = _mm256_cvtepi8_epi16(_mm_loadu_si128((const __m128i*) i8));
+
+      __m256i vsum = _mm256_add_epi16(vxi0, vxi1);
+      vsum = _mm256_add_epi16(vsum, vxi2);
+      vsum = _mm256_add_epi16(vsum, vxi3);
+      vsum = _mm256_add_epi16(vsum, vxi4);
+      vsum = _mm256_add_epi16(vsum, vxi5);
+      vsum = _mm256_add_epi16(vsum, vxi6);
+      vsum = _mm256_add_epi16(vsum, vxi7);
+      vsum = _mm256_add_epi16(vsum, vxi8);
+
+      __m256i vacc01234567 = _mm256_cvtepi16_epi32(_mm256_castsi256_si128(vsum));
+      __m256i vacc89ABCDEF = _mm256_cvtepi16_epi32(_mm256_extracti128_si256(vsum, 1));
+      vacc01234567 = _mm256_add_epi32(vacc01234567, vinit_bias);
+      vacc89ABCDEF = _mm256_add_epi32(vacc89ABCDEF, vinit_bias);
+
+      __m256 vfpacc01234567 = _mm256_cvtepi32_ps(vacc01234567);
+      __m256 vfpacc89ABCDEF = _mm256_cvtepi32_ps(vacc89ABCDEF);
+
+      vfpacc01234567 = _mm256_mul_ps(vfpacc01234567, vscale);
+      vfpacc89ABCDEF = _mm256_mul_ps(vfpacc89ABCDEF, vscale);
+
+      vfpacc01234567 = _mm256_min_ps(vfpacc01234567, voutput_max_less_zero_point);
+      vfpacc89ABCDEF = _mm256_min_ps(vfpacc89ABCDEF, voutput_max_less_zero_point);
+
+      vacc01234567 = _mm256_cvtps_epi32(vfpacc01234567);
+      vacc89ABCDEF = _mm256_cvtps_epi32(vfpacc89ABCDEF);
+
+      const __m256i vout012389AB4567CDEF = _mm256_adds_epi16(_mm256_packs_epi32(vacc01234567, vacc89ABCDEF), voutput_zero_point);
+
+      __m128i vout0123456789ABCDEF = _mm_shuffle_epi32(_mm_packs_epi16(_mm256_castsi256_si128(vout012389AB4567CDEF), _mm256_extracti128_si256(vout012389AB4567CDEF, 1)), _MM_SHUFFLE(3, 1, 2, 0));
+      vout0123456789ABCDEF = _mm_max_epi8(vout0123456789ABCDEF, voutput_min);
+
+      if (c & 8) {
+        _mm_storel_epi64((__m128i*) output, vout0123456789ABCDEF);
+        vout0123456789ABCDEF = _mm_unpackhi_epi64(vout0123456789ABCDEF, vout0123456789ABCDEF);
+        output += 8;
+      }
+      if (c & 4) {
+        *((uint32_t*) output) = (uint32_t) _mm_cvtsi128_si32(vout0123456789ABCDEF);
+        vout0123456789ABCDEF = _mm_srli_epi64(vout0123456789ABCDEF, 32);
+        output += 4;
+      }
+      if (c & 2) {
+        *((uint16_t*) output) = (uint16_t) _mm_extract_epi16(vout0123456789ABCDEF, 0);
+        vout0123456789ABCDEF = _mm_srli_epi32(vout0123456789ABCDEF, 16);
+        output += 2;
+      }
+      if (c & 1) {
+        *output = (int8_t) _mm_extract_epi8(vout0123456789ABCDEF, 0);
+        output += 1;
+      }
+    }
+    output = (int8_t*) ((uintptr_t) output + output_increment);
+  } while (--output_pixels != 0);
+}
+
 void xnn_qs8_dwconv_minmax_fp32_ukernel_up16x25__avx2_mul32(
     size_t channels,
     size_t output_width,
@@ -853,6 +853,101 @@ void xnn_f32_dwconv_minmax_ukernel_up16x9__avx512f(
   } while (--output_width != 0);
 }
 
+void xnn_f32_gemm_minmax_ukernel_1x16__avx512f_broadcast_acc4(
+    size_t mr,
+    size_t nc,
+    size_t kc,
+    const float*restrict a,
+    size_t a_stride,
+    const float*restrict w,
+    float*restrict c,
+    size_t cm_stride,
+    size_t cn_stride,
+    const union xnn_f32_minmax_params params[restrict XNN_MIN_ELEMENTS(1)])
+{
+  assert(mr != 0);
+  assert(mr <= 1);
+  assert(nc != 0);
+  assert(kc != 0);
+  assert(kc % sizeof(float) == 0);
+  assert(a != NULL);
+  assert(w != NULL);
+  assert(c != NULL);
+
+  const float* a0 = a;
+  float* c0 = c;
+
+  do {
+    __m512 vacc0x0123456789ABCDEF = _mm512_load_ps(w);
+    __m512 vacc1x0123456789ABCDEF = _mm512_setzero_ps();
+    __m512 vacc2x0123456789ABCDEF = _mm512_setzero_ps();
+    __m512 vacc3x0123456789ABCDEF = _mm512_setzero_ps();
+    w += 16;
+
+    size_t k = kc;
+    for (; k >= 4 * sizeof(float); k -= 4 * sizeof(float)) {
+      _mm_prefetch((const char*) (w + 512), _MM_HINT_T0);
+      _mm_prefetch((const char*) (w + 528), _MM_HINT_T0);
+      _mm_prefetch((const char*) (w + 544), _MM_HINT_T0);
+      _mm_prefetch((const char*) (w + 560), _MM_HINT_T0);
+
+      const __m512 va0c0 = _mm512_set1_ps(a0[0]);
+      const __m512 va0c1 = _mm512_set1_ps(a0[1]);
+      const __m512 va0c2 = _mm512_set1_ps(a0[2]);
+      const __m512 va0c3 = _mm512_set1_ps(a0[3]);
+      a0 += 4;
+
+      const __m512 vb0123456789ABCDEFc0 = _mm512_load_ps(w + 0);
+      const __m512 vb0123456789ABCDEFc1 = _mm512_load_ps(w + 16);
+      const __m512 vb0123456789ABCDEFc2 = _mm512_load_ps(w + 32);
+      const __m512 vb0123456789ABCDEFc3 = _mm512_load_ps(w + 48);
+      w += 64;
+
+      vacc0x0123456789ABCDEF = _mm512_fmadd_ps(va0c0, vb0123456789ABCDEFc0, vacc0x0123456789ABCDEF);
+      vacc1x0123456789ABCDEF = _mm512_fmadd_ps(va0c1, vb0123456789ABCDEFc1, vacc1x0123456789ABCDEF);
+      vacc2x0123456789ABCDEF = _mm512_fmadd_ps(va0c2, vb0123456789ABCDEFc2, vacc2x0123456789ABCDEF);
+      vacc3x0123456789ABCDEF = _mm512_fmadd_ps(va0c3, vb0123456789ABCDEFc3, vacc3x0123456789ABCDEF);
+    }
+    for (; k != 0; k -= sizeof(float)) {
+      const __m512 va0 = _mm512_set1_ps(*a0);
+      a0 += 1;
+
+      const __m512 vb0123456789ABCDEF = _mm512_load_ps(w + 0);
+      w += 16;
+
+      vacc0x0123456789ABCDEF = _mm512_fmadd_ps(va0, vb0123456789ABCDEF, vacc0x0123456789ABCDEF);
+    }
+    // Add up all accumulators to vacc0
+    vacc0x0123456789ABCDEF = _mm512_add_ps(vacc0x0123456789ABCDEF, vacc1x0123456789ABCDEF);
+    vacc2x0123456789ABCDEF = _mm512_add_ps(vacc2x0123456789ABCDEF, vacc3x0123456789ABCDEF);
+    vacc0x0123456789ABCDEF = _mm512_add_ps(vacc0x0123456789ABCDEF, vacc2x0123456789ABCDEF);
+
+    const __m512 vmin = _mm512_set1_ps(params->scalar.min);
+    vacc0x0123456789ABCDEF = _mm512_max_ps(vacc0x0123456789ABCDEF, vmin);
+
+    const __m512 vmax = _mm512_set1_ps(params->scalar.max);
+    vacc0x0123456789ABCDEF = _mm512_min_ps(vacc0x0123456789ABCDEF, vmax);
+
+    if XNN_LIKELY(nc >= 16) {
+      _mm512_storeu_ps(c0, vacc0x0123456789ABCDEF);
+      c0 = (float*) ((uintptr_t) c0 + cn_stride);
+
+      a0 = (const float*) ((uintptr_t) a0 - kc);
+
+      nc -= 16;
+    } else {
+      if (nc & 15) {
+        // Prepare mask for valid 32-bit elements (depends on nc).
+        const __mmask16 vmask = _cvtu32_mask16((uint16_t) ((uint32_t) (UINT32_C(1) << nc) - UINT32_C(1)));
+
+        _mm512_mask_storeu_ps(c0, vmask, vacc0x0123456789ABCDEF);
+      }
+
+      nc = 0;
+    }
+  } while (nc != 0);
+}
+
 void xnn_f32_gemm_minmax_ukernel_1x16__avx512f_broadcast(
     size_t mr,
     size_t nc,
@@ -7,17 +7,527 @@
 
 #include <immintrin.h>
 
+#include <xnnpack/avgpool.h>
 #include <xnnpack/common.h>
 #include <xnnpack/gavgpool.h>
 #include <xnnpack/intrinsics-polyfill.h>
 #include <xnnpack/math.h>
 #include <xnnpack/maxpool.h>
+#include <xnnpack/pavgpool.h>
 #include <xnnpack/prelu.h>
 #include <xnnpack/vbinary.h>
 #include <xnnpack/vcvt.h>
 #include <xnnpack/vunary.h>
 
 
+void xnn_f16_avgpool_minmax_ukernel_9p8x__f16c_c8(
+    size_t output_pixels,
+    size_t kernel_elements,
+    size_t channels,
+    const void** input,
+    size_t input_offset,
+    const void* zero,
+    void* buffer,
+    void* output_ptr,
+    size_t input_increment,
+    size_t output_increment,
+    const union xnn_f16_scaleminmax_params params[restrict XNN_MIN_ELEMENTS(1)]) XNN_OOB_READS
+{
+  assert(output_pixels != 0);
+  assert(kernel_elements > 9);
+  assert(channels != 0);
+
+  const __m256 vscale = _mm256_load_ps(params->avx.scale);
+  const __m256 voutput_min = _mm256_load_ps(params->avx.min);
+  const __m256 voutput_max = _mm256_load_ps(params->avx.max);
+
+  uint16_t* output = (uint16_t*) output_ptr;
+  do {
+    // First pass.
+    {
+      const uint16_t* i0 = (const uint16_t*) *input++;
+      assert(i0 != NULL);
+      if XNN_UNPREDICTABLE(i0 != (const uint16_t*) zero) {
+        i0 = (const uint16_t*) ((uintptr_t) i0 + input_offset);
+      }
+      const uint16_t* i1 = (const uint16_t*) *input++;
+      assert(i1 != NULL);
+      if XNN_UNPREDICTABLE(i1 != (const uint16_t*) zero) {
+        i1 = (const uint16_t*) ((uintptr_t) i1 + input_offset);
+      }
+      const uint16_t* i2 = (const uint16_t*) *input++;
+      assert(i2 != NULL);
+      if XNN_UNPREDICTABLE(i2 != (const uint16_t*) zero) {
+        i2 = (const uint16_t*) ((uintptr_t) i2 + input_offset);
+      }
+      const uint16_t* i3 = (const uint16_t*) *input++;
+      assert(i3 != NULL);
+      if XNN_UNPREDICTABLE(i3 != (const uint16_t*) zero) {
+        i3 = (const uint16_t*) ((uintptr_t) i3 + input_offset);
+      }
+      const uint16_t* i4 = (const uint16_t*) *input++;
+      assert(i4 != NULL);
+      if XNN_UNPREDICTABLE(i4 != (const uint16_t*) zero) {
+        i4 = (const uint16_t*) ((uintptr_t) i4 + input_offset);
+      }
+      const uint16_t* i5 = (const uint16_t*) *input++;
+      assert(i5 != NULL);
+      if XNN_UNPREDICTABLE(i5 != (const uint16_t*) zero) {
+        i5 = (const uint16_t*) ((uintptr_t) i5 + input_offset);
+      }
+      const uint16_t* i6 = (const uint16_t*) *input++;
+      assert(i6 != NULL);
+      if XNN_UNPREDICTABLE(i6 != (const uint16_t*) zero) {
+        i6 = (const uint16_t*) ((uintptr_t) i6 + input_offset);
+      }
+      const uint16_t* i7 = (const uint16_t*) *input++;
+      assert(i7 != NULL);
+      if XNN_UNPREDICTABLE(i7 != (const uint16_t*) zero) {
+        i7 = (const uint16_t*) ((uintptr_t) i7 + input_offset);
+      }
+      const uint16_t* i8 = (const uint16_t*) *input++;
+      assert(i8 != NULL);
+      if XNN_UNPREDICTABLE(i8 != (const uint16_t*) zero) {
+        i8 = (const uint16_t*) ((uintptr_t) i8 + input_offset);
+      }
+
+      uint16_t* b = (uint16_t*) buffer;
+      for (size_t c = 0; c < channels; c += 8) {
+        const __m256 vi0 = _mm256_cvtph_ps(_mm_loadu_si128((const __m128i*) i0));
+        i0 += 8;
+        const __m256 vi1 = _mm256_cvtph_ps(_mm_loadu_si128((const __m128i*) i1));
+        i1 += 8;
+        const __m256 vi2 = _mm256_cvtph_ps(_mm_loadu_si128((const __m128i*) i2));
+        i2 += 8;
+        const __m256 vi3 = _mm256_cvtph_ps(_mm_loadu_si128((const __m128i*) i3));
+        i3 += 8;
+        const __m256 vi4 = _mm256_cvtph_ps(_mm_loadu_si128((const __m128i*) i4));
+        i4 += 8;
+        const __m256 vi5 = _mm256_cvtph_ps(_mm_loadu_si128((const __m128i*) i5));
+        i5 += 8;
+        const __m256 vi6 = _mm256_cvtph_ps(_mm_loadu_si128((const __m128i*) i6));
+        i6 += 8;
+        const __m256 vi7 = _mm256_cvtph_ps(_mm_loadu_si128((const __m128i*) i7));
+        i7 += 8;
+        const __m256 vi8 = _mm256_cvtph_ps(_mm_loadu_si128((const __m128i*) i8));
+        i8 += 8;
+
+        __m128i vacc = _mm256_cvtps_ph(_mm256_add_ps(vi0, vi1), _MM_FROUND_NO_EXC);
+        vacc = _mm256_cvtps_ph(_mm256_add_ps(_mm256_cvtph_ps(vacc), vi2), _MM_FROUND_NO_EXC);
+        vacc = _mm256_cvtps_ph(_mm256_add_ps(_mm256_cvtph_ps(vacc), vi3), _MM_FROUND_NO_EXC);
+        vacc = _mm256_cvtps_ph(_mm256_add_ps(_mm256_cvtph_ps(vacc), vi4), _MM_FROUND_NO_EXC);
+        vacc = _mm256_cvtps_ph(_mm256_add_ps(_mm256_cvtph_ps(vacc), vi5), _MM_FROUND_NO_EXC);
+        vacc = _mm256_cvtps_ph(_mm256_add_ps(_mm256_cvtph_ps(vacc), vi6), _MM_FROUND_NO_EXC);
+        vacc = _mm256_cvtps_ph(_mm256_add_ps(_mm256_cvtph_ps(vacc), vi7), _MM_FROUND_NO_EXC);
+        vacc = _mm256_cvtps_ph(_mm256_add_ps(_mm256_cvtph_ps(vacc), vi8), _MM_FROUND_NO_EXC);
+
+        _mm_storeu_si128((__m128i*) b, vacc);
+        b += 8;
+      }
+    }
+
+    size_t k = kernel_elements;
+    // Intermediate passes.
+    for (k -= 9; k > 8; k -= 8) {
+      const uint16_t* i0 = (const uint16_t*) *input++;
+      assert(i0 != NULL);
+      if XNN_UNPREDICTABLE(i0 != (const uint16_t*) zero) {
+        i0 = (const uint16_t*) ((uintptr_t) i0 + input_offset);
+      }
+      const uint16_t* i1 = (const uint16_t*) *input++;
+      assert(i1 != NULL);
+      if XNN_UNPREDICTABLE(i1 != (const uint16_t*) zero) {
+        i1 = (const uint16_t*) ((uintptr_t) i1 + input_offset);
+      }
+      const uint16_t* i2 = (const uint16_t*) *input++;
+      assert(i2 != NULL);
+      if XNN_UNPREDICTABLE(i2 != (const uint16_t*) zero) {
+        i2 = (const uint16_t*) ((uintptr_t) i2 + input_offset);
+      }
+      const uint16_t* i3 = (const uint16_t*) *input++;
+      assert(i3 != NULL);
+      if XNN_UNPREDICTABLE(i3 != (const uint16_t*) zero) {
+        i3 = (const uint16_t*) ((uintptr_t) i3 + input_offset);
+      }
+      const uint16_t* i4 = (const uint16_t*) *input++;
+      assert(i4 != NULL);
+      if XNN_UNPREDICTABLE(i4 != (const uint16_t*) zero) {
+        i4 = (const uint16_t*) ((uintptr_t) i4 + input_offset);
+      }
+      const uint16_t* i5 = (const uint16_t*) *input++;
+      assert(i5 != NULL);
+      if XNN_UNPREDICTABLE(i5 != (const uint16_t*) zero) {
+        i5 = (const uint16_t*) ((uintptr_t) i5 + input_offset);
+      }
+      const uint16_t* i6 = (const uint16_t*) *input++;
+      assert(i6 != NULL);
+      if XNN_UNPREDICTABLE(i6 != (const uint16_t*) zero) {
+        i6 = (const uint16_t*) ((uintptr_t) i6 + input_offset);
+      }
+      const uint16_t* i7 = (const uint16_t*) *input++;
+      assert(i7 != NULL);
+      if XNN_UNPREDICTABLE(i7 != (const uint16_t*) zero) {
+        i7 = (const uint16_t*) ((uintptr_t) i7 + input_offset);
+      }
+
+      uint16_t* b = (uint16_t*) buffer;
+      for (size_t c = 0; c < channels; c += 8) {
+        const __m256 vi0 = _mm256_cvtph_ps(_mm_loadu_si128((const __m128i*) i0));
+        i0 += 8;
+        const __m256 vi1 = _mm256_cvtph_ps(_mm_loadu_si128((const __m128i*) i1));
+        i1 += 8;
+        const __m256 vi2 = _mm256_cvtph_ps(_mm_loadu_si128((const __m128i*) i2));
+        i2 += 8;
+        const __m256 vi3 = _mm256_cvtph_ps(_mm_loadu_si128((const __m128i*) i3));
+        i3 += 8;
+        const __m256 vi4 = _mm256_cvtph_ps(_mm_loadu_si128((const __m128i*) i4));
+        i4 += 8;
+        const __m256 vi5 = _mm256_cvtph_ps(_mm_loadu_si128((const __m128i*) i5));
+        i5 += 8;
+        const __m256 vi6 = _mm256_cvtph_ps(_mm_loadu_si128((const __m128i*) i6));
+        i6 += 8;
+        const __m256 vi7 = _mm256_cvtph_ps(_mm_loadu_si128((const __m128i*) i7));
+        i7 += 8;
+
+        __m128i vacc = _mm256_cvtps_ph(_mm256_add_ps(vi0, vi1), _MM_FROUND_NO_EXC);
+        vacc = _mm256_cvtps_ph(_mm256_add_ps(_mm256_cvtph_ps(vacc), vi2), _MM_FROUND_NO_EXC);
+        vacc = _mm256_cvtps_ph(_mm256_add_ps(_mm256_cvtph_ps(vacc), vi3), _MM_FROUND_NO_EXC);
+        vacc = _mm256_cvtps_ph(_mm256_add_ps(_mm256_cvtph_ps(vacc), vi4), _MM_FROUND_NO_EXC);
+        vacc = _mm256_cvtps_ph(_mm256_add_ps(_mm256_cvtph_ps(vacc), vi5), _MM_FROUND_NO_EXC);
+        vacc = _mm256_cvtps_ph(_mm256_add_ps(_mm256_cvtph_ps(vacc), vi6), _MM_FROUND_NO_EXC);
+        vacc = _mm256_cvtps_ph(_mm256_add_ps(_mm256_cvtph_ps(vacc), vi7), _MM_FROUND_NO_EXC);
+        vacc = _mm256_cvtps_ph(_mm256_add_ps(_mm256_cvtph_ps(vacc), _mm256_cvtph_ps(_mm_loadu_si128((const __m128i*) b))), _MM_FROUND_NO_EXC);
+
+        _mm_storeu_si128((__m128i*) b, vacc);
+        b += 8;
+      }
+    }
+
+    // Last pass.
+    {
+      const uint16_t* i0 = (const uint16_t*) input[0];
+      assert(i0 != NULL);
+      const uint16_t* i1 = (const uint16_t*) input[1];
+      const uint16_t* i2 = (const uint16_t*) input[2];
+      const uint16_t* i3 = (const uint16_t*) input[3];
+      const uint16_t* i4 = (const uint16_t*) input[4];
+      const uint16_t* i5 = (const uint16_t*) input[5];
+      const uint16_t* i6 = (const uint16_t*) input[6];
+      const uint16_t* i7 = (const uint16_t*) input[7];
+      input = (const void**) ((uintptr_t) input + input_increment);
+      if (k < 2) {
+        i1 = (const uint16_t*) zero;
+      }
+      assert(i1 != NULL);
+      if (k <= 2) {
+        i2 = (const uint16_t*) zero;
+      }
+      assert(i2 != NULL);
+      if (k < 4) {
+        i3 = (const uint16_t*) zero;
+      }
+      assert(i3 != NULL);
+      if (k <= 4) {
+        i4 = (const uint16_t*) zero;
+      }
+      assert(i4 != NULL);
+      if (k < 6) {
+        i5 = (const uint16_t*) zero;
+      }
+      assert(i5 != NULL);
+      if (k <= 6) {
+        i6 = (const uint16_t*) zero;
+      }
+      assert(i6 != NULL);
+      if (k < 8) {
+        i7 = (const uint16_t*) zero;
+      }
+      assert(i7 != NULL);
+      if XNN_UNPREDICTABLE(i0 != (const uint16_t*) zero) {
+        i0 = (const uint16_t*) ((uintptr_t) i0 + input_offset);
+      }
+      if XNN_UNPREDICTABLE(i1 != (const uint16_t*) zero) {
+        i1 = (const uint16_t*) ((uintptr_t) i1 + input_offset);
+      }
+      if XNN_UNPREDICTABLE(i2 != (const uint16_t*) zero) {
+        i2 = (const uint16_t*) ((uintptr_t) i2 + input_offset);
+      }
+      if XNN_UNPREDICTABLE(i3 != (const uint16_t*) zero) {
+        i3 = (const uint16_t*) ((uintptr_t) i3 + input_offset);
+      }
+      if XNN_UNPREDICTABLE(i4 != (const uint16_t*) zero) {
+        i4 = (const uint16_t*) ((uintptr_t) i4 + input_offset);
+      }
+      if XNN_UNPREDICTABLE(i5 != (const uint16_t*) zero) {
+        i5 = (const uint16_t*) ((uintptr_t) i5 + input_offset);
+      }
+      if XNN_UNPREDICTABLE(i6 != (const uint16_t*) zero) {
+        i6 = (const uint16_t*) ((uintptr_t) i6 + input_offset);
+      }
+      if XNN_UNPREDICTABLE(i7 != (const uint16_t*) zero) {
+        i7 = (const uint16_t*) ((uintptr_t) i7 + input_offset);
+      }
+
+      uint16_t* b = (uint16_t*) buffer;
+      size_t c = channels;
+      for (; c >= 8; c -= 8) {
+        const __m256 vi0 = _mm256_cvtph_ps(_mm_loadu_si128((const __m128i*) i0));
+        i0 += 8;
+        const __m256 vi1 = _mm256_cvtph_ps(_mm_loadu_si128((const __m128i*) i1));
+        i1 += 8;
+        const __m256 vi2 = _mm256_cvtph_ps(_mm_loadu_si128((const __m128i*) i2));
+        i2 += 8;
+        const __m256 vi3 = _mm256_cvtph_ps(_mm_loadu_si128((const __m128i*) i3));
+        i3 += 8;
+        const __m256 vi4 = _mm256_cvtph_ps(_mm_loadu_si128((const __m128i*) i4));
+        i4 += 8;
+        const __m256 vi5 = _mm256_cvtph_ps(_mm_loadu_si128((const __m128i*) i5));
+        i5 += 8;
+        const __m256 vi6 = _mm256_cvtph_ps(_mm_loadu_si128((const __m128i*) i6));
+        i6 += 8;
+        const __m256 vi7 = _mm256_cvtph_ps(_mm_loadu_si128((const __m128i*) i7));
+        i7 += 8;
+
+        __m128i vacc = _mm256_cvtps_ph(_mm256_add_ps(vi0, vi1), _MM_FROUND_NO_EXC);
+        vacc = _mm256_cvtps_ph(_mm256_add_ps(_mm256_cvtph_ps(vacc), vi2), _MM_FROUND_NO_EXC);
+        vacc = _mm256_cvtps_ph(_mm256_add_ps(_mm256_cvtph_ps(vacc), vi3), _MM_FROUND_NO_EXC);
+        vacc = _mm256_cvtps_ph(_mm256_add_ps(_mm256_cvtph_ps(vacc), vi4), _MM_FROUND_NO_EXC);
+        vacc = _mm256_cvtps_ph(_mm256_add_ps(_mm256_cvtph_ps(vacc), vi5), _MM_FROUND_NO_EXC);
+        vacc = _mm256_cvtps_ph(_mm256_add_ps(_mm256_cvtph_ps(vacc), vi6), _MM_FROUND_NO_EXC);
+        vacc = _mm256_cvtps_ph(_mm256_add_ps(_mm256_cvtph_ps(vacc), vi7), _MM_FROUND_NO_EXC);
+        vacc = _mm256_cvtps_ph(_mm256_add_ps(_mm256_cvtph_ps(vacc), _mm256_cvtph_ps(_mm_loadu_si128((const __m128i*) b))), _MM_FROUND_NO_EXC);
+        b += 8;
+
+        vacc = _mm256_cvtps_ph(_mm256_mul_ps(_mm256_cvtph_ps(vacc), vscale), _MM_FROUND_NO_EXC);
+
+        __m256 vout = _mm256_max_ps(_mm256_cvtph_ps(vacc), voutput_min);
+        vout = _mm256_min_ps(vout, voutput_max);
+
+        _mm_storeu_si128((__m128i*) output, _mm256_cvtps_ph(vout, _MM_FROUND_NO_EXC));
+        output += 8;
+      }
+      if (c != 0) {
+        const __m256 vi0 = _mm256_cvtph_ps(_mm_loadu_si128((const __m128i*) i0));
+        const __m256 vi1 = _mm256_cvtph_ps(_mm_loadu_si128((const __m128i*) i1));
+        const __m256 vi2 = _mm256_cvtph_ps(_mm_loadu_si128((const __m128i*) i2));
+        const __m256 vi3 = _mm256_cvtph_ps(_mm_loadu_si128((const __m128i*) i3));
+        const __m256 vi4 = _mm256_cvtph_ps(_mm_loadu_si128((const __m128i*) i4));
+        const __m256 vi5 = _mm256_cvtph_ps(_mm_loadu_si128((const __m128i*) i5));
+        const __m256 vi6 = _mm256_cvtph_ps(_mm_loadu_si128((const __m128i*) i6));
+        const __m256 vi7 = _mm256_cvtph_ps(_mm_loadu_si128((const __m128i*) i7));
+
+        __m128i vacc = _mm256_cvtps_ph(_mm256_add_ps(vi0, vi1), _MM_FROUND_NO_EXC);
+        vacc = _mm256_cvtps_ph(_mm256_add_ps(_mm256_cvtph_ps(vacc), vi2), _MM_FROUND_NO_EXC);
+        vacc = _mm256_cvtps_ph(_mm256_add_ps(_mm256_cvtph_ps(vacc), vi3), _MM_FROUND_NO_EXC);
+        vacc = _mm256_cvtps_ph(_mm256_add_ps(_mm256_cvtph_ps(vacc), vi4), _MM_FROUND_NO_EXC);
+        vacc = _mm256_cvtps_ph(_mm256_add_ps(_mm256_cvtph_ps(vacc), vi5), _MM_FROUND_NO_EXC);
+        vacc = _mm256_cvtps_ph(_mm256_add_ps(_mm256_cvtph_ps(vacc), vi6), _MM_FROUND_NO_EXC);
+        vacc = _mm256_cvtps_ph(_mm256_add_ps(_mm256_cvtph_ps(vacc), vi7), _MM_FROUND_NO_EXC);
+        vacc = _mm256_cvtps_ph(_mm256_add_ps(_mm256_cvtph_ps(vacc), _mm256_cvtph_ps(_mm_loadu_si128((const __m128i*) b))), _MM_FROUND_NO_EXC);
+
+        vacc = _mm256_cvtps_ph(_mm256_mul_ps(_mm256_cvtph_ps(vacc), vscale), _MM_FROUND_NO_EXC);
+
+        __m256 vout = _mm256_max_ps(_mm256_cvtph_ps(vacc), voutput_min);
+        vout = _mm256_min_ps(vout, voutput_max);
+
+        __m128i vh = _mm256_cvtps_ph(vout, _MM_FROUND_NO_EXC);
+        if (c & 4) {
+          _mm_storel_epi64((__m128i*) output, vh);
+          vh = _mm_unpackhi_epi64(vh, vh);
+          output += 4;
+        }
+        if (c & 2) {
+          *((uint32_t*) output) = (uint32_t) _mm_cvtsi128_si32(vh);
+          vh = _mm_srli_epi64(vh, 32);
+          output += 2;
+        }
+        if (c & 1) {
+          *output = (uint16_t) _mm_extract_epi16(vh, 0);
+          output += 1;
+        }
+      }
+    }
+    output = (uint16_t*) ((uintptr_t) output + output_increment);
+  } while (--output_pixels != 0);
+}
+
+void xnn_f16_avgpool_minmax_ukernel_9x__f16c_c8(
+    size_t output_pixels,
+    size_t kernel_elements,
+    size_t channels,
+    const void** input,
+    size_t input_offset,
+    const void* zero,
+    void* output_ptr,
+    size_t input_increment,
+    size_t output_increment,
+    const union xnn_f16_scaleminmax_params params[restrict XNN_MIN_ELEMENTS(1)]) XNN_OOB_READS
+{
+  assert(output_pixels != 0);
+  assert(kernel_elements != 0);
+  assert(kernel_elements <= 9);
+  assert(channels != 0);
+
+  const __m256 vscale = _mm256_load_ps(params->avx.scale);
+  const __m256 voutput_min = _mm256_load_ps(params->avx.min);
+  const __m256 voutput_max = _mm256_load_ps(params->avx.max);
+
+  uint16_t* output = (uint16_t*) output_ptr;
+  do {
+    const uint16_t* i0 = (const uint16_t*) input[0];
+    assert(i0 != NULL);
+    const uint16_t* i1 = (const uint16_t*) input[1];
+    const uint16_t* i2 = (const uint16_t*) input[2];
+    const uint16_t* i3 = (const uint16_t*) input[3];
+    const uint16_t* i4 = (const uint16_t*) input[4];
+    const uint16_t* i5 = (const uint16_t*) input[5];
+    const uint16_t* i6 = (const uint16_t*) input[6];
+    const uint16_t* i7 = (const uint16_t*) input[7];
+    const uint16_t* i8 = (const uint16_t*) input[8];
+    input = (const void**) ((uintptr_t) input + input_increment);
+    if (kernel_elements < 2) {
+      i1 = (const uint16_t*) zero;
+    }
+    assert(i1 != NULL);
+    if (kernel_elements <= 2) {
+      i2 = (const uint16_t*) zero;
+    }
+    assert(i2 != NULL);
+    if (kernel_elements < 4) {
+      i3 = (const uint16_t*) zero;
+    }
+    assert(i3 != NULL);
+    if (kernel_elements <= 4) {
+      i4 = (const uint16_t*) zero;
+    }
+    assert(i4 != NULL);
+    if (kernel_elements < 6) {
+      i5 = (const uint16_t*) zero;
+    }
+    assert(i5 != NULL);
+    if (kernel_elements <= 6) {
+      i6 = (const uint16_t*) zero;
+    }
+    assert(i6 != NULL);
+    if (kernel_elements < 8) {
+      i7 = (const uint16_t*) zero;
+    }
+    assert(i7 != NULL);
+    if (kernel_elements <= 8) {
+      i8 = (const uint16_t*) zero;
+    }
+    assert(i8 != NULL);
+    if XNN_UNPREDICTABLE(i0 != (const uint16_t*) zero) {
+      i0 = (const uint16_t*) ((uintptr_t) i0 + input_offset);
+    }
+    if XNN_UNPREDICTABLE(i1 != (const uint16_t*) zero) {
+      i1 = (const uint16_t*) ((uintptr_t) i1 + input_offset);
+    }
+    if XNN_UNPREDICTABLE(i2 != (const uint16_t*) zero) {
+      i2 = (const uint16_t*) ((uintptr_t) i2 + input_offset);
+    }
+    if XNN_UNPREDICTABLE(i3 != (const uint16_t*) zero) {
+      i3 = (const uint16_t*) ((uintptr_t) i3 + input_offset);
+    }
+    if XNN_UNPREDICTABLE(i4 != (const uint16_t*) zero) {
+      i4 = (const uint16_t*) ((uintptr_t) i4 + input_offset);
+    }
+    if XNN_UNPREDICTABLE(i5 != (const uint16_t*) zero) {
+      i5 = (const uint16_t*) ((uintptr_t) i5 + input_offset);
+    }
+    if XNN_UNPREDICTABLE(i6 != (const uint16_t*) zero) {
+      i6 = (const uint16_t*) ((uintptr_t) i6 + input_offset);
+    }
+    if XNN_UNPREDICTABLE(i7 != (const uint16_t*) zero) {
+      i7 = (const uint16_t*) ((uintptr_t) i7 + input_offset);
+    }
+    if XNN_UNPREDICTABLE(i8 != (const uint16_t*) zero) {
+      i8 = (const uint16_t*) ((uintptr_t) i8 + input_offset);
+    }
+
+    size_t c = channels;
+    for (; c >= 8; c -= 8) {
+      const __m256 vi0 = _mm256_cvtph_ps(_mm_loadu_si128((const __m128i*) i0));
+      i0 += 8;
+      const __m256 vi1 = _mm256_cvtph_ps(_mm_loadu_si128((const __m128i*) i1));
+      i1 += 8;
+      const __m256 vi2 = _mm256_cvtph_ps(_mm_loadu_si128((const __m128i*) i2));
+      i2 += 8;
+      const __m256 vi3 = _mm256_cvtph_ps(_mm_loadu_si128((const __m128i*) i3));
+      i3 += 8;
+      const __m256 vi4 = _mm256_cvtph_ps(_mm_loadu_si128((const __m128i*) i4));
+      i4 += 8;
+      const __m256 vi5 = _mm256_cvtph_ps(_mm_loadu_si128((const __m128i*) i5));
+      i5 += 8;
+      const __m256 vi6 = _mm256_cvtph_ps(_mm_loadu_si128((const __m128i*) i6));
+      i6 += 8;
+      const __m256 vi7 = _mm256_cvtph_ps(_mm_loadu_si128((const __m128i*) i7));
+      i7 += 8;
+      const __m256 vi8 = _mm256_cvtph_ps(_mm_loadu_si128((const __m128i*) i8));
+      i8 += 8;
+
+      __m128i vacc = _mm256_cvtps_ph(_mm256_add_ps(vi0, vi1), _MM_FROUND_NO_EXC);
+      vacc = _mm256_cvtps_ph(_mm256_add_ps(_mm256_cvtph_ps(vacc), vi2), _MM_FROUND_NO_EXC);
+      vacc = _mm256_cvtps_ph(_mm256_add_ps(_mm256_cvtph_ps(vacc), vi3), _MM_FROUND_NO_EXC);
+      vacc = _mm256_cvtps_ph(_mm256_add_ps(_mm256_cvtph_ps(vacc), vi4), _MM_FROUND_NO_EXC);
+      vacc = _mm256_cvtps_ph(_mm256_add_ps(_mm256_cvtph_ps(vacc), vi5), _MM_FROUND_NO_EXC);
+      vacc = _mm256_cvtps_ph(_mm256_add_ps(_mm256_cvtph_ps(vacc), vi6), _MM_FROUND_NO_EXC);
+      vacc = _mm256_cvtps_ph(_mm256_add_ps(_mm256_cvtph_ps(vacc), vi7), _MM_FROUND_NO_EXC);
+      vacc = _mm256_cvtps_ph(_mm256_add_ps(_mm256_cvtph_ps(vacc), vi8), _MM_FROUND_NO_EXC);
+
+      vacc = _mm256_cvtps_ph(_mm256_mul_ps(_mm256_cvtph_ps(vacc), vscale), _MM_FROUND_NO_EXC);
+
+      __m256 vout = _mm256_max_ps(_mm256_cvtph_ps(vacc), voutput_min);
+      vout = _mm256_min_ps(vout, voutput_max);
+
+      _mm_storeu_si128((__m128i*) output, _mm256_cvtps_ph(vout, _MM_FROUND_NO_EXC));
+      output += 8;
+    }
+    if (c != 0) {
+      const __m256 vi0 = _mm256_cvtph_ps(_mm_loadu_si128((const __m128i*) i0));
+      const __m256 vi1 = _mm256_cvtph_ps(_mm_loadu_si128((const __m128i*) i1));
+      const __m256 vi2 = _mm256_cvtph_ps(_mm_loadu_si128((const __m128i*) i2));
+      const __m256 vi3 = _mm256_cvtph_ps(_mm_loadu_si128((const __m128i*) i3));
+      const __m256 vi4 = _mm256_cvtph_ps(_mm_loadu_si128((const __m128i*) i4));
+      const __m256 vi5 = _mm256_cvtph_ps(_mm_loadu_si128((const __m128i*) i5));
+      const __m256 vi6 = _mm256_cvtph_ps(_mm_loadu_si128((const __m128i*) i6));
+      const __m256 vi7 = _mm256_cvtph_ps(_mm_loadu_si128((const __m128i*) i7));
+      const __m256 vi8 = _mm256_cvtph_ps(_mm_loadu_si128((const __m128i*) i8));
+
+      __m128i vacc = _mm256_cvtps_ph(_mm256_add_ps(vi0, vi1), _MM_FROUND_NO_EXC);
+      vacc = _mm256_cvtps_ph(_mm256_add_ps(_mm256_cvtph_ps(vacc), vi2), _MM_FROUND_NO_EXC);
+      vacc = _mm256_cvtps_ph(_mm256_add_ps(_mm256_cvtph_ps(vacc), vi3), _MM_FROUND_NO_EXC);
+      vacc = _mm256_cvtps_ph(_mm256_add_ps(_mm256_cvtph_ps(vacc), vi4), _MM_FROUND_NO_EXC);
+      vacc = _mm256_cvtps_ph(_mm256_add_ps(_mm256_cvtph_ps(vacc), vi5), _MM_FROUND_NO_EXC);
+      vacc = _mm256_cvtps_ph(_mm256_add_ps(_mm256_cvtph_ps(vacc), vi6), _MM_FROUND_NO_EXC);
+      vacc = _mm256_cvtps_ph(_mm256_add_ps(_mm256_cvtph_ps(vacc), vi7), _MM_FROUND_NO_EXC);
+      vacc = _mm256_cvtps_ph(_mm256_add_ps(_mm256_cvtph_ps(vacc), vi8), _MM_FROUND_NO_EXC);
+
+      vacc = _mm256_cvtps_ph(_mm256_mul_ps(_mm256_cvtph_ps(vacc), vscale), _MM_FROUND_NO_EXC);
+
+      __m256 vout = _mm256_max_ps(_mm256_cvtph_ps(vacc), voutput_min);
+      vout = _mm256_min_ps(vout, voutput_max);
+
+      __m128i vh = _mm256_cvtps_ph(vout, _MM_FROUND_NO_EXC);
+      if (c & 4) {
+        _mm_storel_epi64((__m128i*) output, vh);
+        vh = _mm_unpackhi_epi64(vh, vh);
+        output += 4;
+      }
+      if (c & 2) {
+        *((uint32_t*) output) = (uint32_t) _mm_cvtsi128_si32(vh);
+        vh = _mm_srli_epi64(vh, 32);
+        output += 2;
+      }
+      if (c & 1) {
+        *output = (uint16_t) _mm_extract_epi16(vh, 0);
+        output += 1;
+      }
+    }
+    output = (uint16_t*) ((uintptr_t) output + output_increment);
+  } while (--output_pixels != 0);
+}
+
 void xnn_f16_f32_vcvt_ukernel__f16c_x16(
     size_t n,
     const void* input,
@@ -620,6 +1130,522 @@ void xnn_f16_maxpool_minmax_ukernel_9p8x__f16c_c8(
   } while (--output_pixels != 0);
 }
 
+void xnn_f16_pavgpool_minmax_ukernel_9p8x__f16c_c8(
+    size_t output_pixels,
+    size_t kernel_elements,
+    size_t channels,
+    const void** input,
+    size_t input_offset,
+    const void* zero,
+    const void* multiplier,
+    void* buffer,
+    void* output_ptr,
+    size_t input_increment,
+    size_t output_increment,
+    const union xnn_f16_minmax_params params[restrict XNN_MIN_ELEMENTS(1)]) XNN_OOB_READS
+{
+  assert(output_pixels != 0);
+  assert(kernel_elements > 9);
+  assert(channels != 0);
+
+  const __m256 voutput_min = _mm256_load_ps(params->avx.min);
+  const __m256 voutput_max = _mm256_load_ps(params->avx.max);
+
+  const uint16_t* m = (const uint16_t*) multiplier;
+  uint16_t* output = (uint16_t*) output_ptr;
+  do {
+    // First pass.
+    {
+      const uint16_t* i0 = (const uint16_t*) *input++;
+      assert(i0 != NULL);
+      if XNN_UNPREDICTABLE(i0 != (const uint16_t*) zero) {
+        i0 = (const uint16_t*) ((uintptr_t) i0 + input_offset);
+      }
+      const uint16_t* i1 = (const uint16_t*) *input++;
+      assert(i1 != NULL);
+      if XNN_UNPREDICTABLE(i1 != (const uint16_t*) zero) {
+        i1 = (const uint16_t*) ((uintptr_t) i1 + input_offset);
+      }
+      const uint16_t* i2 = (const uint16_t*) *input++;
+      assert(i2 != NULL);
+      if XNN_UNPREDICTABLE(i2 != (const uint16_t*) zero) {
+        i2 = (const uint16_t*) ((uintptr_t) i2 + input_offset);
+      }
+      const uint16_t* i3 = (const uint16_t*) *input++;
+      assert(i3 != NULL);
+      if XNN_UNPREDICTABLE(i3 != (const uint16_t*) zero) {
+        i3 = (const uint16_t*) ((uintptr_t) i3 + input_offset);
+      }
+      const uint16_t* i4 = (const uint16_t*) *input++;
+      assert(i4 != NULL);
+      if XNN_UNPREDICTABLE(i4 != (const uint16_t*) zero) {
+        i4 = (const uint16_t*) ((uintptr_t) i4 + input_offset);
+      }
+      const uint16_t* i5 = (const uint16_t*) *input++;
+      assert(i5 != NULL);
+      if XNN_UNPREDICTABLE(i5 != (const uint16_t*) zero) {
+        i5 = (const uint16_t*) ((uintptr_t) i5 + input_offset);
+      }
+      const uint16_t* i6 = (const uint16_t*) *input++;
+      assert(i6 != NULL);
+      if XNN_UNPREDICTABLE(i6 != (const uint16_t*) zero) {
+        i6 = (const uint16_t*) ((uintptr_t) i6 + input_offset);
+      }
+      const uint16_t* i7 = (const uint16_t*) *input++;
+      assert(i7 != NULL);
+      if XNN_UNPREDICTABLE(i7 != (const uint16_t*) zero) {
+        i7 = (const uint16_t*) ((uintptr_t) i7 + input_offset);
+      }
+      const uint16_t* i8 = (const uint16_t*) *input++;
+      assert(i8 != NULL);
+      if XNN_UNPREDICTABLE(i8 != (const uint16_t*) zero) {
+        i8 = (const uint16_t*) ((uintptr_t) i8 + input_offset);
+      }
+
+      uint16_t* b = (uint16_t*) buffer;
+      for (size_t c = 0; c < channels; c += 8) {
+        const __m256 vi0 = _mm256_cvtph_ps(_mm_loadu_si128((const __m128i*) i0));
+        i0 += 8;
+        const __m256 vi1 = _mm256_cvtph_ps(_mm_loadu_si128((const __m128i*) i1));
+        i1 += 8;
+        const __m256 vi2 = _mm256_cvtph_ps(_mm_loadu_si128((const __m128i*) i2));
+        i2 += 8;
+        const __m256 vi3 = _mm256_cvtph_ps(_mm_loadu_si128((const __m128i*) i3));
+        i3 += 8;
+        const __m256 vi4 = _mm256_cvtph_ps(_mm_loadu_si128((const __m128i*) i4));
+        i4 += 8;
+        const __m256 vi5 = _mm256_cvtph_ps(_mm_loadu_si128((const __m128i*) i5));
+        i5 += 8;
+        const __m256 vi6 = _mm256_cvtph_ps(_mm_loadu_si128((const __m128i*) i6));
+        i6 += 8;
+        const __m256 vi7 = _mm256_cvtph_ps(_mm_loadu_si128((const __m128i*) i7));
+        i7 += 8;
+        const __m256 vi8 = _mm256_cvtph_ps(_mm_loadu_si128((const __m128i*) i8));
+        i8 += 8;
+
+        __m128i vacc = _mm256_cvtps_ph(_mm256_add_ps(vi0, vi1), _MM_FROUND_NO_EXC);
+        vacc = _mm256_cvtps_ph(_mm256_add_ps(_mm256_cvtph_ps(vacc), vi2), _MM_FROUND_NO_EXC);
+        vacc = _mm256_cvtps_ph(_mm256_add_ps(_mm256_cvtph_ps(vacc), vi3), _MM_FROUND_NO_EXC);
+        vacc = _mm256_cvtps_ph(_mm256_add_ps(_mm256_cvtph_ps(vacc), vi4), _MM_FROUND_NO_EXC);
+        vacc = _mm256_cvtps_ph(_mm256_add_ps(_mm256_cvtph_ps(vacc), vi5), _MM_FROUND_NO_EXC);
+        vacc = _mm256_cvtps_ph(_mm256_add_ps(_mm256_cvtph_ps(vacc), vi6), _MM_FROUND_NO_EXC);
+        vacc = _mm256_cvtps_ph(_mm256_add_ps(_mm256_cvtph_ps(vacc), vi7), _MM_FROUND_NO_EXC);
+        vacc = _mm256_cvtps_ph(_mm256_add_ps(_mm256_cvtph_ps(vacc), vi8), _MM_FROUND_NO_EXC);
+
+        _mm_storeu_si128((__m128i*) b, vacc);
+        b += 8;
+      }
+    }
+
+    size_t k = kernel_elements;
+    // Intermediate passes.
+    for (k -= 9; k > 8; k -= 8) {
+      const uint16_t* i0 = (const uint16_t*) *input++;
+      assert(i0 != NULL);
+      if XNN_UNPREDICTABLE(i0 != (const uint16_t*) zero) {
+        i0 = (const uint16_t*) ((uintptr_t) i0 + input_offset);
+      }
+      const uint16_t* i1 = (const uint16_t*) *input++;
+      assert(i1 != NULL);
+      if XNN_UNPREDICTABLE(i1 != (const uint16_t*) zero) {
+        i1 = (const uint16_t*) ((uintptr_t) i1 + input_offset);
+      }
+      const uint16_t* i2 = (const uint16_t*) *input++;
+      assert(i2 != NULL);
+      if XNN_UNPREDICTABLE(i2 != (const uint16_t*) zero) {
+        i2 = (const uint16_t*) ((uintptr_t) i2 + input_offset);
+      }
+      const uint16_t* i3 = (const uint16_t*) *input++;
+      assert(i3 != NULL);
+      if XNN_UNPREDICTABLE(i3 != (const uint16_t*) zero) {
+        i3 = (const uint16_t*) ((uintptr_t) i3 + input_offset);
+      }
+      const uint16_t* i4 = (const uint16_t*) *input++;
+      assert(i4 != NULL);
+      if XNN_UNPREDICTABLE(i4 != (const uint16_t*) zero) {
+        i4 = (const uint16_t*) ((uintptr_t) i4 + input_offset);
+      }
+      const uint16_t* i5 = (const uint16_t*) *input++;
+      assert(i5 != NULL);
+      if XNN_UNPREDICTABLE(i5 != (const uint16_t*) zero) {
+        i5 = (const uint16_t*) ((uintptr_t) i5 + input_offset);
+      }
+      const uint16_t* i6 = (const uint16_t*) *input++;
+      assert(i6 != NULL);
+      if XNN_UNPREDICTABLE(i6 != (const uint16_t*) zero) {
+        i6 = (const uint16_t*) ((uintptr_t) i6 + input_offset);
+      }
+      const uint16_t* i7 = (const uint16_t*) *input++;
+      assert(i7 != NULL);
+      if XNN_UNPREDICTABLE(i7 != (const uint16_t*) zero) {
+        i7 = (const uint16_t*) ((uintptr_t) i7 + input_offset);
+      }
+
+      uint16_t* b = (uint16_t*) buffer;
+      for (size_t c = 0; c < channels; c += 8) {
+        const __m256 vi0 = _mm256_cvtph_ps(_mm_loadu_si128((const __m128i*) i0));
+        i0 += 8;
+        const __m256 vi1 = _mm256_cvtph_ps(_mm_loadu_si128((const __m128i*) i1));
+        i1 += 8;
+        const __m256 vi2 = _mm256_cvtph_ps(_mm_loadu_si128((const __m128i*) i2));
+        i2 += 8;
+        const __m256 vi3 = _mm256_cvtph_ps(_mm_loadu_si128((const __m128i*) i3));
+        i3 += 8;
+        const __m256 vi4 = _mm256_cvtph_ps(_mm_loadu_si128((const __m128i*) i4));
+        i4 += 8;
+        const __m256 vi5 = _mm256_cvtph_ps(_mm_loadu_si128((const __m128i*) i5));
+        i5 += 8;
+        const __m256 vi6 = _mm256_cvtph_ps(_mm_loadu_si128((const __m128i*) i6));
+        i6 += 8;
+        const __m256 vi7 = _mm256_cvtph_ps(_mm_loadu_si128((const __m128i*) i7));
+        i7 += 8;
+
+        __m128i vacc = _mm256_cvtps_ph(_mm256_add_ps(vi0, vi1), _MM_FROUND_NO_EXC);
+        vacc = _mm256_cvtps_ph(_mm256_add_ps(_mm256_cvtph_ps(vacc), vi2), _MM_FROUND_NO_EXC);
+        vacc = _mm256_cvtps_ph(_mm256_add_ps(_mm256_cvtph_ps(vacc), vi3), _MM_FROUND_NO_EXC);
+        vacc = _mm256_cvtps_ph(_mm256_add_ps(_mm256_cvtph_ps(vacc), vi4), _MM_FROUND_NO_EXC);
+        vacc = _mm256_cvtps_ph(_mm256_add_ps(_mm256_cvtph_ps(vacc), vi5), _MM_FROUND_NO_EXC);
+        vacc = _mm256_cvtps_ph(_mm256_add_ps(_mm256_cvtph_ps(vacc), vi6), _MM_FROUND_NO_EXC);
+        vacc = _mm256_cvtps_ph(_mm256_add_ps(_mm256_cvtph_ps(vacc), vi7), _MM_FROUND_NO_EXC);
+        vacc = _mm256_cvtps_ph(_mm256_add_ps(_mm256_cvtph_ps(vacc), _mm256_cvtph_ps(_mm_loadu_si128((const __m128i*) b))), _MM_FROUND_NO_EXC);
+
+        _mm_storeu_si128((__m128i*) b, vacc);
+        b += 8;
+      }
+    }
+
+    // Last pass.
+    {
+      const uint16_t* i0 = (const uint16_t*) input[0];
+      assert(i0 != NULL);
+      const uint16_t* i1 = (const uint16_t*) input[1];
+      const uint16_t* i2 = (const uint16_t*) input[2];
+      const uint16_t* i3 = (const uint16_t*) input[3];
+      const uint16_t* i4 = (const uint16_t*) input[4];
+      const uint16_t* i5 = (const uint16_t*) input[5];
+      const uint16_t* i6 = (const uint16_t*) input[6];
+      const uint16_t* i7 = (const uint16_t*) input[7];
+      input = (const void**) ((uintptr_t) input + input_increment);
+      if (k < 2) {
+        i1 = (const uint16_t*) zero;
+      }
+      assert(i1 != NULL);
+      if (k <= 2) {
+        i2 = (const uint16_t*) zero;
+      }
+      assert(i2 != NULL);
+      if (k < 4) {
+        i3 = (const uint16_t*) zero;
+      }
+      assert(i3 != NULL);
+      if (k <= 4) {
+        i4 = (const uint16_t*) zero;
+      }
+      assert(i4 != NULL);
+      if (k < 6) {
+        i5 = (const uint16_t*) zero;
+      }
+      assert(i5 != NULL);
+      if (k <= 6) {
+        i6 = (const uint16_t*) zero;
+      }
+      assert(i6 != NULL);
+      if (k < 8) {
+        i7 = (const uint16_t*) zero;
+      }
+      assert(i7 != NULL);
+      if XNN_UNPREDICTABLE(i0 != (const uint16_t*) zero) {
+        i0 = (const uint16_t*) ((uintptr_t) i0 + input_offset);
+      }
+      if XNN_UNPREDICTABLE(i1 != (const uint16_t*) zero) {
+        i1 = (const uint16_t*) ((uintptr_t) i1 + input_offset);
+      }
+      if XNN_UNPREDICTABLE(i2 != (const uint16_t*) zero) {
+        i2 = (const uint16_t*) ((uintptr_t) i2 + input_offset);
+      }
+      if XNN_UNPREDICTABLE(i3 != (const uint16_t*) zero) {
+        i3 = (const uint16_t*) ((uintptr_t) i3 + input_offset);
+      }
+      if XNN_UNPREDICTABLE(i4 != (const uint16_t*) zero) {
+        i4 = (const uint16_t*) ((uintptr_t) i4 + input_offset);
+      }
+      if XNN_UNPREDICTABLE(i5 != (const uint16_t*) zero) {
+        i5 = (const uint16_t*) ((uintptr_t) i5 + input_offset);
+      }
+      if XNN_UNPREDICTABLE(i6 != (const uint16_t*) zero) {
+        i6 = (const uint16_t*) ((uintptr_t) i6 + input_offset);
+      }
+      if XNN_UNPREDICTABLE(i7 != (const uint16_t*) zero) {
+        i7 = (const uint16_t*) ((uintptr_t) i7 + input_offset);
+      }
+
+      const __m256 vmultiplier = _mm256_cvtph_ps(_mm_set1_epi16((short) *m));
+      m += 1;
+
+      uint16_t* b = (uint16_t*) buffer;
+      size_t c = channels;
+      for (; c >= 8; c -= 8) {
+        const __m256 vi0 = _mm256_cvtph_ps(_mm_loadu_si128((const __m128i*) i0));
+        i0 += 8;
+        const __m256 vi1 = _mm256_cvtph_ps(_mm_loadu_si128((const __m128i*) i1));
+        i1 += 8;
+        const __m256 vi2 = _mm256_cvtph_ps(_mm_loadu_si128((const __m128i*) i2));
+        i2 += 8;
+        const __m256 vi3 = _mm256_cvtph_ps(_mm_loadu_si128((const __m128i*) i3));
+        i3 += 8;
+        const __m256 vi4 = _mm256_cvtph_ps(_mm_loadu_si128((const __m128i*) i4));
+        i4 += 8;
+        const __m256 vi5 = _mm256_cvtph_ps(_mm_loadu_si128((const __m128i*) i5));
+        i5 += 8;
+        const __m256 vi6 = _mm256_cvtph_ps(_mm_loadu_si128((const __m128i*) i6));
+        i6 += 8;
+        const __m256 vi7 = _mm256_cvtph_ps(_mm_loadu_si128((const __m128i*) i7));
+        i7 += 8;
+
+        __m128i vacc = _mm256_cvtps_ph(_mm256_add_ps(vi0, vi1), _MM_FROUND_NO_EXC);
+        vacc = _mm256_cvtps_ph(_mm256_add_ps(_mm256_cvtph_ps(vacc), vi2), _MM_FROUND_NO_EXC);
+        vacc = _mm256_cvtps_ph(_mm256_add_ps(_mm256_cvtph_ps(vacc), vi3), _MM_FROUND_NO_EXC);
+        vacc = _mm256_cvtps_ph(_mm256_add_ps(_mm256_cvtph_ps(vacc), vi4), _MM_FROUND_NO_EXC);
+        vacc = _mm256_cvtps_ph(_mm256_add_ps(_mm256_cvtph_ps(vacc), vi5), _MM_FROUND_NO_EXC);
+        vacc = _mm256_cvtps_ph(_mm256_add_ps(_mm256_cvtph_ps(vacc), vi6), _MM_FROUND_NO_EXC);
+        vacc = _mm256_cvtps_ph(_mm256_add_ps(_mm256_cvtph_ps(vacc), vi7), _MM_FROUND_NO_EXC);
+        vacc = _mm256_cvtps_ph(_mm256_add_ps(_mm256_cvtph_ps(vacc), _mm256_cvtph_ps(_mm_loadu_si128((const __m128i*) b))), _MM_FROUND_NO_EXC);
+        b += 8;
+
+        vacc = _mm256_cvtps_ph(_mm256_mul_ps(_mm256_cvtph_ps(vacc), vmultiplier), _MM_FROUND_NO_EXC);
+
+        __m256 vout = _mm256_max_ps(_mm256_cvtph_ps(vacc), voutput_min);
+        vout = _mm256_min_ps(vout, voutput_max);
+
+        _mm_storeu_si128((__m128i*) output, _mm256_cvtps_ph(vout, _MM_FROUND_NO_EXC));
+        output += 8;
+      }
+      if (c != 0) {
+        const __m256 vi0 = _mm256_cvtph_ps(_mm_loadu_si128((const __m128i*) i0));
+        const __m256 vi1 = _mm256_cvtph_ps(_mm_loadu_si128((const __m128i*) i1));
+        const __m256 vi2 = _mm256_cvtph_ps(_mm_loadu_si128((const __m128i*) i2));
+        const __m256 vi3 = _mm256_cvtph_ps(_mm_loadu_si128((const __m128i*) i3));
+        const __m256 vi4 = _mm256_cvtph_ps(_mm_loadu_si128((const __m128i*) i4));
+        const __m256 vi5 = _mm256_cvtph_ps(_mm_loadu_si128((const __m128i*) i5));
+        const __m256 vi6 = _mm256_cvtph_ps(_mm_loadu_si128((const __m128i*) i6));
+        const __m256 vi7 = _mm256_cvtph_ps(_mm_loadu_si128((const __m128i*) i7));
+
+        __m128i vacc = _mm256_cvtps_ph(_mm256_add_ps(vi0, vi1), _MM_FROUND_NO_EXC);
+        vacc = _mm256_cvtps_ph(_mm256_add_ps(_mm256_cvtph_ps(vacc), vi2), _MM_FROUND_NO_EXC);
+        vacc = _mm256_cvtps_ph(_mm256_add_ps(_mm256_cvtph_ps(vacc), vi3), _MM_FROUND_NO_EXC);
+        vacc = _mm256_cvtps_ph(_mm256_add_ps(_mm256_cvtph_ps(vacc), vi4), _MM_FROUND_NO_EXC);
+        vacc = _mm256_cvtps_ph(_mm256_add_ps(_mm256_cvtph_ps(vacc), vi5), _MM_FROUND_NO_EXC);
+        vacc = _mm256_cvtps_ph(_mm256_add_ps(_mm256_cvtph_ps(vacc), vi6), _MM_FROUND_NO_EXC);
+        vacc = _mm256_cvtps_ph(_mm256_add_ps(_mm256_cvtph_ps(vacc), vi7), _MM_FROUND_NO_EXC);
+        vacc = _mm256_cvtps_ph(_mm256_add_ps(_mm256_cvtph_ps(vacc), _mm256_cvtph_ps(_mm_loadu_si128((const __m128i*) b))), _MM_FROUND_NO_EXC);
+
+        vacc = _mm256_cvtps_ph(_mm256_mul_ps(_mm256_cvtph_ps(vacc), vmultiplier), _MM_FROUND_NO_EXC);
+
+        __m256 vout = _mm256_max_ps(_mm256_cvtph_ps(vacc), voutput_min);
+        vout = _mm256_min_ps(vout, voutput_max);
+
+        __m128i vh = _mm256_cvtps_ph(vout, _MM_FROUND_NO_EXC);
+        if (c & 4) {
+          _mm_storel_epi64((__m128i*) output, vh);
+          vh = _mm_unpackhi_epi64(vh, vh);
+          output += 4;
+        }
+        if (c & 2) {
+          *((uint32_t*) output) = (uint32_t) _mm_cvtsi128_si32(vh);
+          vh = _mm_srli_epi64(vh, 32);
+          output += 2;
+        }
+        if (c & 1) {
+          *output = (uint16_t) _mm_extract_epi16(vh, 0);
+          output += 1;
+        }
+      }
+    }
+    output = (uint16_t*) ((uintptr_t) output + output_increment);
+  } while (--output_pixels != 0);
+}
+
+void xnn_f16_pavgpool_minmax_ukernel_9x__f16c_c8(
+    size_t output_pixels,
+    size_t kernel_elements,
+    size_t channels,
+    const void** input,
+    size_t input_offset,
+    const void* zero,
+    const void* multiplier,
+    void* output_ptr,
+    size_t input_increment,
+    size_t output_increment,
+    const union xnn_f16_minmax_params params[restrict XNN_MIN_ELEMENTS(1)]) XNN_OOB_READS
+{
+  assert(output_pixels != 0);
+  assert(kernel_elements != 0);
+  assert(kernel_elements <= 9);
+  assert(channels != 0);
+
+  const __m256 voutput_min = _mm256_load_ps(params->avx.min);
+  const __m256 voutput_max = _mm256_load_ps(params->avx.max);
+
+  const uint16_t* m = (const uint16_t*) multiplier;
+  uint16_t* output = (uint16_t*) output_ptr;
+  do {
+    const uint16_t* i0 = (const uint16_t*) input[0];
+    assert(i0 != NULL);
+    const uint16_t* i1 = (const uint16_t*) input[1];
+    const uint16_t* i2 = (const uint16_t*) input[2];
+    const uint16_t* i3 = (const uint16_t*) input[3];
+    const uint16_t* i4 = (const uint16_t*) input[4];
+    const uint16_t* i5 = (const uint16_t*) input[5];
+    const uint16_t* i6 = (const uint16_t*) input[6];
+    const uint16_t* i7 = (const uint16_t*) input[7];
+    const uint16_t* i8 = (const uint16_t*) input[8];
+    input = (const void**) ((uintptr_t) input + input_increment);
+    if (kernel_elements < 2) {
+      i1 = (const uint16_t*) zero;
+    }
+    assert(i1 != NULL);
+    if (kernel_elements <= 2) {
+      i2 = (const uint16_t*) zero;
+    }
+    assert(i2 != NULL);
+    if (kernel_elements < 4) {
+      i3 = (const uint16_t*) zero;
+    }
+    assert(i3 != NULL);
+    if (kernel_elements <= 4) {
+      i4 = (const uint16_t*) zero;
+    }
+    assert(i4 != NULL);
+    if (kernel_elements < 6) {
+      i5 = (const uint16_t*) zero;
+    }
+    assert(i5 != NULL);
+    if (kernel_elements <= 6) {
+      i6 = (const uint16_t*) zero;
+    }
+    assert(i6 != NULL);
+    if (kernel_elements < 8) {
+      i7 = (const uint16_t*) zero;
+    }
+    assert(i7 != NULL);
+    if (kernel_elements <= 8) {
+      i8 = (const uint16_t*) zero;
+    }
+    assert(i8 != NULL);
+    if XNN_UNPREDICTABLE(i0 != (const uint16_t*) zero) {
+      i0 = (const uint16_t*) ((uintptr_t) i0 + input_offset);
+    }
+    if XNN_UNPREDICTABLE(i1 != (const uint16_t*) zero) {
+      i1 = (const uint16_t*) ((uintptr_t) i1 + input_offset);
+    }
+    if XNN_UNPREDICTABLE(i2 != (const uint16_t*) zero) {
+      i2 = (const uint16_t*) ((uintptr_t) i2 + input_offset);
+    }
+    if XNN_UNPREDICTABLE(i3 != (const uint16_t*) zero) {
+      i3 = (const uint16_t*) ((uintptr_t) i3 + input_offset);
+    }
+    if XNN_UNPREDICTABLE(i4 != (const uint16_t*) zero) {
+      i4 = (const uint16_t*) ((uintptr_t) i4 + input_offset);
+    }
+    if XNN_UNPREDICTABLE(i5 != (const uint16_t*) zero) {
+      i5 = (const uint16_t*) ((uintptr_t) i5 + input_offset);
+    }
+    if XNN_UNPREDICTABLE(i6 != (const uint16_t*) zero) {
+      i6 = (const uint16_t*) ((uintptr_t) i6 + input_offset);
+    }
+    if XNN_UNPREDICTABLE(i7 != (const uint16_t*) zero) {
+      i7 = (const uint16_t*) ((uintptr_t) i7 + input_offset);
+    }
+    if XNN_UNPREDICTABLE(i8 != (const uint16_t*) zero) {
+      i8 = (const uint16_t*) ((uintptr_t) i8 + input_offset);
+    }
+
+    const __m256 vmultiplier = _mm256_cvtph_ps(_mm_set1_epi16((short) *m));
+    m += 1;
+
+    size_t c = channels;
+    for (; c >= 8; c -= 8) {
+      const __m256 vi0 = _mm256_cvtph_ps(_mm_loadu_si128((const __m128i*) i0));
+      i0 += 8;
+      const __m256 vi1 = _mm256_cvtph_ps(_mm_loadu_si128((const __m128i*) i1));
+      i1 += 8;
+      const __m256 vi2 = _mm256_cvtph_ps(_mm_loadu_si128((const __m128i*) i2));
+      i2 += 8;
+      const __m256 vi3 = _mm256_cvtph_ps(_mm_loadu_si128((const __m128i*) i3));
+      i3 += 8;
+      const __m256 vi4 = _mm256_cvtph_ps(_mm_loadu_si128((const __m128i*) i4));
+      i4 += 8;
+      const __m256 vi5 = _mm256_cvtph_ps(_mm_loadu_si128((const __m128i*) i5));
+      i5 += 8;
+      const __m256 vi6 = _mm256_cvtph_ps(_mm_loadu_si128((const __m128i*) i6));
+      i6 += 8;
+      const __m256 vi7 = _mm256_cvtph_ps(_mm_loadu_si128((const __m128i*) i7));
+      i7 += 8;
+      const __m256 vi8 = _mm256_cvtph_ps(_mm_loadu_si128((const __m128i*) i8));
+      i8 += 8;
+
+      __m128i vacc = _mm256_cvtps_ph(_mm256_add_ps(vi0, vi1), _MM_FROUND_NO_EXC);
+      vacc = _mm256_cvtps_ph(_mm256_add_ps(_mm256_cvtph_ps(vacc), vi2), _MM_FROUND_NO_EXC);
+      vacc = _mm256_cvtps_ph(_mm256_add_ps(_mm256_cvtph_ps(vacc), vi3), _MM_FROUND_NO_EXC);
+      vacc = _mm256_cvtps_ph(_mm256_add_ps(_mm256_cvtph_ps(vacc), vi4), _MM_FROUND_NO_EXC);
+      vacc = _mm256_cvtps_ph(_mm256_add_ps(_mm256_cvtph_ps(vacc), vi5), _MM_FROUND_NO_EXC);
+      vacc = _mm256_cvtps_ph(_mm256_add_ps(_mm256_cvtph_ps(vacc), vi6), _MM_FROUND_NO_EXC);
+      vacc = _mm256_cvtps_ph(_mm256_add_ps(_mm256_cvtph_ps(vacc), vi7), _MM_FROUND_NO_EXC);
+      vacc = _mm256_cvtps_ph(_mm256_add_ps(_mm256_cvtph_ps(vacc), vi8), _MM_FROUND_NO_EXC);
+
+      vacc = _mm256_cvtps_ph(_mm256_mul_ps(_mm256_cvtph_ps(vacc), vmultiplier), _MM_FROUND_NO_EXC);
+
+      __m256 vout = _mm256_max_ps(_mm256_cvtph_ps(vacc), voutput_min);
+      vout = _mm256_min_ps(vout, voutput_max);
+
+      _mm_storeu_si128((__m128i*) output, _mm256_cvtps_ph(vout, _MM_FROUND_NO_EXC));
+      output += 8;
+    }
+    if (c != 0) {
+      const __m256 vi0 = _mm256_cvtph_ps(_mm_loadu_si128((const __m128i*) i0));
+      const __m256 vi1 = _mm256_cvtph_ps(_mm_loadu_si128((const __m128i*) i1));
+      const __m256 vi2 = _mm256_cvtph_ps(_mm_loadu_si128((const __m128i*) i2));
+      const __m256 vi3 = _mm256_cvtph_ps(_mm_loadu_si128((const __m128i*) i3));
+      const __m256 vi4 = _mm256_cvtph_ps(_mm_loadu_si128((const __m128i*) i4));
+      const __m256 vi5 = _mm256_cvtph_ps(_mm_loadu_si128((const __m128i*) i5));
+      const __m256 vi6 = _mm256_cvtph_ps(_mm_loadu_si128((const __m128i*) i6));
+      const __m256 vi7 = _mm256_cvtph_ps(_mm_loadu_si128((const __m128i*) i7));
+      const __m256 vi8 = _mm256_cvtph_ps(_mm_loadu_si128((const __m128i*) i8));
+
+      __m128i vacc = _mm256_cvtps_ph(_mm256_add_ps(vi0, vi1), _MM_FROUND_NO_EXC);
+      vacc = _mm256_cvtps_ph(_mm256_add_ps(_mm256_cvtph_ps(vacc), vi2), _MM_FROUND_NO_EXC);
+      vacc = _mm256_cvtps_ph(_mm256_add_ps(_mm256_cvtph_ps(vacc), vi3), _MM_FROUND_NO_EXC);
+      vacc = _mm256_cvtps_ph(_mm256_add_ps(_mm256_cvtph_ps(vacc), vi4), _MM_FROUND_NO_EXC);
+      vacc = _mm256_cvtps_ph(_mm256_add_ps(_mm256_cvtph_ps(vacc), vi5), _MM_FROUND_NO_EXC);
+      vacc = _mm256_cvtps_ph(_mm256_add_ps(_mm256_cvtph_ps(vacc), vi6), _MM_FROUND_NO_EXC);
+      vacc = _mm256_cvtps_ph(_mm256_add_ps(_mm256_cvtph_ps(vacc), vi7), _MM_FROUND_NO_EXC);
+      vacc = _mm256_cvtps_ph(_mm256_add_ps(_mm256_cvtph_ps(vacc), vi8), _MM_FROUND_NO_EXC);
+
+      vacc = _mm256_cvtps_ph(_mm256_mul_ps(_mm256_cvtph_ps(vacc), vmultiplier), _MM_FROUND_NO_EXC);
+
+      __m256 vout = _mm256_max_ps(_mm256_cvtph_ps(vacc), voutput_min);
+      vout = _mm256_min_ps(vout, voutput_max);
+
+      __m128i vh = _mm256_cvtps_ph(vout, _MM_FROUND_NO_EXC);
+      if (c & 4) {
+        _mm_storel_epi64((__m128i*) output, vh);
+        vh = _mm_unpackhi_epi64(vh, vh);
+        output += 4;
+      }
+      if (c & 2) {
+        *((uint32_t*) output) = (uint32_t) _mm_cvtsi128_si32(vh);
+        vh = _mm_srli_epi64(vh, 32);
+        output += 2;
+      }
+      if (c & 1) {
+        *output = (uint16_t) _mm_extract_epi16(vh, 0);
+        output += 1;
+      }
+    }
+    output = (uint16_t*) ((uintptr_t) output + output_increment);
+  } while (--output_pixels != 0);
+}
+
 void xnn_f16_prelu_ukernel__f16c_2x16(
     size_t rows,
     size_t channels,
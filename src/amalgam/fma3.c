@@ -2420,6 +2420,140 @@ void xnn_f32_dwconv_minmax_ukernel_up8x25__fma3(
   } while (--output_width != 0);
 }
 
+void xnn_f32_gemm_minmax_ukernel_1x16__fma3_broadcast_acc4(
+    size_t mr,
+    size_t nc,
+    size_t kc,
+    const float*restrict a,
+    size_t a_stride,
+    const float*restrict w,
+    float*restrict c,
+    size_t cm_stride,
+    size_t cn_stride,
+    const union xnn_f32_minmax_params params[restrict XNN_MIN_ELEMENTS(1)])
+{
+  assert(mr != 0);
+  assert(mr <= 1);
+  assert(nc != 0);
+  assert(kc != 0);
+  assert(kc % sizeof(float) == 0);
+  assert(a != NULL);
+  assert(w != NULL);
+  assert(c != NULL);
+
+  const float* a0 = a;
+  float* c0 = c;
+
+  do {
+    __m256 vacc0x01234567 = _mm256_load_ps(w + 0);
+    __m256 vacc0x89ABCDEF = _mm256_load_ps(w + 8);
+    __m256 vacc1x01234567 = _mm256_setzero_ps();
+    __m256 vacc1x89ABCDEF = _mm256_setzero_ps();
+    __m256 vacc2x01234567 = _mm256_setzero_ps();
+    __m256 vacc2x89ABCDEF = _mm256_setzero_ps();
+    __m256 vacc3x01234567 = _mm256_setzero_ps();
+    __m256 vacc3x89ABCDEF = _mm256_setzero_ps();
+    w += 16;
+
+    size_t k = kc;
+    for (; k >= 4 * sizeof(float); k -= 4 * sizeof(float)) {
+      _mm_prefetch((const char*) (w + 512), _MM_HINT_T0);
+      _mm_prefetch((const char*) (w + 528), _MM_HINT_T0);
+      _mm_prefetch((const char*) (w + 544), _MM_HINT_T0);
+      _mm_prefetch((const char*) (w + 560), _MM_HINT_T0);
+
+      const __m256 va0c0 = _mm256_broadcast_ss(a0 + 0);
+      const __m256 va0c1 = _mm256_broadcast_ss(a0 + 1);
+      const __m256 va0c2 = _mm256_broadcast_ss(a0 + 2);
+      const __m256 va0c3 = _mm256_broadcast_ss(a0 + 3);
+      a0 += 4;
+
+      const __m256 vb01234567c0 = _mm256_load_ps(w + 0);
+      const __m256 vb89ABCDEFc0 = _mm256_load_ps(w + 8);
+      const __m256 vb01234567c1 = _mm256_load_ps(w + 16);
+      const __m256 vb89ABCDEFc1 = _mm256_load_ps(w + 24);
+      const __m256 vb01234567c2 = _mm256_load_ps(w + 32);
+      const __m256 vb89ABCDEFc2 = _mm256_load_ps(w + 40);
+      const __m256 vb01234567c3 = _mm256_load_ps(w + 48);
+      const __m256 vb89ABCDEFc3 = _mm256_load_ps(w + 56);
+      w += 64;
+
+      vacc0x01234567 = _mm256_fmadd_ps(va0c0, vb01234567c0, vacc0x01234567);
+      vacc0x89ABCDEF = _mm256_fmadd_ps(va0c0, vb89ABCDEFc0, vacc0x89ABCDEF);
+      vacc1x01234567 = _mm256_fmadd_ps(va0c1, vb01234567c1, vacc1x01234567);
+      vacc1x89ABCDEF = _mm256_fmadd_ps(va0c1, vb89ABCDEFc1, vacc1x89ABCDEF);
+      vacc2x01234567 = _mm256_fmadd_ps(va0c2, vb01234567c2, vacc2x01234567);
+      vacc2x89ABCDEF = _mm256_fmadd_ps(va0c2, vb89ABCDEFc2, vacc2x89ABCDEF);
+      vacc3x01234567 = _mm256_fmadd_ps(va0c3, vb01234567c3, vacc3x01234567);
+      vacc3x89ABCDEF = _mm256_fmadd_ps(va0c3, vb89ABCDEFc3, vacc3x89ABCDEF);
+    }
+    for (; k != 0; k -= sizeof(float)) {
+      const __m256 va0 = _mm256_broadcast_ss(a0);
+      a0 += 1;
+
+      const __m256 vb01234567 = _mm256_load_ps(w + 0);
+      const __m256 vb89ABCDEF = _mm256_load_ps(w + 8);
+      w += 16;
+
+      vacc0x01234567 = _mm256_fmadd_ps(va0, vb01234567, vacc0x01234567);
+      vacc0x89ABCDEF = _mm256_fmadd_ps(va0, vb89ABCDEF, vacc0x89ABCDEF);
+    }
+    // Add up all accumulators to vacc0
+    vacc0x01234567 = _mm256_add_ps(vacc0x01234567, vacc1x01234567);
+    vacc0x89ABCDEF = _mm256_add_ps(vacc0x89ABCDEF, vacc1x89ABCDEF);
+    vacc2x01234567 = _mm256_add_ps(vacc2x01234567, vacc3x01234567);
+    vacc2x89ABCDEF = _mm256_add_ps(vacc2x89ABCDEF, vacc3x89ABCDEF);
+    vacc0x01234567 = _mm256_add_ps(vacc0x01234567, vacc2x01234567);
+    vacc0x89ABCDEF = _mm256_add_ps(vacc0x89ABCDEF, vacc2x89ABCDEF);
+
+    const __m256 vmin = _mm256_load_ps(params->avx.min);
+    vacc0x01234567 = _mm256_max_ps(vacc0x01234567, vmin);
+    vacc0x89ABCDEF = _mm256_max_ps(vacc0x89ABCDEF, vmin);
+
+    const __m256 vmax = _mm256_load_ps(params->avx.max);
+    vacc0x01234567 = _mm256_min_ps(vacc0x01234567, vmax);
+    vacc0x89ABCDEF = _mm256_min_ps(vacc0x89ABCDEF, vmax);
+
+    if XNN_LIKELY(nc >= 16) {
+      _mm256_storeu_ps(c0, vacc0x01234567);
+      _mm256_storeu_ps(c0 + 8, vacc0x89ABCDEF);
+      c0 = (float*) ((uintptr_t) c0 + cn_stride);
+
+      a0 = (const float*) ((uintptr_t) a0 - kc);
+
+      nc -= 16;
+    } else {
+      if (nc & 8) {
+        _mm256_storeu_ps(c0, vacc0x01234567);
+
+        vacc0x01234567 = vacc0x89ABCDEF;
+
+        c0 += 8;
+      }
+      __m128 vacc0x0123 = _mm256_castps256_ps128(vacc0x01234567);
+      if (nc & 4) {
+        _mm_storeu_ps(c0, vacc0x0123);
+
+        vacc0x0123 = _mm256_extractf128_ps(vacc0x01234567, 1);
+
+        c0 += 4;
+      }
+      if (nc & 2) {
+        _mm_storel_pi((__m64*) c0, vacc0x0123);
+
+        vacc0x0123 = _mm_movehl_ps(vacc0x0123, vacc0x0123);
+
+        c0 += 2;
+      }
+      if (nc & 1) {
+        _mm_store_ss(c0, vacc0x0123);
+      }
+
+      nc = 0;
+    }
+  } while (nc != 0);
+}
+
 void xnn_f32_gemm_minmax_ukernel_1x16__fma3_broadcast(
     size_t mr,
     size_t nc,
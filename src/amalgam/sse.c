@@ -21,6 +21,8 @@
 #include <xnnpack/packx.h>
 #include <xnnpack/pavgpool.h>
 #include <xnnpack/rmax.h>
+#include <xnnpack/rmin.h>
+#include <xnnpack/rsum.h>
 #include <xnnpack/spmm.h>
 #include <xnnpack/vbinary.h>
 #include <xnnpack/vmulcaddc.h>
@@ -1160,6 +1162,150 @@ void xnn_f32_conv_hwc2chw_ukernel_3x3s2p1c3x4__sse_2x2(
   }
 }
 
+void xnn_f32_dconv_minmax_ukernel_2x8__sse(
+    size_t output_width,
+    size_t output_channels,
+    size_t kernel_height,
+    size_t kernel_width,
+    size_t input_channels,
+    size_t input_width,
+    size_t input_pixel_stride,
+    size_t subsampling,
+    size_t padding_left,
+    const float** input,
+    size_t input_offset,
+    const float* zero,
+    const float* weights,
+    float* output,
+    size_t output_pixel_stride,
+    const union xnn_f32_minmax_params params[restrict XNN_MIN_ELEMENTS(1)])
+{
+  assert(output_width != 0);
+  assert(output_channels != 0);
+  assert(kernel_height != 0);
+  assert(kernel_width != 0);
+  assert(input_channels != 0);
+  assert(input_channels % sizeof(float) == 0);
+  assert(subsampling != 0);
+  assert(input != NULL);
+  assert(weights != NULL);
+  assert(output != NULL);
+
+  const __m128 vmin = _mm_load_ps(params->sse.min);
+  const __m128 vmax = _mm_load_ps(params->sse.max);
+  // Weights of every block of output channels: 8 biases followed by 8 weights for every kernel element and channel.
+  const size_t w_stride = 8 * (1 + kernel_height * kernel_width * (input_channels / sizeof(float)));
+  do {
+    float* o0 = output;
+    // Input column of the first kernel element for the first output pixel in a tile; wraps around below zero.
+    size_t ix0 = -padding_left;
+    size_t n = output_width;
+    do {
+      // The last tile of an odd number of pixels computes (and stores) its only pixel twice.
+      const size_t ix1 = n >= 2 ? ix0 + subsampling : ix0;
+      float* o1 = n >= 2 ? (float*) ((uintptr_t) o0 + output_pixel_stride) : o0;
+
+      const float* w = weights;
+      __m128 vacc0x0123 = _mm_loadu_ps(w);
+      __m128 vacc0x4567 = _mm_loadu_ps(w + 4);
+      __m128 vacc1x0123 = vacc0x0123;
+      __m128 vacc1x4567 = vacc0x4567;
+      w += 8;
+
+      const float** i = input;
+      size_t ky = kernel_height;
+      do {
+        const float* row = *i++;
+        assert(row != NULL);
+        const bool is_padding_row = row == zero;
+        row = (const float*) ((uintptr_t) row + input_offset);
+
+        size_t kx = 0;
+        do {
+          const float* i0 = zero;
+          if XNN_LIKELY(!is_padding_row && ix0 + kx < input_width) {
+            i0 = (const float*) ((uintptr_t) row + (ix0 + kx) * input_pixel_stride);
+          }
+          const float* i1 = zero;
+          if XNN_LIKELY(!is_padding_row && ix1 + kx < input_width) {
+            i1 = (const float*) ((uintptr_t) row + (ix1 + kx) * input_pixel_stride);
+          }
+
+          size_t k = input_channels;
+          do {
+            const __m128 vi0 = _mm_load1_ps(i0);
+            i0 += 1;
+            const __m128 vi1 = _mm_load1_ps(i1);
+            i1 += 1;
+
+            const __m128 vw0123 = _mm_loadu_ps(w);
+            const __m128 vw4567 = _mm_loadu_ps(w + 4);
+            w += 8;
+
+            vacc0x0123 = _mm_add_ps(vacc0x0123, _mm_mul_ps(vi0, vw0123));
+            vacc0x4567 = _mm_add_ps(vacc0x4567, _mm_mul_ps(vi0, vw4567));
+            vacc1x0123 = _mm_add_ps(vacc1x0123, _mm_mul_ps(vi1, vw0123));
+            vacc1x4567 = _mm_add_ps(vacc1x4567, _mm_mul_ps(vi1, vw4567));
+
+            k -= sizeof(float);
+          } while (k != 0);
+        } while (++kx != kernel_width);
+      } while (--ky != 0);
+
+      vacc0x0123 = _mm_min_ps(vacc0x0123, vmax);
+      vacc0x4567 = _mm_min_ps(vacc0x4567, vmax);
+      vacc1x0123 = _mm_min_ps(vacc1x0123, vmax);
+      vacc1x4567 = _mm_min_ps(vacc1x4567, vmax);
+
+      vacc0x0123 = _mm_max_ps(vacc0x0123, vmin);
+      vacc0x4567 = _mm_max_ps(vacc0x4567, vmin);
+      vacc1x0123 = _mm_max_ps(vacc1x0123, vmin);
+      vacc1x4567 = _mm_max_ps(vacc1x4567, vmin);
+
+      if XNN_LIKELY(output_channels >= 8) {
+        _mm_storeu_ps(o1, vacc1x0123);
+        _mm_storeu_ps(o1 + 4, vacc1x4567);
+        _mm_storeu_ps(o0, vacc0x0123);
+        _mm_storeu_ps(o0 + 4, vacc0x4567);
+      } else {
+        float* c1 = o1;
+        float* c0 = o0;
+        if (output_channels & 4) {
+          _mm_storeu_ps(c1, vacc1x0123);
+          _mm_storeu_ps(c0, vacc0x0123);
+
+          vacc1x0123 = vacc1x4567;
+          vacc0x0123 = vacc0x4567;
+
+          c1 += 4;
+          c0 += 4;
+        }
+        if (output_channels & 2) {
+          _mm_storel_pi((__m64*) c1, vacc1x0123);
+          _mm_storel_pi((__m64*) c0, vacc0x0123);
+
+          vacc1x0123 = _mm_movehl_ps(vacc1x0123, vacc1x0123);
+          vacc0x0123 = _mm_movehl_ps(vacc0x0123, vacc0x0123);
+
+          c1 += 2;
+          c0 += 2;
+        }
+        if (output_channels & 1) {
+          _mm_store_ss(c1, vacc1x0123);
+          _mm_store_ss(c0, vacc0x0123);
+        }
+      }
+      o0 = (float*) ((uintptr_t) o1 + output_pixel_stride);
+      ix0 = ix1 + subsampling;
+      n = doz(n, 2);
+    } while (n != 0);
+
+    weights += w_stride;
+    output += 8;
+    output_channels = doz(output_channels, 8);
+  } while (output_channels != 0);
+}
+
 void xnn_f32_dwconv_minmax_ukernel_up8x25__sse(
     size_t channels,
     size_t output_width,
@@ -2436,6 +2582,122 @@ void xnn_f32_dwconv_minmax_ukernel_up8x9__sse(
   } while (--output_width != 0);
 }
 
+void xnn_f32_dwconv2d_chw_ukernel_dilated__sse_1x4(
+    size_t input_height,
+    size_t input_width,
+    size_t output_height,
+    size_t output_width,
+    size_t kernel_height,
+    size_t kernel_width,
+    size_t subsampling_height,
+    size_t subsampling_width,
+    size_t dilation_height,
+    size_t dilation_width,
+    uint32_t padding_top,
+    uint32_t padding_left,
+    const float* input,
+    const float* weights,
+    float* output,
+    const union xnn_f32_minmax_params params[restrict XNN_MIN_ELEMENTS(1)]) XNN_OOB_READS
+{
+  assert(input_width != 0);
+  assert(input_width % sizeof(float) == 0);
+  assert(output_height != 0);
+  assert(output_width != 0);
+  assert(kernel_height != 0);
+  assert(kernel_width != 0);
+  assert(subsampling_height != 0);
+  assert(subsampling_width != 0);
+  assert(dilation_height != 0);
+  assert(dilation_width != 0);
+
+  const __m128 vmin = _mm_load_ps(params->sse.min);
+  const __m128 vmax = _mm_load_ps(params->sse.max);
+
+  const __m128 vbias = _mm_load1_ps(weights);
+  const float* k = weights + 1;
+  const size_t input_pixels = input_width / sizeof(float);
+
+  // Output columns in [ox_lo, ox_hi) read only valid input columns for every kernel column, and are computed 4 at a
+  // time without any bounds checks. Columns outside this range clip the range of kernel columns per output pixel.
+  // Input coordinates below are relative to the top-left corner of the padded input.
+  const size_t kernel_extent_width = (kernel_width - 1) * dilation_width;
+  const size_t ox_lo = min(output_width, divide_round_up(padding_left, subsampling_width));
+  size_t ox_hi = ox_lo;
+  if (padding_left + input_pixels > kernel_extent_width) {
+    ox_hi = max(ox_lo, min(output_width, (padding_left + input_pixels - 1 - kernel_extent_width) / subsampling_width + 1));
+  }
+
+  for (size_t oy = 0; oy < output_height; oy++) {
+    const size_t iy0 = oy * subsampling_height;
+    const size_t ky_start = divide_round_up(doz(padding_top, iy0), dilation_height);
+    const size_t ky_end = min(kernel_height, divide_round_up(doz(padding_top + input_height, iy0), dilation_height));
+    const float* i0 = (const float*) ((uintptr_t) input + (iy0 + ky_start * dilation_height - padding_top) * input_width);
+    const size_t input_row_increment = dilation_height * input_width;
+
+    size_t ox = 0;
+    for (; ox < output_width; ox++) {
+      if (ox == ox_lo) {
+        // Interior: 4 output pixels at a time.
+        for (; ox + 4 <= ox_hi; ox += 4) {
+          __m128 vacc = vbias;
+          const float* i = i0 + (ox * subsampling_width - padding_left);
+          for (size_t ky = ky_start; ky < ky_end; ky++) {
+            const float* kr = k + ky * kernel_width;
+            const float* ik = i;
+            for (size_t kx = 0; kx < kernel_width; kx++) {
+              const __m128 vk = _mm_load1_ps(kr + kx);
+              __m128 vi;
+              if (subsampling_width == 1) {
+                vi = _mm_loadu_ps(ik);
+              } else if (subsampling_width == 2) {
+                const __m128 vi0123 = _mm_loadu_ps(ik);
+                const __m128 vi4567 = _mm_loadu_ps(ik + 4);
+                vi = _mm_shuffle_ps(vi0123, vi4567, _MM_SHUFFLE(2, 0, 2, 0));
+              } else {
+                vi = _mm_setr_ps(ik[0], ik[subsampling_width], ik[2 * subsampling_width], ik[3 * subsampling_width]);
+              }
+              vacc = _mm_add_ps(vacc, _mm_mul_ps(vi, vk));
+              ik += dilation_width;
+            }
+            i = (const float*) ((uintptr_t) i + input_row_increment);
+          }
+
+          vacc = _mm_max_ps(vacc, vmin);
+          vacc = _mm_min_ps(vacc, vmax);
+          _mm_storeu_ps(output, vacc);
+          output += 4;
+        }
+        if XNN_UNLIKELY(ox == output_width) {
+          break;
+        }
+      }
+
+      // Border or remainder pixel: clip the range of kernel columns.
+      const size_t ix0 = ox * subsampling_width;
+      const size_t kx_start = divide_round_up(doz(padding_left, ix0), dilation_width);
+      const size_t kx_end = min(kernel_width, divide_round_up(doz(padding_left + input_pixels, ix0), dilation_width));
+
+      __m128 vacc = vbias;
+      const float* i = i0;
+      for (size_t ky = ky_start; ky < ky_end; ky++) {
+        const float* kr = k + ky * kernel_width;
+        for (size_t kx = kx_start; kx < kx_end; kx++) {
+          const __m128 vi = _mm_load_ss(i + (ix0 + kx * dilation_width - padding_left));
+          const __m128 vk = _mm_load_ss(kr + kx);
+          vacc = _mm_add_ss(vacc, _mm_mul_ss(vi, vk));
+        }
+        i = (const float*) ((uintptr_t) i + input_row_increment);
+      }
+
+      vacc = _mm_max_ss(vacc, vmin);
+      vacc = _mm_min_ss(vacc, vmax);
+      _mm_store_ss(output, vacc);
+      output += 1;
+    }
+  }
+}
+
 void xnn_f32_dwconv2d_chw_ukernel_3x3p1__sse_2x4_acc2(
     size_t input_height,
     size_t input_width,
@@ -4576,6 +4838,132 @@ void xnn_f32_gavgpool_minmax_ukernel_7x__sse_c4(
   }
 }
 
+void xnn_f32_gemm_minmax_ukernel_1x8__sse_dup_acc4(
+    size_t mr,
+    size_t nc,
+    size_t kc,
+    const float*restrict a,
+    size_t a_stride,
+    const float*restrict w,
+    float*restrict c,
+    size_t cm_stride,
+    size_t cn_stride,
+    const union xnn_f32_minmax_params params[restrict XNN_MIN_ELEMENTS(1)])
+{
+  assert(mr != 0);
+  assert(mr <= 1);
+  assert(nc != 0);
+  assert(kc != 0);
+  assert(kc % sizeof(float) == 0);
+  assert(a != NULL);
+  assert(w != NULL);
+  assert(c != NULL);
+
+  const float* a0 = a;
+  float* c0 = c;
+
+  do {
+    __m128 vacc0x0123 = _mm_load_ps(w + 0);
+    __m128 vacc0x4567 = _mm_load_ps(w + 4);
+    __m128 vacc1x0123 = _mm_setzero_ps();
+    __m128 vacc1x4567 = _mm_setzero_ps();
+    __m128 vacc2x0123 = _mm_setzero_ps();
+    __m128 vacc2x4567 = _mm_setzero_ps();
+    __m128 vacc3x0123 = _mm_setzero_ps();
+    __m128 vacc3x4567 = _mm_setzero_ps();
+    w += 8;
+
+    size_t k = kc;
+    for (; k >= 4 * sizeof(float); k -= 4 * sizeof(float)) {
+      _mm_prefetch((const char*) (w + 256), _MM_HINT_T0);
+      _mm_prefetch((const char*) (w + 272), _MM_HINT_T0);
+
+      const __m128 va0 = _mm_loadu_ps(a0);
+      a0 += 4;
+
+      const __m128 va0c0000 = _mm_shuffle_ps(va0, va0, _MM_SHUFFLE(0, 0, 0, 0));
+      const __m128 va0c1111 = _mm_shuffle_ps(va0, va0, _MM_SHUFFLE(1, 1, 1, 1));
+      const __m128 va0c2222 = _mm_shuffle_ps(va0, va0, _MM_SHUFFLE(2, 2, 2, 2));
+      const __m128 va0c3333 = _mm_shuffle_ps(va0, va0, _MM_SHUFFLE(3, 3, 3, 3));
+
+      const __m128 vb0123c0 = _mm_load_ps(w + 0);
+      const __m128 vb4567c0 = _mm_load_ps(w + 4);
+      const __m128 vb0123c1 = _mm_load_ps(w + 8);
+      const __m128 vb4567c1 = _mm_load_ps(w + 12);
+      const __m128 vb0123c2 = _mm_load_ps(w + 16);
+      const __m128 vb4567c2 = _mm_load_ps(w + 20);
+      const __m128 vb0123c3 = _mm_load_ps(w + 24);
+      const __m128 vb4567c3 = _mm_load_ps(w + 28);
+      w += 32;
+
+      vacc0x0123 = _mm_add_ps(vacc0x0123, _mm_mul_ps(va0c0000, vb0123c0));
+      vacc0x4567 = _mm_add_ps(vacc0x4567, _mm_mul_ps(va0c0000, vb4567c0));
+      vacc1x0123 = _mm_add_ps(vacc1x0123, _mm_mul_ps(va0c1111, vb0123c1));
+      vacc1x4567 = _mm_add_ps(vacc1x4567, _mm_mul_ps(va0c1111, vb4567c1));
+      vacc2x0123 = _mm_add_ps(vacc2x0123, _mm_mul_ps(va0c2222, vb0123c2));
+      vacc2x4567 = _mm_add_ps(vacc2x4567, _mm_mul_ps(va0c2222, vb4567c2));
+      vacc3x0123 = _mm_add_ps(vacc3x0123, _mm_mul_ps(va0c3333, vb0123c3));
+      vacc3x4567 = _mm_add_ps(vacc3x4567, _mm_mul_ps(va0c3333, vb4567c3));
+    }
+    for (; k != 0; k -= sizeof(float)) {
+      const __m128 va0 = _mm_load1_ps(a0);
+      a0 += 1;
+
+      const __m128 vb0123 = _mm_load_ps(w + 0);
+      const __m128 vb4567 = _mm_load_ps(w + 4);
+      w += 8;
+
+      vacc0x0123 = _mm_add_ps(vacc0x0123, _mm_mul_ps(va0, vb0123));
+      vacc0x4567 = _mm_add_ps(vacc0x4567, _mm_mul_ps(va0, vb4567));
+    }
+    // Add up all accumulators to vacc0
+    vacc0x0123 = _mm_add_ps(vacc0x0123, vacc1x0123);
+    vacc0x4567 = _mm_add_ps(vacc0x4567, vacc1x4567);
+    vacc2x0123 = _mm_add_ps(vacc2x0123, vacc3x0123);
+    vacc2x4567 = _mm_add_ps(vacc2x4567, vacc3x4567);
+    vacc0x0123 = _mm_add_ps(vacc0x0123, vacc2x0123);
+    vacc0x4567 = _mm_add_ps(vacc0x4567, vacc2x4567);
+
+    const __m128 vmax = _mm_load_ps(params->sse.max);
+    vacc0x0123 = _mm_min_ps(vacc0x0123, vmax);
+    vacc0x4567 = _mm_min_ps(vacc0x4567, vmax);
+
+    const __m128 vmin = _mm_load_ps(params->sse.min);
+    vacc0x0123 = _mm_max_ps(vacc0x0123, vmin);
+    vacc0x4567 = _mm_max_ps(vacc0x4567, vmin);
+
+    if XNN_LIKELY(nc >= 8) {
+      _mm_storeu_ps(c0, vacc0x0123);
+      _mm_storeu_ps(c0 + 4, vacc0x4567);
+      c0 = (float*) ((uintptr_t) c0 + cn_stride);
+
+      a0 = (const float*) ((uintptr_t) a0 - kc);
+
+      nc -= 8;
+    } else {
+      if (nc & 4) {
+        _mm_storeu_ps(c0, vacc0x0123);
+
+        vacc0x0123 = vacc0x4567;
+
+        c0 += 4;
+      }
+      if (nc & 2) {
+        _mm_storel_pi((__m64*) c0, vacc0x0123);
+
+        vacc0x0123 = _mm_movehl_ps(vacc0x0123, vacc0x0123);
+
+        c0 += 2;
+      }
+      if (nc & 1) {
+        _mm_store_ss(c0, vacc0x0123);
+      }
+
+      nc = 0;
+    }
+  } while (nc != 0);
+}
+
 void xnn_f32_gemm_minmax_ukernel_1x8__sse_load1(
     size_t mr,
     size_t nc,
@@ -6540,6 +6928,91 @@ void xnn_f32_rmax_ukernel__sse(
   _mm_store_ss(y, vmax_lo);
 }
 
+void xnn_f32_rmin_ukernel__sse(
+    size_t n,
+    const float* x,
+    float* y)
+{
+  assert(n != 0);
+  assert(n % sizeof(float) == 0);
+
+  __m128 vmin0 = _mm_load_ss(x);
+  vmin0 = _mm_shuffle_ps(vmin0, vmin0, _MM_SHUFFLE(0, 0, 0, 0));
+  __m128 vmin1 = vmin0;
+  __m128 vmin2 = vmin0;
+  __m128 vmin3 = vmin0;
+  for (; n >= 64; n -= 64) {
+    const __m128 vx0 = _mm_loadu_ps(x);
+    const __m128 vx1 = _mm_loadu_ps(x + 4);
+    const __m128 vx2 = _mm_loadu_ps(x + 8);
+    const __m128 vx3 = _mm_loadu_ps(x + 12);
+    x += 16;
+
+    vmin0 = _mm_min_ps(vmin0, vx0);
+    vmin1 = _mm_min_ps(vmin1, vx1);
+    vmin2 = _mm_min_ps(vmin2, vx2);
+    vmin3 = _mm_min_ps(vmin3, vx3);
+  }
+  __m128 vmin = _mm_min_ps(_mm_min_ps(vmin0, vmin1), _mm_min_ps(vmin2, vmin3));
+  for (; n >= 16; n -= 16) {
+    const __m128 vx = _mm_loadu_ps(x);
+    vmin = _mm_min_ps(vmin, vx);
+    x += 4;
+  }
+  __m128 vmin_lo = _mm_min_ps(vmin, _mm_movehl_ps(vmin, vmin));
+  vmin_lo = _mm_min_ss(vmin_lo, _mm_shuffle_ps(vmin_lo, vmin_lo, _MM_SHUFFLE(3, 3, 1, 1)));
+  if XNN_UNLIKELY(n != 0) {
+    do {
+      vmin_lo = _mm_min_ss(vmin_lo, _mm_load_ss(x));
+      x += 1;
+      n -= 4;
+    } while (n != 0);
+  }
+  _mm_store_ss(y, vmin_lo);
+}
+
+void xnn_f32_rsum_ukernel__sse(
+    size_t n,
+    const float* x,
+    float* y)
+{
+  assert(n != 0);
+  assert(n % sizeof(float) == 0);
+
+  __m128 vacc0 = _mm_setzero_ps();
+  __m128 vacc1 = _mm_setzero_ps();
+  __m128 vacc2 = _mm_setzero_ps();
+  __m128 vacc3 = _mm_setzero_ps();
+  for (; n >= 64; n -= 64) {
+    const __m128 vx0 = _mm_loadu_ps(x);
+    const __m128 vx1 = _mm_loadu_ps(x + 4);
+    const __m128 vx2 = _mm_loadu_ps(x + 8);
+    const __m128 vx3 = _mm_loadu_ps(x + 12);
+    x += 16;
+
+    vacc0 = _mm_add_ps(vacc0, vx0);
+    vacc1 = _mm_add_ps(vacc1, vx1);
+    vacc2 = _mm_add_ps(vacc2, vx2);
+    vacc3 = _mm_add_ps(vacc3, vx3);
+  }
+  __m128 vacc = _mm_add_ps(_mm_add_ps(vacc0, vacc1), _mm_add_ps(vacc2, vacc3));
+  for (; n >= 16; n -= 16) {
+    const __m128 vx = _mm_loadu_ps(x);
+    vacc = _mm_add_ps(vacc, vx);
+    x += 4;
+  }
+  __m128 vacc_lo = _mm_add_ps(vacc, _mm_movehl_ps(vacc, vacc));
+  vacc_lo = _mm_add_ss(vacc_lo, _mm_shuffle_ps(vacc_lo, vacc_lo, _MM_SHUFFLE(3, 3, 1, 1)));
+  if XNN_UNLIKELY(n != 0) {
+    do {
+      vacc_lo = _mm_add_ss(vacc_lo, _mm_load_ss(x));
+      x += 1;
+      n -= 4;
+    } while (n != 0);
+  }
+  _mm_store_ss(y, vacc_lo);
+}
+
 void xnn_f32_spmm_minmax_ukernel_32x1__sse(
     size_t mc,
     size_t nc,
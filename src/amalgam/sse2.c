@@ -4392,6 +4392,654 @@ void xnn_qc8_igemm_minmax_fp32_ukernel_3x4c8__sse2_ld64(
   } while (nc != 0);
 }
 
+void xnn_qs8_avgpool_minmax_fp32_ukernel_9p8x__sse2_c8(
+    size_t output_pixels,
+    size_t kernel_elements,
+    size_t channels,
+    const int8_t** input,
+    size_t input_offset,
+    const int8_t* zero,
+    int32_t* buffer,
+    int8_t* output,
+    size_t input_increment,
+    size_t output_increment,
+    const union xnn_qs8_avgpool_minmax_params params[restrict XNN_MIN_ELEMENTS(1)]) XNN_OOB_READS
+{
+  assert(output_pixels != 0);
+  assert(kernel_elements > 9);
+  assert(channels != 0);
+
+  const __m128i vinit_bias = _mm_load_si128((const __m128i*) params->fp32_sse2.init_bias);
+  const __m128 vscale = _mm_load_ps(params->fp32_sse2.scale);
+  const __m128 voutput_max_less_zero_point = _mm_load_ps(params->fp32_sse2.output_max_less_zero_point);
+  const __m128i voutput_zero_point = _mm_load_si128((const __m128i*) params->fp32_sse2.output_zero_point);
+  const __m128i voutput_min = _mm_load_si128((const __m128i*) params->fp32_sse2.output_min);
+  do {
+    // First pass.
+    {
+      const int8_t* i0 = *input++;
+      assert(i0 != NULL);
+      if XNN_UNPREDICTABLE(i0 != zero) {
+        i0 = (const int8_t*) ((uintptr_t) i0 + input_offset);
+      }
+      const int8_t* i1 = *input++;
+      assert(i1 != NULL);
+      if XNN_UNPREDICTABLE(i1 != zero) {
+        i1 = (const int8_t*) ((uintptr_t) i1 + input_offset);
+      }
+      const int8_t* i2 = *input++;
+      assert(i2 != NULL);
+      if XNN_UNPREDICTABLE(i2 != zero) {
+        i2 = (const int8_t*) ((uintptr_t) i2 + input_offset);
+      }
+      const int8_t* i3 = *input++;
+      assert(i3 != NULL);
+      if XNN_UNPREDICTABLE(i3 != zero) {
+        i3 = (const int8_t*) ((uintptr_t) i3 + input_offset);
+      }
+      const int8_t* i4 = *input++;
+      assert(i4 != NULL);
+      if XNN_UNPREDICTABLE(i4 != zero) {
+        i4 = (const int8_t*) ((uintptr_t) i4 + input_offset);
+      }
+      const int8_t* i5 = *input++;
+      assert(i5 != NULL);
+      if XNN_UNPREDICTABLE(i5 != zero) {
+        i5 = (const int8_t*) ((uintptr_t) i5 + input_offset);
+      }
+      const int8_t* i6 = *input++;
+      assert(i6 != NULL);
+      if XNN_UNPREDICTABLE(i6 != zero) {
+        i6 = (const int8_t*) ((uintptr_t) i6 + input_offset);
+      }
+      const int8_t* i7 = *input++;
+      assert(i7 != NULL);
+      if XNN_UNPREDICTABLE(i7 != zero) {
+        i7 = (const int8_t*) ((uintptr_t) i7 + input_offset);
+      }
+      const int8_t* i8 = *input++;
+      assert(i8 != NULL);
+      if XNN_UNPREDICTABLE(i8 != zero) {
+        i8 = (const int8_t*) ((uintptr_t) i8 + input_offset);
+      }
+
+      int32_t* b = buffer;
+      for (size_t c = 0; c < channels; c += 8) {
+        const __m128i vi0 = _mm_loadl_epi64((const __m128i*) i0);
+        i0 += 8;
+        const __m128i vi1 = _mm_loadl_epi64((const __m128i*) i1);
+        i1 += 8;
+        const __m128i vi2 = _mm_loadl_epi64((const __m128i*) i2);
+        i2 += 8;
+        const __m128i vi3 = _mm_loadl_epi64((const __m128i*) i3);
+        i3 += 8;
+        const __m128i vi4 = _mm_loadl_epi64((const __m128i*) i4);
+        i4 += 8;
+        const __m128i vi5 = _mm_loadl_epi64((const __m128i*) i5);
+        i5 += 8;
+        const __m128i vi6 = _mm_loadl_epi64((const __m128i*) i6);
+        i6 += 8;
+        const __m128i vi7 = _mm_loadl_epi64((const __m128i*) i7);
+        i7 += 8;
+        const __m128i vi8 = _mm_loadl_epi64((const __m128i*) i8);
+        i8 += 8;
+
+        const __m128i vxi0 = _mm_srai_epi16(_mm_unpacklo_epi8(vi0, vi0), 8);
+        const __m128i vxi1 = _mm_srai_epi16(_mm_unpacklo_epi8(vi1, vi1), 8);
+        const __m128i vxi2 = _mm_srai_epi16(_mm_unpacklo_epi8(vi2, vi2), 8);
+        const __m128i vxi3 = _mm_srai_epi16(_mm_unpacklo_epi8(vi3, vi3), 8);
+        const __m128i vxi4 = _mm_srai_epi16(_mm_unpacklo_epi8(vi4, vi4), 8);
+        const __m128i vxi5 = _mm_srai_epi16(_mm_unpacklo_epi8(vi5, vi5), 8);
+        const __m128i vxi6 = _mm_srai_epi16(_mm_unpacklo_epi8(vi6, vi6), 8);
+        const __m128i vxi7 = _mm_srai_epi16(_mm_unpacklo_epi8(vi7, vi7), 8);
+        const __m128i vxi8 = _mm_srai_epi16(_mm_unpacklo_epi8(vi8, vi8), 8);
+
+        __m128i vsum = _mm_add_epi16(vxi0, vxi1);
+        vsum = _mm_add_epi16(vsum, vxi2);
+        vsum = _mm_add_epi16(vsum, vxi3);
+        vsum = _mm_add_epi16(vsum, vxi4);
+        vsum = _mm_add_epi16(vsum, vxi5);
+        vsum = _mm_add_epi16(vsum, vxi6);
+        vsum = _mm_add_epi16(vsum, vxi7);
+        vsum = _mm_add_epi16(vsum, vxi8);
+
+        const __m128i vsgnsum = _mm_cmpgt_epi16(_mm_setzero_si128(), vsum);
+        __m128i vacc0123 = _mm_unpacklo_epi16(vsum, vsgnsum);
+        __m128i vacc4567 = _mm_unpackhi_epi16(vsum, vsgnsum);
+        vacc0123 = _mm_add_epi32(vacc0123, vinit_bias);
+        vacc4567 = _mm_add_epi32(vacc4567, vinit_bias);
+
+        _mm_store_si128((__m128i*) b, vacc0123);
+        _mm_store_si128((__m128i*) (b + 4), vacc4567);
+        b += 8;
+      }
+    }
+
+    size_t k = kernel_elements;
+    // Intermediate passes.
+    for (k -= 9; k > 8; k -= 8) {
+      const int8_t* i0 = *input++;
+      assert(i0 != NULL);
+      if XNN_UNPREDICTABLE(i0 != zero) {
+        i0 = (const int8_t*) ((uintptr_t) i0 + input_offset);
+      }
+      const int8_t* i1 = *input++;
+      assert(i1 != NULL);
+      if XNN_UNPREDICTABLE(i1 != zero) {
+        i1 = (const int8_t*) ((uintptr_t) i1 + input_offset);
+      }
+      const int8_t* i2 = *input++;
+      assert(i2 != NULL);
+      if XNN_UNPREDICTABLE(i2 != zero) {
+        i2 = (const int8_t*) ((uintptr_t) i2 + input_offset);
+      }
+      const int8_t* i3 = *input++;
+      assert(i3 != NULL);
+      if XNN_UNPREDICTABLE(i3 != zero) {
+        i3 = (const int8_t*) ((uintptr_t) i3 + input_offset);
+      }
+      const int8_t* i4 = *input++;
+      assert(i4 != NULL);
+      if XNN_UNPREDICTABLE(i4 != zero) {
+        i4 = (const int8_t*) ((uintptr_t) i4 + input_offset);
+      }
+      const int8_t* i5 = *input++;
+      assert(i5 != NULL);
+      if XNN_UNPREDICTABLE(i5 != zero) {
+        i5 = (const int8_t*) ((uintptr_t) i5 + input_offset);
+      }
+      const int8_t* i6 = *input++;
+      assert(i6 != NULL);
+      if XNN_UNPREDICTABLE(i6 != zero) {
+        i6 = (const int8_t*) ((uintptr_t) i6 + input_offset);
+      }
+      const int8_t* i7 = *input++;
+      assert(i7 != NULL);
+      if XNN_UNPREDICTABLE(i7 != zero) {
+        i7 = (const int8_t*) ((uintptr_t) i7 + input_offset);
+      }
+
+      int32_t* b = buffer;
+      for (size_t c = 0; c < channels; c += 8) {
+        const __m128i vi0 = _mm_loadl_epi64((const __m128i*) i0);
+        i0 += 8;
+        const __m128i vi1 = _mm_loadl_epi64((const __m128i*) i1);
+        i1 += 8;
+        const __m128i vi2 = _mm_loadl_epi64((const __m128i*) i2);
+        i2 += 8;
+        const __m128i vi3 = _mm_loadl_epi64((const __m128i*) i3);
+        i3 += 8;
+        const __m128i vi4 = _mm_loadl_epi64((const __m128i*) i4);
+        i4 += 8;
+        const __m128i vi5 = _mm_loadl_epi64((const __m128i*) i5);
+        i5 += 8;
+        const __m128i vi6 = _mm_loadl_epi64((const __m128i*) i6);
+        i6 += 8;
+        const __m128i vi7 = _mm_loadl_epi64((const __m128i*) i7);
+        i7 += 8;
+
+        const __m128i vxi0 = _mm_srai_epi16(_mm_unpacklo_epi8(vi0, vi0), 8);
+        const __m128i vxi1 = _mm_srai_epi16(_mm_unpacklo_epi8(vi1, vi1), 8);
+        const __m128i vxi2 = _mm_srai_epi16(_mm_unpacklo_epi8(vi2, vi2), 8);
+        const __m128i vxi3 = _mm_srai_epi16(_mm_unpacklo_epi8(vi3, vi3), 8);
+        const __m128i vxi4 = _mm_srai_epi16(_mm_unpacklo_epi8(vi4, vi4), 8);
+        const __m128i vxi5 = _mm_srai_epi16(_mm_unpacklo_epi8(vi5, vi5), 8);
+        const __m128i vxi6 = _mm_srai_epi16(_mm_unpacklo_epi8(vi6, vi6), 8);
+        const __m128i vxi7 = _mm_srai_epi16(_mm_unpacklo_epi8(vi7, vi7), 8);
+
+        __m128i vsum = _mm_add_epi16(vxi0, vxi1);
+        vsum = _mm_add_epi16(vsum, vxi2);
+        vsum = _mm_add_epi16(vsum, vxi3);
+        vsum = _mm_add_epi16(vsum, vxi4);
+        vsum = _mm_add_epi16(vsum, vxi5);
+        vsum = _mm_add_epi16(vsum, vxi6);
+        vsum = _mm_add_epi16(vsum, vxi7);
+
+        const __m128i vsgnsum = _mm_cmpgt_epi16(_mm_setzero_si128(), vsum);
+        __m128i vacc0123 = _mm_unpacklo_epi16(vsum, vsgnsum);
+        __m128i vacc4567 = _mm_unpackhi_epi16(vsum, vsgnsum);
+        vacc0123 = _mm_add_epi32(vacc0123, _mm_load_si128((const __m128i*) b));
+        vacc4567 = _mm_add_epi32(vacc4567, _mm_load_si128((const __m128i*) (b + 4)));
+
+        _mm_store_si128((__m128i*) b, vacc0123);
+        _mm_store_si128((__m128i*) (b + 4), vacc4567);
+        b += 8;
+      }
+    }
+
+    // Last pass.
+    {
+      const int8_t* i0 = input[0];
+      assert(i0 != NULL);
+      const int8_t* i1 = input[1];
+      const int8_t* i2 = input[2];
+      const int8_t* i3 = input[3];
+      const int8_t* i4 = input[4];
+      const int8_t* i5 = input[5];
+      const int8_t* i6 = input[6];
+      const int8_t* i7 = input[7];
+      input = (const int8_t**) ((uintptr_t) input + input_increment);
+      if (k < 2) {
+        i1 = zero;
+      }
+      assert(i1 != NULL);
+      if (k <= 2) {
+        i2 = zero;
+      }
+      assert(i2 != NULL);
+      if (k < 4) {
+        i3 = zero;
+      }
+      assert(i3 != NULL);
+      if (k <= 4) {
+        i4 = zero;
+      }
+      assert(i4 != NULL);
+      if (k < 6) {
+        i5 = zero;
+      }
+      assert(i5 != NULL);
+      if (k <= 6) {
+        i6 = zero;
+      }
+      assert(i6 != NULL);
+      if (k < 8) {
+        i7 = zero;
+      }
+      assert(i7 != NULL);
+      if XNN_UNPREDICTABLE(i0 != zero) {
+        i0 = (const int8_t*) ((uintptr_t) i0 + input_offset);
+      }
+      if XNN_UNPREDICTABLE(i1 != zero) {
+        i1 = (const int8_t*) ((uintptr_t) i1 + input_offset);
+      }
+      if XNN_UNPREDICTABLE(i2 != zero) {
+        i2 = (const int8_t*) ((uintptr_t) i2 + input_offset);
+      }
+      if XNN_UNPREDICTABLE(i3 != zero) {
+        i3 = (const int8_t*) ((uintptr_t) i3 + input_offset);
+      }
+      if XNN_UNPREDICTABLE(i4 != zero) {
+        i4 = (const int8_t*) ((uintptr_t) i4 + input_offset);
+      }
+      if XNN_UNPREDICTABLE(i5 != zero) {
+        i5 = (const int8_t*) ((uintptr_t) i5 + input_offset);
+      }
+      if XNN_UNPREDICTABLE(i6 != zero) {
+        i6 = (const int8_t*) ((uintptr_t) i6 + input_offset);
+      }
+      if XNN_UNPREDICTABLE(i7 != zero) {
+        i7 = (const int8_t*) ((uintptr_t) i7 + input_offset);
+      }
+
+      int32_t* b = buffer;
+      size_t c = channels;
+      for (; c >= 8; c -= 8) {
+        const __m128i vi0 = _mm_loadl_epi64((const __m128i*) i0);
+        i0 += 8;
+        const __m128i vi1 = _mm_loadl_epi64((const __m128i*) i1);
+        i1 += 8;
+        const __m128i vi2 = _mm_loadl_epi64((const __m128i*) i2);
+        i2 += 8;
+        const __m128i vi3 = _mm_loadl_epi64((const __m128i*) i3);
+        i3 += 8;
+        const __m128i vi4 = _mm_loadl_epi64((const __m128i*) i4);
+        i4 += 8;
+        const __m128i vi5 = _mm_loadl_epi64((const __m128i*) i5);
+        i5 += 8;
+        const __m128i vi6 = _mm_loadl_epi64((const __m128i*) i6);
+        i6 += 8;
+        const __m128i vi7 = _mm_loadl_epi64((const __m128i*) i7);
+        i7 += 8;
+
+        const __m128i vxi0 = _mm_srai_epi16(_mm_unpacklo_epi8(vi0, vi0), 8);
+        const __m128i vxi1 = _mm_srai_epi16(_mm_unpacklo_epi8(vi1, vi1), 8);
+        const __m128i vxi2 = _mm_srai_epi16(_mm_unpacklo_epi8(vi2, vi2), 8);
+        const __m128i vxi3 = _mm_srai_epi16(_mm_unpacklo_epi8(vi3, vi3), 8);
+        const __m128i vxi4 = _mm_srai_epi16(_mm_unpacklo_epi8(vi4, vi4), 8);
+        const __m128i vxi5 = _mm_srai_epi16(_mm_unpacklo_epi8(vi5, vi5), 8);
+        const __m128i vxi6 = _mm_srai_epi16(_mm_unpacklo_epi8(vi6, vi6), 8);
+        const __m128i vxi7 = _mm_srai_epi16(_mm_unpacklo_epi8(vi7, vi7), 8);
+
+        __m128i vsum = _mm_add_epi16(vxi0, vxi1);
+        vsum = _mm_add_epi16(vsum, vxi2);
+        vsum = _mm_add_epi16(vsum, vxi3);
+        vsum = _mm_add_epi16(vsum, vxi4);
+        vsum = _mm_add_epi16(vsum, vxi5);
+        vsum = _mm_add_epi16(vsum, vxi6);
+        vsum = _mm_add_epi16(vsum, vxi7);
+
+        const __m128i vsgnsum = _mm_cmpgt_epi16(_mm_setzero_si128(), vsum);
+        __m128i vacc0123 = _mm_unpacklo_epi16(vsum, vsgnsum);
+        __m128i vacc4567 = _mm_unpackhi_epi16(vsum, vsgnsum);
+        vacc0123 = _mm_add_epi32(vacc0123, _mm_load_si128((const __m128i*) b));
+        vacc4567 = _mm_add_epi32(vacc4567, _mm_load_si128((const __m128i*) (b + 4)));
+        b += 8;
+
+        __m128 vfpacc0123 = _mm_cvtepi32_ps(vacc0123);
+        __m128 vfpacc4567 = _mm_cvtepi32_ps(vacc4567);
+
+        vfpacc0123 = _mm_mul_ps(vfpacc0123, vscale);
+        vfpacc4567 = _mm_mul_ps(vfpacc4567, vscale);
+
+        vfpacc0123 = _mm_min_ps(vfpacc0123, voutput_max_less_zero_point);
+        vfpacc4567 = _mm_min_ps(vfpacc4567, voutput_max_less_zero_point);
+
+        vacc0123 = _mm_cvtps_epi32(vfpacc0123);
+        vacc4567 = _mm_cvtps_epi32(vfpacc4567);
+
+        __m128i vout01234567 = _mm_adds_epi16(_mm_packs_epi32(vacc0123, vacc4567), voutput_zero_point);
+        vout01234567 = _mm_max_epi16(vout01234567, voutput_min);
+
+        __m128i vout0123456701234567 = _mm_packs_epi16(vout01234567, vout01234567);
+
+        _mm_storel_epi64((__m128i*) output, vout0123456701234567);
+        output += 8;
+      }
+      if (c != 0) {
+        const __m128i vi0 = _mm_loadl_epi64((const __m128i*) i0);
+        const __m128i vi1 = _mm_loadl_epi64((const __m128i*) i1);
+        const __m128i vi2 = _mm_loadl_epi64((const __m128i*) i2);
+        const __m128i vi3 = _mm_loadl_epi64((const __m128i*) i3);
+        const __m128i vi4 = _mm_loadl_epi64((const __m128i*) i4);
+        const __m128i vi5 = _mm_loadl_epi64((const __m128i*) i5);
+        const __m128i vi6 = _mm_loadl_epi64((const __m128i*) i6);
+        const __m128i vi7 = _mm_loadl_epi64((const __m128i*) i7);
+
+        const __m128i vxi0 = _mm_srai_epi16(_mm_unpacklo_epi8(vi0, vi0), 8);
+        const __m128i vxi1 = _mm_srai_epi16(_mm_unpacklo_epi8(vi1, vi1), 8);
+        const __m128i vxi2 = _mm_srai_epi16(_mm_unpacklo_epi8(vi2, vi2), 8);
+        const __m128i vxi3 = _mm_srai_epi16(_mm_unpacklo_epi8(vi3, vi3), 8);
+        const __m128i vxi4 = _mm_srai_epi16(_mm_unpacklo_epi8(vi4, vi4), 8);
+        const __m128i vxi5 = _mm_srai_epi16(_mm_unpacklo_epi8(vi5, vi5), 8);
+        const __m128i vxi6 = _mm_srai_epi16(_mm_unpacklo_epi8(vi6, vi6), 8);
+        const __m128i vxi7 = _mm_srai_epi16(_mm_unpacklo_epi8(vi7, vi7), 8);
+
+        __m128i vsum = _mm_add_epi16(vxi0, vxi1);
+        vsum = _mm_add_epi16(vsum, vxi2);
+        vsum = _mm_add_epi16(vsum, vxi3);
+        vsum = _mm_add_epi16(vsum, vxi4);
+        vsum = _mm_add_epi16(vsum, vxi5);
+        vsum = _mm_add_epi16(vsum, vxi6);
+        vsum = _mm_add_epi16(vsum, vxi7);
+
+        const __m128i vsgnsum = _mm_cmpgt_epi16(_mm_setzero_si128(), vsum);
+        __m128i vacc0123 = _mm_unpacklo_epi16(vsum, vsgnsum);
+        __m128i vacc4567 = _mm_unpackhi_epi16(vsum, vsgnsum);
+        vacc0123 = _mm_add_epi32(vacc0123, _mm_load_si128((const __m128i*) b));
+        vacc4567 = _mm_add_epi32(vacc4567, _mm_load_si128((const __m128i*) (b + 4)));
+
+        __m128 vfpacc0123 = _mm_cvtepi32_ps(vacc0123);
+        __m128 vfpacc4567 = _mm_cvtepi32_ps(vacc4567);
+
+        vfpacc0123 = _mm_mul_ps(vfpacc0123, vscale);
+        vfpacc4567 = _mm_mul_ps(vfpacc4567, vscale);
+
+        vfpacc0123 = _mm_min_ps(vfpacc0123, voutput_max_less_zero_point);
+        vfpacc4567 = _mm_min_ps(vfpacc4567, voutput_max_less_zero_point);
+
+        vacc0123 = _mm_cvtps_epi32(vfpacc0123);
+        vacc4567 = _mm_cvtps_epi32(vfpacc4567);
+
+        __m128i vout01234567 = _mm_adds_epi16(_mm_packs_epi32(vacc0123, vacc4567), voutput_zero_point);
+        vout01234567 = _mm_max_epi16(vout01234567, voutput_min);
+
+        __m128i vout0123456701234567 = _mm_packs_epi16(vout01234567, vout01234567);
+
+        if (c & 4) {
+          *((uint32_t*) output) = (uint32_t) _mm_cvtsi128_si32(vout0123456701234567);
+          vout0123456701234567 = _mm_srli_epi64(vout0123456701234567, 32);
+          output += 4;
+        }
+        uint32_t vout0123 = (uint32_t) _mm_cvtsi128_si32(vout0123456701234567);
+        if (c & 2) {
+          *((uint16_t*) output) = (uint16_t) vout0123;
+          vout0123 >>= 16;
+          output += 2;
+        }
+        if (c & 1) {
+          *output = (int8_t) vout0123;
+          output += 1;
+        }
+      }
+    }
+    output = (int8_t*) ((uintptr_t) output + output_increment);
+  } while (--output_pixels != 0);
+}
+
+void xnn_qs8_avgpool_minmax_fp32_ukernel_9x__sse2_c8(
+    size_t output_pixels,
+    size_t kernel_elements,
+    size_t channels,
+    const int8_t** input,
+    size_t input_offset,
+    const int8_t* zero,
+    int8_t* output,
+    size_t input_increment,
+    size_t output_increment,
+    const union xnn_qs8_avgpool_minmax_params params[restrict XNN_MIN_ELEMENTS(1)]) XNN_OOB_READS
+{
+  assert(output_pixels != 0);
+  assert(kernel_elements != 0);
+  assert(kernel_elements <= 9);
+  assert(channels != 0);
+
+  const __m128i vinit_bias = _mm_load_si128((const __m128i*) params->fp32_sse2.init_bias);
+  const __m128 vscale = _mm_load_ps(params->fp32_sse2.scale);
+  const __m128 voutput_max_less_zero_point = _mm_load_ps(params->fp32_sse2.output_max_less_zero_point);
+  const __m128i voutput_zero_point = _mm_load_si128((const __m128i*) params->fp32_sse2.output_zero_point);
+  const __m128i voutput_min = _mm_load_si128((const __m128i*) params->fp32_sse2.output_min);
+  do {
+    const int8_t* i0 = input[0];
+    assert(i0 != NULL);
+    const int8_t* i1 = input[1];
+    const int8_t* i2 = input[2];
+    const int8_t* i3 = input[3];
+    const int8_t* i4 = input[4];
+    const int8_t* i5 = input[5];
+    const int8_t* i6 = input[6];
+    const int8_t* i7 = input[7];
+    const int8_t* i8 = input[8];
+    input = (const int8_t**) ((uintptr_t) input + input_increment);
+    if (kernel_elements < 2) {
+      i1 = zero;
+    }
+    assert(i1 != NULL);
+    if (kernel_elements <= 2) {
+      i2 = zero;
+    }
+    assert(i2 != NULL);
+    if (kernel_elements < 4) {
+      i3 = zero;
+    }
+    assert(i3 != NULL);
+    if (kernel_elements <= 4) {
+      i4 = zero;
+    }
+    assert(i4 != NULL);
+    if (kernel_elements < 6) {
+      i5 = zero;
+    }
+    assert(i5 != NULL);
+    if (kernel_elements <= 6) {
+      i6 = zero;
+    }
+    assert(i6 != NULL);
+    if (kernel_elements < 8) {
+      i7 = zero;
+    }
+    assert(i7 != NULL);
+    if (kernel_elements <= 8) {
+      i8 = zero;
+    }
+    assert(i8 != NULL);
+    if XNN_UNPREDICTABLE(i0 != zero) {
+      i0 = (const int8_t*) ((uintptr_t) i0 + input_offset);
+    }
+    if XNN_UNPREDICTABLE(i1 != zero) {
+      i1 = (const int8_t*) ((uintptr_t) i1 + input_offset);
+    }
+    if XNN_UNPREDICTABLE(i2 != zero) {
+      i2 = (const int8_t*) ((uintptr_t) i2 + input_offset);
+    }
+    if XNN_UNPREDICTABLE(i3 != zero) {
+      i3 = (const int8_t*) ((uintptr_t) i3 + input_offset);
+    }
+    if XNN_UNPREDICTABLE(i4 != zero) {
+      i4 = (const int8_t*) ((uintptr_t) i4 + input_offset);
+    }
+    if XNN_UNPREDICTABLE(i5 != zero) {
+      i5 = (const int8_t*) ((uintptr_t) i5 + input_offset);
+    }
+    if XNN_UNPREDICTABLE(i6 != zero) {
+      i6 = (const int8_t*) ((uintptr_t) i6 + input_offset);
+    }
+    if XNN_UNPREDICTABLE(i7 != zero) {
+      i7 = (const int8_t*) ((uintptr_t) i7 + input_offset);
+    }
+    if XNN_UNPREDICTABLE(i8 != zero) {
+      i8 = (const int8_t*) ((uintptr_t) i8 + input_offset);
+    }
+
+    size_t c = channels;
+    for (; c >= 8; c -= 8) {
+      const __m128i vi0 = _mm_loadl_epi64((const __m128i*) i0);
+      i0 += 8;
+      const __m128i vi1 = _mm_loadl_epi64((const __m128i*) i1);
+      i1 += 8;
+      const __m128i vi2 = _mm_loadl_epi64((const __m128i*) i2);
+      i2 += 8;
+      const __m128i vi3 = _mm_loadl_epi64((const __m128i*) i3);
+      i3 += 8;
+      const __m128i vi4 = _mm_loadl_epi64((const __m128i*) i4);
+      i4 += 8;
+      const __m128i vi5 = _mm_loadl_epi64((const __m128i*) i5);
+      i5 += 8;
+      const __m128i vi6 = _mm_loadl_epi64((const __m128i*) i6);
+      i6 += 8;
+      const __m128i vi7 = _mm_loadl_epi64((const __m128i*) i7);
+      i7 += 8;
+      const __m128i vi8 = _mm_loadl_epi64((const __m128i*) i8);
+      i8 += 8;
+
+      const __m128i vxi0 = _mm_srai_epi16(_mm_unpacklo_epi8(vi0, vi0), 8);
+      const __m128i vxi1 = _mm_srai_epi16(_mm_unpacklo_epi8(vi1, vi1), 8);
+      const __m128i vxi2 = _mm_srai_epi16(_mm_unpacklo_epi8(vi2, vi2), 8);
+      const __m128i vxi3 = _mm_srai_epi16(_mm_unpacklo_epi8(vi3, vi3), 8);
+      const __m128i vxi4 = _mm_srai_epi16(_mm_unpacklo_epi8(vi4, vi4), 8);
+      const __m128i vxi5 = _mm_srai_epi16(_mm_unpacklo_epi8(vi5, vi5), 8);
+      const __m128i vxi6 = _mm_srai_epi16(_mm_unpacklo_epi8(vi6, vi6), 8);
+      const __m128i vxi7 = _mm_srai_epi16(_mm_unpacklo_epi8(vi7, vi7), 8);
+      const __m128i vxi8 = _mm_srai_epi16(_mm_unpacklo_epi8(vi8, vi8), 8);
+
+      __m128i vsum = _mm_add_epi16(vxi0, vxi1);
+      vsum = _mm_add_epi16(vsum, vxi2);
+      vsum = _mm_add_epi16(vsum, vxi3);
+      vsum = _mm_add_epi16(vsum, vxi4);
+      vsum = _mm_add_epi16(vsum, vxi5);
+      vsum = _mm_add_epi16(vsum, vxi6);
+      vsum = _mm_add_epi16(vsum, vxi7);
+      vsum = _mm_add_epi16(vsum, vxi8);
+
+      const __m128i vsgnsum = _mm_cmpgt_epi16(_mm_setzero_si128(), vsum);
+      __m128i vacc0123 = _mm_unpacklo_epi16(vsum, vsgnsum);
+      __m128i vacc4567 = _mm_unpackhi_epi16(vsum, vsgnsum);
+      vacc0123 = _mm_add_epi32(vacc0123, vinit_bias);
+      vacc4567 = _mm_add_epi32(vacc4567, vinit_bias);
+
+      __m128 vfpacc0123 = _mm_cvtepi32_ps(vacc0123);
+      __m128 vfpacc4567 = _mm_cvtepi32_ps(vacc4567);
+
+      vfpacc0123 = _mm_mul_ps(vfpacc0123, vscale);
+      vfpacc4567 = _mm_mul_ps(vfpacc4567, vscale);
+
+      vfpacc0123 = _mm_min_ps(vfpacc0123, voutput_max_less_zero_point);
+      vfpacc4567 = _mm_min_ps(vfpacc4567, voutput_max_less_zero_point);
+
+      vacc0123 = _mm_cvtps_epi32(vfpacc0123);
+      vacc4567 = _mm_cvtps_epi32(vfpacc4567);
+
+      __m128i vout01234567 = _mm_adds_epi16(_mm_packs_epi32(vacc0123, vacc4567), voutput_zero_point);
+      vout01234567 = _mm_max_epi16(vout01234567, voutput_min);
+
+      __m128i vout0123456701234567 = _mm_packs_epi16(vout01234567, vout01234567);
+
+      _mm_storel_epi64((__m128i*) output, vout0123456701234567);
+      output += 8;
+    }
+    if (c != 0) {
+      const __m128i vi0 = _mm_loadl_epi64((const __m128i*) i0);
+      const __m128i vi1 = _mm_loadl_epi64((const __m128i*) i1);
+      const __m128i vi2 = _mm_loadl_epi64((const __m128i*) i2);
+      const __m128i vi3 = _mm_loadl_epi64((const __m128i*) i3);
+      const __m128i vi4 = _mm_loadl_epi64((const __m128i*) i4);
+      const __m128i vi5 = _mm_loadl_epi64((const __m128i*) i5);
+      const __m128i vi6 = _mm_loadl_epi64((const __m128i*) i6);
+      const __m128i vi7 = _mm_loadl_epi64((const __m128i*) i7);
+      const __m128i vi8 = _mm_loadl_epi64((const __m128i*) i8);
+
+      const __m128i vxi0 = _mm_srai_epi16(_mm_unpacklo_epi8(vi0, vi0), 8);
+      const __m128i vxi1 = _mm_srai_epi16(_mm_unpacklo_epi8(vi1, vi1), 8);
+      const __m128i vxi2 = _mm_srai_epi16(_mm_unpacklo_epi8(vi2, vi2), 8);
+      const __m128i vxi3 = _mm_srai_epi16(_mm_unpacklo_epi8(vi3, vi3), 8);
+      const __m128i vxi4 = _mm_srai_epi16(_mm_unpacklo_epi8(vi4, vi4), 8);
+      const __m128i vxi5 = _mm_srai_epi16(_mm_unpacklo_epi8(vi5, vi5), 8);
+      const __m128i vxi6 = _mm_srai_epi16(_mm_unpacklo_epi8(vi6, vi6), 8);
+      const __m128i vxi7 = _mm_srai_epi16(_mm_unpacklo_epi8(vi7, vi7), 8);
+      const __m128i vxi8 = _mm_srai_epi16(_mm_unpacklo_epi8(vi8, vi8), 8);
+
+      __m128i vsum = _mm_add_epi16(vxi0, vxi1);
+      vsum = _mm_add_epi16(vsum, vxi2);
+      vsum = _mm_add_epi16(vsum, vxi3);
+      vsum = _mm_add_epi16(vsum, vxi4);
+      vsum = _mm_add_epi16(vsum, vxi5);
+      vsum = _mm_add_epi16(vsum, vxi6);
+      vsum = _mm_add_epi16(vsum, vxi7);
+      vsum = _mm_add_epi16(vsum, vxi8);
+
+      const __m128i vsgnsum = _mm_cmpgt_epi16(_mm_setzero_si128(), vsum);
+      __m128i vacc0123 = _mm_unpacklo_epi16(vsum, vsgnsum);
+      __m128i vacc4567 = _mm_unpackhi_epi16(vsum, vsgnsum);
+      vacc0123 = _mm_add_epi32(vacc0123, vinit_bias);
+      vacc4567 = _mm_add_epi32(vacc4567, vinit_bias);
+
+      __m128 vfpacc0123 = _mm_cvtepi32_ps(vacc0123);
+      __m128 vfpacc4567 = _mm_cvtepi32_ps(vacc4567);
+
+      vfpacc0123 = _mm_mul_ps(vfpacc0123, vscale);
+      vfpacc4567 = _mm_mul_ps(vfpacc4567, vscale);
+
+      vfpacc0123 = _mm_min_ps(vfpacc0123, voutput_max_less_zero_point);
+      vfpacc4567 = _mm_min_ps(vfpacc4567, voutput_max_less_zero_point);
+
+      vacc0123 = _mm_cvtps_epi32(vfpacc0123);
+      vacc4567 = _mm_cvtps_epi32(vfpacc4567);
+
+      __m128i vout01234567 = _mm_adds_epi16(_mm_packs_epi32(vacc0123, vacc4567), voutput_zero_point);
+      vout01234567 = _mm_max_epi16(vout01234567, voutput_min);
+
+      __m128i vout0123456701234567 = _mm_packs_epi16(vout01234567, vout01234567);
+
+      if (c & 4) {
+        *((uint32_t*) output) = (uint32_t) _mm_cvtsi128_si32(vout0123456701234567);
+        vout0123456701234567 = _mm_srli_epi64(vout0123456701234567, 32);
+        output += 4;
+      }
+      uint32_t vout0123 = (uint32_t) _mm_cvtsi128_si32(vout0123456701234567);
+      if (c & 2) {
+        *((uint16_t*) output) = (uint16_t) vout0123;
+        vout0123 >>= 16;
+        output += 2;
+      }
+      if (c & 1) {
+        *output = (int8_t) vout0123;
+        output += 1;
+      }
+    }
+    output = (int8_t*) ((uintptr_t) output + output_increment);
+  } while (--output_pixels != 0);
+}
+
 void xnn_qs8_dwconv_minmax_fp32_ukernel_up8x25__sse2_mul16_add16(
     size_t channels,
     size_t output_width,
@@ -0,0 +1,780 @@
+// Copyright 2022 Google LLC
+//
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree.
+
+#include <assert.h>
+#include <math.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+
+#ifdef _WIN32
+  #include <windows.h>
+#else
+  #include <pthread.h>
+  #include <time.h>
+#endif
+
+#include <xnnpack.h>
+#include <xnnpack/allocator.h>
+#include <xnnpack/autotune.h>
+#include <xnnpack/common.h>
+#include <xnnpack/gemm.h>
+#include <xnnpack/igemm.h>
+#include <xnnpack/log.h>
+#include <xnnpack/math.h>
+#include <xnnpack/params.h>
+
+#ifndef XNN_ENABLE_ASSEMBLY
+  #define XNN_ENABLE_ASSEMBLY 1
+#endif
+
+// Micro-kernels which are never selected by default on x86 processors are built only for autotuning, see the
+// XNNPACK_ENABLE_AUTOTUNE_CANDIDATES build option.
+#ifndef XNN_ENABLE_AUTOTUNE_CANDIDATES
+  #define XNN_ENABLE_AUTOTUNE_CANDIDATES 0
+#endif
+
+
+// Number of output rows every candidate computes in one measurement, rounded up to a multiple of its MR.
+#define XNN_AUTOTUNE_ROWS 48
+// Maximum number of packed weights elements multiplied in one measurement. Layers with more weights are measured on a
+// subset of their output channels.
+#define XNN_AUTOTUNE_MAX_WEIGHTS_ELEMENTS (1024 * 1024)
+// Number of measurements of every candidate, after a warm-up run. The fastest measurement is used.
+#define XNN_AUTOTUNE_REPETITIONS 5
+
+#define XNN_AUTOTUNE_CACHE_MAGIC "xnnpack-autotune"
+#define XNN_AUTOTUNE_CACHE_VERSION 1
+
+struct f32_gemm_candidate {
+  const char* name;
+  xnn_f32_gemm_minmax_ukernel_function gemm;
+  xnn_f32_igemm_minmax_ukernel_function igemm;
+  xnn_f32_gemm_minmax_ukernel_function gemm1;
+  xnn_f32_igemm_minmax_ukernel_function igemm1;
+  xnn_f32_gemm_minmax_ukernel_function gemv;
+  uint8_t mr;
+  uint8_t nr;
+  uint8_t log2_kr;
+  uint8_t log2_sr;
+};
+
+// Set of micro-kernels which can replace each other on a processor. The set is selected by looking up the default
+// micro-kernel in xnn_params.f32.gemm, and all candidates in the set use its parameters initialization function.
+struct f32_gemm_candidate_set {
+  const char* name;
+  // Terminated by an element with NULL name.
+  const struct f32_gemm_candidate* candidates;
+};
+
+#if XNN_ARCH_ARM64
+static const struct f32_gemm_candidate aarch64_neonfma_candidates[] = {
+#if XNN_ENABLE_ASSEMBLY
+  {
+    .name = "6x8__aarch64_neonfma_prfm_cortex_a75",
+    .gemm = xnn_f32_gemm_minmax_ukernel_6x8__aarch64_neonfma_prfm_cortex_a75,
+    .igemm = xnn_f32_igemm_minmax_ukernel_6x8__aarch64_neonfma_prfm_cortex_a75,
+    .gemm1 = xnn_f32_gemm_minmax_ukernel_1x8__neonfma_lane_ld64,
+    .igemm1 = xnn_f32_igemm_minmax_ukernel_1x8__neonfma_lane_ld64,
+    .gemv = xnn_f32_gemm_minmax_ukernel_1x8__neonfma_dup_acc4,
+    .mr = 6, .nr = 8,
+  },
+  {
+    .name = "6x8__aarch64_neonfma_cortex_a75",
+    .gemm = xnn_f32_gemm_minmax_ukernel_6x8__aarch64_neonfma_cortex_a75,
+    .igemm = xnn_f32_igemm_minmax_ukernel_6x8__aarch64_neonfma_cortex_a75,
+    .gemm1 = xnn_f32_gemm_minmax_ukernel_1x8__neonfma_lane_ld64,
+    .igemm1 = xnn_f32_igemm_minmax_ukernel_1x8__neonfma_lane_ld64,
+    .gemv = xnn_f32_gemm_minmax_ukernel_1x8__neonfma_dup_acc4,
+    .mr = 6, .nr = 8,
+  },
+  {
+    .name = "4x8__aarch64_neonfma_prfm_cortex_a75",
+    .gemm = xnn_f32_gemm_minmax_ukernel_4x8__aarch64_neonfma_prfm_cortex_a75,
+    .igemm = xnn_f32_igemm_minmax_ukernel_4x8__aarch64_neonfma_prfm_cortex_a75,
+    .gemm1 = xnn_f32_gemm_minmax_ukernel_1x8__neonfma_lane_ld64,
+    .igemm1 = xnn_f32_igemm_minmax_ukernel_1x8__neonfma_lane_ld64,
+    .gemv = xnn_f32_gemm_minmax_ukernel_1x8__neonfma_dup_acc4,
+    .mr = 4, .nr = 8,
+  },
+  {
+    .name = "4x8__aarch64_neonfma_cortex_a75",
+    .gemm = xnn_f32_gemm_minmax_ukernel_4x8__aarch64_neonfma_cortex_a75,
+    .igemm = xnn_f32_igemm_minmax_ukernel_4x8__aarch64_neonfma_cortex_a75,
+    .gemm1 = xnn_f32_gemm_minmax_ukernel_1x8__neonfma_lane_ld64,
+    .igemm1 = xnn_f32_igemm_minmax_ukernel_1x8__neonfma_lane_ld64,
+    .gemv = xnn_f32_gemm_minmax_ukernel_1x8__neonfma_dup_acc4,
+    .mr = 4, .nr = 8,
+  },
+  {
+    .name = "6x8__aarch64_neonfma_cortex_a53",
+    .gemm = xnn_f32_gemm_minmax_ukernel_6x8__aarch64_neonfma_cortex_a53,
+    .igemm = xnn_f32_igemm_minmax_ukernel_6x8__aarch64_neonfma_cortex_a53,
+    .gemm1 = xnn_f32_gemm_minmax_ukernel_1x8__neonfma_lane_ld64,
+    .igemm1 = xnn_f32_igemm_minmax_ukernel_1x8__neonfma_lane_ld64,
+    .gemv = xnn_f32_gemm_minmax_ukernel_1x8__neonfma_dup_acc4,
+    .mr = 6, .nr = 8,
+  },
+  {
+    .name = "6x8__aarch64_neonfma_prfm_cortex_a53",
+    .gemm = xnn_f32_gemm_minmax_ukernel_6x8__aarch64_neonfma_prfm_cortex_a53,
+    .igemm = xnn_f32_igemm_minmax_ukernel_6x8__aarch64_neonfma_prfm_cortex_a53,
+    .gemm1 = xnn_f32_gemm_minmax_ukernel_1x8__neonfma_lane_ld64,
+    .igemm1 = xnn_f32_igemm_minmax_ukernel_1x8__neonfma_lane_ld64,
+    .gemv = xnn_f32_gemm_minmax_ukernel_1x8__neonfma_dup_acc4,
+    .mr = 6, .nr = 8,
+  },
+  {
+    .name = "6x8__aarch64_neonfma_cortex_a55",
+    .gemm = xnn_f32_gemm_minmax_ukernel_6x8__aarch64_neonfma_cortex_a55,
+    .igemm = xnn_f32_igemm_minmax_ukernel_6x8__aarch64_neonfma_cortex_a55,
+    .gemm1 = xnn_f32_gemm_minmax_ukernel_1x8__neonfma_lane_ld64,
+    .igemm1 = xnn_f32_igemm_minmax_ukernel_1x8__neonfma_lane_ld64,
+    .gemv = xnn_f32_gemm_minmax_ukernel_1x8__neonfma_dup_acc4,
+    .mr = 6, .nr = 8,
+  },
+  {
+    .name = "6x8__aarch64_neonfma_cortex_a73",
+    .gemm = xnn_f32_gemm_minmax_ukernel_6x8__aarch64_neonfma_cortex_a73,
+    .igemm = xnn_f32_igemm_minmax_ukernel_6x8__aarch64_neonfma_cortex_a73,
+    .gemm1 = xnn_f32_gemm_minmax_ukernel_1x8__neonfma_lane_ld64,
+    .igemm1 = xnn_f32_igemm_minmax_ukernel_1x8__neonfma_lane_ld64,
+    .gemv = xnn_f32_gemm_minmax_ukernel_1x8__neonfma_dup_acc4,
+    .mr = 6, .nr = 8,
+  },
+  {
+    .name = "6x8__aarch64_neonfma_ld64",
+    .gemm = xnn_f32_gemm_minmax_ukernel_6x8__aarch64_neonfma_ld64,
+    .igemm = xnn_f32_igemm_minmax_ukernel_6x8__aarch64_neonfma_ld64,
+    .gemm1 = xnn_f32_gemm_minmax_ukernel_1x8__neonfma_lane_ld64,
+    .igemm1 = xnn_f32_igemm_minmax_ukernel_1x8__neonfma_lane_ld64,
+    .gemv = xnn_f32_gemm_minmax_ukernel_1x8__neonfma_dup_acc4,
+    .mr = 6, .nr = 8,
+  },
+  {
+    .name = "6x8__aarch64_neonfma_ld128",
+    .gemm = xnn_f32_gemm_minmax_ukernel_6x8__aarch64_neonfma_ld128,
+    .igemm = xnn_f32_igemm_minmax_ukernel_6x8__aarch64_neonfma_ld128,
+    .gemm1 = xnn_f32_gemm_minmax_ukernel_1x8__neonfma_lane_ld64,
+    .igemm1 = xnn_f32_igemm_minmax_ukernel_1x8__neonfma_lane_ld64,
+    .gemv = xnn_f32_gemm_minmax_ukernel_1x8__neonfma_dup_acc4,
+    .mr = 6, .nr = 8,
+  },
+  {
+    .name = "4x8__aarch64_neonfma_ld128",
+    .gemm = xnn_f32_gemm_minmax_ukernel_4x8__aarch64_neonfma_ld128,
+    .igemm = xnn_f32_igemm_minmax_ukernel_4x8__aarch64_neonfma_ld128,
+    .gemm1 = xnn_f32_gemm_minmax_ukernel_1x8__neonfma_lane_ld64,
+    .igemm1 = xnn_f32_igemm_minmax_ukernel_1x8__neonfma_lane_ld64,
+    .gemv = xnn_f32_gemm_minmax_ukernel_1x8__neonfma_dup_acc4,
+    .mr = 4, .nr = 8,
+  },
+#endif  // XNN_ENABLE_ASSEMBLY
+  {
+    .name = "6x8__neonfma_lane_ld64",
+    .gemm = xnn_f32_gemm_minmax_ukernel_6x8__neonfma_lane_ld64,
+    .igemm = xnn_f32_igemm_minmax_ukernel_6x8__neonfma_lane_ld64,
+    .gemm1 = xnn_f32_gemm_minmax_ukernel_1x8__neonfma_lane_ld64,
+    .igemm1 = xnn_f32_igemm_minmax_ukernel_1x8__neonfma_lane_ld64,
+    .gemv = xnn_f32_gemm_minmax_ukernel_1x8__neonfma_dup_acc4,
+    .mr = 6, .nr = 8,
+  },
+  {
+    .name = "6x8s4__neonfma",
+    .gemm = xnn_f32_gemm_minmax_ukernel_6x8s4__neonfma,
+    .igemm = xnn_f32_igemm_minmax_ukernel_6x8s4__neonfma,
+    .gemm1 = xnn_f32_gemm_minmax_ukernel_1x8s4__neonfma,
+    .igemm1 = xnn_f32_igemm_minmax_ukernel_1x8s4__neonfma,
+    .mr = 6, .nr = 8, .log2_sr = 2,
+  },
+  { .name = NULL },
+};
+#endif  // XNN_ARCH_ARM64
+
+#if XNN_ARCH_X86 || XNN_ARCH_X86_64
+static const struct f32_gemm_candidate avx512f_candidates[] = {
+#if XNN_ENABLE_AUTOTUNE_CANDIDATES
+  {
+    .name = "4x16__avx512f_broadcast",
+    .gemm = xnn_f32_gemm_minmax_ukernel_4x16__avx512f_broadcast,
+    .igemm = xnn_f32_igemm_minmax_ukernel_4x16__avx512f_broadcast,
+    .gemm1 = xnn_f32_gemm_minmax_ukernel_1x16__avx512f_broadcast,
+    .igemm1 = xnn_f32_igemm_minmax_ukernel_1x16__avx512f_broadcast,
+    .gemv = xnn_f32_gemm_minmax_ukernel_1x16__avx512f_broadcast_acc4,
+    .mr = 4, .nr = 16,
+  },
+  {
+    .name = "5x16__avx512f_broadcast",
+    .gemm = xnn_f32_gemm_minmax_ukernel_5x16__avx512f_broadcast,
+    .igemm = xnn_f32_igemm_minmax_ukernel_5x16__avx512f_broadcast,
+    .gemm1 = xnn_f32_gemm_minmax_ukernel_1x16__avx512f_broadcast,
+    .igemm1 = xnn_f32_igemm_minmax_ukernel_1x16__avx512f_broadcast,
+    .gemv = xnn_f32_gemm_minmax_ukernel_1x16__avx512f_broadcast_acc4,
+    .mr = 5, .nr = 16,
+  },
+  {
+    .name = "6x16__avx512f_broadcast",
+    .gemm = xnn_f32_gemm_minmax_ukernel_6x16__avx512f_broadcast,
+    .igemm = xnn_f32_igemm_minmax_ukernel_6x16__avx512f_broadcast,
+    .gemm1 = xnn_f32_gemm_minmax_ukernel_1x16__avx512f_broadcast,
+    .igemm1 = xnn_f32_igemm_minmax_ukernel_1x16__avx512f_broadcast,
+    .gemv = xnn_f32_gemm_minmax_ukernel_1x16__avx512f_broadcast_acc4,
+    .mr = 6, .nr = 16,
+  },
+#endif  // XNN_ENABLE_AUTOTUNE_CANDIDATES
+  {
+    .name = "7x16__avx512f_broadcast",
+    .gemm = xnn_f32_gemm_minmax_ukernel_7x16__avx512f_broadcast,
+    .igemm = xnn_f32_igemm_minmax_ukernel_7x16__avx512f_broadcast,
+    .gemm1 = xnn_f32_gemm_minmax_ukernel_1x16__avx512f_broadcast,
+    .igemm1 = xnn_f32_igemm_minmax_ukernel_1x16__avx512f_broadcast,
+    .gemv = xnn_f32_gemm_minmax_ukernel_1x16__avx512f_broadcast_acc4,
+    .mr = 7, .nr = 16,
+  },
+#if XNN_ENABLE_AUTOTUNE_CANDIDATES
+  {
+    .name = "8x16__avx512f_broadcast",
+    .gemm = xnn_f32_gemm_minmax_ukernel_8x16__avx512f_broadcast,
+    .igemm = xnn_f32_igemm_minmax_ukernel_8x16__avx512f_broadcast,
+    .gemm1 = xnn_f32_gemm_minmax_ukernel_1x16__avx512f_broadcast,
+    .igemm1 = xnn_f32_igemm_minmax_ukernel_1x16__avx512f_broadcast,
+    .gemv = xnn_f32_gemm_minmax_ukernel_1x16__avx512f_broadcast_acc4,
+    .mr = 8, .nr = 16,
+  },
+#endif  // XNN_ENABLE_AUTOTUNE_CANDIDATES
+  { .name = NULL },
+};
+
+static const struct f32_gemm_candidate fma3_candidates[] = {
+#if XNN_ENABLE_AUTOTUNE_CANDIDATES
+  {
+    .name = "3x16__fma3_broadcast",
+    .gemm = xnn_f32_gemm_minmax_ukernel_3x16__fma3_broadcast,
+    .igemm = xnn_f32_igemm_minmax_ukernel_3x16__fma3_broadcast,
+    .gemm1 = xnn_f32_gemm_minmax_ukernel_1x16__fma3_broadcast,
+    .igemm1 = xnn_f32_igemm_minmax_ukernel_1x16__fma3_broadcast,
+    .gemv = xnn_f32_gemm_minmax_ukernel_1x16__fma3_broadcast_acc4,
+    .mr = 3, .nr = 16,
+  },
+  {
+    .name = "4x16__fma3_broadcast",
+    .gemm = xnn_f32_gemm_minmax_ukernel_4x16__fma3_broadcast,
+    .igemm = xnn_f32_igemm_minmax_ukernel_4x16__fma3_broadcast,
+    .gemm1 = xnn_f32_gemm_minmax_ukernel_1x16__fma3_broadcast,
+    .igemm1 = xnn_f32_igemm_minmax_ukernel_1x16__fma3_broadcast,
+    .gemv = xnn_f32_gemm_minmax_ukernel_1x16__fma3_broadcast_acc4,
+    .mr = 4, .nr = 16,
+  },
+#endif  // XNN_ENABLE_AUTOTUNE_CANDIDATES
+  {
+    .name = "5x16__fma3_broadcast",
+    .gemm = xnn_f32_gemm_minmax_ukernel_5x16__fma3_broadcast,
+    .igemm = xnn_f32_igemm_minmax_ukernel_5x16__fma3_broadcast,
+    .gemm1 = xnn_f32_gemm_minmax_ukernel_1x16__fma3_broadcast,
+    .igemm1 = xnn_f32_igemm_minmax_ukernel_1x16__fma3_broadcast,
+    .gemv = xnn_f32_gemm_minmax_ukernel_1x16__fma3_broadcast_acc4,
+    .mr = 5, .nr = 16,
+  },
+  {
+    .name = "4x16s4__fma3_broadcast",
+    .gemm = xnn_f32_gemm_minmax_ukernel_4x16s4__fma3_broadcast,
+    .igemm = xnn_f32_igemm_minmax_ukernel_4x16s4__fma3_broadcast,
+    .gemm1 = xnn_f32_gemm_minmax_ukernel_1x16s4__fma3_broadcast,
+    .igemm1 = xnn_f32_igemm_minmax_ukernel_1x16s4__fma3_broadcast,
+    .mr = 4, .nr = 16, .log2_sr = 2,
+  },
+  { .name = NULL },
+};
+
+static const struct f32_gemm_candidate avx_candidates[] = {
+#if XNN_ENABLE_AUTOTUNE_CANDIDATES
+  {
+    .name = "3x16__avx_broadcast",
+    .gemm = xnn_f32_gemm_minmax_ukernel_3x16__avx_broadcast,
+    .igemm = xnn_f32_igemm_minmax_ukernel_3x16__avx_broadcast,
+    .gemm1 = xnn_f32_gemm_minmax_ukernel_1x16__avx_broadcast,
+    .igemm1 = xnn_f32_igemm_minmax_ukernel_1x16__avx_broadcast,
+    .gemv = xnn_f32_gemm_minmax_ukernel_1x16__avx_broadcast_acc4,
+    .mr = 3, .nr = 16,
+  },
+  {
+    .name = "4x16__avx_broadcast",
+    .gemm = xnn_f32_gemm_minmax_ukernel_4x16__avx_broadcast,
+    .igemm = xnn_f32_igemm_minmax_ukernel_4x16__avx_broadcast,
+    .gemm1 = xnn_f32_gemm_minmax_ukernel_1x16__avx_broadcast,
+    .igemm1 = xnn_f32_igemm_minmax_ukernel_1x16__avx_broadcast,
+    .gemv = xnn_f32_gemm_minmax_ukernel_1x16__avx_broadcast_acc4,
+    .mr = 4, .nr = 16,
+  },
+#endif  // XNN_ENABLE_AUTOTUNE_CANDIDATES
+  {
+    .name = "5x16__avx_broadcast",
+    .gemm = xnn_f32_gemm_minmax_ukernel_5x16__avx_broadcast,
+    .igemm = xnn_f32_igemm_minmax_ukernel_5x16__avx_broadcast,
+    .gemm1 = xnn_f32_gemm_minmax_ukernel_1x16__avx_broadcast,
+    .igemm1 = xnn_f32_igemm_minmax_ukernel_1x16__avx_broadcast,
+    .gemv = xnn_f32_gemm_minmax_ukernel_1x16__avx_broadcast_acc4,
+    .mr = 5, .nr = 16,
+  },
+  { .name = NULL },
+};
+
+static const struct f32_gemm_candidate sse_candidates[] = {
+  {
+    .name = "4x8__sse_load1",
+    .gemm = xnn_f32_gemm_minmax_ukernel_4x8__sse_load1,
+    .igemm = xnn_f32_igemm_minmax_ukernel_4x8__sse_load1,
+    .gemm1 = xnn_f32_gemm_minmax_ukernel_1x8__sse_load1,
+    .igemm1 = xnn_f32_igemm_minmax_ukernel_1x8__sse_load1,
+    .gemv = xnn_f32_gemm_minmax_ukernel_1x8__sse_dup_acc4,
+    .mr = 4, .nr = 8,
+  },
+#if XNN_ENABLE_AUTOTUNE_CANDIDATES
+  {
+    .name = "4x8__sse_dup",
+    .gemm = xnn_f32_gemm_minmax_ukernel_4x8__sse_dup,
+    .igemm = xnn_f32_igemm_minmax_ukernel_4x8__sse_dup,
+    .gemm1 = xnn_f32_gemm_minmax_ukernel_1x8__sse_load1,
+    .igemm1 = xnn_f32_igemm_minmax_ukernel_1x8__sse_load1,
+    .gemv = xnn_f32_gemm_minmax_ukernel_1x8__sse_dup_acc4,
+    .mr = 4, .nr = 8,
+  },
+  {
+    .name = "4x8s4__sse",
+    .gemm = xnn_f32_gemm_minmax_ukernel_4x8s4__sse,
+    .igemm = xnn_f32_igemm_minmax_ukernel_4x8s4__sse,
+    .gemm1 = xnn_f32_gemm_minmax_ukernel_1x8s4__sse,
+    .igemm1 = xnn_f32_igemm_minmax_ukernel_1x8s4__sse,
+    .mr = 4, .nr = 8, .log2_sr = 2,
+  },
+#endif  // XNN_ENABLE_AUTOTUNE_CANDIDATES
+  { .name = NULL },
+};
+#endif  // XNN_ARCH_X86 || XNN_ARCH_X86_64
+
+static const struct f32_gemm_candidate_set candidate_sets[] = {
+#if XNN_ARCH_ARM64
+  { .name = "aarch64_neonfma", .candidates = aarch64_neonfma_candidates },
+#endif  // XNN_ARCH_ARM64
+#if XNN_ARCH_X86 || XNN_ARCH_X86_64
+  { .name = "avx512f", .candidates = avx512f_candidates },
+  { .name = "fma3", .candidates = fma3_candidates },
+  { .name = "avx", .candidates = avx_candidates },
+  { .name = "sse", .candidates = sse_candidates },
+#endif  // XNN_ARCH_X86 || XNN_ARCH_X86_64
+  { .name = NULL },
+};
+
+struct autotune_entry {
+  enum xnn_ukernel_type ukernel_type;
+  size_t group_output_channels;
+  size_t group_input_channels;
+  size_t kernel_size;
+  const struct f32_gemm_candidate* candidate;
+};
+
+// Decisions made or loaded by this process, protected by cache_lock. Benchmarking is done with the lock held, so
+// concurrent operator creation on other threads doesn't disturb the measurements.
+static struct autotune_entry* cache_entries = NULL;
+static size_t cache_num_entries = 0;
+static size_t cache_capacity = 0;
+
+#ifdef _WIN32
+  static SRWLOCK cache_lock = SRWLOCK_INIT;
+
+  static void lock_cache(void) {
+    AcquireSRWLockExclusive(&cache_lock);
+  }
+
+  static void unlock_cache(void) {
+    ReleaseSRWLockExclusive(&cache_lock);
+  }
+#else
+  static pthread_mutex_t cache_lock = PTHREAD_MUTEX_INITIALIZER;
+
+  static void lock_cache(void) {
+    pthread_mutex_lock(&cache_lock);
+  }
+
+  static void unlock_cache(void) {
+    pthread_mutex_unlock(&cache_lock);
+  }
+#endif
+
+static uint64_t read_timer_ns(void) {
+#ifdef _WIN32
+  LARGE_INTEGER counter, frequency;
+  QueryPerformanceCounter(&counter);
+  QueryPerformanceFrequency(&frequency);
+  return (uint64_t) ((double) counter.QuadPart * 1.0e+9 / (double) frequency.QuadPart);
+#else
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return (uint64_t) ts.tv_sec * UINT64_C(1000000000) + (uint64_t) ts.tv_nsec;
+#endif
+}
+
+static const struct f32_gemm_candidate_set* find_candidate_set(void) {
+  const xnn_gemm_ukernel_function default_gemm = xnn_params.f32.gemm.minmax.gemm.function[XNN_UARCH_DEFAULT];
+  if (default_gemm == NULL) {
+    return NULL;
+  }
+  #if XNN_MAX_UARCH_TYPES > 1
+    // Micro-kernels specialized for different cores of a heterogeneous processor can't be benchmarked from one thread.
+    for (size_t i = 1; i < XNN_MAX_UARCH_TYPES; i++) {
+      if (xnn_params.f32.gemm.minmax.gemm.function[i] != default_gemm) {
+        return NULL;
+      }
+    }
+  #endif  // XNN_MAX_UARCH_TYPES > 1
+
+  for (const struct f32_gemm_candidate_set* set = candidate_sets; set->name != NULL; set++) {
+    for (const struct f32_gemm_candidate* candidate = set->candidates; candidate->name != NULL; candidate++) {
+      if ((xnn_gemm_ukernel_function) candidate->gemm == default_gemm &&
+          candidate->mr == xnn_params.f32.gemm.mr && candidate->nr == xnn_params.f32.gemm.nr &&
+          candidate->log2_kr == xnn_params.f32.gemm.log2_kr && candidate->log2_sr == xnn_params.f32.gemm.log2_sr)
+      {
+        return set;
+      }
+    }
+  }
+  return NULL;
+}
+
+static const struct f32_gemm_candidate* find_candidate(
+  const struct f32_gemm_candidate_set* set,
+  const char* name)
+{
+  for (const struct f32_gemm_candidate* candidate = set->candidates; candidate->name != NULL; candidate++) {
+    if (strcmp(candidate->name, name) == 0) {
+      return candidate;
+    }
+  }
+  return NULL;
+}
+
+static struct autotune_entry* find_entry(
+  enum xnn_ukernel_type ukernel_type,
+  size_t group_output_channels,
+  size_t group_input_channels,
+  size_t kernel_size)
+{
+  for (size_t i = 0; i < cache_num_entries; i++) {
+    struct autotune_entry* entry = &cache_entries[i];
+    if (entry->ukernel_type == ukernel_type && entry->group_output_channels == group_output_channels &&
+        entry->group_input_channels == group_input_channels && entry->kernel_size == kernel_size)
+    {
+      return entry;
+    }
+  }
+  return NULL;
+}
+
+static enum xnn_status insert_entry(
+  enum xnn_ukernel_type ukernel_type,
+  size_t group_output_channels,
+  size_t group_input_channels,
+  size_t kernel_size,
+  const struct f32_gemm_candidate* candidate)
+{
+  struct autotune_entry* entry = find_entry(ukernel_type, group_output_channels, group_input_channels, kernel_size);
+  if (entry == NULL) {
+    if (cache_num_entries == cache_capacity) {
+      const size_t new_capacity = max(2 * cache_capacity, 16);
+      struct autotune_entry* new_entries =
+        xnn_reallocate_memory(cache_entries, new_capacity * sizeof(struct autotune_entry));
+      if (new_entries == NULL) {
+        xnn_log_error("failed to allocate %zu bytes for autotuning cache",
+          new_capacity * sizeof(struct autotune_entry));
+        return xnn_status_out_of_memory;
+      }
+      cache_entries = new_entries;
+      cache_capacity = new_capacity;
+    }
+    entry = &cache_entries[cache_num_entries++];
+    entry->ukernel_type = ukernel_type;
+    entry->group_output_channels = group_output_channels;
+    entry->group_input_channels = group_input_channels;
+    entry->kernel_size = kernel_size;
+  }
+  entry->candidate = candidate;
+  return xnn_status_success;
+}
+
+// Returns the fastest candidate in the set for the shape, measured in time per output row on the full reduction
+// dimension and (up to XNN_AUTOTUNE_MAX_WEIGHTS_ELEMENTS) full width of the layer. The number of rows isn't known until
+// setup, so candidates are compared on full MR-row tiles.
+static enum xnn_status benchmark_candidates(
+  const struct f32_gemm_candidate_set* set,
+  enum xnn_ukernel_type ukernel_type,
+  size_t group_output_channels,
+  size_t group_input_channels,
+  size_t kernel_size,
+  const struct f32_gemm_candidate** best_candidate_out)
+{
+  const size_t k = group_input_channels;
+  const size_t ks = ukernel_type == xnn_ukernel_type_igemm ? kernel_size : 1;
+  const size_t n = min(group_output_channels,
+    round_up_po2(max(XNN_AUTOTUNE_MAX_WEIGHTS_ELEMENTS / (ks * k), 1), 16));
+
+  size_t max_mr = 0;
+  size_t weights_size = 0;
+  for (const struct f32_gemm_candidate* candidate = set->candidates; candidate->name != NULL; candidate++) {
+    const size_t kr = UINT32_C(1) << candidate->log2_kr;
+    const size_t sr = UINT32_C(1) << candidate->log2_sr;
+    max_mr = max(max_mr, candidate->mr);
+    weights_size = max(weights_size,
+      round_up(n, candidate->nr) * (1 + ks * round_up_po2(k, kr * sr)) * sizeof(float));
+  }
+
+  const size_t input_size = max_mr * k * sizeof(float) + XNN_EXTRA_BYTES;
+  const size_t output_size = max_mr * n * sizeof(float);
+  const size_t indirection_size = ks * max_mr * sizeof(void*);
+  enum xnn_status status = xnn_status_out_of_memory;
+  void* weights = xnn_allocate_zero_simd_memory(weights_size);
+  float* input = xnn_allocate_zero_simd_memory(input_size);
+  float* output = xnn_allocate_simd_memory(output_size);
+  const float** indirection = xnn_allocate_memory(indirection_size);
+  if (weights == NULL || input == NULL || output == NULL || indirection == NULL) {
+    xnn_log_error("failed to allocate %zu bytes for autotuning buffers",
+      weights_size + input_size + output_size + indirection_size);
+    goto cleanup;
+  }
+
+  union xnn_f32_minmax_params params;
+  xnn_params.f32.gemm.init.f32(&params, -INFINITY, INFINITY);
+
+  const struct f32_gemm_candidate* best_candidate = NULL;
+  double best_time = 0.0;
+  for (const struct f32_gemm_candidate* candidate = set->candidates; candidate->name != NULL; candidate++) {
+    const size_t mr = candidate->mr;
+    for (size_t i = 0; i < ks * mr; i++) {
+      indirection[i] = input + (i % mr) * k;
+    }
+
+    const size_t num_rows = round_up(XNN_AUTOTUNE_ROWS, mr);
+    double candidate_time = 0.0;
+    for (size_t iteration = 0; iteration <= XNN_AUTOTUNE_REPETITIONS; iteration++) {
+      const uint64_t start = read_timer_ns();
+      for (size_t m = 0; m < num_rows; m += mr) {
+        if (ukernel_type == xnn_ukernel_type_igemm) {
+          candidate->igemm(
+            mr, n, k * sizeof(float), ks * mr * sizeof(void*), indirection, weights, output,
+            n * sizeof(float), candidate->nr * sizeof(float), 0, input, &params);
+        } else {
+          candidate->gemm(
+            mr, n, k * sizeof(float), input, k * sizeof(float), weights, output,
+            n * sizeof(float), candidate->nr * sizeof(float), &params);
+        }
+      }
+      const double time = (double) (read_timer_ns() - start) / (double) num_rows;
+      // The first iteration warms up caches and is not counted.
+      if (iteration == 1 || (iteration > 1 && time < candidate_time)) {
+        candidate_time = time;
+      }
+    }
+    xnn_log_debug("autotuning %s with %zu output channels, %zu input channels, %zu kernel size: %s takes %.1f ns/row",
+      ukernel_type == xnn_ukernel_type_igemm ? "IGEMM" : "GEMM",
+      group_output_channels, group_input_channels, ks, candidate->name, candidate_time);
+
+    if (best_candidate == NULL || candidate_time < best_time) {
+      best_candidate = candidate;
+      best_time = candidate_time;
+    }
+  }
+
+  *best_candidate_out = best_candidate;
+  status = xnn_status_success;
+
+cleanup:
+  xnn_release_simd_memory(weights);
+  xnn_release_simd_memory(input);
+  xnn_release_simd_memory(output);
+  xnn_release_memory(indirection);
+  return status;
+}
+
+static void init_gemm_parameters(
+  const struct f32_gemm_candidate* candidate,
+  struct gemm_parameters* gemm_parameters)
+{
+  if ((xnn_gemm_ukernel_function) candidate->gemm == xnn_params.f32.gemm.minmax.gemm.function[XNN_UARCH_DEFAULT] &&
+      candidate->mr == xnn_params.f32.gemm.mr && candidate->log2_sr == xnn_params.f32.gemm.log2_sr)
+  {
+    // Keep the linear and ReLU variants and JIT generators of the default micro-kernel.
+    *gemm_parameters = xnn_params.f32.gemm;
+    return;
+  }
+
+  memset(gemm_parameters, 0, sizeof(struct gemm_parameters));
+  gemm_parameters->minmax.gemm = xnn_init_hmp_gemm_ukernel((xnn_gemm_ukernel_function) candidate->gemm);
+  gemm_parameters->minmax.igemm = xnn_init_hmp_igemm_ukernel((xnn_igemm_ukernel_function) candidate->igemm);
+  gemm_parameters->minmax.gemm1 = xnn_init_hmp_gemm_ukernel((xnn_gemm_ukernel_function) candidate->gemm1);
+  gemm_parameters->minmax.igemm1 = xnn_init_hmp_igemm_ukernel((xnn_igemm_ukernel_function) candidate->igemm1);
+  if (candidate->gemv != NULL) {
+    gemm_parameters->minmax.gemv = xnn_init_hmp_gemm_ukernel((xnn_gemm_ukernel_function) candidate->gemv);
+  }
+  gemm_parameters->init.f32 = xnn_params.f32.gemm.init.f32;
+  gemm_parameters->mr = candidate->mr;
+  gemm_parameters->nr = candidate->nr;
+  gemm_parameters->log2_kr = candidate->log2_kr;
+  gemm_parameters->log2_sr = candidate->log2_sr;
+}
+
+enum xnn_status xnn_autotune_f32_gemm(
+  enum xnn_ukernel_type ukernel_type,
+  size_t group_output_channels,
+  size_t group_input_channels,
+  size_t kernel_size,
+  struct gemm_parameters* gemm_parameters_out)
+{
+  assert(ukernel_type == xnn_ukernel_type_gemm || ukernel_type == xnn_ukernel_type_igemm);
+  assert(group_output_channels != 0);
+  assert(group_input_channels != 0);
+  assert(kernel_size != 0);
+
+  const struct f32_gemm_candidate_set* set = find_candidate_set();
+  if (set == NULL || set->candidates[1].name == NULL) {
+    // No alternatives to the default micro-kernel on this processor.
+    *gemm_parameters_out = xnn_params.f32.gemm;
+    return xnn_status_success;
+  }
+  if (ukernel_type == xnn_ukernel_type_gemm) {
+    kernel_size = 1;
+  }
+
+  lock_cache();
+  enum xnn_status status = xnn_status_success;
+  const struct autotune_entry* entry =
+    find_entry(ukernel_type, group_output_channels, group_input_channels, kernel_size);
+  const struct f32_gemm_candidate* candidate = entry != NULL ? entry->candidate : NULL;
+  if (candidate == NULL) {
+    status = benchmark_candidates(
+      set, ukernel_type, group_output_channels, group_input_channels, kernel_size, &candidate);
+    if (status == xnn_status_success) {
+      xnn_log_info("autotuning selected %s micro-kernel for %zu output channels, %zu input channels, %zu kernel size",
+        candidate->name, group_output_channels, group_input_channels, kernel_size);
+      status = insert_entry(ukernel_type, group_output_channels, group_input_channels, kernel_size, candidate);
+    }
+  }
+  unlock_cache();
+  if (status != xnn_status_success) {
+    return status;
+  }
+
+  init_gemm_parameters(candidate, gemm_parameters_out);
+  return xnn_status_success;
+}
+
+enum xnn_status xnn_save_autotuning_cache(const char* path)
+{
+  if ((xnn_params.init_flags & XNN_INIT_FLAG_XNNPACK) == 0) {
+    xnn_log_error("failed to save autotuning cache: XNNPACK is not initialized");
+    return xnn_status_uninitialized;
+  }
+
+  FILE* file = fopen(path, "w");
+  if (file == NULL) {
+    xnn_log_error("failed to save autotuning cache: can not open %s for writing", path);
+    return xnn_status_invalid_parameter;
+  }
+
+  const struct f32_gemm_candidate_set* set = find_candidate_set();
+  bool success = fprintf(file, "%s %d %s\n",
+    XNN_AUTOTUNE_CACHE_MAGIC, XNN_AUTOTUNE_CACHE_VERSION, set != NULL ? set->name : "none") > 0;
+  lock_cache();
+  for (size_t i = 0; success && i < cache_num_entries; i++) {
+    const struct autotune_entry* entry = &cache_entries[i];
+    success = fprintf(file, "%s %zu %zu %zu %s\n",
+      entry->ukernel_type == xnn_ukernel_type_igemm ? "igemm" : "gemm",
+      entry->group_output_channels, entry->group_input_channels, entry->kernel_size, entry->candidate->name) > 0;
+  }
+  unlock_cache();
+  if (fclose(file) != 0) {
+    success = false;
+  }
+  if (!success) {
+    xnn_log_error("failed to save autotuning cache: error writing %s", path);
+    return xnn_status_invalid_parameter;
+  }
+  return xnn_status_success;
+}
+
+enum xnn_status xnn_load_autotuning_cache(const char* path)
+{
+  if ((xnn_params.init_flags & XNN_INIT_FLAG_XNNPACK) == 0) {
+    xnn_log_error("failed to load autotuning cache: XNNPACK is not initialized");
+    return xnn_status_uninitialized;
+  }
+
+  FILE* file = fopen(path, "r");
+  if (file == NULL) {
+    xnn_log_error("failed to load autotuning cache: can not open %s for reading", path);
+    return xnn_status_invalid_parameter;
+  }
+
+  enum xnn_status status = xnn_status_invalid_parameter;
+  char magic[32];
+  int version = 0;
+  char set_name[32];
+  if (fscanf(file, "%31s %d %31s", magic, &version, set_name) != 3 ||
+      strcmp(magic, XNN_AUTOTUNE_CACHE_MAGIC) != 0 || version != XNN_AUTOTUNE_CACHE_VERSION)
+  {
+    xnn_log_error("failed to load autotuning cache: %s is not an autotuning cache", path);
+    goto cleanup;
+  }
+
+  const struct f32_gemm_candidate_set* set = find_candidate_set();
+  if (set == NULL || strcmp(set->name, set_name) != 0) {
+    xnn_log_warning("ignored autotuning cache %s: saved for %s micro-kernels, but this processor uses %s",
+      path, set_name, set != NULL ? set->name : "none");
+    status = xnn_status_success;
+    goto cleanup;
+  }
+
+  lock_cache();
+  status = xnn_status_success;
+  for (;;) {
+    char type_name[8];
+    size_t group_output_channels = 0;
+    size_t group_input_channels = 0;
+    size_t kernel_size = 0;
+    char candidate_name[64];
+    const int num_fields = fscanf(file, "%7s %zu %zu %zu %63s",
+      type_name, &group_output_channels, &group_input_channels, &kernel_size, candidate_name);
+    if (num_fields == EOF) {
+      break;
+    }
+
+    const bool is_gemm = strcmp(type_name, "gemm") == 0;
+    const bool is_igemm = strcmp(type_name, "igemm") == 0;
+    if (num_fields != 5 || !(is_gemm || is_igemm) ||
+        group_output_channels == 0 || group_input_channels == 0 || kernel_size == 0)
+    {
+      xnn_log_error("failed to load autotuning cache: malformed entry in %s", path);
+      status = xnn_status_invalid_parameter;
+      break;
+    }
+
+    const struct f32_gemm_candidate* candidate = find_candidate(set, candidate_name);
+    if (candidate == NULL) {
+      xnn_log_warning("ignored autotuning cache entry with unknown %s micro-kernel", candidate_name);
+      continue;
+    }
+    status = insert_entry(
+      is_igemm ? xnn_ukernel_type_igemm : xnn_ukernel_type_gemm,
+      group_output_channels, group_input_channels, kernel_size, candidate);
+    if (status != xnn_status_success) {
+      break;
+    }
+  }
+  unlock_cache();
+
+cleanup:
+  fclose(file);
+  return status;
+}
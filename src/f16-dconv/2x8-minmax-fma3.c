@@ -0,0 +1,150 @@
+// Copyright 2022 Google LLC
+//
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree.
+
+#include <assert.h>
+
+#include <immintrin.h>
+
+#include <xnnpack/conv.h>
+#include <xnnpack/intrinsics-polyfill.h>
+#include <xnnpack/math.h>
+
+
+void xnn_f16_dconv_minmax_ukernel_2x8__fma3(
+    size_t output_width,
+    size_t output_channels,
+    size_t kernel_height,
+    size_t kernel_width,
+    size_t input_channels,
+    size_t input_width,
+    size_t input_pixel_stride,
+    size_t subsampling,
+    size_t padding_left,
+    const void** input,
+    size_t input_offset,
+    const void* zero,
+    const void* weights,
+    void* output,
+    size_t output_pixel_stride,
+    const union xnn_f16_minmax_params params[restrict XNN_MIN_ELEMENTS(1)])
+{
+  assert(output_width != 0);
+  assert(output_channels != 0);
+  assert(kernel_height != 0);
+  assert(kernel_width != 0);
+  assert(input_channels != 0);
+  assert(input_channels % sizeof(uint16_t) == 0);
+  assert(subsampling != 0);
+  assert(input != NULL);
+  assert(weights != NULL);
+  assert(output != NULL);
+
+  const __m256 vmin = _mm256_load_ps(params->avx.min);
+  const __m256 vmax = _mm256_load_ps(params->avx.max);
+  // Weights of every block of output channels: 8 biases followed by 8 weights for every kernel element and channel.
+  const size_t w_stride = 8 * (1 + kernel_height * kernel_width * (input_channels / sizeof(uint16_t)));
+  const uint16_t* w_block = (const uint16_t*) weights;
+  uint16_t* o = (uint16_t*) output;
+  do {
+    uint16_t* o0 = o;
+    // Input column of the first kernel element for the first output pixel in a tile; wraps around below zero.
+    size_t ix0 = -padding_left;
+    size_t n = output_width;
+    do {
+      // The last tile of an odd number of pixels computes (and stores) its only pixel twice.
+      const size_t ix1 = n >= 2 ? ix0 + subsampling : ix0;
+      uint16_t* o1 = n >= 2 ? (uint16_t*) ((uintptr_t) o0 + output_pixel_stride) : o0;
+
+      const uint16_t* w = w_block;
+      __m256 vacc0x01234567 = _mm256_cvtph_ps(_mm_load_si128((const __m128i*) w));
+      __m256 vacc1x01234567 = vacc0x01234567;
+      w += 8;
+
+      const void** i = input;
+      size_t ky = kernel_height;
+      do {
+        const void* row = *i++;
+        assert(row != NULL);
+        const bool is_padding_row = row == zero;
+        row = (const void*) ((uintptr_t) row + input_offset);
+
+        size_t kx = 0;
+        do {
+          const uint16_t* i0 = (const uint16_t*) zero;
+          if XNN_LIKELY(!is_padding_row && ix0 + kx < input_width) {
+            i0 = (const uint16_t*) ((uintptr_t) row + (ix0 + kx) * input_pixel_stride);
+          }
+          const uint16_t* i1 = (const uint16_t*) zero;
+          if XNN_LIKELY(!is_padding_row && ix1 + kx < input_width) {
+            i1 = (const uint16_t*) ((uintptr_t) row + (ix1 + kx) * input_pixel_stride);
+          }
+
+          size_t k = input_channels;
+          do {
+            const __m256 vi0 = _mm256_cvtph_ps(_mm_set1_epi16((short) *i0));
+            i0 += 1;
+            const __m256 vi1 = _mm256_cvtph_ps(_mm_set1_epi16((short) *i1));
+            i1 += 1;
+
+            const __m256 vw01234567 = _mm256_cvtph_ps(_mm_load_si128((const __m128i*) w));
+            w += 8;
+
+            vacc0x01234567 = _mm256_cvtph_ps(_mm256_cvtps_ph(_mm256_fmadd_ps(vi0, vw01234567, vacc0x01234567), _MM_FROUND_NO_EXC));
+            vacc1x01234567 = _mm256_cvtph_ps(_mm256_cvtps_ph(_mm256_fmadd_ps(vi1, vw01234567, vacc1x01234567), _MM_FROUND_NO_EXC));
+
+            k -= sizeof(uint16_t);
+          } while (k != 0);
+        } while (++kx != kernel_width);
+      } while (--ky != 0);
+
+      vacc0x01234567 = _mm256_max_ps(vacc0x01234567, vmin);
+      vacc1x01234567 = _mm256_max_ps(vacc1x01234567, vmin);
+
+      vacc0x01234567 = _mm256_min_ps(vacc0x01234567, vmax);
+      vacc1x01234567 = _mm256_min_ps(vacc1x01234567, vmax);
+
+      __m128i vh0x01234567 = _mm256_cvtps_ph(vacc0x01234567, _MM_FROUND_NO_EXC);
+      __m128i vh1x01234567 = _mm256_cvtps_ph(vacc1x01234567, _MM_FROUND_NO_EXC);
+      if XNN_LIKELY(output_channels >= 8) {
+        _mm_storeu_si128((__m128i*) o1, vh1x01234567);
+        _mm_storeu_si128((__m128i*) o0, vh0x01234567);
+      } else {
+        uint16_t* c1 = o1;
+        uint16_t* c0 = o0;
+        if (output_channels & 4) {
+          _mm_storel_epi64((__m128i*) c1, vh1x01234567);
+          _mm_storel_epi64((__m128i*) c0, vh0x01234567);
+
+          vh1x01234567 = _mm_unpackhi_epi64(vh1x01234567, vh1x01234567);
+          vh0x01234567 = _mm_unpackhi_epi64(vh0x01234567, vh0x01234567);
+
+          c1 += 4;
+          c0 += 4;
+        }
+        if (output_channels & 2) {
+          _mm_storeu_si32(c1, vh1x01234567);
+          _mm_storeu_si32(c0, vh0x01234567);
+
+          vh1x01234567 = _mm_srli_epi64(vh1x01234567, 32);
+          vh0x01234567 = _mm_srli_epi64(vh0x01234567, 32);
+
+          c1 += 2;
+          c0 += 2;
+        }
+        if (output_channels & 1) {
+          *c1 = (uint16_t) _mm_extract_epi16(vh1x01234567, 0);
+          *c0 = (uint16_t) _mm_extract_epi16(vh0x01234567, 0);
+        }
+      }
+      o0 = (uint16_t*) ((uintptr_t) o1 + output_pixel_stride);
+      ix0 = ix1 + subsampling;
+      n = doz(n, 2);
+    } while (n != 0);
+
+    w_block += w_stride;
+    o += 8;
+    output_channels = doz(output_channels, 8);
+  } while (output_channels != 0);
+}
@@ -0,0 +1,182 @@
+// Copyright 2022 Google LLC
+//
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree.
+
+#include <assert.h>
+
+#include <immintrin.h>
+
+#include <xnnpack/intrinsics-polyfill.h>
+#include <xnnpack/pavgpool.h>
+
+
+void xnn_f16_pavgpool_minmax_ukernel_9x__avx512skx_c16(
+    size_t output_pixels,
+    size_t kernel_elements,
+    size_t channels,
+    const void** input,
+    size_t input_offset,
+    const void* zero,
+    const void* multiplier,
+    void* output_ptr,
+    size_t input_increment,
+    size_t output_increment,
+    const union xnn_f16_minmax_params params[restrict XNN_MIN_ELEMENTS(1)]) XNN_OOB_READS
+{
+  assert(output_pixels != 0);
+  assert(kernel_elements != 0);
+  assert(kernel_elements <= 9);
+  assert(channels != 0);
+
+  const __m512 voutput_min = _mm512_broadcast_f32x8(_mm256_load_ps(params->avx.min));
+  const __m512 voutput_max = _mm512_broadcast_f32x8(_mm256_load_ps(params->avx.max));
+  // Prepare mask for the valid 16-bit elements of the remainder (depends on channels).
+  const __mmask16 vmask = _cvtu32_mask16((uint16_t) ((uint32_t) (UINT32_C(1) << (channels & 15)) - UINT32_C(1)));
+
+  const uint16_t* m = (const uint16_t*) multiplier;
+  uint16_t* output = (uint16_t*) output_ptr;
+  do {
+    const uint16_t* i0 = (const uint16_t*) input[0];
+    assert(i0 != NULL);
+    const uint16_t* i1 = (const uint16_t*) input[1];
+    const uint16_t* i2 = (const uint16_t*) input[2];
+    const uint16_t* i3 = (const uint16_t*) input[3];
+    const uint16_t* i4 = (const uint16_t*) input[4];
+    const uint16_t* i5 = (const uint16_t*) input[5];
+    const uint16_t* i6 = (const uint16_t*) input[6];
+    const uint16_t* i7 = (const uint16_t*) input[7];
+    const uint16_t* i8 = (const uint16_t*) input[8];
+    input = (const void**) ((uintptr_t) input + input_increment);
+    if (kernel_elements < 2) {
+      i1 = (const uint16_t*) zero;
+    }
+    assert(i1 != NULL);
+    if (kernel_elements <= 2) {
+      i2 = (const uint16_t*) zero;
+    }
+    assert(i2 != NULL);
+    if (kernel_elements < 4) {
+      i3 = (const uint16_t*) zero;
+    }
+    assert(i3 != NULL);
+    if (kernel_elements <= 4) {
+      i4 = (const uint16_t*) zero;
+    }
+    assert(i4 != NULL);
+    if (kernel_elements < 6) {
+      i5 = (const uint16_t*) zero;
+    }
+    assert(i5 != NULL);
+    if (kernel_elements <= 6) {
+      i6 = (const uint16_t*) zero;
+    }
+    assert(i6 != NULL);
+    if (kernel_elements < 8) {
+      i7 = (const uint16_t*) zero;
+    }
+    assert(i7 != NULL);
+    if (kernel_elements <= 8) {
+      i8 = (const uint16_t*) zero;
+    }
+    assert(i8 != NULL);
+    if XNN_UNPREDICTABLE(i0 != (const uint16_t*) zero) {
+      i0 = (const uint16_t*) ((uintptr_t) i0 + input_offset);
+    }
+    if XNN_UNPREDICTABLE(i1 != (const uint16_t*) zero) {
+      i1 = (const uint16_t*) ((uintptr_t) i1 + input_offset);
+    }
+    if XNN_UNPREDICTABLE(i2 != (const uint16_t*) zero) {
+      i2 = (const uint16_t*) ((uintptr_t) i2 + input_offset);
+    }
+    if XNN_UNPREDICTABLE(i3 != (const uint16_t*) zero) {
+      i3 = (const uint16_t*) ((uintptr_t) i3 + input_offset);
+    }
+    if XNN_UNPREDICTABLE(i4 != (const uint16_t*) zero) {
+      i4 = (const uint16_t*) ((uintptr_t) i4 + input_offset);
+    }
+    if XNN_UNPREDICTABLE(i5 != (const uint16_t*) zero) {
+      i5 = (const uint16_t*) ((uintptr_t) i5 + input_offset);
+    }
+    if XNN_UNPREDICTABLE(i6 != (const uint16_t*) zero) {
+      i6 = (const uint16_t*) ((uintptr_t) i6 + input_offset);
+    }
+    if XNN_UNPREDICTABLE(i7 != (const uint16_t*) zero) {
+      i7 = (const uint16_t*) ((uintptr_t) i7 + input_offset);
+    }
+    if XNN_UNPREDICTABLE(i8 != (const uint16_t*) zero) {
+      i8 = (const uint16_t*) ((uintptr_t) i8 + input_offset);
+    }
+
+    const __m512 vmultiplier = _mm512_cvtph_ps(_mm256_set1_epi16((short) *m));
+    m += 1;
+
+    size_t c = channels;
+    for (; c >= 16; c -= 16) {
+      const __m512 vi0 = _mm512_cvtph_ps(_mm256_loadu_si256((const __m256i*) i0));
+      i0 += 16;
+      const __m512 vi1 = _mm512_cvtph_ps(_mm256_loadu_si256((const __m256i*) i1));
+      i1 += 16;
+      const __m512 vi2 = _mm512_cvtph_ps(_mm256_loadu_si256((const __m256i*) i2));
+      i2 += 16;
+      const __m512 vi3 = _mm512_cvtph_ps(_mm256_loadu_si256((const __m256i*) i3));
+      i3 += 16;
+      const __m512 vi4 = _mm512_cvtph_ps(_mm256_loadu_si256((const __m256i*) i4));
+      i4 += 16;
+      const __m512 vi5 = _mm512_cvtph_ps(_mm256_loadu_si256((const __m256i*) i5));
+      i5 += 16;
+      const __m512 vi6 = _mm512_cvtph_ps(_mm256_loadu_si256((const __m256i*) i6));
+      i6 += 16;
+      const __m512 vi7 = _mm512_cvtph_ps(_mm256_loadu_si256((const __m256i*) i7));
+      i7 += 16;
+      const __m512 vi8 = _mm512_cvtph_ps(_mm256_loadu_si256((const __m256i*) i8));
+      i8 += 16;
+
+      __m256i vacc = _mm512_cvtps_ph(_mm512_add_ps(vi0, vi1), _MM_FROUND_NO_EXC);
+      vacc = _mm512_cvtps_ph(_mm512_add_ps(_mm512_cvtph_ps(vacc), vi2), _MM_FROUND_NO_EXC);
+      vacc = _mm512_cvtps_ph(_mm512_add_ps(_mm512_cvtph_ps(vacc), vi3), _MM_FROUND_NO_EXC);
+      vacc = _mm512_cvtps_ph(_mm512_add_ps(_mm512_cvtph_ps(vacc), vi4), _MM_FROUND_NO_EXC);
+      vacc = _mm512_cvtps_ph(_mm512_add_ps(_mm512_cvtph_ps(vacc), vi5), _MM_FROUND_NO_EXC);
+      vacc = _mm512_cvtps_ph(_mm512_add_ps(_mm512_cvtph_ps(vacc), vi6), _MM_FROUND_NO_EXC);
+      vacc = _mm512_cvtps_ph(_mm512_add_ps(_mm512_cvtph_ps(vacc), vi7), _MM_FROUND_NO_EXC);
+      vacc = _mm512_cvtps_ph(_mm512_add_ps(_mm512_cvtph_ps(vacc), vi8), _MM_FROUND_NO_EXC);
+
+      vacc = _mm512_cvtps_ph(_mm512_mul_ps(_mm512_cvtph_ps(vacc), vmultiplier), _MM_FROUND_NO_EXC);
+
+      __m512 vout = _mm512_max_ps(_mm512_cvtph_ps(vacc), voutput_min);
+      vout = _mm512_min_ps(vout, voutput_max);
+
+      _mm256_storeu_si256((__m256i*) output, _mm512_cvtps_ph(vout, _MM_FROUND_NO_EXC));
+      output += 16;
+    }
+    if XNN_UNLIKELY(c != 0) {
+      const __m512 vi0 = _mm512_cvtph_ps(_mm256_maskz_loadu_epi16(vmask, i0));
+      const __m512 vi1 = _mm512_cvtph_ps(_mm256_maskz_loadu_epi16(vmask, i1));
+      const __m512 vi2 = _mm512_cvtph_ps(_mm256_maskz_loadu_epi16(vmask, i2));
+      const __m512 vi3 = _mm512_cvtph_ps(_mm256_maskz_loadu_epi16(vmask, i3));
+      const __m512 vi4 = _mm512_cvtph_ps(_mm256_maskz_loadu_epi16(vmask, i4));
+      const __m512 vi5 = _mm512_cvtph_ps(_mm256_maskz_loadu_epi16(vmask, i5));
+      const __m512 vi6 = _mm512_cvtph_ps(_mm256_maskz_loadu_epi16(vmask, i6));
+      const __m512 vi7 = _mm512_cvtph_ps(_mm256_maskz_loadu_epi16(vmask, i7));
+      const __m512 vi8 = _mm512_cvtph_ps(_mm256_maskz_loadu_epi16(vmask, i8));
+
+      __m256i vacc = _mm512_cvtps_ph(_mm512_add_ps(vi0, vi1), _MM_FROUND_NO_EXC);
+      vacc = _mm512_cvtps_ph(_mm512_add_ps(_mm512_cvtph_ps(vacc), vi2), _MM_FROUND_NO_EXC);
+      vacc = _mm512_cvtps_ph(_mm512_add_ps(_mm512_cvtph_ps(vacc), vi3), _MM_FROUND_NO_EXC);
+      vacc = _mm512_cvtps_ph(_mm512_add_ps(_mm512_cvtph_ps(vacc), vi4), _MM_FROUND_NO_EXC);
+      vacc = _mm512_cvtps_ph(_mm512_add_ps(_mm512_cvtph_ps(vacc), vi5), _MM_FROUND_NO_EXC);
+      vacc = _mm512_cvtps_ph(_mm512_add_ps(_mm512_cvtph_ps(vacc), vi6), _MM_FROUND_NO_EXC);
+      vacc = _mm512_cvtps_ph(_mm512_add_ps(_mm512_cvtph_ps(vacc), vi7), _MM_FROUND_NO_EXC);
+      vacc = _mm512_cvtps_ph(_mm512_add_ps(_mm512_cvtph_ps(vacc), vi8), _MM_FROUND_NO_EXC);
+
+      vacc = _mm512_cvtps_ph(_mm512_mul_ps(_mm512_cvtph_ps(vacc), vmultiplier), _MM_FROUND_NO_EXC);
+
+      __m512 vout = _mm512_max_ps(_mm512_cvtph_ps(vacc), voutput_min);
+      vout = _mm512_min_ps(vout, voutput_max);
+
+      _mm256_mask_storeu_epi16(output, vmask, _mm512_cvtps_ph(vout, _MM_FROUND_NO_EXC));
+      output += c;
+    }
+    output = (uint16_t*) ((uintptr_t) output + output_increment);
+  } while (--output_pixels != 0);
+}
@@ -0,0 +1,125 @@
+// Copyright 2022 Google LLC
+//
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree.
+
+#include <assert.h>
+
+#include <xnnpack/conv.h>
+#include <xnnpack/math.h>
+
+
+void xnn_f32_dconv_minmax_ukernel_1x4__scalar(
+    size_t output_width,
+    size_t output_channels,
+    size_t kernel_height,
+    size_t kernel_width,
+    size_t input_channels,
+    size_t input_width,
+    size_t input_pixel_stride,
+    size_t subsampling,
+    size_t padding_left,
+    const float** input,
+    size_t input_offset,
+    const float* zero,
+    const float* weights,
+    float* output,
+    size_t output_pixel_stride,
+    const union xnn_f32_minmax_params params[restrict XNN_MIN_ELEMENTS(1)])
+{
+  assert(output_width != 0);
+  assert(output_channels != 0);
+  assert(kernel_height != 0);
+  assert(kernel_width != 0);
+  assert(input_channels != 0);
+  assert(input_channels % sizeof(float) == 0);
+  assert(subsampling != 0);
+  assert(input != NULL);
+  assert(weights != NULL);
+  assert(output != NULL);
+
+  const float vmin = params->scalar.min;
+  const float vmax = params->scalar.max;
+  // Weights of every block of output channels: 4 biases followed by 4 weights for every kernel element and channel.
+  const size_t w_stride = 4 * (1 + kernel_height * kernel_width * (input_channels / sizeof(float)));
+  do {
+    float* o0 = output;
+    // Input column of the first kernel element for the current output pixel; wraps around below zero.
+    size_t ix0 = -padding_left;
+    size_t n = output_width;
+    do {
+      const float* w = weights;
+      float vacc0 = w[0];
+      float vacc1 = w[1];
+      float vacc2 = w[2];
+      float vacc3 = w[3];
+      w += 4;
+
+      const float** i = input;
+      size_t ky = kernel_height;
+      do {
+        const float* row = *i++;
+        assert(row != NULL);
+        const bool is_padding_row = row == zero;
+        row = (const float*) ((uintptr_t) row + input_offset);
+
+        size_t ix = ix0;
+        size_t kx = kernel_width;
+        do {
+          const float* i0 = zero;
+          if XNN_LIKELY(!is_padding_row && ix < input_width) {
+            i0 = (const float*) ((uintptr_t) row + ix * input_pixel_stride);
+          }
+          ix += 1;
+
+          size_t k = input_channels;
+          do {
+            const float vi0 = *i0++;
+
+            vacc0 = math_muladd_f32(vi0, w[0], vacc0);
+            vacc1 = math_muladd_f32(vi0, w[1], vacc1);
+            vacc2 = math_muladd_f32(vi0, w[2], vacc2);
+            vacc3 = math_muladd_f32(vi0, w[3], vacc3);
+            w += 4;
+
+            k -= sizeof(float);
+          } while (k != 0);
+        } while (--kx != 0);
+      } while (--ky != 0);
+
+      vacc0 = math_max_f32(vacc0, vmin);
+      vacc1 = math_max_f32(vacc1, vmin);
+      vacc2 = math_max_f32(vacc2, vmin);
+      vacc3 = math_max_f32(vacc3, vmin);
+
+      vacc0 = math_min_f32(vacc0, vmax);
+      vacc1 = math_min_f32(vacc1, vmax);
+      vacc2 = math_min_f32(vacc2, vmax);
+      vacc3 = math_min_f32(vacc3, vmax);
+
+      if XNN_LIKELY(output_channels >= 4) {
+        o0[0] = vacc0;
+        o0[1] = vacc1;
+        o0[2] = vacc2;
+        o0[3] = vacc3;
+      } else {
+        float* o = o0;
+        if (output_channels & 2) {
+          o[0] = vacc0;
+          o[1] = vacc1;
+          vacc0 = vacc2;
+          o += 2;
+        }
+        if (output_channels & 1) {
+          o[0] = vacc0;
+        }
+      }
+      o0 = (float*) ((uintptr_t) o0 + output_pixel_stride);
+      ix0 += subsampling;
+    } while (--n != 0);
+
+    weights += w_stride;
+    output += 4;
+    output_channels = doz(output_channels, 4);
+  } while (output_channels != 0);
+}
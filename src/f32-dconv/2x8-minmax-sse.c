@@ -0,0 +1,156 @@
+// Copyright 2022 Google LLC
+//
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree.
+
+#include <assert.h>
+
+#include <xmmintrin.h>
+
+#include <xnnpack/conv.h>
+#include <xnnpack/math.h>
+
+
+void xnn_f32_dconv_minmax_ukernel_2x8__sse(
+    size_t output_width,
+    size_t output_channels,
+    size_t kernel_height,
+    size_t kernel_width,
+    size_t input_channels,
+    size_t input_width,
+    size_t input_pixel_stride,
+    size_t subsampling,
+    size_t padding_left,
+    const float** input,
+    size_t input_offset,
+    const float* zero,
+    const float* weights,
+    float* output,
+    size_t output_pixel_stride,
+    const union xnn_f32_minmax_params params[restrict XNN_MIN_ELEMENTS(1)])
+{
+  assert(output_width != 0);
+  assert(output_channels != 0);
+  assert(kernel_height != 0);
+  assert(kernel_width != 0);
+  assert(input_channels != 0);
+  assert(input_channels % sizeof(float) == 0);
+  assert(subsampling != 0);
+  assert(input != NULL);
+  assert(weights != NULL);
+  assert(output != NULL);
+
+  const __m128 vmin = _mm_load_ps(params->sse.min);
+  const __m128 vmax = _mm_load_ps(params->sse.max);
+  // Weights of every block of output channels: 8 biases followed by 8 weights for every kernel element and channel.
+  const size_t w_stride = 8 * (1 + kernel_height * kernel_width * (input_channels / sizeof(float)));
+  do {
+    float* o0 = output;
+    // Input column of the first kernel element for the first output pixel in a tile; wraps around below zero.
+    size_t ix0 = -padding_left;
+    size_t n = output_width;
+    do {
+      // The last tile of an odd number of pixels computes (and stores) its only pixel twice.
+      const size_t ix1 = n >= 2 ? ix0 + subsampling : ix0;
+      float* o1 = n >= 2 ? (float*) ((uintptr_t) o0 + output_pixel_stride) : o0;
+
+      const float* w = weights;
+      __m128 vacc0x0123 = _mm_loadu_ps(w);
+      __m128 vacc0x4567 = _mm_loadu_ps(w + 4);
+      __m128 vacc1x0123 = vacc0x0123;
+      __m128 vacc1x4567 = vacc0x4567;
+      w += 8;
+
+      const float** i = input;
+      size_t ky = kernel_height;
+      do {
+        const float* row = *i++;
+        assert(row != NULL);
+        const bool is_padding_row = row == zero;
+        row = (const float*) ((uintptr_t) row + input_offset);
+
+        size_t kx = 0;
+        do {
+          const float* i0 = zero;
+          if XNN_LIKELY(!is_padding_row && ix0 + kx < input_width) {
+            i0 = (const float*) ((uintptr_t) row + (ix0 + kx) * input_pixel_stride);
+          }
+          const float* i1 = zero;
+          if XNN_LIKELY(!is_padding_row && ix1 + kx < input_width) {
+            i1 = (const float*) ((uintptr_t) row + (ix1 + kx) * input_pixel_stride);
+          }
+
+          size_t k = input_channels;
+          do {
+            const __m128 vi0 = _mm_load1_ps(i0);
+            i0 += 1;
+            const __m128 vi1 = _mm_load1_ps(i1);
+            i1 += 1;
+
+            const __m128 vw0123 = _mm_loadu_ps(w);
+            const __m128 vw4567 = _mm_loadu_ps(w + 4);
+            w += 8;
+
+            vacc0x0123 = _mm_add_ps(vacc0x0123, _mm_mul_ps(vi0, vw0123));
+            vacc0x4567 = _mm_add_ps(vacc0x4567, _mm_mul_ps(vi0, vw4567));
+            vacc1x0123 = _mm_add_ps(vacc1x0123, _mm_mul_ps(vi1, vw0123));
+            vacc1x4567 = _mm_add_ps(vacc1x4567, _mm_mul_ps(vi1, vw4567));
+
+            k -= sizeof(float);
+          } while (k != 0);
+        } while (++kx != kernel_width);
+      } while (--ky != 0);
+
+      vacc0x0123 = _mm_min_ps(vacc0x0123, vmax);
+      vacc0x4567 = _mm_min_ps(vacc0x4567, vmax);
+      vacc1x0123 = _mm_min_ps(vacc1x0123, vmax);
+      vacc1x4567 = _mm_min_ps(vacc1x4567, vmax);
+
+      vacc0x0123 = _mm_max_ps(vacc0x0123, vmin);
+      vacc0x4567 = _mm_max_ps(vacc0x4567, vmin);
+      vacc1x0123 = _mm_max_ps(vacc1x0123, vmin);
+      vacc1x4567 = _mm_max_ps(vacc1x4567, vmin);
+
+      if XNN_LIKELY(output_channels >= 8) {
+        _mm_storeu_ps(o1, vacc1x0123);
+        _mm_storeu_ps(o1 + 4, vacc1x4567);
+        _mm_storeu_ps(o0, vacc0x0123);
+        _mm_storeu_ps(o0 + 4, vacc0x4567);
+      } else {
+        float* c1 = o1;
+        float* c0 = o0;
+        if (output_channels & 4) {
+          _mm_storeu_ps(c1, vacc1x0123);
+          _mm_storeu_ps(c0, vacc0x0123);
+
+          vacc1x0123 = vacc1x4567;
+          vacc0x0123 = vacc0x4567;
+
+          c1 += 4;
+          c0 += 4;
+        }
+        if (output_channels & 2) {
+          _mm_storel_pi((__m64*) c1, vacc1x0123);
+          _mm_storel_pi((__m64*) c0, vacc0x0123);
+
+          vacc1x0123 = _mm_movehl_ps(vacc1x0123, vacc1x0123);
+          vacc0x0123 = _mm_movehl_ps(vacc0x0123, vacc0x0123);
+
+          c1 += 2;
+          c0 += 2;
+        }
+        if (output_channels & 1) {
+          _mm_store_ss(c1, vacc1x0123);
+          _mm_store_ss(c0, vacc0x0123);
+        }
+      }
+      o0 = (float*) ((uintptr_t) o1 + output_pixel_stride);
+      ix0 = ix1 + subsampling;
+      n = doz(n, 2);
+    } while (n != 0);
+
+    weights += w_stride;
+    output += 8;
+    output_channels = doz(output_channels, 8);
+  } while (output_channels != 0);
+}
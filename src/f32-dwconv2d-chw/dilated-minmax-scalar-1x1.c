@@ -0,0 +1,74 @@
+// Copyright 2022 Google LLC
+//
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree.
+
+#include <assert.h>
+
+#include <xnnpack/dwconv.h>
+#include <xnnpack/math.h>
+
+
+void xnn_f32_dwconv2d_chw_ukernel_dilated__scalar_1x1(
+    size_t input_height,
+    size_t input_width,
+    size_t output_height,
+    size_t output_width,
+    size_t kernel_height,
+    size_t kernel_width,
+    size_t subsampling_height,
+    size_t subsampling_width,
+    size_t dilation_height,
+    size_t dilation_width,
+    uint32_t padding_top,
+    uint32_t padding_left,
+    const float* input,
+    const float* weights,
+    float* output,
+    const union xnn_f32_minmax_params params[restrict XNN_MIN_ELEMENTS(1)])
+{
+  assert(input_width != 0);
+  assert(input_width % sizeof(float) == 0);
+  assert(output_height != 0);
+  assert(output_width != 0);
+  assert(kernel_height != 0);
+  assert(kernel_width != 0);
+  assert(subsampling_height != 0);
+  assert(subsampling_width != 0);
+  assert(dilation_height != 0);
+  assert(dilation_width != 0);
+
+  const float vmin = params->scalar.min;
+  const float vmax = params->scalar.max;
+
+  const float vbias = weights[0];
+  const float* k = weights + 1;
+  const size_t input_pixels = input_width / sizeof(float);
+
+  // Input coordinates below are relative to the top-left corner of the padded input, so that kernel taps which fall
+  // into the padding can be skipped by clipping the range of kernel rows and columns instead of testing every tap.
+  for (size_t oy = 0; oy < output_height; oy++) {
+    const size_t iy0 = oy * subsampling_height;
+    const size_t ky_start = divide_round_up(doz(padding_top, iy0), dilation_height);
+    const size_t ky_end = min(kernel_height, divide_round_up(doz(padding_top + input_height, iy0), dilation_height));
+
+    for (size_t ox = 0; ox < output_width; ox++) {
+      const size_t ix0 = ox * subsampling_width;
+      const size_t kx_start = divide_round_up(doz(padding_left, ix0), dilation_width);
+      const size_t kx_end = min(kernel_width, divide_round_up(doz(padding_left + input_pixels, ix0), dilation_width));
+
+      float vacc = vbias;
+      for (size_t ky = ky_start; ky < ky_end; ky++) {
+        const float* i = (const float*) ((uintptr_t) input + (iy0 + ky * dilation_height - padding_top) * input_width);
+        const float* kr = k + ky * kernel_width;
+        for (size_t kx = kx_start; kx < kx_end; kx++) {
+          vacc += i[ix0 + kx * dilation_width - padding_left] * kr[kx];
+        }
+      }
+
+      vacc = math_max_f32(vacc, vmin);
+      vacc = math_min_f32(vacc, vmax);
+      *output++ = vacc;
+    }
+  }
+}
@@ -0,0 +1,128 @@
+// Copyright 2022 Google LLC
+//
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree.
+
+#include <assert.h>
+
+#include <xmmintrin.h>
+
+#include <xnnpack/dwconv.h>
+#include <xnnpack/math.h>
+
+
+void xnn_f32_dwconv2d_chw_ukernel_dilated__sse_1x4(
+    size_t input_height,
+    size_t input_width,
+    size_t output_height,
+    size_t output_width,
+    size_t kernel_height,
+    size_t kernel_width,
+    size_t subsampling_height,
+    size_t subsampling_width,
+    size_t dilation_height,
+    size_t dilation_width,
+    uint32_t padding_top,
+    uint32_t padding_left,
+    const float* input,
+    const float* weights,
+    float* output,
+    const union xnn_f32_minmax_params params[restrict XNN_MIN_ELEMENTS(1)]) XNN_OOB_READS
+{
+  assert(input_width != 0);
+  assert(input_width % sizeof(float) == 0);
+  assert(output_height != 0);
+  assert(output_width != 0);
+  assert(kernel_height != 0);
+  assert(kernel_width != 0);
+  assert(subsampling_height != 0);
+  assert(subsampling_width != 0);
+  assert(dilation_height != 0);
+  assert(dilation_width != 0);
+
+  const __m128 vmin = _mm_load_ps(params->sse.min);
+  const __m128 vmax = _mm_load_ps(params->sse.max);
+
+  const __m128 vbias = _mm_load1_ps(weights);
+  const float* k = weights + 1;
+  const size_t input_pixels = input_width / sizeof(float);
+
+  // Output columns in [ox_lo, ox_hi) read only valid input columns for every kernel column, and are computed 4 at a
+  // time without any bounds checks. Columns outside this range clip the range of kernel columns per output pixel.
+  // Input coordinates below are relative to the top-left corner of the padded input.
+  const size_t kernel_extent_width = (kernel_width - 1) * dilation_width;
+  const size_t ox_lo = min(output_width, divide_round_up(padding_left, subsampling_width));
+  size_t ox_hi = ox_lo;
+  if (padding_left + input_pixels > kernel_extent_width) {
+    ox_hi = max(ox_lo, min(output_width, (padding_left + input_pixels - 1 - kernel_extent_width) / subsampling_width + 1));
+  }
+
+  for (size_t oy = 0; oy < output_height; oy++) {
+    const size_t iy0 = oy * subsampling_height;
+    const size_t ky_start = divide_round_up(doz(padding_top, iy0), dilation_height);
+    const size_t ky_end = min(kernel_height, divide_round_up(doz(padding_top + input_height, iy0), dilation_height));
+    const float* i0 = (const float*) ((uintptr_t) input + (iy0 + ky_start * dilation_height - padding_top) * input_width);
+    const size_t input_row_increment = dilation_height * input_width;
+
+    size_t ox = 0;
+    for (; ox < output_width; ox++) {
+      if (ox == ox_lo) {
+        // Interior: 4 output pixels at a time.
+        for (; ox + 4 <= ox_hi; ox += 4) {
+          __m128 vacc = vbias;
+          const float* i = i0 + (ox * subsampling_width - padding_left);
+          for (size_t ky = ky_start; ky < ky_end; ky++) {
+            const float* kr = k + ky * kernel_width;
+            const float* ik = i;
+            for (size_t kx = 0; kx < kernel_width; kx++) {
+              const __m128 vk = _mm_load1_ps(kr + kx);
+              __m128 vi;
+              if (subsampling_width == 1) {
+                vi = _mm_loadu_ps(ik);
+              } else if (subsampling_width == 2) {
+                const __m128 vi0123 = _mm_loadu_ps(ik);
+                const __m128 vi4567 = _mm_loadu_ps(ik + 4);
+                vi = _mm_shuffle_ps(vi0123, vi4567, _MM_SHUFFLE(2, 0, 2, 0));
+              } else {
+                vi = _mm_setr_ps(ik[0], ik[subsampling_width], ik[2 * subsampling_width], ik[3 * subsampling_width]);
+              }
+              vacc = _mm_add_ps(vacc, _mm_mul_ps(vi, vk));
+              ik += dilation_width;
+            }
+            i = (const float*) ((uintptr_t) i + input_row_increment);
+          }
+
+          vacc = _mm_max_ps(vacc, vmin);
+          vacc = _mm_min_ps(vacc, vmax);
+          _mm_storeu_ps(output, vacc);
+          output += 4;
+        }
+        if XNN_UNLIKELY(ox == output_width) {
+          break;
+        }
+      }
+
+      // Border or remainder pixel: clip the range of kernel columns.
+      const size_t ix0 = ox * subsampling_width;
+      const size_t kx_start = divide_round_up(doz(padding_left, ix0), dilation_width);
+      const size_t kx_end = min(kernel_width, divide_round_up(doz(padding_left + input_pixels, ix0), dilation_width));
+
+      __m128 vacc = vbias;
+      const float* i = i0;
+      for (size_t ky = ky_start; ky < ky_end; ky++) {
+        const float* kr = k + ky * kernel_width;
+        for (size_t kx = kx_start; kx < kx_end; kx++) {
+          const __m128 vi = _mm_load_ss(i + (ix0 + kx * dilation_width - padding_left));
+          const __m128 vk = _mm_load_ss(kr + kx);
+          vacc = _mm_add_ss(vacc, _mm_mul_ss(vi, vk));
+        }
+        i = (const float*) ((uintptr_t) i + input_row_increment);
+      }
+
+      vacc = _mm_max_ss(vacc, vmin);
+      vacc = _mm_min_ss(vacc, vmax);
+      _mm_store_ss(output, vacc);
+      output += 1;
+    }
+  }
+}
@@ -0,0 +1,59 @@
+// Copyright 2022 Google LLC
+//
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree.
+
+#include <assert.h>
+
+#include <arm_neon.h>
+
+#include <xnnpack/common.h>
+#include <xnnpack/rmin.h>
+
+
+void xnn_f32_rmin_ukernel__neon(
+    size_t n,
+    const float* x,
+    float* y)
+{
+  assert(n != 0);
+  assert(n % sizeof(float) == 0);
+
+  float32x4_t vmin0 = vld1q_dup_f32(x);
+  float32x4_t vmin1 = vmin0;
+  float32x4_t vmin2 = vmin0;
+  float32x4_t vmin3 = vmin0;
+  for (; n >= 64; n -= 64) {
+    const float32x4_t vx0 = vld1q_f32(x); x += 4;
+    const float32x4_t vx1 = vld1q_f32(x); x += 4;
+    const float32x4_t vx2 = vld1q_f32(x); x += 4;
+    const float32x4_t vx3 = vld1q_f32(x); x += 4;
+
+    vmin0 = vminq_f32(vmin0, vx0);
+    vmin1 = vminq_f32(vmin1, vx1);
+    vmin2 = vminq_f32(vmin2, vx2);
+    vmin3 = vminq_f32(vmin3, vx3);
+  }
+  float32x4_t vmin = vminq_f32(vminq_f32(vmin0, vmin1), vminq_f32(vmin2, vmin3));
+  for (; n >= 16; n -= 16) {
+    const float32x4_t vx = vld1q_f32(x); x += 4;
+    vmin = vminq_f32(vmin, vx);
+  }
+#if XNN_ARCH_ARM64
+  float32x2_t vmin_lo = vget_low_f32(vpminq_f32(vmin, vmin));
+#else
+  float32x2_t vmin_lo = vmin_f32(vget_low_f32(vmin), vget_high_f32(vmin));
+#endif
+  if XNN_UNLIKELY(n != 0) {
+    do {
+      const float32x2_t vx = vld1_dup_f32(x); x += 1;
+      vmin_lo = vmin_f32(vmin_lo, vx);
+      n -= 4;
+    } while (n != 0);
+  }
+#if XNN_ARCH_ARM64
+  *y = vminv_f32(vmin_lo);
+#else
+  vst1_lane_f32(y, vpmin_f32(vmin_lo, vmin_lo), 0);
+#endif
+}
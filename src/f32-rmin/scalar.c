@@ -0,0 +1,47 @@
+// Copyright 2022 Google LLC
+//
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree.
+
+#include <assert.h>
+
+#include <xnnpack/math.h>
+#include <xnnpack/rmin.h>
+
+
+void xnn_f32_rmin_ukernel__scalar(
+    size_t n,
+    const float* x,
+    float* y)
+{
+  assert(n != 0);
+  assert(n % sizeof(float) == 0);
+
+  float vmin0 = *x;
+  float vmin1 = vmin0;
+  float vmin2 = vmin0;
+  float vmin3 = vmin0;
+  for (; n >= 16; n -= 16) {
+    const float vx0 = x[0];
+    const float vx1 = x[1];
+    const float vx2 = x[2];
+    const float vx3 = x[3];
+    x += 4;
+
+    vmin0 = math_min_f32(vx0, vmin0);
+    vmin1 = math_min_f32(vx1, vmin1);
+    vmin2 = math_min_f32(vx2, vmin2);
+    vmin3 = math_min_f32(vx3, vmin3);
+  }
+  const float vmin01 = math_min_f32(vmin0, vmin1);
+  const float vmin23 = math_min_f32(vmin2, vmin3);
+  float vmin = math_min_f32(vmin01, vmin23);
+  if XNN_UNLIKELY(n != 0) {
+    do {
+      const float vx = *x++;
+      vmin = math_min_f32(vx, vmin);
+      n -= 4;
+    } while (n != 0);
+  }
+  *y = vmin;
+}
@@ -0,0 +1,54 @@
+// Copyright 2022 Google LLC
+//
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree.
+
+#include <assert.h>
+
+#include <xmmintrin.h>
+
+#include <xnnpack/rmin.h>
+
+
+void xnn_f32_rmin_ukernel__sse(
+    size_t n,
+    const float* x,
+    float* y)
+{
+  assert(n != 0);
+  assert(n % sizeof(float) == 0);
+
+  __m128 vmin0 = _mm_load_ss(x);
+  vmin0 = _mm_shuffle_ps(vmin0, vmin0, _MM_SHUFFLE(0, 0, 0, 0));
+  __m128 vmin1 = vmin0;
+  __m128 vmin2 = vmin0;
+  __m128 vmin3 = vmin0;
+  for (; n >= 64; n -= 64) {
+    const __m128 vx0 = _mm_loadu_ps(x);
+    const __m128 vx1 = _mm_loadu_ps(x + 4);
+    const __m128 vx2 = _mm_loadu_ps(x + 8);
+    const __m128 vx3 = _mm_loadu_ps(x + 12);
+    x += 16;
+
+    vmin0 = _mm_min_ps(vmin0, vx0);
+    vmin1 = _mm_min_ps(vmin1, vx1);
+    vmin2 = _mm_min_ps(vmin2, vx2);
+    vmin3 = _mm_min_ps(vmin3, vx3);
+  }
+  __m128 vmin = _mm_min_ps(_mm_min_ps(vmin0, vmin1), _mm_min_ps(vmin2, vmin3));
+  for (; n >= 16; n -= 16) {
+    const __m128 vx = _mm_loadu_ps(x);
+    vmin = _mm_min_ps(vmin, vx);
+    x += 4;
+  }
+  __m128 vmin_lo = _mm_min_ps(vmin, _mm_movehl_ps(vmin, vmin));
+  vmin_lo = _mm_min_ss(vmin_lo, _mm_shuffle_ps(vmin_lo, vmin_lo, _MM_SHUFFLE(3, 3, 1, 1)));
+  if XNN_UNLIKELY(n != 0) {
+    do {
+      vmin_lo = _mm_min_ss(vmin_lo, _mm_load_ss(x));
+      x += 1;
+      n -= 4;
+    } while (n != 0);
+  }
+  _mm_store_ss(y, vmin_lo);
+}
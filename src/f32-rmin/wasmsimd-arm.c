@@ -0,0 +1,53 @@
+// Copyright 2022 Google LLC
+//
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree.
+
+#include <assert.h>
+
+#include <wasm_simd128.h>
+
+#include <xnnpack/rmin.h>
+
+
+void xnn_f32_rmin_ukernel__wasmsimd_arm(
+    size_t n,
+    const float* x,
+    float* y)
+{
+  assert(n != 0);
+  assert(n % sizeof(float) == 0);
+
+  v128_t vmin0 = wasm_v128_load32_splat(x);
+  v128_t vmin1 = vmin0;
+  v128_t vmin2 = vmin0;
+  v128_t vmin3 = vmin0;
+  for (; n >= 16 * sizeof(float); n -= 16 * sizeof(float)) {
+    const v128_t vx0 = wasm_v128_load(x);
+    const v128_t vx1 = wasm_v128_load(x + 4);
+    const v128_t vx2 = wasm_v128_load(x + 8);
+    const v128_t vx3 = wasm_v128_load(x + 12);
+    x += 16;
+
+    vmin0 = wasm_f32x4_min(vmin0, vx0);
+    vmin1 = wasm_f32x4_min(vmin1, vx1);
+    vmin2 = wasm_f32x4_min(vmin2, vx2);
+    vmin3 = wasm_f32x4_min(vmin3, vx3);
+  }
+  v128_t vmin0123 = wasm_f32x4_min(wasm_f32x4_min(vmin0, vmin1), wasm_f32x4_min(vmin2, vmin3));
+  for (; n >= 4 * sizeof(float); n -= 4 * sizeof(float)) {
+    const v128_t vx = wasm_v128_load(x);
+    vmin0123 = wasm_f32x4_min(vmin0123, vx);
+    x += 4;
+  }
+  vmin0123 = wasm_f32x4_min(vmin0123, wasm_v32x4_shuffle(vmin0123, vmin0123, 2, 3, 0, 1));
+  float vmin = __builtin_wasm_min_f32(wasm_f32x4_extract_lane(vmin0123, 0), wasm_f32x4_extract_lane(vmin0123, 1));
+  if XNN_UNLIKELY(n != 0) {
+    do {
+      const float vx = *x++;
+      vmin = __builtin_wasm_min_f32(vx, vmin);
+      n -= 4;
+    } while (n != 0);
+  }
+  *y = vmin;
+}
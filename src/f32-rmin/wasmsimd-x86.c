@@ -0,0 +1,57 @@
+// Copyright 2022 Google LLC
+//
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree.
+
+#include <assert.h>
+
+#include <wasm_simd128.h>
+
+#include <xnnpack/math.h>
+#include <xnnpack/rmin.h>
+
+
+void xnn_f32_rmin_ukernel__wasmsimd_x86(
+    size_t n,
+    const float* x,
+    float* y)
+{
+  assert(n != 0);
+  assert(n % sizeof(float) == 0);
+
+  v128_t vmin0 = wasm_v128_load32_splat(x);
+  v128_t vmin1 = vmin0;
+  v128_t vmin2 = vmin0;
+  v128_t vmin3 = vmin0;
+  for (; n >= 16 * sizeof(float); n -= 16 * sizeof(float)) {
+    const v128_t vx0 = wasm_v128_load(x);
+    const v128_t vx1 = wasm_v128_load(x + 4);
+    const v128_t vx2 = wasm_v128_load(x + 8);
+    const v128_t vx3 = wasm_v128_load(x + 12);
+    x += 16;
+
+    vmin0 = wasm_f32x4_pmin(vx0, vmin0);
+    vmin1 = wasm_f32x4_pmin(vx1, vmin1);
+    vmin2 = wasm_f32x4_pmin(vx2, vmin2);
+    vmin3 = wasm_f32x4_pmin(vx3, vmin3);
+  }
+  const v128_t vmin01 = wasm_f32x4_pmin(vmin1, vmin0);
+  const v128_t vmin23 = wasm_f32x4_pmin(vmin3, vmin2);
+  v128_t vmin0123 = wasm_f32x4_pmin(vmin23, vmin01);
+  for (; n >= 4 * sizeof(float); n -= 4 * sizeof(float)) {
+    const v128_t vx = wasm_v128_load(x);
+    vmin0123 = wasm_f32x4_pmin(vx, vmin0123);
+    x += 4;
+  }
+  const v128_t vmin2301 = wasm_v32x4_shuffle(vmin0123, vmin0123, 2, 3, 0, 1);
+  vmin0123 = wasm_f32x4_pmin(vmin2301, vmin0123);
+  float vmin = math_min_f32(wasm_f32x4_extract_lane(vmin0123, 0), wasm_f32x4_extract_lane(vmin0123, 1));
+  if XNN_UNLIKELY(n != 0) {
+    do {
+      const float vx = *x++;
+      vmin = math_min_f32(vx, vmin);
+      n -= 4;
+    } while (n != 0);
+  }
+  *y = vmin;
+}
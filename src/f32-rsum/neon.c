@@ -0,0 +1,52 @@
+// Copyright 2022 Google LLC
+//
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree.
+
+#include <assert.h>
+
+#include <arm_neon.h>
+
+#include <xnnpack/common.h>
+#include <xnnpack/rsum.h>
+
+
+void xnn_f32_rsum_ukernel__neon(
+    size_t n,
+    const float* x,
+    float* y)
+{
+  assert(n != 0);
+  assert(n % sizeof(float) == 0);
+
+  float32x4_t vacc0 = vmovq_n_f32(0.0f);
+  float32x4_t vacc1 = vmovq_n_f32(0.0f);
+  float32x4_t vacc2 = vmovq_n_f32(0.0f);
+  float32x4_t vacc3 = vmovq_n_f32(0.0f);
+  for (; n >= 64; n -= 64) {
+    const float32x4_t vx0 = vld1q_f32(x); x += 4;
+    const float32x4_t vx1 = vld1q_f32(x); x += 4;
+    const float32x4_t vx2 = vld1q_f32(x); x += 4;
+    const float32x4_t vx3 = vld1q_f32(x); x += 4;
+
+    vacc0 = vaddq_f32(vacc0, vx0);
+    vacc1 = vaddq_f32(vacc1, vx1);
+    vacc2 = vaddq_f32(vacc2, vx2);
+    vacc3 = vaddq_f32(vacc3, vx3);
+  }
+  float32x4_t vacc = vaddq_f32(vaddq_f32(vacc0, vacc1), vaddq_f32(vacc2, vacc3));
+  for (; n >= 16; n -= 16) {
+    const float32x4_t vx = vld1q_f32(x); x += 4;
+    vacc = vaddq_f32(vacc, vx);
+  }
+  float32x2_t vacc_lo = vadd_f32(vget_low_f32(vacc), vget_high_f32(vacc));
+  vacc_lo = vpadd_f32(vacc_lo, vacc_lo);
+  if XNN_UNLIKELY(n != 0) {
+    do {
+      const float32x2_t vx = vld1_dup_f32(x); x += 1;
+      vacc_lo = vadd_f32(vacc_lo, vx);
+      n -= 4;
+    } while (n != 0);
+  }
+  vst1_lane_f32(y, vacc_lo, 0);
+}
@@ -0,0 +1,47 @@
+// Copyright 2022 Google LLC
+//
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree.
+
+#include <assert.h>
+
+#include <xnnpack/common.h>
+#include <xnnpack/rsum.h>
+
+
+void xnn_f32_rsum_ukernel__scalar(
+    size_t n,
+    const float* x,
+    float* y)
+{
+  assert(n != 0);
+  assert(n % sizeof(float) == 0);
+
+  float vacc0 = 0.0f;
+  float vacc1 = 0.0f;
+  float vacc2 = 0.0f;
+  float vacc3 = 0.0f;
+  for (; n >= 16; n -= 16) {
+    const float vx0 = x[0];
+    const float vx1 = x[1];
+    const float vx2 = x[2];
+    const float vx3 = x[3];
+    x += 4;
+
+    vacc0 += vx0;
+    vacc1 += vx1;
+    vacc2 += vx2;
+    vacc3 += vx3;
+  }
+  vacc0 += vacc1;
+  vacc2 += vacc3;
+  float vacc = vacc0 + vacc2;
+  if XNN_UNLIKELY(n != 0) {
+    do {
+      const float vx = *x++;
+      vacc += vx;
+      n -= 4;
+    } while (n != 0);
+  }
+  *y = vacc;
+}
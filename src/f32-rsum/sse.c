@@ -0,0 +1,53 @@
+// Copyright 2022 Google LLC
+//
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree.
+
+#include <assert.h>
+
+#include <xmmintrin.h>
+
+#include <xnnpack/rsum.h>
+
+
+void xnn_f32_rsum_ukernel__sse(
+    size_t n,
+    const float* x,
+    float* y)
+{
+  assert(n != 0);
+  assert(n % sizeof(float) == 0);
+
+  __m128 vacc0 = _mm_setzero_ps();
+  __m128 vacc1 = _mm_setzero_ps();
+  __m128 vacc2 = _mm_setzero_ps();
+  __m128 vacc3 = _mm_setzero_ps();
+  for (; n >= 64; n -= 64) {
+    const __m128 vx0 = _mm_loadu_ps(x);
+    const __m128 vx1 = _mm_loadu_ps(x + 4);
+    const __m128 vx2 = _mm_loadu_ps(x + 8);
+    const __m128 vx3 = _mm_loadu_ps(x + 12);
+    x += 16;
+
+    vacc0 = _mm_add_ps(vacc0, vx0);
+    vacc1 = _mm_add_ps(vacc1, vx1);
+    vacc2 = _mm_add_ps(vacc2, vx2);
+    vacc3 = _mm_add_ps(vacc3, vx3);
+  }
+  __m128 vacc = _mm_add_ps(_mm_add_ps(vacc0, vacc1), _mm_add_ps(vacc2, vacc3));
+  for (; n >= 16; n -= 16) {
+    const __m128 vx = _mm_loadu_ps(x);
+    vacc = _mm_add_ps(vacc, vx);
+    x += 4;
+  }
+  __m128 vacc_lo = _mm_add_ps(vacc, _mm_movehl_ps(vacc, vacc));
+  vacc_lo = _mm_add_ss(vacc_lo, _mm_shuffle_ps(vacc_lo, vacc_lo, _MM_SHUFFLE(3, 3, 1, 1)));
+  if XNN_UNLIKELY(n != 0) {
+    do {
+      vacc_lo = _mm_add_ss(vacc_lo, _mm_load_ss(x));
+      x += 1;
+      n -= 4;
+    } while (n != 0);
+  }
+  _mm_store_ss(y, vacc_lo);
+}
@@ -0,0 +1,53 @@
+// Copyright 2022 Google LLC
+//
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree.
+
+#include <assert.h>
+
+#include <wasm_simd128.h>
+
+#include <xnnpack/rsum.h>
+
+
+void xnn_f32_rsum_ukernel__wasmsimd(
+    size_t n,
+    const float* x,
+    float* y)
+{
+  assert(n != 0);
+  assert(n % sizeof(float) == 0);
+
+  v128_t vacc0 = wasm_f32x4_const_splat(0.0f);
+  v128_t vacc1 = vacc0;
+  v128_t vacc2 = vacc0;
+  v128_t vacc3 = vacc0;
+  for (; n >= 16 * sizeof(float); n -= 16 * sizeof(float)) {
+    const v128_t vx0 = wasm_v128_load(x);
+    const v128_t vx1 = wasm_v128_load(x + 4);
+    const v128_t vx2 = wasm_v128_load(x + 8);
+    const v128_t vx3 = wasm_v128_load(x + 12);
+    x += 16;
+
+    vacc0 = wasm_f32x4_add(vacc0, vx0);
+    vacc1 = wasm_f32x4_add(vacc1, vx1);
+    vacc2 = wasm_f32x4_add(vacc2, vx2);
+    vacc3 = wasm_f32x4_add(vacc3, vx3);
+  }
+  v128_t vacc0123 = wasm_f32x4_add(wasm_f32x4_add(vacc0, vacc1), wasm_f32x4_add(vacc2, vacc3));
+  for (; n >= 4 * sizeof(float); n -= 4 * sizeof(float)) {
+    const v128_t vx = wasm_v128_load(x);
+    vacc0123 = wasm_f32x4_add(vacc0123, vx);
+    x += 4;
+  }
+  vacc0123 = wasm_f32x4_add(vacc0123, wasm_v32x4_shuffle(vacc0123, vacc0123, 2, 3, 0, 1));
+  float vacc = wasm_f32x4_extract_lane(vacc0123, 0) + wasm_f32x4_extract_lane(vacc0123, 1);
+  if XNN_UNLIKELY(n != 0) {
+    do {
+      const float vx = *x++;
+      vacc += vx;
+      n -= 4;
+    } while (n != 0);
+  }
+  *y = vacc;
+}
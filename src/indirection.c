@@ -39,6 +39,7 @@ void xnn_indirection_init_conv2d(
   const size_t dilation_width              = op->dilation_width;
   const size_t input_padding_top           = op->padding_top;
   const size_t input_padding_left          = op->padding_left;
+  const uint32_t padding_mode              = op->flags & XNN_PADDING_MODE_FLAGS;
 
   const size_t output_size = output_height * output_width;
   const size_t tiled_output_size = round_up(output_size, output_tile_size);
@@ -53,10 +54,16 @@ void xnn_indirection_init_conv2d(
       const size_t output_x = output_y_x.remainder;
       const size_t output_y = output_y_x.quotient;
       for (size_t kernel_y = 0; kernel_y < kernel_height; kernel_y++) {
-        const size_t input_y = output_y * stride_height + kernel_y * dilation_height - input_padding_top;
+        size_t input_y = output_y * stride_height + kernel_y * dilation_height - input_padding_top;
+        if XNN_UNPREDICTABLE(padding_mode != 0) {
+          input_y = xnn_padded_input_index(input_y, input_height, padding_mode);
+        }
         if (input_y < input_height) {
           for (size_t kernel_x = 0; kernel_x < kernel_width; kernel_x++) {
-            const size_t input_x = output_x * stride_width + kernel_x * dilation_width - input_padding_left;
+            size_t input_x = output_x * stride_width + kernel_x * dilation_width - input_padding_left;
+            if XNN_UNPREDICTABLE(padding_mode != 0) {
+              input_x = xnn_padded_input_index(input_x, input_width, padding_mode);
+            }
             const size_t kernel_index = kernel_y * kernel_width + kernel_x;
             const size_t index = output_tile_start * kernel_size + kernel_index * output_tile_size + output_tile_offset;
             if (input_x < input_width) {
@@ -198,6 +205,62 @@ void xnn_indirection_init_subconv2d(
   }
 }
 
+void xnn_indirection_init_conv2d_compact(
+  xnn_operator_t op,
+  size_t output_tile_size,
+  uint32_t log2_element_size)
+{
+  uint32_t* indirection_buffer             = (uint32_t*) op->indirection_buffer;
+  const size_t input_pixel_stride          = op->input_pixel_stride << log2_element_size;
+  const size_t input_height                = op->input_height;
+  const size_t input_width                 = op->input_width;
+  const size_t output_height               = op->output_height;
+  const size_t output_width                = op->output_width;
+  const size_t kernel_height               = op->kernel_height;
+  const size_t kernel_width                = op->kernel_width;
+  const size_t stride_height               = op->stride_height;
+  const size_t stride_width                = op->stride_width;
+  const size_t dilation_height             = op->dilation_height;
+  const size_t dilation_width              = op->dilation_width;
+  const size_t input_padding_top           = op->padding_top;
+  const size_t input_padding_left          = op->padding_left;
+  const uint32_t padding_mode              = op->flags & XNN_PADDING_MODE_FLAGS;
+
+  const size_t output_size = output_height * output_width;
+  const size_t tiled_output_size = round_up(output_size, output_tile_size);
+  const size_t kernel_size = kernel_height * kernel_width;
+
+  const struct fxdiv_divisor_size_t output_width_divisor = fxdiv_init_size_t(output_width);
+
+  for (size_t output_tile_start = 0; output_tile_start < tiled_output_size; output_tile_start += output_tile_size) {
+    for (size_t output_tile_offset = 0; output_tile_offset < output_tile_size; output_tile_offset++) {
+      const size_t output_index = min(output_tile_start + output_tile_offset, output_size - 1);
+      const struct fxdiv_result_size_t output_y_x = fxdiv_divide_size_t(output_index, output_width_divisor);
+      const size_t output_x = output_y_x.remainder;
+      const size_t output_y = output_y_x.quotient;
+      for (size_t kernel_y = 0; kernel_y < kernel_height; kernel_y++) {
+        size_t input_y = output_y * stride_height + kernel_y * dilation_height - input_padding_top;
+        if XNN_UNPREDICTABLE(padding_mode != 0) {
+          input_y = xnn_padded_input_index(input_y, input_height, padding_mode);
+        }
+        for (size_t kernel_x = 0; kernel_x < kernel_width; kernel_x++) {
+          size_t input_x = output_x * stride_width + kernel_x * dilation_width - input_padding_left;
+          if XNN_UNPREDICTABLE(padding_mode != 0) {
+            input_x = xnn_padded_input_index(input_x, input_width, padding_mode);
+          }
+          const size_t kernel_index = kernel_y * kernel_width + kernel_x;
+          const size_t index = output_tile_start * kernel_size + kernel_index * output_tile_size + output_tile_offset;
+          if (input_y < input_height && input_x < input_width) {
+            indirection_buffer[index] = (uint32_t) ((input_y * input_width + input_x) * input_pixel_stride);
+          } else {
+            indirection_buffer[index] = XNN_INDIRECTION_ZERO_OFFSET;
+          }
+        }
+      }
+    }
+  }
+}
+
 void xnn_indirection_init_dwconv2d(
   xnn_operator_t op,
   size_t step_height,
@@ -220,14 +283,21 @@ void xnn_indirection_init_dwconv2d(
   const size_t dilation_width     = op->dilation_width;
   const size_t input_padding_top  = op->padding_top;
   const size_t input_padding_left = op->padding_left;
+  const uint32_t padding_mode     = op->flags & XNN_PADDING_MODE_FLAGS;
 
   for (size_t output_y = 0; output_y < output_height; output_y++) {
     for (size_t kernel_y = 0; kernel_y < kernel_height; kernel_y++) {
-      const size_t input_y = output_y * stride_height + kernel_y * dilation_height - input_padding_top;
+      size_t input_y = output_y * stride_height + kernel_y * dilation_height - input_padding_top;
+      if XNN_UNPREDICTABLE(padding_mode != 0) {
+        input_y = xnn_padded_input_index(input_y, input_height, padding_mode);
+      }
       if (input_y < input_height) {
         for (size_t output_x = 0; output_x < output_width; output_x++) {
           for (size_t kernel_x = 0; kernel_x < kernel_width; kernel_x++) {
-            const size_t input_x = output_x * stride_width + kernel_x * dilation_width - input_padding_left;
+            size_t input_x = output_x * stride_width + kernel_x * dilation_width - input_padding_left;
+            if XNN_UNPREDICTABLE(padding_mode != 0) {
+              input_x = xnn_padded_input_index(input_x, input_width, padding_mode);
+            }
             const size_t index = output_y * step_height + output_x * step_width * kernel_height + kernel_x * kernel_height + kernel_y;
             if (input_x < input_width) {
               indirection_buffer[index] =
@@ -249,6 +319,80 @@ void xnn_indirection_init_dwconv2d(
   }
 }
 
+void xnn_indirection_init_dconv2d(
+  xnn_operator_t op,
+  uint32_t log2_element_size)
+{
+  const void** indirection_buffer = op->indirection_buffer;
+  const void* input               = op->input;
+  const size_t input_row_stride   = (op->input_width * op->input_pixel_stride) << log2_element_size;
+  const void* zero                = op->zero_buffer;
+  const size_t input_height       = op->input_height;
+  const size_t output_height      = op->output_height;
+  const size_t kernel_height      = op->kernel_height;
+  const size_t stride_height      = op->stride_height;
+  const size_t input_padding_top  = op->padding_top;
+
+  for (size_t output_y = 0; output_y < output_height; output_y++) {
+    for (size_t kernel_y = 0; kernel_y < kernel_height; kernel_y++) {
+      const size_t input_y = output_y * stride_height + kernel_y - input_padding_top;
+      const size_t index = output_y * kernel_height + kernel_y;
+      if (input_y < input_height) {
+        indirection_buffer[index] = (const void*) ((uintptr_t) input + input_y * input_row_stride);
+      } else {
+        indirection_buffer[index] = zero;
+      }
+    }
+  }
+}
+
+void xnn_indirection_init_dwdeconv2d(
+  xnn_operator_t op,
+  size_t step_height,
+  size_t step_width,
+  uint32_t log2_element_size)
+{
+  const void** indirection_buffer = op->indirection_buffer;
+  const void* input               = op->input;
+  const size_t input_pixel_stride = op->input_pixel_stride << log2_element_size;
+  const void* zero                = op->zero_buffer;
+  const size_t input_height       = op->input_height;
+  const size_t input_width        = op->input_width;
+  const size_t output_height      = op->output_height;
+  const size_t output_width       = op->output_width;
+  const size_t kernel_height      = op->kernel_height;
+  const size_t kernel_width       = op->kernel_width;
+  const size_t stride_height      = op->stride_height;
+  const size_t stride_width       = op->stride_width;
+  const size_t dilation_height    = op->dilation_height;
+  const size_t dilation_width     = op->dilation_width;
+  const size_t padding_top        = op->padding_top;
+  const size_t padding_left       = op->padding_left;
+
+  // Same layout as the DWCONV indirection buffer, but each tap gathers the input pixel which the transposed
+  // convolution scatters into the output pixel, or the zero buffer when no input pixel contributes through that tap.
+  for (size_t output_y = 0; output_y < output_height; output_y++) {
+    for (size_t kernel_y = 0; kernel_y < kernel_height; kernel_y++) {
+      const size_t y = output_y + padding_top - kernel_y * dilation_height;
+      const size_t input_y = y / stride_height;
+      const bool valid_y = input_y * stride_height == y && input_y < input_height;
+      for (size_t output_x = 0; output_x < output_width; output_x++) {
+        for (size_t kernel_x = 0; kernel_x < kernel_width; kernel_x++) {
+          const size_t x = output_x + padding_left - kernel_x * dilation_width;
+          const size_t input_x = x / stride_width;
+          const size_t index = output_y * step_height + output_x * step_width * kernel_height + kernel_x * kernel_height + kernel_y;
+          if (valid_y && input_x * stride_width == x && input_x < input_width) {
+            indirection_buffer[index] =
+              (const void*) ((uintptr_t) input + (input_y * input_width + input_x) * input_pixel_stride);
+          } else {
+            indirection_buffer[index] = zero;
+          }
+        }
+      }
+    }
+  }
+}
+
 void xnn_indirection_init_maxpool2d(
   xnn_operator_t op,
   size_t step_height,
@@ -613,6 +757,59 @@ void xnn_indirection_init_resize_bilinear2d_hwc_q11(
   }
 }
 
+static size_t nearest_input_index(
+  size_t output_index,
+  size_t input_size,
+  size_t output_size,
+  bool align_corners,
+  bool tensorflow_legacy)
+{
+  // Integer equivalents of TensorFlow Lite coordinate transformations, exact for dimensions below 2**24:
+  // - align corners:      round(output_index * (input_size - 1) / (output_size - 1))
+  // - legacy TensorFlow:  floor(output_index * input_size / output_size)
+  // - half-pixel centers: floor((output_index + 0.5) * input_size / output_size)
+  size_t input_index;
+  if (align_corners && output_size != 1) {
+    const uint64_t denominator = 2 * (uint64_t) (output_size - 1);
+    input_index = (size_t) ((2 * (uint64_t) output_index * (uint64_t) (input_size - 1) + (uint64_t) (output_size - 1)) / denominator);
+  } else if (tensorflow_legacy || align_corners) {
+    input_index = (size_t) ((uint64_t) output_index * (uint64_t) input_size / (uint64_t) output_size);
+  } else {
+    input_index = (size_t) ((2 * (uint64_t) output_index + 1) * (uint64_t) input_size / (2 * (uint64_t) output_size));
+  }
+  return min(input_index, input_size - 1);
+}
+
+void xnn_indirection_init_resize_nearest2d_hwc(
+  size_t input_pixel_stride,
+  size_t input_height,
+  size_t input_width,
+  size_t output_height,
+  size_t output_width,
+  size_t* input_offsets,
+  bool align_corners,
+  bool tensorflow_legacy)
+{
+  assert(input_height != 0);
+  assert(input_height < 16777216 /* 2**24 */);
+  assert(input_width != 0);
+  assert(input_width < 16777216 /* 2**24 */);
+  assert(output_height != 0);
+  assert(output_height < 16777216 /* 2**24 */);
+  assert(output_width != 0);
+  assert(output_width < 16777216 /* 2**24 */);
+
+  const size_t input_row_stride = input_width * input_pixel_stride;
+  for (size_t output_y = 0; output_y < output_height; output_y++) {
+    const size_t input_y = nearest_input_index(output_y, input_height, output_height, align_corners, tensorflow_legacy);
+    *input_offsets++ = input_y * input_row_stride;
+  }
+  for (size_t output_x = 0; output_x < output_width; output_x++) {
+    const size_t input_x = nearest_input_index(output_x, input_width, output_width, align_corners, tensorflow_legacy);
+    *input_offsets++ = input_x * input_pixel_stride;
+  }
+}
+
 void xnn_indirection_init_resize_bilinear2d_chw_f32(
   size_t input_pixel_stride,
   size_t input_height,
@@ -49,6 +49,8 @@
 #include <xnnpack/prelu.h>
 #include <xnnpack/raddstoreexpminusmax.h>
 #include <xnnpack/rmax.h>
+#include <xnnpack/rmin.h>
+#include <xnnpack/rsum.h>
 #include <xnnpack/spmm.h>
 #include <xnnpack/unpool.h>
 #include <xnnpack/vaddsub.h>
@@ -488,6 +490,14 @@ static void init(void) {
       xnn_params.qs8.dwconv[1].channel_tile = 8;
       xnn_params.qs8.dwconv[1].primary_tile = 25;
 
+      xnn_params.qs8.avgpool = (struct avgpool_parameters) {
+        .unipass = (xnn_avgpool_unipass_ukernel_function) xnn_qs8_avgpool_minmax_rndnu_ukernel_9x__neon_c8,
+        .multipass = (xnn_avgpool_multipass_ukernel_function) xnn_qs8_avgpool_minmax_rndnu_ukernel_9p8x__neon_c8,
+        .init.qs8 = xnn_init_qs8_avgpool_minmax_rndnu_neon_params,
+        .primary_tile = 9,
+        .incremental_tile = 8,
+        .channel_tile = 8,
+      };
       xnn_params.qs8.gavgpool = (struct gavgpool_parameters) {
         .unipass = (xnn_gavgpool_unipass_ukernel_function) xnn_qs8_gavgpool_minmax_rndnu_ukernel_7x__neon_c8,
         .multipass = (xnn_gavgpool_multipass_ukernel_function) xnn_qs8_gavgpool_minmax_rndnu_ukernel_7p7x__neon_c8,
@@ -868,6 +878,7 @@ static void init(void) {
         xnn_params.f32.gemm.mr = 4;
         xnn_params.f32.gemm.nr = 8;
       #endif  // XNN_ENABLE_ASSEMBLY
+      xnn_params.f32.gemm.minmax.gemv = xnn_init_hmp_gemm_ukernel((xnn_gemm_ukernel_function) xnn_f32_gemm_minmax_ukernel_1x8__neon_dup_acc4);
       xnn_params.f32.gemm2.minmax.gemm = xnn_init_hmp_gemm_ukernel((xnn_gemm_ukernel_function) xnn_f32_gemm_minmax_ukernel_4x2__neon_lane_ld64);
       xnn_params.f32.gemm2.minmax.igemm = xnn_init_hmp_igemm_ukernel((xnn_igemm_ukernel_function) xnn_f32_igemm_minmax_ukernel_4x2__neon_lane_ld64);
       xnn_params.f32.gemm2.init.f32 = xnn_init_f32_minmax_scalar_params;
@@ -1036,6 +1047,8 @@ static void init(void) {
         .element_tile = 8,
       };
       xnn_params.f32.rmax = xnn_f32_rmax_ukernel__neon;
+      xnn_params.f32.rmin = xnn_f32_rmin_ukernel__neon;
+      xnn_params.f32.rsum = xnn_f32_rsum_ukernel__neon;
       xnn_params.f32.vadd = (struct vbinary_parameters) {
         .minmax.op_ukernel = (xnn_vbinary_ukernel_function) xnn_f32_vadd_minmax_ukernel__neon_x8,
         .minmax.opc_ukernel = (xnn_vbinary_ukernel_function) xnn_f32_vaddc_minmax_ukernel__neon_x8,
@@ -1123,6 +1136,11 @@ static void init(void) {
           .output_width_tile = 4,
           .output_height_tile = 1,
         };
+        xnn_params.f32.dwconv2d_chw_dilated = (struct dwconv2d_chw_dilated_parameters) {
+          .ukernel = (xnn_dwconv2d_chw_dilated_ukernel_function) xnn_f32_dwconv2d_chw_ukernel_dilated__scalar_1x1,
+          .init.f32 = xnn_init_f32_minmax_scalar_params,
+          .output_width_tile = 1,
+        };
         xnn_params.f32.gavgpool_cw = (struct gavgpool_cw_parameters) {
           .ukernel = (xnn_gavgpool_cw_ukernel_function) xnn_f32_gavgpool_cw_ukernel__neon_x4,
           .channel_tile = 4,
@@ -1253,6 +1271,14 @@ static void init(void) {
       xnn_params.qs8.dwconv[1].channel_tile = 1;
       xnn_params.qs8.dwconv[1].primary_tile = 25;
 
+      xnn_params.qs8.avgpool = (struct avgpool_parameters) {
+        .unipass = (xnn_avgpool_unipass_ukernel_function) xnn_qs8_avgpool_minmax_fp32_ukernel_9x__scalar_imagic_c1,
+        .multipass = (xnn_avgpool_multipass_ukernel_function) xnn_qs8_avgpool_minmax_fp32_ukernel_9p8x__scalar_imagic_c1,
+        .init.qs8 = xnn_init_qs8_avgpool_minmax_fp32_scalar_imagic_params,
+        .primary_tile = 9,
+        .incremental_tile = 8,
+        .channel_tile = 1,
+      };
       xnn_params.qs8.gavgpool = (struct gavgpool_parameters) {
         .unipass = (xnn_gavgpool_unipass_ukernel_function) xnn_qs8_gavgpool_minmax_fp32_ukernel_7x__scalar_imagic_c1,
         .multipass = (xnn_gavgpool_multipass_ukernel_function) xnn_qs8_gavgpool_minmax_fp32_ukernel_7p7x__scalar_imagic_c1,
@@ -1556,6 +1582,8 @@ static void init(void) {
         .element_tile = 4,
       };
       xnn_params.f32.rmax = xnn_f32_rmax_ukernel__scalar;
+      xnn_params.f32.rmin = xnn_f32_rmin_ukernel__scalar;
+      xnn_params.f32.rsum = xnn_f32_rsum_ukernel__scalar;
       xnn_params.f32.vadd = (struct vbinary_parameters) {
         .minmax.op_ukernel = (xnn_vbinary_ukernel_function) xnn_f32_vadd_minmax_ukernel__scalar_x8,
         .minmax.opc_ukernel = (xnn_vbinary_ukernel_function) xnn_f32_vaddc_minmax_ukernel__scalar_x8,
@@ -1653,6 +1681,11 @@ static void init(void) {
           .output_width_tile = 1,
           .output_height_tile = 2,
         };
+        xnn_params.f32.dwconv2d_chw_dilated = (struct dwconv2d_chw_dilated_parameters) {
+          .ukernel = (xnn_dwconv2d_chw_dilated_ukernel_function) xnn_f32_dwconv2d_chw_ukernel_dilated__scalar_1x1,
+          .init.f32 = xnn_init_f32_minmax_scalar_params,
+          .output_width_tile = 1,
+        };
         xnn_params.f32.gavgpool_cw = (struct gavgpool_cw_parameters) {
           .ukernel = (xnn_gavgpool_cw_ukernel_function) xnn_f32_gavgpool_cw_ukernel__scalar_x1,
           .channel_tile = 1,
@@ -2120,6 +2153,14 @@ static void init(void) {
     xnn_params.qs8.dwconv[1].channel_tile = 16;
     xnn_params.qs8.dwconv[1].primary_tile = 25;
 
+    xnn_params.qs8.avgpool = (struct avgpool_parameters) {
+      .unipass = (xnn_avgpool_unipass_ukernel_function) xnn_qs8_avgpool_minmax_rndnu_ukernel_9x__neon_c8,
+      .multipass = (xnn_avgpool_multipass_ukernel_function) xnn_qs8_avgpool_minmax_rndnu_ukernel_9p8x__neon_c8,
+      .init.qs8 = xnn_init_qs8_avgpool_minmax_rndnu_neon_params,
+      .primary_tile = 9,
+      .incremental_tile = 8,
+      .channel_tile = 8,
+    };
     xnn_params.qs8.gavgpool = (struct gavgpool_parameters) {
       .unipass = (xnn_gavgpool_unipass_ukernel_function) xnn_qs8_gavgpool_minmax_rndnu_ukernel_7x__neon_c8,
       .multipass = (xnn_gavgpool_multipass_ukernel_function) xnn_qs8_gavgpool_minmax_rndnu_ukernel_7p7x__neon_c8,
@@ -2447,6 +2488,7 @@ static void init(void) {
         xnn_params.f16.gemm.minmax.gemm1 = xnn_init_hmp_gemm_ukernel((xnn_gemm_ukernel_function) xnn_f16_gemm_minmax_ukernel_1x16__neonfp16arith_ld64);
       #endif  // XNN_ENABLE_ASSEMBLY
       xnn_params.f16.gemm.minmax.igemm = xnn_init_hmp_igemm_ukernel((xnn_igemm_ukernel_function) xnn_f16_igemm_minmax_ukernel_6x16__neonfp16arith_ld64);
+      xnn_params.f16.gemm.minmax.gemv = xnn_init_hmp_gemm_ukernel((xnn_gemm_ukernel_function) xnn_f16_gemm_minmax_ukernel_1x16__neonfp16arith_ld64_acc4);
       xnn_params.f16.gemm.minmax.igemm1 = xnn_init_hmp_igemm_ukernel((xnn_igemm_ukernel_function) xnn_f16_igemm_minmax_ukernel_1x16__neonfp16arith_ld64);
       xnn_params.f16.gemm.init.f16 = xnn_init_f16_scaleminmax_neon_params;
 
@@ -2470,6 +2512,22 @@ static void init(void) {
       xnn_params.f16.dwconv[3].channel_tile = 8;
       xnn_params.f16.dwconv[3].primary_tile = 25;
 
+      xnn_params.f16.avgpool = (struct avgpool_parameters) {
+        .unipass = (xnn_avgpool_unipass_ukernel_function) xnn_f16_avgpool_minmax_ukernel_9x__neonfp16arith_c8,
+        .multipass = (xnn_avgpool_multipass_ukernel_function) xnn_f16_avgpool_minmax_ukernel_9p8x__neonfp16arith_c8,
+        .init.f16 = xnn_init_f16_scaleminmax_neon_params,
+        .primary_tile = 9,
+        .incremental_tile = 8,
+        .channel_tile = 8,
+      };
+      xnn_params.f16.pavgpool = (struct pavgpool_parameters) {
+        .unipass = (xnn_pavgpool_unipass_ukernel_function) xnn_f16_pavgpool_minmax_ukernel_9x__neonfp16arith_c8,
+        .multipass = (xnn_pavgpool_multipass_ukernel_function) xnn_f16_pavgpool_minmax_ukernel_9p8x__neonfp16arith_c8,
+        .init.f16 = xnn_init_f16_minmax_neon_params,
+        .primary_tile = 9,
+        .incremental_tile = 8,
+        .channel_tile = 8,
+      };
       xnn_params.f16.gavgpool = (struct gavgpool_parameters) {
         .unipass = (xnn_gavgpool_unipass_ukernel_function) xnn_f16_gavgpool_minmax_ukernel_7x__neonfp16arith_c8,
         .multipass = (xnn_gavgpool_multipass_ukernel_function) xnn_f16_gavgpool_minmax_ukernel_7p7x__neonfp16arith_c8,
@@ -2737,6 +2795,9 @@ static void init(void) {
         xnn_params.f32.gemm.nr = 8;
       #endif  // XNN_ENABLE_ASSEMBLY
     #endif  // XNN_PLATFORM_IOS || XNN_PLATFORM_MAC
+    if (xnn_params.f32.gemm.nr == 8 && xnn_params.f32.gemm.log2_sr == 0) {
+      xnn_params.f32.gemm.minmax.gemv = xnn_init_hmp_gemm_ukernel((xnn_gemm_ukernel_function) xnn_f32_gemm_minmax_ukernel_1x8__neonfma_dup_acc4);
+    }
     xnn_params.f32.gemm2.minmax.gemm = xnn_init_hmp_gemm_ukernel((xnn_gemm_ukernel_function) xnn_f32_gemm_minmax_ukernel_4x2__neonfma_lane_ld64);
     xnn_params.f32.gemm2.minmax.igemm = xnn_init_hmp_igemm_ukernel((xnn_igemm_ukernel_function) xnn_f32_igemm_minmax_ukernel_4x2__neonfma_lane_ld64);
     xnn_params.f32.gemm2.init.f32 = xnn_init_f32_minmax_scalar_params;
@@ -2905,6 +2966,8 @@ static void init(void) {
       .element_tile = 16,
     };
     xnn_params.f32.rmax = xnn_f32_rmax_ukernel__neon;
+    xnn_params.f32.rmin = xnn_f32_rmin_ukernel__neon;
+    xnn_params.f32.rsum = xnn_f32_rsum_ukernel__neon;
     xnn_params.f32.vadd = (struct vbinary_parameters) {
       .minmax.op_ukernel = (xnn_vbinary_ukernel_function) xnn_f32_vadd_minmax_ukernel__neon_x8,
       .minmax.opc_ukernel = (xnn_vbinary_ukernel_function) xnn_f32_vaddc_minmax_ukernel__neon_x8,
@@ -3002,6 +3065,11 @@ static void init(void) {
         .output_width_tile = 4,
         .output_height_tile = 1,
       };
+      xnn_params.f32.dwconv2d_chw_dilated = (struct dwconv2d_chw_dilated_parameters) {
+        .ukernel = (xnn_dwconv2d_chw_dilated_ukernel_function) xnn_f32_dwconv2d_chw_ukernel_dilated__scalar_1x1,
+        .init.f32 = xnn_init_f32_minmax_scalar_params,
+        .output_width_tile = 1,
+      };
       xnn_params.f32.gavgpool_cw = (struct gavgpool_cw_parameters) {
         .ukernel = (xnn_gavgpool_cw_ukernel_function) xnn_f32_gavgpool_cw_ukernel__neon_x4,
         .channel_tile = 4,
@@ -3305,6 +3373,46 @@ static void init(void) {
     }
     xnn_params.qs8.dwconv[0].primary_tile = 9;
     xnn_params.qs8.dwconv[1].primary_tile = 25;
+    // The DCONV micro-kernel targets only SSE4.1, and on processors with AVX ISA the
+    // wider IGEMM micro-kernels are expected to be faster.
+    if (cpuinfo_has_x86_sse4_1() && !cpuinfo_has_x86_avx()) {
+      xnn_params.qs8.dconv = (struct dconv_parameters) {
+        .ukernel = (xnn_dconv_ukernel_function) xnn_qs8_dconv_minmax_fp32_ukernel_2x8__sse41,
+        .init.qs8 = xnn_init_qs8_conv_minmax_fp32_sse4_params,
+        .mr = 2,
+        .nr = 8,
+        .max_input_channels = 4,
+      };
+    }
+
+    if (cpuinfo_has_x86_avx2()) {
+      xnn_params.qs8.avgpool = (struct avgpool_parameters) {
+        .unipass = (xnn_avgpool_unipass_ukernel_function) xnn_qs8_avgpool_minmax_fp32_ukernel_9x__avx2_c16,
+        .multipass = (xnn_avgpool_multipass_ukernel_function) xnn_qs8_avgpool_minmax_fp32_ukernel_9p8x__avx2_c16,
+        .init.qs8 = xnn_init_qs8_avgpool_minmax_fp32_avx2_params,
+        .primary_tile = 9,
+        .incremental_tile = 8,
+        .channel_tile = 16,
+      };
+    } else if (cpuinfo_has_x86_sse4_1()) {
+      xnn_params.qs8.avgpool = (struct avgpool_parameters) {
+        .unipass = (xnn_avgpool_unipass_ukernel_function) xnn_qs8_avgpool_minmax_fp32_ukernel_9x__sse41_c8,
+        .multipass = (xnn_avgpool_multipass_ukernel_function) xnn_qs8_avgpool_minmax_fp32_ukernel_9p8x__sse41_c8,
+        .init.qs8 = xnn_init_qs8_avgpool_minmax_fp32_sse4_params,
+        .primary_tile = 9,
+        .incremental_tile = 8,
+        .channel_tile = 8,
+      };
+    } else {
+      xnn_params.qs8.avgpool = (struct avgpool_parameters) {
+        .unipass = (xnn_avgpool_unipass_ukernel_function) xnn_qs8_avgpool_minmax_fp32_ukernel_9x__sse2_c8,
+        .multipass = (xnn_avgpool_multipass_ukernel_function) xnn_qs8_avgpool_minmax_fp32_ukernel_9p8x__sse2_c8,
+        .init.qs8 = xnn_init_qs8_avgpool_minmax_fp32_sse2_params,
+        .primary_tile = 9,
+        .incremental_tile = 8,
+        .channel_tile = 8,
+      };
+    }
 
     if (cpuinfo_has_x86_sse4_1()) {
       xnn_params.qs8.gavgpool = (struct gavgpool_parameters) {
@@ -3717,6 +3825,7 @@ static void init(void) {
       xnn_params.f16.gemm.minmax.gemm = xnn_init_hmp_gemm_ukernel((xnn_gemm_ukernel_function) xnn_f16_gemm_minmax_ukernel_4x16__avx2_broadcast);
       xnn_params.f16.gemm.minmax.igemm = xnn_init_hmp_igemm_ukernel((xnn_igemm_ukernel_function) xnn_f16_igemm_minmax_ukernel_4x16__avx2_broadcast);
       xnn_params.f16.gemm.minmax.gemm1 = xnn_init_hmp_gemm_ukernel((xnn_gemm_ukernel_function) xnn_f16_gemm_minmax_ukernel_1x16__avx2_broadcast);
+      xnn_params.f16.gemm.minmax.gemv = xnn_init_hmp_gemm_ukernel((xnn_gemm_ukernel_function) xnn_f16_gemm_minmax_ukernel_1x16__avx2_broadcast_acc4);
       xnn_params.f16.gemm.minmax.igemm1 = xnn_init_hmp_igemm_ukernel((xnn_igemm_ukernel_function) xnn_f16_igemm_minmax_ukernel_1x16__avx2_broadcast);
       xnn_params.f16.gemm.init.f16 = xnn_init_f16_scaleminmax_avx_params;
       xnn_params.f16.gemm.mr = 4;
@@ -3742,6 +3851,44 @@ static void init(void) {
       xnn_params.f16.dwconv[3].channel_tile = 8;
       xnn_params.f16.dwconv[3].primary_tile = 25;
 
+      // F16 operators require AVX2, where the 4x16 IGEMM micro-kernel is expected to be faster than the 2x8 FMA3 DCONV
+      // micro-kernel, so F16 convolutions don't use DCONV.
+
+      if (!XNN_PLATFORM_MOBILE && cpuinfo_has_x86_avx512f() && cpuinfo_has_x86_avx512bw() && cpuinfo_has_x86_avx512dq() && cpuinfo_has_x86_avx512vl()) {
+        xnn_params.f16.avgpool = (struct avgpool_parameters) {
+          .unipass = (xnn_avgpool_unipass_ukernel_function) xnn_f16_avgpool_minmax_ukernel_9x__avx512skx_c16,
+          .multipass = (xnn_avgpool_multipass_ukernel_function) xnn_f16_avgpool_minmax_ukernel_9p8x__avx512skx_c16,
+          .init.f16 = xnn_init_f16_scaleminmax_avx_params,
+          .primary_tile = 9,
+          .incremental_tile = 8,
+          .channel_tile = 16,
+        };
+        xnn_params.f16.pavgpool = (struct pavgpool_parameters) {
+          .unipass = (xnn_pavgpool_unipass_ukernel_function) xnn_f16_pavgpool_minmax_ukernel_9x__avx512skx_c16,
+          .multipass = (xnn_pavgpool_multipass_ukernel_function) xnn_f16_pavgpool_minmax_ukernel_9p8x__avx512skx_c16,
+          .init.f16 = xnn_init_f16_minmax_avx_params,
+          .primary_tile = 9,
+          .incremental_tile = 8,
+          .channel_tile = 16,
+        };
+      } else {
+        xnn_params.f16.avgpool = (struct avgpool_parameters) {
+          .unipass = (xnn_avgpool_unipass_ukernel_function) xnn_f16_avgpool_minmax_ukernel_9x__f16c_c8,
+          .multipass = (xnn_avgpool_multipass_ukernel_function) xnn_f16_avgpool_minmax_ukernel_9p8x__f16c_c8,
+          .init.f16 = xnn_init_f16_scaleminmax_avx_params,
+          .primary_tile = 9,
+          .incremental_tile = 8,
+          .channel_tile = 8,
+        };
+        xnn_params.f16.pavgpool = (struct pavgpool_parameters) {
+          .unipass = (xnn_pavgpool_unipass_ukernel_function) xnn_f16_pavgpool_minmax_ukernel_9x__f16c_c8,
+          .multipass = (xnn_pavgpool_multipass_ukernel_function) xnn_f16_pavgpool_minmax_ukernel_9p8x__f16c_c8,
+          .init.f16 = xnn_init_f16_minmax_avx_params,
+          .primary_tile = 9,
+          .incremental_tile = 8,
+          .channel_tile = 8,
+        };
+      }
       xnn_params.f16.gavgpool = (struct gavgpool_parameters) {
         .unipass = (xnn_gavgpool_unipass_ukernel_function) xnn_f16_gavgpool_minmax_ukernel_7x__f16c_c8,
         .multipass = (xnn_gavgpool_multipass_ukernel_function) xnn_f16_gavgpool_minmax_ukernel_7p7x__f16c_c8,
@@ -3817,6 +3964,7 @@ static void init(void) {
       xnn_params.f32.gemm.minmax.igemm = xnn_init_hmp_igemm_ukernel((xnn_igemm_ukernel_function) xnn_f32_igemm_minmax_ukernel_7x16__avx512f_broadcast);
       xnn_params.f32.gemm.minmax.gemm1 = xnn_init_hmp_gemm_ukernel((xnn_gemm_ukernel_function) xnn_f32_gemm_minmax_ukernel_1x16__avx512f_broadcast);
       xnn_params.f32.gemm.minmax.igemm1 = xnn_init_hmp_igemm_ukernel((xnn_igemm_ukernel_function) xnn_f32_igemm_minmax_ukernel_1x16__avx512f_broadcast);
+      xnn_params.f32.gemm.minmax.gemv = xnn_init_hmp_gemm_ukernel((xnn_gemm_ukernel_function) xnn_f32_gemm_minmax_ukernel_1x16__avx512f_broadcast_acc4);
       xnn_params.f32.gemm.init.f32 = xnn_init_f32_minmax_scalar_params;
       xnn_params.f32.gemm.mr = 7;
       xnn_params.f32.gemm.nr = 16;
@@ -3838,6 +3986,7 @@ static void init(void) {
           xnn_params.f32.gemm.minmax.igemm = xnn_init_hmp_igemm_ukernel((xnn_igemm_ukernel_function) xnn_f32_igemm_minmax_ukernel_5x16__fma3_broadcast);
           xnn_params.f32.gemm.minmax.gemm1 = xnn_init_hmp_gemm_ukernel((xnn_gemm_ukernel_function) xnn_f32_gemm_minmax_ukernel_1x16__fma3_broadcast);
           xnn_params.f32.gemm.minmax.igemm1 = xnn_init_hmp_igemm_ukernel((xnn_igemm_ukernel_function) xnn_f32_igemm_minmax_ukernel_1x16__fma3_broadcast);
+          xnn_params.f32.gemm.minmax.gemv = xnn_init_hmp_gemm_ukernel((xnn_gemm_ukernel_function) xnn_f32_gemm_minmax_ukernel_1x16__fma3_broadcast_acc4);
           xnn_params.f32.gemm.init.f32 = xnn_init_f32_minmax_avx_params;
           xnn_params.f32.gemm.mr = 5;
           xnn_params.f32.gemm.nr = 16;
@@ -3848,6 +3997,7 @@ static void init(void) {
       xnn_params.f32.gemm.minmax.igemm = xnn_init_hmp_igemm_ukernel((xnn_igemm_ukernel_function) xnn_f32_igemm_minmax_ukernel_5x16__avx_broadcast);
       xnn_params.f32.gemm.minmax.gemm1 = xnn_init_hmp_gemm_ukernel((xnn_gemm_ukernel_function) xnn_f32_gemm_minmax_ukernel_1x16__avx_broadcast);
       xnn_params.f32.gemm.minmax.igemm1 = xnn_init_hmp_igemm_ukernel((xnn_igemm_ukernel_function) xnn_f32_igemm_minmax_ukernel_1x16__avx_broadcast);
+      xnn_params.f32.gemm.minmax.gemv = xnn_init_hmp_gemm_ukernel((xnn_gemm_ukernel_function) xnn_f32_gemm_minmax_ukernel_1x16__avx_broadcast_acc4);
       xnn_params.f32.gemm.init.f32 = xnn_init_f32_minmax_avx_params;
       xnn_params.f32.gemm.mr = 5;
       xnn_params.f32.gemm.nr = 16;
@@ -3856,6 +4006,7 @@ static void init(void) {
       xnn_params.f32.gemm.minmax.igemm = xnn_init_hmp_igemm_ukernel((xnn_igemm_ukernel_function) xnn_f32_igemm_minmax_ukernel_4x8__sse_load1);
       xnn_params.f32.gemm.minmax.gemm1 = xnn_init_hmp_gemm_ukernel((xnn_gemm_ukernel_function) xnn_f32_gemm_minmax_ukernel_1x8__sse_load1);
       xnn_params.f32.gemm.minmax.igemm1 = xnn_init_hmp_igemm_ukernel((xnn_igemm_ukernel_function) xnn_f32_igemm_minmax_ukernel_1x8__sse_load1);
+      xnn_params.f32.gemm.minmax.gemv = xnn_init_hmp_gemm_ukernel((xnn_gemm_ukernel_function) xnn_f32_gemm_minmax_ukernel_1x8__sse_dup_acc4);
       xnn_params.f32.gemm.init.f32 = xnn_init_f32_minmax_sse_params;
       xnn_params.f32.gemm.mr = 4;
       xnn_params.f32.gemm.nr = 8;
@@ -3948,6 +4099,17 @@ static void init(void) {
       xnn_params.f32.dwconv[3].channel_tile = 8;
       xnn_params.f32.dwconv[3].primary_tile = 25;
     }
+    // The DCONV micro-kernel targets only SSE, and on processors with AVX ISA the
+    // wider IGEMM micro-kernels are expected to be faster.
+    if (!cpuinfo_has_x86_avx()) {
+      xnn_params.f32.dconv = (struct dconv_parameters) {
+        .ukernel = (xnn_dconv_ukernel_function) xnn_f32_dconv_minmax_ukernel_2x8__sse,
+        .init.f32 = xnn_init_f32_minmax_sse_params,
+        .mr = 2,
+        .nr = 8,
+        .max_input_channels = 4,
+      };
+    }
     xnn_params.f32.avgpool = (struct avgpool_parameters) {
       .unipass = (xnn_avgpool_unipass_ukernel_function) xnn_f32_avgpool_minmax_ukernel_9x__sse_c4,
       .multipass = (xnn_avgpool_multipass_ukernel_function) xnn_f32_avgpool_minmax_ukernel_9p8x__sse_c4,
@@ -4295,6 +4457,8 @@ static void init(void) {
       .element_tile = 20,
     };
     xnn_params.f32.rmax = xnn_f32_rmax_ukernel__sse;
+    xnn_params.f32.rmin = xnn_f32_rmin_ukernel__sse;
+    xnn_params.f32.rsum = xnn_f32_rsum_ukernel__sse;
     if (!XNN_PLATFORM_MOBILE && cpuinfo_has_x86_avx512f()) {
       xnn_params.f32.vadd = (struct vbinary_parameters) {
         .minmax.op_ukernel = (xnn_vbinary_ukernel_function) xnn_f32_vadd_minmax_ukernel__avx512f_x32,
@@ -4493,6 +4657,11 @@ static void init(void) {
         .output_width_tile = 4,
         .output_height_tile = 2,
       };
+      xnn_params.f32.dwconv2d_chw_dilated = (struct dwconv2d_chw_dilated_parameters) {
+        .ukernel = (xnn_dwconv2d_chw_dilated_ukernel_function) xnn_f32_dwconv2d_chw_ukernel_dilated__sse_1x4,
+        .init.f32 = xnn_init_f32_minmax_sse_params,
+        .output_width_tile = 4,
+      };
       xnn_params.f32.gavgpool_cw = (struct gavgpool_cw_parameters) {
         .ukernel = (xnn_gavgpool_cw_ukernel_function) xnn_f32_gavgpool_cw_ukernel__sse_x4,
         .channel_tile = 4,
@@ -4782,6 +4951,14 @@ static void init(void) {
     xnn_params.qs8.dwconv[1].channel_tile = 16;
     xnn_params.qs8.dwconv[1].primary_tile = 25;
 
+    xnn_params.qs8.avgpool = (struct avgpool_parameters) {
+      .unipass = (xnn_avgpool_unipass_ukernel_function) xnn_qs8_avgpool_minmax_fp32_ukernel_9x__scalar_imagic_c1,
+      .multipass = (xnn_avgpool_multipass_ukernel_function) xnn_qs8_avgpool_minmax_fp32_ukernel_9p8x__scalar_imagic_c1,
+      .init.qs8 = xnn_init_qs8_avgpool_minmax_fp32_scalar_imagic_params,
+      .primary_tile = 9,
+      .incremental_tile = 8,
+      .channel_tile = 1,
+    };
     xnn_params.qs8.gavgpool = (struct gavgpool_parameters) {
       .unipass = (xnn_gavgpool_unipass_ukernel_function) xnn_qs8_gavgpool_minmax_fp32_ukernel_7x__wasmsimd_c16,
       .multipass = (xnn_gavgpool_multipass_ukernel_function) xnn_qs8_gavgpool_minmax_fp32_ukernel_7p7x__wasmsimd_c16,
@@ -5269,6 +5446,8 @@ static void init(void) {
     };
     if (is_wasm_x86) {
       xnn_params.f32.rmax = xnn_f32_rmax_ukernel__wasmsimd_x86;
+      xnn_params.f32.rmin = xnn_f32_rmin_ukernel__wasmsimd_x86;
+      xnn_params.f32.rsum = xnn_f32_rsum_ukernel__wasmsimd;
       xnn_params.f32.vadd = (struct vbinary_parameters) {
         .minmax.op_ukernel = (xnn_vbinary_ukernel_function) xnn_f32_vadd_minmax_ukernel__wasmsimd_x86_x16,
         .minmax.opc_ukernel = (xnn_vbinary_ukernel_function) xnn_f32_vaddc_minmax_ukernel__wasmsimd_x86_x16,
@@ -5323,6 +5502,8 @@ static void init(void) {
       };
     } else {
       xnn_params.f32.rmax = xnn_f32_rmax_ukernel__wasmsimd_arm;
+      xnn_params.f32.rmin = xnn_f32_rmin_ukernel__wasmsimd_arm;
+      xnn_params.f32.rsum = xnn_f32_rsum_ukernel__wasmsimd;
       xnn_params.f32.vadd = (struct vbinary_parameters) {
         .minmax.op_ukernel = (xnn_vbinary_ukernel_function) xnn_f32_vadd_minmax_ukernel__wasmsimd_arm_x16,
         .minmax.opc_ukernel = (xnn_vbinary_ukernel_function) xnn_f32_vaddc_minmax_ukernel__wasmsimd_arm_x16,
@@ -5441,6 +5622,11 @@ static void init(void) {
           .output_width_tile = 4,
           .output_height_tile = 1,
         };
+        xnn_params.f32.dwconv2d_chw_dilated = (struct dwconv2d_chw_dilated_parameters) {
+          .ukernel = (xnn_dwconv2d_chw_dilated_ukernel_function) xnn_f32_dwconv2d_chw_ukernel_dilated__scalar_1x1,
+          .init.f32 = xnn_init_f32_minmax_scalar_params,
+          .output_width_tile = 1,
+        };
       } else {
         xnn_params.f32.dwconv2d_chw_3x3 = (struct dwconv2d_chw_parameters) {
           .ukernel = (xnn_dwconv2d_chw_ukernel_function) xnn_f32_dwconv2d_chw_ukernel_3x3p1__wasmsimd_arm_loadsplat_2x4,
@@ -5462,6 +5648,11 @@ static void init(void) {
           .output_width_tile = 4,
           .output_height_tile = 1,
         };
+        xnn_params.f32.dwconv2d_chw_dilated = (struct dwconv2d_chw_dilated_parameters) {
+          .ukernel = (xnn_dwconv2d_chw_dilated_ukernel_function) xnn_f32_dwconv2d_chw_ukernel_dilated__scalar_1x1,
+          .init.f32 = xnn_init_f32_minmax_scalar_params,
+          .output_width_tile = 1,
+        };
       }
       if (is_wasm_x86) {
         xnn_params.f32.gavgpool_cw = (struct gavgpool_cw_parameters) {
@@ -5640,6 +5831,14 @@ static void init(void) {
       xnn_params.qs8.dwconv[1].primary_tile = 25;
     }
 
+    xnn_params.qs8.avgpool = (struct avgpool_parameters) {
+      .unipass = (xnn_avgpool_unipass_ukernel_function) xnn_qs8_avgpool_minmax_fp32_ukernel_9x__scalar_imagic_c1,
+      .multipass = (xnn_avgpool_multipass_ukernel_function) xnn_qs8_avgpool_minmax_fp32_ukernel_9p8x__scalar_imagic_c1,
+      .init.qs8 = xnn_init_qs8_avgpool_minmax_fp32_scalar_imagic_params,
+      .primary_tile = 9,
+      .incremental_tile = 8,
+      .channel_tile = 1,
+    };
     xnn_params.qs8.gavgpool = (struct gavgpool_parameters) {
       .unipass = (xnn_gavgpool_unipass_ukernel_function) xnn_qs8_gavgpool_minmax_fp32_ukernel_7x__scalar_imagic_c4,
       .multipass = (xnn_gavgpool_multipass_ukernel_function) xnn_qs8_gavgpool_minmax_fp32_ukernel_7p7x__scalar_imagic_c4,
@@ -6018,6 +6217,8 @@ static void init(void) {
       .element_tile = 4,
     };
     xnn_params.f32.rmax = xnn_f32_rmax_ukernel__scalar;
+    xnn_params.f32.rmin = xnn_f32_rmin_ukernel__scalar;
+    xnn_params.f32.rsum = xnn_f32_rsum_ukernel__scalar;
     xnn_params.f32.vadd = (struct vbinary_parameters) {
       .minmax.op_ukernel = (xnn_vbinary_ukernel_function) xnn_f32_vadd_minmax_ukernel__wasm_x8,
       .minmax.opc_ukernel = (xnn_vbinary_ukernel_function) xnn_f32_vaddc_minmax_ukernel__wasm_x8,
@@ -6115,6 +6316,11 @@ static void init(void) {
         .output_width_tile = 1,
         .output_height_tile = 1,
       };
+      xnn_params.f32.dwconv2d_chw_dilated = (struct dwconv2d_chw_dilated_parameters) {
+        .ukernel = (xnn_dwconv2d_chw_dilated_ukernel_function) xnn_f32_dwconv2d_chw_ukernel_dilated__scalar_1x1,
+        .init.f32 = xnn_init_f32_minmax_scalar_params,
+        .output_width_tile = 1,
+      };
       xnn_params.f32.gavgpool_cw = (struct gavgpool_cw_parameters) {
         .ukernel = (xnn_gavgpool_cw_ukernel_function) xnn_f32_gavgpool_cw_ukernel__scalar_x1,
         .channel_tile = 1,
@@ -6255,7 +6461,22 @@ static void init(void) {
     xnn_params.qs8.dwconv[1].init.qs8 = xnn_init_qs8_conv_minmax_fp32_scalar_lrintf_params;
     xnn_params.qs8.dwconv[1].channel_tile = 2;
     xnn_params.qs8.dwconv[1].primary_tile = 25;
+    xnn_params.qs8.dconv = (struct dconv_parameters) {
+      .ukernel = (xnn_dconv_ukernel_function) xnn_qs8_dconv_minmax_fp32_ukernel_1x4__scalar_fmagic,
+      .init.qs8 = xnn_init_qs8_conv_minmax_fp32_scalar_fmagic_params,
+      .mr = 1,
+      .nr = 4,
+      .max_input_channels = 4,
+    };
 
+    xnn_params.qs8.avgpool = (struct avgpool_parameters) {
+      .unipass = (xnn_avgpool_unipass_ukernel_function) xnn_qs8_avgpool_minmax_fp32_ukernel_9x__scalar_imagic_c1,
+      .multipass = (xnn_avgpool_multipass_ukernel_function) xnn_qs8_avgpool_minmax_fp32_ukernel_9p8x__scalar_imagic_c1,
+      .init.qs8 = xnn_init_qs8_avgpool_minmax_fp32_scalar_imagic_params,
+      .primary_tile = 9,
+      .incremental_tile = 8,
+      .channel_tile = 1,
+    };
     xnn_params.qs8.gavgpool = (struct gavgpool_parameters) {
       .unipass = (xnn_gavgpool_unipass_ukernel_function) xnn_qs8_gavgpool_minmax_fp32_ukernel_7x__scalar_imagic_c1,
       .multipass = (xnn_gavgpool_multipass_ukernel_function) xnn_qs8_gavgpool_minmax_fp32_ukernel_7p7x__scalar_imagic_c1,
@@ -6445,6 +6666,13 @@ static void init(void) {
     xnn_params.f32.dwconv[3].init.f32 = xnn_init_f32_minmax_scalar_params;
     xnn_params.f32.dwconv[3].channel_tile = 1;
     xnn_params.f32.dwconv[3].primary_tile = 25;
+    xnn_params.f32.dconv = (struct dconv_parameters) {
+      .ukernel = (xnn_dconv_ukernel_function) xnn_f32_dconv_minmax_ukernel_1x4__scalar,
+      .init.f32 = xnn_init_f32_minmax_scalar_params,
+      .mr = 1,
+      .nr = 4,
+      .max_input_channels = 4,
+    };
 
     xnn_params.f32.avgpool = (struct avgpool_parameters) {
       .unipass = (xnn_avgpool_unipass_ukernel_function) xnn_f32_avgpool_minmax_ukernel_9x__scalar_c1,
@@ -6561,6 +6789,8 @@ static void init(void) {
       .element_tile = 4,
     };
     xnn_params.f32.rmax = xnn_f32_rmax_ukernel__scalar;
+    xnn_params.f32.rmin = xnn_f32_rmin_ukernel__scalar;
+    xnn_params.f32.rsum = xnn_f32_rsum_ukernel__scalar;
     xnn_params.f32.vadd = (struct vbinary_parameters) {
       .minmax.op_ukernel = (xnn_vbinary_ukernel_function) xnn_f32_vadd_minmax_ukernel__scalar_x8,
       .minmax.opc_ukernel = (xnn_vbinary_ukernel_function) xnn_f32_vaddc_minmax_ukernel__scalar_x8,
@@ -6658,6 +6888,11 @@ static void init(void) {
         .output_width_tile = 1,
         .output_height_tile = 1,
       };
+      xnn_params.f32.dwconv2d_chw_dilated = (struct dwconv2d_chw_dilated_parameters) {
+        .ukernel = (xnn_dwconv2d_chw_dilated_ukernel_function) xnn_f32_dwconv2d_chw_ukernel_dilated__scalar_1x1,
+        .init.f32 = xnn_init_f32_minmax_scalar_params,
+        .output_width_tile = 1,
+      };
       xnn_params.f32.gavgpool_cw = (struct gavgpool_cw_parameters) {
         .ukernel = (xnn_gavgpool_cw_ukernel_function) xnn_f32_gavgpool_cw_ukernel__scalar_x1,
         .channel_tile = 1,
@@ -6745,6 +6980,21 @@ static void init(void) {
   #error "Unsupported architecture"
 #endif
 
+  // Conservative defaults for platforms where the cache hierarchy can't be detected.
+  xnn_params.cache.l1d_size = 32 * 1024;
+  xnn_params.cache.l2_size = 256 * 1024;
+  #if !XNN_PLATFORM_WEB && !XNN_ARCH_RISCV
+    const struct cpuinfo_cache* l1d_cache = cpuinfo_get_l1d_cache(0);
+    if (l1d_cache != NULL && l1d_cache->size != 0) {
+      xnn_params.cache.l1d_size = l1d_cache->size;
+    }
+    const struct cpuinfo_cache* l2_cache = cpuinfo_get_l2_cache(0);
+    if (l2_cache != NULL && l2_cache->size != 0) {
+      // L2 cache is often shared by a cluster of cores, count only the share of one core.
+      xnn_params.cache.l2_size = l2_cache->size / (l2_cache->processor_count != 0 ? l2_cache->processor_count : 1);
+    }
+  #endif  // !XNN_PLATFORM_WEB && !XNN_ARCH_RISCV
+
   memcpy(&xnn_params.allocator, init_allocator, sizeof(struct xnn_allocator));
   xnn_params.init_flags = init_flags;
 }
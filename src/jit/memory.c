@@ -42,6 +42,7 @@ enum xnn_status xnn_allocate_code_memory(struct xnn_code_buffer* buf, size_t siz
   buf->code = p;
   buf->size = 0;
   buf->capacity = size;
+  xnn_account_memory_allocation(xnn_memory_category_code, size);
   return xnn_status_success;
 }
 
@@ -86,6 +87,7 @@ enum xnn_status xnn_finalize_code_memory(struct xnn_code_buffer* buf) {
   }
 
   buf->capacity = page_aligned_code_size;
+  xnn_account_memory_release(xnn_memory_category_code, unused_capacity);
 
   if (buf->capacity == 0) {
     return xnn_status_success;
@@ -129,6 +131,7 @@ enum xnn_status xnn_release_code_memory(struct xnn_code_buffer* buf) {
     return xnn_status_invalid_state;
   }
 #endif
+  xnn_account_memory_release(xnn_memory_category_code, buf->capacity);
   buf->code = NULL;
   buf->size = 0;
   buf->capacity = 0;
@@ -148,6 +148,21 @@ void xnn_add_value_allocation_tracker(struct xnn_value_allocation_tracker* track
   tracker->max_value_id = value_id;
 }
 
+void xnn_alias_value_allocation_tracker(struct xnn_value_allocation_tracker* tracker,
+                                        uint32_t value_id,
+                                        uint32_t alias_id) {
+#if XNN_ENABLE_MEMOPT
+  struct xnn_value_usage* usage = tracker->usage + value_id;
+  const struct xnn_value_usage* alias_usage = tracker->usage + alias_id;
+  if (alias_usage->first_node < usage->first_node) {
+    usage->first_node = alias_usage->first_node;
+  }
+  if (alias_usage->last_node > usage->last_node) {
+    usage->last_node = alias_usage->last_node;
+  }
+#endif
+}
+
 void xnn_plan_value_allocation_tracker(struct xnn_value_allocation_tracker* tracker) {
 #if XNN_ENABLE_MEMOPT
   if (tracker->min_value_id == XNN_INVALID_VALUE_ID) {
@@ -42,13 +42,29 @@ enum xnn_status xnn_delete_operator(xnn_operator_t op)
   }
 
   xnn_release_memory(op->indirection_buffer);
-  xnn_release_simd_memory(op->packed_weights);
-  xnn_release_simd_memory(op->zero_buffer);
+  if (!op->shares_weights) {
+    if (!op->external_packed_weights) {
+      xnn_release_simd_memory(op->packed_weights);
+    }
+    xnn_release_simd_memory(op->lookup_table);
+  }
+  if (!op->shares_zero_buffer) {
+    xnn_release_simd_memory(op->zero_buffer);
+  }
   xnn_release_memory(op->pixelwise_buffer);
   xnn_release_memory(op->subconvolution_buffer);
-  xnn_release_simd_memory(op->lookup_table);
+  xnn_release_simd_memory(op->scratch_buffer);
+  xnn_release_simd_memory(op->streaming.history);
+  xnn_release_simd_memory(op->streaming.staging);
+  for (size_t i = 0; i < XNN_COUNT_OF(op->fused_operators); i++) {
+    if (op->fused_operators[i] != NULL) {
+      xnn_delete_operator(op->fused_operators[i]);
+    }
+  }
 #if XNN_PLATFORM_JIT
-  xnn_release_jit_ukernel(op->ukernel);
+  if (!op->shares_weights) {
+    xnn_release_jit_ukernel(op->ukernel);
+  }
 #endif  // XNN_PLATFORM_JIT
   xnn_release_simd_memory(op);
   return xnn_status_success;
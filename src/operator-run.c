@@ -7,6 +7,7 @@
 // LICENSE file in the root directory of this source tree.
 
 #include <assert.h>
+#include <stdbool.h>
 #include <stddef.h>
 #include <stdint.h>
 #include <string.h>
@@ -19,7 +20,183 @@
 #include <xnnpack/math.h>
 #include <xnnpack/params.h>
 #include <xnnpack/compute.h>
+#include <xnnpack/indirection.h>
+#include <xnnpack/tiling.h>
+
+
+// Accumulate n bytes of b into c with a VBinary micro-kernel. The micro-kernel may read up to XNN_EXTRA_BYTES past the
+// end of its inputs, but output tensors have no such padding, so the last partial vector goes through a padded copy.
+static void vbinary_accumulate(
+    xnn_vbinary_ukernel_function ukernel,
+    size_t n,
+    void* c,
+    const void* b,
+    const void* params)
+{
+  const size_t n_remainder = n % XNN_EXTRA_BYTES;
+  const size_t n_main = n - n_remainder;
+  if XNN_LIKELY(n_main != 0) {
+    ukernel(n_main, c, b, c, params);
+  }
+  if XNN_UNLIKELY(n_remainder != 0) {
+    XNN_ALIGN(16) char c_remainder[2 * XNN_EXTRA_BYTES];
+    XNN_ALIGN(16) char b_remainder[2 * XNN_EXTRA_BYTES];
+    memcpy(c_remainder, (const void*) ((uintptr_t) c + n_main), n_remainder);
+    memcpy(b_remainder, (const void*) ((uintptr_t) b + n_main), n_remainder);
+    ukernel(n_remainder, c_remainder, b_remainder, c_remainder, params);
+    memcpy((void*) ((uintptr_t) c + n_main), c_remainder, n_remainder);
+  }
+}
+
+// Add the residual tensor to a tile of C produced by a GEMM, IGEMM, or direct convolution micro-kernel while the tile is
+// hot in cache.
+static void add_residual_tile(
+    xnn_vbinary_ukernel_function ukernel,
+    size_t mr_block_size,
+    size_t n,
+    void* c,
+    size_t cm_stride,
+    const void* residual,
+    size_t residual_stride,
+    const void* params)
+{
+  do {
+    vbinary_accumulate(ukernel, n, c, residual, params);
+    c = (void*) ((uintptr_t) c + cm_stride);
+    residual = (const void*) ((uintptr_t) residual + residual_stride);
+  } while (--mr_block_size != 0);
+}
+
+// Add the residual tensor to a tile of the output of a GEMM, if the operator has a fused residual addition.
+static inline void add_gemm_residual(
+    const struct gemm_context context[restrict XNN_MIN_ELEMENTS(1)],
+    size_t group_index,
+    size_t mr_block_start,
+    size_t nr_block_start,
+    size_t mr_block_size,
+    size_t nr_block_size)
+{
+  if (context->residual_ukernel == NULL) {
+    return;
+  }
+  const size_t n_offset = (nr_block_start << context->log2_csize) + group_index * context->cg_stride;
+  add_residual_tile(
+      context->residual_ukernel,
+      mr_block_size,
+      nr_block_size << context->log2_csize,
+      (void*) ((uintptr_t) context->c + mr_block_start * context->cm_stride + n_offset),
+      context->cm_stride,
+      (const void*) ((uintptr_t) context->residual + mr_block_start * context->residual_stride + n_offset),
+      context->residual_stride,
+      &context->residual_params);
+}
+
+// Add the residual tensor to a tile of the output of an IGEMM, if the operator has a fused residual addition.
+static inline void add_igemm_residual(
+    const struct igemm_context context[restrict XNN_MIN_ELEMENTS(1)],
+    size_t batch_index,
+    size_t group_index,
+    size_t mr_block_start,
+    size_t nr_block_start,
+    size_t mr_block_size,
+    size_t nr_block_size)
+{
+  if (context->residual_ukernel == NULL) {
+    return;
+  }
+  const size_t n_offset = (nr_block_start << context->log2_csize) + group_index * context->gc_stride;
+  add_residual_tile(
+      context->residual_ukernel,
+      mr_block_size,
+      nr_block_size << context->log2_csize,
+      (void*) ((uintptr_t) context->c +
+        batch_index * context->bc_stride + mr_block_start * context->cm_stride + n_offset),
+      context->cm_stride,
+      (const void*) ((uintptr_t) context->residual +
+        batch_index * context->residual_batch_stride + mr_block_start * context->residual_stride + n_offset),
+      context->residual_stride,
+      &context->residual_params);
+}
 
+static void pack_gemm_block(
+    const struct pack_gemm_context context[restrict XNN_MIN_ELEMENTS(1)],
+    size_t nc,
+    size_t kc,
+    const void* kernel,
+    const void* bias,
+    void* packed_w)
+{
+  if (context->pack_conv_goki_w != NULL) {
+    context->pack_conv_goki_w(
+      1, nc, context->ks, kc,
+      context->nr, context->kr, context->sr,
+      kernel, bias, packed_w, context->extra_bytes, &context->packing_params);
+  } else {
+    context->pack_gemm_goi_w(
+      1, nc, kc,
+      context->nr, context->kr, context->sr,
+      kernel, bias, packed_w, context->extra_bytes, &context->packing_params);
+  }
+}
+
+void xnn_compute_pack_gemm(
+    const struct pack_gemm_context context[restrict XNN_MIN_ELEMENTS(1)],
+    size_t group_index,
+    size_t nc_block_start,
+    size_t nc_block_size)
+{
+  const size_t nr = context->nr;
+  assert(nc_block_start % nr == 0);
+
+  const void* kernel = (const void*) ((uintptr_t) context->kernel +
+    group_index * context->kernel_g_stride + nc_block_start * context->kernel_n_stride);
+  const void* bias = NULL;
+  if XNN_LIKELY(context->bias != NULL) {
+    bias = (const void*) ((uintptr_t) context->bias +
+      group_index * context->bias_g_stride + nc_block_start * context->bias_n_stride);
+  }
+  void* packed_w = (void*) ((uintptr_t) context->packed_w + group_index * context->packed_g_stride);
+
+  if XNN_LIKELY(context->num_k_segments == 1) {
+    pack_gemm_block(
+      context, nc_block_size, context->kc, kernel, bias,
+      (void*) ((uintptr_t) packed_w + (nc_block_start / nr) * context->packed_n_stride));
+    return;
+  }
+
+  // Rows of a segment of the reduction dimension are not contiguous in the kernel: gather nr rows at a time.
+  assert(context->ks == 1);
+  const size_t num_k_segments = context->num_k_segments;
+  const size_t last_k_segment_size = context->kc - (num_k_segments - 1) * context->k_segment_size;
+  const size_t max_row_size = max(context->k_segment_size, last_k_segment_size) << context->log2_kernel_element_size;
+  void* rows = XNN_SIMD_ALLOCA(nr * max_row_size);
+  for (size_t segment = 0; segment < num_k_segments; segment++) {
+    const bool last_segment = segment + 1 == num_k_segments;
+    const size_t segment_size = last_segment ? last_k_segment_size : context->k_segment_size;
+    const size_t row_size = segment_size << context->log2_kernel_element_size;
+    const size_t packed_n_stride = last_segment ? context->packed_n_stride : context->packed_k_segment_n_stride;
+    const void* segment_kernel = (const void*) ((uintptr_t) kernel +
+      ((segment * context->k_segment_size) << context->log2_kernel_element_size));
+    void* segment_packed_w = (void*) ((uintptr_t) packed_w +
+      segment * context->packed_k_segment_stride + (nc_block_start / nr) * packed_n_stride);
+    for (size_t n = 0; n < nc_block_size; n += nr) {
+      const size_t nr_block_size = min(nc_block_size - n, nr);
+      for (size_t i = 0; i < nr_block_size; i++) {
+        memcpy(
+          (void*) ((uintptr_t) rows + i * row_size),
+          (const void*) ((uintptr_t) segment_kernel + (n + i) * context->kernel_n_stride),
+          row_size);
+      }
+      // Only the first segment includes bias, packed bias of the other segments stays zero.
+      const void* segment_bias = NULL;
+      if (segment == 0 && bias != NULL) {
+        segment_bias = (const void*) ((uintptr_t) bias + n * context->bias_n_stride);
+      }
+      pack_gemm_block(context, nr_block_size, segment_size, rows, segment_bias, segment_packed_w);
+      segment_packed_w = (void*) ((uintptr_t) segment_packed_w + packed_n_stride);
+    }
+  }
+}
 
 void xnn_compute_grouped_gemm(
     const struct gemm_context context[restrict XNN_MIN_ELEMENTS(1)],
@@ -44,6 +221,7 @@ void xnn_compute_grouped_gemm(
       cm_stride,
       context->cn_stride,
       &context->params);
+  add_gemm_residual(context, group_index, mr_block_start, nr_block_start, mr_block_size, nr_block_size);
 }
 
 void xnn_compute_gemm(
@@ -67,6 +245,141 @@ void xnn_compute_gemm(
       cm_stride,
       context->cn_stride,
       &context->params);
+  add_gemm_residual(context, 0 /* group_index */, mr_block_start, nr_block_start, mr_block_size, nr_block_size);
+}
+
+void xnn_compute_gemm_blocked(
+    const struct gemm_context context[restrict XNN_MIN_ELEMENTS(1)],
+    size_t nc_block_start,
+    size_t mc_block_start,
+    size_t nc_block_size,
+    size_t mc_block_size)
+{
+  const size_t mr = context->mr;
+  for (size_t mr_block_start = mc_block_start; mr_block_start < mc_block_start + mc_block_size; mr_block_start += mr) {
+    xnn_compute_gemm(
+        context,
+        mr_block_start,
+        nc_block_start,
+        min(mr, mc_block_start + mc_block_size - mr_block_start),
+        nc_block_size);
+  }
+}
+
+void xnn_compute_split_k_gemm(
+    const struct split_k_gemm_context context[restrict XNN_MIN_ELEMENTS(1)],
+    size_t partial_index,
+    size_t mr_block_start,
+    size_t nr_block_start,
+    size_t mr_block_size,
+    size_t nr_block_size)
+{
+  const size_t a_stride = context->a_stride;
+  const size_t num_segments = context->num_segments;
+  const size_t num_partials = context->num_partials;
+  const size_t segment_start = partial_index * num_segments / num_partials;
+  const size_t segment_end = (partial_index + 1) * num_segments / num_partials;
+  // With a single partition the tile is accumulated directly in the output, and the last segment applies the clamping.
+  const bool final = num_partials == 1;
+
+  void* c;
+  size_t cm_stride;
+  if (final) {
+    cm_stride = context->cm_stride;
+    c = (void*) ((uintptr_t) context->c + mr_block_start * cm_stride + nr_block_start * sizeof(float));
+  } else {
+    cm_stride = context->partial_m_stride;
+    c = (void*) ((uintptr_t) context->partials + partial_index * context->partial_stride +
+      mr_block_start * cm_stride + nr_block_start * sizeof(float));
+  }
+
+  float tmp[XNN_SPLIT_K_MAX_TILE_ELEMENTS];
+  assert(mr_block_size * nr_block_size <= XNN_SPLIT_K_MAX_TILE_ELEMENTS);
+  const size_t tmp_stride = nr_block_size * sizeof(float);
+  for (size_t segment = segment_start; segment < segment_end; segment++) {
+    const bool last_segment = segment + 1 == num_segments;
+    const size_t k_scaled = last_segment ? context->last_segment_k_scaled : context->segment_k_scaled;
+    const size_t w_stride = last_segment ? context->last_w_stride : context->w_stride;
+    const void* a = (const void*) ((uintptr_t) context->a + mr_block_start * a_stride + segment * context->segment_k_scaled);
+    const void* w = (const void*) ((uintptr_t) context->packed_w + segment * context->segment_w_stride + nr_block_start * w_stride);
+    if (segment == segment_start) {
+      context->ukernel.function[XNN_UARCH_DEFAULT](
+          mr_block_size, nr_block_size, k_scaled, a, a_stride, w,
+          c, cm_stride, context->cn_stride, &context->gemm_linear_params);
+    } else {
+      context->ukernel.function[XNN_UARCH_DEFAULT](
+          mr_block_size, nr_block_size, k_scaled, a, a_stride, w,
+          tmp, tmp_stride, context->cn_stride, &context->gemm_linear_params);
+      const void* vadd_params = final && last_segment ? &context->vadd_params : &context->vadd_linear_params;
+      for (size_t m = 0; m < mr_block_size; m++) {
+        float* c_row = (float*) ((uintptr_t) c + m * cm_stride);
+        vbinary_accumulate(context->vadd_ukernel, nr_block_size * sizeof(float), c_row, &tmp[m * nr_block_size], vadd_params);
+      }
+    }
+  }
+
+  if (final && context->residual_ukernel != NULL) {
+    add_residual_tile(
+        context->residual_ukernel,
+        mr_block_size,
+        nr_block_size * sizeof(float),
+        c,
+        cm_stride,
+        (const void*) ((uintptr_t) context->residual + mr_block_start * context->residual_stride + nr_block_start * sizeof(float)),
+        context->residual_stride,
+        &context->residual_params);
+  }
+}
+
+void xnn_compute_segmented_gemm(
+    const struct split_k_gemm_context context[restrict XNN_MIN_ELEMENTS(1)],
+    size_t mr_block_start,
+    size_t nc_block_start,
+    size_t mr_block_size,
+    size_t nc_block_size)
+{
+  assert(context->num_partials == 1);
+
+  const size_t nr = context->cn_stride / sizeof(float);
+  for (size_t nr_block_start = nc_block_start; nr_block_start < nc_block_start + nc_block_size; nr_block_start += nr) {
+    xnn_compute_split_k_gemm(
+        context,
+        0 /* partial index */,
+        mr_block_start,
+        nr_block_start,
+        mr_block_size,
+        min(nr, nc_block_start + nc_block_size - nr_block_start));
+  }
+}
+
+void xnn_compute_split_k_gemm_reduce(
+    const struct split_k_gemm_context context[restrict XNN_MIN_ELEMENTS(1)],
+    size_t mr_index)
+{
+  const size_t n = context->n * sizeof(float);
+  const size_t num_partials = context->num_partials;
+  assert(num_partials >= 2);
+
+  const void* partial = (const void*) ((uintptr_t) context->partials + mr_index * context->partial_m_stride);
+  void* c = (void*) ((uintptr_t) context->c + mr_index * context->cm_stride);
+  // The partial sums are padded with XNN_EXTRA_BYTES, but the output is not.
+  for (size_t p = 1; p < num_partials; p++) {
+    const void* next_partial = (const void*) ((uintptr_t) partial + context->partial_stride);
+    const void* vadd_params = p + 1 == num_partials ? &context->vadd_params : &context->vadd_linear_params;
+    if (p == 1) {
+      context->vadd_ukernel(n, partial, next_partial, c, vadd_params);
+    } else {
+      vbinary_accumulate(context->vadd_ukernel, n, c, next_partial, vadd_params);
+    }
+    partial = next_partial;
+  }
+
+  if (context->residual_ukernel != NULL) {
+    vbinary_accumulate(
+        context->residual_ukernel, n, c,
+        (const void*) ((uintptr_t) context->residual + mr_index * context->residual_stride),
+        &context->residual_params);
+  }
 }
 
 void xnn_compute_spmm(
@@ -87,6 +400,30 @@ void xnn_compute_spmm(
       &context->params);
 }
 
+// Returns the indirection pointers of the output tile starting at mr_block_start. Compact indirection buffers are
+// expanded into the ks x MR pointers of the tile in the compact_a array.
+static inline const void** igemm_indirect_a(
+    const struct igemm_context context[restrict XNN_MIN_ELEMENTS(1)],
+    size_t mr_block_start,
+    const void* compact_a[restrict XNN_MAX_COMPACT_INDIRECTION_TILE_ENTRIES])
+{
+  const size_t ks = context->ks;
+  if XNN_LIKELY(context->compact_indirect_a == NULL) {
+    return (const void**) ((uintptr_t) context->indirect_a + mr_block_start * ks * sizeof(void*));
+  }
+
+  const size_t tile_entries = context->ks_scaled / sizeof(void*);
+  assert(tile_entries <= XNN_MAX_COMPACT_INDIRECTION_TILE_ENTRIES);
+  const uint32_t* offsets = context->compact_indirect_a + mr_block_start * ks;
+  const uintptr_t base = (uintptr_t) context->compact_indirect_base;
+  const void* zero = context->zero;
+  for (size_t i = 0; i < tile_entries; i++) {
+    const uint32_t offset = offsets[i];
+    compact_a[i] = offset == XNN_INDIRECTION_ZERO_OFFSET ? zero : (const void*) (base + offset);
+  }
+  return compact_a;
+}
+
 void xnn_compute_grouped_batch_igemm(
     const struct igemm_context context[restrict XNN_MIN_ELEMENTS(1)],
     size_t batch_index,
@@ -96,7 +433,7 @@ void xnn_compute_grouped_batch_igemm(
     size_t mr_block_size,
     size_t nr_block_size)
 {
-  const size_t ks        = context->ks;
+  const void* compact_a[XNN_MAX_COMPACT_INDIRECTION_TILE_ENTRIES];
   const size_t cm_stride = context->cm_stride;
 
   context->ukernel.function[XNN_UARCH_DEFAULT](
@@ -104,7 +441,7 @@ void xnn_compute_grouped_batch_igemm(
       nr_block_size,
       context->kc,
       context->ks_scaled,
-      (const void**) ((uintptr_t) context->indirect_a + mr_block_start * ks * sizeof(void*)),
+      igemm_indirect_a(context, mr_block_start, compact_a),
       (const void*) ((uintptr_t) context->packed_w + nr_block_start * context->w_stride + group_index * context->gw_stride),
       (void*) ((uintptr_t) context->c + group_index * context->gc_stride + batch_index * context->bc_stride + mr_block_start * cm_stride + (nr_block_start << context->log2_csize)),
       cm_stride,
@@ -112,6 +449,7 @@ void xnn_compute_grouped_batch_igemm(
       context->a_offset + group_index * context->ga_stride + batch_index * context->ba_stride,
       context->zero,
       &context->params);
+  add_igemm_residual(context, batch_index, group_index, mr_block_start, nr_block_start, mr_block_size, nr_block_size);
 }
 
 void xnn_compute_grouped_igemm(
@@ -122,7 +460,7 @@ void xnn_compute_grouped_igemm(
     size_t mr_block_size,
     size_t nr_block_size)
 {
-  const size_t ks        = context->ks;
+  const void* compact_a[XNN_MAX_COMPACT_INDIRECTION_TILE_ENTRIES];
   const size_t cm_stride = context->cm_stride;
 
   context->ukernel.function[XNN_UARCH_DEFAULT](
@@ -130,7 +468,7 @@ void xnn_compute_grouped_igemm(
       nr_block_size,
       context->kc,
       context->ks_scaled,
-      (const void**) ((uintptr_t) context->indirect_a + mr_block_start * ks * sizeof(void*)),
+      igemm_indirect_a(context, mr_block_start, compact_a),
       (const void*) ((uintptr_t) context->packed_w + nr_block_start * context->w_stride + group_index * context->gw_stride),
       (void*) ((uintptr_t) context->c + group_index * context->gc_stride + mr_block_start * cm_stride + (nr_block_start << context->log2_csize)),
       cm_stride,
@@ -138,6 +476,8 @@ void xnn_compute_grouped_igemm(
       context->a_offset + group_index * context->ga_stride,
       context->zero,
       &context->params);
+  add_igemm_residual(
+      context, 0 /* batch_index */, group_index, mr_block_start, nr_block_start, mr_block_size, nr_block_size);
 }
 
 void xnn_compute_batch_igemm(
@@ -148,7 +488,7 @@ void xnn_compute_batch_igemm(
     size_t mr_block_size,
     size_t nr_block_size)
 {
-  const size_t ks        = context->ks;
+  const void* compact_a[XNN_MAX_COMPACT_INDIRECTION_TILE_ENTRIES];
   const size_t cm_stride = context->cm_stride;
 
   context->ukernel.function[XNN_UARCH_DEFAULT](
@@ -156,7 +496,7 @@ void xnn_compute_batch_igemm(
       nr_block_size,
       context->kc,
       context->ks_scaled,
-      (const void**) ((uintptr_t) context->indirect_a + mr_block_start * ks * sizeof(void*)),
+      igemm_indirect_a(context, mr_block_start, compact_a),
       (const void*) ((uintptr_t) context->packed_w + nr_block_start * context->w_stride),
       (void*) ((uintptr_t) context->c + batch_index * context->bc_stride + mr_block_start * cm_stride + (nr_block_start << context->log2_csize)),
       cm_stride,
@@ -164,6 +504,8 @@ void xnn_compute_batch_igemm(
       context->a_offset + batch_index * context->ba_stride,
       context->zero,
       &context->params);
+  add_igemm_residual(
+      context, batch_index, 0 /* group_index */, mr_block_start, nr_block_start, mr_block_size, nr_block_size);
 }
 
 void xnn_compute_igemm(
@@ -173,7 +515,7 @@ void xnn_compute_igemm(
     size_t mr_block_size,
     size_t nr_block_size)
 {
-  const size_t ks        = context->ks;
+  const void* compact_a[XNN_MAX_COMPACT_INDIRECTION_TILE_ENTRIES];
   const size_t cm_stride = context->cm_stride;
 
   context->ukernel.function[XNN_UARCH_DEFAULT](
@@ -181,7 +523,7 @@ void xnn_compute_igemm(
       nr_block_size,
       context->kc,
       context->ks_scaled,
-      (const void**) ((uintptr_t) context->indirect_a + mr_block_start * ks * sizeof(void*)),
+      igemm_indirect_a(context, mr_block_start, compact_a),
       (const void*) ((uintptr_t) context->packed_w + nr_block_start * context->w_stride),
       (void*) ((uintptr_t) context->c + mr_block_start * cm_stride + (nr_block_start << context->log2_csize)),
       cm_stride,
@@ -189,6 +531,9 @@ void xnn_compute_igemm(
       context->a_offset,
       context->zero,
       &context->params);
+  add_igemm_residual(
+      context, 0 /* batch_index */, 0 /* group_index */,
+      mr_block_start, nr_block_start, mr_block_size, nr_block_size);
 }
 
 void xnn_compute_grouped_subgemm2d(
@@ -365,6 +710,39 @@ void xnn_compute_conv2d_hwc2chw(
       &context->params);
 }
 
+void xnn_compute_dconv(
+    const struct dconv_context context[restrict XNN_MIN_ELEMENTS(1)],
+    size_t batch_index,
+    size_t output_y)
+{
+  const void** indirect_input =
+    (const void**) ((uintptr_t) context->indirect_input + output_y * context->indirect_input_height_stride);
+  const size_t input_offset = context->input_offset + batch_index * context->input_batch_stride;
+  void* output = (void*) ((uintptr_t) context->output +
+    batch_index * context->output_batch_stride + output_y * context->output_height_stride);
+
+  context->ukernel(
+    context->output_width, context->output_channels,
+    context->kernel_height, context->kernel_width,
+    context->input_channels, context->input_width, context->input_pixel_stride,
+    context->subsampling, context->padding_left,
+    indirect_input, input_offset, context->zero,
+    context->packed_weights, output, context->output_pixel_stride,
+    &context->params);
+  if (context->residual_ukernel != NULL) {
+    add_residual_tile(
+        context->residual_ukernel,
+        context->output_width,
+        context->output_channels << context->log2_csize,
+        output,
+        context->output_pixel_stride,
+        (const void*) ((uintptr_t) context->residual +
+          batch_index * context->residual_batch_stride + output_y * context->residual_height_stride),
+        context->residual_stride,
+        &context->residual_params);
+  }
+}
+
 void xnn_compute_dwconv_unipass(
     const struct dwconv_context context[restrict XNN_MIN_ELEMENTS(1)],
     size_t batch_index,
@@ -384,6 +762,98 @@ void xnn_compute_dwconv_unipass(
     &context->params);
 }
 
+void xnn_compute_inverted_bottleneck(
+    const struct inverted_bottleneck_context context[restrict XNN_MIN_ELEMENTS(1)],
+    size_t worker_index)
+{
+  // Each worker owns a slice of the scratch buffer and processes strips worker_index, worker_index + num_workers, ...
+  void* scratch = (void*) ((uintptr_t) context->scratch + worker_index * context->scratch_stride);
+  void* expanded = scratch;
+  void* depthwise_output = (void*) ((uintptr_t) scratch + context->depthwise_output_offset);
+  const void** indirection_buffer = (const void**) ((uintptr_t) scratch + context->indirection_buffer_offset);
+
+  const size_t channels = context->channels;
+  const size_t expanded_pixel_stride = channels * sizeof(float);
+  const size_t input_height = context->input_height;
+  const size_t input_width = context->input_width;
+  const size_t output_height = context->output_height;
+  const size_t output_width = context->output_width;
+  const size_t kernel_height = context->kernel_height;
+  const size_t kernel_width = context->kernel_width;
+  const size_t step_width = context->indirection_step_width;
+  const size_t step_height = context->indirection_step_height;
+
+  for (size_t strip = worker_index; strip < context->num_strips; strip += context->num_workers) {
+    const size_t batch_index = strip / context->strips_per_image;
+    const size_t output_y_start = (strip % context->strips_per_image) * context->strip_height;
+    const size_t output_y_count = min(context->strip_height, output_height - output_y_start);
+
+    // Range of input rows [input_y_start, input_y_end) which contribute to the strip of output rows.
+    const size_t input_y_first = output_y_start * context->stride_height;
+    const size_t input_y_last = (output_y_start + output_y_count - 1) * context->stride_height +
+      (kernel_height - 1) * context->dilation_height + 1;
+    const size_t input_y_start = doz(input_y_first, context->padding_top);
+    const size_t input_y_end = min(doz(input_y_last, context->padding_top), input_height);
+
+    // 1x1 expansion Convolution of the contributing input rows into the scratch buffer.
+    if (input_y_end > input_y_start) {
+      const size_t expand_m = (input_y_end - input_y_start) * input_width;
+      const void* a = (const void*) ((uintptr_t) context->input + batch_index * context->input_batch_stride +
+        input_y_start * input_width * context->input_pixel_stride);
+      for (size_t m = 0; m < expand_m; m += context->expand_mr) {
+        context->expand_ukernel(
+          min(context->expand_mr, expand_m - m), channels, context->expand_k_scaled,
+          (const void*) ((uintptr_t) a + m * context->input_pixel_stride), context->input_pixel_stride,
+          context->expand_weights,
+          (void*) ((uintptr_t) expanded + m * expanded_pixel_stride), expanded_pixel_stride,
+          context->expand_nr * sizeof(float),
+          &context->expand_params);
+      }
+    }
+
+    // Depthwise Convolution of the expanded rows, with indirection pointers into the scratch buffer.
+    for (size_t y = 0; y < output_y_count; y++) {
+      const size_t output_y = output_y_start + y;
+      const void** indirection_row = indirection_buffer + y * step_height;
+      for (size_t kernel_y = 0; kernel_y < kernel_height; kernel_y++) {
+        const size_t input_y = output_y * context->stride_height + kernel_y * context->dilation_height - context->padding_top;
+        const bool valid_row = input_y - input_y_start < input_y_end - input_y_start;
+        for (size_t output_x = 0; output_x < output_width; output_x++) {
+          for (size_t kernel_x = 0; kernel_x < kernel_width; kernel_x++) {
+            const size_t input_x = output_x * context->stride_width + kernel_x * context->dilation_width - context->padding_left;
+            const size_t index = output_x * step_width * kernel_height + kernel_x * kernel_height + kernel_y;
+            if (valid_row && input_x < input_width) {
+              indirection_row[index] = (const void*) ((uintptr_t) expanded +
+                ((input_y - input_y_start) * input_width + input_x) * expanded_pixel_stride);
+            } else {
+              indirection_row[index] = context->zero;
+            }
+          }
+        }
+      }
+      context->depthwise_ukernel(
+        channels, output_width, indirection_row, context->depthwise_weights,
+        (void*) ((uintptr_t) depthwise_output + y * output_width * expanded_pixel_stride),
+        kernel_height * step_width * sizeof(void*), 0 /* output increment */, 0 /* input offset */,
+        context->zero, &context->depthwise_params);
+    }
+
+    // 1x1 projection Convolution of the strip into the output tensor.
+    const size_t project_m = output_y_count * output_width;
+    void* c = (void*) ((uintptr_t) context->output + batch_index * context->output_batch_stride +
+      output_y_start * output_width * context->output_pixel_stride);
+    for (size_t m = 0; m < project_m; m += context->project_mr) {
+      context->project_ukernel(
+        min(context->project_mr, project_m - m), context->output_channels, expanded_pixel_stride,
+        (const void*) ((uintptr_t) depthwise_output + m * expanded_pixel_stride), expanded_pixel_stride,
+        context->project_weights,
+        (void*) ((uintptr_t) c + m * context->output_pixel_stride), context->output_pixel_stride,
+        context->project_nr * sizeof(float),
+        &context->project_params);
+    }
+  }
+}
+
 void xnn_compute_dwconv2d_chw(
     const struct dwconv2d_context context[restrict XNN_MIN_ELEMENTS(1)],
     size_t batch_index,
@@ -400,6 +870,43 @@ void xnn_compute_dwconv2d_chw(
     &context->params);
 }
 
+void xnn_compute_dwconv2d_chw_dilated(
+    const struct dwconv2d_dilated_context context[restrict XNN_MIN_ELEMENTS(1)],
+    size_t batch_index,
+    size_t channel,
+    size_t output_y_start,
+    size_t channel_range,
+    size_t output_y_range)
+{
+  assert(channel_range == 1);
+
+  // Rows of the padded input above the first input row read by this tile are consumed either by the padding or by
+  // advancing the input pointer.
+  const size_t input_y_start = output_y_start * context->subsampling_height;
+  const size_t input_y_offset = doz(input_y_start, context->input_padding_top);
+  const uint32_t input_padding_top = (uint32_t) doz(context->input_padding_top, input_y_start);
+
+  context->chw_dilated_ukernel(
+    doz(context->input_height, input_y_offset),
+    context->input_width,
+    output_y_range,
+    context->output_width,
+    context->kernel_height,
+    context->kernel_width,
+    context->subsampling_height,
+    context->subsampling_width,
+    context->dilation_height,
+    context->dilation_width,
+    input_padding_top,
+    context->input_padding_left,
+    (const void*) ((uintptr_t) context->input + channel * context->input_channel_stride +
+      batch_index * context->input_batch_stride + input_y_offset * context->input_width),
+    (const void*) ((uintptr_t) context->packed_weights + channel * context->weights_channel_stride),
+    (void*) ((uintptr_t) context->output + channel * context->output_channel_stride +
+      batch_index * context->output_batch_stride + output_y_start * context->output_height_stride),
+    &context->params);
+}
+
 void xnn_compute_depthtospace2d_hwc_contiguous(
     const struct depthtospace2d_hwc_context* context,
     size_t batch_input_y,
@@ -456,6 +963,34 @@ void xnn_compute_depthtospace2d_chw2hwc(
     context->output_channel_stride);
 }
 
+void xnn_compute_spacetodepth2d_hwc(
+    const struct spacetodepth2d_hwc_context* context,
+    size_t batch_input_y,
+    size_t block_x)
+{
+  // Input row batch_input_y is row block_y of the blocks in output row batch_output_y.
+  const size_t block_size = context->block_size;
+  const size_t batch_output_y = batch_input_y / block_size;
+  const size_t block_y = batch_input_y % block_size;
+  const void* input = (const void*) ((uintptr_t) context->input +
+    batch_input_y * context->input_height_stride + block_x * context->input_width_stride);
+  void* output = (void*) ((uintptr_t) context->output +
+    batch_output_y * context->output_height_stride + block_y * context->output_block_row_offset +
+    block_x * context->elements);
+
+  // Gather the pixels of the input row into every output pixel of the output row as a strided copy.
+  context->ukernel(
+    context->output_width,
+    context->elements,
+    0 /* pre padding */,
+    0 /* post padding */,
+    input,
+    context->input_block_stride,
+    output,
+    context->output_width_stride,
+    0 /* fill pattern */);
+}
+
 void xnn_compute_argmax_pooling_unipass(
     const struct argmax_pooling_context context[restrict XNN_MIN_ELEMENTS(1)],
     size_t batch_index,
@@ -677,6 +1212,71 @@ void xnn_compute_global_average_pooling_ncw(
     &context->params);
 }
 
+void xnn_compute_reduce_contiguous(
+    const struct reduce_context context[restrict XNN_MIN_ELEMENTS(1)],
+    size_t index_i,
+    size_t index_j,
+    size_t index_k)
+{
+  const void* input = (const void*) ((uintptr_t) context->input +
+    index_i * context->input_stride[0] + index_j * context->input_stride[1] + index_k * context->input_stride[2]);
+  float* output = (float*) ((uintptr_t) context->output +
+    index_i * context->output_stride[0] + index_j * context->output_stride[1] + index_k * context->output_stride[2]);
+
+  // Partial results of the rows are combined with the vbinary micro-kernel, which may read XNN_EXTRA_BYTES beyond
+  // the single element.
+  float accumulator[1 + XNN_EXTRA_BYTES / sizeof(float)];
+  float row_result[1 + XNN_EXTRA_BYTES / sizeof(float)];
+  bool first_row = true;
+  for (size_t r2 = 0; r2 < context->reduction_size[2]; r2++) {
+    for (size_t r1 = 0; r1 < context->reduction_size[1]; r1++) {
+      for (size_t r0 = 0; r0 < context->reduction_size[0]; r0++) {
+        const float* row = (const float*) ((uintptr_t) input +
+          r2 * context->reduction_stride[2] + r1 * context->reduction_stride[1] + r0 * context->reduction_stride[0]);
+        if (first_row) {
+          context->rreduce_ukernel.rmax(context->scaled_elements, row, &accumulator[0]);
+          first_row = false;
+        } else {
+          context->rreduce_ukernel.rmax(context->scaled_elements, row, &row_result[0]);
+          context->vbinary_ukernel(sizeof(float), accumulator, row_result, accumulator, &context->params);
+        }
+      }
+    }
+  }
+  *output = accumulator[0] * context->scale;
+}
+
+void xnn_compute_reduce_strided(
+    const struct reduce_context context[restrict XNN_MIN_ELEMENTS(1)],
+    size_t index_i,
+    size_t index_j,
+    size_t index_k)
+{
+  const void* input = (const void*) ((uintptr_t) context->input +
+    index_i * context->input_stride[0] + index_j * context->input_stride[1] + index_k * context->input_stride[2]);
+  void* output = (void*) ((uintptr_t) context->output +
+    index_i * context->output_stride[0] + index_j * context->output_stride[1] + index_k * context->output_stride[2]);
+
+  bool first_row = true;
+  for (size_t r2 = 0; r2 < context->reduction_size[2]; r2++) {
+    for (size_t r1 = 0; r1 < context->reduction_size[1]; r1++) {
+      for (size_t r0 = 0; r0 < context->reduction_size[0]; r0++) {
+        const void* row = (const void*) ((uintptr_t) input +
+          r2 * context->reduction_stride[2] + r1 * context->reduction_stride[1] + r0 * context->reduction_stride[0]);
+        if (first_row) {
+          memcpy(output, row, context->scaled_elements);
+          first_row = false;
+        } else {
+          context->vbinary_ukernel(context->scaled_elements, output, row, output, &context->params);
+        }
+      }
+    }
+  }
+  if (context->vscale_ukernel != NULL) {
+    context->vscale_ukernel(context->scaled_elements, output, &context->scale, output, &context->scale_params);
+  }
+}
+
 void xnn_compute_resize_bilinear(
     const struct resize_bilinear_context context[restrict XNN_MIN_ELEMENTS(1)],
     size_t batch_index,
@@ -716,6 +1316,69 @@ void xnn_compute_resize_bilinear_chw(
     context->input_channel_stride);
 }
 
+void xnn_compute_resize_nearest(
+    const struct resize_nearest_context context[restrict XNN_MIN_ELEMENTS(1)],
+    size_t batch_index,
+    size_t output_y)
+{
+  const size_t scaled_channels = context->scaled_channels;
+  const size_t output_pixel_stride = context->output_pixel_stride;
+  const size_t* input_x_offsets = context->input_offsets + context->output_height;
+  const void* input_row = (const void*) ((uintptr_t) context->input +
+    batch_index * context->input_batch_stride + context->input_offsets[output_y]);
+  void* output = (void*) ((uintptr_t) context->output +
+    batch_index * context->output_batch_stride + output_y * context->output_row_stride);
+
+  for (size_t output_x = 0; output_x < context->output_width; output_x++) {
+    memcpy(output, (const void*) ((uintptr_t) input_row + input_x_offsets[output_x]), scaled_channels);
+    output = (void*) ((uintptr_t) output + output_pixel_stride);
+  }
+}
+
+void xnn_compute_resize_nearest_integer(
+    const struct resize_nearest_context context[restrict XNN_MIN_ELEMENTS(1)],
+    size_t batch_index,
+    size_t input_y)
+{
+  const size_t scaled_channels = context->scaled_channels;
+  const size_t input_pixel_stride = context->input_pixel_stride;
+  const size_t output_pixel_stride = context->output_pixel_stride;
+  const size_t output_row_stride = context->output_row_stride;
+  const size_t height_scale = context->height_scale;
+  const size_t width_scale = context->width_scale;
+  const void* input = (const void*) ((uintptr_t) context->input +
+    batch_index * context->input_batch_stride + input_y * context->input_width * input_pixel_stride);
+  void* output_row = (void*) ((uintptr_t) context->output +
+    batch_index * context->output_batch_stride + input_y * height_scale * output_row_stride);
+
+  // Replicate every input pixel width_scale times into the first output row.
+  void* output = output_row;
+  for (size_t input_x = 0; input_x < context->input_width; input_x++) {
+    for (size_t i = 0; i < width_scale; i++) {
+      memcpy(output, input, scaled_channels);
+      output = (void*) ((uintptr_t) output + output_pixel_stride);
+    }
+    input = (const void*) ((uintptr_t) input + input_pixel_stride);
+  }
+
+  // Copy the first output row height_scale - 1 times. Densely packed rows are copied at once, strided rows pixel by
+  // pixel to keep the bytes between output pixels intact.
+  const size_t output_width = context->output_width;
+  for (size_t i = 1; i < height_scale; i++) {
+    void* output_copy = (void*) ((uintptr_t) output_row + i * output_row_stride);
+    if (output_pixel_stride == scaled_channels) {
+      memcpy(output_copy, output_row, output_width * scaled_channels);
+    } else {
+      const void* output_pixel = output_row;
+      for (size_t output_x = 0; output_x < output_width; output_x++) {
+        memcpy(output_copy, output_pixel, scaled_channels);
+        output_pixel = (const void*) ((uintptr_t) output_pixel + output_pixel_stride);
+        output_copy = (void*) ((uintptr_t) output_copy + output_pixel_stride);
+      }
+    }
+  }
+}
+
 void xnn_compute_prelu(
     const struct prelu_context context[restrict XNN_MIN_ELEMENTS(1)],
     size_t batch_start,
@@ -763,6 +1426,130 @@ void xnn_compute_pad_5d(
   }
 }
 
+static void replicate_padding_elements(
+    size_t count,
+    size_t first_index,
+    size_t input_size,
+    uint32_t padding_mode,
+    uint32_t log2_element_size,
+    const void* input,
+    void* output)
+{
+  switch (log2_element_size) {
+    case 0:
+      for (size_t x = 0; x < count; x++) {
+        ((uint8_t*) output)[x] =
+          ((const uint8_t*) input)[xnn_padded_input_index(first_index + x, input_size, padding_mode)];
+      }
+      break;
+    case 1:
+      for (size_t x = 0; x < count; x++) {
+        ((uint16_t*) output)[x] =
+          ((const uint16_t*) input)[xnn_padded_input_index(first_index + x, input_size, padding_mode)];
+      }
+      break;
+    default:
+      assert(log2_element_size == 2);
+      for (size_t x = 0; x < count; x++) {
+        ((uint32_t*) output)[x] =
+          ((const uint32_t*) input)[xnn_padded_input_index(first_index + x, input_size, padding_mode)];
+      }
+      break;
+  }
+}
+
+static uint32_t replicated_fill_pattern(
+    const void* element,
+    uint32_t log2_element_size)
+{
+  switch (log2_element_size) {
+    case 0:
+      return (uint32_t) *((const uint8_t*) element) * UINT32_C(0x01010101);
+    case 1:
+      return (uint32_t) *((const uint16_t*) element) * UINT32_C(0x00010001);
+    default:
+      assert(log2_element_size == 2);
+      return *((const uint32_t*) element);
+  }
+}
+
+void xnn_compute_pad_nd_5d(
+    const struct pad_nd_context context[restrict XNN_MIN_ELEMENTS(1)],
+    size_t i, size_t j, size_t k, size_t l, size_t m)
+{
+  const uint32_t padding_mode = context->padding_mode;
+  const size_t input_i = xnn_padded_input_index(i - context->pre_paddings[5], context->input_size[5], padding_mode);
+  const size_t input_j = xnn_padded_input_index(j - context->pre_paddings[4], context->input_size[4], padding_mode);
+  const size_t input_k = xnn_padded_input_index(k - context->pre_paddings[3], context->input_size[3], padding_mode);
+  const size_t input_l = xnn_padded_input_index(l - context->pre_paddings[2], context->input_size[2], padding_mode);
+  const size_t input_m = xnn_padded_input_index(m - context->pre_paddings[1], context->input_size[1], padding_mode);
+
+  const void* input = (const void*) ((uintptr_t) context->input +
+    input_i * context->input_stride[4] + input_j * context->input_stride[3] + input_k * context->input_stride[2] +
+    input_l * context->input_stride[1] + input_m * context->input_stride[0]);
+  void* output = (void*) ((uintptr_t) context->output +
+    i * context->output_stride[4] + j * context->output_stride[3] + k * context->output_stride[2] + l * context->output_stride[1] + m * context->output_stride[0]);
+
+  const uint32_t log2_element_size = context->log2_element_size;
+  const size_t input_size = context->input_size[0];
+  const size_t pre_padding = context->pre_paddings[0];
+  const size_t post_padding = context->output_size[0] - pre_padding - input_size;
+  void* input_output = (void*) ((uintptr_t) output + (pre_padding << log2_element_size));
+  void* post_output = (void*) ((uintptr_t) input_output + (input_size << log2_element_size));
+
+  context->copy_ukernel(input_size << log2_element_size, input, input_output, NULL);
+  if (padding_mode & XNN_FLAG_EDGE_PADDING) {
+    if (pre_padding != 0) {
+      context->fill_ukernel(
+        1 /* rows */, pre_padding << log2_element_size, output, 0 /* output stride */,
+        replicated_fill_pattern(input, log2_element_size));
+    }
+    if (post_padding != 0) {
+      const void* last_input = (const void*) ((uintptr_t) input + ((input_size - 1) << log2_element_size));
+      context->fill_ukernel(
+        1 /* rows */, post_padding << log2_element_size, post_output, 0 /* output stride */,
+        replicated_fill_pattern(last_input, log2_element_size));
+    }
+  } else {
+    // Reflected padding in the innermost dimension is at most as wide as the input row, and typically only 1-2 elements
+    // wide, so it is gathered element by element.
+    replicate_padding_elements(
+      pre_padding, -pre_padding, input_size, padding_mode, log2_element_size, input, output);
+    replicate_padding_elements(
+      post_padding, input_size, input_size, padding_mode, log2_element_size, input, post_output);
+  }
+}
+
+void xnn_compute_slice_5d_contiguous(
+    const struct slice_context context[restrict XNN_MIN_ELEMENTS(1)],
+    size_t i, size_t j, size_t k, size_t l, size_t m)
+{
+  const void* input = (const void*) ((uintptr_t) context->input +
+    i * context->input_stride[4] + j * context->input_stride[3] + k * context->input_stride[2] + l * context->input_stride[1] + m * context->input_stride[0]);
+  void* output = (void*) ((uintptr_t) context->output +
+    i * context->output_stride[4] + j * context->output_stride[3] + k * context->output_stride[2] + l * context->output_stride[1] + m * context->output_stride[0]);
+
+  context->ukernel(context->inner_size, input, output, NULL);
+}
+
+void xnn_compute_slice_5d_strided(
+    const struct slice_context context[restrict XNN_MIN_ELEMENTS(1)],
+    size_t i, size_t j, size_t k, size_t l, size_t m)
+{
+  const void* input = (const void*) ((uintptr_t) context->input +
+    i * context->input_stride[4] + j * context->input_stride[3] + k * context->input_stride[2] + l * context->input_stride[1] + m * context->input_stride[0]);
+  void* output = (void*) ((uintptr_t) context->output +
+    i * context->output_stride[4] + j * context->output_stride[3] + k * context->output_stride[2] + l * context->output_stride[1] + m * context->output_stride[0]);
+
+  const size_t inner_input_stride = context->inner_input_stride;
+  const size_t element_size = context->element_size;
+  for (size_t n = context->inner_size; n != 0; n--) {
+    context->ukernel(element_size, input, output, NULL);
+    input = (const void*) ((uintptr_t) input + inner_input_stride);
+    output = (void*) ((uintptr_t) output + element_size);
+  }
+}
+
 void xnn_compute_elementwise_binary_5d(
     const struct elementwise_binary_context context[restrict XNN_MIN_ELEMENTS(1)],
     size_t i, size_t j, size_t k, size_t l, size_t m)
@@ -927,6 +1714,7 @@ void xnn_compute_vmulcaddc(
         cm_stride,
         context->cn_stride,
         &context->params);
+    add_gemm_residual(context, group_index, mr_block_start, nr_block_start, mr_block_size, nr_block_size);
   }
 
   void xnn_compute_hmp_gemm(
@@ -951,6 +1739,7 @@ void xnn_compute_vmulcaddc(
         cm_stride,
         context->cn_stride,
         &context->params);
+    add_gemm_residual(context, 0 /* group_index */, mr_block_start, nr_block_start, mr_block_size, nr_block_size);
   }
 
   void xnn_compute_hmp_grouped_batch_igemm(
@@ -963,7 +1752,7 @@ void xnn_compute_vmulcaddc(
       size_t mr_block_size,
       size_t nr_block_size)
   {
-    const size_t ks        = context->ks;
+    const void* compact_a[XNN_MAX_COMPACT_INDIRECTION_TILE_ENTRIES];
     const size_t cm_stride = context->cm_stride;
 
     context->ukernel.function[uarch_index](
@@ -971,7 +1760,7 @@ void xnn_compute_vmulcaddc(
         nr_block_size,
         context->kc,
         context->ks_scaled,
-        (const void**) ((uintptr_t) context->indirect_a + mr_block_start * ks * sizeof(void*)),
+        igemm_indirect_a(context, mr_block_start, compact_a),
         (const void*) ((uintptr_t) context->packed_w + nr_block_start * context->w_stride + group_index * context->gw_stride),
         (void*) ((uintptr_t) context->c + group_index * context->gc_stride + batch_index * context->bc_stride + mr_block_start * cm_stride + (nr_block_start << context->log2_csize)),
         cm_stride,
@@ -979,6 +1768,7 @@ void xnn_compute_vmulcaddc(
         context->a_offset + group_index * context->ga_stride + batch_index * context->ba_stride,
         context->zero,
         &context->params);
+    add_igemm_residual(context, batch_index, group_index, mr_block_start, nr_block_start, mr_block_size, nr_block_size);
   }
 
   void xnn_compute_hmp_grouped_igemm(
@@ -990,7 +1780,7 @@ void xnn_compute_vmulcaddc(
       size_t mr_block_size,
       size_t nr_block_size)
   {
-    const size_t ks        = context->ks;
+    const void* compact_a[XNN_MAX_COMPACT_INDIRECTION_TILE_ENTRIES];
     const size_t cm_stride = context->cm_stride;
 
     context->ukernel.function[uarch_index](
@@ -998,7 +1788,7 @@ void xnn_compute_vmulcaddc(
         nr_block_size,
         context->kc,
         context->ks_scaled,
-        (const void**) ((uintptr_t) context->indirect_a + mr_block_start * ks * sizeof(void*)),
+        igemm_indirect_a(context, mr_block_start, compact_a),
         (const void*) ((uintptr_t) context->packed_w + nr_block_start * context->w_stride + group_index * context->gw_stride),
         (void*) ((uintptr_t) context->c + group_index * context->gc_stride + mr_block_start * cm_stride + (nr_block_start << context->log2_csize)),
         cm_stride,
@@ -1006,6 +1796,8 @@ void xnn_compute_vmulcaddc(
         context->a_offset + group_index * context->ga_stride,
         context->zero,
         &context->params);
+    add_igemm_residual(
+        context, 0 /* batch_index */, group_index, mr_block_start, nr_block_start, mr_block_size, nr_block_size);
   }
 
   void xnn_compute_batch_hmp_igemm(
@@ -1017,7 +1809,7 @@ void xnn_compute_vmulcaddc(
       size_t mr_block_size,
       size_t nr_block_size)
   {
-    const size_t ks        = context->ks;
+    const void* compact_a[XNN_MAX_COMPACT_INDIRECTION_TILE_ENTRIES];
     const size_t cm_stride = context->cm_stride;
 
     context->ukernel.function[uarch_index](
@@ -1025,7 +1817,7 @@ void xnn_compute_vmulcaddc(
         nr_block_size,
         context->kc,
         context->ks_scaled,
-        (const void**) ((uintptr_t) context->indirect_a + mr_block_start * ks * sizeof(void*)),
+        igemm_indirect_a(context, mr_block_start, compact_a),
         (const void*) ((uintptr_t) context->packed_w + nr_block_start * context->w_stride),
         (void*) ((uintptr_t) context->c + batch_index * context->bc_stride + mr_block_start * cm_stride + (nr_block_start << context->log2_csize)),
         cm_stride,
@@ -1033,6 +1825,8 @@ void xnn_compute_vmulcaddc(
         context->a_offset + batch_index * context->ba_stride,
         context->zero,
         &context->params);
+    add_igemm_residual(
+        context, batch_index, 0 /* group_index */, mr_block_start, nr_block_start, mr_block_size, nr_block_size);
   }
 
   void xnn_compute_hmp_igemm(
@@ -1043,7 +1837,7 @@ void xnn_compute_vmulcaddc(
       size_t mr_block_size,
       size_t nr_block_size)
   {
-    const size_t ks        = context->ks;
+    const void* compact_a[XNN_MAX_COMPACT_INDIRECTION_TILE_ENTRIES];
     const size_t cm_stride = context->cm_stride;
 
     context->ukernel.function[uarch_index](
@@ -1051,7 +1845,7 @@ void xnn_compute_vmulcaddc(
         nr_block_size,
         context->kc,
         context->ks_scaled,
-        (const void**) ((uintptr_t) context->indirect_a + mr_block_start * ks * sizeof(void*)),
+        igemm_indirect_a(context, mr_block_start, compact_a),
         (const void*) ((uintptr_t) context->packed_w + nr_block_start * context->w_stride),
         (void*) ((uintptr_t) context->c + mr_block_start * cm_stride + (nr_block_start << context->log2_csize)),
         cm_stride,
@@ -1059,234 +1853,637 @@ void xnn_compute_vmulcaddc(
         context->a_offset,
         context->zero,
         &context->params);
+    add_igemm_residual(
+        context, 0 /* batch_index */, 0 /* group_index */,
+        mr_block_start, nr_block_start, mr_block_size, nr_block_size);
   }
 #endif  // XNN_MAX_UARCH_TYPES > 1
 
-enum xnn_status xnn_run_operator(xnn_operator_t op, pthreadpool_t threadpool)
+static void run_compute(
+    const struct compute_parameters* compute,
+    void* context,
+    pthreadpool_t threadpool,
+    uint32_t flags)
 {
-  if ((xnn_params.init_flags & XNN_INIT_FLAG_XNNPACK) == 0) {
-    xnn_log_error("failed to run operator: XNNPACK is not initialized");
-    return xnn_status_uninitialized;
-  }
-  switch (op->state) {
-    case xnn_run_state_invalid:
-      xnn_log_error("failed to run operator: operator was not successfully setup");
-      return xnn_status_invalid_state;
-    case xnn_run_state_ready:
-      break;
-    case xnn_run_state_skip:
-      return xnn_status_success;
-  }
-
-  uint32_t flags = PTHREADPOOL_FLAG_DISABLE_DENORMALS;
-  if (op->flags & XNN_FLAG_YIELD_WORKERS) {
-    flags |= PTHREADPOOL_FLAG_YIELD_WORKERS;
-  }
-  switch (op->compute.type) {
+  switch (compute->type) {
     case xnn_parallelization_type_invalid:
       break;
     case xnn_parallelization_type_1d:
-      assert(op->compute.range[0] != 0);
+      assert(compute->range[0] != 0);
       pthreadpool_parallelize_1d(
           threadpool,
-          op->compute.task_1d,
-          &op->context,
-          op->compute.range[0],
+          compute->task_1d,
+          context,
+          compute->range[0],
           flags);
       break;
     case xnn_parallelization_type_1d_tile_1d:
-      assert(op->compute.range[0] != 0);
-      assert(op->compute.tile[0] != 0);
+      assert(compute->range[0] != 0);
+      assert(compute->tile[0] != 0);
       pthreadpool_parallelize_1d_tile_1d(
           threadpool,
-          op->compute.task_1d_tile_1d,
-          &op->context,
-          op->compute.range[0],
-          op->compute.tile[0],
+          compute->task_1d_tile_1d,
+          context,
+          compute->range[0],
+          compute->tile[0],
           flags);
       break;
     case xnn_parallelization_type_2d:
-      assert(op->compute.range[0] != 0);
-      assert(op->compute.range[1] != 0);
+      assert(compute->range[0] != 0);
+      assert(compute->range[1] != 0);
       pthreadpool_parallelize_2d(
           threadpool,
-          op->compute.task_2d,
-          &op->context,
-          op->compute.range[0], op->compute.range[1],
+          compute->task_2d,
+          context,
+          compute->range[0], compute->range[1],
           flags);
       break;
     case xnn_parallelization_type_2d_tile_1d:
-      assert(op->compute.range[0] != 0);
-      assert(op->compute.range[1] != 0);
-      assert(op->compute.tile[0] != 0);
+      assert(compute->range[0] != 0);
+      assert(compute->range[1] != 0);
+      assert(compute->tile[0] != 0);
       pthreadpool_parallelize_2d_tile_1d(
           threadpool,
-          op->compute.task_2d_tile_1d,
-          &op->context,
-          op->compute.range[0], op->compute.range[1],
-          op->compute.tile[0],
+          compute->task_2d_tile_1d,
+          context,
+          compute->range[0], compute->range[1],
+          compute->tile[0],
           flags);
       break;
     case xnn_parallelization_type_2d_tile_2d:
-      assert(op->compute.range[0] != 0);
-      assert(op->compute.range[1] != 0);
-      assert(op->compute.tile[0] != 0);
-      assert(op->compute.tile[1] != 0);
+      assert(compute->range[0] != 0);
+      assert(compute->range[1] != 0);
+      assert(compute->tile[0] != 0);
+      assert(compute->tile[1] != 0);
       pthreadpool_parallelize_2d_tile_2d(
           threadpool,
-          op->compute.task_2d_tile_2d,
-          &op->context,
-          op->compute.range[0], op->compute.range[1],
-          op->compute.tile[0], op->compute.tile[1],
+          compute->task_2d_tile_2d,
+          context,
+          compute->range[0], compute->range[1],
+          compute->tile[0], compute->tile[1],
           flags);
       break;
     case xnn_parallelization_type_3d:
-      assert(op->compute.range[0] != 0);
-      assert(op->compute.range[1] != 0);
-      assert(op->compute.range[2] != 0);
+      assert(compute->range[0] != 0);
+      assert(compute->range[1] != 0);
+      assert(compute->range[2] != 0);
       pthreadpool_parallelize_3d(
           threadpool,
-          op->compute.task_3d,
-          &op->context,
-          op->compute.range[0], op->compute.range[1], op->compute.range[2],
+          compute->task_3d,
+          context,
+          compute->range[0], compute->range[1], compute->range[2],
           flags);
       break;
     case xnn_parallelization_type_3d_tile_2d:
-      assert(op->compute.range[0] != 0);
-      assert(op->compute.range[1] != 0);
-      assert(op->compute.range[2] != 0);
-      assert(op->compute.tile[0] != 0);
-      assert(op->compute.tile[1] != 0);
+      assert(compute->range[0] != 0);
+      assert(compute->range[1] != 0);
+      assert(compute->range[2] != 0);
+      assert(compute->tile[0] != 0);
+      assert(compute->tile[1] != 0);
       pthreadpool_parallelize_3d_tile_2d(
           threadpool,
-          op->compute.task_3d_tile_2d,
-          &op->context,
-          op->compute.range[0], op->compute.range[1], op->compute.range[2],
-          op->compute.tile[0], op->compute.tile[1],
+          compute->task_3d_tile_2d,
+          context,
+          compute->range[0], compute->range[1], compute->range[2],
+          compute->tile[0], compute->tile[1],
           flags);
       break;
     case xnn_parallelization_type_4d:
-      assert(op->compute.range[0] != 0);
-      assert(op->compute.range[1] != 0);
-      assert(op->compute.range[2] != 0);
-      assert(op->compute.range[3] != 0);
+      assert(compute->range[0] != 0);
+      assert(compute->range[1] != 0);
+      assert(compute->range[2] != 0);
+      assert(compute->range[3] != 0);
       pthreadpool_parallelize_4d(
           threadpool,
-          op->compute.task_4d,
-          &op->context,
-          op->compute.range[0], op->compute.range[1], op->compute.range[2], op->compute.range[3],
+          compute->task_4d,
+          context,
+          compute->range[0], compute->range[1], compute->range[2], compute->range[3],
           flags);
       break;
     case xnn_parallelization_type_4d_tile_2d:
-      assert(op->compute.range[0] != 0);
-      assert(op->compute.range[1] != 0);
-      assert(op->compute.range[2] != 0);
-      assert(op->compute.range[3] != 0);
-      assert(op->compute.tile[0] != 0);
-      assert(op->compute.tile[1] != 0);
+      assert(compute->range[0] != 0);
+      assert(compute->range[1] != 0);
+      assert(compute->range[2] != 0);
+      assert(compute->range[3] != 0);
+      assert(compute->tile[0] != 0);
+      assert(compute->tile[1] != 0);
       pthreadpool_parallelize_4d_tile_2d(
           threadpool,
-          op->compute.task_4d_tile_2d,
-          &op->context,
-          op->compute.range[0], op->compute.range[1], op->compute.range[2], op->compute.range[3],
-          op->compute.tile[0], op->compute.tile[1],
+          compute->task_4d_tile_2d,
+          context,
+          compute->range[0], compute->range[1], compute->range[2], compute->range[3],
+          compute->tile[0], compute->tile[1],
           flags);
       break;
     case xnn_parallelization_type_5d:
-      assert(op->compute.range[0] != 0);
-      assert(op->compute.range[1] != 0);
-      assert(op->compute.range[2] != 0);
-      assert(op->compute.range[3] != 0);
-      assert(op->compute.range[4] != 0);
+      assert(compute->range[0] != 0);
+      assert(compute->range[1] != 0);
+      assert(compute->range[2] != 0);
+      assert(compute->range[3] != 0);
+      assert(compute->range[4] != 0);
       pthreadpool_parallelize_5d(
           threadpool,
-          op->compute.task_5d,
-          &op->context,
-          op->compute.range[0], op->compute.range[1], op->compute.range[2], op->compute.range[3], op->compute.range[4],
+          compute->task_5d,
+          context,
+          compute->range[0], compute->range[1], compute->range[2], compute->range[3], compute->range[4],
           flags);
       break;
     case xnn_parallelization_type_5d_tile_2d:
-      assert(op->compute.range[0] != 0);
-      assert(op->compute.range[1] != 0);
-      assert(op->compute.range[2] != 0);
-      assert(op->compute.range[3] != 0);
-      assert(op->compute.range[4] != 0);
-      assert(op->compute.tile[0] != 0);
-      assert(op->compute.tile[1] != 0);
+      assert(compute->range[0] != 0);
+      assert(compute->range[1] != 0);
+      assert(compute->range[2] != 0);
+      assert(compute->range[3] != 0);
+      assert(compute->range[4] != 0);
+      assert(compute->tile[0] != 0);
+      assert(compute->tile[1] != 0);
       pthreadpool_parallelize_5d_tile_2d(
           threadpool,
-          op->compute.task_5d_tile_2d,
-          &op->context,
-          op->compute.range[0], op->compute.range[1], op->compute.range[2], op->compute.range[3], op->compute.range[4],
-          op->compute.tile[0], op->compute.tile[1],
+          compute->task_5d_tile_2d,
+          context,
+          compute->range[0], compute->range[1], compute->range[2], compute->range[3], compute->range[4],
+          compute->tile[0], compute->tile[1],
           flags);
       break;
     case xnn_parallelization_type_6d_tile_2d:
-      assert(op->compute.range[0] != 0);
-      assert(op->compute.range[1] != 0);
-      assert(op->compute.range[2] != 0);
-      assert(op->compute.range[3] != 0);
-      assert(op->compute.range[4] != 0);
-      assert(op->compute.range[5] != 0);
-      assert(op->compute.tile[0] != 0);
-      assert(op->compute.tile[1] != 0);
+      assert(compute->range[0] != 0);
+      assert(compute->range[1] != 0);
+      assert(compute->range[2] != 0);
+      assert(compute->range[3] != 0);
+      assert(compute->range[4] != 0);
+      assert(compute->range[5] != 0);
+      assert(compute->tile[0] != 0);
+      assert(compute->tile[1] != 0);
       pthreadpool_parallelize_6d_tile_2d(
           threadpool,
-          op->compute.task_6d_tile_2d,
-          &op->context,
-          op->compute.range[0], op->compute.range[1], op->compute.range[2], op->compute.range[3], op->compute.range[4], op->compute.range[5],
-          op->compute.tile[0], op->compute.tile[1],
+          compute->task_6d_tile_2d,
+          context,
+          compute->range[0], compute->range[1], compute->range[2], compute->range[3], compute->range[4], compute->range[5],
+          compute->tile[0], compute->tile[1],
           flags);
       break;
 #if XNN_MAX_UARCH_TYPES > 1
     case xnn_parallelization_type_2d_tile_2d_with_uarch:
-      assert(op->compute.range[0] != 0);
-      assert(op->compute.range[1] != 0);
-      assert(op->compute.tile[0] != 0);
-      assert(op->compute.tile[1] != 0);
+      assert(compute->range[0] != 0);
+      assert(compute->range[1] != 0);
+      assert(compute->tile[0] != 0);
+      assert(compute->tile[1] != 0);
       pthreadpool_parallelize_2d_tile_2d_with_uarch(
           threadpool,
-          op->compute.task_2d_tile_2d_with_id,
-          &op->context,
+          compute->task_2d_tile_2d_with_id,
+          context,
           0 /* default uarch index */, XNN_MAX_UARCH_TYPES - 1,
-          op->compute.range[0], op->compute.range[1],
-          op->compute.tile[0], op->compute.tile[1],
+          compute->range[0], compute->range[1],
+          compute->tile[0], compute->tile[1],
           flags);
       break;
     case xnn_parallelization_type_3d_tile_2d_with_uarch:
-      assert(op->compute.range[0] != 0);
-      assert(op->compute.range[1] != 0);
-      assert(op->compute.range[2] != 0);
-      assert(op->compute.tile[0] != 0);
-      assert(op->compute.tile[1] != 0);
+      assert(compute->range[0] != 0);
+      assert(compute->range[1] != 0);
+      assert(compute->range[2] != 0);
+      assert(compute->tile[0] != 0);
+      assert(compute->tile[1] != 0);
       pthreadpool_parallelize_3d_tile_2d_with_uarch(
           threadpool,
-          op->compute.task_3d_tile_2d_with_id,
-          &op->context,
+          compute->task_3d_tile_2d_with_id,
+          context,
           0 /* default uarch index */, XNN_MAX_UARCH_TYPES - 1,
-          op->compute.range[0], op->compute.range[1], op->compute.range[2],
-          op->compute.tile[0], op->compute.tile[1],
+          compute->range[0], compute->range[1], compute->range[2],
+          compute->tile[0], compute->tile[1],
           flags);
       break;
     case xnn_parallelization_type_4d_tile_2d_with_uarch:
-      assert(op->compute.range[0] != 0);
-      assert(op->compute.range[1] != 0);
-      assert(op->compute.range[2] != 0);
-      assert(op->compute.range[3] != 0);
-      assert(op->compute.tile[0] != 0);
-      assert(op->compute.tile[1] != 0);
+      assert(compute->range[0] != 0);
+      assert(compute->range[1] != 0);
+      assert(compute->range[2] != 0);
+      assert(compute->range[3] != 0);
+      assert(compute->tile[0] != 0);
+      assert(compute->tile[1] != 0);
       pthreadpool_parallelize_4d_tile_2d_with_uarch(
           threadpool,
-          op->compute.task_4d_tile_2d_with_id,
-          &op->context,
+          compute->task_4d_tile_2d_with_id,
+          context,
           0 /* default uarch index */, XNN_MAX_UARCH_TYPES - 1,
-          op->compute.range[0], op->compute.range[1], op->compute.range[2], op->compute.range[3],
-          op->compute.tile[0], op->compute.tile[1],
+          compute->range[0], compute->range[1], compute->range[2], compute->range[3],
+          compute->tile[0], compute->tile[1],
           flags);
       break;
 #endif  // XNN_MAX_UARCH_TYPES > 1
     default:
       XNN_UNREACHABLE;
   }
+}
+
+void xnn_pack_operator_weights(xnn_operator_t op, pthreadpool_t threadpool)
+{
+  for (size_t i = 0; i < XNN_COUNT_OF(op->fused_operators); i++) {
+    if (op->fused_operators[i] != NULL) {
+      xnn_pack_operator_weights(op->fused_operators[i], threadpool);
+    }
+  }
+  if (!op->weights_packing_pending) {
+    return;
+  }
+
+  const struct pack_gemm_context* context = &op->context.pack_gemm;
+  const size_t work = xnn_estimate_work(0, (double) context->groups * context->packed_g_stride);
+  const size_t num_threads = pthreadpool_get_threads_count(threadpool);
+  const size_t max_tiles = xnn_compute_max_tiles(work, num_threads);
+  const size_t nc_block_size =
+    xnn_compute_tile_size(context->nc, context->nr, divide_round_up(max_tiles, context->groups));
+  if (xnn_compute_num_useful_threads(work, num_threads) == 1) {
+    threadpool = NULL;
+  }
+  pthreadpool_parallelize_2d_tile_1d(
+    threadpool,
+    (pthreadpool_task_2d_tile_1d_t) xnn_compute_pack_gemm,
+    (void*) context,
+    context->groups, context->nc,
+    nc_block_size,
+    PTHREADPOOL_FLAG_DISABLE_DENORMALS);
+  op->weights_packing_pending = false;
+}
+
+// Copy frames of channel_size bytes between NWC sequences with different frame strides.
+static void copy_frames(
+  size_t frames,
+  size_t channel_size,
+  const void* input,
+  size_t input_stride,
+  void* output,
+  size_t output_stride)
+{
+  if (frames != 0 && input_stride == channel_size && output_stride == channel_size) {
+    memcpy(output, input, frames * channel_size);
+    return;
+  }
+  for (size_t i = 0; i < frames; i++) {
+    memcpy(output, input, channel_size);
+    input = (const void*) ((uintptr_t) input + input_stride);
+    output = (void*) ((uintptr_t) output + output_stride);
+  }
+}
+
+// Concatenate the history and the new input chunk of every sequence of a streaming 1D Convolution in the staging
+// buffer, which the convolution reads from.
+static void stage_streaming_input(xnn_operator_t op)
+{
+  const size_t channel_size = op->groups * op->group_input_channels * sizeof(float);
+  const size_t pixel_stride = op->input_pixel_stride * sizeof(float);
+  const size_t history_frames = op->streaming.history_frames;
+  const size_t input_frames = op->streaming.input_frames;
+  for (size_t i = 0; i < op->streaming.batch_size; i++) {
+    void* staging = (void*) ((uintptr_t) op->streaming.staging + i * (history_frames + input_frames) * pixel_stride);
+    copy_frames(
+      history_frames, channel_size,
+      (const void*) ((uintptr_t) op->streaming.history + i * op->streaming.history_capacity * channel_size), channel_size,
+      staging, pixel_stride);
+    copy_frames(
+      input_frames, channel_size,
+      (const void*) ((uintptr_t) op->streaming.input + i * input_frames * pixel_stride), pixel_stride,
+      (void*) ((uintptr_t) staging + history_frames * pixel_stride), pixel_stride);
+  }
+}
+
+// Retain the frames of every sequence of a streaming 1D Convolution which were not consumed by the outputs of this run:
+// the next output window starts at frame consumed_frames of the history and input chunk concatenation.
+static void retain_streaming_history(xnn_operator_t op)
+{
+  const size_t channel_size = op->groups * op->group_input_channels * sizeof(float);
+  const size_t pixel_stride = op->input_pixel_stride * sizeof(float);
+  const size_t available_frames = op->streaming.history_frames + op->streaming.input_frames;
+  const size_t consumed_frames = op->streaming.consumed_frames;
+  const size_t retained_frames = available_frames - consumed_frames;
+  assert(retained_frames <= op->streaming.history_capacity);
+  // Unstaged sequences have no history: the frames are read from the input chunk.
+  const void* source = op->streaming.staged ? op->streaming.staging : op->streaming.input;
+  for (size_t i = 0; i < op->streaming.batch_size; i++) {
+    copy_frames(
+      retained_frames, channel_size,
+      (const void*) ((uintptr_t) source + (i * available_frames + consumed_frames) * pixel_stride), pixel_stride,
+      (void*) ((uintptr_t) op->streaming.history + i * op->streaming.history_capacity * channel_size), channel_size);
+  }
+  op->streaming.history_frames = retained_frames;
+}
+
+static void get_parallelization_dims(
+  enum xnn_parallelization_type type,
+  size_t* num_dims_out,
+  size_t* num_tiled_dims_out)
+{
+  size_t num_dims = 0;
+  size_t num_tiled_dims = 0;
+  switch (type) {
+    case xnn_parallelization_type_invalid:
+      break;
+    case xnn_parallelization_type_1d:
+      num_dims = 1;
+      break;
+    case xnn_parallelization_type_1d_tile_1d:
+      num_dims = 1;
+      num_tiled_dims = 1;
+      break;
+    case xnn_parallelization_type_2d:
+      num_dims = 2;
+      break;
+    case xnn_parallelization_type_2d_tile_1d:
+      num_dims = 2;
+      num_tiled_dims = 1;
+      break;
+    case xnn_parallelization_type_2d_tile_2d:
+#if XNN_MAX_UARCH_TYPES > 1
+    case xnn_parallelization_type_2d_tile_2d_with_uarch:
+#endif  // XNN_MAX_UARCH_TYPES > 1
+      num_dims = 2;
+      num_tiled_dims = 2;
+      break;
+    case xnn_parallelization_type_3d:
+      num_dims = 3;
+      break;
+    case xnn_parallelization_type_3d_tile_2d:
+#if XNN_MAX_UARCH_TYPES > 1
+    case xnn_parallelization_type_3d_tile_2d_with_uarch:
+#endif  // XNN_MAX_UARCH_TYPES > 1
+      num_dims = 3;
+      num_tiled_dims = 2;
+      break;
+    case xnn_parallelization_type_4d:
+      num_dims = 4;
+      break;
+    case xnn_parallelization_type_4d_tile_2d:
+#if XNN_MAX_UARCH_TYPES > 1
+    case xnn_parallelization_type_4d_tile_2d_with_uarch:
+#endif  // XNN_MAX_UARCH_TYPES > 1
+      num_dims = 4;
+      num_tiled_dims = 2;
+      break;
+    case xnn_parallelization_type_5d:
+      num_dims = 5;
+      break;
+    case xnn_parallelization_type_5d_tile_2d:
+      num_dims = 5;
+      num_tiled_dims = 2;
+      break;
+    case xnn_parallelization_type_6d_tile_2d:
+      num_dims = 6;
+      num_tiled_dims = 2;
+      break;
+    default:
+      XNN_UNREACHABLE;
+  }
+  *num_dims_out = num_dims;
+  *num_tiled_dims_out = num_tiled_dims;
+}
+
+size_t xnn_get_operator_task_count(
+  const struct xnn_operator* op,
+  const struct compute_parameters* compute)
+{
+  if (op->state != xnn_run_state_ready) {
+    return 0;
+  }
+
+  size_t num_dims, num_tiled_dims;
+  get_parallelization_dims(compute->type, &num_dims, &num_tiled_dims);
+  if (num_dims == 0) {
+    return 0;
+  }
+
+  const size_t first_tiled_dim = num_dims - num_tiled_dims;
+  size_t num_tasks = 1;
+  for (size_t d = 0; d < num_dims; d++) {
+    assert(compute->range[d] != 0);
+    if (d >= first_tiled_dim) {
+      assert(compute->tile[d - first_tiled_dim] != 0);
+      num_tasks *= divide_round_up(compute->range[d], compute->tile[d - first_tiled_dim]);
+    } else {
+      num_tasks *= compute->range[d];
+    }
+  }
+  return num_tasks;
+}
+
+static void run_operator_tasks(
+  xnn_operator_t op,
+  const struct compute_parameters* compute,
+  uint32_t uarch_index,
+  size_t task_start,
+  size_t task_count)
+{
+  size_t num_dims, num_tiled_dims;
+  get_parallelization_dims(compute->type, &num_dims, &num_tiled_dims);
+  const size_t first_tiled_dim = num_dims - num_tiled_dims;
+
+  for (size_t task = task_start; task < task_start + task_count; task++) {
+    // Decompose the linear task index into per-dimension indices, with the last dimension varying fastest, in the
+    // same order pthreadpool_parallelize_* would traverse the range.
+    size_t index[6] = { 0 };
+    size_t tile[2] = { 0 };
+    size_t remainder = task;
+    for (size_t d = num_dims; d-- != 0; ) {
+      if (d >= first_tiled_dim) {
+        const size_t t = d - first_tiled_dim;
+        const size_t num_tiles = divide_round_up(compute->range[d], compute->tile[t]);
+        index[d] = (remainder % num_tiles) * compute->tile[t];
+        remainder /= num_tiles;
+        tile[t] = min(compute->tile[t], compute->range[d] - index[d]);
+      } else {
+        index[d] = remainder % compute->range[d];
+        remainder /= compute->range[d];
+      }
+    }
+
+    switch (compute->type) {
+      case xnn_parallelization_type_1d:
+        compute->task_1d(&op->context, index[0]);
+        break;
+      case xnn_parallelization_type_1d_tile_1d:
+        compute->task_1d_tile_1d(&op->context, index[0], tile[0]);
+        break;
+      case xnn_parallelization_type_2d:
+        compute->task_2d(&op->context, index[0], index[1]);
+        break;
+      case xnn_parallelization_type_2d_tile_1d:
+        compute->task_2d_tile_1d(&op->context, index[0], index[1], tile[0]);
+        break;
+      case xnn_parallelization_type_2d_tile_2d:
+        compute->task_2d_tile_2d(&op->context, index[0], index[1], tile[0], tile[1]);
+        break;
+      case xnn_parallelization_type_3d:
+        compute->task_3d(&op->context, index[0], index[1], index[2]);
+        break;
+      case xnn_parallelization_type_3d_tile_2d:
+        compute->task_3d_tile_2d(&op->context, index[0], index[1], index[2], tile[0], tile[1]);
+        break;
+      case xnn_parallelization_type_4d:
+        compute->task_4d(&op->context, index[0], index[1], index[2], index[3]);
+        break;
+      case xnn_parallelization_type_4d_tile_2d:
+        compute->task_4d_tile_2d(&op->context, index[0], index[1], index[2], index[3], tile[0], tile[1]);
+        break;
+      case xnn_parallelization_type_5d:
+        compute->task_5d(&op->context, index[0], index[1], index[2], index[3], index[4]);
+        break;
+      case xnn_parallelization_type_5d_tile_2d:
+        compute->task_5d_tile_2d(&op->context, index[0], index[1], index[2], index[3], index[4], tile[0], tile[1]);
+        break;
+      case xnn_parallelization_type_6d_tile_2d:
+        compute->task_6d_tile_2d(&op->context,
+          index[0], index[1], index[2], index[3], index[4], index[5], tile[0], tile[1]);
+        break;
+#if XNN_MAX_UARCH_TYPES > 1
+      case xnn_parallelization_type_2d_tile_2d_with_uarch:
+        compute->task_2d_tile_2d_with_id(&op->context, uarch_index,
+          index[0], index[1], tile[0], tile[1]);
+        break;
+      case xnn_parallelization_type_3d_tile_2d_with_uarch:
+        compute->task_3d_tile_2d_with_id(&op->context, uarch_index,
+          index[0], index[1], index[2], tile[0], tile[1]);
+        break;
+      case xnn_parallelization_type_4d_tile_2d_with_uarch:
+        compute->task_4d_tile_2d_with_id(&op->context, uarch_index,
+          index[0], index[1], index[2], index[3], tile[0], tile[1]);
+        break;
+#endif  // XNN_MAX_UARCH_TYPES > 1
+      default:
+        XNN_UNREACHABLE;
+    }
+  }
+}
+
+void xnn_run_operator_tasks(
+  xnn_operator_t op,
+  const struct compute_parameters* compute,
+  size_t task_start,
+  size_t task_count)
+{
+  // Worker threads of a persistent parallel region do not know their microarchitecture, use the default one.
+  run_operator_tasks(op, compute, 0 /* default uarch index */, task_start, task_count);
+}
+
+// One pass of an operator restricted to fewer threads than the thread pool has: pthreadpool runs every item on a single
+// thread, so dispatching one item per allowed thread caps the parallelism, and every item runs an equal share of the
+// linearized tasks of the pass.
+struct capped_compute_context {
+  xnn_operator_t op;
+  const struct compute_parameters* compute;
+  size_t num_tasks;
+  size_t num_threads;
+};
+
+static void run_capped_compute_share(
+  const struct capped_compute_context* context,
+  size_t thread_index)
+{
+  const size_t task_start = thread_index * context->num_tasks / context->num_threads;
+  const size_t task_end = (thread_index + 1) * context->num_tasks / context->num_threads;
+  xnn_run_operator_tasks(context->op, context->compute, task_start, task_end - task_start);
+}
+
+#if XNN_MAX_UARCH_TYPES > 1
+static void run_capped_compute_share_with_uarch(
+  const struct capped_compute_context* context,
+  uint32_t uarch_index,
+  size_t thread_index)
+{
+  const size_t task_start = thread_index * context->num_tasks / context->num_threads;
+  const size_t task_end = (thread_index + 1) * context->num_tasks / context->num_threads;
+  run_operator_tasks(context->op, context->compute, uarch_index, task_start, task_end - task_start);
+}
+#endif  // XNN_MAX_UARCH_TYPES > 1
+
+// Run one pass of an operator on at most compute->num_threads threads of the thread pool.
+static void run_operator_pass(
+  xnn_operator_t op,
+  const struct compute_parameters* compute,
+  pthreadpool_t threadpool,
+  uint32_t flags)
+{
+  const size_t num_threads = compute->num_threads;
+  if (num_threads == 1) {
+    // Operators too small to keep several threads busy run on the calling thread.
+    run_compute(compute, &op->context, NULL, flags);
+    return;
+  }
+  if (num_threads == 0 || num_threads >= pthreadpool_get_threads_count(threadpool)) {
+    run_compute(compute, &op->context, threadpool, flags);
+    return;
+  }
+
+  const struct capped_compute_context context = {
+    .op = op,
+    .compute = compute,
+    .num_tasks = xnn_get_operator_task_count(op, compute),
+    .num_threads = num_threads,
+  };
+  #if XNN_MAX_UARCH_TYPES > 1
+    switch (compute->type) {
+      case xnn_parallelization_type_2d_tile_2d_with_uarch:
+      case xnn_parallelization_type_3d_tile_2d_with_uarch:
+      case xnn_parallelization_type_4d_tile_2d_with_uarch:
+        pthreadpool_parallelize_1d_with_uarch(
+          threadpool,
+          (pthreadpool_task_1d_with_id_t) run_capped_compute_share_with_uarch,
+          (void*) &context,
+          0 /* default uarch index */, XNN_MAX_UARCH_TYPES - 1,
+          num_threads,
+          flags);
+        return;
+      default:
+        break;
+    }
+  #endif  // XNN_MAX_UARCH_TYPES > 1
+  pthreadpool_parallelize_1d(
+    threadpool,
+    (pthreadpool_task_1d_t) run_capped_compute_share,
+    (void*) &context,
+    num_threads,
+    flags);
+}
+
+enum xnn_status xnn_run_operator(xnn_operator_t op, pthreadpool_t threadpool)
+{
+  if ((xnn_params.init_flags & XNN_INIT_FLAG_XNNPACK) == 0) {
+    xnn_log_error("failed to run operator: XNNPACK is not initialized");
+    return xnn_status_uninitialized;
+  }
+  switch (op->state) {
+    case xnn_run_state_invalid:
+      xnn_log_error("failed to run operator: operator was not successfully setup");
+      return xnn_status_invalid_state;
+    case xnn_run_state_ready:
+      break;
+    case xnn_run_state_skip:
+      return xnn_status_success;
+  }
+
+  uint32_t flags = PTHREADPOOL_FLAG_DISABLE_DENORMALS;
+  if (op->flags & XNN_FLAG_YIELD_WORKERS) {
+    flags |= PTHREADPOOL_FLAG_YIELD_WORKERS;
+  }
+  const bool streaming = op->type == xnn_operator_type_convolution_nwc_f32 && (op->flags & XNN_FLAG_STREAMING) != 0;
+  if (streaming) {
+    if (op->streaming.staged) {
+      stage_streaming_input(op);
+    }
+    // Chunks too short to complete an output window only extend the history.
+    if (op->streaming.output_frames == 0) {
+      retain_streaming_history(op);
+      op->state = xnn_run_state_invalid;
+      return xnn_status_success;
+    }
+  }
+
+  run_operator_pass(op, &op->compute, threadpool, flags);
+  // Some operators, e.g. GEMM with split reduction dimension, finish the computation in a second pass, which depends on
+  // the results of the first one.
+  if (op->compute2.type != xnn_parallelization_type_invalid) {
+    run_operator_pass(op, &op->compute2, threadpool, flags);
+  }
+
+  if (streaming) {
+    // The history advances with every run, so the next chunk needs a new setup.
+    retain_streaming_history(op);
+    op->state = xnn_run_state_invalid;
+  }
   return xnn_status_success;
 }
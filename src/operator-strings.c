@@ -30,8 +30,12 @@ const char* xnn_operator_type_to_string(enum xnn_operator_type type) {
       return "Add (ND, QU8)";
     case xnn_operator_type_argmax_pooling_nhwc_f32:
       return "ArgMax Pooling (NHWC, F32)";
+    case xnn_operator_type_average_pooling_nhwc_f16:
+      return "Average Pooling (NHWC, F16)";
     case xnn_operator_type_average_pooling_nhwc_f32:
       return "Average Pooling (NHWC, F32)";
+    case xnn_operator_type_average_pooling_nhwc_qs8:
+      return "Average Pooling (NHWC, QS8)";
     case xnn_operator_type_average_pooling_nhwc_qu8:
       return "Average Pooling (NHWC, QU8)";
     case xnn_operator_type_bankers_rounding_nc_f32:
@@ -78,6 +82,8 @@ const char* xnn_operator_type_to_string(enum xnn_operator_type type) {
       return "Convolution (NHWC, QS8)";
     case xnn_operator_type_convolution_nhwc_qu8:
       return "Convolution (NHWC, QU8)";
+    case xnn_operator_type_convolution_nwc_f32:
+      return "Convolution (NWC, F32)";
     case xnn_operator_type_convolution_nchw_f32:
       return "Convolution (NCHW, F32)";
     case xnn_operator_type_copy_nc_x8:
@@ -128,12 +134,16 @@ const char* xnn_operator_type_to_string(enum xnn_operator_type type) {
       return "HardSwish (NC, F16)";
     case xnn_operator_type_hardswish_nc_f32:
       return "HardSwish (NC, F32)";
+    case xnn_operator_type_inverted_bottleneck_nhwc_f32:
+      return "Inverted Bottleneck (NHWC, F32)";
     case xnn_operator_type_leaky_relu_nc_f16:
       return "Leaky ReLU (NC, F16)";
     case xnn_operator_type_leaky_relu_nc_f32:
       return "Leaky ReLU (NC, F32)";
     case xnn_operator_type_leaky_relu_nc_qu8:
       return "Leaky ReLU (NC, QU8)";
+    case xnn_operator_type_max_nd_f32:
+      return "Max (ND, F32)";
     case xnn_operator_type_max_pooling_nhwc_f16:
       return "Max Pooling (NHWC, F16)";
     case xnn_operator_type_max_pooling_nhwc_f32:
@@ -144,6 +154,14 @@ const char* xnn_operator_type_to_string(enum xnn_operator_type type) {
       return "Max Pooling (NHWC, U8)";
     case xnn_operator_type_maximum_nd_f32:
       return "Maximum (ND, F32)";
+    case xnn_operator_type_mean_nd_f16:
+      return "Mean (ND, F16)";
+    case xnn_operator_type_mean_nd_f32:
+      return "Mean (ND, F32)";
+    case xnn_operator_type_mean_nd_qs8:
+      return "Mean (ND, QS8)";
+    case xnn_operator_type_min_nd_f32:
+      return "Min (ND, F32)";
     case xnn_operator_type_minimum_nd_f32:
       return "Minimum (ND, F32)";
     case xnn_operator_type_multiply_nd_f16:
@@ -156,6 +174,12 @@ const char* xnn_operator_type_to_string(enum xnn_operator_type type) {
       return "Multiply (ND, QU8)";
     case xnn_operator_type_negate_nc_f32:
       return "Negate (NC, F32)";
+    case xnn_operator_type_pad_nd_x8:
+      return "Pad (ND, X8)";
+    case xnn_operator_type_pad_nd_x16:
+      return "Pad (ND, X16)";
+    case xnn_operator_type_pad_nd_x32:
+      return "Pad (ND, X32)";
     case xnn_operator_type_prelu_nc_f16:
       return "PReLU (NC, F16)";
     case xnn_operator_type_prelu_nc_f32:
@@ -170,16 +194,34 @@ const char* xnn_operator_type_to_string(enum xnn_operator_type type) {
       return "Resize Bilinear (NHWC, U8)";
     case xnn_operator_type_resize_bilinear_nchw_f32:
       return "Resize Bilinear (NCHW, F32)";
+    case xnn_operator_type_resize_nearest_nhwc_x8:
+      return "Resize Nearest (NHWC, X8)";
+    case xnn_operator_type_resize_nearest_nhwc_x16:
+      return "Resize Nearest (NHWC, X16)";
+    case xnn_operator_type_resize_nearest_nhwc_x32:
+      return "Resize Nearest (NHWC, X32)";
     case xnn_operator_type_sigmoid_nc_f32:
       return "Sigmoid (NC, F32)";
     case xnn_operator_type_sigmoid_nc_qs8:
       return "Sigmoid (NC, QS8)";
     case xnn_operator_type_sigmoid_nc_qu8:
       return "Sigmoid (NC, QU8)";
+    case xnn_operator_type_slice_nd_x8:
+      return "Slice (ND, X8)";
+    case xnn_operator_type_slice_nd_x16:
+      return "Slice (ND, X16)";
+    case xnn_operator_type_slice_nd_x32:
+      return "Slice (ND, X32)";
     case xnn_operator_type_softmax_nc_f32:
       return "Softmax (NC, F32)";
     case xnn_operator_type_softmax_nc_qu8:
       return "Softmax (NC, QU8)";
+    case xnn_operator_type_space_to_depth_nhwc_x8:
+      return "Space To Depth (NHWC, X8)";
+    case xnn_operator_type_space_to_depth_nhwc_x16:
+      return "Space To Depth (NHWC, X16)";
+    case xnn_operator_type_space_to_depth_nhwc_x32:
+      return "Space To Depth (NHWC, X32)";
     case xnn_operator_type_square_nc_f32:
       return "Square (NC, F32)";
     case xnn_operator_type_square_root_nc_f32:
@@ -192,6 +234,12 @@ const char* xnn_operator_type_to_string(enum xnn_operator_type type) {
       return "Subtract (ND, QS8)";
     case xnn_operator_type_subtract_nd_qu8:
       return "Subtract (ND, QU8)";
+    case xnn_operator_type_sum_nd_f16:
+      return "Sum (ND, F16)";
+    case xnn_operator_type_sum_nd_f32:
+      return "Sum (ND, F32)";
+    case xnn_operator_type_sum_nd_qs8:
+      return "Sum (ND, QS8)";
     case xnn_operator_type_tanh_nc_qs8:
       return "Tanh (NC, QS8)";
     case xnn_operator_type_tanh_nc_qu8:
@@ -231,7 +231,8 @@ enum xnn_status xnn_setup_argmax_pooling2d_nhwc_f32(
     const size_t indirection_buffer_size = sizeof(void*) * ((mr - 1) + output_height * step_height);
 
     const void** indirection_buffer =
-      (const void**) xnn_reallocate_memory(argmax_pooling_op->indirection_buffer, indirection_buffer_size);
+      (const void**) xnn_reallocate_tagged_memory(
+        xnn_memory_category_indirection, argmax_pooling_op->indirection_buffer, indirection_buffer_size);
     if (indirection_buffer == NULL) {
       xnn_log_error(
         "failed to allocate %zu bytes for %s operator indirection buffer",
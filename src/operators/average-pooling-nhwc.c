@@ -14,6 +14,8 @@
 #include <stdlib.h>
 #include <string.h>
 
+#include <fp16.h>
+
 #include <xnnpack.h>
 #include <xnnpack/allocator.h>
 #include <xnnpack/operator.h>
@@ -183,7 +185,7 @@ enum xnn_status xnn_create_average_pooling2d_nhwc_qu8(
   }
 
   const size_t zero_bytes = channels * sizeof(uint8_t) + XNN_EXTRA_BYTES;
-  void* zero_buffer = xnn_allocate_simd_memory(zero_bytes);
+  void* zero_buffer = xnn_allocate_tagged_simd_memory(xnn_memory_category_zero_buffer, zero_bytes);
   if (zero_buffer == NULL) {
     xnn_log_error(
       "failed to allocate %zu bytes for %s operator zero padding",
@@ -237,6 +239,377 @@ error:
   return status;
 }
 
+enum xnn_status xnn_create_average_pooling2d_nhwc_qs8(
+    uint32_t input_padding_top,
+    uint32_t input_padding_right,
+    uint32_t input_padding_bottom,
+    uint32_t input_padding_left,
+    uint32_t pooling_height,
+    uint32_t pooling_width,
+    uint32_t stride_height,
+    uint32_t stride_width,
+    size_t channels,
+    size_t input_pixel_stride,
+    size_t output_pixel_stride,
+    int8_t input_zero_point,
+    float input_scale,
+    int8_t output_zero_point,
+    float output_scale,
+    int8_t output_min,
+    int8_t output_max,
+    uint32_t flags,
+    xnn_operator_t* average_pooling_op_out)
+{
+  xnn_operator_t average_pooling_op = NULL;
+  enum xnn_status status = xnn_status_uninitialized;
+
+  if ((xnn_params.init_flags & XNN_INIT_FLAG_XNNPACK) == 0) {
+    xnn_log_error("failed to create %s operator: XNNPACK is not initialized",
+      xnn_operator_type_to_string(xnn_operator_type_average_pooling_nhwc_qs8));
+    goto error;
+  }
+
+  status = xnn_status_invalid_parameter;
+
+  const uint32_t pooling_size = pooling_height * pooling_width;
+  if (pooling_size == 0) {
+    xnn_log_error(
+      "failed to create %s operator with %" PRIu32 "x%" PRIu32 " pooling size: "
+      "pooling size dimensions must be non-zero",
+      xnn_operator_type_to_string(xnn_operator_type_average_pooling_nhwc_qs8), pooling_width, pooling_height);
+    goto error;
+  }
+
+  if (pooling_size == 1) {
+    xnn_log_error(
+      "failed to create %s operator with 1 pooling element: 1x1 pooling is meaningless",
+      xnn_operator_type_to_string(xnn_operator_type_average_pooling_nhwc_qs8));
+    goto error;
+  }
+
+  if (stride_height == 0 || stride_width == 0) {
+    xnn_log_error(
+      "failed to create %s operator with %" PRIu32 "x%" PRIu32 " stride: stride dimensions must be non-zero",
+      xnn_operator_type_to_string(xnn_operator_type_average_pooling_nhwc_qs8), stride_width, stride_height);
+    goto error;
+  }
+
+  if (channels == 0) {
+    xnn_log_error(
+      "failed to create %s operator with %zu channels: number of channels must be non-zero",
+      xnn_operator_type_to_string(xnn_operator_type_average_pooling_nhwc_qs8), channels);
+    goto error;
+  }
+
+  if (input_pixel_stride < channels) {
+    xnn_log_error(
+      "failed to create %s operator with input pixel stride of %zu: "
+      "stride must be at least as large as the number of channels (%zu)",
+      xnn_operator_type_to_string(xnn_operator_type_average_pooling_nhwc_qs8), input_pixel_stride, channels);
+    goto error;
+  }
+
+  if (output_pixel_stride < channels) {
+    xnn_log_error(
+      "failed to create %s operator with output pixel stride of %zu: "
+      "stride must be at least as large as the number of channels (%zu)",
+      xnn_operator_type_to_string(xnn_operator_type_average_pooling_nhwc_qs8), output_pixel_stride, channels);
+    goto error;
+  }
+
+  if (input_scale <= 0.0f || !isnormal(input_scale)) {
+    xnn_log_error(
+      "failed to create %s operator with %.7g input scale: scale must be finite, normalized, and positive",
+      xnn_operator_type_to_string(xnn_operator_type_average_pooling_nhwc_qs8), input_scale);
+    goto error;
+  }
+
+  if (output_scale <= 0.0f || !isnormal(output_scale)) {
+    xnn_log_error(
+      "failed to create %s operator with %.7g output scale: scale must be finite, normalized, and positive",
+      xnn_operator_type_to_string(xnn_operator_type_average_pooling_nhwc_qs8), output_scale);
+    goto error;
+  }
+
+  if (output_min >= output_max) {
+    xnn_log_error(
+      "failed to create %s operator with [%" PRId8 ", %" PRId8 "] output range: range min must be below range max",
+      xnn_operator_type_to_string(xnn_operator_type_average_pooling_nhwc_qs8), output_min, output_max);
+    goto error;
+  }
+
+  const bool any_padding = (input_padding_left | input_padding_top | input_padding_right | input_padding_bottom) != 0;
+  if ((flags & XNN_FLAG_TENSORFLOW_SAME_PADDING) != 0) {
+    if (any_padding) {
+      xnn_log_error(
+        "failed to create %s operator with %" PRIu32 "+%" PRIu32 "x%" PRIu32 "+%" PRIu32" padding: "
+        "TensorFlow SAME padding can't be combined with explicit padding specification",
+        xnn_operator_type_to_string(xnn_operator_type_average_pooling_nhwc_qs8),
+        input_padding_top, input_padding_left, input_padding_bottom, input_padding_right);
+      goto error;
+    }
+  }
+
+  status = xnn_status_unsupported_parameter;
+
+  const float input_output_scale = input_scale / output_scale;
+  if (input_output_scale < 0x1.0p-8f || input_output_scale >= 0x1.0p+8f) {
+    xnn_log_error(
+      "failed to create %s operator with %.7g input scale and %.7g output scale: "
+      "input-to-output scale ratio (%.7f) must be in [2**-8, 2**8) range",
+      xnn_operator_type_to_string(xnn_operator_type_average_pooling_nhwc_qs8),
+      input_scale, output_scale, input_output_scale);
+    goto error;
+  }
+
+  if (pooling_size >= 16777216) {
+    xnn_log_error(
+      "failed to create %s operator with %"PRIu32" (%" PRIu32 "x%" PRIu32 ") pooling elements: "
+      "the number of elements in the pooling area must be below 2**24",
+      xnn_operator_type_to_string(xnn_operator_type_average_pooling_nhwc_qs8),
+      pooling_size, pooling_width, pooling_height);
+    goto error;
+  }
+
+  status = xnn_status_out_of_memory;
+
+  average_pooling_op = xnn_allocate_zero_simd_memory(sizeof(struct xnn_operator));
+  if (average_pooling_op == NULL) {
+    xnn_log_error(
+      "failed to allocate %zu bytes for %s operator descriptor",
+      sizeof(struct xnn_operator), xnn_operator_type_to_string(xnn_operator_type_average_pooling_nhwc_qs8));
+    goto error;
+  }
+
+  const size_t zero_bytes = channels * sizeof(int8_t) + XNN_EXTRA_BYTES;
+  void* zero_buffer = xnn_allocate_tagged_simd_memory(xnn_memory_category_zero_buffer, zero_bytes);
+  if (zero_buffer == NULL) {
+    xnn_log_error(
+      "failed to allocate %zu bytes for %s operator zero padding",
+      zero_bytes, xnn_operator_type_to_string(xnn_operator_type_average_pooling_nhwc_qs8));
+    goto error;
+  }
+  memset(zero_buffer, input_zero_point, channels * sizeof(int8_t));
+  average_pooling_op->zero_buffer = zero_buffer;
+
+  average_pooling_op->padding_top = input_padding_top;
+  average_pooling_op->padding_right = input_padding_right;
+  average_pooling_op->padding_bottom = input_padding_bottom;
+  average_pooling_op->padding_left = input_padding_left;
+
+  average_pooling_op->kernel_height = pooling_height;
+  average_pooling_op->kernel_width = pooling_width;
+  average_pooling_op->stride_height = stride_height;
+  average_pooling_op->stride_width = stride_width;
+  average_pooling_op->dilation_height = 1;
+  average_pooling_op->dilation_width = 1;
+  average_pooling_op->channels = channels;
+  average_pooling_op->input_pixel_stride = input_pixel_stride;
+  average_pooling_op->output_pixel_stride = output_pixel_stride;
+
+  average_pooling_op->input_zero_point = (int32_t) input_zero_point;
+  average_pooling_op->output_zero_point = output_zero_point;
+  average_pooling_op->input_scale = input_scale;
+  average_pooling_op->output_scale = output_scale;
+  average_pooling_op->output_min = output_min;
+  average_pooling_op->output_max = output_max;
+
+  // Number of rows read in the AVGPOOL micro-kernel.
+  const size_t avgpool_nrows =
+    round_up(doz(pooling_size, xnn_params.qs8.avgpool.primary_tile), xnn_params.qs8.avgpool.incremental_tile) + xnn_params.qs8.avgpool.primary_tile;
+  const float requantization_scale = input_scale / (output_scale * (float) pooling_size);
+  xnn_params.qs8.avgpool.init.qs8(&average_pooling_op->params.qs8_avgpool,
+    -((int32_t) input_zero_point * (int32_t) avgpool_nrows),
+    requantization_scale, output_zero_point, output_min, output_max);
+  xnn_params.qs8.gavgpool.init.qs8(&average_pooling_op->params.qs8_gavgpool,
+    0 /* bias */, requantization_scale, output_zero_point, output_min, output_max);
+
+  average_pooling_op->type = xnn_operator_type_average_pooling_nhwc_qs8;
+  average_pooling_op->ukernel.type = xnn_ukernel_type_average_pooling;
+  average_pooling_op->flags = flags;
+
+  *average_pooling_op_out = average_pooling_op;
+  return xnn_status_success;
+
+error:
+  xnn_delete_operator(average_pooling_op);
+  return status;
+}
+
+enum xnn_status xnn_create_average_pooling2d_nhwc_f16(
+    uint32_t input_padding_top,
+    uint32_t input_padding_right,
+    uint32_t input_padding_bottom,
+    uint32_t input_padding_left,
+    uint32_t pooling_height,
+    uint32_t pooling_width,
+    uint32_t stride_height,
+    uint32_t stride_width,
+    size_t channels,
+    size_t input_pixel_stride,
+    size_t output_pixel_stride,
+    float output_min,
+    float output_max,
+    uint32_t flags,
+    xnn_operator_t* average_pooling_op_out)
+{
+  xnn_operator_t average_pooling_op = NULL;
+  enum xnn_status status = xnn_status_uninitialized;
+
+  if ((xnn_params.init_flags & XNN_INIT_FLAG_XNNPACK) == 0) {
+    xnn_log_error("failed to create %s operator: XNNPACK is not initialized",
+      xnn_operator_type_to_string(xnn_operator_type_average_pooling_nhwc_f16));
+    goto error;
+  }
+
+  status = xnn_status_unsupported_hardware;
+
+  if ((xnn_params.init_flags & XNN_INIT_FLAG_F16) == 0) {
+    xnn_log_error("failed to create %s operator: operations on data type are not supported",
+      xnn_operator_type_to_string(xnn_operator_type_average_pooling_nhwc_f16));
+    goto error;
+  }
+
+  status = xnn_status_invalid_parameter;
+
+  const uint32_t pooling_size = pooling_height * pooling_width;
+  if (pooling_size == 0) {
+    xnn_log_error(
+      "failed to create %s operator with %" PRIu32 "x%" PRIu32 " pooling size: "
+      "pooling size dimensions must be non-zero",
+      xnn_operator_type_to_string(xnn_operator_type_average_pooling_nhwc_f16), pooling_width, pooling_height);
+    goto error;
+  }
+
+  if (pooling_size == 1) {
+    xnn_log_error(
+      "failed to create %s operator with 1 pooling element: 1x1 pooling is meaningless",
+      xnn_operator_type_to_string(xnn_operator_type_average_pooling_nhwc_f16));
+    goto error;
+  }
+
+  if (stride_height == 0 || stride_width == 0) {
+    xnn_log_error(
+      "failed to create %s operator with %" PRIu32 "x%" PRIu32 " stride: stride dimensions must be non-zero",
+      xnn_operator_type_to_string(xnn_operator_type_average_pooling_nhwc_f16), stride_width, stride_height);
+    goto error;
+  }
+
+  if (channels == 0) {
+    xnn_log_error(
+      "failed to create %s operator with %zu channels: number of channels must be non-zero",
+      xnn_operator_type_to_string(xnn_operator_type_average_pooling_nhwc_f16), channels);
+    goto error;
+  }
+
+  if (input_pixel_stride < channels) {
+    xnn_log_error(
+      "failed to create %s operator with input pixel stride of %zu: "
+      "stride must be at least as large as the number of channels (%zu)",
+      xnn_operator_type_to_string(xnn_operator_type_average_pooling_nhwc_f16), input_pixel_stride, channels);
+    goto error;
+  }
+
+  if (output_pixel_stride < channels) {
+    xnn_log_error(
+      "failed to create %s operator with output pixel stride of %zu: "
+      "stride must be at least as large as the number of channels (%zu)",
+      xnn_operator_type_to_string(xnn_operator_type_average_pooling_nhwc_f16), output_pixel_stride, channels);
+    goto error;
+  }
+
+  if (isnan(output_min)) {
+    xnn_log_error(
+      "failed to create %s operator with NaN output lower bound: lower bound must be non-NaN",
+      xnn_operator_type_to_string(xnn_operator_type_average_pooling_nhwc_f16));
+    goto error;
+  }
+
+  if (isnan(output_max)) {
+    xnn_log_error(
+      "failed to create %s operator with NaN output upper bound: upper bound must be non-NaN",
+      xnn_operator_type_to_string(xnn_operator_type_average_pooling_nhwc_f16));
+    goto error;
+  }
+
+  const uint16_t output_min_as_half = fp16_ieee_from_fp32_value(output_min);
+  const uint16_t output_max_as_half = fp16_ieee_from_fp32_value(output_max);
+  output_min = fp16_ieee_to_fp32_value(output_min_as_half);
+  output_max = fp16_ieee_to_fp32_value(output_max_as_half);
+  if (output_min >= output_max) {
+    xnn_log_error(
+      "failed to create %s operator with [%.7g, %.7g] output range: lower bound must be below upper bound",
+      xnn_operator_type_to_string(xnn_operator_type_average_pooling_nhwc_f16), output_min, output_max);
+    goto error;
+  }
+
+  const bool any_padding = (input_padding_left | input_padding_top | input_padding_right | input_padding_bottom) != 0;
+  if ((flags & XNN_FLAG_TENSORFLOW_SAME_PADDING) != 0) {
+    if (any_padding) {
+      xnn_log_error(
+        "failed to create %s operator with %" PRIu32 "+%" PRIu32 "x%" PRIu32 "+%" PRIu32" padding: "
+        "TensorFlow SAME padding can't be combined with explicit padding specification",
+        xnn_operator_type_to_string(xnn_operator_type_average_pooling_nhwc_f16),
+        input_padding_top, input_padding_left, input_padding_bottom, input_padding_right);
+      goto error;
+    }
+  }
+
+  status = xnn_status_out_of_memory;
+
+  average_pooling_op = xnn_allocate_zero_simd_memory(sizeof(struct xnn_operator));
+  if (average_pooling_op == NULL) {
+    xnn_log_error(
+      "failed to allocate %zu bytes for %s operator descriptor",
+      sizeof(struct xnn_operator), xnn_operator_type_to_string(xnn_operator_type_average_pooling_nhwc_f16));
+    goto error;
+  }
+
+  const size_t zero_bytes = channels * sizeof(uint16_t) + XNN_EXTRA_BYTES;
+  void* zero_buffer = xnn_allocate_zero_tagged_simd_memory(xnn_memory_category_zero_buffer, zero_bytes);
+  if (zero_buffer == NULL) {
+    xnn_log_error(
+      "failed to allocate %zu bytes for %s operator zero padding",
+      zero_bytes, xnn_operator_type_to_string(xnn_operator_type_average_pooling_nhwc_f16));
+    goto error;
+  }
+  average_pooling_op->zero_buffer = zero_buffer;
+
+  average_pooling_op->padding_top = input_padding_top;
+  average_pooling_op->padding_right = input_padding_right;
+  average_pooling_op->padding_bottom = input_padding_bottom;
+  average_pooling_op->padding_left = input_padding_left;
+
+  average_pooling_op->kernel_height = pooling_height;
+  average_pooling_op->kernel_width = pooling_width;
+  average_pooling_op->stride_height = stride_height;
+  average_pooling_op->stride_width = stride_width;
+  average_pooling_op->dilation_height = 1;
+  average_pooling_op->dilation_width = 1;
+  average_pooling_op->channels = channels;
+  average_pooling_op->input_pixel_stride = input_pixel_stride;
+  average_pooling_op->output_pixel_stride = output_pixel_stride;
+
+  average_pooling_op->type = xnn_operator_type_average_pooling_nhwc_f16;
+  xnn_params.f16.avgpool.init.f16(&average_pooling_op->params.f16_avgpool,
+    fp16_ieee_from_fp32_value(1.0f / (float) (int32_t) pooling_size), output_min_as_half, output_max_as_half);
+  const bool tf_same_padding = (flags & XNN_FLAG_TENSORFLOW_SAME_PADDING) != 0;
+  if (any_padding || tf_same_padding) {
+    xnn_params.f16.pavgpool.init.f16(&average_pooling_op->params.f16_pavgpool, output_min_as_half, output_max_as_half);
+    average_pooling_op->ukernel.type = xnn_ukernel_type_pixelwise_average_pooling;
+  } else {
+    average_pooling_op->ukernel.type = xnn_ukernel_type_average_pooling;
+  }
+  average_pooling_op->flags = flags;
+
+  *average_pooling_op_out = average_pooling_op;
+  return xnn_status_success;
+
+error:
+  xnn_delete_operator(average_pooling_op);
+  return status;
+}
+
 enum xnn_status xnn_create_average_pooling2d_nhwc_f32(
     uint32_t input_padding_top,
     uint32_t input_padding_right,
@@ -355,7 +728,7 @@ enum xnn_status xnn_create_average_pooling2d_nhwc_f32(
   }
 
   const size_t zero_bytes = channels * sizeof(float) + XNN_EXTRA_BYTES;
-  void* zero_buffer = xnn_allocate_zero_simd_memory(zero_bytes);
+  void* zero_buffer = xnn_allocate_zero_tagged_simd_memory(xnn_memory_category_zero_buffer, zero_bytes);
   if (zero_buffer == NULL) {
     xnn_log_error(
       "failed to allocate %zu bytes for %s operator zero padding",
@@ -521,7 +894,8 @@ static enum xnn_status setup_average_pooling2d(
       const size_t indirection_buffer_size = sizeof(void*) * ((primary_tile - 1) + output_height * step_height);
 
       const void** indirection_buffer =
-        (const void**) xnn_reallocate_memory(average_pooling_op->indirection_buffer, indirection_buffer_size);
+        (const void**) xnn_reallocate_tagged_memory(
+          xnn_memory_category_indirection, average_pooling_op->indirection_buffer, indirection_buffer_size);
       if (indirection_buffer == NULL) {
         xnn_log_error("failed to allocate %zu bytes for %s operator indirection buffer",
           indirection_buffer_size, xnn_operator_type_to_string(average_pooling_op->type));
@@ -543,11 +917,12 @@ static enum xnn_status setup_average_pooling2d(
     const size_t output_height_stride = output_width * output_width_stride;
 
     if (is_pixelwise) {
-      /* This part is specific to FP32, needs revision if another data types get a PAVGPOOL micro-kernel */
+      // Multipliers in the pixelwise buffer are stored in the same data type as the output elements: FP32 or FP16.
       if (input_height != last_input_height || input_width != last_input_width) {
-        const size_t pixelwise_buffer_size = output_height * output_width * sizeof(float);
-        float* pixelwise_buffer =
-          (float*) xnn_reallocate_memory(average_pooling_op->pixelwise_buffer, pixelwise_buffer_size);
+        const size_t pixelwise_buffer_size = (output_height * output_width) << log2_output_element_size;
+        void* pixelwise_buffer =
+          xnn_reallocate_tagged_memory(
+            xnn_memory_category_scratch, average_pooling_op->pixelwise_buffer, pixelwise_buffer_size);
         if (pixelwise_buffer == NULL) {
           xnn_log_error("failed to allocate %zu bytes for %s operator pixelwise buffer",
             pixelwise_buffer_size, xnn_operator_type_to_string(average_pooling_op->type));
@@ -555,7 +930,8 @@ static enum xnn_status setup_average_pooling2d(
         }
         average_pooling_op->pixelwise_buffer = pixelwise_buffer;
 
-        float* pixelwise_pointer = pixelwise_buffer;
+        float* pixelwise_f32_pointer = (float*) pixelwise_buffer;
+        uint16_t* pixelwise_f16_pointer = (uint16_t*) pixelwise_buffer;
         for (size_t output_y = 0; output_y < output_height; output_y++) {
           const size_t input_y_start = doz(output_y * average_pooling_op->stride_height, average_pooling_op->padding_top);
           const size_t input_y_end =
@@ -566,7 +942,12 @@ static enum xnn_status setup_average_pooling2d(
             const size_t input_x_end =
               min(doz(output_x * average_pooling_op->stride_width + average_pooling_op->kernel_width, average_pooling_op->padding_left), input_width);
             const uint32_t input_x_range = (uint32_t) (input_x_end - input_x_start);
-            *pixelwise_pointer++ = 1.0f / ((float) (int32_t) (input_y_range * input_x_range));
+            const float multiplier = 1.0f / ((float) (int32_t) (input_y_range * input_x_range));
+            if (log2_output_element_size == 1 /* log2(sizeof(uint16_t)) */) {
+              *pixelwise_f16_pointer++ = fp16_ieee_from_fp32_value(multiplier);
+            } else {
+              *pixelwise_f32_pointer++ = multiplier;
+            }
           }
         }
       }
@@ -580,7 +961,7 @@ static enum xnn_status setup_average_pooling2d(
         .input_batch_stride = input_height * input_width * average_pooling_op->input_pixel_stride << log2_input_element_size,
         .input_offset = (size_t) ((uintptr_t) input - (uintptr_t) average_pooling_op->last_input),
         .pixelwise_buffer = average_pooling_op->pixelwise_buffer,
-        .pixelwise_buffer_height_stride = output_width * sizeof(float),
+        .pixelwise_buffer_height_stride = output_width << log2_output_element_size,
         .output = output,
         .output_batch_stride = output_height * output_height_stride,
         .output_height_stride = output_height_stride,
@@ -681,6 +1062,92 @@ enum xnn_status xnn_setup_average_pooling2d_nhwc_qu8(
     false /* pixelwise not supported */);
 }
 
+enum xnn_status xnn_setup_average_pooling2d_nhwc_qs8(
+    xnn_operator_t average_pooling_op,
+    size_t batch_size,
+    size_t input_height,
+    size_t input_width,
+    const int8_t* input,
+    int8_t* output,
+    pthreadpool_t threadpool)
+{
+  if (average_pooling_op->type != xnn_operator_type_average_pooling_nhwc_qs8) {
+    xnn_log_error("failed to setup operator: operator type mismatch (expected %s, got %s)",
+      xnn_operator_type_to_string(xnn_operator_type_average_pooling_nhwc_qs8),
+      xnn_operator_type_to_string(average_pooling_op->type));
+    return xnn_status_invalid_parameter;
+  }
+
+  assert(average_pooling_op->ukernel.type == xnn_ukernel_type_average_pooling);
+
+  // Number of rows read in the GAVGPOOL micro-kernel.
+  const size_t input_size = input_height * input_width;
+  const size_t pooling_size = average_pooling_op->kernel_height * average_pooling_op->kernel_width;
+  const size_t gavgpool_nrows = round_up(input_size, xnn_params.qs8.gavgpool.row_tile);
+  xnn_params.qs8.gavgpool.update.qs8(
+    &average_pooling_op->params.qs8_gavgpool,
+    -(average_pooling_op->input_zero_point * (int32_t) gavgpool_nrows),
+    average_pooling_op->input_scale / (average_pooling_op->output_scale * (float) pooling_size));
+
+  return setup_average_pooling2d(
+    average_pooling_op,
+    batch_size, input_height, input_width,
+    input, output,
+    0 /* log2(sizeof(input element)) = log2(sizeof(int8_t)) */,
+    0 /* log2(sizeof(output element)) = log2(sizeof(int8_t)) */,
+    &xnn_params.qs8.avgpool,
+    NULL /* no PAVGPOOL micro-kernel */,
+    &xnn_params.qs8.gavgpool,
+    &average_pooling_op->params.qs8_avgpool,
+    sizeof(average_pooling_op->params.qs8_avgpool),
+    &average_pooling_op->params.qs8_gavgpool,
+    sizeof(average_pooling_op->params.qs8_gavgpool),
+    pthreadpool_get_threads_count(threadpool),
+    false /* pixelwise not supported */);
+}
+
+enum xnn_status xnn_setup_average_pooling2d_nhwc_f16(
+    xnn_operator_t average_pooling_op,
+    size_t batch_size,
+    size_t input_height,
+    size_t input_width,
+    const void* input,
+    void* output,
+    pthreadpool_t threadpool)
+{
+  if (average_pooling_op->type != xnn_operator_type_average_pooling_nhwc_f16) {
+    xnn_log_error("failed to setup operator: operator type mismatch (expected %s, got %s)",
+      xnn_operator_type_to_string(xnn_operator_type_average_pooling_nhwc_f16),
+      xnn_operator_type_to_string(average_pooling_op->type));
+    return xnn_status_invalid_parameter;
+  }
+
+  assert(average_pooling_op->ukernel.type == xnn_ukernel_type_average_pooling ||
+         average_pooling_op->ukernel.type == xnn_ukernel_type_pixelwise_average_pooling);
+
+  const bool is_pixelwise = average_pooling_op->ukernel.type == xnn_ukernel_type_pixelwise_average_pooling;
+  if (is_pixelwise) {
+    const size_t input_size = input_height * input_width;
+    xnn_params.f16.gavgpool.update.f16(&average_pooling_op->params.f16_avgpool, fp16_ieee_from_fp32_value(1.0f / (float) (int32_t) input_size));
+  }
+
+  return setup_average_pooling2d(
+    average_pooling_op,
+    batch_size, input_height, input_width,
+    input, output,
+    1 /* log2(sizeof(input element)) = log2(sizeof(uint16_t)) */,
+    1 /* log2(sizeof(output element)) = log2(sizeof(uint16_t)) */,
+    &xnn_params.f16.avgpool,
+    &xnn_params.f16.pavgpool,
+    &xnn_params.f16.gavgpool,
+    is_pixelwise ? (const void*) &average_pooling_op->params.f16_pavgpool : (const void*) &average_pooling_op->params.f16_avgpool,
+    is_pixelwise ? sizeof(average_pooling_op->params.f16_pavgpool) : sizeof(average_pooling_op->params.f16_avgpool),
+    &average_pooling_op->params.f16_avgpool,
+    sizeof(average_pooling_op->params.f16_avgpool),
+    pthreadpool_get_threads_count(threadpool),
+    is_pixelwise);
+}
+
 enum xnn_status xnn_setup_average_pooling2d_nhwc_f32(
     xnn_operator_t average_pooling_op,
     size_t batch_size,
@@ -22,6 +22,7 @@
 #include <xnnpack/pack.h>
 #include <xnnpack/params-init.h>
 #include <xnnpack/params.h>
+#include <xnnpack/tiling.h>
 
 
 static inline size_t compute_output_dimension(
@@ -170,6 +171,7 @@ enum xnn_status xnn_create_convolution2d_nchw_f32(
   // + 3x3 stride-1 depthwise convolution with horizontal padding 1 & no vertical padding
   // + 5x5 stride-2 depthwise convolution with horizontal padding 2 & no vertical padding
   // + 5x5 stride-1 depthwise convolution with horizontal padding 2 & no vertical padding
+  // + depthwise convolution with any other kernel size, subsampling, dilation, and padding
   const bool any_padding = (input_padding_left | input_padding_top | input_padding_right | input_padding_bottom) != 0;
   const bool is_1x1 = kernel_width == 1 && kernel_height == 1 && subsampling_height == 1 && subsampling_width == 1;
   const bool is_3x3 = kernel_width == 3 && kernel_height == 3 && dilation_height == 1 && dilation_width == 1;
@@ -206,6 +208,10 @@ enum xnn_status xnn_create_convolution2d_nchw_f32(
   {
     ukernel_type = xnn_ukernel_type_dwconv;
     dwconv2d_parameters = &xnn_params.f32.dwconv2d_chw_5x5s2;
+  } else if (!nhwc_input && group_input_channels == 1 && group_output_channels == 1 &&
+    xnn_params.f32.dwconv2d_chw_dilated.ukernel != NULL)
+  {
+    ukernel_type = xnn_ukernel_type_dwconv2d_dilated;
   } else {
     xnn_log_error(
       "failed to create %s operator with %" PRIu32 "x%" PRIu32 " kernel, %"PRIu32 "x%" PRIu32 " subsampling, %"PRIu32 "x%" PRIu32 " dilation"
@@ -302,7 +308,8 @@ enum xnn_status xnn_create_convolution2d_nchw_f32(
       const size_t packed_weights_size = num_output_channel_blocks * sizeof(uint32_t) +
         (num_nonzero_blocks * 2) * sizeof(int32_t) + (num_nonzero_values + group_output_channels) * sizeof(float);
 
-      convolution_op->packed_weights = xnn_allocate_simd_memory(packed_weights_size);
+      convolution_op->packed_weights =
+        xnn_allocate_tagged_simd_memory(xnn_memory_category_packed_weights, packed_weights_size);
       if (convolution_op->packed_weights == NULL) {
         xnn_log_error(
           "failed to allocate %zu bytes for %s operator packed weights",
@@ -415,7 +422,8 @@ enum xnn_status xnn_create_convolution2d_nchw_f32(
         round_up(group_output_channels, xnn_params.f32.conv_hwc2chw_3x3c3s2.output_channel_tile);
       const size_t packed_weights_size = groups * packed_group_output_channels *
         (group_input_channels * kernel_height * kernel_width + 1 /* bias */) * sizeof(float);
-      convolution_op->packed_weights = xnn_allocate_simd_memory(packed_weights_size);
+      convolution_op->packed_weights =
+        xnn_allocate_tagged_simd_memory(xnn_memory_category_packed_weights, packed_weights_size);
       if (convolution_op->packed_weights == NULL) {
         xnn_log_error(
           "failed to allocate %zu bytes for %s operator packed weights",
@@ -445,7 +453,8 @@ enum xnn_status xnn_create_convolution2d_nchw_f32(
       assert(group_output_channels == 1);
 
       const size_t packed_weights_size = groups * (kernel_height * kernel_width + 1 /* bias */) * sizeof(float);
-      convolution_op->packed_weights = xnn_allocate_simd_memory(packed_weights_size);
+      convolution_op->packed_weights =
+        xnn_allocate_tagged_simd_memory(xnn_memory_category_packed_weights, packed_weights_size);
       if (convolution_op->packed_weights == NULL) {
         xnn_log_error(
           "failed to allocate %zu bytes for %s operator packed weights",
@@ -470,6 +479,38 @@ enum xnn_status xnn_create_convolution2d_nchw_f32(
 
       break;
     }
+    case xnn_ukernel_type_dwconv2d_dilated:
+    {
+      assert(group_input_channels == 1);
+      assert(group_output_channels == 1);
+
+      const size_t packed_weights_size = groups * (kernel_height * kernel_width + 1 /* bias */) * sizeof(float);
+      convolution_op->packed_weights =
+        xnn_allocate_tagged_simd_memory(xnn_memory_category_packed_weights, packed_weights_size);
+      if (convolution_op->packed_weights == NULL) {
+        xnn_log_error(
+          "failed to allocate %zu bytes for %s operator packed weights",
+          packed_weights_size, xnn_operator_type_to_string(xnn_operator_type_convolution_nchw_f32));
+        goto error;
+      }
+
+      if (flags & XNN_FLAG_DEPTHWISE_CONVOLUTION) {
+        xnn_pack_f32_chw_dwconv_hwg_w(
+          kernel_height * kernel_width, groups,
+          kernel, bias, convolution_op->packed_weights, NULL);
+      } else {
+        xnn_pack_f32_chw_dwconv_ghw_w(
+          kernel_height * kernel_width, groups,
+          kernel, bias, convolution_op->packed_weights, NULL);
+      }
+
+      convolution_op->ukernel.dwconv2d = (struct xnn_ukernel_dwconv2d) {
+        .chw_dilated_function = xnn_params.f32.dwconv2d_chw_dilated.ukernel,
+        .output_width_tile = xnn_params.f32.dwconv2d_chw_dilated.output_width_tile,
+      };
+
+      break;
+    }
     default:
       XNN_UNREACHABLE;
   }
@@ -493,6 +534,8 @@ enum xnn_status xnn_create_convolution2d_nchw_f32(
 
   if (ukernel_type == xnn_ukernel_type_dwconv) {
     xnn_init_f32_chw_params(&convolution_op->params.f32_chw, 0, output_min, output_max);
+  } else if (ukernel_type == xnn_ukernel_type_dwconv2d_dilated) {
+    xnn_params.f32.dwconv2d_chw_dilated.init.f32(&convolution_op->params.f32_minmax, output_min, output_max);
   } else {
     xnn_init_f32_minmax_params(&convolution_op->params.f32_minmax, output_min, output_max);
   }
@@ -608,20 +651,18 @@ static enum xnn_status setup_convolution2d_nchw(
       };
       memcpy(&convolution_op->context.spmm.params, params, sizeof(convolution_op->context.spmm.params));
 
-      const size_t mr = convolution_op->ukernel.spmm.mr;
-      size_t mc = input_size;
-      if (num_threads > 1) {
-        const size_t target_tiles_per_thread = 5;
-        const size_t max_mc = divide_round_up(input_size, num_threads * target_tiles_per_thread);
-        if (max_mc < mc) {
-          mc = min(mc, divide_round_up(mc, max_mc * mr) * mr);
-        }
-      }
+      const size_t work = xnn_estimate_work(
+        (double) batch_size * input_size * num_nonzero_values,
+        (double) batch_size * input_size *
+          (convolution_op->group_input_channels + convolution_op->group_output_channels) * sizeof(float));
+      const size_t max_tiles = xnn_compute_max_tiles(work, num_threads);
+      const size_t mc = xnn_compute_tile_size(input_size, convolution_op->ukernel.spmm.mr, divide_round_up(max_tiles, batch_size));
       convolution_op->compute.type = xnn_parallelization_type_2d_tile_1d;
       convolution_op->compute.task_2d_tile_1d = (pthreadpool_task_2d_tile_1d_t) xnn_compute_spmm;
       convolution_op->compute.range[0] = batch_size;
       convolution_op->compute.range[1] = input_size * sizeof(float);
       convolution_op->compute.tile[0] = mc * sizeof(float);
+      convolution_op->compute.num_threads = xnn_compute_num_useful_threads(work, num_threads);
       convolution_op->state = xnn_run_state_ready;
 
       return xnn_status_success;
@@ -629,15 +670,16 @@ static enum xnn_status setup_convolution2d_nchw(
     case xnn_ukernel_type_conv2d_hwc2chw:
     {
       const size_t zero_size = (input_width * convolution_op->group_input_channels << log2_input_element_size) + XNN_EXTRA_BYTES;
-      void* zero_buffer = xnn_reallocate_memory(convolution_op->zero_buffer, zero_size);
+      // The zero buffer is released as SIMD memory, so it can not be reallocated.
+      xnn_release_simd_memory(convolution_op->zero_buffer);
+      void* zero_buffer = xnn_allocate_zero_tagged_simd_memory(xnn_memory_category_zero_buffer, zero_size);
+      convolution_op->zero_buffer = zero_buffer;
       if (zero_buffer == NULL) {
         xnn_log_error(
           "failed to allocate %zu bytes for %s operator zero padding",
           sizeof(struct xnn_operator), xnn_operator_type_to_string(xnn_operator_type_convolution_nchw_f32));
         return xnn_status_out_of_memory;
       }
-      memset(zero_buffer, 0, zero_size);
-      convolution_op->zero_buffer = zero_buffer;
 
       convolution_op->context.conv2d = (struct conv2d_context) {
         .input_height = input_height,
@@ -656,21 +698,21 @@ static enum xnn_status setup_convolution2d_nchw(
       };
       memcpy(&convolution_op->context.conv2d.params, params, sizeof(convolution_op->context.conv2d.params));
 
-      size_t output_height_slice = output_height;
-      const size_t output_height_tile = convolution_op->ukernel.conv2d.output_height_tile;
-      if (num_threads > 1) {
-        const size_t target_tiles_per_thread = 5;
-        const size_t max_output_height_slice = divide_round_up(output_height, num_threads * target_tiles_per_thread);
-        if (max_output_height_slice < output_height_slice) {
-          output_height_slice = min(output_height_slice,
-            divide_round_up(output_height_slice, max_output_height_slice * output_height_tile) * output_height_tile);
-        }
-      }
+      const size_t input_channels = convolution_op->group_input_channels;
+      const size_t output_channels = convolution_op->group_output_channels;
+      const size_t work = xnn_estimate_work(
+        (double) batch_size * output_height * output_width * output_channels *
+          convolution_op->kernel_height * convolution_op->kernel_width * input_channels,
+        (double) batch_size * ((double) input_height * input_width * (input_channels << log2_input_element_size) +
+          (double) output_height * output_width * (output_channels << log2_output_element_size)));
+      const size_t max_tiles = xnn_compute_max_tiles(work, num_threads);
       convolution_op->compute.type = xnn_parallelization_type_2d_tile_1d;
       convolution_op->compute.task_2d_tile_1d = (pthreadpool_task_2d_tile_1d_t) xnn_compute_conv2d_hwc2chw;
       convolution_op->compute.range[0] = batch_size;
       convolution_op->compute.range[1] = output_height;
-      convolution_op->compute.tile[0] = output_height_slice;
+      convolution_op->compute.tile[0] = xnn_compute_tile_size(
+        output_height, convolution_op->ukernel.conv2d.output_height_tile, divide_round_up(max_tiles, batch_size));
+      convolution_op->compute.num_threads = xnn_compute_num_useful_threads(work, num_threads);
       convolution_op->state = xnn_run_state_ready;
 
       return xnn_status_success;
@@ -678,15 +720,15 @@ static enum xnn_status setup_convolution2d_nchw(
     case xnn_ukernel_type_dwconv:
     {
       const size_t zero_size = (input_width << log2_input_element_size) + 2 * XNN_EXTRA_BYTES;
-      void* zero_buffer = xnn_reallocate_memory(convolution_op->zero_buffer, zero_size);
+      xnn_release_simd_memory(convolution_op->zero_buffer);
+      void* zero_buffer = xnn_allocate_zero_tagged_simd_memory(xnn_memory_category_zero_buffer, zero_size);
+      convolution_op->zero_buffer = zero_buffer;
       if (zero_buffer == NULL) {
         xnn_log_error(
           "failed to allocate %zu bytes for %s operator zero padding",
           sizeof(struct xnn_operator), xnn_operator_type_to_string(xnn_operator_type_convolution_nchw_f32));
         return xnn_status_out_of_memory;
       }
-      memset(zero_buffer, 0, zero_size);
-      convolution_op->zero_buffer = zero_buffer;
 
       xnn_update_f32_chw_params((union xnn_f32_chw_params*) chw_params, (uint32_t) input_width);
       convolution_op->context.dwconv2d = (struct dwconv2d_context) {
@@ -707,10 +749,69 @@ static enum xnn_status setup_convolution2d_nchw(
       };
       memcpy(&convolution_op->context.dwconv2d.params, chw_params, sizeof(convolution_op->context.dwconv2d.params));
 
+      const size_t channels_size = batch_size * convolution_op->groups;
       convolution_op->compute.type = xnn_parallelization_type_2d;
       convolution_op->compute.task_2d = (pthreadpool_task_2d_t) xnn_compute_dwconv2d_chw;
       convolution_op->compute.range[0] = batch_size;
       convolution_op->compute.range[1] = convolution_op->groups;
+      convolution_op->compute.num_threads = xnn_compute_num_useful_threads(
+        xnn_estimate_work(
+          (double) channels_size * output_height * output_width * convolution_op->kernel_height * convolution_op->kernel_width,
+          (double) channels_size * ((double) input_height * input_width * (1 << log2_input_element_size) +
+            (double) output_height * output_width * (1 << log2_output_element_size))),
+        num_threads);
+      convolution_op->state = xnn_run_state_ready;
+
+      return xnn_status_success;
+    }
+    case xnn_ukernel_type_dwconv2d_dilated:
+    {
+      if (output_height == 0 || output_width == 0) {
+        convolution_op->state = xnn_run_state_skip;
+        return xnn_status_success;
+      }
+
+      convolution_op->context.dwconv2d_dilated = (struct dwconv2d_dilated_context) {
+        .input_height = input_height,
+        .input_width = input_width << log2_input_element_size,
+        .input = input,
+        .input_channel_stride = input_height * input_width << log2_input_element_size,
+        .input_batch_stride = input_batch_stride,
+        .input_padding_top = convolution_op->padding_top,
+        .input_padding_left = convolution_op->padding_left,
+        .kernel_height = convolution_op->kernel_height,
+        .kernel_width = convolution_op->kernel_width,
+        .subsampling_height = convolution_op->stride_height,
+        .subsampling_width = convolution_op->stride_width,
+        .dilation_height = convolution_op->dilation_height,
+        .dilation_width = convolution_op->dilation_width,
+        .packed_weights = convolution_op->packed_weights,
+        .weights_channel_stride = bias_element_size +
+          (convolution_op->kernel_height * convolution_op->kernel_width << log2_filter_element_size),
+        .output = output,
+        .output_width = output_width,
+        .output_height_stride = output_width << log2_output_element_size,
+        .output_channel_stride = output_height * output_width << log2_output_element_size,
+        .output_batch_stride = output_batch_stride,
+        .chw_dilated_ukernel = convolution_op->ukernel.dwconv2d.chw_dilated_function,
+      };
+      memcpy(&convolution_op->context.dwconv2d_dilated.params, params, sizeof(convolution_op->context.dwconv2d_dilated.params));
+
+      // With few channels, output rows are split into tiles as well, so that all threads get work.
+      const size_t channels_size = batch_size * convolution_op->groups;
+      const size_t work = xnn_estimate_work(
+        (double) channels_size * output_height * output_width * convolution_op->kernel_height * convolution_op->kernel_width,
+        (double) channels_size * ((double) input_height * input_width * (1 << log2_input_element_size) +
+          (double) output_height * output_width * (1 << log2_output_element_size)));
+      const size_t max_tiles = xnn_compute_max_tiles(work, num_threads);
+      convolution_op->compute.type = xnn_parallelization_type_3d_tile_2d;
+      convolution_op->compute.task_3d_tile_2d = (pthreadpool_task_3d_tile_2d_t) xnn_compute_dwconv2d_chw_dilated;
+      convolution_op->compute.range[0] = batch_size;
+      convolution_op->compute.range[1] = convolution_op->groups;
+      convolution_op->compute.range[2] = output_height;
+      convolution_op->compute.tile[0] = 1;
+      convolution_op->compute.tile[1] = xnn_compute_tile_size(output_height, 1, divide_round_up(max_tiles, channels_size));
+      convolution_op->compute.num_threads = xnn_compute_num_useful_threads(work, num_threads);
       convolution_op->state = xnn_run_state_ready;
 
       return xnn_status_success;
@@ -18,6 +18,7 @@
 
 #include <xnnpack.h>
 #include <xnnpack/allocator.h>
+#include <xnnpack/autotune.h>
 #include <xnnpack/common.h>
 #include <xnnpack/compute.h>
 #include <xnnpack/indirection.h>
@@ -27,6 +28,7 @@
 #include <xnnpack/pack.h>
 #include <xnnpack/params.h>
 #include <xnnpack/params-init.h>
+#include <xnnpack/tiling.h>
 
 
 static inline size_t compute_output_dimension(
@@ -156,6 +158,7 @@ static enum xnn_status create_convolution2d_nhwc(
     xnn_pack_conv_kgo_w_function pack_conv_kgo_w,
     xnn_pack_conv_goki_w_function pack_conv_goki_w,
     const void* packing_params,
+    size_t packing_params_size,
     int input_padding_byte,
     int packed_weights_padding_byte,
     size_t extra_weights_bytes,
@@ -165,15 +168,19 @@ static enum xnn_status create_convolution2d_nhwc(
     size_t gemm_params_size,
     const void* dwconv_params,
     size_t dwconv_params_size,
+    const void* dconv_params,
+    size_t dconv_params_size,
     const void* vmulcaddc_params,
     size_t vmulcaddc_params_size,
     const struct gemm_parameters* gemm_parameters,
     const struct dwconv_parameters* dwconv_ukernel,
+    const struct dconv_parameters* dconv_parameters,
     const struct vmulcaddc_parameters* vmulcaddc_parameters,
     struct jit_gemm_params* jit_gemm_params,
     bool linear_activation,
     bool relu_activation,
     uint32_t datatype_init_flags,
+    struct xnn_packed_weights_buffer* packed_weights_buffer,
     enum xnn_operator_type operator_type,
     xnn_operator_t* convolution_op_out)
 {
@@ -280,6 +287,22 @@ static enum xnn_status create_convolution2d_nhwc(
     }
   }
 
+  const uint32_t padding_mode = flags & XNN_PADDING_MODE_FLAGS;
+  if ((padding_mode & (padding_mode - 1)) != 0) {
+    xnn_log_error(
+      "failed to create %s operator with 0x%08" PRIx32 " flags: reflect, symmetric, and edge padding modes are "
+      "mutually exclusive",
+      xnn_operator_type_to_string(operator_type), flags);
+    goto error;
+  }
+  if (padding_mode != 0 && (flags & XNN_FLAG_TENSORFLOW_SAME_PADDING) != 0) {
+    xnn_log_error(
+      "failed to create %s operator with 0x%08" PRIx32 " flags: "
+      "TensorFlow SAME padding can't be combined with reflect, symmetric, or edge padding modes",
+      xnn_operator_type_to_string(operator_type), flags);
+    goto error;
+  }
+
   status = xnn_status_out_of_memory;
 
   convolution_op = xnn_allocate_zero_simd_memory(sizeof(struct xnn_operator));
@@ -299,6 +322,13 @@ static enum xnn_status create_convolution2d_nhwc(
   } else if (group_input_channels == 1 && group_output_channels == 1 && dwconv_ukernel != NULL)
   {
     ukernel_type = xnn_ukernel_type_dwconv;
+  } else if (dconv_parameters != NULL && groups == 1 && group_input_channels <= dconv_parameters->max_input_channels &&
+             kernel_size != 1 && !unit_subsampling && (dilation_height | dilation_width) == 1 &&
+             (flags & (XNN_FLAG_DEPTHWISE_CONVOLUTION | XNN_PADDING_MODE_FLAGS)) == 0)
+  {
+    // Layers with few input channels and large strided kernels, e.g. the first layer of a network, get too little work
+    // per kernel element to use IGEMM efficiently.
+    ukernel_type = xnn_ukernel_type_dconv;
   } else if (kernel_size == 1 && unit_subsampling && !any_padding) {
     ukernel_type = xnn_ukernel_type_gemm;
   } else {
@@ -306,6 +336,14 @@ static enum xnn_status create_convolution2d_nhwc(
   }
   assert(ukernel_type != xnn_ukernel_type_default);
 
+  // Packed weights layout parameters, completed with the micro-kernel tile sizes and the packed weights size for the
+  // fingerprint of the packed weights.
+  size_t layout[] = {
+    (size_t) operator_type, (size_t) ukernel_type, (size_t) (flags & XNN_FLAG_DEPTHWISE_CONVOLUTION),
+    kernel_height, kernel_width, groups, group_input_channels, group_output_channels,
+    0 /* tile 0 */, 0 /* tile 1 */, 0 /* tile 2 */, 0 /* packed weights size */,
+  };
+  bool pack = false;
   size_t zero_size = 0;
   switch (ukernel_type) {
     case xnn_ukernel_type_vmulcaddc:
@@ -315,17 +353,23 @@ static enum xnn_status create_convolution2d_nhwc(
 
       const size_t c_stride = round_up_po2(groups, vmulcaddc_parameters->channel_tile);
       const size_t packed_weights_size = ((UINT32_C(1) << log2_filter_element_size) + bias_element_size) * c_stride;
-      convolution_op->packed_weights = xnn_allocate_simd_memory(packed_weights_size);
-      if (convolution_op->packed_weights == NULL) {
-        xnn_log_error(
-          "failed to allocate %zu bytes for %s operator packed weights",
-          packed_weights_size, xnn_operator_type_to_string(operator_type));
+      layout[8] = vmulcaddc_parameters->channel_tile;
+      layout[11] = packed_weights_size;
+      status = xnn_init_packed_weights(
+        convolution_op, packed_weights_buffer, packed_weights_size,
+        xnn_compute_packed_weights_fingerprint(
+          layout, XNN_COUNT_OF(layout), packing_params, packing_params_size),
+        flags, operator_type, &pack);
+      if (status != xnn_status_success) {
         goto error;
       }
+      status = xnn_status_out_of_memory;
 
-      pack_vmulcaddc_w(
-        groups, vmulcaddc_parameters->channel_tile,
-        kernel, bias, convolution_op->packed_weights, packing_params);
+      if (pack) {
+        pack_vmulcaddc_w(
+          groups, vmulcaddc_parameters->channel_tile,
+          kernel, bias, convolution_op->packed_weights, packing_params);
+      }
 
       memcpy(&convolution_op->params, vmulcaddc_params, vmulcaddc_params_size);
 
@@ -342,33 +386,40 @@ static enum xnn_status create_convolution2d_nhwc(
 
       const size_t c_stride = round_up_po2(groups, dwconv_ukernel->channel_tile);
       const size_t packed_weights_size = ((kernel_size << log2_filter_element_size) + bias_element_size + extra_weights_bytes) * c_stride;
-      convolution_op->packed_weights = xnn_allocate_simd_memory(packed_weights_size);
-      if (convolution_op->packed_weights == NULL) {
-        xnn_log_error(
-          "failed to allocate %zu bytes for %s operator packed weights",
-          packed_weights_size, xnn_operator_type_to_string(operator_type));
+      layout[8] = dwconv_ukernel->channel_tile;
+      layout[9] = dwconv_ukernel->primary_tile;
+      layout[11] = packed_weights_size;
+      status = xnn_init_packed_weights(
+        convolution_op, packed_weights_buffer, packed_weights_size,
+        xnn_compute_packed_weights_fingerprint(
+          layout, XNN_COUNT_OF(layout), packing_params, packing_params_size),
+        flags, operator_type, &pack);
+      if (status != xnn_status_success) {
         goto error;
       }
-      memset(convolution_op->packed_weights, packed_weights_padding_byte, packed_weights_size);
+      status = xnn_status_out_of_memory;
       memcpy(&convolution_op->params, dwconv_params, dwconv_params_size);
 
-      if (flags & XNN_FLAG_DEPTHWISE_CONVOLUTION) {
-        pack_dwconv_hwg_w(
-          kernel_height, kernel_width,
-          groups, dwconv_ukernel->channel_tile,
-          kernel, bias, convolution_op->packed_weights,
-          dwconv_ukernel->channel_tile * extra_weights_bytes,
-          packing_params);
-      } else {
-        pack_dwconv_ghw_w(
-          kernel_height, kernel_width,
-          groups, dwconv_ukernel->channel_tile,
-          kernel, bias, convolution_op->packed_weights,
-          dwconv_ukernel->channel_tile * extra_weights_bytes,
-          packing_params);
+      if (pack) {
+        memset(convolution_op->packed_weights, packed_weights_padding_byte, packed_weights_size);
+        if (flags & XNN_FLAG_DEPTHWISE_CONVOLUTION) {
+          pack_dwconv_hwg_w(
+            kernel_height, kernel_width,
+            groups, dwconv_ukernel->channel_tile,
+            kernel, bias, convolution_op->packed_weights,
+            dwconv_ukernel->channel_tile * extra_weights_bytes,
+            packing_params);
+        } else {
+          pack_dwconv_ghw_w(
+            kernel_height, kernel_width,
+            groups, dwconv_ukernel->channel_tile,
+            kernel, bias, convolution_op->packed_weights,
+            dwconv_ukernel->channel_tile * extra_weights_bytes,
+            packing_params);
+        }
       }
 
-      if (scale_params != NULL) {
+      if (pack && scale_params != NULL) {
         assert(init_scale_params != NULL);
 
         init_scale_params(
@@ -391,9 +442,34 @@ static enum xnn_status create_convolution2d_nhwc(
       zero_size = XNN_EXTRA_BYTES + (c_stride << log2_input_element_size);
       break;
     }
+    case xnn_ukernel_type_dconv:
     case xnn_ukernel_type_gemm:
     case xnn_ukernel_type_igemm:
     {
+      struct gemm_parameters autotuned_gemm_parameters;
+      struct gemm_parameters dconv_gemm_parameters;
+      if (ukernel_type == xnn_ukernel_type_dconv) {
+        assert(dconv_parameters != NULL);
+        assert(dconv_params != NULL);
+
+        // Direct Convolution uses the IGEMM layout of packed weights with KR = SR = 1.
+        dconv_gemm_parameters = (struct gemm_parameters) {
+          .mr = dconv_parameters->mr,
+          .nr = dconv_parameters->nr,
+        };
+        gemm_parameters = &dconv_gemm_parameters;
+        gemm_params = dconv_params;
+        gemm_params_size = dconv_params_size;
+      } else if ((flags & XNN_FLAG_AUTOTUNE) && operator_type == xnn_operator_type_convolution_nhwc_f32) {
+        const enum xnn_status autotune_status = xnn_autotune_f32_gemm(
+          ukernel_type, group_output_channels, group_input_channels, kernel_size, &autotuned_gemm_parameters);
+        if (autotune_status != xnn_status_success) {
+          status = autotune_status;
+          goto error;
+        }
+        gemm_parameters = &autotuned_gemm_parameters;
+      }
+
       const uint32_t nr = gemm_parameters->nr;
       const uint32_t kr = UINT32_C(1) << gemm_parameters->log2_kr;
       const uint32_t sr = UINT32_C(1) << gemm_parameters->log2_sr;
@@ -401,14 +477,22 @@ static enum xnn_status create_convolution2d_nhwc(
       const size_t k_stride = round_up_po2(group_input_channels, kr * sr);
 
       const size_t packed_group_weights_size = ((kernel_size * k_stride << log2_filter_element_size) + bias_element_size + extra_weights_bytes) * n_stride;
-      convolution_op->packed_weights = xnn_allocate_simd_memory(packed_group_weights_size * groups);
-      if (convolution_op->packed_weights == NULL) {
-        xnn_log_error(
-          "failed to allocate %zu bytes for %s operator packed weights",
-          packed_group_weights_size * groups, xnn_operator_type_to_string(operator_type));
+      layout[8] = nr;
+      layout[9] = kr;
+      layout[10] = sr;
+      layout[11] = packed_group_weights_size * groups;
+      status = xnn_init_packed_weights(
+        convolution_op, packed_weights_buffer, packed_group_weights_size * groups,
+        xnn_compute_packed_weights_fingerprint(
+          layout, XNN_COUNT_OF(layout), packing_params, packing_params_size),
+        flags, operator_type, &pack);
+      if (status != xnn_status_success) {
         goto error;
       }
-      memset(convolution_op->packed_weights, packed_weights_padding_byte, packed_group_weights_size * groups);
+      status = xnn_status_out_of_memory;
+      if (pack) {
+        memset(convolution_op->packed_weights, packed_weights_padding_byte, packed_group_weights_size * groups);
+      }
       memcpy(&convolution_op->params, gemm_params, gemm_params_size);
 
       const struct gemm_fused_ukernels* gemm_ukernels = &gemm_parameters->minmax;
@@ -417,12 +501,40 @@ static enum xnn_status create_convolution2d_nhwc(
       } else if (relu_activation && gemm_parameters->relu.gemm.function[XNN_UARCH_DEFAULT] != NULL) {
         gemm_ukernels = &gemm_parameters->relu;
       }
+
+      // Weights in F32 are converted to F16 while packing.
+      const bool fp32_static_weights =
+        operator_type == xnn_operator_type_convolution_nhwc_f16 && (flags & XNN_FLAG_FP32_STATIC_WEIGHTS) != 0;
+      const uint32_t log2_kernel_element_size = fp32_static_weights ? 2 : log2_filter_element_size;
+      const size_t bias_input_element_size = fp32_static_weights ? sizeof(float) : bias_element_size;
+      convolution_op->context.pack_gemm = (struct pack_gemm_context) {
+        .groups = groups,
+        .ks = kernel_size,
+        .kc = group_input_channels,
+        .nc = group_output_channels,
+        .nr = nr,
+        .kr = kr,
+        .sr = sr,
+        .num_k_segments = 1,
+        .kernel = kernel,
+        .log2_kernel_element_size = log2_kernel_element_size,
+        .kernel_n_stride = (kernel_size * group_input_channels) << log2_kernel_element_size,
+        .kernel_g_stride = (group_output_channels * kernel_size * group_input_channels) << log2_kernel_element_size,
+        .bias = bias,
+        .bias_n_stride = bias_input_element_size,
+        .bias_g_stride = group_output_channels * bias_input_element_size,
+        .packed_w = convolution_op->packed_weights,
+        .packed_n_stride = nr * ((kernel_size * k_stride << log2_filter_element_size) + bias_element_size + extra_weights_bytes),
+        .packed_g_stride = packed_group_weights_size,
+        .extra_bytes = nr * extra_weights_bytes,
+      };
+      if (packing_params != NULL) {
+        memcpy(&convolution_op->context.pack_gemm.packing_params, packing_params, packing_params_size);
+      }
       switch (ukernel_type) {
         case xnn_ukernel_type_gemm:
-          pack_gemm_goi_w(
-              groups, group_output_channels, group_input_channels,
-              nr, kr, sr,
-              kernel, bias, convolution_op->packed_weights, gemm_parameters->nr * extra_weights_bytes, packing_params);
+          convolution_op->context.pack_gemm.pack_gemm_goi_w = pack_gemm_goi_w;
+          convolution_op->weights_packing_pending = pack;
           convolution_op->ukernel.gemm = (struct xnn_ukernel_gemm) {
             .mr = gemm_parameters->mr,
             .nr = nr,
@@ -452,15 +564,15 @@ static enum xnn_status create_convolution2d_nhwc(
           break;
         case xnn_ukernel_type_igemm:
           if (flags & XNN_FLAG_DEPTHWISE_CONVOLUTION) {
-            pack_conv_kgo_w(
-              groups, group_output_channels, kernel_size,
-              nr, kr, sr,
-              kernel, bias, convolution_op->packed_weights, gemm_parameters->nr * extra_weights_bytes, packing_params);
+            if (pack) {
+              pack_conv_kgo_w(
+                groups, group_output_channels, kernel_size,
+                nr, kr, sr,
+                kernel, bias, convolution_op->packed_weights, gemm_parameters->nr * extra_weights_bytes, packing_params);
+            }
           } else {
-            pack_conv_goki_w(
-              groups, group_output_channels, kernel_size, group_input_channels,
-              nr, kr, sr,
-              kernel, bias, convolution_op->packed_weights, gemm_parameters->nr * extra_weights_bytes, packing_params);
+            convolution_op->context.pack_gemm.pack_conv_goki_w = pack_conv_goki_w;
+            convolution_op->weights_packing_pending = pack;
           }
           convolution_op->ukernel.igemm = (struct xnn_ukernel_igemm) {
             .mr = gemm_parameters->mr,
@@ -491,12 +603,21 @@ static enum xnn_status create_convolution2d_nhwc(
             }
           #endif  // XNN_PLATFORM_JIT
 
+          break;
+        case xnn_ukernel_type_dconv:
+          convolution_op->context.pack_gemm.pack_conv_goki_w = pack_conv_goki_w;
+          convolution_op->weights_packing_pending = pack;
+          convolution_op->ukernel.dconv = (struct xnn_ukernel_dconv) {
+            .function = dconv_parameters->ukernel,
+            .mr = dconv_parameters->mr,
+            .nr = nr,
+          };
           break;
         default:
           XNN_UNREACHABLE;
       }
 
-      if (scale_params != NULL) {
+      if (pack && scale_params != NULL) {
         assert(init_scale_params != NULL);
 
         void* group_weights = (void*)
@@ -512,6 +633,12 @@ static enum xnn_status create_convolution2d_nhwc(
         }
       }
 
+      // Without XNN_FLAG_DEFER_PACKING, pack right away on the caller thread. Scale parameters are initialized above
+      // in either case, as packing leaves the extra weights bytes intact.
+      if (!(flags & XNN_FLAG_DEFER_PACKING)) {
+        xnn_pack_operator_weights(convolution_op, NULL /* threadpool */);
+      }
+
       zero_size = XNN_EXTRA_BYTES + (k_stride << log2_input_element_size);
       break;
     }
@@ -521,7 +648,7 @@ static enum xnn_status create_convolution2d_nhwc(
 
   const bool tf_same_padding = (flags & XNN_FLAG_TENSORFLOW_SAME_PADDING) != 0 && kernel_size != 1;
   if (any_padding || tf_same_padding) {
-    convolution_op->zero_buffer = xnn_allocate_simd_memory(zero_size);
+    convolution_op->zero_buffer = xnn_allocate_tagged_simd_memory(xnn_memory_category_zero_buffer, zero_size);
     if (convolution_op->zero_buffer == NULL) {
       xnn_log_error(
         "failed to allocate %zu bytes for %s operator zero padding",
@@ -530,6 +657,8 @@ static enum xnn_status create_convolution2d_nhwc(
     }
     memset(convolution_op->zero_buffer, input_padding_byte, zero_size);
   }
+  // Padding byte of the zero buffer, checked before an indirection buffer (which points to the zero buffer) is shared.
+  convolution_op->input_zero_point = (int32_t) (uint8_t) input_padding_byte;
 
   convolution_op->padding_top = input_padding_top;
   convolution_op->padding_right = input_padding_right;
@@ -669,19 +798,21 @@ enum xnn_status xnn_create_convolution2d_nhwc_qu8(
     (xnn_pack_gemm_goi_w_function) xnn_pack_qu8_gemm_goi_w,
     (xnn_pack_conv_kgo_w_function) xnn_pack_qu8_conv_kgo_w,
     (xnn_pack_conv_goki_w_function) xnn_pack_qu8_conv_goki_w,
-    &packing_params, input_zero_point /* input padding byte */, kernel_zero_point /* packed weights padding byte */,
+    &packing_params, sizeof(packing_params), input_zero_point /* input padding byte */, kernel_zero_point /* packed weights padding byte */,
     0 /* extra weights bytes */, NULL /* init scale params fn */, NULL /* scale params */,
     &gemm_params, sizeof(gemm_params),
     &dwconv_params, sizeof(dwconv_params),
+    NULL /* dconv params */, 0,
     NULL /* vmulcaddc params */, 0,
-    &xnn_params.qu8.gemm, dwconv_ukernel, NULL /* vmulcaddc parameters */,
+    &xnn_params.qu8.gemm, dwconv_ukernel, NULL /* dconv parameters */, NULL /* vmulcaddc parameters */,
     NULL /* jit_gemm_params */,
     false /* linear activation */, false /* relu activation */, XNN_INIT_FLAG_QU8,
+    NULL /* packed weights buffer */,
     xnn_operator_type_convolution_nhwc_qu8,
     convolution_op_out);
 }
 
-enum xnn_status xnn_create_convolution2d_nhwc_qs8(
+static enum xnn_status create_convolution2d_nhwc_qs8(
     uint32_t input_padding_top,
     uint32_t input_padding_right,
     uint32_t input_padding_bottom,
@@ -707,6 +838,7 @@ enum xnn_status xnn_create_convolution2d_nhwc_qs8(
     int8_t output_min,
     int8_t output_max,
     uint32_t flags,
+    struct xnn_packed_weights_buffer* packed_weights_buffer,
     xnn_operator_t* convolution_op_out)
 {
   if (input_scale <= 0.0f || !isnormal(input_scale)) {
@@ -763,6 +895,14 @@ enum xnn_status xnn_create_convolution2d_nhwc_qs8(
       requantization_scale, output_zero_point, output_min, output_max);
   }
 
+  union xnn_qs8_conv_minmax_params dconv_params;
+  const struct dconv_parameters* dconv_parameters = NULL;
+  if (xnn_params.qs8.dconv.ukernel != NULL) {
+    dconv_parameters = &xnn_params.qs8.dconv;
+    dconv_parameters->init.qs8(&dconv_params,
+      requantization_scale, output_zero_point, output_min, output_max);
+  }
+
   return create_convolution2d_nhwc(
     input_padding_top, input_padding_right, input_padding_bottom, input_padding_left,
     kernel_height, kernel_width,
@@ -780,18 +920,157 @@ enum xnn_status xnn_create_convolution2d_nhwc_qs8(
     (xnn_pack_gemm_goi_w_function) xnn_pack_qs8_gemm_goi_w,
     (xnn_pack_conv_kgo_w_function) xnn_pack_qs8_conv_kgo_w,
     (xnn_pack_conv_goki_w_function) xnn_pack_qs8_conv_goki_w,
-    &packing_params, input_zero_point /* input padding byte */, 0 /* packed weights padding byte */,
+    &packing_params, sizeof(packing_params), input_zero_point /* input padding byte */, 0 /* packed weights padding byte */,
     0 /* extra weights bytes */, NULL /* init scale params fn */, NULL /* scale params */,
     &gemm_params, sizeof(gemm_params),
     &dwconv_params, sizeof(dwconv_params),
+    &dconv_params, sizeof(dconv_params),
     NULL /* vmulcaddc params */, 0,
-    &xnn_params.qs8.gemm, dwconv_ukernel, NULL /* vmulcaddc parameters */,
+    &xnn_params.qs8.gemm, dwconv_ukernel, dconv_parameters, NULL /* vmulcaddc parameters */,
     NULL /* jit_gemm_params */,
     false /* linear activation */, false /* relu activation */, XNN_INIT_FLAG_QS8,
+    packed_weights_buffer,
     xnn_operator_type_convolution_nhwc_qs8,
     convolution_op_out);
 }
 
+enum xnn_status xnn_create_convolution2d_nhwc_qs8(
+    uint32_t input_padding_top,
+    uint32_t input_padding_right,
+    uint32_t input_padding_bottom,
+    uint32_t input_padding_left,
+    uint32_t kernel_height,
+    uint32_t kernel_width,
+    uint32_t subsampling_height,
+    uint32_t subsampling_width,
+    uint32_t dilation_height,
+    uint32_t dilation_width,
+    uint32_t groups,
+    size_t group_input_channels,
+    size_t group_output_channels,
+    size_t input_channel_stride,
+    size_t output_channel_stride,
+    int8_t input_zero_point,
+    float input_scale,
+    float kernel_scale,
+    const int8_t* kernel,
+    const int32_t* bias,
+    int8_t output_zero_point,
+    float output_scale,
+    int8_t output_min,
+    int8_t output_max,
+    uint32_t flags,
+    xnn_operator_t* convolution_op_out)
+{
+  return create_convolution2d_nhwc_qs8(
+    input_padding_top, input_padding_right, input_padding_bottom, input_padding_left,
+    kernel_height, kernel_width,
+    subsampling_height, subsampling_width,
+    dilation_height, dilation_width,
+    groups, group_input_channels, group_output_channels,
+    input_channel_stride, output_channel_stride,
+    input_zero_point, input_scale, kernel_scale,
+    kernel, bias,
+    output_zero_point, output_scale, output_min, output_max,
+    flags, NULL /* packed weights buffer */, convolution_op_out);
+}
+
+enum xnn_status xnn_pack_convolution2d_nhwc_qs8_weights(
+    uint32_t input_padding_top,
+    uint32_t input_padding_right,
+    uint32_t input_padding_bottom,
+    uint32_t input_padding_left,
+    uint32_t kernel_height,
+    uint32_t kernel_width,
+    uint32_t subsampling_height,
+    uint32_t subsampling_width,
+    uint32_t dilation_height,
+    uint32_t dilation_width,
+    uint32_t groups,
+    size_t group_input_channels,
+    size_t group_output_channels,
+    int8_t input_zero_point,
+    const int8_t* kernel,
+    const int32_t* bias,
+    uint32_t flags,
+    void* packed_weights,
+    size_t* packed_weights_size,
+    uint64_t* packed_weights_fingerprint)
+{
+  struct xnn_packed_weights_buffer packed_weights_buffer = {
+    .data = packed_weights,
+    .size = *packed_weights_size,
+  };
+  // Quantization parameters other than the input zero point do not affect the packed weights.
+  xnn_operator_t convolution_op = NULL;
+  const enum xnn_status status = create_convolution2d_nhwc_qs8(
+    input_padding_top, input_padding_right, input_padding_bottom, input_padding_left,
+    kernel_height, kernel_width,
+    subsampling_height, subsampling_width,
+    dilation_height, dilation_width,
+    groups, group_input_channels, group_output_channels,
+    groups * group_input_channels /* input channel stride */,
+    groups * group_output_channels /* output channel stride */,
+    input_zero_point, 1.0f /* input scale */, 1.0f /* kernel scale */,
+    kernel, bias,
+    0 /* output zero point */, 1.0f /* output scale */, INT8_MIN, INT8_MAX,
+    flags & ~XNN_FLAG_DEFER_PACKING, &packed_weights_buffer, &convolution_op);
+  *packed_weights_size = packed_weights_buffer.size;
+  *packed_weights_fingerprint = packed_weights_buffer.fingerprint;
+  if (status == xnn_status_success) {
+    xnn_delete_operator(convolution_op);
+  }
+  return status;
+}
+
+enum xnn_status xnn_create_convolution2d_nhwc_qs8_with_packed_weights(
+    uint32_t input_padding_top,
+    uint32_t input_padding_right,
+    uint32_t input_padding_bottom,
+    uint32_t input_padding_left,
+    uint32_t kernel_height,
+    uint32_t kernel_width,
+    uint32_t subsampling_height,
+    uint32_t subsampling_width,
+    uint32_t dilation_height,
+    uint32_t dilation_width,
+    uint32_t groups,
+    size_t group_input_channels,
+    size_t group_output_channels,
+    size_t input_channel_stride,
+    size_t output_channel_stride,
+    int8_t input_zero_point,
+    float input_scale,
+    float kernel_scale,
+    const void* packed_weights,
+    size_t packed_weights_size,
+    uint64_t packed_weights_fingerprint,
+    int8_t output_zero_point,
+    float output_scale,
+    int8_t output_min,
+    int8_t output_max,
+    uint32_t flags,
+    xnn_operator_t* convolution_op_out)
+{
+  struct xnn_packed_weights_buffer packed_weights_buffer = {
+    .data = (void*) packed_weights,
+    .size = packed_weights_size,
+    .fingerprint = packed_weights_fingerprint,
+    .prepacked = true,
+  };
+  return create_convolution2d_nhwc_qs8(
+    input_padding_top, input_padding_right, input_padding_bottom, input_padding_left,
+    kernel_height, kernel_width,
+    subsampling_height, subsampling_width,
+    dilation_height, dilation_width,
+    groups, group_input_channels, group_output_channels,
+    input_channel_stride, output_channel_stride,
+    input_zero_point, input_scale, kernel_scale,
+    NULL /* kernel */, NULL /* bias */,
+    output_zero_point, output_scale, output_min, output_max,
+    flags, &packed_weights_buffer, convolution_op_out);
+}
+
 enum xnn_status xnn_create_convolution2d_nhwc_qc8(
     uint32_t input_padding_top,
     uint32_t input_padding_right,
@@ -899,14 +1178,16 @@ enum xnn_status xnn_create_convolution2d_nhwc_qc8(
     (xnn_pack_gemm_goi_w_function) xnn_pack_qs8_gemm_goi_w,
     (xnn_pack_conv_kgo_w_function) xnn_pack_qs8_conv_kgo_w,
     (xnn_pack_conv_goki_w_function) xnn_pack_qs8_conv_goki_w,
-    &packing_params, input_zero_point /* input padding byte */, 0 /* packed weights padding byte */,
+    &packing_params, sizeof(packing_params), input_zero_point /* input padding byte */, 0 /* packed weights padding byte */,
     sizeof(float) /* extra weights bytes */, xnn_init_qc8_scale_fp32_params, requantization_scale,
     &gemm_params, sizeof(gemm_params),
     &dwconv_params, sizeof(dwconv_params),
+    NULL /* dconv params */, 0,
     NULL /* vmulcaddc params */, 0,
-    &xnn_params.qc8.gemm, dwconv_ukernel, NULL /* vmulcaddc parameters */,
+    &xnn_params.qc8.gemm, dwconv_ukernel, NULL /* dconv parameters */, NULL /* vmulcaddc parameters */,
     NULL /* jit_gemm_params */,
     false /* linear activation */, false /* relu activation */, XNN_INIT_FLAG_QC8,
+    NULL /* packed weights buffer */,
     xnn_operator_type_convolution_nhwc_qc8,
     convolution_op_out);
 }
@@ -972,6 +1253,13 @@ enum xnn_status xnn_create_convolution2d_nhwc_f16(
     dwconv_ukernel->init.f16(&dwconv_params, fp16_output_min, fp16_output_max);
   }
 
+  union xnn_f16_minmax_params dconv_params;
+  const struct dconv_parameters* dconv_parameters = NULL;
+  if (xnn_params.f16.dconv.ukernel != NULL) {
+    dconv_parameters = &xnn_params.f16.dconv;
+    dconv_parameters->init.f16(&dconv_params, fp16_output_min, fp16_output_max);
+  }
+
   union xnn_f16_minmax_params vmulcaddc_params;
   if XNN_LIKELY(xnn_params.f16.vmulcaddc.init.f16 != NULL) {
     xnn_params.f16.vmulcaddc.init.f16(&vmulcaddc_params, fp16_output_min, fp16_output_max);
@@ -1009,19 +1297,21 @@ enum xnn_status xnn_create_convolution2d_nhwc_f16(
     pack_gemm_goi_w,
     pack_conv_kgo_w,
     pack_conv_goki_w,
-    NULL /* packing params */, 0 /* input padding byte */, 0 /* packed weights padding byte */,
+    NULL /* packing params */, 0 /* packing params size */, 0 /* input padding byte */, 0 /* packed weights padding byte */,
     0 /* extra weights bytes */, NULL /* init scale params fn */, NULL /* scale params */,
     &gemm_params, sizeof(gemm_params),
     &dwconv_params, sizeof(dwconv_params),
+    &dconv_params, sizeof(dconv_params),
     &vmulcaddc_params, sizeof(vmulcaddc_params),
-    &xnn_params.f16.gemm, dwconv_ukernel, &xnn_params.f16.vmulcaddc,
+    &xnn_params.f16.gemm, dwconv_ukernel, dconv_parameters, &xnn_params.f16.vmulcaddc,
     NULL /* jit_gemm_params */,
     false /* linear activation */, false /* relu activation */, XNN_INIT_FLAG_F16,
+    NULL /* packed weights buffer */,
     xnn_operator_type_convolution_nhwc_f16,
     convolution_op_out);
 }
 
-enum xnn_status xnn_create_convolution2d_nhwc_f32(
+static enum xnn_status create_convolution2d_nhwc_f32(
     uint32_t input_padding_top,
     uint32_t input_padding_right,
     uint32_t input_padding_bottom,
@@ -1042,26 +1332,28 @@ enum xnn_status xnn_create_convolution2d_nhwc_f32(
     float output_min,
     float output_max,
     uint32_t flags,
+    struct xnn_packed_weights_buffer* packed_weights_buffer,
+    enum xnn_operator_type operator_type,
     xnn_operator_t* convolution_op_out)
 {
   if (isnan(output_min)) {
     xnn_log_error(
       "failed to create %s operator with NaN output lower bound: lower bound must be non-NaN",
-      xnn_operator_type_to_string(xnn_operator_type_convolution_nhwc_f32));
+      xnn_operator_type_to_string(operator_type));
     return xnn_status_invalid_parameter;
   }
 
   if (isnan(output_max)) {
     xnn_log_error(
       "failed to create %s operator with NaN output upper bound: upper bound must be non-NaN",
-      xnn_operator_type_to_string(xnn_operator_type_convolution_nhwc_f32));
+      xnn_operator_type_to_string(operator_type));
     return xnn_status_invalid_parameter;
   }
 
   if (output_min >= output_max) {
     xnn_log_error(
       "failed to create %s operator with [%.7g, %.7g] output range: lower bound must be below upper bound",
-      xnn_operator_type_to_string(xnn_operator_type_convolution_nhwc_f32), output_min, output_max);
+      xnn_operator_type_to_string(operator_type), output_min, output_max);
     return xnn_status_invalid_parameter;
   }
 
@@ -1087,6 +1379,13 @@ enum xnn_status xnn_create_convolution2d_nhwc_f32(
     dwconv_ukernel->init.f32(&dwconv_params, output_min, output_max);
   }
 
+  union xnn_f32_minmax_params dconv_params;
+  const struct dconv_parameters* dconv_parameters = NULL;
+  if (xnn_params.f32.dconv.ukernel != NULL) {
+    dconv_parameters = &xnn_params.f32.dconv;
+    dconv_parameters->init.f32(&dconv_params, output_min, output_max);
+  }
+
   union xnn_f32_minmax_params vmulcaddc_params;
   if XNN_LIKELY(xnn_params.f32.vmulcaddc.init.f32 != NULL) {
     xnn_params.f32.vmulcaddc.init.f32(&vmulcaddc_params, output_min, output_max);
@@ -1109,18 +1408,254 @@ enum xnn_status xnn_create_convolution2d_nhwc_f32(
     (xnn_pack_gemm_goi_w_function) xnn_pack_f32_gemm_goi_w,
     (xnn_pack_conv_kgo_w_function) xnn_pack_f32_conv_kgo_w,
     (xnn_pack_conv_goki_w_function) xnn_pack_f32_conv_goki_w,
-    NULL /* packing params */, 0 /* input padding byte */, 0 /* packed weights padding byte */,
+    NULL /* packing params */, 0 /* packing params size */, 0 /* input padding byte */, 0 /* packed weights padding byte */,
     0 /* extra weights bytes */, NULL /* init scale params fn */, NULL /* scale params */,
     &gemm_params, sizeof(gemm_params),
     &dwconv_params, sizeof(dwconv_params),
+    &dconv_params, sizeof(dconv_params),
     &vmulcaddc_params, sizeof(vmulcaddc_params),
-    &xnn_params.f32.gemm, dwconv_ukernel, &xnn_params.f32.vmulcaddc,
+    &xnn_params.f32.gemm, dwconv_ukernel, dconv_parameters, &xnn_params.f32.vmulcaddc,
     &jit_gemm_params,
     linear_activation, relu_activation, XNN_INIT_FLAG_F32,
-    xnn_operator_type_convolution_nhwc_f32,
+    packed_weights_buffer,
+    operator_type,
     convolution_op_out);
 }
 
+enum xnn_status xnn_create_convolution2d_nhwc_f32(
+    uint32_t input_padding_top,
+    uint32_t input_padding_right,
+    uint32_t input_padding_bottom,
+    uint32_t input_padding_left,
+    uint32_t kernel_height,
+    uint32_t kernel_width,
+    uint32_t subsampling_height,
+    uint32_t subsampling_width,
+    uint32_t dilation_height,
+    uint32_t dilation_width,
+    uint32_t groups,
+    size_t group_input_channels,
+    size_t group_output_channels,
+    size_t input_channel_stride,
+    size_t output_channel_stride,
+    const float* kernel,
+    const float* bias,
+    float output_min,
+    float output_max,
+    uint32_t flags,
+    xnn_operator_t* convolution_op_out)
+{
+  return create_convolution2d_nhwc_f32(
+    input_padding_top, input_padding_right, input_padding_bottom, input_padding_left,
+    kernel_height, kernel_width,
+    subsampling_height, subsampling_width,
+    dilation_height, dilation_width,
+    groups, group_input_channels, group_output_channels,
+    input_channel_stride, output_channel_stride,
+    kernel, bias, output_min, output_max,
+    flags, NULL /* packed weights buffer */, xnn_operator_type_convolution_nhwc_f32, convolution_op_out);
+}
+
+enum xnn_status xnn_pack_convolution2d_nhwc_f32_weights(
+    uint32_t input_padding_top,
+    uint32_t input_padding_right,
+    uint32_t input_padding_bottom,
+    uint32_t input_padding_left,
+    uint32_t kernel_height,
+    uint32_t kernel_width,
+    uint32_t subsampling_height,
+    uint32_t subsampling_width,
+    uint32_t dilation_height,
+    uint32_t dilation_width,
+    uint32_t groups,
+    size_t group_input_channels,
+    size_t group_output_channels,
+    const float* kernel,
+    const float* bias,
+    uint32_t flags,
+    void* packed_weights,
+    size_t* packed_weights_size,
+    uint64_t* packed_weights_fingerprint)
+{
+  struct xnn_packed_weights_buffer packed_weights_buffer = {
+    .data = packed_weights,
+    .size = *packed_weights_size,
+  };
+  xnn_operator_t convolution_op = NULL;
+  const enum xnn_status status = create_convolution2d_nhwc_f32(
+    input_padding_top, input_padding_right, input_padding_bottom, input_padding_left,
+    kernel_height, kernel_width,
+    subsampling_height, subsampling_width,
+    dilation_height, dilation_width,
+    groups, group_input_channels, group_output_channels,
+    groups * group_input_channels /* input channel stride */,
+    groups * group_output_channels /* output channel stride */,
+    kernel, bias, -INFINITY, INFINITY,
+    flags & ~XNN_FLAG_DEFER_PACKING, &packed_weights_buffer, xnn_operator_type_convolution_nhwc_f32, &convolution_op);
+  *packed_weights_size = packed_weights_buffer.size;
+  *packed_weights_fingerprint = packed_weights_buffer.fingerprint;
+  if (status == xnn_status_success) {
+    xnn_delete_operator(convolution_op);
+  }
+  return status;
+}
+
+enum xnn_status xnn_create_convolution2d_nhwc_f32_with_packed_weights(
+    uint32_t input_padding_top,
+    uint32_t input_padding_right,
+    uint32_t input_padding_bottom,
+    uint32_t input_padding_left,
+    uint32_t kernel_height,
+    uint32_t kernel_width,
+    uint32_t subsampling_height,
+    uint32_t subsampling_width,
+    uint32_t dilation_height,
+    uint32_t dilation_width,
+    uint32_t groups,
+    size_t group_input_channels,
+    size_t group_output_channels,
+    size_t input_channel_stride,
+    size_t output_channel_stride,
+    const void* packed_weights,
+    size_t packed_weights_size,
+    uint64_t packed_weights_fingerprint,
+    float output_min,
+    float output_max,
+    uint32_t flags,
+    xnn_operator_t* convolution_op_out)
+{
+  struct xnn_packed_weights_buffer packed_weights_buffer = {
+    .data = (void*) packed_weights,
+    .size = packed_weights_size,
+    .fingerprint = packed_weights_fingerprint,
+    .prepacked = true,
+  };
+  return create_convolution2d_nhwc_f32(
+    input_padding_top, input_padding_right, input_padding_bottom, input_padding_left,
+    kernel_height, kernel_width,
+    subsampling_height, subsampling_width,
+    dilation_height, dilation_width,
+    groups, group_input_channels, group_output_channels,
+    input_channel_stride, output_channel_stride,
+    NULL /* kernel */, NULL /* bias */, output_min, output_max,
+    flags, &packed_weights_buffer, xnn_operator_type_convolution_nhwc_f32, convolution_op_out);
+}
+
+enum xnn_status xnn_create_convolution1d_nwc_f32(
+    uint32_t input_padding_left,
+    uint32_t input_padding_right,
+    uint32_t kernel_width,
+    uint32_t subsampling,
+    uint32_t dilation,
+    uint32_t groups,
+    size_t group_input_channels,
+    size_t group_output_channels,
+    size_t input_channel_stride,
+    size_t output_channel_stride,
+    const float* kernel,
+    const float* bias,
+    float output_min,
+    float output_max,
+    uint32_t flags,
+    xnn_operator_t* convolution_op_out)
+{
+  const bool streaming = (flags & XNN_FLAG_STREAMING) != 0;
+  if (streaming) {
+    if (input_padding_right != 0) {
+      xnn_log_error(
+        "failed to create streaming %s operator with %" PRIu32 " right padding: right padding must be zero",
+        xnn_operator_type_to_string(xnn_operator_type_convolution_nwc_f32), input_padding_right);
+      return xnn_status_invalid_parameter;
+    }
+    if ((flags & (XNN_FLAG_TENSORFLOW_SAME_PADDING | XNN_PADDING_MODE_FLAGS)) != 0) {
+      xnn_log_error(
+        "failed to create streaming %s operator with 0x%08" PRIx32 " flags: "
+        "TensorFlow SAME padding and reflect, symmetric, or edge padding modes are not supported",
+        xnn_operator_type_to_string(xnn_operator_type_convolution_nwc_f32), flags);
+      return xnn_status_invalid_parameter;
+    }
+    // Every chunk must leave the next output window within the retained history: the history never skips frames.
+    const uint32_t effective_kernel_width = (kernel_width - 1) * dilation + 1;
+    if (kernel_width != 0 && dilation != 0 && subsampling > effective_kernel_width) {
+      xnn_log_error(
+        "failed to create streaming %s operator with %" PRIu32 " subsampling: "
+        "subsampling must not exceed the dilated kernel width of %" PRIu32,
+        xnn_operator_type_to_string(xnn_operator_type_convolution_nwc_f32), subsampling, effective_kernel_width);
+      return xnn_status_unsupported_parameter;
+    }
+  }
+
+  // Streaming operators start every sequence with the left padding in the history instead.
+  xnn_operator_t convolution_op = NULL;
+  const enum xnn_status status = create_convolution2d_nhwc_f32(
+    0 /* input padding top */, input_padding_right, 0 /* input padding bottom */,
+    streaming ? 0 : input_padding_left,
+    1 /* kernel height */, kernel_width,
+    1 /* subsampling height */, subsampling,
+    1 /* dilation height */, dilation,
+    groups, group_input_channels, group_output_channels,
+    input_channel_stride, output_channel_stride,
+    kernel, bias, output_min, output_max,
+    flags, NULL /* packed weights buffer */, xnn_operator_type_convolution_nwc_f32, &convolution_op);
+  if (status != xnn_status_success) {
+    return status;
+  }
+
+  if (streaming) {
+    convolution_op->streaming.initial_history_frames = input_padding_left;
+    convolution_op->streaming.history_frames = input_padding_left;
+    convolution_op->streaming.history_capacity = max(input_padding_left, (kernel_width - 1) * dilation);
+  }
+  *convolution_op_out = convolution_op;
+  return xnn_status_success;
+}
+
+// Checks if the IGEMM-based convolution_op can use the indirection buffer of its indirection source in setup: the
+// source must have built its indirection buffer, in the same format, for the same input shape and convolution
+// geometry, and its zero buffer (which padding entries point to) must be large enough and filled with the same byte.
+static bool can_share_indirection_buffer(
+  const struct xnn_operator* convolution_op,
+  uint32_t mr,
+  bool compact_indirection)
+{
+  const struct xnn_operator* source = convolution_op->indirection_source;
+  if (source == NULL || source->indirection_buffer == NULL ||
+      source->type != convolution_op->type || source->ukernel.type != xnn_ukernel_type_igemm)
+  {
+    return false;
+  }
+  if (source->last_input_height != convolution_op->input_height ||
+      source->last_input_width != convolution_op->input_width ||
+      source->input_pixel_stride != convolution_op->input_pixel_stride ||
+      source->indirection_mr != mr ||
+      source->compact_indirection != compact_indirection)
+  {
+    return false;
+  }
+  if (source->kernel_height != convolution_op->kernel_height ||
+      source->kernel_width != convolution_op->kernel_width ||
+      source->stride_height != convolution_op->stride_height ||
+      source->stride_width != convolution_op->stride_width ||
+      source->dilation_height != convolution_op->dilation_height ||
+      source->dilation_width != convolution_op->dilation_width ||
+      source->padding_top != convolution_op->padding_top ||
+      source->padding_left != convolution_op->padding_left ||
+      source->output_height != convolution_op->output_height ||
+      source->output_width != convolution_op->output_width ||
+      (source->flags & XNN_PADDING_MODE_FLAGS) != (convolution_op->flags & XNN_PADDING_MODE_FLAGS))
+  {
+    return false;
+  }
+  if (convolution_op->zero_buffer == NULL) {
+    // Without padding no entry points to the zero buffer.
+    return true;
+  }
+  return source->zero_buffer != NULL && source->input_zero_point == convolution_op->input_zero_point &&
+    round_up_po2(source->group_input_channels, source->ukernel.igemm.kr * source->ukernel.igemm.sr) >=
+      round_up_po2(convolution_op->group_input_channels,
+        convolution_op->ukernel.igemm.kr * convolution_op->ukernel.igemm.sr);
+}
+
 static enum xnn_status setup_convolution2d_nhwc(
   xnn_operator_t convolution_op,
   size_t batch_size,
@@ -1133,7 +1668,7 @@ static enum xnn_status setup_convolution2d_nhwc(
   uint32_t log2_filter_element_size,
   uint32_t extra_weights_elements_size,
   uint32_t log2_output_element_size,
-  size_t num_threads)
+  pthreadpool_t threadpool)
 {
   convolution_op->state = xnn_run_state_invalid;
 
@@ -1143,6 +1678,9 @@ static enum xnn_status setup_convolution2d_nhwc(
     return xnn_status_uninitialized;
   }
 
+  xnn_pack_operator_weights(convolution_op, threadpool);
+  const size_t num_threads = pthreadpool_get_threads_count(threadpool);
+
   if ((xnn_params.init_flags & datatype_init_flags) != datatype_init_flags) {
     xnn_log_error(
       "failed to create %s operator: operations on data type are not supported",
@@ -1157,6 +1695,33 @@ static enum xnn_status setup_convolution2d_nhwc(
     return xnn_status_invalid_parameter;
   }
 
+  const uint32_t padding_mode = convolution_op->flags & XNN_PADDING_MODE_FLAGS;
+  if (padding_mode != 0) {
+    // Reflect padding skips the first and last input rows and columns, so it can replicate one less than symmetric.
+    const size_t max_padding_height = padding_mode == XNN_FLAG_REFLECT_PADDING ? input_height - 1 :
+      padding_mode == XNN_FLAG_SYMMETRIC_PADDING ? input_height : SIZE_MAX;
+    const size_t max_padding_width = padding_mode == XNN_FLAG_REFLECT_PADDING ? input_width - 1 :
+      padding_mode == XNN_FLAG_SYMMETRIC_PADDING ? input_width : SIZE_MAX;
+    if (max(convolution_op->padding_top, convolution_op->padding_bottom) > max_padding_height ||
+        max(convolution_op->padding_left, convolution_op->padding_right) > max_padding_width)
+    {
+      xnn_log_error(
+        "failed to setup %s operator with %zux%zu input and %" PRIu32 "+%" PRIu32 "x%" PRIu32 "+%" PRIu32" padding: "
+        "padding exceeds the limit of the padding mode",
+        xnn_operator_type_to_string(convolution_op->type), input_width, input_height,
+        convolution_op->padding_top, convolution_op->padding_left,
+        convolution_op->padding_bottom, convolution_op->padding_right);
+      return xnn_status_invalid_parameter;
+    }
+  }
+
+  if (convolution_op->residual_ukernel != NULL && convolution_op->residual == NULL) {
+    xnn_log_error(
+      "failed to setup %s operator: residual tensor for the fused addition must be specified via xnn_setup_residual_add",
+      xnn_operator_type_to_string(convolution_op->type));
+    return xnn_status_invalid_state;
+  }
+
   if (batch_size == 0) {
     convolution_op->state = xnn_run_state_skip;
     return xnn_status_success;
@@ -1234,18 +1799,43 @@ static enum xnn_status setup_convolution2d_nhwc(
           .cg_stride = group_output_channels << log2_output_element_size,
           .log2_csize = log2_output_element_size,
           .ukernel = gemm_ukernel,
+          .residual = convolution_op->residual,
+          .residual_stride = convolution_op->residual_pixel_stride << log2_output_element_size,
+          .residual_ukernel = convolution_op->residual_ukernel,
       };
       memcpy(&convolution_op->context.gemm.params, &convolution_op->params, sizeof(convolution_op->context.gemm.params));
+      memcpy(&convolution_op->context.gemm.residual_params, &convolution_op->residual_params, sizeof(convolution_op->context.gemm.residual_params));
 
-      size_t nc = group_output_channels;
-      if (num_threads > 1) {
-        const size_t num_other_tiles = groups * divide_round_up(batch_output_size, mr);
-        const size_t target_tiles_per_thread = 5;
-        const size_t max_nc = divide_round_up(group_output_channels * num_other_tiles, num_threads * target_tiles_per_thread);
-        if (max_nc < nc) {
-          nc = min(nc, divide_round_up(nc, max_nc * nr) * nr);
+      const size_t gemm_k = group_input_channels;
+      if (groups == 1) {
+        const struct xnn_gemm_tiling tiling = xnn_compute_gemm_tiling(
+          batch_output_size, group_output_channels, gemm_k, mr, nr, w_stride, num_threads);
+        bool blocked = tiling.blocked;
+        #if XNN_MAX_UARCH_TYPES > 1
+          // Heterogeneous micro-kernels are selected per-core by pthreadpool, keep the default schedule for them.
+          blocked = blocked && !xnn_is_hmp_gemm_ukernel(gemm_ukernel);
+        #endif
+        if (blocked) {
+          convolution_op->context.gemm.mr = mr;
+          convolution_op->compute.type = xnn_parallelization_type_2d_tile_2d;
+          convolution_op->compute.task_2d_tile_2d = (pthreadpool_task_2d_tile_2d_t) xnn_compute_gemm_blocked;
+          convolution_op->compute.range[0] = group_output_channels;
+          convolution_op->compute.range[1] = batch_output_size;
+          convolution_op->compute.tile[0] = tiling.nc;
+          convolution_op->compute.tile[1] = tiling.mc;
+          convolution_op->compute.num_threads = tiling.num_threads;
+          convolution_op->state = xnn_run_state_ready;
+
+          return xnn_status_success;
         }
       }
+
+      const size_t work = xnn_estimate_work(
+        (double) groups * batch_output_size * group_output_channels * gemm_k,
+        (double) groups * (batch_output_size + group_output_channels) * w_stride);
+      const size_t num_other_tiles = groups * divide_round_up(batch_output_size, mr);
+      const size_t nc = xnn_compute_gemm_nc(num_other_tiles, group_output_channels, nr, xnn_compute_max_tiles(work, num_threads));
+      convolution_op->compute.num_threads = xnn_compute_num_useful_threads(work, num_threads);
       if (groups == 1) {
         #if XNN_MAX_UARCH_TYPES > 1
           if (xnn_is_hmp_gemm_ukernel(gemm_ukernel)) {
@@ -1304,13 +1894,31 @@ static enum xnn_status setup_convolution2d_nhwc(
         igemm_ukernel = convolution_op->ukernel.igemm.mr1_case;
       }
 
-      const size_t tiled_output_size = round_up(output_size, mr);
-      const size_t indirection_buffer_size = sizeof(void*) * kernel_size * tiled_output_size;
-
-      if (input_height != convolution_op->last_input_height ||
-          input_width != convolution_op->last_input_width)
+      // Offsets in compact indirection buffers must fit into 32 bits, and there is nothing to gain on 32-bit systems.
+      const size_t input_pixel_stride_bytes = convolution_op->input_pixel_stride << log2_input_element_size;
+      const bool compact_indirection = (convolution_op->flags & XNN_FLAG_COMPACT_INDIRECTION) != 0 &&
+        sizeof(void*) > sizeof(uint32_t) && kernel_size * mr <= XNN_MAX_COMPACT_INDIRECTION_TILE_ENTRIES &&
+        (input_height * input_width - 1) * input_pixel_stride_bytes < (size_t) XNN_INDIRECTION_ZERO_OFFSET;
+
+      const struct xnn_operator* indirection_op = convolution_op;
+      if (can_share_indirection_buffer(convolution_op, mr, compact_indirection)) {
+        indirection_op = convolution_op->indirection_source;
+        if (convolution_op->indirection_buffer != NULL) {
+          xnn_release_memory((void*) convolution_op->indirection_buffer);
+          convolution_op->indirection_buffer = NULL;
+          convolution_op->last_input_height = 0;
+          convolution_op->last_input_width = 0;
+        }
+      } else if (input_height != convolution_op->last_input_height ||
+                 input_width != convolution_op->last_input_width ||
+                 mr != convolution_op->indirection_mr ||
+                 compact_indirection != convolution_op->compact_indirection)
       {
-        const void** indirection_buffer = (const void**) xnn_reallocate_memory((void*) convolution_op->indirection_buffer, indirection_buffer_size);
+        const size_t tiled_output_size = round_up(output_size, mr);
+        const size_t indirection_buffer_size =
+          (compact_indirection ? sizeof(uint32_t) : sizeof(void*)) * kernel_size * tiled_output_size;
+        const void** indirection_buffer = (const void**) xnn_reallocate_tagged_memory(
+          xnn_memory_category_indirection, (void*) convolution_op->indirection_buffer, indirection_buffer_size);
         if (indirection_buffer == NULL) {
           xnn_log_error(
             "failed to allocate %zu bytes for %s operator indirection buffer",
@@ -1321,8 +1929,14 @@ static enum xnn_status setup_convolution2d_nhwc(
         convolution_op->last_input = input;
         convolution_op->last_input_height = input_height;
         convolution_op->last_input_width = input_width;
+        convolution_op->indirection_mr = mr;
+        convolution_op->compact_indirection = compact_indirection;
 
-        xnn_indirection_init_conv2d(convolution_op, mr, log2_input_element_size);
+        if (compact_indirection) {
+          xnn_indirection_init_conv2d_compact(convolution_op, mr, log2_input_element_size);
+        } else {
+          xnn_indirection_init_conv2d(convolution_op, mr, log2_input_element_size);
+        }
       }
 
       const size_t group_input_channels = convolution_op->group_input_channels;
@@ -1334,9 +1948,11 @@ static enum xnn_status setup_convolution2d_nhwc(
           .ks_scaled = kernel_size * mr * sizeof(void*),
           .kc = group_input_channels << log2_input_element_size,
           .w_stride = w_stride,
-          .indirect_a = convolution_op->indirection_buffer,
-          .a_offset = (size_t) ((uintptr_t) input - (uintptr_t) convolution_op->last_input),
-          .zero = convolution_op->zero_buffer,
+          .indirect_a = compact_indirection ? NULL : indirection_op->indirection_buffer,
+          .compact_indirect_a = compact_indirection ? (const uint32_t*) indirection_op->indirection_buffer : NULL,
+          .compact_indirect_base = indirection_op->last_input,
+          .a_offset = (size_t) ((uintptr_t) input - (uintptr_t) indirection_op->last_input),
+          .zero = indirection_op->zero_buffer,
           .packed_w = convolution_op->packed_weights,
           .c = convolution_op->output,
           .cm_stride = convolution_op->output_pixel_stride << log2_output_element_size,
@@ -1348,18 +1964,22 @@ static enum xnn_status setup_convolution2d_nhwc(
           .bc_stride = output_size * convolution_op->output_pixel_stride << log2_output_element_size,
           .log2_csize = log2_output_element_size,
           .ukernel = igemm_ukernel,
+          .residual = convolution_op->residual,
+          .residual_stride = convolution_op->residual_pixel_stride << log2_output_element_size,
+          .residual_batch_stride = output_size * convolution_op->residual_pixel_stride << log2_output_element_size,
+          .residual_ukernel = convolution_op->residual_ukernel,
       };
       memcpy(&convolution_op->context.igemm.params, &convolution_op->params, sizeof(convolution_op->context.igemm.params));
+      memcpy(&convolution_op->context.igemm.residual_params, &convolution_op->residual_params, sizeof(convolution_op->context.igemm.residual_params));
 
-      size_t nc = group_output_channels;
-      if (num_threads > 1) {
-        const size_t num_other_tiles = groups * batch_size * divide_round_up(output_size, mr);
-        const size_t target_tiles_per_thread = 5;
-        const size_t max_nc = divide_round_up(group_output_channels * num_other_tiles, num_threads * target_tiles_per_thread);
-        if (max_nc < nc) {
-          nc = min(nc, divide_round_up(nc, max_nc * nr) * nr);
-        }
-      }
+      const size_t batch_output_size = batch_size * output_size;
+      const size_t work = xnn_estimate_work(
+        (double) groups * batch_output_size * group_output_channels * kernel_size * group_input_channels,
+        (double) groups * ((double) batch_output_size * kernel_size * (group_input_channels << log2_input_element_size) +
+          (double) group_output_channels * w_stride));
+      const size_t num_other_tiles = groups * batch_size * divide_round_up(output_size, mr);
+      const size_t nc = xnn_compute_gemm_nc(num_other_tiles, group_output_channels, nr, xnn_compute_max_tiles(work, num_threads));
+      convolution_op->compute.num_threads = xnn_compute_num_useful_threads(work, num_threads);
       if (groups == 1) {
         #if XNN_MAX_UARCH_TYPES > 1
           if (xnn_is_hmp_igemm_ukernel(igemm_ukernel)) {
@@ -1456,7 +2076,8 @@ static enum xnn_status setup_convolution2d_nhwc(
         const size_t indirection_buffer_size = sizeof(void*) * output_height * step_height;
 
         const void** indirection_buffer =
-          (const void**) xnn_reallocate_memory(convolution_op->indirection_buffer, indirection_buffer_size);
+          (const void**) xnn_reallocate_tagged_memory(
+            xnn_memory_category_indirection, convolution_op->indirection_buffer, indirection_buffer_size);
         if (indirection_buffer == NULL) {
           xnn_log_error("failed to allocate %zu bytes for %s operator indirection buffer",
             indirection_buffer_size, xnn_operator_type_to_string(convolution_op->type));
@@ -1490,10 +2111,96 @@ static enum xnn_status setup_convolution2d_nhwc(
       };
       memcpy(&convolution_op->context.dwconv.params, &convolution_op->params, sizeof(convolution_op->context.dwconv.params));
 
+      // Every output row is a separate task: only the number of threads is worth adjusting to the size of the layer.
+      const size_t batch_output_size = batch_size * output_height * output_width;
       convolution_op->compute.type = xnn_parallelization_type_2d;
       convolution_op->compute.task_2d = (pthreadpool_task_2d_t) xnn_compute_dwconv_unipass;
       convolution_op->compute.range[0] = batch_size;
       convolution_op->compute.range[1] = output_height;
+      convolution_op->compute.num_threads = xnn_compute_num_useful_threads(
+        xnn_estimate_work(
+          (double) batch_output_size * groups * kernel_size,
+          (double) batch_output_size * groups * (kernel_size + 1) * (1 << log2_input_element_size)),
+        num_threads);
+      convolution_op->state = xnn_run_state_ready;
+
+      return xnn_status_success;
+    }
+    case xnn_ukernel_type_dconv:
+    {
+      const size_t kernel_height = convolution_op->kernel_height;
+      const size_t kernel_width = convolution_op->kernel_width;
+      const size_t output_height = convolution_op->output_height;
+      const size_t output_width = convolution_op->output_width;
+      if (input_height != convolution_op->last_input_height || input_width != convolution_op->last_input_width) {
+        const size_t indirection_buffer_size = sizeof(void*) * output_height * kernel_height;
+
+        const void** indirection_buffer =
+          (const void**) xnn_reallocate_tagged_memory(
+            xnn_memory_category_indirection, convolution_op->indirection_buffer, indirection_buffer_size);
+        if (indirection_buffer == NULL) {
+          xnn_log_error("failed to allocate %zu bytes for %s operator indirection buffer",
+            indirection_buffer_size, xnn_operator_type_to_string(convolution_op->type));
+          return xnn_status_out_of_memory;
+        }
+        convolution_op->indirection_buffer = indirection_buffer;
+
+        xnn_indirection_init_dconv2d(convolution_op, log2_input_element_size);
+
+        convolution_op->last_input = input;
+        convolution_op->last_input_height = input_height;
+        convolution_op->last_input_width = input_width;
+      }
+
+      const size_t group_input_channels = convolution_op->group_input_channels;
+      const size_t group_output_channels = convolution_op->group_output_channels;
+      const size_t output_pixel_stride = convolution_op->output_pixel_stride << log2_output_element_size;
+      const size_t residual_pixel_stride = convolution_op->residual_pixel_stride << log2_output_element_size;
+      convolution_op->context.dconv = (struct dconv_context) {
+          .indirect_input = convolution_op->indirection_buffer,
+          .indirect_input_height_stride = kernel_height * sizeof(void*),
+          .input_offset = (size_t) ((uintptr_t) input - (uintptr_t) convolution_op->last_input),
+          .input_batch_stride = (input_height * input_width * convolution_op->input_pixel_stride) << log2_input_element_size,
+          .input_width = input_width,
+          .input_pixel_stride = convolution_op->input_pixel_stride << log2_input_element_size,
+          .input_channels = group_input_channels << log2_input_element_size,
+          .kernel_height = kernel_height,
+          .kernel_width = kernel_width,
+          .subsampling = convolution_op->stride_width,
+          .padding_left = convolution_op->padding_left,
+          .zero = convolution_op->zero_buffer,
+          .packed_weights = convolution_op->packed_weights,
+          .output = convolution_op->output,
+          .output_batch_stride = output_height * output_width * output_pixel_stride,
+          .output_height_stride = output_width * output_pixel_stride,
+          .output_pixel_stride = output_pixel_stride,
+          .output_width = output_width,
+          .output_channels = group_output_channels,
+          .log2_csize = log2_output_element_size,
+          .ukernel = convolution_op->ukernel.dconv.function,
+          .residual = convolution_op->residual,
+          .residual_stride = residual_pixel_stride,
+          .residual_batch_stride = output_height * output_width * residual_pixel_stride,
+          .residual_height_stride = output_width * residual_pixel_stride,
+          .residual_ukernel = convolution_op->residual_ukernel,
+      };
+      memcpy(&convolution_op->context.dconv.params, &convolution_op->params, sizeof(convolution_op->context.dconv.params));
+      memcpy(&convolution_op->context.dconv.residual_params, &convolution_op->residual_params, sizeof(convolution_op->context.dconv.residual_params));
+
+      // Every output row is a separate task: only the number of threads is worth adjusting to the size of the layer.
+      const size_t batch_output_size = batch_size * output_height * output_width;
+      const size_t kernel_size = kernel_height * kernel_width;
+      const size_t w_stride = extra_weights_elements_size + (kernel_size * group_input_channels << log2_filter_element_size);
+      convolution_op->compute.type = xnn_parallelization_type_2d;
+      convolution_op->compute.task_2d = (pthreadpool_task_2d_t) xnn_compute_dconv;
+      convolution_op->compute.range[0] = batch_size;
+      convolution_op->compute.range[1] = output_height;
+      convolution_op->compute.num_threads = xnn_compute_num_useful_threads(
+        xnn_estimate_work(
+          (double) batch_output_size * group_output_channels * kernel_size * group_input_channels,
+          (double) batch_output_size * kernel_size * (group_input_channels << log2_input_element_size) +
+            (double) group_output_channels * w_stride),
+        num_threads);
       convolution_op->state = xnn_run_state_ready;
 
       return xnn_status_success;
@@ -1513,19 +2220,15 @@ static enum xnn_status setup_convolution2d_nhwc(
       };
       memcpy(&convolution_op->context.vmulcaddc.params, &convolution_op->params, sizeof(convolution_op->context.vmulcaddc.params));
 
-      size_t mc = batch_output_size;
-      if (num_threads > 1) {
-        const size_t target_tiles_per_thread = 5;
-        const size_t max_mc = divide_round_up(batch_output_size, num_threads * target_tiles_per_thread);
-        if (max_mc < mc) {
-          const uint32_t mr = convolution_op->ukernel.vmulcaddc.mr;
-          mc = min(mc, divide_round_up(mc, max_mc * mr) * mr);
-        }
-      }
+      const size_t work = xnn_estimate_work(
+        (double) batch_output_size * convolution_op->groups,
+        (double) batch_output_size * convolution_op->groups * (2 << log2_input_element_size));
       convolution_op->compute.type = xnn_parallelization_type_1d_tile_1d;
       convolution_op->compute.task_1d_tile_1d = (pthreadpool_task_1d_tile_1d_t) xnn_compute_vmulcaddc;
       convolution_op->compute.range[0] = batch_output_size;
-      convolution_op->compute.tile[0] = mc;
+      convolution_op->compute.tile[0] = xnn_compute_tile_size(
+        batch_output_size, convolution_op->ukernel.vmulcaddc.mr, xnn_compute_max_tiles(work, num_threads));
+      convolution_op->compute.num_threads = xnn_compute_num_useful_threads(work, num_threads);
       convolution_op->state = xnn_run_state_ready;
 
       return xnn_status_success;
@@ -1560,7 +2263,7 @@ enum xnn_status xnn_setup_convolution2d_nhwc_qu8(
     0 /* log2(sizeof(filter element)) = log2(sizeof(uint8_t)) */,
     sizeof(int32_t) /* sizeof(extra weights elements) */,
     0 /* log2(sizeof(output element)) = log2(sizeof(uint8_t)) */,
-    pthreadpool_get_threads_count(threadpool));
+    threadpool);
 }
 
 enum xnn_status xnn_setup_convolution2d_nhwc_qs8(
@@ -1588,7 +2291,7 @@ enum xnn_status xnn_setup_convolution2d_nhwc_qs8(
     0 /* log2(sizeof(filter element)) = log2(sizeof(int8_t)) */,
     sizeof(int32_t) /* sizeof(extra weights elements) */,
     0 /* log2(sizeof(output element)) = log2(sizeof(int8_t)) */,
-    pthreadpool_get_threads_count(threadpool));
+    threadpool);
 }
 
 enum xnn_status xnn_setup_convolution2d_nhwc_qc8(
@@ -1616,7 +2319,7 @@ enum xnn_status xnn_setup_convolution2d_nhwc_qc8(
     0 /* log2(sizeof(filter element)) = log2(sizeof(int8_t)) */,
     sizeof(int32_t) + sizeof(float) /* sizeof(extra weights elements) */,
     0 /* log2(sizeof(output element)) = log2(sizeof(int8_t)) */,
-    pthreadpool_get_threads_count(threadpool));
+    threadpool);
 }
 
 enum xnn_status xnn_setup_convolution2d_nhwc_f16(
@@ -1644,7 +2347,7 @@ enum xnn_status xnn_setup_convolution2d_nhwc_f16(
     1 /* log2(sizeof(filter element)) = log2(sizeof(uint16_t)) */,
     sizeof(uint16_t) /* sizeof(extra weights elements) */,
     1 /* log2(sizeof(output element)) = log2(sizeof(uint16_t)) */,
-    pthreadpool_get_threads_count(threadpool));
+    threadpool);
 }
 
 enum xnn_status xnn_setup_convolution2d_nhwc_f32(
@@ -1672,5 +2375,169 @@ enum xnn_status xnn_setup_convolution2d_nhwc_f32(
     2 /* log2(sizeof(filter element)) = log2(sizeof(float)) */,
     sizeof(float) /* sizeof(extra weights elements) */,
     2 /* log2(sizeof(output element)) = log2(sizeof(float)) */,
-    pthreadpool_get_threads_count(threadpool));
+    threadpool);
+}
+
+static enum xnn_status setup_streaming_convolution1d_nwc_f32(
+  xnn_operator_t convolution_op,
+  size_t batch_size,
+  size_t input_width,
+  const float* input,
+  float* output,
+  size_t* output_width,
+  pthreadpool_t threadpool)
+{
+  convolution_op->state = xnn_run_state_invalid;
+
+  if ((xnn_params.init_flags & XNN_INIT_FLAG_XNNPACK) == 0) {
+    xnn_log_error("failed to setup %s operator: XNNPACK is not initialized",
+      xnn_operator_type_to_string(convolution_op->type));
+    return xnn_status_uninitialized;
+  }
+
+  if (input_width == 0) {
+    xnn_log_error(
+      "failed to setup %s operator with %zu-frame input chunk: input chunk must be non-empty",
+      xnn_operator_type_to_string(convolution_op->type), input_width);
+    return xnn_status_invalid_parameter;
+  }
+
+  if (batch_size == 0) {
+    if (output_width != NULL) {
+      *output_width = 0;
+    }
+    convolution_op->state = xnn_run_state_skip;
+    return xnn_status_success;
+  }
+
+  const size_t channels = convolution_op->groups * convolution_op->group_input_channels;
+  if (convolution_op->streaming.batch_size == 0) {
+    // First chunk of new sequences: the history holds the zero frames of the left padding.
+    const size_t history_size = batch_size * convolution_op->streaming.history_capacity * channels * sizeof(float);
+    xnn_release_simd_memory(convolution_op->streaming.history);
+    convolution_op->streaming.history = NULL;
+    if (history_size != 0) {
+      convolution_op->streaming.history = xnn_allocate_zero_simd_memory(history_size);
+      if (convolution_op->streaming.history == NULL) {
+        xnn_log_error(
+          "failed to allocate %zu bytes for %s operator history",
+          history_size, xnn_operator_type_to_string(convolution_op->type));
+        return xnn_status_out_of_memory;
+      }
+    }
+    convolution_op->streaming.batch_size = batch_size;
+    convolution_op->streaming.history_frames = convolution_op->streaming.initial_history_frames;
+  } else if (batch_size != convolution_op->streaming.batch_size) {
+    xnn_log_error(
+      "failed to setup %s operator with batch size %zu: batch size of the streamed sequences is %zu, "
+      "and can change only after xnn_reset_convolution1d_nwc_f32",
+      xnn_operator_type_to_string(convolution_op->type), batch_size, convolution_op->streaming.batch_size);
+    return xnn_status_invalid_parameter;
+  }
+
+  const size_t history_frames = convolution_op->streaming.history_frames;
+  const size_t available_frames = history_frames + input_width;
+  const size_t effective_kernel_width = (convolution_op->kernel_width - 1) * convolution_op->dilation_width + 1;
+  const size_t output_frames = available_frames >= effective_kernel_width ?
+    (available_frames - effective_kernel_width) / convolution_op->stride_width + 1 : 0;
+
+  // Without history, the convolution reads the chunk in place; otherwise run assembles history and chunk in staging.
+  const bool staged = history_frames != 0;
+  if (staged) {
+    const size_t staging_size =
+      batch_size * available_frames * convolution_op->input_pixel_stride * sizeof(float) + XNN_EXTRA_BYTES;
+    if (staging_size > convolution_op->streaming.staging_size) {
+      xnn_release_simd_memory(convolution_op->streaming.staging);
+      convolution_op->streaming.staging_size = 0;
+      convolution_op->streaming.staging = xnn_allocate_tagged_simd_memory(xnn_memory_category_scratch, staging_size);
+      if (convolution_op->streaming.staging == NULL) {
+        xnn_log_error(
+          "failed to allocate %zu bytes for %s operator staging buffer",
+          staging_size, xnn_operator_type_to_string(convolution_op->type));
+        return xnn_status_out_of_memory;
+      }
+      convolution_op->streaming.staging_size = staging_size;
+    }
+  }
+
+  if (output_frames != 0) {
+    const enum xnn_status status = setup_convolution2d_nhwc(
+      convolution_op,
+      batch_size, 1 /* input height */, available_frames,
+      staged ? convolution_op->streaming.staging : input, output,
+      XNN_INIT_FLAG_F32,
+      2 /* log2(sizeof(input element)) = log2(sizeof(float)) */,
+      2 /* log2(sizeof(filter element)) = log2(sizeof(float)) */,
+      sizeof(float) /* sizeof(extra weights elements) */,
+      2 /* log2(sizeof(output element)) = log2(sizeof(float)) */,
+      threadpool);
+    if (status != xnn_status_success) {
+      return status;
+    }
+  }
+
+  convolution_op->streaming.input = input;
+  convolution_op->streaming.input_frames = input_width;
+  convolution_op->streaming.output_frames = output_frames;
+  convolution_op->streaming.consumed_frames = output_frames * convolution_op->stride_width;
+  convolution_op->streaming.staged = staged;
+  if (output_width != NULL) {
+    *output_width = output_frames;
+  }
+  convolution_op->state = xnn_run_state_ready;
+  return xnn_status_success;
+}
+
+enum xnn_status xnn_setup_convolution1d_nwc_f32(
+    xnn_operator_t convolution_op,
+    size_t batch_size,
+    size_t input_width,
+    const float* input,
+    float* output,
+    size_t* output_width,
+    pthreadpool_t threadpool)
+{
+  if (convolution_op->type != xnn_operator_type_convolution_nwc_f32) {
+    xnn_log_error("failed to setup operator: operator type mismatch (expected %s, got %s)",
+      xnn_operator_type_to_string(xnn_operator_type_convolution_nwc_f32),
+      xnn_operator_type_to_string(convolution_op->type));
+    return xnn_status_invalid_parameter;
+  }
+
+  if (convolution_op->flags & XNN_FLAG_STREAMING) {
+    return setup_streaming_convolution1d_nwc_f32(
+      convolution_op, batch_size, input_width, input, output, output_width, threadpool);
+  }
+
+  const enum xnn_status status = setup_convolution2d_nhwc(
+    convolution_op,
+    batch_size, 1 /* input height */, input_width,
+    input, output,
+    XNN_INIT_FLAG_F32,
+    2 /* log2(sizeof(input element)) = log2(sizeof(float)) */,
+    2 /* log2(sizeof(filter element)) = log2(sizeof(float)) */,
+    sizeof(float) /* sizeof(extra weights elements) */,
+    2 /* log2(sizeof(output element)) = log2(sizeof(float)) */,
+    threadpool);
+  if (status == xnn_status_success && output_width != NULL) {
+    *output_width = convolution_op->output_width;
+  }
+  return status;
+}
+
+enum xnn_status xnn_reset_convolution1d_nwc_f32(
+    xnn_operator_t convolution_op)
+{
+  if (convolution_op->type != xnn_operator_type_convolution_nwc_f32) {
+    xnn_log_error("failed to reset operator: operator type mismatch (expected %s, got %s)",
+      xnn_operator_type_to_string(xnn_operator_type_convolution_nwc_f32),
+      xnn_operator_type_to_string(convolution_op->type));
+    return xnn_status_invalid_parameter;
+  }
+
+  // The history is re-allocated, with the zero frames of the left padding, in the next setup.
+  convolution_op->streaming.batch_size = 0;
+  convolution_op->streaming.history_frames = convolution_op->streaming.initial_history_frames;
+  convolution_op->state = xnn_run_state_invalid;
+  return xnn_status_success;
 }
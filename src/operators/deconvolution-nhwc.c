@@ -23,6 +23,7 @@
 #include <xnnpack/operator.h>
 #include <xnnpack/pack.h>
 #include <xnnpack/params.h>
+#include <xnnpack/tiling.h>
 
 
 static inline size_t compute_output_dimension(
@@ -39,6 +40,20 @@ static inline size_t compute_output_dimension(
     output_padding_dimension);
 }
 
+static inline const struct dwconv_parameters* find_dwconv_ukernel(
+    size_t kernel_size,
+    const struct dwconv_parameters* ukernel,
+    size_t num_ukernels)
+{
+  while (num_ukernels-- != 0) {
+    if (ukernel->primary_tile == kernel_size) {
+      return ukernel;
+    }
+    ukernel++;
+  }
+  return NULL;
+}
+
 static enum xnn_status create_deconvolution2d_nhwc(
     uint32_t output_padding_top,
     uint32_t output_padding_right,
@@ -63,13 +78,18 @@ static enum xnn_status create_deconvolution2d_nhwc(
     uint32_t bias_element_size,
     xnn_pack_conv_goki_w_function pack_conv_goki_w,
     xnn_pack_deconv_goki_w_function pack_deconv_goki_w,
+    xnn_pack_dwconv_ghw_w_function pack_dwconv_ghw_w,
     const void* packing_params,
     int input_padding_byte,
     int packed_weights_padding_byte,
     const void* params,
     size_t params_size,
+    const void* dwconv_params,
+    size_t dwconv_params_size,
     const struct gemm_parameters* gemm_parameters,
     const struct gemm_fused_ukernels* gemm_ukernels,
+    const struct dwconv_parameters* dwconv_ukernel,
+    bool linear_activation,
     enum xnn_operator_type operator_type,
     xnn_operator_t* deconvolution_op_out)
 {
@@ -166,7 +186,18 @@ static enum xnn_status create_deconvolution2d_nhwc(
   const uint32_t kernel_size = kernel_height * kernel_width;
   enum xnn_ukernel_type ukernel_type = xnn_ukernel_type_igemm;
   size_t packed_group_weights_size = (((kernel_size * k_stride) << log2_filter_element_size) + bias_element_size) * n_stride;
-  if (max(stride_height, stride_width) > 1 && max(dilation_height, dilation_width) == 1 && stride_width <= kernel_width && stride_height <= kernel_height) {
+  size_t zero_size = (k_stride << log2_input_element_size) + XNN_EXTRA_BYTES;
+  if (group_input_channels == 1 && group_output_channels == 1 && dwconv_ukernel != NULL) {
+    // Depthwise deconvolution: every group is a single channel, and the GEMM micro-kernels would process one input
+    // channel per tap with all but one column of the output tile wasted. Gather the contributing input pixels of every
+    // output pixel through a transposed indirection buffer and reuse the DWCONV micro-kernels instead. The GOKI
+    // kernel layout degenerates into the GHW layout expected by the DWCONV packing function.
+    assert(dwconv_ukernel->primary_tile == kernel_size);
+    ukernel_type = xnn_ukernel_type_dwconv;
+    const size_t c_stride = round_up_po2(groups, dwconv_ukernel->channel_tile);
+    packed_group_weights_size = ((kernel_size << log2_filter_element_size) + bias_element_size) * c_stride;
+    zero_size = (c_stride << log2_input_element_size) + XNN_EXTRA_BYTES;
+  } else if (max(stride_height, stride_width) > 1 && max(dilation_height, dilation_width) == 1 && stride_width <= kernel_width && stride_height <= kernel_height) {
     ukernel_type = xnn_ukernel_type_subconv2d;
     const size_t subkernels = stride_height * stride_width;
     packed_group_weights_size = n_stride *
@@ -194,14 +225,17 @@ static enum xnn_status create_deconvolution2d_nhwc(
       }
     }
   }
-  deconvolution_op->packed_weights = xnn_allocate_simd_memory(packed_group_weights_size * groups);
+  const size_t packed_weights_size =
+    ukernel_type == xnn_ukernel_type_dwconv ? packed_group_weights_size : packed_group_weights_size * groups;
+  deconvolution_op->packed_weights =
+    xnn_allocate_tagged_simd_memory(xnn_memory_category_packed_weights, packed_weights_size);
   if (deconvolution_op->packed_weights == NULL) {
     xnn_log_error(
       "failed to allocate %zu bytes for %s operator packed weights",
-      packed_group_weights_size * groups, xnn_operator_type_to_string(operator_type));
+      packed_weights_size, xnn_operator_type_to_string(operator_type));
     goto error;
   }
-  memset(deconvolution_op->packed_weights, packed_weights_padding_byte, packed_group_weights_size * groups);
+  memset(deconvolution_op->packed_weights, packed_weights_padding_byte, packed_weights_size);
 
   switch (ukernel_type) {
     case xnn_ukernel_type_igemm:
@@ -220,12 +254,19 @@ static enum xnn_status create_deconvolution2d_nhwc(
         kernel, bias, deconvolution_op->packed_weights, deconvolution_op->subconvolution_buffer,
         packing_params);
       break;
+    case xnn_ukernel_type_dwconv:
+      pack_dwconv_ghw_w(
+        kernel_height, kernel_width,
+        groups, dwconv_ukernel->channel_tile,
+        kernel, bias, deconvolution_op->packed_weights,
+        0 /* extra bytes */,
+        packing_params);
+      break;
     default:
       XNN_UNREACHABLE;
   }
 
-  const size_t zero_size = (k_stride << log2_input_element_size) + XNN_EXTRA_BYTES;
-  deconvolution_op->zero_buffer = xnn_allocate_simd_memory(zero_size);
+  deconvolution_op->zero_buffer = xnn_allocate_tagged_simd_memory(xnn_memory_category_zero_buffer, zero_size);
   if (deconvolution_op->zero_buffer == NULL) {
     xnn_log_error(
       "failed to allocate %zu bytes for %s operator zero padding",
@@ -251,17 +292,32 @@ static enum xnn_status create_deconvolution2d_nhwc(
   deconvolution_op->input_pixel_stride = input_pixel_stride;
   deconvolution_op->output_pixel_stride = output_pixel_stride;
 
-  memcpy(&deconvolution_op->params, params, params_size);
   deconvolution_op->type = operator_type;
   deconvolution_op->ukernel.type = ukernel_type;
-  deconvolution_op->ukernel.igemm = (struct xnn_ukernel_igemm) {
-    .general_case = gemm_ukernels->igemm,
-    .gemm_case = gemm_ukernels->gemm,
-    .mr = mr,
-    .nr = nr,
-    .kr = kr,
-    .sr = sr,
-  };
+  if (ukernel_type == xnn_ukernel_type_dwconv) {
+    memcpy(&deconvolution_op->params, dwconv_params, dwconv_params_size);
+
+    const union dwconv_fused_ukernels* dwconv_ukernels = &dwconv_ukernel->minmax;
+    if (linear_activation && dwconv_ukernel->linear.unipass != NULL) {
+      dwconv_ukernels = &dwconv_ukernel->linear;
+    }
+    deconvolution_op->ukernel.dwconv = (struct xnn_ukernel_dwconv) {
+      .unipass_function = dwconv_ukernels->unipass,
+      .primary_tile = dwconv_ukernel->primary_tile,
+      .incremental_tile = dwconv_ukernel->incremental_tile,
+    };
+  } else {
+    memcpy(&deconvolution_op->params, params, params_size);
+
+    deconvolution_op->ukernel.igemm = (struct xnn_ukernel_igemm) {
+      .general_case = gemm_ukernels->igemm,
+      .gemm_case = gemm_ukernels->gemm,
+      .mr = mr,
+      .nr = nr,
+      .kr = kr,
+      .sr = sr,
+    };
+  }
 
   deconvolution_op->state = xnn_run_state_invalid;
 
@@ -344,6 +400,14 @@ enum xnn_status xnn_create_deconvolution2d_nhwc_qs8(
     xnn_params.qs8.gemm.init.qs8(&params,
       requantization_scale, output_zero_point, output_min, output_max);
   }
+  union xnn_qs8_conv_minmax_params dwconv_params;
+  const struct dwconv_parameters* dwconv_ukernel =
+    find_dwconv_ukernel(kernel_height * kernel_width, xnn_params.qs8.dwconv, XNN_MAX_QS8_DWCONV_UKERNELS);
+  if XNN_LIKELY(dwconv_ukernel != NULL) {
+    dwconv_ukernel->init.qs8(&dwconv_params,
+      requantization_scale, output_zero_point, output_min, output_max);
+  }
+
   const struct xnn_qs8_packing_params packing_params = {
     .input_zero_point = input_zero_point,
   };
@@ -360,9 +424,12 @@ enum xnn_status xnn_create_deconvolution2d_nhwc_qs8(
     sizeof(int32_t) /* sizeof(bias element) */,
     (xnn_pack_conv_goki_w_function) xnn_pack_qs8_conv_goki_w,
     (xnn_pack_deconv_goki_w_function) xnn_pack_qs8_deconv_goki_w,
+    (xnn_pack_dwconv_ghw_w_function) xnn_pack_qs8_dwconv_ghw_w,
     &packing_params, input_zero_point /* input padding byte */, 0 /* packed weights padding byte */,
     &params, sizeof(params),
-    &xnn_params.qs8.gemm, &xnn_params.qs8.gemm.minmax,
+    &dwconv_params, sizeof(dwconv_params),
+    &xnn_params.qs8.gemm, &xnn_params.qs8.gemm.minmax, dwconv_ukernel,
+    false /* linear activation */,
     xnn_operator_type_deconvolution_nhwc_qs8,
     deconvolution_op_out);
 }
@@ -439,6 +506,14 @@ enum xnn_status xnn_create_deconvolution2d_nhwc_qu8(
     xnn_params.qu8.gemm.init.qu8(&params,
       kernel_zero_point, requantization_scale, output_zero_point, output_min, output_max);
   }
+  union xnn_qu8_conv_minmax_params dwconv_params;
+  const struct dwconv_parameters* dwconv_ukernel =
+    find_dwconv_ukernel(kernel_height * kernel_width, xnn_params.qu8.dwconv, XNN_MAX_QU8_DWCONV_UKERNELS);
+  if XNN_LIKELY(dwconv_ukernel != NULL) {
+    dwconv_ukernel->init.qu8(&dwconv_params,
+      kernel_zero_point, requantization_scale, output_zero_point, output_min, output_max);
+  }
+
   const struct xnn_qu8_packing_params packing_params = {
     .input_zero_point = input_zero_point,
     .kernel_zero_point = kernel_zero_point,
@@ -456,9 +531,12 @@ enum xnn_status xnn_create_deconvolution2d_nhwc_qu8(
     sizeof(int32_t) /* sizeof(bias element) */,
     (xnn_pack_conv_goki_w_function) xnn_pack_qu8_conv_goki_w,
     (xnn_pack_deconv_goki_w_function) xnn_pack_qu8_deconv_goki_w,
+    (xnn_pack_dwconv_ghw_w_function) xnn_pack_qu8_dwconv_ghw_w,
     &packing_params, input_zero_point /* input padding byte */, kernel_zero_point /* packed weights padding byte */,
     &params, sizeof(params),
-    &xnn_params.qu8.gemm, &xnn_params.qu8.gemm.minmax,
+    &dwconv_params, sizeof(dwconv_params),
+    &xnn_params.qu8.gemm, &xnn_params.qu8.gemm.minmax, dwconv_ukernel,
+    false /* linear activation */,
     xnn_operator_type_deconvolution_nhwc_qu8,
     deconvolution_op_out);
 }
@@ -529,11 +607,20 @@ enum xnn_status xnn_create_deconvolution2d_nhwc_f16(
     gemm_parameters->init.f16(&params, UINT16_C(0x3C00) /* 1.0 */, output_min_as_half, output_max_as_half);
   }
 
+  union xnn_f16_minmax_params dwconv_params;
+  const struct dwconv_parameters* dwconv_ukernel =
+    find_dwconv_ukernel(kernel_height * kernel_width, xnn_params.f16.dwconv, XNN_MAX_F16_DWCONV_UKERNELS);
+  if XNN_LIKELY(dwconv_ukernel != NULL) {
+    dwconv_ukernel->init.f16(&dwconv_params, output_min_as_half, output_max_as_half);
+  }
+
   xnn_pack_conv_goki_w_function pack_conv_goki_w = (xnn_pack_conv_goki_w_function) xnn_pack_f16_conv_goki_w;
   xnn_pack_deconv_goki_w_function pack_deconv_goki_w = (xnn_pack_deconv_goki_w_function) xnn_pack_f16_deconv_goki_w;
+  xnn_pack_dwconv_ghw_w_function pack_dwconv_ghw_w = (xnn_pack_dwconv_ghw_w_function) xnn_pack_f16_dwconv_ghw_w;
   if (flags & XNN_FLAG_FP32_STATIC_WEIGHTS) {
     pack_conv_goki_w = (xnn_pack_conv_goki_w_function) xnn_pack_f32_to_f16_conv_goki_w;
     pack_deconv_goki_w = (xnn_pack_deconv_goki_w_function) xnn_pack_f32_to_f16_deconv_goki_w;
+    pack_dwconv_ghw_w = (xnn_pack_dwconv_ghw_w_function) xnn_pack_f32_to_f16_dwconv_ghw_w;
   }
 
   return create_deconvolution2d_nhwc(
@@ -549,9 +636,12 @@ enum xnn_status xnn_create_deconvolution2d_nhwc_f16(
     sizeof(uint16_t) /* sizeof(bias element) */,
     pack_conv_goki_w,
     pack_deconv_goki_w,
+    pack_dwconv_ghw_w,
     NULL /* packing params */, 0 /* input padding byte */, 0 /* packed weights padding byte */,
     &params, sizeof(params),
-    gemm_parameters, gemm_ukernels,
+    &dwconv_params, sizeof(dwconv_params),
+    gemm_parameters, gemm_ukernels, dwconv_ukernel,
+    linear_activation,
     xnn_operator_type_deconvolution_nhwc_f16,
     deconvolution_op_out);
 }
@@ -617,6 +707,14 @@ enum xnn_status xnn_create_deconvolution2d_nhwc_f32(
   if XNN_LIKELY(xnn_params.f32.gemm.init.f32 != NULL) {
     gemm_parameters->init.f32(&params, output_min, output_max);
   }
+
+  union xnn_f32_minmax_params dwconv_params;
+  const struct dwconv_parameters* dwconv_ukernel =
+    find_dwconv_ukernel(kernel_height * kernel_width, xnn_params.f32.dwconv, XNN_MAX_F32_DWCONV_UKERNELS);
+  if XNN_LIKELY(dwconv_ukernel != NULL) {
+    dwconv_ukernel->init.f32(&dwconv_params, output_min, output_max);
+  }
+
   return create_deconvolution2d_nhwc(
     output_padding_top, output_padding_right, output_padding_bottom, output_padding_left,
     kernel_height, kernel_width,
@@ -630,9 +728,12 @@ enum xnn_status xnn_create_deconvolution2d_nhwc_f32(
     sizeof(float) /* sizeof(bias element) */,
     (xnn_pack_conv_goki_w_function) xnn_pack_f32_conv_goki_w,
     (xnn_pack_deconv_goki_w_function) xnn_pack_f32_deconv_goki_w,
+    (xnn_pack_dwconv_ghw_w_function) xnn_pack_f32_dwconv_ghw_w,
     NULL /* packing params */, 0 /* input padding byte */, 0 /* packed weights padding byte */,
     &params, sizeof(params),
-    gemm_parameters, gemm_ukernels,
+    &dwconv_params, sizeof(dwconv_params),
+    gemm_parameters, gemm_ukernels, dwconv_ukernel,
+    linear_activation,
     xnn_operator_type_deconvolution_nhwc_f32,
     deconvolution_op_out);
 }
@@ -669,7 +770,8 @@ static enum xnn_status setup_conv_path(
   if (input_height != deconvolution_op->last_input_height ||
       input_width != deconvolution_op->last_input_width)
   {
-    const void** indirection_buffer = (const void**) xnn_reallocate_memory(deconvolution_op->indirection_buffer, indirection_buffer_size);
+    const void** indirection_buffer = (const void**) xnn_reallocate_tagged_memory(
+      xnn_memory_category_indirection, deconvolution_op->indirection_buffer, indirection_buffer_size);
     if (indirection_buffer == NULL) {
       xnn_log_error(
         "failed to allocate %zu bytes for %s operator indirection buffer",
@@ -714,15 +816,14 @@ static enum xnn_status setup_conv_path(
   }
   memcpy(&deconvolution_op->context.igemm.params, params, params_size);
 
-  size_t nc = group_output_channels;
-  if (num_threads > 1) {
-    const size_t num_other_tiles = groups * batch_size * divide_round_up(output_size, mr);
-    const size_t target_tiles_per_thread = 5;
-    const size_t max_nc = divide_round_up(group_output_channels * num_other_tiles, num_threads * target_tiles_per_thread);
-    if (max_nc < nc) {
-      nc = min(nc, divide_round_up(nc, max_nc * nr) * nr);
-    }
-  }
+  const size_t batch_output_size = batch_size * output_size;
+  const size_t work = xnn_estimate_work(
+    (double) groups * batch_output_size * group_output_channels * kernel_size * group_input_channels,
+    (double) groups * ((double) batch_output_size * kernel_size * (group_input_channels << log2_input_element_size) +
+      (double) group_output_channels * w_stride));
+  const size_t num_other_tiles = groups * batch_size * divide_round_up(output_size, mr);
+  const size_t nc = xnn_compute_gemm_nc(num_other_tiles, group_output_channels, nr, xnn_compute_max_tiles(work, num_threads));
+  deconvolution_op->compute.num_threads = xnn_compute_num_useful_threads(work, num_threads);
   if (groups == 1) {
     if (batch_size > 1) {
       deconvolution_op->compute.type = xnn_parallelization_type_3d_tile_2d;
@@ -825,7 +926,8 @@ static enum xnn_status setup_subconv2d_path(
         kernel_size * output_height * stride_width * round_up(divide_round_up(output_width, stride_width), mr);
 
       const void** indirection_buffer =
-        (const void**) xnn_reallocate_memory(deconvolution_op->indirection_buffer, indirection_buffer_size);
+        (const void**) xnn_reallocate_tagged_memory(
+          xnn_memory_category_indirection, deconvolution_op->indirection_buffer, indirection_buffer_size);
       if (indirection_buffer == NULL) {
         xnn_log_error(
           "failed to allocate %zu bytes for %s operator indirection buffer",
@@ -892,16 +994,16 @@ static enum xnn_status setup_subconv2d_path(
   const size_t output_height_positions = divide_round_up(output_height, stride_height);
   const size_t output_width_positions = divide_round_up(output_width, stride_width);
 
-  size_t nc = group_output_channels;
-  if (num_threads > 1) {
-    const size_t num_other_tiles = groups * stride_height * stride_width *
-      output_height_positions * divide_round_up(output_width_positions, mr);
-    const size_t target_tiles_per_thread = 5;
-    const size_t max_nc = divide_round_up(group_output_channels * num_other_tiles, num_threads * target_tiles_per_thread);
-    if (max_nc < nc) {
-      nc = min(nc, divide_round_up(nc, max_nc * nr) * nr);
-    }
-  }
+  // Every input pixel contributes to the outputs through every kernel element exactly once.
+  const size_t batch_input_size = batch_size * input_height * input_width;
+  const size_t work = xnn_estimate_work(
+    (double) groups * batch_input_size * kernel_size * group_input_channels * group_output_channels,
+    (double) groups * ((double) batch_input_size * kernel_size * (group_input_channels << log2_input_element_size) +
+      (double) group_output_channels * w_stride));
+  const size_t num_other_tiles = batch_size * groups * stride_height * stride_width *
+    output_height_positions * divide_round_up(output_width_positions, mr);
+  const size_t nc = xnn_compute_gemm_nc(num_other_tiles, group_output_channels, nr, xnn_compute_max_tiles(work, num_threads));
+  deconvolution_op->compute.num_threads = xnn_compute_num_useful_threads(work, num_threads);
 
   if (groups == 1) {
     deconvolution_op->compute.type = xnn_parallelization_type_5d_tile_2d;
@@ -932,6 +1034,82 @@ static enum xnn_status setup_subconv2d_path(
   return xnn_status_success;
 }
 
+static enum xnn_status setup_dwconv_path(
+  xnn_operator_t deconvolution_op,
+  size_t batch_size,
+  size_t input_height,
+  size_t input_width,
+  const void* input,
+  size_t output_height,
+  size_t output_width,
+  void* output,
+  uint32_t log2_input_element_size,
+  uint32_t log2_output_element_size,
+  size_t num_threads)
+{
+  assert(deconvolution_op->ukernel.type == xnn_ukernel_type_dwconv);
+
+  const size_t kernel_height = deconvolution_op->kernel_height;
+  const size_t kernel_width = deconvolution_op->kernel_width;
+  const size_t kernel_size = kernel_height * kernel_width;
+  // Taps of adjacent output pixels never coincide in a transposed convolution, so every output pixel gets its own
+  // column of the indirection buffer.
+  const size_t step_width = kernel_width;
+  const size_t step_height = kernel_size + (output_width - 1) * step_width * kernel_height;
+
+  if (input_height != deconvolution_op->last_input_height ||
+      input_width != deconvolution_op->last_input_width)
+  {
+    const size_t indirection_buffer_size = sizeof(void*) * output_height * step_height;
+    const void** indirection_buffer = (const void**) xnn_reallocate_tagged_memory(
+      xnn_memory_category_indirection, deconvolution_op->indirection_buffer, indirection_buffer_size);
+    if (indirection_buffer == NULL) {
+      xnn_log_error(
+        "failed to allocate %zu bytes for %s operator indirection buffer",
+        indirection_buffer_size, xnn_operator_type_to_string(deconvolution_op->type));
+      return xnn_status_out_of_memory;
+    }
+    deconvolution_op->indirection_buffer = indirection_buffer;
+    deconvolution_op->last_input = input;
+    deconvolution_op->last_input_height = input_height;
+    deconvolution_op->last_input_width = input_width;
+
+    xnn_indirection_init_dwdeconv2d(deconvolution_op, step_height, step_width, log2_input_element_size);
+  }
+
+  const size_t groups = deconvolution_op->groups;
+  deconvolution_op->context.dwconv = (struct dwconv_context) {
+      .indirect_input = deconvolution_op->indirection_buffer,
+      .indirect_input_width_stride = kernel_height * step_width * sizeof(void*),
+      .indirect_input_height_stride = step_height * sizeof(void*),
+      .input_offset = (size_t) ((uintptr_t) input - (uintptr_t) deconvolution_op->last_input),
+      .input_batch_stride = (input_height * input_width * deconvolution_op->input_pixel_stride) << log2_input_element_size,
+      .packed_weights = deconvolution_op->packed_weights,
+      .output = output,
+      .output_batch_stride = (output_height * output_width * deconvolution_op->output_pixel_stride) << log2_output_element_size,
+      .output_height_stride = (output_width * deconvolution_op->output_pixel_stride) << log2_output_element_size,
+      .output_width = output_width,
+      .groups = groups,
+      .zero = deconvolution_op->zero_buffer,
+      .output_increment = (deconvolution_op->output_pixel_stride - groups) << log2_output_element_size,
+      .unipass_ukernel = deconvolution_op->ukernel.dwconv.unipass_function,
+  };
+  memcpy(&deconvolution_op->context.dwconv.params, &deconvolution_op->params, sizeof(deconvolution_op->context.dwconv.params));
+
+  const size_t batch_output_size = batch_size * output_height * output_width;
+  deconvolution_op->compute.type = xnn_parallelization_type_2d;
+  deconvolution_op->compute.task_2d = (pthreadpool_task_2d_t) xnn_compute_dwconv_unipass;
+  deconvolution_op->compute.range[0] = batch_size;
+  deconvolution_op->compute.range[1] = output_height;
+  deconvolution_op->compute.num_threads = xnn_compute_num_useful_threads(
+    xnn_estimate_work(
+      (double) batch_output_size * groups * kernel_size,
+      (double) batch_output_size * groups * (kernel_size + 1) * (1 << log2_input_element_size)),
+    num_threads);
+  deconvolution_op->state = xnn_run_state_ready;
+  return xnn_status_success;
+}
+
 static enum xnn_status setup_deconvolution2d_nhwc(
   xnn_operator_t deconvolution_op,
   size_t batch_size,
@@ -1023,6 +1201,14 @@ static enum xnn_status setup_deconvolution2d_nhwc(
         log2_input_element_size, log2_filter_element_size, bias_element_size, log2_output_element_size,
         params, params_size, num_threads, use_gemm);
     }
+    case xnn_ukernel_type_dwconv:
+      return setup_dwconv_path(
+        deconvolution_op,
+        batch_size,
+        input_height, input_width, input,
+        deconvolution_op->output_height, deconvolution_op->output_width, output,
+        log2_input_element_size, log2_output_element_size,
+        num_threads);
     default:
       XNN_UNREACHABLE;
   }
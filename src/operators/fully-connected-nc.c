@@ -17,11 +17,14 @@
 
 #include <xnnpack.h>
 #include <xnnpack/allocator.h>
+#include <xnnpack/autotune.h>
+#include <xnnpack/compute.h>
 #include <xnnpack/log.h>
 #include <xnnpack/math.h>
 #include <xnnpack/operator.h>
 #include <xnnpack/pack.h>
 #include <xnnpack/params.h>
+#include <xnnpack/tiling.h>
 
 
 static enum xnn_status create_fully_connected_nc(
@@ -34,15 +37,18 @@ static enum xnn_status create_fully_connected_nc(
     uint32_t flags,
     uint32_t log2_filter_element_size,
     uint32_t bias_element_size,
+    size_t k_segment_size,
     xnn_pack_gemm_io_w_function pack_gemm_io_w,
     xnn_pack_gemm_goi_w_function pack_gemm_goi_w,
     const void* packing_params,
+    size_t packing_params_size,
     int packed_weights_padding_byte,
     const void* params,
     size_t params_size,
     const struct gemm_parameters* gemm_parameters,
     const struct gemm_fused_ukernels* gemm_ukernels,
     uint32_t datatype_init_flags,
+    struct xnn_packed_weights_buffer* packed_weights_buffer,
     enum xnn_operator_type operator_type,
     xnn_operator_t* fully_connected_op_out)
 {
@@ -113,37 +119,105 @@ static enum xnn_status create_fully_connected_nc(
   const size_t n_stride = round_up(output_channels, nr);
   const size_t k_stride = round_up_po2(input_channels, kr * sr);
 
-  const size_t packed_weights_size = n_stride * (bias_element_size + (k_stride << log2_filter_element_size));
-  fully_connected_op->packed_weights = xnn_allocate_simd_memory(packed_weights_size);
-  if (fully_connected_op->packed_weights == NULL) {
-    xnn_log_error(
-      "failed to allocate %zu bytes for %s operator packed weights",
-      packed_weights_size, xnn_operator_type_to_string(operator_type));
+  size_t packed_weights_size = n_stride * (bias_element_size + (k_stride << log2_filter_element_size));
+  size_t num_k_segments = 0;
+  size_t last_k_segment_size = 0;
+  if (k_segment_size != 0) {
+    // Weights are packed independently for every segment of the reduction dimension, and the last segment takes the
+    // remainder of the input channels.
+    num_k_segments = input_channels / k_segment_size;
+    last_k_segment_size = input_channels - (num_k_segments - 1) * k_segment_size;
+    packed_weights_size =
+      n_stride * (num_k_segments - 1) * (bias_element_size + (round_up_po2(k_segment_size, kr * sr) << log2_filter_element_size)) +
+      n_stride * (bias_element_size + (round_up_po2(last_k_segment_size, kr * sr) << log2_filter_element_size));
+  }
+  // Transposed weights are packed into the same layout, and XNN_FLAG_TRANSPOSE_WEIGHTS is not part of the fingerprint.
+  const size_t layout[] = {
+    (size_t) operator_type, input_channels, output_channels, nr, kr, sr, k_segment_size, packed_weights_size,
+  };
+  bool pack = false;
+  status = xnn_init_packed_weights(
+    fully_connected_op, packed_weights_buffer, packed_weights_size,
+    xnn_compute_packed_weights_fingerprint(layout, XNN_COUNT_OF(layout), packing_params, packing_params_size),
+    flags, operator_type, &pack);
+  if (status != xnn_status_success) {
     goto error;
   }
-  memset(fully_connected_op->packed_weights, packed_weights_padding_byte, packed_weights_size);
+  status = xnn_status_out_of_memory;
+  if (pack) {
+    memset(fully_connected_op->packed_weights, packed_weights_padding_byte, packed_weights_size);
+  }
 
-  if (flags & XNN_FLAG_TRANSPOSE_WEIGHTS) {
-    pack_gemm_io_w(
-      output_channels, input_channels,
-      nr, kr, sr,
-      kernel, bias,
-      fully_connected_op->packed_weights,
-      packing_params);
+  if (!pack) {
+    // Weights are pre-packed, or only the size and fingerprint of the packed weights are requested.
+  } else if (flags & XNN_FLAG_TRANSPOSE_WEIGHTS) {
+    void* packed_weights = fully_connected_op->packed_weights;
+    for (size_t segment = 0; segment < max(num_k_segments, 1); segment++) {
+      const size_t segment_start = segment * k_segment_size;
+      const size_t segment_size =
+        num_k_segments == 0 ? input_channels : segment + 1 == num_k_segments ? last_k_segment_size : k_segment_size;
+      // Only the first segment includes bias, packed bias of the other segments stays zero.
+      const void* segment_bias = segment == 0 ? bias : NULL;
+      pack_gemm_io_w(
+        output_channels, segment_size,
+        nr, kr, sr,
+        (const void*) ((uintptr_t) kernel + ((segment_start * output_channels) << log2_filter_element_size)),
+        segment_bias,
+        packed_weights,
+        packing_params);
+      packed_weights = (void*) ((uintptr_t) packed_weights +
+        n_stride * (bias_element_size + (round_up_po2(segment_size, kr * sr) << log2_filter_element_size)));
+    }
   } else {
-    pack_gemm_goi_w(
-      1, output_channels, input_channels,
-      nr, kr, sr,
-      kernel, bias,
-      fully_connected_op->packed_weights,
-      0 /* extra bytes */,
-      packing_params);
+    // Weights in F32 are converted to F16 while packing.
+    const bool fp32_static_weights =
+      operator_type == xnn_operator_type_fully_connected_nc_f16 && (flags & XNN_FLAG_FP32_STATIC_WEIGHTS) != 0;
+    const uint32_t log2_kernel_element_size = fp32_static_weights ? 2 : log2_filter_element_size;
+    const size_t bias_input_element_size = fp32_static_weights ? sizeof(float) : bias_element_size;
+    const size_t k_segment_stride = round_up_po2(k_segment_size, kr * sr);
+    const size_t last_k_segment_stride = num_k_segments == 0 ? k_stride : round_up_po2(last_k_segment_size, kr * sr);
+    fully_connected_op->context.pack_gemm = (struct pack_gemm_context) {
+      .groups = 1,
+      .ks = 1,
+      .kc = input_channels,
+      .nc = output_channels,
+      .nr = nr,
+      .kr = kr,
+      .sr = sr,
+      .num_k_segments = max(num_k_segments, 1),
+      .k_segment_size = k_segment_size,
+      .kernel = kernel,
+      .log2_kernel_element_size = log2_kernel_element_size,
+      .kernel_n_stride = input_channels << log2_kernel_element_size,
+      .kernel_g_stride = (output_channels * input_channels) << log2_kernel_element_size,
+      .bias = bias,
+      .bias_n_stride = bias_input_element_size,
+      .bias_g_stride = output_channels * bias_input_element_size,
+      .packed_w = fully_connected_op->packed_weights,
+      .packed_n_stride = nr * (bias_element_size + (last_k_segment_stride << log2_filter_element_size)),
+      .packed_g_stride = packed_weights_size,
+      .packed_k_segment_n_stride = nr * (bias_element_size + (k_segment_stride << log2_filter_element_size)),
+      .packed_k_segment_stride = n_stride * (bias_element_size + (k_segment_stride << log2_filter_element_size)),
+      .extra_bytes = 0,
+      .pack_gemm_goi_w = pack_gemm_goi_w,
+    };
+    if (packing_params != NULL) {
+      memcpy(&fully_connected_op->context.pack_gemm.packing_params, packing_params, packing_params_size);
+    }
+    // Without XNN_FLAG_DEFER_PACKING, pack right away on the caller thread.
+    fully_connected_op->weights_packing_pending = true;
+    if (!(flags & XNN_FLAG_DEFER_PACKING)) {
+      xnn_pack_operator_weights(fully_connected_op, NULL /* threadpool */);
+    }
   }
 
+  fully_connected_op->groups = 1;
   fully_connected_op->group_input_channels = input_channels;
   fully_connected_op->group_output_channels = output_channels;
   fully_connected_op->input_pixel_stride = input_stride;
   fully_connected_op->output_pixel_stride = output_stride;
+  fully_connected_op->num_k_segments = num_k_segments;
+  fully_connected_op->k_segment_size = k_segment_size;
 
   memcpy(&fully_connected_op->params, params, params_size);
   fully_connected_op->type = operator_type;
@@ -153,9 +227,11 @@ static enum xnn_status create_fully_connected_nc(
   fully_connected_op->ukernel.gemm = (struct xnn_ukernel_gemm) {
     .general_case = gemm_ukernels->gemm,
     .mr1_case = gemm_ukernels->gemm1,
+    .gemv_case = gemm_ukernels->gemv,
     .mr = gemm_parameters->mr,
     .nr = nr,
     .kr = kr,
+    .sr = sr,
   };
 
   fully_connected_op->state = xnn_run_state_invalid;
@@ -168,6 +244,107 @@ error:
   return status;
 }
 
+// Setup of F32 Fully Connected with weights packed in segments of the reduction dimension. When there are fewer output
+// tiles than threads, the segments are partitioned across threads, and the partial sums are added up in a second pass.
+// Otherwise the output is tiled as in regular GEMM, and every task accumulates all segments directly in its tile.
+static enum xnn_status setup_segmented_fully_connected_nc_f32(
+  xnn_operator_t fully_connected_op,
+  size_t batch_size,
+  const float* input,
+  float* output,
+  uint32_t mr,
+  struct xnn_hmp_gemm_ukernel gemm_ukernel,
+  size_t num_threads)
+{
+  const size_t input_channels = fully_connected_op->group_input_channels;
+  const size_t output_channels = fully_connected_op->group_output_channels;
+  const uint32_t nr = fully_connected_op->ukernel.gemm.nr;
+  const size_t skr = fully_connected_op->ukernel.gemm.kr * fully_connected_op->ukernel.gemm.sr;
+
+  const size_t num_segments = fully_connected_op->num_k_segments;
+  const size_t segment_size = fully_connected_op->k_segment_size;
+  const size_t last_segment_size = input_channels - (num_segments - 1) * segment_size;
+  const size_t w_stride = sizeof(float) + round_up_po2(segment_size, skr) * sizeof(float);
+  const size_t num_partials = xnn_compute_gemm_k_partitions(batch_size, output_channels, mr, nr, num_segments, num_threads);
+
+  if (num_partials > 1) {
+    const size_t partials_size = num_partials * batch_size * output_channels * sizeof(float) + XNN_EXTRA_BYTES;
+    if (partials_size > fully_connected_op->scratch_buffer_size) {
+      xnn_release_simd_memory(fully_connected_op->scratch_buffer);
+      fully_connected_op->scratch_buffer_size = 0;
+      fully_connected_op->scratch_buffer = xnn_allocate_tagged_simd_memory(xnn_memory_category_scratch, partials_size);
+      if (fully_connected_op->scratch_buffer == NULL) {
+        xnn_log_error(
+          "failed to allocate %zu bytes for %s operator partial sums",
+          partials_size, xnn_operator_type_to_string(fully_connected_op->type));
+        return xnn_status_out_of_memory;
+      }
+      fully_connected_op->scratch_buffer_size = partials_size;
+    }
+  }
+
+  fully_connected_op->context.split_k_gemm = (struct split_k_gemm_context) {
+    .a = input,
+    .a_stride = fully_connected_op->input_pixel_stride * sizeof(float),
+    .packed_w = fully_connected_op->packed_weights,
+    .num_segments = num_segments,
+    .segment_k_scaled = segment_size * sizeof(float),
+    .last_segment_k_scaled = last_segment_size * sizeof(float),
+    .w_stride = w_stride,
+    .last_w_stride = sizeof(float) + round_up_po2(last_segment_size, skr) * sizeof(float),
+    .segment_w_stride = round_up(output_channels, nr) * w_stride,
+    .c = output,
+    .cm_stride = fully_connected_op->output_pixel_stride * sizeof(float),
+    .cn_stride = nr * sizeof(float),
+    .n = output_channels,
+    .num_partials = num_partials,
+    .partials = fully_connected_op->scratch_buffer,
+    .partial_m_stride = output_channels * sizeof(float),
+    .partial_stride = batch_size * output_channels * sizeof(float),
+    .ukernel = gemm_ukernel,
+    .vadd_ukernel = xnn_params.f32.vadd.minmax.op_ukernel,
+    .vadd_params = fully_connected_op->k_segment_vadd_params,
+    .residual = fully_connected_op->residual,
+    .residual_stride = fully_connected_op->residual_pixel_stride * sizeof(float),
+    .residual_ukernel = fully_connected_op->residual_ukernel,
+    .residual_params = fully_connected_op->residual_params.f32,
+  };
+  if XNN_LIKELY(xnn_params.f32.gemm.init.f32 != NULL) {
+    xnn_params.f32.gemm.init.f32(&fully_connected_op->context.split_k_gemm.gemm_linear_params, -INFINITY, INFINITY);
+  }
+  if XNN_LIKELY(xnn_params.f32.vadd.init.f32_minmax != NULL) {
+    xnn_params.f32.vadd.init.f32_minmax(&fully_connected_op->context.split_k_gemm.vadd_linear_params, -INFINITY, INFINITY);
+  }
+
+  if (num_partials > 1) {
+    fully_connected_op->compute.type = xnn_parallelization_type_3d_tile_2d;
+    fully_connected_op->compute.task_3d_tile_2d = (pthreadpool_task_3d_tile_2d_t) xnn_compute_split_k_gemm;
+    fully_connected_op->compute.range[0] = num_partials;
+    fully_connected_op->compute.range[1] = batch_size;
+    fully_connected_op->compute.range[2] = output_channels;
+    fully_connected_op->compute.tile[0] = mr;
+    fully_connected_op->compute.tile[1] = nr;
+    fully_connected_op->compute.num_threads = 0;
+    fully_connected_op->compute2.type = xnn_parallelization_type_1d;
+    fully_connected_op->compute2.task_1d = (pthreadpool_task_1d_t) xnn_compute_split_k_gemm_reduce;
+    fully_connected_op->compute2.range[0] = batch_size;
+  } else {
+    // Every nr-column panel of a segment fits in L1, so rows are always the outer parallelization dimension.
+    const struct xnn_gemm_tiling tiling = xnn_compute_gemm_tiling(
+      batch_size, output_channels, input_channels, mr, nr, num_segments * w_stride, num_threads);
+    fully_connected_op->compute.type = xnn_parallelization_type_2d_tile_2d;
+    fully_connected_op->compute.task_2d_tile_2d = (pthreadpool_task_2d_tile_2d_t) xnn_compute_segmented_gemm;
+    fully_connected_op->compute.range[0] = batch_size;
+    fully_connected_op->compute.range[1] = output_channels;
+    fully_connected_op->compute.tile[0] = mr;
+    fully_connected_op->compute.tile[1] = tiling.nc;
+    fully_connected_op->compute.num_threads = tiling.num_threads;
+  }
+  fully_connected_op->state = xnn_run_state_ready;
+
+  return xnn_status_success;
+}
+
 static enum xnn_status setup_fully_connected_nc(
   xnn_operator_t fully_connected_op,
   size_t batch_size,
@@ -180,9 +357,10 @@ static enum xnn_status setup_fully_connected_nc(
   uint32_t log2_output_element_size,
   const void* params,
   size_t params_size,
-  size_t num_threads)
+  pthreadpool_t threadpool)
 {
   fully_connected_op->state = xnn_run_state_invalid;
+  fully_connected_op->compute2.type = xnn_parallelization_type_invalid;
 
   if ((xnn_params.init_flags & XNN_INIT_FLAG_XNNPACK) == 0) {
     xnn_log_error("failed to setup %s operator: XNNPACK is not initialized",
@@ -190,6 +368,16 @@ static enum xnn_status setup_fully_connected_nc(
     return xnn_status_uninitialized;
   }
 
+  xnn_pack_operator_weights(fully_connected_op, threadpool);
+  const size_t num_threads = pthreadpool_get_threads_count(threadpool);
+
+  if (fully_connected_op->residual_ukernel != NULL && fully_connected_op->residual == NULL) {
+    xnn_log_error(
+      "failed to setup %s operator: residual tensor for the fused addition must be specified via xnn_setup_residual_add",
+      xnn_operator_type_to_string(fully_connected_op->type));
+    return xnn_status_invalid_state;
+  }
+
   if (batch_size == 0) {
     fully_connected_op->state = xnn_run_state_skip;
     return xnn_status_success;
@@ -211,9 +399,21 @@ static enum xnn_status setup_fully_connected_nc(
   const uint32_t nr = fully_connected_op->ukernel.gemm.nr;
 
   struct xnn_hmp_gemm_ukernel gemm_ukernel = fully_connected_op->ukernel.gemm.general_case;
-  if (batch_size == 1 && fully_connected_op->ukernel.gemm.mr1_case.function[XNN_UARCH_DEFAULT] != NULL) {
-    gemm_ukernel = fully_connected_op->ukernel.gemm.mr1_case;
-    mr = 1;
+  if (batch_size == 1) {
+    // Batch-1 Fully Connected is a matrix-vector product: prefer the dedicated GEMV micro-kernel, which shares the
+    // packed weights layout with the GEMM micro-kernels, and otherwise fall back to the MR=1 GEMM micro-kernel.
+    if (fully_connected_op->ukernel.gemm.gemv_case.function[XNN_UARCH_DEFAULT] != NULL) {
+      gemm_ukernel = fully_connected_op->ukernel.gemm.gemv_case;
+      mr = 1;
+    } else if (fully_connected_op->ukernel.gemm.mr1_case.function[XNN_UARCH_DEFAULT] != NULL) {
+      gemm_ukernel = fully_connected_op->ukernel.gemm.mr1_case;
+      mr = 1;
+    }
+  }
+
+  if (fully_connected_op->num_k_segments != 0) {
+    return setup_segmented_fully_connected_nc_f32(
+      fully_connected_op, batch_size, input, output, mr, gemm_ukernel, num_threads);
   }
 
   fully_connected_op->context.gemm = (struct gemm_context) {
@@ -227,24 +427,31 @@ static enum xnn_status setup_fully_connected_nc(
     .cn_stride = nr << log2_output_element_size,
     .log2_csize = log2_output_element_size,
     .ukernel = gemm_ukernel,
+    .residual = fully_connected_op->residual,
+    .residual_stride = fully_connected_op->residual_pixel_stride << log2_output_element_size,
+    .residual_ukernel = fully_connected_op->residual_ukernel,
   };
   memcpy(&fully_connected_op->context.gemm.params, params, params_size);
+  memcpy(&fully_connected_op->context.gemm.residual_params, &fully_connected_op->residual_params, sizeof(fully_connected_op->context.gemm.residual_params));
 
-  size_t nc = output_channels;
-  if (num_threads > 1) {
-    const size_t num_other_tiles = divide_round_up(batch_size, mr);
-    const size_t target_tiles_per_thread = 5;
-    const size_t max_nc = divide_round_up(output_channels * num_other_tiles, num_threads * target_tiles_per_thread);
-    if (max_nc < nc) {
-      nc = min(nc, divide_round_up(nc, max_nc * nr) * nr);
-    }
-  }
+  const struct xnn_gemm_tiling tiling = xnn_compute_gemm_tiling(
+    batch_size, output_channels, input_channels, mr, nr, fully_connected_op->context.gemm.w_stride, num_threads);
   fully_connected_op->compute.type = xnn_parallelization_type_2d_tile_2d;
-  fully_connected_op->compute.task_2d_tile_2d = (pthreadpool_task_2d_tile_2d_t) xnn_compute_gemm;
-  fully_connected_op->compute.range[0] = batch_size;
-  fully_connected_op->compute.range[1] = output_channels;
-  fully_connected_op->compute.tile[0] = mr;
-  fully_connected_op->compute.tile[1] = nc;
+  fully_connected_op->compute.num_threads = tiling.num_threads;
+  if (tiling.blocked) {
+    fully_connected_op->context.gemm.mr = mr;
+    fully_connected_op->compute.task_2d_tile_2d = (pthreadpool_task_2d_tile_2d_t) xnn_compute_gemm_blocked;
+    fully_connected_op->compute.range[0] = output_channels;
+    fully_connected_op->compute.range[1] = batch_size;
+    fully_connected_op->compute.tile[0] = tiling.nc;
+    fully_connected_op->compute.tile[1] = tiling.mc;
+  } else {
+    fully_connected_op->compute.task_2d_tile_2d = (pthreadpool_task_2d_tile_2d_t) xnn_compute_gemm;
+    fully_connected_op->compute.range[0] = batch_size;
+    fully_connected_op->compute.range[1] = output_channels;
+    fully_connected_op->compute.tile[0] = mr;
+    fully_connected_op->compute.tile[1] = tiling.nc;
+  }
   fully_connected_op->state = xnn_run_state_ready;
 
   return xnn_status_success;
@@ -321,17 +528,19 @@ enum xnn_status xnn_create_fully_connected_nc_qu8(
     kernel, bias, flags,
     0 /* log2(sizeof(filter element)) = log2(sizeof(uint8_t)) */,
     sizeof(int32_t) /* sizeof(bias element) */,
+    0 /* no K segments */,
     (xnn_pack_gemm_io_w_function) xnn_pack_qu8_gemm_io_w,
     (xnn_pack_gemm_goi_w_function) xnn_pack_qu8_gemm_goi_w,
-    &packing_params, kernel_zero_point /* packed weights padding byte */,
+    &packing_params, sizeof(packing_params), kernel_zero_point /* packed weights padding byte */,
     &params, sizeof(params),
     &xnn_params.qu8.gemm, &xnn_params.qu8.gemm.minmax,
     XNN_INIT_FLAG_QU8,
+    NULL /* packed weights buffer */,
     xnn_operator_type_fully_connected_nc_qu8,
     fully_connected_op_out);
 }
 
-enum xnn_status xnn_create_fully_connected_nc_qs8(
+static enum xnn_status create_fully_connected_nc_qs8(
     size_t input_channels,
     size_t output_channels,
     size_t input_stride,
@@ -346,6 +555,7 @@ enum xnn_status xnn_create_fully_connected_nc_qs8(
     int8_t output_min,
     int8_t output_max,
     uint32_t flags,
+    struct xnn_packed_weights_buffer* packed_weights_buffer,
     xnn_operator_t* fully_connected_op_out)
 {
   if (input_scale <= 0.0f || !isnormal(input_scale)) {
@@ -399,17 +609,107 @@ enum xnn_status xnn_create_fully_connected_nc_qs8(
     kernel, bias, flags,
     0 /* log2(sizeof(filter element)) = log2(sizeof(int8_t)) */,
     sizeof(int32_t) /* sizeof(bias element) */,
+    0 /* no K segments */,
     (xnn_pack_gemm_io_w_function) xnn_pack_qs8_gemm_io_w,
     (xnn_pack_gemm_goi_w_function) xnn_pack_qs8_gemm_goi_w,
-    &packing_params, 0 /* packed weights padding byte */,
+    &packing_params, sizeof(packing_params), 0 /* packed weights padding byte */,
     &params, sizeof(params),
     &xnn_params.qs8.gemm, &xnn_params.qs8.gemm.minmax,
     XNN_INIT_FLAG_QS8,
+    packed_weights_buffer,
     xnn_operator_type_fully_connected_nc_qs8,
     fully_connected_op_out);
 }
 
-enum xnn_status xnn_create_fully_connected_nc_f32(
+enum xnn_status xnn_create_fully_connected_nc_qs8(
+    size_t input_channels,
+    size_t output_channels,
+    size_t input_stride,
+    size_t output_stride,
+    int8_t input_zero_point,
+    float input_scale,
+    float kernel_scale,
+    const int8_t* kernel,
+    const int32_t* bias,
+    int8_t output_zero_point,
+    float output_scale,
+    int8_t output_min,
+    int8_t output_max,
+    uint32_t flags,
+    xnn_operator_t* fully_connected_op_out)
+{
+  return create_fully_connected_nc_qs8(
+    input_channels, output_channels, input_stride, output_stride,
+    input_zero_point, input_scale, kernel_scale,
+    kernel, bias,
+    output_zero_point, output_scale, output_min, output_max,
+    flags, NULL /* packed weights buffer */, fully_connected_op_out);
+}
+
+enum xnn_status xnn_pack_fully_connected_nc_qs8_weights(
+    size_t input_channels,
+    size_t output_channels,
+    int8_t input_zero_point,
+    const int8_t* kernel,
+    const int32_t* bias,
+    uint32_t flags,
+    void* packed_weights,
+    size_t* packed_weights_size,
+    uint64_t* packed_weights_fingerprint)
+{
+  struct xnn_packed_weights_buffer packed_weights_buffer = {
+    .data = packed_weights,
+    .size = *packed_weights_size,
+  };
+  // Quantization parameters other than the input zero point do not affect the packed weights.
+  xnn_operator_t fully_connected_op = NULL;
+  const enum xnn_status status = create_fully_connected_nc_qs8(
+    input_channels, output_channels, input_channels /* input stride */, output_channels /* output stride */,
+    input_zero_point, 1.0f /* input scale */, 1.0f /* kernel scale */,
+    kernel, bias,
+    0 /* output zero point */, 1.0f /* output scale */, INT8_MIN, INT8_MAX,
+    flags & ~XNN_FLAG_DEFER_PACKING, &packed_weights_buffer, &fully_connected_op);
+  *packed_weights_size = packed_weights_buffer.size;
+  *packed_weights_fingerprint = packed_weights_buffer.fingerprint;
+  if (status == xnn_status_success) {
+    xnn_delete_operator(fully_connected_op);
+  }
+  return status;
+}
+
+enum xnn_status xnn_create_fully_connected_nc_qs8_with_packed_weights(
+    size_t input_channels,
+    size_t output_channels,
+    size_t input_stride,
+    size_t output_stride,
+    int8_t input_zero_point,
+    float input_scale,
+    float kernel_scale,
+    const void* packed_weights,
+    size_t packed_weights_size,
+    uint64_t packed_weights_fingerprint,
+    int8_t output_zero_point,
+    float output_scale,
+    int8_t output_min,
+    int8_t output_max,
+    uint32_t flags,
+    xnn_operator_t* fully_connected_op_out)
+{
+  struct xnn_packed_weights_buffer packed_weights_buffer = {
+    .data = (void*) packed_weights,
+    .size = packed_weights_size,
+    .fingerprint = packed_weights_fingerprint,
+    .prepacked = true,
+  };
+  return create_fully_connected_nc_qs8(
+    input_channels, output_channels, input_stride, output_stride,
+    input_zero_point, input_scale, kernel_scale,
+    NULL /* kernel */, NULL /* bias */,
+    output_zero_point, output_scale, output_min, output_max,
+    flags, &packed_weights_buffer, fully_connected_op_out);
+}
+
+static enum xnn_status create_fully_connected_nc_f32(
     size_t input_channels,
     size_t output_channels,
     size_t input_stride,
@@ -419,6 +719,7 @@ enum xnn_status xnn_create_fully_connected_nc_f32(
     float output_min,
     float output_max,
     uint32_t flags,
+    struct xnn_packed_weights_buffer* packed_weights_buffer,
     xnn_operator_t* fully_connected_op_out)
 {
   if (isnan(output_min)) {
@@ -442,30 +743,131 @@ enum xnn_status xnn_create_fully_connected_nc_f32(
     return xnn_status_invalid_parameter;
   }
 
-  const struct gemm_fused_ukernels* gemm_ukernels = &xnn_params.f32.gemm.minmax;
+  struct gemm_parameters gemm_parameters = xnn_params.f32.gemm;
+  if (flags & XNN_FLAG_AUTOTUNE) {
+    const enum xnn_status autotune_status = xnn_autotune_f32_gemm(
+      xnn_ukernel_type_gemm, output_channels, input_channels, 1 /* kernel size */, &gemm_parameters);
+    if (autotune_status != xnn_status_success) {
+      return autotune_status;
+    }
+  }
+
+  const struct gemm_fused_ukernels* gemm_ukernels = &gemm_parameters.minmax;
   const bool linear_activation = (output_max == INFINITY) && (output_min == -output_max);
-  if (linear_activation && xnn_params.f32.gemm.linear.gemm.function[XNN_UARCH_DEFAULT] != NULL) {
-    gemm_ukernels = &xnn_params.f32.gemm.linear;
+  if (linear_activation && gemm_parameters.linear.gemm.function[XNN_UARCH_DEFAULT] != NULL) {
+    gemm_ukernels = &gemm_parameters.linear;
   }
 
   union xnn_f32_minmax_params params;
-  if XNN_LIKELY(xnn_params.f32.gemm.init.f32 != NULL) {
-    xnn_params.f32.gemm.init.f32(&params, output_min, output_max);
+  if XNN_LIKELY(gemm_parameters.init.f32 != NULL) {
+    gemm_parameters.init.f32(&params, output_min, output_max);
   }
-  return create_fully_connected_nc(
+
+  // Split the reduction dimension into segments when it is long, so that skinny GEMMs can be parallelized across it.
+  size_t k_segment_size = 0;
+  if (gemm_parameters.mr * gemm_parameters.nr <= XNN_SPLIT_K_MAX_TILE_ELEMENTS &&
+      xnn_params.f32.vadd.minmax.op_ukernel != NULL)
+  {
+    k_segment_size = xnn_compute_gemm_k_segment_size(
+      input_channels, gemm_parameters.nr, 2 /* log2(sizeof(filter element)) = log2(sizeof(float)) */);
+  }
+
+  xnn_operator_t fully_connected_op = NULL;
+  const enum xnn_status status = create_fully_connected_nc(
     input_channels, output_channels,
     input_stride, output_stride,
     kernel, bias, flags,
     2 /* log2(sizeof(filter element)) = log2(sizeof(float)) */,
     sizeof(float) /* sizeof(bias element) */,
+    k_segment_size,
     (xnn_pack_gemm_io_w_function) xnn_pack_f32_gemm_io_w,
     (xnn_pack_gemm_goi_w_function) xnn_pack_f32_gemm_goi_w,
-    NULL /* packing params */, 0 /* packed weights padding byte */,
+    NULL /* packing params */, 0 /* packing params size */, 0 /* packed weights padding byte */,
     &params, sizeof(params),
-    &xnn_params.f32.gemm, gemm_ukernels,
+    &gemm_parameters, gemm_ukernels,
     XNN_INIT_FLAG_F32,
+    packed_weights_buffer,
     xnn_operator_type_fully_connected_nc_f32,
-    fully_connected_op_out);
+    &fully_connected_op);
+  if (status != xnn_status_success) {
+    return status;
+  }
+
+  if (fully_connected_op->num_k_segments != 0 && xnn_params.f32.vadd.init.f32_minmax != NULL) {
+    xnn_params.f32.vadd.init.f32_minmax(&fully_connected_op->k_segment_vadd_params, output_min, output_max);
+  }
+  *fully_connected_op_out = fully_connected_op;
+  return xnn_status_success;
+}
+
+enum xnn_status xnn_create_fully_connected_nc_f32(
+    size_t input_channels,
+    size_t output_channels,
+    size_t input_stride,
+    size_t output_stride,
+    const float* kernel,
+    const float* bias,
+    float output_min,
+    float output_max,
+    uint32_t flags,
+    xnn_operator_t* fully_connected_op_out)
+{
+  return create_fully_connected_nc_f32(
+    input_channels, output_channels, input_stride, output_stride,
+    kernel, bias, output_min, output_max,
+    flags, NULL /* packed weights buffer */, fully_connected_op_out);
+}
+
+enum xnn_status xnn_pack_fully_connected_nc_f32_weights(
+    size_t input_channels,
+    size_t output_channels,
+    const float* kernel,
+    const float* bias,
+    uint32_t flags,
+    void* packed_weights,
+    size_t* packed_weights_size,
+    uint64_t* packed_weights_fingerprint)
+{
+  struct xnn_packed_weights_buffer packed_weights_buffer = {
+    .data = packed_weights,
+    .size = *packed_weights_size,
+  };
+  xnn_operator_t fully_connected_op = NULL;
+  const enum xnn_status status = create_fully_connected_nc_f32(
+    input_channels, output_channels, input_channels /* input stride */, output_channels /* output stride */,
+    kernel, bias, -INFINITY, INFINITY,
+    flags & ~XNN_FLAG_DEFER_PACKING, &packed_weights_buffer, &fully_connected_op);
+  *packed_weights_size = packed_weights_buffer.size;
+  *packed_weights_fingerprint = packed_weights_buffer.fingerprint;
+  if (status == xnn_status_success) {
+    xnn_delete_operator(fully_connected_op);
+  }
+  return status;
+}
+
+enum xnn_status xnn_create_fully_connected_nc_f32_with_packed_weights(
+    size_t input_channels,
+    size_t output_channels,
+    size_t input_stride,
+    size_t output_stride,
+    const void* packed_weights,
+    size_t packed_weights_size,
+    uint64_t packed_weights_fingerprint,
+    float output_min,
+    float output_max,
+    uint32_t flags,
+    xnn_operator_t* fully_connected_op_out)
+{
+  struct xnn_packed_weights_buffer packed_weights_buffer = {
+    .data = (void*) packed_weights,
+    .size = packed_weights_size,
+    .fingerprint = packed_weights_fingerprint,
+    .prepacked = true,
+  };
+  return create_fully_connected_nc_f32(
+    input_channels, output_channels, input_stride, output_stride,
+    NULL /* kernel */, NULL /* bias */, output_min, output_max,
+    flags, &packed_weights_buffer, fully_connected_op_out);
 }
 
 enum xnn_status xnn_create_fully_connected_nc_f16(
@@ -521,12 +923,14 @@ enum xnn_status xnn_create_fully_connected_nc_f16(
     kernel, bias, flags,
     1 /* log2(sizeof(filter element)) = log2(sizeof(uint16_t)) */,
     sizeof(uint16_t) /* sizeof(bias element) */,
+    0 /* no K segments */,
     pack_gemm_io_w,
     pack_gemm_goi_w,
-    NULL /* packing params */, 0 /* packed weights padding byte */,
+    NULL /* packing params */, 0 /* packing params size */, 0 /* packed weights padding byte */,
     &params, sizeof(params),
     &xnn_params.f16.gemm, &xnn_params.f16.gemm.minmax,
     XNN_INIT_FLAG_F16,
+    NULL /* packed weights buffer */,
     xnn_operator_type_fully_connected_nc_f16,
     fully_connected_op_out);
 }
@@ -556,7 +960,7 @@ enum xnn_status xnn_setup_fully_connected_nc_qu8(
     0 /* log2(sizeof(output element)) = log2(sizeof(uint8_t)) */,
     &fully_connected_op->params.qu8_conv_minmax,
     sizeof(fully_connected_op->params.qu8_conv_minmax),
-    pthreadpool_get_threads_count(threadpool));
+    threadpool);
 }
 
 enum xnn_status xnn_setup_fully_connected_nc_qs8(
@@ -584,7 +988,7 @@ enum xnn_status xnn_setup_fully_connected_nc_qs8(
     0 /* log2(sizeof(output element)) = log2(sizeof(int8_t)) */,
     &fully_connected_op->params.qs8_conv_minmax,
     sizeof(fully_connected_op->params.qs8_conv_minmax),
-    pthreadpool_get_threads_count(threadpool));
+    threadpool);
 }
 
 enum xnn_status xnn_setup_fully_connected_nc_f32(
@@ -612,7 +1016,7 @@ enum xnn_status xnn_setup_fully_connected_nc_f32(
     2 /* log2(sizeof(output element)) = log2(sizeof(float)) */,
     &fully_connected_op->params.f32_minmax,
     sizeof(fully_connected_op->params.f32_minmax),
-    pthreadpool_get_threads_count(threadpool));
+    threadpool);
 }
 
 enum xnn_status xnn_setup_fully_connected_nc_f16(
@@ -640,5 +1044,5 @@ enum xnn_status xnn_setup_fully_connected_nc_f16(
     1 /* log2(sizeof(output element)) = log2(sizeof(uint16_t)) */,
     &fully_connected_op->params.f16_scaleminmax,
     sizeof(fully_connected_op->params.f16_scaleminmax),
-    pthreadpool_get_threads_count(threadpool));
+    threadpool);
 }
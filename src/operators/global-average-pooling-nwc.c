@@ -88,7 +88,7 @@ static enum xnn_status create_global_average_pooling_nwc(
   }
 
   const size_t zero_size = (channels << log2_element_size) + XNN_EXTRA_BYTES;
-  void* zero_buffer = xnn_allocate_zero_simd_memory(zero_size);
+  void* zero_buffer = xnn_allocate_zero_tagged_simd_memory(xnn_memory_category_zero_buffer, zero_size);
   if (zero_buffer == NULL) {
     xnn_log_error(
       "failed to allocate %zu bytes for %s operator zero padding",
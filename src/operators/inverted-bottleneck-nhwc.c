@@ -0,0 +1,305 @@
+// Copyright 2022 Google LLC
+//
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree.
+
+#include <assert.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+#include <xnnpack.h>
+#include <xnnpack/allocator.h>
+#include <xnnpack/common.h>
+#include <xnnpack/compute.h>
+#include <xnnpack/indirection.h>
+#include <xnnpack/log.h>
+#include <xnnpack/math.h>
+#include <xnnpack/operator.h>
+#include <xnnpack/params.h>
+
+
+// Target size of the intermediate tensors for one strip of output rows. Strips are sized to keep the expanded
+// intermediate tensor resident in the L2 cache of the core which processes the strip.
+#define XNN_INVERTED_BOTTLENECK_STRIP_BYTES (256 * 1024)
+
+static bool is_pointwise_gemm(xnn_operator_t op) {
+  return op->ukernel.type == xnn_ukernel_type_gemm && op->groups == 1 &&
+    op->kernel_height == 1 && op->kernel_width == 1 && op->stride_height == 1 && op->stride_width == 1 &&
+    (op->padding_top | op->padding_right | op->padding_bottom | op->padding_left) == 0 &&
+    (op->flags & XNN_FLAG_TENSORFLOW_SAME_PADDING) == 0 &&
+    op->residual_ukernel == NULL;
+}
+
+enum xnn_status xnn_create_inverted_bottleneck_nhwc_f32(
+    xnn_operator_t expand_op,
+    xnn_operator_t depthwise_op,
+    xnn_operator_t project_op,
+    uint32_t flags,
+    xnn_operator_t* inverted_bottleneck_op_out)
+{
+  xnn_operator_t inverted_bottleneck_op = NULL;
+  enum xnn_status status = xnn_status_uninitialized;
+
+  if ((xnn_params.init_flags & XNN_INIT_FLAG_XNNPACK) == 0) {
+    xnn_log_error("failed to create %s operator: XNNPACK is not initialized",
+      xnn_operator_type_to_string(xnn_operator_type_inverted_bottleneck_nhwc_f32));
+    goto error;
+  }
+
+  status = xnn_status_invalid_parameter;
+
+  if (expand_op->type != xnn_operator_type_convolution_nhwc_f32 ||
+      depthwise_op->type != xnn_operator_type_convolution_nhwc_f32 ||
+      project_op->type != xnn_operator_type_convolution_nhwc_f32)
+  {
+    xnn_log_error(
+      "failed to create %s operator from %s, %s, and %s operators: all operators must be %s",
+      xnn_operator_type_to_string(xnn_operator_type_inverted_bottleneck_nhwc_f32),
+      xnn_operator_type_to_string(expand_op->type),
+      xnn_operator_type_to_string(depthwise_op->type),
+      xnn_operator_type_to_string(project_op->type),
+      xnn_operator_type_to_string(xnn_operator_type_convolution_nhwc_f32));
+    goto error;
+  }
+
+  const size_t channels = depthwise_op->groups;
+  if (expand_op->group_output_channels != channels || depthwise_op->group_input_channels != 1 ||
+      depthwise_op->group_output_channels != 1 || project_op->group_input_channels != channels)
+  {
+    xnn_log_error(
+      "failed to create %s operator: mismatching number of channels (expansion output: %zu, depthwise: %zu groups "
+      "with %zu input and %zu output channels, projection input: %zu)",
+      xnn_operator_type_to_string(xnn_operator_type_inverted_bottleneck_nhwc_f32),
+      expand_op->group_output_channels, channels,
+      depthwise_op->group_input_channels, depthwise_op->group_output_channels,
+      project_op->group_input_channels);
+    goto error;
+  }
+
+  status = xnn_status_unsupported_parameter;
+
+  if (!is_pointwise_gemm(expand_op) || !is_pointwise_gemm(project_op)) {
+    xnn_log_error(
+      "failed to create %s operator: expansion and projection operators must be ungrouped 1x1 convolutions "
+      "without padding, subsampling, or fused residual addition",
+      xnn_operator_type_to_string(xnn_operator_type_inverted_bottleneck_nhwc_f32));
+    goto error;
+  }
+
+  // The fused block points padded taps of the depthwise convolution at a zero buffer, and can't replicate the input
+  // pixels for reflect, symmetric, or edge padding.
+  if (depthwise_op->ukernel.type != xnn_ukernel_type_dwconv ||
+      (depthwise_op->flags & XNN_FLAG_TENSORFLOW_SAME_PADDING) != 0 ||
+      (depthwise_op->flags & XNN_PADDING_MODE_FLAGS) != 0)
+  {
+    xnn_log_error(
+      "failed to create %s operator: depthwise operator must use a unipass DWCONV micro-kernel with explicit zero "
+      "padding",
+      xnn_operator_type_to_string(xnn_operator_type_inverted_bottleneck_nhwc_f32));
+    goto error;
+  }
+
+  status = xnn_status_out_of_memory;
+
+  inverted_bottleneck_op = xnn_allocate_zero_simd_memory(sizeof(struct xnn_operator));
+  if (inverted_bottleneck_op == NULL) {
+    xnn_log_error(
+      "failed to allocate %zu bytes for %s operator descriptor",
+      sizeof(struct xnn_operator), xnn_operator_type_to_string(xnn_operator_type_inverted_bottleneck_nhwc_f32));
+    goto error;
+  }
+
+  // The fused operator takes ownership of the expansion, depthwise, and projection operators, and uses their packed
+  // weights, micro-kernels, and parameters.
+  inverted_bottleneck_op->fused_operators[0] = expand_op;
+  inverted_bottleneck_op->fused_operators[1] = depthwise_op;
+  inverted_bottleneck_op->fused_operators[2] = project_op;
+
+  inverted_bottleneck_op->group_input_channels = expand_op->group_input_channels;
+  inverted_bottleneck_op->group_channels = channels;
+  inverted_bottleneck_op->group_output_channels = project_op->group_output_channels;
+  inverted_bottleneck_op->input_pixel_stride = expand_op->input_pixel_stride;
+  inverted_bottleneck_op->output_pixel_stride = project_op->output_pixel_stride;
+
+  inverted_bottleneck_op->type = xnn_operator_type_inverted_bottleneck_nhwc_f32;
+  inverted_bottleneck_op->flags = flags;
+
+  inverted_bottleneck_op->state = xnn_run_state_invalid;
+
+  *inverted_bottleneck_op_out = inverted_bottleneck_op;
+  return xnn_status_success;
+
+error:
+  xnn_release_simd_memory(inverted_bottleneck_op);
+  return status;
+}
+
+enum xnn_status xnn_setup_inverted_bottleneck_nhwc_f32(
+    xnn_operator_t inverted_bottleneck_op,
+    size_t batch_size,
+    size_t input_height,
+    size_t input_width,
+    const float* input,
+    float* output,
+    pthreadpool_t threadpool)
+{
+  if (inverted_bottleneck_op->type != xnn_operator_type_inverted_bottleneck_nhwc_f32) {
+    xnn_log_error("failed to setup operator: operator type mismatch (expected %s, got %s)",
+      xnn_operator_type_to_string(xnn_operator_type_inverted_bottleneck_nhwc_f32),
+      xnn_operator_type_to_string(inverted_bottleneck_op->type));
+    return xnn_status_invalid_parameter;
+  }
+  inverted_bottleneck_op->state = xnn_run_state_invalid;
+
+  if ((xnn_params.init_flags & XNN_INIT_FLAG_XNNPACK) == 0) {
+    xnn_log_error("failed to setup %s operator: XNNPACK is not initialized",
+      xnn_operator_type_to_string(xnn_operator_type_inverted_bottleneck_nhwc_f32));
+    return xnn_status_uninitialized;
+  }
+
+  // The fused operators are not setup on their own: pack their weights if packing was deferred.
+  xnn_pack_operator_weights(inverted_bottleneck_op, threadpool);
+
+  if (input_width == 0 || input_height == 0) {
+    xnn_log_error(
+      "failed to setup %s operator with %zux%zu input: input dimensions must be non-zero",
+      xnn_operator_type_to_string(xnn_operator_type_inverted_bottleneck_nhwc_f32), input_width, input_height);
+    return xnn_status_invalid_parameter;
+  }
+
+  if (batch_size == 0) {
+    inverted_bottleneck_op->state = xnn_run_state_skip;
+    return xnn_status_success;
+  }
+
+  const xnn_operator_t expand_op = inverted_bottleneck_op->fused_operators[0];
+  const xnn_operator_t depthwise_op = inverted_bottleneck_op->fused_operators[1];
+  const xnn_operator_t project_op = inverted_bottleneck_op->fused_operators[2];
+
+  const size_t kernel_height = depthwise_op->kernel_height;
+  const size_t kernel_width = depthwise_op->kernel_width;
+  const size_t effective_kernel_height = (kernel_height - 1) * depthwise_op->dilation_height + 1;
+  const size_t effective_kernel_width = (kernel_width - 1) * depthwise_op->dilation_width + 1;
+  const size_t padded_input_height = depthwise_op->padding_top + input_height + depthwise_op->padding_bottom;
+  const size_t padded_input_width = depthwise_op->padding_left + input_width + depthwise_op->padding_right;
+  const size_t output_height = doz(padded_input_height, effective_kernel_height) / depthwise_op->stride_height + 1;
+  const size_t output_width = doz(padded_input_width, effective_kernel_width) / depthwise_op->stride_width + 1;
+
+  const size_t channels = inverted_bottleneck_op->group_channels;
+  const size_t expanded_row_size = input_width * channels * sizeof(float);
+  const size_t depthwise_row_size = output_width * channels * sizeof(float);
+  const size_t step_width = depthwise_op->dilation_width == 1 ? depthwise_op->stride_width : kernel_width;
+  const size_t step_height = kernel_height * kernel_width + (output_width - 1) * step_width * kernel_height;
+
+  // Pick the tallest strip which fits the target size, then shrink it if there are not enough strips for all threads.
+  size_t strip_height = 1;
+  while (strip_height < output_height) {
+    const size_t next_strip_height = strip_height + 1;
+    const size_t expanded_rows =
+      min((next_strip_height - 1) * depthwise_op->stride_height + effective_kernel_height, input_height);
+    if (expanded_rows * expanded_row_size + next_strip_height * depthwise_row_size > XNN_INVERTED_BOTTLENECK_STRIP_BYTES) {
+      break;
+    }
+    strip_height = next_strip_height;
+  }
+  const size_t num_threads = pthreadpool_get_threads_count(threadpool);
+  if (batch_size * divide_round_up(output_height, strip_height) < num_threads) {
+    const size_t target_strips_per_image = divide_round_up(num_threads, batch_size);
+    strip_height = divide_round_up(output_height, min(target_strips_per_image, output_height));
+  }
+  const size_t strips_per_image = divide_round_up(output_height, strip_height);
+  const size_t num_strips = batch_size * strips_per_image;
+  const size_t num_workers = min(num_threads, num_strips);
+
+  const size_t max_expanded_rows =
+    min((strip_height - 1) * depthwise_op->stride_height + effective_kernel_height, input_height);
+  const size_t depthwise_output_offset =
+    round_up_po2(max_expanded_rows * expanded_row_size + XNN_EXTRA_BYTES, XNN_ALLOCATION_ALIGNMENT);
+  const size_t indirection_buffer_offset = depthwise_output_offset +
+    round_up_po2(strip_height * depthwise_row_size + XNN_EXTRA_BYTES, XNN_ALLOCATION_ALIGNMENT);
+  const size_t scratch_stride = indirection_buffer_offset +
+    round_up_po2(strip_height * step_height * sizeof(void*), XNN_ALLOCATION_ALIGNMENT);
+  const size_t scratch_size = num_workers * scratch_stride;
+  if (scratch_size > inverted_bottleneck_op->scratch_buffer_size) {
+    xnn_release_simd_memory(inverted_bottleneck_op->scratch_buffer);
+    inverted_bottleneck_op->scratch_buffer_size = 0;
+    inverted_bottleneck_op->scratch_buffer = xnn_allocate_tagged_simd_memory(xnn_memory_category_scratch, scratch_size);
+    if (inverted_bottleneck_op->scratch_buffer == NULL) {
+      xnn_log_error(
+        "failed to allocate %zu bytes for %s operator scratch buffer",
+        scratch_size, xnn_operator_type_to_string(xnn_operator_type_inverted_bottleneck_nhwc_f32));
+      return xnn_status_out_of_memory;
+    }
+    inverted_bottleneck_op->scratch_buffer_size = scratch_size;
+  }
+
+  inverted_bottleneck_op->batch_size = batch_size;
+  inverted_bottleneck_op->input_height = input_height;
+  inverted_bottleneck_op->input_width = input_width;
+  inverted_bottleneck_op->input = input;
+  inverted_bottleneck_op->output_height = output_height;
+  inverted_bottleneck_op->output_width = output_width;
+  inverted_bottleneck_op->output = output;
+
+  const size_t input_pixel_stride = inverted_bottleneck_op->input_pixel_stride * sizeof(float);
+  const size_t output_pixel_stride = inverted_bottleneck_op->output_pixel_stride * sizeof(float);
+  inverted_bottleneck_op->context.inverted_bottleneck = (struct inverted_bottleneck_context) {
+    .input = input,
+    .input_pixel_stride = input_pixel_stride,
+    .input_batch_stride = input_height * input_width * input_pixel_stride,
+    .input_height = input_height,
+    .input_width = input_width,
+    .channels = channels,
+    .expand_ukernel = expand_op->ukernel.gemm.general_case.function[XNN_UARCH_DEFAULT],
+    .expand_weights = expand_op->packed_weights,
+    .expand_k_scaled = expand_op->group_input_channels * sizeof(float),
+    .expand_mr = expand_op->ukernel.gemm.mr,
+    .expand_nr = expand_op->ukernel.gemm.nr,
+    .depthwise_ukernel = depthwise_op->ukernel.dwconv.unipass_function,
+    .depthwise_weights = depthwise_op->packed_weights,
+    .zero = depthwise_op->zero_buffer,
+    .kernel_height = depthwise_op->kernel_height,
+    .kernel_width = depthwise_op->kernel_width,
+    .stride_height = depthwise_op->stride_height,
+    .stride_width = depthwise_op->stride_width,
+    .dilation_height = depthwise_op->dilation_height,
+    .dilation_width = depthwise_op->dilation_width,
+    .padding_top = depthwise_op->padding_top,
+    .padding_left = depthwise_op->padding_left,
+    .indirection_step_width = step_width,
+    .indirection_step_height = step_height,
+    .project_ukernel = project_op->ukernel.gemm.general_case.function[XNN_UARCH_DEFAULT],
+    .project_weights = project_op->packed_weights,
+    .project_mr = project_op->ukernel.gemm.mr,
+    .project_nr = project_op->ukernel.gemm.nr,
+    .output_channels = project_op->group_output_channels,
+    .output = output,
+    .output_pixel_stride = output_pixel_stride,
+    .output_batch_stride = output_height * output_width * output_pixel_stride,
+    .output_height = output_height,
+    .output_width = output_width,
+    .strip_height = strip_height,
+    .strips_per_image = strips_per_image,
+    .num_strips = num_strips,
+    .num_workers = num_workers,
+    .scratch = inverted_bottleneck_op->scratch_buffer,
+    .scratch_stride = scratch_stride,
+    .depthwise_output_offset = depthwise_output_offset,
+    .indirection_buffer_offset = indirection_buffer_offset,
+  };
+  memcpy(&inverted_bottleneck_op->context.inverted_bottleneck.expand_params, &expand_op->params.f32_minmax,
+    sizeof(inverted_bottleneck_op->context.inverted_bottleneck.expand_params));
+  memcpy(&inverted_bottleneck_op->context.inverted_bottleneck.depthwise_params, &depthwise_op->params.f32_minmax,
+    sizeof(inverted_bottleneck_op->context.inverted_bottleneck.depthwise_params));
+  memcpy(&inverted_bottleneck_op->context.inverted_bottleneck.project_params, &project_op->params.f32_minmax,
+    sizeof(inverted_bottleneck_op->context.inverted_bottleneck.project_params));
+
+  inverted_bottleneck_op->compute.type = xnn_parallelization_type_1d;
+  inverted_bottleneck_op->compute.task_1d = (pthreadpool_task_1d_t) xnn_compute_inverted_bottleneck;
+  inverted_bottleneck_op->compute.range[0] = num_workers;
+  inverted_bottleneck_op->state = xnn_run_state_ready;
+
+  return xnn_status_success;
+}
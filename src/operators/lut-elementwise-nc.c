@@ -99,7 +99,8 @@ static enum xnn_status create_lut_elementwise_nc(
     goto error;
   }
 
-  lut_elementwise_op->lookup_table = xnn_allocate_simd_memory(256 * sizeof(uint8_t));
+  lut_elementwise_op->lookup_table = xnn_allocate_tagged_simd_memory(
+    xnn_memory_category_packed_weights, 256 * sizeof(uint8_t));
   if (lut_elementwise_op->lookup_table == NULL) {
     xnn_log_error(
       "failed to allocate 256 bytes for %s operator lookup table",
@@ -275,7 +275,8 @@ static enum xnn_status setup_max_pooling2d_nhwc(
     // Micro-kernel may read up to (mr - 1) elements after the end of indirection buffer.
     const size_t indirection_buffer_size = sizeof(void*) * ((mr - 1) + output_height * step_height);
     const void** indirection_buffer =
-      (const void**) xnn_reallocate_memory(max_pooling_op->indirection_buffer, indirection_buffer_size);
+      (const void**) xnn_reallocate_tagged_memory(
+        xnn_memory_category_indirection, max_pooling_op->indirection_buffer, indirection_buffer_size);
     if (indirection_buffer == NULL) {
       xnn_log_error("failed to allocate %zu bytes for indirection buffer", indirection_buffer_size);
       return xnn_status_out_of_memory;
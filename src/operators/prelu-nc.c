@@ -16,6 +16,7 @@
 #include <xnnpack/pack.h>
 #include <xnnpack/params-init.h>
 #include <xnnpack/params.h>
+#include <xnnpack/tiling.h>
 
 
 static enum xnn_status create_prelu_nc(
@@ -84,7 +85,7 @@ static enum xnn_status create_prelu_nc(
   }
 
   const size_t packed_weights_size = (channels << log2_weights_element_size) + XNN_EXTRA_BYTES;
-  prelu_op->packed_weights = xnn_allocate_simd_memory(packed_weights_size);
+  prelu_op->packed_weights = xnn_allocate_tagged_simd_memory(xnn_memory_category_packed_weights, packed_weights_size);
   if (prelu_op->packed_weights == NULL) {
     xnn_log_error(
       "failed to allocate %zu bytes for %s operator packed weights",
@@ -197,19 +198,12 @@ static enum xnn_status setup_prelu_nc(
     .ukernel = prelu->ukernel,
   };
 
-  size_t batch_tile = batch_size;
-  if (num_threads > 1) {
-    const size_t target_tiles_per_thread = 5;
-    const size_t max_batch_tile = divide_round_up(batch_size, num_threads * target_tiles_per_thread);
-    if (max_batch_tile < batch_tile) {
-      const uint32_t row_tile = prelu->row_tile;
-      batch_tile = min(batch_tile, divide_round_up(batch_tile, max_batch_tile * row_tile) * row_tile);
-    }
-  }
+  const size_t work = xnn_estimate_work((double) batch_size * channels, (double) batch_size * channels * (2 << log2_element_size));
   prelu_op->compute.type = xnn_parallelization_type_1d_tile_1d;
   prelu_op->compute.task_1d_tile_1d = (pthreadpool_task_1d_tile_1d_t) xnn_compute_prelu;
   prelu_op->compute.range[0] = batch_size;
-  prelu_op->compute.tile[0] = batch_tile;
+  prelu_op->compute.tile[0] = xnn_compute_tile_size(batch_size, prelu->row_tile, xnn_compute_max_tiles(work, num_threads));
+  prelu_op->compute.num_threads = xnn_compute_num_useful_threads(work, num_threads);
   prelu_op->state = xnn_run_state_ready;
 
   return xnn_status_success;
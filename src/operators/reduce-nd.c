@@ -0,0 +1,817 @@
+// Copyright 2022 Google LLC
+//
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree.
+
+#include <assert.h>
+#include <math.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <fp16.h>
+
+#include <xnnpack.h>
+#include <xnnpack/allocator.h>
+#include <xnnpack/log.h>
+#include <xnnpack/operator.h>
+#include <xnnpack/params-init.h>
+#include <xnnpack/params.h>
+
+
+static enum xnn_status create_reduce_nd(
+    uint32_t flags,
+    size_t params_offset,
+    const void* params,
+    size_t params_size,
+    uint32_t datatype_init_flags,
+    enum xnn_operator_type operator_type,
+    xnn_operator_t* reduce_op_out)
+{
+  xnn_operator_t reduce_op = NULL;
+  enum xnn_status status = xnn_status_uninitialized;
+
+  if ((xnn_params.init_flags & XNN_INIT_FLAG_XNNPACK) == 0) {
+    xnn_log_error("failed to create %s operator: XNNPACK is not initialized",
+      xnn_operator_type_to_string(operator_type));
+    goto error;
+  }
+
+  status = xnn_status_unsupported_hardware;
+
+  if ((xnn_params.init_flags & datatype_init_flags) == 0) {
+    xnn_log_error("failed to create %s operator: operations on data type are not supported",
+      xnn_operator_type_to_string(operator_type));
+    goto error;
+  }
+
+  status = xnn_status_out_of_memory;
+
+  reduce_op = xnn_allocate_zero_simd_memory(sizeof(struct xnn_operator));
+  if (reduce_op == NULL) {
+    xnn_log_error(
+      "failed to allocate %zu bytes for %s operator descriptor",
+      sizeof(struct xnn_operator), xnn_operator_type_to_string(operator_type));
+    goto error;
+  }
+
+  if (params_size != 0) {
+    memcpy((void*) ((uintptr_t) reduce_op + params_offset), params, params_size);
+  }
+
+  reduce_op->type = operator_type;
+  reduce_op->flags = flags;
+
+  reduce_op->state = xnn_run_state_invalid;
+
+  *reduce_op_out = reduce_op;
+  return xnn_status_success;
+
+error:
+  xnn_delete_operator(reduce_op);
+  return status;
+}
+
+static enum xnn_status create_reduce_nd_f16(
+    uint32_t flags,
+    enum xnn_operator_type operator_type,
+    xnn_operator_t* reduce_op_out)
+{
+  union xnn_f16_scaleminmax_params params;
+  if (xnn_params.f16.gavgpool.init.f16 != NULL) {
+    xnn_params.f16.gavgpool.init.f16(&params,
+      0 /* scale */, UINT16_C(0xFC00) /* -inf */, UINT16_C(0x7C00) /* inf */);
+  }
+  return create_reduce_nd(
+    flags,
+    offsetof(struct xnn_operator, params.f16_scaleminmax),
+    &params, sizeof(params),
+    XNN_INIT_FLAG_F16,
+    operator_type,
+    reduce_op_out);
+}
+
+static enum xnn_status create_reduce_nd_f32(
+    uint32_t flags,
+    enum xnn_operator_type operator_type,
+    xnn_operator_t* reduce_op_out)
+{
+  union xnn_f32_scaleminmax_params params;
+  if (xnn_params.f32.gavgpool.init.f32 != NULL) {
+    xnn_params.f32.gavgpool.init.f32(&params,
+      0.0f /* scale */, -INFINITY, INFINITY);
+  }
+  return create_reduce_nd(
+    flags,
+    offsetof(struct xnn_operator, params.f32_scaleminmax),
+    &params, sizeof(params),
+    XNN_INIT_FLAG_F32,
+    operator_type,
+    reduce_op_out);
+}
+
+static enum xnn_status create_reduce_nd_qs8(
+    int8_t input_zero_point,
+    float input_scale,
+    int8_t output_zero_point,
+    float output_scale,
+    uint32_t flags,
+    enum xnn_operator_type operator_type,
+    xnn_operator_t* reduce_op_out)
+{
+  if (input_scale <= 0.0f || !isnormal(input_scale)) {
+    xnn_log_error(
+      "failed to create %s operator with %.7g input scale: scale must be finite, normalized, and positive",
+      xnn_operator_type_to_string(operator_type), input_scale);
+    return xnn_status_invalid_parameter;
+  }
+
+  if (output_scale <= 0.0f || !isnormal(output_scale)) {
+    xnn_log_error(
+      "failed to create %s operator with %.7g output scale: scale must be finite, normalized, and positive",
+      xnn_operator_type_to_string(operator_type), output_scale);
+    return xnn_status_invalid_parameter;
+  }
+
+  const float input_output_scale = input_scale / output_scale;
+  if (input_output_scale < 0x1.0p-8f || input_output_scale >= 0x1.0p+8f) {
+    xnn_log_error(
+      "failed to create %s operator with %.7g input-to-output scale ratio: scale ratio must be in [2**-8, 2**8) range",
+      xnn_operator_type_to_string(operator_type), input_output_scale);
+    return xnn_status_unsupported_parameter;
+  }
+
+  union xnn_qs8_avgpool_minmax_params params;
+  if (xnn_params.qs8.gavgpool.init.qs8 != NULL) {
+    xnn_params.qs8.gavgpool.init.qs8(&params,
+      0 /* bias */, 1.0f /* scale */, output_zero_point, INT8_MIN, INT8_MAX);
+  }
+  const enum xnn_status status = create_reduce_nd(
+    flags,
+    offsetof(struct xnn_operator, params.qs8_gavgpool),
+    &params, sizeof(params),
+    XNN_INIT_FLAG_QS8,
+    operator_type,
+    reduce_op_out);
+  if (status == xnn_status_success) {
+    xnn_operator_t reduce_op = *reduce_op_out;
+    reduce_op->input_zero_point = (int32_t) input_zero_point;
+    reduce_op->input_scale = input_scale;
+    reduce_op->output_scale = output_scale;
+  }
+  return status;
+}
+
+enum xnn_status xnn_create_max_nd_f32(
+    uint32_t flags,
+    xnn_operator_t* max_op_out)
+{
+  return create_reduce_nd(
+    flags, 0 /* params offset */, NULL /* params */, 0 /* params size */,
+    XNN_INIT_FLAG_F32, xnn_operator_type_max_nd_f32, max_op_out);
+}
+
+enum xnn_status xnn_create_mean_nd_f16(
+    uint32_t flags,
+    xnn_operator_t* mean_op_out)
+{
+  return create_reduce_nd_f16(flags, xnn_operator_type_mean_nd_f16, mean_op_out);
+}
+
+enum xnn_status xnn_create_mean_nd_f32(
+    uint32_t flags,
+    xnn_operator_t* mean_op_out)
+{
+  return create_reduce_nd_f32(flags, xnn_operator_type_mean_nd_f32, mean_op_out);
+}
+
+enum xnn_status xnn_create_mean_nd_qs8(
+    int8_t input_zero_point,
+    float input_scale,
+    int8_t output_zero_point,
+    float output_scale,
+    uint32_t flags,
+    xnn_operator_t* mean_op_out)
+{
+  return create_reduce_nd_qs8(
+    input_zero_point, input_scale, output_zero_point, output_scale, flags,
+    xnn_operator_type_mean_nd_qs8, mean_op_out);
+}
+
+enum xnn_status xnn_create_min_nd_f32(
+    uint32_t flags,
+    xnn_operator_t* min_op_out)
+{
+  return create_reduce_nd(
+    flags, 0 /* params offset */, NULL /* params */, 0 /* params size */,
+    XNN_INIT_FLAG_F32, xnn_operator_type_min_nd_f32, min_op_out);
+}
+
+enum xnn_status xnn_create_sum_nd_f16(
+    uint32_t flags,
+    xnn_operator_t* sum_op_out)
+{
+  return create_reduce_nd_f16(flags, xnn_operator_type_sum_nd_f16, sum_op_out);
+}
+
+enum xnn_status xnn_create_sum_nd_f32(
+    uint32_t flags,
+    xnn_operator_t* sum_op_out)
+{
+  return create_reduce_nd_f32(flags, xnn_operator_type_sum_nd_f32, sum_op_out);
+}
+
+enum xnn_status xnn_create_sum_nd_qs8(
+    int8_t input_zero_point,
+    float input_scale,
+    int8_t output_zero_point,
+    float output_scale,
+    uint32_t flags,
+    xnn_operator_t* sum_op_out)
+{
+  return create_reduce_nd_qs8(
+    input_zero_point, input_scale, output_zero_point, output_scale, flags,
+    xnn_operator_type_sum_nd_qs8, sum_op_out);
+}
+
+// Reduction with the Global Average Pooling micro-kernels, for at most one group of adjacent reduced dimensions:
+// the input is viewed as a [batch_size, reduction_size, channels] tensor, reduced along the middle dimension.
+static enum xnn_status setup_reduce_nd_gavgpool(
+    xnn_operator_t reduce_op,
+    size_t batch_size,
+    size_t reduction_size,
+    size_t channels,
+    const void* input,
+    void* output,
+    uint32_t log2_element_size,
+    const struct gavgpool_parameters gavgpool[restrict XNN_MIN_ELEMENTS(1)],
+    const void* params,
+    size_t params_size,
+    void (*update_params)(xnn_operator_t, size_t))
+{
+  // The zero buffer depends on the number of channels, which is known only at setup time: re-allocate it if the
+  // previous one is too small.
+  if (reduce_op->zero_buffer == NULL || channels > reduce_op->channels) {
+    xnn_release_simd_memory(reduce_op->zero_buffer);
+    reduce_op->zero_buffer = NULL;
+    reduce_op->channels = 0;
+
+    const size_t zero_size = (channels << log2_element_size) + XNN_EXTRA_BYTES;
+    void* zero_buffer = xnn_allocate_zero_tagged_simd_memory(xnn_memory_category_zero_buffer, zero_size);
+    if (zero_buffer == NULL) {
+      xnn_log_error(
+        "failed to allocate %zu bytes for %s operator zero padding",
+        zero_size, xnn_operator_type_to_string(reduce_op->type));
+      return xnn_status_out_of_memory;
+    }
+    reduce_op->zero_buffer = zero_buffer;
+    reduce_op->channels = channels;
+  }
+
+  update_params(reduce_op, reduction_size);
+
+  assert(gavgpool->row_tile != 0);
+
+  const size_t input_stride_in_bytes = channels << log2_element_size;
+  reduce_op->context.global_average_pooling_nwc = (struct global_average_pooling_nwc_context) {
+      .input = input,
+      .zero = reduce_op->zero_buffer,
+      .input_pixel_stride = input_stride_in_bytes,
+      .input_batch_stride = input_stride_in_bytes * reduction_size,
+      .input_elements = reduction_size,
+      .channels = channels,
+      .output = output,
+      .output_batch_stride = input_stride_in_bytes,
+  };
+  memcpy(&reduce_op->context.global_average_pooling_nwc.params, params, params_size);
+  reduce_op->compute.type = xnn_parallelization_type_1d;
+  reduce_op->compute.range[0] = batch_size;
+
+  if (reduction_size <= gavgpool->row_tile) {
+    reduce_op->compute.task_1d = (pthreadpool_task_1d_t) xnn_compute_global_average_pooling_nwc_unipass;
+    reduce_op->context.global_average_pooling_nwc.unipass_ukernel = gavgpool->unipass;
+  } else {
+    reduce_op->compute.task_1d = (pthreadpool_task_1d_t) xnn_compute_global_average_pooling_nwc_multipass;
+    reduce_op->context.global_average_pooling_nwc.multipass_ukernel = gavgpool->multipass;
+  }
+  reduce_op->state = xnn_run_state_ready;
+
+  return xnn_status_success;
+}
+
+// Generic F32 reduction over up to 3 groups of reduced dimensions interleaved with up to 3 groups of non-reduced
+// dimensions. The normalized shape lists dimensions from the innermost to the outermost, alternating between reduced
+// and non-reduced groups. Non-reduced groups are parallelized, and reduced groups are looped over in the compute
+// function: the innermost group is reduced by the rreduce micro-kernel when it is reduced, and accumulated element-wise
+// with the vbinary micro-kernel when it is not.
+static enum xnn_status setup_reduce_nd_f32(
+    xnn_operator_t reduce_op,
+    size_t num_normalized_dims,
+    const size_t* normalized_shape,
+    bool innermost_dim_reduced,
+    const float* input,
+    float* output,
+    bool average,
+    xnn_f32_rmax_ukernel_function rreduce_ukernel,
+    const struct vbinary_parameters vbinary[restrict XNN_MIN_ELEMENTS(1)],
+    const void* params,
+    size_t params_size)
+{
+  size_t input_stride[XNN_MAX_TENSOR_DIMS];
+  size_t output_stride[XNN_MAX_TENSOR_DIMS];
+  size_t input_elements = 1;
+  size_t output_elements = 1;
+  size_t reduction_elements = 1;
+  for (size_t i = 0; i < num_normalized_dims; i++) {
+    const bool is_reduced = ((i & 1) == 0) == innermost_dim_reduced;
+    input_stride[i] = input_elements * sizeof(float);
+    output_stride[i] = output_elements * sizeof(float);
+    input_elements *= normalized_shape[i];
+    if (is_reduced) {
+      reduction_elements *= normalized_shape[i];
+    } else {
+      output_elements *= normalized_shape[i];
+    }
+  }
+
+  struct reduce_context* context = &reduce_op->context.reduce;
+  *context = (struct reduce_context) {
+    .input = input,
+    .input_stride = { 0, 0, 0 },
+    .reduction_size = { 1, 1, 1 },
+    .reduction_stride = { 0, 0, 0 },
+    .scaled_elements = normalized_shape[0] * sizeof(float),
+    .output = output,
+    .output_stride = { 0, 0, 0 },
+    .scale = average ? 1.0f / (float) reduction_elements : 1.0f,
+    .vbinary_ukernel = vbinary->minmax.op_ukernel,
+  };
+  context->rreduce_ukernel.rmax = rreduce_ukernel;
+  memcpy(&context->params, params, params_size);
+
+  size_t parallel_range[3] = { 1, 1, 1 };
+  size_t num_parallel_dims = 0;
+  size_t num_reduction_dims = 0;
+  for (size_t i = 1; i < num_normalized_dims; i++) {
+    const bool is_reduced = ((i & 1) == 0) == innermost_dim_reduced;
+    if (is_reduced) {
+      assert(num_reduction_dims < 3);
+      context->reduction_size[num_reduction_dims] = normalized_shape[i];
+      context->reduction_stride[num_reduction_dims] = input_stride[i];
+      num_reduction_dims += 1;
+    } else {
+      // Parallelized dimensions are listed from the outermost to the innermost, the last one at index 2.
+      assert(num_parallel_dims < 3);
+      parallel_range[2 - num_parallel_dims] = normalized_shape[i];
+      context->input_stride[2 - num_parallel_dims] = input_stride[i];
+      context->output_stride[2 - num_parallel_dims] = output_stride[i];
+      num_parallel_dims += 1;
+    }
+  }
+
+  reduce_op->compute.type = xnn_parallelization_type_3d;
+  reduce_op->compute.range[0] = parallel_range[0];
+  reduce_op->compute.range[1] = parallel_range[1];
+  reduce_op->compute.range[2] = parallel_range[2];
+  if (innermost_dim_reduced) {
+    reduce_op->compute.task_3d = (pthreadpool_task_3d_t) xnn_compute_reduce_contiguous;
+  } else {
+    reduce_op->compute.task_3d = (pthreadpool_task_3d_t) xnn_compute_reduce_strided;
+    if (average) {
+      context->vscale_ukernel = xnn_params.f32.vmul.minmax.opc_ukernel;
+      if (xnn_params.f32.vmul.init.f32_minmax != NULL) {
+        xnn_params.f32.vmul.init.f32_minmax(&context->scale_params, -INFINITY, INFINITY);
+      }
+    }
+  }
+  reduce_op->state = xnn_run_state_ready;
+
+  return xnn_status_success;
+}
+
+static enum xnn_status setup_reduce_nd(
+    xnn_operator_t reduce_op,
+    enum xnn_operator_type expected_operator_type,
+    size_t num_reduction_axes,
+    const size_t* reduction_axes,
+    size_t num_input_dims,
+    const size_t* input_shape,
+    const void* input,
+    void* output,
+    uint32_t log2_element_size,
+    uint32_t datatype_init_flags,
+    const struct gavgpool_parameters* gavgpool,
+    const void* gavgpool_params,
+    size_t gavgpool_params_size,
+    void (*update_params)(xnn_operator_t, size_t),
+    bool average,
+    xnn_f32_rmax_ukernel_function rreduce_ukernel,
+    const struct vbinary_parameters* vbinary,
+    const void* vbinary_params,
+    size_t vbinary_params_size)
+{
+  if (reduce_op->type != expected_operator_type) {
+    xnn_log_error("failed to setup operator: operator type mismatch (expected %s, got %s)",
+      xnn_operator_type_to_string(expected_operator_type),
+      xnn_operator_type_to_string(reduce_op->type));
+    return xnn_status_invalid_parameter;
+  }
+  reduce_op->state = xnn_run_state_invalid;
+
+  if ((xnn_params.init_flags & XNN_INIT_FLAG_XNNPACK) == 0) {
+    xnn_log_error("failed to setup %s operator: XNNPACK is not initialized",
+      xnn_operator_type_to_string(reduce_op->type));
+    return xnn_status_uninitialized;
+  }
+
+  if ((xnn_params.init_flags & datatype_init_flags) == 0) {
+    xnn_log_error("failed to setup %s operator: operations on data type are not supported",
+      xnn_operator_type_to_string(reduce_op->type));
+    return xnn_status_unsupported_hardware;
+  }
+
+  if (num_input_dims > XNN_MAX_TENSOR_DIMS) {
+    xnn_log_error(
+      "failed to setup %s operator with %zu dimensions in input shape: "
+      "the number of input dimensions must not exceed %d",
+      xnn_operator_type_to_string(reduce_op->type), num_input_dims, XNN_MAX_TENSOR_DIMS);
+    return xnn_status_unsupported_parameter;
+  }
+
+  for (size_t i = 0; i < num_input_dims; i++) {
+    if (input_shape[i] == 0) {
+      xnn_log_error(
+        "failed to setup %s operator: input shape dimension #%zu is zero",
+        xnn_operator_type_to_string(reduce_op->type), i);
+      return xnn_status_invalid_parameter;
+    }
+  }
+
+  if (num_reduction_axes > num_input_dims) {
+    xnn_log_error(
+      "failed to setup %s operator with %zu reduction axes: "
+      "the number of reduction axes must not exceed the number of input dimensions (%zu)",
+      xnn_operator_type_to_string(reduce_op->type), num_reduction_axes, num_input_dims);
+    return xnn_status_invalid_parameter;
+  }
+
+  bool is_reduced_dim[XNN_MAX_TENSOR_DIMS] = { false };
+  for (size_t i = 0; i < num_reduction_axes; i++) {
+    const size_t axis = reduction_axes[i];
+    if (axis >= num_input_dims) {
+      xnn_log_error(
+        "failed to setup %s operator with #%zu reduction axis of %zu: the reduction axis must be less than the number "
+        "of input dimensions (%zu)",
+        xnn_operator_type_to_string(reduce_op->type), i, axis, num_input_dims);
+      return xnn_status_invalid_parameter;
+    }
+    if (i != 0 && axis <= reduction_axes[i - 1]) {
+      xnn_log_error(
+        "failed to setup %s operator with #%zu reduction axis of %zu: "
+        "the reduction axes must be in strictly ascending order",
+        xnn_operator_type_to_string(reduce_op->type), i, axis);
+      return xnn_status_invalid_parameter;
+    }
+    is_reduced_dim[axis] = true;
+  }
+
+  // Normalize the shape: drop dimensions of size 1, and merge adjacent dimensions which are either both reduced or
+  // both non-reduced. The normalized shape lists dimensions from the innermost to the outermost, and alternates
+  // between reduced and non-reduced dimensions.
+  size_t num_normalized_dims = 0;
+  size_t normalized_shape[XNN_MAX_TENSOR_DIMS];
+  bool innermost_dim_reduced = false;
+  bool is_previous_dim_reduced = false;
+  for (size_t i = 0; i < num_input_dims; i++) {
+    const size_t input_dim = input_shape[num_input_dims - 1 - i];
+    const bool is_current_dim_reduced = is_reduced_dim[num_input_dims - 1 - i];
+    if (input_dim == 1) {
+      continue;
+    }
+    if (num_normalized_dims == 0) {
+      innermost_dim_reduced = is_current_dim_reduced;
+      normalized_shape[num_normalized_dims++] = input_dim;
+    } else if (is_current_dim_reduced == is_previous_dim_reduced) {
+      normalized_shape[num_normalized_dims - 1] *= input_dim;
+    } else {
+      normalized_shape[num_normalized_dims++] = input_dim;
+    }
+    is_previous_dim_reduced = is_current_dim_reduced;
+  }
+  if (num_normalized_dims == 0) {
+    // All dimensions have size 1: the reduction is a copy of a single element.
+    normalized_shape[num_normalized_dims++] = 1;
+  }
+  const size_t num_reduced_groups = innermost_dim_reduced ?
+    (num_normalized_dims + 1) / 2 : num_normalized_dims / 2;
+
+  reduce_op->input = input;
+  reduce_op->output = output;
+
+  // Reductions over a single group of adjacent dimensions use the Global Average Pooling micro-kernels, except for F32
+  // reductions of the innermost dimension, which use the faster rreduce micro-kernels.
+  const bool use_gavgpool = gavgpool != NULL && num_reduced_groups <= 1 &&
+    (rreduce_ukernel == NULL || !innermost_dim_reduced);
+  if (use_gavgpool) {
+    size_t channels = 1;
+    size_t reduction_size = 1;
+    size_t batch_size = 1;
+    for (size_t i = 0; i < num_normalized_dims; i++) {
+      const bool is_reduced = ((i & 1) == 0) == innermost_dim_reduced;
+      if (is_reduced) {
+        reduction_size = normalized_shape[i];
+      } else if (i == 0) {
+        channels = normalized_shape[i];
+      } else {
+        batch_size *= normalized_shape[i];
+      }
+    }
+    return setup_reduce_nd_gavgpool(
+      reduce_op, batch_size, reduction_size, channels,
+      input, output,
+      log2_element_size,
+      gavgpool,
+      gavgpool_params, gavgpool_params_size,
+      update_params);
+  }
+
+  if (rreduce_ukernel == NULL) {
+    xnn_log_error(
+      "failed to setup %s operator with %zu groups of non-adjacent reduction axes: "
+      "only reductions over adjacent axes are supported for this data type",
+      xnn_operator_type_to_string(reduce_op->type), num_reduced_groups);
+    return xnn_status_unsupported_parameter;
+  }
+
+  return setup_reduce_nd_f32(
+    reduce_op,
+    num_normalized_dims, normalized_shape, innermost_dim_reduced,
+    input, output,
+    average,
+    rreduce_ukernel,
+    vbinary, vbinary_params, vbinary_params_size);
+}
+
+static void update_params_mean_f16(
+  xnn_operator_t reduce_op,
+  size_t reduction_size)
+{
+  xnn_params.f16.gavgpool.update.f16(
+    &reduce_op->params.f16_scaleminmax,
+    fp16_ieee_from_fp32_value(1.0f / (float) reduction_size));
+}
+
+static void update_params_sum_f16(
+  xnn_operator_t reduce_op,
+  size_t reduction_size)
+{
+  xnn_params.f16.gavgpool.update.f16(
+    &reduce_op->params.f16_scaleminmax,
+    UINT16_C(0x3C00) /* 1.0 */);
+}
+
+static void update_params_mean_f32(
+  xnn_operator_t reduce_op,
+  size_t reduction_size)
+{
+  xnn_params.f32.gavgpool.update.f32(&reduce_op->params.f32_scaleminmax, 1.0f / (float) reduction_size);
+}
+
+static void update_params_sum_f32(
+  xnn_operator_t reduce_op,
+  size_t reduction_size)
+{
+  xnn_params.f32.gavgpool.update.f32(&reduce_op->params.f32_scaleminmax, 1.0f);
+}
+
+static void update_params_mean_qs8(
+  xnn_operator_t reduce_op,
+  size_t reduction_size)
+{
+  const int32_t bias = -((int32_t) reduction_size * reduce_op->input_zero_point);
+  const float scale = reduce_op->input_scale / (reduce_op->output_scale * (float) reduction_size);
+  xnn_params.qs8.gavgpool.update.qs8(&reduce_op->params.qs8_gavgpool, bias, scale);
+}
+
+static void update_params_sum_qs8(
+  xnn_operator_t reduce_op,
+  size_t reduction_size)
+{
+  const int32_t bias = -((int32_t) reduction_size * reduce_op->input_zero_point);
+  const float scale = reduce_op->input_scale / reduce_op->output_scale;
+  xnn_params.qs8.gavgpool.update.qs8(&reduce_op->params.qs8_gavgpool, bias, scale);
+}
+
+enum xnn_status xnn_setup_max_nd_f32(
+    xnn_operator_t max_op,
+    size_t num_reduction_axes,
+    const size_t* reduction_axes,
+    size_t num_input_dims,
+    const size_t* input_shape,
+    const float* input,
+    float* output,
+    pthreadpool_t threadpool)
+{
+  union xnn_f32_default_params params;
+  if (xnn_params.f32.vmax.init.f32_default != NULL) {
+    xnn_params.f32.vmax.init.f32_default(&params);
+  }
+  return setup_reduce_nd(
+    max_op, xnn_operator_type_max_nd_f32,
+    num_reduction_axes, reduction_axes,
+    num_input_dims, input_shape,
+    input, output,
+    2 /* log2(sizeof(float)) */,
+    XNN_INIT_FLAG_F32,
+    NULL /* gavgpool */, NULL /* gavgpool params */, 0 /* gavgpool params size */, NULL /* update params */,
+    false /* average */,
+    xnn_params.f32.rmax,
+    &xnn_params.f32.vmax, &params, sizeof(params));
+}
+
+enum xnn_status xnn_setup_mean_nd_f16(
+    xnn_operator_t mean_op,
+    size_t num_reduction_axes,
+    const size_t* reduction_axes,
+    size_t num_input_dims,
+    const size_t* input_shape,
+    const void* input,
+    void* output,
+    pthreadpool_t threadpool)
+{
+  return setup_reduce_nd(
+    mean_op, xnn_operator_type_mean_nd_f16,
+    num_reduction_axes, reduction_axes,
+    num_input_dims, input_shape,
+    input, output,
+    1 /* log2(sizeof(uint16_t)) */,
+    XNN_INIT_FLAG_F16,
+    &xnn_params.f16.gavgpool,
+    &mean_op->params.f16_scaleminmax, sizeof(mean_op->params.f16_scaleminmax),
+    update_params_mean_f16,
+    true /* average */,
+    NULL /* rreduce ukernel */,
+    NULL /* vbinary */, NULL /* vbinary params */, 0 /* vbinary params size */);
+}
+
+enum xnn_status xnn_setup_mean_nd_f32(
+    xnn_operator_t mean_op,
+    size_t num_reduction_axes,
+    const size_t* reduction_axes,
+    size_t num_input_dims,
+    const size_t* input_shape,
+    const float* input,
+    float* output,
+    pthreadpool_t threadpool)
+{
+  union xnn_f32_minmax_params params;
+  if (xnn_params.f32.vadd.init.f32_minmax != NULL) {
+    xnn_params.f32.vadd.init.f32_minmax(&params, -INFINITY, INFINITY);
+  }
+  return setup_reduce_nd(
+    mean_op, xnn_operator_type_mean_nd_f32,
+    num_reduction_axes, reduction_axes,
+    num_input_dims, input_shape,
+    input, output,
+    2 /* log2(sizeof(float)) */,
+    XNN_INIT_FLAG_F32,
+    &xnn_params.f32.gavgpool,
+    &mean_op->params.f32_scaleminmax, sizeof(mean_op->params.f32_scaleminmax),
+    update_params_mean_f32,
+    true /* average */,
+    xnn_params.f32.rsum,
+    &xnn_params.f32.vadd, &params, sizeof(params));
+}
+
+enum xnn_status xnn_setup_mean_nd_qs8(
+    xnn_operator_t mean_op,
+    size_t num_reduction_axes,
+    const size_t* reduction_axes,
+    size_t num_input_dims,
+    const size_t* input_shape,
+    const int8_t* input,
+    int8_t* output,
+    pthreadpool_t threadpool)
+{
+  return setup_reduce_nd(
+    mean_op, xnn_operator_type_mean_nd_qs8,
+    num_reduction_axes, reduction_axes,
+    num_input_dims, input_shape,
+    input, output,
+    0 /* log2(sizeof(int8_t)) */,
+    XNN_INIT_FLAG_QS8,
+    &xnn_params.qs8.gavgpool,
+    &mean_op->params.qs8_gavgpool, sizeof(mean_op->params.qs8_gavgpool),
+    update_params_mean_qs8,
+    true /* average */,
+    NULL /* rreduce ukernel */,
+    NULL /* vbinary */, NULL /* vbinary params */, 0 /* vbinary params size */);
+}
+
+enum xnn_status xnn_setup_min_nd_f32(
+    xnn_operator_t min_op,
+    size_t num_reduction_axes,
+    const size_t* reduction_axes,
+    size_t num_input_dims,
+    const size_t* input_shape,
+    const float* input,
+    float* output,
+    pthreadpool_t threadpool)
+{
+  union xnn_f32_default_params params;
+  if (xnn_params.f32.vmin.init.f32_default != NULL) {
+    xnn_params.f32.vmin.init.f32_default(&params);
+  }
+  return setup_reduce_nd(
+    min_op, xnn_operator_type_min_nd_f32,
+    num_reduction_axes, reduction_axes,
+    num_input_dims, input_shape,
+    input, output,
+    2 /* log2(sizeof(float)) */,
+    XNN_INIT_FLAG_F32,
+    NULL /* gavgpool */, NULL /* gavgpool params */, 0 /* gavgpool params size */, NULL /* update params */,
+    false /* average */,
+    xnn_params.f32.rmin,
+    &xnn_params.f32.vmin, &params, sizeof(params));
+}
+
+enum xnn_status xnn_setup_sum_nd_f16(
+    xnn_operator_t sum_op,
+    size_t num_reduction_axes,
+    const size_t* reduction_axes,
+    size_t num_input_dims,
+    const size_t* input_shape,
+    const void* input,
+    void* output,
+    pthreadpool_t threadpool)
+{
+  return setup_reduce_nd(
+    sum_op, xnn_operator_type_sum_nd_f16,
+    num_reduction_axes, reduction_axes,
+    num_input_dims, input_shape,
+    input, output,
+    1 /* log2(sizeof(uint16_t)) */,
+    XNN_INIT_FLAG_F16,
+    &xnn_params.f16.gavgpool,
+    &sum_op->params.f16_scaleminmax, sizeof(sum_op->params.f16_scaleminmax),
+    update_params_sum_f16,
+    false /* average */,
+    NULL /* rreduce ukernel */,
+    NULL /* vbinary */, NULL /* vbinary params */, 0 /* vbinary params size */);
+}
+
+enum xnn_status xnn_setup_sum_nd_f32(
+    xnn_operator_t sum_op,
+    size_t num_reduction_axes,
+    const size_t* reduction_axes,
+    size_t num_input_dims,
+    const size_t* input_shape,
+    const float* input,
+    float* output,
+    pthreadpool_t threadpool)
+{
+  union xnn_f32_minmax_params params;
+  if (xnn_params.f32.vadd.init.f32_minmax != NULL) {
+    xnn_params.f32.vadd.init.f32_minmax(&params, -INFINITY, INFINITY);
+  }
+  return setup_reduce_nd(
+    sum_op, xnn_operator_type_sum_nd_f32,
+    num_reduction_axes, reduction_axes,
+    num_input_dims, input_shape,
+    input, output,
+    2 /* log2(sizeof(float)) */,
+    XNN_INIT_FLAG_F32,
+    &xnn_params.f32.gavgpool,
+    &sum_op->params.f32_scaleminmax, sizeof(sum_op->params.f32_scaleminmax),
+    update_params_sum_f32,
+    false /* average */,
+    xnn_params.f32.rsum,
+    &xnn_params.f32.vadd, &params, sizeof(params));
+}
+
+enum xnn_status xnn_setup_sum_nd_qs8(
+    xnn_operator_t sum_op,
+    size_t num_reduction_axes,
+    const size_t* reduction_axes,
+    size_t num_input_dims,
+    const size_t* input_shape,
+    const int8_t* input,
+    int8_t* output,
+    pthreadpool_t threadpool)
+{
+  return setup_reduce_nd(
+    sum_op, xnn_operator_type_sum_nd_qs8,
+    num_reduction_axes, reduction_axes,
+    num_input_dims, input_shape,
+    input, output,
+    0 /* log2(sizeof(int8_t)) */,
+    XNN_INIT_FLAG_QS8,
+    &xnn_params.qs8.gavgpool,
+    &sum_op->params.qs8_gavgpool, sizeof(sum_op->params.qs8_gavgpool),
+    update_params_sum_qs8,
+    false /* average */,
+    NULL /* rreduce ukernel */,
+    NULL /* vbinary */, NULL /* vbinary params */, 0 /* vbinary params size */);
+}
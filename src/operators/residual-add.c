@@ -0,0 +1,322 @@
+// Copyright 2022 Google LLC
+//
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree.
+
+#include <assert.h>
+#include <inttypes.h>
+#include <math.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+#include <fp16.h>
+
+#include <xnnpack.h>
+#include <xnnpack/log.h>
+#include <xnnpack/operator.h>
+#include <xnnpack/params.h>
+
+
+static enum xnn_status fuse_residual_add(
+    xnn_operator_t op,
+    enum xnn_operator_type convolution_operator_type,
+    enum xnn_operator_type fully_connected_operator_type,
+    const struct vbinary_parameters vadd[restrict XNN_MIN_ELEMENTS(1)],
+    const void* params,
+    size_t params_size,
+    uint32_t datatype_init_flags)
+{
+  if ((xnn_params.init_flags & XNN_INIT_FLAG_XNNPACK) == 0) {
+    xnn_log_error("failed to fuse residual addition into %s operator: XNNPACK is not initialized",
+      xnn_operator_type_to_string(op->type));
+    return xnn_status_uninitialized;
+  }
+
+  if ((xnn_params.init_flags & datatype_init_flags) != datatype_init_flags) {
+    xnn_log_error("failed to fuse residual addition into %s operator: operations on data type are not supported",
+      xnn_operator_type_to_string(op->type));
+    return xnn_status_unsupported_hardware;
+  }
+
+  if (op->type != convolution_operator_type && op->type != fully_connected_operator_type) {
+    xnn_log_error("failed to fuse residual addition into operator: operator type mismatch (expected %s or %s, got %s)",
+      xnn_operator_type_to_string(convolution_operator_type),
+      xnn_operator_type_to_string(fully_connected_operator_type),
+      xnn_operator_type_to_string(op->type));
+    return xnn_status_invalid_parameter;
+  }
+
+  switch (op->ukernel.type) {
+    case xnn_ukernel_type_dconv:
+    case xnn_ukernel_type_gemm:
+    case xnn_ukernel_type_igemm:
+      break;
+    default:
+      xnn_log_error(
+        "failed to fuse residual addition into %s operator: "
+        "only GEMM-, IGEMM-, and direct convolution-based operators support fused residual",
+        xnn_operator_type_to_string(op->type));
+      return xnn_status_unsupported_parameter;
+  }
+
+  if (vadd->minmax.op_ukernel == NULL) {
+    xnn_log_error("failed to fuse residual addition into %s operator: addition micro-kernel is not available",
+      xnn_operator_type_to_string(op->type));
+    return xnn_status_unsupported_hardware;
+  }
+
+  op->residual_ukernel = vadd->minmax.op_ukernel;
+  memcpy(&op->residual_params, params, params_size);
+  op->residual = NULL;
+  op->residual_pixel_stride = 0;
+
+  op->state = xnn_run_state_invalid;
+
+  return xnn_status_success;
+}
+
+enum xnn_status xnn_fuse_residual_add_f16(
+    xnn_operator_t op,
+    float output_min,
+    float output_max)
+{
+  if (isnan(output_min)) {
+    xnn_log_error(
+      "failed to fuse residual addition into %s operator with NaN output lower bound: lower bound must be non-NaN",
+      xnn_operator_type_to_string(op->type));
+    return xnn_status_invalid_parameter;
+  }
+
+  if (isnan(output_max)) {
+    xnn_log_error(
+      "failed to fuse residual addition into %s operator with NaN output upper bound: upper bound must be non-NaN",
+      xnn_operator_type_to_string(op->type));
+    return xnn_status_invalid_parameter;
+  }
+
+  const uint16_t output_min_as_half = fp16_ieee_from_fp32_value(output_min);
+  const uint16_t output_max_as_half = fp16_ieee_from_fp32_value(output_max);
+  if (fp16_ieee_to_fp32_value(output_min_as_half) >= fp16_ieee_to_fp32_value(output_max_as_half)) {
+    xnn_log_error(
+      "failed to fuse residual addition into %s operator with [%.7g, %.7g] output range: lower bound must be below upper bound",
+      xnn_operator_type_to_string(op->type),
+      fp16_ieee_to_fp32_value(output_min_as_half), fp16_ieee_to_fp32_value(output_max_as_half));
+    return xnn_status_invalid_parameter;
+  }
+
+  union xnn_f16_minmax_params params;
+  if (xnn_params.f16.vadd.init.f16_minmax != NULL) {
+    xnn_params.f16.vadd.init.f16_minmax(&params, output_min_as_half, output_max_as_half);
+  }
+  return fuse_residual_add(
+    op,
+    xnn_operator_type_convolution_nhwc_f16,
+    xnn_operator_type_fully_connected_nc_f16,
+    &xnn_params.f16.vadd,
+    &params, sizeof(params),
+    XNN_INIT_FLAG_F16);
+}
+
+enum xnn_status xnn_fuse_residual_add_f32(
+    xnn_operator_t op,
+    float output_min,
+    float output_max)
+{
+  if (isnan(output_min)) {
+    xnn_log_error(
+      "failed to fuse residual addition into %s operator with NaN output lower bound: lower bound must be non-NaN",
+      xnn_operator_type_to_string(op->type));
+    return xnn_status_invalid_parameter;
+  }
+
+  if (isnan(output_max)) {
+    xnn_log_error(
+      "failed to fuse residual addition into %s operator with NaN output upper bound: upper bound must be non-NaN",
+      xnn_operator_type_to_string(op->type));
+    return xnn_status_invalid_parameter;
+  }
+
+  if (output_min >= output_max) {
+    xnn_log_error(
+      "failed to fuse residual addition into %s operator with [%.7g, %.7g] output range: lower bound must be below upper bound",
+      xnn_operator_type_to_string(op->type), output_min, output_max);
+    return xnn_status_invalid_parameter;
+  }
+
+  union xnn_f32_minmax_params params;
+  if (xnn_params.f32.vadd.init.f32_minmax != NULL) {
+    xnn_params.f32.vadd.init.f32_minmax(&params, output_min, output_max);
+  }
+  return fuse_residual_add(
+    op,
+    xnn_operator_type_convolution_nhwc_f32,
+    xnn_operator_type_fully_connected_nc_f32,
+    &xnn_params.f32.vadd,
+    &params, sizeof(params),
+    XNN_INIT_FLAG_F32);
+}
+
+static enum xnn_status validate_quantized_residual_add(
+    xnn_operator_t op,
+    float input_scale,
+    float residual_scale,
+    float output_scale)
+{
+  if (input_scale <= 0.0f || !isnormal(input_scale)) {
+    xnn_log_error(
+      "failed to fuse residual addition into %s operator with %.7g input scale: scale must be finite and positive",
+      xnn_operator_type_to_string(op->type), input_scale);
+    return xnn_status_invalid_parameter;
+  }
+
+  if (residual_scale <= 0.0f || !isnormal(residual_scale)) {
+    xnn_log_error(
+      "failed to fuse residual addition into %s operator with %.7g residual scale: scale must be finite and positive",
+      xnn_operator_type_to_string(op->type), residual_scale);
+    return xnn_status_invalid_parameter;
+  }
+
+  if (output_scale <= 0.0f || !isnormal(output_scale)) {
+    xnn_log_error(
+      "failed to fuse residual addition into %s operator with %.7g output scale: scale must be finite and positive",
+      xnn_operator_type_to_string(op->type), output_scale);
+    return xnn_status_invalid_parameter;
+  }
+
+  const float input_output_scale = input_scale / output_scale;
+  if (input_output_scale < 0x1.0p-10f || input_output_scale >= 0x1.0p+8f) {
+    xnn_log_error(
+      "failed to fuse residual addition into %s operator with %.7g input-to-output scale ratio: "
+      "scale ratio must be in [2**-10, 2**8) range",
+      xnn_operator_type_to_string(op->type), input_output_scale);
+    return xnn_status_unsupported_parameter;
+  }
+
+  const float residual_output_scale = residual_scale / output_scale;
+  if (residual_output_scale < 0x1.0p-10f || residual_output_scale >= 0x1.0p+8f) {
+    xnn_log_error(
+      "failed to fuse residual addition into %s operator with %.7g residual-to-output scale ratio: "
+      "scale ratio must be in [2**-10, 2**8) range",
+      xnn_operator_type_to_string(op->type), residual_output_scale);
+    return xnn_status_unsupported_parameter;
+  }
+
+  return xnn_status_success;
+}
+
+enum xnn_status xnn_fuse_residual_add_qs8(
+    xnn_operator_t op,
+    int8_t input_zero_point,
+    float input_scale,
+    int8_t residual_zero_point,
+    float residual_scale,
+    int8_t output_zero_point,
+    float output_scale,
+    int8_t output_min,
+    int8_t output_max)
+{
+  const enum xnn_status status = validate_quantized_residual_add(op, input_scale, residual_scale, output_scale);
+  if (status != xnn_status_success) {
+    return status;
+  }
+
+  if (output_min >= output_max) {
+    xnn_log_error(
+      "failed to fuse residual addition into %s operator with [%" PRId8 ", %" PRId8 "] output range: "
+      "lower bound must be below upper bound",
+      xnn_operator_type_to_string(op->type), output_min, output_max);
+    return xnn_status_invalid_parameter;
+  }
+
+  union xnn_qs8_addsub_minmax_params params;
+  if (xnn_params.qs8.vadd.init.qs8_addsub != NULL) {
+    xnn_params.qs8.vadd.init.qs8_addsub(
+      &params, input_zero_point, residual_zero_point, output_zero_point,
+      input_scale / output_scale, residual_scale / output_scale, output_min, output_max);
+  }
+  enum xnn_operator_type convolution_operator_type = xnn_operator_type_convolution_nhwc_qs8;
+  if (op->type == xnn_operator_type_convolution_nhwc_qc8) {
+    // Per-channel quantized convolution produces the same QS8 output as per-tensor quantized convolution.
+    convolution_operator_type = xnn_operator_type_convolution_nhwc_qc8;
+  }
+  return fuse_residual_add(
+    op,
+    convolution_operator_type,
+    xnn_operator_type_fully_connected_nc_qs8,
+    &xnn_params.qs8.vadd,
+    &params, sizeof(params),
+    XNN_INIT_FLAG_QS8);
+}
+
+enum xnn_status xnn_fuse_residual_add_qu8(
+    xnn_operator_t op,
+    uint8_t input_zero_point,
+    float input_scale,
+    uint8_t residual_zero_point,
+    float residual_scale,
+    uint8_t output_zero_point,
+    float output_scale,
+    uint8_t output_min,
+    uint8_t output_max)
+{
+  const enum xnn_status status = validate_quantized_residual_add(op, input_scale, residual_scale, output_scale);
+  if (status != xnn_status_success) {
+    return status;
+  }
+
+  if (output_min >= output_max) {
+    xnn_log_error(
+      "failed to fuse residual addition into %s operator with [%" PRIu8 ", %" PRIu8 "] output range: "
+      "lower bound must be below upper bound",
+      xnn_operator_type_to_string(op->type), output_min, output_max);
+    return xnn_status_invalid_parameter;
+  }
+
+  union xnn_qu8_addsub_minmax_params params;
+  if (xnn_params.qu8.vadd.init.qu8_addsub != NULL) {
+    xnn_params.qu8.vadd.init.qu8_addsub(
+      &params, input_zero_point, residual_zero_point, output_zero_point,
+      input_scale / output_scale, residual_scale / output_scale, output_min, output_max);
+  }
+  return fuse_residual_add(
+    op,
+    xnn_operator_type_convolution_nhwc_qu8,
+    xnn_operator_type_fully_connected_nc_qu8,
+    &xnn_params.qu8.vadd,
+    &params, sizeof(params),
+    XNN_INIT_FLAG_QU8);
+}
+
+enum xnn_status xnn_setup_residual_add(
+    xnn_operator_t op,
+    const void* residual,
+    size_t residual_stride)
+{
+  if (op->residual_ukernel == NULL) {
+    xnn_log_error("failed to setup residual addition in %s operator: residual addition was not fused into the operator",
+      xnn_operator_type_to_string(op->type));
+    return xnn_status_invalid_state;
+  }
+
+  if (residual == NULL) {
+    xnn_log_error("failed to setup residual addition in %s operator: residual tensor must be non-NULL",
+      xnn_operator_type_to_string(op->type));
+    return xnn_status_invalid_parameter;
+  }
+
+  const size_t output_channels = op->groups * op->group_output_channels;
+  if (residual_stride < output_channels) {
+    xnn_log_error(
+      "failed to setup residual addition in %s operator with residual element stride of %zu: "
+      "stride must be at least as large as the number of output channels (%zu)",
+      xnn_operator_type_to_string(op->type), residual_stride, output_channels);
+    return xnn_status_invalid_parameter;
+  }
+
+  op->residual = residual;
+  op->residual_pixel_stride = residual_stride;
+  op->state = xnn_run_state_invalid;
+
+  return xnn_status_success;
+}
@@ -19,6 +19,7 @@
 #include <xnnpack/math.h>
 #include <xnnpack/params.h>
 #include <xnnpack/indirection.h>
+#include <xnnpack/tiling.h>
 
 
 enum xnn_status xnn_create_resize_bilinear2d_nchw_f32(
@@ -151,7 +152,8 @@ enum xnn_status xnn_setup_resize_bilinear2d_nchw_f32(
     const size_t indirection_buffer_size = sizeof(void*) * (output_height * output_width * 4);
     const size_t packed_weights_size = sizeof(float) * (output_height * output_width * 2);
 
-    const void** indirection_buffer = (const void**) xnn_reallocate_memory(resize_op->indirection_buffer, indirection_buffer_size);
+    const void** indirection_buffer = (const void**) xnn_reallocate_tagged_memory(
+      xnn_memory_category_indirection, resize_op->indirection_buffer, indirection_buffer_size);
     if (indirection_buffer == NULL) {
       xnn_log_error(
         "failed to allocate %zu bytes for %s operator indirection buffer",
@@ -162,7 +164,8 @@ enum xnn_status xnn_setup_resize_bilinear2d_nchw_f32(
 
     // Note: packed weights must be SIMD-aligned, so we can't use xnn_reallocate_memory
     xnn_release_simd_memory(resize_op->packed_weights);
-    resize_op->packed_weights = xnn_allocate_simd_memory(packed_weights_size);
+    resize_op->packed_weights =
+      xnn_allocate_tagged_simd_memory(xnn_memory_category_packed_weights, packed_weights_size);
     if (resize_op->packed_weights == NULL) {
       xnn_log_error(
         "failed to allocate %zu bytes for %s operator packed weights",
@@ -207,23 +210,18 @@ enum xnn_status xnn_setup_resize_bilinear2d_nchw_f32(
     .ukernel = xnn_params.f32.ibilinear_chw.ukernel,
   };
 
+  // Every output pixel interpolates 4 input pixels.
   const size_t num_threads = pthreadpool_get_threads_count(threadpool);
-  size_t output_channel_tile = resize_op->channels;
-  if (num_threads > 1) {
-    const size_t target_tiles_per_thread = 4;
-    const size_t max_channel_tile = divide_round_up(output_channel_tile, num_threads * target_tiles_per_thread);
-    if (max_channel_tile < output_channel_tile) {
-      const uint32_t output_channel_subtile = xnn_params.f32.ibilinear_chw.channel_tile;
-      output_channel_tile =
-        min(output_channel_tile,
-          divide_round_up(output_channel_tile, max_channel_tile * output_channel_subtile) * output_channel_subtile);
-    }
-  }
+  const size_t output_elements = batch_size * resize_op->channels * output_height * output_width;
+  const size_t work = xnn_estimate_work((double) output_elements * 4, (double) output_elements * 5 * sizeof(float));
+  const size_t max_tiles = xnn_compute_max_tiles(work, num_threads);
   resize_op->compute.type = xnn_parallelization_type_2d_tile_1d;
   resize_op->compute.task_2d_tile_1d = (pthreadpool_task_2d_tile_1d_t) xnn_compute_resize_bilinear_chw;
   resize_op->compute.range[0] = batch_size;
   resize_op->compute.range[1] = resize_op->channels;
-  resize_op->compute.tile[0] = output_channel_tile;
+  resize_op->compute.tile[0] = xnn_compute_tile_size(
+    resize_op->channels, xnn_params.f32.ibilinear_chw.channel_tile, divide_round_up(max_tiles, batch_size));
+  resize_op->compute.num_threads = xnn_compute_num_useful_threads(work, num_threads);
   resize_op->state = xnn_run_state_ready;
 
   return xnn_status_success;
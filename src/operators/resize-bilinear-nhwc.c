@@ -19,6 +19,7 @@
 #include <xnnpack/math.h>
 #include <xnnpack/params.h>
 #include <xnnpack/indirection.h>
+#include <xnnpack/tiling.h>
 
 
 static enum xnn_status create_resize_bilinear2d_nhwc(
@@ -234,7 +235,8 @@ static enum xnn_status setup_resize_bilinear2d_nhwc(
     const size_t indirection_buffer_size = sizeof(void*) * (output_height * output_width * 4);
     const size_t packed_weights_size = (output_height * output_width * 2) << log2_weight_element_size;
 
-    const void** indirection_buffer = (const void**) xnn_reallocate_memory(resize_op->indirection_buffer, indirection_buffer_size);
+    const void** indirection_buffer = (const void**) xnn_reallocate_tagged_memory(
+      xnn_memory_category_indirection, resize_op->indirection_buffer, indirection_buffer_size);
     if (indirection_buffer == NULL) {
       xnn_log_error(
         "failed to allocate %zu bytes for %s operator indirection buffer",
@@ -245,7 +247,8 @@ static enum xnn_status setup_resize_bilinear2d_nhwc(
 
     // Note: packed weights must be SIMD-aligned, so we can't use xnn_reallocate_memory
     xnn_release_simd_memory(resize_op->packed_weights);
-    resize_op->packed_weights = xnn_allocate_simd_memory(packed_weights_size);
+    resize_op->packed_weights =
+      xnn_allocate_tagged_simd_memory(xnn_memory_category_packed_weights, packed_weights_size);
     if (resize_op->packed_weights == NULL) {
       xnn_log_error(
         "failed to allocate %zu bytes for %s operator packed weights",
@@ -290,23 +293,17 @@ static enum xnn_status setup_resize_bilinear2d_nhwc(
     .ukernel = ibilinear->ukernel,
   };
 
+  // Every output pixel interpolates 4 input pixels.
   const size_t output_size = output_height * output_width;
-  size_t output_size_tile = output_size;
-  if (num_threads > 1) {
-    const size_t target_tiles_per_thread = 5;
-    const size_t max_output_size_tile = divide_round_up(output_size, num_threads * target_tiles_per_thread);
-    if (max_output_size_tile < output_size_tile) {
-      const uint32_t output_size_subtile = ibilinear->pixel_tile;
-      output_size_tile =
-        min(output_size_tile,
-          divide_round_up(output_size_tile, max_output_size_tile * output_size_subtile) * output_size_subtile);
-    }
-  }
+  const size_t output_elements = batch_size * output_size * resize_op->channels;
+  const size_t work = xnn_estimate_work((double) output_elements * 4, (double) output_elements * (5 << log2_element_size));
+  const size_t max_tiles = xnn_compute_max_tiles(work, num_threads);
   resize_op->compute.type = xnn_parallelization_type_2d_tile_1d;
   resize_op->compute.task_2d_tile_1d = (pthreadpool_task_2d_tile_1d_t) xnn_compute_resize_bilinear;
   resize_op->compute.range[0] = batch_size;
   resize_op->compute.range[1] = output_size;
-  resize_op->compute.tile[0] = output_size_tile;
+  resize_op->compute.tile[0] = xnn_compute_tile_size(output_size, ibilinear->pixel_tile, divide_round_up(max_tiles, batch_size));
+  resize_op->compute.num_threads = xnn_compute_num_useful_threads(work, num_threads);
   resize_op->state = xnn_run_state_ready;
 
   return xnn_status_success;
@@ -103,7 +103,8 @@ enum xnn_status xnn_create_softmax_nc_qu8(
     goto error;
   }
 
-  softmax_op->lookup_table = xnn_allocate_simd_memory(256 * sizeof(uint32_t));
+  softmax_op->lookup_table = xnn_allocate_tagged_simd_memory(
+    xnn_memory_category_packed_weights, 256 * sizeof(uint32_t));
   if (softmax_op->lookup_table == NULL) {
     xnn_log_error(
       "failed to allocate 256 bytes for %s operator lookup table",
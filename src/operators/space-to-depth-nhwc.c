@@ -0,0 +1,253 @@
+// Copyright 2022 Google LLC
+//
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree.
+
+#include <inttypes.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include <xnnpack.h>
+#include <xnnpack/allocator.h>
+#include <xnnpack/compute.h>
+#include <xnnpack/log.h>
+#include <xnnpack/operator.h>
+#include <xnnpack/params.h>
+
+
+static enum xnn_status create_space_to_depth_nhwc(
+    size_t input_channels,
+    size_t input_channel_stride,
+    size_t output_channel_stride,
+    uint32_t block_size,
+    uint32_t flags,
+    enum xnn_operator_type operator_type,
+    xnn_operator_t* space_to_depth_op_out)
+{
+  xnn_operator_t space_to_depth_op = NULL;
+  enum xnn_status status = xnn_status_uninitialized;
+
+  if ((xnn_params.init_flags & XNN_INIT_FLAG_XNNPACK) == 0) {
+    xnn_log_error("failed to create %s operator: XNNPACK is not initialized",
+      xnn_operator_type_to_string(operator_type));
+    goto error;
+  }
+
+  status = xnn_status_invalid_parameter;
+
+  if (input_channels == 0) {
+    xnn_log_error("failed to create %s operator with %zu input channels: number of channels must be non-zero",
+      xnn_operator_type_to_string(operator_type), input_channels);
+    goto error;
+  }
+
+  if (input_channel_stride < input_channels) {
+    xnn_log_error(
+      "failed to create %s operator with input channel stride of %zu: "
+      "stride must be at least as large as the number of input channels (%zu)",
+      xnn_operator_type_to_string(operator_type), input_channel_stride, input_channels);
+    goto error;
+  }
+
+  if (block_size <= 1) {
+    xnn_log_error("failed to create %s operator with %" PRIu32 " block size: block size must be greater than 1",
+      xnn_operator_type_to_string(operator_type), block_size);
+    goto error;
+  }
+
+  const size_t output_channels = input_channels * block_size * block_size;
+  if (output_channel_stride < output_channels) {
+    xnn_log_error(
+      "failed to create %s operator with output channel stride of %zu: "
+      "stride must be at least as large as the number of output channels (%" PRIu32 "x%" PRIu32 "x%zu)",
+      xnn_operator_type_to_string(operator_type),
+      output_channel_stride, block_size, block_size, input_channels);
+    goto error;
+  }
+
+  status = xnn_status_out_of_memory;
+
+  space_to_depth_op = xnn_allocate_zero_simd_memory(sizeof(struct xnn_operator));
+  if (space_to_depth_op == NULL) {
+    xnn_log_error(
+      "failed to allocate %zu bytes for %s operator descriptor",
+      sizeof(struct xnn_operator), xnn_operator_type_to_string(operator_type));
+    goto error;
+  }
+
+  space_to_depth_op->channels = input_channels;
+  space_to_depth_op->input_pixel_stride = input_channel_stride;
+  space_to_depth_op->output_pixel_stride = output_channel_stride;
+  space_to_depth_op->block_size = block_size;
+
+  space_to_depth_op->type = operator_type;
+  space_to_depth_op->flags = flags;
+
+  space_to_depth_op->state = xnn_run_state_invalid;
+
+  *space_to_depth_op_out = space_to_depth_op;
+  return xnn_status_success;
+
+error:
+  xnn_delete_operator(space_to_depth_op);
+  return status;
+}
+
+enum xnn_status xnn_create_space_to_depth_nhwc_x8(
+    size_t input_channels,
+    size_t input_channel_stride,
+    size_t output_channel_stride,
+    uint32_t block_size,
+    uint32_t flags,
+    xnn_operator_t* space_to_depth_op_out)
+{
+  return create_space_to_depth_nhwc(
+    input_channels, input_channel_stride, output_channel_stride, block_size, flags,
+    xnn_operator_type_space_to_depth_nhwc_x8, space_to_depth_op_out);
+}
+
+enum xnn_status xnn_create_space_to_depth_nhwc_x16(
+    size_t input_channels,
+    size_t input_channel_stride,
+    size_t output_channel_stride,
+    uint32_t block_size,
+    uint32_t flags,
+    xnn_operator_t* space_to_depth_op_out)
+{
+  return create_space_to_depth_nhwc(
+    input_channels, input_channel_stride, output_channel_stride, block_size, flags,
+    xnn_operator_type_space_to_depth_nhwc_x16, space_to_depth_op_out);
+}
+
+enum xnn_status xnn_create_space_to_depth_nhwc_x32(
+    size_t input_channels,
+    size_t input_channel_stride,
+    size_t output_channel_stride,
+    uint32_t block_size,
+    uint32_t flags,
+    xnn_operator_t* space_to_depth_op_out)
+{
+  return create_space_to_depth_nhwc(
+    input_channels, input_channel_stride, output_channel_stride, block_size, flags,
+    xnn_operator_type_space_to_depth_nhwc_x32, space_to_depth_op_out);
+}
+
+static enum xnn_status setup_space_to_depth_nhwc(
+    xnn_operator_t space_to_depth_op,
+    enum xnn_operator_type expected_operator_type,
+    size_t batch_size,
+    size_t input_height,
+    size_t input_width,
+    const void* input,
+    void* output,
+    uint32_t log2_element_size)
+{
+  if (space_to_depth_op->type != expected_operator_type) {
+    xnn_log_error("failed to setup operator: operator type mismatch (expected %s, got %s)",
+      xnn_operator_type_to_string(expected_operator_type),
+      xnn_operator_type_to_string(space_to_depth_op->type));
+    return xnn_status_invalid_parameter;
+  }
+  space_to_depth_op->state = xnn_run_state_invalid;
+
+  if ((xnn_params.init_flags & XNN_INIT_FLAG_XNNPACK) == 0) {
+    xnn_log_error("failed to setup %s operator: XNNPACK is not initialized",
+      xnn_operator_type_to_string(space_to_depth_op->type));
+    return xnn_status_uninitialized;
+  }
+
+  if (input_width == 0 || input_height == 0) {
+    xnn_log_error("failed to setup %s operator with %zux%zu input: input dimensions must be non-zero",
+      xnn_operator_type_to_string(space_to_depth_op->type), input_width, input_height);
+    return xnn_status_invalid_parameter;
+  }
+
+  const uint32_t block_size = space_to_depth_op->block_size;
+  if (input_width % block_size != 0 || input_height % block_size != 0) {
+    xnn_log_error(
+      "failed to setup %s operator with %zux%zu input: input dimensions must be divisible by the block size (%" PRIu32 ")",
+      xnn_operator_type_to_string(space_to_depth_op->type), input_width, input_height, block_size);
+    return xnn_status_invalid_parameter;
+  }
+
+  if (batch_size == 0) {
+    space_to_depth_op->state = xnn_run_state_skip;
+    return xnn_status_success;
+  }
+
+  const size_t input_channels = space_to_depth_op->channels;
+  const size_t output_width = input_width / block_size;
+  const size_t input_width_stride = space_to_depth_op->input_pixel_stride << log2_element_size;
+  const size_t output_width_stride = space_to_depth_op->output_pixel_stride << log2_element_size;
+  const size_t pixel_size = input_channels << log2_element_size;
+  // When input pixels are contiguous, the block_size pixels of a block row are copied into an output pixel at once.
+  const bool contiguous_input = space_to_depth_op->input_pixel_stride == input_channels;
+
+  space_to_depth_op->context.spacetodepth2d_hwc = (struct spacetodepth2d_hwc_context) {
+    .elements = contiguous_input ? block_size * pixel_size : pixel_size,
+    .block_size = (size_t) block_size,
+    .output_width = output_width,
+    .input = input,
+    .output = output,
+    .input_height_stride = input_width * input_width_stride,
+    .input_width_stride = input_width_stride,
+    .input_block_stride = block_size * input_width_stride,
+    .output_height_stride = output_width * output_width_stride,
+    .output_width_stride = output_width_stride,
+    .output_block_row_offset = block_size * pixel_size,
+    .ukernel = xnn_params.xx.pad.ukernel,
+  };
+  space_to_depth_op->compute.type = xnn_parallelization_type_2d;
+  space_to_depth_op->compute.task_2d = (pthreadpool_task_2d_t) xnn_compute_spacetodepth2d_hwc;
+  space_to_depth_op->compute.range[0] = batch_size * input_height;
+  space_to_depth_op->compute.range[1] = contiguous_input ? 1 : block_size;
+  space_to_depth_op->state = xnn_run_state_ready;
+
+  return xnn_status_success;
+}
+
+enum xnn_status xnn_setup_space_to_depth_nhwc_x8(
+    xnn_operator_t space_to_depth_op,
+    size_t batch_size,
+    size_t input_height,
+    size_t input_width,
+    const void* input,
+    void* output,
+    pthreadpool_t threadpool)
+{
+  return setup_space_to_depth_nhwc(
+    space_to_depth_op, xnn_operator_type_space_to_depth_nhwc_x8,
+    batch_size, input_height, input_width,
+    input, output, 0 /* log2(element size) */);
+}
+
+enum xnn_status xnn_setup_space_to_depth_nhwc_x16(
+    xnn_operator_t space_to_depth_op,
+    size_t batch_size,
+    size_t input_height,
+    size_t input_width,
+    const void* input,
+    void* output,
+    pthreadpool_t threadpool)
+{
+  return setup_space_to_depth_nhwc(
+    space_to_depth_op, xnn_operator_type_space_to_depth_nhwc_x16,
+    batch_size, input_height, input_width,
+    input, output, 1 /* log2(element size) */);
+}
+
+enum xnn_status xnn_setup_space_to_depth_nhwc_x32(
+    xnn_operator_t space_to_depth_op,
+    size_t batch_size,
+    size_t input_height,
+    size_t input_width,
+    const void* input,
+    void* output,
+    pthreadpool_t threadpool)
+{
+  return setup_space_to_depth_nhwc(
+    space_to_depth_op, xnn_operator_type_space_to_depth_nhwc_x32,
+    batch_size, input_height, input_width,
+    input, output, 2 /* log2(element size) */);
+}
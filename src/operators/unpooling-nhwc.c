@@ -193,7 +193,8 @@ enum xnn_status xnn_setup_unpooling2d_nhwc_x32(
   const size_t pooling_size = pooling_height * pooling_width;
 
   const size_t indirection_buffer_size = sizeof(void*) * (batch_size * input_height * input_width * pooling_size);
-  const void** indirection_buffer = (const void**) xnn_reallocate_memory(unpooling_op->indirection_buffer, indirection_buffer_size);
+  const void** indirection_buffer = (const void**) xnn_reallocate_tagged_memory(
+    xnn_memory_category_indirection, unpooling_op->indirection_buffer, indirection_buffer_size);
   if (indirection_buffer == NULL) {
     xnn_log_error(
       "failed to allocate %zu bytes for %s operator indirection buffer",
@@ -0,0 +1,130 @@
+// Copyright 2022 Google LLC
+//
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree.
+
+#include <inttypes.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include <xnnpack.h>
+#include <xnnpack/allocator.h>
+#include <xnnpack/log.h>
+#include <xnnpack/operator.h>
+#include <xnnpack/params.h>
+
+
+// Version of the packed weights layouts. Must be incremented on any change in the packing functions.
+#define XNN_PACKED_WEIGHTS_VERSION 1
+
+// 64-bit FNV-1a hash.
+static uint64_t hash_bytes(uint64_t hash, const void* data, size_t size)
+{
+  const uint8_t* bytes = (const uint8_t*) data;
+  for (size_t i = 0; i < size; i++) {
+    hash ^= (uint64_t) bytes[i];
+    hash *= UINT64_C(0x100000001B3);
+  }
+  return hash;
+}
+
+static uint64_t hash_value(uint64_t hash, uint64_t value)
+{
+  // Hash a fixed-width little-endian representation, independent of the size of size_t and of the byte order.
+  for (size_t i = 0; i < sizeof(value); i++) {
+    hash ^= (value >> (i * 8)) & UINT64_C(0xFF);
+    hash *= UINT64_C(0x100000001B3);
+  }
+  return hash;
+}
+
+uint64_t xnn_compute_packed_weights_fingerprint(
+  const size_t* layout,
+  size_t layout_size,
+  const void* packing_params,
+  size_t packing_params_size)
+{
+  uint64_t hash = UINT64_C(0xCBF29CE484222325);
+  hash = hash_value(hash, XNN_PACKED_WEIGHTS_VERSION);
+  hash = hash_value(hash, layout_size);
+  for (size_t i = 0; i < layout_size; i++) {
+    hash = hash_value(hash, (uint64_t) layout[i]);
+  }
+  if (packing_params != NULL) {
+    hash = hash_bytes(hash, packing_params, packing_params_size);
+  }
+  return hash;
+}
+
+enum xnn_status xnn_init_packed_weights(
+  xnn_operator_t op,
+  struct xnn_packed_weights_buffer* packed_weights_buffer,
+  size_t size,
+  uint64_t fingerprint,
+  uint32_t flags,
+  enum xnn_operator_type operator_type,
+  bool* pack_out)
+{
+  *pack_out = false;
+  if (packed_weights_buffer == NULL) {
+    op->packed_weights = (flags & XNN_FLAG_HUGE_PAGES) ?
+      xnn_allocate_huge_simd_memory(xnn_memory_category_packed_weights, size) :
+      xnn_allocate_tagged_simd_memory(xnn_memory_category_packed_weights, size);
+    if (op->packed_weights == NULL) {
+      xnn_log_error(
+        "failed to allocate %zu bytes for %s operator packed weights",
+        size, xnn_operator_type_to_string(operator_type));
+      return xnn_status_out_of_memory;
+    }
+    *pack_out = true;
+    return xnn_status_success;
+  }
+
+  if (packed_weights_buffer->prepacked) {
+    if (packed_weights_buffer->fingerprint != fingerprint) {
+      xnn_log_error(
+        "failed to create %s operator with packed weights fingerprint %016" PRIx64 ": "
+        "weights were packed for a different configuration or processor (expected fingerprint %016" PRIx64 ")",
+        xnn_operator_type_to_string(operator_type), packed_weights_buffer->fingerprint, fingerprint);
+      return xnn_status_unsupported_parameter;
+    }
+    if (packed_weights_buffer->size != size) {
+      xnn_log_error(
+        "failed to create %s operator with %zu bytes of packed weights: expected %zu bytes",
+        xnn_operator_type_to_string(operator_type), packed_weights_buffer->size, size);
+      return xnn_status_invalid_parameter;
+    }
+  } else {
+    const size_t capacity = packed_weights_buffer->size;
+    packed_weights_buffer->size = size;
+    packed_weights_buffer->fingerprint = fingerprint;
+    if (packed_weights_buffer->data == NULL) {
+      // Only the size and fingerprint of the packed weights are requested.
+      return xnn_status_success;
+    }
+    if (capacity < size) {
+      xnn_log_error(
+        "failed to pack %s operator weights into %zu bytes: packed weights take %zu bytes",
+        xnn_operator_type_to_string(operator_type), capacity, size);
+      return xnn_status_invalid_parameter;
+    }
+  }
+
+  if (packed_weights_buffer->data == NULL) {
+    xnn_log_error(
+      "failed to create %s operator with NULL packed weights", xnn_operator_type_to_string(operator_type));
+    return xnn_status_invalid_parameter;
+  }
+  if ((uintptr_t) packed_weights_buffer->data % XNN_PACKED_WEIGHTS_ALIGNMENT != 0) {
+    xnn_log_error(
+      "failed to use packed weights at %p for %s operator: packed weights must be aligned to %d bytes",
+      packed_weights_buffer->data, xnn_operator_type_to_string(operator_type), XNN_PACKED_WEIGHTS_ALIGNMENT);
+    return xnn_status_invalid_parameter;
+  }
+
+  op->packed_weights = packed_weights_buffer->data;
+  op->external_packed_weights = true;
+  *pack_out = !packed_weights_buffer->prepacked;
+  return xnn_status_success;
+}
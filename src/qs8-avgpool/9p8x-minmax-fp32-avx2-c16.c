@@ -0,0 +1,389 @@
+// Copyright 2022 Google LLC
+//
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree.
+
+#include <assert.h>
+
+#include <immintrin.h>
+
+#include <xnnpack/avgpool.h>
+
+
+void xnn_qs8_avgpool_minmax_fp32_ukernel_9p8x__avx2_c16(
+    size_t output_pixels,
+    size_t kernel_elements,
+    size_t channels,
+    const int8_t** input,
+    size_t input_offset,
+    const int8_t* zero,
+    int32_t* buffer,
+    int8_t* output,
+    size_t input_increment,
+    size_t output_increment,
+    const union xnn_qs8_avgpool_minmax_params params[restrict XNN_MIN_ELEMENTS(1)]) XNN_OOB_READS
+{
+  assert(output_pixels != 0);
+  assert(kernel_elements > 9);
+  assert(channels != 0);
+
+  const __m256i vinit_bias = _mm256_load_si256((const __m256i*) params->fp32_avx2.init_bias);
+  const __m256 vscale = _mm256_load_ps(params->fp32_avx2.scale);
+  const __m256 voutput_max_less_zero_point = _mm256_load_ps(params->fp32_avx2.output_max_less_zero_point);
+  const __m256i voutput_zero_point = _mm256_load_si256((const __m256i*) params->fp32_avx2.output_zero_point);
+  const __m128i voutput_min = _mm_load_si128((const __m128i*) params->fp32_avx2.output_min);
+  do {
+    // First pass.
+    {
+      const int8_t* i0 = *input++;
+      assert(i0 != NULL);
+      if XNN_UNPREDICTABLE(i0 != zero) {
+        i0 = (const int8_t*) ((uintptr_t) i0 + input_offset);
+      }
+      const int8_t* i1 = *input++;
+      assert(i1 != NULL);
+      if XNN_UNPREDICTABLE(i1 != zero) {
+        i1 = (const int8_t*) ((uintptr_t) i1 + input_offset);
+      }
+      const int8_t* i2 = *input++;
+      assert(i2 != NULL);
+      if XNN_UNPREDICTABLE(i2 != zero) {
+        i2 = (const int8_t*) ((uintptr_t) i2 + input_offset);
+      }
+      const int8_t* i3 = *input++;
+      assert(i3 != NULL);
+      if XNN_UNPREDICTABLE(i3 != zero) {
+        i3 = (const int8_t*) ((uintptr_t) i3 + input_offset);
+      }
+      const int8_t* i4 = *input++;
+      assert(i4 != NULL);
+      if XNN_UNPREDICTABLE(i4 != zero) {
+        i4 = (const int8_t*) ((uintptr_t) i4 + input_offset);
+      }
+      const int8_t* i5 = *input++;
+      assert(i5 != NULL);
+      if XNN_UNPREDICTABLE(i5 != zero) {
+        i5 = (const int8_t*) ((uintptr_t) i5 + input_offset);
+      }
+      const int8_t* i6 = *input++;
+      assert(i6 != NULL);
+      if XNN_UNPREDICTABLE(i6 != zero) {
+        i6 = (const int8_t*) ((uintptr_t) i6 + input_offset);
+      }
+      const int8_t* i7 = *input++;
+      assert(i7 != NULL);
+      if XNN_UNPREDICTABLE(i7 != zero) {
+        i7 = (const int8_t*) ((uintptr_t) i7 + input_offset);
+      }
+      const int8_t* i8 = *input++;
+      assert(i8 != NULL);
+      if XNN_UNPREDICTABLE(i8 != zero) {
+        i8 = (const int8_t*) ((uintptr_t) i8 + input_offset);
+      }
+
+      int32_t* b = buffer;
+      for (size_t c = 0; c < channels; c += 16) {
+        const __m256i vxi0 = _mm256_cvtepi8_epi16(_mm_loadu_si128((const __m128i*) i0));
+        i0 += 16;
+        const __m256i vxi1 = _mm256_cvtepi8_epi16(_mm_loadu_si128((const __m128i*) i1));
+        i1 += 16;
+        const __m256i vxi2 = _mm256_cvtepi8_epi16(_mm_loadu_si128((const __m128i*) i2));
+        i2 += 16;
+        const __m256i vxi3 = _mm256_cvtepi8_epi16(_mm_loadu_si128((const __m128i*) i3));
+        i3 += 16;
+        const __m256i vxi4 = _mm256_cvtepi8_epi16(_mm_loadu_si128((const __m128i*) i4));
+        i4 += 16;
+        const __m256i vxi5 = _mm256_cvtepi8_epi16(_mm_loadu_si128((const __m128i*) i5));
+        i5 += 16;
+        const __m256i vxi6 = _mm256_cvtepi8_epi16(_mm_loadu_si128((const __m128i*) i6));
+        i6 += 16;
+        const __m256i vxi7 = _mm256_cvtepi8_epi16(_mm_loadu_si128((const __m128i*) i7));
+        i7 += 16;
+        const __m256i vxi8 = _mm256_cvtepi8_epi16(_mm_loadu_si128((const __m128i*) i8));
+        i8 += 16;
+
+        __m256i vsum = _mm256_add_epi16(vxi0, vxi1);
+        vsum = _mm256_add_epi16(vsum, vxi2);
+        vsum = _mm256_add_epi16(vsum, vxi3);
+        vsum = _mm256_add_epi16(vsum, vxi4);
+        vsum = _mm256_add_epi16(vsum, vxi5);
+        vsum = _mm256_add_epi16(vsum, vxi6);
+        vsum = _mm256_add_epi16(vsum, vxi7);
+        vsum = _mm256_add_epi16(vsum, vxi8);
+
+        __m256i vacc01234567 = _mm256_cvtepi16_epi32(_mm256_castsi256_si128(vsum));
+        __m256i vacc89ABCDEF = _mm256_cvtepi16_epi32(_mm256_extracti128_si256(vsum, 1));
+        vacc01234567 = _mm256_add_epi32(vacc01234567, vinit_bias);
+        vacc89ABCDEF = _mm256_add_epi32(vacc89ABCDEF, vinit_bias);
+
+        _mm256_store_si256((__m256i*) b, vacc01234567);
+        _mm256_store_si256((__m256i*) (b + 8), vacc89ABCDEF);
+        b += 16;
+      }
+    }
+
+    size_t k = kernel_elements;
+    // Intermediate passes.
+    for (k -= 9; k > 8; k -= 8) {
+      const int8_t* i0 = *input++;
+      assert(i0 != NULL);
+      if XNN_UNPREDICTABLE(i0 != zero) {
+        i0 = (const int8_t*) ((uintptr_t) i0 + input_offset);
+      }
+      const int8_t* i1 = *input++;
+      assert(i1 != NULL);
+      if XNN_UNPREDICTABLE(i1 != zero) {
+        i1 = (const int8_t*) ((uintptr_t) i1 + input_offset);
+      }
+      const int8_t* i2 = *input++;
+      assert(i2 != NULL);
+      if XNN_UNPREDICTABLE(i2 != zero) {
+        i2 = (const int8_t*) ((uintptr_t) i2 + input_offset);
+      }
+      const int8_t* i3 = *input++;
+      assert(i3 != NULL);
+      if XNN_UNPREDICTABLE(i3 != zero) {
+        i3 = (const int8_t*) ((uintptr_t) i3 + input_offset);
+      }
+      const int8_t* i4 = *input++;
+      assert(i4 != NULL);
+      if XNN_UNPREDICTABLE(i4 != zero) {
+        i4 = (const int8_t*) ((uintptr_t) i4 + input_offset);
+      }
+      const int8_t* i5 = *input++;
+      assert(i5 != NULL);
+      if XNN_UNPREDICTABLE(i5 != zero) {
+        i5 = (const int8_t*) ((uintptr_t) i5 + input_offset);
+      }
+      const int8_t* i6 = *input++;
+      assert(i6 != NULL);
+      if XNN_UNPREDICTABLE(i6 != zero) {
+        i6 = (const int8_t*) ((uintptr_t) i6 + input_offset);
+      }
+      const int8_t* i7 = *input++;
+      assert(i7 != NULL);
+      if XNN_UNPREDICTABLE(i7 != zero) {
+        i7 = (const int8_t*) ((uintptr_t) i7 + input_offset);
+      }
+
+      int32_t* b = buffer;
+      for (size_t c = 0; c < channels; c += 16) {
+        const __m256i vxi0 = _mm256_cvtepi8_epi16(_mm_loadu_si128((const __m128i*) i0));
+        i0 += 16;
+        const __m256i vxi1 = _mm256_cvtepi8_epi16(_mm_loadu_si128((const __m128i*) i1));
+        i1 += 16;
+        const __m256i vxi2 = _mm256_cvtepi8_epi16(_mm_loadu_si128((const __m128i*) i2));
+        i2 += 16;
+        const __m256i vxi3 = _mm256_cvtepi8_epi16(_mm_loadu_si128((const __m128i*) i3));
+        i3 += 16;
+        const __m256i vxi4 = _mm256_cvtepi8_epi16(_mm_loadu_si128((const __m128i*) i4));
+        i4 += 16;
+        const __m256i vxi5 = _mm256_cvtepi8_epi16(_mm_loadu_si128((const __m128i*) i5));
+        i5 += 16;
+        const __m256i vxi6 = _mm256_cvtepi8_epi16(_mm_loadu_si128((const __m128i*) i6));
+        i6 += 16;
+        const __m256i vxi7 = _mm256_cvtepi8_epi16(_mm_loadu_si128((const __m128i*) i7));
+        i7 += 16;
+
+        __m256i vsum = _mm256_add_epi16(vxi0, vxi1);
+        vsum = _mm256_add_epi16(vsum, vxi2);
+        vsum = _mm256_add_epi16(vsum, vxi3);
+        vsum = _mm256_add_epi16(vsum, vxi4);
+        vsum = _mm256_add_epi16(vsum, vxi5);
+        vsum = _mm256_add_epi16(vsum, vxi6);
+        vsum = _mm256_add_epi16(vsum, vxi7);
+
+        __m256i vacc01234567 = _mm256_cvtepi16_epi32(_mm256_castsi256_si128(vsum));
+        __m256i vacc89ABCDEF = _mm256_cvtepi16_epi32(_mm256_extracti128_si256(vsum, 1));
+        vacc01234567 = _mm256_add_epi32(vacc01234567, _mm256_load_si256((const __m256i*) b));
+        vacc89ABCDEF = _mm256_add_epi32(vacc89ABCDEF, _mm256_load_si256((const __m256i*) (b + 8)));
+
+        _mm256_store_si256((__m256i*) b, vacc01234567);
+        _mm256_store_si256((__m256i*) (b + 8), vacc89ABCDEF);
+        b += 16;
+      }
+    }
+
+    // Last pass.
+    {
+      const int8_t* i0 = input[0];
+      assert(i0 != NULL);
+      const int8_t* i1 = input[1];
+      const int8_t* i2 = input[2];
+      const int8_t* i3 = input[3];
+      const int8_t* i4 = input[4];
+      const int8_t* i5 = input[5];
+      const int8_t* i6 = input[6];
+      const int8_t* i7 = input[7];
+      input = (const int8_t**) ((uintptr_t) input + input_increment);
+      if (k < 2) {
+        i1 = zero;
+      }
+      assert(i1 != NULL);
+      if (k <= 2) {
+        i2 = zero;
+      }
+      assert(i2 != NULL);
+      if (k < 4) {
+        i3 = zero;
+      }
+      assert(i3 != NULL);
+      if (k <= 4) {
+        i4 = zero;
+      }
+      assert(i4 != NULL);
+      if (k < 6) {
+        i5 = zero;
+      }
+      assert(i5 != NULL);
+      if (k <= 6) {
+        i6 = zero;
+      }
+      assert(i6 != NULL);
+      if (k < 8) {
+        i7 = zero;
+      }
+      assert(i7 != NULL);
+      if XNN_UNPREDICTABLE(i0 != zero) {
+        i0 = (const int8_t*) ((uintptr_t) i0 + input_offset);
+      }
+      if XNN_UNPREDICTABLE(i1 != zero) {
+        i1 = (const int8_t*) ((uintptr_t) i1 + input_offset);
+      }
+      if XNN_UNPREDICTABLE(i2 != zero) {
+        i2 = (const int8_t*) ((uintptr_t) i2 + input_offset);
+      }
+      if XNN_UNPREDICTABLE(i3 != zero) {
+        i3 = (const int8_t*) ((uintptr_t) i3 + input_offset);
+      }
+      if XNN_UNPREDICTABLE(i4 != zero) {
+        i4 = (const int8_t*) ((uintptr_t) i4 + input_offset);
+      }
+      if XNN_UNPREDICTABLE(i5 != zero) {
+        i5 = (const int8_t*) ((uintptr_t) i5 + input_offset);
+      }
+      if XNN_UNPREDICTABLE(i6 != zero) {
+        i6 = (const int8_t*) ((uintptr_t) i6 + input_offset);
+      }
+      if XNN_UNPREDICTABLE(i7 != zero) {
+        i7 = (const int8_t*) ((uintptr_t) i7 + input_offset);
+      }
+
+      int32_t* b = buffer;
+      size_t c = channels;
+      for (; c >= 16; c -= 16) {
+        const __m256i vxi0 = _mm256_cvtepi8_epi16(_mm_loadu_si128((const __m128i*) i0));
+        i0 += 16;
+        const __m256i vxi1 = _mm256_cvtepi8_epi16(_mm_loadu_si128((const __m128i*) i1));
+        i1 += 16;
+        const __m256i vxi2 = _mm256_cvtepi8_epi16(_mm_loadu_si128((const __m128i*) i2));
+        i2 += 16;
+        const __m256i vxi3 = _mm256_cvtepi8_epi16(_mm_loadu_si128((const __m128i*) i3));
+        i3 += 16;
+        const __m256i vxi4 = _mm256_cvtepi8_epi16(_mm_loadu_si128((const __m128i*) i4));
+        i4 += 16;
+        const __m256i vxi5 = _mm256_cvtepi8_epi16(_mm_loadu_si128((const __m128i*) i5));
+        i5 += 16;
+        const __m256i vxi6 = _mm256_cvtepi8_epi16(_mm_loadu_si128((const __m128i*) i6));
+        i6 += 16;
+        const __m256i vxi7 = _mm256_cvtepi8_epi16(_mm_loadu_si128((const __m128i*) i7));
+        i7 += 16;
+
+        __m256i vsum = _mm256_add_epi16(vxi0, vxi1);
+        vsum = _mm256_add_epi16(vsum, vxi2);
+        vsum = _mm256_add_epi16(vsum, vxi3);
+        vsum = _mm256_add_epi16(vsum, vxi4);
+        vsum = _mm256_add_epi16(vsum, vxi5);
+        vsum = _mm256_add_epi16(vsum, vxi6);
+        vsum = _mm256_add_epi16(vsum, vxi7);
+
+        __m256i vacc01234567 = _mm256_cvtepi16_epi32(_mm256_castsi256_si128(vsum));
+        __m256i vacc89ABCDEF = _mm256_cvtepi16_epi32(_mm256_extracti128_si256(vsum, 1));
+        vacc01234567 = _mm256_add_epi32(vacc01234567, _mm256_load_si256((const __m256i*) b));
+        vacc89ABCDEF = _mm256_add_epi32(vacc89ABCDEF, _mm256_load_si256((const __m256i*) (b + 8)));
+        b += 16;
+
+        __m256 vfpacc01234567 = _mm256_cvtepi32_ps(vacc01234567);
+        __m256 vfpacc89ABCDEF = _mm256_cvtepi32_ps(vacc89ABCDEF);
+
+        vfpacc01234567 = _mm256_mul_ps(vfpacc01234567, vscale);
+        vfpacc89ABCDEF = _mm256_mul_ps(vfpacc89ABCDEF, vscale);
+
+        vfpacc01234567 = _mm256_min_ps(vfpacc01234567, voutput_max_less_zero_point);
+        vfpacc89ABCDEF = _mm256_min_ps(vfpacc89ABCDEF, voutput_max_less_zero_point);
+
+        vacc01234567 = _mm256_cvtps_epi32(vfpacc01234567);
+        vacc89ABCDEF = _mm256_cvtps_epi32(vfpacc89ABCDEF);
+
+        const __m256i vout012389AB4567CDEF = _mm256_adds_epi16(_mm256_packs_epi32(vacc01234567, vacc89ABCDEF), voutput_zero_point);
+
+        __m128i vout0123456789ABCDEF = _mm_shuffle_epi32(_mm_packs_epi16(_mm256_castsi256_si128(vout012389AB4567CDEF), _mm256_extracti128_si256(vout012389AB4567CDEF, 1)), _MM_SHUFFLE(3, 1, 2, 0));
+        vout0123456789ABCDEF = _mm_max_epi8(vout0123456789ABCDEF, voutput_min);
+
+        _mm_storeu_si128((__m128i*) output, vout0123456789ABCDEF);
+        output += 16;
+      }
+      if (c != 0) {
+        const __m256i vxi0 = _mm256_cvtepi8_epi16(_mm_loadu_si128((const __m128i*) i0));
+        const __m256i vxi1 = _mm256_cvtepi8_epi16(_mm_loadu_si128((const __m128i*) i1));
+        const __m256i vxi2 = _mm256_cvtepi8_epi16(_mm_loadu_si128((const __m128i*) i2));
+        const __m256i vxi3 = _mm256_cvtepi8_epi16(_mm_loadu_si128((const __m128i*) i3));
+        const __m256i vxi4 = _mm256_cvtepi8_epi16(_mm_loadu_si128((const __m128i*) i4));
+        const __m256i vxi5 = _mm256_cvtepi8_epi16(_mm_loadu_si128((const __m128i*) i5));
+        const __m256i vxi6 = _mm256_cvtepi8_epi16(_mm_loadu_si128((const __m128i*) i6));
+        const __m256i vxi7 = _mm256_cvtepi8_epi16(_mm_loadu_si128((const __m128i*) i7));
+
+        __m256i vsum = _mm256_add_epi16(vxi0, vxi1);
+        vsum = _mm256_add_epi16(vsum, vxi2);
+        vsum = _mm256_add_epi16(vsum, vxi3);
+        vsum = _mm256_add_epi16(vsum, vxi4);
+        vsum = _mm256_add_epi16(vsum, vxi5);
+        vsum = _mm256_add_epi16(vsum, vxi6);
+        vsum = _mm256_add_epi16(vsum, vxi7);
+
+        __m256i vacc01234567 = _mm256_cvtepi16_epi32(_mm256_castsi256_si128(vsum));
+        __m256i vacc89ABCDEF = _mm256_cvtepi16_epi32(_mm256_extracti128_si256(vsum, 1));
+        vacc01234567 = _mm256_add_epi32(vacc01234567, _mm256_load_si256((const __m256i*) b));
+        vacc89ABCDEF = _mm256_add_epi32(vacc89ABCDEF, _mm256_load_si256((const __m256i*) (b + 8)));
+
+        __m256 vfpacc01234567 = _mm256_cvtepi32_ps(vacc01234567);
+        __m256 vfpacc89ABCDEF = _mm256_cvtepi32_ps(vacc89ABCDEF);
+
+        vfpacc01234567 = _mm256_mul_ps(vfpacc01234567, vscale);
+        vfpacc89ABCDEF = _mm256_mul_ps(vfpacc89ABCDEF, vscale);
+
+        vfpacc01234567 = _mm256_min_ps(vfpacc01234567, voutput_max_less_zero_point);
+        vfpacc89ABCDEF = _mm256_min_ps(vfpacc89ABCDEF, voutput_max_less_zero_point);
+
+        vacc01234567 = _mm256_cvtps_epi32(vfpacc01234567);
+        vacc89ABCDEF = _mm256_cvtps_epi32(vfpacc89ABCDEF);
+
+        const __m256i vout012389AB4567CDEF = _mm256_adds_epi16(_mm256_packs_epi32(vacc01234567, vacc89ABCDEF), voutput_zero_point);
+
+        __m128i vout0123456789ABCDEF = _mm_shuffle_epi32(_mm_packs_epi16(_mm256_castsi256_si128(vout012389AB4567CDEF), _mm256_extracti128_si256(vout012389AB4567CDEF, 1)), _MM_SHUFFLE(3, 1, 2, 0));
+        vout0123456789ABCDEF = _mm_max_epi8(vout0123456789ABCDEF, voutput_min);
+
+        if (c & 8) {
+          _mm_storel_epi64((__m128i*) output, vout0123456789ABCDEF);
+          vout0123456789ABCDEF = _mm_unpackhi_epi64(vout0123456789ABCDEF, vout0123456789ABCDEF);
+          output += 8;
+        }
+        if (c & 4) {
+          *((uint32_t*) output) = (uint32_t) _mm_cvtsi128_si32(vout0123456789ABCDEF);
+          vout0123456789ABCDEF = _mm_srli_epi64(vout0123456789ABCDEF, 32);
+          output += 4;
+        }
+        if (c & 2) {
+          *((uint16_t*) output) = (uint16_t) _mm_extract_epi16(vout0123456789ABCDEF, 0);
+          vout0123456789ABCDEF = _mm_srli_epi32(vout0123456789ABCDEF, 16);
+          output += 2;
+        }
+        if (c & 1) {
+          *output = (int8_t) _mm_extract_epi8(vout0123456789ABCDEF, 0);
+          output += 1;
+        }
+      }
+    }
+    output = (int8_t*) ((uintptr_t) output + output_increment);
+  } while (--output_pixels != 0);
+}
@@ -0,0 +1,212 @@
+// Copyright 2022 Google LLC
+//
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree.
+
+#include <assert.h>
+
+#include <arm_neon.h>
+
+#include <xnnpack/avgpool.h>
+
+
+void xnn_qs8_avgpool_minmax_rndnu_ukernel_9x__neon_c8(
+    size_t output_pixels,
+    size_t kernel_elements,
+    size_t channels,
+    const int8_t** input,
+    size_t input_offset,
+    const int8_t* zero,
+    int8_t* output,
+    size_t input_increment,
+    size_t output_increment,
+    const union xnn_qs8_avgpool_minmax_params params[restrict XNN_MIN_ELEMENTS(1)]) XNN_OOB_READS
+{
+  assert(output_pixels != 0);
+  assert(kernel_elements != 0);
+  assert(kernel_elements <= 9);
+  assert(channels != 0);
+
+  const int32x4_t vinit_bias = vld1q_dup_s32(&params->rndnu_neon.init_bias);
+  const int32x4_t vleft_pre_shift = vld1q_dup_s32(&params->rndnu_neon.left_pre_shift);
+  const int32x4_t vmultiplier = vld1q_dup_s32(&params->rndnu_neon.multiplier);
+  const int32x4_t vleft_post_shift = vld1q_dup_s32(&params->rndnu_neon.left_post_shift);
+  const int16x8_t voutput_zero_point = vld1q_dup_s16(&params->rndnu_neon.output_zero_point);
+  const int8x8_t voutput_min = vld1_dup_s8(&params->rndnu_neon.output_min);
+  const int8x8_t voutput_max = vld1_dup_s8(&params->rndnu_neon.output_max);
+  do {
+    const int8_t* i0 = input[0];
+    assert(i0 != NULL);
+    const int8_t* i1 = input[1];
+    const int8_t* i2 = input[2];
+    const int8_t* i3 = input[3];
+    const int8_t* i4 = input[4];
+    const int8_t* i5 = input[5];
+    const int8_t* i6 = input[6];
+    const int8_t* i7 = input[7];
+    const int8_t* i8 = input[8];
+    input = (const int8_t**) ((uintptr_t) input + input_increment);
+    if (kernel_elements < 2) {
+      i1 = zero;
+    }
+    assert(i1 != NULL);
+    if (kernel_elements <= 2) {
+      i2 = zero;
+    }
+    assert(i2 != NULL);
+    if (kernel_elements < 4) {
+      i3 = zero;
+    }
+    assert(i3 != NULL);
+    if (kernel_elements <= 4) {
+      i4 = zero;
+    }
+    assert(i4 != NULL);
+    if (kernel_elements < 6) {
+      i5 = zero;
+    }
+    assert(i5 != NULL);
+    if (kernel_elements <= 6) {
+      i6 = zero;
+    }
+    assert(i6 != NULL);
+    if (kernel_elements < 8) {
+      i7 = zero;
+    }
+    assert(i7 != NULL);
+    if (kernel_elements <= 8) {
+      i8 = zero;
+    }
+    assert(i8 != NULL);
+    if XNN_UNPREDICTABLE(i0 != zero) {
+      i0 = (const int8_t*) ((uintptr_t) i0 + input_offset);
+    }
+    if XNN_UNPREDICTABLE(i1 != zero) {
+      i1 = (const int8_t*) ((uintptr_t) i1 + input_offset);
+    }
+    if XNN_UNPREDICTABLE(i2 != zero) {
+      i2 = (const int8_t*) ((uintptr_t) i2 + input_offset);
+    }
+    if XNN_UNPREDICTABLE(i3 != zero) {
+      i3 = (const int8_t*) ((uintptr_t) i3 + input_offset);
+    }
+    if XNN_UNPREDICTABLE(i4 != zero) {
+      i4 = (const int8_t*) ((uintptr_t) i4 + input_offset);
+    }
+    if XNN_UNPREDICTABLE(i5 != zero) {
+      i5 = (const int8_t*) ((uintptr_t) i5 + input_offset);
+    }
+    if XNN_UNPREDICTABLE(i6 != zero) {
+      i6 = (const int8_t*) ((uintptr_t) i6 + input_offset);
+    }
+    if XNN_UNPREDICTABLE(i7 != zero) {
+      i7 = (const int8_t*) ((uintptr_t) i7 + input_offset);
+    }
+    if XNN_UNPREDICTABLE(i8 != zero) {
+      i8 = (const int8_t*) ((uintptr_t) i8 + input_offset);
+    }
+
+    size_t c = channels;
+    for (; c >= 8; c -= 8) {
+      const int8x8_t vi0 = vld1_s8(i0); i0 += 8;
+      const int8x8_t vi1 = vld1_s8(i1); i1 += 8;
+      const int8x8_t vi2 = vld1_s8(i2); i2 += 8;
+      const int8x8_t vi3 = vld1_s8(i3); i3 += 8;
+      const int8x8_t vi4 = vld1_s8(i4); i4 += 8;
+      const int8x8_t vi5 = vld1_s8(i5); i5 += 8;
+      const int8x8_t vi6 = vld1_s8(i6); i6 += 8;
+      const int8x8_t vi7 = vld1_s8(i7); i7 += 8;
+      const int8x8_t vi8 = vld1_s8(i8); i8 += 8;
+
+      int16x8_t vsum = vaddl_s8(vi0, vi1);
+      vsum = vaddw_s8(vsum, vi2);
+      vsum = vaddw_s8(vsum, vi3);
+      vsum = vaddw_s8(vsum, vi4);
+      vsum = vaddw_s8(vsum, vi5);
+      vsum = vaddw_s8(vsum, vi6);
+      vsum = vaddw_s8(vsum, vi7);
+      vsum = vaddw_s8(vsum, vi8);
+
+      int32x4_t vacc0123 = vaddw_s16(vinit_bias, vget_low_s16(vsum));
+      int32x4_t vacc4567 = vaddw_s16(vinit_bias, vget_high_s16(vsum));
+
+      vacc0123 = vqshlq_s32(vacc0123, vleft_pre_shift);
+      vacc4567 = vqshlq_s32(vacc4567, vleft_pre_shift);
+
+      vacc0123 = vqdmulhq_s32(vacc0123, vmultiplier);
+      vacc4567 = vqdmulhq_s32(vacc4567, vmultiplier);
+
+      vacc0123 = vrshlq_s32(vacc0123, vleft_post_shift);
+      vacc4567 = vrshlq_s32(vacc4567, vleft_post_shift);
+
+      #if XNN_ARCH_ARM64
+        int16x8_t vacc01234567 = vqmovn_high_s32(vqmovn_s32(vacc0123), vacc4567);
+      #else  // !XNN_ARCH_ARM64
+        int16x8_t vacc01234567 = vcombine_s16(vqmovn_s32(vacc0123), vqmovn_s32(vacc4567));
+      #endif  // !XNN_ARCH_ARM64
+      vacc01234567 = vqaddq_s16(vacc01234567, voutput_zero_point);
+
+      int8x8_t vout01234567 = vqmovn_s16(vacc01234567);
+      vout01234567 = vmax_s8(vout01234567, voutput_min);
+      vout01234567 = vmin_s8(vout01234567, voutput_max);
+
+      vst1_s8(output, vout01234567); output += 8;
+    }
+    if (c != 0) {
+      const int8x8_t vi0 = vld1_s8(i0);
+      const int8x8_t vi1 = vld1_s8(i1);
+      const int8x8_t vi2 = vld1_s8(i2);
+      const int8x8_t vi3 = vld1_s8(i3);
+      const int8x8_t vi4 = vld1_s8(i4);
+      const int8x8_t vi5 = vld1_s8(i5);
+      const int8x8_t vi6 = vld1_s8(i6);
+      const int8x8_t vi7 = vld1_s8(i7);
+      const int8x8_t vi8 = vld1_s8(i8);
+
+      int16x8_t vsum = vaddl_s8(vi0, vi1);
+      vsum = vaddw_s8(vsum, vi2);
+      vsum = vaddw_s8(vsum, vi3);
+      vsum = vaddw_s8(vsum, vi4);
+      vsum = vaddw_s8(vsum, vi5);
+      vsum = vaddw_s8(vsum, vi6);
+      vsum = vaddw_s8(vsum, vi7);
+      vsum = vaddw_s8(vsum, vi8);
+
+      int32x4_t vacc0123 = vaddw_s16(vinit_bias, vget_low_s16(vsum));
+      int32x4_t vacc4567 = vaddw_s16(vinit_bias, vget_high_s16(vsum));
+
+      vacc0123 = vqshlq_s32(vacc0123, vleft_pre_shift);
+      vacc4567 = vqshlq_s32(vacc4567, vleft_pre_shift);
+
+      vacc0123 = vqdmulhq_s32(vacc0123, vmultiplier);
+      vacc4567 = vqdmulhq_s32(vacc4567, vmultiplier);
+
+      vacc0123 = vrshlq_s32(vacc0123, vleft_post_shift);
+      vacc4567 = vrshlq_s32(vacc4567, vleft_post_shift);
+
+      #if XNN_ARCH_ARM64
+        int16x8_t vacc01234567 = vqmovn_high_s32(vqmovn_s32(vacc0123), vacc4567);
+      #else  // !XNN_ARCH_ARM64
+        int16x8_t vacc01234567 = vcombine_s16(vqmovn_s32(vacc0123), vqmovn_s32(vacc4567));
+      #endif  // !XNN_ARCH_ARM64
+      vacc01234567 = vqaddq_s16(vacc01234567, voutput_zero_point);
+
+      int8x8_t vout01234567 = vqmovn_s16(vacc01234567);
+      vout01234567 = vmax_s8(vout01234567, voutput_min);
+      vout01234567 = vmin_s8(vout01234567, voutput_max);
+
+      if (c & 4) {
+        vst1_lane_u32((void*) output, vreinterpret_u32_s8(vout01234567), 0); output += 4;
+        vout01234567 = vext_s8(vout01234567, vout01234567, 4);
+      }
+      if (c & 2) {
+        vst1_lane_u16((void*) output, vreinterpret_u16_s8(vout01234567), 0); output += 2;
+        vout01234567 = vext_s8(vout01234567, vout01234567, 2);
+      }
+      if (c & 1) {
+        vst1_lane_s8(output, vout01234567, 0); output += 1;
+      }
+    }
+    output = (int8_t*) ((uintptr_t) output + output_increment);
+  } while (--output_pixels != 0);
+}
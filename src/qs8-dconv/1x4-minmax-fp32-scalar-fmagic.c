@@ -0,0 +1,151 @@
+// Copyright 2022 Google LLC
+//
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree.
+
+#include <assert.h>
+
+#include <fp16.h>
+
+#include <xnnpack/conv.h>
+#include <xnnpack/math.h>
+
+
+void xnn_qs8_dconv_minmax_fp32_ukernel_1x4__scalar_fmagic(
+    size_t output_width,
+    size_t output_channels,
+    size_t kernel_height,
+    size_t kernel_width,
+    size_t input_channels,
+    size_t input_width,
+    size_t input_pixel_stride,
+    size_t subsampling,
+    size_t padding_left,
+    const int8_t** input,
+    size_t input_offset,
+    const int8_t* zero,
+    const void* weights,
+    int8_t* output,
+    size_t output_pixel_stride,
+    const union xnn_qs8_conv_minmax_params params[restrict XNN_MIN_ELEMENTS(1)])
+{
+  assert(output_width != 0);
+  assert(output_channels != 0);
+  assert(kernel_height != 0);
+  assert(kernel_width != 0);
+  assert(input_channels != 0);
+  assert(subsampling != 0);
+  assert(input != NULL);
+  assert(weights != NULL);
+  assert(output != NULL);
+
+  const float vscale = params->fp32_scalar_fmagic.scale;
+  const float voutput_min_less_zero_point = params->fp32_scalar_fmagic.output_min_less_zero_point;
+  const float voutput_max_less_zero_point = params->fp32_scalar_fmagic.output_max_less_zero_point;
+  const float vmagic_bias = params->fp32_scalar_fmagic.magic_bias;
+  const int32_t vmagic_bias_less_output_zero_point = params->fp32_scalar_fmagic.magic_bias_less_output_zero_point;
+  // Weights of every block of output channels: 4 32-bit biases followed by 4 8-bit weights for every kernel element and
+  // channel.
+  const size_t w_stride = 4 * (sizeof(int32_t) + kernel_height * kernel_width * input_channels);
+  do {
+    int8_t* o0 = output;
+    // Input column of the first kernel element for the current output pixel; wraps around below zero.
+    size_t ix0 = -padding_left;
+    size_t n = output_width;
+    do {
+      const void* w = weights;
+      int32_t vacc0 = ((const int32_t*) w)[0];
+      int32_t vacc1 = ((const int32_t*) w)[1];
+      int32_t vacc2 = ((const int32_t*) w)[2];
+      int32_t vacc3 = ((const int32_t*) w)[3];
+      w = (const void*) ((const int32_t*) w + 4);
+
+      const int8_t** i = input;
+      size_t ky = kernel_height;
+      do {
+        const int8_t* row = *i++;
+        assert(row != NULL);
+        const bool is_padding_row = row == zero;
+        row = (const int8_t*) ((uintptr_t) row + input_offset);
+
+        size_t ix = ix0;
+        size_t kx = kernel_width;
+        do {
+          // Padding reads the zero buffer, filled with the input zero point: the packed biases account for it.
+          const int8_t* i0 = zero;
+          if XNN_LIKELY(!is_padding_row && ix < input_width) {
+            i0 = (const int8_t*) ((uintptr_t) row + ix * input_pixel_stride);
+          }
+          ix += 1;
+
+          size_t k = input_channels;
+          do {
+            const int32_t vi0 = (int32_t) *i0++;
+
+            const int32_t vw0 = (int32_t) ((const int8_t*) w)[0];
+            const int32_t vw1 = (int32_t) ((const int8_t*) w)[1];
+            const int32_t vw2 = (int32_t) ((const int8_t*) w)[2];
+            const int32_t vw3 = (int32_t) ((const int8_t*) w)[3];
+            w = (const void*) ((const int8_t*) w + 4);
+
+            vacc0 += vi0 * vw0;
+            vacc1 += vi0 * vw1;
+            vacc2 += vi0 * vw2;
+            vacc3 += vi0 * vw3;
+
+            k -= sizeof(int8_t);
+          } while (k != 0);
+        } while (--kx != 0);
+      } while (--ky != 0);
+
+      float vfpacc0 = (float) vacc0 * vscale;
+      float vfpacc1 = (float) vacc1 * vscale;
+      float vfpacc2 = (float) vacc2 * vscale;
+      float vfpacc3 = (float) vacc3 * vscale;
+
+      vfpacc0 = math_max_f32(vfpacc0, voutput_min_less_zero_point);
+      vfpacc1 = math_max_f32(vfpacc1, voutput_min_less_zero_point);
+      vfpacc2 = math_max_f32(vfpacc2, voutput_min_less_zero_point);
+      vfpacc3 = math_max_f32(vfpacc3, voutput_min_less_zero_point);
+
+      vfpacc0 = math_min_f32(vfpacc0, voutput_max_less_zero_point);
+      vfpacc1 = math_min_f32(vfpacc1, voutput_max_less_zero_point);
+      vfpacc2 = math_min_f32(vfpacc2, voutput_max_less_zero_point);
+      vfpacc3 = math_min_f32(vfpacc3, voutput_max_less_zero_point);
+
+      vfpacc0 += vmagic_bias;
+      vfpacc1 += vmagic_bias;
+      vfpacc2 += vmagic_bias;
+      vfpacc3 += vmagic_bias;
+
+      int32_t vout0 = (int32_t) fp32_to_bits(vfpacc0) - vmagic_bias_less_output_zero_point;
+      int32_t vout1 = (int32_t) fp32_to_bits(vfpacc1) - vmagic_bias_less_output_zero_point;
+      int32_t vout2 = (int32_t) fp32_to_bits(vfpacc2) - vmagic_bias_less_output_zero_point;
+      int32_t vout3 = (int32_t) fp32_to_bits(vfpacc3) - vmagic_bias_less_output_zero_point;
+
+      if XNN_LIKELY(output_channels >= 4) {
+        o0[0] = (int8_t) vout0;
+        o0[1] = (int8_t) vout1;
+        o0[2] = (int8_t) vout2;
+        o0[3] = (int8_t) vout3;
+      } else {
+        int8_t* o = o0;
+        if (output_channels & 2) {
+          o[0] = (int8_t) vout0;
+          o[1] = (int8_t) vout1;
+          vout0 = vout2;
+          o += 2;
+        }
+        if (output_channels & 1) {
+          o[0] = (int8_t) vout0;
+        }
+      }
+      o0 = (int8_t*) ((uintptr_t) o0 + output_pixel_stride);
+      ix0 += subsampling;
+    } while (--n != 0);
+
+    weights = (const void*) ((uintptr_t) weights + w_stride);
+    output += 4;
+    output_channels = doz(output_channels, 4);
+  } while (output_channels != 0);
+}
@@ -0,0 +1,169 @@
+// Copyright 2022 Google LLC
+//
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree.
+
+#include <assert.h>
+
+#include <smmintrin.h>
+
+#include <xnnpack/conv.h>
+#include <xnnpack/math.h>
+
+
+void xnn_qs8_dconv_minmax_fp32_ukernel_2x8__sse41(
+    size_t output_width,
+    size_t output_channels,
+    size_t kernel_height,
+    size_t kernel_width,
+    size_t input_channels,
+    size_t input_width,
+    size_t input_pixel_stride,
+    size_t subsampling,
+    size_t padding_left,
+    const int8_t** input,
+    size_t input_offset,
+    const int8_t* zero,
+    const void* weights,
+    int8_t* output,
+    size_t output_pixel_stride,
+    const union xnn_qs8_conv_minmax_params params[restrict XNN_MIN_ELEMENTS(1)])
+{
+  assert(output_width != 0);
+  assert(output_channels != 0);
+  assert(kernel_height != 0);
+  assert(kernel_width != 0);
+  assert(input_channels != 0);
+  assert(subsampling != 0);
+  assert(input != NULL);
+  assert(weights != NULL);
+  assert(output != NULL);
+
+  const __m128 vscale = _mm_load_ps(params->fp32_sse4.scale);
+  const __m128 voutput_max_less_zero_point = _mm_load_ps(params->fp32_sse4.output_max_less_zero_point);
+  const __m128i voutput_zero_point = _mm_load_si128((const __m128i*) params->fp32_sse4.output_zero_point);
+  const __m128i voutput_min = _mm_load_si128((const __m128i*) params->fp32_sse4.output_min);
+  // Weights of every block of output channels: 8 32-bit biases followed by 8 8-bit weights for every kernel element and
+  // channel.
+  const size_t w_stride = 8 * (sizeof(int32_t) + kernel_height * kernel_width * input_channels);
+  do {
+    int8_t* o0 = output;
+    // Input column of the first kernel element for the first output pixel in a tile; wraps around below zero.
+    size_t ix0 = -padding_left;
+    size_t n = output_width;
+    do {
+      // The last tile of an odd number of pixels computes (and stores) its only pixel twice.
+      const size_t ix1 = n >= 2 ? ix0 + subsampling : ix0;
+      int8_t* o1 = n >= 2 ? (int8_t*) ((uintptr_t) o0 + output_pixel_stride) : o0;
+
+      const void* w = weights;
+      __m128i vacc0x0123 = _mm_loadu_si128((const __m128i*) w);
+      __m128i vacc0x4567 = _mm_loadu_si128((const __m128i*) ((const int32_t*) w + 4));
+      __m128i vacc1x0123 = vacc0x0123;
+      __m128i vacc1x4567 = vacc0x4567;
+      w = (const void*) ((const int32_t*) w + 8);
+
+      const int8_t** i = input;
+      size_t ky = kernel_height;
+      do {
+        const int8_t* row = *i++;
+        assert(row != NULL);
+        const bool is_padding_row = row == zero;
+        row = (const int8_t*) ((uintptr_t) row + input_offset);
+
+        size_t kx = 0;
+        do {
+          // Padding reads the zero buffer, filled with the input zero point: the packed biases account for it.
+          const int8_t* i0 = zero;
+          if XNN_LIKELY(!is_padding_row && ix0 + kx < input_width) {
+            i0 = (const int8_t*) ((uintptr_t) row + (ix0 + kx) * input_pixel_stride);
+          }
+          const int8_t* i1 = zero;
+          if XNN_LIKELY(!is_padding_row && ix1 + kx < input_width) {
+            i1 = (const int8_t*) ((uintptr_t) row + (ix1 + kx) * input_pixel_stride);
+          }
+
+          size_t k = input_channels;
+          do {
+            const __m128i vxi0 = _mm_set1_epi16((short) *i0++);
+            const __m128i vxi1 = _mm_set1_epi16((short) *i1++);
+
+            const __m128i vw01234567 = _mm_loadl_epi64((const __m128i*) w);
+            const __m128i vxw01234567 = _mm_cvtepi8_epi16(vw01234567);
+            w = (const void*) ((const int8_t*) w + 8);
+
+            const __m128i vprod0x01234567 = _mm_mullo_epi16(vxi0, vxw01234567);
+            const __m128i vprod1x01234567 = _mm_mullo_epi16(vxi1, vxw01234567);
+
+            vacc0x0123 = _mm_add_epi32(vacc0x0123, _mm_cvtepi16_epi32(vprod0x01234567));
+            vacc0x4567 = _mm_add_epi32(vacc0x4567, _mm_srai_epi32(_mm_unpackhi_epi16(vprod0x01234567, vprod0x01234567), 16));
+            vacc1x0123 = _mm_add_epi32(vacc1x0123, _mm_cvtepi16_epi32(vprod1x01234567));
+            vacc1x4567 = _mm_add_epi32(vacc1x4567, _mm_srai_epi32(_mm_unpackhi_epi16(vprod1x01234567, vprod1x01234567), 16));
+
+            k -= sizeof(int8_t);
+          } while (k != 0);
+        } while (++kx != kernel_width);
+      } while (--ky != 0);
+
+      __m128 vscaled0x0123 = _mm_cvtepi32_ps(vacc0x0123);
+      __m128 vscaled0x4567 = _mm_cvtepi32_ps(vacc0x4567);
+      __m128 vscaled1x0123 = _mm_cvtepi32_ps(vacc1x0123);
+      __m128 vscaled1x4567 = _mm_cvtepi32_ps(vacc1x4567);
+
+      vscaled0x0123 = _mm_mul_ps(vscaled0x0123, vscale);
+      vscaled0x4567 = _mm_mul_ps(vscaled0x4567, vscale);
+      vscaled1x0123 = _mm_mul_ps(vscaled1x0123, vscale);
+      vscaled1x4567 = _mm_mul_ps(vscaled1x4567, vscale);
+
+      vscaled0x0123 = _mm_min_ps(vscaled0x0123, voutput_max_less_zero_point);
+      vscaled0x4567 = _mm_min_ps(vscaled0x4567, voutput_max_less_zero_point);
+      vscaled1x0123 = _mm_min_ps(vscaled1x0123, voutput_max_less_zero_point);
+      vscaled1x4567 = _mm_min_ps(vscaled1x4567, voutput_max_less_zero_point);
+
+      vacc0x0123 = _mm_cvtps_epi32(vscaled0x0123);
+      vacc0x4567 = _mm_cvtps_epi32(vscaled0x4567);
+      vacc1x0123 = _mm_cvtps_epi32(vscaled1x0123);
+      vacc1x4567 = _mm_cvtps_epi32(vscaled1x4567);
+
+      const __m128i vacc0x01234567 = _mm_adds_epi16(_mm_packs_epi32(vacc0x0123, vacc0x4567), voutput_zero_point);
+      const __m128i vacc1x01234567 = _mm_adds_epi16(_mm_packs_epi32(vacc1x0123, vacc1x4567), voutput_zero_point);
+
+      __m128i vout = _mm_packs_epi16(vacc0x01234567, vacc1x01234567);
+
+      vout = _mm_max_epi8(vout, voutput_min);
+
+      if XNN_LIKELY(output_channels >= 8) {
+        _mm_storeh_pi((__m64*) o1, _mm_castsi128_ps(vout));
+        _mm_storel_epi64((__m128i*) o0, vout);
+      } else {
+        int8_t* c1 = o1;
+        int8_t* c0 = o0;
+        if (output_channels & 4) {
+          *((uint32_t*) c1) = (uint32_t) _mm_extract_epi32(vout, 2);
+          *((uint32_t*) c0) = (uint32_t) _mm_cvtsi128_si32(vout);
+          c1 += 4;
+          c0 += 4;
+          vout = _mm_srli_epi64(vout, 32);
+        }
+        if (output_channels & 2) {
+          *((uint16_t*) c1) = (uint16_t) _mm_extract_epi16(vout, 4);
+          *((uint16_t*) c0) = (uint16_t) _mm_extract_epi16(vout, 0);
+          c1 += 2;
+          c0 += 2;
+          vout = _mm_srli_epi32(vout, 16);
+        }
+        if (output_channels & 1) {
+          *c1 = (int8_t) _mm_extract_epi8(vout, 8);
+          *c0 = (int8_t) _mm_extract_epi8(vout, 0);
+        }
+      }
+      o0 = (int8_t*) ((uintptr_t) o1 + output_pixel_stride);
+      ix0 = ix1 + subsampling;
+      n = doz(n, 2);
+    } while (n != 0);
+
+    weights = (const void*) ((uintptr_t) weights + w_stride);
+    output += 8;
+    output_channels = doz(output_channels, 8);
+  } while (output_channels != 0);
+}
@@ -4,13 +4,16 @@
 // LICENSE file in the root directory of this source tree.
 
 #include <math.h>
+#include <stdbool.h>
 #include <stddef.h>
 #include <stdint.h>
 #include <stdlib.h>
 #include <stdio.h>
+#include <string.h>
 
 #include <xnnpack.h>
 #include <xnnpack/allocator.h>
+#include <xnnpack/indirection.h>
 #include <xnnpack/log.h>
 #include <xnnpack/math.h>
 #include <xnnpack/memory-planner.h>
@@ -19,6 +22,351 @@
 #include <xnnpack/subgraph.h>
 
 
+#if defined(__GNUC__) || defined(__clang__)
+  #define XNN_HAVE_PARALLEL_REGION 1
+#else
+  #define XNN_HAVE_PARALLEL_REGION 0
+#endif
+
+// Progress of one pass of an operator in a persistent parallel region.
+struct xnn_parallel_region_pass {
+  // Number of tasks claimed by threads so far.
+  size_t claimed_tasks;
+  // Number of tasks whose outputs are complete.
+  size_t completed_tasks;
+};
+
+struct xnn_parallel_region {
+  size_t num_threads;
+  uint32_t flags;
+  // Number of threads which entered the parallel region so far.
+  size_t num_entered_threads;
+  // Progress of the two passes of every operator, reset before every invocation.
+  struct xnn_parallel_region_pass passes[];
+};
+
+
+#if XNN_HAVE_PARALLEL_REGION
+static enum xnn_status create_parallel_region(
+  xnn_runtime_t runtime,
+  uint32_t flags)
+{
+  if ((flags & XNN_FLAG_PERSISTENT_PARALLEL_REGION) == 0 || pthreadpool_get_threads_count(runtime->threadpool) <= 1) {
+    return xnn_status_success;
+  }
+
+  const size_t parallel_region_size =
+    sizeof(struct xnn_parallel_region) + 2 * sizeof(struct xnn_parallel_region_pass) * runtime->num_ops;
+  runtime->parallel_region = xnn_allocate_zero_memory(parallel_region_size);
+  if (runtime->parallel_region == NULL) {
+    xnn_log_error("failed to allocate %zu bytes for parallel region descriptor", parallel_region_size);
+    return xnn_status_out_of_memory;
+  }
+  runtime->parallel_region->num_threads = pthreadpool_get_threads_count(runtime->threadpool);
+  runtime->parallel_region->flags = PTHREADPOOL_FLAG_DISABLE_DENORMALS;
+  if (flags & XNN_FLAG_YIELD_WORKERS) {
+    runtime->parallel_region->flags |= PTHREADPOOL_FLAG_YIELD_WORKERS;
+  }
+  return xnn_status_success;
+}
+#endif  // XNN_HAVE_PARALLEL_REGION
+
+enum xnn_status xnn_create_workspace(
+  xnn_workspace_t* workspace_out)
+{
+  if ((xnn_params.init_flags & XNN_INIT_FLAG_XNNPACK) == 0) {
+    xnn_log_error("failed to create workspace: XNNPACK is not initialized");
+    return xnn_status_uninitialized;
+  }
+
+  struct xnn_workspace* workspace = xnn_allocate_zero_memory(sizeof(struct xnn_workspace));
+  if (workspace == NULL) {
+    xnn_log_error("failed to allocate %zu bytes for workspace descriptor", sizeof(struct xnn_workspace));
+    return xnn_status_out_of_memory;
+  }
+  workspace->ref_count = 1;
+
+  *workspace_out = workspace;
+  return xnn_status_success;
+}
+
+enum xnn_status xnn_release_workspace(
+  xnn_workspace_t workspace)
+{
+  if (workspace != NULL) {
+    assert(workspace->ref_count != 0);
+    if (--workspace->ref_count == 0) {
+      assert(workspace->first_user == NULL);
+      xnn_release_simd_memory(workspace->data);
+      xnn_release_memory(workspace);
+    }
+  }
+  return xnn_status_success;
+}
+
+// Grow the workspace to at least new_size bytes, and re-bind intermediate values of all runtimes using the workspace
+// to the new memory. Runtimes which were already setup are setup again to update operators' pointers.
+static enum xnn_status grow_workspace(
+  struct xnn_workspace* workspace,
+  size_t new_size,
+  bool huge_pages)
+{
+  assert(new_size > workspace->size);
+
+  void* new_data = huge_pages ?
+    xnn_allocate_huge_simd_memory(xnn_memory_category_workspace, new_size) :
+    xnn_allocate_tagged_simd_memory(xnn_memory_category_workspace, new_size);
+  if (new_data == NULL) {
+    xnn_log_error("failed to allocate %zu bytes for runtime workspace", new_size);
+    return xnn_status_out_of_memory;
+  }
+
+  void* old_data = workspace->data;
+  const uintptr_t old_start = (uintptr_t) old_data;
+  const uintptr_t old_end = old_start + workspace->size;
+  workspace->data = new_data;
+  workspace->size = new_size;
+
+  enum xnn_status status = xnn_status_success;
+  for (struct xnn_runtime* user = workspace->first_user; user != NULL; user = user->next_workspace_user) {
+    for (size_t i = 0; i < user->num_blobs; i++) {
+      struct xnn_blob* blob = &user->blobs[i];
+      if (!blob->external && (uintptr_t) blob->data >= old_start && (uintptr_t) blob->data < old_end) {
+        blob->data = (void*) ((uintptr_t) new_data + ((uintptr_t) blob->data - old_start));
+      }
+    }
+
+    for (size_t i = 0; i < user->num_ops; i++) {
+      const struct xnn_operator_data* opdata = &user->opdata[i];
+      if (opdata->operator_object == NULL || opdata->operator_object->state == xnn_run_state_invalid) {
+        // Operator was removed during optimization, or was never setup
+        continue;
+      }
+
+      const enum xnn_status setup_status = opdata->setup(opdata, user->blobs, user->num_blobs, user->threadpool);
+      if (setup_status != xnn_status_success) {
+        xnn_log_error("failed to re-setup runtime after workspace reallocation: error in operator #%zu", i);
+        status = setup_status;
+      }
+    }
+  }
+
+  xnn_release_simd_memory(old_data);
+  return status;
+}
+
+// Slice Nodes which produce a contiguous block of memory within their input are not executed: their output Value
+// aliases the input Value at an offset. The memory of external outputs is provided by the user, so slices into them
+// still copy.
+static bool get_zero_copy_slice_offset(
+  xnn_subgraph_t subgraph,
+  const struct xnn_node* node,
+  size_t* offset_out)
+{
+  if (node->type != xnn_node_type_static_slice) {
+    return false;
+  }
+  if (subgraph->values[node->outputs[0]].flags & XNN_VALUE_FLAG_EXTERNAL_OUTPUT) {
+    return false;
+  }
+  return xnn_subgraph_get_contiguous_slice_offset(node, subgraph->values, offset_out);
+}
+
+static void alias_zero_copy_slices(
+  xnn_subgraph_t subgraph,
+  struct xnn_runtime* runtime,
+  struct xnn_value_allocation_tracker* tracker)
+{
+  for (uint32_t n = 0; n < subgraph->num_nodes; n++) {
+    const struct xnn_node* node = subgraph->nodes + n;
+    size_t offset;
+    if (!get_zero_copy_slice_offset(subgraph, node, &offset)) {
+      continue;
+    }
+
+    const uint32_t input_id = node->inputs[0];
+    const uint32_t output_id = node->outputs[0];
+    const size_t element_size =
+      xnn_tensor_get_size(subgraph, input_id) / xnn_shape_multiply_all_dims(&subgraph->values[input_id].shape);
+    const struct xnn_blob* input_blob = &runtime->blobs[input_id];
+    struct xnn_blob* output_blob = &runtime->blobs[output_id];
+    output_blob->alias = true;
+    output_blob->alias_id = input_id;
+    output_blob->alias_offset = offset * element_size;
+    if (input_blob->alias) {
+      // Slice of a slice: alias the Value which owns the memory.
+      output_blob->alias_id = input_blob->alias_id;
+      output_blob->alias_offset += input_blob->alias_offset;
+    }
+    xnn_alias_value_allocation_tracker(tracker, output_blob->alias_id, output_id);
+  }
+}
+
+// Bind Values which alias the memory of other Values. Aliases of external Values are bound in xnn_setup_runtime.
+static void bind_aliased_blobs(struct xnn_runtime* runtime)
+{
+  for (size_t i = 0; i < runtime->num_blobs; i++) {
+    struct xnn_blob* blob = &runtime->blobs[i];
+    if (blob->alias) {
+      const struct xnn_blob* aliased_blob = &runtime->blobs[blob->alias_id];
+      blob->data = aliased_blob->data == NULL ? NULL : (void*) ((uintptr_t) aliased_blob->data + blob->alias_offset);
+    }
+  }
+}
+
+static bool is_igemm_convolution_nhwc(const struct xnn_operator* op) {
+  if (op == NULL || op->ukernel.type != xnn_ukernel_type_igemm) {
+    return false;
+  }
+  switch (op->type) {
+    case xnn_operator_type_convolution_nhwc_f16:
+    case xnn_operator_type_convolution_nhwc_f32:
+    case xnn_operator_type_convolution_nhwc_qc8:
+    case xnn_operator_type_convolution_nhwc_qs8:
+    case xnn_operator_type_convolution_nhwc_qu8:
+      return true;
+    default:
+      return false;
+  }
+}
+
+// Let every IGEMM-based Convolution operator use the indirection buffer of the first preceding Convolution operator
+// with the same input shape, convolution geometry, and padding mode. Operators are setup in order, so the source
+// operator always rebuilds its indirection buffer before the operators sharing it are setup, and setup falls back to a
+// private indirection buffer if the source turns out to be incompatible.
+static void share_indirection_buffers(struct xnn_runtime* runtime) {
+  for (size_t i = 0; i < runtime->num_ops; i++) {
+    const struct xnn_operator_data* opdata = &runtime->opdata[i];
+    xnn_operator_t op = opdata->operator_object;
+    if (!is_igemm_convolution_nhwc(op)) {
+      continue;
+    }
+    for (size_t j = 0; j < i; j++) {
+      const struct xnn_operator_data* source_opdata = &runtime->opdata[j];
+      xnn_operator_t source = source_opdata->operator_object;
+      if (is_igemm_convolution_nhwc(source) && source->indirection_source == NULL &&
+          source->type == op->type &&
+          source_opdata->input_height == opdata->input_height &&
+          source_opdata->input_width == opdata->input_width &&
+          source->input_pixel_stride == op->input_pixel_stride &&
+          source->kernel_height == op->kernel_height && source->kernel_width == op->kernel_width &&
+          source->stride_height == op->stride_height && source->stride_width == op->stride_width &&
+          source->dilation_height == op->dilation_height && source->dilation_width == op->dilation_width &&
+          source->padding_top == op->padding_top && source->padding_left == op->padding_left &&
+          source->padding_bottom == op->padding_bottom && source->padding_right == op->padding_right &&
+          (source->flags & (XNN_FLAG_TENSORFLOW_SAME_PADDING | XNN_PADDING_MODE_FLAGS)) ==
+            (op->flags & (XNN_FLAG_TENSORFLOW_SAME_PADDING | XNN_PADDING_MODE_FLAGS)))
+      {
+        op->indirection_source = source;
+        break;
+      }
+    }
+  }
+}
+
+enum xnn_status xnn_get_runtime_workspace_size(
+  xnn_runtime_t runtime,
+  size_t* workspace_size_out)
+{
+  *workspace_size_out = runtime->workspace_size;
+  return xnn_status_success;
+}
+
+static void add_allocation_memory_usage(
+  const struct xnn_allocation_header* header,
+  struct xnn_memory_usage* usage)
+{
+  usage->current_bytes[header->category] += header->size;
+  usage->current_total_bytes += header->size;
+}
+
+static void add_operator_memory_usage(
+  const struct xnn_operator* op,
+  struct xnn_memory_usage* usage)
+{
+  add_allocation_memory_usage(xnn_get_simd_allocation_header(op), usage);
+  if (op->indirection_buffer != NULL) {
+    add_allocation_memory_usage(xnn_get_allocation_header(op->indirection_buffer), usage);
+  }
+  if (!op->shares_weights) {
+    if (op->packed_weights != NULL && !op->external_packed_weights) {
+      add_allocation_memory_usage(xnn_get_simd_allocation_header(op->packed_weights), usage);
+    }
+    if (op->lookup_table != NULL) {
+      add_allocation_memory_usage(xnn_get_simd_allocation_header(op->lookup_table), usage);
+    }
+#if XNN_PLATFORM_JIT
+    if (op->ukernel.type == xnn_ukernel_type_gemm) {
+      const size_t code_size = op->ukernel.gemm.general_code_buffer.capacity + op->ukernel.gemm.mr1_code_buffer.capacity;
+      usage->current_bytes[xnn_memory_category_code] += code_size;
+      usage->current_total_bytes += code_size;
+    }
+#endif  // XNN_PLATFORM_JIT
+  }
+  if (op->zero_buffer != NULL && !op->shares_zero_buffer) {
+    add_allocation_memory_usage(xnn_get_simd_allocation_header(op->zero_buffer), usage);
+  }
+  if (op->pixelwise_buffer != NULL) {
+    add_allocation_memory_usage(xnn_get_allocation_header(op->pixelwise_buffer), usage);
+  }
+  if (op->subconvolution_buffer != NULL) {
+    add_allocation_memory_usage(xnn_get_allocation_header(op->subconvolution_buffer), usage);
+  }
+  if (op->scratch_buffer != NULL) {
+    add_allocation_memory_usage(xnn_get_simd_allocation_header(op->scratch_buffer), usage);
+  }
+  for (size_t i = 0; i < XNN_COUNT_OF(op->fused_operators); i++) {
+    if (op->fused_operators[i] != NULL) {
+      add_operator_memory_usage(op->fused_operators[i], usage);
+    }
+  }
+}
+
+// Compute the current memory usage of the Runtime from the headers of its allocations, and update its peak memory
+// usage with it.
+static void update_runtime_memory_usage(
+  struct xnn_runtime* runtime,
+  struct xnn_memory_usage* usage)
+{
+  memset(usage, 0, sizeof(struct xnn_memory_usage));
+  add_allocation_memory_usage(xnn_get_allocation_header(runtime), usage);
+  if (runtime->opdata != NULL) {
+    add_allocation_memory_usage(xnn_get_allocation_header(runtime->opdata), usage);
+    for (size_t i = 0; i < runtime->num_ops; i++) {
+      if (runtime->opdata[i].operator_object != NULL) {
+        add_operator_memory_usage(runtime->opdata[i].operator_object, usage);
+      }
+    }
+  }
+  if (runtime->blobs != NULL) {
+    add_allocation_memory_usage(xnn_get_allocation_header(runtime->blobs), usage);
+  }
+  if (runtime->workspace != NULL) {
+    add_allocation_memory_usage(xnn_get_allocation_header(runtime->workspace), usage);
+    if (runtime->workspace->data != NULL) {
+      add_allocation_memory_usage(xnn_get_simd_allocation_header(runtime->workspace->data), usage);
+    }
+  }
+  if (runtime->parallel_region != NULL) {
+    add_allocation_memory_usage(xnn_get_allocation_header(runtime->parallel_region), usage);
+  }
+
+  for (size_t i = 0; i < XNN_NUM_MEMORY_CATEGORIES; i++) {
+    runtime->peak_memory_bytes[i] = max(runtime->peak_memory_bytes[i], usage->current_bytes[i]);
+    usage->peak_bytes[i] = runtime->peak_memory_bytes[i];
+  }
+  runtime->peak_total_memory_bytes = max(runtime->peak_total_memory_bytes, usage->current_total_bytes);
+  usage->peak_total_bytes = runtime->peak_total_memory_bytes;
+}
+
+enum xnn_status xnn_get_runtime_memory_usage(
+  xnn_runtime_t runtime,
+  struct xnn_memory_usage* usage_out)
+{
+  update_runtime_memory_usage(runtime, usage_out);
+  return xnn_status_success;
+}
+
 enum xnn_status xnn_create_runtime(
   xnn_subgraph_t subgraph,
   xnn_runtime_t* runtime_out)
@@ -31,6 +379,16 @@ enum xnn_status xnn_create_runtime_v2(
   pthreadpool_t threadpool,
   uint32_t flags,
   xnn_runtime_t* runtime_out)
+{
+  return xnn_create_runtime_v3(subgraph, NULL /* workspace */, threadpool, flags, runtime_out);
+}
+
+enum xnn_status xnn_create_runtime_v3(
+  xnn_subgraph_t subgraph,
+  xnn_workspace_t workspace,
+  pthreadpool_t threadpool,
+  uint32_t flags,
+  xnn_runtime_t* runtime_out)
 {
   struct xnn_runtime* runtime = NULL;
   enum xnn_status status = xnn_status_uninitialized;
@@ -76,12 +434,54 @@ enum xnn_status xnn_create_runtime_v2(
     }
   }
 
+  if (flags & XNN_FLAG_AUTOTUNE) {
+    for (size_t i = 0; i < subgraph->num_nodes; i++) {
+      struct xnn_node* node = subgraph->nodes + i;
+      if (node->type == xnn_node_type_convolution_2d || node->type == xnn_node_type_fully_connected) {
+        node->flags |= XNN_FLAG_AUTOTUNE;
+      }
+    }
+  }
+
+  if (flags & XNN_FLAG_HUGE_PAGES) {
+    for (size_t i = 0; i < subgraph->num_nodes; i++) {
+      struct xnn_node* node = subgraph->nodes + i;
+      if (node->type == xnn_node_type_convolution_2d || node->type == xnn_node_type_fully_connected) {
+        node->flags |= XNN_FLAG_HUGE_PAGES;
+      }
+    }
+  }
+
+  if (flags & XNN_FLAG_COMPACT_INDIRECTION) {
+    for (size_t i = 0; i < subgraph->num_nodes; i++) {
+      struct xnn_node* node = subgraph->nodes + i;
+      if (node->type == xnn_node_type_convolution_2d) {
+        node->flags |= XNN_FLAG_COMPACT_INDIRECTION;
+      }
+    }
+  }
+
+  // Operators only allocate packed weights when they are created, and the weights of all operators are packed at once
+  // below (or in the first setup with XNN_FLAG_DEFER_PACKING), when packing can be parallelized on the thread pool.
+  for (size_t i = 0; i < subgraph->num_nodes; i++) {
+    struct xnn_node* node = subgraph->nodes + i;
+    if (node->type == xnn_node_type_convolution_2d || node->type == xnn_node_type_fully_connected) {
+      node->flags |= XNN_FLAG_DEFER_PACKING;
+    }
+  }
+
   struct xnn_value* values = subgraph->values;
   for (size_t i = 0; i < subgraph->num_nodes; i++) {
     const struct xnn_node* node = subgraph->nodes + i;
 
     // Ignore fused nodes
     if (node->type != xnn_node_type_invalid) {
+      size_t slice_offset;
+      if (get_zero_copy_slice_offset(subgraph, node, &slice_offset)) {
+        // Output of the Slice Node aliases its input, see alias_zero_copy_slices.
+        continue;
+      }
+
       assert(node->create != NULL);
       status = node->create(node, values, subgraph->num_values, runtime->opdata + i);
       if (status != xnn_status_success) {
@@ -90,6 +490,7 @@ enum xnn_status xnn_create_runtime_v2(
       runtime->opdata[i].setup = node->setup;
     }
   }
+  share_indirection_buffers(runtime);
 
   runtime->blobs = xnn_allocate_zero_memory(sizeof(struct xnn_blob) * subgraph->num_values);
   if (runtime->blobs == NULL) {
@@ -101,6 +502,7 @@ enum xnn_status xnn_create_runtime_v2(
 
   struct xnn_value_allocation_tracker mem_alloc_tracker;
   xnn_init_value_allocation_tracker(&mem_alloc_tracker, subgraph);
+  alias_zero_copy_slices(subgraph, runtime, &mem_alloc_tracker);
 
   for (uint32_t i = 0; i < subgraph->num_values; i++) {
     struct xnn_value* value = &subgraph->values[i];
@@ -108,7 +510,7 @@ enum xnn_status xnn_create_runtime_v2(
     if (value->datatype != xnn_datatype_invalid && value->type == xnn_value_type_dense_tensor) {
       blob->size = xnn_tensor_get_size(subgraph, i);
       blob->data = (void*) (uintptr_t) value->data;
-      if (blob->data == NULL) {
+      if (blob->data == NULL && !blob->alias) {
         if ((value->flags & (XNN_VALUE_FLAG_EXTERNAL_INPUT | XNN_VALUE_FLAG_EXTERNAL_OUTPUT)) == 0) {
           // Value is purely internal to the runtime, and must be allocated in its workspace.
           xnn_add_value_allocation_tracker(&mem_alloc_tracker, i, round_up_po2(blob->size, XNN_EXTRA_BYTES));
@@ -121,30 +523,64 @@ enum xnn_status xnn_create_runtime_v2(
   }
   xnn_plan_value_allocation_tracker(&mem_alloc_tracker);
 
-  if (mem_alloc_tracker.mem_arena_size != 0) {
-    // XNN_EXTRA_BYTES ensures that out-of-bound reads of intermediate values don't segfault.
-    const size_t mem_arena_size = mem_alloc_tracker.mem_arena_size + XNN_EXTRA_BYTES;
-    runtime->workspace = xnn_allocate_simd_memory(mem_arena_size);
-    if (runtime->workspace == NULL) {
-      xnn_log_error("failed to allocate %zu bytes for runtime workspace", mem_arena_size);
+  if (workspace == NULL) {
+    status = xnn_create_workspace(&workspace);
+    if (status != xnn_status_success) {
       xnn_release_value_allocation_tracker(&mem_alloc_tracker);
       goto error;
     }
+  } else {
+    workspace->ref_count += 1;
+  }
+  runtime->workspace = workspace;
+
+  if (mem_alloc_tracker.mem_arena_size != 0) {
+    // XNN_EXTRA_BYTES ensures that out-of-bound reads of intermediate values don't segfault.
+    runtime->workspace_size = mem_alloc_tracker.mem_arena_size + XNN_EXTRA_BYTES;
+    if (workspace->size < runtime->workspace_size) {
+      status = grow_workspace(workspace, runtime->workspace_size, (flags & XNN_FLAG_HUGE_PAGES) != 0);
+      if (status != xnn_status_success) {
+        xnn_release_value_allocation_tracker(&mem_alloc_tracker);
+        goto error;
+      }
+    }
     for (size_t i = 0; i < subgraph->num_values; i++) {
       const struct xnn_value* value = &subgraph->values[i];
       struct xnn_blob* blob = &runtime->blobs[i];
       if (value->datatype != xnn_datatype_invalid && value->type == xnn_value_type_dense_tensor) {
-        if (value->data == NULL && !blob->external) {
+        if (value->data == NULL && !blob->external && !blob->alias) {
           // Value is purely internal to the runtime, allocate it in the workspace.
-          blob->data = (void*) ((uintptr_t) runtime->workspace + mem_alloc_tracker.usage[i].alloc_offset);
+          blob->data = (void*) ((uintptr_t) workspace->data + mem_alloc_tracker.usage[i].alloc_offset);
         }
       }
     }
   }
   xnn_release_value_allocation_tracker(&mem_alloc_tracker);
+  bind_aliased_blobs(runtime);
+
+  runtime->next_workspace_user = workspace->first_user;
+  workspace->first_user = runtime;
 
   runtime->threadpool = threadpool;
 
+  if ((flags & XNN_FLAG_DEFER_PACKING) == 0) {
+    for (size_t i = 0; i < runtime->num_ops; i++) {
+      if (runtime->opdata[i].operator_object != NULL) {
+        xnn_pack_operator_weights(runtime->opdata[i].operator_object, threadpool);
+      }
+    }
+  }
+
+#if XNN_HAVE_PARALLEL_REGION
+  status = create_parallel_region(runtime, flags);
+  if (status != xnn_status_success) {
+    goto error;
+  }
+#endif  // XNN_HAVE_PARALLEL_REGION
+
+  struct xnn_memory_usage memory_usage;
+  update_runtime_memory_usage(runtime, &memory_usage);
+
   *runtime_out = runtime;
   return xnn_status_success;
 
@@ -153,6 +589,249 @@ error:
   return status;
 }
 
+static bool has_immutable_weights(enum xnn_operator_type type)
+{
+  switch (type) {
+    case xnn_operator_type_convolution_nchw_f32:
+    case xnn_operator_type_convolution_nhwc_f16:
+    case xnn_operator_type_convolution_nhwc_f32:
+    case xnn_operator_type_convolution_nhwc_qc8:
+    case xnn_operator_type_convolution_nhwc_qs8:
+    case xnn_operator_type_convolution_nhwc_qu8:
+    case xnn_operator_type_convolution_nwc_f32:
+    case xnn_operator_type_deconvolution_nhwc_f16:
+    case xnn_operator_type_deconvolution_nhwc_f32:
+    case xnn_operator_type_deconvolution_nhwc_qs8:
+    case xnn_operator_type_deconvolution_nhwc_qu8:
+    case xnn_operator_type_elu_nc_qs8:
+    case xnn_operator_type_fully_connected_nc_f16:
+    case xnn_operator_type_fully_connected_nc_f32:
+    case xnn_operator_type_fully_connected_nc_qs8:
+    case xnn_operator_type_fully_connected_nc_qu8:
+    case xnn_operator_type_leaky_relu_nc_qu8:
+    case xnn_operator_type_prelu_nc_f16:
+    case xnn_operator_type_prelu_nc_f32:
+    case xnn_operator_type_sigmoid_nc_qs8:
+    case xnn_operator_type_sigmoid_nc_qu8:
+    case xnn_operator_type_softmax_nc_qu8:
+    case xnn_operator_type_tanh_nc_qs8:
+    case xnn_operator_type_tanh_nc_qu8:
+      return true;
+    default:
+      return false;
+  }
+}
+
+static bool recreates_zero_buffer(enum xnn_operator_type type)
+{
+  switch (type) {
+    case xnn_operator_type_convolution_nchw_f32:
+    case xnn_operator_type_max_nd_f32:
+    case xnn_operator_type_mean_nd_f16:
+    case xnn_operator_type_mean_nd_f32:
+    case xnn_operator_type_mean_nd_qs8:
+    case xnn_operator_type_min_nd_f32:
+    case xnn_operator_type_sum_nd_f16:
+    case xnn_operator_type_sum_nd_f32:
+    case xnn_operator_type_sum_nd_qs8:
+      return true;
+    default:
+      return false;
+  }
+}
+
+static enum xnn_status clone_operator(
+  const struct xnn_operator* op,
+  xnn_operator_t* clone_out)
+{
+  xnn_operator_t clone = xnn_allocate_zero_simd_memory(sizeof(struct xnn_operator));
+  if (clone == NULL) {
+    xnn_log_error("failed to allocate %zu bytes for %s operator descriptor",
+      sizeof(struct xnn_operator), xnn_operator_type_to_string(op->type));
+    return xnn_status_out_of_memory;
+  }
+  memcpy(clone, op, sizeof(struct xnn_operator));
+
+  // Packed weights, lookup tables, and JIT-generated code are immutable after operator creation (or deferred packing)
+  // only for some operators: e.g. Resize Bilinear re-creates its packed weights in setup. Clones of other operators
+  // start without weights and own what they allocate in setup.
+  clone->shares_weights = has_immutable_weights(op->type);
+  if (!clone->shares_weights) {
+    clone->packed_weights = NULL;
+    clone->lookup_table = NULL;
+  }
+  // Convolution in NCHW layout and Reduce operators re-create their zero buffer in setup, all other operators create it
+  // once.
+  clone->shares_zero_buffer = !recreates_zero_buffer(op->type);
+  if (!clone->shares_zero_buffer) {
+    clone->zero_buffer = NULL;
+  }
+
+  // Buffers derived from shapes and pointers of the input and output are re-created in the first setup of the clone.
+  clone->indirection_buffer = NULL;
+  clone->indirection_source = NULL;
+  clone->pixelwise_buffer = NULL;
+  clone->subconvolution_buffer = NULL;
+  clone->scratch_buffer = NULL;
+  clone->scratch_buffer_size = 0;
+  clone->valid_batch_size = 0;
+  clone->last_input_height = 0;
+  clone->last_input_width = 0;
+  clone->last_input = NULL;
+  clone->last_output_height = 0;
+  clone->last_output_width = 0;
+  clone->last_output = NULL;
+  clone->streaming.history = NULL;
+  clone->streaming.staging = NULL;
+  clone->streaming.staging_size = 0;
+  clone->streaming.batch_size = 0;
+  memset(clone->fused_operators, 0, sizeof(clone->fused_operators));
+  clone->state = xnn_run_state_invalid;
+
+  if (op->subconvolution_buffer != NULL) {
+    // Subconvolution parameters are initialized in operator creation, and updated in setup.
+    const size_t subconvolution_buffer_size =
+      sizeof(struct subconvolution_params) * op->stride_height * op->stride_width;
+    clone->subconvolution_buffer = xnn_allocate_memory(subconvolution_buffer_size);
+    if (clone->subconvolution_buffer == NULL) {
+      xnn_log_error("failed to allocate %zu bytes for %s operator subconvolution buffer",
+        subconvolution_buffer_size, xnn_operator_type_to_string(op->type));
+      xnn_delete_operator(clone);
+      return xnn_status_out_of_memory;
+    }
+    memcpy(clone->subconvolution_buffer, op->subconvolution_buffer, subconvolution_buffer_size);
+  }
+
+  for (size_t i = 0; i < XNN_COUNT_OF(op->fused_operators); i++) {
+    if (op->fused_operators[i] != NULL) {
+      const enum xnn_status status = clone_operator(op->fused_operators[i], &clone->fused_operators[i]);
+      if (status != xnn_status_success) {
+        xnn_delete_operator(clone);
+        return status;
+      }
+    }
+  }
+
+  *clone_out = clone;
+  return xnn_status_success;
+}
+
+enum xnn_status xnn_clone_runtime(
+  xnn_runtime_t runtime,
+  pthreadpool_t threadpool,
+  uint32_t flags,
+  xnn_runtime_t* runtime_out)
+{
+  struct xnn_runtime* clone = NULL;
+  enum xnn_status status = xnn_status_uninitialized;
+
+  if ((xnn_params.init_flags & XNN_INIT_FLAG_XNNPACK) == 0) {
+    xnn_log_error("failed to clone runtime: XNNPACK is not initialized");
+    goto error;
+  }
+
+  status = xnn_status_out_of_memory;
+
+  clone = xnn_allocate_zero_memory(sizeof(struct xnn_runtime));
+  if (clone == NULL) {
+    xnn_log_error("failed to allocate %zu bytes for runtime descriptor", sizeof(struct xnn_runtime));
+    goto error;
+  }
+
+  clone->opdata = xnn_allocate_zero_memory(sizeof(struct xnn_operator_data) * runtime->num_ops);
+  if (clone->opdata == NULL) {
+    xnn_log_error("failed to allocate %zu bytes for opdata descriptors",
+      sizeof(struct xnn_operator_data) * runtime->num_ops);
+    goto error;
+  }
+  clone->num_ops = runtime->num_ops;
+
+  for (size_t i = 0; i < runtime->num_ops; i++) {
+    // Clones borrow packed weights, so the weights must be packed before they are shared.
+    if (runtime->opdata[i].operator_object != NULL) {
+      xnn_pack_operator_weights(runtime->opdata[i].operator_object, threadpool);
+    }
+    clone->opdata[i] = runtime->opdata[i];
+    clone->opdata[i].operator_object = NULL;
+    if (runtime->opdata[i].operator_object != NULL) {
+      status = clone_operator(runtime->opdata[i].operator_object, &clone->opdata[i].operator_object);
+      if (status != xnn_status_success) {
+        goto error;
+      }
+    }
+  }
+  share_indirection_buffers(clone);
+
+  status = xnn_status_out_of_memory;
+
+  clone->blobs = xnn_allocate_zero_memory(sizeof(struct xnn_blob) * runtime->num_blobs);
+  if (clone->blobs == NULL) {
+    xnn_log_error("failed to allocate %zu bytes for blob descriptors",
+      sizeof(struct xnn_blob) * runtime->num_blobs);
+    goto error;
+  }
+  clone->num_blobs = runtime->num_blobs;
+  clone->num_external_values = runtime->num_external_values;
+
+  // The clone always gets a workspace of its own, otherwise it could not run concurrently with the original runtime.
+  status = xnn_create_workspace(&clone->workspace);
+  if (status != xnn_status_success) {
+    goto error;
+  }
+  if (runtime->workspace_size != 0) {
+    status = grow_workspace(clone->workspace, runtime->workspace_size, (flags & XNN_FLAG_HUGE_PAGES) != 0);
+    if (status != xnn_status_success) {
+      goto error;
+    }
+    clone->workspace_size = runtime->workspace_size;
+  }
+  clone->workspace->first_user = clone;
+
+  const uintptr_t workspace_start = (uintptr_t) runtime->workspace->data;
+  const uintptr_t workspace_end = workspace_start + runtime->workspace_size;
+  for (size_t i = 0; i < runtime->num_blobs; i++) {
+    const struct xnn_blob* blob = &runtime->blobs[i];
+    struct xnn_blob* cloned_blob = &clone->blobs[i];
+    cloned_blob->size = blob->size;
+    cloned_blob->external = blob->external;
+    cloned_blob->alias = blob->alias;
+    cloned_blob->alias_id = blob->alias_id;
+    cloned_blob->alias_offset = blob->alias_offset;
+    if (blob->external) {
+      // External values must be specified via a call to xnn_setup_runtime on the clone.
+      cloned_blob->data = NULL;
+    } else if ((uintptr_t) blob->data >= workspace_start && (uintptr_t) blob->data < workspace_end) {
+      // Intermediate value: same offset in the workspace of the clone.
+      cloned_blob->data = (void*) ((uintptr_t) clone->workspace->data + ((uintptr_t) blob->data - workspace_start));
+    } else {
+      // Static value: shared with the original runtime.
+      cloned_blob->data = blob->data;
+    }
+  }
+  bind_aliased_blobs(clone);
+
+  clone->threadpool = threadpool;
+
+#if XNN_HAVE_PARALLEL_REGION
+  status = create_parallel_region(clone, flags);
+  if (status != xnn_status_success) {
+    goto error;
+  }
+#else
+  (void) flags;
+#endif  // XNN_HAVE_PARALLEL_REGION
+
+  struct xnn_memory_usage memory_usage;
+  update_runtime_memory_usage(clone, &memory_usage);
+
+  *runtime_out = clone;
+  return xnn_status_success;
+
+error:
+  xnn_delete_runtime(clone);
+  return status;
+}
+
 enum xnn_status xnn_setup_runtime(
   xnn_runtime_t runtime,
   size_t num_external_values,
@@ -183,6 +862,7 @@ enum xnn_status xnn_setup_runtime(
     struct xnn_blob* blob = &runtime->blobs[value_id];
     blob->data = external_value->data;
   }
+  bind_aliased_blobs(runtime);
 
   for (size_t i = 0; i < runtime->num_ops; i++) {
     const struct xnn_operator_data* opdata = &runtime->opdata[i];
@@ -199,12 +879,122 @@ enum xnn_status xnn_setup_runtime(
     }
   }
 
+  struct xnn_memory_usage memory_usage;
+  update_runtime_memory_usage(runtime, &memory_usage);
   return xnn_status_success;
 }
 
+#if XNN_HAVE_PARALLEL_REGION
+// Tell the processor that the thread is spinning, so that it saves power and yields the resources of the core to its
+// sibling hardware threads, which may be the very threads the spinning thread waits for.
+static inline void spin_wait_hint(void)
+{
+  #if XNN_ARCH_X86 || XNN_ARCH_X86_64
+    __builtin_ia32_pause();
+  #elif XNN_ARCH_ARM || XNN_ARCH_ARM64
+    __asm__ __volatile__("yield");
+  #endif
+}
+
+// Wait until all tasks of a pass are complete, so that the next operator or pass can read their outputs.
+static void wait_parallel_region_pass(
+  struct xnn_parallel_region_pass* pass,
+  size_t num_tasks)
+{
+  while (__atomic_load_n(&pass->completed_tasks, __ATOMIC_ACQUIRE) < num_tasks) {
+    // Busy-wait: operators are expected to follow each other within microseconds.
+    spin_wait_hint();
+  }
+}
+
+// Executed once for every thread of the thread pool. Threads walk the execution plan together, dynamically claiming
+// chunks of the tasks of every operator, and wait until all tasks of an operator are complete before moving on to the
+// next operator.
+//
+// The thread pool is not guaranteed to run all items of the parallelization concurrently: e.g. the Grand Central
+// Dispatch backend of pthreadpool may run them on fewer threads, one after another. Hence threads never wait for each
+// other to arrive: a thread only waits for tasks which a running thread already claimed, and an item which starts late
+// joins the operator in progress, or returns right away if the others already finished the execution plan. Threads
+// claim their slots in the order they enter, rather than use the item index, so that operators capped at fewer threads
+// run on threads which actually entered the region.
+static void run_parallel_region(
+  struct xnn_runtime* runtime,
+  size_t item_index)
+{
+  struct xnn_parallel_region* region = runtime->parallel_region;
+  const size_t thread_slot = __atomic_fetch_add(&region->num_entered_threads, 1, __ATOMIC_RELAXED);
+  for (size_t i = 0; i < runtime->num_ops; i++) {
+    xnn_operator_t op = runtime->opdata[i].operator_object;
+    if (op == NULL) {
+      // Operator was removed after fusion
+      continue;
+    }
+
+    const struct compute_parameters* passes[2] = { &op->compute, &op->compute2 };
+    for (size_t pass = 0; pass < 2; pass++) {
+      const size_t num_tasks = xnn_get_operator_task_count(op, passes[pass]);
+      if (num_tasks == 0) {
+        continue;
+      }
+
+      // Threads beyond the number worth using for this operator skip straight to waiting for its completion.
+      struct xnn_parallel_region_pass* pass_progress = &region->passes[2 * i + pass];
+      const size_t num_threads = passes[pass]->num_threads == 0 ?
+        region->num_threads : min(passes[pass]->num_threads, region->num_threads);
+      if (thread_slot < num_threads) {
+        // Claim several tasks at a time to amortize the atomic operations, but keep enough chunks to balance load.
+        const size_t chunk_size = divide_round_up(num_tasks, num_threads * 4);
+        for (;;) {
+          const size_t task_start = __atomic_fetch_add(&pass_progress->claimed_tasks, chunk_size, __ATOMIC_RELAXED);
+          if (task_start >= num_tasks) {
+            break;
+          }
+          const size_t task_count = min(chunk_size, num_tasks - task_start);
+          xnn_run_operator_tasks(op, passes[pass], task_start, task_count);
+          __atomic_add_fetch(&pass_progress->completed_tasks, task_count, __ATOMIC_RELEASE);
+        }
+      }
+
+      // Outputs of this operator or pass must be complete before any thread reads them.
+      wait_parallel_region_pass(pass_progress, num_tasks);
+    }
+  }
+}
+
+static enum xnn_status invoke_parallel_region(
+  xnn_runtime_t runtime)
+{
+  struct xnn_parallel_region* region = runtime->parallel_region;
+  for (size_t i = 0; i < runtime->num_ops; i++) {
+    const xnn_operator_t op = runtime->opdata[i].operator_object;
+    if (op != NULL && op->state == xnn_run_state_invalid) {
+      xnn_log_error("failed to invoke runtime: operator #%zu was not successfully setup", i);
+      return xnn_status_invalid_state;
+    }
+    region->passes[2 * i] = (struct xnn_parallel_region_pass) { 0 };
+    region->passes[2 * i + 1] = (struct xnn_parallel_region_pass) { 0 };
+  }
+  region->num_entered_threads = 0;
+
+  pthreadpool_parallelize_1d(
+    runtime->threadpool,
+    (pthreadpool_task_1d_t) run_parallel_region,
+    runtime,
+    region->num_threads,
+    region->flags);
+  return xnn_status_success;
+}
+#endif  // XNN_HAVE_PARALLEL_REGION
+
 enum xnn_status xnn_invoke_runtime(
   xnn_runtime_t runtime)
 {
+#if XNN_HAVE_PARALLEL_REGION
+  if (runtime->parallel_region != NULL) {
+    return invoke_parallel_region(runtime);
+  }
+#endif  // XNN_HAVE_PARALLEL_REGION
+
   for (size_t i = 0; i < runtime->num_ops; i++) {
     if (runtime->opdata[i].operator_object == NULL) {
       // Operator was removed after fusion
@@ -230,8 +1020,20 @@ enum xnn_status xnn_delete_runtime(
       xnn_release_memory(runtime->opdata);
 
       xnn_release_memory(runtime->blobs);
-      xnn_release_simd_memory(runtime->workspace);
     }
+    if (runtime->workspace != NULL) {
+      // Unlink the runtime from the list of workspace users
+      struct xnn_runtime** user = &runtime->workspace->first_user;
+      while (*user != NULL) {
+        if (*user == runtime) {
+          *user = runtime->next_workspace_user;
+          break;
+        }
+        user = &(*user)->next_workspace_user;
+      }
+      xnn_release_workspace(runtime->workspace);
+    }
+    xnn_release_memory(runtime->parallel_region);
     xnn_release_memory(runtime);
   }
   return xnn_status_success;
@@ -72,12 +72,28 @@ const char* xnn_node_type_to_string(enum xnn_node_type type) {
       return "Sigmoid";
     case xnn_node_type_softmax:
       return "Softmax";
+    case xnn_node_type_space_to_depth:
+      return "Space To Depth";
     case xnn_node_type_static_constant_pad:
       return "Static Constant Pad";
+    case xnn_node_type_static_pad:
+      return "Static Pad";
+    case xnn_node_type_static_reduce_max:
+      return "Static Reduce Max";
+    case xnn_node_type_static_reduce_mean:
+      return "Static Reduce Mean";
+    case xnn_node_type_static_reduce_min:
+      return "Static Reduce Min";
+    case xnn_node_type_static_reduce_sum:
+      return "Static Reduce Sum";
     case xnn_node_type_static_reshape:
       return "Static Reshape";
     case xnn_node_type_static_resize_bilinear_2d:
       return "Static Resize Bilinear 2D";
+    case xnn_node_type_static_resize_nearest_2d:
+      return "Static Resize Nearest 2D";
+    case xnn_node_type_static_slice:
+      return "Static Slice";
     case xnn_node_type_square:
       return "Square";
     case xnn_node_type_square_root:
@@ -12,6 +12,7 @@
 
 #include <xnnpack.h>
 #include <xnnpack/allocator.h>
+#include <xnnpack/indirection.h>
 #include <xnnpack/log.h>
 #include <xnnpack/math.h>
 #include <xnnpack/params.h>
@@ -213,6 +214,40 @@ void xnn_subgraph_analyze_consumers_and_producers(xnn_subgraph_t subgraph)
 #define XNN_LAYOUT_FLAG_COMPATIBLE_NCHW2NHWC 4
 #define XNN_LAYOUT_FLAG_INCOMPATIBLE_CLUSTER 8
 
+// Check if a Depthwise Convolution Node has one of the shapes supported by the specialized NCHW micro-kernels.
+static bool is_nchw_specialized_depthwise_convolution(const struct xnn_node* node) {
+  if ((node->params.depthwise_convolution_2d.dilation_height | node->params.depthwise_convolution_2d.dilation_width) != 1) {
+    return false;
+  }
+  if (node->params.depthwise_convolution_2d.subsampling_height != node->params.depthwise_convolution_2d.subsampling_width) {
+    return false;
+  }
+  switch (node->params.depthwise_convolution_2d.subsampling_height) {
+    case 1:
+    case 2:
+      break;
+    default:
+      return false;
+  }
+  if (node->params.depthwise_convolution_2d.kernel_height != node->params.depthwise_convolution_2d.kernel_width) {
+    return false;
+  }
+  switch (node->params.depthwise_convolution_2d.kernel_height) {
+    case 3:
+      return node->params.depthwise_convolution_2d.input_padding_top == 1 &&
+             node->params.depthwise_convolution_2d.input_padding_right == 1 &&
+             node->params.depthwise_convolution_2d.input_padding_bottom == 1 &&
+             node->params.depthwise_convolution_2d.input_padding_left == 1;
+    case 5:
+      return node->params.depthwise_convolution_2d.input_padding_top == 2 &&
+             node->params.depthwise_convolution_2d.input_padding_right == 2 &&
+             node->params.depthwise_convolution_2d.input_padding_bottom == 2 &&
+             node->params.depthwise_convolution_2d.input_padding_left == 2;
+    default:
+      return false;
+  }
+}
+
 uint32_t xnn_check_nchw_compatibility(xnn_subgraph_t subgraph, struct xnn_node* node) {
   if (node->compute_type != xnn_compute_type_fp32) {
     return 0;
@@ -221,11 +256,17 @@ uint32_t xnn_check_nchw_compatibility(xnn_subgraph_t subgraph, struct xnn_node*
   switch (node->type) {
     case xnn_node_type_convolution_2d:
       // Supported cases:
-      // - 1x1 convolution (no stride, no dilation, no padding, no groups)
+      // - 1x1 convolution (no stride, no dilation, no padding, no groups, no fused residual addition)
       // - 3x3 stride-2 convolution (no dilation, padding 1 on each side, no groups, 3 input channels)
       if (node->params.convolution_2d.groups != 1) {
         return 0;
       }
+      if (node->flags & XNN_PADDING_MODE_FLAGS) {
+        return 0;
+      }
+      if (node->residual.fused) {
+        return 0;
+      }
       if ((node->params.convolution_2d.dilation_height | node->params.convolution_2d.dilation_width) != 1) {
         return 0;
       }
@@ -260,42 +301,19 @@ uint32_t xnn_check_nchw_compatibility(xnn_subgraph_t subgraph, struct xnn_node*
       // - 3x3 stride-2 convolution (no dilation, padding 1 on each side)
       // - 5x5 stride-1 convolution (no dilation, padding 2 on each side)
       // - 5x5 stride-2 convolution (no dilation, padding 2 on each side)
-      if ((node->params.depthwise_convolution_2d.dilation_height | node->params.depthwise_convolution_2d.dilation_width) != 1) {
-        return 0;
-      }
-      if (node->flags & XNN_FLAG_TENSORFLOW_SAME_PADDING) {
+      // - any other kernel size, stride, dilation, and explicit padding, through the generic dilated micro-kernel, but
+      //   only if the micro-kernel computes several output pixels at once: the scalar one-pixel micro-kernel is slower
+      //   than the NHWC depthwise convolution it would replace
+      if (node->flags & (XNN_FLAG_TENSORFLOW_SAME_PADDING | XNN_PADDING_MODE_FLAGS)) {
         return 0;
       }
       if (node->params.depthwise_convolution_2d.depth_multiplier != 1) {
         return 0;
       }
-      if (node->params.depthwise_convolution_2d.subsampling_height != node->params.depthwise_convolution_2d.subsampling_width) {
-        return 0;
-      }
-      switch (node->params.depthwise_convolution_2d.subsampling_height) {
-        case 1:
-        case 2:
-          break;
-        default:
-          return 0;
-      }
-      if (node->params.depthwise_convolution_2d.kernel_height != node->params.depthwise_convolution_2d.kernel_width) {
-        return 0;
-      }
-      switch (node->params.depthwise_convolution_2d.kernel_height) {
-        case 3:
-          return node->params.depthwise_convolution_2d.input_padding_top == 1 &&
-                 node->params.depthwise_convolution_2d.input_padding_right == 1 &&
-                 node->params.depthwise_convolution_2d.input_padding_bottom == 1 &&
-                 node->params.depthwise_convolution_2d.input_padding_left == 1 ? XNN_LAYOUT_FLAG_COMPATIBLE_NCHW : 0;
-        case 5:
-          return node->params.depthwise_convolution_2d.input_padding_top == 2 &&
-                 node->params.depthwise_convolution_2d.input_padding_right == 2 &&
-                 node->params.depthwise_convolution_2d.input_padding_bottom == 2 &&
-                 node->params.depthwise_convolution_2d.input_padding_left == 2 ? XNN_LAYOUT_FLAG_COMPATIBLE_NCHW : 0;
-        default:
-          return 0;
+      if (is_nchw_specialized_depthwise_convolution(node)) {
+        return XNN_LAYOUT_FLAG_COMPATIBLE_NCHW;
       }
+      return xnn_params.f32.dwconv2d_chw_dilated.output_width_tile > 1 ? XNN_LAYOUT_FLAG_COMPATIBLE_NCHW : 0;
     case xnn_node_type_depth_to_space:
       return XNN_LAYOUT_FLAG_COMPATIBLE_NCHW2NHWC;
     case xnn_node_type_global_average_pooling_2d:
@@ -340,6 +358,8 @@ uint32_t xnn_check_nchw_compatibility(xnn_subgraph_t subgraph, struct xnn_node*
     case xnn_node_type_static_resize_bilinear_2d:
       return subgraph->values[node->inputs[0]].shape.dim[1] > 1 &&
              subgraph->values[node->inputs[0]].shape.dim[2] > 1 ? XNN_LAYOUT_FLAG_COMPATIBLE_NCHW : 0;
+    case xnn_node_type_static_resize_nearest_2d:
+      return XNN_LAYOUT_FLAG_COMPATIBLE_NCHW;
     case xnn_node_type_abs:
     case xnn_node_type_bankers_rounding:
     case xnn_node_type_ceiling:
@@ -615,6 +635,7 @@ bool xnn_subgraph_rewrite_for_fp16(xnn_subgraph_t subgraph)
           }
         }
         break;
+      case xnn_node_type_average_pooling_2d:
       case xnn_node_type_clamp:
       case xnn_node_type_convolution_2d:
       case xnn_node_type_deconvolution_2d:
@@ -624,9 +645,13 @@ bool xnn_subgraph_rewrite_for_fp16(xnn_subgraph_t subgraph)
       case xnn_node_type_leaky_relu:
       case xnn_node_type_max_pooling_2d:
       case xnn_node_type_prelu:
+      case xnn_node_type_space_to_depth:
       case xnn_node_type_static_constant_pad:
+      case xnn_node_type_static_pad:
       case xnn_node_type_static_reshape:
       case xnn_node_type_static_resize_bilinear_2d:
+      case xnn_node_type_static_resize_nearest_2d:
+      case xnn_node_type_static_slice:
         break;
       default:
         xnn_log_warning("FP16 rewrite aborted: node #%" PRIu32 " (%s) is not supported for FP16 inference",
@@ -642,6 +667,12 @@ bool xnn_subgraph_rewrite_for_fp16(xnn_subgraph_t subgraph)
     struct xnn_node* node = &subgraph->nodes[n];
     switch (node->type) {
       case xnn_node_type_convolution_2d:
+        subgraph->values[node->inputs[0]].fp16_compatible = true;
+        subgraph->values[node->outputs[0]].fp16_compatible = true;
+        if (node->residual.fused) {
+          subgraph->values[node->inputs[node->num_inputs - 1]].fp16_compatible = true;
+        }
+        break;
       case xnn_node_type_deconvolution_2d:
       case xnn_node_type_depthwise_convolution_2d:
       case xnn_node_type_prelu:
@@ -801,6 +832,176 @@ bool xnn_subgraph_rewrite_for_fp16(xnn_subgraph_t subgraph)
   return true;
 }
 
+// Check if a static FP32 1x1 Convolution filter has at least 2/3rd of zeroes, i.e. could be profitable for sparse
+// inference.
+static bool is_sparse_filter(xnn_subgraph_t subgraph, uint32_t filter_id)
+{
+  const struct xnn_value* filter = &subgraph->values[filter_id];
+  if (filter->data == NULL || filter->shape.num_dims != 4) {
+    return false;
+  }
+
+  const size_t num_params = filter->shape.dim[0] * filter->shape.dim[3];
+  const float* data = (const float*) filter->data;
+  size_t num_zeroes = 0;
+  for (size_t i = 0; i < num_params; i++) {
+    num_zeroes += (size_t) (data[i] == 0.0f);
+  }
+  return num_zeroes * 3 > num_params * 2;
+}
+
+// Check if an Add Node can be fused into the Convolution 2D or Fully Connected Node producing one of its inputs.
+static bool is_fusible_residual_add(
+  xnn_subgraph_t subgraph,
+  uint32_t producer_id,
+  uint32_t consumer_id,
+  uint32_t value_id,
+  uint32_t residual_id)
+{
+  const struct xnn_node* producer = &subgraph->nodes[producer_id];
+  const struct xnn_node* consumer = &subgraph->nodes[consumer_id];
+  switch (producer->type) {
+    case xnn_node_type_convolution_2d:
+      // Convolutions with a single input and output channel per group use DWCONV or VMULCADDC micro-kernels,
+      // which don't support residual addition.
+      if (producer->params.convolution_2d.group_input_channels == 1 &&
+          producer->params.convolution_2d.group_output_channels == 1)
+      {
+        return false;
+      }
+      // Sparse 1x1 Convolutions are candidates for the NCHW rewrite, which doesn't support residual addition.
+      if (producer->compute_type == xnn_compute_type_fp32 && producer->params.convolution_2d.groups == 1 &&
+          max(producer->params.convolution_2d.kernel_height, producer->params.convolution_2d.kernel_width) == 1 &&
+          is_sparse_filter(subgraph, producer->inputs[1]))
+      {
+        return false;
+      }
+      break;
+    case xnn_node_type_fully_connected:
+      break;
+    default:
+      return false;
+  }
+  if (producer->residual.fused || producer->bottleneck.fused ||
+      producer->num_inputs >= XNN_MAX_INPUTS || producer->num_outputs != 1)
+  {
+    return false;
+  }
+
+  switch (producer->compute_type) {
+    case xnn_compute_type_fp32:
+    case xnn_compute_type_qs8:
+    case xnn_compute_type_qu8:
+      if (consumer->compute_type != producer->compute_type) {
+        return false;
+      }
+      break;
+    case xnn_compute_type_qc8:
+      if (consumer->compute_type != xnn_compute_type_qs8) {
+        return false;
+      }
+      break;
+    default:
+      return false;
+  }
+
+  const struct xnn_value* value = &subgraph->values[value_id];
+  const struct xnn_value* residual = &subgraph->values[residual_id];
+  const struct xnn_value* sum = &subgraph->values[consumer->outputs[0]];
+  if (residual_id == value_id || residual->data != NULL) {
+    return false;
+  }
+  // The residual must be computed before the fused Node executes.
+  if (residual->producer != XNN_INVALID_NODE_ID && residual->producer >= producer_id) {
+    return false;
+  }
+  // Broadcasting is not supported: all tensors must have the same shape.
+  if (residual->shape.num_dims != value->shape.num_dims || sum->shape.num_dims != value->shape.num_dims) {
+    return false;
+  }
+  for (size_t i = 0; i < value->shape.num_dims; i++) {
+    if (residual->shape.dim[i] != value->shape.dim[i] || sum->shape.dim[i] != value->shape.dim[i]) {
+      return false;
+    }
+  }
+  return true;
+}
+
+// Minimum size of the expanded tensor in an inverted bottleneck block for the depth-first execution to pay off.
+#define XNN_MIN_INVERTED_BOTTLENECK_INTERMEDIATE_SIZE (512 * 1024)
+
+static bool is_pointwise_convolution(const struct xnn_node* node) {
+  return node->type == xnn_node_type_convolution_2d &&
+    node->compute_type == xnn_compute_type_fp32 &&
+    node->params.convolution_2d.groups == 1 &&
+    node->params.convolution_2d.kernel_height == 1 &&
+    node->params.convolution_2d.kernel_width == 1 &&
+    node->params.convolution_2d.subsampling_height == 1 &&
+    node->params.convolution_2d.subsampling_width == 1 &&
+    (node->params.convolution_2d.input_padding_top | node->params.convolution_2d.input_padding_right |
+     node->params.convolution_2d.input_padding_bottom | node->params.convolution_2d.input_padding_left) == 0 &&
+    (node->flags & XNN_FLAG_TENSORFLOW_SAME_PADDING) == 0 &&
+    !node->residual.fused && !node->bottleneck.fused;
+}
+
+// Check if a Depthwise Convolution 2D Node and the 1x1 Convolution 2D Node consuming its output can be fused together
+// with the 1x1 Convolution 2D Node producing its input into an inverted bottleneck block. Returns the ID of the
+// expansion 1x1 Convolution 2D Node, or XNN_INVALID_NODE_ID if the Nodes can't be fused.
+static uint32_t find_fusible_inverted_bottleneck(
+  xnn_subgraph_t subgraph,
+  uint32_t depthwise_id,
+  uint32_t project_id)
+{
+  const struct xnn_node* depthwise = &subgraph->nodes[depthwise_id];
+  const struct xnn_node* project = &subgraph->nodes[project_id];
+  if (depthwise->type != xnn_node_type_depthwise_convolution_2d ||
+      depthwise->compute_type != xnn_compute_type_fp32 ||
+      depthwise->params.depthwise_convolution_2d.depth_multiplier != 1 ||
+      (depthwise->flags & (XNN_FLAG_TENSORFLOW_SAME_PADDING | XNN_PADDING_MODE_FLAGS)) != 0 ||
+      depthwise->num_inputs != 3)
+  {
+    return XNN_INVALID_NODE_ID;
+  }
+  if (!is_pointwise_convolution(project) || project->num_inputs != 3 ||
+      project->params.convolution_2d.group_input_channels != depthwise->params.depthwise_convolution_2d.input_channels)
+  {
+    return XNN_INVALID_NODE_ID;
+  }
+
+  // The fused block executes the Depthwise Convolution with a unipass DWCONV micro-kernel.
+  const size_t kernel_size =
+    depthwise->params.depthwise_convolution_2d.kernel_height * depthwise->params.depthwise_convolution_2d.kernel_width;
+  if (kernel_size == 1) {
+    return XNN_INVALID_NODE_ID;
+  }
+  bool has_dwconv_ukernel = false;
+  for (size_t i = 0; i < XNN_MAX_F32_DWCONV_UKERNELS; i++) {
+    has_dwconv_ukernel |= xnn_params.f32.dwconv[i].primary_tile == kernel_size;
+  }
+  if (!has_dwconv_ukernel) {
+    return XNN_INVALID_NODE_ID;
+  }
+
+  const uint32_t expanded_id = depthwise->inputs[0];
+  const struct xnn_value* expanded = &subgraph->values[expanded_id];
+  if (expanded->num_consumers != 1 || expanded->producer == XNN_INVALID_NODE_ID) {
+    return XNN_INVALID_NODE_ID;
+  }
+  const uint32_t expand_id = expanded->producer;
+  const struct xnn_node* expand = &subgraph->nodes[expand_id];
+  if (!is_pointwise_convolution(expand) || expand->num_outputs != 1 ||
+      expand->params.convolution_2d.group_output_channels != depthwise->params.depthwise_convolution_2d.input_channels)
+  {
+    return XNN_INVALID_NODE_ID;
+  }
+
+  // Depth-first execution only pays off when the expanded tensor doesn't fit into caches.
+  if (xnn_tensor_get_size(subgraph, expanded_id) < XNN_MIN_INVERTED_BOTTLENECK_INTERMEDIATE_SIZE) {
+    return XNN_INVALID_NODE_ID;
+  }
+  return expand_id;
+}
+
 enum xnn_status xnn_subgraph_optimize(
   xnn_subgraph_t subgraph,
   uint32_t flags)
@@ -864,10 +1065,22 @@ enum xnn_status xnn_subgraph_optimize(
             subgraph->values[fused_output_id].producer = producer_id;
             producer->outputs[0] = fused_output_id;
 
-            producer->activation.output_min =
-              math_max_f32(producer->activation.output_min, consumer->activation.output_min);
-            producer->activation.output_max =
-              math_min_f32(producer->activation.output_max, consumer->activation.output_max);
+            if (producer->bottleneck.fused) {
+              producer->bottleneck.output_min =
+                math_max_f32(producer->bottleneck.output_min, consumer->activation.output_min);
+              producer->bottleneck.output_max =
+                math_min_f32(producer->bottleneck.output_max, consumer->activation.output_max);
+            } else if (producer->residual.fused) {
+              producer->residual.output_min =
+                math_max_f32(producer->residual.output_min, consumer->activation.output_min);
+              producer->residual.output_max =
+                math_min_f32(producer->residual.output_max, consumer->activation.output_max);
+            } else {
+              producer->activation.output_min =
+                math_max_f32(producer->activation.output_min, consumer->activation.output_min);
+              producer->activation.output_max =
+                math_min_f32(producer->activation.output_max, consumer->activation.output_max);
+            }
 
             xnn_node_clear(consumer);
             xnn_value_clear(value);
@@ -876,6 +1089,79 @@ enum xnn_status xnn_subgraph_optimize(
             break;
         }
       }
+      // Try to fuse Add Node downstream into Convolution 2D or Fully Connected Node as a residual addition
+      if (consumer->type == xnn_node_type_add2) {
+        assert(consumer->num_inputs == 2);
+        assert(consumer->num_outputs == 1);
+        const uint32_t residual_id = consumer->inputs[0] == i ? consumer->inputs[1] : consumer->inputs[0];
+        if (is_fusible_residual_add(subgraph, producer_id, consumer_id, i, residual_id)) {
+          xnn_log_info("fuse Add Node #%"PRIu32" into upstream Node #%"PRIu32, consumer_id, producer_id);
+
+          producer->residual.fused = true;
+          producer->residual.zero_point = value->quantization.zero_point;
+          producer->residual.scale = value->quantization.scale;
+          producer->residual.output_min = consumer->activation.output_min;
+          producer->residual.output_max = consumer->activation.output_max;
+          producer->inputs[producer->num_inputs++] = residual_id;
+
+          if (subgraph->values[residual_id].first_consumer > producer_id) {
+            subgraph->values[residual_id].first_consumer = producer_id;
+          }
+
+          const uint32_t fused_output_id = consumer->outputs[0];
+          assert(fused_output_id < subgraph->num_values);
+          subgraph->values[fused_output_id].producer = producer_id;
+          producer->outputs[0] = fused_output_id;
+
+          xnn_node_clear(consumer);
+          xnn_value_clear(value);
+          continue;
+        }
+      }
+      // Try to fuse Depthwise Convolution 2D Node and downstream 1x1 Convolution 2D Node into upstream 1x1 Convolution
+      // 2D Node for depth-first execution of the inverted bottleneck block. Layout and FP16 rewrites don't support the
+      // fused block, so the fusion is skipped when they may be applied.
+      if ((flags & (XNN_FLAG_HINT_SPARSE_INFERENCE | XNN_FLAG_HINT_FP16_INFERENCE | XNN_FLAG_FORCE_FP16_INFERENCE)) == 0) {
+        const uint32_t expand_id = find_fusible_inverted_bottleneck(subgraph, producer_id, consumer_id);
+        if (expand_id != XNN_INVALID_NODE_ID) {
+          xnn_log_info("fuse Depthwise Convolution 2D Node #%"PRIu32" and Convolution 2D Node #%"PRIu32
+            " into upstream Convolution 2D Node #%"PRIu32, producer_id, consumer_id, expand_id);
+
+          struct xnn_node* expand = &subgraph->nodes[expand_id];
+          const uint32_t expanded_id = producer->inputs[0];
+          expand->bottleneck.fused = true;
+          expand->bottleneck.padding_top = producer->params.depthwise_convolution_2d.input_padding_top;
+          expand->bottleneck.padding_right = producer->params.depthwise_convolution_2d.input_padding_right;
+          expand->bottleneck.padding_bottom = producer->params.depthwise_convolution_2d.input_padding_bottom;
+          expand->bottleneck.padding_left = producer->params.depthwise_convolution_2d.input_padding_left;
+          expand->bottleneck.kernel_height = producer->params.depthwise_convolution_2d.kernel_height;
+          expand->bottleneck.kernel_width = producer->params.depthwise_convolution_2d.kernel_width;
+          expand->bottleneck.subsampling_height = producer->params.depthwise_convolution_2d.subsampling_height;
+          expand->bottleneck.subsampling_width = producer->params.depthwise_convolution_2d.subsampling_width;
+          expand->bottleneck.dilation_height = producer->params.depthwise_convolution_2d.dilation_height;
+          expand->bottleneck.dilation_width = producer->params.depthwise_convolution_2d.dilation_width;
+          expand->bottleneck.depthwise_filter_id = producer->inputs[1];
+          expand->bottleneck.depthwise_bias_id = producer->inputs[2];
+          expand->bottleneck.depthwise_output_min = producer->activation.output_min;
+          expand->bottleneck.depthwise_output_max = producer->activation.output_max;
+          expand->bottleneck.output_channels = consumer->params.convolution_2d.group_output_channels;
+          expand->bottleneck.project_filter_id = consumer->inputs[1];
+          expand->bottleneck.project_bias_id = consumer->inputs[2];
+          expand->bottleneck.output_min = consumer->activation.output_min;
+          expand->bottleneck.output_max = consumer->activation.output_max;
+
+          const uint32_t fused_output_id = consumer->outputs[0];
+          assert(fused_output_id < subgraph->num_values);
+          subgraph->values[fused_output_id].producer = expand_id;
+          expand->outputs[0] = fused_output_id;
+
+          xnn_node_clear(producer);
+          xnn_node_clear(consumer);
+          xnn_value_clear(&subgraph->values[expanded_id]);
+          xnn_value_clear(value);
+          continue;
+        }
+      }
       // Try to fuse Constant Pad node downstream into [Depthwise] Convolution 2D Node
       if (producer->type == xnn_node_type_static_constant_pad) {
         assert(producer->num_inputs == 1);
@@ -946,6 +1232,105 @@ enum xnn_status xnn_subgraph_optimize(
             break;
         }
       }
+      // Try to fuse reflect, symmetric, or edge Pad node downstream into [Depthwise] Convolution 2D Node, which
+      // replicates the input pixels through its indirection buffer instead of reading a padded copy of the input
+      if (producer->type == xnn_node_type_static_pad) {
+        assert(producer->num_inputs == 1);
+        assert(producer->num_outputs == 1);
+        const bool is_spatial_2d_padding = value->shape.num_dims == 4 &&
+          (producer->params.static_pad.pre_paddings[0] | producer->params.static_pad.post_paddings[0] |
+           producer->params.static_pad.pre_paddings[3] | producer->params.static_pad.post_paddings[3]) == 0;
+        const uint32_t padding_mode = producer->flags & XNN_PADDING_MODE_FLAGS;
+        uint32_t* input_padding_top = NULL;
+        uint32_t* input_padding_right = NULL;
+        uint32_t* input_padding_bottom = NULL;
+        uint32_t* input_padding_left = NULL;
+        switch (consumer->type) {
+          case xnn_node_type_convolution_2d:
+            input_padding_top = &consumer->params.convolution_2d.input_padding_top;
+            input_padding_right = &consumer->params.convolution_2d.input_padding_right;
+            input_padding_bottom = &consumer->params.convolution_2d.input_padding_bottom;
+            input_padding_left = &consumer->params.convolution_2d.input_padding_left;
+            break;
+          case xnn_node_type_depthwise_convolution_2d:
+            input_padding_top = &consumer->params.depthwise_convolution_2d.input_padding_top;
+            input_padding_right = &consumer->params.depthwise_convolution_2d.input_padding_right;
+            input_padding_bottom = &consumer->params.depthwise_convolution_2d.input_padding_bottom;
+            input_padding_left = &consumer->params.depthwise_convolution_2d.input_padding_left;
+            break;
+          default:
+            break;
+        }
+        // The replicated padding can't be combined with the zero padding of the Convolution itself.
+        if (input_padding_top != NULL && is_spatial_2d_padding && !consumer->bottleneck.fused &&
+            (*input_padding_top | *input_padding_right | *input_padding_bottom | *input_padding_left) == 0 &&
+            (consumer->flags & (XNN_FLAG_TENSORFLOW_SAME_PADDING | XNN_PADDING_MODE_FLAGS)) == 0)
+        {
+          xnn_log_info("fuse Pad Node #%"PRIu32" into %s Node #%"PRIu32,
+            producer_id, xnn_node_type_to_string(consumer->type), consumer_id);
+          assert(consumer->num_inputs >= 1);
+          assert(consumer->inputs[0] == producer->outputs[0]);
+
+          *input_padding_top = (uint32_t) producer->params.static_pad.pre_paddings[1];
+          *input_padding_right = (uint32_t) producer->params.static_pad.post_paddings[2];
+          *input_padding_bottom = (uint32_t) producer->params.static_pad.post_paddings[1];
+          *input_padding_left = (uint32_t) producer->params.static_pad.pre_paddings[2];
+          consumer->flags |= padding_mode;
+
+          consumer->inputs[0] = producer->inputs[0];
+
+          const uint32_t fused_input_id = producer->inputs[0];
+          assert(fused_input_id < subgraph->num_values);
+          if (subgraph->values[fused_input_id].first_consumer == producer_id) {
+            subgraph->values[fused_input_id].first_consumer = consumer_id;
+          }
+
+          xnn_node_clear(producer);
+          xnn_value_clear(value);
+        }
+      }
+      // Try to fuse Space To Depth Node downstream into 1x1 Convolution 2D Node. A 1x1 Convolution over the
+      // rearranged pixels is a block_size x block_size Convolution with block_size stride over the original input,
+      // and the [OC, 1, 1, block_size * block_size * IC] filter already has the [OC, block_size, block_size, IC] layout.
+      if (producer->type == xnn_node_type_space_to_depth && consumer->type == xnn_node_type_convolution_2d) {
+        assert(producer->num_inputs == 1);
+        assert(producer->num_outputs == 1);
+        const uint32_t block_size = producer->params.space_to_depth.block_size;
+        if (consumer->params.convolution_2d.kernel_height == 1 &&
+            consumer->params.convolution_2d.kernel_width == 1 &&
+            consumer->params.convolution_2d.subsampling_height == 1 &&
+            consumer->params.convolution_2d.subsampling_width == 1 &&
+            (consumer->params.convolution_2d.input_padding_top | consumer->params.convolution_2d.input_padding_right |
+             consumer->params.convolution_2d.input_padding_bottom | consumer->params.convolution_2d.input_padding_left) == 0 &&
+            consumer->params.convolution_2d.groups == 1 && !consumer->bottleneck.fused &&
+            (consumer->flags & (XNN_FLAG_TENSORFLOW_SAME_PADDING | XNN_PADDING_MODE_FLAGS)) == 0)
+        {
+          xnn_log_info("fuse Space To Depth Node #%"PRIu32" into Convolution 2D Node #%"PRIu32,
+            producer_id, consumer_id);
+          assert(consumer->num_inputs >= 1);
+          assert(consumer->inputs[0] == producer->outputs[0]);
+          assert(consumer->params.convolution_2d.group_input_channels % (block_size * block_size) == 0);
+
+          consumer->params.convolution_2d.kernel_height = block_size;
+          consumer->params.convolution_2d.kernel_width = block_size;
+          consumer->params.convolution_2d.subsampling_height = block_size;
+          consumer->params.convolution_2d.subsampling_width = block_size;
+          consumer->params.convolution_2d.dilation_height = 1;
+          consumer->params.convolution_2d.dilation_width = 1;
+          consumer->params.convolution_2d.group_input_channels /= block_size * block_size;
+
+          consumer->inputs[0] = producer->inputs[0];
+
+          const uint32_t fused_input_id = producer->inputs[0];
+          assert(fused_input_id < subgraph->num_values);
+          if (subgraph->values[fused_input_id].first_consumer == producer_id) {
+            subgraph->values[fused_input_id].first_consumer = consumer_id;
+          }
+
+          xnn_node_clear(producer);
+          xnn_value_clear(value);
+        }
+      }
     }
   }
 
@@ -3,6 +3,7 @@
 // This source code is licensed under the BSD-style license found in the
 // LICENSE file in the root directory of this source tree.
 
+#include <assert.h>
 #include <math.h>
 #include <stddef.h>
 #include <stdint.h>
@@ -202,6 +203,66 @@ static enum xnn_status setup_add_operator(
   }
 }
 
+enum xnn_status xnn_subgraph_fuse_residual_add(
+  const struct xnn_node* node,
+  const struct xnn_value* values,
+  uint32_t residual_id,
+  uint32_t output_id,
+  xnn_operator_t op)
+{
+  assert(node->residual.fused);
+
+  switch (node->compute_type) {
+    case xnn_compute_type_fp32:
+      return xnn_fuse_residual_add_f32(op, node->residual.output_min, node->residual.output_max);
+#ifndef XNN_NO_F16_OPERATORS
+    case xnn_compute_type_fp16:
+      return xnn_fuse_residual_add_f16(op, node->residual.output_min, node->residual.output_max);
+#endif  // !defined(XNN_NO_F16_OPERATORS)
+#ifndef XNN_NO_QS8_OPERATORS
+    case xnn_compute_type_qc8:
+    case xnn_compute_type_qs8:
+    {
+      const float output_scale = values[output_id].quantization.scale;
+      const int32_t output_zero_point = values[output_id].quantization.zero_point;
+      const int8_t output_min =
+        (int8_t) lrintf(fminf(fmaxf(node->residual.output_min / output_scale + (float) output_zero_point, -128.0f), 127.0f));
+      const int8_t output_max =
+        (int8_t) lrintf(fminf(fmaxf(node->residual.output_max / output_scale + (float) output_zero_point, -128.0f), 127.0f));
+      return xnn_fuse_residual_add_qs8(
+        op,
+        (int8_t) node->residual.zero_point,
+        node->residual.scale,
+        (int8_t) values[residual_id].quantization.zero_point,
+        values[residual_id].quantization.scale,
+        (int8_t) output_zero_point,
+        output_scale, output_min, output_max);
+    }
+#endif  // !defined(XNN_NO_QS8_OPERATORS)
+#ifndef XNN_NO_QU8_OPERATORS
+    case xnn_compute_type_qu8:
+    {
+      const float output_scale = values[output_id].quantization.scale;
+      const int32_t output_zero_point = values[output_id].quantization.zero_point;
+      const uint8_t output_min =
+        (uint8_t) lrintf(fminf(fmaxf(node->residual.output_min / output_scale + (float) output_zero_point, 0.0f), 255.0f));
+      const uint8_t output_max =
+        (uint8_t) lrintf(fminf(fmaxf(node->residual.output_max / output_scale + (float) output_zero_point, 0.0f), 255.0f));
+      return xnn_fuse_residual_add_qu8(
+        op,
+        (uint8_t) node->residual.zero_point,
+        node->residual.scale,
+        (uint8_t) values[residual_id].quantization.zero_point,
+        values[residual_id].quantization.scale,
+        (uint8_t) output_zero_point,
+        output_scale, output_min, output_max);
+    }
+#endif  // !defined(XNN_NO_QU8_OPERATORS)
+    default:
+      XNN_UNREACHABLE;
+  }
+}
+
 enum xnn_status xnn_define_add2(
   xnn_subgraph_t subgraph,
   float output_min,
@@ -19,8 +19,6 @@ static enum xnn_status create_average_pooling_operator(
   size_t num_values,
   struct xnn_operator_data* opdata)
 {
-  assert(node->compute_type == xnn_compute_type_fp32);
-
   assert(node->num_inputs == 1);
   const uint32_t input_id = node->inputs[0];
   assert(input_id != XNN_INVALID_VALUE_ID);
@@ -34,20 +32,101 @@ static enum xnn_status create_average_pooling_operator(
   const size_t channel_dim = values[input_id].shape.dim[3];
   assert(channel_dim == values[output_id].shape.dim[3]);
 
-  const enum xnn_status status = xnn_create_average_pooling2d_nhwc_f32(
-    node->params.pooling_2d.padding_top,
-    node->params.pooling_2d.padding_right,
-    node->params.pooling_2d.padding_bottom,
-    node->params.pooling_2d.padding_left,
-    node->params.pooling_2d.pooling_height,
-    node->params.pooling_2d.pooling_width,
-    node->params.pooling_2d.stride_height,
-    node->params.pooling_2d.stride_width,
-    channel_dim /* channels */, channel_dim /* input stride */, channel_dim /* output stride */,
-    node->activation.output_min,
-    node->activation.output_max,
-    node->flags,
-    &opdata->operator_object);
+  enum xnn_status status;
+  switch (node->compute_type) {
+#ifndef XNN_NO_F16_OPERATORS
+    case xnn_compute_type_fp16:
+      status = xnn_create_average_pooling2d_nhwc_f16(
+        node->params.pooling_2d.padding_top,
+        node->params.pooling_2d.padding_right,
+        node->params.pooling_2d.padding_bottom,
+        node->params.pooling_2d.padding_left,
+        node->params.pooling_2d.pooling_height,
+        node->params.pooling_2d.pooling_width,
+        node->params.pooling_2d.stride_height,
+        node->params.pooling_2d.stride_width,
+        channel_dim /* channels */, channel_dim /* input stride */, channel_dim /* output stride */,
+        node->activation.output_min,
+        node->activation.output_max,
+        node->flags,
+        &opdata->operator_object);
+      break;
+#endif  // !defined(XNN_NO_F16_OPERATORS)
+    case xnn_compute_type_fp32:
+      status = xnn_create_average_pooling2d_nhwc_f32(
+        node->params.pooling_2d.padding_top,
+        node->params.pooling_2d.padding_right,
+        node->params.pooling_2d.padding_bottom,
+        node->params.pooling_2d.padding_left,
+        node->params.pooling_2d.pooling_height,
+        node->params.pooling_2d.pooling_width,
+        node->params.pooling_2d.stride_height,
+        node->params.pooling_2d.stride_width,
+        channel_dim /* channels */, channel_dim /* input stride */, channel_dim /* output stride */,
+        node->activation.output_min,
+        node->activation.output_max,
+        node->flags,
+        &opdata->operator_object);
+      break;
+#ifndef XNN_NO_QS8_OPERATORS
+    case xnn_compute_type_qs8:
+    {
+      const float output_scale = values[output_id].quantization.scale;
+      const int32_t output_zero_point = values[output_id].quantization.zero_point;
+      const int8_t output_min =
+        (int8_t) lrintf(fminf(fmaxf(node->activation.output_min / output_scale + (float) output_zero_point, -128.0f), 127.0f));
+      const int8_t output_max =
+        (int8_t) lrintf(fminf(fmaxf(node->activation.output_max / output_scale + (float) output_zero_point, -128.0f), 127.0f));
+      status = xnn_create_average_pooling2d_nhwc_qs8(
+        node->params.pooling_2d.padding_top,
+        node->params.pooling_2d.padding_right,
+        node->params.pooling_2d.padding_bottom,
+        node->params.pooling_2d.padding_left,
+        node->params.pooling_2d.pooling_height,
+        node->params.pooling_2d.pooling_width,
+        node->params.pooling_2d.stride_height,
+        node->params.pooling_2d.stride_width,
+        channel_dim /* channels */, channel_dim /* input stride */, channel_dim /* output stride */,
+        (int8_t) values[input_id].quantization.zero_point, values[input_id].quantization.scale,
+        (int8_t) values[output_id].quantization.zero_point, values[output_id].quantization.scale,
+        output_min,
+        output_max,
+        node->flags,
+        &opdata->operator_object);
+      break;
+    }
+#endif  // !defined(XNN_NO_QS8_OPERATORS)
+#ifndef XNN_NO_QU8_OPERATORS
+    case xnn_compute_type_qu8:
+    {
+      const float output_scale = values[output_id].quantization.scale;
+      const int32_t output_zero_point = values[output_id].quantization.zero_point;
+      const uint8_t output_min =
+        (uint8_t) lrintf(fminf(fmaxf(node->activation.output_min / output_scale + (float) output_zero_point, 0.0f), 255.0f));
+      const uint8_t output_max =
+        (uint8_t) lrintf(fminf(fmaxf(node->activation.output_max / output_scale + (float) output_zero_point, 0.0f), 255.0f));
+      status = xnn_create_average_pooling2d_nhwc_qu8(
+        node->params.pooling_2d.padding_top,
+        node->params.pooling_2d.padding_right,
+        node->params.pooling_2d.padding_bottom,
+        node->params.pooling_2d.padding_left,
+        node->params.pooling_2d.pooling_height,
+        node->params.pooling_2d.pooling_width,
+        node->params.pooling_2d.stride_height,
+        node->params.pooling_2d.stride_width,
+        channel_dim /* channels */, channel_dim /* input stride */, channel_dim /* output stride */,
+        (uint8_t) values[input_id].quantization.zero_point, values[input_id].quantization.scale,
+        (uint8_t) values[output_id].quantization.zero_point, values[output_id].quantization.scale,
+        output_min,
+        output_max,
+        node->flags,
+        &opdata->operator_object);
+      break;
+    }
+#endif  // !defined(XNN_NO_QU8_OPERATORS)
+    default:
+      XNN_UNREACHABLE;
+  }
   if (status == xnn_status_success) {
     opdata->batch_size = values[input_id].shape.dim[0];
     opdata->input_height = values[input_id].shape.dim[1];
@@ -80,14 +159,52 @@ static enum xnn_status setup_average_pooling_operator(
   void* output_data = output_blob->data;
   assert(output_data != NULL);
 
-  return xnn_setup_average_pooling2d_nhwc_f32(
-    opdata->operator_object,
-    opdata->batch_size,
-    opdata->input_height,
-    opdata->input_width,
-    input_data,
-    output_data,
-    threadpool);
+  switch (opdata->operator_object->type) {
+#ifndef XNN_NO_F16_OPERATORS
+    case xnn_operator_type_average_pooling_nhwc_f16:
+      return xnn_setup_average_pooling2d_nhwc_f16(
+        opdata->operator_object,
+        opdata->batch_size,
+        opdata->input_height,
+        opdata->input_width,
+        input_data,
+        output_data,
+        threadpool);
+#endif  // !defined(XNN_NO_F16_OPERATORS)
+    case xnn_operator_type_average_pooling_nhwc_f32:
+      return xnn_setup_average_pooling2d_nhwc_f32(
+        opdata->operator_object,
+        opdata->batch_size,
+        opdata->input_height,
+        opdata->input_width,
+        input_data,
+        output_data,
+        threadpool);
+#ifndef XNN_NO_QS8_OPERATORS
+    case xnn_operator_type_average_pooling_nhwc_qs8:
+      return xnn_setup_average_pooling2d_nhwc_qs8(
+        opdata->operator_object,
+        opdata->batch_size,
+        opdata->input_height,
+        opdata->input_width,
+        input_data,
+        output_data,
+        threadpool);
+#endif  // !defined(XNN_NO_QS8_OPERATORS)
+#ifndef XNN_NO_QU8_OPERATORS
+    case xnn_operator_type_average_pooling_nhwc_qu8:
+      return xnn_setup_average_pooling2d_nhwc_qu8(
+        opdata->operator_object,
+        opdata->batch_size,
+        opdata->input_height,
+        opdata->input_width,
+        input_data,
+        output_data,
+        threadpool);
+#endif  // !defined(XNN_NO_QU8_OPERATORS)
+    default:
+      XNN_UNREACHABLE;
+  }
 }
 
 enum xnn_status xnn_define_average_pooling_2d(
@@ -186,6 +303,12 @@ enum xnn_status xnn_define_average_pooling_2d(
 
   switch (input_value->datatype) {
     case xnn_datatype_fp32:
+#ifndef XNN_NO_QS8_OPERATORS
+    case xnn_datatype_qint8:
+#endif  // !defined(XNN_NO_QS8_OPERATORS)
+#ifndef XNN_NO_QU8_OPERATORS
+    case xnn_datatype_quint8:
+#endif  // !defined(XNN_NO_QU8_OPERATORS)
       break;
     default:
       xnn_log_error(
@@ -210,9 +333,21 @@ enum xnn_status xnn_define_average_pooling_2d(
     return xnn_status_invalid_parameter;
   }
 
+  enum xnn_compute_type compute_type = xnn_compute_type_invalid;
   switch (output_value->datatype) {
     case xnn_datatype_fp32:
+      compute_type = xnn_compute_type_fp32;
+      break;
+#ifndef XNN_NO_QS8_OPERATORS
+    case xnn_datatype_qint8:
+      compute_type = xnn_compute_type_qs8;
+      break;
+#endif  // !defined(XNN_NO_QS8_OPERATORS)
+#ifndef XNN_NO_QU8_OPERATORS
+    case xnn_datatype_quint8:
+      compute_type = xnn_compute_type_qu8;
       break;
+#endif  // !defined(XNN_NO_QU8_OPERATORS)
     default:
       xnn_log_error(
         "failed to define %s operator with output ID #%" PRIu32 ": unsupported Value datatype %s (%d)",
@@ -221,13 +356,35 @@ enum xnn_status xnn_define_average_pooling_2d(
       return xnn_status_invalid_parameter;
   }
 
+  if (input_value->datatype != output_value->datatype) {
+    xnn_log_error(
+      "failed to define %s operator with input ID #%" PRIu32 " and output ID #%" PRIu32
+      ": mismatching datatypes across input (%s) and output (%s)",
+      xnn_node_type_to_string(xnn_node_type_average_pooling_2d), input_id, output_id,
+      xnn_datatype_to_string(input_value->datatype),
+      xnn_datatype_to_string(output_value->datatype));
+    return xnn_status_invalid_parameter;
+  }
+
+  // Quantized operators count padding pixels in the average, while floating-point operators and TensorFlow Lite
+  // exclude them, so quantized nodes would compute a different average near the borders of the input.
+  if (compute_type != xnn_compute_type_fp32 && (any_padding || (flags & XNN_FLAG_TENSORFLOW_SAME_PADDING) != 0)) {
+    xnn_log_error(
+      "failed to define %s operator with %" PRIu32 "+%" PRIu32 "x%" PRIu32 "+%" PRIu32" padding and 0x%08" PRIx32
+      " flags: padding is not supported for quantized datatype %s",
+      xnn_node_type_to_string(xnn_node_type_average_pooling_2d),
+      input_padding_top, input_padding_left, input_padding_bottom, input_padding_right, flags,
+      xnn_datatype_to_string(output_value->datatype));
+    return xnn_status_unsupported_parameter;
+  }
+
   struct xnn_node* node = xnn_subgraph_new_node(subgraph);
   if (node == NULL) {
     return xnn_status_out_of_memory;
   }
 
   node->type = xnn_node_type_average_pooling_2d;
-  node->compute_type = xnn_compute_type_fp32;
+  node->compute_type = compute_type;
   node->params.pooling_2d.padding_top = input_padding_top;
   node->params.pooling_2d.padding_right = input_padding_right;
   node->params.pooling_2d.padding_bottom = input_padding_bottom;
@@ -9,18 +9,131 @@
 
 #include <xnnpack.h>
 #include <xnnpack/log.h>
+#include <xnnpack/operator.h>
 #include <xnnpack/params.h>
 #include <xnnpack/subgraph.h>
 
 
+static enum xnn_status create_inverted_bottleneck_operator(
+  const struct xnn_node* node,
+  const struct xnn_value* values,
+  size_t num_values,
+  struct xnn_operator_data* opdata)
+{
+  assert(node->compute_type == xnn_compute_type_fp32);
+  assert(node->num_inputs == 3);
+  const uint32_t input_id = node->inputs[0];
+  assert(input_id != XNN_INVALID_VALUE_ID);
+  assert(input_id < num_values);
+  const uint32_t filter_id = node->inputs[1];
+  assert(filter_id != XNN_INVALID_VALUE_ID);
+  assert(filter_id < num_values);
+  const uint32_t bias_id = node->inputs[2];
+  assert(bias_id != XNN_INVALID_VALUE_ID);
+  assert(bias_id < num_values);
+  assert(node->bottleneck.depthwise_filter_id < num_values);
+  assert(node->bottleneck.depthwise_bias_id < num_values);
+  assert(node->bottleneck.project_filter_id < num_values);
+  assert(node->bottleneck.project_bias_id < num_values);
+
+  assert(node->num_outputs == 1);
+  const uint32_t output_id = node->outputs[0];
+  assert(output_id != XNN_INVALID_VALUE_ID);
+  assert(output_id < num_values);
+
+  const size_t input_channels = node->params.convolution_2d.group_input_channels;
+  const size_t channels = node->params.convolution_2d.group_output_channels;
+  const size_t output_channels = node->bottleneck.output_channels;
+
+  xnn_operator_t expand_op = NULL;
+  xnn_operator_t depthwise_op = NULL;
+  xnn_operator_t project_op = NULL;
+  enum xnn_status status = xnn_create_convolution2d_nhwc_f32(
+    0, 0, 0, 0 /* padding */,
+    1, 1 /* kernel size */,
+    1, 1 /* subsampling */,
+    1, 1 /* dilation */,
+    1 /* groups */, input_channels, channels,
+    input_channels /* input_pixel_stride */, channels /* output_pixel_stride */,
+    values[filter_id].data, values[bias_id].data,
+    node->activation.output_min, node->activation.output_max,
+    0 /* flags */,
+    &expand_op);
+  if (status != xnn_status_success) {
+    goto error;
+  }
+
+  status = xnn_create_convolution2d_nhwc_f32(
+    node->bottleneck.padding_top, node->bottleneck.padding_right,
+    node->bottleneck.padding_bottom, node->bottleneck.padding_left,
+    node->bottleneck.kernel_height, node->bottleneck.kernel_width,
+    node->bottleneck.subsampling_height, node->bottleneck.subsampling_width,
+    node->bottleneck.dilation_height, node->bottleneck.dilation_width,
+    channels /* groups */, 1 /* group_input_channels */, 1 /* group_output_channels */,
+    channels /* input_pixel_stride */, channels /* output_pixel_stride */,
+    values[node->bottleneck.depthwise_filter_id].data, values[node->bottleneck.depthwise_bias_id].data,
+    node->bottleneck.depthwise_output_min, node->bottleneck.depthwise_output_max,
+    XNN_FLAG_DEPTHWISE_CONVOLUTION,
+    &depthwise_op);
+  if (status != xnn_status_success) {
+    goto error;
+  }
+
+  status = xnn_create_convolution2d_nhwc_f32(
+    0, 0, 0, 0 /* padding */,
+    1, 1 /* kernel size */,
+    1, 1 /* subsampling */,
+    1, 1 /* dilation */,
+    1 /* groups */, channels, output_channels,
+    channels /* input_pixel_stride */, output_channels /* output_pixel_stride */,
+    values[node->bottleneck.project_filter_id].data, values[node->bottleneck.project_bias_id].data,
+    node->bottleneck.output_min, node->bottleneck.output_max,
+    0 /* flags */,
+    &project_op);
+  if (status != xnn_status_success) {
+    goto error;
+  }
+
+  status = xnn_create_inverted_bottleneck_nhwc_f32(
+    expand_op, depthwise_op, project_op, 0 /* flags */, &opdata->operator_object);
+  if (status != xnn_status_success) {
+    goto error;
+  }
+
+  opdata->batch_size = values[input_id].shape.dim[0];
+  opdata->input_height = values[input_id].shape.dim[1];
+  opdata->input_width = values[input_id].shape.dim[2];
+  opdata->inputs[0] = input_id;
+  opdata->outputs[0] = output_id;
+  return xnn_status_success;
+
+error:
+  if (expand_op != NULL) {
+    xnn_delete_operator(expand_op);
+  }
+  if (depthwise_op != NULL) {
+    xnn_delete_operator(depthwise_op);
+  }
+  if (project_op != NULL) {
+    xnn_delete_operator(project_op);
+  }
+  return status;
+}
+
 static enum xnn_status create_convolution_operator(
   const struct xnn_node* node,
   const struct xnn_value* values,
   size_t num_values,
   struct xnn_operator_data* opdata)
 {
-  assert(node->num_inputs >= 2);
-  assert(node->num_inputs <= 3);
+  if (node->bottleneck.fused) {
+    return create_inverted_bottleneck_operator(node, values, num_values, opdata);
+  }
+
+  // Residual tensor of a fused Add Node, if any, is the last input.
+  const uint32_t num_inputs = node->num_inputs - (uint32_t) node->residual.fused;
+  assert(num_inputs >= 2);
+  assert(num_inputs <= 3);
   const uint32_t input_id = node->inputs[0];
   assert(input_id != XNN_INVALID_VALUE_ID);
   assert(input_id < num_values);
@@ -37,7 +150,7 @@ static enum xnn_status create_convolution_operator(
   assert(filter_data != NULL);
 
   const void* bias_data = NULL;
-  if (node->num_inputs > 2) {
+  if (num_inputs > 2) {
     const uint32_t bias_id = node->inputs[2];
     assert(bias_id != XNN_INVALID_VALUE_ID);
     assert(bias_id < num_values);
@@ -128,8 +241,11 @@ static enum xnn_status create_convolution_operator(
 #ifndef XNN_NO_QS8_OPERATORS
       case xnn_compute_type_qs8:
       {
-        const float output_scale = values[output_id].quantization.scale;
-        const int32_t output_zero_point = values[output_id].quantization.zero_point;
+        // With fused residual addition, the convolution produces the quantization of the fused-away Add input.
+        const float output_scale =
+          node->residual.fused ? node->residual.scale : values[output_id].quantization.scale;
+        const int32_t output_zero_point =
+          node->residual.fused ? node->residual.zero_point : values[output_id].quantization.zero_point;
         const int8_t output_min =
           (int8_t) lrintf(fminf(fmaxf(node->activation.output_min / output_scale + (float) output_zero_point, -128.0f), 127.0f));
         const int8_t output_max =
@@ -163,8 +279,11 @@ static enum xnn_status create_convolution_operator(
       }
       case xnn_compute_type_qc8:
       {
-        const float output_scale = values[output_id].quantization.scale;
-        const int32_t output_zero_point = values[output_id].quantization.zero_point;
+        // With fused residual addition, the convolution produces the quantization of the fused-away Add input.
+        const float output_scale =
+          node->residual.fused ? node->residual.scale : values[output_id].quantization.scale;
+        const int32_t output_zero_point =
+          node->residual.fused ? node->residual.zero_point : values[output_id].quantization.zero_point;
         const int8_t output_min =
           (int8_t) lrintf(fminf(fmaxf(node->activation.output_min / output_scale + (float) output_zero_point, -128.0f), 127.0f));
         const int8_t output_max =
@@ -200,8 +319,11 @@ static enum xnn_status create_convolution_operator(
 #ifndef XNN_NO_QU8_OPERATORS
       case xnn_compute_type_qu8:
       {
-        const float output_scale = values[output_id].quantization.scale;
-        const int32_t output_zero_point = values[output_id].quantization.zero_point;
+        // With fused residual addition, the convolution produces the quantization of the fused-away Add input.
+        const float output_scale =
+          node->residual.fused ? node->residual.scale : values[output_id].quantization.scale;
+        const int32_t output_zero_point =
+          node->residual.fused ? node->residual.zero_point : values[output_id].quantization.zero_point;
         const uint8_t output_min =
           (uint8_t) lrintf(fminf(fmaxf(node->activation.output_min / output_scale + (float) output_zero_point, 0.0f), 255.0f));
         const uint8_t output_max =
@@ -239,6 +361,15 @@ static enum xnn_status create_convolution_operator(
         XNN_UNREACHABLE;
     }
   }
+  if (status == xnn_status_success && node->residual.fused) {
+    const uint32_t residual_id = node->inputs[node->num_inputs - 1];
+    assert(residual_id != XNN_INVALID_VALUE_ID);
+    assert(residual_id < num_values);
+    status = xnn_subgraph_fuse_residual_add(node, values, residual_id, output_id, opdata->operator_object);
+    if (status == xnn_status_success) {
+      opdata->inputs[1] = residual_id;
+    }
+  }
   if (status == xnn_status_success) {
     opdata->batch_size = values[input_id].shape.dim[0];
     opdata->input_height = values[input_id].shape.dim[1];
@@ -271,6 +402,22 @@ static enum xnn_status setup_convolution_operator(
   void* output_data = output_blob->data;
   assert(output_data != NULL);
 
+  if (opdata->operator_object->residual_ukernel != NULL) {
+    const uint32_t residual_id = opdata->inputs[1];
+    assert(residual_id != XNN_INVALID_VALUE_ID);
+    assert(residual_id < num_blobs);
+
+    const void* residual_data = blobs[residual_id].data;
+    assert(residual_data != NULL);
+
+    const enum xnn_status status = xnn_setup_residual_add(
+      opdata->operator_object, residual_data,
+      opdata->operator_object->groups * opdata->operator_object->group_output_channels);
+    if (status != xnn_status_success) {
+      return status;
+    }
+  }
+
   switch (opdata->operator_object->type) {
     case xnn_operator_type_convolution_nchw_f32:
       return xnn_setup_convolution2d_nchw_f32(
@@ -282,6 +429,16 @@ static enum xnn_status setup_convolution_operator(
         output_data,
         threadpool);
       break;
+    case xnn_operator_type_inverted_bottleneck_nhwc_f32:
+      return xnn_setup_inverted_bottleneck_nhwc_f32(
+        opdata->operator_object,
+        opdata->batch_size,
+        opdata->input_height,
+        opdata->input_width,
+        input_data,
+        output_data,
+        threadpool);
+      break;
     case xnn_operator_type_convolution_nhwc_f32:
       return xnn_setup_convolution2d_nhwc_f32(
         opdata->operator_object,
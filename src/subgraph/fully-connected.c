@@ -9,6 +9,7 @@
 
 #include <xnnpack.h>
 #include <xnnpack/log.h>
+#include <xnnpack/operator.h>
 #include <xnnpack/params.h>
 #include <xnnpack/subgraph.h>
 
@@ -19,8 +20,10 @@ static enum xnn_status create_fully_connected_operator(
   size_t num_values,
   struct xnn_operator_data* opdata)
 {
-  assert(node->num_inputs >= 2);
-  assert(node->num_inputs <= 3);
+  // Residual tensor of a fused Add Node, if any, is the last input.
+  const uint32_t num_inputs = node->num_inputs - (uint32_t) node->residual.fused;
+  assert(num_inputs >= 2);
+  assert(num_inputs <= 3);
   const uint32_t input_id = node->inputs[0];
   assert(input_id != XNN_INVALID_VALUE_ID);
   assert(input_id < num_values);
@@ -47,7 +50,7 @@ static enum xnn_status create_fully_connected_operator(
   assert(filter_data != NULL);
 
   const void* bias_data = NULL;
-  if (node->num_inputs > 2) {
+  if (num_inputs > 2) {
     const uint32_t bias_id = node->inputs[2];
     assert(bias_id != XNN_INVALID_VALUE_ID);
     assert(bias_id < num_values);
@@ -74,8 +77,11 @@ static enum xnn_status create_fully_connected_operator(
 #ifndef XNN_NO_QS8_OPERATORS
     case xnn_compute_type_qs8:
     {
-      const float output_scale = values[output_id].quantization.scale;
-      const int32_t output_zero_point = values[output_id].quantization.zero_point;
+      // With fused residual addition, the operator produces the quantization of the fused-away Add input.
+      const float output_scale =
+        node->residual.fused ? node->residual.scale : values[output_id].quantization.scale;
+      const int32_t output_zero_point =
+        node->residual.fused ? node->residual.zero_point : values[output_id].quantization.zero_point;
       const int8_t output_min =
         (int8_t) lrintf(fminf(fmaxf(node->activation.output_min / output_scale + (float) output_zero_point, -128.0f), 127.0f));
       const int8_t output_max =
@@ -100,8 +106,11 @@ static enum xnn_status create_fully_connected_operator(
 #ifndef XNN_NO_QU8_OPERATORS
     case xnn_compute_type_qu8:
     {
-      const float output_scale = values[output_id].quantization.scale;
-      const int32_t output_zero_point = values[output_id].quantization.zero_point;
+      // With fused residual addition, the operator produces the quantization of the fused-away Add input.
+      const float output_scale =
+        node->residual.fused ? node->residual.scale : values[output_id].quantization.scale;
+      const int32_t output_zero_point =
+        node->residual.fused ? node->residual.zero_point : values[output_id].quantization.zero_point;
       const uint8_t output_min =
         (uint8_t) lrintf(fminf(fmaxf(node->activation.output_min / output_scale + (float) output_zero_point, 0.0f), 255.0f));
       const uint8_t output_max =
@@ -127,6 +136,15 @@ static enum xnn_status create_fully_connected_operator(
     default:
       XNN_UNREACHABLE;
   }
+  if (status == xnn_status_success && node->residual.fused) {
+    const uint32_t residual_id = node->inputs[node->num_inputs - 1];
+    assert(residual_id != XNN_INVALID_VALUE_ID);
+    assert(residual_id < num_values);
+    status = xnn_subgraph_fuse_residual_add(node, values, residual_id, output_id, opdata->operator_object);
+    if (status == xnn_status_success) {
+      opdata->inputs[1] = residual_id;
+    }
+  }
   if (status == xnn_status_success) {
     opdata->batch_size = num_input_elements / input_channels;
     opdata->inputs[0] = input_id;
@@ -157,6 +175,21 @@ static enum xnn_status setup_fully_connected_operator(
   void* output_data = output_blob->data;
   assert(output_data != NULL);
 
+  if (opdata->operator_object->residual_ukernel != NULL) {
+    const uint32_t residual_id = opdata->inputs[1];
+    assert(residual_id != XNN_INVALID_VALUE_ID);
+    assert(residual_id < num_blobs);
+
+    const void* residual_data = blobs[residual_id].data;
+    assert(residual_data != NULL);
+
+    const enum xnn_status status = xnn_setup_residual_add(
+      opdata->operator_object, residual_data, opdata->operator_object->group_output_channels);
+    if (status != xnn_status_success) {
+      return status;
+    }
+  }
+
   switch (opdata->operator_object->type) {
     case xnn_operator_type_fully_connected_nc_f32:
       return xnn_setup_fully_connected_nc_f32(
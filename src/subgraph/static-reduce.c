@@ -0,0 +1,385 @@
+// Copyright 2022 Google LLC
+//
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree.
+
+#include <math.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+#include <xnnpack.h>
+#include <xnnpack/log.h>
+#include <xnnpack/params.h>
+#include <xnnpack/subgraph.h>
+
+
+static enum xnn_status create_reduce_operator(
+  const struct xnn_node* node,
+  const struct xnn_value* values,
+  size_t num_values,
+  struct xnn_operator_data* opdata)
+{
+  assert(node->num_inputs == 1);
+  const uint32_t input_id = node->inputs[0];
+  assert(input_id != XNN_INVALID_VALUE_ID);
+  assert(input_id < num_values);
+
+  assert(node->num_outputs == 1);
+  const uint32_t output_id = node->outputs[0];
+  assert(output_id != XNN_INVALID_VALUE_ID);
+  assert(output_id < num_values);
+
+  enum xnn_status status;
+  switch (node->compute_type) {
+    case xnn_compute_type_fp32:
+      switch (node->type) {
+        case xnn_node_type_static_reduce_max:
+          status = xnn_create_max_nd_f32(node->flags, &opdata->operator_object);
+          break;
+        case xnn_node_type_static_reduce_mean:
+          status = xnn_create_mean_nd_f32(node->flags, &opdata->operator_object);
+          break;
+        case xnn_node_type_static_reduce_min:
+          status = xnn_create_min_nd_f32(node->flags, &opdata->operator_object);
+          break;
+        case xnn_node_type_static_reduce_sum:
+          status = xnn_create_sum_nd_f32(node->flags, &opdata->operator_object);
+          break;
+        default:
+          XNN_UNREACHABLE;
+      }
+      break;
+#ifndef XNN_NO_QS8_OPERATORS
+    case xnn_compute_type_qs8:
+    {
+      const int8_t input_zero_point = (int8_t) values[input_id].quantization.zero_point;
+      const float input_scale = values[input_id].quantization.scale;
+      const int8_t output_zero_point = (int8_t) values[output_id].quantization.zero_point;
+      const float output_scale = values[output_id].quantization.scale;
+      switch (node->type) {
+        case xnn_node_type_static_reduce_mean:
+          status = xnn_create_mean_nd_qs8(
+            input_zero_point, input_scale, output_zero_point, output_scale,
+            node->flags, &opdata->operator_object);
+          break;
+        case xnn_node_type_static_reduce_sum:
+          status = xnn_create_sum_nd_qs8(
+            input_zero_point, input_scale, output_zero_point, output_scale,
+            node->flags, &opdata->operator_object);
+          break;
+        default:
+          XNN_UNREACHABLE;
+      }
+      break;
+    }
+#endif  // !defined(XNN_NO_QS8_OPERATORS)
+    default:
+      XNN_UNREACHABLE;
+  }
+  if (status == xnn_status_success) {
+    opdata->shape1 = values[input_id].shape;
+    opdata->num_reduction_axes = node->params.reduce.num_reduction_axes;
+    memcpy(opdata->reduction_axes, node->params.reduce.reduction_axes, sizeof(size_t) * XNN_MAX_TENSOR_DIMS);
+    opdata->inputs[0] = input_id;
+    opdata->outputs[0] = output_id;
+  }
+  return status;
+}
+
+static enum xnn_status setup_reduce_operator(
+  const struct xnn_operator_data* opdata,
+  const struct xnn_blob* blobs,
+  size_t num_blobs,
+  pthreadpool_t threadpool)
+{
+  const uint32_t input_id = opdata->inputs[0];
+  assert(input_id != XNN_INVALID_VALUE_ID);
+  assert(input_id < num_blobs);
+
+  const uint32_t output_id = opdata->outputs[0];
+  assert(output_id != XNN_INVALID_VALUE_ID);
+  assert(output_id < num_blobs);
+
+  const struct xnn_blob* input_blob = blobs + input_id;
+  const void* input_data = input_blob->data;
+  assert(input_data != NULL);
+
+  const struct xnn_blob* output_blob = blobs + output_id;
+  void* output_data = output_blob->data;
+  assert(output_data != NULL);
+
+  switch (opdata->operator_object->type) {
+    case xnn_operator_type_max_nd_f32:
+      return xnn_setup_max_nd_f32(
+        opdata->operator_object,
+        opdata->num_reduction_axes,
+        opdata->reduction_axes,
+        opdata->shape1.num_dims,
+        opdata->shape1.dim,
+        input_data,
+        output_data,
+        threadpool);
+    case xnn_operator_type_mean_nd_f32:
+      return xnn_setup_mean_nd_f32(
+        opdata->operator_object,
+        opdata->num_reduction_axes,
+        opdata->reduction_axes,
+        opdata->shape1.num_dims,
+        opdata->shape1.dim,
+        input_data,
+        output_data,
+        threadpool);
+    case xnn_operator_type_min_nd_f32:
+      return xnn_setup_min_nd_f32(
+        opdata->operator_object,
+        opdata->num_reduction_axes,
+        opdata->reduction_axes,
+        opdata->shape1.num_dims,
+        opdata->shape1.dim,
+        input_data,
+        output_data,
+        threadpool);
+    case xnn_operator_type_sum_nd_f32:
+      return xnn_setup_sum_nd_f32(
+        opdata->operator_object,
+        opdata->num_reduction_axes,
+        opdata->reduction_axes,
+        opdata->shape1.num_dims,
+        opdata->shape1.dim,
+        input_data,
+        output_data,
+        threadpool);
+#ifndef XNN_NO_QS8_OPERATORS
+    case xnn_operator_type_mean_nd_qs8:
+      return xnn_setup_mean_nd_qs8(
+        opdata->operator_object,
+        opdata->num_reduction_axes,
+        opdata->reduction_axes,
+        opdata->shape1.num_dims,
+        opdata->shape1.dim,
+        input_data,
+        output_data,
+        threadpool);
+    case xnn_operator_type_sum_nd_qs8:
+      return xnn_setup_sum_nd_qs8(
+        opdata->operator_object,
+        opdata->num_reduction_axes,
+        opdata->reduction_axes,
+        opdata->shape1.num_dims,
+        opdata->shape1.dim,
+        input_data,
+        output_data,
+        threadpool);
+#endif  // !defined(XNN_NO_QS8_OPERATORS)
+    default:
+      XNN_UNREACHABLE;
+  }
+}
+
+static enum xnn_status define_static_reduce(
+  xnn_subgraph_t subgraph,
+  enum xnn_node_type node_type,
+  size_t num_reduction_axes,
+  const size_t* reduction_axes,
+  uint32_t input_id,
+  uint32_t output_id,
+  uint32_t flags)
+{
+  if ((xnn_params.init_flags & XNN_INIT_FLAG_XNNPACK) == 0) {
+    xnn_log_error("failed to define %s operator: XNNPACK is not initialized",
+      xnn_node_type_to_string(node_type));
+    return xnn_status_uninitialized;
+  }
+
+  if (input_id >= subgraph->num_values) {
+    xnn_log_error(
+      "failed to define %s operator with input ID #%" PRIu32 ": invalid Value ID",
+      xnn_node_type_to_string(node_type), input_id);
+    return xnn_status_invalid_parameter;
+  }
+
+  const struct xnn_value* input_value = &subgraph->values[input_id];
+  if (input_value->type != xnn_value_type_dense_tensor) {
+    xnn_log_error(
+      "failed to define %s operator with input ID #%" PRIu32 ": unsupported Value type %d (expected dense tensor)",
+      xnn_node_type_to_string(node_type), input_id, input_value->type);
+    return xnn_status_invalid_parameter;
+  }
+
+  // Max and Min reductions are only implemented for FP32 tensors.
+  switch (input_value->datatype) {
+    case xnn_datatype_fp32:
+      break;
+#ifndef XNN_NO_QS8_OPERATORS
+    case xnn_datatype_qint8:
+      if (node_type == xnn_node_type_static_reduce_mean || node_type == xnn_node_type_static_reduce_sum) {
+        break;
+      }
+      xnn_log_error(
+        "failed to define %s operator with input ID #%" PRIu32 ": unsupported Value datatype %s (%d)",
+        xnn_node_type_to_string(node_type), input_id,
+        xnn_datatype_to_string(input_value->datatype), input_value->datatype);
+      return xnn_status_invalid_parameter;
+#endif  // !defined(XNN_NO_QS8_OPERATORS)
+    default:
+      xnn_log_error(
+        "failed to define %s operator with input ID #%" PRIu32 ": unsupported Value datatype %s (%d)",
+        xnn_node_type_to_string(node_type), input_id,
+        xnn_datatype_to_string(input_value->datatype), input_value->datatype);
+      return xnn_status_invalid_parameter;
+  }
+
+  if (output_id >= subgraph->num_values) {
+    xnn_log_error(
+      "failed to define %s operator with output ID #%" PRIu32 ": invalid Value ID",
+      xnn_node_type_to_string(node_type), output_id);
+    return xnn_status_invalid_parameter;
+  }
+
+  const struct xnn_value* output_value = &subgraph->values[output_id];
+  if (output_value->type != xnn_value_type_dense_tensor) {
+    xnn_log_error(
+      "failed to define %s operator with output ID #%" PRIu32 ": unsupported Value type %d (expected dense tensor)",
+      xnn_node_type_to_string(node_type), output_id, output_value->type);
+    return xnn_status_invalid_parameter;
+  }
+
+  enum xnn_compute_type compute_type = xnn_compute_type_invalid;
+  switch (output_value->datatype) {
+    case xnn_datatype_fp32:
+      compute_type = xnn_compute_type_fp32;
+      break;
+#ifndef XNN_NO_QS8_OPERATORS
+    case xnn_datatype_qint8:
+      compute_type = xnn_compute_type_qs8;
+      break;
+#endif  // !defined(XNN_NO_QS8_OPERATORS)
+    default:
+      xnn_log_error(
+        "failed to define %s operator with output ID #%" PRIu32 ": unsupported Value datatype %s (%d)",
+        xnn_node_type_to_string(node_type), output_id,
+        xnn_datatype_to_string(output_value->datatype), output_value->datatype);
+      return xnn_status_invalid_parameter;
+  }
+
+  if (input_value->datatype != output_value->datatype) {
+    xnn_log_error(
+      "failed to define %s operator with input ID #%" PRIu32 " and output ID #%" PRIu32
+      ": mismatching datatypes across input (%s) and output (%s)",
+      xnn_node_type_to_string(node_type), input_id, output_id,
+      xnn_datatype_to_string(input_value->datatype),
+      xnn_datatype_to_string(output_value->datatype));
+    return xnn_status_invalid_parameter;
+  }
+
+  const size_t num_input_dims = input_value->shape.num_dims;
+  if (num_reduction_axes == 0 || num_reduction_axes > num_input_dims) {
+    xnn_log_error(
+      "failed to define %s operator with input ID #%" PRIu32 ": invalid number of reduction axes %zu "
+      "(expected between 1 and %zu)",
+      xnn_node_type_to_string(node_type), input_id, num_reduction_axes, num_input_dims);
+    return xnn_status_invalid_parameter;
+  }
+
+  size_t num_reduced_elements = 1;
+  for (size_t i = 0; i < num_reduction_axes; i++) {
+    if (reduction_axes[i] >= num_input_dims) {
+      xnn_log_error(
+        "failed to define %s operator with input ID #%" PRIu32 ": reduction axis #%zu (%zu) exceeds "
+        "the number of input dimensions (%zu)",
+        xnn_node_type_to_string(node_type), input_id, i, reduction_axes[i], num_input_dims);
+      return xnn_status_invalid_parameter;
+    }
+    if (i != 0 && reduction_axes[i] <= reduction_axes[i - 1]) {
+      xnn_log_error(
+        "failed to define %s operator with input ID #%" PRIu32 ": reduction axis #%zu (%zu) must be greater than "
+        "reduction axis #%zu (%zu)",
+        xnn_node_type_to_string(node_type), input_id, i, reduction_axes[i], i - 1, reduction_axes[i - 1]);
+      return xnn_status_invalid_parameter;
+    }
+    num_reduced_elements *= input_value->shape.dim[reduction_axes[i]];
+  }
+
+  // The output may either keep the reduced dimensions with size 1 or omit them, but it must have exactly as many
+  // elements as the non-reduced dimensions of the input.
+  const size_t num_input_elements = xnn_shape_multiply_all_dims(&input_value->shape);
+  const size_t num_output_elements = xnn_shape_multiply_all_dims(&output_value->shape);
+  if (num_reduced_elements != 0 && num_output_elements * num_reduced_elements != num_input_elements) {
+    xnn_log_error(
+      "failed to define %s operator with input ID #%" PRIu32 " and output ID #%" PRIu32
+      ": number of output elements (%zu) does not match the number of non-reduced input elements (%zu)",
+      xnn_node_type_to_string(node_type), input_id, output_id,
+      num_output_elements, num_input_elements / num_reduced_elements);
+    return xnn_status_invalid_parameter;
+  }
+
+  struct xnn_node* node = xnn_subgraph_new_node(subgraph);
+  if (node == NULL) {
+    return xnn_status_out_of_memory;
+  }
+
+  node->params.reduce.num_reduction_axes = num_reduction_axes;
+  memcpy(node->params.reduce.reduction_axes, reduction_axes, num_reduction_axes * sizeof(size_t));
+
+  node->type = node_type;
+  node->compute_type = compute_type;
+  node->num_inputs = 1;
+  node->inputs[0] = input_id;
+  node->num_outputs = 1;
+  node->outputs[0] = output_id;
+  node->flags = flags;
+
+  node->create = create_reduce_operator;
+  node->setup = setup_reduce_operator;
+
+  return xnn_status_success;
+}
+
+enum xnn_status xnn_define_static_reduce_max(
+  xnn_subgraph_t subgraph,
+  size_t num_reduction_axes,
+  const size_t* reduction_axes,
+  uint32_t input_id,
+  uint32_t output_id,
+  uint32_t flags)
+{
+  return define_static_reduce(
+    subgraph, xnn_node_type_static_reduce_max, num_reduction_axes, reduction_axes, input_id, output_id, flags);
+}
+
+enum xnn_status xnn_define_static_reduce_mean(
+  xnn_subgraph_t subgraph,
+  size_t num_reduction_axes,
+  const size_t* reduction_axes,
+  uint32_t input_id,
+  uint32_t output_id,
+  uint32_t flags)
+{
+  return define_static_reduce(
+    subgraph, xnn_node_type_static_reduce_mean, num_reduction_axes, reduction_axes, input_id, output_id, flags);
+}
+
+enum xnn_status xnn_define_static_reduce_min(
+  xnn_subgraph_t subgraph,
+  size_t num_reduction_axes,
+  const size_t* reduction_axes,
+  uint32_t input_id,
+  uint32_t output_id,
+  uint32_t flags)
+{
+  return define_static_reduce(
+    subgraph, xnn_node_type_static_reduce_min, num_reduction_axes, reduction_axes, input_id, output_id, flags);
+}
+
+enum xnn_status xnn_define_static_reduce_sum(
+  xnn_subgraph_t subgraph,
+  size_t num_reduction_axes,
+  const size_t* reduction_axes,
+  uint32_t input_id,
+  uint32_t output_id,
+  uint32_t flags)
+{
+  return define_static_reduce(
+    subgraph, xnn_node_type_static_reduce_sum, num_reduction_axes, reduction_axes, input_id, output_id, flags);
+}
@@ -0,0 +1,354 @@
+// Copyright 2022 Google LLC
+//
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree.
+
+#include <assert.h>
+#include <inttypes.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+#include <xnnpack.h>
+#include <xnnpack/log.h>
+#include <xnnpack/params.h>
+#include <xnnpack/subgraph.h>
+
+
+static enum xnn_status create_slice_operator(
+  const struct xnn_node* node,
+  const struct xnn_value* values,
+  size_t num_values,
+  struct xnn_operator_data* opdata)
+{
+  assert(node->num_inputs == 1);
+  const uint32_t input_id = node->inputs[0];
+  assert(input_id != XNN_INVALID_VALUE_ID);
+  assert(input_id < num_values);
+
+  assert(node->num_outputs == 1);
+  const uint32_t output_id = node->outputs[0];
+  assert(output_id != XNN_INVALID_VALUE_ID);
+  assert(output_id < num_values);
+
+  enum xnn_status status;
+  switch (node->compute_type) {
+#ifndef XNN_NO_F16_OPERATORS
+    case xnn_compute_type_fp16:
+      status = xnn_create_slice_nd_x16(node->flags, &opdata->operator_object);
+      break;
+#endif  // !defined(XNN_NO_F16_OPERATORS)
+    case xnn_compute_type_fp32:
+      status = xnn_create_slice_nd_x32(node->flags, &opdata->operator_object);
+      break;
+#ifndef XNN_NO_QS8_OPERATORS
+    case xnn_compute_type_qs8:
+#endif  // !defined(XNN_NO_QS8_OPERATORS)
+#ifndef XNN_NO_QU8_OPERATORS
+    case xnn_compute_type_qu8:
+#endif  // !defined(XNN_NO_QU8_OPERATORS)
+#if !defined(XNN_NO_QS8_OPERATORS) || !defined(XNN_NO_QU8_OPERATORS)
+      status = xnn_create_slice_nd_x8(node->flags, &opdata->operator_object);
+      break;
+#endif  // !defined(XNN_NO_QS8_OPERATORS) || !defined(XNN_NO_QU8_OPERATORS)
+    default:
+      XNN_UNREACHABLE;
+  }
+  if (status == xnn_status_success) {
+    opdata->shape1 = values[input_id].shape;
+    memcpy(opdata->offsets, node->params.slice.offsets, sizeof(size_t) * XNN_MAX_TENSOR_DIMS);
+    memcpy(opdata->sizes, node->params.slice.sizes, sizeof(size_t) * XNN_MAX_TENSOR_DIMS);
+    memcpy(opdata->strides, node->params.slice.strides, sizeof(size_t) * XNN_MAX_TENSOR_DIMS);
+    opdata->inputs[0] = input_id;
+    opdata->outputs[0] = output_id;
+  }
+  return status;
+}
+
+static enum xnn_status setup_slice_operator(
+  const struct xnn_operator_data* opdata,
+  const struct xnn_blob* blobs,
+  size_t num_blobs,
+  pthreadpool_t threadpool)
+{
+  const uint32_t input_id = opdata->inputs[0];
+  assert(input_id != XNN_INVALID_VALUE_ID);
+  assert(input_id < num_blobs);
+
+  const uint32_t output_id = opdata->outputs[0];
+  assert(output_id != XNN_INVALID_VALUE_ID);
+  assert(output_id < num_blobs);
+
+  const struct xnn_blob* input_blob = blobs + input_id;
+  const void* input_data = input_blob->data;
+  assert(input_data != NULL);
+
+  const struct xnn_blob* output_blob = blobs + output_id;
+  void* output_data = output_blob->data;
+  assert(output_data != NULL);
+
+  switch (opdata->operator_object->type) {
+#if !defined(XNN_NO_QS8_OPERATORS) || !defined(XNN_NO_QU8_OPERATORS)
+    case xnn_operator_type_slice_nd_x8:
+      return xnn_setup_slice_nd_x8(
+        opdata->operator_object,
+        opdata->shape1.num_dims,
+        opdata->shape1.dim,
+        opdata->offsets,
+        opdata->sizes,
+        opdata->strides,
+        input_data,
+        output_data,
+        threadpool);
+      break;
+#endif  // !defined(XNN_NO_QS8_OPERATORS) || !defined(XNN_NO_QU8_OPERATORS)
+#ifndef XNN_NO_F16_OPERATORS
+    case xnn_operator_type_slice_nd_x16:
+      return xnn_setup_slice_nd_x16(
+        opdata->operator_object,
+        opdata->shape1.num_dims,
+        opdata->shape1.dim,
+        opdata->offsets,
+        opdata->sizes,
+        opdata->strides,
+        input_data,
+        output_data,
+        threadpool);
+      break;
+#endif  // !defined(XNN_NO_F16_OPERATORS)
+    case xnn_operator_type_slice_nd_x32:
+      return xnn_setup_slice_nd_x32(
+        opdata->operator_object,
+        opdata->shape1.num_dims,
+        opdata->shape1.dim,
+        opdata->offsets,
+        opdata->sizes,
+        opdata->strides,
+        input_data,
+        output_data,
+        threadpool);
+      break;
+    default:
+      XNN_UNREACHABLE;
+  }
+}
+
+bool xnn_subgraph_get_contiguous_slice_offset(
+  const struct xnn_node* node,
+  const struct xnn_value* values,
+  size_t* offset_out)
+{
+  assert(node->type == xnn_node_type_static_slice);
+  const struct xnn_shape* input_shape = &values[node->inputs[0]].shape;
+
+  // Walking from the innermost dimension, the slice stays contiguous while it covers whole input dimensions. The first
+  // partially covered dimension must have a unit stride, and all dimensions outside of it must be sliced to a single
+  // element.
+  size_t offset = 0;
+  size_t input_stride = 1;
+  bool is_partial = false;
+  for (size_t i = input_shape->num_dims; i != 0; i--) {
+    const size_t input_dim = input_shape->dim[i - 1];
+    const size_t size = node->params.slice.sizes[i - 1];
+    if (is_partial) {
+      if (size != 1) {
+        return false;
+      }
+    } else if (size != input_dim) {
+      if (size != 1 && node->params.slice.strides[i - 1] != 1) {
+        return false;
+      }
+      is_partial = true;
+    }
+    offset += node->params.slice.offsets[i - 1] * input_stride;
+    input_stride *= input_dim;
+  }
+  *offset_out = offset;
+  return true;
+}
+
+enum xnn_status xnn_define_static_slice(
+  xnn_subgraph_t subgraph,
+  size_t num_dims,
+  const size_t* offsets,
+  const size_t* sizes,
+  const size_t* strides,
+  uint32_t input_id,
+  uint32_t output_id,
+  uint32_t flags)
+{
+  if ((xnn_params.init_flags & XNN_INIT_FLAG_XNNPACK) == 0) {
+    xnn_log_error("failed to define %s operator: XNNPACK is not initialized",
+      xnn_node_type_to_string(xnn_node_type_static_slice));
+    return xnn_status_uninitialized;
+  }
+
+  if (input_id >= subgraph->num_values) {
+    xnn_log_error(
+      "failed to define %s operator with input ID #%" PRIu32 ": invalid Value ID",
+      xnn_node_type_to_string(xnn_node_type_static_slice), input_id);
+    return xnn_status_invalid_parameter;
+  }
+
+  const struct xnn_value* input_value = &subgraph->values[input_id];
+  if (input_value->type != xnn_value_type_dense_tensor) {
+    xnn_log_error(
+      "failed to define %s operator with input ID #%" PRIu32 ": unsupported Value type %d (expected dense tensor)",
+      xnn_node_type_to_string(xnn_node_type_static_slice), input_id, input_value->type);
+    return xnn_status_invalid_parameter;
+  }
+
+  switch (input_value->datatype) {
+    case xnn_datatype_fp32:
+#ifndef XNN_NO_QS8_OPERATORS
+    case xnn_datatype_qint8:
+#endif  // !defined(XNN_NO_QS8_OPERATORS)
+#ifndef XNN_NO_QU8_OPERATORS
+    case xnn_datatype_quint8:
+#endif  // !defined(XNN_NO_QU8_OPERATORS)
+      break;
+    default:
+      xnn_log_error(
+        "failed to define %s operator with input ID #%" PRIu32 ": unsupported Value datatype %s (%d)",
+        xnn_node_type_to_string(xnn_node_type_static_slice), input_id,
+        xnn_datatype_to_string(input_value->datatype), input_value->datatype);
+      return xnn_status_invalid_parameter;
+  }
+
+  if (output_id >= subgraph->num_values) {
+    xnn_log_error(
+      "failed to define %s operator with output ID #%" PRIu32 ": invalid Value ID",
+      xnn_node_type_to_string(xnn_node_type_static_slice), output_id);
+    return xnn_status_invalid_parameter;
+  }
+
+  const struct xnn_value* output_value = &subgraph->values[output_id];
+  if (output_value->type != xnn_value_type_dense_tensor) {
+    xnn_log_error(
+      "failed to define %s operator with output ID #%" PRIu32 ": unsupported Value type %d (expected dense tensor)",
+      xnn_node_type_to_string(xnn_node_type_static_slice), output_id, output_value->type);
+    return xnn_status_invalid_parameter;
+  }
+
+  if (input_value->shape.num_dims != num_dims) {
+    xnn_log_error(
+      "failed to define %s operator with input ID #%" PRIu32 ": number of input dimensions (%zu) "
+      "does not match the number of slice dimensions (%zu)",
+      xnn_node_type_to_string(xnn_node_type_static_slice), input_id, input_value->shape.num_dims, num_dims);
+    return xnn_status_invalid_parameter;
+  }
+
+  if (output_value->shape.num_dims != num_dims) {
+    xnn_log_error(
+      "failed to define %s operator with output ID #%" PRIu32 ": number of output dimensions (%zu) "
+      "does not match the number of slice dimensions (%zu)",
+      xnn_node_type_to_string(xnn_node_type_static_slice), output_id, output_value->shape.num_dims, num_dims);
+    return xnn_status_invalid_parameter;
+  }
+
+  for (size_t i = 0; i < num_dims; i++) {
+    const size_t stride = strides != NULL ? strides[i] : 1;
+    if (stride == 0) {
+      xnn_log_error(
+        "failed to define %s operator: slice stride in dimension #%zu is zero",
+        xnn_node_type_to_string(xnn_node_type_static_slice), i);
+      return xnn_status_invalid_parameter;
+    }
+    if (sizes[i] != output_value->shape.dim[i]) {
+      xnn_log_error(
+        "failed to define %s operator with output ID #%" PRIu32 ": output dimension #%zu (%zu) "
+        "does not match the slice size (%zu)",
+        xnn_node_type_to_string(xnn_node_type_static_slice), output_id, i, output_value->shape.dim[i], sizes[i]);
+      return xnn_status_invalid_parameter;
+    }
+    if (sizes[i] == 0 || offsets[i] >= input_value->shape.dim[i] ||
+        (sizes[i] - 1) * stride >= input_value->shape.dim[i] - offsets[i])
+    {
+      xnn_log_error(
+        "failed to define %s operator with input ID #%" PRIu32 ": slice of %zu elements with offset %zu and stride %zu "
+        "in dimension #%zu exceeds input dimension of %zu elements",
+        xnn_node_type_to_string(xnn_node_type_static_slice), input_id, sizes[i], offsets[i], stride, i,
+        input_value->shape.dim[i]);
+      return xnn_status_invalid_parameter;
+    }
+  }
+
+  enum xnn_compute_type compute_type = xnn_compute_type_invalid;
+  switch (output_value->datatype) {
+    case xnn_datatype_fp32:
+      compute_type = xnn_compute_type_fp32;
+      break;
+#ifndef XNN_NO_QS8_OPERATORS
+    case xnn_datatype_qint8:
+      compute_type = xnn_compute_type_qs8;
+      break;
+#endif  // !defined(XNN_NO_QS8_OPERATORS)
+#ifndef XNN_NO_QU8_OPERATORS
+    case xnn_datatype_quint8:
+      compute_type = xnn_compute_type_qu8;
+      break;
+#endif  // !defined(XNN_NO_QU8_OPERATORS)
+    default:
+      xnn_log_error(
+        "failed to define %s operator with output ID #%" PRIu32 ": unsupported Value datatype %s (%d)",
+        xnn_node_type_to_string(xnn_node_type_static_slice), output_id,
+        xnn_datatype_to_string(output_value->datatype), output_value->datatype);
+      return xnn_status_invalid_parameter;
+  }
+
+  if (input_value->datatype != output_value->datatype) {
+    xnn_log_error(
+      "failed to define %s operator with input ID #%" PRIu32 " and output ID #%" PRIu32
+      ": mismatching datatypes across input (%s) and output (%s)",
+      xnn_node_type_to_string(xnn_node_type_static_slice), input_id, output_id,
+      xnn_datatype_to_string(input_value->datatype),
+      xnn_datatype_to_string(output_value->datatype));
+    return xnn_status_invalid_parameter;
+  }
+
+#if !defined(XNN_NO_QU8_OPERATORS) || !defined(XNN_NO_QS8_OPERATORS)
+  if (output_value->datatype == xnn_datatype_qint8 || output_value->datatype == xnn_datatype_quint8) {
+    if (input_value->quantization.zero_point != output_value->quantization.zero_point) {
+      xnn_log_error(
+        "failed to define %s operator with input ID #%" PRIu32 " and output ID #%" PRIu32
+        ": mismatching zero point quantization parameter across input (%"PRId32") and output (%"PRId32")",
+        xnn_node_type_to_string(xnn_node_type_static_slice), input_id, output_id,
+        input_value->quantization.zero_point, output_value->quantization.zero_point);
+      return xnn_status_invalid_parameter;
+    }
+    if (input_value->quantization.scale != output_value->quantization.scale) {
+      xnn_log_error(
+        "failed to define %s operator with input ID #%" PRIu32 " and output ID #%" PRIu32
+        ": mismatching scale quantization parameter across input (%.7g) and output (%.7g)",
+        xnn_node_type_to_string(xnn_node_type_static_slice), input_id, output_id,
+        input_value->quantization.scale, output_value->quantization.scale);
+      return xnn_status_invalid_parameter;
+    }
+  }
+#endif  // !defined(XNN_NO_QU8_OPERATORS) || !defined(XNN_NO_QS8_OPERATORS)
+
+  struct xnn_node* node = xnn_subgraph_new_node(subgraph);
+  if (node == NULL) {
+    return xnn_status_out_of_memory;
+  }
+
+  memcpy(node->params.slice.offsets, offsets, num_dims * sizeof(size_t));
+  memcpy(node->params.slice.sizes, sizes, num_dims * sizeof(size_t));
+  for (size_t i = 0; i < num_dims; i++) {
+    node->params.slice.strides[i] = strides != NULL ? strides[i] : 1;
+  }
+
+  node->type = xnn_node_type_static_slice;
+  node->compute_type = compute_type;
+  node->num_inputs = 1;
+  node->inputs[0] = input_id;
+  node->num_outputs = 1;
+  node->outputs[0] = output_id;
+  node->flags = flags;
+
+  node->create = create_slice_operator;
+  node->setup = setup_slice_operator;
+
+  return xnn_status_success;
+}
@@ -6,6 +6,7 @@
 #pragma once
 
 #include <stddef.h>
+#include <stdint.h>
 #include <stdlib.h>
 #include <string.h>
 
@@ -32,45 +33,153 @@
   #define XNN_ALLOCATION_ALIGNMENT 16
 #endif
 
+// Size of the huge pages of transparent huge page support on Linux.
+#define XNN_HUGE_PAGE_SIZE 2097152
+
+// Every allocation is preceded by a header with its size and memory category, which is used for memory accounting
+// when the allocation is released. Headers of SIMD allocations are padded to keep the alignment of the memory.
+struct xnn_allocation_header {
+  size_t size;
+  enum xnn_memory_category category;
+};
+
+#define XNN_ALLOCATION_HEADER_SIZE 16
+#if XNN_ALLOCATION_ALIGNMENT > XNN_ALLOCATION_HEADER_SIZE
+  #define XNN_SIMD_ALLOCATION_HEADER_SIZE XNN_ALLOCATION_ALIGNMENT
+#else
+  #define XNN_SIMD_ALLOCATION_HEADER_SIZE XNN_ALLOCATION_HEADER_SIZE
+#endif
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
 XNN_INTERNAL extern const struct xnn_allocator xnn_default_allocator;
 
+// Update the global memory accounting (see xnn_get_memory_usage) for memory_size bytes allocated in, or released from,
+// a memory category.
+XNN_INTERNAL void xnn_account_memory_allocation(enum xnn_memory_category category, size_t memory_size);
+XNN_INTERNAL void xnn_account_memory_release(enum xnn_memory_category category, size_t memory_size);
+
+// Allocates memory like xnn_allocate_tagged_simd_memory, but aligned to huge pages and backed by transparent huge pages
+// when the allocation spans at least one huge page and the operating system supports it, to reduce TLB misses when
+// large buffers (e.g. packed weights) are streamed. The memory is released with xnn_release_simd_memory.
+XNN_INTERNAL void* xnn_allocate_huge_simd_memory(enum xnn_memory_category category, size_t memory_size);
+
+#ifdef __cplusplus
+}  // extern "C"
+#endif
+
+inline static void* xnn_init_allocation_header(
+  void* allocation_pointer,
+  size_t header_size,
+  size_t memory_size,
+  enum xnn_memory_category category)
+{
+  if (allocation_pointer == NULL) {
+    return NULL;
+  }
+  struct xnn_allocation_header* header = (struct xnn_allocation_header*) allocation_pointer;
+  header->size = memory_size;
+  header->category = category;
+  xnn_account_memory_allocation(category, memory_size);
+  return (void*) ((uintptr_t) allocation_pointer + header_size);
+}
+
+// Header of memory allocated by one of the xnn_allocate_*memory or xnn_reallocate_*memory functions.
+inline static const struct xnn_allocation_header* xnn_get_allocation_header(const void* memory_pointer) {
+  return (const struct xnn_allocation_header*) ((uintptr_t) memory_pointer - XNN_ALLOCATION_HEADER_SIZE);
+}
+
+// Header of memory allocated by one of the xnn_allocate_*simd_memory functions.
+inline static const struct xnn_allocation_header* xnn_get_simd_allocation_header(const void* memory_pointer) {
+  return (const struct xnn_allocation_header*) ((uintptr_t) memory_pointer - XNN_SIMD_ALLOCATION_HEADER_SIZE);
+}
+
+inline static void* xnn_allocate_tagged_memory(enum xnn_memory_category category, size_t memory_size) {
+  return xnn_init_allocation_header(
+    xnn_params.allocator.allocate(xnn_params.allocator.context, XNN_ALLOCATION_HEADER_SIZE + memory_size),
+    XNN_ALLOCATION_HEADER_SIZE, memory_size, category);
+}
+
 inline static void* xnn_allocate_memory(size_t memory_size) {
-  return xnn_params.allocator.allocate(xnn_params.allocator.context, memory_size);
+  return xnn_allocate_tagged_memory(xnn_memory_category_other, memory_size);
 }
 
 inline static void* xnn_allocate_zero_memory(size_t memory_size) {
-  void* memory_pointer = xnn_params.allocator.allocate(xnn_params.allocator.context, memory_size);
+  void* memory_pointer = xnn_allocate_tagged_memory(xnn_memory_category_other, memory_size);
   if (memory_pointer != NULL) {
     memset(memory_pointer, 0, memory_size);
   }
   return memory_pointer;
 }
 
+inline static void* xnn_reallocate_tagged_memory(
+  enum xnn_memory_category category,
+  void* memory_pointer,
+  size_t memory_size)
+{
+  void* allocation_pointer = NULL;
+  struct xnn_allocation_header old_header = { 0, xnn_memory_category_other };
+  if (memory_pointer != NULL) {
+    old_header = *xnn_get_allocation_header(memory_pointer);
+    allocation_pointer = (void*) ((uintptr_t) memory_pointer - XNN_ALLOCATION_HEADER_SIZE);
+  }
+  allocation_pointer = xnn_params.allocator.reallocate(
+    xnn_params.allocator.context, allocation_pointer, XNN_ALLOCATION_HEADER_SIZE + memory_size);
+  if (allocation_pointer == NULL) {
+    return NULL;
+  }
+  if (memory_pointer != NULL) {
+    xnn_account_memory_release(old_header.category, old_header.size);
+  }
+  return xnn_init_allocation_header(allocation_pointer, XNN_ALLOCATION_HEADER_SIZE, memory_size, category);
+}
+
 inline static void* xnn_reallocate_memory(void* memory_pointer, size_t memory_size) {
-  return xnn_params.allocator.reallocate(xnn_params.allocator.context, memory_pointer, memory_size);
+  return xnn_reallocate_tagged_memory(xnn_memory_category_other, memory_pointer, memory_size);
 }
 
 inline static void xnn_release_memory(void* memory_pointer) {
-  xnn_params.allocator.deallocate(xnn_params.allocator.context, memory_pointer);
+  if XNN_LIKELY(memory_pointer != NULL) {
+    const struct xnn_allocation_header* header = xnn_get_allocation_header(memory_pointer);
+    xnn_account_memory_release(header->category, header->size);
+    xnn_params.allocator.deallocate(xnn_params.allocator.context, (void*) header);
+  }
 }
 
-inline static void* xnn_allocate_simd_memory(size_t memory_size) {
-  return xnn_params.allocator.aligned_allocate(xnn_params.allocator.context, XNN_ALLOCATION_ALIGNMENT, memory_size);
+inline static void* xnn_allocate_tagged_simd_memory(enum xnn_memory_category category, size_t memory_size) {
+  return xnn_init_allocation_header(
+    xnn_params.allocator.aligned_allocate(
+      xnn_params.allocator.context, XNN_ALLOCATION_ALIGNMENT, XNN_SIMD_ALLOCATION_HEADER_SIZE + memory_size),
+    XNN_SIMD_ALLOCATION_HEADER_SIZE, memory_size, category);
 }
 
-inline static void* xnn_allocate_zero_simd_memory(size_t memory_size) {
-  void* memory_pointer = xnn_params.allocator.aligned_allocate(
-    xnn_params.allocator.context, XNN_ALLOCATION_ALIGNMENT, memory_size);
+inline static void* xnn_allocate_zero_tagged_simd_memory(enum xnn_memory_category category, size_t memory_size) {
+  void* memory_pointer = xnn_allocate_tagged_simd_memory(category, memory_size);
   if (memory_pointer != NULL) {
     memset(memory_pointer, 0, memory_size);
   }
   return memory_pointer;
 }
 
+inline static void* xnn_allocate_simd_memory(size_t memory_size) {
+  return xnn_allocate_tagged_simd_memory(xnn_memory_category_other, memory_size);
+}
+
+inline static void* xnn_allocate_zero_simd_memory(size_t memory_size) {
+  return xnn_allocate_zero_tagged_simd_memory(xnn_memory_category_other, memory_size);
+}
+
 inline static void xnn_release_simd_memory(void* memory_pointer) {
-  xnn_params.allocator.aligned_deallocate(xnn_params.allocator.context, memory_pointer);
+  if XNN_LIKELY(memory_pointer != NULL) {
+    const struct xnn_allocation_header* header = xnn_get_simd_allocation_header(memory_pointer);
+    xnn_account_memory_release(header->category, header->size);
+    xnn_params.allocator.aligned_deallocate(xnn_params.allocator.context, (void*) header);
+  }
 }
 
+
 #if defined(__GNUC__) && defined(__BIGGEST_ALIGNMENT__) && (__BIGGEST_ALIGNMENT__ >= XNN_ALLOCATION_ALIGNMENT)
   #define XNN_SIMD_ALLOCA(size) __builtin_alloca((size))
 #elif (defined(__clang_major__) && (__clang_major__ >= 4)) || \
@@ -0,0 +1,36 @@
+// Copyright 2022 Google LLC
+//
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree.
+
+#pragma once
+
+#include <stddef.h>
+
+#include <xnnpack.h>
+#include <xnnpack/common.h>
+#include <xnnpack/operator.h>
+#include <xnnpack/params.h>
+
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Select the F32 GEMM micro-kernels for a GEMM (ukernel_type == xnn_ukernel_type_gemm) or IGEMM
+// (ukernel_type == xnn_ukernel_type_igemm) with group_output_channels columns, group_input_channels reduction elements
+// per kernel element, and kernel_size kernel elements. If no decision for this shape is cached, the candidate
+// micro-kernels compatible with xnn_params.f32.gemm are benchmarked, and the fastest is cached for the lifetime of the
+// process. Candidates use the same parameters initialization function as xnn_params.f32.gemm.
+//
+// If there are no alternative candidates on this processor, gemm_parameters_out is initialized with xnn_params.f32.gemm.
+enum xnn_status xnn_autotune_f32_gemm(
+  enum xnn_ukernel_type ukernel_type,
+  size_t group_output_channels,
+  size_t group_input_channels,
+  size_t kernel_size,
+  struct gemm_parameters* gemm_parameters_out);
+
+#ifdef __cplusplus
+}  // extern "C"
+#endif
@@ -19,6 +19,43 @@ extern "C" {
 #endif
 
 
+#define DECLARE_F16_AVGPOOL_MINMAX_MULTIPASS_UKERNEL_FUNCTION(fn_name) \
+  XNN_INTERNAL void fn_name(                                           \
+      size_t output_pixels,                                            \
+      size_t kernel_elements,                                          \
+      size_t channels,                                                 \
+      const void** input,                                              \
+      size_t input_offset,                                             \
+      const void* zero,                                                \
+      void* buffer,                                                    \
+      void* output,                                                    \
+      size_t input_increment,                                          \
+      size_t output_increment,                                         \
+      const union xnn_f16_scaleminmax_params* params);
+
+DECLARE_F16_AVGPOOL_MINMAX_MULTIPASS_UKERNEL_FUNCTION(xnn_f16_avgpool_minmax_ukernel_9p8x__f16c_c8)
+DECLARE_F16_AVGPOOL_MINMAX_MULTIPASS_UKERNEL_FUNCTION(xnn_f16_avgpool_minmax_ukernel_9p8x__avx512skx_c16)
+DECLARE_F16_AVGPOOL_MINMAX_MULTIPASS_UKERNEL_FUNCTION(xnn_f16_avgpool_minmax_ukernel_9p8x__neonfp16arith_c8)
+
+
+#define DECLARE_F16_AVGPOOL_MINMAX_UNIPASS_UKERNEL_FUNCTION(fn_name) \
+  XNN_INTERNAL void fn_name(                                         \
+      size_t output_pixels,                                          \
+      size_t kernel_elements,                                        \
+      size_t channels,                                               \
+      const void** input,                                            \
+      size_t input_offset,                                           \
+      const void* zero,                                              \
+      void* output,                                                  \
+      size_t input_increment,                                        \
+      size_t output_increment,                                       \
+      const union xnn_f16_scaleminmax_params* params);
+
+DECLARE_F16_AVGPOOL_MINMAX_UNIPASS_UKERNEL_FUNCTION(xnn_f16_avgpool_minmax_ukernel_9x__f16c_c8)
+DECLARE_F16_AVGPOOL_MINMAX_UNIPASS_UKERNEL_FUNCTION(xnn_f16_avgpool_minmax_ukernel_9x__avx512skx_c16)
+DECLARE_F16_AVGPOOL_MINMAX_UNIPASS_UKERNEL_FUNCTION(xnn_f16_avgpool_minmax_ukernel_9x__neonfp16arith_c8)
+
+
 #define DECLARE_F32_AVGPOOL_MINMAX_MULTIPASS_UKERNEL_FUNCTION(fn_name) \
   XNN_INTERNAL void fn_name(                                           \
       size_t output_pixels,                                            \
@@ -99,6 +136,47 @@ DECLARE_QU8_AVGPOOL_MINMAX_UNIPASS_UKERNEL_FUNCTION(xnn_qu8_avgpool_minmax_ukern
 DECLARE_QU8_AVGPOOL_MINMAX_UNIPASS_UKERNEL_FUNCTION(xnn_qu8_avgpool_minmax_ukernel_9x__sse2_c8)
 
 
+#define DECLARE_QS8_AVGPOOL_MINMAX_MULTIPASS_UKERNEL_FUNCTION(fn_name) \
+  XNN_INTERNAL void fn_name(                                           \
+      size_t output_pixels,                                            \
+      size_t kernel_elements,                                          \
+      size_t channels,                                                 \
+      const int8_t** input,                                            \
+      size_t input_offset,                                             \
+      const int8_t* zero,                                              \
+      int32_t* buffer,                                                 \
+      int8_t* output,                                                  \
+      size_t input_increment,                                          \
+      size_t output_increment,                                         \
+      const union xnn_qs8_avgpool_minmax_params* params);
+
+DECLARE_QS8_AVGPOOL_MINMAX_MULTIPASS_UKERNEL_FUNCTION(xnn_qs8_avgpool_minmax_fp32_ukernel_9p8x__scalar_imagic_c1)
+DECLARE_QS8_AVGPOOL_MINMAX_MULTIPASS_UKERNEL_FUNCTION(xnn_qs8_avgpool_minmax_fp32_ukernel_9p8x__sse2_c8)
+DECLARE_QS8_AVGPOOL_MINMAX_MULTIPASS_UKERNEL_FUNCTION(xnn_qs8_avgpool_minmax_fp32_ukernel_9p8x__sse41_c8)
+DECLARE_QS8_AVGPOOL_MINMAX_MULTIPASS_UKERNEL_FUNCTION(xnn_qs8_avgpool_minmax_fp32_ukernel_9p8x__avx2_c16)
+DECLARE_QS8_AVGPOOL_MINMAX_MULTIPASS_UKERNEL_FUNCTION(xnn_qs8_avgpool_minmax_rndnu_ukernel_9p8x__neon_c8)
+
+
+#define DECLARE_QS8_AVGPOOL_MINMAX_UNIPASS_UKERNEL_FUNCTION(fn_name) \
+  XNN_INTERNAL void fn_name(                                         \
+      size_t output_pixels,                                          \
+      size_t kernel_elements,                                        \
+      size_t channels,                                               \
+      const int8_t** input,                                          \
+      size_t input_offset,                                           \
+      const int8_t* zero,                                            \
+      int8_t* output,                                                \
+      size_t input_increment,                                        \
+      size_t output_increment,                                       \
+      const union xnn_qs8_avgpool_minmax_params* params);
+
+DECLARE_QS8_AVGPOOL_MINMAX_UNIPASS_UKERNEL_FUNCTION(xnn_qs8_avgpool_minmax_fp32_ukernel_9x__scalar_imagic_c1)
+DECLARE_QS8_AVGPOOL_MINMAX_UNIPASS_UKERNEL_FUNCTION(xnn_qs8_avgpool_minmax_fp32_ukernel_9x__sse2_c8)
+DECLARE_QS8_AVGPOOL_MINMAX_UNIPASS_UKERNEL_FUNCTION(xnn_qs8_avgpool_minmax_fp32_ukernel_9x__sse41_c8)
+DECLARE_QS8_AVGPOOL_MINMAX_UNIPASS_UKERNEL_FUNCTION(xnn_qs8_avgpool_minmax_fp32_ukernel_9x__avx2_c16)
+DECLARE_QS8_AVGPOOL_MINMAX_UNIPASS_UKERNEL_FUNCTION(xnn_qs8_avgpool_minmax_rndnu_ukernel_9x__neon_c8)
+
+
 #ifdef __cplusplus
 }  // extern "C"
 #endif
@@ -12,6 +12,7 @@
 #include <xnnpack.h>
 #include <xnnpack/common.h>
 #include <xnnpack/math.h>
+#include <xnnpack/pack.h>
 #include <xnnpack/params.h>
 
 
@@ -59,8 +60,61 @@ struct compute_parameters {
   };
   size_t range[6];
   size_t tile[2];
+  // Maximum number of threads worth using for the computation, or 0 if all threads of the thread pool should be used.
+  // If 1, the computation runs on the calling thread. xnn_run_operator and persistent parallel regions of Runtimes run
+  // the computation on at most this many threads of the thread pool.
+  size_t num_threads;
 };
 
+// Packing of GEMM weights in [groups, output channels, kernel elements, input channels] layout, split by blocks of
+// output channels in every group. Every block of output channels starts at a multiple of nr.
+struct pack_gemm_context {
+  size_t groups;
+  size_t ks;
+  size_t kc;
+  size_t nc;
+  size_t nr;
+  size_t kr;
+  size_t sr;
+  // Segments of the reduction dimension are packed one after another, each for all output channels. All segments but
+  // the last one have k_segment_size input channels, and only the first one includes bias. Unsegmented weights are a
+  // single segment with kc input channels.
+  size_t num_k_segments;
+  size_t k_segment_size;
+  const void* kernel;
+  uint32_t log2_kernel_element_size;
+  size_t kernel_n_stride;
+  size_t kernel_g_stride;
+  // Bias may be NULL.
+  const void* bias;
+  size_t bias_n_stride;
+  size_t bias_g_stride;
+  void* packed_w;
+  // Stride of packed weights for a block of nr output channels, including extra_bytes, in the last (or only) segment.
+  size_t packed_n_stride;
+  size_t packed_g_stride;
+  // Stride of packed weights for a block of nr output channels, and for all output channels, in a segment other than
+  // the last one.
+  size_t packed_k_segment_n_stride;
+  size_t packed_k_segment_stride;
+  size_t extra_bytes;
+  // Exactly one of the packing functions is set.
+  xnn_pack_gemm_goi_w_function pack_gemm_goi_w;
+  xnn_pack_conv_goki_w_function pack_conv_goki_w;
+  union {
+    struct xnn_qs8_packing_params qs8;
+    struct xnn_qu8_packing_params qu8;
+  } packing_params;
+};
+
+#ifndef __cplusplus
+  XNN_PRIVATE void xnn_compute_pack_gemm(
+      const struct pack_gemm_context context[restrict XNN_MIN_ELEMENTS(1)],
+      size_t group_index,
+      size_t nc_block_start,
+      size_t nc_block_size);
+#endif
+
 struct gemm_context {
   size_t k_scaled;
   const void* a;
@@ -73,6 +127,8 @@ struct gemm_context {
   size_t cn_stride;
   size_t cg_stride;
   uint32_t log2_csize;
+  // Number of rows processed by one micro-kernel call. Only used by xnn_compute_gemm_blocked.
+  size_t mr;
   struct xnn_hmp_gemm_ukernel ukernel;
   union {
     union xnn_qs8_conv_minmax_params qs8;
@@ -80,6 +136,17 @@ struct gemm_context {
     union xnn_f16_scaleminmax_params f16;
     union xnn_f32_minmax_params f32;
   } params;
+  // Optional residual tensor added to the output tile right after the micro-kernel call.
+  // The residual tensor has the same layout as C, except for the stride between rows.
+  const void* residual;
+  size_t residual_stride;
+  xnn_vbinary_ukernel_function residual_ukernel;
+  union {
+    union xnn_qs8_addsub_minmax_params qs8;
+    union xnn_qu8_addsub_minmax_params qu8;
+    union xnn_f16_minmax_params f16;
+    union xnn_f32_minmax_params f32;
+  } residual_params;
 };
 
 #ifndef __cplusplus
@@ -98,6 +165,15 @@ struct gemm_context {
       size_t mr_block_size,
       size_t nr_block_size);
 
+  // Cache-blocked GEMM: the block of columns is the outer dimension, and the block of rows may span several
+  // micro-kernel tiles of context->mr rows, which reuse the same panel of packed weights.
+  XNN_PRIVATE void xnn_compute_gemm_blocked(
+      const struct gemm_context context[restrict XNN_MIN_ELEMENTS(1)],
+      size_t nc_block_start,
+      size_t mc_block_start,
+      size_t nc_block_size,
+      size_t mc_block_size);
+
   #if XNN_MAX_UARCH_TYPES > 1
     XNN_PRIVATE void xnn_compute_hmp_grouped_gemm(
         const struct gemm_context context[restrict XNN_MIN_ELEMENTS(1)],
@@ -118,6 +194,69 @@ struct gemm_context {
   #endif  // XNN_MAX_UARCH_TYPES > 1
 #endif
 
+// Maximum number of elements in a micro-kernel tile (mr x nr) of GEMM with split reduction dimension.
+#define XNN_SPLIT_K_MAX_TILE_ELEMENTS 128
+
+// Context for GEMM with weights packed in segments along the reduction (K) dimension. Every segment has its own
+// packed bias, which is zero in all segments but the first one. Consecutive segments are grouped into num_partials
+// partitions: if there is a single partition, every task accumulates all segments directly into the output tile,
+// otherwise tasks of different partitions write partial sums into separate buffers, which are then summed up.
+struct split_k_gemm_context {
+  const void* a;
+  size_t a_stride;
+  const void* packed_w;
+  size_t num_segments;
+  // Size of A row in every segment but the last one, in bytes.
+  size_t segment_k_scaled;
+  // Size of A row in the last segment, in bytes.
+  size_t last_segment_k_scaled;
+  // Size of one column of packed weights in every segment but the last one, in bytes.
+  size_t w_stride;
+  // Size of one column of packed weights in the last segment, in bytes.
+  size_t last_w_stride;
+  // Size of packed weights for every segment but the last one, in bytes.
+  size_t segment_w_stride;
+  void* c;
+  size_t cm_stride;
+  size_t cn_stride;
+  size_t n;
+  size_t num_partials;
+  void* partials;
+  size_t partial_m_stride;
+  size_t partial_stride;
+  struct xnn_hmp_gemm_ukernel ukernel;
+  xnn_vbinary_ukernel_function vadd_ukernel;
+  // Partial sums are computed without output clamping, which is applied by the addition of the last partial sum.
+  union xnn_f32_minmax_params gemm_linear_params;
+  union xnn_f32_minmax_params vadd_params;
+  union xnn_f32_minmax_params vadd_linear_params;
+  const void* residual;
+  size_t residual_stride;
+  xnn_vbinary_ukernel_function residual_ukernel;
+  union xnn_f32_minmax_params residual_params;
+};
+
+#ifndef __cplusplus
+  XNN_PRIVATE void xnn_compute_split_k_gemm(
+      const struct split_k_gemm_context context[restrict XNN_MIN_ELEMENTS(1)],
+      size_t partial_index,
+      size_t mr_block_start,
+      size_t nr_block_start,
+      size_t mr_block_size,
+      size_t nr_block_size);
+
+  XNN_PRIVATE void xnn_compute_segmented_gemm(
+      const struct split_k_gemm_context context[restrict XNN_MIN_ELEMENTS(1)],
+      size_t mr_block_start,
+      size_t nc_block_start,
+      size_t mr_block_size,
+      size_t nc_block_size);
+
+  XNN_PRIVATE void xnn_compute_split_k_gemm_reduce(
+      const struct split_k_gemm_context context[restrict XNN_MIN_ELEMENTS(1)],
+      size_t mr_index);
+#endif
+
 // Context for Sparse Matrix-Dense Matrix Multiplication.
 // C [MxN] := A [MxK] * B [KxN] + bias [N]
 // A and C are dense matrices with row-major storage, B is a sparse matrix.
@@ -164,6 +303,10 @@ struct igemm_context {
   size_t kc;
   size_t w_stride;
   const void** indirect_a;
+  // Optional compact indirection buffer of 32-bit offsets from compact_indirect_base, which replaces indirect_a when
+  // not NULL. See xnn_indirection_init_conv2d_compact.
+  const uint32_t* compact_indirect_a;
+  const void* compact_indirect_base;
   size_t a_offset;
   void* zero;
   const void* packed_w;
@@ -183,6 +326,18 @@ struct igemm_context {
     union xnn_f16_scaleminmax_params f16;
     union xnn_f32_minmax_params f32;
   } params;
+  // Optional residual tensor added to the output tile right after the micro-kernel call.
+  // The residual tensor has the same layout as C, except for the stride between rows and batch elements.
+  const void* residual;
+  size_t residual_stride;
+  size_t residual_batch_stride;
+  xnn_vbinary_ukernel_function residual_ukernel;
+  union {
+    union xnn_qs8_addsub_minmax_params qs8;
+    union xnn_qu8_addsub_minmax_params qu8;
+    union xnn_f16_minmax_params f16;
+    union xnn_f32_minmax_params f32;
+  } residual_params;
 };
 
 #ifndef __cplusplus
@@ -379,6 +534,54 @@ struct conv2d_context {
       size_t output_y_slice);
 #endif
 
+struct dconv_context {
+  // Pointers to the input rows for every output row and kernel row, or to the zero buffer for padding rows.
+  const void** indirect_input;
+  size_t indirect_input_height_stride;
+  size_t input_offset;
+  size_t input_batch_stride;
+  size_t input_width;
+  size_t input_pixel_stride;
+  size_t input_channels;
+  size_t kernel_height;
+  size_t kernel_width;
+  size_t subsampling;
+  size_t padding_left;
+  const void* zero;
+  const void* packed_weights;
+  void* output;
+  size_t output_batch_stride;
+  size_t output_height_stride;
+  size_t output_pixel_stride;
+  size_t output_width;
+  size_t output_channels;
+  size_t log2_csize;
+  union {
+    union xnn_qs8_conv_minmax_params qs8;
+    union xnn_f16_minmax_params f16;
+    union xnn_f32_minmax_params f32;
+  } params;
+  xnn_dconv_ukernel_function ukernel;
+  // Optional residual tensor added to every output row right after the micro-kernel call.
+  const void* residual;
+  size_t residual_stride;
+  size_t residual_batch_stride;
+  size_t residual_height_stride;
+  xnn_vbinary_ukernel_function residual_ukernel;
+  union {
+    union xnn_qs8_addsub_minmax_params qs8;
+    union xnn_f16_minmax_params f16;
+    union xnn_f32_minmax_params f32;
+  } residual_params;
+};
+
+#ifndef __cplusplus
+  XNN_PRIVATE void xnn_compute_dconv(
+      const struct dconv_context context[restrict XNN_MIN_ELEMENTS(1)],
+      size_t batch_index,
+      size_t output_y);
+#endif
+
 struct dwconv_context {
   const void** indirect_input;
   size_t indirect_input_width_stride;
@@ -411,6 +614,69 @@ struct dwconv_context {
       size_t output_y);
 #endif
 
+// Depth-first execution of an inverted bottleneck block: 1x1 expansion Convolution, Depthwise Convolution, and 1x1
+// projection Convolution. Output rows are processed in strips, and both intermediate tensors for a strip live in the
+// per-worker scratch buffer.
+struct inverted_bottleneck_context {
+  const void* input;
+  size_t input_pixel_stride;
+  size_t input_batch_stride;
+  size_t input_height;
+  size_t input_width;
+  // Number of channels in the expanded intermediate tensors.
+  size_t channels;
+
+  xnn_gemm_ukernel_function expand_ukernel;
+  const void* expand_weights;
+  size_t expand_k_scaled;
+  size_t expand_mr;
+  size_t expand_nr;
+  union xnn_f32_minmax_params expand_params;
+
+  xnn_dwconv_unipass_ukernel_function depthwise_ukernel;
+  const void* depthwise_weights;
+  const void* zero;
+  uint32_t kernel_height;
+  uint32_t kernel_width;
+  uint32_t stride_height;
+  uint32_t stride_width;
+  uint32_t dilation_height;
+  uint32_t dilation_width;
+  uint32_t padding_top;
+  uint32_t padding_left;
+  size_t indirection_step_width;
+  size_t indirection_step_height;
+  union xnn_f32_minmax_params depthwise_params;
+
+  xnn_gemm_ukernel_function project_ukernel;
+  const void* project_weights;
+  size_t project_mr;
+  size_t project_nr;
+  size_t output_channels;
+  union xnn_f32_minmax_params project_params;
+
+  void* output;
+  size_t output_pixel_stride;
+  size_t output_batch_stride;
+  size_t output_height;
+  size_t output_width;
+
+  size_t strip_height;
+  size_t strips_per_image;
+  size_t num_strips;
+  size_t num_workers;
+  void* scratch;
+  size_t scratch_stride;
+  size_t depthwise_output_offset;
+  size_t indirection_buffer_offset;
+};
+
+#ifndef __cplusplus
+  XNN_PRIVATE void xnn_compute_inverted_bottleneck(
+      const struct inverted_bottleneck_context context[restrict XNN_MIN_ELEMENTS(1)],
+      size_t worker_index);
+#endif
+
 struct dwconv2d_context {
   size_t input_height;
   size_t input_width;
@@ -439,6 +705,45 @@ struct dwconv2d_context {
       size_t channel);
 #endif
 
+struct dwconv2d_dilated_context {
+  size_t input_height;
+  size_t input_width;
+  const void* input;
+  size_t input_channel_stride;
+  size_t input_batch_stride;
+  uint32_t input_padding_top;
+  uint32_t input_padding_left;
+  size_t kernel_height;
+  size_t kernel_width;
+  size_t subsampling_height;
+  size_t subsampling_width;
+  size_t dilation_height;
+  size_t dilation_width;
+  const void* packed_weights;
+  size_t weights_channel_stride;
+  void* output;
+  size_t output_width;
+  size_t output_height_stride;
+  size_t output_channel_stride;
+  size_t output_batch_stride;
+  union {
+    union xnn_f32_minmax_params f32;
+  } params;
+  union {
+    xnn_dwconv2d_chw_dilated_ukernel_function chw_dilated_ukernel;
+  };
+};
+
+#ifndef __cplusplus
+  XNN_PRIVATE void xnn_compute_dwconv2d_chw_dilated(
+      const struct dwconv2d_dilated_context context[restrict XNN_MIN_ELEMENTS(1)],
+      size_t batch_index,
+      size_t channel,
+      size_t output_y_start,
+      size_t channel_range,
+      size_t output_y_range);
+#endif
+
 struct depthtospace2d_hwc_context {
   size_t elements;
   size_t input_width;
@@ -486,6 +791,32 @@ struct depthtospace2d_chw2hwc_context {
       size_t batch_index);
 #endif
 
+struct spacetodepth2d_hwc_context {
+  // Number of bytes copied into an output pixel per call of the micro-kernel: a row of block_size input pixels when
+  // input pixels are contiguous, or a single input pixel otherwise.
+  size_t elements;
+  size_t block_size;
+  size_t output_width;
+  const void* input;
+  void* output;
+  size_t input_height_stride;
+  size_t input_width_stride;
+  // Stride between the input pixels copied into consecutive output pixels, i.e. block_size input pixels.
+  size_t input_block_stride;
+  size_t output_height_stride;
+  size_t output_width_stride;
+  // Offset, in bytes, of the channels copied from consecutive rows of a block within an output pixel.
+  size_t output_block_row_offset;
+  xnn_pad_ukernel_function ukernel;
+};
+
+#ifndef __cplusplus
+  XNN_PRIVATE void xnn_compute_spacetodepth2d_hwc(
+      const struct spacetodepth2d_hwc_context* context,
+      size_t batch_input_y,
+      size_t block_x);
+#endif
+
 struct max_pooling_context {
   const void** indirect_input;
   size_t indirect_input_height_stride;
@@ -585,7 +916,9 @@ struct average_pooling_context {
   size_t input_increment;
   size_t output_increment;
   union {
+    union xnn_qs8_avgpool_minmax_params qs8;
     union xnn_qu8_avgpool_minmax_params qu8;
+    union xnn_f16_scaleminmax_params f16;
     union xnn_f32_scaleminmax_params f32;
   } params;
   union {
@@ -624,6 +957,7 @@ struct pixelwise_average_pooling_context {
   size_t output_increment;
   union {
     union xnn_u8_minmax_params u8;
+    union xnn_f16_minmax_params f16;
     union xnn_f32_minmax_params f32;
   } params;
   union {
@@ -697,6 +1031,49 @@ struct global_average_pooling_ncw_context {
       size_t channels_slice);
 #endif
 
+struct reduce_context {
+  const void* input;
+  // Strides of the input along the non-reduced dimensions, outermost first, for the three parallelized indices.
+  size_t input_stride[3];
+  // Sizes and input strides of the reduced dimensions other than the innermost dimension, innermost first. Unused
+  // dimensions have size 1.
+  size_t reduction_size[3];
+  size_t reduction_stride[3];
+  // Size of the innermost dimension in bytes. The innermost dimension is reduced by the rreduce micro-kernel when it
+  // is a reduced dimension, and accumulated element-wise with the vbinary micro-kernel when it is not.
+  size_t scaled_elements;
+  void* output;
+  size_t output_stride[3];
+  float scale;
+  union {
+    xnn_f32_rmax_ukernel_function rmax;
+    xnn_f32_rmin_ukernel_function rmin;
+    xnn_f32_rsum_ukernel_function rsum;
+  } rreduce_ukernel;
+  xnn_vbinary_ukernel_function vbinary_ukernel;
+  // Optional micro-kernel to multiply the reduced elements by the scale, with minmax parameters.
+  xnn_vbinary_ukernel_function vscale_ukernel;
+  union {
+    union xnn_f32_default_params f32_default;
+    union xnn_f32_minmax_params f32_minmax;
+  } params;
+  union xnn_f32_minmax_params scale_params;
+};
+
+#ifndef __cplusplus
+  XNN_PRIVATE void xnn_compute_reduce_contiguous(
+      const struct reduce_context context[restrict XNN_MIN_ELEMENTS(1)],
+      size_t index_i,
+      size_t index_j,
+      size_t index_k);
+
+  XNN_PRIVATE void xnn_compute_reduce_strided(
+      const struct reduce_context context[restrict XNN_MIN_ELEMENTS(1)],
+      size_t index_i,
+      size_t index_j,
+      size_t index_k);
+#endif
+
 struct resize_bilinear_context {
   // Number of channels multiplied by sizeof(input element).
   size_t scaled_channels;
@@ -758,6 +1135,48 @@ struct resize_bilinear_chw_context {
     size_t pixel_range);
 #endif
 
+struct resize_nearest_context {
+  // Number of channels multiplied by sizeof(element).
+  size_t scaled_channels;
+  // Pointer to the input tensor.
+  const void* input;
+  // Stride, in bytes, between adjacent pixels in the input.
+  size_t input_pixel_stride;
+  // Stride, in bytes, between images of consecutive batches in the input.
+  size_t input_batch_stride;
+  // Offsets, in bytes, of the input row for every output row (output_height elements), followed by offsets, in
+  // bytes, of the input pixel within the row for every output column (output_width elements).
+  const size_t* input_offsets;
+  // Number of output rows.
+  size_t output_height;
+  // Number of output columns.
+  size_t output_width;
+  // Pointer to the output tensor.
+  void* output;
+  // Stride, in bytes, between adjacent pixels in the output.
+  size_t output_pixel_stride;
+  // Stride, in bytes, between adjacent rows in the output.
+  size_t output_row_stride;
+  // Stride, in bytes, between images of consecutive batches in the output.
+  size_t output_batch_stride;
+  // Number of input columns, and integer upscaling factors of output rows and columns. Only used when the output
+  // dimensions are integer multiples of the input dimensions, and input_offsets is NULL.
+  size_t input_width;
+  size_t height_scale;
+  size_t width_scale;
+};
+
+#ifndef __cplusplus
+  XNN_PRIVATE void xnn_compute_resize_nearest(
+      const struct resize_nearest_context context[restrict XNN_MIN_ELEMENTS(1)],
+      size_t batch_index,
+      size_t output_y);
+  XNN_PRIVATE void xnn_compute_resize_nearest_integer(
+      const struct resize_nearest_context context[restrict XNN_MIN_ELEMENTS(1)],
+      size_t batch_index,
+      size_t input_y);
+#endif
+
 struct elementwise_binary_context {
   const void* a;
   size_t a_stride[XNN_MAX_TENSOR_DIMS - 1];
@@ -970,6 +1389,53 @@ struct pad_context {
       size_t i, size_t j, size_t k, size_t l, size_t m);
 #endif
 
+struct pad_nd_context {
+  const void* input;
+  size_t input_stride[XNN_MAX_TENSOR_DIMS - 1];
+  void* output;
+  size_t output_stride[XNN_MAX_TENSOR_DIMS - 1];
+  // Padding before and sizes of the input in every dimension, in elements.
+  size_t pre_paddings[XNN_MAX_TENSOR_DIMS];
+  size_t input_size[XNN_MAX_TENSOR_DIMS];
+  // Size of the innermost dimension of the output, in elements.
+  size_t output_size[1];
+  uint32_t log2_element_size;
+  // Padding mode flag: one of XNN_FLAG_REFLECT_PADDING, XNN_FLAG_SYMMETRIC_PADDING, or XNN_FLAG_EDGE_PADDING.
+  uint32_t padding_mode;
+  xnn_univector_ukernel_function copy_ukernel;
+  xnn_fill_ukernel_function fill_ukernel;
+};
+
+#ifndef __cplusplus
+  XNN_PRIVATE void xnn_compute_pad_nd_5d(
+      const struct pad_nd_context context[restrict XNN_MIN_ELEMENTS(1)],
+      size_t i, size_t j, size_t k, size_t l, size_t m);
+#endif
+
+struct slice_context {
+  const void* input;
+  size_t input_stride[XNN_MAX_TENSOR_DIMS - 1];
+  void* output;
+  size_t output_stride[XNN_MAX_TENSOR_DIMS - 1];
+  // Number of bytes to copy in the innermost dimension when it is contiguous in the input, or number of elements to
+  // gather from the innermost dimension otherwise.
+  size_t inner_size;
+  // Stride, in bytes, between gathered elements of the innermost dimension. Only used with strided innermost dimension.
+  size_t inner_input_stride;
+  // Size of an element in bytes. Only used with strided innermost dimension.
+  size_t element_size;
+  xnn_univector_ukernel_function ukernel;
+};
+
+#ifndef __cplusplus
+  XNN_PRIVATE void xnn_compute_slice_5d_contiguous(
+      const struct slice_context context[restrict XNN_MIN_ELEMENTS(1)],
+      size_t i, size_t j, size_t k, size_t l, size_t m);
+  XNN_PRIVATE void xnn_compute_slice_5d_strided(
+      const struct slice_context context[restrict XNN_MIN_ELEMENTS(1)],
+      size_t i, size_t j, size_t k, size_t l, size_t m);
+#endif
+
 struct u8_softmax_context {
   size_t n;
   const uint8_t* x;
@@ -79,6 +79,74 @@ DECLARE_F32_CONV_HWC2CHW_UKERNEL_FUNCTION(xnn_f32_conv_hwc2chw_ukernel_3x3s2p1c3
 DECLARE_F32_CONV_HWC2CHW_UKERNEL_FUNCTION(xnn_f32_conv_hwc2chw_ukernel_3x3s2p1c3x4__sse_2x2)
 DECLARE_F32_CONV_HWC2CHW_UKERNEL_FUNCTION(xnn_f32_conv_hwc2chw_ukernel_3x3s2p1c3x4__wasmsimd_2x2)
 
+
+#define DECLARE_F16_DCONV_MINMAX_UKERNEL_FUNCTION(fn_name)            \
+  XNN_INTERNAL void fn_name(                                          \
+      size_t output_width,                                            \
+      size_t output_channels,                                         \
+      size_t kernel_height,                                           \
+      size_t kernel_width,                                            \
+      size_t input_channels,                                          \
+      size_t input_width,                                             \
+      size_t input_pixel_stride,                                      \
+      size_t subsampling,                                             \
+      size_t padding_left,                                            \
+      const void** input,                                             \
+      size_t input_offset,                                            \
+      const void* zero,                                               \
+      const void* weights,                                            \
+      void* output,                                                   \
+      size_t output_pixel_stride,                                     \
+      const union xnn_f16_minmax_params params[XNN_MIN_ELEMENTS(1)]);
+
+DECLARE_F16_DCONV_MINMAX_UKERNEL_FUNCTION(xnn_f16_dconv_minmax_ukernel_2x8__fma3)
+
+
+#define DECLARE_F32_DCONV_MINMAX_UKERNEL_FUNCTION(fn_name)            \
+  XNN_INTERNAL void fn_name(                                          \
+      size_t output_width,                                            \
+      size_t output_channels,                                         \
+      size_t kernel_height,                                           \
+      size_t kernel_width,                                            \
+      size_t input_channels,                                          \
+      size_t input_width,                                             \
+      size_t input_pixel_stride,                                      \
+      size_t subsampling,                                             \
+      size_t padding_left,                                            \
+      const float** input,                                            \
+      size_t input_offset,                                            \
+      const float* zero,                                              \
+      const float* weights,                                           \
+      float* output,                                                  \
+      size_t output_pixel_stride,                                     \
+      const union xnn_f32_minmax_params params[XNN_MIN_ELEMENTS(1)]);
+
+DECLARE_F32_DCONV_MINMAX_UKERNEL_FUNCTION(xnn_f32_dconv_minmax_ukernel_1x4__scalar)
+DECLARE_F32_DCONV_MINMAX_UKERNEL_FUNCTION(xnn_f32_dconv_minmax_ukernel_2x8__sse)
+
+
+#define DECLARE_QS8_DCONV_MINMAX_UKERNEL_FUNCTION(fn_name)                 \
+  XNN_INTERNAL void fn_name(                                               \
+      size_t output_width,                                                 \
+      size_t output_channels,                                              \
+      size_t kernel_height,                                                \
+      size_t kernel_width,                                                 \
+      size_t input_channels,                                               \
+      size_t input_width,                                                  \
+      size_t input_pixel_stride,                                           \
+      size_t subsampling,                                                  \
+      size_t padding_left,                                                 \
+      const int8_t** input,                                                \
+      size_t input_offset,                                                 \
+      const int8_t* zero,                                                  \
+      const void* weights,                                                 \
+      int8_t* output,                                                      \
+      size_t output_pixel_stride,                                          \
+      const union xnn_qs8_conv_minmax_params params[XNN_MIN_ELEMENTS(1)]);
+
+DECLARE_QS8_DCONV_MINMAX_UKERNEL_FUNCTION(xnn_qs8_dconv_minmax_fp32_ukernel_1x4__scalar_fmagic)
+DECLARE_QS8_DCONV_MINMAX_UKERNEL_FUNCTION(xnn_qs8_dconv_minmax_fp32_ukernel_2x8__sse41)
+
 #ifdef __cplusplus
 }  // extern "C"
 #endif
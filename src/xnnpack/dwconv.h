@@ -1300,6 +1300,29 @@ DECLARE_F32_DWCONV2D_CHW_MINMAX_UKERNEL_FUNCTION(xnn_f32_dwconv2d_chw_ukernel_5x
 DECLARE_F32_DWCONV2D_CHW_MINMAX_UKERNEL_FUNCTION(xnn_f32_dwconv2d_chw_ukernel_5x5s2p2__wasmsimd_x86_splat_3x4_acc2)
 
 
+#define DECLARE_F32_DWCONV2D_CHW_DILATED_MINMAX_UKERNEL_FUNCTION(fn_name) \
+  XNN_INTERNAL void fn_name(                                              \
+    size_t input_height,                                                  \
+    size_t input_width,                                                   \
+    size_t output_height,                                                 \
+    size_t output_width,                                                  \
+    size_t kernel_height,                                                 \
+    size_t kernel_width,                                                  \
+    size_t subsampling_height,                                            \
+    size_t subsampling_width,                                             \
+    size_t dilation_height,                                               \
+    size_t dilation_width,                                                \
+    uint32_t padding_top,                                                 \
+    uint32_t padding_left,                                                \
+    const float* input,                                                   \
+    const float* weights,                                                 \
+    float* output,                                                        \
+    const union xnn_f32_minmax_params* params);
+
+DECLARE_F32_DWCONV2D_CHW_DILATED_MINMAX_UKERNEL_FUNCTION(xnn_f32_dwconv2d_chw_ukernel_dilated__scalar_1x1)
+DECLARE_F32_DWCONV2D_CHW_DILATED_MINMAX_UKERNEL_FUNCTION(xnn_f32_dwconv2d_chw_ukernel_dilated__sse_1x4)
+
+
 #ifdef __cplusplus
 }  // extern "C"
 #endif
@@ -19,17 +19,59 @@
 extern "C" {
 #endif
 
+// Padding mode flags for padding which replicates input elements rather than inserts a constant.
+#define XNN_PADDING_MODE_FLAGS (XNN_FLAG_REFLECT_PADDING | XNN_FLAG_SYMMETRIC_PADDING | XNN_FLAG_EDGE_PADDING)
+
+// Map a coordinate in a padded dimension, relative to the first input element and thus wrapped around for the leading
+// padding, to the coordinate of the input element it replicates under the padding mode in flags. The padding must not
+// exceed the limits of the padding mode, so that a single reflection brings the coordinate inside the input.
+static inline size_t xnn_padded_input_index(size_t index, size_t size, uint32_t flags) {
+  if XNN_LIKELY(index < size) {
+    return index;
+  }
+  const bool before_input = (ptrdiff_t) index < 0;
+  if (flags & XNN_FLAG_EDGE_PADDING) {
+    return before_input ? 0 : size - 1;
+  }
+  const size_t symmetric = (size_t) ((flags & XNN_FLAG_SYMMETRIC_PADDING) != 0);
+  if (before_input) {
+    return -index - symmetric;
+  } else {
+    return 2 * size - 2 + symmetric - index;
+  }
+}
+
 XNN_INTERNAL void xnn_indirection_init_conv2d(
   xnn_operator_t op,
   size_t output_tile_size,
   uint32_t log2_element_size);
 
+// Offset of padding entries in compact indirection buffers, which are expanded to the zero buffer pointer.
+#define XNN_INDIRECTION_ZERO_OFFSET UINT32_MAX
+
+// Maximum number of entries of one output tile (kernel size x MR) in compact indirection buffers, which are expanded to
+// pointers on the stack before every micro-kernel call.
+#define XNN_MAX_COMPACT_INDIRECTION_TILE_ENTRIES 512
+
+// Initialize a compact indirection buffer for an IGEMM convolution: same layout as in xnn_indirection_init_conv2d, but
+// with 32-bit byte offsets from op->input instead of pointers, and XNN_INDIRECTION_ZERO_OFFSET for padding.
+XNN_INTERNAL void xnn_indirection_init_conv2d_compact(
+  xnn_operator_t op,
+  size_t output_tile_size,
+  uint32_t log2_element_size);
+
 XNN_INTERNAL void xnn_indirection_init_dwconv2d(
   xnn_operator_t op,
   size_t step_height,
   size_t step_width,
   uint32_t log2_element_size);
 
+// Initialize an indirection buffer for a direct convolution: one pointer to the input row, or to the zero buffer for
+// padding rows, for every output row and kernel row. The micro-kernel computes the horizontal input offsets itself.
+XNN_INTERNAL void xnn_indirection_init_dconv2d(
+  xnn_operator_t op,
+  uint32_t log2_element_size);
+
 XNN_INTERNAL void xnn_indirection_init_deconv2d(
   xnn_operator_t op,
   size_t output_tile_size,
@@ -40,6 +82,12 @@ XNN_INTERNAL void xnn_indirection_init_subconv2d(
   size_t output_tile_size,
   uint32_t log2_element_size);
 
+XNN_INTERNAL void xnn_indirection_init_dwdeconv2d(
+  xnn_operator_t op,
+  size_t step_height,
+  size_t step_width,
+  uint32_t log2_element_size);
+
 XNN_INTERNAL void xnn_indirection_init_maxpool2d(
   xnn_operator_t op,
   size_t step_height,
@@ -94,6 +142,18 @@ XNN_INTERNAL void xnn_indirection_init_resize_bilinear2d_hwc_q11(
   bool align_corners,
   bool tensorflow_legacy);
 
+// Computes byte offsets of the nearest input row for every output row, followed by byte offsets of the nearest input
+// pixel within a row for every output column.
+XNN_INTERNAL void xnn_indirection_init_resize_nearest2d_hwc(
+  size_t input_pixel_stride,
+  size_t input_height,
+  size_t input_width,
+  size_t output_height,
+  size_t output_width,
+  size_t* input_offsets,
+  bool align_corners,
+  bool tensorflow_legacy);
+
 XNN_INTERNAL void xnn_indirection_init_resize_bilinear2d_chw_f32(
   size_t input_pixel_stride,
   size_t input_height,
@@ -53,6 +53,11 @@ inline static void xnn_release_value_allocation_tracker(struct xnn_value_allocat
 XNN_INTERNAL void xnn_add_value_allocation_tracker(struct xnn_value_allocation_tracker* tracker,
                                                    uint32_t value_id, size_t tensor_size);
 
+// Extend the lifecycle of the xnn_value referred by 'value_id' to cover the lifecycle of the xnn_value referred by
+// 'alias_id', which shares its memory instead of being allocated.
+XNN_INTERNAL void xnn_alias_value_allocation_tracker(struct xnn_value_allocation_tracker* tracker,
+                                                     uint32_t value_id, uint32_t alias_id);
+
 // Plan the exact the memory allocation for intermediate tensors according to the xnn_value allocation tracker.
 XNN_INTERNAL void xnn_plan_value_allocation_tracker(struct xnn_value_allocation_tracker* tracker);
 
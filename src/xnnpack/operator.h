@@ -8,6 +8,7 @@
 
 #pragma once
 
+#include <stdbool.h>
 #include <stddef.h>
 #include <stdint.h>
 
@@ -22,7 +23,9 @@ enum xnn_ukernel_type {
   xnn_ukernel_type_default = 0,
   xnn_ukernel_type_average_pooling,
   xnn_ukernel_type_conv2d_hwc2chw,
+  xnn_ukernel_type_dconv,
   xnn_ukernel_type_dwconv,
+  xnn_ukernel_type_dwconv2d_dilated,
   xnn_ukernel_type_gemm,
   xnn_ukernel_type_igemm,
   xnn_ukernel_type_pixelwise_average_pooling,
@@ -39,7 +42,9 @@ enum xnn_operator_type {
   xnn_operator_type_add_nd_qs8,
   xnn_operator_type_add_nd_qu8,
   xnn_operator_type_argmax_pooling_nhwc_f32,
+  xnn_operator_type_average_pooling_nhwc_f16,
   xnn_operator_type_average_pooling_nhwc_f32,
+  xnn_operator_type_average_pooling_nhwc_qs8,
   xnn_operator_type_average_pooling_nhwc_qu8,
   xnn_operator_type_bankers_rounding_nc_f32,
   xnn_operator_type_channel_shuffle_nc_x8,
@@ -64,6 +69,7 @@ enum xnn_operator_type {
   xnn_operator_type_convolution_nhwc_qc8,
   xnn_operator_type_convolution_nhwc_qs8,
   xnn_operator_type_convolution_nhwc_qu8,
+  xnn_operator_type_convolution_nwc_f32,
   xnn_operator_type_copy_nc_x8,
   xnn_operator_type_copy_nc_x16,
   xnn_operator_type_copy_nc_x32,
@@ -88,20 +94,29 @@ enum xnn_operator_type {
   xnn_operator_type_global_average_pooling_ncw_f32,
   xnn_operator_type_hardswish_nc_f16,
   xnn_operator_type_hardswish_nc_f32,
+  xnn_operator_type_inverted_bottleneck_nhwc_f32,
   xnn_operator_type_leaky_relu_nc_f16,
   xnn_operator_type_leaky_relu_nc_f32,
   xnn_operator_type_leaky_relu_nc_qu8,
+  xnn_operator_type_max_nd_f32,
   xnn_operator_type_max_pooling_nhwc_f16,
   xnn_operator_type_max_pooling_nhwc_f32,
   xnn_operator_type_max_pooling_nhwc_s8,
   xnn_operator_type_max_pooling_nhwc_u8,
   xnn_operator_type_maximum_nd_f32,
+  xnn_operator_type_mean_nd_f16,
+  xnn_operator_type_mean_nd_f32,
+  xnn_operator_type_mean_nd_qs8,
+  xnn_operator_type_min_nd_f32,
   xnn_operator_type_minimum_nd_f32,
   xnn_operator_type_multiply_nd_f16,
   xnn_operator_type_multiply_nd_f32,
   xnn_operator_type_multiply_nd_qs8,
   xnn_operator_type_multiply_nd_qu8,
   xnn_operator_type_negate_nc_f32,
+  xnn_operator_type_pad_nd_x8,
+  xnn_operator_type_pad_nd_x16,
+  xnn_operator_type_pad_nd_x32,
   xnn_operator_type_prelu_nc_f16,
   xnn_operator_type_prelu_nc_f32,
   xnn_operator_type_resize_bilinear_nchw_f32,
@@ -109,17 +124,29 @@ enum xnn_operator_type {
   xnn_operator_type_resize_bilinear_nhwc_f32,
   xnn_operator_type_resize_bilinear_nhwc_s8,
   xnn_operator_type_resize_bilinear_nhwc_u8,
+  xnn_operator_type_resize_nearest_nhwc_x8,
+  xnn_operator_type_resize_nearest_nhwc_x16,
+  xnn_operator_type_resize_nearest_nhwc_x32,
   xnn_operator_type_sigmoid_nc_f32,
   xnn_operator_type_sigmoid_nc_qs8,
   xnn_operator_type_sigmoid_nc_qu8,
+  xnn_operator_type_slice_nd_x8,
+  xnn_operator_type_slice_nd_x16,
+  xnn_operator_type_slice_nd_x32,
   xnn_operator_type_softmax_nc_f32,
   xnn_operator_type_softmax_nc_qu8,
+  xnn_operator_type_space_to_depth_nhwc_x8,
+  xnn_operator_type_space_to_depth_nhwc_x16,
+  xnn_operator_type_space_to_depth_nhwc_x32,
   xnn_operator_type_square_nc_f32,
   xnn_operator_type_square_root_nc_f32,
   xnn_operator_type_squared_difference_nd_f32,
   xnn_operator_type_subtract_nd_f32,
   xnn_operator_type_subtract_nd_qs8,
   xnn_operator_type_subtract_nd_qu8,
+  xnn_operator_type_sum_nd_f16,
+  xnn_operator_type_sum_nd_f32,
+  xnn_operator_type_sum_nd_qs8,
   xnn_operator_type_tanh_nc_qs8,
   xnn_operator_type_tanh_nc_qu8,
   xnn_operator_type_truncation_nc_f32,
@@ -135,6 +162,13 @@ struct xnn_ukernel_conv2d {
   uint8_t output_channel_tile;
 };
 
+// Direct 2D Convolution in NHWC layout
+struct xnn_ukernel_dconv {
+  xnn_dconv_ukernel_function function;
+  uint8_t mr;
+  uint8_t nr;
+};
+
 struct xnn_ukernel_dwconv {
   union {
     xnn_dwconv_unipass_ukernel_function unipass_function;
@@ -148,6 +182,7 @@ struct xnn_ukernel_dwconv {
 struct xnn_ukernel_dwconv2d {
   union {
     xnn_dwconv2d_chw_ukernel_function chw_function;
+    xnn_dwconv2d_chw_dilated_ukernel_function chw_dilated_function;
   };
   uint8_t output_width_tile;
 };
@@ -155,6 +190,7 @@ struct xnn_ukernel_dwconv2d {
 struct xnn_ukernel_gemm {
   struct xnn_hmp_gemm_ukernel general_case;
   struct xnn_hmp_gemm_ukernel mr1_case;
+  struct xnn_hmp_gemm_ukernel gemv_case;
 #if XNN_PLATFORM_JIT
   struct xnn_code_buffer general_code_buffer;
   struct xnn_code_buffer mr1_code_buffer;
@@ -203,6 +239,7 @@ struct xnn_ukernel {
   enum xnn_ukernel_type type;
   union {
     struct xnn_ukernel_conv2d conv2d;
+    struct xnn_ukernel_dconv dconv;
     struct xnn_ukernel_dwconv dwconv;
     struct xnn_ukernel_dwconv2d dwconv2d;
     struct xnn_ukernel_gemm gemm;
@@ -261,12 +298,25 @@ struct xnn_operator {
   const void* input;
   const void* input2;
   const void** indirection_buffer;
+  // IGEMM-based operator with the same input geometry, set up before this operator, whose indirection buffer is used
+  // instead of a private one when the two are compatible in setup. Not owned by this operator.
+  struct xnn_operator* indirection_source;
+  // Output tile size and format (32-bit offsets instead of pointers) of the indirection buffer of an IGEMM-based
+  // operator, as of the last rebuild.
+  uint32_t indirection_mr;
+  bool compact_indirection;
 
   size_t output_height;
   size_t output_width;
   size_t output_pixel_stride;
   void* output;
 
+  // Residual tensor added to the output of GEMM-, IGEMM-, and direct convolution-based operators with fused residual
+  // addition.
+  const void* residual;
+  size_t residual_pixel_stride;
+  xnn_vbinary_ukernel_function residual_ukernel;
+
   void* packed_weights;
   // Total number of non-zero kernel elements when weights use sparse representation.
   size_t num_nonzero_values;
@@ -276,6 +326,12 @@ struct xnn_operator {
   size_t num_output_channel_blocks;
   // Input channel corresponding to the first non-zero kernel element.
   size_t first_input_channel;
+  // Number of segments of the reduction dimension in packed GEMM weights, and the number of input channels in every
+  // segment but the last one. Zero if the packed weights are not segmented.
+  size_t num_k_segments;
+  size_t k_segment_size;
+  // Parameters of the addition of partial sums over segments of the reduction dimension, with output clamping.
+  union xnn_f32_minmax_params k_segment_vadd_params;
 
   float input_scale;
   float output_scale;
@@ -298,6 +354,39 @@ struct xnn_operator {
   void* lookup_table;
   void* pixelwise_buffer;
   struct subconvolution_params* subconvolution_buffer;
+  // Scratch memory for intermediate results, allocated in setup.
+  void* scratch_buffer;
+  size_t scratch_buffer_size;
+  // Operators owned and executed by a fused operator, e.g. an inverted bottleneck block.
+  struct xnn_operator* fused_operators[3];
+  // State of a streaming 1D Convolution operator (XNN_FLAG_STREAMING). The history buffer keeps, for every sequence
+  // in the batch, the last input frames which are still needed by future outputs. When setup starts with a non-empty
+  // history, run concatenates the history and the new chunk in the staging buffer, and the convolution reads from it.
+  struct {
+    void* history;
+    size_t history_capacity;
+    size_t history_frames;
+    size_t initial_history_frames;
+    size_t batch_size;
+    void* staging;
+    size_t staging_size;
+    const void* input;
+    size_t input_frames;
+    size_t output_frames;
+    size_t consumed_frames;
+    bool staged;
+  } streaming;
+  // Operators cloned from another operator borrow its packed weights, lookup table, and JIT-generated code, unless they
+  // are re-created in setup, and, unless the zero buffer is re-created in setup, its zero buffer. Borrowed buffers are
+  // not released with the operator.
+  bool shares_weights;
+  bool shares_zero_buffer;
+  // Packed weights are in caller-owned memory (see struct xnn_packed_weights_buffer), and not released with the
+  // operator.
+  bool external_packed_weights;
+  // Packed weights are allocated, but not yet filled in from the kernel and bias in context.pack_gemm. Packing is
+  // deferred to xnn_pack_operator_weights, called in the first setup of the operator or at runtime creation.
+  bool weights_packing_pending;
   uint32_t flags;
 
   union {
@@ -317,6 +406,13 @@ struct xnn_operator {
     union xnn_f32_hswish_params f32_hswish;
     union xnn_f16_minmax_params f16_minmax;
     union xnn_f16_scaleminmax_params f16_scaleminmax;
+    // Pixelwise Average Pooling normally use f16_pavgpool params, but also initialize f16_avgpool params in case it
+    // needs to switch to Global Average Pooling operation. These are separate from f16_minmax and f16_scaleminmax,
+    // which other operators expect at the start of the union.
+    struct {
+      union xnn_f16_minmax_params f16_pavgpool;
+      union xnn_f16_scaleminmax_params f16_avgpool;
+    };
     // Pixelwise Average Pooling normally use f32_minmax_params, but also initialize
     // f32_scaleminmax_params in case it needs to switch to Global Average Pooling operation.
     struct {
@@ -363,6 +459,13 @@ struct xnn_operator {
     union xnn_s8_minmax_params s8_minmax;
     union xnn_u8_minmax_params u8_minmax;
   } params;
+  // Parameters of the fused residual addition. The operator output is the first input of the addition.
+  union {
+    union xnn_qs8_addsub_minmax_params qs8;
+    union xnn_qu8_addsub_minmax_params qu8;
+    union xnn_f16_minmax_params f16;
+    union xnn_f32_minmax_params f32;
+  } residual_params;
   enum xnn_operator_type type;
   struct xnn_ukernel ukernel;
 
@@ -373,7 +476,9 @@ struct xnn_operator {
     struct average_pooling_context average_pooling;
     struct channel_shuffle_context channel_shuffle;
     struct conv2d_context conv2d;
+    struct dconv_context dconv;
     struct dwconv2d_context dwconv2d;
+    struct dwconv2d_dilated_context dwconv2d_dilated;
     struct dwconv_context dwconv;
     struct depthtospace2d_chw2hwc_context depthtospace2d_chw;
     struct depthtospace2d_hwc_context depthtospace2d_hwc;
@@ -382,15 +487,23 @@ struct xnn_operator {
     struct global_average_pooling_nwc_context global_average_pooling_nwc;
     struct global_average_pooling_ncw_context global_average_pooling_ncw;
     struct igemm_context igemm;
+    struct inverted_bottleneck_context inverted_bottleneck;
     struct lut_contiguous_context lut_contiguous;
     struct lut_strided_context lut_strided;
     struct max_pooling_context max_pooling;
+    struct pack_gemm_context pack_gemm;
     struct pad_context pad;
+    struct pad_nd_context pad_nd;
+    struct slice_context slice;
+    struct spacetodepth2d_hwc_context spacetodepth2d_hwc;
     struct pixelwise_average_pooling_context pixelwise_average_pooling;
     struct prelu_context prelu;
+    struct reduce_context reduce;
     struct resize_bilinear_context resize_bilinear;
     struct resize_bilinear_chw_context resize_bilinear_chw;
+    struct resize_nearest_context resize_nearest;
     struct spmm_context spmm;
+    struct split_k_gemm_context split_k_gemm;
     struct subconv_context subconv;
     struct subgemm_context subgemm;
     struct f32_three_pass_softmax_context f32_three_pass_softmax;
@@ -403,3 +516,56 @@ struct xnn_operator {
 
   enum xnn_run_state state;
 };
+
+// Caller-owned memory for the packed weights of an operator, which replaces the memory allocated by the operator.
+struct xnn_packed_weights_buffer {
+  // Caller-owned memory, or NULL to only compute the size and the fingerprint of the packed weights.
+  void* data;
+  // Size of data in bytes. Set to the size of the packed weights unless the weights are pre-packed.
+  size_t size;
+  // Fingerprint of the configuration of the packed weights. Set when packing, and validated for pre-packed weights.
+  uint64_t fingerprint;
+  // Data already holds packed weights, which the operator references as is.
+  bool prepacked;
+};
+
+// Fingerprint of the packed weights layout described by an array of layout parameters (e.g. the operator type, the
+// weights dimensions, and the micro-kernel tile sizes) and by the packing parameters.
+XNN_INTERNAL uint64_t xnn_compute_packed_weights_fingerprint(
+  const size_t* layout,
+  size_t layout_size,
+  const void* packing_params,
+  size_t packing_params_size);
+
+// Initialize op->packed_weights with size bytes of memory: allocated by the operator (in huge pages with
+// XNN_FLAG_HUGE_PAGES in flags) if packed_weights_buffer is NULL, and the caller-owned memory otherwise. pack_out is set to true if the operator must pack its weights into the memory,
+// and to false if the weights are pre-packed or if the caller only queries the size and fingerprint of the weights, in
+// which case op->packed_weights stays NULL.
+XNN_INTERNAL enum xnn_status xnn_init_packed_weights(
+  xnn_operator_t op,
+  struct xnn_packed_weights_buffer* packed_weights_buffer,
+  size_t size,
+  uint64_t fingerprint,
+  uint32_t flags,
+  enum xnn_operator_type operator_type,
+  bool* pack_out);
+
+// Pack weights of the operator and of its fused operators if packing was deferred at creation (see
+// XNN_FLAG_DEFER_PACKING). Packing is parallelized across threads of the threadpool. No-op for packed operators.
+XNN_INTERNAL void xnn_pack_operator_weights(
+  xnn_operator_t op,
+  pthreadpool_t threadpool);
+
+// Number of independent tasks in one pass (op->compute or op->compute2) of the computation of a successfully setup
+// operator, i.e. the number of calls to the compute function that pthreadpool would make in xnn_run_operator.
+// Returns 0 for operators and passes that have nothing to do.
+XNN_INTERNAL size_t xnn_get_operator_task_count(
+  const struct xnn_operator* op,
+  const struct compute_parameters* compute);
+
+// Run tasks [task_start, task_start + task_count) of one pass of a successfully setup operator on the caller thread.
+XNN_INTERNAL void xnn_run_operator_tasks(
+  struct xnn_operator* op,
+  const struct compute_parameters* compute,
+  size_t task_start,
+  size_t task_count);
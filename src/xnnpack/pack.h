@@ -12,13 +12,15 @@
 #include <stddef.h>
 
 #include <xnnpack/common.h>
-#include <xnnpack/operator.h>
 
 
 #ifdef __cplusplus
 extern "C" {
 #endif
 
+// Defined in xnnpack/operator.h.
+struct subconvolution_params;
+
 
 struct xnn_qu8_packing_params {
   uint8_t input_zero_point;
@@ -1682,6 +1682,13 @@ union xnn_qs8_avgpool_minmax_params {
     XNN_ALIGN(16) int16_t output_zero_point[8];
     XNN_ALIGN(16) int8_t output_min[16];
   } fp32_sse4;
+  struct {
+    XNN_ALIGN(32) int32_t init_bias[8];
+    XNN_ALIGN(32) float scale[8];
+    XNN_ALIGN(32) float output_max_less_zero_point[8];
+    XNN_ALIGN(32) int16_t output_zero_point[16];
+    XNN_ALIGN(32) int8_t output_min[32];
+  } fp32_avx2;
 #endif  // XNN_ARCH_X86 || XNN_ARCH_X86_64
 #if XNN_ARCH_WASMSIMD || XNN_ARCH_WASMRELAXEDSIMD
   struct {
@@ -2402,6 +2409,78 @@ typedef void (*xnn_f32_conv_hwc2chw_ukernel_function)(
     size_t output_channel_stride,
     const union xnn_f32_minmax_params* params);
 
+typedef void (*xnn_dconv_ukernel_function)(
+    size_t output_width,
+    size_t output_channels,
+    size_t kernel_height,
+    size_t kernel_width,
+    size_t input_channels,
+    size_t input_width,
+    size_t input_pixel_stride,
+    size_t subsampling,
+    size_t padding_left,
+    const void** input,
+    size_t input_offset,
+    const void* zero,
+    const void* weights,
+    void* output,
+    size_t output_pixel_stride,
+    const void* params);
+
+typedef void (*xnn_f16_dconv_minmax_ukernel_function)(
+    size_t output_width,
+    size_t output_channels,
+    size_t kernel_height,
+    size_t kernel_width,
+    size_t input_channels,
+    size_t input_width,
+    size_t input_pixel_stride,
+    size_t subsampling,
+    size_t padding_left,
+    const void** input,
+    size_t input_offset,
+    const void* zero,
+    const void* weights,
+    void* output,
+    size_t output_pixel_stride,
+    const union xnn_f16_minmax_params* params);
+
+typedef void (*xnn_f32_dconv_minmax_ukernel_function)(
+    size_t output_width,
+    size_t output_channels,
+    size_t kernel_height,
+    size_t kernel_width,
+    size_t input_channels,
+    size_t input_width,
+    size_t input_pixel_stride,
+    size_t subsampling,
+    size_t padding_left,
+    const float** input,
+    size_t input_offset,
+    const float* zero,
+    const float* weights,
+    float* output,
+    size_t output_pixel_stride,
+    const union xnn_f32_minmax_params* params);
+
+typedef void (*xnn_qs8_dconv_minmax_ukernel_function)(
+    size_t output_width,
+    size_t output_channels,
+    size_t kernel_height,
+    size_t kernel_width,
+    size_t input_channels,
+    size_t input_width,
+    size_t input_pixel_stride,
+    size_t subsampling,
+    size_t padding_left,
+    const int8_t** input,
+    size_t input_offset,
+    const int8_t* zero,
+    const void* weights,
+    int8_t* output,
+    size_t output_pixel_stride,
+    const union xnn_qs8_conv_minmax_params* params);
+
 typedef void (*xnn_spmm_ukernel_function)(
     size_t batch_size,
     size_t output_channels,
@@ -2560,6 +2639,42 @@ typedef void (*xnn_f32_dwconv2d_chw_ukernel_function)(
     uint32_t padding_top,
     const union xnn_f32_chw_params* params);
 
+typedef void (*xnn_dwconv2d_chw_dilated_ukernel_function)(
+    size_t input_height,
+    size_t input_width,
+    size_t output_height,
+    size_t output_width,
+    size_t kernel_height,
+    size_t kernel_width,
+    size_t subsampling_height,
+    size_t subsampling_width,
+    size_t dilation_height,
+    size_t dilation_width,
+    uint32_t padding_top,
+    uint32_t padding_left,
+    const void* input,
+    const void* weights,
+    void* output,
+    const void* params);
+
+typedef void (*xnn_f32_dwconv2d_chw_dilated_ukernel_function)(
+    size_t input_height,
+    size_t input_width,
+    size_t output_height,
+    size_t output_width,
+    size_t kernel_height,
+    size_t kernel_width,
+    size_t subsampling_height,
+    size_t subsampling_width,
+    size_t dilation_height,
+    size_t dilation_width,
+    uint32_t padding_top,
+    uint32_t padding_left,
+    const float* input,
+    const float* weights,
+    float* output,
+    const union xnn_f32_minmax_params* params);
+
 typedef void (*xnn_dwconv_unipass_ukernel_function)(
     size_t channels,
     size_t output_width,
@@ -2841,6 +2956,18 @@ typedef void (*xnn_avgpool_unipass_ukernel_function)(
     size_t output_increment,
     const void* params);
 
+typedef void (*xnn_f16_avgpool_minmax_unipass_ukernel_function)(
+    size_t output_pixels,
+    size_t kernel_elements,
+    size_t channels,
+    const void** input,
+    size_t input_offset,
+    const void* zero,
+    void* output,
+    size_t input_increment,
+    size_t output_increment,
+    const union xnn_f16_scaleminmax_params* params);
+
 typedef void (*xnn_f32_avgpool_minmax_unipass_ukernel_function)(
     size_t output_pixels,
     size_t kernel_elements,
@@ -2853,6 +2980,18 @@ typedef void (*xnn_f32_avgpool_minmax_unipass_ukernel_function)(
     size_t output_increment,
     const union xnn_f32_scaleminmax_params* params);
 
+typedef void (*xnn_qs8_avgpool_minmax_unipass_ukernel_function)(
+    size_t output_pixels,
+    size_t kernel_elements,
+    size_t channels,
+    const int8_t** input,
+    size_t input_offset,
+    const int8_t* zero,
+    int8_t* output,
+    size_t input_increment,
+    size_t output_increment,
+    const union xnn_qs8_avgpool_minmax_params* params);
+
 typedef void (*xnn_qu8_avgpool_minmax_unipass_ukernel_function)(
     size_t output_pixels,
     size_t kernel_elements,
@@ -2878,6 +3017,19 @@ typedef void (*xnn_avgpool_multipass_ukernel_function)(
     size_t output_increment,
     const void* params);
 
+typedef void (*xnn_f16_avgpool_minmax_multipass_ukernel_function)(
+    size_t output_pixels,
+    size_t kernel_elements,
+    size_t channels,
+    const void** input,
+    size_t input_offset,
+    const void* zero,
+    void* buffer,
+    void* output,
+    size_t input_increment,
+    size_t output_increment,
+    const union xnn_f16_scaleminmax_params* params);
+
 typedef void (*xnn_f32_avgpool_minmax_multipass_ukernel_function)(
     size_t output_pixels,
     size_t kernel_elements,
@@ -2891,6 +3043,19 @@ typedef void (*xnn_f32_avgpool_minmax_multipass_ukernel_function)(
     size_t output_increment,
     const union xnn_f32_scaleminmax_params* params);
 
+typedef void (*xnn_qs8_avgpool_minmax_multipass_ukernel_function)(
+    size_t output_pixels,
+    size_t kernel_elements,
+    size_t channels,
+    const int8_t** input,
+    size_t input_offset,
+    const int8_t* zero,
+    int32_t* buffer,
+    int8_t* output,
+    size_t input_increment,
+    size_t output_increment,
+    const union xnn_qs8_avgpool_minmax_params* params);
+
 typedef void (*xnn_qu8_avgpool_minmax_multipass_ukernel_function)(
     size_t output_pixels,
     size_t kernel_elements,
@@ -2917,6 +3082,19 @@ typedef void (*xnn_pavgpool_unipass_ukernel_function)(
     size_t output_increment,
     const void* params);
 
+typedef void (*xnn_f16_pavgpool_minmax_unipass_ukernel_function)(
+    size_t output_pixels,
+    size_t kernel_elements,
+    size_t channels,
+    const void** input,
+    size_t input_offset,
+    const void* zero,
+    const void* multiplier,
+    void* output,
+    size_t input_increment,
+    size_t output_increment,
+    const union xnn_f16_minmax_params* params);
+
 typedef void (*xnn_f32_pavgpool_minmax_unipass_ukernel_function)(
     size_t output_pixels,
     size_t kernel_elements,
@@ -2944,6 +3122,20 @@ typedef void (*xnn_pavgpool_multipass_ukernel_function)(
     size_t output_increment,
     const void* params);
 
+typedef void (*xnn_f16_pavgpool_minmax_multipass_ukernel_function)(
+    size_t output_pixels,
+    size_t kernel_elements,
+    size_t channels,
+    const void** input,
+    size_t input_offset,
+    const void* zero,
+    const void* multiplier,
+    void* buffer,
+    void* output,
+    size_t input_increment,
+    size_t output_increment,
+    const union xnn_f16_minmax_params* params);
+
 typedef void (*xnn_f32_pavgpool_minmax_multipass_ukernel_function)(
     size_t output_pixels,
     size_t kernel_elements,
@@ -3160,6 +3352,16 @@ typedef void (*xnn_f32_rmax_ukernel_function)(
     const float* x,
     float* y);
 
+typedef void (*xnn_f32_rmin_ukernel_function)(
+    size_t n,
+    const float* x,
+    float* y);
+
+typedef void (*xnn_f32_rsum_ukernel_function)(
+    size_t n,
+    const float* x,
+    float* y);
+
 typedef void (*xnn_u8_lut32norm_ukernel_function)(
     size_t n,
     const uint8_t* x,
@@ -3700,6 +3902,9 @@ struct gemm_fused_ukernels {
   // Optional GEMM and IGEMM micro-kernels with MR=1 and the same NR and KR parameters.
   struct xnn_hmp_gemm_ukernel gemm1;
   struct xnn_hmp_igemm_ukernel igemm1;
+  // Optional GEMM micro-kernel with MR=1 and the same NR, KR, and SR parameters, specialized for matrix-vector products
+  // (i.e. batch-1 Fully Connected) with long reduction dimension.
+  struct xnn_hmp_gemm_ukernel gemv;
 };
 
 #if XNN_PLATFORM_JIT
@@ -3857,6 +4062,23 @@ struct conv_hwc2chw_parameters {
   uint8_t output_width_tile;
 };
 
+struct dconv_parameters {
+  xnn_dconv_ukernel_function ukernel;
+  union {
+    xnn_init_qs8_conv_minmax_params_fn qs8;
+    xnn_init_f16_minmax_params_fn f16;
+    xnn_init_f32_minmax_params_fn f32;
+  } init;
+  // Number of output pixels in a tile.
+  // For best efficiency, micro-kernel must produce a multiple of this number of pixels in each call.
+  uint8_t mr;
+  // Number of output channels in a tile.
+  // This parameter must be passed as is to weight packing function.
+  uint8_t nr;
+  // Maximum number of input channels for which the micro-kernel is preferred over IGEMM.
+  uint8_t max_input_channels;
+};
+
 struct dwconv2d_chw_parameters {
   xnn_dwconv2d_chw_ukernel_function ukernel;
   // Number of output width pixels in a tile.
@@ -3866,6 +4088,15 @@ struct dwconv2d_chw_parameters {
   uint8_t output_height_tile;
 };
 
+struct dwconv2d_chw_dilated_parameters {
+  xnn_dwconv2d_chw_dilated_ukernel_function ukernel;
+  union {
+    xnn_init_f32_minmax_params_fn f32;
+  } init;
+  // Number of output width pixels in a tile.
+  uint8_t output_width_tile;
+};
+
 struct gavgpool_cw_parameters {
   xnn_gavgpool_cw_ukernel_function ukernel;
   // Number of channels in a tile.
@@ -3930,7 +4161,9 @@ struct avgpool_parameters {
   xnn_avgpool_unipass_ukernel_function unipass;
   xnn_avgpool_multipass_ukernel_function multipass;
   union {
+    xnn_init_f16_scaleminmax_params_fn f16;
     xnn_init_f32_scaleminmax_params_fn f32;
+    xnn_init_qs8_avgpool_minmax_params_fn qs8;
     xnn_init_qu8_avgpool_minmax_params_fn qu8;
   } init;
   // Number of rows in a primary tile.
@@ -3949,6 +4182,9 @@ struct avgpool_parameters {
 struct pavgpool_parameters {
   xnn_pavgpool_unipass_ukernel_function unipass;
   xnn_pavgpool_multipass_ukernel_function multipass;
+  union {
+    xnn_init_f16_minmax_params_fn f16;
+  } init;
   // Number of rows in a primary tile.
   // Unipass micro-kernel must be called with this number of rows, or fewer.
   // Multipass micro-kernel must be called with more than this number of rows.
@@ -4098,6 +4334,9 @@ struct xnn_parameters {
   struct {
     struct gemm_parameters gemm;
     struct dwconv_parameters dwconv[XNN_MAX_QS8_DWCONV_UKERNELS];
+    // Direct Convolution with few input channels and large kernel and stride.
+    struct dconv_parameters dconv;
+    struct avgpool_parameters avgpool;
     struct gavgpool_parameters gavgpool;
     struct vbinary_parameters vadd;
     struct vbinary_parameters vmul;
@@ -4129,10 +4368,14 @@ struct xnn_parameters {
     struct zip_parameters zip;
   } x8;
   struct {
+    struct avgpool_parameters avgpool;
+    struct pavgpool_parameters pavgpool;
     struct gavgpool_parameters gavgpool;
     struct gemm_parameters gemm;
     struct gemm_parameters gemm2;
     struct dwconv_parameters dwconv[XNN_MAX_F16_DWCONV_UKERNELS];
+    // Direct Convolution with few input channels and large kernel and stride.
+    struct dconv_parameters dconv;
     // Bilinear interpolation (2D).
     struct ibilinear_parameters ibilinear;
     struct maxpool_parameters maxpool;
@@ -4148,6 +4391,8 @@ struct xnn_parameters {
     struct gemm_parameters gemm;
     struct gemm_parameters gemm2;
     struct dwconv_parameters dwconv[XNN_MAX_F32_DWCONV_UKERNELS];
+    // Direct Convolution with few input channels and large kernel and stride.
+    struct dconv_parameters dconv;
     struct avgpool_parameters avgpool;
     struct pavgpool_parameters pavgpool;
     struct gavgpool_parameters gavgpool;
@@ -4180,6 +4425,8 @@ struct xnn_parameters {
     struct vmulcaddc_parameters vmulcaddc;
     struct raddstoreexpminusmax_parameters raddstoreexpminusmax;
     xnn_f32_rmax_ukernel_function rmax;
+    xnn_f32_rmin_ukernel_function rmin;
+    xnn_f32_rsum_ukernel_function rsum;
     // Sparse Matrix-Dense Matrix Multiplication (NR=1 block).
     struct spmm_parameters spmm;
     // Sparse Matrix-Dense Matrix Multiplication (NR=2 block).
@@ -4196,6 +4443,8 @@ struct xnn_parameters {
     struct dwconv2d_chw_parameters dwconv2d_chw_5x5;
     // Direct 5x5 stride-2 Convolution with padding 2 on left and right in CHW layout.
     struct dwconv2d_chw_parameters dwconv2d_chw_5x5s2;
+    // Direct depthwise Convolution with arbitrary kernel size, stride, dilation, and padding in CHW layout.
+    struct dwconv2d_chw_dilated_parameters dwconv2d_chw_dilated;
     // Global Average Pooling in CW layout.
     struct gavgpool_cw_parameters gavgpool_cw;
     // Bilinear interpolation (2D) in CHW layout.
@@ -4220,6 +4469,11 @@ struct xnn_parameters {
     struct fill_parameters fill;
     struct pad_parameters pad;
   } xx;
+  // Sizes of the data caches available to a single core, used to choose block sizes in GEMM-based operators.
+  struct {
+    size_t l1d_size;
+    size_t l2_size;
+  } cache;
 };
 
 #ifdef __cplusplus
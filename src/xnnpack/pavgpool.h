@@ -16,6 +16,45 @@ extern "C" {
 #endif
 
 
+#define DECLARE_F16_PAVGPOOL_MINMAX_MULTIPASS_UKERNEL_FUNCTION(fn_name) \
+  XNN_INTERNAL void fn_name(                                            \
+      size_t output_pixels,                                             \
+      size_t kernel_elements,                                           \
+      size_t channels,                                                  \
+      const void** input,                                               \
+      size_t input_offset,                                              \
+      const void* zero,                                                 \
+      const void* multiplier,                                           \
+      void* buffer,                                                     \
+      void* output,                                                     \
+      size_t input_increment,                                           \
+      size_t output_increment,                                          \
+      const union xnn_f16_minmax_params* params);
+
+DECLARE_F16_PAVGPOOL_MINMAX_MULTIPASS_UKERNEL_FUNCTION(xnn_f16_pavgpool_minmax_ukernel_9p8x__f16c_c8)
+DECLARE_F16_PAVGPOOL_MINMAX_MULTIPASS_UKERNEL_FUNCTION(xnn_f16_pavgpool_minmax_ukernel_9p8x__avx512skx_c16)
+DECLARE_F16_PAVGPOOL_MINMAX_MULTIPASS_UKERNEL_FUNCTION(xnn_f16_pavgpool_minmax_ukernel_9p8x__neonfp16arith_c8)
+
+
+#define DECLARE_F16_PAVGPOOL_MINMAX_UNIPASS_UKERNEL_FUNCTION(fn_name) \
+  XNN_INTERNAL void fn_name(                                          \
+      size_t output_pixels,                                           \
+      size_t kernel_elements,                                         \
+      size_t channels,                                                \
+      const void** input,                                             \
+      size_t input_offset,                                            \
+      const void* zero,                                               \
+      const void* multiplier,                                         \
+      void* output,                                                   \
+      size_t input_increment,                                         \
+      size_t output_increment,                                        \
+      const union xnn_f16_minmax_params* params);
+
+DECLARE_F16_PAVGPOOL_MINMAX_UNIPASS_UKERNEL_FUNCTION(xnn_f16_pavgpool_minmax_ukernel_9x__f16c_c8)
+DECLARE_F16_PAVGPOOL_MINMAX_UNIPASS_UKERNEL_FUNCTION(xnn_f16_pavgpool_minmax_ukernel_9x__avx512skx_c16)
+DECLARE_F16_PAVGPOOL_MINMAX_UNIPASS_UKERNEL_FUNCTION(xnn_f16_pavgpool_minmax_ukernel_9x__neonfp16arith_c8)
+
+
 #define DECLARE_F32_PAVGPOOL_MINMAX_MULTIPASS_UKERNEL_FUNCTION(fn_name) \
   XNN_INTERNAL void fn_name(                                            \
       size_t output_pixels,                                             \
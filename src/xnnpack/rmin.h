@@ -0,0 +1,33 @@
+// Copyright 2022 Google LLC
+//
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree.
+
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <xnnpack/common.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+
+#define DECLARE_F32_RMIN_UKERNEL_FUNCTION(fn_name) \
+  XNN_INTERNAL void fn_name(                       \
+      size_t n,                                    \
+      const float* x,                              \
+      float* y);
+
+DECLARE_F32_RMIN_UKERNEL_FUNCTION(xnn_f32_rmin_ukernel__neon)
+DECLARE_F32_RMIN_UKERNEL_FUNCTION(xnn_f32_rmin_ukernel__scalar)
+DECLARE_F32_RMIN_UKERNEL_FUNCTION(xnn_f32_rmin_ukernel__sse)
+DECLARE_F32_RMIN_UKERNEL_FUNCTION(xnn_f32_rmin_ukernel__wasmsimd_arm)
+DECLARE_F32_RMIN_UKERNEL_FUNCTION(xnn_f32_rmin_ukernel__wasmsimd_x86)
+
+
+#ifdef __cplusplus
+}  // extern "C"
+#endif
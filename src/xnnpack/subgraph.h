@@ -10,7 +10,7 @@
 
 #include <xnnpack.h>
 
-#define XNN_MAX_INPUTS 3
+#define XNN_MAX_INPUTS 4
 #define XNN_MAX_OUTPUTS 2
 
 #define XNN_MAX_RUNTIME_INPUTS 2
@@ -99,6 +99,12 @@ struct xnn_blob {
   /// Data pointer.
   void* data;
   bool external;
+  /// Indicates that the Value shares the memory of another Value, starting at an offset, instead of owning memory.
+  bool alias;
+  /// ID of the Value which owns the memory of an aliasing Value.
+  uint32_t alias_id;
+  /// Offset, in bytes, of the aliasing Value within the memory of Value alias_id.
+  size_t alias_offset;
 };
 
 struct xnn_node;
@@ -160,9 +166,17 @@ enum xnn_node_type {
   xnn_node_type_prelu,
   xnn_node_type_sigmoid,
   xnn_node_type_softmax,
+  xnn_node_type_space_to_depth,
   xnn_node_type_static_constant_pad,
+  xnn_node_type_static_pad,
+  xnn_node_type_static_reduce_max,
+  xnn_node_type_static_reduce_mean,
+  xnn_node_type_static_reduce_min,
+  xnn_node_type_static_reduce_sum,
   xnn_node_type_static_reshape,
   xnn_node_type_static_resize_bilinear_2d,
+  xnn_node_type_static_resize_nearest_2d,
+  xnn_node_type_static_slice,
   xnn_node_type_square,
   xnn_node_type_square_root,
   xnn_node_type_squared_difference,
@@ -225,6 +239,9 @@ struct xnn_node {
     struct {
       uint32_t block_size;
     } depth_to_space;
+    struct {
+      uint32_t block_size;
+    } space_to_depth;
     struct {
       uint32_t padding_top;
       uint32_t padding_right;
@@ -248,6 +265,10 @@ struct xnn_node {
       size_t post_paddings[XNN_MAX_TENSOR_DIMS];
       uint32_t padding_value;
     } static_pad;
+    struct {
+      size_t num_reduction_axes;
+      size_t reduction_axes[XNN_MAX_TENSOR_DIMS];
+    } reduce;
     struct {
       struct xnn_shape new_shape;
     } static_reshape;
@@ -255,11 +276,54 @@ struct xnn_node {
       size_t new_height;
       size_t new_width;
     } static_resize;
+    struct {
+      size_t offsets[XNN_MAX_TENSOR_DIMS];
+      size_t sizes[XNN_MAX_TENSOR_DIMS];
+      size_t strides[XNN_MAX_TENSOR_DIMS];
+    } slice;
   } params;
   struct {
     float output_min;
     float output_max;
   } activation;
+  /// Add Node fused into the output of a Convolution 2D or Fully Connected Node.
+  struct {
+    /// Indicates that an Add Node was fused into the Node. The residual tensor is the last input of the Node.
+    bool fused;
+    /// Quantization parameters of the Node output before the residual addition.
+    int32_t zero_point;
+    float scale;
+    /// Output clamping range after the residual addition.
+    float output_min;
+    float output_max;
+  } residual;
+  /// Depthwise Convolution 2D and 1x1 Convolution 2D Nodes fused downstream of a 1x1 Convolution 2D Node. The Node
+  /// then executes the whole inverted bottleneck block depth-first, and its output is the output of the last fused Node.
+  struct {
+    /// Indicates that the inverted bottleneck block was fused into the Node.
+    bool fused;
+    /// Parameters of the fused Depthwise Convolution 2D Node.
+    uint32_t padding_top;
+    uint32_t padding_right;
+    uint32_t padding_bottom;
+    uint32_t padding_left;
+    uint32_t kernel_height;
+    uint32_t kernel_width;
+    uint32_t subsampling_height;
+    uint32_t subsampling_width;
+    uint32_t dilation_height;
+    uint32_t dilation_width;
+    uint32_t depthwise_filter_id;
+    uint32_t depthwise_bias_id;
+    float depthwise_output_min;
+    float depthwise_output_max;
+    /// Parameters of the fused projection 1x1 Convolution 2D Node.
+    size_t output_channels;
+    uint32_t project_filter_id;
+    uint32_t project_bias_id;
+    float output_min;
+    float output_max;
+  } bottleneck;
   /// Value IDs for node inputs.
   uint32_t inputs[XNN_MAX_INPUTS];
   uint32_t num_inputs;
@@ -295,6 +359,11 @@ struct xnn_operator_data {
   size_t post_paddings[XNN_MAX_TENSOR_DIMS];
   uint32_t adjustment_height;
   uint32_t adjustment_width;
+  size_t num_reduction_axes;
+  size_t reduction_axes[XNN_MAX_TENSOR_DIMS];
+  size_t offsets[XNN_MAX_TENSOR_DIMS];
+  size_t sizes[XNN_MAX_TENSOR_DIMS];
+  size_t strides[XNN_MAX_TENSOR_DIMS];
   uint32_t inputs[XNN_MAX_RUNTIME_INPUTS];
   uint32_t outputs[XNN_MAX_RUNTIME_OUTPUTS];
 };
@@ -313,6 +382,16 @@ struct xnn_subgraph {
   struct xnn_node* nodes;
 };
 
+/// Workspace is a block of memory for intermediate values of one or more runtimes which are never invoked concurrently.
+struct xnn_workspace {
+  void* data;
+  size_t size;
+  /// Head of the linked list of runtimes with intermediate values in the workspace.
+  struct xnn_runtime* first_user;
+  /// Number of references held by the user and by runtimes.
+  size_t ref_count;
+};
+
 /// Runtime is a combination of an execution plan for subgraph Nodes and a memory manager for subgraph Values.
 struct xnn_runtime {
   uint32_t num_external_values;
@@ -325,9 +404,22 @@ struct xnn_runtime {
   struct xnn_blob* blobs;
   size_t num_blobs;
 
-  void* workspace;
+  // Workspace for intermediate values, possibly shared with other runtimes.
+  struct xnn_workspace* workspace;
+  // Size of the workspace required for intermediate values of this runtime.
+  size_t workspace_size;
+  // Next runtime in the list of runtimes using the same workspace.
+  struct xnn_runtime* next_workspace_user;
 
   pthreadpool_t threadpool;
+
+  // Synchronization state for invoking the whole Runtime in a single thread pool dispatch. Non-NULL only if the
+  // Runtime was created with XNN_FLAG_PERSISTENT_PARALLEL_REGION and a multi-threaded thread pool.
+  struct xnn_parallel_region* parallel_region;
+
+  // Peak memory usage of the Runtime by category and in total, sampled when the Runtime is created and setup.
+  size_t peak_memory_bytes[XNN_NUM_MEMORY_CATEGORIES];
+  size_t peak_total_memory_bytes;
 };
 
 struct xnn_value* xnn_subgraph_new_internal_value(xnn_subgraph_t subgraph);
@@ -357,6 +449,21 @@ void xnn_value_clear(struct xnn_value* value);
 
 void xnn_value_copy(struct xnn_value* dst_value, const struct xnn_value* src_value);
 
+// Fuse the Add Node recorded in node->residual into the operator created for a Convolution 2D or Fully Connected Node.
+enum xnn_status xnn_subgraph_fuse_residual_add(
+  const struct xnn_node* node,
+  const struct xnn_value* values,
+  uint32_t residual_id,
+  uint32_t output_id,
+  xnn_operator_t op);
+
+// Check if the output of a Slice Node is a contiguous block of memory within its input, and if so, return the offset of
+// the block in input elements.
+bool xnn_subgraph_get_contiguous_slice_offset(
+  const struct xnn_node* node,
+  const struct xnn_value* values,
+  size_t* offset_out);
+
 void xnn_init_convert_node(
   struct xnn_node* node,
   enum xnn_compute_type compute_type,
@@ -0,0 +1,158 @@
+// Copyright 2022 Google LLC
+//
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree.
+
+#pragma once
+
+#include <assert.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include <xnnpack/common.h>
+#include <xnnpack/math.h>
+#include <xnnpack/params.h>
+
+
+// Minimum amount of work, in the units of xnn_estimate_work, which amortizes waking up a thread of the thread pool and
+// synchronizing with it at the end of the operator.
+#define XNN_MIN_WORK_PER_THREAD 131072
+
+// Minimum amount of work in a single task, which amortizes claiming the task and the function call overhead.
+#define XNN_MIN_WORK_PER_TILE 16384
+
+// Number of tasks per thread which balances the load when threads run at different speeds or start late.
+#define XNN_TARGET_TILES_PER_THREAD 5
+
+// Estimate the work of an operator, or a part of it, which performs ops multiply-adds (or comparable elementwise
+// operations) and streams bytes bytes of memory. The unit is one scalar multiply-add: a core completes several SIMD
+// multiply-adds in the time it streams one byte from the L2 cache or beyond, hence the weight on memory traffic.
+// Callers compute ops and bytes in floating-point, because their products of dimensions overflow size_t on 32-bit
+// platforms, and the estimate saturates at SIZE_MAX.
+static inline size_t xnn_estimate_work(double ops, double bytes)
+{
+  const double work = ops + bytes * 2.0;
+  return work < (double) SIZE_MAX ? (size_t) work : SIZE_MAX;
+}
+
+// Number of threads worth using for an operator with the given estimated work. Operators which can't keep even two
+// threads busy are run on the calling thread, without any synchronization.
+static inline size_t xnn_compute_num_useful_threads(size_t work, size_t num_threads)
+{
+  return max(1, min(num_threads, work / XNN_MIN_WORK_PER_THREAD));
+}
+
+// Maximum number of tasks to split an operator with the given estimated work into: enough to balance the load across
+// the useful threads, but not so many that tasks get too small to amortize their overhead. Returns 1 if the operator
+// should run on the calling thread.
+static inline size_t xnn_compute_max_tiles(size_t work, size_t num_threads)
+{
+  const size_t num_useful_threads = xnn_compute_num_useful_threads(work, num_threads);
+  if (num_useful_threads == 1) {
+    return 1;
+  }
+  return min(num_useful_threads * XNN_TARGET_TILES_PER_THREAD, max(num_useful_threads, work / XNN_MIN_WORK_PER_TILE));
+}
+
+// Choose the size of a tile along a dimension of range elements, as a multiple of granularity elements, such that the
+// dimension is split into about max_tiles tiles.
+static inline size_t xnn_compute_tile_size(size_t range, size_t granularity, size_t max_tiles)
+{
+  assert(granularity != 0);
+  assert(max_tiles != 0);
+  return min(range, round_up(divide_round_up(range, max_tiles), granularity));
+}
+
+// Choose the number of columns in tiles of a GEMM output with n columns, when other_tiles tasks are already available
+// from the rows and other parallelized dimensions. Columns are split only if the other dimensions can't provide
+// max_tiles tasks: splitting columns makes every task reload its rows of the input.
+static inline size_t xnn_compute_gemm_nc(size_t other_tiles, size_t n, size_t nr, size_t max_tiles)
+{
+  if (other_tiles >= max_tiles) {
+    return n;
+  }
+  return xnn_compute_tile_size(n, nr, divide_round_up(max_tiles, other_tiles));
+}
+
+// Partitioning of an MxN GEMM output into tasks of mc rows and nc columns.
+struct xnn_gemm_tiling {
+  size_t mc;
+  size_t nc;
+  // If true, every task multiplies mc / mr row blocks by the same nc-column panel of packed weights, and blocks of
+  // columns are the outer parallelization dimension. This is the case when packed weights don't fit in the L2 cache,
+  // and keeping the panel cache-resident pays off, and when the GEMM is too small to be split at all, and mc and nc
+  // cover the whole output. Otherwise mc equals mr and rows are the outer parallelization dimension.
+  bool blocked;
+  // Number of threads worth using, see xnn_compute_num_useful_threads.
+  size_t num_threads;
+};
+
+// Choose tile sizes for a GEMM with m rows, n columns, and k multiply-adds per output element, where every column of
+// packed weights (including its bias and extra per-channel parameters) takes w_stride bytes.
+static inline struct xnn_gemm_tiling xnn_compute_gemm_tiling(
+  size_t m,
+  size_t n,
+  size_t k,
+  size_t mr,
+  size_t nr,
+  size_t w_stride,
+  size_t num_threads)
+{
+  // Rows of the input take about as many bytes as columns of packed weights.
+  const size_t work = xnn_estimate_work((double) m * n * k, (double) (m + n) * w_stride);
+  const size_t max_tiles = xnn_compute_max_tiles(work, num_threads);
+  const size_t num_useful_threads = xnn_compute_num_useful_threads(work, num_threads);
+  if (max_tiles == 1) {
+    return (struct xnn_gemm_tiling) { .mc = m, .nc = n, .blocked = true, .num_threads = 1 };
+  }
+
+  // Keep the panel of packed weights within half of the L2 cache, leaving the rest for the input and output rows.
+  const size_t l2_budget = xnn_params.cache.l2_size / 2;
+  if (m <= mr || n * w_stride <= l2_budget) {
+    const size_t nc = xnn_compute_gemm_nc(divide_round_up(m, mr), n, nr, max_tiles);
+    return (struct xnn_gemm_tiling) { .mc = mr, .nc = nc, .blocked = false, .num_threads = num_useful_threads };
+  }
+
+  const size_t nc = min(n, max(nr, l2_budget / w_stride / nr * nr));
+
+  size_t mc = m;
+  const size_t num_column_blocks = divide_round_up(n, nc);
+  if (num_column_blocks < max_tiles) {
+    mc = xnn_compute_tile_size(m, mr, divide_round_up(max_tiles, num_column_blocks));
+  }
+  return (struct xnn_gemm_tiling) { .mc = mc, .nc = nc, .blocked = true, .num_threads = num_useful_threads };
+}
+
+// Choose the number of input channels in every segment of GEMM weights packed with split reduction dimension, such that
+// an nr-column panel of packed weights of a segment fits in half of the L1 data cache. Returns 0 if the reduction
+// dimension is too short to be worth splitting.
+static inline size_t xnn_compute_gemm_k_segment_size(
+  size_t k,
+  size_t nr,
+  uint32_t log2_element_size)
+{
+  const size_t min_segments = 4;
+  const size_t segment_size = max(16, round_down_po2((xnn_params.cache.l1d_size / 2) / (nr << log2_element_size), 16));
+  if (k < min_segments * segment_size) {
+    return 0;
+  }
+  return segment_size;
+}
+
+// Choose the number of partitions of the segments of the reduction dimension which are processed in parallel. Splitting
+// the reduction dimension pays off only when there are fewer tiles of the MxN output than threads.
+static inline size_t xnn_compute_gemm_k_partitions(
+  size_t m,
+  size_t n,
+  size_t mr,
+  size_t nr,
+  size_t num_segments,
+  size_t num_threads)
+{
+  const size_t num_tiles = divide_round_up(m, mr) * divide_round_up(n, nr);
+  if (num_threads <= 1 || num_tiles >= num_threads) {
+    return 1;
+  }
+  return min(num_segments, divide_round_up(num_threads, num_tiles));
+}
@@ -0,0 +1,316 @@
+// Copyright 2022 Google LLC
+//
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree.
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <fstream>
+#include <functional>
+#include <limits>
+#include <memory>
+#include <random>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <xnnpack.h>
+#include <xnnpack/autotune.h>
+#include <xnnpack/operator.h>
+#include <xnnpack/params.h>
+
+
+namespace {
+
+using OperatorPtr = std::unique_ptr<xnn_operator, decltype(&xnn_delete_operator)>;
+
+// Every test uses shapes of its own, because decisions are cached for the lifetime of the process.
+struct Shape {
+  xnn_ukernel_type ukernel_type;
+  size_t group_output_channels;
+  size_t group_input_channels;
+  size_t kernel_size;
+
+  std::string ToString() const {
+    std::ostringstream entry;
+    entry << (ukernel_type == xnn_ukernel_type_igemm ? "igemm" : "gemm") << " "
+      << group_output_channels << " " << group_input_channels << " " << kernel_size;
+    return entry.str();
+  }
+};
+
+gemm_parameters Autotune(const Shape& shape) {
+  gemm_parameters parameters;
+  EXPECT_EQ(xnn_status_success, xnn_autotune_f32_gemm(
+    shape.ukernel_type, shape.group_output_channels, shape.group_input_channels, shape.kernel_size, &parameters));
+  return parameters;
+}
+
+void ExpectSameMicrokernels(const gemm_parameters& expected, const gemm_parameters& actual) {
+  EXPECT_EQ(expected.minmax.gemm.function[XNN_UARCH_DEFAULT], actual.minmax.gemm.function[XNN_UARCH_DEFAULT]);
+  EXPECT_EQ(expected.minmax.igemm.function[XNN_UARCH_DEFAULT], actual.minmax.igemm.function[XNN_UARCH_DEFAULT]);
+  EXPECT_EQ(expected.minmax.gemm1.function[XNN_UARCH_DEFAULT], actual.minmax.gemm1.function[XNN_UARCH_DEFAULT]);
+  EXPECT_EQ(expected.minmax.igemm1.function[XNN_UARCH_DEFAULT], actual.minmax.igemm1.function[XNN_UARCH_DEFAULT]);
+  EXPECT_EQ(expected.minmax.gemv.function[XNN_UARCH_DEFAULT], actual.minmax.gemv.function[XNN_UARCH_DEFAULT]);
+  EXPECT_EQ(expected.mr, actual.mr);
+  EXPECT_EQ(expected.nr, actual.nr);
+  EXPECT_EQ(expected.log2_kr, actual.log2_kr);
+  EXPECT_EQ(expected.log2_sr, actual.log2_sr);
+}
+
+std::string CachePath(const std::string& name) {
+  return ::testing::TempDir() + "/xnnpack-autotune-" + name + ".txt";
+}
+
+void WriteCache(const std::string& path, const std::string& content) {
+  std::ofstream file(path, std::ios::trunc);
+  file << content;
+}
+
+std::vector<std::string> SaveCache(const std::string& path) {
+  EXPECT_EQ(xnn_status_success, xnn_save_autotuning_cache(path.c_str()));
+  std::vector<std::string> lines;
+  std::ifstream file(path);
+  for (std::string line; std::getline(file, line);) {
+    lines.push_back(line);
+  }
+  std::remove(path.c_str());
+  return lines;
+}
+
+// Returns the name of the micro-kernel selected for the shape in the saved cache, or an empty string if the cache has
+// no entry for the shape.
+std::string FindCandidate(const std::vector<std::string>& lines, const Shape& shape) {
+  const std::string prefix = shape.ToString() + " ";
+  for (const std::string& line : lines) {
+    if (line.compare(0, prefix.size(), prefix) == 0) {
+      return line.substr(prefix.size());
+    }
+  }
+  return std::string();
+}
+
+enum xnn_status LoadCache(const std::string& path, const std::string& content) {
+  WriteCache(path, content);
+  const enum xnn_status status = xnn_load_autotuning_cache(path.c_str());
+  std::remove(path.c_str());
+  return status;
+}
+
+// Header line of the cache files saved on this processor.
+std::string CacheHeader() {
+  const std::vector<std::string> lines = SaveCache(CachePath("header"));
+  EXPECT_FALSE(lines.empty());
+  return lines.empty() ? std::string() : lines[0] + "\n";
+}
+
+std::vector<float> RandomVector(size_t size) {
+  std::random_device random_device;
+  auto rng = std::mt19937(random_device());
+  auto f32rng = std::bind(std::uniform_real_distribution<float>(-1.0f, 1.0f), std::ref(rng));
+  std::vector<float> data(size);
+  std::generate(data.begin(), data.end(), std::ref(f32rng));
+  return data;
+}
+
+void ExpectNear(const std::vector<float>& expected, const std::vector<float>& actual, size_t reduction_size) {
+  ASSERT_EQ(expected.size(), actual.size());
+  const float tolerance = 1.0e-6f * float(reduction_size);
+  for (size_t i = 0; i < expected.size(); i++) {
+    ASSERT_NEAR(expected[i], actual[i], tolerance * std::max(1.0f, std::abs(expected[i]))) << "at " << i;
+  }
+}
+
+}  // namespace
+
+
+TEST(AUTOTUNE, cached_decision) {
+  ASSERT_EQ(xnn_status_success, xnn_initialize(nullptr /* allocator */));
+  for (const Shape& shape : {
+    Shape{xnn_ukernel_type_gemm, 40, 24, 1},
+    Shape{xnn_ukernel_type_igemm, 40, 24, 9},
+  }) {
+    const gemm_parameters parameters = Autotune(shape);
+    ASSERT_NE(nullptr, parameters.minmax.gemm.function[XNN_UARCH_DEFAULT]);
+    ASSERT_NE(nullptr, parameters.minmax.igemm.function[XNN_UARCH_DEFAULT]);
+    ASSERT_GE(parameters.mr, 1);
+    ASSERT_EQ(xnn_params.f32.gemm.nr, parameters.nr);
+    ASSERT_EQ(xnn_params.f32.gemm.log2_kr, parameters.log2_kr);
+    ASSERT_EQ(xnn_params.f32.gemm.init.f32, parameters.init.f32);
+
+    // The second call for the same shape reuses the decision.
+    ExpectSameMicrokernels(parameters, Autotune(shape));
+  }
+
+  // GEMM decisions don't depend on the kernel size.
+  ExpectSameMicrokernels(
+    Autotune(Shape{xnn_ukernel_type_gemm, 40, 24, 1}), Autotune(Shape{xnn_ukernel_type_gemm, 40, 24, 4}));
+}
+
+TEST(AUTOTUNE, fully_connected) {
+  ASSERT_EQ(xnn_status_success, xnn_initialize(nullptr /* allocator */));
+  const size_t input_channels = 96;
+  const size_t output_channels = 72;
+  const std::vector<float> kernel = RandomVector(output_channels * input_channels);
+  const std::vector<float> bias = RandomVector(output_channels);
+
+  xnn_operator_t default_op = nullptr;
+  ASSERT_EQ(xnn_status_success, xnn_create_fully_connected_nc_f32(
+    input_channels, output_channels, input_channels, output_channels, kernel.data(), bias.data(),
+    -std::numeric_limits<float>::max(), std::numeric_limits<float>::max(), 0 /* flags */, &default_op));
+  OperatorPtr auto_default_op(default_op, xnn_delete_operator);
+  xnn_operator_t autotuned_op = nullptr;
+  ASSERT_EQ(xnn_status_success, xnn_create_fully_connected_nc_f32(
+    input_channels, output_channels, input_channels, output_channels, kernel.data(), bias.data(),
+    -std::numeric_limits<float>::max(), std::numeric_limits<float>::max(), XNN_FLAG_AUTOTUNE,
+    &autotuned_op));
+  OperatorPtr auto_autotuned_op(autotuned_op, xnn_delete_operator);
+
+  // The operator uses the micro-kernel selected for its shape. Output bounds are finite, so that the operator doesn't
+  // switch to the linear variant of the default micro-kernel.
+  const gemm_parameters parameters = Autotune(Shape{xnn_ukernel_type_gemm, output_channels, input_channels, 1});
+  ASSERT_EQ(parameters.mr, autotuned_op->ukernel.gemm.mr);
+  ASSERT_EQ(parameters.nr, autotuned_op->ukernel.gemm.nr);
+  ASSERT_EQ(
+    parameters.minmax.gemm.function[XNN_UARCH_DEFAULT],
+    autotuned_op->ukernel.gemm.general_case.function[XNN_UARCH_DEFAULT]);
+
+  // Batch sizes cover the GEMV path, the MR=1 path, and partial and full tiles of all candidates.
+  for (size_t batch_size : {1, 3, 17, 48}) {
+    const std::vector<float> input = RandomVector(batch_size * input_channels + XNN_EXTRA_BYTES / sizeof(float));
+    std::vector<float> expected(batch_size * output_channels, std::nanf(""));
+    std::vector<float> actual(batch_size * output_channels, std::nanf(""));
+    ASSERT_EQ(xnn_status_success, xnn_setup_fully_connected_nc_f32(
+      default_op, batch_size, input.data(), expected.data(), nullptr /* thread pool */));
+    ASSERT_EQ(xnn_status_success, xnn_run_operator(default_op, nullptr /* thread pool */));
+    ASSERT_EQ(xnn_status_success, xnn_setup_fully_connected_nc_f32(
+      autotuned_op, batch_size, input.data(), actual.data(), nullptr /* thread pool */));
+    ASSERT_EQ(xnn_status_success, xnn_run_operator(autotuned_op, nullptr /* thread pool */));
+    ExpectNear(expected, actual, input_channels);
+  }
+}
+
+TEST(AUTOTUNE, convolution) {
+  ASSERT_EQ(xnn_status_success, xnn_initialize(nullptr /* allocator */));
+  const size_t batch_size = 2;
+  const size_t height = 7;
+  const size_t width = 9;
+  const size_t input_channels = 12;
+  const size_t output_channels = 40;
+  const std::vector<float> kernel = RandomVector(output_channels * 3 * 3 * input_channels);
+  const std::vector<float> bias = RandomVector(output_channels);
+  const std::vector<float> input =
+    RandomVector(batch_size * height * width * input_channels + XNN_EXTRA_BYTES / sizeof(float));
+
+  std::vector<float> expected(batch_size * height * width * output_channels, std::nanf(""));
+  std::vector<float> actual(batch_size * height * width * output_channels, std::nanf(""));
+  for (uint32_t flags : {0u, static_cast<uint32_t>(XNN_FLAG_AUTOTUNE)}) {
+    xnn_operator_t convolution_op = nullptr;
+    ASSERT_EQ(xnn_status_success, xnn_create_convolution2d_nhwc_f32(
+      1 /* top padding */, 1 /* right padding */, 1 /* bottom padding */, 1 /* left padding */,
+      3 /* kernel height */, 3 /* kernel width */,
+      1 /* subsampling height */, 1 /* subsampling width */,
+      1 /* dilation height */, 1 /* dilation width */,
+      1 /* groups */, input_channels, output_channels, input_channels, output_channels,
+      kernel.data(), bias.data(),
+      -std::numeric_limits<float>::max(), std::numeric_limits<float>::max(), flags, &convolution_op));
+    OperatorPtr auto_convolution_op(convolution_op, xnn_delete_operator);
+
+    if (flags & XNN_FLAG_AUTOTUNE) {
+      const gemm_parameters parameters = Autotune(Shape{xnn_ukernel_type_igemm, output_channels, input_channels, 9});
+      ASSERT_EQ(xnn_ukernel_type_igemm, convolution_op->ukernel.type);
+      ASSERT_EQ(parameters.mr, convolution_op->ukernel.igemm.mr);
+      ASSERT_EQ(parameters.nr, convolution_op->ukernel.igemm.nr);
+      ASSERT_EQ(
+        parameters.minmax.igemm.function[XNN_UARCH_DEFAULT],
+        convolution_op->ukernel.igemm.general_case.function[XNN_UARCH_DEFAULT]);
+    }
+
+    ASSERT_EQ(xnn_status_success, xnn_setup_convolution2d_nhwc_f32(
+      convolution_op, batch_size, height, width, input.data(), flags == 0 ? expected.data() : actual.data(),
+      nullptr /* thread pool */));
+    ASSERT_EQ(xnn_status_success, xnn_run_operator(convolution_op, nullptr /* thread pool */));
+  }
+  ExpectNear(expected, actual, 3 * 3 * input_channels);
+}
+
+TEST(AUTOTUNE, save_and_load) {
+  ASSERT_EQ(xnn_status_success, xnn_initialize(nullptr /* allocator */));
+  const Shape gemm_shape{xnn_ukernel_type_gemm, 200, 40, 1};
+  const Shape igemm_shape{xnn_ukernel_type_igemm, 24, 8, 9};
+  const gemm_parameters gemm_decision = Autotune(gemm_shape);
+  const gemm_parameters igemm_decision = Autotune(igemm_shape);
+
+  const std::vector<std::string> saved = SaveCache(CachePath("saved"));
+  ASSERT_FALSE(saved.empty());
+  const std::string header = saved[0] + "\n";
+
+  // Loading a saved cache back is a no-op.
+  std::string content;
+  for (const std::string& line : saved) {
+    content += line + "\n";
+  }
+  ASSERT_EQ(xnn_status_success, LoadCache(CachePath("reload"), content));
+  ASSERT_EQ(saved, SaveCache(CachePath("reloaded")));
+
+  const std::string gemm_candidate = FindCandidate(saved, gemm_shape);
+  const std::string igemm_candidate = FindCandidate(saved, igemm_shape);
+  if (gemm_candidate.empty() || igemm_candidate.empty()) {
+    GTEST_SKIP() << "no alternative F32 GEMM micro-kernels on this processor";
+  }
+
+  // Decisions loaded for new shapes are used instead of benchmarking.
+  const Shape loaded_gemm_shape{xnn_ukernel_type_gemm, 328, 56, 1};
+  const Shape loaded_igemm_shape{xnn_ukernel_type_igemm, 40, 16, 4};
+  ASSERT_EQ(xnn_status_success, LoadCache(CachePath("load"),
+    header +
+    loaded_gemm_shape.ToString() + " " + gemm_candidate + "\n" +
+    loaded_igemm_shape.ToString() + " " + igemm_candidate + "\n"));
+  ExpectSameMicrokernels(gemm_decision, Autotune(loaded_gemm_shape));
+  ExpectSameMicrokernels(igemm_decision, Autotune(loaded_igemm_shape));
+
+  const std::vector<std::string> resaved = SaveCache(CachePath("resaved"));
+  ASSERT_EQ(gemm_candidate, FindCandidate(resaved, loaded_gemm_shape));
+  ASSERT_EQ(igemm_candidate, FindCandidate(resaved, loaded_igemm_shape));
+}
+
+TEST(AUTOTUNE, load_rejects_malformed_cache) {
+  ASSERT_EQ(xnn_status_success, xnn_initialize(nullptr /* allocator */));
+  const std::string header = CacheHeader();
+  const std::string path = CachePath("malformed");
+
+  std::remove(path.c_str());
+  ASSERT_EQ(xnn_status_invalid_parameter, xnn_load_autotuning_cache(path.c_str()));
+  ASSERT_EQ(xnn_status_invalid_parameter, LoadCache(path, ""));
+  ASSERT_EQ(xnn_status_invalid_parameter, LoadCache(path, "not an autotuning cache\n"));
+  ASSERT_EQ(xnn_status_invalid_parameter, LoadCache(path, "xnnpack-autotune\n"));
+  ASSERT_EQ(xnn_status_invalid_parameter,
+    LoadCache(path, "xnnpack-autotune 2" + header.substr(header.find(' ', header.find(' ') + 1))));
+  ASSERT_EQ(xnn_status_invalid_parameter, LoadCache(path, header + "conv 8 8 1 kernel\n"));
+  ASSERT_EQ(xnn_status_invalid_parameter, LoadCache(path, header + "gemm 0 8 1 kernel\n"));
+  ASSERT_EQ(xnn_status_invalid_parameter, LoadCache(path, header + "igemm 8 8 0 kernel\n"));
+  ASSERT_EQ(xnn_status_invalid_parameter, LoadCache(path, header + "gemm 8 8\n"));
+}
+
+TEST(AUTOTUNE, load_ignores_foreign_cache) {
+  ASSERT_EQ(xnn_status_success, xnn_initialize(nullptr /* allocator */));
+  const Shape tuned_shape{xnn_ukernel_type_gemm, 144, 32, 1};
+  Autotune(tuned_shape);
+  const std::string candidate = FindCandidate(SaveCache(CachePath("candidates")), tuned_shape);
+  const Shape shape{xnn_ukernel_type_gemm, 8, 136, 1};
+
+  // Decisions saved on a processor with another set of candidate micro-kernels.
+  ASSERT_EQ(xnn_status_success, LoadCache(CachePath("foreign"),
+    "xnnpack-autotune 1 foreign\n" + shape.ToString() + " " + (candidate.empty() ? "kernel" : candidate) + "\n"));
+  ASSERT_EQ("", FindCandidate(SaveCache(CachePath("foreign-saved")), shape));
+
+  // Decisions naming micro-kernels which are not candidates on this processor.
+  ASSERT_EQ(xnn_status_success, LoadCache(CachePath("unknown"),
+    CacheHeader() + shape.ToString() + " no_such_kernel\n"));
+  ASSERT_EQ("", FindCandidate(SaveCache(CachePath("unknown-saved")), shape));
+}
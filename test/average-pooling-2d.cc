@@ -0,0 +1,120 @@
+// Copyright 2022 Google LLC
+//
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree.
+
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+
+#include <gtest/gtest.h>
+
+#include <xnnpack.h>
+#include <xnnpack/subgraph.h>
+
+
+namespace {
+
+using SubgraphPtr = std::unique_ptr<xnn_subgraph, decltype(&xnn_delete_subgraph)>;
+
+constexpr size_t kBatchSize = 2;
+constexpr size_t kInputHeight = 9;
+constexpr size_t kInputWidth = 8;
+constexpr size_t kChannels = 5;
+
+// Defines 3x3 stride-1 Average Pooling Nodes between input and output Values of the same shape.
+class AveragePooling2DDefineTest : public ::testing::Test {
+ protected:
+  void SetUp() override {
+    ASSERT_EQ(xnn_status_success, xnn_initialize(nullptr /* allocator */));
+
+    xnn_subgraph_t subgraph = nullptr;
+    ASSERT_EQ(xnn_status_success, xnn_create_subgraph(0 /* external value IDs */, 0 /* flags */, &subgraph));
+    subgraph_.reset(subgraph);
+  }
+
+  void DefineValues(xnn_datatype datatype, uint32_t* input_id, uint32_t* output_id) {
+    const std::array<size_t, 4> dims = {{kBatchSize, kInputHeight, kInputWidth, kChannels}};
+    if (datatype == xnn_datatype_fp32) {
+      ASSERT_EQ(xnn_status_success, xnn_define_tensor_value(
+        subgraph_.get(), datatype, dims.size(), dims.data(), nullptr,
+        XNN_INVALID_VALUE_ID, 0 /* flags */, input_id));
+      ASSERT_EQ(xnn_status_success, xnn_define_tensor_value(
+        subgraph_.get(), datatype, dims.size(), dims.data(), nullptr,
+        XNN_INVALID_VALUE_ID, 0 /* flags */, output_id));
+    } else {
+      ASSERT_EQ(xnn_status_success, xnn_define_quantized_tensor_value(
+        subgraph_.get(), datatype, 1 /* zero point */, 0.5f /* scale */, dims.size(), dims.data(), nullptr,
+        XNN_INVALID_VALUE_ID, 0 /* flags */, input_id));
+      ASSERT_EQ(xnn_status_success, xnn_define_quantized_tensor_value(
+        subgraph_.get(), datatype, 1 /* zero point */, 0.5f /* scale */, dims.size(), dims.data(), nullptr,
+        XNN_INVALID_VALUE_ID, 0 /* flags */, output_id));
+    }
+  }
+
+  xnn_status DefinePooling(uint32_t padding, uint32_t input_id, uint32_t output_id, uint32_t flags) {
+    return xnn_define_average_pooling_2d(
+      subgraph_.get(), padding, padding, padding, padding,
+      3 /* pooling height */, 3 /* pooling width */, 1 /* stride height */, 1 /* stride width */,
+      -INFINITY, INFINITY, input_id, output_id, flags);
+  }
+
+  SubgraphPtr subgraph_{nullptr, xnn_delete_subgraph};
+};
+
+}  // namespace
+
+TEST_F(AveragePooling2DDefineTest, fp32_with_padding) {
+  uint32_t input_id = XNN_INVALID_VALUE_ID;
+  uint32_t output_id = XNN_INVALID_VALUE_ID;
+  DefineValues(xnn_datatype_fp32, &input_id, &output_id);
+
+  ASSERT_EQ(xnn_status_success, DefinePooling(1, input_id, output_id, 0 /* flags */));
+  ASSERT_EQ(xnn_status_success, DefinePooling(0, input_id, output_id, XNN_FLAG_TENSORFLOW_SAME_PADDING));
+  ASSERT_EQ(2, subgraph_->num_nodes);
+  ASSERT_EQ(xnn_compute_type_fp32, subgraph_->nodes[0].compute_type);
+}
+
+TEST_F(AveragePooling2DDefineTest, qs8_without_padding) {
+  uint32_t input_id = XNN_INVALID_VALUE_ID;
+  uint32_t output_id = XNN_INVALID_VALUE_ID;
+  DefineValues(xnn_datatype_qint8, &input_id, &output_id);
+
+  ASSERT_EQ(xnn_status_success, DefinePooling(0, input_id, output_id, 0 /* flags */));
+  ASSERT_EQ(1, subgraph_->num_nodes);
+  ASSERT_EQ(xnn_compute_type_qs8, subgraph_->nodes[0].compute_type);
+}
+
+TEST_F(AveragePooling2DDefineTest, qs8_rejects_padding) {
+  uint32_t input_id = XNN_INVALID_VALUE_ID;
+  uint32_t output_id = XNN_INVALID_VALUE_ID;
+  DefineValues(xnn_datatype_qint8, &input_id, &output_id);
+
+  ASSERT_EQ(xnn_status_unsupported_parameter, DefinePooling(1, input_id, output_id, 0 /* flags */));
+  ASSERT_EQ(xnn_status_unsupported_parameter,
+    DefinePooling(0, input_id, output_id, XNN_FLAG_TENSORFLOW_SAME_PADDING));
+  ASSERT_EQ(0, subgraph_->num_nodes);
+}
+
+TEST_F(AveragePooling2DDefineTest, qu8_without_padding) {
+  uint32_t input_id = XNN_INVALID_VALUE_ID;
+  uint32_t output_id = XNN_INVALID_VALUE_ID;
+  DefineValues(xnn_datatype_quint8, &input_id, &output_id);
+
+  ASSERT_EQ(xnn_status_success, DefinePooling(0, input_id, output_id, 0 /* flags */));
+  ASSERT_EQ(1, subgraph_->num_nodes);
+  ASSERT_EQ(xnn_compute_type_qu8, subgraph_->nodes[0].compute_type);
+}
+
+TEST_F(AveragePooling2DDefineTest, qu8_rejects_padding) {
+  uint32_t input_id = XNN_INVALID_VALUE_ID;
+  uint32_t output_id = XNN_INVALID_VALUE_ID;
+  DefineValues(xnn_datatype_quint8, &input_id, &output_id);
+
+  ASSERT_EQ(xnn_status_unsupported_parameter, DefinePooling(1, input_id, output_id, 0 /* flags */));
+  ASSERT_EQ(xnn_status_unsupported_parameter,
+    DefinePooling(0, input_id, output_id, XNN_FLAG_TENSORFLOW_SAME_PADDING));
+  ASSERT_EQ(0, subgraph_->num_nodes);
+}
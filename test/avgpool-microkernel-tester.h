@@ -20,6 +20,8 @@
 #include <random>
 #include <vector>
 
+#include <fp16.h>
+
 #include <xnnpack.h>
 #include <xnnpack/AlignedAllocator.h>
 #include <xnnpack/params-init.h>
@@ -386,6 +388,384 @@ class AvgPoolMicrokernelTester {
     }
   }
 
+  void Test(
+      xnn_qs8_avgpool_minmax_unipass_ukernel_function avgpool_minmax,
+      xnn_init_qs8_avgpool_minmax_params_fn init_params,
+      xnn_qs8_requantize_fn requantize) const
+  {
+    std::random_device random_device;
+    auto rng = std::mt19937(random_device());
+    auto i8rng = std::bind(
+      std::uniform_int_distribution<int32_t>(std::numeric_limits<int8_t>::min(), std::numeric_limits<int8_t>::max()), rng);
+
+    std::vector<const int8_t*> indirect_input((output_pixels() - 1) * step() + packed_pooling_elements());
+    std::vector<int8_t> input(XNN_EXTRA_BYTES / sizeof(int8_t) +
+      input_offset() + indirect_input.size() * channels());
+    std::vector<int8_t> zero(channels() + XNN_EXTRA_BYTES / sizeof(int8_t));
+    std::vector<int8_t> output((output_pixels() - 1) * output_stride() + channels());
+    std::vector<int8_t> output_ref(output_pixels() * channels());
+    std::vector<float> output_real(output_pixels() * channels());
+    std::vector<int32_t> accumulator(output_pixels() * channels());
+    for (size_t iteration = 0; iteration < iterations(); iteration++) {
+      do {
+        std::generate(input.begin(), input.end(), std::ref(i8rng));
+      } while (input.size() > 1 && *std::max_element(input.cbegin(), input.cend()) == *std::min_element(input.cbegin(), input.cend()));
+      std::fill(input.begin(), input.begin() + input_offset(), INT8_C(0xA5));
+      std::fill(input.end() - XNN_EXTRA_BYTES / sizeof(int8_t), input.end(), INT8_C(0xA5));
+      std::fill(output.begin(), output.end(), INT8_C(0xA5));
+
+      for (size_t i = 0; i < (output_pixels() - 1) * step() + pooling_elements(); i++) {
+        indirect_input[i] = input.data() + i * channels();
+      }
+      std::shuffle(indirect_input.begin(),
+        indirect_input.begin() + (output_pixels() - 1) * step() + pooling_elements(), rng);
+      if (zero_index() != SIZE_MAX) {
+        indirect_input[zero_index()] = zero.data();
+      }
+
+      // Prepare parameters.
+      union xnn_qs8_avgpool_minmax_params params;
+      init_params(
+        &params,
+        -int32_t(input_zero_point() - 0x80) * int32_t(pooling_elements()),
+        input_scale() / (output_scale() * float(pooling_elements())),
+        int8_t(output_zero_point() - 0x80), int8_t(qmin() - 0x80), int8_t(qmax() - 0x80));
+
+      // Compute reference results.
+      for (size_t x = 0; x < output_pixels(); x++) {
+        for (size_t c = 0; c < channels(); c++) {
+          int32_t acc = 0;
+          for (size_t p = 0; p < pooling_elements(); p++) {
+            const int8_t* row = indirect_input[x * step() + p];
+            if (row != zero.data()) {
+              acc += int32_t(row[c + input_offset()]);
+            }
+            acc -= int32_t(input_zero_point() - 0x80);
+          }
+          accumulator[x * channels() + c] = acc;
+          output_ref[x * channels() + c] = requantize(
+            acc, input_scale() / (output_scale() * float(pooling_elements())),
+            int8_t(output_zero_point() - 0x80), int8_t(qmin() - 0x80), int8_t(qmax() - 0x80));
+          const float scaled_acc =
+            float(acc) * (input_scale() / (output_scale() * float(pooling_elements()))) + float(output_zero_point() - 0x80);
+          output_real[x * channels() + c] =
+            std::min(std::max(scaled_acc, float(qmin() - 0x80)), float(qmax() - 0x80));
+        }
+      }
+
+      // Call optimized micro-kernel.
+      avgpool_minmax(output_pixels(), pooling_elements(), channels(),
+        indirect_input.data(), input_offset() * sizeof(int8_t), zero.data(),
+        output.data(),
+        step() * sizeof(void*),
+        (output_stride() - channels()) * sizeof(int8_t),
+        &params);
+
+      // Verify results.
+      for (size_t x = 0; x < output_pixels(); x++) {
+        for (size_t c = 0; c < channels(); c++) {
+          ASSERT_GE(int32_t(output[x * output_stride() + c]), int32_t(qmin() - 0x80))
+            << "at pixel " << x << " / " << output_pixels() << ", channel " << c << " / " << channels()
+            << ", pooling elements = " << pooling_elements() << ", step = " << step()
+            << ", input offset = " << input_offset();
+          ASSERT_LE(int32_t(output[x * output_stride() + c]), int32_t(qmax() - 0x80))
+            << "at pixel " << x << " / " << output_pixels() << ", channel " << c << " / " << channels()
+            << ", pooling elements = " << pooling_elements() << ", step = " << step()
+            << ", input offset = " << input_offset();
+          ASSERT_NEAR(float(int32_t(output[x * output_stride() + c])), output_real[x * channels() + c], 0.5f)
+            << "at pixel " << x << " / " << output_pixels() << ", channel " << c << " / " << channels()
+            << ", pooling elements = " << pooling_elements() << ", step = " << step()
+            << ", input offset = " << input_offset() << ", accumulator = " << accumulator[x * channels() + c];
+          ASSERT_EQ(int32_t(output_ref[x * channels() + c]), int32_t(output[x * output_stride() + c]))
+            << "at pixel " << x << " / " << output_pixels() << ", channel " << c << " / " << channels()
+            << ", pooling elements = " << pooling_elements() << ", step = " << step()
+            << ", input offset = " << input_offset() << ", accumulator = " << accumulator[x * channels() + c];
+        }
+      }
+    }
+  }
+
+  void Test(
+      xnn_qs8_avgpool_minmax_multipass_ukernel_function avgpool_minmax,
+      xnn_init_qs8_avgpool_minmax_params_fn init_params,
+      xnn_qs8_requantize_fn requantize) const
+  {
+    std::random_device random_device;
+    auto rng = std::mt19937(random_device());
+    auto i8rng = std::bind(
+      std::uniform_int_distribution<int32_t>(std::numeric_limits<int8_t>::min(), std::numeric_limits<int8_t>::max()), rng);
+
+    std::vector<const int8_t*> indirect_input((output_pixels() - 1) * step() + packed_pooling_elements());
+    std::vector<int8_t> input(XNN_EXTRA_BYTES / sizeof(int8_t) +
+      input_offset() + indirect_input.size() * channels());
+    std::vector<int8_t> zero(channels() + XNN_EXTRA_BYTES / sizeof(int8_t));
+    std::vector<int8_t> output((output_pixels() - 1) * output_stride() + channels());
+    std::vector<int8_t> output_ref(output_pixels() * channels());
+    std::vector<float> output_real(output_pixels() * channels());
+    std::vector<int32_t> accumulator(output_pixels() * channels());
+    std::vector<int32_t, AlignedAllocator<int32_t, 64>> buffer(XNN_EXTRA_BYTES / sizeof(int8_t) + channels());
+    for (size_t iteration = 0; iteration < iterations(); iteration++) {
+      do {
+        std::generate(input.begin(), input.end(), std::ref(i8rng));
+      } while (input.size() > 1 && *std::max_element(input.cbegin(), input.cend()) == *std::min_element(input.cbegin(), input.cend()));
+      std::fill(input.begin(), input.begin() + input_offset(), INT8_C(0xA5));
+      std::fill(input.end() - XNN_EXTRA_BYTES / sizeof(int8_t), input.end(), INT8_C(0xA5));
+      std::fill(output.begin(), output.end(), INT8_C(0xA5));
+
+      for (size_t i = 0; i < (output_pixels() - 1) * step() + pooling_elements(); i++) {
+        indirect_input[i] = input.data() + i * channels();
+      }
+      std::shuffle(indirect_input.begin(),
+        indirect_input.begin() + (output_pixels() - 1) * step() + pooling_elements(), rng);
+      if (zero_index() != SIZE_MAX) {
+        indirect_input[zero_index()] = zero.data();
+      }
+
+      // Prepare parameters.
+      union xnn_qs8_avgpool_minmax_params params;
+      init_params(
+        &params,
+        -int32_t(input_zero_point() - 0x80) * int32_t(pooling_elements()),
+        input_scale() / (output_scale() * float(pooling_elements())),
+        int8_t(output_zero_point() - 0x80), int8_t(qmin() - 0x80), int8_t(qmax() - 0x80));
+
+      // Compute reference results.
+      for (size_t x = 0; x < output_pixels(); x++) {
+        for (size_t c = 0; c < channels(); c++) {
+          int32_t acc = 0;
+          for (size_t p = 0; p < pooling_elements(); p++) {
+            const int8_t* row = indirect_input[x * step() + p];
+            if (row != zero.data()) {
+              acc += int32_t(row[c + input_offset()]);
+            }
+            acc -= int32_t(input_zero_point() - 0x80);
+          }
+          accumulator[x * channels() + c] = acc;
+          output_ref[x * channels() + c] = requantize(
+            acc, input_scale() / (output_scale() * float(pooling_elements())),
+            int8_t(output_zero_point() - 0x80), int8_t(qmin() - 0x80), int8_t(qmax() - 0x80));
+          const float scaled_acc =
+            float(acc) * (input_scale() / (output_scale() * float(pooling_elements()))) + float(output_zero_point() - 0x80);
+          output_real[x * channels() + c] =
+            std::min(std::max(scaled_acc, float(qmin() - 0x80)), float(qmax() - 0x80));
+        }
+      }
+
+      // Call optimized micro-kernel.
+      avgpool_minmax(output_pixels(), pooling_elements(), channels(),
+        indirect_input.data(), input_offset() * sizeof(int8_t), zero.data(),
+        buffer.data(), output.data(),
+        (step() - (packed_pooling_elements() - incremental_pooling_tile())) * sizeof(void*),
+        (output_stride() - channels()) * sizeof(int8_t),
+        &params);
+
+      // Verify results.
+      for (size_t x = 0; x < output_pixels(); x++) {
+        for (size_t c = 0; c < channels(); c++) {
+          ASSERT_GE(int32_t(output[x * output_stride() + c]), int32_t(qmin() - 0x80))
+            << "at pixel " << x << " / " << output_pixels() << ", channel " << c << " / " << channels()
+            << ", pooling elements = " << pooling_elements() << ", step = " << step()
+            << ", input offset = " << input_offset();
+          ASSERT_LE(int32_t(output[x * output_stride() + c]), int32_t(qmax() - 0x80))
+            << "at pixel " << x << " / " << output_pixels() << ", channel " << c << " / " << channels()
+            << ", pooling elements = " << pooling_elements() << ", step = " << step()
+            << ", input offset = " << input_offset();
+          ASSERT_NEAR(float(int32_t(output[x * output_stride() + c])), output_real[x * channels() + c], 0.5f)
+            << "at pixel " << x << " / " << output_pixels() << ", channel " << c << " / " << channels()
+            << ", pooling elements = " << pooling_elements() << ", step = " << step()
+            << ", input offset = " << input_offset() << ", accumulator = " << accumulator[x * channels() + c];
+          ASSERT_EQ(int32_t(output_ref[x * channels() + c]), int32_t(output[x * output_stride() + c]))
+            << "at pixel " << x << " / " << output_pixels() << ", channel " << c << " / " << channels()
+            << ", pooling elements = " << pooling_elements() << ", step = " << step()
+            << ", input offset = " << input_offset() << ", accumulator = " << accumulator[x * channels() + c];
+        }
+      }
+    }
+  }
+
+  void Test(xnn_f16_avgpool_minmax_unipass_ukernel_function avgpool_minmax, xnn_init_f16_scaleminmax_params_fn init_params) const {
+    std::random_device random_device;
+    auto rng = std::mt19937(random_device());
+    auto f32irng = std::bind(std::uniform_real_distribution<float>(), rng);
+    auto f16irng = std::bind(fp16_ieee_from_fp32_value, f32irng);
+
+    std::vector<const uint16_t*> indirect_input((output_pixels() - 1) * step() + packed_pooling_elements());
+    std::vector<uint16_t> input(XNN_EXTRA_BYTES / sizeof(uint16_t) +
+      input_offset() + indirect_input.size() * channels());
+    std::vector<uint16_t> zero(channels() + XNN_EXTRA_BYTES / sizeof(uint16_t));
+    std::vector<uint16_t> output((output_pixels() - 1) * output_stride() + channels());
+    std::vector<float> output_ref(output_pixels() * channels());
+    for (size_t iteration = 0; iteration < iterations(); iteration++) {
+      std::generate(input.begin(), input.end(), std::ref(f16irng));
+      std::fill(input.begin(), input.begin() + input_offset(), UINT16_C(0x7E00) /* NaN */);
+      std::fill(input.end() - XNN_EXTRA_BYTES / sizeof(uint16_t), input.end(), UINT16_C(0x7E00) /* NaN */);
+      std::fill(output.begin(), output.end(), UINT16_C(0x7E00) /* NaN */);
+
+      for (size_t i = 0; i < (output_pixels() - 1) * step() + pooling_elements(); i++) {
+        indirect_input[i] = input.data() + i * channels();
+      }
+      std::shuffle(indirect_input.begin(),
+        indirect_input.begin() + (output_pixels() - 1) * step() + pooling_elements(), rng);
+      if (zero_index() != SIZE_MAX) {
+        indirect_input[zero_index()] = zero.data();
+      }
+
+      // Compute reference results, without clamping.
+      for (size_t x = 0; x < output_pixels(); x++) {
+        for (size_t c = 0; c < channels(); c++) {
+          float acc = 0.0f;
+          for (size_t p = 0; p < pooling_elements(); p++) {
+            const uint16_t* row = indirect_input[x * step() + p];
+            if (row != zero.data()) {
+              acc += fp16_ieee_to_fp32_value(row[c + input_offset()]);
+            }
+          }
+          output_ref[x * channels() + c] = acc / float(pooling_elements());
+        }
+      }
+
+      // Compute clamping parameters.
+      const float accumulated_min = *std::min_element(output_ref.cbegin(), output_ref.cend());
+      const float accumulated_max = *std::max_element(output_ref.cbegin(), output_ref.cend());
+      const float accumulated_range = accumulated_max - accumulated_min;
+      const float output_min = fp16_ieee_to_fp32_value(fp16_ieee_from_fp32_value(accumulated_min + float(qmin()) / 255.0f * accumulated_range));
+      const float output_max = fp16_ieee_to_fp32_value(fp16_ieee_from_fp32_value(accumulated_max - float(255 - qmax()) / 255.0f * accumulated_range));
+
+      // Clamp reference results.
+      for (float& output_value : output_ref) {
+        output_value = std::max(std::min(output_value, output_max), output_min);
+      }
+
+      // Prepare parameters.
+      xnn_f16_scaleminmax_params params;
+      init_params(&params,
+        fp16_ieee_from_fp32_value(1.0f / float(pooling_elements())),
+        fp16_ieee_from_fp32_value(output_min),
+        fp16_ieee_from_fp32_value(output_max));
+
+      // Call optimized micro-kernel.
+      avgpool_minmax(output_pixels(), pooling_elements(), channels(),
+        reinterpret_cast<const void**>(indirect_input.data()), input_offset() * sizeof(uint16_t), zero.data(),
+        output.data(),
+        step() * sizeof(void*),
+        (output_stride() - channels()) * sizeof(uint16_t),
+        &params);
+
+      // Verify results.
+      for (size_t x = 0; x < output_pixels(); x++) {
+        for (size_t c = 0; c < channels(); c++) {
+          ASSERT_GE(fp16_ieee_to_fp32_value(output[x * output_stride() + c]), output_min)
+            << "at pixel " << x << " / " << output_pixels() << ", channel " << c << " / " << channels()
+            << ", pooling elements = " << pooling_elements() << ", step = " << step()
+            << ", input offset = " << input_offset();
+          ASSERT_LE(fp16_ieee_to_fp32_value(output[x * output_stride() + c]), output_max)
+            << "at pixel " << x << " / " << output_pixels() << ", channel " << c << " / " << channels()
+            << ", pooling elements = " << pooling_elements() << ", step = " << step()
+            << ", input offset = " << input_offset();
+          ASSERT_NEAR(
+              fp16_ieee_to_fp32_value(output[x * output_stride() + c]),
+              output_ref[x * channels() + c],
+              std::max(1.0e-4f, std::abs(output_ref[x * channels() + c]) * 3.0e-3f))
+            << "at pixel " << x << " / " << output_pixels() << ", channel " << c << " / " << channels()
+            << ", pooling elements = " << pooling_elements() << ", step = " << step()
+            << ", input offset = " << input_offset();
+        }
+      }
+    }
+  }
+
+  void Test(xnn_f16_avgpool_minmax_multipass_ukernel_function avgpool_minmax, xnn_init_f16_scaleminmax_params_fn init_params) const {
+    std::random_device random_device;
+    auto rng = std::mt19937(random_device());
+    auto f32irng = std::bind(std::uniform_real_distribution<float>(), rng);
+    auto f16irng = std::bind(fp16_ieee_from_fp32_value, f32irng);
+
+    std::vector<const uint16_t*> indirect_input((output_pixels() - 1) * step() + packed_pooling_elements());
+    std::vector<uint16_t> input(XNN_EXTRA_BYTES / sizeof(uint16_t) +
+      input_offset() + indirect_input.size() * channels());
+    std::vector<uint16_t> zero(channels() + XNN_EXTRA_BYTES / sizeof(uint16_t));
+    std::vector<uint16_t> output((output_pixels() - 1) * output_stride() + channels());
+    std::vector<float> output_ref(output_pixels() * channels());
+    std::vector<uint16_t, AlignedAllocator<uint16_t, 64>> buffer(XNN_EXTRA_BYTES / sizeof(uint16_t) + channels());
+    for (size_t iteration = 0; iteration < iterations(); iteration++) {
+      std::generate(input.begin(), input.end(), std::ref(f16irng));
+      std::fill(input.begin(), input.begin() + input_offset(), UINT16_C(0x7E00) /* NaN */);
+      std::fill(input.end() - XNN_EXTRA_BYTES / sizeof(uint16_t), input.end(), UINT16_C(0x7E00) /* NaN */);
+      std::fill(output.begin(), output.end(), UINT16_C(0x7E00) /* NaN */);
+
+      for (size_t i = 0; i < (output_pixels() - 1) * step() + pooling_elements(); i++) {
+        indirect_input[i] = input.data() + i * channels();
+      }
+      std::shuffle(indirect_input.begin(),
+        indirect_input.begin() + (output_pixels() - 1) * step() + pooling_elements(), rng);
+      if (zero_index() != SIZE_MAX) {
+        indirect_input[zero_index()] = zero.data();
+      }
+
+      // Compute reference results, without clamping.
+      for (size_t x = 0; x < output_pixels(); x++) {
+        for (size_t c = 0; c < channels(); c++) {
+          float acc = 0.0f;
+          for (size_t p = 0; p < pooling_elements(); p++) {
+            const uint16_t* row = indirect_input[x * step() + p];
+            if (row != zero.data()) {
+              acc += fp16_ieee_to_fp32_value(row[c + input_offset()]);
+            }
+          }
+          output_ref[x * channels() + c] = acc / float(pooling_elements());
+        }
+      }
+
+      // Compute clamping parameters.
+      const float accumulated_min = *std::min_element(output_ref.cbegin(), output_ref.cend());
+      const float accumulated_max = *std::max_element(output_ref.cbegin(), output_ref.cend());
+      const float accumulated_range = accumulated_max - accumulated_min;
+      const float output_min = fp16_ieee_to_fp32_value(fp16_ieee_from_fp32_value(accumulated_min + float(qmin()) / 255.0f * accumulated_range));
+      const float output_max = fp16_ieee_to_fp32_value(fp16_ieee_from_fp32_value(accumulated_max - float(255 - qmax()) / 255.0f * accumulated_range));
+
+      // Clamp reference results.
+      for (float& output_value : output_ref) {
+        output_value = std::max(std::min(output_value, output_max), output_min);
+      }
+
+      // Prepare parameters.
+      xnn_f16_scaleminmax_params params;
+      init_params(&params,
+        fp16_ieee_from_fp32_value(1.0f / float(pooling_elements())),
+        fp16_ieee_from_fp32_value(output_min),
+        fp16_ieee_from_fp32_value(output_max));
+
+      // Call optimized micro-kernel.
+      avgpool_minmax(output_pixels(), pooling_elements(), channels(),
+        reinterpret_cast<const void**>(indirect_input.data()), input_offset() * sizeof(uint16_t), zero.data(),
+        buffer.data(), output.data(),
+        (step() - (packed_pooling_elements() - incremental_pooling_tile())) * sizeof(void*),
+        (output_stride() - channels()) * sizeof(uint16_t),
+        &params);
+
+      // Verify results.
+      for (size_t x = 0; x < output_pixels(); x++) {
+        for (size_t c = 0; c < channels(); c++) {
+          ASSERT_GE(fp16_ieee_to_fp32_value(output[x * output_stride() + c]), output_min)
+            << "at pixel " << x << " / " << output_pixels() << ", channel " << c << " / " << channels()
+            << ", pooling elements = " << pooling_elements() << ", step = " << step()
+            << ", input offset = " << input_offset();
+          ASSERT_LE(fp16_ieee_to_fp32_value(output[x * output_stride() + c]), output_max)
+            << "at pixel " << x << " / " << output_pixels() << ", channel " << c << " / " << channels()
+            << ", pooling elements = " << pooling_elements() << ", step = " << step()
+            << ", input offset = " << input_offset();
+          ASSERT_NEAR(
+              fp16_ieee_to_fp32_value(output[x * output_stride() + c]),
+              output_ref[x * channels() + c],
+              std::max(1.0e-4f, std::abs(output_ref[x * channels() + c]) * 3.0e-3f))
+            << "at pixel " << x << " / " << output_pixels() << ", channel " << c << " / " << channels()
+            << ", pooling elements = " << pooling_elements() << ", step = " << step()
+            << ", input offset = " << input_offset();
+        }
+      }
+    }
+  }
+
   void Test(xnn_f32_avgpool_minmax_unipass_ukernel_function avgpool_minmax, xnn_init_f32_scaleminmax_params_fn init_params) const {
     std::random_device random_device;
     auto rng = std::mt19937(random_device());
@@ -561,6 +941,191 @@ class AvgPoolMicrokernelTester {
     }
   }
 
+  void Test(xnn_f16_pavgpool_minmax_unipass_ukernel_function pavgpool_minmax, xnn_init_f16_minmax_params_fn init_params) const {
+    std::random_device random_device;
+    auto rng = std::mt19937(random_device());
+    auto f32irng = std::bind(std::uniform_real_distribution<float>(), rng);
+    auto f16irng = std::bind(fp16_ieee_from_fp32_value, f32irng);
+    auto f32mrng = std::bind(std::uniform_real_distribution<float>(0.1f, 0.5f), rng);
+    auto f16mrng = std::bind(fp16_ieee_from_fp32_value, f32mrng);
+
+    std::vector<const uint16_t*> indirect_input((output_pixels() - 1) * step() + packed_pooling_elements());
+    std::vector<uint16_t> input(XNN_EXTRA_BYTES / sizeof(uint16_t) +
+      input_offset() + indirect_input.size() * channels());
+    std::vector<uint16_t> zero(channels() + XNN_EXTRA_BYTES / sizeof(uint16_t));
+    std::vector<uint16_t> multiplier(output_pixels());
+    std::vector<uint16_t> output((output_pixels() - 1) * output_stride() + channels());
+    std::vector<float> output_ref(output_pixels() * channels());
+    for (size_t iteration = 0; iteration < iterations(); iteration++) {
+      std::generate(input.begin(), input.end(), std::ref(f16irng));
+      std::fill(input.begin(), input.begin() + input_offset(), UINT16_C(0x7E00) /* NaN */);
+      std::fill(input.end() - XNN_EXTRA_BYTES / sizeof(uint16_t), input.end(), UINT16_C(0x7E00) /* NaN */);
+      std::generate(multiplier.begin(), multiplier.end(), std::ref(f16mrng));
+      std::fill(output.begin(), output.end(), UINT16_C(0x7E00) /* NaN */);
+
+      for (size_t i = 0; i < (output_pixels() - 1) * step() + pooling_elements(); i++) {
+        indirect_input[i] = input.data() + i * channels();
+      }
+      std::shuffle(indirect_input.begin(),
+        indirect_input.begin() + (output_pixels() - 1) * step() + pooling_elements(), rng);
+      if (zero_index() != SIZE_MAX) {
+        indirect_input[zero_index()] = zero.data();
+      }
+
+      // Compute reference results, without clamping.
+      for (size_t x = 0; x < output_pixels(); x++) {
+        for (size_t c = 0; c < channels(); c++) {
+          float acc = 0.0f;
+          for (size_t p = 0; p < pooling_elements(); p++) {
+            const uint16_t* row = indirect_input[x * step() + p];
+            if (row != zero.data()) {
+              acc += fp16_ieee_to_fp32_value(row[c + input_offset()]);
+            }
+          }
+          output_ref[x * channels() + c] = acc * fp16_ieee_to_fp32_value(multiplier[x]);
+        }
+      }
+
+      // Compute clamping parameters.
+      const float accumulated_min = *std::min_element(output_ref.cbegin(), output_ref.cend());
+      const float accumulated_max = *std::max_element(output_ref.cbegin(), output_ref.cend());
+      const float accumulated_range = accumulated_max - accumulated_min;
+      const float output_min = fp16_ieee_to_fp32_value(fp16_ieee_from_fp32_value(accumulated_min + float(qmin()) / 255.0f * accumulated_range));
+      const float output_max = fp16_ieee_to_fp32_value(fp16_ieee_from_fp32_value(accumulated_max - float(255 - qmax()) / 255.0f * accumulated_range));
+
+      // Clamp reference results.
+      for (float& output_value : output_ref) {
+        output_value = std::max(std::min(output_value, output_max), output_min);
+      }
+
+      // Prepare parameters.
+      xnn_f16_minmax_params params;
+      init_params(&params, fp16_ieee_from_fp32_value(output_min), fp16_ieee_from_fp32_value(output_max));
+
+      // Call optimized micro-kernel.
+      pavgpool_minmax(output_pixels(), pooling_elements(), channels(),
+        reinterpret_cast<const void**>(indirect_input.data()), input_offset() * sizeof(uint16_t), zero.data(),
+        multiplier.data(), output.data(),
+        step() * sizeof(void*),
+        (output_stride() - channels()) * sizeof(uint16_t),
+        &params);
+
+      // Verify results.
+      for (size_t x = 0; x < output_pixels(); x++) {
+        for (size_t c = 0; c < channels(); c++) {
+          ASSERT_GE(fp16_ieee_to_fp32_value(output[x * output_stride() + c]), output_min)
+            << "at pixel " << x << " / " << output_pixels() << ", channel " << c << " / " << channels()
+            << ", pooling elements = " << pooling_elements() << ", step = " << step()
+            << ", input offset = " << input_offset();
+          ASSERT_LE(fp16_ieee_to_fp32_value(output[x * output_stride() + c]), output_max)
+            << "at pixel " << x << " / " << output_pixels() << ", channel " << c << " / " << channels()
+            << ", pooling elements = " << pooling_elements() << ", step = " << step()
+            << ", input offset = " << input_offset();
+          ASSERT_NEAR(
+              fp16_ieee_to_fp32_value(output[x * output_stride() + c]),
+              output_ref[x * channels() + c],
+              std::max(1.0e-4f, std::abs(output_ref[x * channels() + c]) * 3.0e-3f))
+            << "at pixel " << x << " / " << output_pixels() << ", channel " << c << " / " << channels()
+            << ", pooling elements = " << pooling_elements() << ", step = " << step()
+            << ", input offset = " << input_offset();
+        }
+      }
+    }
+  }
+
+  void Test(xnn_f16_pavgpool_minmax_multipass_ukernel_function pavgpool_minmax, xnn_init_f16_minmax_params_fn init_params) const {
+    std::random_device random_device;
+    auto rng = std::mt19937(random_device());
+    auto f32irng = std::bind(std::uniform_real_distribution<float>(), rng);
+    auto f16irng = std::bind(fp16_ieee_from_fp32_value, f32irng);
+    auto f32mrng = std::bind(std::uniform_real_distribution<float>(0.1f, 0.5f), rng);
+    auto f16mrng = std::bind(fp16_ieee_from_fp32_value, f32mrng);
+
+    std::vector<const uint16_t*> indirect_input((output_pixels() - 1) * step() + packed_pooling_elements());
+    std::vector<uint16_t> input(XNN_EXTRA_BYTES / sizeof(uint16_t) +
+      input_offset() + indirect_input.size() * channels());
+    std::vector<uint16_t> zero(channels() + XNN_EXTRA_BYTES / sizeof(uint16_t));
+    std::vector<uint16_t> multiplier(output_pixels());
+    std::vector<uint16_t> output((output_pixels() - 1) * output_stride() + channels());
+    std::vector<float> output_ref(output_pixels() * channels());
+    std::vector<uint16_t, AlignedAllocator<uint16_t, 64>> buffer(XNN_EXTRA_BYTES / sizeof(uint16_t) + channels());
+    for (size_t iteration = 0; iteration < iterations(); iteration++) {
+      std::generate(input.begin(), input.end(), std::ref(f16irng));
+      std::fill(input.begin(), input.begin() + input_offset(), UINT16_C(0x7E00) /* NaN */);
+      std::fill(input.end() - XNN_EXTRA_BYTES / sizeof(uint16_t), input.end(), UINT16_C(0x7E00) /* NaN */);
+      std::generate(multiplier.begin(), multiplier.end(), std::ref(f16mrng));
+      std::fill(output.begin(), output.end(), UINT16_C(0x7E00) /* NaN */);
+
+      for (size_t i = 0; i < (output_pixels() - 1) * step() + pooling_elements(); i++) {
+        indirect_input[i] = input.data() + i * channels();
+      }
+      std::shuffle(indirect_input.begin(),
+        indirect_input.begin() + (output_pixels() - 1) * step() + pooling_elements(), rng);
+      if (zero_index() != SIZE_MAX) {
+        indirect_input[zero_index()] = zero.data();
+      }
+
+      // Compute reference results, without clamping.
+      for (size_t x = 0; x < output_pixels(); x++) {
+        for (size_t c = 0; c < channels(); c++) {
+          float acc = 0.0f;
+          for (size_t p = 0; p < pooling_elements(); p++) {
+            const uint16_t* row = indirect_input[x * step() + p];
+            if (row != zero.data()) {
+              acc += fp16_ieee_to_fp32_value(row[c + input_offset()]);
+            }
+          }
+          output_ref[x * channels() + c] = acc * fp16_ieee_to_fp32_value(multiplier[x]);
+        }
+      }
+
+      // Compute clamping parameters.
+      const float accumulated_min = *std::min_element(output_ref.cbegin(), output_ref.cend());
+      const float accumulated_max = *std::max_element(output_ref.cbegin(), output_ref.cend());
+      const float accumulated_range = accumulated_max - accumulated_min;
+      const float output_min = fp16_ieee_to_fp32_value(fp16_ieee_from_fp32_value(accumulated_min + float(qmin()) / 255.0f * accumulated_range));
+      const float output_max = fp16_ieee_to_fp32_value(fp16_ieee_from_fp32_value(accumulated_max - float(255 - qmax()) / 255.0f * accumulated_range));
+
+      // Clamp reference results.
+      for (float& output_value : output_ref) {
+        output_value = std::max(std::min(output_value, output_max), output_min);
+      }
+
+      // Prepare parameters.
+      xnn_f16_minmax_params params;
+      init_params(&params, fp16_ieee_from_fp32_value(output_min), fp16_ieee_from_fp32_value(output_max));
+
+      // Call optimized micro-kernel.
+      pavgpool_minmax(output_pixels(), pooling_elements(), channels(),
+        reinterpret_cast<const void**>(indirect_input.data()), input_offset() * sizeof(uint16_t), zero.data(),
+        multiplier.data(), buffer.data(), output.data(),
+        (step() - (packed_pooling_elements() - incremental_pooling_tile())) * sizeof(void*),
+        (output_stride() - channels()) * sizeof(uint16_t),
+        &params);
+
+      // Verify results.
+      for (size_t x = 0; x < output_pixels(); x++) {
+        for (size_t c = 0; c < channels(); c++) {
+          ASSERT_GE(fp16_ieee_to_fp32_value(output[x * output_stride() + c]), output_min)
+            << "at pixel " << x << " / " << output_pixels() << ", channel " << c << " / " << channels()
+            << ", pooling elements = " << pooling_elements() << ", step = " << step()
+            << ", input offset = " << input_offset();
+          ASSERT_LE(fp16_ieee_to_fp32_value(output[x * output_stride() + c]), output_max)
+            << "at pixel " << x << " / " << output_pixels() << ", channel " << c << " / " << channels()
+            << ", pooling elements = " << pooling_elements() << ", step = " << step()
+            << ", input offset = " << input_offset();
+          ASSERT_NEAR(
+              fp16_ieee_to_fp32_value(output[x * output_stride() + c]),
+              output_ref[x * channels() + c],
+              std::max(1.0e-4f, std::abs(output_ref[x * channels() + c]) * 3.0e-3f))
+            << "at pixel " << x << " / " << output_pixels() << ", channel " << c << " / " << channels()
+            << ", pooling elements = " << pooling_elements() << ", step = " << step()
+            << ", input offset = " << input_offset();
+        }
+      }
+    }
+  }
+
   void Test(xnn_f32_pavgpool_minmax_unipass_ukernel_function pavgpool_minmax, xnn_init_f32_minmax_params_fn init_params) const {
     std::random_device random_device;
     auto rng = std::mt19937(random_device());
@@ -1453,6 +1453,209 @@ TEST(CONVOLUTION_NCHW_F32, batched_depthwise_5x5s2_without_bias) {
     .TestNCHWxF32();
 }
 
+/**************************** DWCONV dilated path ****************************/
+
+TEST(CONVOLUTION_NCHW_F32, depthwise_3x3_dilation_2) {
+  ASSERT_EQ(xnn_status_success, xnn_initialize(nullptr /* allocator */));
+  ConvolutionOperatorTester()
+    .input_size(27, 29)
+    .kernel_size(3, 3)
+    .dilation(2)
+    .padding(2)
+    .groups(19)
+    .iterations(3)
+    .TestNCHWxF32();
+}
+
+TEST(CONVOLUTION_NCHW_F32, depthwise_3x3_dilation_2_varying_channels) {
+  ASSERT_EQ(xnn_status_success, xnn_initialize(nullptr /* allocator */));
+  for (size_t channels = 1; channels <= 16; channels *= 4) {
+    ConvolutionOperatorTester()
+      .input_size(27, 29)
+      .kernel_size(3, 3)
+      .dilation(2)
+      .padding(2)
+      .groups(channels)
+      .iterations(1)
+      .TestNCHWxF32();
+  }
+}
+
+TEST(CONVOLUTION_NCHW_F32, depthwise_3x3_dilation_4_subsampling_2) {
+  ConvolutionOperatorTester()
+    .input_size(27, 29)
+    .kernel_size(3, 3)
+    .dilation(4)
+    .padding(4)
+    .subsampling(2)
+    .groups(19)
+    .iterations(3)
+    .TestNCHWxF32();
+}
+
+TEST(CONVOLUTION_NCHW_F32, depthwise_3x3_dilation_2x3) {
+  ConvolutionOperatorTester()
+    .input_size(27, 29)
+    .kernel_size(3, 3)
+    .dilation(2, 3)
+    .padding(2, 3)
+    .groups(19)
+    .iterations(3)
+    .TestNCHWxF32();
+}
+
+TEST(CONVOLUTION_NCHW_F32, depthwise_5x5_dilation_2) {
+  ConvolutionOperatorTester()
+    .input_size(27, 29)
+    .kernel_size(5, 5)
+    .dilation(2)
+    .padding(4)
+    .groups(19)
+    .iterations(3)
+    .TestNCHWxF32();
+}
+
+TEST(CONVOLUTION_NCHW_F32, depthwise_7x7) {
+  ConvolutionOperatorTester()
+    .input_size(27, 29)
+    .kernel_size(7, 7)
+    .padding(3)
+    .groups(19)
+    .iterations(3)
+    .TestNCHWxF32();
+}
+
+TEST(CONVOLUTION_NCHW_F32, depthwise_7x7s2) {
+  ConvolutionOperatorTester()
+    .input_size(27, 29)
+    .kernel_size(7, 7)
+    .padding(3)
+    .subsampling(2)
+    .groups(19)
+    .iterations(3)
+    .TestNCHWxF32();
+}
+
+TEST(CONVOLUTION_NCHW_F32, depthwise_7x1_dilation_2) {
+  ConvolutionOperatorTester()
+    .input_size(27, 29)
+    .kernel_size(7, 1)
+    .dilation(2, 1)
+    .padding(6, 0)
+    .groups(19)
+    .iterations(3)
+    .TestNCHWxF32();
+}
+
+TEST(CONVOLUTION_NCHW_F32, depthwise_1x7_dilation_2) {
+  ConvolutionOperatorTester()
+    .input_size(27, 29)
+    .kernel_size(1, 7)
+    .dilation(1, 2)
+    .padding(0, 6)
+    .groups(19)
+    .iterations(3)
+    .TestNCHWxF32();
+}
+
+TEST(CONVOLUTION_NCHW_F32, depthwise_3x3_asymmetric_padding) {
+  ConvolutionOperatorTester()
+    .input_size(27, 29)
+    .kernel_size(3, 3)
+    .padding_top(0)
+    .padding_left(1)
+    .padding_bottom(2)
+    .padding_right(0)
+    .groups(19)
+    .iterations(3)
+    .TestNCHWxF32();
+}
+
+TEST(CONVOLUTION_NCHW_F32, depthwise_3x3_dilation_2_with_input_stride) {
+  ConvolutionOperatorTester()
+    .input_size(27, 29)
+    .kernel_size(3, 3)
+    .dilation(2)
+    .padding(2)
+    .input_channel_stride(21)
+    .groups(19)
+    .iterations(3)
+    .TestNCHWxF32();
+}
+
+TEST(CONVOLUTION_NCHW_F32, depthwise_3x3_dilation_2_with_output_stride) {
+  ConvolutionOperatorTester()
+    .input_size(27, 29)
+    .kernel_size(3, 3)
+    .dilation(2)
+    .padding(2)
+    .output_channel_stride(23)
+    .groups(19)
+    .iterations(3)
+    .TestNCHWxF32();
+}
+
+TEST(CONVOLUTION_NCHW_F32, depthwise_3x3_dilation_2_with_qmin) {
+  ConvolutionOperatorTester()
+    .input_size(27, 29)
+    .kernel_size(3, 3)
+    .dilation(2)
+    .padding(2)
+    .groups(19)
+    .qmin(128)
+    .iterations(3)
+    .TestNCHWxF32();
+}
+
+TEST(CONVOLUTION_NCHW_F32, depthwise_3x3_dilation_2_with_qmax) {
+  ConvolutionOperatorTester()
+    .input_size(27, 29)
+    .kernel_size(3, 3)
+    .dilation(2)
+    .padding(2)
+    .groups(19)
+    .qmax(128)
+    .iterations(3)
+    .TestNCHWxF32();
+}
+
+TEST(CONVOLUTION_NCHW_F32, depthwise_3x3_dilation_2_without_bias) {
+  ConvolutionOperatorTester()
+    .has_bias(false)
+    .input_size(27, 29)
+    .kernel_size(3, 3)
+    .dilation(2)
+    .padding(2)
+    .groups(19)
+    .iterations(3)
+    .TestNCHWxF32();
+}
+
+TEST(CONVOLUTION_NCHW_F32, batched_depthwise_3x3_dilation_2) {
+  ASSERT_EQ(xnn_status_success, xnn_initialize(nullptr /* allocator */));
+  ConvolutionOperatorTester()
+    .batch_size(2)
+    .input_size(27, 29)
+    .kernel_size(3, 3)
+    .dilation(2)
+    .padding(2)
+    .groups(19)
+    .iterations(3)
+    .TestNCHWxF32();
+}
+
+TEST(CONVOLUTION_NCHW_F32, batched_depthwise_7x7s2) {
+  ConvolutionOperatorTester()
+    .batch_size(2)
+    .input_size(27, 29)
+    .kernel_size(7, 7)
+    .padding(3)
+    .subsampling(2)
+    .groups(19)
+    .iterations(3)
+    .TestNCHWxF32();
+}
+
 /**************************** DWCONV 3x3 path ****************************/
 
 TEST(DEPTHWISE_CONVOLUTION_NCHW_F32, 3x3) {
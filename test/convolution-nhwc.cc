@@ -21,6 +21,17 @@ TEST(CONVOLUTION_NHWC_QC8, 1x1) {
     .TestNHWCxQC8();
 }
 
+TEST(CONVOLUTION_NHWC_QC8, 1x1_with_defer_packing) {
+  ConvolutionOperatorTester()
+    .defer_packing(true)
+    .input_size(27, 29)
+    .kernel_size(1, 1)
+    .group_input_channels(23)
+    .group_output_channels(19)
+    .iterations(3)
+    .TestNHWCxQC8();
+}
+
 TEST(CONVOLUTION_NHWC_QC8, 1x1_with_qmin) {
   ConvolutionOperatorTester()
     .input_size(27, 29)
@@ -341,6 +352,19 @@ TEST(CONVOLUTION_NHWC_QC8, grouped_3x3) {
     .TestNHWCxQC8();
 }
 
+TEST(CONVOLUTION_NHWC_QC8, grouped_3x3_with_defer_packing) {
+  ConvolutionOperatorTester()
+    .defer_packing(true)
+    .input_size(10, 11)
+    .padding(1)
+    .kernel_size(3, 3)
+    .groups(2)
+    .group_input_channels(14)
+    .group_output_channels(13)
+    .iterations(3)
+    .TestNHWCxQC8();
+}
+
 TEST(CONVOLUTION_NHWC_QC8, grouped_3x3_without_padding) {
   ConvolutionOperatorTester()
     .input_size(13, 12)
@@ -1217,6 +1241,17 @@ TEST(CONVOLUTION_NHWC_QS8, 1x1) {
     .TestNHWCxQS8();
 }
 
+TEST(CONVOLUTION_NHWC_QS8, 1x1_with_prepacked_weights) {
+  ConvolutionOperatorTester()
+    .prepacked_weights(true)
+    .input_size(27, 29)
+    .kernel_size(1, 1)
+    .group_input_channels(23)
+    .group_output_channels(19)
+    .iterations(3)
+    .TestNHWCxQS8();
+}
+
 TEST(CONVOLUTION_NHWC_QS8, 1x1_with_qmin) {
   ConvolutionOperatorTester()
     .input_size(27, 29)
@@ -1537,6 +1572,44 @@ TEST(CONVOLUTION_NHWC_QS8, grouped_3x3) {
     .TestNHWCxQS8();
 }
 
+TEST(CONVOLUTION_NHWC_QS8, grouped_3x3_with_prepacked_weights) {
+  ConvolutionOperatorTester()
+    .prepacked_weights(true)
+    .input_size(10, 11)
+    .padding(1)
+    .kernel_size(3, 3)
+    .groups(2)
+    .group_input_channels(14)
+    .group_output_channels(13)
+    .iterations(3)
+    .TestNHWCxQS8();
+}
+
+TEST(CONVOLUTION_NHWC_QS8, 3x3_with_compact_indirection) {
+  ConvolutionOperatorTester()
+    .compact_indirection(true)
+    .input_size(13, 12)
+    .padding(1)
+    .kernel_size(3, 3)
+    .group_input_channels(15)
+    .group_output_channels(17)
+    .iterations(3)
+    .TestNHWCxQS8();
+}
+
+TEST(CONVOLUTION_NHWC_QS8, grouped_3x3_with_compact_indirection) {
+  ConvolutionOperatorTester()
+    .compact_indirection(true)
+    .input_size(10, 11)
+    .padding(1)
+    .kernel_size(3, 3)
+    .groups(2)
+    .group_input_channels(14)
+    .group_output_channels(13)
+    .iterations(3)
+    .TestNHWCxQS8();
+}
+
 TEST(CONVOLUTION_NHWC_QS8, grouped_3x3_without_padding) {
   ConvolutionOperatorTester()
     .input_size(13, 12)
@@ -1777,6 +1850,17 @@ TEST(CONVOLUTION_NHWC_QS8, depthwise_3x3) {
     .TestNHWCxQS8();
 }
 
+TEST(CONVOLUTION_NHWC_QS8, depthwise_3x3_with_prepacked_weights) {
+  ConvolutionOperatorTester()
+    .prepacked_weights(true)
+    .input_size(15, 14)
+    .padding(1, 1)
+    .kernel_size(3, 3)
+    .groups(27)
+    .iterations(3)
+    .TestNHWCxQS8();
+}
+
 TEST(CONVOLUTION_NHWC_QS8, depthwise_3x3_without_bias) {
   ConvolutionOperatorTester()
     .has_bias(false)
@@ -1899,6 +1983,149 @@ TEST(CONVOLUTION_NHWC_QS8, depthwise_3x3d2x1) {
     .TestNHWCxQS8();
 }
 
+TEST(CONVOLUTION_NHWC_QS8, 7x7s2_direct) {
+  ConvolutionOperatorTester()
+    .input_size(32, 31)
+    .padding(3)
+    .kernel_size(7, 7)
+    .subsampling(2)
+    .group_input_channels(3)
+    .group_output_channels(19)
+    .iterations(3)
+    .TestNHWCxQS8();
+}
+
+TEST(CONVOLUTION_NHWC_QS8, 7x7s2_direct_with_batch) {
+  ConvolutionOperatorTester()
+    .batch_size(3)
+    .input_size(16, 15)
+    .padding(3)
+    .kernel_size(7, 7)
+    .subsampling(2)
+    .group_input_channels(3)
+    .group_output_channels(19)
+    .iterations(3)
+    .TestNHWCxQS8();
+}
+
+TEST(CONVOLUTION_NHWC_QS8, 7x7s2_direct_with_input_stride) {
+  ConvolutionOperatorTester()
+    .input_size(16, 15)
+    .padding(3)
+    .kernel_size(7, 7)
+    .subsampling(2)
+    .input_channel_stride(5)
+    .group_input_channels(3)
+    .group_output_channels(19)
+    .iterations(3)
+    .TestNHWCxQS8();
+}
+
+TEST(CONVOLUTION_NHWC_QS8, 7x7s2_direct_with_output_stride) {
+  ConvolutionOperatorTester()
+    .input_size(16, 15)
+    .padding(3)
+    .kernel_size(7, 7)
+    .subsampling(2)
+    .output_channel_stride(23)
+    .group_input_channels(3)
+    .group_output_channels(19)
+    .iterations(3)
+    .TestNHWCxQS8();
+}
+
+TEST(CONVOLUTION_NHWC_QS8, 7x7s2_direct_with_qmin) {
+  ConvolutionOperatorTester()
+    .input_size(16, 15)
+    .padding(3)
+    .kernel_size(7, 7)
+    .subsampling(2)
+    .group_input_channels(3)
+    .group_output_channels(19)
+    .qmin(128)
+    .iterations(3)
+    .TestNHWCxQS8();
+}
+
+TEST(CONVOLUTION_NHWC_QS8, 7x7s2_direct_with_qmax) {
+  ConvolutionOperatorTester()
+    .input_size(16, 15)
+    .padding(3)
+    .kernel_size(7, 7)
+    .subsampling(2)
+    .group_input_channels(3)
+    .group_output_channels(19)
+    .qmax(128)
+    .iterations(3)
+    .TestNHWCxQS8();
+}
+
+TEST(CONVOLUTION_NHWC_QS8, 7x7s2_direct_without_bias) {
+  ConvolutionOperatorTester()
+    .has_bias(false)
+    .input_size(16, 15)
+    .padding(3)
+    .kernel_size(7, 7)
+    .subsampling(2)
+    .group_input_channels(3)
+    .group_output_channels(19)
+    .iterations(3)
+    .TestNHWCxQS8();
+}
+
+TEST(CONVOLUTION_NHWC_QS8, 4x4s4_direct) {
+  ConvolutionOperatorTester()
+    .input_size(32, 28)
+    .kernel_size(4, 4)
+    .subsampling(4)
+    .group_input_channels(3)
+    .group_output_channels(17)
+    .iterations(3)
+    .TestNHWCxQS8();
+}
+
+TEST(CONVOLUTION_NHWC_QS8, 5x3s2x3_direct_with_asymmetric_padding) {
+  ConvolutionOperatorTester()
+    .input_size(17, 19)
+    .padding_top(2)
+    .padding_left(1)
+    .padding_bottom(1)
+    .padding_right(0)
+    .kernel_size(5, 3)
+    .subsampling(2, 3)
+    .group_input_channels(4)
+    .group_output_channels(11)
+    .iterations(3)
+    .TestNHWCxQS8();
+}
+
+TEST(CONVOLUTION_NHWC_QS8, 3x3s2_direct_with_1_input_channel) {
+  ConvolutionOperatorTester()
+    .input_size(15, 14)
+    .padding(1)
+    .kernel_size(3, 3)
+    .subsampling(2)
+    .group_input_channels(1)
+    .group_output_channels(9)
+    .iterations(3)
+    .TestNHWCxQS8();
+}
+
+TEST(CONVOLUTION_NHWC_QS8, setup_changing_size_direct) {
+  ASSERT_EQ(xnn_status_success, xnn_initialize(nullptr /* allocator */));
+  ConvolutionOperatorTester()
+    .batch_size(2)
+    .input_size(16, 15)
+    .next_input_size(19, 13)
+    .next_batch_size(3)
+    .padding(3)
+    .kernel_size(7, 7)
+    .subsampling(2)
+    .group_input_channels(3)
+    .group_output_channels(19)
+    .TestSetupNHWCxQS8();
+}
+
 TEST(DEPTHWISE_CONVOLUTION_NHWC_QS8, 1x1) {
   ConvolutionOperatorTester()
     .depthwise_layout(true)
@@ -3607,6 +3834,39 @@ TEST(CONVOLUTION_NHWC_F32, 1x1) {
     .TestNHWCxF32();
 }
 
+TEST(CONVOLUTION_NHWC_F32, 1x1_with_autotune) {
+  ConvolutionOperatorTester()
+    .autotune(true)
+    .input_size(27, 29)
+    .kernel_size(1, 1)
+    .group_input_channels(23)
+    .group_output_channels(19)
+    .iterations(3)
+    .TestNHWCxF32();
+}
+
+TEST(CONVOLUTION_NHWC_F32, 1x1_with_defer_packing) {
+  ConvolutionOperatorTester()
+    .defer_packing(true)
+    .input_size(27, 29)
+    .kernel_size(1, 1)
+    .group_input_channels(23)
+    .group_output_channels(19)
+    .iterations(3)
+    .TestNHWCxF32();
+}
+
+TEST(CONVOLUTION_NHWC_F32, 1x1_with_prepacked_weights) {
+  ConvolutionOperatorTester()
+    .prepacked_weights(true)
+    .input_size(27, 29)
+    .kernel_size(1, 1)
+    .group_input_channels(23)
+    .group_output_channels(19)
+    .iterations(3)
+    .TestNHWCxF32();
+}
+
 TEST(CONVOLUTION_NHWC_F32, 1x1_with_qmin) {
   ConvolutionOperatorTester()
     .input_size(27, 29)
@@ -3673,6 +3933,38 @@ TEST(CONVOLUTION_NHWC_F32, 1x1_with_batch) {
     .TestNHWCxF32();
 }
 
+TEST(CONVOLUTION_NHWC_F32, 1x1_with_residual) {
+  ConvolutionOperatorTester()
+    .has_residual(true)
+    .input_size(27, 29)
+    .kernel_size(1, 1)
+    .group_input_channels(23)
+    .group_output_channels(19)
+    .iterations(3)
+    .TestNHWCxF32();
+}
+
+TEST(CONVOLUTION_NHWC_F32, 1x1_with_residual_and_output_stride) {
+  ConvolutionOperatorTester()
+    .has_residual(true)
+    .input_size(27, 29)
+    .kernel_size(1, 1)
+    .output_channel_stride(29)
+    .group_input_channels(23)
+    .group_output_channels(19)
+    .iterations(3)
+    .TestNHWCxF32();
+}
+
+TEST(CONVOLUTION_NHWC_F32, 1x1_with_large_weights) {
+  ConvolutionOperatorTester()
+    .input_size(13, 14)
+    .kernel_size(1, 1)
+    .group_input_channels(1024)
+    .group_output_channels(259)
+    .TestNHWCxF32();
+}
+
 TEST(CONVOLUTION_NHWC_F32, grouped_1x1) {
   ConvolutionOperatorTester()
     .input_size(24, 25)
@@ -3926,9 +4218,11 @@ TEST(CONVOLUTION_NHWC_F32, 3x3) {
     .TestNHWCxF32();
 }
 
-TEST(CONVOLUTION_NHWC_F32, 3x3_without_padding) {
+TEST(CONVOLUTION_NHWC_F32, 3x3_with_autotune) {
   ConvolutionOperatorTester()
+    .autotune(true)
     .input_size(13, 12)
+    .padding(1)
     .kernel_size(3, 3)
     .group_input_channels(15)
     .group_output_channels(17)
@@ -3936,10 +4230,11 @@ TEST(CONVOLUTION_NHWC_F32, 3x3_without_padding) {
     .TestNHWCxF32();
 }
 
-TEST(CONVOLUTION_NHWC_F32, 3x3_with_left_padding) {
+TEST(CONVOLUTION_NHWC_F32, 3x3_with_defer_packing) {
   ConvolutionOperatorTester()
+    .defer_packing(true)
     .input_size(13, 12)
-    .padding_left(1)
+    .padding(1)
     .kernel_size(3, 3)
     .group_input_channels(15)
     .group_output_channels(17)
@@ -3947,21 +4242,24 @@ TEST(CONVOLUTION_NHWC_F32, 3x3_with_left_padding) {
     .TestNHWCxF32();
 }
 
-TEST(CONVOLUTION_NHWC_F32, 3x3_with_right_padding) {
+TEST(CONVOLUTION_NHWC_F32, grouped_3x3_with_defer_packing) {
   ConvolutionOperatorTester()
-    .input_size(13, 12)
-    .padding_right(1)
+    .defer_packing(true)
+    .input_size(10, 11)
+    .padding(1)
     .kernel_size(3, 3)
-    .group_input_channels(15)
-    .group_output_channels(17)
+    .groups(2)
+    .group_input_channels(14)
+    .group_output_channels(13)
     .iterations(3)
     .TestNHWCxF32();
 }
 
-TEST(CONVOLUTION_NHWC_F32, 3x3_with_top_padding) {
+TEST(CONVOLUTION_NHWC_F32, 3x3_with_prepacked_weights) {
   ConvolutionOperatorTester()
+    .prepacked_weights(true)
     .input_size(13, 12)
-    .padding_top(1)
+    .padding(1)
     .kernel_size(3, 3)
     .group_input_channels(15)
     .group_output_channels(17)
@@ -3969,10 +4267,11 @@ TEST(CONVOLUTION_NHWC_F32, 3x3_with_top_padding) {
     .TestNHWCxF32();
 }
 
-TEST(CONVOLUTION_NHWC_F32, 3x3_with_bottom_padding) {
+TEST(CONVOLUTION_NHWC_F32, 3x3_with_compact_indirection) {
   ConvolutionOperatorTester()
+    .compact_indirection(true)
     .input_size(13, 12)
-    .padding_bottom(1)
+    .padding(1)
     .kernel_size(3, 3)
     .group_input_channels(15)
     .group_output_channels(17)
@@ -3980,34 +4279,37 @@ TEST(CONVOLUTION_NHWC_F32, 3x3_with_bottom_padding) {
     .TestNHWCxF32();
 }
 
-TEST(CONVOLUTION_NHWC_F32, 3x3_with_input_stride) {
+TEST(CONVOLUTION_NHWC_F32, grouped_3x3_with_compact_indirection) {
   ConvolutionOperatorTester()
-    .input_size(13, 12)
+    .compact_indirection(true)
+    .input_size(10, 11)
     .padding(1)
     .kernel_size(3, 3)
-    .input_channel_stride(22)
-    .group_input_channels(15)
-    .group_output_channels(17)
+    .groups(2)
+    .group_input_channels(14)
+    .group_output_channels(13)
     .iterations(3)
     .TestNHWCxF32();
 }
 
-TEST(CONVOLUTION_NHWC_F32, 3x3_with_output_stride) {
+TEST(CONVOLUTION_NHWC_F32, batched_3x3_with_compact_indirection) {
   ConvolutionOperatorTester()
+    .compact_indirection(true)
+    .batch_size(2)
     .input_size(13, 12)
     .padding(1)
     .kernel_size(3, 3)
-    .output_channel_stride(23)
+    .dilation(2)
     .group_input_channels(15)
     .group_output_channels(17)
     .iterations(3)
     .TestNHWCxF32();
 }
 
-TEST(CONVOLUTION_NHWC_F32, 3x3_without_bias) {
+TEST(CONVOLUTION_NHWC_F32, 3x3_with_reflect_padding) {
   ConvolutionOperatorTester()
-    .has_bias(false)
-    .input_size(10, 9)
+    .padding_mode(XNN_FLAG_REFLECT_PADDING)
+    .input_size(13, 12)
     .padding(1)
     .kernel_size(3, 3)
     .group_input_channels(15)
@@ -4016,11 +4318,307 @@ TEST(CONVOLUTION_NHWC_F32, 3x3_without_bias) {
     .TestNHWCxF32();
 }
 
-TEST(CONVOLUTION_NHWC_F32, 3x3_with_batch) {
+TEST(CONVOLUTION_NHWC_F32, 5x5s2_with_reflect_padding) {
   ConvolutionOperatorTester()
-    .batch_size(3)
-    .input_size(10, 9)
-    .padding(1)
+    .padding_mode(XNN_FLAG_REFLECT_PADDING)
+    .input_size(13, 12)
+    .padding_top(2)
+    .padding_right(1)
+    .padding_bottom(2)
+    .padding_left(2)
+    .kernel_size(5, 5)
+    .subsampling(2)
+    .group_input_channels(15)
+    .group_output_channels(17)
+    .iterations(3)
+    .TestNHWCxF32();
+}
+
+TEST(CONVOLUTION_NHWC_F32, 3x3_with_reflect_padding_and_compact_indirection) {
+  ConvolutionOperatorTester()
+    .padding_mode(XNN_FLAG_REFLECT_PADDING)
+    .compact_indirection(true)
+    .batch_size(2)
+    .input_size(13, 12)
+    .padding(1)
+    .kernel_size(3, 3)
+    .group_input_channels(15)
+    .group_output_channels(17)
+    .iterations(3)
+    .TestNHWCxF32();
+}
+
+TEST(CONVOLUTION_NHWC_F32, depthwise_3x3_with_reflect_padding) {
+  ConvolutionOperatorTester()
+    .padding_mode(XNN_FLAG_REFLECT_PADDING)
+    .input_size(15, 14)
+    .padding(1, 1)
+    .kernel_size(3, 3)
+    .groups(24)
+    .iterations(3)
+    .TestNHWCxF32();
+}
+
+TEST(CONVOLUTION_NHWC_F32, 3x3_with_symmetric_padding) {
+  ConvolutionOperatorTester()
+    .padding_mode(XNN_FLAG_SYMMETRIC_PADDING)
+    .input_size(13, 12)
+    .padding(1)
+    .kernel_size(3, 3)
+    .group_input_channels(15)
+    .group_output_channels(17)
+    .iterations(3)
+    .TestNHWCxF32();
+}
+
+TEST(CONVOLUTION_NHWC_F32, 5x5s2_with_symmetric_padding) {
+  ConvolutionOperatorTester()
+    .padding_mode(XNN_FLAG_SYMMETRIC_PADDING)
+    .input_size(13, 12)
+    .padding_top(2)
+    .padding_right(1)
+    .padding_bottom(2)
+    .padding_left(2)
+    .kernel_size(5, 5)
+    .subsampling(2)
+    .group_input_channels(15)
+    .group_output_channels(17)
+    .iterations(3)
+    .TestNHWCxF32();
+}
+
+TEST(CONVOLUTION_NHWC_F32, 3x3_with_symmetric_padding_and_compact_indirection) {
+  ConvolutionOperatorTester()
+    .padding_mode(XNN_FLAG_SYMMETRIC_PADDING)
+    .compact_indirection(true)
+    .batch_size(2)
+    .input_size(13, 12)
+    .padding(1)
+    .kernel_size(3, 3)
+    .group_input_channels(15)
+    .group_output_channels(17)
+    .iterations(3)
+    .TestNHWCxF32();
+}
+
+TEST(CONVOLUTION_NHWC_F32, depthwise_3x3_with_symmetric_padding) {
+  ConvolutionOperatorTester()
+    .padding_mode(XNN_FLAG_SYMMETRIC_PADDING)
+    .input_size(15, 14)
+    .padding(1, 1)
+    .kernel_size(3, 3)
+    .groups(24)
+    .iterations(3)
+    .TestNHWCxF32();
+}
+
+TEST(CONVOLUTION_NHWC_F32, 3x3_with_edge_padding) {
+  ConvolutionOperatorTester()
+    .padding_mode(XNN_FLAG_EDGE_PADDING)
+    .input_size(13, 12)
+    .padding(1)
+    .kernel_size(3, 3)
+    .group_input_channels(15)
+    .group_output_channels(17)
+    .iterations(3)
+    .TestNHWCxF32();
+}
+
+TEST(CONVOLUTION_NHWC_F32, 5x5s2_with_edge_padding) {
+  ConvolutionOperatorTester()
+    .padding_mode(XNN_FLAG_EDGE_PADDING)
+    .input_size(13, 12)
+    .padding_top(2)
+    .padding_right(1)
+    .padding_bottom(2)
+    .padding_left(2)
+    .kernel_size(5, 5)
+    .subsampling(2)
+    .group_input_channels(15)
+    .group_output_channels(17)
+    .iterations(3)
+    .TestNHWCxF32();
+}
+
+TEST(CONVOLUTION_NHWC_F32, 3x3_with_edge_padding_and_compact_indirection) {
+  ConvolutionOperatorTester()
+    .padding_mode(XNN_FLAG_EDGE_PADDING)
+    .compact_indirection(true)
+    .batch_size(2)
+    .input_size(13, 12)
+    .padding(1)
+    .kernel_size(3, 3)
+    .group_input_channels(15)
+    .group_output_channels(17)
+    .iterations(3)
+    .TestNHWCxF32();
+}
+
+TEST(CONVOLUTION_NHWC_F32, depthwise_3x3_with_edge_padding) {
+  ConvolutionOperatorTester()
+    .padding_mode(XNN_FLAG_EDGE_PADDING)
+    .input_size(15, 14)
+    .padding(1, 1)
+    .kernel_size(3, 3)
+    .groups(24)
+    .iterations(3)
+    .TestNHWCxF32();
+}
+
+TEST(CONVOLUTION_NHWC_F32, grouped_3x3_with_prepacked_weights) {
+  ConvolutionOperatorTester()
+    .prepacked_weights(true)
+    .input_size(10, 11)
+    .padding(1)
+    .kernel_size(3, 3)
+    .groups(2)
+    .group_input_channels(14)
+    .group_output_channels(13)
+    .iterations(3)
+    .TestNHWCxF32();
+}
+
+TEST(CONVOLUTION_NHWC_F32, depthwise_1x1_with_prepacked_weights) {
+  ConvolutionOperatorTester()
+    .prepacked_weights(true)
+    .input_size(15, 14)
+    .kernel_size(1, 1)
+    .groups(24)
+    .iterations(3)
+    .TestNHWCxF32();
+}
+
+TEST(CONVOLUTION_NHWC_F32, depthwise_3x3_with_prepacked_weights) {
+  ConvolutionOperatorTester()
+    .prepacked_weights(true)
+    .input_size(15, 14)
+    .padding(1, 1)
+    .kernel_size(3, 3)
+    .groups(24)
+    .iterations(3)
+    .TestNHWCxF32();
+}
+
+TEST(CONVOLUTION_NHWC_F32, 3x3_with_residual) {
+  ConvolutionOperatorTester()
+    .has_residual(true)
+    .input_size(13, 12)
+    .padding(1)
+    .kernel_size(3, 3)
+    .group_input_channels(15)
+    .group_output_channels(17)
+    .iterations(3)
+    .TestNHWCxF32();
+}
+
+TEST(CONVOLUTION_NHWC_F32, 3x3_with_residual_and_batch) {
+  ConvolutionOperatorTester()
+    .has_residual(true)
+    .batch_size(3)
+    .input_size(13, 12)
+    .padding(1)
+    .kernel_size(3, 3)
+    .group_input_channels(15)
+    .group_output_channels(17)
+    .iterations(3)
+    .TestNHWCxF32();
+}
+
+TEST(CONVOLUTION_NHWC_F32, 3x3_without_padding) {
+  ConvolutionOperatorTester()
+    .input_size(13, 12)
+    .kernel_size(3, 3)
+    .group_input_channels(15)
+    .group_output_channels(17)
+    .iterations(3)
+    .TestNHWCxF32();
+}
+
+TEST(CONVOLUTION_NHWC_F32, 3x3_with_left_padding) {
+  ConvolutionOperatorTester()
+    .input_size(13, 12)
+    .padding_left(1)
+    .kernel_size(3, 3)
+    .group_input_channels(15)
+    .group_output_channels(17)
+    .iterations(3)
+    .TestNHWCxF32();
+}
+
+TEST(CONVOLUTION_NHWC_F32, 3x3_with_right_padding) {
+  ConvolutionOperatorTester()
+    .input_size(13, 12)
+    .padding_right(1)
+    .kernel_size(3, 3)
+    .group_input_channels(15)
+    .group_output_channels(17)
+    .iterations(3)
+    .TestNHWCxF32();
+}
+
+TEST(CONVOLUTION_NHWC_F32, 3x3_with_top_padding) {
+  ConvolutionOperatorTester()
+    .input_size(13, 12)
+    .padding_top(1)
+    .kernel_size(3, 3)
+    .group_input_channels(15)
+    .group_output_channels(17)
+    .iterations(3)
+    .TestNHWCxF32();
+}
+
+TEST(CONVOLUTION_NHWC_F32, 3x3_with_bottom_padding) {
+  ConvolutionOperatorTester()
+    .input_size(13, 12)
+    .padding_bottom(1)
+    .kernel_size(3, 3)
+    .group_input_channels(15)
+    .group_output_channels(17)
+    .iterations(3)
+    .TestNHWCxF32();
+}
+
+TEST(CONVOLUTION_NHWC_F32, 3x3_with_input_stride) {
+  ConvolutionOperatorTester()
+    .input_size(13, 12)
+    .padding(1)
+    .kernel_size(3, 3)
+    .input_channel_stride(22)
+    .group_input_channels(15)
+    .group_output_channels(17)
+    .iterations(3)
+    .TestNHWCxF32();
+}
+
+TEST(CONVOLUTION_NHWC_F32, 3x3_with_output_stride) {
+  ConvolutionOperatorTester()
+    .input_size(13, 12)
+    .padding(1)
+    .kernel_size(3, 3)
+    .output_channel_stride(23)
+    .group_input_channels(15)
+    .group_output_channels(17)
+    .iterations(3)
+    .TestNHWCxF32();
+}
+
+TEST(CONVOLUTION_NHWC_F32, 3x3_without_bias) {
+  ConvolutionOperatorTester()
+    .has_bias(false)
+    .input_size(10, 9)
+    .padding(1)
+    .kernel_size(3, 3)
+    .group_input_channels(15)
+    .group_output_channels(17)
+    .iterations(3)
+    .TestNHWCxF32();
+}
+
+TEST(CONVOLUTION_NHWC_F32, 3x3_with_batch) {
+  ConvolutionOperatorTester()
+    .batch_size(3)
+    .input_size(10, 9)
+    .padding(1)
     .kernel_size(3, 3)
     .group_input_channels(15)
     .group_output_channels(17)
@@ -4040,6 +4638,32 @@ TEST(CONVOLUTION_NHWC_F32, grouped_3x3) {
     .TestNHWCxF32();
 }
 
+TEST(CONVOLUTION_NHWC_F32, grouped_3x3_with_autotune) {
+  ConvolutionOperatorTester()
+    .autotune(true)
+    .input_size(10, 11)
+    .padding(1)
+    .kernel_size(3, 3)
+    .groups(2)
+    .group_input_channels(14)
+    .group_output_channels(13)
+    .iterations(3)
+    .TestNHWCxF32();
+}
+
+TEST(CONVOLUTION_NHWC_F32, grouped_3x3_with_residual) {
+  ConvolutionOperatorTester()
+    .has_residual(true)
+    .input_size(10, 11)
+    .padding(1)
+    .kernel_size(3, 3)
+    .groups(2)
+    .group_input_channels(14)
+    .group_output_channels(13)
+    .iterations(3)
+    .TestNHWCxF32();
+}
+
 TEST(CONVOLUTION_NHWC_F32, grouped_3x3_without_padding) {
   ConvolutionOperatorTester()
     .input_size(13, 12)
@@ -4718,6 +5342,162 @@ TEST(CONVOLUTION_NHWC_F32, depthwise_5x5d2x1) {
     .TestNHWCxF32();
 }
 
+TEST(CONVOLUTION_NHWC_F32, 7x7s2_direct) {
+  ConvolutionOperatorTester()
+    .input_size(32, 31)
+    .padding(3)
+    .kernel_size(7, 7)
+    .subsampling(2)
+    .group_input_channels(3)
+    .group_output_channels(19)
+    .iterations(3)
+    .TestNHWCxF32();
+}
+
+TEST(CONVOLUTION_NHWC_F32, 7x7s2_direct_with_batch) {
+  ConvolutionOperatorTester()
+    .batch_size(3)
+    .input_size(16, 15)
+    .padding(3)
+    .kernel_size(7, 7)
+    .subsampling(2)
+    .group_input_channels(3)
+    .group_output_channels(19)
+    .iterations(3)
+    .TestNHWCxF32();
+}
+
+TEST(CONVOLUTION_NHWC_F32, 7x7s2_direct_with_input_stride) {
+  ConvolutionOperatorTester()
+    .input_size(16, 15)
+    .padding(3)
+    .kernel_size(7, 7)
+    .subsampling(2)
+    .input_channel_stride(5)
+    .group_input_channels(3)
+    .group_output_channels(19)
+    .iterations(3)
+    .TestNHWCxF32();
+}
+
+TEST(CONVOLUTION_NHWC_F32, 7x7s2_direct_with_output_stride) {
+  ConvolutionOperatorTester()
+    .input_size(16, 15)
+    .padding(3)
+    .kernel_size(7, 7)
+    .subsampling(2)
+    .output_channel_stride(23)
+    .group_input_channels(3)
+    .group_output_channels(19)
+    .iterations(3)
+    .TestNHWCxF32();
+}
+
+TEST(CONVOLUTION_NHWC_F32, 7x7s2_direct_with_qmin) {
+  ConvolutionOperatorTester()
+    .input_size(16, 15)
+    .padding(3)
+    .kernel_size(7, 7)
+    .subsampling(2)
+    .group_input_channels(3)
+    .group_output_channels(19)
+    .qmin(128)
+    .iterations(3)
+    .TestNHWCxF32();
+}
+
+TEST(CONVOLUTION_NHWC_F32, 7x7s2_direct_with_qmax) {
+  ConvolutionOperatorTester()
+    .input_size(16, 15)
+    .padding(3)
+    .kernel_size(7, 7)
+    .subsampling(2)
+    .group_input_channels(3)
+    .group_output_channels(19)
+    .qmax(128)
+    .iterations(3)
+    .TestNHWCxF32();
+}
+
+TEST(CONVOLUTION_NHWC_F32, 7x7s2_direct_without_bias) {
+  ConvolutionOperatorTester()
+    .has_bias(false)
+    .input_size(16, 15)
+    .padding(3)
+    .kernel_size(7, 7)
+    .subsampling(2)
+    .group_input_channels(3)
+    .group_output_channels(19)
+    .iterations(3)
+    .TestNHWCxF32();
+}
+
+TEST(CONVOLUTION_NHWC_F32, 7x7s2_direct_with_residual) {
+  ConvolutionOperatorTester()
+    .has_residual(true)
+    .input_size(16, 15)
+    .padding(3)
+    .kernel_size(7, 7)
+    .subsampling(2)
+    .group_input_channels(3)
+    .group_output_channels(19)
+    .iterations(3)
+    .TestNHWCxF32();
+}
+
+TEST(CONVOLUTION_NHWC_F32, 4x4s4_direct) {
+  ConvolutionOperatorTester()
+    .input_size(32, 28)
+    .kernel_size(4, 4)
+    .subsampling(4)
+    .group_input_channels(3)
+    .group_output_channels(17)
+    .iterations(3)
+    .TestNHWCxF32();
+}
+
+TEST(CONVOLUTION_NHWC_F32, 5x3s2x3_direct_with_asymmetric_padding) {
+  ConvolutionOperatorTester()
+    .input_size(17, 19)
+    .padding_top(2)
+    .padding_left(1)
+    .padding_bottom(1)
+    .padding_right(0)
+    .kernel_size(5, 3)
+    .subsampling(2, 3)
+    .group_input_channels(4)
+    .group_output_channels(11)
+    .iterations(3)
+    .TestNHWCxF32();
+}
+
+TEST(CONVOLUTION_NHWC_F32, 3x3s2_direct_with_1_input_channel) {
+  ConvolutionOperatorTester()
+    .input_size(15, 14)
+    .padding(1)
+    .kernel_size(3, 3)
+    .subsampling(2)
+    .group_input_channels(1)
+    .group_output_channels(9)
+    .iterations(3)
+    .TestNHWCxF32();
+}
+
+TEST(CONVOLUTION_NHWC_F32, setup_changing_size_direct) {
+  ASSERT_EQ(xnn_status_success, xnn_initialize(nullptr /* allocator */));
+  ConvolutionOperatorTester()
+    .batch_size(2)
+    .input_size(16, 15)
+    .next_input_size(19, 13)
+    .next_batch_size(3)
+    .padding(3)
+    .kernel_size(7, 7)
+    .subsampling(2)
+    .group_input_channels(3)
+    .group_output_channels(19)
+    .TestSetupNHWCxF32();
+}
+
 TEST(DEPTHWISE_CONVOLUTION_NHWC_F32, 1x1) {
   ConvolutionOperatorTester()
     .depthwise_layout(true)
@@ -4906,6 +5686,20 @@ TEST(CONVOLUTION_NHWC_F32, setup_changing_input_buffer) {
     .TestSetupNHWCxF32();
 }
 
+TEST(CONVOLUTION_NHWC_F32, setup_changing_input_buffer_with_compact_indirection) {
+  ASSERT_EQ(xnn_status_success, xnn_initialize(nullptr /* allocator */));
+  ConvolutionOperatorTester()
+    .compact_indirection(true)
+    .batch_size(3)
+    .input_height(8)
+    .input_width(8)
+    .kernel_height(5)
+    .kernel_width(3)
+    .group_input_channels(15)
+    .group_output_channels(17)
+    .TestSetupNHWCxF32();
+}
+
 TEST(CONVOLUTION_NHWC_F32, setup_changing_input_buffer_grouped) {
   ASSERT_EQ(xnn_status_success, xnn_initialize(nullptr /* allocator */));
   ConvolutionOperatorTester()
@@ -5046,6 +5840,21 @@ TEST(CONVOLUTION_NHWC_F32, setup_changing_height) {
     .TestSetupNHWCxF32();
 }
 
+TEST(CONVOLUTION_NHWC_F32, setup_changing_height_with_compact_indirection) {
+  ASSERT_EQ(xnn_status_success, xnn_initialize(nullptr /* allocator */));
+  ConvolutionOperatorTester()
+    .compact_indirection(true)
+    .batch_size(3)
+    .input_height(8)
+    .input_width(8)
+    .next_input_height(9)
+    .kernel_height(5)
+    .kernel_width(3)
+    .group_input_channels(15)
+    .group_output_channels(17)
+    .TestSetupNHWCxF32();
+}
+
 TEST(CONVOLUTION_NHWC_F32, setup_changing_height_grouped) {
   ASSERT_EQ(xnn_status_success, xnn_initialize(nullptr /* allocator */));
   ConvolutionOperatorTester()
@@ -6411,6 +7220,149 @@ TEST(CONVOLUTION_NHWC_F16, depthwise_5x5d2x1) {
     .TestNHWCxF16();
 }
 
+TEST(CONVOLUTION_NHWC_F16, 7x7s2_direct) {
+  ConvolutionOperatorTester()
+    .input_size(32, 31)
+    .padding(3)
+    .kernel_size(7, 7)
+    .subsampling(2)
+    .group_input_channels(3)
+    .group_output_channels(19)
+    .iterations(3)
+    .TestNHWCxF16();
+}
+
+TEST(CONVOLUTION_NHWC_F16, 7x7s2_direct_with_batch) {
+  ConvolutionOperatorTester()
+    .batch_size(3)
+    .input_size(16, 15)
+    .padding(3)
+    .kernel_size(7, 7)
+    .subsampling(2)
+    .group_input_channels(3)
+    .group_output_channels(19)
+    .iterations(3)
+    .TestNHWCxF16();
+}
+
+TEST(CONVOLUTION_NHWC_F16, 7x7s2_direct_with_input_stride) {
+  ConvolutionOperatorTester()
+    .input_size(16, 15)
+    .padding(3)
+    .kernel_size(7, 7)
+    .subsampling(2)
+    .input_channel_stride(5)
+    .group_input_channels(3)
+    .group_output_channels(19)
+    .iterations(3)
+    .TestNHWCxF16();
+}
+
+TEST(CONVOLUTION_NHWC_F16, 7x7s2_direct_with_output_stride) {
+  ConvolutionOperatorTester()
+    .input_size(16, 15)
+    .padding(3)
+    .kernel_size(7, 7)
+    .subsampling(2)
+    .output_channel_stride(23)
+    .group_input_channels(3)
+    .group_output_channels(19)
+    .iterations(3)
+    .TestNHWCxF16();
+}
+
+TEST(CONVOLUTION_NHWC_F16, 7x7s2_direct_with_qmin) {
+  ConvolutionOperatorTester()
+    .input_size(16, 15)
+    .padding(3)
+    .kernel_size(7, 7)
+    .subsampling(2)
+    .group_input_channels(3)
+    .group_output_channels(19)
+    .qmin(128)
+    .iterations(3)
+    .TestNHWCxF16();
+}
+
+TEST(CONVOLUTION_NHWC_F16, 7x7s2_direct_with_qmax) {
+  ConvolutionOperatorTester()
+    .input_size(16, 15)
+    .padding(3)
+    .kernel_size(7, 7)
+    .subsampling(2)
+    .group_input_channels(3)
+    .group_output_channels(19)
+    .qmax(128)
+    .iterations(3)
+    .TestNHWCxF16();
+}
+
+TEST(CONVOLUTION_NHWC_F16, 7x7s2_direct_without_bias) {
+  ConvolutionOperatorTester()
+    .has_bias(false)
+    .input_size(16, 15)
+    .padding(3)
+    .kernel_size(7, 7)
+    .subsampling(2)
+    .group_input_channels(3)
+    .group_output_channels(19)
+    .iterations(3)
+    .TestNHWCxF16();
+}
+
+TEST(CONVOLUTION_NHWC_F16, 4x4s4_direct) {
+  ConvolutionOperatorTester()
+    .input_size(32, 28)
+    .kernel_size(4, 4)
+    .subsampling(4)
+    .group_input_channels(3)
+    .group_output_channels(17)
+    .iterations(3)
+    .TestNHWCxF16();
+}
+
+TEST(CONVOLUTION_NHWC_F16, 5x3s2x3_direct_with_asymmetric_padding) {
+  ConvolutionOperatorTester()
+    .input_size(17, 19)
+    .padding_top(2)
+    .padding_left(1)
+    .padding_bottom(1)
+    .padding_right(0)
+    .kernel_size(5, 3)
+    .subsampling(2, 3)
+    .group_input_channels(4)
+    .group_output_channels(11)
+    .iterations(3)
+    .TestNHWCxF16();
+}
+
+TEST(CONVOLUTION_NHWC_F16, 3x3s2_direct_with_1_input_channel) {
+  ConvolutionOperatorTester()
+    .input_size(15, 14)
+    .padding(1)
+    .kernel_size(3, 3)
+    .subsampling(2)
+    .group_input_channels(1)
+    .group_output_channels(9)
+    .iterations(3)
+    .TestNHWCxF16();
+}
+
+TEST(CONVOLUTION_NHWC_F16, setup_changing_size_direct) {
+  ASSERT_EQ(xnn_status_success, xnn_initialize(nullptr /* allocator */));
+  ConvolutionOperatorTester()
+    .batch_size(2)
+    .input_size(16, 15)
+    .next_input_size(19, 13)
+    .next_batch_size(3)
+    .padding(3)
+    .kernel_size(7, 7)
+    .subsampling(2)
+    .group_input_channels(3)
+    .group_output_channels(19)
+    .TestSetupNHWCxF16();
+}
+
 TEST(DEPTHWISE_CONVOLUTION_NHWC_F16, 1x1) {
   ConvolutionOperatorTester()
     .depthwise_layout(true)
@@ -0,0 +1,380 @@
+// Copyright 2022 Google LLC
+//
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree.
+
+#include <gtest/gtest.h>
+
+#include "convolution1d-operator-tester.h"
+
+
+TEST(CONVOLUTION_NWC_F32, 1x1) {
+  Convolution1DOperatorTester()
+    .input_width(27)
+    .kernel_width(1)
+    .group_input_channels(23)
+    .group_output_channels(19)
+    .iterations(3)
+    .TestNWCxF32();
+}
+
+TEST(CONVOLUTION_NWC_F32, 1x1_with_qmin) {
+  Convolution1DOperatorTester()
+    .input_width(27)
+    .kernel_width(1)
+    .group_input_channels(23)
+    .group_output_channels(19)
+    .qmin(128)
+    .iterations(3)
+    .TestNWCxF32();
+}
+
+TEST(CONVOLUTION_NWC_F32, 1x1_with_qmax) {
+  Convolution1DOperatorTester()
+    .input_width(27)
+    .kernel_width(1)
+    .group_input_channels(23)
+    .group_output_channels(19)
+    .qmax(128)
+    .iterations(3)
+    .TestNWCxF32();
+}
+
+TEST(CONVOLUTION_NWC_F32, 1x1_with_input_stride) {
+  Convolution1DOperatorTester()
+    .input_width(27)
+    .kernel_width(1)
+    .group_input_channels(23)
+    .group_output_channels(19)
+    .input_channel_stride(28)
+    .iterations(3)
+    .TestNWCxF32();
+}
+
+TEST(CONVOLUTION_NWC_F32, 1x1_with_output_stride) {
+  Convolution1DOperatorTester()
+    .input_width(27)
+    .kernel_width(1)
+    .group_input_channels(23)
+    .group_output_channels(19)
+    .output_channel_stride(29)
+    .iterations(3)
+    .TestNWCxF32();
+}
+
+TEST(CONVOLUTION_NWC_F32, 1x1_without_bias) {
+  Convolution1DOperatorTester()
+    .has_bias(false)
+    .input_width(27)
+    .kernel_width(1)
+    .group_input_channels(23)
+    .group_output_channels(19)
+    .iterations(3)
+    .TestNWCxF32();
+}
+
+TEST(CONVOLUTION_NWC_F32, 1x1_with_batch) {
+  Convolution1DOperatorTester()
+    .batch_size(3)
+    .input_width(27)
+    .kernel_width(1)
+    .group_input_channels(23)
+    .group_output_channels(19)
+    .iterations(3)
+    .TestNWCxF32();
+}
+
+TEST(CONVOLUTION_NWC_F32, kw3) {
+  Convolution1DOperatorTester()
+    .input_width(29)
+    .kernel_width(3)
+    .group_input_channels(15)
+    .group_output_channels(17)
+    .iterations(3)
+    .TestNWCxF32();
+}
+
+TEST(CONVOLUTION_NWC_F32, kw3_with_padding) {
+  Convolution1DOperatorTester()
+    .input_width(29)
+    .padding(1)
+    .kernel_width(3)
+    .group_input_channels(15)
+    .group_output_channels(17)
+    .iterations(3)
+    .TestNWCxF32();
+}
+
+TEST(CONVOLUTION_NWC_F32, kw3_with_left_padding) {
+  Convolution1DOperatorTester()
+    .input_width(29)
+    .padding_left(2)
+    .kernel_width(3)
+    .group_input_channels(15)
+    .group_output_channels(17)
+    .iterations(3)
+    .TestNWCxF32();
+}
+
+TEST(CONVOLUTION_NWC_F32, kw5_with_subsampling) {
+  Convolution1DOperatorTester()
+    .input_width(29)
+    .padding(2)
+    .kernel_width(5)
+    .subsampling(2)
+    .group_input_channels(15)
+    .group_output_channels(17)
+    .iterations(3)
+    .TestNWCxF32();
+}
+
+TEST(CONVOLUTION_NWC_F32, kw3_with_dilation) {
+  Convolution1DOperatorTester()
+    .input_width(29)
+    .padding(2)
+    .kernel_width(3)
+    .dilation(2)
+    .group_input_channels(15)
+    .group_output_channels(17)
+    .iterations(3)
+    .TestNWCxF32();
+}
+
+TEST(CONVOLUTION_NWC_F32, kw3_with_batch) {
+  Convolution1DOperatorTester()
+    .batch_size(3)
+    .input_width(29)
+    .padding(1)
+    .kernel_width(3)
+    .group_input_channels(15)
+    .group_output_channels(17)
+    .iterations(3)
+    .TestNWCxF32();
+}
+
+TEST(CONVOLUTION_NWC_F32, grouped_kw3) {
+  Convolution1DOperatorTester()
+    .input_width(29)
+    .padding(1)
+    .kernel_width(3)
+    .groups(2)
+    .group_input_channels(15)
+    .group_output_channels(17)
+    .iterations(3)
+    .TestNWCxF32();
+}
+
+TEST(CONVOLUTION_NWC_F32, depthwise_kw5) {
+  Convolution1DOperatorTester()
+    .input_width(29)
+    .padding(2)
+    .kernel_width(5)
+    .groups(24)
+    .group_input_channels(1)
+    .group_output_channels(1)
+    .iterations(3)
+    .TestNWCxF32();
+}
+
+TEST(CONVOLUTION_NWC_F32, streaming_1x1) {
+  Convolution1DOperatorTester()
+    .streaming(true)
+    .input_width(27)
+    .kernel_width(1)
+    .group_input_channels(23)
+    .group_output_channels(19)
+    .iterations(3)
+    .TestNWCxF32();
+}
+
+TEST(CONVOLUTION_NWC_F32, streaming_kw3) {
+  Convolution1DOperatorTester()
+    .streaming(true)
+    .input_width(29)
+    .kernel_width(3)
+    .group_input_channels(15)
+    .group_output_channels(17)
+    .iterations(3)
+    .TestNWCxF32();
+}
+
+TEST(CONVOLUTION_NWC_F32, streaming_kw3_with_left_padding) {
+  Convolution1DOperatorTester()
+    .streaming(true)
+    .input_width(29)
+    .padding_left(2)
+    .kernel_width(3)
+    .group_input_channels(15)
+    .group_output_channels(17)
+    .iterations(3)
+    .TestNWCxF32();
+}
+
+TEST(CONVOLUTION_NWC_F32, streaming_kw3_with_large_left_padding) {
+  Convolution1DOperatorTester()
+    .streaming(true)
+    .input_width(29)
+    .padding_left(5)
+    .kernel_width(3)
+    .group_input_channels(15)
+    .group_output_channels(17)
+    .iterations(3)
+    .TestNWCxF32();
+}
+
+TEST(CONVOLUTION_NWC_F32, streaming_kw3_with_single_frame_chunks) {
+  Convolution1DOperatorTester()
+    .streaming(true)
+    .input_width(29)
+    .padding_left(2)
+    .kernel_width(3)
+    .max_chunk_width(1)
+    .group_input_channels(15)
+    .group_output_channels(17)
+    .iterations(3)
+    .TestNWCxF32();
+}
+
+TEST(CONVOLUTION_NWC_F32, streaming_kw3_with_long_chunks) {
+  Convolution1DOperatorTester()
+    .streaming(true)
+    .input_width(61)
+    .padding_left(2)
+    .kernel_width(3)
+    .max_chunk_width(17)
+    .group_input_channels(15)
+    .group_output_channels(17)
+    .iterations(3)
+    .TestNWCxF32();
+}
+
+TEST(CONVOLUTION_NWC_F32, streaming_kw5_with_subsampling) {
+  Convolution1DOperatorTester()
+    .streaming(true)
+    .input_width(29)
+    .padding_left(4)
+    .kernel_width(5)
+    .subsampling(2)
+    .group_input_channels(15)
+    .group_output_channels(17)
+    .iterations(3)
+    .TestNWCxF32();
+}
+
+TEST(CONVOLUTION_NWC_F32, streaming_kw2_with_subsampling_equal_to_kernel) {
+  Convolution1DOperatorTester()
+    .streaming(true)
+    .input_width(29)
+    .kernel_width(2)
+    .subsampling(2)
+    .group_input_channels(15)
+    .group_output_channels(17)
+    .iterations(3)
+    .TestNWCxF32();
+}
+
+TEST(CONVOLUTION_NWC_F32, streaming_kw3_with_dilation) {
+  Convolution1DOperatorTester()
+    .streaming(true)
+    .input_width(29)
+    .padding_left(4)
+    .kernel_width(3)
+    .dilation(2)
+    .max_chunk_width(7)
+    .group_input_channels(15)
+    .group_output_channels(17)
+    .iterations(3)
+    .TestNWCxF32();
+}
+
+TEST(CONVOLUTION_NWC_F32, streaming_kw3_with_input_stride) {
+  Convolution1DOperatorTester()
+    .streaming(true)
+    .input_width(29)
+    .padding_left(2)
+    .kernel_width(3)
+    .input_channel_stride(18)
+    .group_input_channels(15)
+    .group_output_channels(17)
+    .iterations(3)
+    .TestNWCxF32();
+}
+
+TEST(CONVOLUTION_NWC_F32, streaming_kw3_with_output_stride) {
+  Convolution1DOperatorTester()
+    .streaming(true)
+    .input_width(29)
+    .padding_left(2)
+    .kernel_width(3)
+    .output_channel_stride(19)
+    .group_input_channels(15)
+    .group_output_channels(17)
+    .iterations(3)
+    .TestNWCxF32();
+}
+
+TEST(CONVOLUTION_NWC_F32, streaming_kw3_with_batch) {
+  Convolution1DOperatorTester()
+    .streaming(true)
+    .batch_size(3)
+    .input_width(29)
+    .padding_left(2)
+    .kernel_width(3)
+    .group_input_channels(15)
+    .group_output_channels(17)
+    .iterations(3)
+    .TestNWCxF32();
+}
+
+TEST(CONVOLUTION_NWC_F32, streaming_kw3_with_qmin) {
+  Convolution1DOperatorTester()
+    .streaming(true)
+    .input_width(29)
+    .padding_left(2)
+    .kernel_width(3)
+    .group_input_channels(15)
+    .group_output_channels(17)
+    .qmin(128)
+    .iterations(3)
+    .TestNWCxF32();
+}
+
+TEST(CONVOLUTION_NWC_F32, streaming_kw3_with_qmax) {
+  Convolution1DOperatorTester()
+    .streaming(true)
+    .input_width(29)
+    .padding_left(2)
+    .kernel_width(3)
+    .group_input_channels(15)
+    .group_output_channels(17)
+    .qmax(128)
+    .iterations(3)
+    .TestNWCxF32();
+}
+
+TEST(CONVOLUTION_NWC_F32, streaming_depthwise_kw5) {
+  Convolution1DOperatorTester()
+    .streaming(true)
+    .input_width(29)
+    .padding_left(4)
+    .kernel_width(5)
+    .groups(24)
+    .group_input_channels(1)
+    .group_output_channels(1)
+    .iterations(3)
+    .TestNWCxF32();
+}
+
+TEST(CONVOLUTION_NWC_F32, streaming_depthwise_kw3_with_dilation) {
+  Convolution1DOperatorTester()
+    .streaming(true)
+    .input_width(41)
+    .padding_left(4)
+    .kernel_width(3)
+    .dilation(2)
+    .groups(24)
+    .group_input_channels(1)
+    .group_output_channels(1)
+    .iterations(3)
+    .TestNWCxF32();
+}
@@ -23,6 +23,7 @@
 #include <fp16.h>
 
 #include <xnnpack.h>
+#include <xnnpack/AlignedAllocator.h>
 
 
 class ConvolutionOperatorTester {
@@ -493,6 +494,51 @@ class ConvolutionOperatorTester {
     return this->depthwise_layout_;
   }
 
+  inline ConvolutionOperatorTester& autotune(bool autotune) {
+    this->autotune_ = autotune;
+    return *this;
+  }
+
+  inline bool autotune() const {
+    return this->autotune_;
+  }
+
+  inline ConvolutionOperatorTester& defer_packing(bool defer_packing) {
+    this->defer_packing_ = defer_packing;
+    return *this;
+  }
+
+  inline bool defer_packing() const {
+    return this->defer_packing_;
+  }
+
+  inline ConvolutionOperatorTester& prepacked_weights(bool prepacked_weights) {
+    this->prepacked_weights_ = prepacked_weights;
+    return *this;
+  }
+
+  inline bool prepacked_weights() const {
+    return this->prepacked_weights_;
+  }
+
+  inline ConvolutionOperatorTester& padding_mode(uint32_t padding_mode) {
+    this->padding_mode_ = padding_mode;
+    return *this;
+  }
+
+  inline uint32_t padding_mode() const {
+    return this->padding_mode_;
+  }
+
+  inline ConvolutionOperatorTester& compact_indirection(bool compact_indirection) {
+    this->compact_indirection_ = compact_indirection;
+    return *this;
+  }
+
+  inline bool compact_indirection() const {
+    return this->compact_indirection_;
+  }
+
   inline ConvolutionOperatorTester& has_bias(bool has_bias) {
     this->has_bias_ = has_bias;
     return *this;
@@ -502,6 +548,15 @@ class ConvolutionOperatorTester {
     return this->has_bias_;
   }
 
+  inline ConvolutionOperatorTester& has_residual(bool has_residual) {
+    this->has_residual_ = has_residual;
+    return *this;
+  }
+
+  inline bool has_residual() const {
+    return this->has_residual_;
+  }
+
   inline ConvolutionOperatorTester& weights_type(WeightsType weights_type) {
     this->weights_type_ = weights_type;
     return *this;
@@ -672,7 +727,8 @@ class ConvolutionOperatorTester {
           input_zero_point, 1.0f /* input scale */, requantization_scales.data(),
           kernel.data(), has_bias() ? bias.data() : nullptr,
           output_zero_point, 1.0f /* output scale */, int8_t(qmin() - 0x80), int8_t(qmax() - 0x80),
-          (depthwise_layout() ? XNN_FLAG_DEPTHWISE_CONVOLUTION : 0) | (padding_tf_same() ? XNN_FLAG_TENSORFLOW_SAME_PADDING : 0),
+          (depthwise_layout() ? XNN_FLAG_DEPTHWISE_CONVOLUTION : 0) | (padding_tf_same() ? XNN_FLAG_TENSORFLOW_SAME_PADDING : 0) |
+            (defer_packing() ? XNN_FLAG_DEFER_PACKING : 0),
           &convolution_op);
       if (status == xnn_status_unsupported_hardware) {
         GTEST_SKIP();
@@ -835,7 +891,60 @@ class ConvolutionOperatorTester {
       ASSERT_EQ(xnn_status_success, xnn_initialize(nullptr /* allocator */));
       xnn_operator_t convolution_op = nullptr;
 
-      xnn_status status = xnn_create_convolution2d_nhwc_qs8(
+      const uint32_t flags =
+        (depthwise_layout() ? XNN_FLAG_DEPTHWISE_CONVOLUTION : 0) | (padding_tf_same() ? XNN_FLAG_TENSORFLOW_SAME_PADDING : 0) |
+        (defer_packing() ? XNN_FLAG_DEFER_PACKING : 0) | (compact_indirection() ? XNN_FLAG_COMPACT_INDIRECTION : 0);
+      std::vector<uint8_t, AlignedAllocator<uint8_t, XNN_PACKED_WEIGHTS_ALIGNMENT>> packed_weights;
+      xnn_status status = xnn_status_success;
+      if (prepacked_weights()) {
+        size_t packed_weights_size = 0;
+        uint64_t fingerprint = 0;
+        status = xnn_pack_convolution2d_nhwc_qs8_weights(
+          padding_tf_same() ? 0 : padding_top(), padding_tf_same() ? 0 : padding_right(),
+          padding_tf_same() ? 0 : padding_bottom(), padding_tf_same() ? 0 : padding_left(),
+          kernel_height(), kernel_width(),
+          subsampling_height(), subsampling_width(),
+          dilation_height(), dilation_width(),
+          groups(), group_input_channels(), group_output_channels(),
+          input_zero_point, kernel.data(), has_bias() ? bias.data() : nullptr,
+          flags, nullptr /* packed weights */, &packed_weights_size, &fingerprint);
+        if (status == xnn_status_unsupported_hardware) {
+          GTEST_SKIP();
+        }
+        ASSERT_EQ(xnn_status_success, status);
+        packed_weights.resize(packed_weights_size);
+        uint64_t packed_fingerprint = 0;
+        ASSERT_EQ(xnn_status_success,
+          xnn_pack_convolution2d_nhwc_qs8_weights(
+            padding_tf_same() ? 0 : padding_top(), padding_tf_same() ? 0 : padding_right(),
+            padding_tf_same() ? 0 : padding_bottom(), padding_tf_same() ? 0 : padding_left(),
+            kernel_height(), kernel_width(),
+            subsampling_height(), subsampling_width(),
+            dilation_height(), dilation_width(),
+            groups(), group_input_channels(), group_output_channels(),
+            input_zero_point, kernel.data(), has_bias() ? bias.data() : nullptr,
+            flags, packed_weights.data(), &packed_weights_size, &packed_fingerprint));
+        ASSERT_EQ(fingerprint, packed_fingerprint);
+        ASSERT_EQ(packed_weights.size(), packed_weights_size);
+
+        ASSERT_EQ(xnn_status_unsupported_parameter,
+          xnn_create_convolution2d_nhwc_qs8_with_packed_weights(
+            padding_tf_same() ? 0 : padding_top(), padding_tf_same() ? 0 : padding_right(),
+            padding_tf_same() ? 0 : padding_bottom(), padding_tf_same() ? 0 : padding_left(),
+            kernel_height(), kernel_width(),
+            subsampling_height(), subsampling_width(),
+            dilation_height(), dilation_width(),
+            groups(), group_input_channels(), group_output_channels(),
+            input_channel_stride(), output_channel_stride(),
+            input_zero_point, 1.0f /* input scale */, 1.0f /* kernel scale */,
+            packed_weights.data(), packed_weights.size(), fingerprint + 1,
+            output_zero_point, output_scale, int8_t(qmin() - 0x80), int8_t(qmax() - 0x80),
+            flags, &convolution_op));
+
+        // Clobber the original weights to check that the operator does not reference them.
+        std::fill(kernel.begin(), kernel.end(), 0);
+        std::fill(bias.begin(), bias.end(), 0);
+        status = xnn_create_convolution2d_nhwc_qs8_with_packed_weights(
           padding_tf_same() ? 0 : padding_top(), padding_tf_same() ? 0 : padding_right(),
           padding_tf_same() ? 0 : padding_bottom(), padding_tf_same() ? 0 : padding_left(),
           kernel_height(), kernel_width(),
@@ -844,10 +953,23 @@ class ConvolutionOperatorTester {
           groups(), group_input_channels(), group_output_channels(),
           input_channel_stride(), output_channel_stride(),
           input_zero_point, 1.0f /* input scale */, 1.0f /* kernel scale */,
-          kernel.data(), has_bias() ? bias.data() : nullptr,
+          packed_weights.data(), packed_weights.size(), fingerprint,
           output_zero_point, output_scale, int8_t(qmin() - 0x80), int8_t(qmax() - 0x80),
-          (depthwise_layout() ? XNN_FLAG_DEPTHWISE_CONVOLUTION : 0) | (padding_tf_same() ? XNN_FLAG_TENSORFLOW_SAME_PADDING : 0),
-          &convolution_op);
+          flags, &convolution_op);
+      } else {
+        status = xnn_create_convolution2d_nhwc_qs8(
+            padding_tf_same() ? 0 : padding_top(), padding_tf_same() ? 0 : padding_right(),
+            padding_tf_same() ? 0 : padding_bottom(), padding_tf_same() ? 0 : padding_left(),
+            kernel_height(), kernel_width(),
+            subsampling_height(), subsampling_width(),
+            dilation_height(), dilation_width(),
+            groups(), group_input_channels(), group_output_channels(),
+            input_channel_stride(), output_channel_stride(),
+            input_zero_point, 1.0f /* input scale */, 1.0f /* kernel scale */,
+            kernel.data(), has_bias() ? bias.data() : nullptr,
+            output_zero_point, output_scale, int8_t(qmin() - 0x80), int8_t(qmax() - 0x80),
+            flags, &convolution_op);
+      }
       if (status == xnn_status_unsupported_hardware) {
         GTEST_SKIP();
       }
@@ -1018,7 +1140,8 @@ class ConvolutionOperatorTester {
           kernel_zero_point, 1.0f /* kernel scale */,
           kernel.data(), has_bias() ? bias.data() : nullptr,
           output_zero_point, output_scale, qmin(), qmax(),
-          (depthwise_layout() ? XNN_FLAG_DEPTHWISE_CONVOLUTION : 0) | (padding_tf_same() ? XNN_FLAG_TENSORFLOW_SAME_PADDING : 0),
+          (depthwise_layout() ? XNN_FLAG_DEPTHWISE_CONVOLUTION : 0) | (padding_tf_same() ? XNN_FLAG_TENSORFLOW_SAME_PADDING : 0) |
+            (defer_packing() ? XNN_FLAG_DEFER_PACKING : 0),
           &convolution_op);
       if (status == xnn_status_unsupported_hardware) {
         GTEST_SKIP();
@@ -1075,11 +1198,13 @@ class ConvolutionOperatorTester {
     std::vector<float> bias(groups() * group_output_channels());
     std::vector<float> output(batch_size() * ((output_height() * output_width() - 1) * output_channel_stride() + groups() * group_output_channels()));
     std::vector<float> output_ref(batch_size() * output_height() * output_width() * groups() * group_output_channels());
+    std::vector<float> residual(output_ref.size() + XNN_EXTRA_BYTES / sizeof(float));
 
     for (size_t iteration = 0; iteration < iterations(); iteration++) {
       std::generate(input.begin(), input.end(), std::ref(f32rng));
       std::generate(kernel.begin(), kernel.end(), std::ref(f32rng));
       std::generate(bias.begin(), bias.end(), std::ref(f32rng));
+      std::generate(residual.begin(), residual.end(), std::ref(f32rng));
       std::fill(output.begin(), output.end(), nanf(""));
 
       // Compute reference results, without clamping.
@@ -1106,10 +1231,10 @@ class ConvolutionOperatorTester {
           for (size_t oy = 0; oy < output_height(); oy++) {
             for (size_t ox = 0; ox < output_width(); ox++) {
               for (size_t ky = 0; ky < kernel_height(); ky++) {
-                const size_t iy = oy * subsampling_height() + ky * dilation_height() - padding_top();
+                const size_t iy = PaddedInputIndex(oy * subsampling_height() + ky * dilation_height() - padding_top(), input_height());
                 if (iy < input_height()) {
                   for (size_t kx = 0; kx < kernel_width(); kx++) {
-                    const size_t ix = ox * subsampling_width() + kx * dilation_width() - padding_left();
+                    const size_t ix = PaddedInputIndex(ox * subsampling_width() + kx * dilation_width() - padding_left(), input_width());
                     if (ix < input_width()) {
                       for (size_t g = 0; g < groups(); g++) {
                         for (size_t oc = 0; oc < group_output_channels(); oc++) {
@@ -1130,10 +1255,10 @@ class ConvolutionOperatorTester {
           for (size_t oy = 0; oy < output_height(); oy++) {
             for (size_t ox = 0; ox < output_width(); ox++) {
               for (size_t ky = 0; ky < kernel_height(); ky++) {
-                const size_t iy = oy * subsampling_height() + ky * dilation_height() - padding_top();
+                const size_t iy = PaddedInputIndex(oy * subsampling_height() + ky * dilation_height() - padding_top(), input_height());
                 if (iy < input_height()) {
                   for (size_t kx = 0; kx < kernel_width(); kx++) {
-                    const size_t ix = ox * subsampling_width() + kx * dilation_width() - padding_left();
+                    const size_t ix = PaddedInputIndex(ox * subsampling_width() + kx * dilation_width() - padding_left(), input_width());
                     if (ix < input_width()) {
                       for (size_t g = 0; g < groups(); g++) {
                         for (size_t oc = 0; oc < group_output_channels(); oc++) {
@@ -1165,22 +1290,94 @@ class ConvolutionOperatorTester {
         value = std::max(std::min(value, output_max), output_min);
       }
 
+      // Add residual to reference results.
+      if (has_residual()) {
+        for (size_t i = 0; i < output_ref.size(); i++) {
+          output_ref[i] += residual[i];
+        }
+      }
+
       // Create, setup, run, and destroy Convolution operator.
       ASSERT_EQ(xnn_status_success, xnn_initialize(nullptr /* allocator */));
       xnn_operator_t convolution_op = nullptr;
 
-      xnn_status status = xnn_create_convolution2d_nhwc_f32(
+      const uint32_t flags =
+        (depthwise_layout() ? XNN_FLAG_DEPTHWISE_CONVOLUTION : 0) | (padding_tf_same() ? XNN_FLAG_TENSORFLOW_SAME_PADDING : 0) |
+        (autotune() ? XNN_FLAG_AUTOTUNE : 0) | (defer_packing() ? XNN_FLAG_DEFER_PACKING : 0) |
+        (compact_indirection() ? XNN_FLAG_COMPACT_INDIRECTION : 0) | padding_mode();
+      std::vector<uint8_t, AlignedAllocator<uint8_t, XNN_PACKED_WEIGHTS_ALIGNMENT>> packed_weights;
+      xnn_status status = xnn_status_success;
+      if (prepacked_weights()) {
+        size_t packed_weights_size = 0;
+        uint64_t fingerprint = 0;
+        status = xnn_pack_convolution2d_nhwc_f32_weights(
           padding_tf_same() ? 0 : padding_top(), padding_tf_same() ? 0 : padding_right(),
           padding_tf_same() ? 0 : padding_bottom(), padding_tf_same() ? 0 : padding_left(),
           kernel_height(), kernel_width(),
           subsampling_height(), subsampling_width(),
           dilation_height(), dilation_width(),
           groups(), group_input_channels(), group_output_channels(),
-          input_channel_stride(), output_channel_stride(),
           kernel.data(), has_bias() ? bias.data() : nullptr,
+          flags, nullptr /* packed weights */, &packed_weights_size, &fingerprint);
+        if (status == xnn_status_unsupported_hardware) {
+          GTEST_SKIP();
+        }
+        ASSERT_EQ(xnn_status_success, status);
+        packed_weights.resize(packed_weights_size);
+        uint64_t packed_fingerprint = 0;
+        ASSERT_EQ(xnn_status_success,
+          xnn_pack_convolution2d_nhwc_f32_weights(
+            padding_tf_same() ? 0 : padding_top(), padding_tf_same() ? 0 : padding_right(),
+            padding_tf_same() ? 0 : padding_bottom(), padding_tf_same() ? 0 : padding_left(),
+            kernel_height(), kernel_width(),
+            subsampling_height(), subsampling_width(),
+            dilation_height(), dilation_width(),
+            groups(), group_input_channels(), group_output_channels(),
+            kernel.data(), has_bias() ? bias.data() : nullptr,
+            flags, packed_weights.data(), &packed_weights_size, &packed_fingerprint));
+        ASSERT_EQ(fingerprint, packed_fingerprint);
+        ASSERT_EQ(packed_weights.size(), packed_weights_size);
+
+        ASSERT_EQ(xnn_status_unsupported_parameter,
+          xnn_create_convolution2d_nhwc_f32_with_packed_weights(
+            padding_tf_same() ? 0 : padding_top(), padding_tf_same() ? 0 : padding_right(),
+            padding_tf_same() ? 0 : padding_bottom(), padding_tf_same() ? 0 : padding_left(),
+            kernel_height(), kernel_width(),
+            subsampling_height(), subsampling_width(),
+            dilation_height(), dilation_width(),
+            groups(), group_input_channels(), group_output_channels(),
+            input_channel_stride(), output_channel_stride(),
+            packed_weights.data(), packed_weights.size(), fingerprint + 1,
+            output_min, output_max,
+            flags, &convolution_op));
+
+        // Clobber the original weights to check that the operator does not reference them.
+        std::fill(kernel.begin(), kernel.end(), std::nanf(""));
+        std::fill(bias.begin(), bias.end(), std::nanf(""));
+        status = xnn_create_convolution2d_nhwc_f32_with_packed_weights(
+          padding_tf_same() ? 0 : padding_top(), padding_tf_same() ? 0 : padding_right(),
+          padding_tf_same() ? 0 : padding_bottom(), padding_tf_same() ? 0 : padding_left(),
+          kernel_height(), kernel_width(),
+          subsampling_height(), subsampling_width(),
+          dilation_height(), dilation_width(),
+          groups(), group_input_channels(), group_output_channels(),
+          input_channel_stride(), output_channel_stride(),
+          packed_weights.data(), packed_weights.size(), fingerprint,
           output_min, output_max,
-          (depthwise_layout() ? XNN_FLAG_DEPTHWISE_CONVOLUTION : 0) | (padding_tf_same() ? XNN_FLAG_TENSORFLOW_SAME_PADDING : 0),
-          &convolution_op);
+          flags, &convolution_op);
+      } else {
+        status = xnn_create_convolution2d_nhwc_f32(
+            padding_tf_same() ? 0 : padding_top(), padding_tf_same() ? 0 : padding_right(),
+            padding_tf_same() ? 0 : padding_bottom(), padding_tf_same() ? 0 : padding_left(),
+            kernel_height(), kernel_width(),
+            subsampling_height(), subsampling_width(),
+            dilation_height(), dilation_width(),
+            groups(), group_input_channels(), group_output_channels(),
+            input_channel_stride(), output_channel_stride(),
+            kernel.data(), has_bias() ? bias.data() : nullptr,
+            output_min, output_max,
+            flags, &convolution_op);
+      }
       if (status == xnn_status_unsupported_hardware) {
         GTEST_SKIP();
       }
@@ -1190,6 +1387,15 @@ class ConvolutionOperatorTester {
       // Smart pointer to automatically delete convolution_op.
       std::unique_ptr<xnn_operator, decltype(&xnn_delete_operator)> auto_convolution_op(convolution_op, xnn_delete_operator);
 
+      if (has_residual()) {
+        ASSERT_EQ(xnn_status_success,
+          xnn_fuse_residual_add_f32(
+            convolution_op,
+            -std::numeric_limits<float>::infinity(), std::numeric_limits<float>::infinity()));
+        ASSERT_EQ(xnn_status_success,
+          xnn_setup_residual_add(convolution_op, residual.data(), groups() * group_output_channels()));
+      }
+
       ASSERT_EQ(xnn_status_success,
         xnn_setup_convolution2d_nhwc_f32(
           convolution_op,
@@ -1206,10 +1412,12 @@ class ConvolutionOperatorTester {
           for (size_t x = 0; x < output_width(); x++) {
             for (size_t g = 0; g < groups(); g++) {
               for (size_t c = 0; c < group_output_channels(); c++) {
-                ASSERT_GE(output[((i * output_height() + y) * output_width() + x) * output_channel_stride() + g * group_output_channels() + c], output_min)
-                  << "(x, y) = (" << x << ", " << y << "), group = " << g << ", channel = " << c;
-                ASSERT_LE(output[((i * output_height() + y) * output_width() + x) * output_channel_stride() + g * group_output_channels() + c], output_max)
-                  << "(x, y) = (" << x << ", " << y << "), group = " << g << ", channel = " << c;
+                if (!has_residual()) {
+                  ASSERT_GE(output[((i * output_height() + y) * output_width() + x) * output_channel_stride() + g * group_output_channels() + c], output_min)
+                    << "(x, y) = (" << x << ", " << y << "), group = " << g << ", channel = " << c;
+                  ASSERT_LE(output[((i * output_height() + y) * output_width() + x) * output_channel_stride() + g * group_output_channels() + c], output_max)
+                    << "(x, y) = (" << x << ", " << y << "), group = " << g << ", channel = " << c;
+                }
                 ASSERT_NEAR(
                     output_ref[(((i * output_height() + y) * output_width() + x) * groups() + g) * group_output_channels() + c],
                     output[((i * output_height() + y) * output_width() + x) * output_channel_stride() + g * group_output_channels() + c],
@@ -1361,6 +1569,9 @@ class ConvolutionOperatorTester {
       if (weights_type() == WeightsType::FP32) {
         flags |= XNN_FLAG_FP32_STATIC_WEIGHTS;
       }
+      if (defer_packing()) {
+        flags |= XNN_FLAG_DEFER_PACKING;
+      }
       xnn_status status = xnn_create_convolution2d_nhwc_f16(
           padding_tf_same() ? 0 : padding_top(), padding_tf_same() ? 0 : padding_right(),
           padding_tf_same() ? 0 : padding_bottom(), padding_tf_same() ? 0 : padding_left(),
@@ -2646,7 +2857,7 @@ class ConvolutionOperatorTester {
           input_channel_stride(), output_channel_stride(),
           kernel.data(), has_bias() ? bias.data() : nullptr,
           output_min, output_max,
-          0, &convolution_op);
+          compact_indirection() ? XNN_FLAG_COMPACT_INDIRECTION : 0, &convolution_op);
       if (status == xnn_status_unsupported_hardware) {
         GTEST_SKIP();
       }
@@ -2772,6 +2983,26 @@ class ConvolutionOperatorTester {
   }
 
  private:
+  // Index of the input row or column read for a padded row or column under padding_mode(), or the original index,
+  // which is out of bounds, for zero padding.
+  size_t PaddedInputIndex(size_t index, size_t size) const {
+    if (index < size) {
+      return index;
+    }
+    const ptrdiff_t signed_index = ptrdiff_t(index);
+    const ptrdiff_t signed_size = ptrdiff_t(size);
+    switch (padding_mode()) {
+      case XNN_FLAG_REFLECT_PADDING:
+        return size_t(signed_index < 0 ? -signed_index : 2 * signed_size - 2 - signed_index);
+      case XNN_FLAG_SYMMETRIC_PADDING:
+        return size_t(signed_index < 0 ? -signed_index - 1 : 2 * signed_size - 1 - signed_index);
+      case XNN_FLAG_EDGE_PADDING:
+        return size_t(signed_index < 0 ? 0 : signed_size - 1);
+      default:
+        return index;
+    }
+  }
+
   uint32_t padding_top_{0};
   uint32_t padding_right_{0};
   uint32_t padding_bottom_{0};
@@ -2799,7 +3030,13 @@ class ConvolutionOperatorTester {
   uint8_t qmax_{255};
   bool depthwise_layout_{false};
   bool force_nhwc_input_{false};
+  bool autotune_{false};
+  bool defer_packing_{false};
+  bool prepacked_weights_{false};
+  bool compact_indirection_{false};
+  uint32_t padding_mode_{0};
   bool has_bias_{true};
+  bool has_residual_{false};
   WeightsType weights_type_{WeightsType::Default};
   size_t iterations_{1};
 };
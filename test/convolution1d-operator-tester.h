@@ -0,0 +1,410 @@
+// Copyright 2022 Google LLC
+//
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree.
+
+#pragma once
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <cstddef>
+#include <cstdlib>
+#include <functional>
+#include <limits>
+#include <memory>
+#include <random>
+#include <vector>
+
+#include <xnnpack.h>
+
+
+class Convolution1DOperatorTester {
+ public:
+  inline Convolution1DOperatorTester& padding(uint32_t padding) {
+    this->padding_left_ = padding;
+    this->padding_right_ = padding;
+    return *this;
+  }
+
+  inline Convolution1DOperatorTester& padding_left(uint32_t padding_left) {
+    this->padding_left_ = padding_left;
+    return *this;
+  }
+
+  inline uint32_t padding_left() const {
+    return this->padding_left_;
+  }
+
+  inline Convolution1DOperatorTester& padding_right(uint32_t padding_right) {
+    this->padding_right_ = padding_right;
+    return *this;
+  }
+
+  inline uint32_t padding_right() const {
+    return this->padding_right_;
+  }
+
+  inline Convolution1DOperatorTester& input_width(size_t input_width) {
+    assert(input_width >= 1);
+    this->input_width_ = input_width;
+    return *this;
+  }
+
+  inline size_t input_width() const {
+    return this->input_width_;
+  }
+
+  inline Convolution1DOperatorTester& groups(uint32_t groups) {
+    assert(groups >= 1);
+    this->groups_ = groups;
+    return *this;
+  }
+
+  inline uint32_t groups() const {
+    return this->groups_;
+  }
+
+  inline Convolution1DOperatorTester& group_input_channels(size_t group_input_channels) {
+    assert(group_input_channels >= 1);
+    this->group_input_channels_ = group_input_channels;
+    return *this;
+  }
+
+  inline size_t group_input_channels() const {
+    return this->group_input_channels_;
+  }
+
+  inline Convolution1DOperatorTester& group_output_channels(size_t group_output_channels) {
+    assert(group_output_channels >= 1);
+    this->group_output_channels_ = group_output_channels;
+    return *this;
+  }
+
+  inline size_t group_output_channels() const {
+    return this->group_output_channels_;
+  }
+
+  inline Convolution1DOperatorTester& batch_size(size_t batch_size) {
+    assert(batch_size >= 1);
+    this->batch_size_ = batch_size;
+    return *this;
+  }
+
+  inline size_t batch_size() const {
+    return this->batch_size_;
+  }
+
+  inline Convolution1DOperatorTester& kernel_width(uint32_t kernel_width) {
+    assert(kernel_width >= 1);
+    this->kernel_width_ = kernel_width;
+    return *this;
+  }
+
+  inline uint32_t kernel_width() const {
+    return this->kernel_width_;
+  }
+
+  inline uint32_t dilated_kernel_width() const {
+    return (kernel_width() - 1) * dilation() + 1;
+  }
+
+  inline Convolution1DOperatorTester& subsampling(uint32_t subsampling) {
+    assert(subsampling >= 1);
+    this->subsampling_ = subsampling;
+    return *this;
+  }
+
+  inline uint32_t subsampling() const {
+    return this->subsampling_;
+  }
+
+  inline Convolution1DOperatorTester& dilation(uint32_t dilation) {
+    assert(dilation >= 1);
+    this->dilation_ = dilation;
+    return *this;
+  }
+
+  inline uint32_t dilation() const {
+    return this->dilation_;
+  }
+
+  inline Convolution1DOperatorTester& input_channel_stride(size_t input_channel_stride) {
+    assert(input_channel_stride >= 1);
+    this->input_channel_stride_ = input_channel_stride;
+    return *this;
+  }
+
+  inline size_t input_channel_stride() const {
+    if (this->input_channel_stride_ == 0) {
+      return group_input_channels() * groups();
+    } else {
+      assert(this->input_channel_stride_ >= group_input_channels() * groups());
+      return this->input_channel_stride_;
+    }
+  }
+
+  inline Convolution1DOperatorTester& output_channel_stride(size_t output_channel_stride) {
+    assert(output_channel_stride >= 1);
+    this->output_channel_stride_ = output_channel_stride;
+    return *this;
+  }
+
+  inline size_t output_channel_stride() const {
+    if (this->output_channel_stride_ == 0) {
+      return group_output_channels() * groups();
+    } else {
+      assert(this->output_channel_stride_ >= group_output_channels() * groups());
+      return this->output_channel_stride_;
+    }
+  }
+
+  inline size_t output_width() const {
+    const size_t padded_input_width = padding_left() + input_width() + padding_right();
+    if (padded_input_width < dilated_kernel_width()) {
+      return 0;
+    }
+    return (padded_input_width - dilated_kernel_width()) / subsampling() + 1;
+  }
+
+  inline Convolution1DOperatorTester& streaming(bool streaming) {
+    this->streaming_ = streaming;
+    return *this;
+  }
+
+  inline bool streaming() const {
+    return this->streaming_;
+  }
+
+  inline Convolution1DOperatorTester& max_chunk_width(size_t max_chunk_width) {
+    assert(max_chunk_width >= 1);
+    this->max_chunk_width_ = max_chunk_width;
+    return *this;
+  }
+
+  inline size_t max_chunk_width() const {
+    return this->max_chunk_width_;
+  }
+
+  inline Convolution1DOperatorTester& qmin(uint8_t qmin) {
+    this->qmin_ = qmin;
+    return *this;
+  }
+
+  inline uint8_t qmin() const {
+    return this->qmin_;
+  }
+
+  inline Convolution1DOperatorTester& qmax(uint8_t qmax) {
+    this->qmax_ = qmax;
+    return *this;
+  }
+
+  inline uint8_t qmax() const {
+    return this->qmax_;
+  }
+
+  inline Convolution1DOperatorTester& has_bias(bool has_bias) {
+    this->has_bias_ = has_bias;
+    return *this;
+  }
+
+  inline bool has_bias() const {
+    return this->has_bias_;
+  }
+
+  inline Convolution1DOperatorTester& iterations(size_t iterations) {
+    this->iterations_ = iterations;
+    return *this;
+  }
+
+  inline size_t iterations() const {
+    return this->iterations_;
+  }
+
+  void TestNWCxF32() const {
+    ASSERT_TRUE(!streaming() || padding_right() == 0);
+
+    std::random_device random_device;
+    auto rng = std::mt19937(random_device());
+    auto f32rng = std::bind(std::uniform_real_distribution<float>(0.1f, 1.0f), std::ref(rng));
+    auto chunkrng = std::bind(std::uniform_int_distribution<size_t>(1, max_chunk_width()), std::ref(rng));
+
+    std::vector<float> input(batch_size() * input_width() * input_channel_stride());
+    std::vector<float> kernel(groups() * group_output_channels() * kernel_width() * group_input_channels());
+    std::vector<float> bias(groups() * group_output_channels());
+    std::vector<float> output_ref(batch_size() * output_width() * groups() * group_output_channels());
+
+    for (size_t iteration = 0; iteration < iterations(); iteration++) {
+      std::generate(input.begin(), input.end(), std::ref(f32rng));
+      std::generate(kernel.begin(), kernel.end(), std::ref(f32rng));
+      std::generate(bias.begin(), bias.end(), std::ref(f32rng));
+
+      // Compute reference results, without clamping.
+      for (size_t i = 0; i < batch_size(); i++) {
+        for (size_t ox = 0; ox < output_width(); ox++) {
+          for (size_t g = 0; g < groups(); g++) {
+            for (size_t oc = 0; oc < group_output_channels(); oc++) {
+              float acc = has_bias() ? bias[g * group_output_channels() + oc] : 0.0f;
+              for (size_t kx = 0; kx < kernel_width(); kx++) {
+                const size_t ix = ox * subsampling() + kx * dilation() - padding_left();
+                if (ix < input_width()) {
+                  for (size_t ic = 0; ic < group_input_channels(); ic++) {
+                    acc +=
+                      input[(i * input_width() + ix) * input_channel_stride() + g * group_input_channels() + ic] *
+                      kernel[((g * group_output_channels() + oc) * kernel_width() + kx) * group_input_channels() + ic];
+                  }
+                }
+              }
+              output_ref[((i * output_width() + ox) * groups() + g) * group_output_channels() + oc] = acc;
+            }
+          }
+        }
+      }
+
+      // Compute clamping parameters.
+      float output_min = -std::numeric_limits<float>::infinity();
+      float output_max = std::numeric_limits<float>::infinity();
+      if (!output_ref.empty()) {
+        const float accumulated_min = *std::min_element(output_ref.cbegin(), output_ref.cend());
+        const float accumulated_max = *std::max_element(output_ref.cbegin(), output_ref.cend());
+        const float accumulated_range = accumulated_max - accumulated_min;
+        if (qmin() != 0) {
+          output_min = accumulated_min + accumulated_range / 255.0f * float(qmin());
+        }
+        if (qmax() != 255) {
+          output_max = accumulated_max - accumulated_range / 255.0f * float(255 - qmax());
+        }
+      }
+
+      // Clamp reference results.
+      for (float& value : output_ref) {
+        value = std::max(std::min(value, output_max), output_min);
+      }
+
+      // Create, setup, run, and destroy Convolution operator.
+      ASSERT_EQ(xnn_status_success, xnn_initialize(nullptr /* allocator */));
+      xnn_operator_t convolution_op = nullptr;
+
+      const xnn_status status = xnn_create_convolution1d_nwc_f32(
+        padding_left(), padding_right(),
+        kernel_width(), subsampling(), dilation(),
+        groups(), group_input_channels(), group_output_channels(),
+        input_channel_stride(), output_channel_stride(),
+        kernel.data(), has_bias() ? bias.data() : nullptr,
+        output_min, output_max,
+        streaming() ? XNN_FLAG_STREAMING : 0, &convolution_op);
+      if (status == xnn_status_unsupported_hardware) {
+        GTEST_SKIP();
+      }
+      ASSERT_EQ(xnn_status_success, status);
+      ASSERT_NE(nullptr, convolution_op);
+
+      // Smart pointer to automatically delete convolution_op.
+      std::unique_ptr<xnn_operator, decltype(&xnn_delete_operator)> auto_convolution_op(convolution_op, xnn_delete_operator);
+
+      // Streaming operators process every sequence twice, to check that reset restores the initial state.
+      const size_t num_passes = streaming() ? 2 : 1;
+      for (size_t pass = 0; pass < num_passes; pass++) {
+        std::vector<float> output(batch_size() * output_width() * output_channel_stride());
+        std::fill(output.begin(), output.end(), std::nanf(""));
+        if (streaming()) {
+          ASSERT_EQ(xnn_status_success, xnn_reset_convolution1d_nwc_f32(convolution_op));
+          size_t input_offset = 0;
+          size_t output_offset = 0;
+          while (input_offset < input_width()) {
+            const size_t chunk_width = std::min(chunkrng(), input_width() - input_offset);
+            std::vector<float> chunk(XNN_EXTRA_BYTES / sizeof(float) + batch_size() * chunk_width * input_channel_stride());
+            for (size_t i = 0; i < batch_size(); i++) {
+              std::copy_n(
+                input.cbegin() + (i * input_width() + input_offset) * input_channel_stride(),
+                chunk_width * input_channel_stride(),
+                chunk.begin() + i * chunk_width * input_channel_stride());
+            }
+            std::vector<float> chunk_output(
+              batch_size() * (padding_left() + dilated_kernel_width() + chunk_width) * output_channel_stride());
+
+            size_t chunk_output_width = SIZE_MAX;
+            ASSERT_EQ(xnn_status_success,
+              xnn_setup_convolution1d_nwc_f32(
+                convolution_op,
+                batch_size(), chunk_width,
+                chunk.data(), chunk_output.data(), &chunk_output_width,
+                nullptr /* thread pool */));
+            ASSERT_LE(output_offset + chunk_output_width, output_width());
+
+            ASSERT_EQ(xnn_status_success,
+              xnn_run_operator(convolution_op, nullptr /* thread pool */));
+
+            for (size_t i = 0; i < batch_size(); i++) {
+              std::copy_n(
+                chunk_output.cbegin() + i * chunk_output_width * output_channel_stride(),
+                chunk_output_width * output_channel_stride(),
+                output.begin() + (i * output_width() + output_offset) * output_channel_stride());
+            }
+            input_offset += chunk_width;
+            output_offset += chunk_output_width;
+          }
+          ASSERT_EQ(output_width(), output_offset);
+        } else {
+          std::vector<float> padded_input(input);
+          padded_input.resize(input.size() + XNN_EXTRA_BYTES / sizeof(float));
+          size_t actual_output_width = SIZE_MAX;
+          ASSERT_EQ(xnn_status_success,
+            xnn_setup_convolution1d_nwc_f32(
+              convolution_op,
+              batch_size(), input_width(),
+              padded_input.data(), output.data(), &actual_output_width,
+              nullptr /* thread pool */));
+          ASSERT_EQ(output_width(), actual_output_width);
+
+          ASSERT_EQ(xnn_status_success,
+            xnn_run_operator(convolution_op, nullptr /* thread pool */));
+        }
+
+        // Verify results.
+        for (size_t i = 0; i < batch_size(); i++) {
+          for (size_t x = 0; x < output_width(); x++) {
+            for (size_t g = 0; g < groups(); g++) {
+              for (size_t c = 0; c < group_output_channels(); c++) {
+                const float output_value =
+                  output[(i * output_width() + x) * output_channel_stride() + g * group_output_channels() + c];
+                const float output_ref_value =
+                  output_ref[((i * output_width() + x) * groups() + g) * group_output_channels() + c];
+                ASSERT_GE(output_value, output_min)
+                  << "batch index = " << i << ", x = " << x << ", group = " << g << ", channel = " << c;
+                ASSERT_LE(output_value, output_max)
+                  << "batch index = " << i << ", x = " << x << ", group = " << g << ", channel = " << c;
+                ASSERT_NEAR(output_ref_value, output_value, 1.0e-4 * std::abs(output_ref_value))
+                  << "batch index = " << i << ", x = " << x << ", group = " << g << ", channel = " << c
+                  << ", pass = " << pass;
+              }
+            }
+          }
+        }
+      }
+    }
+  }
+
+ private:
+  uint32_t padding_left_{0};
+  uint32_t padding_right_{0};
+  size_t input_width_{1};
+  uint32_t groups_{1};
+  size_t group_input_channels_{1};
+  size_t group_output_channels_{1};
+  size_t batch_size_{1};
+  uint32_t kernel_width_{1};
+  uint32_t subsampling_{1};
+  uint32_t dilation_{1};
+  size_t input_channel_stride_{0};
+  size_t output_channel_stride_{0};
+  bool streaming_{false};
+  size_t max_chunk_width_{4};
+  uint8_t qmin_{0};
+  uint8_t qmax_{255};
+  bool has_bias_{true};
+  size_t iterations_{3};
+};
@@ -0,0 +1,544 @@
+// Copyright 2022 Google LLC
+//
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree.
+
+#pragma once
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <functional>
+#include <limits>
+#include <random>
+#include <vector>
+
+#include <fp16.h>
+
+#include <xnnpack.h>
+#include <xnnpack/AlignedAllocator.h>
+#include <xnnpack/pack.h>
+#include <xnnpack/params-init.h>
+#include <xnnpack/params.h>
+#include <xnnpack/requantization.h>
+
+
+class DConvMicrokernelTester {
+ public:
+  inline DConvMicrokernelTester& nr(uint32_t nr) {
+    this->nr_ = nr;
+    return *this;
+  }
+
+  inline uint32_t nr() const {
+    return this->nr_;
+  }
+
+  inline uint32_t packed_output_channels() const {
+    return (output_channels() + nr() - 1) / nr() * nr();
+  }
+
+  inline DConvMicrokernelTester& kernel_size(uint32_t kernel_size) {
+    this->kernel_height_ = kernel_size;
+    this->kernel_width_ = kernel_size;
+    return *this;
+  }
+
+  inline DConvMicrokernelTester& kernel_height(uint32_t kernel_height) {
+    this->kernel_height_ = kernel_height;
+    return *this;
+  }
+
+  inline uint32_t kernel_height() const {
+    return this->kernel_height_;
+  }
+
+  inline DConvMicrokernelTester& kernel_width(uint32_t kernel_width) {
+    this->kernel_width_ = kernel_width;
+    return *this;
+  }
+
+  inline uint32_t kernel_width() const {
+    return this->kernel_width_;
+  }
+
+  inline DConvMicrokernelTester& subsampling(uint32_t subsampling) {
+    this->subsampling_ = subsampling;
+    return *this;
+  }
+
+  inline uint32_t subsampling() const {
+    return this->subsampling_;
+  }
+
+  inline DConvMicrokernelTester& padding_left(uint32_t padding_left) {
+    this->padding_left_ = padding_left;
+    return *this;
+  }
+
+  inline uint32_t padding_left() const {
+    return this->padding_left_;
+  }
+
+  inline DConvMicrokernelTester& padding_right(uint32_t padding_right) {
+    this->padding_right_ = padding_right;
+    return *this;
+  }
+
+  inline uint32_t padding_right() const {
+    return this->padding_right_;
+  }
+
+  // Number of leading kernel rows which point to the zero buffer.
+  inline DConvMicrokernelTester& padding_top(uint32_t padding_top) {
+    this->padding_top_ = padding_top;
+    return *this;
+  }
+
+  inline uint32_t padding_top() const {
+    return this->padding_top_;
+  }
+
+  inline DConvMicrokernelTester& input_channels(size_t input_channels) {
+    this->input_channels_ = input_channels;
+    return *this;
+  }
+
+  inline size_t input_channels() const {
+    return this->input_channels_;
+  }
+
+  inline DConvMicrokernelTester& input_pixel_stride(size_t input_pixel_stride) {
+    this->input_pixel_stride_ = input_pixel_stride;
+    return *this;
+  }
+
+  inline size_t input_pixel_stride() const {
+    if (this->input_pixel_stride_ == 0) {
+      return input_channels();
+    } else {
+      assert(this->input_pixel_stride_ >= input_channels());
+      return this->input_pixel_stride_;
+    }
+  }
+
+  inline DConvMicrokernelTester& input_width(size_t input_width) {
+    this->input_width_ = input_width;
+    return *this;
+  }
+
+  inline size_t input_width() const {
+    return this->input_width_;
+  }
+
+  inline DConvMicrokernelTester& input_offset(size_t input_offset) {
+    this->input_offset_ = input_offset;
+    return *this;
+  }
+
+  inline size_t input_offset() const {
+    return this->input_offset_;
+  }
+
+  inline DConvMicrokernelTester& output_channels(size_t output_channels) {
+    this->output_channels_ = output_channels;
+    return *this;
+  }
+
+  inline size_t output_channels() const {
+    return this->output_channels_;
+  }
+
+  inline DConvMicrokernelTester& output_pixel_stride(size_t output_pixel_stride) {
+    this->output_pixel_stride_ = output_pixel_stride;
+    return *this;
+  }
+
+  inline size_t output_pixel_stride() const {
+    if (this->output_pixel_stride_ == 0) {
+      return output_channels();
+    } else {
+      assert(this->output_pixel_stride_ >= output_channels());
+      return this->output_pixel_stride_;
+    }
+  }
+
+  inline size_t output_width() const {
+    const size_t padded_input_width = padding_left() + input_width() + padding_right();
+    if (padded_input_width <= kernel_width()) {
+      return 1;
+    } else {
+      return (padded_input_width - kernel_width()) / subsampling() + 1;
+    }
+  }
+
+  inline DConvMicrokernelTester& input_zero_point(int8_t input_zero_point) {
+    this->input_zero_point_ = input_zero_point;
+    return *this;
+  }
+
+  inline int8_t input_zero_point() const {
+    return this->input_zero_point_;
+  }
+
+  inline DConvMicrokernelTester& qmin(uint8_t qmin) {
+    this->qmin_ = qmin;
+    return *this;
+  }
+
+  inline uint8_t qmin() const {
+    return this->qmin_;
+  }
+
+  inline DConvMicrokernelTester& qmax(uint8_t qmax) {
+    this->qmax_ = qmax;
+    return *this;
+  }
+
+  inline uint8_t qmax() const {
+    return this->qmax_;
+  }
+
+  inline DConvMicrokernelTester& iterations(size_t iterations) {
+    this->iterations_ = iterations;
+    return *this;
+  }
+
+  inline size_t iterations() const {
+    return this->iterations_;
+  }
+
+  void Test(xnn_f32_dconv_minmax_ukernel_function dconv, xnn_init_f32_minmax_params_fn init_params) const {
+    ASSERT_LE(padding_top(), kernel_height());
+
+    std::random_device random_device;
+    auto rng = std::mt19937(random_device());
+    auto f32rng = std::bind(std::uniform_real_distribution<float>(0.1f, 1.0f), std::ref(rng));
+
+    std::vector<float> input(XNN_EXTRA_BYTES / sizeof(float) +
+      kernel_height() * input_width() * input_pixel_stride());
+    std::vector<float> zero(XNN_EXTRA_BYTES / sizeof(float) + input_channels());
+    std::vector<const float*> indirection(kernel_height());
+    std::vector<float> kernel(output_channels() * kernel_height() * kernel_width() * input_channels());
+    std::vector<float> bias(output_channels());
+    std::vector<float, AlignedAllocator<float, 64>> packed_weights(
+      packed_output_channels() * (1 + kernel_height() * kernel_width() * input_channels()));
+    std::vector<float> output((output_width() - 1) * output_pixel_stride() + output_channels());
+    std::vector<float> output_ref(output_width() * output_channels());
+
+    for (size_t iteration = 0; iteration < iterations(); iteration++) {
+      std::generate(input.begin(), input.end(), std::ref(f32rng));
+      std::generate(kernel.begin(), kernel.end(), std::ref(f32rng));
+      std::generate(bias.begin(), bias.end(), std::ref(f32rng));
+      std::fill(output.begin(), output.end(), nanf(""));
+      std::fill(packed_weights.begin(), packed_weights.end(), 0.0f);
+
+      xnn_pack_f32_conv_goki_w(
+        1, output_channels(), kernel_height() * kernel_width(), input_channels(),
+        nr(), 1 /* kr */, 1 /* sr */,
+        kernel.data(), bias.data(), packed_weights.data(), 0 /* extra bytes */, nullptr);
+
+      for (size_t ky = 0; ky < kernel_height(); ky++) {
+        indirection[ky] = ky < padding_top() ?
+          zero.data() : input.data() + ky * input_width() * input_pixel_stride() - input_offset();
+      }
+
+      // Compute reference results, without clamping.
+      for (size_t ox = 0; ox < output_width(); ox++) {
+        for (size_t oc = 0; oc < output_channels(); oc++) {
+          float acc = bias[oc];
+          for (size_t ky = padding_top(); ky < kernel_height(); ky++) {
+            for (size_t kx = 0; kx < kernel_width(); kx++) {
+              const size_t ix = ox * subsampling() + kx - padding_left();
+              if (ix < input_width()) {
+                for (size_t ic = 0; ic < input_channels(); ic++) {
+                  acc +=
+                    input[(ky * input_width() + ix) * input_pixel_stride() + ic] *
+                    kernel[((oc * kernel_height() + ky) * kernel_width() + kx) * input_channels() + ic];
+                }
+              }
+            }
+          }
+          output_ref[ox * output_channels() + oc] = acc;
+        }
+      }
+
+      // Compute clamping parameters.
+      const float accumulated_min = *std::min_element(output_ref.cbegin(), output_ref.cend());
+      const float accumulated_max = *std::max_element(output_ref.cbegin(), output_ref.cend());
+      const float output_min = accumulated_min + (accumulated_max - accumulated_min) / 255.0f * float(qmin());
+      const float output_max = accumulated_max - (accumulated_max - accumulated_min) / 255.0f * float(255 - qmax());
+
+      // Clamp reference results.
+      for (float& value : output_ref) {
+        value = std::max(std::min(value, output_max), output_min);
+      }
+
+      // Prepare parameters.
+      xnn_f32_minmax_params params;
+      init_params(&params, output_min, output_max);
+
+      // Call optimized micro-kernel.
+      dconv(
+        output_width(), output_channels(), kernel_height(), kernel_width(),
+        input_channels() * sizeof(float), input_width(), input_pixel_stride() * sizeof(float),
+        subsampling(), padding_left(),
+        indirection.data(), input_offset() * sizeof(float), zero.data(),
+        packed_weights.data(), output.data(), output_pixel_stride() * sizeof(float),
+        &params);
+
+      // Verify results.
+      for (size_t x = 0; x < output_width(); x++) {
+        for (size_t c = 0; c < output_channels(); c++) {
+          ASSERT_GE(output[x * output_pixel_stride() + c], output_min)
+            << "x = " << x << ", channel = " << c;
+          ASSERT_LE(output[x * output_pixel_stride() + c], output_max)
+            << "x = " << x << ", channel = " << c;
+          ASSERT_NEAR(
+              output_ref[x * output_channels() + c],
+              output[x * output_pixel_stride() + c],
+              1.0e-4 * std::abs(output_ref[x * output_channels() + c]))
+            << "x = " << x << ", channel = " << c;
+        }
+      }
+    }
+  }
+
+  void Test(xnn_f16_dconv_minmax_ukernel_function dconv, xnn_init_f16_minmax_params_fn init_params) const {
+    ASSERT_LE(padding_top(), kernel_height());
+
+    std::random_device random_device;
+    auto rng = std::mt19937(random_device());
+    auto f32rng = std::bind(std::uniform_real_distribution<float>(0.1f, 1.0f), std::ref(rng));
+    auto f16rng = std::bind(fp16_ieee_from_fp32_value, f32rng);
+
+    std::vector<uint16_t> input(XNN_EXTRA_BYTES / sizeof(uint16_t) +
+      kernel_height() * input_width() * input_pixel_stride());
+    std::vector<uint16_t> zero(XNN_EXTRA_BYTES / sizeof(uint16_t) + input_channels());
+    std::vector<const void*> indirection(kernel_height());
+    std::vector<uint16_t> kernel(output_channels() * kernel_height() * kernel_width() * input_channels());
+    std::vector<uint16_t> bias(output_channels());
+    std::vector<uint16_t, AlignedAllocator<uint16_t, 64>> packed_weights(
+      packed_output_channels() * (1 + kernel_height() * kernel_width() * input_channels()));
+    std::vector<uint16_t> output((output_width() - 1) * output_pixel_stride() + output_channels());
+    std::vector<float> output_ref(output_width() * output_channels());
+
+    for (size_t iteration = 0; iteration < iterations(); iteration++) {
+      std::generate(input.begin(), input.end(), std::ref(f16rng));
+      std::generate(kernel.begin(), kernel.end(), std::ref(f16rng));
+      std::generate(bias.begin(), bias.end(), std::ref(f16rng));
+      std::fill(output.begin(), output.end(), UINT16_C(0x7E00) /* NaN */);
+      std::fill(packed_weights.begin(), packed_weights.end(), 0);
+
+      xnn_pack_f16_conv_goki_w(
+        1, output_channels(), kernel_height() * kernel_width(), input_channels(),
+        nr(), 1 /* kr */, 1 /* sr */,
+        kernel.data(), bias.data(), packed_weights.data(), 0 /* extra bytes */, nullptr);
+
+      for (size_t ky = 0; ky < kernel_height(); ky++) {
+        indirection[ky] = ky < padding_top() ?
+          zero.data() : input.data() + ky * input_width() * input_pixel_stride() - input_offset();
+      }
+
+      // Compute reference results, without clamping.
+      for (size_t ox = 0; ox < output_width(); ox++) {
+        for (size_t oc = 0; oc < output_channels(); oc++) {
+          float acc = fp16_ieee_to_fp32_value(bias[oc]);
+          for (size_t ky = padding_top(); ky < kernel_height(); ky++) {
+            for (size_t kx = 0; kx < kernel_width(); kx++) {
+              const size_t ix = ox * subsampling() + kx - padding_left();
+              if (ix < input_width()) {
+                for (size_t ic = 0; ic < input_channels(); ic++) {
+                  acc +=
+                    fp16_ieee_to_fp32_value(input[(ky * input_width() + ix) * input_pixel_stride() + ic]) *
+                    fp16_ieee_to_fp32_value(kernel[((oc * kernel_height() + ky) * kernel_width() + kx) * input_channels() + ic]);
+                }
+              }
+            }
+          }
+          output_ref[ox * output_channels() + oc] = acc;
+        }
+      }
+
+      // Compute clamping parameters.
+      const float accumulated_min = *std::min_element(output_ref.cbegin(), output_ref.cend());
+      const float accumulated_max = *std::max_element(output_ref.cbegin(), output_ref.cend());
+      const float accumulated_range = accumulated_max - accumulated_min;
+      const float output_min = fp16_ieee_to_fp32_value(fp16_ieee_from_fp32_value(
+        accumulated_min + accumulated_range / 255.0f * float(qmin())));
+      const float output_max = fp16_ieee_to_fp32_value(fp16_ieee_from_fp32_value(
+        accumulated_max - accumulated_range / 255.0f * float(255 - qmax())));
+
+      // Clamp reference results.
+      for (float& value : output_ref) {
+        value = std::max(std::min(value, output_max), output_min);
+      }
+
+      // Prepare parameters.
+      xnn_f16_minmax_params params;
+      init_params(&params, fp16_ieee_from_fp32_value(output_min), fp16_ieee_from_fp32_value(output_max));
+
+      // Call optimized micro-kernel.
+      dconv(
+        output_width(), output_channels(), kernel_height(), kernel_width(),
+        input_channels() * sizeof(uint16_t), input_width(), input_pixel_stride() * sizeof(uint16_t),
+        subsampling(), padding_left(),
+        indirection.data(), input_offset() * sizeof(uint16_t), zero.data(),
+        packed_weights.data(), output.data(), output_pixel_stride() * sizeof(uint16_t),
+        &params);
+
+      // Verify results.
+      for (size_t x = 0; x < output_width(); x++) {
+        for (size_t c = 0; c < output_channels(); c++) {
+          ASSERT_GE(fp16_ieee_to_fp32_value(output[x * output_pixel_stride() + c]), output_min)
+            << "x = " << x << ", channel = " << c;
+          ASSERT_LE(fp16_ieee_to_fp32_value(output[x * output_pixel_stride() + c]), output_max)
+            << "x = " << x << ", channel = " << c;
+          ASSERT_NEAR(
+              output_ref[x * output_channels() + c],
+              fp16_ieee_to_fp32_value(output[x * output_pixel_stride() + c]),
+              std::max(1.0e-4f, std::abs(output_ref[x * output_channels() + c]) * 1.0e-2f))
+            << "x = " << x << ", channel = " << c;
+        }
+      }
+    }
+  }
+
+  void Test(
+    xnn_qs8_dconv_minmax_ukernel_function dconv,
+    xnn_init_qs8_conv_minmax_params_fn init_params,
+    xnn_qs8_requantize_fn requantize) const
+  {
+    ASSERT_LE(padding_top(), kernel_height());
+
+    std::random_device random_device;
+    auto rng = std::mt19937(random_device());
+    auto i32rng = std::bind(std::uniform_int_distribution<int32_t>(-10000, 10000), std::ref(rng));
+    auto i8rng = std::bind(
+      std::uniform_int_distribution<int32_t>(std::numeric_limits<int8_t>::min(), std::numeric_limits<int8_t>::max()),
+      std::ref(rng));
+    auto w8rng = std::bind(
+      std::uniform_int_distribution<int32_t>(-std::numeric_limits<int8_t>::max(), std::numeric_limits<int8_t>::max()),
+      std::ref(rng));
+
+    std::vector<int8_t> input(XNN_EXTRA_BYTES / sizeof(int8_t) +
+      kernel_height() * input_width() * input_pixel_stride());
+    std::vector<int8_t> zero(XNN_EXTRA_BYTES / sizeof(int8_t) + input_channels(), input_zero_point());
+    std::vector<const int8_t*> indirection(kernel_height());
+    std::vector<int8_t> kernel(output_channels() * kernel_height() * kernel_width() * input_channels());
+    std::vector<int32_t> bias(output_channels());
+    std::vector<int8_t, AlignedAllocator<int8_t, 64>> packed_weights(
+      packed_output_channels() * (sizeof(int32_t) + kernel_height() * kernel_width() * input_channels()));
+    std::vector<int8_t> output((output_width() - 1) * output_pixel_stride() + output_channels());
+    std::vector<int32_t> accumulators(output_width() * output_channels());
+    std::vector<int8_t> output_ref(output_width() * output_channels());
+
+    for (size_t iteration = 0; iteration < iterations(); iteration++) {
+      do {
+        std::generate(input.begin(), input.end(), std::ref(i8rng));
+      } while (input.size() > 1 && *std::max_element(input.cbegin(), input.cend()) == *std::min_element(input.cbegin(), input.cend()));
+      do {
+        std::generate(kernel.begin(), kernel.end(), std::ref(w8rng));
+      } while (kernel.size() > 1 && *std::max_element(kernel.cbegin(), kernel.cend()) == *std::min_element(kernel.cbegin(), kernel.cend()));
+      std::generate(bias.begin(), bias.end(), std::ref(i32rng));
+      std::fill(output.begin(), output.end(), INT8_C(0xA5));
+      std::fill(packed_weights.begin(), packed_weights.end(), 0);
+
+      const xnn_qs8_packing_params packing_params = { input_zero_point() };
+      xnn_pack_qs8_conv_goki_w(
+        1, output_channels(), kernel_height() * kernel_width(), input_channels(),
+        nr(), 1 /* kr */, 1 /* sr */,
+        kernel.data(), bias.data(), packed_weights.data(), 0 /* extra bytes */, &packing_params);
+
+      for (size_t ky = 0; ky < kernel_height(); ky++) {
+        indirection[ky] = ky < padding_top() ?
+          zero.data() : input.data() + ky * input_width() * input_pixel_stride() - input_offset();
+      }
+
+      // Compute 32-bit results and output quantization arguments.
+      for (size_t ox = 0; ox < output_width(); ox++) {
+        for (size_t oc = 0; oc < output_channels(); oc++) {
+          int32_t acc = bias[oc];
+          for (size_t ky = padding_top(); ky < kernel_height(); ky++) {
+            for (size_t kx = 0; kx < kernel_width(); kx++) {
+              const size_t ix = ox * subsampling() + kx - padding_left();
+              if (ix < input_width()) {
+                for (size_t ic = 0; ic < input_channels(); ic++) {
+                  acc +=
+                    (int32_t(input[(ky * input_width() + ix) * input_pixel_stride() + ic]) - int32_t(input_zero_point())) *
+                    int32_t(kernel[((oc * kernel_height() + ky) * kernel_width() + kx) * input_channels() + ic]);
+                }
+              }
+            }
+          }
+          accumulators[ox * output_channels() + oc] = acc;
+        }
+      }
+
+      const int32_t accumulated_min = *std::min_element(accumulators.cbegin(), accumulators.cend());
+      const int32_t accumulated_max = *std::max_element(accumulators.cbegin(), accumulators.cend());
+      const double output_scale = uint32_t(accumulated_max - accumulated_min) >= 256 ?
+        double(uint32_t(accumulated_max - accumulated_min)) / 255.0 : 1.00001;
+      const int8_t output_zero_point = int8_t(std::max(std::min(
+        lrint(-0.5 - 0.5 * double(accumulated_min + accumulated_max) / output_scale),
+        long(std::numeric_limits<int8_t>::max())), long(std::numeric_limits<int8_t>::min())));
+
+      const float requantization_scale = 1.0f / float(output_scale);
+      union xnn_qs8_conv_minmax_params quantization_params;
+      init_params(&quantization_params,
+        requantization_scale, output_zero_point, int8_t(qmin() - 0x80), int8_t(qmax() - 0x80));
+
+      // Call optimized micro-kernel.
+      dconv(
+        output_width(), output_channels(), kernel_height(), kernel_width(),
+        input_channels() * sizeof(int8_t), input_width(), input_pixel_stride() * sizeof(int8_t),
+        subsampling(), padding_left(),
+        indirection.data(), input_offset() * sizeof(int8_t), zero.data(),
+        packed_weights.data(), output.data(), output_pixel_stride() * sizeof(int8_t),
+        &quantization_params);
+
+      for (size_t i = 0; i < accumulators.size(); i++) {
+        output_ref[i] = requantize(
+          accumulators[i], requantization_scale, output_zero_point, int8_t(qmin() - 0x80), int8_t(qmax() - 0x80));
+      }
+
+      // Verify results.
+      for (size_t x = 0; x < output_width(); x++) {
+        for (size_t c = 0; c < output_channels(); c++) {
+          ASSERT_LE(int32_t(output[x * output_pixel_stride() + c]), int32_t(qmax()) - 0x80)
+            << "x = " << x << ", channel = " << c;
+          ASSERT_GE(int32_t(output[x * output_pixel_stride() + c]), int32_t(qmin()) - 0x80)
+            << "x = " << x << ", channel = " << c;
+          ASSERT_EQ(int32_t(output_ref[x * output_channels() + c]), int32_t(output[x * output_pixel_stride() + c]))
+            << "x = " << x << ", channel = " << c << ", accumulator = " << accumulators[x * output_channels() + c]
+            << ", requantization scale = " << requantization_scale
+            << ", output zero point = " << int32_t(output_zero_point);
+        }
+      }
+    }
+  }
+
+ private:
+  uint32_t nr_{1};
+  uint32_t kernel_height_{1};
+  uint32_t kernel_width_{1};
+  uint32_t subsampling_{1};
+  uint32_t padding_left_{0};
+  uint32_t padding_right_{0};
+  uint32_t padding_top_{0};
+  size_t input_channels_{1};
+  size_t input_pixel_stride_{0};
+  size_t input_width_{1};
+  size_t input_offset_{0};
+  size_t output_channels_{1};
+  size_t output_pixel_stride_{0};
+  int8_t input_zero_point_{-1};
+  uint8_t qmin_{0};
+  uint8_t qmax_{255};
+  size_t iterations_{3};
+};
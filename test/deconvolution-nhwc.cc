@@ -3919,6 +3919,236 @@ TEST(DECONVOLUTION_NHWC_QS8, 2x2s2_setup_changing_width) {
     .TestSetupQS8();
 }
 
+/**************************** DWCONV path ****************************/
+
+TEST(DECONVOLUTION_NHWC_QS8, depthwise_3x3) {
+  ASSERT_EQ(xnn_status_success, xnn_initialize(nullptr /* allocator */));
+  DeconvolutionOperatorTester()
+    .input_size(kUnstridedInputHeight, kUnstridedInputWidth)
+    .padding(1)
+    .kernel_size(3, 3)
+    .groups(24)
+    .group_input_channels(1)
+    .group_output_channels(1)
+    .iterations(3)
+    .TestQS8();
+}
+
+TEST(DECONVOLUTION_NHWC_QS8, depthwise_3x3_varying_padding) {
+  ASSERT_EQ(xnn_status_success, xnn_initialize(nullptr /* allocator */));
+  for (size_t padding = 0; padding <= 2; padding++) {
+    DeconvolutionOperatorTester()
+      .input_size(kUnstridedInputHeight, kUnstridedInputWidth)
+      .padding_top(padding)
+      .padding_right(2 - padding)
+      .padding_bottom(padding)
+      .padding_left(2 - padding)
+      .kernel_size(3, 3)
+      .groups(24)
+      .group_input_channels(1)
+      .group_output_channels(1)
+      .iterations(1)
+      .TestQS8();
+  }
+}
+
+TEST(DECONVOLUTION_NHWC_QS8, depthwise_3x3_with_dilation) {
+  ASSERT_EQ(xnn_status_success, xnn_initialize(nullptr /* allocator */));
+  for (size_t dilation = 2; dilation <= 3; dilation++) {
+    DeconvolutionOperatorTester()
+      .input_size(kUnstridedInputHeight, kUnstridedInputWidth)
+      .padding(1)
+      .kernel_size(3, 3)
+      .dilation_height(dilation)
+      .dilation_width(dilation + 1)
+      .groups(24)
+      .group_input_channels(1)
+      .group_output_channels(1)
+      .iterations(1)
+      .TestQS8();
+  }
+}
+
+TEST(DECONVOLUTION_NHWC_QS8, depthwise_3x3s2) {
+  ASSERT_EQ(xnn_status_success, xnn_initialize(nullptr /* allocator */));
+  DeconvolutionOperatorTester()
+    .input_size(kStridedInputHeight, kStridedInputWidth)
+    .padding(1)
+    .kernel_size(3, 3)
+    .stride(2)
+    .groups(24)
+    .group_input_channels(1)
+    .group_output_channels(1)
+    .iterations(3)
+    .TestQS8();
+}
+
+TEST(DECONVOLUTION_NHWC_QS8, depthwise_3x3s2_with_adjustment) {
+  ASSERT_EQ(xnn_status_success, xnn_initialize(nullptr /* allocator */));
+  for (size_t adjustment = 0; adjustment <= 1; adjustment++) {
+    DeconvolutionOperatorTester()
+      .input_size(kStridedInputHeight, kStridedInputWidth)
+      .padding(1)
+      .adjustment_height(adjustment)
+      .adjustment_width(1 - adjustment)
+      .kernel_size(3, 3)
+      .stride(2)
+      .groups(24)
+      .group_input_channels(1)
+      .group_output_channels(1)
+      .iterations(1)
+      .TestQS8();
+  }
+}
+
+TEST(DECONVOLUTION_NHWC_QS8, depthwise_3x3s3x2_with_dilation) {
+  ASSERT_EQ(xnn_status_success, xnn_initialize(nullptr /* allocator */));
+  DeconvolutionOperatorTester()
+    .input_size(kStridedInputHeight, kStridedInputWidth)
+    .padding(2)
+    .kernel_size(3, 3)
+    .stride_height(3)
+    .stride_width(2)
+    .dilation(2)
+    .groups(24)
+    .group_input_channels(1)
+    .group_output_channels(1)
+    .iterations(3)
+    .TestQS8();
+}
+
+TEST(DECONVOLUTION_NHWC_QS8, depthwise_3x3s2_with_input_stride) {
+  ASSERT_EQ(xnn_status_success, xnn_initialize(nullptr /* allocator */));
+  DeconvolutionOperatorTester()
+    .input_size(kStridedInputHeight, kStridedInputWidth)
+    .padding(1)
+    .kernel_size(3, 3)
+    .stride(2)
+    .groups(24)
+    .group_input_channels(1)
+    .group_output_channels(1)
+    .input_pixel_stride(29)
+    .iterations(3)
+    .TestQS8();
+}
+
+TEST(DECONVOLUTION_NHWC_QS8, depthwise_3x3s2_with_output_stride) {
+  ASSERT_EQ(xnn_status_success, xnn_initialize(nullptr /* allocator */));
+  DeconvolutionOperatorTester()
+    .input_size(kStridedInputHeight, kStridedInputWidth)
+    .padding(1)
+    .kernel_size(3, 3)
+    .stride(2)
+    .groups(24)
+    .group_input_channels(1)
+    .group_output_channels(1)
+    .output_pixel_stride(31)
+    .iterations(3)
+    .TestQS8();
+}
+
+TEST(DECONVOLUTION_NHWC_QS8, depthwise_3x3s2_with_qmin) {
+  ASSERT_EQ(xnn_status_success, xnn_initialize(nullptr /* allocator */));
+  DeconvolutionOperatorTester()
+    .input_size(kStridedInputHeight, kStridedInputWidth)
+    .padding(1)
+    .kernel_size(3, 3)
+    .stride(2)
+    .groups(24)
+    .group_input_channels(1)
+    .group_output_channels(1)
+    .qmin(128)
+    .iterations(3)
+    .TestQS8();
+}
+
+TEST(DECONVOLUTION_NHWC_QS8, depthwise_3x3s2_with_qmax) {
+  ASSERT_EQ(xnn_status_success, xnn_initialize(nullptr /* allocator */));
+  DeconvolutionOperatorTester()
+    .input_size(kStridedInputHeight, kStridedInputWidth)
+    .padding(1)
+    .kernel_size(3, 3)
+    .stride(2)
+    .groups(24)
+    .group_input_channels(1)
+    .group_output_channels(1)
+    .qmax(128)
+    .iterations(3)
+    .TestQS8();
+}
+
+TEST(DECONVOLUTION_NHWC_QS8, depthwise_3x3s2_without_bias) {
+  ASSERT_EQ(xnn_status_success, xnn_initialize(nullptr /* allocator */));
+  DeconvolutionOperatorTester()
+    .has_bias(false)
+    .input_size(kStridedInputHeight, kStridedInputWidth)
+    .padding(1)
+    .kernel_size(3, 3)
+    .stride(2)
+    .groups(24)
+    .group_input_channels(1)
+    .group_output_channels(1)
+    .iterations(3)
+    .TestQS8();
+}
+
+TEST(DECONVOLUTION_NHWC_QS8, depthwise_5x5s2) {
+  ASSERT_EQ(xnn_status_success, xnn_initialize(nullptr /* allocator */));
+  DeconvolutionOperatorTester()
+    .input_size(kStridedInputHeight, kStridedInputWidth)
+    .padding(2)
+    .kernel_size(5, 5)
+    .stride(2)
+    .groups(24)
+    .group_input_channels(1)
+    .group_output_channels(1)
+    .iterations(3)
+    .TestQS8();
+}
+
+TEST(DECONVOLUTION_NHWC_QS8, batched_depthwise_3x3s2) {
+  ASSERT_EQ(xnn_status_success, xnn_initialize(nullptr /* allocator */));
+  DeconvolutionOperatorTester()
+    .batch_size(2)
+    .input_size(kStridedInputHeight, kStridedInputWidth)
+    .padding(1)
+    .kernel_size(3, 3)
+    .stride(2)
+    .groups(24)
+    .group_input_channels(1)
+    .group_output_channels(1)
+    .iterations(3)
+    .TestQS8();
+}
+
+TEST(DECONVOLUTION_NHWC_QS8, depthwise_3x3s2_setup_changing_batch) {
+  ASSERT_EQ(xnn_status_success, xnn_initialize(nullptr /* allocator */));
+  DeconvolutionOperatorTester()
+    .batch_size(2)
+    .next_batch_size(5)
+    .input_size(kStridedInputHeight, kStridedInputWidth)
+    .kernel_size(3, 3)
+    .stride(2)
+    .groups(24)
+    .group_input_channels(1)
+    .group_output_channels(1)
+    .TestSetupQS8();
+}
+
+TEST(DECONVOLUTION_NHWC_QS8, depthwise_3x3s2_setup_changing_height) {
+  ASSERT_EQ(xnn_status_success, xnn_initialize(nullptr /* allocator */));
+  DeconvolutionOperatorTester()
+    .batch_size(2)
+    .input_size(kStridedInputHeight, kStridedInputWidth)
+    .next_input_height(kStridedInputHeight + 3)
+    .kernel_size(3, 3)
+    .stride(2)
+    .groups(24)
+    .group_input_channels(1)
+    .group_output_channels(1)
+    .TestSetupQS8();
+}
+
 /**************************** Future GEMM path ****************************/
 
 TEST(DECONVOLUTION_NHWC_QU8, 1x1) {
@@ -7822,6 +8052,236 @@ TEST(DECONVOLUTION_NHWC_QU8, 2x2s2_setup_changing_width) {
     .TestSetupQU8();
 }
 
+/**************************** DWCONV path ****************************/
+
+TEST(DECONVOLUTION_NHWC_QU8, depthwise_3x3) {
+  ASSERT_EQ(xnn_status_success, xnn_initialize(nullptr /* allocator */));
+  DeconvolutionOperatorTester()
+    .input_size(kUnstridedInputHeight, kUnstridedInputWidth)
+    .padding(1)
+    .kernel_size(3, 3)
+    .groups(24)
+    .group_input_channels(1)
+    .group_output_channels(1)
+    .iterations(3)
+    .TestQU8();
+}
+
+TEST(DECONVOLUTION_NHWC_QU8, depthwise_3x3_varying_padding) {
+  ASSERT_EQ(xnn_status_success, xnn_initialize(nullptr /* allocator */));
+  for (size_t padding = 0; padding <= 2; padding++) {
+    DeconvolutionOperatorTester()
+      .input_size(kUnstridedInputHeight, kUnstridedInputWidth)
+      .padding_top(padding)
+      .padding_right(2 - padding)
+      .padding_bottom(padding)
+      .padding_left(2 - padding)
+      .kernel_size(3, 3)
+      .groups(24)
+      .group_input_channels(1)
+      .group_output_channels(1)
+      .iterations(1)
+      .TestQU8();
+  }
+}
+
+TEST(DECONVOLUTION_NHWC_QU8, depthwise_3x3_with_dilation) {
+  ASSERT_EQ(xnn_status_success, xnn_initialize(nullptr /* allocator */));
+  for (size_t dilation = 2; dilation <= 3; dilation++) {
+    DeconvolutionOperatorTester()
+      .input_size(kUnstridedInputHeight, kUnstridedInputWidth)
+      .padding(1)
+      .kernel_size(3, 3)
+      .dilation_height(dilation)
+      .dilation_width(dilation + 1)
+      .groups(24)
+      .group_input_channels(1)
+      .group_output_channels(1)
+      .iterations(1)
+      .TestQU8();
+  }
+}
+
+TEST(DECONVOLUTION_NHWC_QU8, depthwise_3x3s2) {
+  ASSERT_EQ(xnn_status_success, xnn_initialize(nullptr /* allocator */));
+  DeconvolutionOperatorTester()
+    .input_size(kStridedInputHeight, kStridedInputWidth)
+    .padding(1)
+    .kernel_size(3, 3)
+    .stride(2)
+    .groups(24)
+    .group_input_channels(1)
+    .group_output_channels(1)
+    .iterations(3)
+    .TestQU8();
+}
+
+TEST(DECONVOLUTION_NHWC_QU8, depthwise_3x3s2_with_adjustment) {
+  ASSERT_EQ(xnn_status_success, xnn_initialize(nullptr /* allocator */));
+  for (size_t adjustment = 0; adjustment <= 1; adjustment++) {
+    DeconvolutionOperatorTester()
+      .input_size(kStridedInputHeight, kStridedInputWidth)
+      .padding(1)
+      .adjustment_height(adjustment)
+      .adjustment_width(1 - adjustment)
+      .kernel_size(3, 3)
+      .stride(2)
+      .groups(24)
+      .group_input_channels(1)
+      .group_output_channels(1)
+      .iterations(1)
+      .TestQU8();
+  }
+}
+
+TEST(DECONVOLUTION_NHWC_QU8, depthwise_3x3s3x2_with_dilation) {
+  ASSERT_EQ(xnn_status_success, xnn_initialize(nullptr /* allocator */));
+  DeconvolutionOperatorTester()
+    .input_size(kStridedInputHeight, kStridedInputWidth)
+    .padding(2)
+    .kernel_size(3, 3)
+    .stride_height(3)
+    .stride_width(2)
+    .dilation(2)
+    .groups(24)
+    .group_input_channels(1)
+    .group_output_channels(1)
+    .iterations(3)
+    .TestQU8();
+}
+
+TEST(DECONVOLUTION_NHWC_QU8, depthwise_3x3s2_with_input_stride) {
+  ASSERT_EQ(xnn_status_success, xnn_initialize(nullptr /* allocator */));
+  DeconvolutionOperatorTester()
+    .input_size(kStridedInputHeight, kStridedInputWidth)
+    .padding(1)
+    .kernel_size(3, 3)
+    .stride(2)
+    .groups(24)
+    .group_input_channels(1)
+    .group_output_channels(1)
+    .input_pixel_stride(29)
+    .iterations(3)
+    .TestQU8();
+}
+
+TEST(DECONVOLUTION_NHWC_QU8, depthwise_3x3s2_with_output_stride) {
+  ASSERT_EQ(xnn_status_success, xnn_initialize(nullptr /* allocator */));
+  DeconvolutionOperatorTester()
+    .input_size(kStridedInputHeight, kStridedInputWidth)
+    .padding(1)
+    .kernel_size(3, 3)
+    .stride(2)
+    .groups(24)
+    .group_input_channels(1)
+    .group_output_channels(1)
+    .output_pixel_stride(31)
+    .iterations(3)
+    .TestQU8();
+}
+
+TEST(DECONVOLUTION_NHWC_QU8, depthwise_3x3s2_with_qmin) {
+  ASSERT_EQ(xnn_status_success, xnn_initialize(nullptr /* allocator */));
+  DeconvolutionOperatorTester()
+    .input_size(kStridedInputHeight, kStridedInputWidth)
+    .padding(1)
+    .kernel_size(3, 3)
+    .stride(2)
+    .groups(24)
+    .group_input_channels(1)
+    .group_output_channels(1)
+    .qmin(128)
+    .iterations(3)
+    .TestQU8();
+}
+
+TEST(DECONVOLUTION_NHWC_QU8, depthwise_3x3s2_with_qmax) {
+  ASSERT_EQ(xnn_status_success, xnn_initialize(nullptr /* allocator */));
+  DeconvolutionOperatorTester()
+    .input_size(kStridedInputHeight, kStridedInputWidth)
+    .padding(1)
+    .kernel_size(3, 3)
+    .stride(2)
+    .groups(24)
+    .group_input_channels(1)
+    .group_output_channels(1)
+    .qmax(128)
+    .iterations(3)
+    .TestQU8();
+}
+
+TEST(DECONVOLUTION_NHWC_QU8, depthwise_3x3s2_without_bias) {
+  ASSERT_EQ(xnn_status_success, xnn_initialize(nullptr /* allocator */));
+  DeconvolutionOperatorTester()
+    .has_bias(false)
+    .input_size(kStridedInputHeight, kStridedInputWidth)
+    .padding(1)
+    .kernel_size(3, 3)
+    .stride(2)
+    .groups(24)
+    .group_input_channels(1)
+    .group_output_channels(1)
+    .iterations(3)
+    .TestQU8();
+}
+
+TEST(DECONVOLUTION_NHWC_QU8, depthwise_5x5s2) {
+  ASSERT_EQ(xnn_status_success, xnn_initialize(nullptr /* allocator */));
+  DeconvolutionOperatorTester()
+    .input_size(kStridedInputHeight, kStridedInputWidth)
+    .padding(2)
+    .kernel_size(5, 5)
+    .stride(2)
+    .groups(24)
+    .group_input_channels(1)
+    .group_output_channels(1)
+    .iterations(3)
+    .TestQU8();
+}
+
+TEST(DECONVOLUTION_NHWC_QU8, batched_depthwise_3x3s2) {
+  ASSERT_EQ(xnn_status_success, xnn_initialize(nullptr /* allocator */));
+  DeconvolutionOperatorTester()
+    .batch_size(2)
+    .input_size(kStridedInputHeight, kStridedInputWidth)
+    .padding(1)
+    .kernel_size(3, 3)
+    .stride(2)
+    .groups(24)
+    .group_input_channels(1)
+    .group_output_channels(1)
+    .iterations(3)
+    .TestQU8();
+}
+
+TEST(DECONVOLUTION_NHWC_QU8, depthwise_3x3s2_setup_changing_batch) {
+  ASSERT_EQ(xnn_status_success, xnn_initialize(nullptr /* allocator */));
+  DeconvolutionOperatorTester()
+    .batch_size(2)
+    .next_batch_size(5)
+    .input_size(kStridedInputHeight, kStridedInputWidth)
+    .kernel_size(3, 3)
+    .stride(2)
+    .groups(24)
+    .group_input_channels(1)
+    .group_output_channels(1)
+    .TestSetupQU8();
+}
+
+TEST(DECONVOLUTION_NHWC_QU8, depthwise_3x3s2_setup_changing_height) {
+  ASSERT_EQ(xnn_status_success, xnn_initialize(nullptr /* allocator */));
+  DeconvolutionOperatorTester()
+    .batch_size(2)
+    .input_size(kStridedInputHeight, kStridedInputWidth)
+    .next_input_height(kStridedInputHeight + 3)
+    .kernel_size(3, 3)
+    .stride(2)
+    .groups(24)
+    .group_input_channels(1)
+    .group_output_channels(1)
+    .TestSetupQU8();
+}
+
 /**************************** Future GEMM path ****************************/
 
 TEST(DECONVOLUTION_NHWC_F16, 1x1) {
@@ -11811,138 +12271,368 @@ TEST(DECONVOLUTION_NHWC_F16, batched_grouped_2x2s2_varying_input_channels) {
   }
 }
 
-TEST(DECONVOLUTION_NHWC_F16, batched_grouped_2x2s2_varying_output_channels) {
+TEST(DECONVOLUTION_NHWC_F16, batched_grouped_2x2s2_varying_output_channels) {
+  ASSERT_EQ(xnn_status_success, xnn_initialize(nullptr /* allocator */));
+  for (size_t output_channels = 1; output_channels <= xnn_params.f16.gemm.nr * 2; output_channels *= 2) {
+    DeconvolutionOperatorTester()
+      .batch_size(2)
+      .input_size(kStridedInputHeight, kStridedInputWidth)
+      .kernel_size(2, 2)
+      .stride(2)
+      .groups(2)
+      .group_input_channels(17)
+      .group_output_channels(output_channels)
+      .iterations(1)
+      .TestF16();
+  }
+}
+
+TEST(DECONVOLUTION_NHWC_F16, batched_grouped_2x2s2_with_input_stride) {
+  ASSERT_EQ(xnn_status_success, xnn_initialize(nullptr /* allocator */));
+  DeconvolutionOperatorTester()
+    .batch_size(2)
+    .input_size(kStridedInputHeight, kStridedInputWidth)
+    .kernel_size(2, 2)
+    .stride(2)
+    .groups(2)
+    .group_input_channels(17)
+    .group_output_channels(xnn_params.f16.gemm.nr * 2 + 3)
+    .input_pixel_stride(37)
+    .iterations(3)
+    .TestF16();
+}
+
+TEST(DECONVOLUTION_NHWC_F16, batched_grouped_2x2s2_with_output_stride) {
+  ASSERT_EQ(xnn_status_success, xnn_initialize(nullptr /* allocator */));
+  DeconvolutionOperatorTester()
+    .batch_size(2)
+    .input_size(kStridedInputHeight, kStridedInputWidth)
+    .kernel_size(2, 2)
+    .stride(2)
+    .groups(2)
+    .group_input_channels(17)
+    .group_output_channels(xnn_params.f16.gemm.nr + 3)
+    .output_pixel_stride(xnn_params.f16.gemm.nr * 2 + 13)
+    .iterations(3)
+    .TestF16();
+}
+
+TEST(DECONVOLUTION_NHWC_F16, batched_grouped_2x2s2_with_qmin) {
+  ASSERT_EQ(xnn_status_success, xnn_initialize(nullptr /* allocator */));
+  DeconvolutionOperatorTester()
+    .batch_size(2)
+    .input_size(kStridedInputHeight, kStridedInputWidth)
+    .kernel_size(2, 2)
+    .stride(2)
+    .groups(2)
+    .group_input_channels(17)
+    .group_output_channels(xnn_params.f16.gemm.nr * 2 + 3)
+    .qmin(128)
+    .iterations(3)
+    .TestF16();
+}
+
+TEST(DECONVOLUTION_NHWC_F16, batched_grouped_2x2s2_with_qmax) {
+  ASSERT_EQ(xnn_status_success, xnn_initialize(nullptr /* allocator */));
+  DeconvolutionOperatorTester()
+    .batch_size(2)
+    .input_size(kStridedInputHeight, kStridedInputWidth)
+    .kernel_size(2, 2)
+    .stride(2)
+    .groups(2)
+    .group_input_channels(17)
+    .group_output_channels(xnn_params.f16.gemm.nr * 2 + 3)
+    .qmax(128)
+    .iterations(3)
+    .TestF16();
+}
+
+TEST(DECONVOLUTION_NHWC_F16, batched_grouped_2x2s2_without_bias) {
+  ASSERT_EQ(xnn_status_success, xnn_initialize(nullptr /* allocator */));
+  DeconvolutionOperatorTester()
+    .has_bias(false)
+    .batch_size(2)
+    .input_size(kStridedInputHeight, kStridedInputWidth)
+    .kernel_size(2, 2)
+    .stride(2)
+    .groups(2)
+    .group_input_channels(17)
+    .group_output_channels(xnn_params.f16.gemm.nr * 2 + 3)
+    .iterations(3)
+    .TestF16();
+}
+
+// /**************************** SUBCONV2D/GEMM path, setup ****************************/
+
+TEST(DECONVOLUTION_NHWC_F16, 2x2s2_setup_changing_batch) {
+  ASSERT_EQ(xnn_status_success, xnn_initialize(nullptr /* allocator */));
+  DeconvolutionOperatorTester()
+    .batch_size(2)
+    .next_batch_size(5)
+    .input_size(kStridedInputHeight, kStridedInputWidth)
+    .kernel_size(2, 2)
+    .stride(2)
+    .groups(2)
+    .group_input_channels(15)
+    .group_output_channels(17)
+    .TestSetupF16();
+}
+
+TEST(DECONVOLUTION_NHWC_F16, 2x2s2_setup_changing_height) {
+  ASSERT_EQ(xnn_status_success, xnn_initialize(nullptr /* allocator */));
+  DeconvolutionOperatorTester()
+    .batch_size(2)
+    .input_size(kStridedInputHeight, kStridedInputWidth)
+    .next_input_height(kStridedInputHeight + 3)
+    .kernel_size(2, 2)
+    .stride(2)
+    .groups(2)
+    .group_input_channels(15)
+    .group_output_channels(17)
+    .TestSetupF16();
+}
+
+TEST(DECONVOLUTION_NHWC_F16, 2x2s2_setup_changing_width) {
+  ASSERT_EQ(xnn_status_success, xnn_initialize(nullptr /* allocator */));
+  DeconvolutionOperatorTester()
+    .batch_size(2)
+    .input_size(kStridedInputHeight, kStridedInputWidth)
+    .next_input_width(kStridedInputWidth + 3)
+    .kernel_size(2, 2)
+    .stride(2)
+    .groups(2)
+    .group_input_channels(15)
+    .group_output_channels(17)
+    .TestSetupF16();
+}
+
+/**************************** DWCONV path ****************************/
+
+TEST(DECONVOLUTION_NHWC_F16, depthwise_3x3) {
+  ASSERT_EQ(xnn_status_success, xnn_initialize(nullptr /* allocator */));
+  DeconvolutionOperatorTester()
+    .input_size(kUnstridedInputHeight, kUnstridedInputWidth)
+    .padding(1)
+    .kernel_size(3, 3)
+    .groups(24)
+    .group_input_channels(1)
+    .group_output_channels(1)
+    .iterations(3)
+    .TestF16();
+}
+
+TEST(DECONVOLUTION_NHWC_F16, depthwise_3x3_varying_padding) {
+  ASSERT_EQ(xnn_status_success, xnn_initialize(nullptr /* allocator */));
+  for (size_t padding = 0; padding <= 2; padding++) {
+    DeconvolutionOperatorTester()
+      .input_size(kUnstridedInputHeight, kUnstridedInputWidth)
+      .padding_top(padding)
+      .padding_right(2 - padding)
+      .padding_bottom(padding)
+      .padding_left(2 - padding)
+      .kernel_size(3, 3)
+      .groups(24)
+      .group_input_channels(1)
+      .group_output_channels(1)
+      .iterations(1)
+      .TestF16();
+  }
+}
+
+TEST(DECONVOLUTION_NHWC_F16, depthwise_3x3_with_dilation) {
+  ASSERT_EQ(xnn_status_success, xnn_initialize(nullptr /* allocator */));
+  for (size_t dilation = 2; dilation <= 3; dilation++) {
+    DeconvolutionOperatorTester()
+      .input_size(kUnstridedInputHeight, kUnstridedInputWidth)
+      .padding(1)
+      .kernel_size(3, 3)
+      .dilation_height(dilation)
+      .dilation_width(dilation + 1)
+      .groups(24)
+      .group_input_channels(1)
+      .group_output_channels(1)
+      .iterations(1)
+      .TestF16();
+  }
+}
+
+TEST(DECONVOLUTION_NHWC_F16, depthwise_3x3s2) {
   ASSERT_EQ(xnn_status_success, xnn_initialize(nullptr /* allocator */));
-  for (size_t output_channels = 1; output_channels <= xnn_params.f16.gemm.nr * 2; output_channels *= 2) {
+  DeconvolutionOperatorTester()
+    .input_size(kStridedInputHeight, kStridedInputWidth)
+    .padding(1)
+    .kernel_size(3, 3)
+    .stride(2)
+    .groups(24)
+    .group_input_channels(1)
+    .group_output_channels(1)
+    .iterations(3)
+    .TestF16();
+}
+
+TEST(DECONVOLUTION_NHWC_F16, depthwise_3x3s2_with_adjustment) {
+  ASSERT_EQ(xnn_status_success, xnn_initialize(nullptr /* allocator */));
+  for (size_t adjustment = 0; adjustment <= 1; adjustment++) {
     DeconvolutionOperatorTester()
-      .batch_size(2)
       .input_size(kStridedInputHeight, kStridedInputWidth)
-      .kernel_size(2, 2)
+      .padding(1)
+      .adjustment_height(adjustment)
+      .adjustment_width(1 - adjustment)
+      .kernel_size(3, 3)
       .stride(2)
-      .groups(2)
-      .group_input_channels(17)
-      .group_output_channels(output_channels)
+      .groups(24)
+      .group_input_channels(1)
+      .group_output_channels(1)
       .iterations(1)
       .TestF16();
   }
 }
 
-TEST(DECONVOLUTION_NHWC_F16, batched_grouped_2x2s2_with_input_stride) {
+TEST(DECONVOLUTION_NHWC_F16, depthwise_3x3s3x2_with_dilation) {
   ASSERT_EQ(xnn_status_success, xnn_initialize(nullptr /* allocator */));
   DeconvolutionOperatorTester()
-    .batch_size(2)
     .input_size(kStridedInputHeight, kStridedInputWidth)
-    .kernel_size(2, 2)
+    .padding(2)
+    .kernel_size(3, 3)
+    .stride_height(3)
+    .stride_width(2)
+    .dilation(2)
+    .groups(24)
+    .group_input_channels(1)
+    .group_output_channels(1)
+    .iterations(3)
+    .TestF16();
+}
+
+TEST(DECONVOLUTION_NHWC_F16, depthwise_3x3s2_with_input_stride) {
+  ASSERT_EQ(xnn_status_success, xnn_initialize(nullptr /* allocator */));
+  DeconvolutionOperatorTester()
+    .input_size(kStridedInputHeight, kStridedInputWidth)
+    .padding(1)
+    .kernel_size(3, 3)
     .stride(2)
-    .groups(2)
-    .group_input_channels(17)
-    .group_output_channels(xnn_params.f16.gemm.nr * 2 + 3)
-    .input_pixel_stride(37)
+    .groups(24)
+    .group_input_channels(1)
+    .group_output_channels(1)
+    .input_pixel_stride(29)
     .iterations(3)
     .TestF16();
 }
 
-TEST(DECONVOLUTION_NHWC_F16, batched_grouped_2x2s2_with_output_stride) {
+TEST(DECONVOLUTION_NHWC_F16, depthwise_3x3s2_with_output_stride) {
   ASSERT_EQ(xnn_status_success, xnn_initialize(nullptr /* allocator */));
   DeconvolutionOperatorTester()
-    .batch_size(2)
     .input_size(kStridedInputHeight, kStridedInputWidth)
-    .kernel_size(2, 2)
+    .padding(1)
+    .kernel_size(3, 3)
     .stride(2)
-    .groups(2)
-    .group_input_channels(17)
-    .group_output_channels(xnn_params.f16.gemm.nr + 3)
-    .output_pixel_stride(xnn_params.f16.gemm.nr * 2 + 13)
+    .groups(24)
+    .group_input_channels(1)
+    .group_output_channels(1)
+    .output_pixel_stride(31)
     .iterations(3)
     .TestF16();
 }
 
-TEST(DECONVOLUTION_NHWC_F16, batched_grouped_2x2s2_with_qmin) {
+TEST(DECONVOLUTION_NHWC_F16, depthwise_3x3s2_with_qmin) {
   ASSERT_EQ(xnn_status_success, xnn_initialize(nullptr /* allocator */));
   DeconvolutionOperatorTester()
-    .batch_size(2)
     .input_size(kStridedInputHeight, kStridedInputWidth)
-    .kernel_size(2, 2)
+    .padding(1)
+    .kernel_size(3, 3)
     .stride(2)
-    .groups(2)
-    .group_input_channels(17)
-    .group_output_channels(xnn_params.f16.gemm.nr * 2 + 3)
+    .groups(24)
+    .group_input_channels(1)
+    .group_output_channels(1)
     .qmin(128)
     .iterations(3)
     .TestF16();
 }
 
-TEST(DECONVOLUTION_NHWC_F16, batched_grouped_2x2s2_with_qmax) {
+TEST(DECONVOLUTION_NHWC_F16, depthwise_3x3s2_with_qmax) {
   ASSERT_EQ(xnn_status_success, xnn_initialize(nullptr /* allocator */));
   DeconvolutionOperatorTester()
-    .batch_size(2)
     .input_size(kStridedInputHeight, kStridedInputWidth)
-    .kernel_size(2, 2)
+    .padding(1)
+    .kernel_size(3, 3)
     .stride(2)
-    .groups(2)
-    .group_input_channels(17)
-    .group_output_channels(xnn_params.f16.gemm.nr * 2 + 3)
+    .groups(24)
+    .group_input_channels(1)
+    .group_output_channels(1)
     .qmax(128)
     .iterations(3)
     .TestF16();
 }
 
-TEST(DECONVOLUTION_NHWC_F16, batched_grouped_2x2s2_without_bias) {
+TEST(DECONVOLUTION_NHWC_F16, depthwise_3x3s2_without_bias) {
   ASSERT_EQ(xnn_status_success, xnn_initialize(nullptr /* allocator */));
   DeconvolutionOperatorTester()
     .has_bias(false)
-    .batch_size(2)
     .input_size(kStridedInputHeight, kStridedInputWidth)
-    .kernel_size(2, 2)
+    .padding(1)
+    .kernel_size(3, 3)
     .stride(2)
-    .groups(2)
-    .group_input_channels(17)
-    .group_output_channels(xnn_params.f16.gemm.nr * 2 + 3)
+    .groups(24)
+    .group_input_channels(1)
+    .group_output_channels(1)
     .iterations(3)
     .TestF16();
 }
 
-// /**************************** SUBCONV2D/GEMM path, setup ****************************/
+TEST(DECONVOLUTION_NHWC_F16, depthwise_5x5s2) {
+  ASSERT_EQ(xnn_status_success, xnn_initialize(nullptr /* allocator */));
+  DeconvolutionOperatorTester()
+    .input_size(kStridedInputHeight, kStridedInputWidth)
+    .padding(2)
+    .kernel_size(5, 5)
+    .stride(2)
+    .groups(24)
+    .group_input_channels(1)
+    .group_output_channels(1)
+    .iterations(3)
+    .TestF16();
+}
 
-TEST(DECONVOLUTION_NHWC_F16, 2x2s2_setup_changing_batch) {
+TEST(DECONVOLUTION_NHWC_F16, batched_depthwise_3x3s2) {
   ASSERT_EQ(xnn_status_success, xnn_initialize(nullptr /* allocator */));
   DeconvolutionOperatorTester()
     .batch_size(2)
-    .next_batch_size(5)
     .input_size(kStridedInputHeight, kStridedInputWidth)
-    .kernel_size(2, 2)
+    .padding(1)
+    .kernel_size(3, 3)
     .stride(2)
-    .groups(2)
-    .group_input_channels(15)
-    .group_output_channels(17)
-    .TestSetupF16();
+    .groups(24)
+    .group_input_channels(1)
+    .group_output_channels(1)
+    .iterations(3)
+    .TestF16();
 }
 
-TEST(DECONVOLUTION_NHWC_F16, 2x2s2_setup_changing_height) {
+TEST(DECONVOLUTION_NHWC_F16, depthwise_3x3s2_setup_changing_batch) {
   ASSERT_EQ(xnn_status_success, xnn_initialize(nullptr /* allocator */));
   DeconvolutionOperatorTester()
     .batch_size(2)
+    .next_batch_size(5)
     .input_size(kStridedInputHeight, kStridedInputWidth)
-    .next_input_height(kStridedInputHeight + 3)
-    .kernel_size(2, 2)
+    .kernel_size(3, 3)
     .stride(2)
-    .groups(2)
-    .group_input_channels(15)
-    .group_output_channels(17)
+    .groups(24)
+    .group_input_channels(1)
+    .group_output_channels(1)
     .TestSetupF16();
 }
 
-TEST(DECONVOLUTION_NHWC_F16, 2x2s2_setup_changing_width) {
+TEST(DECONVOLUTION_NHWC_F16, depthwise_3x3s2_setup_changing_height) {
   ASSERT_EQ(xnn_status_success, xnn_initialize(nullptr /* allocator */));
   DeconvolutionOperatorTester()
     .batch_size(2)
     .input_size(kStridedInputHeight, kStridedInputWidth)
-    .next_input_width(kStridedInputWidth + 3)
-    .kernel_size(2, 2)
+    .next_input_height(kStridedInputHeight + 3)
+    .kernel_size(3, 3)
     .stride(2)
-    .groups(2)
-    .group_input_channels(15)
-    .group_output_channels(17)
+    .groups(24)
+    .group_input_channels(1)
+    .group_output_channels(1)
     .TestSetupF16();
 }
 
@@ -15845,3 +16535,233 @@ TEST(DECONVOLUTION_NHWC_F32, 2x2s2_setup_changing_width) {
     .group_output_channels(17)
     .TestSetupF32();
 }
+
+/**************************** DWCONV path ****************************/
+
+TEST(DECONVOLUTION_NHWC_F32, depthwise_3x3) {
+  ASSERT_EQ(xnn_status_success, xnn_initialize(nullptr /* allocator */));
+  DeconvolutionOperatorTester()
+    .input_size(kUnstridedInputHeight, kUnstridedInputWidth)
+    .padding(1)
+    .kernel_size(3, 3)
+    .groups(24)
+    .group_input_channels(1)
+    .group_output_channels(1)
+    .iterations(3)
+    .TestF32();
+}
+
+TEST(DECONVOLUTION_NHWC_F32, depthwise_3x3_varying_padding) {
+  ASSERT_EQ(xnn_status_success, xnn_initialize(nullptr /* allocator */));
+  for (size_t padding = 0; padding <= 2; padding++) {
+    DeconvolutionOperatorTester()
+      .input_size(kUnstridedInputHeight, kUnstridedInputWidth)
+      .padding_top(padding)
+      .padding_right(2 - padding)
+      .padding_bottom(padding)
+      .padding_left(2 - padding)
+      .kernel_size(3, 3)
+      .groups(24)
+      .group_input_channels(1)
+      .group_output_channels(1)
+      .iterations(1)
+      .TestF32();
+  }
+}
+
+TEST(DECONVOLUTION_NHWC_F32, depthwise_3x3_with_dilation) {
+  ASSERT_EQ(xnn_status_success, xnn_initialize(nullptr /* allocator */));
+  for (size_t dilation = 2; dilation <= 3; dilation++) {
+    DeconvolutionOperatorTester()
+      .input_size(kUnstridedInputHeight, kUnstridedInputWidth)
+      .padding(1)
+      .kernel_size(3, 3)
+      .dilation_height(dilation)
+      .dilation_width(dilation + 1)
+      .groups(24)
+      .group_input_channels(1)
+      .group_output_channels(1)
+      .iterations(1)
+      .TestF32();
+  }
+}
+
+TEST(DECONVOLUTION_NHWC_F32, depthwise_3x3s2) {
+  ASSERT_EQ(xnn_status_success, xnn_initialize(nullptr /* allocator */));
+  DeconvolutionOperatorTester()
+    .input_size(kStridedInputHeight, kStridedInputWidth)
+    .padding(1)
+    .kernel_size(3, 3)
+    .stride(2)
+    .groups(24)
+    .group_input_channels(1)
+    .group_output_channels(1)
+    .iterations(3)
+    .TestF32();
+}
+
+TEST(DECONVOLUTION_NHWC_F32, depthwise_3x3s2_with_adjustment) {
+  ASSERT_EQ(xnn_status_success, xnn_initialize(nullptr /* allocator */));
+  for (size_t adjustment = 0; adjustment <= 1; adjustment++) {
+    DeconvolutionOperatorTester()
+      .input_size(kStridedInputHeight, kStridedInputWidth)
+      .padding(1)
+      .adjustment_height(adjustment)
+      .adjustment_width(1 - adjustment)
+      .kernel_size(3, 3)
+      .stride(2)
+      .groups(24)
+      .group_input_channels(1)
+      .group_output_channels(1)
+      .iterations(1)
+      .TestF32();
+  }
+}
+
+TEST(DECONVOLUTION_NHWC_F32, depthwise_3x3s3x2_with_dilation) {
+  ASSERT_EQ(xnn_status_success, xnn_initialize(nullptr /* allocator */));
+  DeconvolutionOperatorTester()
+    .input_size(kStridedInputHeight, kStridedInputWidth)
+    .padding(2)
+    .kernel_size(3, 3)
+    .stride_height(3)
+    .stride_width(2)
+    .dilation(2)
+    .groups(24)
+    .group_input_channels(1)
+    .group_output_channels(1)
+    .iterations(3)
+    .TestF32();
+}
+
+TEST(DECONVOLUTION_NHWC_F32, depthwise_3x3s2_with_input_stride) {
+  ASSERT_EQ(xnn_status_success, xnn_initialize(nullptr /* allocator */));
+  DeconvolutionOperatorTester()
+    .input_size(kStridedInputHeight, kStridedInputWidth)
+    .padding(1)
+    .kernel_size(3, 3)
+    .stride(2)
+    .groups(24)
+    .group_input_channels(1)
+    .group_output_channels(1)
+    .input_pixel_stride(29)
+    .iterations(3)
+    .TestF32();
+}
+
+TEST(DECONVOLUTION_NHWC_F32, depthwise_3x3s2_with_output_stride) {
+  ASSERT_EQ(xnn_status_success, xnn_initialize(nullptr /* allocator */));
+  DeconvolutionOperatorTester()
+    .input_size(kStridedInputHeight, kStridedInputWidth)
+    .padding(1)
+    .kernel_size(3, 3)
+    .stride(2)
+    .groups(24)
+    .group_input_channels(1)
+    .group_output_channels(1)
+    .output_pixel_stride(31)
+    .iterations(3)
+    .TestF32();
+}
+
+TEST(DECONVOLUTION_NHWC_F32, depthwise_3x3s2_with_qmin) {
+  ASSERT_EQ(xnn_status_success, xnn_initialize(nullptr /* allocator */));
+  DeconvolutionOperatorTester()
+    .input_size(kStridedInputHeight, kStridedInputWidth)
+    .padding(1)
+    .kernel_size(3, 3)
+    .stride(2)
+    .groups(24)
+    .group_input_channels(1)
+    .group_output_channels(1)
+    .qmin(128)
+    .iterations(3)
+    .TestF32();
+}
+
+TEST(DECONVOLUTION_NHWC_F32, depthwise_3x3s2_with_qmax) {
+  ASSERT_EQ(xnn_status_success, xnn_initialize(nullptr /* allocator */));
+  DeconvolutionOperatorTester()
+    .input_size(kStridedInputHeight, kStridedInputWidth)
+    .padding(1)
+    .kernel_size(3, 3)
+    .stride(2)
+    .groups(24)
+    .group_input_channels(1)
+    .group_output_channels(1)
+    .qmax(128)
+    .iterations(3)
+    .TestF32();
+}
+
+TEST(DECONVOLUTION_NHWC_F32, depthwise_3x3s2_without_bias) {
+  ASSERT_EQ(xnn_status_success, xnn_initialize(nullptr /* allocator */));
+  DeconvolutionOperatorTester()
+    .has_bias(false)
+    .input_size(kStridedInputHeight, kStridedInputWidth)
+    .padding(1)
+    .kernel_size(3, 3)
+    .stride(2)
+    .groups(24)
+    .group_input_channels(1)
+    .group_output_channels(1)
+    .iterations(3)
+    .TestF32();
+}
+
+TEST(DECONVOLUTION_NHWC_F32, depthwise_5x5s2) {
+  ASSERT_EQ(xnn_status_success, xnn_initialize(nullptr /* allocator */));
+  DeconvolutionOperatorTester()
+    .input_size(kStridedInputHeight, kStridedInputWidth)
+    .padding(2)
+    .kernel_size(5, 5)
+    .stride(2)
+    .groups(24)
+    .group_input_channels(1)
+    .group_output_channels(1)
+    .iterations(3)
+    .TestF32();
+}
+
+TEST(DECONVOLUTION_NHWC_F32, batched_depthwise_3x3s2) {
+  ASSERT_EQ(xnn_status_success, xnn_initialize(nullptr /* allocator */));
+  DeconvolutionOperatorTester()
+    .batch_size(2)
+    .input_size(kStridedInputHeight, kStridedInputWidth)
+    .padding(1)
+    .kernel_size(3, 3)
+    .stride(2)
+    .groups(24)
+    .group_input_channels(1)
+    .group_output_channels(1)
+    .iterations(3)
+    .TestF32();
+}
+
+TEST(DECONVOLUTION_NHWC_F32, depthwise_3x3s2_setup_changing_batch) {
+  ASSERT_EQ(xnn_status_success, xnn_initialize(nullptr /* allocator */));
+  DeconvolutionOperatorTester()
+    .batch_size(2)
+    .next_batch_size(5)
+    .input_size(kStridedInputHeight, kStridedInputWidth)
+    .kernel_size(3, 3)
+    .stride(2)
+    .groups(24)
+    .group_input_channels(1)
+    .group_output_channels(1)
+    .TestSetupF32();
+}
+
+TEST(DECONVOLUTION_NHWC_F32, depthwise_3x3s2_setup_changing_height) {
+  ASSERT_EQ(xnn_status_success, xnn_initialize(nullptr /* allocator */));
+  DeconvolutionOperatorTester()
+    .batch_size(2)
+    .input_size(kStridedInputHeight, kStridedInputWidth)
+    .next_input_height(kStridedInputHeight + 3)
+    .kernel_size(3, 3)
+    .stride(2)
+    .groups(24)
+    .group_input_channels(1)
+    .group_output_channels(1)
+    .TestSetupF32();
+}
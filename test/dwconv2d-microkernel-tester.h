@@ -100,6 +100,53 @@ class DWConv2DMicrokernelTester {
     return this->subsampling_;
   }
 
+  inline DWConv2DMicrokernelTester& subsampling_height(uint32_t subsampling_height) {
+    assert(subsampling_height >= 1);
+    this->subsampling_height_ = subsampling_height;
+    return *this;
+  }
+
+  inline uint32_t subsampling_height() const {
+    return this->subsampling_height_ == 0 ? subsampling() : this->subsampling_height_;
+  }
+
+  inline DWConv2DMicrokernelTester& subsampling_width(uint32_t subsampling_width) {
+    assert(subsampling_width >= 1);
+    this->subsampling_width_ = subsampling_width;
+    return *this;
+  }
+
+  inline uint32_t subsampling_width() const {
+    return this->subsampling_width_ == 0 ? subsampling() : this->subsampling_width_;
+  }
+
+  inline DWConv2DMicrokernelTester& dilation(uint32_t dilation) {
+    assert(dilation >= 1);
+    this->dilation_height_ = dilation;
+    this->dilation_width_ = dilation;
+    return *this;
+  }
+
+  inline DWConv2DMicrokernelTester& dilation_height(uint32_t dilation_height) {
+    assert(dilation_height >= 1);
+    this->dilation_height_ = dilation_height;
+    return *this;
+  }
+
+  inline uint32_t dilation_height() const {
+    return this->dilation_height_;
+  }
+
+  inline DWConv2DMicrokernelTester& dilation_width(uint32_t dilation_width) {
+    assert(dilation_width >= 1);
+    this->dilation_width_ = dilation_width;
+    return *this;
+  }
+
+  inline uint32_t dilation_width() const {
+    return this->dilation_width_;
+  }
+
   inline DWConv2DMicrokernelTester& kernel_height(uint32_t kernel_height) {
     assert(kernel_height != 0);
     this->kernel_height_ = kernel_height;
@@ -124,21 +171,29 @@ class DWConv2DMicrokernelTester {
     return kernel_height() * kernel_width();
   }
 
+  inline uint32_t dilated_kernel_height() const {
+    return (kernel_height() - 1) * dilation_height() + 1;
+  }
+
+  inline uint32_t dilated_kernel_width() const {
+    return (kernel_width() - 1) * dilation_width() + 1;
+  }
+
   inline uint32_t output_height() const {
     const uint32_t padded_input_height = padding_top() + input_height() + padding_bottom();
-    if (padded_input_height <= kernel_height()) {
+    if (padded_input_height <= dilated_kernel_height()) {
       return 1;
     } else {
-      return (padded_input_height - kernel_height()) / subsampling() + 1;
+      return (padded_input_height - dilated_kernel_height()) / subsampling_height() + 1;
     }
   }
 
   inline uint32_t output_width() const {
     const uint32_t padded_input_width = padding_left() + input_width() + padding_right();
-    if (padded_input_width <= kernel_width()) {
+    if (padded_input_width <= dilated_kernel_width()) {
       return 1;
     } else {
-      return (padded_input_width - kernel_width()) / subsampling() + 1;
+      return (padded_input_width - dilated_kernel_width()) / subsampling_width() + 1;
     }
   }
 
@@ -246,6 +301,79 @@ class DWConv2DMicrokernelTester {
     }
   }
 
+  void Test(xnn_f32_dwconv2d_chw_dilated_ukernel_function dwconv, xnn_init_f32_minmax_params_fn init_params) const {
+    std::random_device random_device;
+    auto rng = std::mt19937(random_device());
+    auto f32rng = std::bind(std::uniform_real_distribution<float>(0.0f, 1.0f), rng);
+
+    std::vector<float, AlignedAllocator<float, 64>> input(input_height() * input_width() + XNN_EXTRA_BYTES / sizeof(float));
+    std::vector<float> packed_weights(kernel_size() + 1);
+    std::vector<float, AlignedAllocator<float, 64>> output(output_height() * output_width());
+    std::vector<float> output_ref(output_height() * output_width());
+
+    for (size_t iteration = 0; iteration < iterations(); iteration++) {
+      std::generate(input.begin(), input.end(), std::ref(f32rng));
+      std::generate(packed_weights.begin(), packed_weights.end(), std::ref(f32rng));
+      std::fill(output.begin(), output.end(), nanf(""));
+
+      for (size_t oy = 0; oy < output_height(); oy++) {
+        for (size_t ox = 0; ox < output_width(); ox++) {
+          float acc = packed_weights[0];
+          for (size_t ky = 0; ky < kernel_height(); ky++) {
+            const size_t iy = oy * subsampling_height() + ky * dilation_height() - padding_top();
+            for (size_t kx = 0; kx < kernel_width(); kx++) {
+              const size_t ix = ox * subsampling_width() + kx * dilation_width() - padding_left();
+              if (ix < input_width() && iy < input_height()) {
+                const float input_val = input[iy * input_width() + ix];
+                const float kernel_val = packed_weights[1 + ky * kernel_width() + kx];
+                acc += input_val * kernel_val;
+              }
+            }
+          }
+          output_ref[oy * output_width() + ox] = acc;
+        }
+      }
+
+      // Compute clamping parameters.
+      const float accumulated_min = *std::min_element(output_ref.cbegin(), output_ref.cend());
+      const float accumulated_max = *std::max_element(output_ref.cbegin(), output_ref.cend());
+      const float accumulated_range = accumulated_max - accumulated_min;
+      const float output_min = accumulated_min + accumulated_range / 255.0f * float(qmin());
+      const float output_max = accumulated_max - accumulated_range / 255.0f * float(255 - qmax());
+
+      // Prepare parameters.
+      xnn_f32_minmax_params params;
+      init_params(&params, output_min, output_max);
+
+      // Clamp reference results.
+      for (float& output_val : output_ref) {
+        output_val = std::max(std::min(output_val, output_max), output_min);
+      }
+
+      // Call optimized micro-kernel.
+      dwconv(
+        input_height(), input_width() * sizeof(float),
+        output_height(), output_width(),
+        kernel_height(), kernel_width(),
+        subsampling_height(), subsampling_width(),
+        dilation_height(), dilation_width(),
+        padding_top(), padding_left(),
+        input.data(), packed_weights.data(), output.data(),
+        &params);
+
+      // Verify results.
+      for (size_t y = 0; y < output_height(); y++) {
+        for (size_t x = 0; x < output_width(); x++) {
+          ASSERT_NEAR(
+              output_ref[y * output_width() + x],
+              output[y * output_width() + x],
+              std::abs(output_ref[y * output_width() + x]) * 1.0e-5)
+            << "x = " << x << ", y = " << y;
+        }
+      }
+    }
+  }
+
  private:
   uint32_t padding_left_{0};
   uint32_t padding_right_{0};
@@ -254,6 +382,10 @@ class DWConv2DMicrokernelTester {
   uint32_t input_height_{1};
   uint32_t input_width_{1};
   uint32_t subsampling_{1};
+  uint32_t subsampling_height_{0};
+  uint32_t subsampling_width_{0};
+  uint32_t dilation_height_{1};
+  uint32_t dilation_width_{1};
   uint32_t kernel_height_{1};
   uint32_t kernel_width_{1};
   uint8_t qmin_{0};
@@ -1848,5692 +1848,6148 @@
 
 
 #if XNN_ARCH_ARM64
-  TEST(F16_GEMM_MINMAX_4X8__NEONFP16ARITH_LD64, k_eq_4) {
+  TEST(F16_GEMM_MINMAX_1X16__NEONFP16ARITH_LD64_ACC4, k_eq_4) {
     TEST_REQUIRES_ARM_NEON_FP16_ARITH;
     GemmMicrokernelTester()
-      .mr(4)
-      .nr(8)
+      .mr(1)
+      .nr(16)
       .kr(1)
       .sr(1)
-      .m(4)
-      .n(8)
+      .m(1)
+      .n(16)
       .k(4)
-      .Test(xnn_f16_gemm_minmax_ukernel_4x8__neonfp16arith_ld64, xnn_init_f16_scaleminmax_neon_params);
+      .Test(xnn_f16_gemm_minmax_ukernel_1x16__neonfp16arith_ld64_acc4, xnn_init_f16_scaleminmax_neon_params);
   }
 
-  TEST(F16_GEMM_MINMAX_4X8__NEONFP16ARITH_LD64, strided_cn) {
+  TEST(F16_GEMM_MINMAX_1X16__NEONFP16ARITH_LD64_ACC4, strided_cn) {
     TEST_REQUIRES_ARM_NEON_FP16_ARITH;
     GemmMicrokernelTester()
-      .mr(4)
-      .nr(8)
+      .mr(1)
+      .nr(16)
       .kr(1)
       .sr(1)
-      .m(4)
-      .n(8)
+      .m(1)
+      .n(16)
       .k(4)
-      .cn_stride(11)
-      .Test(xnn_f16_gemm_minmax_ukernel_4x8__neonfp16arith_ld64, xnn_init_f16_scaleminmax_neon_params);
+      .cn_stride(19)
+      .Test(xnn_f16_gemm_minmax_ukernel_1x16__neonfp16arith_ld64_acc4, xnn_init_f16_scaleminmax_neon_params);
   }
 
-  TEST(F16_GEMM_MINMAX_4X8__NEONFP16ARITH_LD64, k_eq_4_strided_a) {
+  TEST(F16_GEMM_MINMAX_1X16__NEONFP16ARITH_LD64_ACC4, k_eq_4_strided_a) {
     TEST_REQUIRES_ARM_NEON_FP16_ARITH;
     GemmMicrokernelTester()
-      .mr(4)
-      .nr(8)
+      .mr(1)
+      .nr(16)
       .kr(1)
       .sr(1)
-      .m(4)
-      .n(8)
+      .m(1)
+      .n(16)
       .k(4)
       .a_stride(7)
-      .Test(xnn_f16_gemm_minmax_ukernel_4x8__neonfp16arith_ld64, xnn_init_f16_scaleminmax_neon_params);
+      .Test(xnn_f16_gemm_minmax_ukernel_1x16__neonfp16arith_ld64_acc4, xnn_init_f16_scaleminmax_neon_params);
   }
 
-  TEST(F16_GEMM_MINMAX_4X8__NEONFP16ARITH_LD64, k_eq_4_subtile) {
+  TEST(F16_GEMM_MINMAX_1X16__NEONFP16ARITH_LD64_ACC4, k_eq_4_subtile) {
     TEST_REQUIRES_ARM_NEON_FP16_ARITH;
-    for (uint32_t n = 1; n <= 8; n++) {
-      for (uint32_t m = 1; m <= 4; m++) {
+    for (uint32_t n = 1; n <= 16; n++) {
+      for (uint32_t m = 1; m <= 1; m++) {
         GemmMicrokernelTester()
-          .mr(4)
-          .nr(8)
+          .mr(1)
+          .nr(16)
           .kr(1)
           .sr(1)
           .m(m)
           .n(n)
           .k(4)
           .iterations(1)
-          .Test(xnn_f16_gemm_minmax_ukernel_4x8__neonfp16arith_ld64, xnn_init_f16_scaleminmax_neon_params);
+          .Test(xnn_f16_gemm_minmax_ukernel_1x16__neonfp16arith_ld64_acc4, xnn_init_f16_scaleminmax_neon_params);
       }
     }
   }
 
-  TEST(F16_GEMM_MINMAX_4X8__NEONFP16ARITH_LD64, k_eq_4_subtile_m) {
+  TEST(F16_GEMM_MINMAX_1X16__NEONFP16ARITH_LD64_ACC4, k_eq_4_subtile_m) {
     TEST_REQUIRES_ARM_NEON_FP16_ARITH;
-    for (uint32_t m = 1; m <= 4; m++) {
+    for (uint32_t m = 1; m <= 1; m++) {
       GemmMicrokernelTester()
-        .mr(4)
-        .nr(8)
+        .mr(1)
+        .nr(16)
         .kr(1)
         .sr(1)
         .m(m)
-        .n(8)
+        .n(16)
         .k(4)
         .iterations(1)
-        .Test(xnn_f16_gemm_minmax_ukernel_4x8__neonfp16arith_ld64, xnn_init_f16_scaleminmax_neon_params);
+        .Test(xnn_f16_gemm_minmax_ukernel_1x16__neonfp16arith_ld64_acc4, xnn_init_f16_scaleminmax_neon_params);
     }
   }
 
-  TEST(F16_GEMM_MINMAX_4X8__NEONFP16ARITH_LD64, k_eq_4_subtile_n) {
+  TEST(F16_GEMM_MINMAX_1X16__NEONFP16ARITH_LD64_ACC4, k_eq_4_subtile_n) {
     TEST_REQUIRES_ARM_NEON_FP16_ARITH;
-    for (uint32_t n = 1; n <= 8; n++) {
+    for (uint32_t n = 1; n <= 16; n++) {
       GemmMicrokernelTester()
-        .mr(4)
-        .nr(8)
+        .mr(1)
+        .nr(16)
         .kr(1)
         .sr(1)
-        .m(4)
+        .m(1)
         .n(n)
         .k(4)
         .iterations(1)
-        .Test(xnn_f16_gemm_minmax_ukernel_4x8__neonfp16arith_ld64, xnn_init_f16_scaleminmax_neon_params);
+        .Test(xnn_f16_gemm_minmax_ukernel_1x16__neonfp16arith_ld64_acc4, xnn_init_f16_scaleminmax_neon_params);
     }
   }
 
-  TEST(F16_GEMM_MINMAX_4X8__NEONFP16ARITH_LD64, k_lt_4) {
+  TEST(F16_GEMM_MINMAX_1X16__NEONFP16ARITH_LD64_ACC4, k_lt_4) {
     TEST_REQUIRES_ARM_NEON_FP16_ARITH;
     for (size_t k = 1; k < 4; k++) {
       GemmMicrokernelTester()
-        .mr(4)
-        .nr(8)
+        .mr(1)
+        .nr(16)
         .kr(1)
         .sr(1)
-        .m(4)
-        .n(8)
+        .m(1)
+        .n(16)
         .k(k)
-        .Test(xnn_f16_gemm_minmax_ukernel_4x8__neonfp16arith_ld64, xnn_init_f16_scaleminmax_neon_params);
+        .Test(xnn_f16_gemm_minmax_ukernel_1x16__neonfp16arith_ld64_acc4, xnn_init_f16_scaleminmax_neon_params);
     }
   }
 
-  TEST(F16_GEMM_MINMAX_4X8__NEONFP16ARITH_LD64, k_lt_4_strided_a) {
+  TEST(F16_GEMM_MINMAX_1X16__NEONFP16ARITH_LD64_ACC4, k_lt_4_strided_a) {
     TEST_REQUIRES_ARM_NEON_FP16_ARITH;
     for (size_t k = 1; k < 4; k++) {
       GemmMicrokernelTester()
-        .mr(4)
-        .nr(8)
+        .mr(1)
+        .nr(16)
         .kr(1)
         .sr(1)
-        .m(4)
-        .n(8)
+        .m(1)
+        .n(16)
         .k(k)
         .a_stride(7)
-        .Test(xnn_f16_gemm_minmax_ukernel_4x8__neonfp16arith_ld64, xnn_init_f16_scaleminmax_neon_params);
+        .Test(xnn_f16_gemm_minmax_ukernel_1x16__neonfp16arith_ld64_acc4, xnn_init_f16_scaleminmax_neon_params);
     }
   }
 
-  TEST(F16_GEMM_MINMAX_4X8__NEONFP16ARITH_LD64, k_lt_4_subtile) {
+  TEST(F16_GEMM_MINMAX_1X16__NEONFP16ARITH_LD64_ACC4, k_lt_4_subtile) {
     TEST_REQUIRES_ARM_NEON_FP16_ARITH;
     for (size_t k = 1; k < 4; k++) {
-      for (uint32_t n = 1; n <= 8; n++) {
-        for (uint32_t m = 1; m <= 4; m++) {
+      for (uint32_t n = 1; n <= 16; n++) {
+        for (uint32_t m = 1; m <= 1; m++) {
           GemmMicrokernelTester()
-            .mr(4)
-            .nr(8)
+            .mr(1)
+            .nr(16)
             .kr(1)
             .sr(1)
             .m(m)
             .n(n)
             .k(k)
             .iterations(1)
-            .Test(xnn_f16_gemm_minmax_ukernel_4x8__neonfp16arith_ld64, xnn_init_f16_scaleminmax_neon_params);
+            .Test(xnn_f16_gemm_minmax_ukernel_1x16__neonfp16arith_ld64_acc4, xnn_init_f16_scaleminmax_neon_params);
         }
       }
     }
   }
 
-  TEST(F16_GEMM_MINMAX_4X8__NEONFP16ARITH_LD64, k_gt_4) {
+  TEST(F16_GEMM_MINMAX_1X16__NEONFP16ARITH_LD64_ACC4, k_gt_4) {
     TEST_REQUIRES_ARM_NEON_FP16_ARITH;
     for (size_t k = 5; k < 8; k++) {
       GemmMicrokernelTester()
-        .mr(4)
-        .nr(8)
+        .mr(1)
+        .nr(16)
         .kr(1)
         .sr(1)
-        .m(4)
-        .n(8)
+        .m(1)
+        .n(16)
         .k(k)
-        .Test(xnn_f16_gemm_minmax_ukernel_4x8__neonfp16arith_ld64, xnn_init_f16_scaleminmax_neon_params);
+        .Test(xnn_f16_gemm_minmax_ukernel_1x16__neonfp16arith_ld64_acc4, xnn_init_f16_scaleminmax_neon_params);
     }
   }
 
-  TEST(F16_GEMM_MINMAX_4X8__NEONFP16ARITH_LD64, k_gt_4_strided_a) {
+  TEST(F16_GEMM_MINMAX_1X16__NEONFP16ARITH_LD64_ACC4, k_gt_4_strided_a) {
     TEST_REQUIRES_ARM_NEON_FP16_ARITH;
     for (size_t k = 5; k < 8; k++) {
       GemmMicrokernelTester()
-        .mr(4)
-        .nr(8)
+        .mr(1)
+        .nr(16)
         .kr(1)
         .sr(1)
-        .m(4)
-        .n(8)
+        .m(1)
+        .n(16)
         .k(k)
         .a_stride(11)
-        .Test(xnn_f16_gemm_minmax_ukernel_4x8__neonfp16arith_ld64, xnn_init_f16_scaleminmax_neon_params);
+        .Test(xnn_f16_gemm_minmax_ukernel_1x16__neonfp16arith_ld64_acc4, xnn_init_f16_scaleminmax_neon_params);
     }
   }
 
-  TEST(F16_GEMM_MINMAX_4X8__NEONFP16ARITH_LD64, k_gt_4_subtile) {
+  TEST(F16_GEMM_MINMAX_1X16__NEONFP16ARITH_LD64_ACC4, k_gt_4_subtile) {
     TEST_REQUIRES_ARM_NEON_FP16_ARITH;
     for (size_t k = 5; k < 8; k++) {
-      for (uint32_t n = 1; n <= 8; n++) {
-        for (uint32_t m = 1; m <= 4; m++) {
+      for (uint32_t n = 1; n <= 16; n++) {
+        for (uint32_t m = 1; m <= 1; m++) {
           GemmMicrokernelTester()
-            .mr(4)
-            .nr(8)
+            .mr(1)
+            .nr(16)
             .kr(1)
             .sr(1)
             .m(m)
             .n(n)
             .k(k)
             .iterations(1)
-            .Test(xnn_f16_gemm_minmax_ukernel_4x8__neonfp16arith_ld64, xnn_init_f16_scaleminmax_neon_params);
+            .Test(xnn_f16_gemm_minmax_ukernel_1x16__neonfp16arith_ld64_acc4, xnn_init_f16_scaleminmax_neon_params);
         }
       }
     }
   }
 
-  TEST(F16_GEMM_MINMAX_4X8__NEONFP16ARITH_LD64, k_div_4) {
+  TEST(F16_GEMM_MINMAX_1X16__NEONFP16ARITH_LD64_ACC4, k_div_4) {
     TEST_REQUIRES_ARM_NEON_FP16_ARITH;
     for (size_t k = 8; k <= 40; k += 4) {
       GemmMicrokernelTester()
-        .mr(4)
-        .nr(8)
+        .mr(1)
+        .nr(16)
         .kr(1)
         .sr(1)
-        .m(4)
-        .n(8)
+        .m(1)
+        .n(16)
         .k(k)
-        .Test(xnn_f16_gemm_minmax_ukernel_4x8__neonfp16arith_ld64, xnn_init_f16_scaleminmax_neon_params);
+        .Test(xnn_f16_gemm_minmax_ukernel_1x16__neonfp16arith_ld64_acc4, xnn_init_f16_scaleminmax_neon_params);
     }
   }
 
-  TEST(F16_GEMM_MINMAX_4X8__NEONFP16ARITH_LD64, k_div_4_strided_a) {
+  TEST(F16_GEMM_MINMAX_1X16__NEONFP16ARITH_LD64_ACC4, k_div_4_strided_a) {
     TEST_REQUIRES_ARM_NEON_FP16_ARITH;
     for (size_t k = 8; k <= 40; k += 4) {
       GemmMicrokernelTester()
-        .mr(4)
-        .nr(8)
+        .mr(1)
+        .nr(16)
         .kr(1)
         .sr(1)
-        .m(4)
-        .n(8)
+        .m(1)
+        .n(16)
         .k(k)
         .a_stride(43)
-        .Test(xnn_f16_gemm_minmax_ukernel_4x8__neonfp16arith_ld64, xnn_init_f16_scaleminmax_neon_params);
+        .Test(xnn_f16_gemm_minmax_ukernel_1x16__neonfp16arith_ld64_acc4, xnn_init_f16_scaleminmax_neon_params);
     }
   }
 
-  TEST(F16_GEMM_MINMAX_4X8__NEONFP16ARITH_LD64, k_div_4_subtile) {
+  TEST(F16_GEMM_MINMAX_1X16__NEONFP16ARITH_LD64_ACC4, k_div_4_subtile) {
     TEST_REQUIRES_ARM_NEON_FP16_ARITH;
     for (size_t k = 8; k <= 40; k += 4) {
-      for (uint32_t n = 1; n <= 8; n++) {
-        for (uint32_t m = 1; m <= 4; m++) {
+      for (uint32_t n = 1; n <= 16; n++) {
+        for (uint32_t m = 1; m <= 1; m++) {
           GemmMicrokernelTester()
-            .mr(4)
-            .nr(8)
+            .mr(1)
+            .nr(16)
             .kr(1)
             .sr(1)
             .m(m)
             .n(n)
             .k(k)
             .iterations(1)
-            .Test(xnn_f16_gemm_minmax_ukernel_4x8__neonfp16arith_ld64, xnn_init_f16_scaleminmax_neon_params);
+            .Test(xnn_f16_gemm_minmax_ukernel_1x16__neonfp16arith_ld64_acc4, xnn_init_f16_scaleminmax_neon_params);
         }
       }
     }
   }
 
-  TEST(F16_GEMM_MINMAX_4X8__NEONFP16ARITH_LD64, n_gt_8) {
+  TEST(F16_GEMM_MINMAX_1X16__NEONFP16ARITH_LD64_ACC4, n_gt_16) {
     TEST_REQUIRES_ARM_NEON_FP16_ARITH;
-    for (uint32_t n = 9; n < 16; n++) {
+    for (uint32_t n = 17; n < 32; n++) {
       for (size_t k = 1; k <= 20; k += 5) {
         GemmMicrokernelTester()
-          .mr(4)
-          .nr(8)
+          .mr(1)
+          .nr(16)
           .kr(1)
           .sr(1)
-          .m(4)
+          .m(1)
           .n(n)
           .k(k)
-          .Test(xnn_f16_gemm_minmax_ukernel_4x8__neonfp16arith_ld64, xnn_init_f16_scaleminmax_neon_params);
+          .Test(xnn_f16_gemm_minmax_ukernel_1x16__neonfp16arith_ld64_acc4, xnn_init_f16_scaleminmax_neon_params);
       }
     }
   }
 
-  TEST(F16_GEMM_MINMAX_4X8__NEONFP16ARITH_LD64, n_gt_8_strided_cn) {
+  TEST(F16_GEMM_MINMAX_1X16__NEONFP16ARITH_LD64_ACC4, n_gt_16_strided_cn) {
     TEST_REQUIRES_ARM_NEON_FP16_ARITH;
-    for (uint32_t n = 9; n < 16; n++) {
+    for (uint32_t n = 17; n < 32; n++) {
       for (size_t k = 1; k <= 20; k += 5) {
         GemmMicrokernelTester()
-          .mr(4)
-          .nr(8)
+          .mr(1)
+          .nr(16)
           .kr(1)
           .sr(1)
-          .m(4)
+          .m(1)
           .n(n)
           .k(k)
-          .cn_stride(11)
-          .Test(xnn_f16_gemm_minmax_ukernel_4x8__neonfp16arith_ld64, xnn_init_f16_scaleminmax_neon_params);
+          .cn_stride(19)
+          .Test(xnn_f16_gemm_minmax_ukernel_1x16__neonfp16arith_ld64_acc4, xnn_init_f16_scaleminmax_neon_params);
       }
     }
   }
 
-  TEST(F16_GEMM_MINMAX_4X8__NEONFP16ARITH_LD64, n_gt_8_strided_a) {
+  TEST(F16_GEMM_MINMAX_1X16__NEONFP16ARITH_LD64_ACC4, n_gt_16_strided_a) {
     TEST_REQUIRES_ARM_NEON_FP16_ARITH;
-    for (uint32_t n = 9; n < 16; n++) {
+    for (uint32_t n = 17; n < 32; n++) {
       for (size_t k = 1; k <= 20; k += 5) {
         GemmMicrokernelTester()
-          .mr(4)
-          .nr(8)
+          .mr(1)
+          .nr(16)
           .kr(1)
           .sr(1)
-          .m(4)
+          .m(1)
           .n(n)
           .k(k)
           .a_stride(23)
-          .Test(xnn_f16_gemm_minmax_ukernel_4x8__neonfp16arith_ld64, xnn_init_f16_scaleminmax_neon_params);
+          .Test(xnn_f16_gemm_minmax_ukernel_1x16__neonfp16arith_ld64_acc4, xnn_init_f16_scaleminmax_neon_params);
       }
     }
   }
 
-  TEST(F16_GEMM_MINMAX_4X8__NEONFP16ARITH_LD64, n_gt_8_subtile) {
+  TEST(F16_GEMM_MINMAX_1X16__NEONFP16ARITH_LD64_ACC4, n_gt_16_subtile) {
     TEST_REQUIRES_ARM_NEON_FP16_ARITH;
-    for (uint32_t n = 9; n < 16; n++) {
+    for (uint32_t n = 17; n < 32; n++) {
       for (size_t k = 1; k <= 20; k += 5) {
-        for (uint32_t m = 1; m <= 4; m++) {
+        for (uint32_t m = 1; m <= 1; m++) {
           GemmMicrokernelTester()
-            .mr(4)
-            .nr(8)
+            .mr(1)
+            .nr(16)
             .kr(1)
             .sr(1)
             .m(m)
             .n(n)
             .k(k)
             .iterations(1)
-            .Test(xnn_f16_gemm_minmax_ukernel_4x8__neonfp16arith_ld64, xnn_init_f16_scaleminmax_neon_params);
+            .Test(xnn_f16_gemm_minmax_ukernel_1x16__neonfp16arith_ld64_acc4, xnn_init_f16_scaleminmax_neon_params);
         }
       }
     }
   }
 
-  TEST(F16_GEMM_MINMAX_4X8__NEONFP16ARITH_LD64, n_div_8) {
+  TEST(F16_GEMM_MINMAX_1X16__NEONFP16ARITH_LD64_ACC4, n_div_16) {
     TEST_REQUIRES_ARM_NEON_FP16_ARITH;
-    for (uint32_t n = 16; n <= 24; n += 8) {
+    for (uint32_t n = 32; n <= 48; n += 16) {
       for (size_t k = 1; k <= 20; k += 5) {
         GemmMicrokernelTester()
-          .mr(4)
-          .nr(8)
+          .mr(1)
+          .nr(16)
           .kr(1)
           .sr(1)
-          .m(4)
+          .m(1)
           .n(n)
           .k(k)
-          .Test(xnn_f16_gemm_minmax_ukernel_4x8__neonfp16arith_ld64, xnn_init_f16_scaleminmax_neon_params);
+          .Test(xnn_f16_gemm_minmax_ukernel_1x16__neonfp16arith_ld64_acc4, xnn_init_f16_scaleminmax_neon_params);
       }
     }
   }
 
-  TEST(F16_GEMM_MINMAX_4X8__NEONFP16ARITH_LD64, n_div_8_strided_cn) {
+  TEST(F16_GEMM_MINMAX_1X16__NEONFP16ARITH_LD64_ACC4, n_div_16_strided_cn) {
     TEST_REQUIRES_ARM_NEON_FP16_ARITH;
-    for (uint32_t n = 16; n <= 24; n += 8) {
+    for (uint32_t n = 32; n <= 48; n += 16) {
       for (size_t k = 1; k <= 20; k += 5) {
         GemmMicrokernelTester()
-          .mr(4)
-          .nr(8)
+          .mr(1)
+          .nr(16)
           .kr(1)
           .sr(1)
-          .m(4)
+          .m(1)
           .n(n)
           .k(k)
-          .cn_stride(11)
-          .Test(xnn_f16_gemm_minmax_ukernel_4x8__neonfp16arith_ld64, xnn_init_f16_scaleminmax_neon_params);
+          .cn_stride(19)
+          .Test(xnn_f16_gemm_minmax_ukernel_1x16__neonfp16arith_ld64_acc4, xnn_init_f16_scaleminmax_neon_params);
       }
     }
   }
 
-  TEST(F16_GEMM_MINMAX_4X8__NEONFP16ARITH_LD64, n_div_8_strided_a) {
+  TEST(F16_GEMM_MINMAX_1X16__NEONFP16ARITH_LD64_ACC4, n_div_16_strided_a) {
     TEST_REQUIRES_ARM_NEON_FP16_ARITH;
-    for (uint32_t n = 16; n <= 24; n += 8) {
+    for (uint32_t n = 32; n <= 48; n += 16) {
       for (size_t k = 1; k <= 20; k += 5) {
         GemmMicrokernelTester()
-          .mr(4)
-          .nr(8)
+          .mr(1)
+          .nr(16)
           .kr(1)
           .sr(1)
-          .m(4)
+          .m(1)
           .n(n)
           .k(k)
           .a_stride(23)
-          .Test(xnn_f16_gemm_minmax_ukernel_4x8__neonfp16arith_ld64, xnn_init_f16_scaleminmax_neon_params);
+          .Test(xnn_f16_gemm_minmax_ukernel_1x16__neonfp16arith_ld64_acc4, xnn_init_f16_scaleminmax_neon_params);
       }
     }
   }
 
-  TEST(F16_GEMM_MINMAX_4X8__NEONFP16ARITH_LD64, n_div_8_subtile) {
+  TEST(F16_GEMM_MINMAX_1X16__NEONFP16ARITH_LD64_ACC4, n_div_16_subtile) {
     TEST_REQUIRES_ARM_NEON_FP16_ARITH;
-    for (uint32_t n = 16; n <= 24; n += 8) {
+    for (uint32_t n = 32; n <= 48; n += 16) {
       for (size_t k = 1; k <= 20; k += 5) {
-        for (uint32_t m = 1; m <= 4; m++) {
+        for (uint32_t m = 1; m <= 1; m++) {
           GemmMicrokernelTester()
-            .mr(4)
-            .nr(8)
+            .mr(1)
+            .nr(16)
             .kr(1)
             .sr(1)
             .m(m)
             .n(n)
             .k(k)
             .iterations(1)
-            .Test(xnn_f16_gemm_minmax_ukernel_4x8__neonfp16arith_ld64, xnn_init_f16_scaleminmax_neon_params);
+            .Test(xnn_f16_gemm_minmax_ukernel_1x16__neonfp16arith_ld64_acc4, xnn_init_f16_scaleminmax_neon_params);
         }
       }
     }
   }
 
-  TEST(F16_GEMM_MINMAX_4X8__NEONFP16ARITH_LD64, strided_cm_subtile) {
+  TEST(F16_GEMM_MINMAX_1X16__NEONFP16ARITH_LD64_ACC4, strided_cm_subtile) {
     TEST_REQUIRES_ARM_NEON_FP16_ARITH;
     for (size_t k = 1; k <= 20; k += 5) {
-      for (uint32_t n = 1; n <= 8; n++) {
-        for (uint32_t m = 1; m <= 4; m++) {
+      for (uint32_t n = 1; n <= 16; n++) {
+        for (uint32_t m = 1; m <= 1; m++) {
           GemmMicrokernelTester()
-            .mr(4)
-            .nr(8)
+            .mr(1)
+            .nr(16)
             .kr(1)
             .sr(1)
             .m(m)
             .n(n)
             .k(k)
-            .cm_stride(11)
+            .cm_stride(19)
             .iterations(1)
-            .Test(xnn_f16_gemm_minmax_ukernel_4x8__neonfp16arith_ld64, xnn_init_f16_scaleminmax_neon_params);
+            .Test(xnn_f16_gemm_minmax_ukernel_1x16__neonfp16arith_ld64_acc4, xnn_init_f16_scaleminmax_neon_params);
         }
       }
     }
   }
 
-  TEST(F16_GEMM_MINMAX_4X8__NEONFP16ARITH_LD64, qmin) {
+  TEST(F16_GEMM_MINMAX_1X16__NEONFP16ARITH_LD64_ACC4, qmin) {
     TEST_REQUIRES_ARM_NEON_FP16_ARITH;
     GemmMicrokernelTester()
-      .mr(4)
-      .nr(8)
+      .mr(1)
+      .nr(16)
       .kr(1)
       .sr(1)
-      .m(4)
-      .n(8)
-      .k(4)
+      .m(1)
+      .n(16)
+      .k(4)
       .qmin(128)
-      .Test(xnn_f16_gemm_minmax_ukernel_4x8__neonfp16arith_ld64, xnn_init_f16_scaleminmax_neon_params);
+      .Test(xnn_f16_gemm_minmax_ukernel_1x16__neonfp16arith_ld64_acc4, xnn_init_f16_scaleminmax_neon_params);
   }
 
-  TEST(F16_GEMM_MINMAX_4X8__NEONFP16ARITH_LD64, qmax) {
+  TEST(F16_GEMM_MINMAX_1X16__NEONFP16ARITH_LD64_ACC4, qmax) {
     TEST_REQUIRES_ARM_NEON_FP16_ARITH;
     GemmMicrokernelTester()
-      .mr(4)
-      .nr(8)
+      .mr(1)
+      .nr(16)
       .kr(1)
       .sr(1)
-      .m(4)
-      .n(8)
+      .m(1)
+      .n(16)
       .k(4)
       .qmax(128)
-      .Test(xnn_f16_gemm_minmax_ukernel_4x8__neonfp16arith_ld64, xnn_init_f16_scaleminmax_neon_params);
+      .Test(xnn_f16_gemm_minmax_ukernel_1x16__neonfp16arith_ld64_acc4, xnn_init_f16_scaleminmax_neon_params);
   }
 
-  TEST(F16_GEMM_MINMAX_4X8__NEONFP16ARITH_LD64, strided_cm) {
+  TEST(F16_GEMM_MINMAX_1X16__NEONFP16ARITH_LD64_ACC4, strided_cm) {
     TEST_REQUIRES_ARM_NEON_FP16_ARITH;
     GemmMicrokernelTester()
-      .mr(4)
-      .nr(8)
+      .mr(1)
+      .nr(16)
       .kr(1)
       .sr(1)
-      .m(4)
-      .n(8)
+      .m(1)
+      .n(16)
       .k(4)
-      .cm_stride(11)
-      .Test(xnn_f16_gemm_minmax_ukernel_4x8__neonfp16arith_ld64, xnn_init_f16_scaleminmax_neon_params);
+      .cm_stride(19)
+      .Test(xnn_f16_gemm_minmax_ukernel_1x16__neonfp16arith_ld64_acc4, xnn_init_f16_scaleminmax_neon_params);
   }
 #endif  // XNN_ARCH_ARM64
 
 
 #if XNN_ARCH_ARM64
-  TEST(F16_GEMM_MINMAX_4X16__NEONFP16ARITH_LD64, k_eq_4) {
+  TEST(F16_GEMM_MINMAX_4X8__NEONFP16ARITH_LD64, k_eq_4) {
     TEST_REQUIRES_ARM_NEON_FP16_ARITH;
     GemmMicrokernelTester()
       .mr(4)
-      .nr(16)
+      .nr(8)
       .kr(1)
       .sr(1)
       .m(4)
-      .n(16)
+      .n(8)
       .k(4)
-      .Test(xnn_f16_gemm_minmax_ukernel_4x16__neonfp16arith_ld64, xnn_init_f16_scaleminmax_neon_params);
+      .Test(xnn_f16_gemm_minmax_ukernel_4x8__neonfp16arith_ld64, xnn_init_f16_scaleminmax_neon_params);
   }
 
-  TEST(F16_GEMM_MINMAX_4X16__NEONFP16ARITH_LD64, strided_cn) {
+  TEST(F16_GEMM_MINMAX_4X8__NEONFP16ARITH_LD64, strided_cn) {
     TEST_REQUIRES_ARM_NEON_FP16_ARITH;
     GemmMicrokernelTester()
       .mr(4)
-      .nr(16)
+      .nr(8)
       .kr(1)
       .sr(1)
       .m(4)
-      .n(16)
+      .n(8)
       .k(4)
-      .cn_stride(19)
-      .Test(xnn_f16_gemm_minmax_ukernel_4x16__neonfp16arith_ld64, xnn_init_f16_scaleminmax_neon_params);
+      .cn_stride(11)
+      .Test(xnn_f16_gemm_minmax_ukernel_4x8__neonfp16arith_ld64, xnn_init_f16_scaleminmax_neon_params);
   }
 
-  TEST(F16_GEMM_MINMAX_4X16__NEONFP16ARITH_LD64, k_eq_4_strided_a) {
+  TEST(F16_GEMM_MINMAX_4X8__NEONFP16ARITH_LD64, k_eq_4_strided_a) {
     TEST_REQUIRES_ARM_NEON_FP16_ARITH;
     GemmMicrokernelTester()
       .mr(4)
-      .nr(16)
+      .nr(8)
       .kr(1)
       .sr(1)
       .m(4)
-      .n(16)
+      .n(8)
       .k(4)
       .a_stride(7)
-      .Test(xnn_f16_gemm_minmax_ukernel_4x16__neonfp16arith_ld64, xnn_init_f16_scaleminmax_neon_params);
+      .Test(xnn_f16_gemm_minmax_ukernel_4x8__neonfp16arith_ld64, xnn_init_f16_scaleminmax_neon_params);
   }
 
-  TEST(F16_GEMM_MINMAX_4X16__NEONFP16ARITH_LD64, k_eq_4_subtile) {
+  TEST(F16_GEMM_MINMAX_4X8__NEONFP16ARITH_LD64, k_eq_4_subtile) {
     TEST_REQUIRES_ARM_NEON_FP16_ARITH;
-    for (uint32_t n = 1; n <= 16; n++) {
+    for (uint32_t n = 1; n <= 8; n++) {
       for (uint32_t m = 1; m <= 4; m++) {
         GemmMicrokernelTester()
           .mr(4)
-          .nr(16)
+          .nr(8)
           .kr(1)
           .sr(1)
           .m(m)
           .n(n)
           .k(4)
           .iterations(1)
-          .Test(xnn_f16_gemm_minmax_ukernel_4x16__neonfp16arith_ld64, xnn_init_f16_scaleminmax_neon_params);
+          .Test(xnn_f16_gemm_minmax_ukernel_4x8__neonfp16arith_ld64, xnn_init_f16_scaleminmax_neon_params);
       }
     }
   }
 
-  TEST(F16_GEMM_MINMAX_4X16__NEONFP16ARITH_LD64, k_eq_4_subtile_m) {
+  TEST(F16_GEMM_MINMAX_4X8__NEONFP16ARITH_LD64, k_eq_4_subtile_m) {
     TEST_REQUIRES_ARM_NEON_FP16_ARITH;
     for (uint32_t m = 1; m <= 4; m++) {
       GemmMicrokernelTester()
         .mr(4)
-        .nr(16)
+        .nr(8)
         .kr(1)
         .sr(1)
         .m(m)
-        .n(16)
+        .n(8)
         .k(4)
         .iterations(1)
-        .Test(xnn_f16_gemm_minmax_ukernel_4x16__neonfp16arith_ld64, xnn_init_f16_scaleminmax_neon_params);
+        .Test(xnn_f16_gemm_minmax_ukernel_4x8__neonfp16arith_ld64, xnn_init_f16_scaleminmax_neon_params);
     }
   }
 
-  TEST(F16_GEMM_MINMAX_4X16__NEONFP16ARITH_LD64, k_eq_4_subtile_n) {
+  TEST(F16_GEMM_MINMAX_4X8__NEONFP16ARITH_LD64, k_eq_4_subtile_n) {
     TEST_REQUIRES_ARM_NEON_FP16_ARITH;
-    for (uint32_t n = 1; n <= 16; n++) {
+    for (uint32_t n = 1; n <= 8; n++) {
       GemmMicrokernelTester()
         .mr(4)
-        .nr(16)
+        .nr(8)
         .kr(1)
         .sr(1)
         .m(4)
         .n(n)
         .k(4)
         .iterations(1)
-        .Test(xnn_f16_gemm_minmax_ukernel_4x16__neonfp16arith_ld64, xnn_init_f16_scaleminmax_neon_params);
+        .Test(xnn_f16_gemm_minmax_ukernel_4x8__neonfp16arith_ld64, xnn_init_f16_scaleminmax_neon_params);
     }
   }
 
-  TEST(F16_GEMM_MINMAX_4X16__NEONFP16ARITH_LD64, k_lt_4) {
+  TEST(F16_GEMM_MINMAX_4X8__NEONFP16ARITH_LD64, k_lt_4) {
     TEST_REQUIRES_ARM_NEON_FP16_ARITH;
     for (size_t k = 1; k < 4; k++) {
       GemmMicrokernelTester()
         .mr(4)
-        .nr(16)
+        .nr(8)
         .kr(1)
         .sr(1)
         .m(4)
-        .n(16)
+        .n(8)
         .k(k)
-        .Test(xnn_f16_gemm_minmax_ukernel_4x16__neonfp16arith_ld64, xnn_init_f16_scaleminmax_neon_params);
+        .Test(xnn_f16_gemm_minmax_ukernel_4x8__neonfp16arith_ld64, xnn_init_f16_scaleminmax_neon_params);
     }
   }
 
-  TEST(F16_GEMM_MINMAX_4X16__NEONFP16ARITH_LD64, k_lt_4_strided_a) {
+  TEST(F16_GEMM_MINMAX_4X8__NEONFP16ARITH_LD64, k_lt_4_strided_a) {
     TEST_REQUIRES_ARM_NEON_FP16_ARITH;
     for (size_t k = 1; k < 4; k++) {
       GemmMicrokernelTester()
         .mr(4)
-        .nr(16)
+        .nr(8)
         .kr(1)
         .sr(1)
         .m(4)
-        .n(16)
+        .n(8)
         .k(k)
         .a_stride(7)
-        .Test(xnn_f16_gemm_minmax_ukernel_4x16__neonfp16arith_ld64, xnn_init_f16_scaleminmax_neon_params);
+        .Test(xnn_f16_gemm_minmax_ukernel_4x8__neonfp16arith_ld64, xnn_init_f16_scaleminmax_neon_params);
     }
   }
 
-  TEST(F16_GEMM_MINMAX_4X16__NEONFP16ARITH_LD64, k_lt_4_subtile) {
+  TEST(F16_GEMM_MINMAX_4X8__NEONFP16ARITH_LD64, k_lt_4_subtile) {
     TEST_REQUIRES_ARM_NEON_FP16_ARITH;
     for (size_t k = 1; k < 4; k++) {
-      for (uint32_t n = 1; n <= 16; n++) {
+      for (uint32_t n = 1; n <= 8; n++) {
         for (uint32_t m = 1; m <= 4; m++) {
           GemmMicrokernelTester()
             .mr(4)
-            .nr(16)
+            .nr(8)
             .kr(1)
             .sr(1)
             .m(m)
             .n(n)
             .k(k)
             .iterations(1)
-            .Test(xnn_f16_gemm_minmax_ukernel_4x16__neonfp16arith_ld64, xnn_init_f16_scaleminmax_neon_params);
+            .Test(xnn_f16_gemm_minmax_ukernel_4x8__neonfp16arith_ld64, xnn_init_f16_scaleminmax_neon_params);
         }
       }
     }
   }
 
-  TEST(F16_GEMM_MINMAX_4X16__NEONFP16ARITH_LD64, k_gt_4) {
+  TEST(F16_GEMM_MINMAX_4X8__NEONFP16ARITH_LD64, k_gt_4) {
     TEST_REQUIRES_ARM_NEON_FP16_ARITH;
     for (size_t k = 5; k < 8; k++) {
       GemmMicrokernelTester()
         .mr(4)
-        .nr(16)
+        .nr(8)
         .kr(1)
         .sr(1)
         .m(4)
-        .n(16)
+        .n(8)
         .k(k)
-        .Test(xnn_f16_gemm_minmax_ukernel_4x16__neonfp16arith_ld64, xnn_init_f16_scaleminmax_neon_params);
+        .Test(xnn_f16_gemm_minmax_ukernel_4x8__neonfp16arith_ld64, xnn_init_f16_scaleminmax_neon_params);
     }
   }
 
-  TEST(F16_GEMM_MINMAX_4X16__NEONFP16ARITH_LD64, k_gt_4_strided_a) {
+  TEST(F16_GEMM_MINMAX_4X8__NEONFP16ARITH_LD64, k_gt_4_strided_a) {
     TEST_REQUIRES_ARM_NEON_FP16_ARITH;
     for (size_t k = 5; k < 8; k++) {
       GemmMicrokernelTester()
         .mr(4)
-        .nr(16)
+        .nr(8)
         .kr(1)
         .sr(1)
         .m(4)
-        .n(16)
+        .n(8)
         .k(k)
         .a_stride(11)
-        .Test(xnn_f16_gemm_minmax_ukernel_4x16__neonfp16arith_ld64, xnn_init_f16_scaleminmax_neon_params);
+        .Test(xnn_f16_gemm_minmax_ukernel_4x8__neonfp16arith_ld64, xnn_init_f16_scaleminmax_neon_params);
     }
   }
 
-  TEST(F16_GEMM_MINMAX_4X16__NEONFP16ARITH_LD64, k_gt_4_subtile) {
+  TEST(F16_GEMM_MINMAX_4X8__NEONFP16ARITH_LD64, k_gt_4_subtile) {
     TEST_REQUIRES_ARM_NEON_FP16_ARITH;
     for (size_t k = 5; k < 8; k++) {
-      for (uint32_t n = 1; n <= 16; n++) {
+      for (uint32_t n = 1; n <= 8; n++) {
         for (uint32_t m = 1; m <= 4; m++) {
           GemmMicrokernelTester()
             .mr(4)
-            .nr(16)
+            .nr(8)
             .kr(1)
             .sr(1)
             .m(m)
             .n(n)
             .k(k)
             .iterations(1)
-            .Test(xnn_f16_gemm_minmax_ukernel_4x16__neonfp16arith_ld64, xnn_init_f16_scaleminmax_neon_params);
+            .Test(xnn_f16_gemm_minmax_ukernel_4x8__neonfp16arith_ld64, xnn_init_f16_scaleminmax_neon_params);
         }
       }
     }
   }
 
-  TEST(F16_GEMM_MINMAX_4X16__NEONFP16ARITH_LD64, k_div_4) {
+  TEST(F16_GEMM_MINMAX_4X8__NEONFP16ARITH_LD64, k_div_4) {
     TEST_REQUIRES_ARM_NEON_FP16_ARITH;
     for (size_t k = 8; k <= 40; k += 4) {
       GemmMicrokernelTester()
         .mr(4)
-        .nr(16)
+        .nr(8)
         .kr(1)
         .sr(1)
         .m(4)
-        .n(16)
+        .n(8)
         .k(k)
-        .Test(xnn_f16_gemm_minmax_ukernel_4x16__neonfp16arith_ld64, xnn_init_f16_scaleminmax_neon_params);
+        .Test(xnn_f16_gemm_minmax_ukernel_4x8__neonfp16arith_ld64, xnn_init_f16_scaleminmax_neon_params);
     }
   }
 
-  TEST(F16_GEMM_MINMAX_4X16__NEONFP16ARITH_LD64, k_div_4_strided_a) {
+  TEST(F16_GEMM_MINMAX_4X8__NEONFP16ARITH_LD64, k_div_4_strided_a) {
     TEST_REQUIRES_ARM_NEON_FP16_ARITH;
     for (size_t k = 8; k <= 40; k += 4) {
       GemmMicrokernelTester()
         .mr(4)
-        .nr(16)
+        .nr(8)
         .kr(1)
         .sr(1)
         .m(4)
-        .n(16)
+        .n(8)
         .k(k)
         .a_stride(43)
-        .Test(xnn_f16_gemm_minmax_ukernel_4x16__neonfp16arith_ld64, xnn_init_f16_scaleminmax_neon_params);
+        .Test(xnn_f16_gemm_minmax_ukernel_4x8__neonfp16arith_ld64, xnn_init_f16_scaleminmax_neon_params);
     }
   }
 
-  TEST(F16_GEMM_MINMAX_4X16__NEONFP16ARITH_LD64, k_div_4_subtile) {
+  TEST(F16_GEMM_MINMAX_4X8__NEONFP16ARITH_LD64, k_div_4_subtile) {
     TEST_REQUIRES_ARM_NEON_FP16_ARITH;
     for (size_t k = 8; k <= 40; k += 4) {
-      for (uint32_t n = 1; n <= 16; n++) {
+      for (uint32_t n = 1; n <= 8; n++) {
         for (uint32_t m = 1; m <= 4; m++) {
           GemmMicrokernelTester()
             .mr(4)
-            .nr(16)
+            .nr(8)
             .kr(1)
             .sr(1)
             .m(m)
             .n(n)
             .k(k)
             .iterations(1)
-            .Test(xnn_f16_gemm_minmax_ukernel_4x16__neonfp16arith_ld64, xnn_init_f16_scaleminmax_neon_params);
+            .Test(xnn_f16_gemm_minmax_ukernel_4x8__neonfp16arith_ld64, xnn_init_f16_scaleminmax_neon_params);
         }
       }
     }
   }
 
-  TEST(F16_GEMM_MINMAX_4X16__NEONFP16ARITH_LD64, n_gt_16) {
+  TEST(F16_GEMM_MINMAX_4X8__NEONFP16ARITH_LD64, n_gt_8) {
     TEST_REQUIRES_ARM_NEON_FP16_ARITH;
-    for (uint32_t n = 17; n < 32; n++) {
+    for (uint32_t n = 9; n < 16; n++) {
       for (size_t k = 1; k <= 20; k += 5) {
         GemmMicrokernelTester()
           .mr(4)
-          .nr(16)
+          .nr(8)
           .kr(1)
           .sr(1)
           .m(4)
           .n(n)
           .k(k)
-          .Test(xnn_f16_gemm_minmax_ukernel_4x16__neonfp16arith_ld64, xnn_init_f16_scaleminmax_neon_params);
+          .Test(xnn_f16_gemm_minmax_ukernel_4x8__neonfp16arith_ld64, xnn_init_f16_scaleminmax_neon_params);
       }
     }
   }
 
-  TEST(F16_GEMM_MINMAX_4X16__NEONFP16ARITH_LD64, n_gt_16_strided_cn) {
+  TEST(F16_GEMM_MINMAX_4X8__NEONFP16ARITH_LD64, n_gt_8_strided_cn) {
     TEST_REQUIRES_ARM_NEON_FP16_ARITH;
-    for (uint32_t n = 17; n < 32; n++) {
+    for (uint32_t n = 9; n < 16; n++) {
       for (size_t k = 1; k <= 20; k += 5) {
         GemmMicrokernelTester()
           .mr(4)
-          .nr(16)
+          .nr(8)
           .kr(1)
           .sr(1)
           .m(4)
           .n(n)
           .k(k)
-          .cn_stride(19)
-          .Test(xnn_f16_gemm_minmax_ukernel_4x16__neonfp16arith_ld64, xnn_init_f16_scaleminmax_neon_params);
+          .cn_stride(11)
+          .Test(xnn_f16_gemm_minmax_ukernel_4x8__neonfp16arith_ld64, xnn_init_f16_scaleminmax_neon_params);
       }
     }
   }
 
-  TEST(F16_GEMM_MINMAX_4X16__NEONFP16ARITH_LD64, n_gt_16_strided_a) {
+  TEST(F16_GEMM_MINMAX_4X8__NEONFP16ARITH_LD64, n_gt_8_strided_a) {
     TEST_REQUIRES_ARM_NEON_FP16_ARITH;
-    for (uint32_t n = 17; n < 32; n++) {
+    for (uint32_t n = 9; n < 16; n++) {
       for (size_t k = 1; k <= 20; k += 5) {
         GemmMicrokernelTester()
           .mr(4)
-          .nr(16)
+          .nr(8)
           .kr(1)
           .sr(1)
           .m(4)
           .n(n)
           .k(k)
           .a_stride(23)
-          .Test(xnn_f16_gemm_minmax_ukernel_4x16__neonfp16arith_ld64, xnn_init_f16_scaleminmax_neon_params);
+          .Test(xnn_f16_gemm_minmax_ukernel_4x8__neonfp16arith_ld64, xnn_init_f16_scaleminmax_neon_params);
       }
     }
   }
 
-  TEST(F16_GEMM_MINMAX_4X16__NEONFP16ARITH_LD64, n_gt_16_subtile) {
+  TEST(F16_GEMM_MINMAX_4X8__NEONFP16ARITH_LD64, n_gt_8_subtile) {
     TEST_REQUIRES_ARM_NEON_FP16_ARITH;
-    for (uint32_t n = 17; n < 32; n++) {
+    for (uint32_t n = 9; n < 16; n++) {
       for (size_t k = 1; k <= 20; k += 5) {
         for (uint32_t m = 1; m <= 4; m++) {
           GemmMicrokernelTester()
             .mr(4)
-            .nr(16)
+            .nr(8)
             .kr(1)
             .sr(1)
             .m(m)
             .n(n)
             .k(k)
             .iterations(1)
-            .Test(xnn_f16_gemm_minmax_ukernel_4x16__neonfp16arith_ld64, xnn_init_f16_scaleminmax_neon_params);
+            .Test(xnn_f16_gemm_minmax_ukernel_4x8__neonfp16arith_ld64, xnn_init_f16_scaleminmax_neon_params);
         }
       }
     }
   }
 
-  TEST(F16_GEMM_MINMAX_4X16__NEONFP16ARITH_LD64, n_div_16) {
+  TEST(F16_GEMM_MINMAX_4X8__NEONFP16ARITH_LD64, n_div_8) {
     TEST_REQUIRES_ARM_NEON_FP16_ARITH;
-    for (uint32_t n = 32; n <= 48; n += 16) {
+    for (uint32_t n = 16; n <= 24; n += 8) {
       for (size_t k = 1; k <= 20; k += 5) {
         GemmMicrokernelTester()
           .mr(4)
-          .nr(16)
+          .nr(8)
           .kr(1)
           .sr(1)
           .m(4)
           .n(n)
           .k(k)
-          .Test(xnn_f16_gemm_minmax_ukernel_4x16__neonfp16arith_ld64, xnn_init_f16_scaleminmax_neon_params);
+          .Test(xnn_f16_gemm_minmax_ukernel_4x8__neonfp16arith_ld64, xnn_init_f16_scaleminmax_neon_params);
       }
     }
   }
 
-  TEST(F16_GEMM_MINMAX_4X16__NEONFP16ARITH_LD64, n_div_16_strided_cn) {
+  TEST(F16_GEMM_MINMAX_4X8__NEONFP16ARITH_LD64, n_div_8_strided_cn) {
     TEST_REQUIRES_ARM_NEON_FP16_ARITH;
-    for (uint32_t n = 32; n <= 48; n += 16) {
+    for (uint32_t n = 16; n <= 24; n += 8) {
       for (size_t k = 1; k <= 20; k += 5) {
         GemmMicrokernelTester()
           .mr(4)
-          .nr(16)
+          .nr(8)
           .kr(1)
           .sr(1)
           .m(4)
           .n(n)
           .k(k)
-          .cn_stride(19)
-          .Test(xnn_f16_gemm_minmax_ukernel_4x16__neonfp16arith_ld64, xnn_init_f16_scaleminmax_neon_params);
+          .cn_stride(11)
+          .Test(xnn_f16_gemm_minmax_ukernel_4x8__neonfp16arith_ld64, xnn_init_f16_scaleminmax_neon_params);
       }
     }
   }
 
-  TEST(F16_GEMM_MINMAX_4X16__NEONFP16ARITH_LD64, n_div_16_strided_a) {
+  TEST(F16_GEMM_MINMAX_4X8__NEONFP16ARITH_LD64, n_div_8_strided_a) {
     TEST_REQUIRES_ARM_NEON_FP16_ARITH;
-    for (uint32_t n = 32; n <= 48; n += 16) {
+    for (uint32_t n = 16; n <= 24; n += 8) {
       for (size_t k = 1; k <= 20; k += 5) {
         GemmMicrokernelTester()
           .mr(4)
-          .nr(16)
+          .nr(8)
           .kr(1)
           .sr(1)
           .m(4)
           .n(n)
           .k(k)
           .a_stride(23)
-          .Test(xnn_f16_gemm_minmax_ukernel_4x16__neonfp16arith_ld64, xnn_init_f16_scaleminmax_neon_params);
+          .Test(xnn_f16_gemm_minmax_ukernel_4x8__neonfp16arith_ld64, xnn_init_f16_scaleminmax_neon_params);
       }
     }
   }
 
-  TEST(F16_GEMM_MINMAX_4X16__NEONFP16ARITH_LD64, n_div_16_subtile) {
+  TEST(F16_GEMM_MINMAX_4X8__NEONFP16ARITH_LD64, n_div_8_subtile) {
     TEST_REQUIRES_ARM_NEON_FP16_ARITH;
-    for (uint32_t n = 32; n <= 48; n += 16) {
+    for (uint32_t n = 16; n <= 24; n += 8) {
       for (size_t k = 1; k <= 20; k += 5) {
         for (uint32_t m = 1; m <= 4; m++) {
           GemmMicrokernelTester()
             .mr(4)
-            .nr(16)
+            .nr(8)
             .kr(1)
             .sr(1)
             .m(m)
             .n(n)
             .k(k)
             .iterations(1)
-            .Test(xnn_f16_gemm_minmax_ukernel_4x16__neonfp16arith_ld64, xnn_init_f16_scaleminmax_neon_params);
+            .Test(xnn_f16_gemm_minmax_ukernel_4x8__neonfp16arith_ld64, xnn_init_f16_scaleminmax_neon_params);
         }
       }
     }
   }
 
-  TEST(F16_GEMM_MINMAX_4X16__NEONFP16ARITH_LD64, strided_cm_subtile) {
+  TEST(F16_GEMM_MINMAX_4X8__NEONFP16ARITH_LD64, strided_cm_subtile) {
     TEST_REQUIRES_ARM_NEON_FP16_ARITH;
     for (size_t k = 1; k <= 20; k += 5) {
-      for (uint32_t n = 1; n <= 16; n++) {
+      for (uint32_t n = 1; n <= 8; n++) {
         for (uint32_t m = 1; m <= 4; m++) {
           GemmMicrokernelTester()
             .mr(4)
-            .nr(16)
+            .nr(8)
             .kr(1)
             .sr(1)
             .m(m)
             .n(n)
             .k(k)
-            .cm_stride(19)
+            .cm_stride(11)
             .iterations(1)
-            .Test(xnn_f16_gemm_minmax_ukernel_4x16__neonfp16arith_ld64, xnn_init_f16_scaleminmax_neon_params);
+            .Test(xnn_f16_gemm_minmax_ukernel_4x8__neonfp16arith_ld64, xnn_init_f16_scaleminmax_neon_params);
         }
       }
     }
   }
 
-  TEST(F16_GEMM_MINMAX_4X16__NEONFP16ARITH_LD64, qmin) {
+  TEST(F16_GEMM_MINMAX_4X8__NEONFP16ARITH_LD64, qmin) {
     TEST_REQUIRES_ARM_NEON_FP16_ARITH;
     GemmMicrokernelTester()
       .mr(4)
-      .nr(16)
+      .nr(8)
       .kr(1)
       .sr(1)
       .m(4)
-      .n(16)
+      .n(8)
       .k(4)
       .qmin(128)
-      .Test(xnn_f16_gemm_minmax_ukernel_4x16__neonfp16arith_ld64, xnn_init_f16_scaleminmax_neon_params);
+      .Test(xnn_f16_gemm_minmax_ukernel_4x8__neonfp16arith_ld64, xnn_init_f16_scaleminmax_neon_params);
   }
 
-  TEST(F16_GEMM_MINMAX_4X16__NEONFP16ARITH_LD64, qmax) {
+  TEST(F16_GEMM_MINMAX_4X8__NEONFP16ARITH_LD64, qmax) {
     TEST_REQUIRES_ARM_NEON_FP16_ARITH;
     GemmMicrokernelTester()
       .mr(4)
-      .nr(16)
+      .nr(8)
       .kr(1)
       .sr(1)
       .m(4)
-      .n(16)
+      .n(8)
       .k(4)
       .qmax(128)
-      .Test(xnn_f16_gemm_minmax_ukernel_4x16__neonfp16arith_ld64, xnn_init_f16_scaleminmax_neon_params);
+      .Test(xnn_f16_gemm_minmax_ukernel_4x8__neonfp16arith_ld64, xnn_init_f16_scaleminmax_neon_params);
   }
 
-  TEST(F16_GEMM_MINMAX_4X16__NEONFP16ARITH_LD64, strided_cm) {
+  TEST(F16_GEMM_MINMAX_4X8__NEONFP16ARITH_LD64, strided_cm) {
     TEST_REQUIRES_ARM_NEON_FP16_ARITH;
     GemmMicrokernelTester()
       .mr(4)
-      .nr(16)
+      .nr(8)
       .kr(1)
       .sr(1)
       .m(4)
-      .n(16)
+      .n(8)
       .k(4)
-      .cm_stride(19)
-      .Test(xnn_f16_gemm_minmax_ukernel_4x16__neonfp16arith_ld64, xnn_init_f16_scaleminmax_neon_params);
+      .cm_stride(11)
+      .Test(xnn_f16_gemm_minmax_ukernel_4x8__neonfp16arith_ld64, xnn_init_f16_scaleminmax_neon_params);
   }
 #endif  // XNN_ARCH_ARM64
 
 
 #if XNN_ARCH_ARM64
-  TEST(F16_GEMM_MINMAX_6X8__NEONFP16ARITH_LD64, k_eq_4) {
+  TEST(F16_GEMM_MINMAX_4X16__NEONFP16ARITH_LD64, k_eq_4) {
     TEST_REQUIRES_ARM_NEON_FP16_ARITH;
     GemmMicrokernelTester()
-      .mr(6)
-      .nr(8)
+      .mr(4)
+      .nr(16)
       .kr(1)
       .sr(1)
-      .m(6)
-      .n(8)
+      .m(4)
+      .n(16)
       .k(4)
-      .Test(xnn_f16_gemm_minmax_ukernel_6x8__neonfp16arith_ld64, xnn_init_f16_scaleminmax_neon_params);
+      .Test(xnn_f16_gemm_minmax_ukernel_4x16__neonfp16arith_ld64, xnn_init_f16_scaleminmax_neon_params);
   }
 
-  TEST(F16_GEMM_MINMAX_6X8__NEONFP16ARITH_LD64, strided_cn) {
+  TEST(F16_GEMM_MINMAX_4X16__NEONFP16ARITH_LD64, strided_cn) {
     TEST_REQUIRES_ARM_NEON_FP16_ARITH;
     GemmMicrokernelTester()
-      .mr(6)
-      .nr(8)
+      .mr(4)
+      .nr(16)
       .kr(1)
       .sr(1)
-      .m(6)
-      .n(8)
+      .m(4)
+      .n(16)
       .k(4)
-      .cn_stride(11)
-      .Test(xnn_f16_gemm_minmax_ukernel_6x8__neonfp16arith_ld64, xnn_init_f16_scaleminmax_neon_params);
+      .cn_stride(19)
+      .Test(xnn_f16_gemm_minmax_ukernel_4x16__neonfp16arith_ld64, xnn_init_f16_scaleminmax_neon_params);
   }
 
-  TEST(F16_GEMM_MINMAX_6X8__NEONFP16ARITH_LD64, k_eq_4_strided_a) {
+  TEST(F16_GEMM_MINMAX_4X16__NEONFP16ARITH_LD64, k_eq_4_strided_a) {
     TEST_REQUIRES_ARM_NEON_FP16_ARITH;
     GemmMicrokernelTester()
-      .mr(6)
-      .nr(8)
+      .mr(4)
+      .nr(16)
       .kr(1)
       .sr(1)
-      .m(6)
-      .n(8)
+      .m(4)
+      .n(16)
       .k(4)
       .a_stride(7)
-      .Test(xnn_f16_gemm_minmax_ukernel_6x8__neonfp16arith_ld64, xnn_init_f16_scaleminmax_neon_params);
+      .Test(xnn_f16_gemm_minmax_ukernel_4x16__neonfp16arith_ld64, xnn_init_f16_scaleminmax_neon_params);
   }
 
-  TEST(F16_GEMM_MINMAX_6X8__NEONFP16ARITH_LD64, k_eq_4_subtile) {
+  TEST(F16_GEMM_MINMAX_4X16__NEONFP16ARITH_LD64, k_eq_4_subtile) {
     TEST_REQUIRES_ARM_NEON_FP16_ARITH;
-    for (uint32_t n = 1; n <= 8; n++) {
-      for (uint32_t m = 1; m <= 6; m++) {
+    for (uint32_t n = 1; n <= 16; n++) {
+      for (uint32_t m = 1; m <= 4; m++) {
         GemmMicrokernelTester()
-          .mr(6)
-          .nr(8)
+          .mr(4)
+          .nr(16)
           .kr(1)
           .sr(1)
           .m(m)
           .n(n)
           .k(4)
           .iterations(1)
-          .Test(xnn_f16_gemm_minmax_ukernel_6x8__neonfp16arith_ld64, xnn_init_f16_scaleminmax_neon_params);
+          .Test(xnn_f16_gemm_minmax_ukernel_4x16__neonfp16arith_ld64, xnn_init_f16_scaleminmax_neon_params);
       }
     }
   }
 
-  TEST(F16_GEMM_MINMAX_6X8__NEONFP16ARITH_LD64, k_eq_4_subtile_m) {
+  TEST(F16_GEMM_MINMAX_4X16__NEONFP16ARITH_LD64, k_eq_4_subtile_m) {
     TEST_REQUIRES_ARM_NEON_FP16_ARITH;
-    for (uint32_t m = 1; m <= 6; m++) {
+    for (uint32_t m = 1; m <= 4; m++) {
       GemmMicrokernelTester()
-        .mr(6)
-        .nr(8)
+        .mr(4)
+        .nr(16)
         .kr(1)
         .sr(1)
         .m(m)
-        .n(8)
+        .n(16)
         .k(4)
         .iterations(1)
-        .Test(xnn_f16_gemm_minmax_ukernel_6x8__neonfp16arith_ld64, xnn_init_f16_scaleminmax_neon_params);
+        .Test(xnn_f16_gemm_minmax_ukernel_4x16__neonfp16arith_ld64, xnn_init_f16_scaleminmax_neon_params);
     }
   }
 
-  TEST(F16_GEMM_MINMAX_6X8__NEONFP16ARITH_LD64, k_eq_4_subtile_n) {
+  TEST(F16_GEMM_MINMAX_4X16__NEONFP16ARITH_LD64, k_eq_4_subtile_n) {
     TEST_REQUIRES_ARM_NEON_FP16_ARITH;
-    for (uint32_t n = 1; n <= 8; n++) {
+    for (uint32_t n = 1; n <= 16; n++) {
       GemmMicrokernelTester()
-        .mr(6)
-        .nr(8)
+        .mr(4)
+        .nr(16)
         .kr(1)
         .sr(1)
-        .m(6)
+        .m(4)
         .n(n)
         .k(4)
         .iterations(1)
-        .Test(xnn_f16_gemm_minmax_ukernel_6x8__neonfp16arith_ld64, xnn_init_f16_scaleminmax_neon_params);
+        .Test(xnn_f16_gemm_minmax_ukernel_4x16__neonfp16arith_ld64, xnn_init_f16_scaleminmax_neon_params);
     }
   }
 
-  TEST(F16_GEMM_MINMAX_6X8__NEONFP16ARITH_LD64, k_lt_4) {
+  TEST(F16_GEMM_MINMAX_4X16__NEONFP16ARITH_LD64, k_lt_4) {
     TEST_REQUIRES_ARM_NEON_FP16_ARITH;
     for (size_t k = 1; k < 4; k++) {
       GemmMicrokernelTester()
-        .mr(6)
-        .nr(8)
+        .mr(4)
+        .nr(16)
         .kr(1)
         .sr(1)
-        .m(6)
-        .n(8)
+        .m(4)
+        .n(16)
         .k(k)
-        .Test(xnn_f16_gemm_minmax_ukernel_6x8__neonfp16arith_ld64, xnn_init_f16_scaleminmax_neon_params);
+        .Test(xnn_f16_gemm_minmax_ukernel_4x16__neonfp16arith_ld64, xnn_init_f16_scaleminmax_neon_params);
     }
   }
 
-  TEST(F16_GEMM_MINMAX_6X8__NEONFP16ARITH_LD64, k_lt_4_strided_a) {
+  TEST(F16_GEMM_MINMAX_4X16__NEONFP16ARITH_LD64, k_lt_4_strided_a) {
     TEST_REQUIRES_ARM_NEON_FP16_ARITH;
     for (size_t k = 1; k < 4; k++) {
       GemmMicrokernelTester()
-        .mr(6)
-        .nr(8)
+        .mr(4)
+        .nr(16)
         .kr(1)
         .sr(1)
-        .m(6)
-        .n(8)
+        .m(4)
+        .n(16)
         .k(k)
         .a_stride(7)
-        .Test(xnn_f16_gemm_minmax_ukernel_6x8__neonfp16arith_ld64, xnn_init_f16_scaleminmax_neon_params);
+        .Test(xnn_f16_gemm_minmax_ukernel_4x16__neonfp16arith_ld64, xnn_init_f16_scaleminmax_neon_params);
     }
   }
 
-  TEST(F16_GEMM_MINMAX_6X8__NEONFP16ARITH_LD64, k_lt_4_subtile) {
+  TEST(F16_GEMM_MINMAX_4X16__NEONFP16ARITH_LD64, k_lt_4_subtile) {
     TEST_REQUIRES_ARM_NEON_FP16_ARITH;
     for (size_t k = 1; k < 4; k++) {
-      for (uint32_t n = 1; n <= 8; n++) {
-        for (uint32_t m = 1; m <= 6; m++) {
+      for (uint32_t n = 1; n <= 16; n++) {
+        for (uint32_t m = 1; m <= 4; m++) {
           GemmMicrokernelTester()
-            .mr(6)
-            .nr(8)
+            .mr(4)
+            .nr(16)
             .kr(1)
             .sr(1)
             .m(m)
             .n(n)
             .k(k)
             .iterations(1)
-            .Test(xnn_f16_gemm_minmax_ukernel_6x8__neonfp16arith_ld64, xnn_init_f16_scaleminmax_neon_params);
+            .Test(xnn_f16_gemm_minmax_ukernel_4x16__neonfp16arith_ld64, xnn_init_f16_scaleminmax_neon_params);
         }
       }
     }
   }
 
-  TEST(F16_GEMM_MINMAX_6X8__NEONFP16ARITH_LD64, k_gt_4) {
+  TEST(F16_GEMM_MINMAX_4X16__NEONFP16ARITH_LD64, k_gt_4) {
     TEST_REQUIRES_ARM_NEON_FP16_ARITH;
     for (size_t k = 5; k < 8; k++) {
       GemmMicrokernelTester()
-        .mr(6)
-        .nr(8)
+        .mr(4)
+        .nr(16)
         .kr(1)
         .sr(1)
-        .m(6)
-        .n(8)
+        .m(4)
+        .n(16)
         .k(k)
-        .Test(xnn_f16_gemm_minmax_ukernel_6x8__neonfp16arith_ld64, xnn_init_f16_scaleminmax_neon_params);
+        .Test(xnn_f16_gemm_minmax_ukernel_4x16__neonfp16arith_ld64, xnn_init_f16_scaleminmax_neon_params);
     }
   }
 
-  TEST(F16_GEMM_MINMAX_6X8__NEONFP16ARITH_LD64, k_gt_4_strided_a) {
+  TEST(F16_GEMM_MINMAX_4X16__NEONFP16ARITH_LD64, k_gt_4_strided_a) {
     TEST_REQUIRES_ARM_NEON_FP16_ARITH;
     for (size_t k = 5; k < 8; k++) {
       GemmMicrokernelTester()
-        .mr(6)
-        .nr(8)
+        .mr(4)
+        .nr(16)
         .kr(1)
         .sr(1)
-        .m(6)
-        .n(8)
+        .m(4)
+        .n(16)
         .k(k)
         .a_stride(11)
-        .Test(xnn_f16_gemm_minmax_ukernel_6x8__neonfp16arith_ld64, xnn_init_f16_scaleminmax_neon_params);
+        .Test(xnn_f16_gemm_minmax_ukernel_4x16__neonfp16arith_ld64, xnn_init_f16_scaleminmax_neon_params);
     }
   }
 
-  TEST(F16_GEMM_MINMAX_6X8__NEONFP16ARITH_LD64, k_gt_4_subtile) {
+  TEST(F16_GEMM_MINMAX_4X16__NEONFP16ARITH_LD64, k_gt_4_subtile) {
     TEST_REQUIRES_ARM_NEON_FP16_ARITH;
     for (size_t k = 5; k < 8; k++) {
-      for (uint32_t n = 1; n <= 8; n++) {
-        for (uint32_t m = 1; m <= 6; m++) {
+      for (uint32_t n = 1; n <= 16; n++) {
+        for (uint32_t m = 1; m <= 4; m++) {
           GemmMicrokernelTester()
-            .mr(6)
-            .nr(8)
+            .mr(4)
+            .nr(16)
             .kr(1)
             .sr(1)
             .m(m)
             .n(n)
             .k(k)
             .iterations(1)
-            .Test(xnn_f16_gemm_minmax_ukernel_6x8__neonfp16arith_ld64, xnn_init_f16_scaleminmax_neon_params);
+            .Test(xnn_f16_gemm_minmax_ukernel_4x16__neonfp16arith_ld64, xnn_init_f16_scaleminmax_neon_params);
         }
       }
     }
   }
 
-  TEST(F16_GEMM_MINMAX_6X8__NEONFP16ARITH_LD64, k_div_4) {
+  TEST(F16_GEMM_MINMAX_4X16__NEONFP16ARITH_LD64, k_div_4) {
     TEST_REQUIRES_ARM_NEON_FP16_ARITH;
     for (size_t k = 8; k <= 40; k += 4) {
       GemmMicrokernelTester()
-        .mr(6)
-        .nr(8)
+        .mr(4)
+        .nr(16)
         .kr(1)
         .sr(1)
-        .m(6)
-        .n(8)
+        .m(4)
+        .n(16)
         .k(k)
-        .Test(xnn_f16_gemm_minmax_ukernel_6x8__neonfp16arith_ld64, xnn_init_f16_scaleminmax_neon_params);
+        .Test(xnn_f16_gemm_minmax_ukernel_4x16__neonfp16arith_ld64, xnn_init_f16_scaleminmax_neon_params);
     }
   }
 
-  TEST(F16_GEMM_MINMAX_6X8__NEONFP16ARITH_LD64, k_div_4_strided_a) {
+  TEST(F16_GEMM_MINMAX_4X16__NEONFP16ARITH_LD64, k_div_4_strided_a) {
     TEST_REQUIRES_ARM_NEON_FP16_ARITH;
     for (size_t k = 8; k <= 40; k += 4) {
       GemmMicrokernelTester()
-        .mr(6)
-        .nr(8)
+        .mr(4)
+        .nr(16)
         .kr(1)
         .sr(1)
-        .m(6)
-        .n(8)
+        .m(4)
+        .n(16)
         .k(k)
         .a_stride(43)
-        .Test(xnn_f16_gemm_minmax_ukernel_6x8__neonfp16arith_ld64, xnn_init_f16_scaleminmax_neon_params);
+        .Test(xnn_f16_gemm_minmax_ukernel_4x16__neonfp16arith_ld64, xnn_init_f16_scaleminmax_neon_params);
     }
   }
 
-  TEST(F16_GEMM_MINMAX_6X8__NEONFP16ARITH_LD64, k_div_4_subtile) {
+  TEST(F16_GEMM_MINMAX_4X16__NEONFP16ARITH_LD64, k_div_4_subtile) {
     TEST_REQUIRES_ARM_NEON_FP16_ARITH;
     for (size_t k = 8; k <= 40; k += 4) {
-      for (uint32_t n = 1; n <= 8; n++) {
-        for (uint32_t m = 1; m <= 6; m++) {
+      for (uint32_t n = 1; n <= 16; n++) {
+        for (uint32_t m = 1; m <= 4; m++) {
           GemmMicrokernelTester()
-            .mr(6)
-            .nr(8)
+            .mr(4)
+            .nr(16)
             .kr(1)
             .sr(1)
             .m(m)
             .n(n)
             .k(k)
             .iterations(1)
-            .Test(xnn_f16_gemm_minmax_ukernel_6x8__neonfp16arith_ld64, xnn_init_f16_scaleminmax_neon_params);
+            .Test(xnn_f16_gemm_minmax_ukernel_4x16__neonfp16arith_ld64, xnn_init_f16_scaleminmax_neon_params);
         }
       }
     }
   }
 
-  TEST(F16_GEMM_MINMAX_6X8__NEONFP16ARITH_LD64, n_gt_8) {
+  TEST(F16_GEMM_MINMAX_4X16__NEONFP16ARITH_LD64, n_gt_16) {
     TEST_REQUIRES_ARM_NEON_FP16_ARITH;
-    for (uint32_t n = 9; n < 16; n++) {
+    for (uint32_t n = 17; n < 32; n++) {
       for (size_t k = 1; k <= 20; k += 5) {
         GemmMicrokernelTester()
-          .mr(6)
-          .nr(8)
+          .mr(4)
+          .nr(16)
           .kr(1)
           .sr(1)
-          .m(6)
+          .m(4)
           .n(n)
           .k(k)
-          .Test(xnn_f16_gemm_minmax_ukernel_6x8__neonfp16arith_ld64, xnn_init_f16_scaleminmax_neon_params);
+          .Test(xnn_f16_gemm_minmax_ukernel_4x16__neonfp16arith_ld64, xnn_init_f16_scaleminmax_neon_params);
       }
     }
   }
 
-  TEST(F16_GEMM_MINMAX_6X8__NEONFP16ARITH_LD64, n_gt_8_strided_cn) {
+  TEST(F16_GEMM_MINMAX_4X16__NEONFP16ARITH_LD64, n_gt_16_strided_cn) {
     TEST_REQUIRES_ARM_NEON_FP16_ARITH;
-    for (uint32_t n = 9; n < 16; n++) {
+    for (uint32_t n = 17; n < 32; n++) {
       for (size_t k = 1; k <= 20; k += 5) {
         GemmMicrokernelTester()
-          .mr(6)
-          .nr(8)
+          .mr(4)
+          .nr(16)
           .kr(1)
           .sr(1)
-          .m(6)
+          .m(4)
           .n(n)
           .k(k)
-          .cn_stride(11)
-          .Test(xnn_f16_gemm_minmax_ukernel_6x8__neonfp16arith_ld64, xnn_init_f16_scaleminmax_neon_params);
+          .cn_stride(19)
+          .Test(xnn_f16_gemm_minmax_ukernel_4x16__neonfp16arith_ld64, xnn_init_f16_scaleminmax_neon_params);
       }
     }
   }
 
-  TEST(F16_GEMM_MINMAX_6X8__NEONFP16ARITH_LD64, n_gt_8_strided_a) {
+  TEST(F16_GEMM_MINMAX_4X16__NEONFP16ARITH_LD64, n_gt_16_strided_a) {
     TEST_REQUIRES_ARM_NEON_FP16_ARITH;
-    for (uint32_t n = 9; n < 16; n++) {
+    for (uint32_t n = 17; n < 32; n++) {
       for (size_t k = 1; k <= 20; k += 5) {
         GemmMicrokernelTester()
-          .mr(6)
-          .nr(8)
+          .mr(4)
+          .nr(16)
           .kr(1)
           .sr(1)
-          .m(6)
+          .m(4)
           .n(n)
           .k(k)
           .a_stride(23)
-          .Test(xnn_f16_gemm_minmax_ukernel_6x8__neonfp16arith_ld64, xnn_init_f16_scaleminmax_neon_params);
+          .Test(xnn_f16_gemm_minmax_ukernel_4x16__neonfp16arith_ld64, xnn_init_f16_scaleminmax_neon_params);
       }
     }
   }
 
-  TEST(F16_GEMM_MINMAX_6X8__NEONFP16ARITH_LD64, n_gt_8_subtile) {
+  TEST(F16_GEMM_MINMAX_4X16__NEONFP16ARITH_LD64, n_gt_16_subtile) {
     TEST_REQUIRES_ARM_NEON_FP16_ARITH;
-    for (uint32_t n = 9; n < 16; n++) {
+    for (uint32_t n = 17; n < 32; n++) {
       for (size_t k = 1; k <= 20; k += 5) {
-        for (uint32_t m = 1; m <= 6; m++) {
+        for (uint32_t m = 1; m <= 4; m++) {
           GemmMicrokernelTester()
-            .mr(6)
-            .nr(8)
+            .mr(4)
+            .nr(16)
             .kr(1)
             .sr(1)
             .m(m)
             .n(n)
             .k(k)
             .iterations(1)
-            .Test(xnn_f16_gemm_minmax_ukernel_6x8__neonfp16arith_ld64, xnn_init_f16_scaleminmax_neon_params);
+            .Test(xnn_f16_gemm_minmax_ukernel_4x16__neonfp16arith_ld64, xnn_init_f16_scaleminmax_neon_params);
         }
       }
     }
   }
 
-  TEST(F16_GEMM_MINMAX_6X8__NEONFP16ARITH_LD64, n_div_8) {
+  TEST(F16_GEMM_MINMAX_4X16__NEONFP16ARITH_LD64, n_div_16) {
     TEST_REQUIRES_ARM_NEON_FP16_ARITH;
-    for (uint32_t n = 16; n <= 24; n += 8) {
+    for (uint32_t n = 32; n <= 48; n += 16) {
       for (size_t k = 1; k <= 20; k += 5) {
         GemmMicrokernelTester()
-          .mr(6)
-          .nr(8)
+          .mr(4)
+          .nr(16)
           .kr(1)
           .sr(1)
-          .m(6)
+          .m(4)
           .n(n)
           .k(k)
-          .Test(xnn_f16_gemm_minmax_ukernel_6x8__neonfp16arith_ld64, xnn_init_f16_scaleminmax_neon_params);
+          .Test(xnn_f16_gemm_minmax_ukernel_4x16__neonfp16arith_ld64, xnn_init_f16_scaleminmax_neon_params);
       }
     }
   }
 
-  TEST(F16_GEMM_MINMAX_6X8__NEONFP16ARITH_LD64, n_div_8_strided_cn) {
+  TEST(F16_GEMM_MINMAX_4X16__NEONFP16ARITH_LD64, n_div_16_strided_cn) {
     TEST_REQUIRES_ARM_NEON_FP16_ARITH;
-    for (uint32_t n = 16; n <= 24; n += 8) {
+    for (uint32_t n = 32; n <= 48; n += 16) {
       for (size_t k = 1; k <= 20; k += 5) {
         GemmMicrokernelTester()
-          .mr(6)
-          .nr(8)
+          .mr(4)
+          .nr(16)
           .kr(1)
           .sr(1)
-          .m(6)
+          .m(4)
           .n(n)
           .k(k)
-          .cn_stride(11)
-          .Test(xnn_f16_gemm_minmax_ukernel_6x8__neonfp16arith_ld64, xnn_init_f16_scaleminmax_neon_params);
+          .cn_stride(19)
+          .Test(xnn_f16_gemm_minmax_ukernel_4x16__neonfp16arith_ld64, xnn_init_f16_scaleminmax_neon_params);
       }
     }
   }
 
-  TEST(F16_GEMM_MINMAX_6X8__NEONFP16ARITH_LD64, n_div_8_strided_a) {
+  TEST(F16_GEMM_MINMAX_4X16__NEONFP16ARITH_LD64, n_div_16_strided_a) {
     TEST_REQUIRES_ARM_NEON_FP16_ARITH;
-    for (uint32_t n = 16; n <= 24; n += 8) {
+    for (uint32_t n = 32; n <= 48; n += 16) {
       for (size_t k = 1; k <= 20; k += 5) {
         GemmMicrokernelTester()
-          .mr(6)
-          .nr(8)
+          .mr(4)
+          .nr(16)
           .kr(1)
           .sr(1)
-          .m(6)
+          .m(4)
           .n(n)
           .k(k)
           .a_stride(23)
-          .Test(xnn_f16_gemm_minmax_ukernel_6x8__neonfp16arith_ld64, xnn_init_f16_scaleminmax_neon_params);
+          .Test(xnn_f16_gemm_minmax_ukernel_4x16__neonfp16arith_ld64, xnn_init_f16_scaleminmax_neon_params);
       }
     }
   }
 
-  TEST(F16_GEMM_MINMAX_6X8__NEONFP16ARITH_LD64, n_div_8_subtile) {
+  TEST(F16_GEMM_MINMAX_4X16__NEONFP16ARITH_LD64, n_div_16_subtile) {
     TEST_REQUIRES_ARM_NEON_FP16_ARITH;
-    for (uint32_t n = 16; n <= 24; n += 8) {
+    for (uint32_t n = 32; n <= 48; n += 16) {
       for (size_t k = 1; k <= 20; k += 5) {
-        for (uint32_t m = 1; m <= 6; m++) {
+        for (uint32_t m = 1; m <= 4; m++) {
           GemmMicrokernelTester()
-            .mr(6)
-            .nr(8)
+            .mr(4)
+            .nr(16)
             .kr(1)
             .sr(1)
             .m(m)
             .n(n)
             .k(k)
             .iterations(1)
-            .Test(xnn_f16_gemm_minmax_ukernel_6x8__neonfp16arith_ld64, xnn_init_f16_scaleminmax_neon_params);
+            .Test(xnn_f16_gemm_minmax_ukernel_4x16__neonfp16arith_ld64, xnn_init_f16_scaleminmax_neon_params);
         }
       }
     }
   }
 
-  TEST(F16_GEMM_MINMAX_6X8__NEONFP16ARITH_LD64, strided_cm_subtile) {
+  TEST(F16_GEMM_MINMAX_4X16__NEONFP16ARITH_LD64, strided_cm_subtile) {
     TEST_REQUIRES_ARM_NEON_FP16_ARITH;
     for (size_t k = 1; k <= 20; k += 5) {
-      for (uint32_t n = 1; n <= 8; n++) {
-        for (uint32_t m = 1; m <= 6; m++) {
+      for (uint32_t n = 1; n <= 16; n++) {
+        for (uint32_t m = 1; m <= 4; m++) {
           GemmMicrokernelTester()
-            .mr(6)
-            .nr(8)
+            .mr(4)
+            .nr(16)
             .kr(1)
             .sr(1)
             .m(m)
             .n(n)
             .k(k)
-            .cm_stride(11)
+            .cm_stride(19)
             .iterations(1)
-            .Test(xnn_f16_gemm_minmax_ukernel_6x8__neonfp16arith_ld64, xnn_init_f16_scaleminmax_neon_params);
+            .Test(xnn_f16_gemm_minmax_ukernel_4x16__neonfp16arith_ld64, xnn_init_f16_scaleminmax_neon_params);
         }
       }
     }
   }
 
-  TEST(F16_GEMM_MINMAX_6X8__NEONFP16ARITH_LD64, qmin) {
+  TEST(F16_GEMM_MINMAX_4X16__NEONFP16ARITH_LD64, qmin) {
     TEST_REQUIRES_ARM_NEON_FP16_ARITH;
     GemmMicrokernelTester()
-      .mr(6)
-      .nr(8)
+      .mr(4)
+      .nr(16)
       .kr(1)
       .sr(1)
-      .m(6)
-      .n(8)
+      .m(4)
+      .n(16)
       .k(4)
       .qmin(128)
-      .Test(xnn_f16_gemm_minmax_ukernel_6x8__neonfp16arith_ld64, xnn_init_f16_scaleminmax_neon_params);
+      .Test(xnn_f16_gemm_minmax_ukernel_4x16__neonfp16arith_ld64, xnn_init_f16_scaleminmax_neon_params);
   }
 
-  TEST(F16_GEMM_MINMAX_6X8__NEONFP16ARITH_LD64, qmax) {
+  TEST(F16_GEMM_MINMAX_4X16__NEONFP16ARITH_LD64, qmax) {
     TEST_REQUIRES_ARM_NEON_FP16_ARITH;
     GemmMicrokernelTester()
-      .mr(6)
-      .nr(8)
+      .mr(4)
+      .nr(16)
       .kr(1)
       .sr(1)
-      .m(6)
-      .n(8)
+      .m(4)
+      .n(16)
       .k(4)
       .qmax(128)
-      .Test(xnn_f16_gemm_minmax_ukernel_6x8__neonfp16arith_ld64, xnn_init_f16_scaleminmax_neon_params);
+      .Test(xnn_f16_gemm_minmax_ukernel_4x16__neonfp16arith_ld64, xnn_init_f16_scaleminmax_neon_params);
   }
 
-  TEST(F16_GEMM_MINMAX_6X8__NEONFP16ARITH_LD64, strided_cm) {
+  TEST(F16_GEMM_MINMAX_4X16__NEONFP16ARITH_LD64, strided_cm) {
     TEST_REQUIRES_ARM_NEON_FP16_ARITH;
     GemmMicrokernelTester()
-      .mr(6)
-      .nr(8)
+      .mr(4)
+      .nr(16)
       .kr(1)
       .sr(1)
-      .m(6)
-      .n(8)
+      .m(4)
+      .n(16)
       .k(4)
-      .cm_stride(11)
-      .Test(xnn_f16_gemm_minmax_ukernel_6x8__neonfp16arith_ld64, xnn_init_f16_scaleminmax_neon_params);
+      .cm_stride(19)
+      .Test(xnn_f16_gemm_minmax_ukernel_4x16__neonfp16arith_ld64, xnn_init_f16_scaleminmax_neon_params);
   }
 #endif  // XNN_ARCH_ARM64
 
 
 #if XNN_ARCH_ARM64
-  TEST(F16_GEMM_MINMAX_6X16__NEONFP16ARITH_LD64, k_eq_4) {
+  TEST(F16_GEMM_MINMAX_6X8__NEONFP16ARITH_LD64, k_eq_4) {
     TEST_REQUIRES_ARM_NEON_FP16_ARITH;
     GemmMicrokernelTester()
       .mr(6)
-      .nr(16)
+      .nr(8)
       .kr(1)
       .sr(1)
       .m(6)
-      .n(16)
+      .n(8)
       .k(4)
-      .Test(xnn_f16_gemm_minmax_ukernel_6x16__neonfp16arith_ld64, xnn_init_f16_scaleminmax_neon_params);
+      .Test(xnn_f16_gemm_minmax_ukernel_6x8__neonfp16arith_ld64, xnn_init_f16_scaleminmax_neon_params);
   }
 
-  TEST(F16_GEMM_MINMAX_6X16__NEONFP16ARITH_LD64, strided_cn) {
+  TEST(F16_GEMM_MINMAX_6X8__NEONFP16ARITH_LD64, strided_cn) {
     TEST_REQUIRES_ARM_NEON_FP16_ARITH;
     GemmMicrokernelTester()
       .mr(6)
-      .nr(16)
+      .nr(8)
       .kr(1)
       .sr(1)
       .m(6)
-      .n(16)
+      .n(8)
       .k(4)
-      .cn_stride(19)
-      .Test(xnn_f16_gemm_minmax_ukernel_6x16__neonfp16arith_ld64, xnn_init_f16_scaleminmax_neon_params);
+      .cn_stride(11)
+      .Test(xnn_f16_gemm_minmax_ukernel_6x8__neonfp16arith_ld64, xnn_init_f16_scaleminmax_neon_params);
   }
 
-  TEST(F16_GEMM_MINMAX_6X16__NEONFP16ARITH_LD64, k_eq_4_strided_a) {
+  TEST(F16_GEMM_MINMAX_6X8__NEONFP16ARITH_LD64, k_eq_4_strided_a) {
     TEST_REQUIRES_ARM_NEON_FP16_ARITH;
     GemmMicrokernelTester()
       .mr(6)
-      .nr(16)
+      .nr(8)
       .kr(1)
       .sr(1)
       .m(6)
-      .n(16)
+      .n(8)
       .k(4)
       .a_stride(7)
-      .Test(xnn_f16_gemm_minmax_ukernel_6x16__neonfp16arith_ld64, xnn_init_f16_scaleminmax_neon_params);
+      .Test(xnn_f16_gemm_minmax_ukernel_6x8__neonfp16arith_ld64, xnn_init_f16_scaleminmax_neon_params);
   }
 
-  TEST(F16_GEMM_MINMAX_6X16__NEONFP16ARITH_LD64, k_eq_4_subtile) {
+  TEST(F16_GEMM_MINMAX_6X8__NEONFP16ARITH_LD64, k_eq_4_subtile) {
     TEST_REQUIRES_ARM_NEON_FP16_ARITH;
-    for (uint32_t n = 1; n <= 16; n++) {
+    for (uint32_t n = 1; n <= 8; n++) {
       for (uint32_t m = 1; m <= 6; m++) {
         GemmMicrokernelTester()
           .mr(6)
-          .nr(16)
+          .nr(8)
           .kr(1)
           .sr(1)
           .m(m)
           .n(n)
           .k(4)
           .iterations(1)
-          .Test(xnn_f16_gemm_minmax_ukernel_6x16__neonfp16arith_ld64, xnn_init_f16_scaleminmax_neon_params);
+          .Test(xnn_f16_gemm_minmax_ukernel_6x8__neonfp16arith_ld64, xnn_init_f16_scaleminmax_neon_params);
       }
     }
   }
 
-  TEST(F16_GEMM_MINMAX_6X16__NEONFP16ARITH_LD64, k_eq_4_subtile_m) {
+  TEST(F16_GEMM_MINMAX_6X8__NEONFP16ARITH_LD64, k_eq_4_subtile_m) {
     TEST_REQUIRES_ARM_NEON_FP16_ARITH;
     for (uint32_t m = 1; m <= 6; m++) {
       GemmMicrokernelTester()
         .mr(6)
-        .nr(16)
+        .nr(8)
         .kr(1)
         .sr(1)
         .m(m)
-        .n(16)
+        .n(8)
         .k(4)
         .iterations(1)
-        .Test(xnn_f16_gemm_minmax_ukernel_6x16__neonfp16arith_ld64, xnn_init_f16_scaleminmax_neon_params);
+        .Test(xnn_f16_gemm_minmax_ukernel_6x8__neonfp16arith_ld64, xnn_init_f16_scaleminmax_neon_params);
     }
   }
 
-  TEST(F16_GEMM_MINMAX_6X16__NEONFP16ARITH_LD64, k_eq_4_subtile_n) {
+  TEST(F16_GEMM_MINMAX_6X8__NEONFP16ARITH_LD64, k_eq_4_subtile_n) {
     TEST_REQUIRES_ARM_NEON_FP16_ARITH;
-    for (uint32_t n = 1; n <= 16; n++) {
+    for (uint32_t n = 1; n <= 8; n++) {
       GemmMicrokernelTester()
         .mr(6)
-        .nr(16)
+        .nr(8)
         .kr(1)
         .sr(1)
         .m(6)
         .n(n)
         .k(4)
         .iterations(1)
-        .Test(xnn_f16_gemm_minmax_ukernel_6x16__neonfp16arith_ld64, xnn_init_f16_scaleminmax_neon_params);
+        .Test(xnn_f16_gemm_minmax_ukernel_6x8__neonfp16arith_ld64, xnn_init_f16_scaleminmax_neon_params);
     }
   }
 
-  TEST(F16_GEMM_MINMAX_6X16__NEONFP16ARITH_LD64, k_lt_4) {
+  TEST(F16_GEMM_MINMAX_6X8__NEONFP16ARITH_LD64, k_lt_4) {
     TEST_REQUIRES_ARM_NEON_FP16_ARITH;
     for (size_t k = 1; k < 4; k++) {
       GemmMicrokernelTester()
         .mr(6)
-        .nr(16)
+        .nr(8)
         .kr(1)
         .sr(1)
         .m(6)
-        .n(16)
+        .n(8)
         .k(k)
-        .Test(xnn_f16_gemm_minmax_ukernel_6x16__neonfp16arith_ld64, xnn_init_f16_scaleminmax_neon_params);
+        .Test(xnn_f16_gemm_minmax_ukernel_6x8__neonfp16arith_ld64, xnn_init_f16_scaleminmax_neon_params);
     }
   }
 
-  TEST(F16_GEMM_MINMAX_6X16__NEONFP16ARITH_LD64, k_lt_4_strided_a) {
+  TEST(F16_GEMM_MINMAX_6X8__NEONFP16ARITH_LD64, k_lt_4_strided_a) {
     TEST_REQUIRES_ARM_NEON_FP16_ARITH;
     for (size_t k = 1; k < 4; k++) {
       GemmMicrokernelTester()
         .mr(6)
-        .nr(16)
+        .nr(8)
         .kr(1)
         .sr(1)
         .m(6)
-        .n(16)
+        .n(8)
         .k(k)
         .a_stride(7)
-        .Test(xnn_f16_gemm_minmax_ukernel_6x16__neonfp16arith_ld64, xnn_init_f16_scaleminmax_neon_params);
+        .Test(xnn_f16_gemm_minmax_ukernel_6x8__neonfp16arith_ld64, xnn_init_f16_scaleminmax_neon_params);
     }
   }
 
-  TEST(F16_GEMM_MINMAX_6X16__NEONFP16ARITH_LD64, k_lt_4_subtile) {
+  TEST(F16_GEMM_MINMAX_6X8__NEONFP16ARITH_LD64, k_lt_4_subtile) {
     TEST_REQUIRES_ARM_NEON_FP16_ARITH;
     for (size_t k = 1; k < 4; k++) {
-      for (uint32_t n = 1; n <= 16; n++) {
+      for (uint32_t n = 1; n <= 8; n++) {
         for (uint32_t m = 1; m <= 6; m++) {
           GemmMicrokernelTester()
             .mr(6)
-            .nr(16)
+            .nr(8)
             .kr(1)
             .sr(1)
             .m(m)
             .n(n)
             .k(k)
             .iterations(1)
-            .Test(xnn_f16_gemm_minmax_ukernel_6x16__neonfp16arith_ld64, xnn_init_f16_scaleminmax_neon_params);
+            .Test(xnn_f16_gemm_minmax_ukernel_6x8__neonfp16arith_ld64, xnn_init_f16_scaleminmax_neon_params);
         }
       }
     }
   }
 
-  TEST(F16_GEMM_MINMAX_6X16__NEONFP16ARITH_LD64, k_gt_4) {
+  TEST(F16_GEMM_MINMAX_6X8__NEONFP16ARITH_LD64, k_gt_4) {
     TEST_REQUIRES_ARM_NEON_FP16_ARITH;
     for (size_t k = 5; k < 8; k++) {
       GemmMicrokernelTester()
         .mr(6)
-        .nr(16)
+        .nr(8)
         .kr(1)
         .sr(1)
         .m(6)
-        .n(16)
+        .n(8)
         .k(k)
-        .Test(xnn_f16_gemm_minmax_ukernel_6x16__neonfp16arith_ld64, xnn_init_f16_scaleminmax_neon_params);
+        .Test(xnn_f16_gemm_minmax_ukernel_6x8__neonfp16arith_ld64, xnn_init_f16_scaleminmax_neon_params);
     }
   }
 
-  TEST(F16_GEMM_MINMAX_6X16__NEONFP16ARITH_LD64, k_gt_4_strided_a) {
+  TEST(F16_GEMM_MINMAX_6X8__NEONFP16ARITH_LD64, k_gt_4_strided_a) {
     TEST_REQUIRES_ARM_NEON_FP16_ARITH;
     for (size_t k = 5; k < 8; k++) {
       GemmMicrokernelTester()
         .mr(6)
-        .nr(16)
+        .nr(8)
         .kr(1)
         .sr(1)
         .m(6)
-        .n(16)
+        .n(8)
         .k(k)
         .a_stride(11)
-        .Test(xnn_f16_gemm_minmax_ukernel_6x16__neonfp16arith_ld64, xnn_init_f16_scaleminmax_neon_params);
+        .Test(xnn_f16_gemm_minmax_ukernel_6x8__neonfp16arith_ld64, xnn_init_f16_scaleminmax_neon_params);
     }
   }
 
-  TEST(F16_GEMM_MINMAX_6X16__NEONFP16ARITH_LD64, k_gt_4_subtile) {
+  TEST(F16_GEMM_MINMAX_6X8__NEONFP16ARITH_LD64, k_gt_4_subtile) {
     TEST_REQUIRES_ARM_NEON_FP16_ARITH;
     for (size_t k = 5; k < 8; k++) {
-      for (uint32_t n = 1; n <= 16; n++) {
+      for (uint32_t n = 1; n <= 8; n++) {
         for (uint32_t m = 1; m <= 6; m++) {
           GemmMicrokernelTester()
             .mr(6)
-            .nr(16)
+            .nr(8)
             .kr(1)
             .sr(1)
             .m(m)
             .n(n)
             .k(k)
             .iterations(1)
-            .Test(xnn_f16_gemm_minmax_ukernel_6x16__neonfp16arith_ld64, xnn_init_f16_scaleminmax_neon_params);
+            .Test(xnn_f16_gemm_minmax_ukernel_6x8__neonfp16arith_ld64, xnn_init_f16_scaleminmax_neon_params);
         }
       }
     }
   }
 
-  TEST(F16_GEMM_MINMAX_6X16__NEONFP16ARITH_LD64, k_div_4) {
+  TEST(F16_GEMM_MINMAX_6X8__NEONFP16ARITH_LD64, k_div_4) {
     TEST_REQUIRES_ARM_NEON_FP16_ARITH;
     for (size_t k = 8; k <= 40; k += 4) {
       GemmMicrokernelTester()
         .mr(6)
-        .nr(16)
+        .nr(8)
         .kr(1)
         .sr(1)
         .m(6)
-        .n(16)
+        .n(8)
         .k(k)
-        .Test(xnn_f16_gemm_minmax_ukernel_6x16__neonfp16arith_ld64, xnn_init_f16_scaleminmax_neon_params);
+        .Test(xnn_f16_gemm_minmax_ukernel_6x8__neonfp16arith_ld64, xnn_init_f16_scaleminmax_neon_params);
     }
   }
 
-  TEST(F16_GEMM_MINMAX_6X16__NEONFP16ARITH_LD64, k_div_4_strided_a) {
+  TEST(F16_GEMM_MINMAX_6X8__NEONFP16ARITH_LD64, k_div_4_strided_a) {
     TEST_REQUIRES_ARM_NEON_FP16_ARITH;
     for (size_t k = 8; k <= 40; k += 4) {
       GemmMicrokernelTester()
         .mr(6)
-        .nr(16)
+        .nr(8)
         .kr(1)
         .sr(1)
         .m(6)
-        .n(16)
+        .n(8)
         .k(k)
         .a_stride(43)
-        .Test(xnn_f16_gemm_minmax_ukernel_6x16__neonfp16arith_ld64, xnn_init_f16_scaleminmax_neon_params);
+        .Test(xnn_f16_gemm_minmax_ukernel_6x8__neonfp16arith_ld64, xnn_init_f16_scaleminmax_neon_params);
     }
   }
 
-  TEST(F16_GEMM_MINMAX_6X16__NEONFP16ARITH_LD64, k_div_4_subtile) {
+  TEST(F16_GEMM_MINMAX_6X8__NEONFP16ARITH_LD64, k_div_4_subtile) {
     TEST_REQUIRES_ARM_NEON_FP16_ARITH;
     for (size_t k = 8; k <= 40; k += 4) {
-      for (uint32_t n = 1; n <= 16; n++) {
+      for (uint32_t n = 1; n <= 8; n++) {
         for (uint32_t m = 1; m <= 6; m++) {
           GemmMicrokernelTester()
             .mr(6)
-            .nr(16)
+            .nr(8)
             .kr(1)
             .sr(1)
             .m(m)
             .n(n)
             .k(k)
             .iterations(1)
-            .Test(xnn_f16_gemm_minmax_ukernel_6x16__neonfp16arith_ld64, xnn_init_f16_scaleminmax_neon_params);
+            .Test(xnn_f16_gemm_minmax_ukernel_6x8__neonfp16arith_ld64, xnn_init_f16_scaleminmax_neon_params);
         }
       }
     }
   }
 
-  TEST(F16_GEMM_MINMAX_6X16__NEONFP16ARITH_LD64, n_gt_16) {
+  TEST(F16_GEMM_MINMAX_6X8__NEONFP16ARITH_LD64, n_gt_8) {
     TEST_REQUIRES_ARM_NEON_FP16_ARITH;
-    for (uint32_t n = 17; n < 32; n++) {
+    for (uint32_t n = 9; n < 16; n++) {
       for (size_t k = 1; k <= 20; k += 5) {
         GemmMicrokernelTester()
           .mr(6)
-          .nr(16)
+          .nr(8)
           .kr(1)
           .sr(1)
           .m(6)
           .n(n)
           .k(k)
-          .Test(xnn_f16_gemm_minmax_ukernel_6x16__neonfp16arith_ld64, xnn_init_f16_scaleminmax_neon_params);
+          .Test(xnn_f16_gemm_minmax_ukernel_6x8__neonfp16arith_ld64, xnn_init_f16_scaleminmax_neon_params);
       }
     }
   }
 
-  TEST(F16_GEMM_MINMAX_6X16__NEONFP16ARITH_LD64, n_gt_16_strided_cn) {
+  TEST(F16_GEMM_MINMAX_6X8__NEONFP16ARITH_LD64, n_gt_8_strided_cn) {
     TEST_REQUIRES_ARM_NEON_FP16_ARITH;
-    for (uint32_t n = 17; n < 32; n++) {
+    for (uint32_t n = 9; n < 16; n++) {
       for (size_t k = 1; k <= 20; k += 5) {
         GemmMicrokernelTester()
           .mr(6)
-          .nr(16)
+          .nr(8)
           .kr(1)
           .sr(1)
           .m(6)
           .n(n)
           .k(k)
-          .cn_stride(19)
-          .Test(xnn_f16_gemm_minmax_ukernel_6x16__neonfp16arith_ld64, xnn_init_f16_scaleminmax_neon_params);
+          .cn_stride(11)
+          .Test(xnn_f16_gemm_minmax_ukernel_6x8__neonfp16arith_ld64, xnn_init_f16_scaleminmax_neon_params);
       }
     }
   }
 
-  TEST(F16_GEMM_MINMAX_6X16__NEONFP16ARITH_LD64, n_gt_16_strided_a) {
+  TEST(F16_GEMM_MINMAX_6X8__NEONFP16ARITH_LD64, n_gt_8_strided_a) {
     TEST_REQUIRES_ARM_NEON_FP16_ARITH;
-    for (uint32_t n = 17; n < 32; n++) {
+    for (uint32_t n = 9; n < 16; n++) {
       for (size_t k = 1; k <= 20; k += 5) {
         GemmMicrokernelTester()
           .mr(6)
-          .nr(16)
+          .nr(8)
           .kr(1)
           .sr(1)
           .m(6)
           .n(n)
           .k(k)
           .a_stride(23)
-          .Test(xnn_f16_gemm_minmax_ukernel_6x16__neonfp16arith_ld64, xnn_init_f16_scaleminmax_neon_params);
+          .Test(xnn_f16_gemm_minmax_ukernel_6x8__neonfp16arith_ld64, xnn_init_f16_scaleminmax_neon_params);
       }
     }
   }
 
-  TEST(F16_GEMM_MINMAX_6X16__NEONFP16ARITH_LD64, n_gt_16_subtile) {
+  TEST(F16_GEMM_MINMAX_6X8__NEONFP16ARITH_LD64, n_gt_8_subtile) {
     TEST_REQUIRES_ARM_NEON_FP16_ARITH;
-    for (uint32_t n = 17; n < 32; n++) {
+    for (uint32_t n = 9; n < 16; n++) {
       for (size_t k = 1; k <= 20; k += 5) {
         for (uint32_t m = 1; m <= 6; m++) {
           GemmMicrokernelTester()
             .mr(6)
-            .nr(16)
+            .nr(8)
             .kr(1)
             .sr(1)
             .m(m)
             .n(n)
             .k(k)
             .iterations(1)
-            .Test(xnn_f16_gemm_minmax_ukernel_6x16__neonfp16arith_ld64, xnn_init_f16_scaleminmax_neon_params);
+            .Test(xnn_f16_gemm_minmax_ukernel_6x8__neonfp16arith_ld64, xnn_init_f16_scaleminmax_neon_params);
         }
       }
     }
   }
 
-  TEST(F16_GEMM_MINMAX_6X16__NEONFP16ARITH_LD64, n_div_16) {
+  TEST(F16_GEMM_MINMAX_6X8__NEONFP16ARITH_LD64, n_div_8) {
     TEST_REQUIRES_ARM_NEON_FP16_ARITH;
-    for (uint32_t n = 32; n <= 48; n += 16) {
+    for (uint32_t n = 16; n <= 24; n += 8) {
       for (size_t k = 1; k <= 20; k += 5) {
         GemmMicrokernelTester()
           .mr(6)
-          .nr(16)
+          .nr(8)
           .kr(1)
           .sr(1)
           .m(6)
           .n(n)
           .k(k)
-          .Test(xnn_f16_gemm_minmax_ukernel_6x16__neonfp16arith_ld64, xnn_init_f16_scaleminmax_neon_params);
+          .Test(xnn_f16_gemm_minmax_ukernel_6x8__neonfp16arith_ld64, xnn_init_f16_scaleminmax_neon_params);
       }
     }
   }
 
-  TEST(F16_GEMM_MINMAX_6X16__NEONFP16ARITH_LD64, n_div_16_strided_cn) {
+  TEST(F16_GEMM_MINMAX_6X8__NEONFP16ARITH_LD64, n_div_8_strided_cn) {
     TEST_REQUIRES_ARM_NEON_FP16_ARITH;
-    for (uint32_t n = 32; n <= 48; n += 16) {
+    for (uint32_t n = 16; n <= 24; n += 8) {
       for (size_t k = 1; k <= 20; k += 5) {
         GemmMicrokernelTester()
           .mr(6)
-          .nr(16)
+          .nr(8)
           .kr(1)
           .sr(1)
           .m(6)
           .n(n)
           .k(k)
-          .cn_stride(19)
-          .Test(xnn_f16_gemm_minmax_ukernel_6x16__neonfp16arith_ld64, xnn_init_f16_scaleminmax_neon_params);
+          .cn_stride(11)
+          .Test(xnn_f16_gemm_minmax_ukernel_6x8__neonfp16arith_ld64, xnn_init_f16_scaleminmax_neon_params);
       }
     }
   }
 
-  TEST(F16_GEMM_MINMAX_6X16__NEONFP16ARITH_LD64, n_div_16_strided_a) {
+  TEST(F16_GEMM_MINMAX_6X8__NEONFP16ARITH_LD64, n_div_8_strided_a) {
     TEST_REQUIRES_ARM_NEON_FP16_ARITH;
-    for (uint32_t n = 32; n <= 48; n += 16) {
+    for (uint32_t n = 16; n <= 24; n += 8) {
       for (size_t k = 1; k <= 20; k += 5) {
         GemmMicrokernelTester()
           .mr(6)
-          .nr(16)
+          .nr(8)
           .kr(1)
           .sr(1)
           .m(6)
           .n(n)
           .k(k)
           .a_stride(23)
-          .Test(xnn_f16_gemm_minmax_ukernel_6x16__neonfp16arith_ld64, xnn_init_f16_scaleminmax_neon_params);
+          .Test(xnn_f16_gemm_minmax_ukernel_6x8__neonfp16arith_ld64, xnn_init_f16_scaleminmax_neon_params);
       }
     }
   }
 
-  TEST(F16_GEMM_MINMAX_6X16__NEONFP16ARITH_LD64, n_div_16_subtile) {
+  TEST(F16_GEMM_MINMAX_6X8__NEONFP16ARITH_LD64, n_div_8_subtile) {
     TEST_REQUIRES_ARM_NEON_FP16_ARITH;
-    for (uint32_t n = 32; n <= 48; n += 16) {
+    for (uint32_t n = 16; n <= 24; n += 8) {
       for (size_t k = 1; k <= 20; k += 5) {
         for (uint32_t m = 1; m <= 6; m++) {
           GemmMicrokernelTester()
             .mr(6)
-            .nr(16)
+            .nr(8)
             .kr(1)
             .sr(1)
             .m(m)
             .n(n)
             .k(k)
             .iterations(1)
-            .Test(xnn_f16_gemm_minmax_ukernel_6x16__neonfp16arith_ld64, xnn_init_f16_scaleminmax_neon_params);
+            .Test(xnn_f16_gemm_minmax_ukernel_6x8__neonfp16arith_ld64, xnn_init_f16_scaleminmax_neon_params);
         }
       }
     }
   }
 
-  TEST(F16_GEMM_MINMAX_6X16__NEONFP16ARITH_LD64, strided_cm_subtile) {
+  TEST(F16_GEMM_MINMAX_6X8__NEONFP16ARITH_LD64, strided_cm_subtile) {
     TEST_REQUIRES_ARM_NEON_FP16_ARITH;
     for (size_t k = 1; k <= 20; k += 5) {
-      for (uint32_t n = 1; n <= 16; n++) {
+      for (uint32_t n = 1; n <= 8; n++) {
         for (uint32_t m = 1; m <= 6; m++) {
           GemmMicrokernelTester()
             .mr(6)
-            .nr(16)
+            .nr(8)
             .kr(1)
             .sr(1)
             .m(m)
             .n(n)
             .k(k)
-            .cm_stride(19)
+            .cm_stride(11)
             .iterations(1)
-            .Test(xnn_f16_gemm_minmax_ukernel_6x16__neonfp16arith_ld64, xnn_init_f16_scaleminmax_neon_params);
+            .Test(xnn_f16_gemm_minmax_ukernel_6x8__neonfp16arith_ld64, xnn_init_f16_scaleminmax_neon_params);
         }
       }
     }
   }
 
-  TEST(F16_GEMM_MINMAX_6X16__NEONFP16ARITH_LD64, qmin) {
+  TEST(F16_GEMM_MINMAX_6X8__NEONFP16ARITH_LD64, qmin) {
     TEST_REQUIRES_ARM_NEON_FP16_ARITH;
     GemmMicrokernelTester()
       .mr(6)
-      .nr(16)
+      .nr(8)
       .kr(1)
       .sr(1)
       .m(6)
-      .n(16)
+      .n(8)
       .k(4)
       .qmin(128)
-      .Test(xnn_f16_gemm_minmax_ukernel_6x16__neonfp16arith_ld64, xnn_init_f16_scaleminmax_neon_params);
+      .Test(xnn_f16_gemm_minmax_ukernel_6x8__neonfp16arith_ld64, xnn_init_f16_scaleminmax_neon_params);
   }
 
-  TEST(F16_GEMM_MINMAX_6X16__NEONFP16ARITH_LD64, qmax) {
+  TEST(F16_GEMM_MINMAX_6X8__NEONFP16ARITH_LD64, qmax) {
     TEST_REQUIRES_ARM_NEON_FP16_ARITH;
     GemmMicrokernelTester()
       .mr(6)
-      .nr(16)
+      .nr(8)
       .kr(1)
       .sr(1)
       .m(6)
-      .n(16)
+      .n(8)
       .k(4)
       .qmax(128)
-      .Test(xnn_f16_gemm_minmax_ukernel_6x16__neonfp16arith_ld64, xnn_init_f16_scaleminmax_neon_params);
+      .Test(xnn_f16_gemm_minmax_ukernel_6x8__neonfp16arith_ld64, xnn_init_f16_scaleminmax_neon_params);
   }
 
-  TEST(F16_GEMM_MINMAX_6X16__NEONFP16ARITH_LD64, strided_cm) {
+  TEST(F16_GEMM_MINMAX_6X8__NEONFP16ARITH_LD64, strided_cm) {
     TEST_REQUIRES_ARM_NEON_FP16_ARITH;
     GemmMicrokernelTester()
       .mr(6)
-      .nr(16)
+      .nr(8)
       .kr(1)
       .sr(1)
       .m(6)
-      .n(16)
+      .n(8)
       .k(4)
-      .cm_stride(19)
-      .Test(xnn_f16_gemm_minmax_ukernel_6x16__neonfp16arith_ld64, xnn_init_f16_scaleminmax_neon_params);
+      .cm_stride(11)
+      .Test(xnn_f16_gemm_minmax_ukernel_6x8__neonfp16arith_ld64, xnn_init_f16_scaleminmax_neon_params);
   }
 #endif  // XNN_ARCH_ARM64
 
 
 #if XNN_ARCH_ARM64
-  TEST(F16_GEMM_MINMAX_8X8__NEONFP16ARITH_LD64, k_eq_4) {
+  TEST(F16_GEMM_MINMAX_6X16__NEONFP16ARITH_LD64, k_eq_4) {
     TEST_REQUIRES_ARM_NEON_FP16_ARITH;
     GemmMicrokernelTester()
-      .mr(8)
-      .nr(8)
+      .mr(6)
+      .nr(16)
       .kr(1)
       .sr(1)
-      .m(8)
-      .n(8)
+      .m(6)
+      .n(16)
       .k(4)
-      .Test(xnn_f16_gemm_minmax_ukernel_8x8__neonfp16arith_ld64, xnn_init_f16_scaleminmax_neon_params);
+      .Test(xnn_f16_gemm_minmax_ukernel_6x16__neonfp16arith_ld64, xnn_init_f16_scaleminmax_neon_params);
   }
 
-  TEST(F16_GEMM_MINMAX_8X8__NEONFP16ARITH_LD64, strided_cn) {
+  TEST(F16_GEMM_MINMAX_6X16__NEONFP16ARITH_LD64, strided_cn) {
     TEST_REQUIRES_ARM_NEON_FP16_ARITH;
     GemmMicrokernelTester()
-      .mr(8)
-      .nr(8)
+      .mr(6)
+      .nr(16)
       .kr(1)
       .sr(1)
-      .m(8)
-      .n(8)
+      .m(6)
+      .n(16)
       .k(4)
-      .cn_stride(11)
-      .Test(xnn_f16_gemm_minmax_ukernel_8x8__neonfp16arith_ld64, xnn_init_f16_scaleminmax_neon_params);
+      .cn_stride(19)
+      .Test(xnn_f16_gemm_minmax_ukernel_6x16__neonfp16arith_ld64, xnn_init_f16_scaleminmax_neon_params);
   }
 
-  TEST(F16_GEMM_MINMAX_8X8__NEONFP16ARITH_LD64, k_eq_4_strided_a) {
+  TEST(F16_GEMM_MINMAX_6X16__NEONFP16ARITH_LD64, k_eq_4_strided_a) {
     TEST_REQUIRES_ARM_NEON_FP16_ARITH;
     GemmMicrokernelTester()
-      .mr(8)
-      .nr(8)
+      .mr(6)
+      .nr(16)
       .kr(1)
       .sr(1)
-      .m(8)
-      .n(8)
+      .m(6)
+      .n(16)
       .k(4)
       .a_stride(7)
-      .Test(xnn_f16_gemm_minmax_ukernel_8x8__neonfp16arith_ld64, xnn_init_f16_scaleminmax_neon_params);
+      .Test(xnn_f16_gemm_minmax_ukernel_6x16__neonfp16arith_ld64, xnn_init_f16_scaleminmax_neon_params);
   }
 
-  TEST(F16_GEMM_MINMAX_8X8__NEONFP16ARITH_LD64, k_eq_4_subtile) {
+  TEST(F16_GEMM_MINMAX_6X16__NEONFP16ARITH_LD64, k_eq_4_subtile) {
     TEST_REQUIRES_ARM_NEON_FP16_ARITH;
-    for (uint32_t n = 1; n <= 8; n++) {
-      for (uint32_t m = 1; m <= 8; m++) {
+    for (uint32_t n = 1; n <= 16; n++) {
+      for (uint32_t m = 1; m <= 6; m++) {
         GemmMicrokernelTester()
-          .mr(8)
-          .nr(8)
+          .mr(6)
+          .nr(16)
           .kr(1)
           .sr(1)
           .m(m)
           .n(n)
           .k(4)
           .iterations(1)
-          .Test(xnn_f16_gemm_minmax_ukernel_8x8__neonfp16arith_ld64, xnn_init_f16_scaleminmax_neon_params);
+          .Test(xnn_f16_gemm_minmax_ukernel_6x16__neonfp16arith_ld64, xnn_init_f16_scaleminmax_neon_params);
       }
     }
   }
 
-  TEST(F16_GEMM_MINMAX_8X8__NEONFP16ARITH_LD64, k_eq_4_subtile_m) {
+  TEST(F16_GEMM_MINMAX_6X16__NEONFP16ARITH_LD64, k_eq_4_subtile_m) {
     TEST_REQUIRES_ARM_NEON_FP16_ARITH;
-    for (uint32_t m = 1; m <= 8; m++) {
+    for (uint32_t m = 1; m <= 6; m++) {
       GemmMicrokernelTester()
-        .mr(8)
-        .nr(8)
+        .mr(6)
+        .nr(16)
         .kr(1)
         .sr(1)
         .m(m)
-        .n(8)
+        .n(16)
         .k(4)
         .iterations(1)
-        .Test(xnn_f16_gemm_minmax_ukernel_8x8__neonfp16arith_ld64, xnn_init_f16_scaleminmax_neon_params);
+        .Test(xnn_f16_gemm_minmax_ukernel_6x16__neonfp16arith_ld64, xnn_init_f16_scaleminmax_neon_params);
     }
   }
 
-  TEST(F16_GEMM_MINMAX_8X8__NEONFP16ARITH_LD64, k_eq_4_subtile_n) {
+  TEST(F16_GEMM_MINMAX_6X16__NEONFP16ARITH_LD64, k_eq_4_subtile_n) {
     TEST_REQUIRES_ARM_NEON_FP16_ARITH;
-    for (uint32_t n = 1; n <= 8; n++) {
+    for (uint32_t n = 1; n <= 16; n++) {
       GemmMicrokernelTester()
-        .mr(8)
-        .nr(8)
+        .mr(6)
+        .nr(16)
         .kr(1)
         .sr(1)
-        .m(8)
+        .m(6)
         .n(n)
         .k(4)
         .iterations(1)
-        .Test(xnn_f16_gemm_minmax_ukernel_8x8__neonfp16arith_ld64, xnn_init_f16_scaleminmax_neon_params);
+        .Test(xnn_f16_gemm_minmax_ukernel_6x16__neonfp16arith_ld64, xnn_init_f16_scaleminmax_neon_params);
     }
   }
 
-  TEST(F16_GEMM_MINMAX_8X8__NEONFP16ARITH_LD64, k_lt_4) {
+  TEST(F16_GEMM_MINMAX_6X16__NEONFP16ARITH_LD64, k_lt_4) {
     TEST_REQUIRES_ARM_NEON_FP16_ARITH;
     for (size_t k = 1; k < 4; k++) {
       GemmMicrokernelTester()
-        .mr(8)
-        .nr(8)
+        .mr(6)
+        .nr(16)
         .kr(1)
         .sr(1)
-        .m(8)
-        .n(8)
+        .m(6)
+        .n(16)
         .k(k)
-        .Test(xnn_f16_gemm_minmax_ukernel_8x8__neonfp16arith_ld64, xnn_init_f16_scaleminmax_neon_params);
+        .Test(xnn_f16_gemm_minmax_ukernel_6x16__neonfp16arith_ld64, xnn_init_f16_scaleminmax_neon_params);
     }
   }
 
-  TEST(F16_GEMM_MINMAX_8X8__NEONFP16ARITH_LD64, k_lt_4_strided_a) {
+  TEST(F16_GEMM_MINMAX_6X16__NEONFP16ARITH_LD64, k_lt_4_strided_a) {
     TEST_REQUIRES_ARM_NEON_FP16_ARITH;
     for (size_t k = 1; k < 4; k++) {
       GemmMicrokernelTester()
-        .mr(8)
-        .nr(8)
+        .mr(6)
+        .nr(16)
         .kr(1)
         .sr(1)
-        .m(8)
-        .n(8)
+        .m(6)
+        .n(16)
         .k(k)
         .a_stride(7)
-        .Test(xnn_f16_gemm_minmax_ukernel_8x8__neonfp16arith_ld64, xnn_init_f16_scaleminmax_neon_params);
+        .Test(xnn_f16_gemm_minmax_ukernel_6x16__neonfp16arith_ld64, xnn_init_f16_scaleminmax_neon_params);
     }
   }
 
-  TEST(F16_GEMM_MINMAX_8X8__NEONFP16ARITH_LD64, k_lt_4_subtile) {
+  TEST(F16_GEMM_MINMAX_6X16__NEONFP16ARITH_LD64, k_lt_4_subtile) {
     TEST_REQUIRES_ARM_NEON_FP16_ARITH;
     for (size_t k = 1; k < 4; k++) {
-      for (uint32_t n = 1; n <= 8; n++) {
-        for (uint32_t m = 1; m <= 8; m++) {
+      for (uint32_t n = 1; n <= 16; n++) {
+        for (uint32_t m = 1; m <= 6; m++) {
           GemmMicrokernelTester()
-            .mr(8)
-            .nr(8)
+            .mr(6)
+            .nr(16)
             .kr(1)
             .sr(1)
             .m(m)
             .n(n)
             .k(k)
             .iterations(1)
-            .Test(xnn_f16_gemm_minmax_ukernel_8x8__neonfp16arith_ld64, xnn_init_f16_scaleminmax_neon_params);
+            .Test(xnn_f16_gemm_minmax_ukernel_6x16__neonfp16arith_ld64, xnn_init_f16_scaleminmax_neon_params);
         }
       }
     }
   }
 
-  TEST(F16_GEMM_MINMAX_8X8__NEONFP16ARITH_LD64, k_gt_4) {
+  TEST(F16_GEMM_MINMAX_6X16__NEONFP16ARITH_LD64, k_gt_4) {
     TEST_REQUIRES_ARM_NEON_FP16_ARITH;
     for (size_t k = 5; k < 8; k++) {
       GemmMicrokernelTester()
-        .mr(8)
-        .nr(8)
+        .mr(6)
+        .nr(16)
         .kr(1)
         .sr(1)
-        .m(8)
-        .n(8)
+        .m(6)
+        .n(16)
         .k(k)
-        .Test(xnn_f16_gemm_minmax_ukernel_8x8__neonfp16arith_ld64, xnn_init_f16_scaleminmax_neon_params);
+        .Test(xnn_f16_gemm_minmax_ukernel_6x16__neonfp16arith_ld64, xnn_init_f16_scaleminmax_neon_params);
     }
   }
 
-  TEST(F16_GEMM_MINMAX_8X8__NEONFP16ARITH_LD64, k_gt_4_strided_a) {
+  TEST(F16_GEMM_MINMAX_6X16__NEONFP16ARITH_LD64, k_gt_4_strided_a) {
     TEST_REQUIRES_ARM_NEON_FP16_ARITH;
     for (size_t k = 5; k < 8; k++) {
       GemmMicrokernelTester()
-        .mr(8)
-        .nr(8)
+        .mr(6)
+        .nr(16)
         .kr(1)
         .sr(1)
-        .m(8)
-        .n(8)
+        .m(6)
+        .n(16)
         .k(k)
         .a_stride(11)
-        .Test(xnn_f16_gemm_minmax_ukernel_8x8__neonfp16arith_ld64, xnn_init_f16_scaleminmax_neon_params);
+        .Test(xnn_f16_gemm_minmax_ukernel_6x16__neonfp16arith_ld64, xnn_init_f16_scaleminmax_neon_params);
     }
   }
 
-  TEST(F16_GEMM_MINMAX_8X8__NEONFP16ARITH_LD64, k_gt_4_subtile) {
+  TEST(F16_GEMM_MINMAX_6X16__NEONFP16ARITH_LD64, k_gt_4_subtile) {
     TEST_REQUIRES_ARM_NEON_FP16_ARITH;
     for (size_t k = 5; k < 8; k++) {
-      for (uint32_t n = 1; n <= 8; n++) {
-        for (uint32_t m = 1; m <= 8; m++) {
+      for (uint32_t n = 1; n <= 16; n++) {
+        for (uint32_t m = 1; m <= 6; m++) {
           GemmMicrokernelTester()
-            .mr(8)
-            .nr(8)
+            .mr(6)
+            .nr(16)
             .kr(1)
             .sr(1)
             .m(m)
             .n(n)
             .k(k)
             .iterations(1)
-            .Test(xnn_f16_gemm_minmax_ukernel_8x8__neonfp16arith_ld64, xnn_init_f16_scaleminmax_neon_params);
+            .Test(xnn_f16_gemm_minmax_ukernel_6x16__neonfp16arith_ld64, xnn_init_f16_scaleminmax_neon_params);
         }
       }
     }
   }
 
-  TEST(F16_GEMM_MINMAX_8X8__NEONFP16ARITH_LD64, k_div_4) {
+  TEST(F16_GEMM_MINMAX_6X16__NEONFP16ARITH_LD64, k_div_4) {
     TEST_REQUIRES_ARM_NEON_FP16_ARITH;
     for (size_t k = 8; k <= 40; k += 4) {
       GemmMicrokernelTester()
-        .mr(8)
-        .nr(8)
+        .mr(6)
+        .nr(16)
         .kr(1)
         .sr(1)
-        .m(8)
-        .n(8)
+        .m(6)
+        .n(16)
         .k(k)
-        .Test(xnn_f16_gemm_minmax_ukernel_8x8__neonfp16arith_ld64, xnn_init_f16_scaleminmax_neon_params);
+        .Test(xnn_f16_gemm_minmax_ukernel_6x16__neonfp16arith_ld64, xnn_init_f16_scaleminmax_neon_params);
     }
   }
 
-  TEST(F16_GEMM_MINMAX_8X8__NEONFP16ARITH_LD64, k_div_4_strided_a) {
+  TEST(F16_GEMM_MINMAX_6X16__NEONFP16ARITH_LD64, k_div_4_strided_a) {
     TEST_REQUIRES_ARM_NEON_FP16_ARITH;
     for (size_t k = 8; k <= 40; k += 4) {
       GemmMicrokernelTester()
-        .mr(8)
-        .nr(8)
+        .mr(6)
+        .nr(16)
         .kr(1)
         .sr(1)
-        .m(8)
-        .n(8)
+        .m(6)
+        .n(16)
         .k(k)
         .a_stride(43)
-        .Test(xnn_f16_gemm_minmax_ukernel_8x8__neonfp16arith_ld64, xnn_init_f16_scaleminmax_neon_params);
+        .Test(xnn_f16_gemm_minmax_ukernel_6x16__neonfp16arith_ld64, xnn_init_f16_scaleminmax_neon_params);
     }
   }
 
-  TEST(F16_GEMM_MINMAX_8X8__NEONFP16ARITH_LD64, k_div_4_subtile) {
+  TEST(F16_GEMM_MINMAX_6X16__NEONFP16ARITH_LD64, k_div_4_subtile) {
     TEST_REQUIRES_ARM_NEON_FP16_ARITH;
     for (size_t k = 8; k <= 40; k += 4) {
-      for (uint32_t n = 1; n <= 8; n++) {
-        for (uint32_t m = 1; m <= 8; m++) {
+      for (uint32_t n = 1; n <= 16; n++) {
+        for (uint32_t m = 1; m <= 6; m++) {
           GemmMicrokernelTester()
-            .mr(8)
-            .nr(8)
+            .mr(6)
+            .nr(16)
             .kr(1)
             .sr(1)
             .m(m)
             .n(n)
             .k(k)
             .iterations(1)
-            .Test(xnn_f16_gemm_minmax_ukernel_8x8__neonfp16arith_ld64, xnn_init_f16_scaleminmax_neon_params);
+            .Test(xnn_f16_gemm_minmax_ukernel_6x16__neonfp16arith_ld64, xnn_init_f16_scaleminmax_neon_params);
         }
       }
     }
   }
 
-  TEST(F16_GEMM_MINMAX_8X8__NEONFP16ARITH_LD64, n_gt_8) {
+  TEST(F16_GEMM_MINMAX_6X16__NEONFP16ARITH_LD64, n_gt_16) {
     TEST_REQUIRES_ARM_NEON_FP16_ARITH;
-    for (uint32_t n = 9; n < 16; n++) {
+    for (uint32_t n = 17; n < 32; n++) {
       for (size_t k = 1; k <= 20; k += 5) {
         GemmMicrokernelTester()
-          .mr(8)
-          .nr(8)
+          .mr(6)
+          .nr(16)
           .kr(1)
           .sr(1)
-          .m(8)
+          .m(6)
           .n(n)
           .k(k)
-          .Test(xnn_f16_gemm_minmax_ukernel_8x8__neonfp16arith_ld64, xnn_init_f16_scaleminmax_neon_params);
+          .Test(xnn_f16_gemm_minmax_ukernel_6x16__neonfp16arith_ld64, xnn_init_f16_scaleminmax_neon_params);
       }
     }
   }
 
-  TEST(F16_GEMM_MINMAX_8X8__NEONFP16ARITH_LD64, n_gt_8_strided_cn) {
+  TEST(F16_GEMM_MINMAX_6X16__NEONFP16ARITH_LD64, n_gt_16_strided_cn) {
     TEST_REQUIRES_ARM_NEON_FP16_ARITH;
-    for (uint32_t n = 9; n < 16; n++) {
+    for (uint32_t n = 17; n < 32; n++) {
       for (size_t k = 1; k <= 20; k += 5) {
         GemmMicrokernelTester()
-          .mr(8)
-          .nr(8)
+          .mr(6)
+          .nr(16)
           .kr(1)
           .sr(1)
-          .m(8)
+          .m(6)
           .n(n)
           .k(k)
-          .cn_stride(11)
-          .Test(xnn_f16_gemm_minmax_ukernel_8x8__neonfp16arith_ld64, xnn_init_f16_scaleminmax_neon_params);
+          .cn_stride(19)
+          .Test(xnn_f16_gemm_minmax_ukernel_6x16__neonfp16arith_ld64, xnn_init_f16_scaleminmax_neon_params);
       }
     }
   }
 
-  TEST(F16_GEMM_MINMAX_8X8__NEONFP16ARITH_LD64, n_gt_8_strided_a) {
+  TEST(F16_GEMM_MINMAX_6X16__NEONFP16ARITH_LD64, n_gt_16_strided_a) {
     TEST_REQUIRES_ARM_NEON_FP16_ARITH;
-    for (uint32_t n = 9; n < 16; n++) {
+    for (uint32_t n = 17; n < 32; n++) {
       for (size_t k = 1; k <= 20; k += 5) {
         GemmMicrokernelTester()
-          .mr(8)
-          .nr(8)
+          .mr(6)
+          .nr(16)
           .kr(1)
           .sr(1)
-          .m(8)
+          .m(6)
           .n(n)
           .k(k)
           .a_stride(23)
-          .Test(xnn_f16_gemm_minmax_ukernel_8x8__neonfp16arith_ld64, xnn_init_f16_scaleminmax_neon_params);
+          .Test(xnn_f16_gemm_minmax_ukernel_6x16__neonfp16arith_ld64, xnn_init_f16_scaleminmax_neon_params);
       }
     }
   }
 
-  TEST(F16_GEMM_MINMAX_8X8__NEONFP16ARITH_LD64, n_gt_8_subtile) {
+  TEST(F16_GEMM_MINMAX_6X16__NEONFP16ARITH_LD64, n_gt_16_subtile) {
     TEST_REQUIRES_ARM_NEON_FP16_ARITH;
-    for (uint32_t n = 9; n < 16; n++) {
+    for (uint32_t n = 17; n < 32; n++) {
       for (size_t k = 1; k <= 20; k += 5) {
-        for (uint32_t m = 1; m <= 8; m++) {
+        for (uint32_t m = 1; m <= 6; m++) {
           GemmMicrokernelTester()
-            .mr(8)
-            .nr(8)
+            .mr(6)
+            .nr(16)
             .kr(1)
             .sr(1)
             .m(m)
             .n(n)
             .k(k)
             .iterations(1)
-            .Test(xnn_f16_gemm_minmax_ukernel_8x8__neonfp16arith_ld64, xnn_init_f16_scaleminmax_neon_params);
+            .Test(xnn_f16_gemm_minmax_ukernel_6x16__neonfp16arith_ld64, xnn_init_f16_scaleminmax_neon_params);
         }
       }
     }
   }
 
-  TEST(F16_GEMM_MINMAX_8X8__NEONFP16ARITH_LD64, n_div_8) {
+  TEST(F16_GEMM_MINMAX_6X16__NEONFP16ARITH_LD64, n_div_16) {
     TEST_REQUIRES_ARM_NEON_FP16_ARITH;
-    for (uint32_t n = 16; n <= 24; n += 8) {
+    for (uint32_t n = 32; n <= 48; n += 16) {
       for (size_t k = 1; k <= 20; k += 5) {
         GemmMicrokernelTester()
-          .mr(8)
-          .nr(8)
+          .mr(6)
+          .nr(16)
           .kr(1)
           .sr(1)
-          .m(8)
+          .m(6)
           .n(n)
           .k(k)
-          .Test(xnn_f16_gemm_minmax_ukernel_8x8__neonfp16arith_ld64, xnn_init_f16_scaleminmax_neon_params);
+          .Test(xnn_f16_gemm_minmax_ukernel_6x16__neonfp16arith_ld64, xnn_init_f16_scaleminmax_neon_params);
       }
     }
   }
 
-  TEST(F16_GEMM_MINMAX_8X8__NEONFP16ARITH_LD64, n_div_8_strided_cn) {
+  TEST(F16_GEMM_MINMAX_6X16__NEONFP16ARITH_LD64, n_div_16_strided_cn) {
     TEST_REQUIRES_ARM_NEON_FP16_ARITH;
-    for (uint32_t n = 16; n <= 24; n += 8) {
+    for (uint32_t n = 32; n <= 48; n += 16) {
       for (size_t k = 1; k <= 20; k += 5) {
         GemmMicrokernelTester()
-          .mr(8)
-          .nr(8)
+          .mr(6)
+          .nr(16)
           .kr(1)
           .sr(1)
-          .m(8)
+          .m(6)
           .n(n)
           .k(k)
-          .cn_stride(11)
-          .Test(xnn_f16_gemm_minmax_ukernel_8x8__neonfp16arith_ld64, xnn_init_f16_scaleminmax_neon_params);
+          .cn_stride(19)
+          .Test(xnn_f16_gemm_minmax_ukernel_6x16__neonfp16arith_ld64, xnn_init_f16_scaleminmax_neon_params);
       }
     }
   }
 
-  TEST(F16_GEMM_MINMAX_8X8__NEONFP16ARITH_LD64, n_div_8_strided_a) {
+  TEST(F16_GEMM_MINMAX_6X16__NEONFP16ARITH_LD64, n_div_16_strided_a) {
     TEST_REQUIRES_ARM_NEON_FP16_ARITH;
-    for (uint32_t n = 16; n <= 24; n += 8) {
+    for (uint32_t n = 32; n <= 48; n += 16) {
       for (size_t k = 1; k <= 20; k += 5) {
         GemmMicrokernelTester()
-          .mr(8)
-          .nr(8)
+          .mr(6)
+          .nr(16)
           .kr(1)
           .sr(1)
-          .m(8)
+          .m(6)
           .n(n)
           .k(k)
           .a_stride(23)
-          .Test(xnn_f16_gemm_minmax_ukernel_8x8__neonfp16arith_ld64, xnn_init_f16_scaleminmax_neon_params);
+          .Test(xnn_f16_gemm_minmax_ukernel_6x16__neonfp16arith_ld64, xnn_init_f16_scaleminmax_neon_params);
       }
     }
   }
 
-  TEST(F16_GEMM_MINMAX_8X8__NEONFP16ARITH_LD64, n_div_8_subtile) {
+  TEST(F16_GEMM_MINMAX_6X16__NEONFP16ARITH_LD64, n_div_16_subtile) {
     TEST_REQUIRES_ARM_NEON_FP16_ARITH;
-    for (uint32_t n = 16; n <= 24; n += 8) {
+    for (uint32_t n = 32; n <= 48; n += 16) {
       for (size_t k = 1; k <= 20; k += 5) {
-        for (uint32_t m = 1; m <= 8; m++) {
+        for (uint32_t m = 1; m <= 6; m++) {
           GemmMicrokernelTester()
-            .mr(8)
-            .nr(8)
+            .mr(6)
+            .nr(16)
             .kr(1)
             .sr(1)
             .m(m)
             .n(n)
             .k(k)
             .iterations(1)
-            .Test(xnn_f16_gemm_minmax_ukernel_8x8__neonfp16arith_ld64, xnn_init_f16_scaleminmax_neon_params);
+            .Test(xnn_f16_gemm_minmax_ukernel_6x16__neonfp16arith_ld64, xnn_init_f16_scaleminmax_neon_params);
         }
       }
     }
   }
 
-  TEST(F16_GEMM_MINMAX_8X8__NEONFP16ARITH_LD64, strided_cm_subtile) {
+  TEST(F16_GEMM_MINMAX_6X16__NEONFP16ARITH_LD64, strided_cm_subtile) {
     TEST_REQUIRES_ARM_NEON_FP16_ARITH;
     for (size_t k = 1; k <= 20; k += 5) {
-      for (uint32_t n = 1; n <= 8; n++) {
-        for (uint32_t m = 1; m <= 8; m++) {
+      for (uint32_t n = 1; n <= 16; n++) {
+        for (uint32_t m = 1; m <= 6; m++) {
           GemmMicrokernelTester()
-            .mr(8)
-            .nr(8)
+            .mr(6)
+            .nr(16)
             .kr(1)
             .sr(1)
             .m(m)
             .n(n)
             .k(k)
-            .cm_stride(11)
+            .cm_stride(19)
             .iterations(1)
-            .Test(xnn_f16_gemm_minmax_ukernel_8x8__neonfp16arith_ld64, xnn_init_f16_scaleminmax_neon_params);
+            .Test(xnn_f16_gemm_minmax_ukernel_6x16__neonfp16arith_ld64, xnn_init_f16_scaleminmax_neon_params);
         }
       }
     }
   }
 
-  TEST(F16_GEMM_MINMAX_8X8__NEONFP16ARITH_LD64, qmin) {
+  TEST(F16_GEMM_MINMAX_6X16__NEONFP16ARITH_LD64, qmin) {
     TEST_REQUIRES_ARM_NEON_FP16_ARITH;
     GemmMicrokernelTester()
-      .mr(8)
-      .nr(8)
+      .mr(6)
+      .nr(16)
       .kr(1)
       .sr(1)
-      .m(8)
-      .n(8)
+      .m(6)
+      .n(16)
       .k(4)
       .qmin(128)
-      .Test(xnn_f16_gemm_minmax_ukernel_8x8__neonfp16arith_ld64, xnn_init_f16_scaleminmax_neon_params);
+      .Test(xnn_f16_gemm_minmax_ukernel_6x16__neonfp16arith_ld64, xnn_init_f16_scaleminmax_neon_params);
   }
 
-  TEST(F16_GEMM_MINMAX_8X8__NEONFP16ARITH_LD64, qmax) {
+  TEST(F16_GEMM_MINMAX_6X16__NEONFP16ARITH_LD64, qmax) {
     TEST_REQUIRES_ARM_NEON_FP16_ARITH;
     GemmMicrokernelTester()
-      .mr(8)
-      .nr(8)
+      .mr(6)
+      .nr(16)
       .kr(1)
       .sr(1)
-      .m(8)
-      .n(8)
+      .m(6)
+      .n(16)
       .k(4)
       .qmax(128)
-      .Test(xnn_f16_gemm_minmax_ukernel_8x8__neonfp16arith_ld64, xnn_init_f16_scaleminmax_neon_params);
+      .Test(xnn_f16_gemm_minmax_ukernel_6x16__neonfp16arith_ld64, xnn_init_f16_scaleminmax_neon_params);
   }
 
-  TEST(F16_GEMM_MINMAX_8X8__NEONFP16ARITH_LD64, strided_cm) {
+  TEST(F16_GEMM_MINMAX_6X16__NEONFP16ARITH_LD64, strided_cm) {
     TEST_REQUIRES_ARM_NEON_FP16_ARITH;
     GemmMicrokernelTester()
-      .mr(8)
-      .nr(8)
+      .mr(6)
+      .nr(16)
       .kr(1)
       .sr(1)
-      .m(8)
-      .n(8)
+      .m(6)
+      .n(16)
       .k(4)
-      .cm_stride(11)
-      .Test(xnn_f16_gemm_minmax_ukernel_8x8__neonfp16arith_ld64, xnn_init_f16_scaleminmax_neon_params);
+      .cm_stride(19)
+      .Test(xnn_f16_gemm_minmax_ukernel_6x16__neonfp16arith_ld64, xnn_init_f16_scaleminmax_neon_params);
   }
 #endif  // XNN_ARCH_ARM64
 
 
 #if XNN_ARCH_ARM64
-  TEST(F16_GEMM_MINMAX_8X16__NEONFP16ARITH_LD64, k_eq_4) {
+  TEST(F16_GEMM_MINMAX_8X8__NEONFP16ARITH_LD64, k_eq_4) {
     TEST_REQUIRES_ARM_NEON_FP16_ARITH;
     GemmMicrokernelTester()
       .mr(8)
-      .nr(16)
+      .nr(8)
       .kr(1)
       .sr(1)
       .m(8)
-      .n(16)
+      .n(8)
       .k(4)
-      .Test(xnn_f16_gemm_minmax_ukernel_8x16__neonfp16arith_ld64, xnn_init_f16_scaleminmax_neon_params);
+      .Test(xnn_f16_gemm_minmax_ukernel_8x8__neonfp16arith_ld64, xnn_init_f16_scaleminmax_neon_params);
   }
 
-  TEST(F16_GEMM_MINMAX_8X16__NEONFP16ARITH_LD64, strided_cn) {
+  TEST(F16_GEMM_MINMAX_8X8__NEONFP16ARITH_LD64, strided_cn) {
     TEST_REQUIRES_ARM_NEON_FP16_ARITH;
     GemmMicrokernelTester()
       .mr(8)
-      .nr(16)
+      .nr(8)
       .kr(1)
       .sr(1)
       .m(8)
-      .n(16)
+      .n(8)
       .k(4)
-      .cn_stride(19)
-      .Test(xnn_f16_gemm_minmax_ukernel_8x16__neonfp16arith_ld64, xnn_init_f16_scaleminmax_neon_params);
+      .cn_stride(11)
+      .Test(xnn_f16_gemm_minmax_ukernel_8x8__neonfp16arith_ld64, xnn_init_f16_scaleminmax_neon_params);
   }
 
-  TEST(F16_GEMM_MINMAX_8X16__NEONFP16ARITH_LD64, k_eq_4_strided_a) {
+  TEST(F16_GEMM_MINMAX_8X8__NEONFP16ARITH_LD64, k_eq_4_strided_a) {
     TEST_REQUIRES_ARM_NEON_FP16_ARITH;
     GemmMicrokernelTester()
       .mr(8)
-      .nr(16)
+      .nr(8)
       .kr(1)
       .sr(1)
       .m(8)
-      .n(16)
+      .n(8)
       .k(4)
       .a_stride(7)
-      .Test(xnn_f16_gemm_minmax_ukernel_8x16__neonfp16arith_ld64, xnn_init_f16_scaleminmax_neon_params);
+      .Test(xnn_f16_gemm_minmax_ukernel_8x8__neonfp16arith_ld64, xnn_init_f16_scaleminmax_neon_params);
   }
 
-  TEST(F16_GEMM_MINMAX_8X16__NEONFP16ARITH_LD64, k_eq_4_subtile) {
+  TEST(F16_GEMM_MINMAX_8X8__NEONFP16ARITH_LD64, k_eq_4_subtile) {
     TEST_REQUIRES_ARM_NEON_FP16_ARITH;
-    for (uint32_t n = 1; n <= 16; n++) {
+    for (uint32_t n = 1; n <= 8; n++) {
       for (uint32_t m = 1; m <= 8; m++) {
         GemmMicrokernelTester()
           .mr(8)
-          .nr(16)
+          .nr(8)
           .kr(1)
           .sr(1)
           .m(m)
           .n(n)
           .k(4)
           .iterations(1)
-          .Test(xnn_f16_gemm_minmax_ukernel_8x16__neonfp16arith_ld64, xnn_init_f16_scaleminmax_neon_params);
+          .Test(xnn_f16_gemm_minmax_ukernel_8x8__neonfp16arith_ld64, xnn_init_f16_scaleminmax_neon_params);
       }
     }
   }
 
-  TEST(F16_GEMM_MINMAX_8X16__NEONFP16ARITH_LD64, k_eq_4_subtile_m) {
+  TEST(F16_GEMM_MINMAX_8X8__NEONFP16ARITH_LD64, k_eq_4_subtile_m) {
     TEST_REQUIRES_ARM_NEON_FP16_ARITH;
     for (uint32_t m = 1; m <= 8; m++) {
       GemmMicrokernelTester()
         .mr(8)
-        .nr(16)
+        .nr(8)
         .kr(1)
         .sr(1)
         .m(m)
-        .n(16)
+        .n(8)
         .k(4)
         .iterations(1)
-        .Test(xnn_f16_gemm_minmax_ukernel_8x16__neonfp16arith_ld64, xnn_init_f16_scaleminmax_neon_params);
+        .Test(xnn_f16_gemm_minmax_ukernel_8x8__neonfp16arith_ld64, xnn_init_f16_scaleminmax_neon_params);
     }
   }
 
-  TEST(F16_GEMM_MINMAX_8X16__NEONFP16ARITH_LD64, k_eq_4_subtile_n) {
+  TEST(F16_GEMM_MINMAX_8X8__NEONFP16ARITH_LD64, k_eq_4_subtile_n) {
     TEST_REQUIRES_ARM_NEON_FP16_ARITH;
-    for (uint32_t n = 1; n <= 16; n++) {
+    for (uint32_t n = 1; n <= 8; n++) {
       GemmMicrokernelTester()
         .mr(8)
-        .nr(16)
+        .nr(8)
         .kr(1)
         .sr(1)
         .m(8)
         .n(n)
         .k(4)
         .iterations(1)
-        .Test(xnn_f16_gemm_minmax_ukernel_8x16__neonfp16arith_ld64, xnn_init_f16_scaleminmax_neon_params);
+        .Test(xnn_f16_gemm_minmax_ukernel_8x8__neonfp16arith_ld64, xnn_init_f16_scaleminmax_neon_params);
     }
   }
 
-  TEST(F16_GEMM_MINMAX_8X16__NEONFP16ARITH_LD64, k_lt_4) {
+  TEST(F16_GEMM_MINMAX_8X8__NEONFP16ARITH_LD64, k_lt_4) {
     TEST_REQUIRES_ARM_NEON_FP16_ARITH;
     for (size_t k = 1; k < 4; k++) {
       GemmMicrokernelTester()
         .mr(8)
-        .nr(16)
+        .nr(8)
         .kr(1)
         .sr(1)
         .m(8)
-        .n(16)
+        .n(8)
         .k(k)
-        .Test(xnn_f16_gemm_minmax_ukernel_8x16__neonfp16arith_ld64, xnn_init_f16_scaleminmax_neon_params);
+        .Test(xnn_f16_gemm_minmax_ukernel_8x8__neonfp16arith_ld64, xnn_init_f16_scaleminmax_neon_params);
     }
   }
 
-  TEST(F16_GEMM_MINMAX_8X16__NEONFP16ARITH_LD64, k_lt_4_strided_a) {
+  TEST(F16_GEMM_MINMAX_8X8__NEONFP16ARITH_LD64, k_lt_4_strided_a) {
     TEST_REQUIRES_ARM_NEON_FP16_ARITH;
     for (size_t k = 1; k < 4; k++) {
       GemmMicrokernelTester()
         .mr(8)
-        .nr(16)
+        .nr(8)
         .kr(1)
         .sr(1)
         .m(8)
-        .n(16)
+        .n(8)
         .k(k)
         .a_stride(7)
-        .Test(xnn_f16_gemm_minmax_ukernel_8x16__neonfp16arith_ld64, xnn_init_f16_scaleminmax_neon_params);
+        .Test(xnn_f16_gemm_minmax_ukernel_8x8__neonfp16arith_ld64, xnn_init_f16_scaleminmax_neon_params);
     }
   }
 
-  TEST(F16_GEMM_MINMAX_8X16__NEONFP16ARITH_LD64, k_lt_4_subtile) {
+  TEST(F16_GEMM_MINMAX_8X8__NEONFP16ARITH_LD64, k_lt_4_subtile) {
     TEST_REQUIRES_ARM_NEON_FP16_ARITH;
     for (size_t k = 1; k < 4; k++) {
-      for (uint32_t n = 1; n <= 16; n++) {
+      for (uint32_t n = 1; n <= 8; n++) {
         for (uint32_t m = 1; m <= 8; m++) {
           GemmMicrokernelTester()
             .mr(8)
-            .nr(16)
+            .nr(8)
             .kr(1)
             .sr(1)
             .m(m)
             .n(n)
             .k(k)
             .iterations(1)
-            .Test(xnn_f16_gemm_minmax_ukernel_8x16__neonfp16arith_ld64, xnn_init_f16_scaleminmax_neon_params);
+            .Test(xnn_f16_gemm_minmax_ukernel_8x8__neonfp16arith_ld64, xnn_init_f16_scaleminmax_neon_params);
         }
       }
     }
   }
 
-  TEST(F16_GEMM_MINMAX_8X16__NEONFP16ARITH_LD64, k_gt_4) {
+  TEST(F16_GEMM_MINMAX_8X8__NEONFP16ARITH_LD64, k_gt_4) {
     TEST_REQUIRES_ARM_NEON_FP16_ARITH;
     for (size_t k = 5; k < 8; k++) {
       GemmMicrokernelTester()
         .mr(8)
-        .nr(16)
+        .nr(8)
         .kr(1)
         .sr(1)
         .m(8)
-        .n(16)
+        .n(8)
         .k(k)
-        .Test(xnn_f16_gemm_minmax_ukernel_8x16__neonfp16arith_ld64, xnn_init_f16_scaleminmax_neon_params);
+        .Test(xnn_f16_gemm_minmax_ukernel_8x8__neonfp16arith_ld64, xnn_init_f16_scaleminmax_neon_params);
     }
   }
 
-  TEST(F16_GEMM_MINMAX_8X16__NEONFP16ARITH_LD64, k_gt_4_strided_a) {
+  TEST(F16_GEMM_MINMAX_8X8__NEONFP16ARITH_LD64, k_gt_4_strided_a) {
     TEST_REQUIRES_ARM_NEON_FP16_ARITH;
     for (size_t k = 5; k < 8; k++) {
       GemmMicrokernelTester()
         .mr(8)
-        .nr(16)
+        .nr(8)
         .kr(1)
         .sr(1)
         .m(8)
-        .n(16)
+        .n(8)
         .k(k)
         .a_stride(11)
-        .Test(xnn_f16_gemm_minmax_ukernel_8x16__neonfp16arith_ld64, xnn_init_f16_scaleminmax_neon_params);
+        .Test(xnn_f16_gemm_minmax_ukernel_8x8__neonfp16arith_ld64, xnn_init_f16_scaleminmax_neon_params);
     }
   }
 
-  TEST(F16_GEMM_MINMAX_8X16__NEONFP16ARITH_LD64, k_gt_4_subtile) {
+  TEST(F16_GEMM_MINMAX_8X8__NEONFP16ARITH_LD64, k_gt_4_subtile) {
     TEST_REQUIRES_ARM_NEON_FP16_ARITH;
     for (size_t k = 5; k < 8; k++) {
-      for (uint32_t n = 1; n <= 16; n++) {
+      for (uint32_t n = 1; n <= 8; n++) {
         for (uint32_t m = 1; m <= 8; m++) {
           GemmMicrokernelTester()
             .mr(8)
-            .nr(16)
+            .nr(8)
             .kr(1)
             .sr(1)
             .m(m)
             .n(n)
             .k(k)
             .iterations(1)
-            .Test(xnn_f16_gemm_minmax_ukernel_8x16__neonfp16arith_ld64, xnn_init_f16_scaleminmax_neon_params);
+            .Test(xnn_f16_gemm_minmax_ukernel_8x8__neonfp16arith_ld64, xnn_init_f16_scaleminmax_neon_params);
         }
       }
     }
   }
 
-  TEST(F16_GEMM_MINMAX_8X16__NEONFP16ARITH_LD64, k_div_4) {
+  TEST(F16_GEMM_MINMAX_8X8__NEONFP16ARITH_LD64, k_div_4) {
     TEST_REQUIRES_ARM_NEON_FP16_ARITH;
     for (size_t k = 8; k <= 40; k += 4) {
       GemmMicrokernelTester()
         .mr(8)
-        .nr(16)
+        .nr(8)
         .kr(1)
         .sr(1)
         .m(8)
-        .n(16)
+        .n(8)
         .k(k)
-        .Test(xnn_f16_gemm_minmax_ukernel_8x16__neonfp16arith_ld64, xnn_init_f16_scaleminmax_neon_params);
+        .Test(xnn_f16_gemm_minmax_ukernel_8x8__neonfp16arith_ld64, xnn_init_f16_scaleminmax_neon_params);
     }
   }
 
-  TEST(F16_GEMM_MINMAX_8X16__NEONFP16ARITH_LD64, k_div_4_strided_a) {
+  TEST(F16_GEMM_MINMAX_8X8__NEONFP16ARITH_LD64, k_div_4_strided_a) {
     TEST_REQUIRES_ARM_NEON_FP16_ARITH;
     for (size_t k = 8; k <= 40; k += 4) {
       GemmMicrokernelTester()
         .mr(8)
-        .nr(16)
+        .nr(8)
         .kr(1)
         .sr(1)
         .m(8)
-        .n(16)
+        .n(8)
         .k(k)
         .a_stride(43)
-        .Test(xnn_f16_gemm_minmax_ukernel_8x16__neonfp16arith_ld64, xnn_init_f16_scaleminmax_neon_params);
+        .Test(xnn_f16_gemm_minmax_ukernel_8x8__neonfp16arith_ld64, xnn_init_f16_scaleminmax_neon_params);
     }
   }
 
-  TEST(F16_GEMM_MINMAX_8X16__NEONFP16ARITH_LD64, k_div_4_subtile) {
+  TEST(F16_GEMM_MINMAX_8X8__NEONFP16ARITH_LD64, k_div_4_subtile) {
     TEST_REQUIRES_ARM_NEON_FP16_ARITH;
     for (size_t k = 8; k <= 40; k += 4) {
-      for (uint32_t n = 1; n <= 16; n++) {
+      for (uint32_t n = 1; n <= 8; n++) {
         for (uint32_t m = 1; m <= 8; m++) {
           GemmMicrokernelTester()
             .mr(8)
-            .nr(16)
+            .nr(8)
             .kr(1)
             .sr(1)
             .m(m)
             .n(n)
             .k(k)
             .iterations(1)
-            .Test(xnn_f16_gemm_minmax_ukernel_8x16__neonfp16arith_ld64, xnn_init_f16_scaleminmax_neon_params);
+            .Test(xnn_f16_gemm_minmax_ukernel_8x8__neonfp16arith_ld64, xnn_init_f16_scaleminmax_neon_params);
         }
       }
     }
   }
 
-  TEST(F16_GEMM_MINMAX_8X16__NEONFP16ARITH_LD64, n_gt_16) {
+  TEST(F16_GEMM_MINMAX_8X8__NEONFP16ARITH_LD64, n_gt_8) {
     TEST_REQUIRES_ARM_NEON_FP16_ARITH;
-    for (uint32_t n = 17; n < 32; n++) {
+    for (uint32_t n = 9; n < 16; n++) {
       for (size_t k = 1; k <= 20; k += 5) {
         GemmMicrokernelTester()
           .mr(8)
-          .nr(16)
+          .nr(8)
           .kr(1)
           .sr(1)
           .m(8)
           .n(n)
           .k(k)
-          .Test(xnn_f16_gemm_minmax_ukernel_8x16__neonfp16arith_ld64, xnn_init_f16_scaleminmax_neon_params);
+          .Test(xnn_f16_gemm_minmax_ukernel_8x8__neonfp16arith_ld64, xnn_init_f16_scaleminmax_neon_params);
       }
     }
   }
 
-  TEST(F16_GEMM_MINMAX_8X16__NEONFP16ARITH_LD64, n_gt_16_strided_cn) {
+  TEST(F16_GEMM_MINMAX_8X8__NEONFP16ARITH_LD64, n_gt_8_strided_cn) {
     TEST_REQUIRES_ARM_NEON_FP16_ARITH;
-    for (uint32_t n = 17; n < 32; n++) {
+    for (uint32_t n = 9; n < 16; n++) {
       for (size_t k = 1; k <= 20; k += 5) {
         GemmMicrokernelTester()
           .mr(8)
-          .nr(16)
+          .nr(8)
           .kr(1)
           .sr(1)
           .m(8)
           .n(n)
           .k(k)
-          .cn_stride(19)
-          .Test(xnn_f16_gemm_minmax_ukernel_8x16__neonfp16arith_ld64, xnn_init_f16_scaleminmax_neon_params);
+          .cn_stride(11)
+          .Test(xnn_f16_gemm_minmax_ukernel_8x8__neonfp16arith_ld64, xnn_init_f16_scaleminmax_neon_params);
       }
     }
   }
 
-  TEST(F16_GEMM_MINMAX_8X16__NEONFP16ARITH_LD64, n_gt_16_strided_a) {
+  TEST(F16_GEMM_MINMAX_8X8__NEONFP16ARITH_LD64, n_gt_8_strided_a) {
     TEST_REQUIRES_ARM_NEON_FP16_ARITH;
-    for (uint32_t n = 17; n < 32; n++) {
+    for (uint32_t n = 9; n < 16; n++) {
       for (size_t k = 1; k <= 20; k += 5) {
         GemmMicrokernelTester()
           .mr(8)
-          .nr(16)
+          .nr(8)
           .kr(1)
           .sr(1)
           .m(8)
           .n(n)
           .k(k)
           .a_stride(23)
-          .Test(xnn_f16_gemm_minmax_ukernel_8x16__neonfp16arith_ld64, xnn_init_f16_scaleminmax_neon_params);
+          .Test(xnn_f16_gemm_minmax_ukernel_8x8__neonfp16arith_ld64, xnn_init_f16_scaleminmax_neon_params);
       }
     }
   }
 
-  TEST(F16_GEMM_MINMAX_8X16__NEONFP16ARITH_LD64, n_gt_16_subtile) {
+  TEST(F16_GEMM_MINMAX_8X8__NEONFP16ARITH_LD64, n_gt_8_subtile) {
     TEST_REQUIRES_ARM_NEON_FP16_ARITH;
-    for (uint32_t n = 17; n < 32; n++) {
+    for (uint32_t n = 9; n < 16; n++) {
       for (size_t k = 1; k <= 20; k += 5) {
         for (uint32_t m = 1; m <= 8; m++) {
           GemmMicrokernelTester()
             .mr(8)
-            .nr(16)
+            .nr(8)
             .kr(1)
             .sr(1)
             .m(m)
             .n(n)
             .k(k)
             .iterations(1)
-            .Test(xnn_f16_gemm_minmax_ukernel_8x16__neonfp16arith_ld64, xnn_init_f16_scaleminmax_neon_params);
+            .Test(xnn_f16_gemm_minmax_ukernel_8x8__neonfp16arith_ld64, xnn_init_f16_scaleminmax_neon_params);
         }
       }
     }
   }
 
-  TEST(F16_GEMM_MINMAX_8X16__NEONFP16ARITH_LD64, n_div_16) {
+  TEST(F16_GEMM_MINMAX_8X8__NEONFP16ARITH_LD64, n_div_8) {
     TEST_REQUIRES_ARM_NEON_FP16_ARITH;
-    for (uint32_t n = 32; n <= 48; n += 16) {
+    for (uint32_t n = 16; n <= 24; n += 8) {
       for (size_t k = 1; k <= 20; k += 5) {
         GemmMicrokernelTester()
           .mr(8)
-          .nr(16)
+          .nr(8)
           .kr(1)
           .sr(1)
           .m(8)
           .n(n)
           .k(k)
-          .Test(xnn_f16_gemm_minmax_ukernel_8x16__neonfp16arith_ld64, xnn_init_f16_scaleminmax_neon_params);
+          .Test(xnn_f16_gemm_minmax_ukernel_8x8__neonfp16arith_ld64, xnn_init_f16_scaleminmax_neon_params);
       }
     }
   }
 
-  TEST(F16_GEMM_MINMAX_8X16__NEONFP16ARITH_LD64, n_div_16_strided_cn) {
+  TEST(F16_GEMM_MINMAX_8X8__NEONFP16ARITH_LD64, n_div_8_strided_cn) {
     TEST_REQUIRES_ARM_NEON_FP16_ARITH;
-    for (uint32_t n = 32; n <= 48; n += 16) {
+    for (uint32_t n = 16; n <= 24; n += 8) {
       for (size_t k = 1; k <= 20; k += 5) {
         GemmMicrokernelTester()
           .mr(8)
-          .nr(16)
+          .nr(8)
           .kr(1)
           .sr(1)
           .m(8)
           .n(n)
           .k(k)
-          .cn_stride(19)
-          .Test(xnn_f16_gemm_minmax_ukernel_8x16__neonfp16arith_ld64, xnn_init_f16_scaleminmax_neon_params);
+          .cn_stride(11)
+          .Test(xnn_f16_gemm_minmax_ukernel_8x8__neonfp16arith_ld64, xnn_init_f16_scaleminmax_neon_params);
       }
     }
   }
 
-  TEST(F16_GEMM_MINMAX_8X16__NEONFP16ARITH_LD64, n_div_16_strided_a) {
+  TEST(F16_GEMM_MINMAX_8X8__NEONFP16ARITH_LD64, n_div_8_strided_a) {
     TEST_REQUIRES_ARM_NEON_FP16_ARITH;
-    for (uint32_t n = 32; n <= 48; n += 16) {
+    for (uint32_t n = 16; n <= 24; n += 8) {
       for (size_t k = 1; k <= 20; k += 5) {
         GemmMicrokernelTester()
           .mr(8)
-          .nr(16)
+          .nr(8)
           .kr(1)
           .sr(1)
           .m(8)
           .n(n)
           .k(k)
           .a_stride(23)
-          .Test(xnn_f16_gemm_minmax_ukernel_8x16__neonfp16arith_ld64, xnn_init_f16_scaleminmax_neon_params);
+          .Test(xnn_f16_gemm_minmax_ukernel_8x8__neonfp16arith_ld64, xnn_init_f16_scaleminmax_neon_params);
       }
     }
   }
 
-  TEST(F16_GEMM_MINMAX_8X16__NEONFP16ARITH_LD64, n_div_16_subtile) {
+  TEST(F16_GEMM_MINMAX_8X8__NEONFP16ARITH_LD64, n_div_8_subtile) {
     TEST_REQUIRES_ARM_NEON_FP16_ARITH;
-    for (uint32_t n = 32; n <= 48; n += 16) {
+    for (uint32_t n = 16; n <= 24; n += 8) {
       for (size_t k = 1; k <= 20; k += 5) {
         for (uint32_t m = 1; m <= 8; m++) {
           GemmMicrokernelTester()
             .mr(8)
-            .nr(16)
+            .nr(8)
             .kr(1)
             .sr(1)
             .m(m)
             .n(n)
             .k(k)
             .iterations(1)
-            .Test(xnn_f16_gemm_minmax_ukernel_8x16__neonfp16arith_ld64, xnn_init_f16_scaleminmax_neon_params);
+            .Test(xnn_f16_gemm_minmax_ukernel_8x8__neonfp16arith_ld64, xnn_init_f16_scaleminmax_neon_params);
         }
       }
     }
   }
 
-  TEST(F16_GEMM_MINMAX_8X16__NEONFP16ARITH_LD64, strided_cm_subtile) {
+  TEST(F16_GEMM_MINMAX_8X8__NEONFP16ARITH_LD64, strided_cm_subtile) {
     TEST_REQUIRES_ARM_NEON_FP16_ARITH;
     for (size_t k = 1; k <= 20; k += 5) {
-      for (uint32_t n = 1; n <= 16; n++) {
+      for (uint32_t n = 1; n <= 8; n++) {
         for (uint32_t m = 1; m <= 8; m++) {
           GemmMicrokernelTester()
             .mr(8)
-            .nr(16)
+            .nr(8)
             .kr(1)
             .sr(1)
             .m(m)
             .n(n)
             .k(k)
-            .cm_stride(19)
+            .cm_stride(11)
             .iterations(1)
-            .Test(xnn_f16_gemm_minmax_ukernel_8x16__neonfp16arith_ld64, xnn_init_f16_scaleminmax_neon_params);
+            .Test(xnn_f16_gemm_minmax_ukernel_8x8__neonfp16arith_ld64, xnn_init_f16_scaleminmax_neon_params);
         }
       }
     }
   }
 
-  TEST(F16_GEMM_MINMAX_8X16__NEONFP16ARITH_LD64, qmin) {
+  TEST(F16_GEMM_MINMAX_8X8__NEONFP16ARITH_LD64, qmin) {
     TEST_REQUIRES_ARM_NEON_FP16_ARITH;
     GemmMicrokernelTester()
       .mr(8)
-      .nr(16)
+      .nr(8)
       .kr(1)
       .sr(1)
       .m(8)
-      .n(16)
+      .n(8)
       .k(4)
       .qmin(128)
-      .Test(xnn_f16_gemm_minmax_ukernel_8x16__neonfp16arith_ld64, xnn_init_f16_scaleminmax_neon_params);
+      .Test(xnn_f16_gemm_minmax_ukernel_8x8__neonfp16arith_ld64, xnn_init_f16_scaleminmax_neon_params);
   }
 
-  TEST(F16_GEMM_MINMAX_8X16__NEONFP16ARITH_LD64, qmax) {
+  TEST(F16_GEMM_MINMAX_8X8__NEONFP16ARITH_LD64, qmax) {
     TEST_REQUIRES_ARM_NEON_FP16_ARITH;
     GemmMicrokernelTester()
       .mr(8)
-      .nr(16)
+      .nr(8)
       .kr(1)
       .sr(1)
       .m(8)
-      .n(16)
+      .n(8)
       .k(4)
       .qmax(128)
-      .Test(xnn_f16_gemm_minmax_ukernel_8x16__neonfp16arith_ld64, xnn_init_f16_scaleminmax_neon_params);
+      .Test(xnn_f16_gemm_minmax_ukernel_8x8__neonfp16arith_ld64, xnn_init_f16_scaleminmax_neon_params);
   }
 
-  TEST(F16_GEMM_MINMAX_8X16__NEONFP16ARITH_LD64, strided_cm) {
+  TEST(F16_GEMM_MINMAX_8X8__NEONFP16ARITH_LD64, strided_cm) {
     TEST_REQUIRES_ARM_NEON_FP16_ARITH;
     GemmMicrokernelTester()
       .mr(8)
-      .nr(16)
+      .nr(8)
       .kr(1)
       .sr(1)
       .m(8)
-      .n(16)
+      .n(8)
       .k(4)
-      .cm_stride(19)
-      .Test(xnn_f16_gemm_minmax_ukernel_8x16__neonfp16arith_ld64, xnn_init_f16_scaleminmax_neon_params);
+      .cm_stride(11)
+      .Test(xnn_f16_gemm_minmax_ukernel_8x8__neonfp16arith_ld64, xnn_init_f16_scaleminmax_neon_params);
   }
 #endif  // XNN_ARCH_ARM64
 
 
-#if XNN_ARCH_ARM64 && XNN_ENABLE_ASSEMBLY
-  TEST(F16_GEMM_MINMAX_1X8__AARCH64_NEONFP16ARITH_LD64, k_eq_4) {
+#if XNN_ARCH_ARM64
+  TEST(F16_GEMM_MINMAX_8X16__NEONFP16ARITH_LD64, k_eq_4) {
     TEST_REQUIRES_ARM_NEON_FP16_ARITH;
     GemmMicrokernelTester()
-      .mr(1)
-      .nr(8)
+      .mr(8)
+      .nr(16)
       .kr(1)
       .sr(1)
-      .m(1)
-      .n(8)
+      .m(8)
+      .n(16)
       .k(4)
-      .Test(xnn_f16_gemm_minmax_ukernel_1x8__aarch64_neonfp16arith_ld64, xnn_init_f16_scaleminmax_neon_params);
+      .Test(xnn_f16_gemm_minmax_ukernel_8x16__neonfp16arith_ld64, xnn_init_f16_scaleminmax_neon_params);
   }
 
-  TEST(F16_GEMM_MINMAX_1X8__AARCH64_NEONFP16ARITH_LD64, strided_cn) {
+  TEST(F16_GEMM_MINMAX_8X16__NEONFP16ARITH_LD64, strided_cn) {
     TEST_REQUIRES_ARM_NEON_FP16_ARITH;
     GemmMicrokernelTester()
-      .mr(1)
-      .nr(8)
+      .mr(8)
+      .nr(16)
       .kr(1)
       .sr(1)
-      .m(1)
-      .n(8)
+      .m(8)
+      .n(16)
       .k(4)
-      .cn_stride(11)
-      .Test(xnn_f16_gemm_minmax_ukernel_1x8__aarch64_neonfp16arith_ld64, xnn_init_f16_scaleminmax_neon_params);
+      .cn_stride(19)
+      .Test(xnn_f16_gemm_minmax_ukernel_8x16__neonfp16arith_ld64, xnn_init_f16_scaleminmax_neon_params);
   }
 
-  TEST(F16_GEMM_MINMAX_1X8__AARCH64_NEONFP16ARITH_LD64, k_eq_4_strided_a) {
+  TEST(F16_GEMM_MINMAX_8X16__NEONFP16ARITH_LD64, k_eq_4_strided_a) {
     TEST_REQUIRES_ARM_NEON_FP16_ARITH;
     GemmMicrokernelTester()
-      .mr(1)
-      .nr(8)
+      .mr(8)
+      .nr(16)
       .kr(1)
       .sr(1)
-      .m(1)
-      .n(8)
+      .m(8)
+      .n(16)
       .k(4)
       .a_stride(7)
-      .Test(xnn_f16_gemm_minmax_ukernel_1x8__aarch64_neonfp16arith_ld64, xnn_init_f16_scaleminmax_neon_params);
+      .Test(xnn_f16_gemm_minmax_ukernel_8x16__neonfp16arith_ld64, xnn_init_f16_scaleminmax_neon_params);
   }
 
-  TEST(F16_GEMM_MINMAX_1X8__AARCH64_NEONFP16ARITH_LD64, k_eq_4_subtile) {
+  TEST(F16_GEMM_MINMAX_8X16__NEONFP16ARITH_LD64, k_eq_4_subtile) {
     TEST_REQUIRES_ARM_NEON_FP16_ARITH;
-    for (uint32_t n = 1; n <= 8; n++) {
-      for (uint32_t m = 1; m <= 1; m++) {
+    for (uint32_t n = 1; n <= 16; n++) {
+      for (uint32_t m = 1; m <= 8; m++) {
         GemmMicrokernelTester()
-          .mr(1)
-          .nr(8)
+          .mr(8)
+          .nr(16)
           .kr(1)
           .sr(1)
           .m(m)
           .n(n)
           .k(4)
           .iterations(1)
-          .Test(xnn_f16_gemm_minmax_ukernel_1x8__aarch64_neonfp16arith_ld64, xnn_init_f16_scaleminmax_neon_params);
+          .Test(xnn_f16_gemm_minmax_ukernel_8x16__neonfp16arith_ld64, xnn_init_f16_scaleminmax_neon_params);
       }
     }
   }
 
-  TEST(F16_GEMM_MINMAX_1X8__AARCH64_NEONFP16ARITH_LD64, k_eq_4_subtile_m) {
+  TEST(F16_GEMM_MINMAX_8X16__NEONFP16ARITH_LD64, k_eq_4_subtile_m) {
     TEST_REQUIRES_ARM_NEON_FP16_ARITH;
-    for (uint32_t m = 1; m <= 1; m++) {
+    for (uint32_t m = 1; m <= 8; m++) {
       GemmMicrokernelTester()
-        .mr(1)
-        .nr(8)
+        .mr(8)
+        .nr(16)
         .kr(1)
         .sr(1)
         .m(m)
-        .n(8)
+        .n(16)
         .k(4)
         .iterations(1)
-        .Test(xnn_f16_gemm_minmax_ukernel_1x8__aarch64_neonfp16arith_ld64, xnn_init_f16_scaleminmax_neon_params);
+        .Test(xnn_f16_gemm_minmax_ukernel_8x16__neonfp16arith_ld64, xnn_init_f16_scaleminmax_neon_params);
     }
   }
 
-  TEST(F16_GEMM_MINMAX_1X8__AARCH64_NEONFP16ARITH_LD64, k_eq_4_subtile_n) {
+  TEST(F16_GEMM_MINMAX_8X16__NEONFP16ARITH_LD64, k_eq_4_subtile_n) {
     TEST_REQUIRES_ARM_NEON_FP16_ARITH;
-    for (uint32_t n = 1; n <= 8; n++) {
+    for (uint32_t n = 1; n <= 16; n++) {
       GemmMicrokernelTester()
-        .mr(1)
-        .nr(8)
+        .mr(8)
+        .nr(16)
         .kr(1)
         .sr(1)
-        .m(1)
+        .m(8)
         .n(n)
         .k(4)
         .iterations(1)
-        .Test(xnn_f16_gemm_minmax_ukernel_1x8__aarch64_neonfp16arith_ld64, xnn_init_f16_scaleminmax_neon_params);
+        .Test(xnn_f16_gemm_minmax_ukernel_8x16__neonfp16arith_ld64, xnn_init_f16_scaleminmax_neon_params);
     }
   }
 
-  TEST(F16_GEMM_MINMAX_1X8__AARCH64_NEONFP16ARITH_LD64, k_lt_4) {
+  TEST(F16_GEMM_MINMAX_8X16__NEONFP16ARITH_LD64, k_lt_4) {
     TEST_REQUIRES_ARM_NEON_FP16_ARITH;
     for (size_t k = 1; k < 4; k++) {
       GemmMicrokernelTester()
-        .mr(1)
-        .nr(8)
+        .mr(8)
+        .nr(16)
         .kr(1)
         .sr(1)
-        .m(1)
-        .n(8)
+        .m(8)
+        .n(16)
         .k(k)
-        .Test(xnn_f16_gemm_minmax_ukernel_1x8__aarch64_neonfp16arith_ld64, xnn_init_f16_scaleminmax_neon_params);
+        .Test(xnn_f16_gemm_minmax_ukernel_8x16__neonfp16arith_ld64, xnn_init_f16_scaleminmax_neon_params);
     }
   }
 
-  TEST(F16_GEMM_MINMAX_1X8__AARCH64_NEONFP16ARITH_LD64, k_lt_4_strided_a) {
+  TEST(F16_GEMM_MINMAX_8X16__NEONFP16ARITH_LD64, k_lt_4_strided_a) {
     TEST_REQUIRES_ARM_NEON_FP16_ARITH;
     for (size_t k = 1; k < 4; k++) {
       GemmMicrokernelTester()
-        .mr(1)
-        .nr(8)
+        .mr(8)
+        .nr(16)
         .kr(1)
         .sr(1)
-        .m(1)
-        .n(8)
+        .m(8)
+        .n(16)
         .k(k)
         .a_stride(7)
-        .Test(xnn_f16_gemm_minmax_ukernel_1x8__aarch64_neonfp16arith_ld64, xnn_init_f16_scaleminmax_neon_params);
+        .Test(xnn_f16_gemm_minmax_ukernel_8x16__neonfp16arith_ld64, xnn_init_f16_scaleminmax_neon_params);
     }
   }
 
-  TEST(F16_GEMM_MINMAX_1X8__AARCH64_NEONFP16ARITH_LD64, k_lt_4_subtile) {
+  TEST(F16_GEMM_MINMAX_8X16__NEONFP16ARITH_LD64, k_lt_4_subtile) {
     TEST_REQUIRES_ARM_NEON_FP16_ARITH;
     for (size_t k = 1; k < 4; k++) {
-      for (uint32_t n = 1; n <= 8; n++) {
-        for (uint32_t m = 1; m <= 1; m++) {
+      for (uint32_t n = 1; n <= 16; n++) {
+        for (uint32_t m = 1; m <= 8; m++) {
           GemmMicrokernelTester()
-            .mr(1)
-            .nr(8)
+            .mr(8)
+            .nr(16)
             .kr(1)
             .sr(1)
             .m(m)
             .n(n)
             .k(k)
             .iterations(1)
-            .Test(xnn_f16_gemm_minmax_ukernel_1x8__aarch64_neonfp16arith_ld64, xnn_init_f16_scaleminmax_neon_params);
+            .Test(xnn_f16_gemm_minmax_ukernel_8x16__neonfp16arith_ld64, xnn_init_f16_scaleminmax_neon_params);
         }
       }
     }
   }
 
-  TEST(F16_GEMM_MINMAX_1X8__AARCH64_NEONFP16ARITH_LD64, k_gt_4) {
+  TEST(F16_GEMM_MINMAX_8X16__NEONFP16ARITH_LD64, k_gt_4) {
     TEST_REQUIRES_ARM_NEON_FP16_ARITH;
     for (size_t k = 5; k < 8; k++) {
       GemmMicrokernelTester()
-        .mr(1)
-        .nr(8)
+        .mr(8)
+        .nr(16)
         .kr(1)
         .sr(1)
-        .m(1)
-        .n(8)
+        .m(8)
+        .n(16)
         .k(k)
-        .Test(xnn_f16_gemm_minmax_ukernel_1x8__aarch64_neonfp16arith_ld64, xnn_init_f16_scaleminmax_neon_params);
+        .Test(xnn_f16_gemm_minmax_ukernel_8x16__neonfp16arith_ld64, xnn_init_f16_scaleminmax_neon_params);
     }
   }
 
-  TEST(F16_GEMM_MINMAX_1X8__AARCH64_NEONFP16ARITH_LD64, k_gt_4_strided_a) {
+  TEST(F16_GEMM_MINMAX_8X16__NEONFP16ARITH_LD64, k_gt_4_strided_a) {
     TEST_REQUIRES_ARM_NEON_FP16_ARITH;
     for (size_t k = 5; k < 8; k++) {
       GemmMicrokernelTester()
-        .mr(1)
-        .nr(8)
+        .mr(8)
+        .nr(16)
         .kr(1)
         .sr(1)
-        .m(1)
-        .n(8)
+        .m(8)
+        .n(16)
         .k(k)
         .a_stride(11)
-        .Test(xnn_f16_gemm_minmax_ukernel_1x8__aarch64_neonfp16arith_ld64, xnn_init_f16_scaleminmax_neon_params);
+        .Test(xnn_f16_gemm_minmax_ukernel_8x16__neonfp16arith_ld64, xnn_init_f16_scaleminmax_neon_params);
     }
   }
 
-  TEST(F16_GEMM_MINMAX_1X8__AARCH64_NEONFP16ARITH_LD64, k_gt_4_subtile) {
+  TEST(F16_GEMM_MINMAX_8X16__NEONFP16ARITH_LD64, k_gt_4_subtile) {
     TEST_REQUIRES_ARM_NEON_FP16_ARITH;
     for (size_t k = 5; k < 8; k++) {
-      for (uint32_t n = 1; n <= 8; n++) {
-        for (uint32_t m = 1; m <= 1; m++) {
+      for (uint32_t n = 1; n <= 16; n++) {
+        for (uint32_t m = 1; m <= 8; m++) {
           GemmMicrokernelTester()
-            .mr(1)
-            .nr(8)
+            .mr(8)
+            .nr(16)
             .kr(1)
             .sr(1)
             .m(m)
             .n(n)
             .k(k)
             .iterations(1)
-            .Test(xnn_f16_gemm_minmax_ukernel_1x8__aarch64_neonfp16arith_ld64, xnn_init_f16_scaleminmax_neon_params);
+            .Test(xnn_f16_gemm_minmax_ukernel_8x16__neonfp16arith_ld64, xnn_init_f16_scaleminmax_neon_params);
         }
       }
     }
   }
 
-  TEST(F16_GEMM_MINMAX_1X8__AARCH64_NEONFP16ARITH_LD64, k_div_4) {
+  TEST(F16_GEMM_MINMAX_8X16__NEONFP16ARITH_LD64, k_div_4) {
     TEST_REQUIRES_ARM_NEON_FP16_ARITH;
     for (size_t k = 8; k <= 40; k += 4) {
       GemmMicrokernelTester()
-        .mr(1)
-        .nr(8)
+        .mr(8)
+        .nr(16)
         .kr(1)
         .sr(1)
-        .m(1)
-        .n(8)
+        .m(8)
+        .n(16)
         .k(k)
-        .Test(xnn_f16_gemm_minmax_ukernel_1x8__aarch64_neonfp16arith_ld64, xnn_init_f16_scaleminmax_neon_params);
+        .Test(xnn_f16_gemm_minmax_ukernel_8x16__neonfp16arith_ld64, xnn_init_f16_scaleminmax_neon_params);
     }
   }
 
-  TEST(F16_GEMM_MINMAX_1X8__AARCH64_NEONFP16ARITH_LD64, k_div_4_strided_a) {
+  TEST(F16_GEMM_MINMAX_8X16__NEONFP16ARITH_LD64, k_div_4_strided_a) {
     TEST_REQUIRES_ARM_NEON_FP16_ARITH;
     for (size_t k = 8; k <= 40; k += 4) {
       GemmMicrokernelTester()
-        .mr(1)
-        .nr(8)
+        .mr(8)
+        .nr(16)
         .kr(1)
         .sr(1)
-        .m(1)
-        .n(8)
+        .m(8)
+        .n(16)
         .k(k)
         .a_stride(43)
-        .Test(xnn_f16_gemm_minmax_ukernel_1x8__aarch64_neonfp16arith_ld64, xnn_init_f16_scaleminmax_neon_params);
+        .Test(xnn_f16_gemm_minmax_ukernel_8x16__neonfp16arith_ld64, xnn_init_f16_scaleminmax_neon_params);
     }
   }
 
-  TEST(F16_GEMM_MINMAX_1X8__AARCH64_NEONFP16ARITH_LD64, k_div_4_subtile) {
+  TEST(F16_GEMM_MINMAX_8X16__NEONFP16ARITH_LD64, k_div_4_subtile) {
     TEST_REQUIRES_ARM_NEON_FP16_ARITH;
     for (size_t k = 8; k <= 40; k += 4) {
-      for (uint32_t n = 1; n <= 8; n++) {
-        for (uint32_t m = 1; m <= 1; m++) {
+      for (uint32_t n = 1; n <= 16; n++) {
+        for (uint32_t m = 1; m <= 8; m++) {
           GemmMicrokernelTester()
-            .mr(1)
-            .nr(8)
+            .mr(8)
+            .nr(16)
             .kr(1)
             .sr(1)
             .m(m)
             .n(n)
             .k(k)
             .iterations(1)
-            .Test(xnn_f16_gemm_minmax_ukernel_1x8__aarch64_neonfp16arith_ld64, xnn_init_f16_scaleminmax_neon_params);
+            .Test(xnn_f16_gemm_minmax_ukernel_8x16__neonfp16arith_ld64, xnn_init_f16_scaleminmax_neon_params);
         }
       }
     }
   }
 
-  TEST(F16_GEMM_MINMAX_1X8__AARCH64_NEONFP16ARITH_LD64, n_gt_8) {
+  TEST(F16_GEMM_MINMAX_8X16__NEONFP16ARITH_LD64, n_gt_16) {
     TEST_REQUIRES_ARM_NEON_FP16_ARITH;
-    for (uint32_t n = 9; n < 16; n++) {
+    for (uint32_t n = 17; n < 32; n++) {
       for (size_t k = 1; k <= 20; k += 5) {
         GemmMicrokernelTester()
-          .mr(1)
-          .nr(8)
+          .mr(8)
+          .nr(16)
           .kr(1)
           .sr(1)
-          .m(1)
+          .m(8)
           .n(n)
           .k(k)
-          .Test(xnn_f16_gemm_minmax_ukernel_1x8__aarch64_neonfp16arith_ld64, xnn_init_f16_scaleminmax_neon_params);
+          .Test(xnn_f16_gemm_minmax_ukernel_8x16__neonfp16arith_ld64, xnn_init_f16_scaleminmax_neon_params);
       }
     }
   }
 
-  TEST(F16_GEMM_MINMAX_1X8__AARCH64_NEONFP16ARITH_LD64, n_gt_8_strided_cn) {
+  TEST(F16_GEMM_MINMAX_8X16__NEONFP16ARITH_LD64, n_gt_16_strided_cn) {
     TEST_REQUIRES_ARM_NEON_FP16_ARITH;
-    for (uint32_t n = 9; n < 16; n++) {
+    for (uint32_t n = 17; n < 32; n++) {
       for (size_t k = 1; k <= 20; k += 5) {
         GemmMicrokernelTester()
-          .mr(1)
-          .nr(8)
+          .mr(8)
+          .nr(16)
           .kr(1)
           .sr(1)
-          .m(1)
+          .m(8)
           .n(n)
           .k(k)
-          .cn_stride(11)
-          .Test(xnn_f16_gemm_minmax_ukernel_1x8__aarch64_neonfp16arith_ld64, xnn_init_f16_scaleminmax_neon_params);
+          .cn_stride(19)
+          .Test(xnn_f16_gemm_minmax_ukernel_8x16__neonfp16arith_ld64, xnn_init_f16_scaleminmax_neon_params);
       }
     }
   }
 
-  TEST(F16_GEMM_MINMAX_1X8__AARCH64_NEONFP16ARITH_LD64, n_gt_8_strided_a) {
+  TEST(F16_GEMM_MINMAX_8X16__NEONFP16ARITH_LD64, n_gt_16_strided_a) {
     TEST_REQUIRES_ARM_NEON_FP16_ARITH;
-    for (uint32_t n = 9; n < 16; n++) {
+    for (uint32_t n = 17; n < 32; n++) {
       for (size_t k = 1; k <= 20; k += 5) {
         GemmMicrokernelTester()
-          .mr(1)
-          .nr(8)
+          .mr(8)
+          .nr(16)
           .kr(1)
           .sr(1)
-          .m(1)
+          .m(8)
           .n(n)
           .k(k)
           .a_stride(23)
-          .Test(xnn_f16_gemm_minmax_ukernel_1x8__aarch64_neonfp16arith_ld64, xnn_init_f16_scaleminmax_neon_params);
+          .Test(xnn_f16_gemm_minmax_ukernel_8x16__neonfp16arith_ld64, xnn_init_f16_scaleminmax_neon_params);
       }
     }
   }
 
-  TEST(F16_GEMM_MINMAX_1X8__AARCH64_NEONFP16ARITH_LD64, n_gt_8_subtile) {
+  TEST(F16_GEMM_MINMAX_8X16__NEONFP16ARITH_LD64, n_gt_16_subtile) {
     TEST_REQUIRES_ARM_NEON_FP16_ARITH;
-    for (uint32_t n = 9; n < 16; n++) {
+    for (uint32_t n = 17; n < 32; n++) {
       for (size_t k = 1; k <= 20; k += 5) {
-        for (uint32_t m = 1; m <= 1; m++) {
+        for (uint32_t m = 1; m <= 8; m++) {
           GemmMicrokernelTester()
-            .mr(1)
-            .nr(8)
+            .mr(8)
+            .nr(16)
             .kr(1)
             .sr(1)
             .m(m)
             .n(n)
             .k(k)
             .iterations(1)
-            .Test(xnn_f16_gemm_minmax_ukernel_1x8__aarch64_neonfp16arith_ld64, xnn_init_f16_scaleminmax_neon_params);
+            .Test(xnn_f16_gemm_minmax_ukernel_8x16__neonfp16arith_ld64, xnn_init_f16_scaleminmax_neon_params);
         }
       }
     }
   }
 
-  TEST(F16_GEMM_MINMAX_1X8__AARCH64_NEONFP16ARITH_LD64, n_div_8) {
+  TEST(F16_GEMM_MINMAX_8X16__NEONFP16ARITH_LD64, n_div_16) {
     TEST_REQUIRES_ARM_NEON_FP16_ARITH;
-    for (uint32_t n = 16; n <= 24; n += 8) {
+    for (uint32_t n = 32; n <= 48; n += 16) {
       for (size_t k = 1; k <= 20; k += 5) {
         GemmMicrokernelTester()
-          .mr(1)
-          .nr(8)
+          .mr(8)
+          .nr(16)
           .kr(1)
           .sr(1)
-          .m(1)
+          .m(8)
           .n(n)
           .k(k)
-          .Test(xnn_f16_gemm_minmax_ukernel_1x8__aarch64_neonfp16arith_ld64, xnn_init_f16_scaleminmax_neon_params);
+          .Test(xnn_f16_gemm_minmax_ukernel_8x16__neonfp16arith_ld64, xnn_init_f16_scaleminmax_neon_params);
       }
     }
   }
 
-  TEST(F16_GEMM_MINMAX_1X8__AARCH64_NEONFP16ARITH_LD64, n_div_8_strided_cn) {
+  TEST(F16_GEMM_MINMAX_8X16__NEONFP16ARITH_LD64, n_div_16_strided_cn) {
     TEST_REQUIRES_ARM_NEON_FP16_ARITH;
-    for (uint32_t n = 16; n <= 24; n += 8) {
+    for (uint32_t n = 32; n <= 48; n += 16) {
       for (size_t k = 1; k <= 20; k += 5) {
         GemmMicrokernelTester()
-          .mr(1)
-          .nr(8)
+          .mr(8)
+          .nr(16)
           .kr(1)
           .sr(1)
-          .m(1)
+          .m(8)
           .n(n)
           .k(k)
-          .cn_stride(11)
-          .Test(xnn_f16_gemm_minmax_ukernel_1x8__aarch64_neonfp16arith_ld64, xnn_init_f16_scaleminmax_neon_params);
+          .cn_stride(19)
+          .Test(xnn_f16_gemm_minmax_ukernel_8x16__neonfp16arith_ld64, xnn_init_f16_scaleminmax_neon_params);
       }
     }
   }
 
-  TEST(F16_GEMM_MINMAX_1X8__AARCH64_NEONFP16ARITH_LD64, n_div_8_strided_a) {
+  TEST(F16_GEMM_MINMAX_8X16__NEONFP16ARITH_LD64, n_div_16_strided_a) {
     TEST_REQUIRES_ARM_NEON_FP16_ARITH;
-    for (uint32_t n = 16; n <= 24; n += 8) {
+    for (uint32_t n = 32; n <= 48; n += 16) {
       for (size_t k = 1; k <= 20; k += 5) {
         GemmMicrokernelTester()
-          .mr(1)
-          .nr(8)
+          .mr(8)
+          .nr(16)
           .kr(1)
           .sr(1)
-          .m(1)
+          .m(8)
           .n(n)
           .k(k)
           .a_stride(23)
-          .Test(xnn_f16_gemm_minmax_ukernel_1x8__aarch64_neonfp16arith_ld64, xnn_init_f16_scaleminmax_neon_params);
+          .Test(xnn_f16_gemm_minmax_ukernel_8x16__neonfp16arith_ld64, xnn_init_f16_scaleminmax_neon_params);
       }
     }
   }
 
-  TEST(F16_GEMM_MINMAX_1X8__AARCH64_NEONFP16ARITH_LD64, n_div_8_subtile) {
+  TEST(F16_GEMM_MINMAX_8X16__NEONFP16ARITH_LD64, n_div_16_subtile) {
     TEST_REQUIRES_ARM_NEON_FP16_ARITH;
-    for (uint32_t n = 16; n <= 24; n += 8) {
+    for (uint32_t n = 32; n <= 48; n += 16) {
       for (size_t k = 1; k <= 20; k += 5) {
-        for (uint32_t m = 1; m <= 1; m++) {
+        for (uint32_t m = 1; m <= 8; m++) {
           GemmMicrokernelTester()
-            .mr(1)
-            .nr(8)
+            .mr(8)
+            .nr(16)
             .kr(1)
             .sr(1)
             .m(m)
             .n(n)
             .k(k)
             .iterations(1)
-            .Test(xnn_f16_gemm_minmax_ukernel_1x8__aarch64_neonfp16arith_ld64, xnn_init_f16_scaleminmax_neon_params);
+            .Test(xnn_f16_gemm_minmax_ukernel_8x16__neonfp16arith_ld64, xnn_init_f16_scaleminmax_neon_params);
         }
       }
     }
   }
 
-  TEST(F16_GEMM_MINMAX_1X8__AARCH64_NEONFP16ARITH_LD64, strided_cm_subtile) {
+  TEST(F16_GEMM_MINMAX_8X16__NEONFP16ARITH_LD64, strided_cm_subtile) {
     TEST_REQUIRES_ARM_NEON_FP16_ARITH;
     for (size_t k = 1; k <= 20; k += 5) {
-      for (uint32_t n = 1; n <= 8; n++) {
-        for (uint32_t m = 1; m <= 1; m++) {
+      for (uint32_t n = 1; n <= 16; n++) {
+        for (uint32_t m = 1; m <= 8; m++) {
           GemmMicrokernelTester()
-            .mr(1)
-            .nr(8)
+            .mr(8)
+            .nr(16)
             .kr(1)
             .sr(1)
             .m(m)
             .n(n)
             .k(k)
-            .cm_stride(11)
+            .cm_stride(19)
             .iterations(1)
-            .Test(xnn_f16_gemm_minmax_ukernel_1x8__aarch64_neonfp16arith_ld64, xnn_init_f16_scaleminmax_neon_params);
+            .Test(xnn_f16_gemm_minmax_ukernel_8x16__neonfp16arith_ld64, xnn_init_f16_scaleminmax_neon_params);
         }
       }
     }
   }
 
-  TEST(F16_GEMM_MINMAX_1X8__AARCH64_NEONFP16ARITH_LD64, qmin) {
+  TEST(F16_GEMM_MINMAX_8X16__NEONFP16ARITH_LD64, qmin) {
     TEST_REQUIRES_ARM_NEON_FP16_ARITH;
     GemmMicrokernelTester()
-      .mr(1)
-      .nr(8)
+      .mr(8)
+      .nr(16)
       .kr(1)
       .sr(1)
-      .m(1)
-      .n(8)
+      .m(8)
+      .n(16)
       .k(4)
       .qmin(128)
-      .Test(xnn_f16_gemm_minmax_ukernel_1x8__aarch64_neonfp16arith_ld64, xnn_init_f16_scaleminmax_neon_params);
+      .Test(xnn_f16_gemm_minmax_ukernel_8x16__neonfp16arith_ld64, xnn_init_f16_scaleminmax_neon_params);
   }
 
-  TEST(F16_GEMM_MINMAX_1X8__AARCH64_NEONFP16ARITH_LD64, qmax) {
+  TEST(F16_GEMM_MINMAX_8X16__NEONFP16ARITH_LD64, qmax) {
     TEST_REQUIRES_ARM_NEON_FP16_ARITH;
     GemmMicrokernelTester()
-      .mr(1)
-      .nr(8)
+      .mr(8)
+      .nr(16)
       .kr(1)
       .sr(1)
-      .m(1)
-      .n(8)
+      .m(8)
+      .n(16)
       .k(4)
       .qmax(128)
-      .Test(xnn_f16_gemm_minmax_ukernel_1x8__aarch64_neonfp16arith_ld64, xnn_init_f16_scaleminmax_neon_params);
+      .Test(xnn_f16_gemm_minmax_ukernel_8x16__neonfp16arith_ld64, xnn_init_f16_scaleminmax_neon_params);
   }
 
-  TEST(F16_GEMM_MINMAX_1X8__AARCH64_NEONFP16ARITH_LD64, strided_cm) {
+  TEST(F16_GEMM_MINMAX_8X16__NEONFP16ARITH_LD64, strided_cm) {
     TEST_REQUIRES_ARM_NEON_FP16_ARITH;
     GemmMicrokernelTester()
-      .mr(1)
-      .nr(8)
+      .mr(8)
+      .nr(16)
       .kr(1)
       .sr(1)
-      .m(1)
-      .n(8)
+      .m(8)
+      .n(16)
       .k(4)
-      .cm_stride(11)
-      .Test(xnn_f16_gemm_minmax_ukernel_1x8__aarch64_neonfp16arith_ld64, xnn_init_f16_scaleminmax_neon_params);
+      .cm_stride(19)
+      .Test(xnn_f16_gemm_minmax_ukernel_8x16__neonfp16arith_ld64, xnn_init_f16_scaleminmax_neon_params);
   }
-#endif  // XNN_ARCH_ARM64 && XNN_ENABLE_ASSEMBLY
+#endif  // XNN_ARCH_ARM64
 
 
 #if XNN_ARCH_ARM64 && XNN_ENABLE_ASSEMBLY
-  TEST(F16_GEMM_MINMAX_1X16__AARCH64_NEONFP16ARITH_LD32, k_eq_2) {
+  TEST(F16_GEMM_MINMAX_1X8__AARCH64_NEONFP16ARITH_LD64, k_eq_4) {
     TEST_REQUIRES_ARM_NEON_FP16_ARITH;
     GemmMicrokernelTester()
       .mr(1)
-      .nr(16)
+      .nr(8)
       .kr(1)
       .sr(1)
       .m(1)
-      .n(16)
-      .k(2)
-      .Test(xnn_f16_gemm_minmax_ukernel_1x16__aarch64_neonfp16arith_ld32, xnn_init_f16_scaleminmax_neon_params);
+      .n(8)
+      .k(4)
+      .Test(xnn_f16_gemm_minmax_ukernel_1x8__aarch64_neonfp16arith_ld64, xnn_init_f16_scaleminmax_neon_params);
   }
 
-  TEST(F16_GEMM_MINMAX_1X16__AARCH64_NEONFP16ARITH_LD32, strided_cn) {
+  TEST(F16_GEMM_MINMAX_1X8__AARCH64_NEONFP16ARITH_LD64, strided_cn) {
     TEST_REQUIRES_ARM_NEON_FP16_ARITH;
     GemmMicrokernelTester()
       .mr(1)
-      .nr(16)
+      .nr(8)
       .kr(1)
       .sr(1)
       .m(1)
-      .n(16)
-      .k(2)
-      .cn_stride(19)
-      .Test(xnn_f16_gemm_minmax_ukernel_1x16__aarch64_neonfp16arith_ld32, xnn_init_f16_scaleminmax_neon_params);
+      .n(8)
+      .k(4)
+      .cn_stride(11)
+      .Test(xnn_f16_gemm_minmax_ukernel_1x8__aarch64_neonfp16arith_ld64, xnn_init_f16_scaleminmax_neon_params);
   }
 
-  TEST(F16_GEMM_MINMAX_1X16__AARCH64_NEONFP16ARITH_LD32, k_eq_2_strided_a) {
+  TEST(F16_GEMM_MINMAX_1X8__AARCH64_NEONFP16ARITH_LD64, k_eq_4_strided_a) {
     TEST_REQUIRES_ARM_NEON_FP16_ARITH;
     GemmMicrokernelTester()
       .mr(1)
-      .nr(16)
+      .nr(8)
       .kr(1)
       .sr(1)
       .m(1)
-      .n(16)
-      .k(2)
-      .a_stride(5)
-      .Test(xnn_f16_gemm_minmax_ukernel_1x16__aarch64_neonfp16arith_ld32, xnn_init_f16_scaleminmax_neon_params);
+      .n(8)
+      .k(4)
+      .a_stride(7)
+      .Test(xnn_f16_gemm_minmax_ukernel_1x8__aarch64_neonfp16arith_ld64, xnn_init_f16_scaleminmax_neon_params);
   }
 
-  TEST(F16_GEMM_MINMAX_1X16__AARCH64_NEONFP16ARITH_LD32, k_eq_2_subtile) {
+  TEST(F16_GEMM_MINMAX_1X8__AARCH64_NEONFP16ARITH_LD64, k_eq_4_subtile) {
     TEST_REQUIRES_ARM_NEON_FP16_ARITH;
-    for (uint32_t n = 1; n <= 16; n++) {
+    for (uint32_t n = 1; n <= 8; n++) {
       for (uint32_t m = 1; m <= 1; m++) {
         GemmMicrokernelTester()
           .mr(1)
-          .nr(16)
+          .nr(8)
           .kr(1)
           .sr(1)
           .m(m)
           .n(n)
-          .k(2)
+          .k(4)
           .iterations(1)
-          .Test(xnn_f16_gemm_minmax_ukernel_1x16__aarch64_neonfp16arith_ld32, xnn_init_f16_scaleminmax_neon_params);
+          .Test(xnn_f16_gemm_minmax_ukernel_1x8__aarch64_neonfp16arith_ld64, xnn_init_f16_scaleminmax_neon_params);
       }
     }
   }
 
-  TEST(F16_GEMM_MINMAX_1X16__AARCH64_NEONFP16ARITH_LD32, k_eq_2_subtile_m) {
+  TEST(F16_GEMM_MINMAX_1X8__AARCH64_NEONFP16ARITH_LD64, k_eq_4_subtile_m) {
     TEST_REQUIRES_ARM_NEON_FP16_ARITH;
     for (uint32_t m = 1; m <= 1; m++) {
       GemmMicrokernelTester()
         .mr(1)
-        .nr(16)
+        .nr(8)
         .kr(1)
         .sr(1)
         .m(m)
-        .n(16)
-        .k(2)
+        .n(8)
+        .k(4)
         .iterations(1)
-        .Test(xnn_f16_gemm_minmax_ukernel_1x16__aarch64_neonfp16arith_ld32, xnn_init_f16_scaleminmax_neon_params);
+        .Test(xnn_f16_gemm_minmax_ukernel_1x8__aarch64_neonfp16arith_ld64, xnn_init_f16_scaleminmax_neon_params);
     }
   }
 
-  TEST(F16_GEMM_MINMAX_1X16__AARCH64_NEONFP16ARITH_LD32, k_eq_2_subtile_n) {
+  TEST(F16_GEMM_MINMAX_1X8__AARCH64_NEONFP16ARITH_LD64, k_eq_4_subtile_n) {
     TEST_REQUIRES_ARM_NEON_FP16_ARITH;
-    for (uint32_t n = 1; n <= 16; n++) {
+    for (uint32_t n = 1; n <= 8; n++) {
       GemmMicrokernelTester()
         .mr(1)
-        .nr(16)
+        .nr(8)
         .kr(1)
         .sr(1)
         .m(1)
         .n(n)
-        .k(2)
+        .k(4)
         .iterations(1)
-        .Test(xnn_f16_gemm_minmax_ukernel_1x16__aarch64_neonfp16arith_ld32, xnn_init_f16_scaleminmax_neon_params);
+        .Test(xnn_f16_gemm_minmax_ukernel_1x8__aarch64_neonfp16arith_ld64, xnn_init_f16_scaleminmax_neon_params);
     }
   }
 
-  TEST(F16_GEMM_MINMAX_1X16__AARCH64_NEONFP16ARITH_LD32, k_lt_2) {
+  TEST(F16_GEMM_MINMAX_1X8__AARCH64_NEONFP16ARITH_LD64, k_lt_4) {
     TEST_REQUIRES_ARM_NEON_FP16_ARITH;
-    for (size_t k = 1; k < 2; k++) {
+    for (size_t k = 1; k < 4; k++) {
       GemmMicrokernelTester()
         .mr(1)
-        .nr(16)
+        .nr(8)
         .kr(1)
         .sr(1)
         .m(1)
-        .n(16)
+        .n(8)
         .k(k)
-        .Test(xnn_f16_gemm_minmax_ukernel_1x16__aarch64_neonfp16arith_ld32, xnn_init_f16_scaleminmax_neon_params);
+        .Test(xnn_f16_gemm_minmax_ukernel_1x8__aarch64_neonfp16arith_ld64, xnn_init_f16_scaleminmax_neon_params);
     }
   }
 
-  TEST(F16_GEMM_MINMAX_1X16__AARCH64_NEONFP16ARITH_LD32, k_lt_2_strided_a) {
+  TEST(F16_GEMM_MINMAX_1X8__AARCH64_NEONFP16ARITH_LD64, k_lt_4_strided_a) {
     TEST_REQUIRES_ARM_NEON_FP16_ARITH;
-    for (size_t k = 1; k < 2; k++) {
+    for (size_t k = 1; k < 4; k++) {
       GemmMicrokernelTester()
         .mr(1)
-        .nr(16)
+        .nr(8)
         .kr(1)
         .sr(1)
         .m(1)
-        .n(16)
+        .n(8)
         .k(k)
-        .a_stride(5)
-        .Test(xnn_f16_gemm_minmax_ukernel_1x16__aarch64_neonfp16arith_ld32, xnn_init_f16_scaleminmax_neon_params);
+        .a_stride(7)
+        .Test(xnn_f16_gemm_minmax_ukernel_1x8__aarch64_neonfp16arith_ld64, xnn_init_f16_scaleminmax_neon_params);
     }
   }
 
-  TEST(F16_GEMM_MINMAX_1X16__AARCH64_NEONFP16ARITH_LD32, k_lt_2_subtile) {
+  TEST(F16_GEMM_MINMAX_1X8__AARCH64_NEONFP16ARITH_LD64, k_lt_4_subtile) {
     TEST_REQUIRES_ARM_NEON_FP16_ARITH;
-    for (size_t k = 1; k < 2; k++) {
-      for (uint32_t n = 1; n <= 16; n++) {
+    for (size_t k = 1; k < 4; k++) {
+      for (uint32_t n = 1; n <= 8; n++) {
         for (uint32_t m = 1; m <= 1; m++) {
           GemmMicrokernelTester()
             .mr(1)
-            .nr(16)
+            .nr(8)
             .kr(1)
             .sr(1)
             .m(m)
             .n(n)
             .k(k)
             .iterations(1)
-            .Test(xnn_f16_gemm_minmax_ukernel_1x16__aarch64_neonfp16arith_ld32, xnn_init_f16_scaleminmax_neon_params);
+            .Test(xnn_f16_gemm_minmax_ukernel_1x8__aarch64_neonfp16arith_ld64, xnn_init_f16_scaleminmax_neon_params);
         }
       }
     }
   }
 
-  TEST(F16_GEMM_MINMAX_1X16__AARCH64_NEONFP16ARITH_LD32, k_gt_2) {
+  TEST(F16_GEMM_MINMAX_1X8__AARCH64_NEONFP16ARITH_LD64, k_gt_4) {
     TEST_REQUIRES_ARM_NEON_FP16_ARITH;
-    for (size_t k = 3; k < 4; k++) {
+    for (size_t k = 5; k < 8; k++) {
       GemmMicrokernelTester()
         .mr(1)
-        .nr(16)
+        .nr(8)
         .kr(1)
         .sr(1)
         .m(1)
-        .n(16)
+        .n(8)
         .k(k)
-        .Test(xnn_f16_gemm_minmax_ukernel_1x16__aarch64_neonfp16arith_ld32, xnn_init_f16_scaleminmax_neon_params);
+        .Test(xnn_f16_gemm_minmax_ukernel_1x8__aarch64_neonfp16arith_ld64, xnn_init_f16_scaleminmax_neon_params);
     }
   }
 
-  TEST(F16_GEMM_MINMAX_1X16__AARCH64_NEONFP16ARITH_LD32, k_gt_2_strided_a) {
+  TEST(F16_GEMM_MINMAX_1X8__AARCH64_NEONFP16ARITH_LD64, k_gt_4_strided_a) {
     TEST_REQUIRES_ARM_NEON_FP16_ARITH;
-    for (size_t k = 3; k < 4; k++) {
+    for (size_t k = 5; k < 8; k++) {
       GemmMicrokernelTester()
         .mr(1)
-        .nr(16)
+        .nr(8)
         .kr(1)
         .sr(1)
         .m(1)
-        .n(16)
+        .n(8)
         .k(k)
-        .a_stride(7)
-        .Test(xnn_f16_gemm_minmax_ukernel_1x16__aarch64_neonfp16arith_ld32, xnn_init_f16_scaleminmax_neon_params);
+        .a_stride(11)
+        .Test(xnn_f16_gemm_minmax_ukernel_1x8__aarch64_neonfp16arith_ld64, xnn_init_f16_scaleminmax_neon_params);
     }
   }
 
-  TEST(F16_GEMM_MINMAX_1X16__AARCH64_NEONFP16ARITH_LD32, k_gt_2_subtile) {
+  TEST(F16_GEMM_MINMAX_1X8__AARCH64_NEONFP16ARITH_LD64, k_gt_4_subtile) {
     TEST_REQUIRES_ARM_NEON_FP16_ARITH;
-    for (size_t k = 3; k < 4; k++) {
-      for (uint32_t n = 1; n <= 16; n++) {
+    for (size_t k = 5; k < 8; k++) {
+      for (uint32_t n = 1; n <= 8; n++) {
         for (uint32_t m = 1; m <= 1; m++) {
           GemmMicrokernelTester()
             .mr(1)
-            .nr(16)
+            .nr(8)
             .kr(1)
             .sr(1)
             .m(m)
             .n(n)
             .k(k)
             .iterations(1)
-            .Test(xnn_f16_gemm_minmax_ukernel_1x16__aarch64_neonfp16arith_ld32, xnn_init_f16_scaleminmax_neon_params);
+            .Test(xnn_f16_gemm_minmax_ukernel_1x8__aarch64_neonfp16arith_ld64, xnn_init_f16_scaleminmax_neon_params);
         }
       }
     }
   }
 
-  TEST(F16_GEMM_MINMAX_1X16__AARCH64_NEONFP16ARITH_LD32, k_div_2) {
+  TEST(F16_GEMM_MINMAX_1X8__AARCH64_NEONFP16ARITH_LD64, k_div_4) {
     TEST_REQUIRES_ARM_NEON_FP16_ARITH;
-    for (size_t k = 4; k <= 20; k += 2) {
+    for (size_t k = 8; k <= 40; k += 4) {
       GemmMicrokernelTester()
         .mr(1)
-        .nr(16)
+        .nr(8)
         .kr(1)
         .sr(1)
         .m(1)
-        .n(16)
+        .n(8)
         .k(k)
-        .Test(xnn_f16_gemm_minmax_ukernel_1x16__aarch64_neonfp16arith_ld32, xnn_init_f16_scaleminmax_neon_params);
+        .Test(xnn_f16_gemm_minmax_ukernel_1x8__aarch64_neonfp16arith_ld64, xnn_init_f16_scaleminmax_neon_params);
     }
   }
 
-  TEST(F16_GEMM_MINMAX_1X16__AARCH64_NEONFP16ARITH_LD32, k_div_2_strided_a) {
+  TEST(F16_GEMM_MINMAX_1X8__AARCH64_NEONFP16ARITH_LD64, k_div_4_strided_a) {
     TEST_REQUIRES_ARM_NEON_FP16_ARITH;
-    for (size_t k = 4; k <= 20; k += 2) {
+    for (size_t k = 8; k <= 40; k += 4) {
       GemmMicrokernelTester()
         .mr(1)
-        .nr(16)
+        .nr(8)
         .kr(1)
         .sr(1)
         .m(1)
-        .n(16)
+        .n(8)
         .k(k)
-        .a_stride(23)
-        .Test(xnn_f16_gemm_minmax_ukernel_1x16__aarch64_neonfp16arith_ld32, xnn_init_f16_scaleminmax_neon_params);
+        .a_stride(43)
+        .Test(xnn_f16_gemm_minmax_ukernel_1x8__aarch64_neonfp16arith_ld64, xnn_init_f16_scaleminmax_neon_params);
     }
   }
 
-  TEST(F16_GEMM_MINMAX_1X16__AARCH64_NEONFP16ARITH_LD32, k_div_2_subtile) {
+  TEST(F16_GEMM_MINMAX_1X8__AARCH64_NEONFP16ARITH_LD64, k_div_4_subtile) {
     TEST_REQUIRES_ARM_NEON_FP16_ARITH;
-    for (size_t k = 4; k <= 20; k += 2) {
-      for (uint32_t n = 1; n <= 16; n++) {
+    for (size_t k = 8; k <= 40; k += 4) {
+      for (uint32_t n = 1; n <= 8; n++) {
         for (uint32_t m = 1; m <= 1; m++) {
           GemmMicrokernelTester()
             .mr(1)
-            .nr(16)
+            .nr(8)
             .kr(1)
             .sr(1)
             .m(m)
             .n(n)
             .k(k)
             .iterations(1)
-            .Test(xnn_f16_gemm_minmax_ukernel_1x16__aarch64_neonfp16arith_ld32, xnn_init_f16_scaleminmax_neon_params);
+            .Test(xnn_f16_gemm_minmax_ukernel_1x8__aarch64_neonfp16arith_ld64, xnn_init_f16_scaleminmax_neon_params);
         }
       }
     }
   }
 
-  TEST(F16_GEMM_MINMAX_1X16__AARCH64_NEONFP16ARITH_LD32, n_gt_16) {
+  TEST(F16_GEMM_MINMAX_1X8__AARCH64_NEONFP16ARITH_LD64, n_gt_8) {
     TEST_REQUIRES_ARM_NEON_FP16_ARITH;
-    for (uint32_t n = 17; n < 32; n++) {
-      for (size_t k = 1; k <= 10; k += 3) {
+    for (uint32_t n = 9; n < 16; n++) {
+      for (size_t k = 1; k <= 20; k += 5) {
         GemmMicrokernelTester()
           .mr(1)
-          .nr(16)
+          .nr(8)
           .kr(1)
           .sr(1)
           .m(1)
           .n(n)
           .k(k)
-          .Test(xnn_f16_gemm_minmax_ukernel_1x16__aarch64_neonfp16arith_ld32, xnn_init_f16_scaleminmax_neon_params);
+          .Test(xnn_f16_gemm_minmax_ukernel_1x8__aarch64_neonfp16arith_ld64, xnn_init_f16_scaleminmax_neon_params);
       }
     }
   }
 
-  TEST(F16_GEMM_MINMAX_1X16__AARCH64_NEONFP16ARITH_LD32, n_gt_16_strided_cn) {
+  TEST(F16_GEMM_MINMAX_1X8__AARCH64_NEONFP16ARITH_LD64, n_gt_8_strided_cn) {
     TEST_REQUIRES_ARM_NEON_FP16_ARITH;
-    for (uint32_t n = 17; n < 32; n++) {
-      for (size_t k = 1; k <= 10; k += 3) {
+    for (uint32_t n = 9; n < 16; n++) {
+      for (size_t k = 1; k <= 20; k += 5) {
         GemmMicrokernelTester()
           .mr(1)
-          .nr(16)
+          .nr(8)
           .kr(1)
           .sr(1)
           .m(1)
           .n(n)
           .k(k)
-          .cn_stride(19)
-          .Test(xnn_f16_gemm_minmax_ukernel_1x16__aarch64_neonfp16arith_ld32, xnn_init_f16_scaleminmax_neon_params);
+          .cn_stride(11)
+          .Test(xnn_f16_gemm_minmax_ukernel_1x8__aarch64_neonfp16arith_ld64, xnn_init_f16_scaleminmax_neon_params);
       }
     }
   }
 
-  TEST(F16_GEMM_MINMAX_1X16__AARCH64_NEONFP16ARITH_LD32, n_gt_16_strided_a) {
+  TEST(F16_GEMM_MINMAX_1X8__AARCH64_NEONFP16ARITH_LD64, n_gt_8_strided_a) {
     TEST_REQUIRES_ARM_NEON_FP16_ARITH;
-    for (uint32_t n = 17; n < 32; n++) {
-      for (size_t k = 1; k <= 10; k += 3) {
+    for (uint32_t n = 9; n < 16; n++) {
+      for (size_t k = 1; k <= 20; k += 5) {
         GemmMicrokernelTester()
           .mr(1)
-          .nr(16)
+          .nr(8)
           .kr(1)
           .sr(1)
           .m(1)
           .n(n)
           .k(k)
-          .a_stride(13)
-          .Test(xnn_f16_gemm_minmax_ukernel_1x16__aarch64_neonfp16arith_ld32, xnn_init_f16_scaleminmax_neon_params);
+          .a_stride(23)
+          .Test(xnn_f16_gemm_minmax_ukernel_1x8__aarch64_neonfp16arith_ld64, xnn_init_f16_scaleminmax_neon_params);
       }
     }
   }
 
-  TEST(F16_GEMM_MINMAX_1X16__AARCH64_NEONFP16ARITH_LD32, n_gt_16_subtile) {
+  TEST(F16_GEMM_MINMAX_1X8__AARCH64_NEONFP16ARITH_LD64, n_gt_8_subtile) {
     TEST_REQUIRES_ARM_NEON_FP16_ARITH;
-    for (uint32_t n = 17; n < 32; n++) {
-      for (size_t k = 1; k <= 10; k += 3) {
+    for (uint32_t n = 9; n < 16; n++) {
+      for (size_t k = 1; k <= 20; k += 5) {
         for (uint32_t m = 1; m <= 1; m++) {
           GemmMicrokernelTester()
             .mr(1)
-            .nr(16)
+            .nr(8)
             .kr(1)
             .sr(1)
             .m(m)
             .n(n)
             .k(k)
             .iterations(1)
-            .Test(xnn_f16_gemm_minmax_ukernel_1x16__aarch64_neonfp16arith_ld32, xnn_init_f16_scaleminmax_neon_params);
+            .Test(xnn_f16_gemm_minmax_ukernel_1x8__aarch64_neonfp16arith_ld64, xnn_init_f16_scaleminmax_neon_params);
         }
       }
     }
   }
 
-  TEST(F16_GEMM_MINMAX_1X16__AARCH64_NEONFP16ARITH_LD32, n_div_16) {
+  TEST(F16_GEMM_MINMAX_1X8__AARCH64_NEONFP16ARITH_LD64, n_div_8) {
     TEST_REQUIRES_ARM_NEON_FP16_ARITH;
-    for (uint32_t n = 32; n <= 48; n += 16) {
-      for (size_t k = 1; k <= 10; k += 3) {
+    for (uint32_t n = 16; n <= 24; n += 8) {
+      for (size_t k = 1; k <= 20; k += 5) {
         GemmMicrokernelTester()
           .mr(1)
-          .nr(16)
+          .nr(8)
           .kr(1)
           .sr(1)
           .m(1)
           .n(n)
           .k(k)
-          .Test(xnn_f16_gemm_minmax_ukernel_1x16__aarch64_neonfp16arith_ld32, xnn_init_f16_scaleminmax_neon_params);
+          .Test(xnn_f16_gemm_minmax_ukernel_1x8__aarch64_neonfp16arith_ld64, xnn_init_f16_scaleminmax_neon_params);
       }
     }
   }
 
-  TEST(F16_GEMM_MINMAX_1X16__AARCH64_NEONFP16ARITH_LD32, n_div_16_strided_cn) {
+  TEST(F16_GEMM_MINMAX_1X8__AARCH64_NEONFP16ARITH_LD64, n_div_8_strided_cn) {
     TEST_REQUIRES_ARM_NEON_FP16_ARITH;
-    for (uint32_t n = 32; n <= 48; n += 16) {
-      for (size_t k = 1; k <= 10; k += 3) {
+    for (uint32_t n = 16; n <= 24; n += 8) {
+      for (size_t k = 1; k <= 20; k += 5) {
         GemmMicrokernelTester()
           .mr(1)
-          .nr(16)
+          .nr(8)
           .kr(1)
           .sr(1)
           .m(1)
           .n(n)
           .k(k)
-          .cn_stride(19)
-          .Test(xnn_f16_gemm_minmax_ukernel_1x16__aarch64_neonfp16arith_ld32, xnn_init_f16_scaleminmax_neon_params);
+          .cn_stride(11)
+          .Test(xnn_f16_gemm_minmax_ukernel_1x8__aarch64_neonfp16arith_ld64, xnn_init_f16_scaleminmax_neon_params);
       }
     }
   }
 
-  TEST(F16_GEMM_MINMAX_1X16__AARCH64_NEONFP16ARITH_LD32, n_div_16_strided_a) {
+  TEST(F16_GEMM_MINMAX_1X8__AARCH64_NEONFP16ARITH_LD64, n_div_8_strided_a) {
     TEST_REQUIRES_ARM_NEON_FP16_ARITH;
-    for (uint32_t n = 32; n <= 48; n += 16) {
-      for (size_t k = 1; k <= 10; k += 3) {
+    for (uint32_t n = 16; n <= 24; n += 8) {
+      for (size_t k = 1; k <= 20; k += 5) {
         GemmMicrokernelTester()
           .mr(1)
-          .nr(16)
+          .nr(8)
           .kr(1)
           .sr(1)
           .m(1)
           .n(n)
           .k(k)
-          .a_stride(13)
-          .Test(xnn_f16_gemm_minmax_ukernel_1x16__aarch64_neonfp16arith_ld32, xnn_init_f16_scaleminmax_neon_params);
+          .a_stride(23)
+          .Test(xnn_f16_gemm_minmax_ukernel_1x8__aarch64_neonfp16arith_ld64, xnn_init_f16_scaleminmax_neon_params);
       }
     }
   }
 
-  TEST(F16_GEMM_MINMAX_1X16__AARCH64_NEONFP16ARITH_LD32, n_div_16_subtile) {
+  TEST(F16_GEMM_MINMAX_1X8__AARCH64_NEONFP16ARITH_LD64, n_div_8_subtile) {
     TEST_REQUIRES_ARM_NEON_FP16_ARITH;
-    for (uint32_t n = 32; n <= 48; n += 16) {
-      for (size_t k = 1; k <= 10; k += 3) {
+    for (uint32_t n = 16; n <= 24; n += 8) {
+      for (size_t k = 1; k <= 20; k += 5) {
         for (uint32_t m = 1; m <= 1; m++) {
           GemmMicrokernelTester()
             .mr(1)
-            .nr(16)
+            .nr(8)
             .kr(1)
             .sr(1)
             .m(m)
             .n(n)
             .k(k)
             .iterations(1)
-            .Test(xnn_f16_gemm_minmax_ukernel_1x16__aarch64_neonfp16arith_ld32, xnn_init_f16_scaleminmax_neon_params);
+            .Test(xnn_f16_gemm_minmax_ukernel_1x8__aarch64_neonfp16arith_ld64, xnn_init_f16_scaleminmax_neon_params);
         }
       }
     }
   }
 
-  TEST(F16_GEMM_MINMAX_1X16__AARCH64_NEONFP16ARITH_LD32, strided_cm_subtile) {
+  TEST(F16_GEMM_MINMAX_1X8__AARCH64_NEONFP16ARITH_LD64, strided_cm_subtile) {
     TEST_REQUIRES_ARM_NEON_FP16_ARITH;
-    for (size_t k = 1; k <= 10; k += 3) {
-      for (uint32_t n = 1; n <= 16; n++) {
+    for (size_t k = 1; k <= 20; k += 5) {
+      for (uint32_t n = 1; n <= 8; n++) {
         for (uint32_t m = 1; m <= 1; m++) {
           GemmMicrokernelTester()
             .mr(1)
-            .nr(16)
+            .nr(8)
             .kr(1)
             .sr(1)
             .m(m)
             .n(n)
             .k(k)
-            .cm_stride(19)
+            .cm_stride(11)
             .iterations(1)
-            .Test(xnn_f16_gemm_minmax_ukernel_1x16__aarch64_neonfp16arith_ld32, xnn_init_f16_scaleminmax_neon_params);
+            .Test(xnn_f16_gemm_minmax_ukernel_1x8__aarch64_neonfp16arith_ld64, xnn_init_f16_scaleminmax_neon_params);
         }
       }
     }
   }
 
-  TEST(F16_GEMM_MINMAX_1X16__AARCH64_NEONFP16ARITH_LD32, qmin) {
+  TEST(F16_GEMM_MINMAX_1X8__AARCH64_NEONFP16ARITH_LD64, qmin) {
     TEST_REQUIRES_ARM_NEON_FP16_ARITH;
     GemmMicrokernelTester()
       .mr(1)
-      .nr(16)
+      .nr(8)
       .kr(1)
       .sr(1)
       .m(1)
-      .n(16)
-      .k(2)
+      .n(8)
+      .k(4)
       .qmin(128)
-      .Test(xnn_f16_gemm_minmax_ukernel_1x16__aarch64_neonfp16arith_ld32, xnn_init_f16_scaleminmax_neon_params);
+      .Test(xnn_f16_gemm_minmax_ukernel_1x8__aarch64_neonfp16arith_ld64, xnn_init_f16_scaleminmax_neon_params);
   }
 
-  TEST(F16_GEMM_MINMAX_1X16__AARCH64_NEONFP16ARITH_LD32, qmax) {
+  TEST(F16_GEMM_MINMAX_1X8__AARCH64_NEONFP16ARITH_LD64, qmax) {
     TEST_REQUIRES_ARM_NEON_FP16_ARITH;
     GemmMicrokernelTester()
       .mr(1)
-      .nr(16)
+      .nr(8)
       .kr(1)
       .sr(1)
       .m(1)
-      .n(16)
-      .k(2)
+      .n(8)
+      .k(4)
       .qmax(128)
-      .Test(xnn_f16_gemm_minmax_ukernel_1x16__aarch64_neonfp16arith_ld32, xnn_init_f16_scaleminmax_neon_params);
+      .Test(xnn_f16_gemm_minmax_ukernel_1x8__aarch64_neonfp16arith_ld64, xnn_init_f16_scaleminmax_neon_params);
   }
 
-  TEST(F16_GEMM_MINMAX_1X16__AARCH64_NEONFP16ARITH_LD32, strided_cm) {
+  TEST(F16_GEMM_MINMAX_1X8__AARCH64_NEONFP16ARITH_LD64, strided_cm) {
     TEST_REQUIRES_ARM_NEON_FP16_ARITH;
     GemmMicrokernelTester()
       .mr(1)
-      .nr(16)
+      .nr(8)
       .kr(1)
       .sr(1)
       .m(1)
-      .n(16)
-      .k(2)
-      .cm_stride(19)
-      .Test(xnn_f16_gemm_minmax_ukernel_1x16__aarch64_neonfp16arith_ld32, xnn_init_f16_scaleminmax_neon_params);
+      .n(8)
+      .k(4)
+      .cm_stride(11)
+      .Test(xnn_f16_gemm_minmax_ukernel_1x8__aarch64_neonfp16arith_ld64, xnn_init_f16_scaleminmax_neon_params);
   }
 #endif  // XNN_ARCH_ARM64 && XNN_ENABLE_ASSEMBLY
 
 
 #if XNN_ARCH_ARM64 && XNN_ENABLE_ASSEMBLY
-  TEST(F16_GEMM_MINMAX_4X8__AARCH64_NEONFP16ARITH_LD64, k_eq_4) {
+  TEST(F16_GEMM_MINMAX_1X16__AARCH64_NEONFP16ARITH_LD32, k_eq_2) {
     TEST_REQUIRES_ARM_NEON_FP16_ARITH;
     GemmMicrokernelTester()
-      .mr(4)
-      .nr(8)
+      .mr(1)
+      .nr(16)
       .kr(1)
       .sr(1)
-      .m(4)
-      .n(8)
-      .k(4)
-      .Test(xnn_f16_gemm_minmax_ukernel_4x8__aarch64_neonfp16arith_ld64, xnn_init_f16_scaleminmax_neon_params);
+      .m(1)
+      .n(16)
+      .k(2)
+      .Test(xnn_f16_gemm_minmax_ukernel_1x16__aarch64_neonfp16arith_ld32, xnn_init_f16_scaleminmax_neon_params);
   }
 
-  TEST(F16_GEMM_MINMAX_4X8__AARCH64_NEONFP16ARITH_LD64, strided_cn) {
+  TEST(F16_GEMM_MINMAX_1X16__AARCH64_NEONFP16ARITH_LD32, strided_cn) {
     TEST_REQUIRES_ARM_NEON_FP16_ARITH;
     GemmMicrokernelTester()
-      .mr(4)
-      .nr(8)
+      .mr(1)
+      .nr(16)
       .kr(1)
       .sr(1)
-      .m(4)
-      .n(8)
-      .k(4)
-      .cn_stride(11)
-      .Test(xnn_f16_gemm_minmax_ukernel_4x8__aarch64_neonfp16arith_ld64, xnn_init_f16_scaleminmax_neon_params);
+      .m(1)
+      .n(16)
+      .k(2)
+      .cn_stride(19)
+      .Test(xnn_f16_gemm_minmax_ukernel_1x16__aarch64_neonfp16arith_ld32, xnn_init_f16_scaleminmax_neon_params);
   }
 
-  TEST(F16_GEMM_MINMAX_4X8__AARCH64_NEONFP16ARITH_LD64, k_eq_4_strided_a) {
+  TEST(F16_GEMM_MINMAX_1X16__AARCH64_NEONFP16ARITH_LD32, k_eq_2_strided_a) {
     TEST_REQUIRES_ARM_NEON_FP16_ARITH;
     GemmMicrokernelTester()
-      .mr(4)
-      .nr(8)
+      .mr(1)
+      .nr(16)
       .kr(1)
       .sr(1)
-      .m(4)
-      .n(8)
-      .k(4)
-      .a_stride(7)
-      .Test(xnn_f16_gemm_minmax_ukernel_4x8__aarch64_neonfp16arith_ld64, xnn_init_f16_scaleminmax_neon_params);
+      .m(1)
+      .n(16)
+      .k(2)
+      .a_stride(5)
+      .Test(xnn_f16_gemm_minmax_ukernel_1x16__aarch64_neonfp16arith_ld32, xnn_init_f16_scaleminmax_neon_params);
   }
 
-  TEST(F16_GEMM_MINMAX_4X8__AARCH64_NEONFP16ARITH_LD64, k_eq_4_subtile) {
+  TEST(F16_GEMM_MINMAX_1X16__AARCH64_NEONFP16ARITH_LD32, k_eq_2_subtile) {
     TEST_REQUIRES_ARM_NEON_FP16_ARITH;
-    for (uint32_t n = 1; n <= 8; n++) {
-      for (uint32_t m = 1; m <= 4; m++) {
+    for (uint32_t n = 1; n <= 16; n++) {
+      for (uint32_t m = 1; m <= 1; m++) {
         GemmMicrokernelTester()
-          .mr(4)
-          .nr(8)
+          .mr(1)
+          .nr(16)
           .kr(1)
           .sr(1)
           .m(m)
           .n(n)
-          .k(4)
+          .k(2)
           .iterations(1)
-          .Test(xnn_f16_gemm_minmax_ukernel_4x8__aarch64_neonfp16arith_ld64, xnn_init_f16_scaleminmax_neon_params);
+          .Test(xnn_f16_gemm_minmax_ukernel_1x16__aarch64_neonfp16arith_ld32, xnn_init_f16_scaleminmax_neon_params);
       }
     }
   }
 
-  TEST(F16_GEMM_MINMAX_4X8__AARCH64_NEONFP16ARITH_LD64, k_eq_4_subtile_m) {
+  TEST(F16_GEMM_MINMAX_1X16__AARCH64_NEONFP16ARITH_LD32, k_eq_2_subtile_m) {
     TEST_REQUIRES_ARM_NEON_FP16_ARITH;
-    for (uint32_t m = 1; m <= 4; m++) {
+    for (uint32_t m = 1; m <= 1; m++) {
       GemmMicrokernelTester()
-        .mr(4)
-        .nr(8)
+        .mr(1)
+        .nr(16)
         .kr(1)
         .sr(1)
         .m(m)
-        .n(8)
-        .k(4)
+        .n(16)
+        .k(2)
         .iterations(1)
-        .Test(xnn_f16_gemm_minmax_ukernel_4x8__aarch64_neonfp16arith_ld64, xnn_init_f16_scaleminmax_neon_params);
+        .Test(xnn_f16_gemm_minmax_ukernel_1x16__aarch64_neonfp16arith_ld32, xnn_init_f16_scaleminmax_neon_params);
     }
   }
 
-  TEST(F16_GEMM_MINMAX_4X8__AARCH64_NEONFP16ARITH_LD64, k_eq_4_subtile_n) {
+  TEST(F16_GEMM_MINMAX_1X16__AARCH64_NEONFP16ARITH_LD32, k_eq_2_subtile_n) {
     TEST_REQUIRES_ARM_NEON_FP16_ARITH;
-    for (uint32_t n = 1; n <= 8; n++) {
+    for (uint32_t n = 1; n <= 16; n++) {
       GemmMicrokernelTester()
-        .mr(4)
-        .nr(8)
+        .mr(1)
+        .nr(16)
         .kr(1)
         .sr(1)
-        .m(4)
+        .m(1)
         .n(n)
-        .k(4)
+        .k(2)
         .iterations(1)
-        .Test(xnn_f16_gemm_minmax_ukernel_4x8__aarch64_neonfp16arith_ld64, xnn_init_f16_scaleminmax_neon_params);
+        .Test(xnn_f16_gemm_minmax_ukernel_1x16__aarch64_neonfp16arith_ld32, xnn_init_f16_scaleminmax_neon_params);
     }
   }
 
-  TEST(F16_GEMM_MINMAX_4X8__AARCH64_NEONFP16ARITH_LD64, k_lt_4) {
+  TEST(F16_GEMM_MINMAX_1X16__AARCH64_NEONFP16ARITH_LD32, k_lt_2) {
     TEST_REQUIRES_ARM_NEON_FP16_ARITH;
-    for (size_t k = 1; k < 4; k++) {
+    for (size_t k = 1; k < 2; k++) {
       GemmMicrokernelTester()
-        .mr(4)
-        .nr(8)
+        .mr(1)
+        .nr(16)
         .kr(1)
         .sr(1)
-        .m(4)
-        .n(8)
+        .m(1)
+        .n(16)
         .k(k)
-        .Test(xnn_f16_gemm_minmax_ukernel_4x8__aarch64_neonfp16arith_ld64, xnn_init_f16_scaleminmax_neon_params);
+        .Test(xnn_f16_gemm_minmax_ukernel_1x16__aarch64_neonfp16arith_ld32, xnn_init_f16_scaleminmax_neon_params);
     }
   }
 
-  TEST(F16_GEMM_MINMAX_4X8__AARCH64_NEONFP16ARITH_LD64, k_lt_4_strided_a) {
+  TEST(F16_GEMM_MINMAX_1X16__AARCH64_NEONFP16ARITH_LD32, k_lt_2_strided_a) {
     TEST_REQUIRES_ARM_NEON_FP16_ARITH;
-    for (size_t k = 1; k < 4; k++) {
+    for (size_t k = 1; k < 2; k++) {
       GemmMicrokernelTester()
-        .mr(4)
-        .nr(8)
+        .mr(1)
+        .nr(16)
         .kr(1)
         .sr(1)
-        .m(4)
-        .n(8)
+        .m(1)
+        .n(16)
         .k(k)
-        .a_stride(7)
-        .Test(xnn_f16_gemm_minmax_ukernel_4x8__aarch64_neonfp16arith_ld64, xnn_init_f16_scaleminmax_neon_params);
+        .a_stride(5)
+        .Test(xnn_f16_gemm_minmax_ukernel_1x16__aarch64_neonfp16arith_ld32, xnn_init_f16_scaleminmax_neon_params);
     }
   }
 
-  TEST(F16_GEMM_MINMAX_4X8__AARCH64_NEONFP16ARITH_LD64, k_lt_4_subtile) {
+  TEST(F16_GEMM_MINMAX_1X16__AARCH64_NEONFP16ARITH_LD32, k_lt_2_subtile) {
     TEST_REQUIRES_ARM_NEON_FP16_ARITH;
-    for (size_t k = 1; k < 4; k++) {
-      for (uint32_t n = 1; n <= 8; n++) {
-        for (uint32_t m = 1; m <= 4; m++) {
+    for (size_t k = 1; k < 2; k++) {
+      for (uint32_t n = 1; n <= 16; n++) {
+        for (uint32_t m = 1; m <= 1; m++) {
           GemmMicrokernelTester()
-            .mr(4)
-            .nr(8)
+            .mr(1)
+            .nr(16)
             .kr(1)
             .sr(1)
             .m(m)
             .n(n)
             .k(k)
             .iterations(1)
-            .Test(xnn_f16_gemm_minmax_ukernel_4x8__aarch64_neonfp16arith_ld64, xnn_init_f16_scaleminmax_neon_params);
+            .Test(xnn_f16_gemm_minmax_ukernel_1x16__aarch64_neonfp16arith_ld32, xnn_init_f16_scaleminmax_neon_params);
         }
       }
     }
   }
 
-  TEST(F16_GEMM_MINMAX_4X8__AARCH64_NEONFP16ARITH_LD64, k_gt_4) {
+  TEST(F16_GEMM_MINMAX_1X16__AARCH64_NEONFP16ARITH_LD32, k_gt_2) {
     TEST_REQUIRES_ARM_NEON_FP16_ARITH;
-    for (size_t k = 5; k < 8; k++) {
+    for (size_t k = 3; k < 4; k++) {
       GemmMicrokernelTester()
-        .mr(4)
-        .nr(8)
+        .mr(1)
+        .nr(16)
         .kr(1)
         .sr(1)
-        .m(4)
-        .n(8)
+        .m(1)
+        .n(16)
         .k(k)
-        .Test(xnn_f16_gemm_minmax_ukernel_4x8__aarch64_neonfp16arith_ld64, xnn_init_f16_scaleminmax_neon_params);
+        .Test(xnn_f16_gemm_minmax_ukernel_1x16__aarch64_neonfp16arith_ld32, xnn_init_f16_scaleminmax_neon_params);
     }
   }
 
-  TEST(F16_GEMM_MINMAX_4X8__AARCH64_NEONFP16ARITH_LD64, k_gt_4_strided_a) {
+  TEST(F16_GEMM_MINMAX_1X16__AARCH64_NEONFP16ARITH_LD32, k_gt_2_strided_a) {
     TEST_REQUIRES_ARM_NEON_FP16_ARITH;
-    for (size_t k = 5; k < 8; k++) {
+    for (size_t k = 3; k < 4; k++) {
       GemmMicrokernelTester()
-        .mr(4)
-        .nr(8)
+        .mr(1)
+        .nr(16)
         .kr(1)
         .sr(1)
-        .m(4)
-        .n(8)
+        .m(1)
+        .n(16)
         .k(k)
-        .a_stride(11)
-        .Test(xnn_f16_gemm_minmax_ukernel_4x8__aarch64_neonfp16arith_ld64, xnn_init_f16_scaleminmax_neon_params);
+        .a_stride(7)
+        .Test(xnn_f16_gemm_minmax_ukernel_1x16__aarch64_neonfp16arith_ld32, xnn_init_f16_scaleminmax_neon_params);
     }
   }
 
-  TEST(F16_GEMM_MINMAX_4X8__AARCH64_NEONFP16ARITH_LD64, k_gt_4_subtile) {
+  TEST(F16_GEMM_MINMAX_1X16__AARCH64_NEONFP16ARITH_LD32, k_gt_2_subtile) {
     TEST_REQUIRES_ARM_NEON_FP16_ARITH;
-    for (size_t k = 5; k < 8; k++) {
-      for (uint32_t n = 1; n <= 8; n++) {
-        for (uint32_t m = 1; m <= 4; m++) {
+    for (size_t k = 3; k < 4; k++) {
+      for (uint32_t n = 1; n <= 16; n++) {
+        for (uint32_t m = 1; m <= 1; m++) {
           GemmMicrokernelTester()
-            .mr(4)
-            .nr(8)
+            .mr(1)
+            .nr(16)
             .kr(1)
             .sr(1)
             .m(m)
             .n(n)
             .k(k)
             .iterations(1)
-            .Test(xnn_f16_gemm_minmax_ukernel_4x8__aarch64_neonfp16arith_ld64, xnn_init_f16_scaleminmax_neon_params);
+            .Test(xnn_f16_gemm_minmax_ukernel_1x16__aarch64_neonfp16arith_ld32, xnn_init_f16_scaleminmax_neon_params);
         }
       }
     }
   }
 
-  TEST(F16_GEMM_MINMAX_4X8__AARCH64_NEONFP16ARITH_LD64, k_div_4) {
+  TEST(F16_GEMM_MINMAX_1X16__AARCH64_NEONFP16ARITH_LD32, k_div_2) {
     TEST_REQUIRES_ARM_NEON_FP16_ARITH;
-    for (size_t k = 8; k <= 40; k += 4) {
+    for (size_t k = 4; k <= 20; k += 2) {
       GemmMicrokernelTester()
-        .mr(4)
-        .nr(8)
+        .mr(1)
+        .nr(16)
         .kr(1)
         .sr(1)
-        .m(4)
-        .n(8)
+        .m(1)
+        .n(16)
         .k(k)
-        .Test(xnn_f16_gemm_minmax_ukernel_4x8__aarch64_neonfp16arith_ld64, xnn_init_f16_scaleminmax_neon_params);
+        .Test(xnn_f16_gemm_minmax_ukernel_1x16__aarch64_neonfp16arith_ld32, xnn_init_f16_scaleminmax_neon_params);
     }
   }
 
-  TEST(F16_GEMM_MINMAX_4X8__AARCH64_NEONFP16ARITH_LD64, k_div_4_strided_a) {
+  TEST(F16_GEMM_MINMAX_1X16__AARCH64_NEONFP16ARITH_LD32, k_div_2_strided_a) {
     TEST_REQUIRES_ARM_NEON_FP16_ARITH;
-    for (size_t k = 8; k <= 40; k += 4) {
+    for (size_t k = 4; k <= 20; k += 2) {
       GemmMicrokernelTester()
-        .mr(4)
-        .nr(8)
+        .mr(1)
+        .nr(16)
         .kr(1)
         .sr(1)
-        .m(4)
-        .n(8)
+        .m(1)
+        .n(16)
         .k(k)
-        .a_stride(43)
-        .Test(xnn_f16_gemm_minmax_ukernel_4x8__aarch64_neonfp16arith_ld64, xnn_init_f16_scaleminmax_neon_params);
+        .a_stride(23)
+        .Test(xnn_f16_gemm_minmax_ukernel_1x16__aarch64_neonfp16arith_ld32, xnn_init_f16_scaleminmax_neon_params);
     }
   }
 
-  TEST(F16_GEMM_MINMAX_4X8__AARCH64_NEONFP16ARITH_LD64, k_div_4_subtile) {
+  TEST(F16_GEMM_MINMAX_1X16__AARCH64_NEONFP16ARITH_LD32, k_div_2_subtile) {
     TEST_REQUIRES_ARM_NEON_FP16_ARITH;
-    for (size_t k = 8; k <= 40; k += 4) {
-      for (uint32_t n = 1; n <= 8; n++) {
-        for (uint32_t m = 1; m <= 4; m++) {
+    for (size_t k = 4; k <= 20; k += 2) {
+      for (uint32_t n = 1; n <= 16; n++) {
+        for (uint32_t m = 1; m <= 1; m++) {
           GemmMicrokernelTester()
-            .mr(4)
-            .nr(8)
+            .mr(1)
+            .nr(16)
             .kr(1)
             .sr(1)
             .m(m)
             .n(n)
             .k(k)
             .iterations(1)
-            .Test(xnn_f16_gemm_minmax_ukernel_4x8__aarch64_neonfp16arith_ld64, xnn_init_f16_scaleminmax_neon_params);
+            .Test(xnn_f16_gemm_minmax_ukernel_1x16__aarch64_neonfp16arith_ld32, xnn_init_f16_scaleminmax_neon_params);
         }
       }
     }
   }
 
-  TEST(F16_GEMM_MINMAX_4X8__AARCH64_NEONFP16ARITH_LD64, n_gt_8) {
+  TEST(F16_GEMM_MINMAX_1X16__AARCH64_NEONFP16ARITH_LD32, n_gt_16) {
     TEST_REQUIRES_ARM_NEON_FP16_ARITH;
-    for (uint32_t n = 9; n < 16; n++) {
-      for (size_t k = 1; k <= 20; k += 5) {
+    for (uint32_t n = 17; n < 32; n++) {
+      for (size_t k = 1; k <= 10; k += 3) {
         GemmMicrokernelTester()
-          .mr(4)
-          .nr(8)
+          .mr(1)
+          .nr(16)
           .kr(1)
           .sr(1)
-          .m(4)
+          .m(1)
           .n(n)
           .k(k)
-          .Test(xnn_f16_gemm_minmax_ukernel_4x8__aarch64_neonfp16arith_ld64, xnn_init_f16_scaleminmax_neon_params);
+          .Test(xnn_f16_gemm_minmax_ukernel_1x16__aarch64_neonfp16arith_ld32, xnn_init_f16_scaleminmax_neon_params);
       }
     }
   }
 
-  TEST(F16_GEMM_MINMAX_4X8__AARCH64_NEONFP16ARITH_LD64, n_gt_8_strided_cn) {
+  TEST(F16_GEMM_MINMAX_1X16__AARCH64_NEONFP16ARITH_LD32, n_gt_16_strided_cn) {
     TEST_REQUIRES_ARM_NEON_FP16_ARITH;
-    for (uint32_t n = 9; n < 16; n++) {
-      for (size_t k = 1; k <= 20; k += 5) {
+    for (uint32_t n = 17; n < 32; n++) {
+      for (size_t k = 1; k <= 10; k += 3) {
         GemmMicrokernelTester()
-          .mr(4)
-          .nr(8)
+          .mr(1)
+          .nr(16)
           .kr(1)
           .sr(1)
-          .m(4)
+          .m(1)
           .n(n)
           .k(k)
-          .cn_stride(11)
-          .Test(xnn_f16_gemm_minmax_ukernel_4x8__aarch64_neonfp16arith_ld64, xnn_init_f16_scaleminmax_neon_params);
+          .cn_stride(19)
+          .Test(xnn_f16_gemm_minmax_ukernel_1x16__aarch64_neonfp16arith_ld32, xnn_init_f16_scaleminmax_neon_params);
       }
     }
   }
 
-  TEST(F16_GEMM_MINMAX_4X8__AARCH64_NEONFP16ARITH_LD64, n_gt_8_strided_a) {
+  TEST(F16_GEMM_MINMAX_1X16__AARCH64_NEONFP16ARITH_LD32, n_gt_16_strided_a) {
     TEST_REQUIRES_ARM_NEON_FP16_ARITH;
-    for (uint32_t n = 9; n < 16; n++) {
-      for (size_t k = 1; k <= 20; k += 5) {
+    for (uint32_t n = 17; n < 32; n++) {
+      for (size_t k = 1; k <= 10; k += 3) {
         GemmMicrokernelTester()
-          .mr(4)
-          .nr(8)
+          .mr(1)
+          .nr(16)
           .kr(1)
           .sr(1)
-          .m(4)
+          .m(1)
           .n(n)
           .k(k)
-          .a_stride(23)
-          .Test(xnn_f16_gemm_minmax_ukernel_4x8__aarch64_neonfp16arith_ld64, xnn_init_f16_scaleminmax_neon_params);
+          .a_stride(13)
+          .Test(xnn_f16_gemm_minmax_ukernel_1x16__aarch64_neonfp16arith_ld32, xnn_init_f16_scaleminmax_neon_params);
       }
     }
   }
 
-  TEST(F16_GEMM_MINMAX_4X8__AARCH64_NEONFP16ARITH_LD64, n_gt_8_subtile) {
+  TEST(F16_GEMM_MINMAX_1X16__AARCH64_NEONFP16ARITH_LD32, n_gt_16_subtile) {
     TEST_REQUIRES_ARM_NEON_FP16_ARITH;
-    for (uint32_t n = 9; n < 16; n++) {
-      for (size_t k = 1; k <= 20; k += 5) {
-        for (uint32_t m = 1; m <= 4; m++) {
+    for (uint32_t n = 17; n < 32; n++) {
+      for (size_t k = 1; k <= 10; k += 3) {
+        for (uint32_t m = 1; m <= 1; m++) {
           GemmMicrokernelTester()
-            .mr(4)
-            .nr(8)
+            .mr(1)
+            .nr(16)
             .kr(1)
             .sr(1)
             .m(m)
             .n(n)
             .k(k)
             .iterations(1)
-            .Test(xnn_f16_gemm_minmax_ukernel_4x8__aarch64_neonfp16arith_ld64, xnn_init_f16_scaleminmax_neon_params);
+            .Test(xnn_f16_gemm_minmax_ukernel_1x16__aarch64_neonfp16arith_ld32, xnn_init_f16_scaleminmax_neon_params);
         }
       }
     }
   }
 
-  TEST(F16_GEMM_MINMAX_4X8__AARCH64_NEONFP16ARITH_LD64, n_div_8) {
+  TEST(F16_GEMM_MINMAX_1X16__AARCH64_NEONFP16ARITH_LD32, n_div_16) {
     TEST_REQUIRES_ARM_NEON_FP16_ARITH;
-    for (uint32_t n = 16; n <= 24; n += 8) {
-      for (size_t k = 1; k <= 20; k += 5) {
+    for (uint32_t n = 32; n <= 48; n += 16) {
+      for (size_t k = 1; k <= 10; k += 3) {
         GemmMicrokernelTester()
-          .mr(4)
-          .nr(8)
+          .mr(1)
+          .nr(16)
           .kr(1)
           .sr(1)
-          .m(4)
+          .m(1)
           .n(n)
           .k(k)
-          .Test(xnn_f16_gemm_minmax_ukernel_4x8__aarch64_neonfp16arith_ld64, xnn_init_f16_scaleminmax_neon_params);
+          .Test(xnn_f16_gemm_minmax_ukernel_1x16__aarch64_neonfp16arith_ld32, xnn_init_f16_scaleminmax_neon_params);
       }
     }
   }
 
-  TEST(F16_GEMM_MINMAX_4X8__AARCH64_NEONFP16ARITH_LD64, n_div_8_strided_cn) {
+  TEST(F16_GEMM_MINMAX_1X16__AARCH64_NEONFP16ARITH_LD32, n_div_16_strided_cn) {
     TEST_REQUIRES_ARM_NEON_FP16_ARITH;
-    for (uint32_t n = 16; n <= 24; n += 8) {
-      for (size_t k = 1; k <= 20; k += 5) {
+    for (uint32_t n = 32; n <= 48; n += 16) {
+      for (size_t k = 1; k <= 10; k += 3) {
         GemmMicrokernelTester()
-          .mr(4)
-          .nr(8)
+          .mr(1)
+          .nr(16)
           .kr(1)
           .sr(1)
-          .m(4)
+          .m(1)
           .n(n)
           .k(k)
-          .cn_stride(11)
-          .Test(xnn_f16_gemm_minmax_ukernel_4x8__aarch64_neonfp16arith_ld64, xnn_init_f16_scaleminmax_neon_params);
+          .cn_stride(19)
+          .Test(xnn_f16_gemm_minmax_ukernel_1x16__aarch64_neonfp16arith_ld32, xnn_init_f16_scaleminmax_neon_params);
       }
     }
   }
 
-  TEST(F16_GEMM_MINMAX_4X8__AARCH64_NEONFP16ARITH_LD64, n_div_8_strided_a) {
+  TEST(F16_GEMM_MINMAX_1X16__AARCH64_NEONFP16ARITH_LD32, n_div_16_strided_a) {
     TEST_REQUIRES_ARM_NEON_FP16_ARITH;
-    for (uint32_t n = 16; n <= 24; n += 8) {
-      for (size_t k = 1; k <= 20; k += 5) {
+    for (uint32_t n = 32; n <= 48; n += 16) {
+      for (size_t k = 1; k <= 10; k += 3) {
         GemmMicrokernelTester()
-          .mr(4)
-          .nr(8)
+          .mr(1)
+          .nr(16)
           .kr(1)
           .sr(1)
-          .m(4)
+          .m(1)
           .n(n)
           .k(k)
-          .a_stride(23)
-          .Test(xnn_f16_gemm_minmax_ukernel_4x8__aarch64_neonfp16arith_ld64, xnn_init_f16_scaleminmax_neon_params);
+          .a_stride(13)
+          .Test(xnn_f16_gemm_minmax_ukernel_1x16__aarch64_neonfp16arith_ld32, xnn_init_f16_scaleminmax_neon_params);
       }
     }
   }
 
-  TEST(F16_GEMM_MINMAX_4X8__AARCH64_NEONFP16ARITH_LD64, n_div_8_subtile) {
+  TEST(F16_GEMM_MINMAX_1X16__AARCH64_NEONFP16ARITH_LD32, n_div_16_subtile) {
     TEST_REQUIRES_ARM_NEON_FP16_ARITH;
-    for (uint32_t n = 16; n <= 24; n += 8) {
-      for (size_t k = 1; k <= 20; k += 5) {
-        for (uint32_t m = 1; m <= 4; m++) {
+    for (uint32_t n = 32; n <= 48; n += 16) {
+      for (size_t k = 1; k <= 10; k += 3) {
+        for (uint32_t m = 1; m <= 1; m++) {
           GemmMicrokernelTester()
-            .mr(4)
-            .nr(8)
+            .mr(1)
+            .nr(16)
             .kr(1)
             .sr(1)
             .m(m)
             .n(n)
             .k(k)
             .iterations(1)
-            .Test(xnn_f16_gemm_minmax_ukernel_4x8__aarch64_neonfp16arith_ld64, xnn_init_f16_scaleminmax_neon_params);
+            .Test(xnn_f16_gemm_minmax_ukernel_1x16__aarch64_neonfp16arith_ld32, xnn_init_f16_scaleminmax_neon_params);
         }
       }
     }
   }
 
-  TEST(F16_GEMM_MINMAX_4X8__AARCH64_NEONFP16ARITH_LD64, strided_cm_subtile) {
+  TEST(F16_GEMM_MINMAX_1X16__AARCH64_NEONFP16ARITH_LD32, strided_cm_subtile) {
     TEST_REQUIRES_ARM_NEON_FP16_ARITH;
-    for (size_t k = 1; k <= 20; k += 5) {
-      for (uint32_t n = 1; n <= 8; n++) {
-        for (uint32_t m = 1; m <= 4; m++) {
+    for (size_t k = 1; k <= 10; k += 3) {
+      for (uint32_t n = 1; n <= 16; n++) {
+        for (uint32_t m = 1; m <= 1; m++) {
           GemmMicrokernelTester()
-            .mr(4)
-            .nr(8)
+            .mr(1)
+            .nr(16)
             .kr(1)
             .sr(1)
             .m(m)
             .n(n)
             .k(k)
-            .cm_stride(11)
+            .cm_stride(19)
             .iterations(1)
-            .Test(xnn_f16_gemm_minmax_ukernel_4x8__aarch64_neonfp16arith_ld64, xnn_init_f16_scaleminmax_neon_params);
+            .Test(xnn_f16_gemm_minmax_ukernel_1x16__aarch64_neonfp16arith_ld32, xnn_init_f16_scaleminmax_neon_params);
         }
       }
     }
   }
 
-  TEST(F16_GEMM_MINMAX_4X8__AARCH64_NEONFP16ARITH_LD64, qmin) {
+  TEST(F16_GEMM_MINMAX_1X16__AARCH64_NEONFP16ARITH_LD32, qmin) {
     TEST_REQUIRES_ARM_NEON_FP16_ARITH;
     GemmMicrokernelTester()
-      .mr(4)
-      .nr(8)
+      .mr(1)
+      .nr(16)
       .kr(1)
       .sr(1)
-      .m(4)
-      .n(8)
-      .k(4)
+      .m(1)
+      .n(16)
+      .k(2)
       .qmin(128)
-      .Test(xnn_f16_gemm_minmax_ukernel_4x8__aarch64_neonfp16arith_ld64, xnn_init_f16_scaleminmax_neon_params);
+      .Test(xnn_f16_gemm_minmax_ukernel_1x16__aarch64_neonfp16arith_ld32, xnn_init_f16_scaleminmax_neon_params);
   }
 
-  TEST(F16_GEMM_MINMAX_4X8__AARCH64_NEONFP16ARITH_LD64, qmax) {
+  TEST(F16_GEMM_MINMAX_1X16__AARCH64_NEONFP16ARITH_LD32, qmax) {
     TEST_REQUIRES_ARM_NEON_FP16_ARITH;
     GemmMicrokernelTester()
-      .mr(4)
-      .nr(8)
+      .mr(1)
+      .nr(16)
       .kr(1)
       .sr(1)
-      .m(4)
-      .n(8)
-      .k(4)
+      .m(1)
+      .n(16)
+      .k(2)
       .qmax(128)
-      .Test(xnn_f16_gemm_minmax_ukernel_4x8__aarch64_neonfp16arith_ld64, xnn_init_f16_scaleminmax_neon_params);
+      .Test(xnn_f16_gemm_minmax_ukernel_1x16__aarch64_neonfp16arith_ld32, xnn_init_f16_scaleminmax_neon_params);
   }
 
-  TEST(F16_GEMM_MINMAX_4X8__AARCH64_NEONFP16ARITH_LD64, strided_cm) {
+  TEST(F16_GEMM_MINMAX_1X16__AARCH64_NEONFP16ARITH_LD32, strided_cm) {
     TEST_REQUIRES_ARM_NEON_FP16_ARITH;
     GemmMicrokernelTester()
-      .mr(4)
-      .nr(8)
+      .mr(1)
+      .nr(16)
       .kr(1)
       .sr(1)
-      .m(4)
-      .n(8)
-      .k(4)
-      .cm_stride(11)
-      .Test(xnn_f16_gemm_minmax_ukernel_4x8__aarch64_neonfp16arith_ld64, xnn_init_f16_scaleminmax_neon_params);
+      .m(1)
+      .n(16)
+      .k(2)
+      .cm_stride(19)
+      .Test(xnn_f16_gemm_minmax_ukernel_1x16__aarch64_neonfp16arith_ld32, xnn_init_f16_scaleminmax_neon_params);
   }
 #endif  // XNN_ARCH_ARM64 && XNN_ENABLE_ASSEMBLY
 
 
 #if XNN_ARCH_ARM64 && XNN_ENABLE_ASSEMBLY
-  TEST(F16_GEMM_MINMAX_4X16__AARCH64_NEONFP16ARITH_LD32, k_eq_2) {
+  TEST(F16_GEMM_MINMAX_4X8__AARCH64_NEONFP16ARITH_LD64, k_eq_4) {
     TEST_REQUIRES_ARM_NEON_FP16_ARITH;
     GemmMicrokernelTester()
       .mr(4)
-      .nr(16)
+      .nr(8)
       .kr(1)
       .sr(1)
       .m(4)
-      .n(16)
-      .k(2)
-      .Test(xnn_f16_gemm_minmax_ukernel_4x16__aarch64_neonfp16arith_ld32, xnn_init_f16_scaleminmax_neon_params);
+      .n(8)
+      .k(4)
+      .Test(xnn_f16_gemm_minmax_ukernel_4x8__aarch64_neonfp16arith_ld64, xnn_init_f16_scaleminmax_neon_params);
   }
 
-  TEST(F16_GEMM_MINMAX_4X16__AARCH64_NEONFP16ARITH_LD32, strided_cn) {
+  TEST(F16_GEMM_MINMAX_4X8__AARCH64_NEONFP16ARITH_LD64, strided_cn) {
     TEST_REQUIRES_ARM_NEON_FP16_ARITH;
     GemmMicrokernelTester()
       .mr(4)
-      .nr(16)
+      .nr(8)
       .kr(1)
       .sr(1)
       .m(4)
-      .n(16)
-      .k(2)
-      .cn_stride(19)
-      .Test(xnn_f16_gemm_minmax_ukernel_4x16__aarch64_neonfp16arith_ld32, xnn_init_f16_scaleminmax_neon_params);
+      .n(8)
+      .k(4)
+      .cn_stride(11)
+      .Test(xnn_f16_gemm_minmax_ukernel_4x8__aarch64_neonfp16arith_ld64, xnn_init_f16_scaleminmax_neon_params);
   }
 
-  TEST(F16_GEMM_MINMAX_4X16__AARCH64_NEONFP16ARITH_LD32, k_eq_2_strided_a) {
+  TEST(F16_GEMM_MINMAX_4X8__AARCH64_NEONFP16ARITH_LD64, k_eq_4_strided_a) {
     TEST_REQUIRES_ARM_NEON_FP16_ARITH;
     GemmMicrokernelTester()
       .mr(4)
-      .nr(16)
+      .nr(8)
       .kr(1)
       .sr(1)
       .m(4)
-      .n(16)
-      .k(2)
-      .a_stride(5)
-      .Test(xnn_f16_gemm_minmax_ukernel_4x16__aarch64_neonfp16arith_ld32, xnn_init_f16_scaleminmax_neon_params);
+      .n(8)
+      .k(4)
+      .a_stride(7)
+      .Test(xnn_f16_gemm_minmax_ukernel_4x8__aarch64_neonfp16arith_ld64, xnn_init_f16_scaleminmax_neon_params);
   }
 
-  TEST(F16_GEMM_MINMAX_4X16__AARCH64_NEONFP16ARITH_LD32, k_eq_2_subtile) {
+  TEST(F16_GEMM_MINMAX_4X8__AARCH64_NEONFP16ARITH_LD64, k_eq_4_subtile) {
     TEST_REQUIRES_ARM_NEON_FP16_ARITH;
-    for (uint32_t n = 1; n <= 16; n++) {
+    for (uint32_t n = 1; n <= 8; n++) {
       for (uint32_t m = 1; m <= 4; m++) {
         GemmMicrokernelTester()
           .mr(4)
-          .nr(16)
+          .nr(8)
           .kr(1)
           .sr(1)
           .m(m)
           .n(n)
-          .k(2)
+          .k(4)
           .iterations(1)
-          .Test(xnn_f16_gemm_minmax_ukernel_4x16__aarch64_neonfp16arith_ld32, xnn_init_f16_scaleminmax_neon_params);
+          .Test(xnn_f16_gemm_minmax_ukernel_4x8__aarch64_neonfp16arith_ld64, xnn_init_f16_scaleminmax_neon_params);
       }
     }
   }
 
-  TEST(F16_GEMM_MINMAX_4X16__AARCH64_NEONFP16ARITH_LD32, k_eq_2_subtile_m) {
+  TEST(F16_GEMM_MINMAX_4X8__AARCH64_NEONFP16ARITH_LD64, k_eq_4_subtile_m) {
     TEST_REQUIRES_ARM_NEON_FP16_ARITH;
     for (uint32_t m = 1; m <= 4; m++) {
       GemmMicrokernelTester()
         .mr(4)
-        .nr(16)
+        .nr(8)
         .kr(1)
         .sr(1)
         .m(m)
-        .n(16)
-        .k(2)
+        .n(8)
+        .k(4)
         .iterations(1)
-        .Test(xnn_f16_gemm_minmax_ukernel_4x16__aarch64_neonfp16arith_ld32, xnn_init_f16_scaleminmax_neon_params);
+        .Test(xnn_f16_gemm_minmax_ukernel_4x8__aarch64_neonfp16arith_ld64, xnn_init_f16_scaleminmax_neon_params);
     }
   }
 
-  TEST(F16_GEMM_MINMAX_4X16__AARCH64_NEONFP16ARITH_LD32, k_eq_2_subtile_n) {
+  TEST(F16_GEMM_MINMAX_4X8__AARCH64_NEONFP16ARITH_LD64, k_eq_4_subtile_n) {
     TEST_REQUIRES_ARM_NEON_FP16_ARITH;
-    for (uint32_t n = 1; n <= 16; n++) {
+    for (uint32_t n = 1; n <= 8; n++) {
       GemmMicrokernelTester()
         .mr(4)
-        .nr(16)
+        .nr(8)
         .kr(1)
         .sr(1)
         .m(4)
         .n(n)
-        .k(2)
+        .k(4)
         .iterations(1)
-        .Test(xnn_f16_gemm_minmax_ukernel_4x16__aarch64_neonfp16arith_ld32, xnn_init_f16_scaleminmax_neon_params);
+        .Test(xnn_f16_gemm_minmax_ukernel_4x8__aarch64_neonfp16arith_ld64, xnn_init_f16_scaleminmax_neon_params);
     }
   }
 
-  TEST(F16_GEMM_MINMAX_4X16__AARCH64_NEONFP16ARITH_LD32, k_lt_2) {
+  TEST(F16_GEMM_MINMAX_4X8__AARCH64_NEONFP16ARITH_LD64, k_lt_4) {
     TEST_REQUIRES_ARM_NEON_FP16_ARITH;
-    for (size_t k = 1; k < 2; k++) {
+    for (size_t k = 1; k < 4; k++) {
       GemmMicrokernelTester()
         .mr(4)
-        .nr(16)
+        .nr(8)
         .kr(1)
         .sr(1)
         .m(4)
-        .n(16)
+        .n(8)
         .k(k)
-        .Test(xnn_f16_gemm_minmax_ukernel_4x16__aarch64_neonfp16arith_ld32, xnn_init_f16_scaleminmax_neon_params);
+        .Test(xnn_f16_gemm_minmax_ukernel_4x8__aarch64_neonfp16arith_ld64, xnn_init_f16_scaleminmax_neon_params);
     }
   }
 
-  TEST(F16_GEMM_MINMAX_4X16__AARCH64_NEONFP16ARITH_LD32, k_lt_2_strided_a) {
+  TEST(F16_GEMM_MINMAX_4X8__AARCH64_NEONFP16ARITH_LD64, k_lt_4_strided_a) {
     TEST_REQUIRES_ARM_NEON_FP16_ARITH;
-    for (size_t k = 1; k < 2; k++) {
+    for (size_t k = 1; k < 4; k++) {
       GemmMicrokernelTester()
         .mr(4)
-        .nr(16)
+        .nr(8)
         .kr(1)
         .sr(1)
         .m(4)
-        .n(16)
+        .n(8)
         .k(k)
-        .a_stride(5)
-        .Test(xnn_f16_gemm_minmax_ukernel_4x16__aarch64_neonfp16arith_ld32, xnn_init_f16_scaleminmax_neon_params);
+        .a_stride(7)
+        .Test(xnn_f16_gemm_minmax_ukernel_4x8__aarch64_neonfp16arith_ld64, xnn_init_f16_scaleminmax_neon_params);
     }
   }
 
-  TEST(F16_GEMM_MINMAX_4X16__AARCH64_NEONFP16ARITH_LD32, k_lt_2_subtile) {
+  TEST(F16_GEMM_MINMAX_4X8__AARCH64_NEONFP16ARITH_LD64, k_lt_4_subtile) {
     TEST_REQUIRES_ARM_NEON_FP16_ARITH;
-    for (size_t k = 1; k < 2; k++) {
-      for (uint32_t n = 1; n <= 16; n++) {
+    for (size_t k = 1; k < 4; k++) {
+      for (uint32_t n = 1; n <= 8; n++) {
         for (uint32_t m = 1; m <= 4; m++) {
           GemmMicrokernelTester()
             .mr(4)
-            .nr(16)
+            .nr(8)
             .kr(1)
             .sr(1)
             .m(m)
             .n(n)
             .k(k)
             .iterations(1)
-            .Test(xnn_f16_gemm_minmax_ukernel_4x16__aarch64_neonfp16arith_ld32, xnn_init_f16_scaleminmax_neon_params);
+            .Test(xnn_f16_gemm_minmax_ukernel_4x8__aarch64_neonfp16arith_ld64, xnn_init_f16_scaleminmax_neon_params);
         }
       }
     }
   }
 
-  TEST(F16_GEMM_MINMAX_4X16__AARCH64_NEONFP16ARITH_LD32, k_gt_2) {
+  TEST(F16_GEMM_MINMAX_4X8__AARCH64_NEONFP16ARITH_LD64, k_gt_4) {
     TEST_REQUIRES_ARM_NEON_FP16_ARITH;
-    for (size_t k = 3; k < 4; k++) {
+    for (size_t k = 5; k < 8; k++) {
       GemmMicrokernelTester()
         .mr(4)
-        .nr(16)
+        .nr(8)
         .kr(1)
         .sr(1)
         .m(4)
-        .n(16)
+        .n(8)
         .k(k)
-        .Test(xnn_f16_gemm_minmax_ukernel_4x16__aarch64_neonfp16arith_ld32, xnn_init_f16_scaleminmax_neon_params);
+        .Test(xnn_f16_gemm_minmax_ukernel_4x8__aarch64_neonfp16arith_ld64, xnn_init_f16_scaleminmax_neon_params);
     }
   }
 
-  TEST(F16_GEMM_MINMAX_4X16__AARCH64_NEONFP16ARITH_LD32, k_gt_2_strided_a) {
+  TEST(F16_GEMM_MINMAX_4X8__AARCH64_NEONFP16ARITH_LD64, k_gt_4_strided_a) {
     TEST_REQUIRES_ARM_NEON_FP16_ARITH;
-    for (size_t k = 3; k < 4; k++) {
+    for (size_t k = 5; k < 8; k++) {
       GemmMicrokernelTester()
         .mr(4)
-        .nr(16)
+        .nr(8)
         .kr(1)
         .sr(1)
         .m(4)
-        .n(16)
+        .n(8)
         .k(k)
-        .a_stride(7)
-        .Test(xnn_f16_gemm_minmax_ukernel_4x16__aarch64_neonfp16arith_ld32, xnn_init_f16_scaleminmax_neon_params);
+        .a_stride(11)
+        .Test(xnn_f16_gemm_minmax_ukernel_4x8__aarch64_neonfp16arith_ld64, xnn_init_f16_scaleminmax_neon_params);
     }
   }
 
-  TEST(F16_GEMM_MINMAX_4X16__AARCH64_NEONFP16ARITH_LD32, k_gt_2_subtile) {
+  TEST(F16_GEMM_MINMAX_4X8__AARCH64_NEONFP16ARITH_LD64, k_gt_4_subtile) {
     TEST_REQUIRES_ARM_NEON_FP16_ARITH;
-    for (size_t k = 3; k < 4; k++) {
-      for (uint32_t n = 1; n <= 16; n++) {
+    for (size_t k = 5; k < 8; k++) {
+      for (uint32_t n = 1; n <= 8; n++) {
         for (uint32_t m = 1; m <= 4; m++) {
           GemmMicrokernelTester()
             .mr(4)
-            .nr(16)
+            .nr(8)
             .kr(1)
             .sr(1)
             .m(m)
             .n(n)
             .k(k)
             .iterations(1)
-            .Test(xnn_f16_gemm_minmax_ukernel_4x16__aarch64_neonfp16arith_ld32, xnn_init_f16_scaleminmax_neon_params);
+            .Test(xnn_f16_gemm_minmax_ukernel_4x8__aarch64_neonfp16arith_ld64, xnn_init_f16_scaleminmax_neon_params);
         }
       }
     }
   }
 
-  TEST(F16_GEMM_MINMAX_4X16__AARCH64_NEONFP16ARITH_LD32, k_div_2) {
+  TEST(F16_GEMM_MINMAX_4X8__AARCH64_NEONFP16ARITH_LD64, k_div_4) {
     TEST_REQUIRES_ARM_NEON_FP16_ARITH;
-    for (size_t k = 4; k <= 20; k += 2) {
+    for (size_t k = 8; k <= 40; k += 4) {
       GemmMicrokernelTester()
         .mr(4)
-        .nr(16)
+        .nr(8)
         .kr(1)
         .sr(1)
         .m(4)
-        .n(16)
+        .n(8)
         .k(k)
-        .Test(xnn_f16_gemm_minmax_ukernel_4x16__aarch64_neonfp16arith_ld32, xnn_init_f16_scaleminmax_neon_params);
+        .Test(xnn_f16_gemm_minmax_ukernel_4x8__aarch64_neonfp16arith_ld64, xnn_init_f16_scaleminmax_neon_params);
     }
   }
 
-  TEST(F16_GEMM_MINMAX_4X16__AARCH64_NEONFP16ARITH_LD32, k_div_2_strided_a) {
+  TEST(F16_GEMM_MINMAX_4X8__AARCH64_NEONFP16ARITH_LD64, k_div_4_strided_a) {
     TEST_REQUIRES_ARM_NEON_FP16_ARITH;
-    for (size_t k = 4; k <= 20; k += 2) {
+    for (size_t k = 8; k <= 40; k += 4) {
       GemmMicrokernelTester()
         .mr(4)
-        .nr(16)
+        .nr(8)
         .kr(1)
         .sr(1)
         .m(4)
-        .n(16)
+        .n(8)
         .k(k)
-        .a_stride(23)
-        .Test(xnn_f16_gemm_minmax_ukernel_4x16__aarch64_neonfp16arith_ld32, xnn_init_f16_scaleminmax_neon_params);
+        .a_stride(43)
+        .Test(xnn_f16_gemm_minmax_ukernel_4x8__aarch64_neonfp16arith_ld64, xnn_init_f16_scaleminmax_neon_params);
     }
   }
 
-  TEST(F16_GEMM_MINMAX_4X16__AARCH64_NEONFP16ARITH_LD32, k_div_2_subtile) {
+  TEST(F16_GEMM_MINMAX_4X8__AARCH64_NEONFP16ARITH_LD64, k_div_4_subtile) {
     TEST_REQUIRES_ARM_NEON_FP16_ARITH;
-    for (size_t k = 4; k <= 20; k += 2) {
-      for (uint32_t n = 1; n <= 16; n++) {
+    for (size_t k = 8; k <= 40; k += 4) {
+      for (uint32_t n = 1; n <= 8; n++) {
         for (uint32_t m = 1; m <= 4; m++) {
           GemmMicrokernelTester()
             .mr(4)
-            .nr(16)
+            .nr(8)
             .kr(1)
             .sr(1)
             .m(m)
             .n(n)
             .k(k)
             .iterations(1)
-            .Test(xnn_f16_gemm_minmax_ukernel_4x16__aarch64_neonfp16arith_ld32, xnn_init_f16_scaleminmax_neon_params);
+            .Test(xnn_f16_gemm_minmax_ukernel_4x8__aarch64_neonfp16arith_ld64, xnn_init_f16_scaleminmax_neon_params);
         }
       }
     }
   }
 
-  TEST(F16_GEMM_MINMAX_4X16__AARCH64_NEONFP16ARITH_LD32, n_gt_16) {
+  TEST(F16_GEMM_MINMAX_4X8__AARCH64_NEONFP16ARITH_LD64, n_gt_8) {
     TEST_REQUIRES_ARM_NEON_FP16_ARITH;
-    for (uint32_t n = 17; n < 32; n++) {
-      for (size_t k = 1; k <= 10; k += 3) {
+    for (uint32_t n = 9; n < 16; n++) {
+      for (size_t k = 1; k <= 20; k += 5) {
         GemmMicrokernelTester()
           .mr(4)
-          .nr(16)
+          .nr(8)
           .kr(1)
           .sr(1)
           .m(4)
           .n(n)
           .k(k)
-          .Test(xnn_f16_gemm_minmax_ukernel_4x16__aarch64_neonfp16arith_ld32, xnn_init_f16_scaleminmax_neon_params);
+          .Test(xnn_f16_gemm_minmax_ukernel_4x8__aarch64_neonfp16arith_ld64, xnn_init_f16_scaleminmax_neon_params);
       }
     }
   }
 
-  TEST(F16_GEMM_MINMAX_4X16__AARCH64_NEONFP16ARITH_LD32, n_gt_16_strided_cn) {
+  TEST(F16_GEMM_MINMAX_4X8__AARCH64_NEONFP16ARITH_LD64, n_gt_8_strided_cn) {
     TEST_REQUIRES_ARM_NEON_FP16_ARITH;
-    for (uint32_t n = 17; n < 32; n++) {
-      for (size_t k = 1; k <= 10; k += 3) {
+    for (uint32_t n = 9; n < 16; n++) {
+      for (size_t k = 1; k <= 20; k += 5) {
         GemmMicrokernelTester()
           .mr(4)
-          .nr(16)
+          .nr(8)
           .kr(1)
           .sr(1)
           .m(4)
           .n(n)
           .k(k)
-          .cn_stride(19)
-          .Test(xnn_f16_gemm_minmax_ukernel_4x16__aarch64_neonfp16arith_ld32, xnn_init_f16_scaleminmax_neon_params);
+          .cn_stride(11)
+          .Test(xnn_f16_gemm_minmax_ukernel_4x8__aarch64_neonfp16arith_ld64, xnn_init_f16_scaleminmax_neon_params);
       }
     }
   }
 
-  TEST(F16_GEMM_MINMAX_4X16__AARCH64_NEONFP16ARITH_LD32, n_gt_16_strided_a) {
+  TEST(F16_GEMM_MINMAX_4X8__AARCH64_NEONFP16ARITH_LD64, n_gt_8_strided_a) {
     TEST_REQUIRES_ARM_NEON_FP16_ARITH;
-    for (uint32_t n = 17; n < 32; n++) {
-      for (size_t k = 1; k <= 10; k += 3) {
+    for (uint32_t n = 9; n < 16; n++) {
+      for (size_t k = 1; k <= 20; k += 5) {
         GemmMicrokernelTester()
           .mr(4)
-          .nr(16)
+          .nr(8)
           .kr(1)
           .sr(1)
           .m(4)
           .n(n)
           .k(k)
-          .a_stride(13)
-          .Test(xnn_f16_gemm_minmax_ukernel_4x16__aarch64_neonfp16arith_ld32, xnn_init_f16_scaleminmax_neon_params);
+          .a_stride(23)
+          .Test(xnn_f16_gemm_minmax_ukernel_4x8__aarch64_neonfp16arith_ld64, xnn_init_f16_scaleminmax_neon_params);
       }
     }
   }
 
-  TEST(F16_GEMM_MINMAX_4X16__AARCH64_NEONFP16ARITH_LD32, n_gt_16_subtile) {
+  TEST(F16_GEMM_MINMAX_4X8__AARCH64_NEONFP16ARITH_LD64, n_gt_8_subtile) {
     TEST_REQUIRES_ARM_NEON_FP16_ARITH;
-    for (uint32_t n = 17; n < 32; n++) {
-      for (size_t k = 1; k <= 10; k += 3) {
+    for (uint32_t n = 9; n < 16; n++) {
+      for (size_t k = 1; k <= 20; k += 5) {
         for (uint32_t m = 1; m <= 4; m++) {
           GemmMicrokernelTester()
             .mr(4)
-            .nr(16)
+            .nr(8)
             .kr(1)
             .sr(1)
             .m(m)
             .n(n)
             .k(k)
             .iterations(1)
-            .Test(xnn_f16_gemm_minmax_ukernel_4x16__aarch64_neonfp16arith_ld32, xnn_init_f16_scaleminmax_neon_params);
+            .Test(xnn_f16_gemm_minmax_ukernel_4x8__aarch64_neonfp16arith_ld64, xnn_init_f16_scaleminmax_neon_params);
         }
       }
     }
   }
 
-  TEST(F16_GEMM_MINMAX_4X16__AARCH64_NEONFP16ARITH_LD32, n_div_16) {
+  TEST(F16_GEMM_MINMAX_4X8__AARCH64_NEONFP16ARITH_LD64, n_div_8) {
     TEST_REQUIRES_ARM_NEON_FP16_ARITH;
-    for (uint32_t n = 32; n <= 48; n += 16) {
-      for (size_t k = 1; k <= 10; k += 3) {
+    for (uint32_t n = 16; n <= 24; n += 8) {
+      for (size_t k = 1; k <= 20; k += 5) {
         GemmMicrokernelTester()
           .mr(4)
-          .nr(16)
+          .nr(8)
           .kr(1)
           .sr(1)
           .m(4)
           .n(n)
           .k(k)
-          .Test(xnn_f16_gemm_minmax_ukernel_4x16__aarch64_neonfp16arith_ld32, xnn_init_f16_scaleminmax_neon_params);
+          .Test(xnn_f16_gemm_minmax_ukernel_4x8__aarch64_neonfp16arith_ld64, xnn_init_f16_scaleminmax_neon_params);
       }
     }
   }
 
-  TEST(F16_GEMM_MINMAX_4X16__AARCH64_NEONFP16ARITH_LD32, n_div_16_strided_cn) {
+  TEST(F16_GEMM_MINMAX_4X8__AARCH64_NEONFP16ARITH_LD64, n_div_8_strided_cn) {
     TEST_REQUIRES_ARM_NEON_FP16_ARITH;
-    for (uint32_t n = 32; n <= 48; n += 16) {
-      for (size_t k = 1; k <= 10; k += 3) {
+    for (uint32_t n = 16; n <= 24; n += 8) {
+      for (size_t k = 1; k <= 20; k += 5) {
         GemmMicrokernelTester()
           .mr(4)
-          .nr(16)
+          .nr(8)
           .kr(1)
           .sr(1)
           .m(4)
           .n(n)
           .k(k)
-          .cn_stride(19)
-          .Test(xnn_f16_gemm_minmax_ukernel_4x16__aarch64_neonfp16arith_ld32, xnn_init_f16_scaleminmax_neon_params);
+          .cn_stride(11)
+          .Test(xnn_f16_gemm_minmax_ukernel_4x8__aarch64_neonfp16arith_ld64, xnn_init_f16_scaleminmax_neon_params);
       }
     }
   }
 
-  TEST(F16_GEMM_MINMAX_4X16__AARCH64_NEONFP16ARITH_LD32, n_div_16_strided_a) {
+  TEST(F16_GEMM_MINMAX_4X8__AARCH64_NEONFP16ARITH_LD64, n_div_8_strided_a) {
     TEST_REQUIRES_ARM_NEON_FP16_ARITH;
-    for (uint32_t n = 32; n <= 48; n += 16) {
-      for (size_t k = 1; k <= 10; k += 3) {
+    for (uint32_t n = 16; n <= 24; n += 8) {
+      for (size_t k = 1; k <= 20; k += 5) {
         GemmMicrokernelTester()
           .mr(4)
-          .nr(16)
+          .nr(8)
           .kr(1)
           .sr(1)
           .m(4)
           .n(n)
           .k(k)
-          .a_stride(13)
-          .Test(xnn_f16_gemm_minmax_ukernel_4x16__aarch64_neonfp16arith_ld32, xnn_init_f16_scaleminmax_neon_params);
+          .a_stride(23)
+          .Test(xnn_f16_gemm_minmax_ukernel_4x8__aarch64_neonfp16arith_ld64, xnn_init_f16_scaleminmax_neon_params);
       }
     }
   }
 
-  TEST(F16_GEMM_MINMAX_4X16__AARCH64_NEONFP16ARITH_LD32, n_div_16_subtile) {
+  TEST(F16_GEMM_MINMAX_4X8__AARCH64_NEONFP16ARITH_LD64, n_div_8_subtile) {
     TEST_REQUIRES_ARM_NEON_FP16_ARITH;
-    for (uint32_t n = 32; n <= 48; n += 16) {
-      for (size_t k = 1; k <= 10; k += 3) {
+    for (uint32_t n = 16; n <= 24; n += 8) {
+      for (size_t k = 1; k <= 20; k += 5) {
         for (uint32_t m = 1; m <= 4; m++) {
           GemmMicrokernelTester()
             .mr(4)
-            .nr(16)
+            .nr(8)
             .kr(1)
             .sr(1)
             .m(m)
             .n(n)
             .k(k)
             .iterations(1)
-            .Test(xnn_f16_gemm_minmax_ukernel_4x16__aarch64_neonfp16arith_ld32, xnn_init_f16_scaleminmax_neon_params);
+            .Test(xnn_f16_gemm_minmax_ukernel_4x8__aarch64_neonfp16arith_ld64, xnn_init_f16_scaleminmax_neon_params);
         }
       }
     }
   }
 
-  TEST(F16_GEMM_MINMAX_4X16__AARCH64_NEONFP16ARITH_LD32, strided_cm_subtile) {
+  TEST(F16_GEMM_MINMAX_4X8__AARCH64_NEONFP16ARITH_LD64, strided_cm_subtile) {
     TEST_REQUIRES_ARM_NEON_FP16_ARITH;
-    for (size_t k = 1; k <= 10; k += 3) {
-      for (uint32_t n = 1; n <= 16; n++) {
+    for (size_t k = 1; k <= 20; k += 5) {
+      for (uint32_t n = 1; n <= 8; n++) {
         for (uint32_t m = 1; m <= 4; m++) {
           GemmMicrokernelTester()
             .mr(4)
-            .nr(16)
+            .nr(8)
             .kr(1)
             .sr(1)
             .m(m)
             .n(n)
             .k(k)
-            .cm_stride(19)
+            .cm_stride(11)
             .iterations(1)
-            .Test(xnn_f16_gemm_minmax_ukernel_4x16__aarch64_neonfp16arith_ld32, xnn_init_f16_scaleminmax_neon_params);
+            .Test(xnn_f16_gemm_minmax_ukernel_4x8__aarch64_neonfp16arith_ld64, xnn_init_f16_scaleminmax_neon_params);
         }
       }
     }
   }
 
-  TEST(F16_GEMM_MINMAX_4X16__AARCH64_NEONFP16ARITH_LD32, qmin) {
+  TEST(F16_GEMM_MINMAX_4X8__AARCH64_NEONFP16ARITH_LD64, qmin) {
     TEST_REQUIRES_ARM_NEON_FP16_ARITH;
     GemmMicrokernelTester()
       .mr(4)
-      .nr(16)
+      .nr(8)
       .kr(1)
       .sr(1)
       .m(4)
-      .n(16)
-      .k(2)
+      .n(8)
+      .k(4)
       .qmin(128)
-      .Test(xnn_f16_gemm_minmax_ukernel_4x16__aarch64_neonfp16arith_ld32, xnn_init_f16_scaleminmax_neon_params);
+      .Test(xnn_f16_gemm_minmax_ukernel_4x8__aarch64_neonfp16arith_ld64, xnn_init_f16_scaleminmax_neon_params);
   }
 
-  TEST(F16_GEMM_MINMAX_4X16__AARCH64_NEONFP16ARITH_LD32, qmax) {
+  TEST(F16_GEMM_MINMAX_4X8__AARCH64_NEONFP16ARITH_LD64, qmax) {
     TEST_REQUIRES_ARM_NEON_FP16_ARITH;
     GemmMicrokernelTester()
       .mr(4)
-      .nr(16)
+      .nr(8)
       .kr(1)
       .sr(1)
       .m(4)
-      .n(16)
-      .k(2)
+      .n(8)
+      .k(4)
       .qmax(128)
-      .Test(xnn_f16_gemm_minmax_ukernel_4x16__aarch64_neonfp16arith_ld32, xnn_init_f16_scaleminmax_neon_params);
+      .Test(xnn_f16_gemm_minmax_ukernel_4x8__aarch64_neonfp16arith_ld64, xnn_init_f16_scaleminmax_neon_params);
   }
 
-  TEST(F16_GEMM_MINMAX_4X16__AARCH64_NEONFP16ARITH_LD32, strided_cm) {
+  TEST(F16_GEMM_MINMAX_4X8__AARCH64_NEONFP16ARITH_LD64, strided_cm) {
     TEST_REQUIRES_ARM_NEON_FP16_ARITH;
     GemmMicrokernelTester()
       .mr(4)
-      .nr(16)
+      .nr(8)
       .kr(1)
       .sr(1)
       .m(4)
-      .n(16)
-      .k(2)
-      .cm_stride(19)
-      .Test(xnn_f16_gemm_minmax_ukernel_4x16__aarch64_neonfp16arith_ld32, xnn_init_f16_scaleminmax_neon_params);
+      .n(8)
+      .k(4)
+      .cm_stride(11)
+      .Test(xnn_f16_gemm_minmax_ukernel_4x8__aarch64_neonfp16arith_ld64, xnn_init_f16_scaleminmax_neon_params);
   }
 #endif  // XNN_ARCH_ARM64 && XNN_ENABLE_ASSEMBLY
 
 
 #if XNN_ARCH_ARM64 && XNN_ENABLE_ASSEMBLY
-  TEST(F16_GEMM_MINMAX_6X8__AARCH64_NEONFP16ARITH_LD64, k_eq_4) {
+  TEST(F16_GEMM_MINMAX_4X16__AARCH64_NEONFP16ARITH_LD32, k_eq_2) {
     TEST_REQUIRES_ARM_NEON_FP16_ARITH;
     GemmMicrokernelTester()
-      .mr(6)
-      .nr(8)
+      .mr(4)
+      .nr(16)
       .kr(1)
       .sr(1)
-      .m(6)
-      .n(8)
-      .k(4)
-      .Test(xnn_f16_gemm_minmax_ukernel_6x8__aarch64_neonfp16arith_ld64, xnn_init_f16_scaleminmax_neon_params);
+      .m(4)
+      .n(16)
+      .k(2)
+      .Test(xnn_f16_gemm_minmax_ukernel_4x16__aarch64_neonfp16arith_ld32, xnn_init_f16_scaleminmax_neon_params);
   }
 
-  TEST(F16_GEMM_MINMAX_6X8__AARCH64_NEONFP16ARITH_LD64, strided_cn) {
+  TEST(F16_GEMM_MINMAX_4X16__AARCH64_NEONFP16ARITH_LD32, strided_cn) {
     TEST_REQUIRES_ARM_NEON_FP16_ARITH;
     GemmMicrokernelTester()
-      .mr(6)
-      .nr(8)
+      .mr(4)
+      .nr(16)
       .kr(1)
       .sr(1)
-      .m(6)
-      .n(8)
-      .k(4)
-      .cn_stride(11)
-      .Test(xnn_f16_gemm_minmax_ukernel_6x8__aarch64_neonfp16arith_ld64, xnn_init_f16_scaleminmax_neon_params);
+      .m(4)
+      .n(16)
+      .k(2)
+      .cn_stride(19)
+      .Test(xnn_f16_gemm_minmax_ukernel_4x16__aarch64_neonfp16arith_ld32, xnn_init_f16_scaleminmax_neon_params);
   }
 
-  TEST(F16_GEMM_MINMAX_6X8__AARCH64_NEONFP16ARITH_LD64, k_eq_4_strided_a) {
+  TEST(F16_GEMM_MINMAX_4X16__AARCH64_NEONFP16ARITH_LD32, k_eq_2_strided_a) {
     TEST_REQUIRES_ARM_NEON_FP16_ARITH;
     GemmMicrokernelTester()
-      .mr(6)
-      .nr(8)
+      .mr(4)
+      .nr(16)
       .kr(1)
       .sr(1)
-      .m(6)
-      .n(8)
-      .k(4)
-      .a_stride(7)
-      .Test(xnn_f16_gemm_minmax_ukernel_6x8__aarch64_neonfp16arith_ld64, xnn_init_f16_scaleminmax_neon_params);
+      .m(4)
+      .n(16)
+      .k(2)
+      .a_stride(5)
+      .Test(xnn_f16_gemm_minmax_ukernel_4x16__aarch64_neonfp16arith_ld32, xnn_init_f16_scaleminmax_neon_params);
   }
 
-  TEST(F16_GEMM_MINMAX_6X8__AARCH64_NEONFP16ARITH_LD64, k_eq_4_subtile) {
+  TEST(F16_GEMM_MINMAX_4X16__AARCH64_NEONFP16ARITH_LD32, k_eq_2_subtile) {
     TEST_REQUIRES_ARM_NEON_FP16_ARITH;
-    for (uint32_t n = 1; n <= 8; n++) {
-      for (uint32_t m = 1; m <= 6; m++) {
+    for (uint32_t n = 1; n <= 16; n++) {
+      for (uint32_t m = 1; m <= 4; m++) {
         GemmMicrokernelTester()
-          .mr(6)
-          .nr(8)
+          .mr(4)
+          .nr(16)
           .kr(1)
           .sr(1)
           .m(m)
           .n(n)
-          .k(4)
+          .k(2)
           .iterations(1)
-          .Test(xnn_f16_gemm_minmax_ukernel_6x8__aarch64_neonfp16arith_ld64, xnn_init_f16_scaleminmax_neon_params);
+          .Test(xnn_f16_gemm_minmax_ukernel_4x16__aarch64_neonfp16arith_ld32, xnn_init_f16_scaleminmax_neon_params);
       }
     }
   }
 
-  TEST(F16_GEMM_MINMAX_6X8__AARCH64_NEONFP16ARITH_LD64, k_eq_4_subtile_m) {
+  TEST(F16_GEMM_MINMAX_4X16__AARCH64_NEONFP16ARITH_LD32, k_eq_2_subtile_m) {
     TEST_REQUIRES_ARM_NEON_FP16_ARITH;
-    for (uint32_t m = 1; m <= 6; m++) {
+    for (uint32_t m = 1; m <= 4; m++) {
       GemmMicrokernelTester()
-        .mr(6)
-        .nr(8)
+        .mr(4)
+        .nr(16)
         .kr(1)
         .sr(1)
         .m(m)
-        .n(8)
-        .k(4)
+        .n(16)
+        .k(2)
         .iterations(1)
-        .Test(xnn_f16_gemm_minmax_ukernel_6x8__aarch64_neonfp16arith_ld64, xnn_init_f16_scaleminmax_neon_params);
+        .Test(xnn_f16_gemm_minmax_ukernel_4x16__aarch64_neonfp16arith_ld32, xnn_init_f16_scaleminmax_neon_params);
     }
   }
 
-  TEST(F16_GEMM_MINMAX_6X8__AARCH64_NEONFP16ARITH_LD64, k_eq_4_subtile_n) {
+  TEST(F16_GEMM_MINMAX_4X16__AARCH64_NEONFP16ARITH_LD32, k_eq_2_subtile_n) {
     TEST_REQUIRES_ARM_NEON_FP16_ARITH;
-    for (uint32_t n = 1; n <= 8; n++) {
+    for (uint32_t n = 1; n <= 16; n++) {
       GemmMicrokernelTester()
-        .mr(6)
-        .nr(8)
+        .mr(4)
+        .nr(16)
         .kr(1)
         .sr(1)
-        .m(6)
+        .m(4)
         .n(n)
-        .k(4)
+        .k(2)
         .iterations(1)
-        .Test(xnn_f16_gemm_minmax_ukernel_6x8__aarch64_neonfp16arith_ld64, xnn_init_f16_scaleminmax_neon_params);
+        .Test(xnn_f16_gemm_minmax_ukernel_4x16__aarch64_neonfp16arith_ld32, xnn_init_f16_scaleminmax_neon_params);
     }
   }
 
-  TEST(F16_GEMM_MINMAX_6X8__AARCH64_NEONFP16ARITH_LD64, k_lt_4) {
+  TEST(F16_GEMM_MINMAX_4X16__AARCH64_NEONFP16ARITH_LD32, k_lt_2) {
     TEST_REQUIRES_ARM_NEON_FP16_ARITH;
-    for (size_t k = 1; k < 4; k++) {
+    for (size_t k = 1; k < 2; k++) {
       GemmMicrokernelTester()
-        .mr(6)
-        .nr(8)
+        .mr(4)
+        .nr(16)
         .kr(1)
         .sr(1)
-        .m(6)
-        .n(8)
+        .m(4)
+        .n(16)
         .k(k)
-        .Test(xnn_f16_gemm_minmax_ukernel_6x8__aarch64_neonfp16arith_ld64, xnn_init_f16_scaleminmax_neon_params);
+        .Test(xnn_f16_gemm_minmax_ukernel_4x16__aarch64_neonfp16arith_ld32, xnn_init_f16_scaleminmax_neon_params);
     }
   }
 
-  TEST(F16_GEMM_MINMAX_6X8__AARCH64_NEONFP16ARITH_LD64, k_lt_4_strided_a) {
+  TEST(F16_GEMM_MINMAX_4X16__AARCH64_NEONFP16ARITH_LD32, k_lt_2_strided_a) {
     TEST_REQUIRES_ARM_NEON_FP16_ARITH;
-    for (size_t k = 1; k < 4; k++) {
+    for (size_t k = 1; k < 2; k++) {
       GemmMicrokernelTester()
-        .mr(6)
-        .nr(8)
+        .mr(4)
+        .nr(16)
         .kr(1)
         .sr(1)
-        .m(6)
-        .n(8)
+        .m(4)
+        .n(16)
         .k(k)
-        .a_stride(7)
-        .Test(xnn_f16_gemm_minmax_ukernel_6x8__aarch64_neonfp16arith_ld64, xnn_init_f16_scaleminmax_neon_params);
+        .a_stride(5)
+        .Test(xnn_f16_gemm_minmax_ukernel_4x16__aarch64_neonfp16arith_ld32, xnn_init_f16_scaleminmax_neon_params);
     }
   }
 
-  TEST(F16_GEMM_MINMAX_6X8__AARCH64_NEONFP16ARITH_LD64, k_lt_4_subtile) {
+  TEST(F16_GEMM_MINMAX_4X16__AARCH64_NEONFP16ARITH_LD32, k_lt_2_subtile) {
     TEST_REQUIRES_ARM_NEON_FP16_ARITH;
-    for (size_t k = 1; k < 4; k++) {
-      for (uint32_t n = 1; n <= 8; n++) {
-        for (uint32_t m = 1; m <= 6; m++) {
+    for (size_t k = 1; k < 2; k++) {
+      for (uint32_t n = 1; n <= 16; n++) {
+        for (uint32_t m = 1; m <= 4; m++) {
           GemmMicrokernelTester()
-            .mr(6)
-            .nr(8)
+            .mr(4)
+            .nr(16)
             .kr(1)
             .sr(1)
             .m(m)
             .n(n)
             .k(k)
             .iterations(1)
-            .Test(xnn_f16_gemm_minmax_ukernel_6x8__aarch64_neonfp16arith_ld64, xnn_init_f16_scaleminmax_neon_params);
+            .Test(xnn_f16_gemm_minmax_ukernel_4x16__aarch64_neonfp16arith_ld32, xnn_init_f16_scaleminmax_neon_params);
         }
       }
     }
   }
 
-  TEST(F16_GEMM_MINMAX_6X8__AARCH64_NEONFP16ARITH_LD64, k_gt_4) {
+  TEST(F16_GEMM_MINMAX_4X16__AARCH64_NEONFP16ARITH_LD32, k_gt_2) {
     TEST_REQUIRES_ARM_NEON_FP16_ARITH;
-    for (size_t k = 5; k < 8; k++) {
+    for (size_t k = 3; k < 4; k++) {
       GemmMicrokernelTester()
-        .mr(6)
-        .nr(8)
+        .mr(4)
+        .nr(16)
         .kr(1)
         .sr(1)
-        .m(6)
-        .n(8)
+        .m(4)
+        .n(16)
         .k(k)
-        .Test(xnn_f16_gemm_minmax_ukernel_6x8__aarch64_neonfp16arith_ld64, xnn_init_f16_scaleminmax_neon_params);
+        .Test(xnn_f16_gemm_minmax_ukernel_4x16__aarch64_neonfp16arith_ld32, xnn_init_f16_scaleminmax_neon_params);
     }
   }
 
-  TEST(F16_GEMM_MINMAX_6X8__AARCH64_NEONFP16ARITH_LD64, k_gt_4_strided_a) {
+  TEST(F16_GEMM_MINMAX_4X16__AARCH64_NEONFP16ARITH_LD32, k_gt_2_strided_a) {
     TEST_REQUIRES_ARM_NEON_FP16_ARITH;
-    for (size_t k = 5; k < 8; k++) {
+    for (size_t k = 3; k < 4; k++) {
       GemmMicrokernelTester()
-        .mr(6)
-        .nr(8)
+        .mr(4)
+        .nr(16)
         .kr(1)
         .sr(1)
-        .m(6)
-        .n(8)
+        .m(4)
+        .n(16)
         .k(k)
-        .a_stride(11)
-        .Test(xnn_f16_gemm_minmax_ukernel_6x8__aarch64_neonfp16arith_ld64, xnn_init_f16_scaleminmax_neon_params);
+        .a_stride(7)
+        .Test(xnn_f16_gemm_minmax_ukernel_4x16__aarch64_neonfp16arith_ld32, xnn_init_f16_scaleminmax_neon_params);
     }
   }
 
-  TEST(F16_GEMM_MINMAX_6X8__AARCH64_NEONFP16ARITH_LD64, k_gt_4_subtile) {
+  TEST(F16_GEMM_MINMAX_4X16__AARCH64_NEONFP16ARITH_LD32, k_gt_2_subtile) {
     TEST_REQUIRES_ARM_NEON_FP16_ARITH;
-    for (size_t k = 5; k < 8; k++) {
-      for (uint32_t n = 1; n <= 8; n++) {
-        for (uint32_t m = 1; m <= 6; m++) {
+    for (size_t k = 3; k < 4; k++) {
+      for (uint32_t n = 1; n <= 16; n++) {
+        for (uint32_t m = 1; m <= 4; m++) {
           GemmMicrokernelTester()
-            .mr(6)
-            .nr(8)
+            .mr(4)
+            .nr(16)
             .kr(1)
             .sr(1)
             .m(m)
             .n(n)
             .k(k)
             .iterations(1)
-            .Test(xnn_f16_gemm_minmax_ukernel_6x8__aarch64_neonfp16arith_ld64, xnn_init_f16_scaleminmax_neon_params);
+            .Test(xnn_f16_gemm_minmax_ukernel_4x16__aarch64_neonfp16arith_ld32, xnn_init_f16_scaleminmax_neon_params);
         }
       }
     }
   }
 
-  TEST(F16_GEMM_MINMAX_6X8__AARCH64_NEONFP16ARITH_LD64, k_div_4) {
+  TEST(F16_GEMM_MINMAX_4X16__AARCH64_NEONFP16ARITH_LD32, k_div_2) {
     TEST_REQUIRES_ARM_NEON_FP16_ARITH;
-    for (size_t k = 8; k <= 40; k += 4) {
+    for (size_t k = 4; k <= 20; k += 2) {
       GemmMicrokernelTester()
-        .mr(6)
-        .nr(8)
+        .mr(4)
+        .nr(16)
         .kr(1)
         .sr(1)
-        .m(6)
-        .n(8)
+        .m(4)
+        .n(16)
         .k(k)
-        .Test(xnn_f16_gemm_minmax_ukernel_6x8__aarch64_neonfp16arith_ld64, xnn_init_f16_scaleminmax_neon_params);
+        .Test(xnn_f16_gemm_minmax_ukernel_4x16__aarch64_neonfp16arith_ld32, xnn_init_f16_scaleminmax_neon_params);
     }
   }
 
-  TEST(F16_GEMM_MINMAX_6X8__AARCH64_NEONFP16ARITH_LD64, k_div_4_strided_a) {
+  TEST(F16_GEMM_MINMAX_4X16__AARCH64_NEONFP16ARITH_LD32, k_div_2_strided_a) {
     TEST_REQUIRES_ARM_NEON_FP16_ARITH;
-    for (size_t k = 8; k <= 40; k += 4) {
+    for (size_t k = 4; k <= 20; k += 2) {
       GemmMicrokernelTester()
-        .mr(6)
-        .nr(8)
+        .mr(4)
+        .nr(16)
         .kr(1)
         .sr(1)
-        .m(6)
-        .n(8)
+        .m(4)
+        .n(16)
         .k(k)
-        .a_stride(43)
-        .Test(xnn_f16_gemm_minmax_ukernel_6x8__aarch64_neonfp16arith_ld64, xnn_init_f16_scaleminmax_neon_params);
+        .a_stride(23)
+        .Test(xnn_f16_gemm_minmax_ukernel_4x16__aarch64_neonfp16arith_ld32, xnn_init_f16_scaleminmax_neon_params);
     }
   }
 
-  TEST(F16_GEMM_MINMAX_6X8__AARCH64_NEONFP16ARITH_LD64, k_div_4_subtile) {
+  TEST(F16_GEMM_MINMAX_4X16__AARCH64_NEONFP16ARITH_LD32, k_div_2_subtile) {
     TEST_REQUIRES_ARM_NEON_FP16_ARITH;
-    for (size_t k = 8; k <= 40; k += 4) {
-      for (uint32_t n = 1; n <= 8; n++) {
-        for (uint32_t m = 1; m <= 6; m++) {
+    for (size_t k = 4; k <= 20; k += 2) {
+      for (uint32_t n = 1; n <= 16; n++) {
+        for (uint32_t m = 1; m <= 4; m++) {
           GemmMicrokernelTester()
-            .mr(6)
-            .nr(8)
+            .mr(4)
+            .nr(16)
             .kr(1)
             .sr(1)
             .m(m)
             .n(n)
             .k(k)
             .iterations(1)
-            .Test(xnn_f16_gemm_minmax_ukernel_6x8__aarch64_neonfp16arith_ld64, xnn_init_f16_scaleminmax_neon_params);
+            .Test(xnn_f16_gemm_minmax_ukernel_4x16__aarch64_neonfp16arith_ld32, xnn_init_f16_scaleminmax_neon_params);
         }
       }
     }
   }
 
-  TEST(F16_GEMM_MINMAX_6X8__AARCH64_NEONFP16ARITH_LD64, n_gt_8) {
+  TEST(F16_GEMM_MINMAX_4X16__AARCH64_NEONFP16ARITH_LD32, n_gt_16) {
     TEST_REQUIRES_ARM_NEON_FP16_ARITH;
-    for (uint32_t n = 9; n < 16; n++) {
-      for (size_t k = 1; k <= 20; k += 5) {
+    for (uint32_t n = 17; n < 32; n++) {
+      for (size_t k = 1; k <= 10; k += 3) {
         GemmMicrokernelTester()
-          .mr(6)
-          .nr(8)
+          .mr(4)
+          .nr(16)
           .kr(1)
           .sr(1)
-          .m(6)
+          .m(4)
           .n(n)
           .k(k)
-          .Test(xnn_f16_gemm_minmax_ukernel_6x8__aarch64_neonfp16arith_ld64, xnn_init_f16_scaleminmax_neon_params);
+          .Test(xnn_f16_gemm_minmax_ukernel_4x16__aarch64_neonfp16arith_ld32, xnn_init_f16_scaleminmax_neon_params);
       }
     }
   }
 
-  TEST(F16_GEMM_MINMAX_6X8__AARCH64_NEONFP16ARITH_LD64, n_gt_8_strided_cn) {
+  TEST(F16_GEMM_MINMAX_4X16__AARCH64_NEONFP16ARITH_LD32, n_gt_16_strided_cn) {
     TEST_REQUIRES_ARM_NEON_FP16_ARITH;
-    for (uint32_t n = 9; n < 16; n++) {
-      for (size_t k = 1; k <= 20; k += 5) {
+    for (uint32_t n = 17; n < 32; n++) {
+      for (size_t k = 1; k <= 10; k += 3) {
         GemmMicrokernelTester()
-          .mr(6)
-          .nr(8)
+          .mr(4)
+          .nr(16)
           .kr(1)
           .sr(1)
-          .m(6)
+          .m(4)
           .n(n)
           .k(k)
-          .cn_stride(11)
-          .Test(xnn_f16_gemm_minmax_ukernel_6x8__aarch64_neonfp16arith_ld64, xnn_init_f16_scaleminmax_neon_params);
+          .cn_stride(19)
+          .Test(xnn_f16_gemm_minmax_ukernel_4x16__aarch64_neonfp16arith_ld32, xnn_init_f16_scaleminmax_neon_params);
       }
     }
   }
 
-  TEST(F16_GEMM_MINMAX_6X8__AARCH64_NEONFP16ARITH_LD64, n_gt_8_strided_a) {
+  TEST(F16_GEMM_MINMAX_4X16__AARCH64_NEONFP16ARITH_LD32, n_gt_16_strided_a) {
     TEST_REQUIRES_ARM_NEON_FP16_ARITH;
-    for (uint32_t n = 9; n < 16; n++) {
-      for (size_t k = 1; k <= 20; k += 5) {
+    for (uint32_t n = 17; n < 32; n++) {
+      for (size_t k = 1; k <= 10; k += 3) {
         GemmMicrokernelTester()
-          .mr(6)
-          .nr(8)
+          .mr(4)
+          .nr(16)
           .kr(1)
           .sr(1)
-          .m(6)
+          .m(4)
           .n(n)
           .k(k)
-          .a_stride(23)
-          .Test(xnn_f16_gemm_minmax_ukernel_6x8__aarch64_neonfp16arith_ld64, xnn_init_f16_scaleminmax_neon_params);
+          .a_stride(13)
+          .Test(xnn_f16_gemm_minmax_ukernel_4x16__aarch64_neonfp16arith_ld32, xnn_init_f16_scaleminmax_neon_params);
       }
     }
   }
 
-  TEST(F16_GEMM_MINMAX_6X8__AARCH64_NEONFP16ARITH_LD64, n_gt_8_subtile) {
+  TEST(F16_GEMM_MINMAX_4X16__AARCH64_NEONFP16ARITH_LD32, n_gt_16_subtile) {
     TEST_REQUIRES_ARM_NEON_FP16_ARITH;
-    for (uint32_t n = 9; n < 16; n++) {
-      for (size_t k = 1; k <= 20; k += 5) {
-        for (uint32_t m = 1; m <= 6; m++) {
+    for (uint32_t n = 17; n < 32; n++) {
+      for (size_t k = 1; k <= 10; k += 3) {
+        for (uint32_t m = 1; m <= 4; m++) {
           GemmMicrokernelTester()
-            .mr(6)
-            .nr(8)
+            .mr(4)
+            .nr(16)
             .kr(1)
             .sr(1)
             .m(m)
             .n(n)
             .k(k)
             .iterations(1)
-            .Test(xnn_f16_gemm_minmax_ukernel_6x8__aarch64_neonfp16arith_ld64, xnn_init_f16_scaleminmax_neon_params);
+            .Test(xnn_f16_gemm_minmax_ukernel_4x16__aarch64_neonfp16arith_ld32, xnn_init_f16_scaleminmax_neon_params);
         }
       }
     }
   }
 
-  TEST(F16_GEMM_MINMAX_6X8__AARCH64_NEONFP16ARITH_LD64, n_div_8) {
+  TEST(F16_GEMM_MINMAX_4X16__AARCH64_NEONFP16ARITH_LD32, n_div_16) {
     TEST_REQUIRES_ARM_NEON_FP16_ARITH;
-    for (uint32_t n = 16; n <= 24; n += 8) {
-      for (size_t k = 1; k <= 20; k += 5) {
+    for (uint32_t n = 32; n <= 48; n += 16) {
+      for (size_t k = 1; k <= 10; k += 3) {
         GemmMicrokernelTester()
-          .mr(6)
-          .nr(8)
+          .mr(4)
+          .nr(16)
           .kr(1)
           .sr(1)
-          .m(6)
+          .m(4)
           .n(n)
           .k(k)
-          .Test(xnn_f16_gemm_minmax_ukernel_6x8__aarch64_neonfp16arith_ld64, xnn_init_f16_scaleminmax_neon_params);
+          .Test(xnn_f16_gemm_minmax_ukernel_4x16__aarch64_neonfp16arith_ld32, xnn_init_f16_scaleminmax_neon_params);
       }
     }
   }
 
-  TEST(F16_GEMM_MINMAX_6X8__AARCH64_NEONFP16ARITH_LD64, n_div_8_strided_cn) {
+  TEST(F16_GEMM_MINMAX_4X16__AARCH64_NEONFP16ARITH_LD32, n_div_16_strided_cn) {
     TEST_REQUIRES_ARM_NEON_FP16_ARITH;
-    for (uint32_t n = 16; n <= 24; n += 8) {
-      for (size_t k = 1; k <= 20; k += 5) {
+    for (uint32_t n = 32; n <= 48; n += 16) {
+      for (size_t k = 1; k <= 10; k += 3) {
         GemmMicrokernelTester()
-          .mr(6)
-          .nr(8)
+          .mr(4)
+          .nr(16)
           .kr(1)
           .sr(1)
-          .m(6)
+          .m(4)
           .n(n)
           .k(k)
-          .cn_stride(11)
-          .Test(xnn_f16_gemm_minmax_ukernel_6x8__aarch64_neonfp16arith_ld64, xnn_init_f16_scaleminmax_neon_params);
+          .cn_stride(19)
+          .Test(xnn_f16_gemm_minmax_ukernel_4x16__aarch64_neonfp16arith_ld32, xnn_init_f16_scaleminmax_neon_params);
       }
     }
   }
 
-  TEST(F16_GEMM_MINMAX_6X8__AARCH64_NEONFP16ARITH_LD64, n_div_8_strided_a) {
+  TEST(F16_GEMM_MINMAX_4X16__AARCH64_NEONFP16ARITH_LD32, n_div_16_strided_a) {
     TEST_REQUIRES_ARM_NEON_FP16_ARITH;
-    for (uint32_t n = 16; n <= 24; n += 8) {
-      for (size_t k = 1; k <= 20; k += 5) {
+    for (uint32_t n = 32; n <= 48; n += 16) {
+      for (size_t k = 1; k <= 10; k += 3) {
         GemmMicrokernelTester()
-          .mr(6)
-          .nr(8)
+          .mr(4)
+          .nr(16)
           .kr(1)
           .sr(1)
-          .m(6)
+          .m(4)
           .n(n)
           .k(k)
-          .a_stride(23)
-          .Test(xnn_f16_gemm_minmax_ukernel_6x8__aarch64_neonfp16arith_ld64, xnn_init_f16_scaleminmax_neon_params);
+          .a_stride(13)
+          .Test(xnn_f16_gemm_minmax_ukernel_4x16__aarch64_neonfp16arith_ld32, xnn_init_f16_scaleminmax_neon_params);
       }
     }
   }
 
-  TEST(F16_GEMM_MINMAX_6X8__AARCH64_NEONFP16ARITH_LD64, n_div_8_subtile) {
+  TEST(F16_GEMM_MINMAX_4X16__AARCH64_NEONFP16ARITH_LD32, n_div_16_subtile) {
     TEST_REQUIRES_ARM_NEON_FP16_ARITH;
-    for (uint32_t n = 16; n <= 24; n += 8) {
-      for (size_t k = 1; k <= 20; k += 5) {
-        for (uint32_t m = 1; m <= 6; m++) {
+    for (uint32_t n = 32; n <= 48; n += 16) {
+      for (size_t k = 1; k <= 10; k += 3) {
+        for (uint32_t m = 1; m <= 4; m++) {
           GemmMicrokernelTester()
-            .mr(6)
-            .nr(8)
+            .mr(4)
+            .nr(16)
             .kr(1)
             .sr(1)
             .m(m)
             .n(n)
             .k(k)
             .iterations(1)
-            .Test(xnn_f16_gemm_minmax_ukernel_6x8__aarch64_neonfp16arith_ld64, xnn_init_f16_scaleminmax_neon_params);
+            .Test(xnn_f16_gemm_minmax_ukernel_4x16__aarch64_neonfp16arith_ld32, xnn_init_f16_scaleminmax_neon_params);
         }
       }
     }
   }
 
-  TEST(F16_GEMM_MINMAX_6X8__AARCH64_NEONFP16ARITH_LD64, strided_cm_subtile) {
+  TEST(F16_GEMM_MINMAX_4X16__AARCH64_NEONFP16ARITH_LD32, strided_cm_subtile) {
     TEST_REQUIRES_ARM_NEON_FP16_ARITH;
-    for (size_t k = 1; k <= 20; k += 5) {
-      for (uint32_t n = 1; n <= 8; n++) {
-        for (uint32_t m = 1; m <= 6; m++) {
+    for (size_t k = 1; k <= 10; k += 3) {
+      for (uint32_t n = 1; n <= 16; n++) {
+        for (uint32_t m = 1; m <= 4; m++) {
           GemmMicrokernelTester()
-            .mr(6)
-            .nr(8)
+            .mr(4)
+            .nr(16)
             .kr(1)
             .sr(1)
             .m(m)
             .n(n)
             .k(k)
-            .cm_stride(11)
+            .cm_stride(19)
             .iterations(1)
-            .Test(xnn_f16_gemm_minmax_ukernel_6x8__aarch64_neonfp16arith_ld64, xnn_init_f16_scaleminmax_neon_params);
+            .Test(xnn_f16_gemm_minmax_ukernel_4x16__aarch64_neonfp16arith_ld32, xnn_init_f16_scaleminmax_neon_params);
         }
       }
     }
   }
 
-  TEST(F16_GEMM_MINMAX_6X8__AARCH64_NEONFP16ARITH_LD64, qmin) {
+  TEST(F16_GEMM_MINMAX_4X16__AARCH64_NEONFP16ARITH_LD32, qmin) {
     TEST_REQUIRES_ARM_NEON_FP16_ARITH;
     GemmMicrokernelTester()
-      .mr(6)
-      .nr(8)
+      .mr(4)
+      .nr(16)
       .kr(1)
       .sr(1)
-      .m(6)
-      .n(8)
-      .k(4)
+      .m(4)
+      .n(16)
+      .k(2)
       .qmin(128)
-      .Test(xnn_f16_gemm_minmax_ukernel_6x8__aarch64_neonfp16arith_ld64, xnn_init_f16_scaleminmax_neon_params);
+      .Test(xnn_f16_gemm_minmax_ukernel_4x16__aarch64_neonfp16arith_ld32, xnn_init_f16_scaleminmax_neon_params);
   }
 
-  TEST(F16_GEMM_MINMAX_6X8__AARCH64_NEONFP16ARITH_LD64, qmax) {
+  TEST(F16_GEMM_MINMAX_4X16__AARCH64_NEONFP16ARITH_LD32, qmax) {
     TEST_REQUIRES_ARM_NEON_FP16_ARITH;
     GemmMicrokernelTester()
-      .mr(6)
-      .nr(8)
+      .mr(4)
+      .nr(16)
       .kr(1)
       .sr(1)
-      .m(6)
-      .n(8)
-      .k(4)
+      .m(4)
+      .n(16)
+      .k(2)
       .qmax(128)
-      .Test(xnn_f16_gemm_minmax_ukernel_6x8__aarch64_neonfp16arith_ld64, xnn_init_f16_scaleminmax_neon_params);
+      .Test(xnn_f16_gemm_minmax_ukernel_4x16__aarch64_neonfp16arith_ld32, xnn_init_f16_scaleminmax_neon_params);
   }
 
-  TEST(F16_GEMM_MINMAX_6X8__AARCH64_NEONFP16ARITH_LD64, strided_cm) {
+  TEST(F16_GEMM_MINMAX_4X16__AARCH64_NEONFP16ARITH_LD32, strided_cm) {
     TEST_REQUIRES_ARM_NEON_FP16_ARITH;
     GemmMicrokernelTester()
-      .mr(6)
-      .nr(8)
+      .mr(4)
+      .nr(16)
       .kr(1)
       .sr(1)
-      .m(6)
-      .n(8)
-      .k(4)
-      .cm_stride(11)
-      .Test(xnn_f16_gemm_minmax_ukernel_6x8__aarch64_neonfp16arith_ld64, xnn_init_f16_scaleminmax_neon_params);
+      .m(4)
+      .n(16)
+      .k(2)
+      .cm_stride(19)
+      .Test(xnn_f16_gemm_minmax_ukernel_4x16__aarch64_neonfp16arith_ld32, xnn_init_f16_scaleminmax_neon_params);
   }
 #endif  // XNN_ARCH_ARM64 && XNN_ENABLE_ASSEMBLY
 
 
 #if XNN_ARCH_ARM64 && XNN_ENABLE_ASSEMBLY
-  TEST(F16_GEMM_MINMAX_6X16__AARCH64_NEONFP16ARITH_LD32, k_eq_2) {
+  TEST(F16_GEMM_MINMAX_6X8__AARCH64_NEONFP16ARITH_LD64, k_eq_4) {
     TEST_REQUIRES_ARM_NEON_FP16_ARITH;
     GemmMicrokernelTester()
       .mr(6)
-      .nr(16)
+      .nr(8)
       .kr(1)
       .sr(1)
       .m(6)
-      .n(16)
-      .k(2)
-      .Test(xnn_f16_gemm_minmax_ukernel_6x16__aarch64_neonfp16arith_ld32, xnn_init_f16_scaleminmax_neon_params);
+      .n(8)
+      .k(4)
+      .Test(xnn_f16_gemm_minmax_ukernel_6x8__aarch64_neonfp16arith_ld64, xnn_init_f16_scaleminmax_neon_params);
   }
 
-  TEST(F16_GEMM_MINMAX_6X16__AARCH64_NEONFP16ARITH_LD32, strided_cn) {
+  TEST(F16_GEMM_MINMAX_6X8__AARCH64_NEONFP16ARITH_LD64, strided_cn) {
     TEST_REQUIRES_ARM_NEON_FP16_ARITH;
     GemmMicrokernelTester()
       .mr(6)
-      .nr(16)
+      .nr(8)
       .kr(1)
       .sr(1)
       .m(6)
-      .n(16)
-      .k(2)
-      .cn_stride(19)
-      .Test(xnn_f16_gemm_minmax_ukernel_6x16__aarch64_neonfp16arith_ld32, xnn_init_f16_scaleminmax_neon_params);
+      .n(8)
+      .k(4)
+      .cn_stride(11)
+      .Test(xnn_f16_gemm_minmax_ukernel_6x8__aarch64_neonfp16arith_ld64, xnn_init_f16_scaleminmax_neon_params);
   }
 
-  TEST(F16_GEMM_MINMAX_6X16__AARCH64_NEONFP16ARITH_LD32, k_eq_2_strided_a) {
+  TEST(F16_GEMM_MINMAX_6X8__AARCH64_NEONFP16ARITH_LD64, k_eq_4_strided_a) {
     TEST_REQUIRES_ARM_NEON_FP16_ARITH;
     GemmMicrokernelTester()
       .mr(6)
-      .nr(16)
+      .nr(8)
       .kr(1)
       .sr(1)
       .m(6)
-      .n(16)
-      .k(2)
-      .a_stride(5)
-      .Test(xnn_f16_gemm_minmax_ukernel_6x16__aarch64_neonfp16arith_ld32, xnn_init_f16_scaleminmax_neon_params);
+      .n(8)
+      .k(4)
+      .a_stride(7)
+      .Test(xnn_f16_gemm_minmax_ukernel_6x8__aarch64_neonfp16arith_ld64, xnn_init_f16_scaleminmax_neon_params);
   }
 
-  TEST(F16_GEMM_MINMAX_6X16__AARCH64_NEONFP16ARITH_LD32, k_eq_2_subtile) {
+  TEST(F16_GEMM_MINMAX_6X8__AARCH64_NEONFP16ARITH_LD64, k_eq_4_subtile) {
     TEST_REQUIRES_ARM_NEON_FP16_ARITH;
-    for (uint32_t n = 1; n <= 16; n++) {
+    for (uint32_t n = 1; n <= 8; n++) {
       for (uint32_t m = 1; m <= 6; m++) {
         GemmMicrokernelTester()
           .mr(6)
-          .nr(16)
+          .nr(8)
           .kr(1)
           .sr(1)
           .m(m)
           .n(n)
-          .k(2)
+          .k(4)
           .iterations(1)
-          .Test(xnn_f16_gemm_minmax_ukernel_6x16__aarch64_neonfp16arith_ld32, xnn_init_f16_scaleminmax_neon_params);
+          .Test(xnn_f16_gemm_minmax_ukernel_6x8__aarch64_neonfp16arith_ld64, xnn_init_f16_scaleminmax_neon_params);
       }
     }
   }
 
-  TEST(F16_GEMM_MINMAX_6X16__AARCH64_NEONFP16ARITH_LD32, k_eq_2_subtile_m) {
+  TEST(F16_GEMM_MINMAX_6X8__AARCH64_NEONFP16ARITH_LD64, k_eq_4_subtile_m) {
     TEST_REQUIRES_ARM_NEON_FP16_ARITH;
     for (uint32_t m = 1; m <= 6; m++) {
       GemmMicrokernelTester()
         .mr(6)
-        .nr(16)
+        .nr(8)
         .kr(1)
         .sr(1)
         .m(m)
-        .n(16)
-        .k(2)
+        .n(8)
+        .k(4)
         .iterations(1)
-        .Test(xnn_f16_gemm_minmax_ukernel_6x16__aarch64_neonfp16arith_ld32, xnn_init_f16_scaleminmax_neon_params);
+        .Test(xnn_f16_gemm_minmax_ukernel_6x8__aarch64_neonfp16arith_ld64, xnn_init_f16_scaleminmax_neon_params);
     }
   }
 
-  TEST(F16_GEMM_MINMAX_6X16__AARCH64_NEONFP16ARITH_LD32, k_eq_2_subtile_n) {
+  TEST(F16_GEMM_MINMAX_6X8__AARCH64_NEONFP16ARITH_LD64, k_eq_4_subtile_n) {
     TEST_REQUIRES_ARM_NEON_FP16_ARITH;
-    for (uint32_t n = 1; n <= 16; n++) {
+    for (uint32_t n = 1; n <= 8; n++) {
       GemmMicrokernelTester()
         .mr(6)
-        .nr(16)
+        .nr(8)
         .kr(1)
         .sr(1)
         .m(6)
         .n(n)
-        .k(2)
+        .k(4)
         .iterations(1)
-        .Test(xnn_f16_gemm_minmax_ukernel_6x16__aarch64_neonfp16arith_ld32, xnn_init_f16_scaleminmax_neon_params);
+        .Test(xnn_f16_gemm_minmax_ukernel_6x8__aarch64_neonfp16arith_ld64, xnn_init_f16_scaleminmax_neon_params);
     }
   }
 
-  TEST(F16_GEMM_MINMAX_6X16__AARCH64_NEONFP16ARITH_LD32, k_lt_2) {
+  TEST(F16_GEMM_MINMAX_6X8__AARCH64_NEONFP16ARITH_LD64, k_lt_4) {
     TEST_REQUIRES_ARM_NEON_FP16_ARITH;
-    for (size_t k = 1; k < 2; k++) {
+    for (size_t k = 1; k < 4; k++) {
       GemmMicrokernelTester()
         .mr(6)
-        .nr(16)
+        .nr(8)
         .kr(1)
         .sr(1)
         .m(6)
-        .n(16)
+        .n(8)
         .k(k)
-        .Test(xnn_f16_gemm_minmax_ukernel_6x16__aarch64_neonfp16arith_ld32, xnn_init_f16_scaleminmax_neon_params);
+        .Test(xnn_f16_gemm_minmax_ukernel_6x8__aarch64_neonfp16arith_ld64, xnn_init_f16_scaleminmax_neon_params);
     }
   }
 
-  TEST(F16_GEMM_MINMAX_6X16__AARCH64_NEONFP16ARITH_LD32, k_lt_2_strided_a) {
+  TEST(F16_GEMM_MINMAX_6X8__AARCH64_NEONFP16ARITH_LD64, k_lt_4_strided_a) {
     TEST_REQUIRES_ARM_NEON_FP16_ARITH;
-    for (size_t k = 1; k < 2; k++) {
+    for (size_t k = 1; k < 4; k++) {
       GemmMicrokernelTester()
         .mr(6)
-        .nr(16)
+        .nr(8)
         .kr(1)
         .sr(1)
         .m(6)
-        .n(16)
+        .n(8)
         .k(k)
-        .a_stride(5)
-        .Test(xnn_f16_gemm_minmax_ukernel_6x16__aarch64_neonfp16arith_ld32, xnn_init_f16_scaleminmax_neon_params);
+        .a_stride(7)
+        .Test(xnn_f16_gemm_minmax_ukernel_6x8__aarch64_neonfp16arith_ld64, xnn_init_f16_scaleminmax_neon_params);
     }
   }
 
-  TEST(F16_GEMM_MINMAX_6X16__AARCH64_NEONFP16ARITH_LD32, k_lt_2_subtile) {
+  TEST(F16_GEMM_MINMAX_6X8__AARCH64_NEONFP16ARITH_LD64, k_lt_4_subtile) {
     TEST_REQUIRES_ARM_NEON_FP16_ARITH;
-    for (size_t k = 1; k < 2; k++) {
-      for (uint32_t n = 1; n <= 16; n++) {
+    for (size_t k = 1; k < 4; k++) {
+      for (uint32_t n = 1; n <= 8; n++) {
         for (uint32_t m = 1; m <= 6; m++) {
           GemmMicrokernelTester()
             .mr(6)
-            .nr(16)
+            .nr(8)
             .kr(1)
             .sr(1)
             .m(m)
             .n(n)
             .k(k)
             .iterations(1)
-            .Test(xnn_f16_gemm_minmax_ukernel_6x16__aarch64_neonfp16arith_ld32, xnn_init_f16_scaleminmax_neon_params);
+            .Test(xnn_f16_gemm_minmax_ukernel_6x8__aarch64_neonfp16arith_ld64, xnn_init_f16_scaleminmax_neon_params);
         }
       }
     }
   }
 
-  TEST(F16_GEMM_MINMAX_6X16__AARCH64_NEONFP16ARITH_LD32, k_gt_2) {
+  TEST(F16_GEMM_MINMAX_6X8__AARCH64_NEONFP16ARITH_LD64, k_gt_4) {
     TEST_REQUIRES_ARM_NEON_FP16_ARITH;
-    for (size_t k = 3; k < 4; k++) {
+    for (size_t k = 5; k < 8; k++) {
       GemmMicrokernelTester()
         .mr(6)
-        .nr(16)
+        .nr(8)
         .kr(1)
         .sr(1)
         .m(6)
-        .n(16)
+        .n(8)
         .k(k)
-        .Test(xnn_f16_gemm_minmax_ukernel_6x16__aarch64_neonfp16arith_ld32, xnn_init_f16_scaleminmax_neon_params);
+        .Test(xnn_f16_gemm_minmax_ukernel_6x8__aarch64_neonfp16arith_ld64, xnn_init_f16_scaleminmax_neon_params);
     }
   }
 
-  TEST(F16_GEMM_MINMAX_6X16__AARCH64_NEONFP16ARITH_LD32, k_gt_2_strided_a) {
+  TEST(F16_GEMM_MINMAX_6X8__AARCH64_NEONFP16ARITH_LD64, k_gt_4_strided_a) {
     TEST_REQUIRES_ARM_NEON_FP16_ARITH;
-    for (size_t k = 3; k < 4; k++) {
+    for (size_t k = 5; k < 8; k++) {
       GemmMicrokernelTester()
         .mr(6)
-        .nr(16)
+        .nr(8)
         .kr(1)
         .sr(1)
         .m(6)
-        .n(16)
+        .n(8)
         .k(k)
-        .a_stride(7)
-        .Test(xnn_f16_gemm_minmax_ukernel_6x16__aarch64_neonfp16arith_ld32, xnn_init_f16_scaleminmax_neon_params);
+        .a_stride(11)
+        .Test(xnn_f16_gemm_minmax_ukernel_6x8__aarch64_neonfp16arith_ld64, xnn_init_f16_scaleminmax_neon_params);
     }
   }
 
-  TEST(F16_GEMM_MINMAX_6X16__AARCH64_NEONFP16ARITH_LD32, k_gt_2_subtile) {
+  TEST(F16_GEMM_MINMAX_6X8__AARCH64_NEONFP16ARITH_LD64, k_gt_4_subtile) {
     TEST_REQUIRES_ARM_NEON_FP16_ARITH;
-    for (size_t k = 3; k < 4; k++) {
-      for (uint32_t n = 1; n <= 16; n++) {
+    for (size_t k = 5; k < 8; k++) {
+      for (uint32_t n = 1; n <= 8; n++) {
         for (uint32_t m = 1; m <= 6; m++) {
           GemmMicrokernelTester()
             .mr(6)
-            .nr(16)
+            .nr(8)
             .kr(1)
             .sr(1)
             .m(m)
             .n(n)
             .k(k)
             .iterations(1)
-            .Test(xnn_f16_gemm_minmax_ukernel_6x16__aarch64_neonfp16arith_ld32, xnn_init_f16_scaleminmax_neon_params);
+            .Test(xnn_f16_gemm_minmax_ukernel_6x8__aarch64_neonfp16arith_ld64, xnn_init_f16_scaleminmax_neon_params);
         }
       }
     }
   }
 
-  TEST(F16_GEMM_MINMAX_6X16__AARCH64_NEONFP16ARITH_LD32, k_div_2) {
+  TEST(F16_GEMM_MINMAX_6X8__AARCH64_NEONFP16ARITH_LD64, k_div_4) {
     TEST_REQUIRES_ARM_NEON_FP16_ARITH;
-    for (size_t k = 4; k <= 20; k += 2) {
+    for (size_t k = 8; k <= 40; k += 4) {
       GemmMicrokernelTester()
         .mr(6)
-        .nr(16)
+        .nr(8)
         .kr(1)
         .sr(1)
         .m(6)
-        .n(16)
+        .n(8)
         .k(k)
-        .Test(xnn_f16_gemm_minmax_ukernel_6x16__aarch64_neonfp16arith_ld32, xnn_init_f16_scaleminmax_neon_params);
+        .Test(xnn_f16_gemm_minmax_ukernel_6x8__aarch64_neonfp16arith_ld64, xnn_init_f16_scaleminmax_neon_params);
     }
   }
 
-  TEST(F16_GEMM_MINMAX_6X16__AARCH64_NEONFP16ARITH_LD32, k_div_2_strided_a) {
+  TEST(F16_GEMM_MINMAX_6X8__AARCH64_NEONFP16ARITH_LD64, k_div_4_strided_a) {
     TEST_REQUIRES_ARM_NEON_FP16_ARITH;
-    for (size_t k = 4; k <= 20; k += 2) {
+    for (size_t k = 8; k <= 40; k += 4) {
       GemmMicrokernelTester()
         .mr(6)
-        .nr(16)
+        .nr(8)
         .kr(1)
         .sr(1)
         .m(6)
-        .n(16)
+        .n(8)
         .k(k)
-        .a_stride(23)
-        .Test(xnn_f16_gemm_minmax_ukernel_6x16__aarch64_neonfp16arith_ld32, xnn_init_f16_scaleminmax_neon_params);
+        .a_stride(43)
+        .Test(xnn_f16_gemm_minmax_ukernel_6x8__aarch64_neonfp16arith_ld64, xnn_init_f16_scaleminmax_neon_params);
     }
   }
 
-  TEST(F16_GEMM_MINMAX_6X16__AARCH64_NEONFP16ARITH_LD32, k_div_2_subtile) {
+  TEST(F16_GEMM_MINMAX_6X8__AARCH64_NEONFP16ARITH_LD64, k_div_4_subtile) {
     TEST_REQUIRES_ARM_NEON_FP16_ARITH;
-    for (size_t k = 4; k <= 20; k += 2) {
-      for (uint32_t n = 1; n <= 16; n++) {
+    for (size_t k = 8; k <= 40; k += 4) {
+      for (uint32_t n = 1; n <= 8; n++) {
         for (uint32_t m = 1; m <= 6; m++) {
           GemmMicrokernelTester()
             .mr(6)
-            .nr(16)
+            .nr(8)
             .kr(1)
             .sr(1)
             .m(m)
             .n(n)
             .k(k)
             .iterations(1)
-            .Test(xnn_f16_gemm_minmax_ukernel_6x16__aarch64_neonfp16arith_ld32, xnn_init_f16_scaleminmax_neon_params);
+            .Test(xnn_f16_gemm_minmax_ukernel_6x8__aarch64_neonfp16arith_ld64, xnn_init_f16_scaleminmax_neon_params);
         }
       }
     }
   }
 
-  TEST(F16_GEMM_MINMAX_6X16__AARCH64_NEONFP16ARITH_LD32, n_gt_16) {
+  TEST(F16_GEMM_MINMAX_6X8__AARCH64_NEONFP16ARITH_LD64, n_gt_8) {
     TEST_REQUIRES_ARM_NEON_FP16_ARITH;
-    for (uint32_t n = 17; n < 32; n++) {
-      for (size_t k = 1; k <= 10; k += 3) {
+    for (uint32_t n = 9; n < 16; n++) {
+      for (size_t k = 1; k <= 20; k += 5) {
         GemmMicrokernelTester()
           .mr(6)
-          .nr(16)
+          .nr(8)
           .kr(1)
           .sr(1)
           .m(6)
           .n(n)
           .k(k)
-          .Test(xnn_f16_gemm_minmax_ukernel_6x16__aarch64_neonfp16arith_ld32, xnn_init_f16_scaleminmax_neon_params);
+          .Test(xnn_f16_gemm_minmax_ukernel_6x8__aarch64_neonfp16arith_ld64, xnn_init_f16_scaleminmax_neon_params);
       }
     }
   }
 
-  TEST(F16_GEMM_MINMAX_6X16__AARCH64_NEONFP16ARITH_LD32, n_gt_16_strided_cn) {
+  TEST(F16_GEMM_MINMAX_6X8__AARCH64_NEONFP16ARITH_LD64, n_gt_8_strided_cn) {
     TEST_REQUIRES_ARM_NEON_FP16_ARITH;
-    for (uint32_t n = 17; n < 32; n++) {
-      for (size_t k = 1; k <= 10; k += 3) {
+    for (uint32_t n = 9; n < 16; n++) {
+      for (size_t k = 1; k <= 20; k += 5) {
         GemmMicrokernelTester()
           .mr(6)
-          .nr(16)
+          .nr(8)
           .kr(1)
           .sr(1)
           .m(6)
           .n(n)
           .k(k)
-          .cn_stride(19)
-          .Test(xnn_f16_gemm_minmax_ukernel_6x16__aarch64_neonfp16arith_ld32, xnn_init_f16_scaleminmax_neon_params);
+          .cn_stride(11)
+          .Test(xnn_f16_gemm_minmax_ukernel_6x8__aarch64_neonfp16arith_ld64, xnn_init_f16_scaleminmax_neon_params);
       }
     }
   }
 
-  TEST(F16_GEMM_MINMAX_6X16__AARCH64_NEONFP16ARITH_LD32, n_gt_16_strided_a) {
+  TEST(F16_GEMM_MINMAX_6X8__AARCH64_NEONFP16ARITH_LD64, n_gt_8_strided_a) {
     TEST_REQUIRES_ARM_NEON_FP16_ARITH;
-    for (uint32_t n = 17; n < 32; n++) {
-      for (size_t k = 1; k <= 10; k += 3) {
+    for (uint32_t n = 9; n < 16; n++) {
+      for (size_t k = 1; k <= 20; k += 5) {
         GemmMicrokernelTester()
           .mr(6)
-          .nr(16)
+          .nr(8)
           .kr(1)
           .sr(1)
           .m(6)
           .n(n)
           .k(k)
-          .a_stride(13)
-          .Test(xnn_f16_gemm_minmax_ukernel_6x16__aarch64_neonfp16arith_ld32, xnn_init_f16_scaleminmax_neon_params);
+          .a_stride(23)
+          .Test(xnn_f16_gemm_minmax_ukernel_6x8__aarch64_neonfp16arith_ld64, xnn_init_f16_scaleminmax_neon_params);
       }
     }
   }
 
-  TEST(F16_GEMM_MINMAX_6X16__AARCH64_NEONFP16ARITH_LD32, n_gt_16_subtile) {
+  TEST(F16_GEMM_MINMAX_6X8__AARCH64_NEONFP16ARITH_LD64, n_gt_8_subtile) {
     TEST_REQUIRES_ARM_NEON_FP16_ARITH;
-    for (uint32_t n = 17; n < 32; n++) {
-      for (size_t k = 1; k <= 10; k += 3) {
+    for (uint32_t n = 9; n < 16; n++) {
+      for (size_t k = 1; k <= 20; k += 5) {
         for (uint32_t m = 1; m <= 6; m++) {
           GemmMicrokernelTester()
             .mr(6)
-            .nr(16)
+            .nr(8)
             .kr(1)
             .sr(1)
             .m(m)
             .n(n)
             .k(k)
             .iterations(1)
-            .Test(xnn_f16_gemm_minmax_ukernel_6x16__aarch64_neonfp16arith_ld32, xnn_init_f16_scaleminmax_neon_params);
+            .Test(xnn_f16_gemm_minmax_ukernel_6x8__aarch64_neonfp16arith_ld64, xnn_init_f16_scaleminmax_neon_params);
         }
       }
     }
   }
 
-  TEST(F16_GEMM_MINMAX_6X16__AARCH64_NEONFP16ARITH_LD32, n_div_16) {
+  TEST(F16_GEMM_MINMAX_6X8__AARCH64_NEONFP16ARITH_LD64, n_div_8) {
     TEST_REQUIRES_ARM_NEON_FP16_ARITH;
-    for (uint32_t n = 32; n <= 48; n += 16) {
-      for (size_t k = 1; k <= 10; k += 3) {
+    for (uint32_t n = 16; n <= 24; n += 8) {
+      for (size_t k = 1; k <= 20; k += 5) {
         GemmMicrokernelTester()
           .mr(6)
-          .nr(16)
+          .nr(8)
           .kr(1)
           .sr(1)
           .m(6)
           .n(n)
           .k(k)
-          .Test(xnn_f16_gemm_minmax_ukernel_6x16__aarch64_neonfp16arith_ld32, xnn_init_f16_scaleminmax_neon_params);
+          .Test(xnn_f16_gemm_minmax_ukernel_6x8__aarch64_neonfp16arith_ld64, xnn_init_f16_scaleminmax_neon_params);
       }
     }
   }
 
-  TEST(F16_GEMM_MINMAX_6X16__AARCH64_NEONFP16ARITH_LD32, n_div_16_strided_cn) {
+  TEST(F16_GEMM_MINMAX_6X8__AARCH64_NEONFP16ARITH_LD64, n_div_8_strided_cn) {
     TEST_REQUIRES_ARM_NEON_FP16_ARITH;
-    for (uint32_t n = 32; n <= 48; n += 16) {
-      for (size_t k = 1; k <= 10; k += 3) {
+    for (uint32_t n = 16; n <= 24; n += 8) {
+      for (size_t k = 1; k <= 20; k += 5) {
         GemmMicrokernelTester()
           .mr(6)
-          .nr(16)
+          .nr(8)
           .kr(1)
           .sr(1)
           .m(6)
           .n(n)
           .k(k)
-          .cn_stride(19)
-          .Test(xnn_f16_gemm_minmax_ukernel_6x16__aarch64_neonfp16arith_ld32, xnn_init_f16_scaleminmax_neon_params);
+          .cn_stride(11)
+          .Test(xnn_f16_gemm_minmax_ukernel_6x8__aarch64_neonfp16arith_ld64, xnn_init_f16_scaleminmax_neon_params);
       }
     }
   }
 
-  TEST(F16_GEMM_MINMAX_6X16__AARCH64_NEONFP16ARITH_LD32, n_div_16_strided_a) {
+  TEST(F16_GEMM_MINMAX_6X8__AARCH64_NEONFP16ARITH_LD64, n_div_8_strided_a) {
     TEST_REQUIRES_ARM_NEON_FP16_ARITH;
-    for (uint32_t n = 32; n <= 48; n += 16) {
-      for (size_t k = 1; k <= 10; k += 3) {
+    for (uint32_t n = 16; n <= 24; n += 8) {
+      for (size_t k = 1; k <= 20; k += 5) {
         GemmMicrokernelTester()
           .mr(6)
-          .nr(16)
+          .nr(8)
           .kr(1)
           .sr(1)
           .m(6)
           .n(n)
           .k(k)
-          .a_stride(13)
-          .Test(xnn_f16_gemm_minmax_ukernel_6x16__aarch64_neonfp16arith_ld32, xnn_init_f16_scaleminmax_neon_params);
+          .a_stride(23)
+          .Test(xnn_f16_gemm_minmax_ukernel_6x8__aarch64_neonfp16arith_ld64, xnn_init_f16_scaleminmax_neon_params);
       }
     }
   }
 
-  TEST(F16_GEMM_MINMAX_6X16__AARCH64_NEONFP16ARITH_LD32, n_div_16_subtile) {
+  TEST(F16_GEMM_MINMAX_6X8__AARCH64_NEONFP16ARITH_LD64, n_div_8_subtile) {
     TEST_REQUIRES_ARM_NEON_FP16_ARITH;
-    for (uint32_t n = 32; n <= 48; n += 16) {
-      for (size_t k = 1; k <= 10; k += 3) {
+    for (uint32_t n = 16; n <= 24; n += 8) {
+      for (size_t k = 1; k <= 20; k += 5) {
         for (uint32_t m = 1; m <= 6; m++) {
           GemmMicrokernelTester()
             .mr(6)
-            .nr(16)
+            .nr(8)
             .kr(1)
             .sr(1)
             .m(m)
             .n(n)
             .k(k)
             .iterations(1)
-            .Test(xnn_f16_gemm_minmax_ukernel_6x16__aarch64_neonfp16arith_ld32, xnn_init_f16_scaleminmax_neon_params);
+            .Test(xnn_f16_gemm_minmax_ukernel_6x8__aarch64_neonfp16arith_ld64, xnn_init_f16_scaleminmax_neon_params);
         }
       }
     }
   }
 
-  TEST(F16_GEMM_MINMAX_6X16__AARCH64_NEONFP16ARITH_LD32, strided_cm_subtile) {
+  TEST(F16_GEMM_MINMAX_6X8__AARCH64_NEONFP16ARITH_LD64, strided_cm_subtile) {
     TEST_REQUIRES_ARM_NEON_FP16_ARITH;
-    for (size_t k = 1; k <= 10; k += 3) {
-      for (uint32_t n = 1; n <= 16; n++) {
+    for (size_t k = 1; k <= 20; k += 5) {
+      for (uint32_t n = 1; n <= 8; n++) {
         for (uint32_t m = 1; m <= 6; m++) {
           GemmMicrokernelTester()
             .mr(6)
-            .nr(16)
+            .nr(8)
             .kr(1)
             .sr(1)
             .m(m)
             .n(n)
             .k(k)
-            .cm_stride(19)
+            .cm_stride(11)
             .iterations(1)
-            .Test(xnn_f16_gemm_minmax_ukernel_6x16__aarch64_neonfp16arith_ld32, xnn_init_f16_scaleminmax_neon_params);
+            .Test(xnn_f16_gemm_minmax_ukernel_6x8__aarch64_neonfp16arith_ld64, xnn_init_f16_scaleminmax_neon_params);
         }
       }
     }
   }
 
-  TEST(F16_GEMM_MINMAX_6X16__AARCH64_NEONFP16ARITH_LD32, qmin) {
+  TEST(F16_GEMM_MINMAX_6X8__AARCH64_NEONFP16ARITH_LD64, qmin) {
     TEST_REQUIRES_ARM_NEON_FP16_ARITH;
     GemmMicrokernelTester()
       .mr(6)
-      .nr(16)
+      .nr(8)
       .kr(1)
       .sr(1)
       .m(6)
-      .n(16)
-      .k(2)
+      .n(8)
+      .k(4)
       .qmin(128)
-      .Test(xnn_f16_gemm_minmax_ukernel_6x16__aarch64_neonfp16arith_ld32, xnn_init_f16_scaleminmax_neon_params);
+      .Test(xnn_f16_gemm_minmax_ukernel_6x8__aarch64_neonfp16arith_ld64, xnn_init_f16_scaleminmax_neon_params);
   }
 
-  TEST(F16_GEMM_MINMAX_6X16__AARCH64_NEONFP16ARITH_LD32, qmax) {
+  TEST(F16_GEMM_MINMAX_6X8__AARCH64_NEONFP16ARITH_LD64, qmax) {
     TEST_REQUIRES_ARM_NEON_FP16_ARITH;
     GemmMicrokernelTester()
       .mr(6)
-      .nr(16)
+      .nr(8)
       .kr(1)
       .sr(1)
       .m(6)
-      .n(16)
-      .k(2)
+      .n(8)
+      .k(4)
       .qmax(128)
-      .Test(xnn_f16_gemm_minmax_ukernel_6x16__aarch64_neonfp16arith_ld32, xnn_init_f16_scaleminmax_neon_params);
+      .Test(xnn_f16_gemm_minmax_ukernel_6x8__aarch64_neonfp16arith_ld64, xnn_init_f16_scaleminmax_neon_params);
   }
 
-  TEST(F16_GEMM_MINMAX_6X16__AARCH64_NEONFP16ARITH_LD32, strided_cm) {
+  TEST(F16_GEMM_MINMAX_6X8__AARCH64_NEONFP16ARITH_LD64, strided_cm) {
     TEST_REQUIRES_ARM_NEON_FP16_ARITH;
     GemmMicrokernelTester()
       .mr(6)
-      .nr(16)
+      .nr(8)
       .kr(1)
       .sr(1)
       .m(6)
-      .n(16)
-      .k(2)
-      .cm_stride(19)
-      .Test(xnn_f16_gemm_minmax_ukernel_6x16__aarch64_neonfp16arith_ld32, xnn_init_f16_scaleminmax_neon_params);
+      .n(8)
+      .k(4)
+      .cm_stride(11)
+      .Test(xnn_f16_gemm_minmax_ukernel_6x8__aarch64_neonfp16arith_ld64, xnn_init_f16_scaleminmax_neon_params);
   }
 #endif  // XNN_ARCH_ARM64 && XNN_ENABLE_ASSEMBLY
 
 
 #if XNN_ARCH_ARM64 && XNN_ENABLE_ASSEMBLY
-  TEST(F16_GEMM_MINMAX_8X8__AARCH64_NEONFP16ARITH_LD64, k_eq_4) {
+  TEST(F16_GEMM_MINMAX_6X16__AARCH64_NEONFP16ARITH_LD32, k_eq_2) {
     TEST_REQUIRES_ARM_NEON_FP16_ARITH;
     GemmMicrokernelTester()
-      .mr(8)
-      .nr(8)
+      .mr(6)
+      .nr(16)
       .kr(1)
       .sr(1)
-      .m(8)
-      .n(8)
-      .k(4)
-      .Test(xnn_f16_gemm_minmax_ukernel_8x8__aarch64_neonfp16arith_ld64, xnn_init_f16_scaleminmax_neon_params);
+      .m(6)
+      .n(16)
+      .k(2)
+      .Test(xnn_f16_gemm_minmax_ukernel_6x16__aarch64_neonfp16arith_ld32, xnn_init_f16_scaleminmax_neon_params);
   }
 
-  TEST(F16_GEMM_MINMAX_8X8__AARCH64_NEONFP16ARITH_LD64, strided_cn) {
+  TEST(F16_GEMM_MINMAX_6X16__AARCH64_NEONFP16ARITH_LD32, strided_cn) {
     TEST_REQUIRES_ARM_NEON_FP16_ARITH;
     GemmMicrokernelTester()
-      .mr(8)
-      .nr(8)
+      .mr(6)
+      .nr(16)
       .kr(1)
       .sr(1)
-      .m(8)
-      .n(8)
-      .k(4)
-      .cn_stride(11)
-      .Test(xnn_f16_gemm_minmax_ukernel_8x8__aarch64_neonfp16arith_ld64, xnn_init_f16_scaleminmax_neon_params);
+      .m(6)
+      .n(16)
+      .k(2)
+      .cn_stride(19)
+      .Test(xnn_f16_gemm_minmax_ukernel_6x16__aarch64_neonfp16arith_ld32, xnn_init_f16_scaleminmax_neon_params);
   }
 
-  TEST(F16_GEMM_MINMAX_8X8__AARCH64_NEONFP16ARITH_LD64, k_eq_4_strided_a) {
+  TEST(F16_GEMM_MINMAX_6X16__AARCH64_NEONFP16ARITH_LD32, k_eq_2_strided_a) {
     TEST_REQUIRES_ARM_NEON_FP16_ARITH;
     GemmMicrokernelTester()
-      .mr(8)
-      .nr(8)
+      .mr(6)
+      .nr(16)
       .kr(1)
       .sr(1)
-      .m(8)
-      .n(8)
-      .k(4)
-      .a_stride(7)
-      .Test(xnn_f16_gemm_minmax_ukernel_8x8__aarch64_neonfp16arith_ld64, xnn_init_f16_scaleminmax_neon_params);
+      .m(6)
+      .n(16)
+      .k(2)
+      .a_stride(5)
+      .Test(xnn_f16_gemm_minmax_ukernel_6x16__aarch64_neonfp16arith_ld32, xnn_init_f16_scaleminmax_neon_params);
   }
 
-  TEST(F16_GEMM_MINMAX_8X8__AARCH64_NEONFP16ARITH_LD64, k_eq_4_subtile) {
+  TEST(F16_GEMM_MINMAX_6X16__AARCH64_NEONFP16ARITH_LD32, k_eq_2_subtile) {
     TEST_REQUIRES_ARM_NEON_FP16_ARITH;
-    for (uint32_t n = 1; n <= 8; n++) {
-      for (uint32_t m = 1; m <= 8; m++) {
+    for (uint32_t n = 1; n <= 16; n++) {
+      for (uint32_t m = 1; m <= 6; m++) {
         GemmMicrokernelTester()
-          .mr(8)
-          .nr(8)
+          .mr(6)
+          .nr(16)
           .kr(1)
           .sr(1)
           .m(m)
           .n(n)
-          .k(4)
+          .k(2)
           .iterations(1)
-          .Test(xnn_f16_gemm_minmax_ukernel_8x8__aarch64_neonfp16arith_ld64, xnn_init_f16_scaleminmax_neon_params);
+          .Test(xnn_f16_gemm_minmax_ukernel_6x16__aarch64_neonfp16arith_ld32, xnn_init_f16_scaleminmax_neon_params);
       }
     }
   }
 
-  TEST(F16_GEMM_MINMAX_8X8__AARCH64_NEONFP16ARITH_LD64, k_eq_4_subtile_m) {
+  TEST(F16_GEMM_MINMAX_6X16__AARCH64_NEONFP16ARITH_LD32, k_eq_2_subtile_m) {
     TEST_REQUIRES_ARM_NEON_FP16_ARITH;
-    for (uint32_t m = 1; m <= 8; m++) {
+    for (uint32_t m = 1; m <= 6; m++) {
       GemmMicrokernelTester()
-        .mr(8)
-        .nr(8)
+        .mr(6)
+        .nr(16)
         .kr(1)
         .sr(1)
         .m(m)
-        .n(8)
-        .k(4)
+        .n(16)
+        .k(2)
         .iterations(1)
-        .Test(xnn_f16_gemm_minmax_ukernel_8x8__aarch64_neonfp16arith_ld64, xnn_init_f16_scaleminmax_neon_params);
+        .Test(xnn_f16_gemm_minmax_ukernel_6x16__aarch64_neonfp16arith_ld32, xnn_init_f16_scaleminmax_neon_params);
     }
   }
 
-  TEST(F16_GEMM_MINMAX_8X8__AARCH64_NEONFP16ARITH_LD64, k_eq_4_subtile_n) {
+  TEST(F16_GEMM_MINMAX_6X16__AARCH64_NEONFP16ARITH_LD32, k_eq_2_subtile_n) {
     TEST_REQUIRES_ARM_NEON_FP16_ARITH;
-    for (uint32_t n = 1; n <= 8; n++) {
+    for (uint32_t n = 1; n <= 16; n++) {
       GemmMicrokernelTester()
-        .mr(8)
-        .nr(8)
+        .mr(6)
+        .nr(16)
         .kr(1)
         .sr(1)
-        .m(8)
+        .m(6)
         .n(n)
-        .k(4)
+        .k(2)
         .iterations(1)
-        .Test(xnn_f16_gemm_minmax_ukernel_8x8__aarch64_neonfp16arith_ld64, xnn_init_f16_scaleminmax_neon_params);
+        .Test(xnn_f16_gemm_minmax_ukernel_6x16__aarch64_neonfp16arith_ld32, xnn_init_f16_scaleminmax_neon_params);
     }
   }
 
-  TEST(F16_GEMM_MINMAX_8X8__AARCH64_NEONFP16ARITH_LD64, k_lt_4) {
+  TEST(F16_GEMM_MINMAX_6X16__AARCH64_NEONFP16ARITH_LD32, k_lt_2) {
     TEST_REQUIRES_ARM_NEON_FP16_ARITH;
-    for (size_t k = 1; k < 4; k++) {
+    for (size_t k = 1; k < 2; k++) {
       GemmMicrokernelTester()
-        .mr(8)
-        .nr(8)
+        .mr(6)
+        .nr(16)
         .kr(1)
         .sr(1)
-        .m(8)
-        .n(8)
+        .m(6)
+        .n(16)
         .k(k)
-        .Test(xnn_f16_gemm_minmax_ukernel_8x8__aarch64_neonfp16arith_ld64, xnn_init_f16_scaleminmax_neon_params);
+        .Test(xnn_f16_gemm_minmax_ukernel_6x16__aarch64_neonfp16arith_ld32, xnn_init_f16_scaleminmax_neon_params);
     }
   }
 
-  TEST(F16_GEMM_MINMAX_8X8__AARCH64_NEONFP16ARITH_LD64, k_lt_4_strided_a) {
+  TEST(F16_GEMM_MINMAX_6X16__AARCH64_NEONFP16ARITH_LD32, k_lt_2_strided_a) {
     TEST_REQUIRES_ARM_NEON_FP16_ARITH;
-    for (size_t k = 1; k < 4; k++) {
+    for (size_t k = 1; k < 2; k++) {
       GemmMicrokernelTester()
-        .mr(8)
-        .nr(8)
+        .mr(6)
+        .nr(16)
         .kr(1)
         .sr(1)
-        .m(8)
-        .n(8)
+        .m(6)
+        .n(16)
         .k(k)
-        .a_stride(7)
-        .Test(xnn_f16_gemm_minmax_ukernel_8x8__aarch64_neonfp16arith_ld64, xnn_init_f16_scaleminmax_neon_params);
+        .a_stride(5)
+        .Test(xnn_f16_gemm_minmax_ukernel_6x16__aarch64_neonfp16arith_ld32, xnn_init_f16_scaleminmax_neon_params);
     }
   }
 
-  TEST(F16_GEMM_MINMAX_8X8__AARCH64_NEONFP16ARITH_LD64, k_lt_4_subtile) {
+  TEST(F16_GEMM_MINMAX_6X16__AARCH64_NEONFP16ARITH_LD32, k_lt_2_subtile) {
     TEST_REQUIRES_ARM_NEON_FP16_ARITH;
-    for (size_t k = 1; k < 4; k++) {
-      for (uint32_t n = 1; n <= 8; n++) {
-        for (uint32_t m = 1; m <= 8; m++) {
+    for (size_t k = 1; k < 2; k++) {
+      for (uint32_t n = 1; n <= 16; n++) {
+        for (uint32_t m = 1; m <= 6; m++) {
           GemmMicrokernelTester()
-            .mr(8)
-            .nr(8)
+            .mr(6)
+            .nr(16)
             .kr(1)
             .sr(1)
             .m(m)
             .n(n)
             .k(k)
             .iterations(1)
-            .Test(xnn_f16_gemm_minmax_ukernel_8x8__aarch64_neonfp16arith_ld64, xnn_init_f16_scaleminmax_neon_params);
+            .Test(xnn_f16_gemm_minmax_ukernel_6x16__aarch64_neonfp16arith_ld32, xnn_init_f16_scaleminmax_neon_params);
         }
       }
     }
   }
 
-  TEST(F16_GEMM_MINMAX_8X8__AARCH64_NEONFP16ARITH_LD64, k_gt_4) {
+  TEST(F16_GEMM_MINMAX_6X16__AARCH64_NEONFP16ARITH_LD32, k_gt_2) {
     TEST_REQUIRES_ARM_NEON_FP16_ARITH;
-    for (size_t k = 5; k < 8; k++) {
+    for (size_t k = 3; k < 4; k++) {
       GemmMicrokernelTester()
-        .mr(8)
-        .nr(8)
+        .mr(6)
+        .nr(16)
         .kr(1)
         .sr(1)
-        .m(8)
-        .n(8)
+        .m(6)
+        .n(16)
         .k(k)
-        .Test(xnn_f16_gemm_minmax_ukernel_8x8__aarch64_neonfp16arith_ld64, xnn_init_f16_scaleminmax_neon_params);
+        .Test(xnn_f16_gemm_minmax_ukernel_6x16__aarch64_neonfp16arith_ld32, xnn_init_f16_scaleminmax_neon_params);
     }
   }
 
-  TEST(F16_GEMM_MINMAX_8X8__AARCH64_NEONFP16ARITH_LD64, k_gt_4_strided_a) {
+  TEST(F16_GEMM_MINMAX_6X16__AARCH64_NEONFP16ARITH_LD32, k_gt_2_strided_a) {
     TEST_REQUIRES_ARM_NEON_FP16_ARITH;
-    for (size_t k = 5; k < 8; k++) {
+    for (size_t k = 3; k < 4; k++) {
       GemmMicrokernelTester()
-        .mr(8)
-        .nr(8)
+        .mr(6)
+        .nr(16)
         .kr(1)
         .sr(1)
-        .m(8)
-        .n(8)
+        .m(6)
+        .n(16)
         .k(k)
-        .a_stride(11)
-        .Test(xnn_f16_gemm_minmax_ukernel_8x8__aarch64_neonfp16arith_ld64, xnn_init_f16_scaleminmax_neon_params);
+        .a_stride(7)
+        .Test(xnn_f16_gemm_minmax_ukernel_6x16__aarch64_neonfp16arith_ld32, xnn_init_f16_scaleminmax_neon_params);
     }
   }
 
-  TEST(F16_GEMM_MINMAX_8X8__AARCH64_NEONFP16ARITH_LD64, k_gt_4_subtile) {
+  TEST(F16_GEMM_MINMAX_6X16__AARCH64_NEONFP16ARITH_LD32, k_gt_2_subtile) {
     TEST_REQUIRES_ARM_NEON_FP16_ARITH;
-    for (size_t k = 5; k < 8; k++) {
-      for (uint32_t n = 1; n <= 8; n++) {
-        for (uint32_t m = 1; m <= 8; m++) {
+    for (size_t k = 3; k < 4; k++) {
+      for (uint32_t n = 1; n <= 16; n++) {
+        for (uint32_t m = 1; m <= 6; m++) {
           GemmMicrokernelTester()
-            .mr(8)
-            .nr(8)
+            .mr(6)
+            .nr(16)
             .kr(1)
             .sr(1)
             .m(m)
             .n(n)
             .k(k)
             .iterations(1)
-            .Test(xnn_f16_gemm_minmax_ukernel_8x8__aarch64_neonfp16arith_ld64, xnn_init_f16_scaleminmax_neon_params);
+            .Test(xnn_f16_gemm_minmax_ukernel_6x16__aarch64_neonfp16arith_ld32, xnn_init_f16_scaleminmax_neon_params);
         }
       }
     }
   }
 
-  TEST(F16_GEMM_MINMAX_8X8__AARCH64_NEONFP16ARITH_LD64, k_div_4) {
+  TEST(F16_GEMM_MINMAX_6X16__AARCH64_NEONFP16ARITH_LD32, k_div_2) {
     TEST_REQUIRES_ARM_NEON_FP16_ARITH;
-    for (size_t k = 8; k <= 40; k += 4) {
+    for (size_t k = 4; k <= 20; k += 2) {
       GemmMicrokernelTester()
-        .mr(8)
-        .nr(8)
+        .mr(6)
+        .nr(16)
         .kr(1)
         .sr(1)
-        .m(8)
-        .n(8)
+        .m(6)
+        .n(16)
         .k(k)
-        .Test(xnn_f16_gemm_minmax_ukernel_8x8__aarch64_neonfp16arith_ld64, xnn_init_f16_scaleminmax_neon_params);
+        .Test(xnn_f16_gemm_minmax_ukernel_6x16__aarch64_neonfp16arith_ld32, xnn_init_f16_scaleminmax_neon_params);
     }
   }
 
-  TEST(F16_GEMM_MINMAX_8X8__AARCH64_NEONFP16ARITH_LD64, k_div_4_strided_a) {
+  TEST(F16_GEMM_MINMAX_6X16__AARCH64_NEONFP16ARITH_LD32, k_div_2_strided_a) {
     TEST_REQUIRES_ARM_NEON_FP16_ARITH;
-    for (size_t k = 8; k <= 40; k += 4) {
+    for (size_t k = 4; k <= 20; k += 2) {
       GemmMicrokernelTester()
-        .mr(8)
-        .nr(8)
+        .mr(6)
+        .nr(16)
+        .kr(1)
+        .sr(1)
+        .m(6)
+        .n(16)
+        .k(k)
+        .a_stride(23)
+        .Test(xnn_f16_gemm_minmax_ukernel_6x16__aarch64_neonfp16arith_ld32, xnn_init_f16_scaleminmax_neon_params);
+    }
+  }
+
+  TEST(F16_GEMM_MINMAX_6X16__AARCH64_NEONFP16ARITH_LD32, k_div_2_subtile) {
+    TEST_REQUIRES_ARM_NEON_FP16_ARITH;
+    for (size_t k = 4; k <= 20; k += 2) {
+      for (uint32_t n = 1; n <= 16; n++) {
+        for (uint32_t m = 1; m <= 6; m++) {
+          GemmMicrokernelTester()
+            .mr(6)
+            .nr(16)
+            .kr(1)
+            .sr(1)
+            .m(m)
+            .n(n)
+            .k(k)
+            .iterations(1)
+            .Test(xnn_f16_gemm_minmax_ukernel_6x16__aarch64_neonfp16arith_ld32, xnn_init_f16_scaleminmax_neon_params);
+        }
+      }
+    }
+  }
+
+  TEST(F16_GEMM_MINMAX_6X16__AARCH64_NEONFP16ARITH_LD32, n_gt_16) {
+    TEST_REQUIRES_ARM_NEON_FP16_ARITH;
+    for (uint32_t n = 17; n < 32; n++) {
+      for (size_t k = 1; k <= 10; k += 3) {
+        GemmMicrokernelTester()
+          .mr(6)
+          .nr(16)
+          .kr(1)
+          .sr(1)
+          .m(6)
+          .n(n)
+          .k(k)
+          .Test(xnn_f16_gemm_minmax_ukernel_6x16__aarch64_neonfp16arith_ld32, xnn_init_f16_scaleminmax_neon_params);
+      }
+    }
+  }
+
+  TEST(F16_GEMM_MINMAX_6X16__AARCH64_NEONFP16ARITH_LD32, n_gt_16_strided_cn) {
+    TEST_REQUIRES_ARM_NEON_FP16_ARITH;
+    for (uint32_t n = 17; n < 32; n++) {
+      for (size_t k = 1; k <= 10; k += 3) {
+        GemmMicrokernelTester()
+          .mr(6)
+          .nr(16)
+          .kr(1)
+          .sr(1)
+          .m(6)
+          .n(n)
+          .k(k)
+          .cn_stride(19)
+          .Test(xnn_f16_gemm_minmax_ukernel_6x16__aarch64_neonfp16arith_ld32, xnn_init_f16_scaleminmax_neon_params);
+      }
+    }
+  }
+
+  TEST(F16_GEMM_MINMAX_6X16__AARCH64_NEONFP16ARITH_LD32, n_gt_16_strided_a) {
+    TEST_REQUIRES_ARM_NEON_FP16_ARITH;
+    for (uint32_t n = 17; n < 32; n++) {
+      for (size_t k = 1; k <= 10; k += 3) {
+        GemmMicrokernelTester()
+          .mr(6)
+          .nr(16)
+          .kr(1)
+          .sr(1)
+          .m(6)
+          .n(n)
+          .k(k)
+          .a_stride(13)
+          .Test(xnn_f16_gemm_minmax_ukernel_6x16__aarch64_neonfp16arith_ld32, xnn_init_f16_scaleminmax_neon_params);
+      }
+    }
+  }
+
+  TEST(F16_GEMM_MINMAX_6X16__AARCH64_NEONFP16ARITH_LD32, n_gt_16_subtile) {
+    TEST_REQUIRES_ARM_NEON_FP16_ARITH;
+    for (uint32_t n = 17; n < 32; n++) {
+      for (size_t k = 1; k <= 10; k += 3) {
+        for (uint32_t m = 1; m <= 6; m++) {
+          GemmMicrokernelTester()
+            .mr(6)
+            .nr(16)
+            .kr(1)
+            .sr(1)
+            .m(m)
+            .n(n)
+            .k(k)
+            .iterations(1)
+            .Test(xnn_f16_gemm_minmax_ukernel_6x16__aarch64_neonfp16arith_ld32, xnn_init_f16_scaleminmax_neon_params);
+        }
+      }
+    }
+  }
+
+  TEST(F16_GEMM_MINMAX_6X16__AARCH64_NEONFP16ARITH_LD32, n_div_16) {
+    TEST_REQUIRES_ARM_NEON_FP16_ARITH;
+    for (uint32_t n = 32; n <= 48; n += 16) {
+      for (size_t k = 1; k <= 10; k += 3) {
+        GemmMicrokernelTester()
+          .mr(6)
+          .nr(16)
+          .kr(1)
+          .sr(1)
+          .m(6)
+          .n(n)
+          .k(k)
+          .Test(xnn_f16_gemm_minmax_ukernel_6x16__aarch64_neonfp16arith_ld32, xnn_init_f16_scaleminmax_neon_params);
+      }
+    }
+  }
+
+  TEST(F16_GEMM_MINMAX_6X16__AARCH64_NEONFP16ARITH_LD32, n_div_16_strided_cn) {
+    TEST_REQUIRES_ARM_NEON_FP16_ARITH;
+    for (uint32_t n = 32; n <= 48; n += 16) {
+      for (size_t k = 1; k <= 10; k += 3) {
+        GemmMicrokernelTester()
+          .mr(6)
+          .nr(16)
+          .kr(1)
+          .sr(1)
+          .m(6)
+          .n(n)
+          .k(k)
+          .cn_stride(19)
+          .Test(xnn_f16_gemm_minmax_ukernel_6x16__aarch64_neonfp16arith_ld32, xnn_init_f16_scaleminmax_neon_params);
+      }
+    }
+  }
+
+  TEST(F16_GEMM_MINMAX_6X16__AARCH64_NEONFP16ARITH_LD32, n_div_16_strided_a) {
+    TEST_REQUIRES_ARM_NEON_FP16_ARITH;
+    for (uint32_t n = 32; n <= 48; n += 16) {
+      for (size_t k = 1; k <= 10; k += 3) {
+        GemmMicrokernelTester()
+          .mr(6)
+          .nr(16)
+          .kr(1)
+          .sr(1)
+          .m(6)
+          .n(n)
+          .k(k)
+          .a_stride(13)
+          .Test(xnn_f16_gemm_minmax_ukernel_6x16__aarch64_neonfp16arith_ld32, xnn_init_f16_scaleminmax_neon_params);
+      }
+    }
+  }
+
+  TEST(F16_GEMM_MINMAX_6X16__AARCH64_NEONFP16ARITH_LD32, n_div_16_subtile) {
+    TEST_REQUIRES_ARM_NEON_FP16_ARITH;
+    for (uint32_t n = 32; n <= 48; n += 16) {
+      for (size_t k = 1; k <= 10; k += 3) {
+        for (uint32_t m = 1; m <= 6; m++) {
+          GemmMicrokernelTester()
+            .mr(6)
+            .nr(16)
+            .kr(1)
+            .sr(1)
+            .m(m)
+            .n(n)
+            .k(k)
+            .iterations(1)
+            .Test(xnn_f16_gemm_minmax_ukernel_6x16__aarch64_neonfp16arith_ld32, xnn_init_f16_scaleminmax_neon_params);
+        }
+      }
+    }
+  }
+
+  TEST(F16_GEMM_MINMAX_6X16__AARCH64_NEONFP16ARITH_LD32, strided_cm_subtile) {
+    TEST_REQUIRES_ARM_NEON_FP16_ARITH;
+    for (size_t k = 1; k <= 10; k += 3) {
+      for (uint32_t n = 1; n <= 16; n++) {
+        for (uint32_t m = 1; m <= 6; m++) {
+          GemmMicrokernelTester()
+            .mr(6)
+            .nr(16)
+            .kr(1)
+            .sr(1)
+            .m(m)
+            .n(n)
+            .k(k)
+            .cm_stride(19)
+            .iterations(1)
+            .Test(xnn_f16_gemm_minmax_ukernel_6x16__aarch64_neonfp16arith_ld32, xnn_init_f16_scaleminmax_neon_params);
+        }
+      }
+    }
+  }
+
+  TEST(F16_GEMM_MINMAX_6X16__AARCH64_NEONFP16ARITH_LD32, qmin) {
+    TEST_REQUIRES_ARM_NEON_FP16_ARITH;
+    GemmMicrokernelTester()
+      .mr(6)
+      .nr(16)
+      .kr(1)
+      .sr(1)
+      .m(6)
+      .n(16)
+      .k(2)
+      .qmin(128)
+      .Test(xnn_f16_gemm_minmax_ukernel_6x16__aarch64_neonfp16arith_ld32, xnn_init_f16_scaleminmax_neon_params);
+  }
+
+  TEST(F16_GEMM_MINMAX_6X16__AARCH64_NEONFP16ARITH_LD32, qmax) {
+    TEST_REQUIRES_ARM_NEON_FP16_ARITH;
+    GemmMicrokernelTester()
+      .mr(6)
+      .nr(16)
+      .kr(1)
+      .sr(1)
+      .m(6)
+      .n(16)
+      .k(2)
+      .qmax(128)
+      .Test(xnn_f16_gemm_minmax_ukernel_6x16__aarch64_neonfp16arith_ld32, xnn_init_f16_scaleminmax_neon_params);
+  }
+
+  TEST(F16_GEMM_MINMAX_6X16__AARCH64_NEONFP16ARITH_LD32, strided_cm) {
+    TEST_REQUIRES_ARM_NEON_FP16_ARITH;
+    GemmMicrokernelTester()
+      .mr(6)
+      .nr(16)
+      .kr(1)
+      .sr(1)
+      .m(6)
+      .n(16)
+      .k(2)
+      .cm_stride(19)
+      .Test(xnn_f16_gemm_minmax_ukernel_6x16__aarch64_neonfp16arith_ld32, xnn_init_f16_scaleminmax_neon_params);
+  }
+#endif  // XNN_ARCH_ARM64 && XNN_ENABLE_ASSEMBLY
+
+
+#if XNN_ARCH_ARM64 && XNN_ENABLE_ASSEMBLY
+  TEST(F16_GEMM_MINMAX_8X8__AARCH64_NEONFP16ARITH_LD64, k_eq_4) {
+    TEST_REQUIRES_ARM_NEON_FP16_ARITH;
+    GemmMicrokernelTester()
+      .mr(8)
+      .nr(8)
+      .kr(1)
+      .sr(1)
+      .m(8)
+      .n(8)
+      .k(4)
+      .Test(xnn_f16_gemm_minmax_ukernel_8x8__aarch64_neonfp16arith_ld64, xnn_init_f16_scaleminmax_neon_params);
+  }
+
+  TEST(F16_GEMM_MINMAX_8X8__AARCH64_NEONFP16ARITH_LD64, strided_cn) {
+    TEST_REQUIRES_ARM_NEON_FP16_ARITH;
+    GemmMicrokernelTester()
+      .mr(8)
+      .nr(8)
+      .kr(1)
+      .sr(1)
+      .m(8)
+      .n(8)
+      .k(4)
+      .cn_stride(11)
+      .Test(xnn_f16_gemm_minmax_ukernel_8x8__aarch64_neonfp16arith_ld64, xnn_init_f16_scaleminmax_neon_params);
+  }
+
+  TEST(F16_GEMM_MINMAX_8X8__AARCH64_NEONFP16ARITH_LD64, k_eq_4_strided_a) {
+    TEST_REQUIRES_ARM_NEON_FP16_ARITH;
+    GemmMicrokernelTester()
+      .mr(8)
+      .nr(8)
+      .kr(1)
+      .sr(1)
+      .m(8)
+      .n(8)
+      .k(4)
+      .a_stride(7)
+      .Test(xnn_f16_gemm_minmax_ukernel_8x8__aarch64_neonfp16arith_ld64, xnn_init_f16_scaleminmax_neon_params);
+  }
+
+  TEST(F16_GEMM_MINMAX_8X8__AARCH64_NEONFP16ARITH_LD64, k_eq_4_subtile) {
+    TEST_REQUIRES_ARM_NEON_FP16_ARITH;
+    for (uint32_t n = 1; n <= 8; n++) {
+      for (uint32_t m = 1; m <= 8; m++) {
+        GemmMicrokernelTester()
+          .mr(8)
+          .nr(8)
+          .kr(1)
+          .sr(1)
+          .m(m)
+          .n(n)
+          .k(4)
+          .iterations(1)
+          .Test(xnn_f16_gemm_minmax_ukernel_8x8__aarch64_neonfp16arith_ld64, xnn_init_f16_scaleminmax_neon_params);
+      }
+    }
+  }
+
+  TEST(F16_GEMM_MINMAX_8X8__AARCH64_NEONFP16ARITH_LD64, k_eq_4_subtile_m) {
+    TEST_REQUIRES_ARM_NEON_FP16_ARITH;
+    for (uint32_t m = 1; m <= 8; m++) {
+      GemmMicrokernelTester()
+        .mr(8)
+        .nr(8)
+        .kr(1)
+        .sr(1)
+        .m(m)
+        .n(8)
+        .k(4)
+        .iterations(1)
+        .Test(xnn_f16_gemm_minmax_ukernel_8x8__aarch64_neonfp16arith_ld64, xnn_init_f16_scaleminmax_neon_params);
+    }
+  }
+
+  TEST(F16_GEMM_MINMAX_8X8__AARCH64_NEONFP16ARITH_LD64, k_eq_4_subtile_n) {
+    TEST_REQUIRES_ARM_NEON_FP16_ARITH;
+    for (uint32_t n = 1; n <= 8; n++) {
+      GemmMicrokernelTester()
+        .mr(8)
+        .nr(8)
+        .kr(1)
+        .sr(1)
+        .m(8)
+        .n(n)
+        .k(4)
+        .iterations(1)
+        .Test(xnn_f16_gemm_minmax_ukernel_8x8__aarch64_neonfp16arith_ld64, xnn_init_f16_scaleminmax_neon_params);
+    }
+  }
+
+  TEST(F16_GEMM_MINMAX_8X8__AARCH64_NEONFP16ARITH_LD64, k_lt_4) {
+    TEST_REQUIRES_ARM_NEON_FP16_ARITH;
+    for (size_t k = 1; k < 4; k++) {
+      GemmMicrokernelTester()
+        .mr(8)
+        .nr(8)
+        .kr(1)
+        .sr(1)
+        .m(8)
+        .n(8)
+        .k(k)
+        .Test(xnn_f16_gemm_minmax_ukernel_8x8__aarch64_neonfp16arith_ld64, xnn_init_f16_scaleminmax_neon_params);
+    }
+  }
+
+  TEST(F16_GEMM_MINMAX_8X8__AARCH64_NEONFP16ARITH_LD64, k_lt_4_strided_a) {
+    TEST_REQUIRES_ARM_NEON_FP16_ARITH;
+    for (size_t k = 1; k < 4; k++) {
+      GemmMicrokernelTester()
+        .mr(8)
+        .nr(8)
+        .kr(1)
+        .sr(1)
+        .m(8)
+        .n(8)
+        .k(k)
+        .a_stride(7)
+        .Test(xnn_f16_gemm_minmax_ukernel_8x8__aarch64_neonfp16arith_ld64, xnn_init_f16_scaleminmax_neon_params);
+    }
+  }
+
+  TEST(F16_GEMM_MINMAX_8X8__AARCH64_NEONFP16ARITH_LD64, k_lt_4_subtile) {
+    TEST_REQUIRES_ARM_NEON_FP16_ARITH;
+    for (size_t k = 1; k < 4; k++) {
+      for (uint32_t n = 1; n <= 8; n++) {
+        for (uint32_t m = 1; m <= 8; m++) {
+          GemmMicrokernelTester()
+            .mr(8)
+            .nr(8)
+            .kr(1)
+            .sr(1)
+            .m(m)
+            .n(n)
+            .k(k)
+            .iterations(1)
+            .Test(xnn_f16_gemm_minmax_ukernel_8x8__aarch64_neonfp16arith_ld64, xnn_init_f16_scaleminmax_neon_params);
+        }
+      }
+    }
+  }
+
+  TEST(F16_GEMM_MINMAX_8X8__AARCH64_NEONFP16ARITH_LD64, k_gt_4) {
+    TEST_REQUIRES_ARM_NEON_FP16_ARITH;
+    for (size_t k = 5; k < 8; k++) {
+      GemmMicrokernelTester()
+        .mr(8)
+        .nr(8)
+        .kr(1)
+        .sr(1)
+        .m(8)
+        .n(8)
+        .k(k)
+        .Test(xnn_f16_gemm_minmax_ukernel_8x8__aarch64_neonfp16arith_ld64, xnn_init_f16_scaleminmax_neon_params);
+    }
+  }
+
+  TEST(F16_GEMM_MINMAX_8X8__AARCH64_NEONFP16ARITH_LD64, k_gt_4_strided_a) {
+    TEST_REQUIRES_ARM_NEON_FP16_ARITH;
+    for (size_t k = 5; k < 8; k++) {
+      GemmMicrokernelTester()
+        .mr(8)
+        .nr(8)
+        .kr(1)
+        .sr(1)
+        .m(8)
+        .n(8)
+        .k(k)
+        .a_stride(11)
+        .Test(xnn_f16_gemm_minmax_ukernel_8x8__aarch64_neonfp16arith_ld64, xnn_init_f16_scaleminmax_neon_params);
+    }
+  }
+
+  TEST(F16_GEMM_MINMAX_8X8__AARCH64_NEONFP16ARITH_LD64, k_gt_4_subtile) {
+    TEST_REQUIRES_ARM_NEON_FP16_ARITH;
+    for (size_t k = 5; k < 8; k++) {
+      for (uint32_t n = 1; n <= 8; n++) {
+        for (uint32_t m = 1; m <= 8; m++) {
+          GemmMicrokernelTester()
+            .mr(8)
+            .nr(8)
+            .kr(1)
+            .sr(1)
+            .m(m)
+            .n(n)
+            .k(k)
+            .iterations(1)
+            .Test(xnn_f16_gemm_minmax_ukernel_8x8__aarch64_neonfp16arith_ld64, xnn_init_f16_scaleminmax_neon_params);
+        }
+      }
+    }
+  }
+
+  TEST(F16_GEMM_MINMAX_8X8__AARCH64_NEONFP16ARITH_LD64, k_div_4) {
+    TEST_REQUIRES_ARM_NEON_FP16_ARITH;
+    for (size_t k = 8; k <= 40; k += 4) {
+      GemmMicrokernelTester()
+        .mr(8)
+        .nr(8)
+        .kr(1)
+        .sr(1)
+        .m(8)
+        .n(8)
+        .k(k)
+        .Test(xnn_f16_gemm_minmax_ukernel_8x8__aarch64_neonfp16arith_ld64, xnn_init_f16_scaleminmax_neon_params);
+    }
+  }
+
+  TEST(F16_GEMM_MINMAX_8X8__AARCH64_NEONFP16ARITH_LD64, k_div_4_strided_a) {
+    TEST_REQUIRES_ARM_NEON_FP16_ARITH;
+    for (size_t k = 8; k <= 40; k += 4) {
+      GemmMicrokernelTester()
+        .mr(8)
+        .nr(8)
         .kr(1)
         .sr(1)
         .m(8)
@@ -7544,13 +8000,367 @@
     }
   }
 
-  TEST(F16_GEMM_MINMAX_8X8__AARCH64_NEONFP16ARITH_LD64, k_div_4_subtile) {
+  TEST(F16_GEMM_MINMAX_8X8__AARCH64_NEONFP16ARITH_LD64, k_div_4_subtile) {
+    TEST_REQUIRES_ARM_NEON_FP16_ARITH;
+    for (size_t k = 8; k <= 40; k += 4) {
+      for (uint32_t n = 1; n <= 8; n++) {
+        for (uint32_t m = 1; m <= 8; m++) {
+          GemmMicrokernelTester()
+            .mr(8)
+            .nr(8)
+            .kr(1)
+            .sr(1)
+            .m(m)
+            .n(n)
+            .k(k)
+            .iterations(1)
+            .Test(xnn_f16_gemm_minmax_ukernel_8x8__aarch64_neonfp16arith_ld64, xnn_init_f16_scaleminmax_neon_params);
+        }
+      }
+    }
+  }
+
+  TEST(F16_GEMM_MINMAX_8X8__AARCH64_NEONFP16ARITH_LD64, n_gt_8) {
+    TEST_REQUIRES_ARM_NEON_FP16_ARITH;
+    for (uint32_t n = 9; n < 16; n++) {
+      for (size_t k = 1; k <= 20; k += 5) {
+        GemmMicrokernelTester()
+          .mr(8)
+          .nr(8)
+          .kr(1)
+          .sr(1)
+          .m(8)
+          .n(n)
+          .k(k)
+          .Test(xnn_f16_gemm_minmax_ukernel_8x8__aarch64_neonfp16arith_ld64, xnn_init_f16_scaleminmax_neon_params);
+      }
+    }
+  }
+
+  TEST(F16_GEMM_MINMAX_8X8__AARCH64_NEONFP16ARITH_LD64, n_gt_8_strided_cn) {
+    TEST_REQUIRES_ARM_NEON_FP16_ARITH;
+    for (uint32_t n = 9; n < 16; n++) {
+      for (size_t k = 1; k <= 20; k += 5) {
+        GemmMicrokernelTester()
+          .mr(8)
+          .nr(8)
+          .kr(1)
+          .sr(1)
+          .m(8)
+          .n(n)
+          .k(k)
+          .cn_stride(11)
+          .Test(xnn_f16_gemm_minmax_ukernel_8x8__aarch64_neonfp16arith_ld64, xnn_init_f16_scaleminmax_neon_params);
+      }
+    }
+  }
+
+  TEST(F16_GEMM_MINMAX_8X8__AARCH64_NEONFP16ARITH_LD64, n_gt_8_strided_a) {
+    TEST_REQUIRES_ARM_NEON_FP16_ARITH;
+    for (uint32_t n = 9; n < 16; n++) {
+      for (size_t k = 1; k <= 20; k += 5) {
+        GemmMicrokernelTester()
+          .mr(8)
+          .nr(8)
+          .kr(1)
+          .sr(1)
+          .m(8)
+          .n(n)
+          .k(k)
+          .a_stride(23)
+          .Test(xnn_f16_gemm_minmax_ukernel_8x8__aarch64_neonfp16arith_ld64, xnn_init_f16_scaleminmax_neon_params);
+      }
+    }
+  }
+
+  TEST(F16_GEMM_MINMAX_8X8__AARCH64_NEONFP16ARITH_LD64, n_gt_8_subtile) {
+    TEST_REQUIRES_ARM_NEON_FP16_ARITH;
+    for (uint32_t n = 9; n < 16; n++) {
+      for (size_t k = 1; k <= 20; k += 5) {
+        for (uint32_t m = 1; m <= 8; m++) {
+          GemmMicrokernelTester()
+            .mr(8)
+            .nr(8)
+            .kr(1)
+            .sr(1)
+            .m(m)
+            .n(n)
+            .k(k)
+            .iterations(1)
+            .Test(xnn_f16_gemm_minmax_ukernel_8x8__aarch64_neonfp16arith_ld64, xnn_init_f16_scaleminmax_neon_params);
+        }
+      }
+    }
+  }
+
+  TEST(F16_GEMM_MINMAX_8X8__AARCH64_NEONFP16ARITH_LD64, n_div_8) {
+    TEST_REQUIRES_ARM_NEON_FP16_ARITH;
+    for (uint32_t n = 16; n <= 24; n += 8) {
+      for (size_t k = 1; k <= 20; k += 5) {
+        GemmMicrokernelTester()
+          .mr(8)
+          .nr(8)
+          .kr(1)
+          .sr(1)
+          .m(8)
+          .n(n)
+          .k(k)
+          .Test(xnn_f16_gemm_minmax_ukernel_8x8__aarch64_neonfp16arith_ld64, xnn_init_f16_scaleminmax_neon_params);
+      }
+    }
+  }
+
+  TEST(F16_GEMM_MINMAX_8X8__AARCH64_NEONFP16ARITH_LD64, n_div_8_strided_cn) {
     TEST_REQUIRES_ARM_NEON_FP16_ARITH;
-    for (size_t k = 8; k <= 40; k += 4) {
+    for (uint32_t n = 16; n <= 24; n += 8) {
+      for (size_t k = 1; k <= 20; k += 5) {
+        GemmMicrokernelTester()
+          .mr(8)
+          .nr(8)
+          .kr(1)
+          .sr(1)
+          .m(8)
+          .n(n)
+          .k(k)
+          .cn_stride(11)
+          .Test(xnn_f16_gemm_minmax_ukernel_8x8__aarch64_neonfp16arith_ld64, xnn_init_f16_scaleminmax_neon_params);
+      }
+    }
+  }
+
+  TEST(F16_GEMM_MINMAX_8X8__AARCH64_NEONFP16ARITH_LD64, n_div_8_strided_a) {
+    TEST_REQUIRES_ARM_NEON_FP16_ARITH;
+    for (uint32_t n = 16; n <= 24; n += 8) {
+      for (size_t k = 1; k <= 20; k += 5) {
+        GemmMicrokernelTester()
+          .mr(8)
+          .nr(8)
+          .kr(1)
+          .sr(1)
+          .m(8)
+          .n(n)
+          .k(k)
+          .a_stride(23)
+          .Test(xnn_f16_gemm_minmax_ukernel_8x8__aarch64_neonfp16arith_ld64, xnn_init_f16_scaleminmax_neon_params);
+      }
+    }
+  }
+
+  TEST(F16_GEMM_MINMAX_8X8__AARCH64_NEONFP16ARITH_LD64, n_div_8_subtile) {
+    TEST_REQUIRES_ARM_NEON_FP16_ARITH;
+    for (uint32_t n = 16; n <= 24; n += 8) {
+      for (size_t k = 1; k <= 20; k += 5) {
+        for (uint32_t m = 1; m <= 8; m++) {
+          GemmMicrokernelTester()
+            .mr(8)
+            .nr(8)
+            .kr(1)
+            .sr(1)
+            .m(m)
+            .n(n)
+            .k(k)
+            .iterations(1)
+            .Test(xnn_f16_gemm_minmax_ukernel_8x8__aarch64_neonfp16arith_ld64, xnn_init_f16_scaleminmax_neon_params);
+        }
+      }
+    }
+  }
+
+  TEST(F16_GEMM_MINMAX_8X8__AARCH64_NEONFP16ARITH_LD64, strided_cm_subtile) {
+    TEST_REQUIRES_ARM_NEON_FP16_ARITH;
+    for (size_t k = 1; k <= 20; k += 5) {
       for (uint32_t n = 1; n <= 8; n++) {
         for (uint32_t m = 1; m <= 8; m++) {
           GemmMicrokernelTester()
-            .mr(8)
+            .mr(8)
+            .nr(8)
+            .kr(1)
+            .sr(1)
+            .m(m)
+            .n(n)
+            .k(k)
+            .cm_stride(11)
+            .iterations(1)
+            .Test(xnn_f16_gemm_minmax_ukernel_8x8__aarch64_neonfp16arith_ld64, xnn_init_f16_scaleminmax_neon_params);
+        }
+      }
+    }
+  }
+
+  TEST(F16_GEMM_MINMAX_8X8__AARCH64_NEONFP16ARITH_LD64, qmin) {
+    TEST_REQUIRES_ARM_NEON_FP16_ARITH;
+    GemmMicrokernelTester()
+      .mr(8)
+      .nr(8)
+      .kr(1)
+      .sr(1)
+      .m(8)
+      .n(8)
+      .k(4)
+      .qmin(128)
+      .Test(xnn_f16_gemm_minmax_ukernel_8x8__aarch64_neonfp16arith_ld64, xnn_init_f16_scaleminmax_neon_params);
+  }
+
+  TEST(F16_GEMM_MINMAX_8X8__AARCH64_NEONFP16ARITH_LD64, qmax) {
+    TEST_REQUIRES_ARM_NEON_FP16_ARITH;
+    GemmMicrokernelTester()
+      .mr(8)
+      .nr(8)
+      .kr(1)
+      .sr(1)
+      .m(8)
+      .n(8)
+      .k(4)
+      .qmax(128)
+      .Test(xnn_f16_gemm_minmax_ukernel_8x8__aarch64_neonfp16arith_ld64, xnn_init_f16_scaleminmax_neon_params);
+  }
+
+  TEST(F16_GEMM_MINMAX_8X8__AARCH64_NEONFP16ARITH_LD64, strided_cm) {
+    TEST_REQUIRES_ARM_NEON_FP16_ARITH;
+    GemmMicrokernelTester()
+      .mr(8)
+      .nr(8)
+      .kr(1)
+      .sr(1)
+      .m(8)
+      .n(8)
+      .k(4)
+      .cm_stride(11)
+      .Test(xnn_f16_gemm_minmax_ukernel_8x8__aarch64_neonfp16arith_ld64, xnn_init_f16_scaleminmax_neon_params);
+  }
+#endif  // XNN_ARCH_ARM64 && XNN_ENABLE_ASSEMBLY
+
+
+#if XNN_ARCH_X86 || XNN_ARCH_X86_64
+  TEST(F16_GEMM_MINMAX_1X8__AVX2_BROADCAST, k_eq_1) {
+    TEST_REQUIRES_X86_AVX2;
+    GemmMicrokernelTester()
+      .mr(1)
+      .nr(8)
+      .kr(1)
+      .sr(1)
+      .m(1)
+      .n(8)
+      .k(1)
+      .Test(xnn_f16_gemm_minmax_ukernel_1x8__avx2_broadcast, xnn_init_f16_scaleminmax_avx_params);
+  }
+
+  TEST(F16_GEMM_MINMAX_1X8__AVX2_BROADCAST, strided_cn) {
+    TEST_REQUIRES_X86_AVX2;
+    GemmMicrokernelTester()
+      .mr(1)
+      .nr(8)
+      .kr(1)
+      .sr(1)
+      .m(1)
+      .n(8)
+      .k(1)
+      .cn_stride(11)
+      .Test(xnn_f16_gemm_minmax_ukernel_1x8__avx2_broadcast, xnn_init_f16_scaleminmax_avx_params);
+  }
+
+  TEST(F16_GEMM_MINMAX_1X8__AVX2_BROADCAST, k_eq_1_strided_a) {
+    TEST_REQUIRES_X86_AVX2;
+    GemmMicrokernelTester()
+      .mr(1)
+      .nr(8)
+      .kr(1)
+      .sr(1)
+      .m(1)
+      .n(8)
+      .k(1)
+      .a_stride(3)
+      .Test(xnn_f16_gemm_minmax_ukernel_1x8__avx2_broadcast, xnn_init_f16_scaleminmax_avx_params);
+  }
+
+  TEST(F16_GEMM_MINMAX_1X8__AVX2_BROADCAST, k_eq_1_subtile) {
+    TEST_REQUIRES_X86_AVX2;
+    for (uint32_t n = 1; n <= 8; n++) {
+      for (uint32_t m = 1; m <= 1; m++) {
+        GemmMicrokernelTester()
+          .mr(1)
+          .nr(8)
+          .kr(1)
+          .sr(1)
+          .m(m)
+          .n(n)
+          .k(1)
+          .iterations(1)
+          .Test(xnn_f16_gemm_minmax_ukernel_1x8__avx2_broadcast, xnn_init_f16_scaleminmax_avx_params);
+      }
+    }
+  }
+
+  TEST(F16_GEMM_MINMAX_1X8__AVX2_BROADCAST, k_eq_1_subtile_m) {
+    TEST_REQUIRES_X86_AVX2;
+    for (uint32_t m = 1; m <= 1; m++) {
+      GemmMicrokernelTester()
+        .mr(1)
+        .nr(8)
+        .kr(1)
+        .sr(1)
+        .m(m)
+        .n(8)
+        .k(1)
+        .iterations(1)
+        .Test(xnn_f16_gemm_minmax_ukernel_1x8__avx2_broadcast, xnn_init_f16_scaleminmax_avx_params);
+    }
+  }
+
+  TEST(F16_GEMM_MINMAX_1X8__AVX2_BROADCAST, k_eq_1_subtile_n) {
+    TEST_REQUIRES_X86_AVX2;
+    for (uint32_t n = 1; n <= 8; n++) {
+      GemmMicrokernelTester()
+        .mr(1)
+        .nr(8)
+        .kr(1)
+        .sr(1)
+        .m(1)
+        .n(n)
+        .k(1)
+        .iterations(1)
+        .Test(xnn_f16_gemm_minmax_ukernel_1x8__avx2_broadcast, xnn_init_f16_scaleminmax_avx_params);
+    }
+  }
+
+  TEST(F16_GEMM_MINMAX_1X8__AVX2_BROADCAST, k_gt_1) {
+    TEST_REQUIRES_X86_AVX2;
+    for (size_t k = 2; k < 10; k++) {
+      GemmMicrokernelTester()
+        .mr(1)
+        .nr(8)
+        .kr(1)
+        .sr(1)
+        .m(1)
+        .n(8)
+        .k(k)
+        .Test(xnn_f16_gemm_minmax_ukernel_1x8__avx2_broadcast, xnn_init_f16_scaleminmax_avx_params);
+    }
+  }
+
+  TEST(F16_GEMM_MINMAX_1X8__AVX2_BROADCAST, k_gt_1_strided_a) {
+    TEST_REQUIRES_X86_AVX2;
+    for (size_t k = 2; k < 10; k++) {
+      GemmMicrokernelTester()
+        .mr(1)
+        .nr(8)
+        .kr(1)
+        .sr(1)
+        .m(1)
+        .n(8)
+        .k(k)
+        .a_stride(11)
+        .Test(xnn_f16_gemm_minmax_ukernel_1x8__avx2_broadcast, xnn_init_f16_scaleminmax_avx_params);
+    }
+  }
+
+  TEST(F16_GEMM_MINMAX_1X8__AVX2_BROADCAST, k_gt_1_subtile) {
+    TEST_REQUIRES_X86_AVX2;
+    for (size_t k = 2; k < 10; k++) {
+      for (uint32_t n = 1; n <= 8; n++) {
+        for (uint32_t m = 1; m <= 1; m++) {
+          GemmMicrokernelTester()
+            .mr(1)
             .nr(8)
             .kr(1)
             .sr(1)
@@ -7558,72 +8368,72 @@
             .n(n)
             .k(k)
             .iterations(1)
-            .Test(xnn_f16_gemm_minmax_ukernel_8x8__aarch64_neonfp16arith_ld64, xnn_init_f16_scaleminmax_neon_params);
+            .Test(xnn_f16_gemm_minmax_ukernel_1x8__avx2_broadcast, xnn_init_f16_scaleminmax_avx_params);
         }
       }
     }
   }
 
-  TEST(F16_GEMM_MINMAX_8X8__AARCH64_NEONFP16ARITH_LD64, n_gt_8) {
-    TEST_REQUIRES_ARM_NEON_FP16_ARITH;
+  TEST(F16_GEMM_MINMAX_1X8__AVX2_BROADCAST, n_gt_8) {
+    TEST_REQUIRES_X86_AVX2;
     for (uint32_t n = 9; n < 16; n++) {
-      for (size_t k = 1; k <= 20; k += 5) {
+      for (size_t k = 1; k <= 5; k += 2) {
         GemmMicrokernelTester()
-          .mr(8)
+          .mr(1)
           .nr(8)
           .kr(1)
           .sr(1)
-          .m(8)
+          .m(1)
           .n(n)
           .k(k)
-          .Test(xnn_f16_gemm_minmax_ukernel_8x8__aarch64_neonfp16arith_ld64, xnn_init_f16_scaleminmax_neon_params);
+          .Test(xnn_f16_gemm_minmax_ukernel_1x8__avx2_broadcast, xnn_init_f16_scaleminmax_avx_params);
       }
     }
   }
 
-  TEST(F16_GEMM_MINMAX_8X8__AARCH64_NEONFP16ARITH_LD64, n_gt_8_strided_cn) {
-    TEST_REQUIRES_ARM_NEON_FP16_ARITH;
+  TEST(F16_GEMM_MINMAX_1X8__AVX2_BROADCAST, n_gt_8_strided_cn) {
+    TEST_REQUIRES_X86_AVX2;
     for (uint32_t n = 9; n < 16; n++) {
-      for (size_t k = 1; k <= 20; k += 5) {
+      for (size_t k = 1; k <= 5; k += 2) {
         GemmMicrokernelTester()
-          .mr(8)
+          .mr(1)
           .nr(8)
           .kr(1)
           .sr(1)
-          .m(8)
+          .m(1)
           .n(n)
           .k(k)
           .cn_stride(11)
-          .Test(xnn_f16_gemm_minmax_ukernel_8x8__aarch64_neonfp16arith_ld64, xnn_init_f16_scaleminmax_neon_params);
+          .Test(xnn_f16_gemm_minmax_ukernel_1x8__avx2_broadcast, xnn_init_f16_scaleminmax_avx_params);
       }
     }
   }
 
-  TEST(F16_GEMM_MINMAX_8X8__AARCH64_NEONFP16ARITH_LD64, n_gt_8_strided_a) {
-    TEST_REQUIRES_ARM_NEON_FP16_ARITH;
+  TEST(F16_GEMM_MINMAX_1X8__AVX2_BROADCAST, n_gt_8_strided_a) {
+    TEST_REQUIRES_X86_AVX2;
     for (uint32_t n = 9; n < 16; n++) {
-      for (size_t k = 1; k <= 20; k += 5) {
+      for (size_t k = 1; k <= 5; k += 2) {
         GemmMicrokernelTester()
-          .mr(8)
+          .mr(1)
           .nr(8)
           .kr(1)
           .sr(1)
-          .m(8)
+          .m(1)
           .n(n)
           .k(k)
-          .a_stride(23)
-          .Test(xnn_f16_gemm_minmax_ukernel_8x8__aarch64_neonfp16arith_ld64, xnn_init_f16_scaleminmax_neon_params);
+          .a_stride(7)
+          .Test(xnn_f16_gemm_minmax_ukernel_1x8__avx2_broadcast, xnn_init_f16_scaleminmax_avx_params);
       }
     }
   }
 
-  TEST(F16_GEMM_MINMAX_8X8__AARCH64_NEONFP16ARITH_LD64, n_gt_8_subtile) {
-    TEST_REQUIRES_ARM_NEON_FP16_ARITH;
+  TEST(F16_GEMM_MINMAX_1X8__AVX2_BROADCAST, n_gt_8_subtile) {
+    TEST_REQUIRES_X86_AVX2;
     for (uint32_t n = 9; n < 16; n++) {
-      for (size_t k = 1; k <= 20; k += 5) {
-        for (uint32_t m = 1; m <= 8; m++) {
+      for (size_t k = 1; k <= 5; k += 2) {
+        for (uint32_t m = 1; m <= 1; m++) {
           GemmMicrokernelTester()
-            .mr(8)
+            .mr(1)
             .nr(8)
             .kr(1)
             .sr(1)
@@ -7631,72 +8441,72 @@
             .n(n)
             .k(k)
             .iterations(1)
-            .Test(xnn_f16_gemm_minmax_ukernel_8x8__aarch64_neonfp16arith_ld64, xnn_init_f16_scaleminmax_neon_params);
+            .Test(xnn_f16_gemm_minmax_ukernel_1x8__avx2_broadcast, xnn_init_f16_scaleminmax_avx_params);
         }
       }
     }
   }
 
-  TEST(F16_GEMM_MINMAX_8X8__AARCH64_NEONFP16ARITH_LD64, n_div_8) {
-    TEST_REQUIRES_ARM_NEON_FP16_ARITH;
+  TEST(F16_GEMM_MINMAX_1X8__AVX2_BROADCAST, n_div_8) {
+    TEST_REQUIRES_X86_AVX2;
     for (uint32_t n = 16; n <= 24; n += 8) {
-      for (size_t k = 1; k <= 20; k += 5) {
+      for (size_t k = 1; k <= 5; k += 2) {
         GemmMicrokernelTester()
-          .mr(8)
+          .mr(1)
           .nr(8)
           .kr(1)
           .sr(1)
-          .m(8)
+          .m(1)
           .n(n)
           .k(k)
-          .Test(xnn_f16_gemm_minmax_ukernel_8x8__aarch64_neonfp16arith_ld64, xnn_init_f16_scaleminmax_neon_params);
+          .Test(xnn_f16_gemm_minmax_ukernel_1x8__avx2_broadcast, xnn_init_f16_scaleminmax_avx_params);
       }
     }
   }
 
-  TEST(F16_GEMM_MINMAX_8X8__AARCH64_NEONFP16ARITH_LD64, n_div_8_strided_cn) {
-    TEST_REQUIRES_ARM_NEON_FP16_ARITH;
+  TEST(F16_GEMM_MINMAX_1X8__AVX2_BROADCAST, n_div_8_strided_cn) {
+    TEST_REQUIRES_X86_AVX2;
     for (uint32_t n = 16; n <= 24; n += 8) {
-      for (size_t k = 1; k <= 20; k += 5) {
+      for (size_t k = 1; k <= 5; k += 2) {
         GemmMicrokernelTester()
-          .mr(8)
+          .mr(1)
           .nr(8)
           .kr(1)
           .sr(1)
-          .m(8)
+          .m(1)
           .n(n)
           .k(k)
           .cn_stride(11)
-          .Test(xnn_f16_gemm_minmax_ukernel_8x8__aarch64_neonfp16arith_ld64, xnn_init_f16_scaleminmax_neon_params);
+          .Test(xnn_f16_gemm_minmax_ukernel_1x8__avx2_broadcast, xnn_init_f16_scaleminmax_avx_params);
       }
     }
   }
 
-  TEST(F16_GEMM_MINMAX_8X8__AARCH64_NEONFP16ARITH_LD64, n_div_8_strided_a) {
-    TEST_REQUIRES_ARM_NEON_FP16_ARITH;
+  TEST(F16_GEMM_MINMAX_1X8__AVX2_BROADCAST, n_div_8_strided_a) {
+    TEST_REQUIRES_X86_AVX2;
     for (uint32_t n = 16; n <= 24; n += 8) {
-      for (size_t k = 1; k <= 20; k += 5) {
+      for (size_t k = 1; k <= 5; k += 2) {
         GemmMicrokernelTester()
-          .mr(8)
+          .mr(1)
           .nr(8)
           .kr(1)
           .sr(1)
-          .m(8)
+          .m(1)
           .n(n)
           .k(k)
-          .a_stride(23)
-          .Test(xnn_f16_gemm_minmax_ukernel_8x8__aarch64_neonfp16arith_ld64, xnn_init_f16_scaleminmax_neon_params);
+          .a_stride(7)
+          .Test(xnn_f16_gemm_minmax_ukernel_1x8__avx2_broadcast, xnn_init_f16_scaleminmax_avx_params);
       }
     }
   }
 
-  TEST(F16_GEMM_MINMAX_8X8__AARCH64_NEONFP16ARITH_LD64, n_div_8_subtile) {
-    TEST_REQUIRES_ARM_NEON_FP16_ARITH;
+  TEST(F16_GEMM_MINMAX_1X8__AVX2_BROADCAST, n_div_8_subtile) {
+    TEST_REQUIRES_X86_AVX2;
     for (uint32_t n = 16; n <= 24; n += 8) {
-      for (size_t k = 1; k <= 20; k += 5) {
-        for (uint32_t m = 1; m <= 8; m++) {
+      for (size_t k = 1; k <= 5; k += 2) {
+        for (uint32_t m = 1; m <= 1; m++) {
           GemmMicrokernelTester()
-            .mr(8)
+            .mr(1)
             .nr(8)
             .kr(1)
             .sr(1)
@@ -7704,19 +8514,19 @@
             .n(n)
             .k(k)
             .iterations(1)
-            .Test(xnn_f16_gemm_minmax_ukernel_8x8__aarch64_neonfp16arith_ld64, xnn_init_f16_scaleminmax_neon_params);
+            .Test(xnn_f16_gemm_minmax_ukernel_1x8__avx2_broadcast, xnn_init_f16_scaleminmax_avx_params);
         }
       }
     }
   }
 
-  TEST(F16_GEMM_MINMAX_8X8__AARCH64_NEONFP16ARITH_LD64, strided_cm_subtile) {
-    TEST_REQUIRES_ARM_NEON_FP16_ARITH;
-    for (size_t k = 1; k <= 20; k += 5) {
+  TEST(F16_GEMM_MINMAX_1X8__AVX2_BROADCAST, strided_cm_subtile) {
+    TEST_REQUIRES_X86_AVX2;
+    for (size_t k = 1; k <= 5; k += 2) {
       for (uint32_t n = 1; n <= 8; n++) {
-        for (uint32_t m = 1; m <= 8; m++) {
+        for (uint32_t m = 1; m <= 1; m++) {
           GemmMicrokernelTester()
-            .mr(8)
+            .mr(1)
             .nr(8)
             .kr(1)
             .sr(1)
@@ -7725,412 +8535,412 @@
             .k(k)
             .cm_stride(11)
             .iterations(1)
-            .Test(xnn_f16_gemm_minmax_ukernel_8x8__aarch64_neonfp16arith_ld64, xnn_init_f16_scaleminmax_neon_params);
+            .Test(xnn_f16_gemm_minmax_ukernel_1x8__avx2_broadcast, xnn_init_f16_scaleminmax_avx_params);
         }
       }
     }
   }
 
-  TEST(F16_GEMM_MINMAX_8X8__AARCH64_NEONFP16ARITH_LD64, qmin) {
-    TEST_REQUIRES_ARM_NEON_FP16_ARITH;
+  TEST(F16_GEMM_MINMAX_1X8__AVX2_BROADCAST, qmin) {
+    TEST_REQUIRES_X86_AVX2;
     GemmMicrokernelTester()
-      .mr(8)
+      .mr(1)
       .nr(8)
       .kr(1)
       .sr(1)
-      .m(8)
+      .m(1)
       .n(8)
-      .k(4)
+      .k(1)
       .qmin(128)
-      .Test(xnn_f16_gemm_minmax_ukernel_8x8__aarch64_neonfp16arith_ld64, xnn_init_f16_scaleminmax_neon_params);
+      .Test(xnn_f16_gemm_minmax_ukernel_1x8__avx2_broadcast, xnn_init_f16_scaleminmax_avx_params);
   }
 
-  TEST(F16_GEMM_MINMAX_8X8__AARCH64_NEONFP16ARITH_LD64, qmax) {
-    TEST_REQUIRES_ARM_NEON_FP16_ARITH;
+  TEST(F16_GEMM_MINMAX_1X8__AVX2_BROADCAST, qmax) {
+    TEST_REQUIRES_X86_AVX2;
     GemmMicrokernelTester()
-      .mr(8)
+      .mr(1)
       .nr(8)
       .kr(1)
       .sr(1)
-      .m(8)
+      .m(1)
       .n(8)
-      .k(4)
+      .k(1)
       .qmax(128)
-      .Test(xnn_f16_gemm_minmax_ukernel_8x8__aarch64_neonfp16arith_ld64, xnn_init_f16_scaleminmax_neon_params);
+      .Test(xnn_f16_gemm_minmax_ukernel_1x8__avx2_broadcast, xnn_init_f16_scaleminmax_avx_params);
   }
 
-  TEST(F16_GEMM_MINMAX_8X8__AARCH64_NEONFP16ARITH_LD64, strided_cm) {
-    TEST_REQUIRES_ARM_NEON_FP16_ARITH;
+  TEST(F16_GEMM_MINMAX_1X8__AVX2_BROADCAST, strided_cm) {
+    TEST_REQUIRES_X86_AVX2;
     GemmMicrokernelTester()
-      .mr(8)
+      .mr(1)
       .nr(8)
       .kr(1)
       .sr(1)
-      .m(8)
+      .m(1)
       .n(8)
-      .k(4)
+      .k(1)
       .cm_stride(11)
-      .Test(xnn_f16_gemm_minmax_ukernel_8x8__aarch64_neonfp16arith_ld64, xnn_init_f16_scaleminmax_neon_params);
+      .Test(xnn_f16_gemm_minmax_ukernel_1x8__avx2_broadcast, xnn_init_f16_scaleminmax_avx_params);
   }
-#endif  // XNN_ARCH_ARM64 && XNN_ENABLE_ASSEMBLY
+#endif  // XNN_ARCH_X86 || XNN_ARCH_X86_64
 
 
 #if XNN_ARCH_X86 || XNN_ARCH_X86_64
-  TEST(F16_GEMM_MINMAX_1X8__AVX2_BROADCAST, k_eq_1) {
+  TEST(F16_GEMM_MINMAX_1X16__AVX2_BROADCAST, k_eq_1) {
     TEST_REQUIRES_X86_AVX2;
     GemmMicrokernelTester()
       .mr(1)
-      .nr(8)
+      .nr(16)
       .kr(1)
       .sr(1)
       .m(1)
-      .n(8)
+      .n(16)
       .k(1)
-      .Test(xnn_f16_gemm_minmax_ukernel_1x8__avx2_broadcast, xnn_init_f16_scaleminmax_avx_params);
+      .Test(xnn_f16_gemm_minmax_ukernel_1x16__avx2_broadcast, xnn_init_f16_scaleminmax_avx_params);
   }
 
-  TEST(F16_GEMM_MINMAX_1X8__AVX2_BROADCAST, strided_cn) {
+  TEST(F16_GEMM_MINMAX_1X16__AVX2_BROADCAST, strided_cn) {
     TEST_REQUIRES_X86_AVX2;
     GemmMicrokernelTester()
       .mr(1)
-      .nr(8)
+      .nr(16)
       .kr(1)
       .sr(1)
       .m(1)
-      .n(8)
+      .n(16)
       .k(1)
-      .cn_stride(11)
-      .Test(xnn_f16_gemm_minmax_ukernel_1x8__avx2_broadcast, xnn_init_f16_scaleminmax_avx_params);
+      .cn_stride(19)
+      .Test(xnn_f16_gemm_minmax_ukernel_1x16__avx2_broadcast, xnn_init_f16_scaleminmax_avx_params);
   }
 
-  TEST(F16_GEMM_MINMAX_1X8__AVX2_BROADCAST, k_eq_1_strided_a) {
+  TEST(F16_GEMM_MINMAX_1X16__AVX2_BROADCAST, k_eq_1_strided_a) {
     TEST_REQUIRES_X86_AVX2;
     GemmMicrokernelTester()
       .mr(1)
-      .nr(8)
+      .nr(16)
       .kr(1)
       .sr(1)
       .m(1)
-      .n(8)
+      .n(16)
       .k(1)
       .a_stride(3)
-      .Test(xnn_f16_gemm_minmax_ukernel_1x8__avx2_broadcast, xnn_init_f16_scaleminmax_avx_params);
+      .Test(xnn_f16_gemm_minmax_ukernel_1x16__avx2_broadcast, xnn_init_f16_scaleminmax_avx_params);
   }
 
-  TEST(F16_GEMM_MINMAX_1X8__AVX2_BROADCAST, k_eq_1_subtile) {
+  TEST(F16_GEMM_MINMAX_1X16__AVX2_BROADCAST, k_eq_1_subtile) {
     TEST_REQUIRES_X86_AVX2;
-    for (uint32_t n = 1; n <= 8; n++) {
+    for (uint32_t n = 1; n <= 16; n++) {
       for (uint32_t m = 1; m <= 1; m++) {
         GemmMicrokernelTester()
           .mr(1)
-          .nr(8)
+          .nr(16)
           .kr(1)
           .sr(1)
           .m(m)
           .n(n)
           .k(1)
           .iterations(1)
-          .Test(xnn_f16_gemm_minmax_ukernel_1x8__avx2_broadcast, xnn_init_f16_scaleminmax_avx_params);
+          .Test(xnn_f16_gemm_minmax_ukernel_1x16__avx2_broadcast, xnn_init_f16_scaleminmax_avx_params);
       }
     }
   }
 
-  TEST(F16_GEMM_MINMAX_1X8__AVX2_BROADCAST, k_eq_1_subtile_m) {
+  TEST(F16_GEMM_MINMAX_1X16__AVX2_BROADCAST, k_eq_1_subtile_m) {
     TEST_REQUIRES_X86_AVX2;
     for (uint32_t m = 1; m <= 1; m++) {
       GemmMicrokernelTester()
         .mr(1)
-        .nr(8)
+        .nr(16)
         .kr(1)
         .sr(1)
         .m(m)
-        .n(8)
+        .n(16)
         .k(1)
         .iterations(1)
-        .Test(xnn_f16_gemm_minmax_ukernel_1x8__avx2_broadcast, xnn_init_f16_scaleminmax_avx_params);
+        .Test(xnn_f16_gemm_minmax_ukernel_1x16__avx2_broadcast, xnn_init_f16_scaleminmax_avx_params);
     }
   }
 
-  TEST(F16_GEMM_MINMAX_1X8__AVX2_BROADCAST, k_eq_1_subtile_n) {
+  TEST(F16_GEMM_MINMAX_1X16__AVX2_BROADCAST, k_eq_1_subtile_n) {
     TEST_REQUIRES_X86_AVX2;
-    for (uint32_t n = 1; n <= 8; n++) {
+    for (uint32_t n = 1; n <= 16; n++) {
       GemmMicrokernelTester()
         .mr(1)
-        .nr(8)
+        .nr(16)
         .kr(1)
         .sr(1)
         .m(1)
         .n(n)
         .k(1)
         .iterations(1)
-        .Test(xnn_f16_gemm_minmax_ukernel_1x8__avx2_broadcast, xnn_init_f16_scaleminmax_avx_params);
+        .Test(xnn_f16_gemm_minmax_ukernel_1x16__avx2_broadcast, xnn_init_f16_scaleminmax_avx_params);
     }
   }
 
-  TEST(F16_GEMM_MINMAX_1X8__AVX2_BROADCAST, k_gt_1) {
+  TEST(F16_GEMM_MINMAX_1X16__AVX2_BROADCAST, k_gt_1) {
     TEST_REQUIRES_X86_AVX2;
     for (size_t k = 2; k < 10; k++) {
       GemmMicrokernelTester()
         .mr(1)
-        .nr(8)
+        .nr(16)
         .kr(1)
         .sr(1)
         .m(1)
-        .n(8)
+        .n(16)
         .k(k)
-        .Test(xnn_f16_gemm_minmax_ukernel_1x8__avx2_broadcast, xnn_init_f16_scaleminmax_avx_params);
+        .Test(xnn_f16_gemm_minmax_ukernel_1x16__avx2_broadcast, xnn_init_f16_scaleminmax_avx_params);
     }
   }
 
-  TEST(F16_GEMM_MINMAX_1X8__AVX2_BROADCAST, k_gt_1_strided_a) {
+  TEST(F16_GEMM_MINMAX_1X16__AVX2_BROADCAST, k_gt_1_strided_a) {
     TEST_REQUIRES_X86_AVX2;
     for (size_t k = 2; k < 10; k++) {
       GemmMicrokernelTester()
         .mr(1)
-        .nr(8)
+        .nr(16)
         .kr(1)
         .sr(1)
         .m(1)
-        .n(8)
+        .n(16)
         .k(k)
         .a_stride(11)
-        .Test(xnn_f16_gemm_minmax_ukernel_1x8__avx2_broadcast, xnn_init_f16_scaleminmax_avx_params);
+        .Test(xnn_f16_gemm_minmax_ukernel_1x16__avx2_broadcast, xnn_init_f16_scaleminmax_avx_params);
     }
   }
 
-  TEST(F16_GEMM_MINMAX_1X8__AVX2_BROADCAST, k_gt_1_subtile) {
+  TEST(F16_GEMM_MINMAX_1X16__AVX2_BROADCAST, k_gt_1_subtile) {
     TEST_REQUIRES_X86_AVX2;
     for (size_t k = 2; k < 10; k++) {
-      for (uint32_t n = 1; n <= 8; n++) {
+      for (uint32_t n = 1; n <= 16; n++) {
         for (uint32_t m = 1; m <= 1; m++) {
           GemmMicrokernelTester()
             .mr(1)
-            .nr(8)
+            .nr(16)
             .kr(1)
             .sr(1)
             .m(m)
             .n(n)
             .k(k)
             .iterations(1)
-            .Test(xnn_f16_gemm_minmax_ukernel_1x8__avx2_broadcast, xnn_init_f16_scaleminmax_avx_params);
+            .Test(xnn_f16_gemm_minmax_ukernel_1x16__avx2_broadcast, xnn_init_f16_scaleminmax_avx_params);
         }
       }
     }
   }
 
-  TEST(F16_GEMM_MINMAX_1X8__AVX2_BROADCAST, n_gt_8) {
+  TEST(F16_GEMM_MINMAX_1X16__AVX2_BROADCAST, n_gt_16) {
     TEST_REQUIRES_X86_AVX2;
-    for (uint32_t n = 9; n < 16; n++) {
+    for (uint32_t n = 17; n < 32; n++) {
       for (size_t k = 1; k <= 5; k += 2) {
         GemmMicrokernelTester()
           .mr(1)
-          .nr(8)
+          .nr(16)
           .kr(1)
           .sr(1)
           .m(1)
           .n(n)
           .k(k)
-          .Test(xnn_f16_gemm_minmax_ukernel_1x8__avx2_broadcast, xnn_init_f16_scaleminmax_avx_params);
+          .Test(xnn_f16_gemm_minmax_ukernel_1x16__avx2_broadcast, xnn_init_f16_scaleminmax_avx_params);
       }
     }
   }
 
-  TEST(F16_GEMM_MINMAX_1X8__AVX2_BROADCAST, n_gt_8_strided_cn) {
+  TEST(F16_GEMM_MINMAX_1X16__AVX2_BROADCAST, n_gt_16_strided_cn) {
     TEST_REQUIRES_X86_AVX2;
-    for (uint32_t n = 9; n < 16; n++) {
+    for (uint32_t n = 17; n < 32; n++) {
       for (size_t k = 1; k <= 5; k += 2) {
         GemmMicrokernelTester()
           .mr(1)
-          .nr(8)
+          .nr(16)
           .kr(1)
           .sr(1)
           .m(1)
           .n(n)
           .k(k)
-          .cn_stride(11)
-          .Test(xnn_f16_gemm_minmax_ukernel_1x8__avx2_broadcast, xnn_init_f16_scaleminmax_avx_params);
+          .cn_stride(19)
+          .Test(xnn_f16_gemm_minmax_ukernel_1x16__avx2_broadcast, xnn_init_f16_scaleminmax_avx_params);
       }
     }
   }
 
-  TEST(F16_GEMM_MINMAX_1X8__AVX2_BROADCAST, n_gt_8_strided_a) {
+  TEST(F16_GEMM_MINMAX_1X16__AVX2_BROADCAST, n_gt_16_strided_a) {
     TEST_REQUIRES_X86_AVX2;
-    for (uint32_t n = 9; n < 16; n++) {
+    for (uint32_t n = 17; n < 32; n++) {
       for (size_t k = 1; k <= 5; k += 2) {
         GemmMicrokernelTester()
           .mr(1)
-          .nr(8)
+          .nr(16)
           .kr(1)
           .sr(1)
           .m(1)
           .n(n)
           .k(k)
           .a_stride(7)
-          .Test(xnn_f16_gemm_minmax_ukernel_1x8__avx2_broadcast, xnn_init_f16_scaleminmax_avx_params);
+          .Test(xnn_f16_gemm_minmax_ukernel_1x16__avx2_broadcast, xnn_init_f16_scaleminmax_avx_params);
       }
     }
   }
 
-  TEST(F16_GEMM_MINMAX_1X8__AVX2_BROADCAST, n_gt_8_subtile) {
+  TEST(F16_GEMM_MINMAX_1X16__AVX2_BROADCAST, n_gt_16_subtile) {
     TEST_REQUIRES_X86_AVX2;
-    for (uint32_t n = 9; n < 16; n++) {
+    for (uint32_t n = 17; n < 32; n++) {
       for (size_t k = 1; k <= 5; k += 2) {
         for (uint32_t m = 1; m <= 1; m++) {
           GemmMicrokernelTester()
             .mr(1)
-            .nr(8)
+            .nr(16)
             .kr(1)
             .sr(1)
             .m(m)
             .n(n)
             .k(k)
             .iterations(1)
-            .Test(xnn_f16_gemm_minmax_ukernel_1x8__avx2_broadcast, xnn_init_f16_scaleminmax_avx_params);
+            .Test(xnn_f16_gemm_minmax_ukernel_1x16__avx2_broadcast, xnn_init_f16_scaleminmax_avx_params);
         }
       }
     }
   }
 
-  TEST(F16_GEMM_MINMAX_1X8__AVX2_BROADCAST, n_div_8) {
+  TEST(F16_GEMM_MINMAX_1X16__AVX2_BROADCAST, n_div_16) {
     TEST_REQUIRES_X86_AVX2;
-    for (uint32_t n = 16; n <= 24; n += 8) {
+    for (uint32_t n = 32; n <= 48; n += 16) {
       for (size_t k = 1; k <= 5; k += 2) {
         GemmMicrokernelTester()
           .mr(1)
-          .nr(8)
+          .nr(16)
           .kr(1)
           .sr(1)
           .m(1)
           .n(n)
           .k(k)
-          .Test(xnn_f16_gemm_minmax_ukernel_1x8__avx2_broadcast, xnn_init_f16_scaleminmax_avx_params);
+          .Test(xnn_f16_gemm_minmax_ukernel_1x16__avx2_broadcast, xnn_init_f16_scaleminmax_avx_params);
       }
     }
   }
 
-  TEST(F16_GEMM_MINMAX_1X8__AVX2_BROADCAST, n_div_8_strided_cn) {
+  TEST(F16_GEMM_MINMAX_1X16__AVX2_BROADCAST, n_div_16_strided_cn) {
     TEST_REQUIRES_X86_AVX2;
-    for (uint32_t n = 16; n <= 24; n += 8) {
+    for (uint32_t n = 32; n <= 48; n += 16) {
       for (size_t k = 1; k <= 5; k += 2) {
         GemmMicrokernelTester()
           .mr(1)
-          .nr(8)
+          .nr(16)
           .kr(1)
           .sr(1)
           .m(1)
           .n(n)
           .k(k)
-          .cn_stride(11)
-          .Test(xnn_f16_gemm_minmax_ukernel_1x8__avx2_broadcast, xnn_init_f16_scaleminmax_avx_params);
+          .cn_stride(19)
+          .Test(xnn_f16_gemm_minmax_ukernel_1x16__avx2_broadcast, xnn_init_f16_scaleminmax_avx_params);
       }
     }
   }
 
-  TEST(F16_GEMM_MINMAX_1X8__AVX2_BROADCAST, n_div_8_strided_a) {
+  TEST(F16_GEMM_MINMAX_1X16__AVX2_BROADCAST, n_div_16_strided_a) {
     TEST_REQUIRES_X86_AVX2;
-    for (uint32_t n = 16; n <= 24; n += 8) {
+    for (uint32_t n = 32; n <= 48; n += 16) {
       for (size_t k = 1; k <= 5; k += 2) {
         GemmMicrokernelTester()
           .mr(1)
-          .nr(8)
+          .nr(16)
           .kr(1)
           .sr(1)
           .m(1)
           .n(n)
           .k(k)
           .a_stride(7)
-          .Test(xnn_f16_gemm_minmax_ukernel_1x8__avx2_broadcast, xnn_init_f16_scaleminmax_avx_params);
+          .Test(xnn_f16_gemm_minmax_ukernel_1x16__avx2_broadcast, xnn_init_f16_scaleminmax_avx_params);
       }
     }
   }
 
-  TEST(F16_GEMM_MINMAX_1X8__AVX2_BROADCAST, n_div_8_subtile) {
+  TEST(F16_GEMM_MINMAX_1X16__AVX2_BROADCAST, n_div_16_subtile) {
     TEST_REQUIRES_X86_AVX2;
-    for (uint32_t n = 16; n <= 24; n += 8) {
+    for (uint32_t n = 32; n <= 48; n += 16) {
       for (size_t k = 1; k <= 5; k += 2) {
         for (uint32_t m = 1; m <= 1; m++) {
           GemmMicrokernelTester()
             .mr(1)
-            .nr(8)
+            .nr(16)
             .kr(1)
             .sr(1)
             .m(m)
             .n(n)
             .k(k)
             .iterations(1)
-            .Test(xnn_f16_gemm_minmax_ukernel_1x8__avx2_broadcast, xnn_init_f16_scaleminmax_avx_params);
+            .Test(xnn_f16_gemm_minmax_ukernel_1x16__avx2_broadcast, xnn_init_f16_scaleminmax_avx_params);
         }
       }
     }
   }
 
-  TEST(F16_GEMM_MINMAX_1X8__AVX2_BROADCAST, strided_cm_subtile) {
+  TEST(F16_GEMM_MINMAX_1X16__AVX2_BROADCAST, strided_cm_subtile) {
     TEST_REQUIRES_X86_AVX2;
     for (size_t k = 1; k <= 5; k += 2) {
-      for (uint32_t n = 1; n <= 8; n++) {
+      for (uint32_t n = 1; n <= 16; n++) {
         for (uint32_t m = 1; m <= 1; m++) {
           GemmMicrokernelTester()
             .mr(1)
-            .nr(8)
+            .nr(16)
             .kr(1)
             .sr(1)
             .m(m)
             .n(n)
             .k(k)
-            .cm_stride(11)
+            .cm_stride(19)
             .iterations(1)
-            .Test(xnn_f16_gemm_minmax_ukernel_1x8__avx2_broadcast, xnn_init_f16_scaleminmax_avx_params);
+            .Test(xnn_f16_gemm_minmax_ukernel_1x16__avx2_broadcast, xnn_init_f16_scaleminmax_avx_params);
         }
       }
     }
   }
 
-  TEST(F16_GEMM_MINMAX_1X8__AVX2_BROADCAST, qmin) {
+  TEST(F16_GEMM_MINMAX_1X16__AVX2_BROADCAST, qmin) {
     TEST_REQUIRES_X86_AVX2;
     GemmMicrokernelTester()
       .mr(1)
-      .nr(8)
+      .nr(16)
       .kr(1)
       .sr(1)
       .m(1)
-      .n(8)
+      .n(16)
       .k(1)
       .qmin(128)
-      .Test(xnn_f16_gemm_minmax_ukernel_1x8__avx2_broadcast, xnn_init_f16_scaleminmax_avx_params);
+      .Test(xnn_f16_gemm_minmax_ukernel_1x16__avx2_broadcast, xnn_init_f16_scaleminmax_avx_params);
   }
 
-  TEST(F16_GEMM_MINMAX_1X8__AVX2_BROADCAST, qmax) {
+  TEST(F16_GEMM_MINMAX_1X16__AVX2_BROADCAST, qmax) {
     TEST_REQUIRES_X86_AVX2;
     GemmMicrokernelTester()
       .mr(1)
-      .nr(8)
+      .nr(16)
       .kr(1)
       .sr(1)
       .m(1)
-      .n(8)
+      .n(16)
       .k(1)
       .qmax(128)
-      .Test(xnn_f16_gemm_minmax_ukernel_1x8__avx2_broadcast, xnn_init_f16_scaleminmax_avx_params);
+      .Test(xnn_f16_gemm_minmax_ukernel_1x16__avx2_broadcast, xnn_init_f16_scaleminmax_avx_params);
   }
 
-  TEST(F16_GEMM_MINMAX_1X8__AVX2_BROADCAST, strided_cm) {
+  TEST(F16_GEMM_MINMAX_1X16__AVX2_BROADCAST, strided_cm) {
     TEST_REQUIRES_X86_AVX2;
     GemmMicrokernelTester()
       .mr(1)
-      .nr(8)
+      .nr(16)
       .kr(1)
       .sr(1)
       .m(1)
-      .n(8)
+      .n(16)
       .k(1)
-      .cm_stride(11)
-      .Test(xnn_f16_gemm_minmax_ukernel_1x8__avx2_broadcast, xnn_init_f16_scaleminmax_avx_params);
+      .cm_stride(19)
+      .Test(xnn_f16_gemm_minmax_ukernel_1x16__avx2_broadcast, xnn_init_f16_scaleminmax_avx_params);
   }
 #endif  // XNN_ARCH_X86 || XNN_ARCH_X86_64
 
 
 #if XNN_ARCH_X86 || XNN_ARCH_X86_64
-  TEST(F16_GEMM_MINMAX_1X16__AVX2_BROADCAST, k_eq_1) {
+  TEST(F16_GEMM_MINMAX_1X16__AVX2_BROADCAST_ACC4, k_eq_4) {
     TEST_REQUIRES_X86_AVX2;
     GemmMicrokernelTester()
       .mr(1)
@@ -8139,11 +8949,11 @@
       .sr(1)
       .m(1)
       .n(16)
-      .k(1)
-      .Test(xnn_f16_gemm_minmax_ukernel_1x16__avx2_broadcast, xnn_init_f16_scaleminmax_avx_params);
+      .k(4)
+      .Test(xnn_f16_gemm_minmax_ukernel_1x16__avx2_broadcast_acc4, xnn_init_f16_scaleminmax_avx_params);
   }
 
-  TEST(F16_GEMM_MINMAX_1X16__AVX2_BROADCAST, strided_cn) {
+  TEST(F16_GEMM_MINMAX_1X16__AVX2_BROADCAST_ACC4, strided_cn) {
     TEST_REQUIRES_X86_AVX2;
     GemmMicrokernelTester()
       .mr(1)
@@ -8152,12 +8962,12 @@
       .sr(1)
       .m(1)
       .n(16)
-      .k(1)
+      .k(4)
       .cn_stride(19)
-      .Test(xnn_f16_gemm_minmax_ukernel_1x16__avx2_broadcast, xnn_init_f16_scaleminmax_avx_params);
+      .Test(xnn_f16_gemm_minmax_ukernel_1x16__avx2_broadcast_acc4, xnn_init_f16_scaleminmax_avx_params);
   }
 
-  TEST(F16_GEMM_MINMAX_1X16__AVX2_BROADCAST, k_eq_1_strided_a) {
+  TEST(F16_GEMM_MINMAX_1X16__AVX2_BROADCAST_ACC4, k_eq_4_strided_a) {
     TEST_REQUIRES_X86_AVX2;
     GemmMicrokernelTester()
       .mr(1)
@@ -8166,12 +8976,12 @@
       .sr(1)
       .m(1)
       .n(16)
-      .k(1)
-      .a_stride(3)
-      .Test(xnn_f16_gemm_minmax_ukernel_1x16__avx2_broadcast, xnn_init_f16_scaleminmax_avx_params);
+      .k(4)
+      .a_stride(7)
+      .Test(xnn_f16_gemm_minmax_ukernel_1x16__avx2_broadcast_acc4, xnn_init_f16_scaleminmax_avx_params);
   }
 
-  TEST(F16_GEMM_MINMAX_1X16__AVX2_BROADCAST, k_eq_1_subtile) {
+  TEST(F16_GEMM_MINMAX_1X16__AVX2_BROADCAST_ACC4, k_eq_4_subtile) {
     TEST_REQUIRES_X86_AVX2;
     for (uint32_t n = 1; n <= 16; n++) {
       for (uint32_t m = 1; m <= 1; m++) {
@@ -8182,14 +8992,14 @@
           .sr(1)
           .m(m)
           .n(n)
-          .k(1)
+          .k(4)
           .iterations(1)
-          .Test(xnn_f16_gemm_minmax_ukernel_1x16__avx2_broadcast, xnn_init_f16_scaleminmax_avx_params);
+          .Test(xnn_f16_gemm_minmax_ukernel_1x16__avx2_broadcast_acc4, xnn_init_f16_scaleminmax_avx_params);
       }
     }
   }
 
-  TEST(F16_GEMM_MINMAX_1X16__AVX2_BROADCAST, k_eq_1_subtile_m) {
+  TEST(F16_GEMM_MINMAX_1X16__AVX2_BROADCAST_ACC4, k_eq_4_subtile_m) {
     TEST_REQUIRES_X86_AVX2;
     for (uint32_t m = 1; m <= 1; m++) {
       GemmMicrokernelTester()
@@ -8199,13 +9009,13 @@
         .sr(1)
         .m(m)
         .n(16)
-        .k(1)
+        .k(4)
         .iterations(1)
-        .Test(xnn_f16_gemm_minmax_ukernel_1x16__avx2_broadcast, xnn_init_f16_scaleminmax_avx_params);
+        .Test(xnn_f16_gemm_minmax_ukernel_1x16__avx2_broadcast_acc4, xnn_init_f16_scaleminmax_avx_params);
     }
   }
 
-  TEST(F16_GEMM_MINMAX_1X16__AVX2_BROADCAST, k_eq_1_subtile_n) {
+  TEST(F16_GEMM_MINMAX_1X16__AVX2_BROADCAST_ACC4, k_eq_4_subtile_n) {
     TEST_REQUIRES_X86_AVX2;
     for (uint32_t n = 1; n <= 16; n++) {
       GemmMicrokernelTester()
@@ -8215,15 +9025,15 @@
         .sr(1)
         .m(1)
         .n(n)
-        .k(1)
+        .k(4)
         .iterations(1)
-        .Test(xnn_f16_gemm_minmax_ukernel_1x16__avx2_broadcast, xnn_init_f16_scaleminmax_avx_params);
+        .Test(xnn_f16_gemm_minmax_ukernel_1x16__avx2_broadcast_acc4, xnn_init_f16_scaleminmax_avx_params);
     }
   }
 
-  TEST(F16_GEMM_MINMAX_1X16__AVX2_BROADCAST, k_gt_1) {
+  TEST(F16_GEMM_MINMAX_1X16__AVX2_BROADCAST_ACC4, k_lt_4) {
     TEST_REQUIRES_X86_AVX2;
-    for (size_t k = 2; k < 10; k++) {
+    for (size_t k = 1; k < 4; k++) {
       GemmMicrokernelTester()
         .mr(1)
         .nr(16)
@@ -8232,13 +9042,64 @@
         .m(1)
         .n(16)
         .k(k)
-        .Test(xnn_f16_gemm_minmax_ukernel_1x16__avx2_broadcast, xnn_init_f16_scaleminmax_avx_params);
+        .Test(xnn_f16_gemm_minmax_ukernel_1x16__avx2_broadcast_acc4, xnn_init_f16_scaleminmax_avx_params);
     }
   }
 
-  TEST(F16_GEMM_MINMAX_1X16__AVX2_BROADCAST, k_gt_1_strided_a) {
+  TEST(F16_GEMM_MINMAX_1X16__AVX2_BROADCAST_ACC4, k_lt_4_strided_a) {
     TEST_REQUIRES_X86_AVX2;
-    for (size_t k = 2; k < 10; k++) {
+    for (size_t k = 1; k < 4; k++) {
+      GemmMicrokernelTester()
+        .mr(1)
+        .nr(16)
+        .kr(1)
+        .sr(1)
+        .m(1)
+        .n(16)
+        .k(k)
+        .a_stride(7)
+        .Test(xnn_f16_gemm_minmax_ukernel_1x16__avx2_broadcast_acc4, xnn_init_f16_scaleminmax_avx_params);
+    }
+  }
+
+  TEST(F16_GEMM_MINMAX_1X16__AVX2_BROADCAST_ACC4, k_lt_4_subtile) {
+    TEST_REQUIRES_X86_AVX2;
+    for (size_t k = 1; k < 4; k++) {
+      for (uint32_t n = 1; n <= 16; n++) {
+        for (uint32_t m = 1; m <= 1; m++) {
+          GemmMicrokernelTester()
+            .mr(1)
+            .nr(16)
+            .kr(1)
+            .sr(1)
+            .m(m)
+            .n(n)
+            .k(k)
+            .iterations(1)
+            .Test(xnn_f16_gemm_minmax_ukernel_1x16__avx2_broadcast_acc4, xnn_init_f16_scaleminmax_avx_params);
+        }
+      }
+    }
+  }
+
+  TEST(F16_GEMM_MINMAX_1X16__AVX2_BROADCAST_ACC4, k_gt_4) {
+    TEST_REQUIRES_X86_AVX2;
+    for (size_t k = 5; k < 8; k++) {
+      GemmMicrokernelTester()
+        .mr(1)
+        .nr(16)
+        .kr(1)
+        .sr(1)
+        .m(1)
+        .n(16)
+        .k(k)
+        .Test(xnn_f16_gemm_minmax_ukernel_1x16__avx2_broadcast_acc4, xnn_init_f16_scaleminmax_avx_params);
+    }
+  }
+
+  TEST(F16_GEMM_MINMAX_1X16__AVX2_BROADCAST_ACC4, k_gt_4_strided_a) {
+    TEST_REQUIRES_X86_AVX2;
+    for (size_t k = 5; k < 8; k++) {
       GemmMicrokernelTester()
         .mr(1)
         .nr(16)
@@ -8248,13 +9109,13 @@
         .n(16)
         .k(k)
         .a_stride(11)
-        .Test(xnn_f16_gemm_minmax_ukernel_1x16__avx2_broadcast, xnn_init_f16_scaleminmax_avx_params);
+        .Test(xnn_f16_gemm_minmax_ukernel_1x16__avx2_broadcast_acc4, xnn_init_f16_scaleminmax_avx_params);
     }
   }
 
-  TEST(F16_GEMM_MINMAX_1X16__AVX2_BROADCAST, k_gt_1_subtile) {
+  TEST(F16_GEMM_MINMAX_1X16__AVX2_BROADCAST_ACC4, k_gt_4_subtile) {
     TEST_REQUIRES_X86_AVX2;
-    for (size_t k = 2; k < 10; k++) {
+    for (size_t k = 5; k < 8; k++) {
       for (uint32_t n = 1; n <= 16; n++) {
         for (uint32_t m = 1; m <= 1; m++) {
           GemmMicrokernelTester()
@@ -8266,16 +9127,67 @@
             .n(n)
             .k(k)
             .iterations(1)
-            .Test(xnn_f16_gemm_minmax_ukernel_1x16__avx2_broadcast, xnn_init_f16_scaleminmax_avx_params);
+            .Test(xnn_f16_gemm_minmax_ukernel_1x16__avx2_broadcast_acc4, xnn_init_f16_scaleminmax_avx_params);
         }
       }
     }
   }
 
-  TEST(F16_GEMM_MINMAX_1X16__AVX2_BROADCAST, n_gt_16) {
+  TEST(F16_GEMM_MINMAX_1X16__AVX2_BROADCAST_ACC4, k_div_4) {
+    TEST_REQUIRES_X86_AVX2;
+    for (size_t k = 8; k <= 40; k += 4) {
+      GemmMicrokernelTester()
+        .mr(1)
+        .nr(16)
+        .kr(1)
+        .sr(1)
+        .m(1)
+        .n(16)
+        .k(k)
+        .Test(xnn_f16_gemm_minmax_ukernel_1x16__avx2_broadcast_acc4, xnn_init_f16_scaleminmax_avx_params);
+    }
+  }
+
+  TEST(F16_GEMM_MINMAX_1X16__AVX2_BROADCAST_ACC4, k_div_4_strided_a) {
+    TEST_REQUIRES_X86_AVX2;
+    for (size_t k = 8; k <= 40; k += 4) {
+      GemmMicrokernelTester()
+        .mr(1)
+        .nr(16)
+        .kr(1)
+        .sr(1)
+        .m(1)
+        .n(16)
+        .k(k)
+        .a_stride(43)
+        .Test(xnn_f16_gemm_minmax_ukernel_1x16__avx2_broadcast_acc4, xnn_init_f16_scaleminmax_avx_params);
+    }
+  }
+
+  TEST(F16_GEMM_MINMAX_1X16__AVX2_BROADCAST_ACC4, k_div_4_subtile) {
+    TEST_REQUIRES_X86_AVX2;
+    for (size_t k = 8; k <= 40; k += 4) {
+      for (uint32_t n = 1; n <= 16; n++) {
+        for (uint32_t m = 1; m <= 1; m++) {
+          GemmMicrokernelTester()
+            .mr(1)
+            .nr(16)
+            .kr(1)
+            .sr(1)
+            .m(m)
+            .n(n)
+            .k(k)
+            .iterations(1)
+            .Test(xnn_f16_gemm_minmax_ukernel_1x16__avx2_broadcast_acc4, xnn_init_f16_scaleminmax_avx_params);
+        }
+      }
+    }
+  }
+
+  TEST(F16_GEMM_MINMAX_1X16__AVX2_BROADCAST_ACC4, n_gt_16) {
     TEST_REQUIRES_X86_AVX2;
     for (uint32_t n = 17; n < 32; n++) {
-      for (size_t k = 1; k <= 5; k += 2) {
+      for (size_t k = 1; k <= 20; k += 5) {
         GemmMicrokernelTester()
           .mr(1)
           .nr(16)
@@ -8284,15 +9196,15 @@
           .m(1)
           .n(n)
           .k(k)
-          .Test(xnn_f16_gemm_minmax_ukernel_1x16__avx2_broadcast, xnn_init_f16_scaleminmax_avx_params);
+          .Test(xnn_f16_gemm_minmax_ukernel_1x16__avx2_broadcast_acc4, xnn_init_f16_scaleminmax_avx_params);
       }
     }
   }
 
-  TEST(F16_GEMM_MINMAX_1X16__AVX2_BROADCAST, n_gt_16_strided_cn) {
+  TEST(F16_GEMM_MINMAX_1X16__AVX2_BROADCAST_ACC4, n_gt_16_strided_cn) {
     TEST_REQUIRES_X86_AVX2;
     for (uint32_t n = 17; n < 32; n++) {
-      for (size_t k = 1; k <= 5; k += 2) {
+      for (size_t k = 1; k <= 20; k += 5) {
         GemmMicrokernelTester()
           .mr(1)
           .nr(16)
@@ -8302,15 +9214,15 @@
           .n(n)
           .k(k)
           .cn_stride(19)
-          .Test(xnn_f16_gemm_minmax_ukernel_1x16__avx2_broadcast, xnn_init_f16_scaleminmax_avx_params);
+          .Test(xnn_f16_gemm_minmax_ukernel_1x16__avx2_broadcast_acc4, xnn_init_f16_scaleminmax_avx_params);
       }
     }
   }
 
-  TEST(F16_GEMM_MINMAX_1X16__AVX2_BROADCAST, n_gt_16_strided_a) {
+  TEST(F16_GEMM_MINMAX_1X16__AVX2_BROADCAST_ACC4, n_gt_16_strided_a) {
     TEST_REQUIRES_X86_AVX2;
     for (uint32_t n = 17; n < 32; n++) {
-      for (size_t k = 1; k <= 5; k += 2) {
+      for (size_t k = 1; k <= 20; k += 5) {
         GemmMicrokernelTester()
           .mr(1)
           .nr(16)
@@ -8319,16 +9231,16 @@
           .m(1)
           .n(n)
           .k(k)
-          .a_stride(7)
-          .Test(xnn_f16_gemm_minmax_ukernel_1x16__avx2_broadcast, xnn_init_f16_scaleminmax_avx_params);
+          .a_stride(23)
+          .Test(xnn_f16_gemm_minmax_ukernel_1x16__avx2_broadcast_acc4, xnn_init_f16_scaleminmax_avx_params);
       }
     }
   }
 
-  TEST(F16_GEMM_MINMAX_1X16__AVX2_BROADCAST, n_gt_16_subtile) {
+  TEST(F16_GEMM_MINMAX_1X16__AVX2_BROADCAST_ACC4, n_gt_16_subtile) {
     TEST_REQUIRES_X86_AVX2;
     for (uint32_t n = 17; n < 32; n++) {
-      for (size_t k = 1; k <= 5; k += 2) {
+      for (size_t k = 1; k <= 20; k += 5) {
         for (uint32_t m = 1; m <= 1; m++) {
           GemmMicrokernelTester()
             .mr(1)
@@ -8339,16 +9251,16 @@
             .n(n)
             .k(k)
             .iterations(1)
-            .Test(xnn_f16_gemm_minmax_ukernel_1x16__avx2_broadcast, xnn_init_f16_scaleminmax_avx_params);
+            .Test(xnn_f16_gemm_minmax_ukernel_1x16__avx2_broadcast_acc4, xnn_init_f16_scaleminmax_avx_params);
         }
       }
     }
   }
 
-  TEST(F16_GEMM_MINMAX_1X16__AVX2_BROADCAST, n_div_16) {
+  TEST(F16_GEMM_MINMAX_1X16__AVX2_BROADCAST_ACC4, n_div_16) {
     TEST_REQUIRES_X86_AVX2;
     for (uint32_t n = 32; n <= 48; n += 16) {
-      for (size_t k = 1; k <= 5; k += 2) {
+      for (size_t k = 1; k <= 20; k += 5) {
         GemmMicrokernelTester()
           .mr(1)
           .nr(16)
@@ -8357,15 +9269,15 @@
           .m(1)
           .n(n)
           .k(k)
-          .Test(xnn_f16_gemm_minmax_ukernel_1x16__avx2_broadcast, xnn_init_f16_scaleminmax_avx_params);
+          .Test(xnn_f16_gemm_minmax_ukernel_1x16__avx2_broadcast_acc4, xnn_init_f16_scaleminmax_avx_params);
       }
     }
   }
 
-  TEST(F16_GEMM_MINMAX_1X16__AVX2_BROADCAST, n_div_16_strided_cn) {
+  TEST(F16_GEMM_MINMAX_1X16__AVX2_BROADCAST_ACC4, n_div_16_strided_cn) {
     TEST_REQUIRES_X86_AVX2;
     for (uint32_t n = 32; n <= 48; n += 16) {
-      for (size_t k = 1; k <= 5; k += 2) {
+      for (size_t k = 1; k <= 20; k += 5) {
         GemmMicrokernelTester()
           .mr(1)
           .nr(16)
@@ -8375,15 +9287,15 @@
           .n(n)
           .k(k)
           .cn_stride(19)
-          .Test(xnn_f16_gemm_minmax_ukernel_1x16__avx2_broadcast, xnn_init_f16_scaleminmax_avx_params);
+          .Test(xnn_f16_gemm_minmax_ukernel_1x16__avx2_broadcast_acc4, xnn_init_f16_scaleminmax_avx_params);
       }
     }
   }
 
-  TEST(F16_GEMM_MINMAX_1X16__AVX2_BROADCAST, n_div_16_strided_a) {
+  TEST(F16_GEMM_MINMAX_1X16__AVX2_BROADCAST_ACC4, n_div_16_strided_a) {
     TEST_REQUIRES_X86_AVX2;
     for (uint32_t n = 32; n <= 48; n += 16) {
-      for (size_t k = 1; k <= 5; k += 2) {
+      for (size_t k = 1; k <= 20; k += 5) {
         GemmMicrokernelTester()
           .mr(1)
           .nr(16)
@@ -8392,16 +9304,16 @@
           .m(1)
           .n(n)
           .k(k)
-          .a_stride(7)
-          .Test(xnn_f16_gemm_minmax_ukernel_1x16__avx2_broadcast, xnn_init_f16_scaleminmax_avx_params);
+          .a_stride(23)
+          .Test(xnn_f16_gemm_minmax_ukernel_1x16__avx2_broadcast_acc4, xnn_init_f16_scaleminmax_avx_params);
       }
     }
   }
 
-  TEST(F16_GEMM_MINMAX_1X16__AVX2_BROADCAST, n_div_16_subtile) {
+  TEST(F16_GEMM_MINMAX_1X16__AVX2_BROADCAST_ACC4, n_div_16_subtile) {
     TEST_REQUIRES_X86_AVX2;
     for (uint32_t n = 32; n <= 48; n += 16) {
-      for (size_t k = 1; k <= 5; k += 2) {
+      for (size_t k = 1; k <= 20; k += 5) {
         for (uint32_t m = 1; m <= 1; m++) {
           GemmMicrokernelTester()
             .mr(1)
@@ -8412,15 +9324,15 @@
             .n(n)
             .k(k)
             .iterations(1)
-            .Test(xnn_f16_gemm_minmax_ukernel_1x16__avx2_broadcast, xnn_init_f16_scaleminmax_avx_params);
+            .Test(xnn_f16_gemm_minmax_ukernel_1x16__avx2_broadcast_acc4, xnn_init_f16_scaleminmax_avx_params);
         }
       }
     }
   }
 
-  TEST(F16_GEMM_MINMAX_1X16__AVX2_BROADCAST, strided_cm_subtile) {
+  TEST(F16_GEMM_MINMAX_1X16__AVX2_BROADCAST_ACC4, strided_cm_subtile) {
     TEST_REQUIRES_X86_AVX2;
-    for (size_t k = 1; k <= 5; k += 2) {
+    for (size_t k = 1; k <= 20; k += 5) {
       for (uint32_t n = 1; n <= 16; n++) {
         for (uint32_t m = 1; m <= 1; m++) {
           GemmMicrokernelTester()
@@ -8433,13 +9345,13 @@
             .k(k)
             .cm_stride(19)
             .iterations(1)
-            .Test(xnn_f16_gemm_minmax_ukernel_1x16__avx2_broadcast, xnn_init_f16_scaleminmax_avx_params);
+            .Test(xnn_f16_gemm_minmax_ukernel_1x16__avx2_broadcast_acc4, xnn_init_f16_scaleminmax_avx_params);
         }
       }
     }
   }
 
-  TEST(F16_GEMM_MINMAX_1X16__AVX2_BROADCAST, qmin) {
+  TEST(F16_GEMM_MINMAX_1X16__AVX2_BROADCAST_ACC4, qmin) {
     TEST_REQUIRES_X86_AVX2;
     GemmMicrokernelTester()
       .mr(1)
@@ -8448,12 +9360,12 @@
       .sr(1)
       .m(1)
       .n(16)
-      .k(1)
+      .k(4)
       .qmin(128)
-      .Test(xnn_f16_gemm_minmax_ukernel_1x16__avx2_broadcast, xnn_init_f16_scaleminmax_avx_params);
+      .Test(xnn_f16_gemm_minmax_ukernel_1x16__avx2_broadcast_acc4, xnn_init_f16_scaleminmax_avx_params);
   }
 
-  TEST(F16_GEMM_MINMAX_1X16__AVX2_BROADCAST, qmax) {
+  TEST(F16_GEMM_MINMAX_1X16__AVX2_BROADCAST_ACC4, qmax) {
     TEST_REQUIRES_X86_AVX2;
     GemmMicrokernelTester()
       .mr(1)
@@ -8462,12 +9374,12 @@
       .sr(1)
       .m(1)
       .n(16)
-      .k(1)
+      .k(4)
       .qmax(128)
-      .Test(xnn_f16_gemm_minmax_ukernel_1x16__avx2_broadcast, xnn_init_f16_scaleminmax_avx_params);
+      .Test(xnn_f16_gemm_minmax_ukernel_1x16__avx2_broadcast_acc4, xnn_init_f16_scaleminmax_avx_params);
   }
 
-  TEST(F16_GEMM_MINMAX_1X16__AVX2_BROADCAST, strided_cm) {
+  TEST(F16_GEMM_MINMAX_1X16__AVX2_BROADCAST_ACC4, strided_cm) {
     TEST_REQUIRES_X86_AVX2;
     GemmMicrokernelTester()
       .mr(1)
@@ -8476,9 +9388,9 @@
       .sr(1)
       .m(1)
       .n(16)
-      .k(1)
+      .k(4)
       .cm_stride(19)
-      .Test(xnn_f16_gemm_minmax_ukernel_1x16__avx2_broadcast, xnn_init_f16_scaleminmax_avx_params);
+      .Test(xnn_f16_gemm_minmax_ukernel_1x16__avx2_broadcast_acc4, xnn_init_f16_scaleminmax_avx_params);
   }
 #endif  // XNN_ARCH_X86 || XNN_ARCH_X86_64
 
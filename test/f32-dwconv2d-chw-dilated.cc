@@ -0,0 +1,571 @@
+// Copyright 2022 Google LLC
+//
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree.
+
+#include <gtest/gtest.h>
+
+#include <xnnpack/common.h>
+#include <xnnpack/isa-checks.h>
+
+#include <xnnpack/dwconv.h>
+#include "dwconv2d-microkernel-tester.h"
+
+
+#if XNN_ARCH_X86 || XNN_ARCH_X86_64
+  TEST(F32_DWCONV2D_CHW_DILATED__SSE_1X4, kernel_3x3_dilation_2) {
+    TEST_REQUIRES_X86_SSE;
+    for (size_t input_width = 1; input_width < 25; input_width++) {
+      for (size_t input_height = 1; input_height < 7; input_height++) {
+        DWConv2DMicrokernelTester()
+          .input_width(input_width)
+          .input_height(input_height)
+          .kernel_height(3)
+          .kernel_width(3)
+          .subsampling(1)
+          .dilation(2)
+          .padding_left(2)
+          .padding_right(2)
+          .padding_top(2)
+          .padding_bottom(2)
+          .Test(xnn_f32_dwconv2d_chw_ukernel_dilated__sse_1x4, xnn_init_f32_minmax_sse_params);
+      }
+    }
+  }
+
+  TEST(F32_DWCONV2D_CHW_DILATED__SSE_1X4, kernel_3x3_dilation_4) {
+    TEST_REQUIRES_X86_SSE;
+    for (size_t input_width = 1; input_width < 25; input_width++) {
+      for (size_t input_height = 1; input_height < 7; input_height++) {
+        DWConv2DMicrokernelTester()
+          .input_width(input_width)
+          .input_height(input_height)
+          .kernel_height(3)
+          .kernel_width(3)
+          .subsampling(1)
+          .dilation(4)
+          .padding_left(4)
+          .padding_right(4)
+          .padding_top(4)
+          .padding_bottom(4)
+          .Test(xnn_f32_dwconv2d_chw_ukernel_dilated__sse_1x4, xnn_init_f32_minmax_sse_params);
+      }
+    }
+  }
+
+  TEST(F32_DWCONV2D_CHW_DILATED__SSE_1X4, kernel_3x3_dilation_2_subsampling_2) {
+    TEST_REQUIRES_X86_SSE;
+    for (size_t input_width = 1; input_width < 25; input_width++) {
+      for (size_t input_height = 1; input_height < 7; input_height++) {
+        DWConv2DMicrokernelTester()
+          .input_width(input_width)
+          .input_height(input_height)
+          .kernel_height(3)
+          .kernel_width(3)
+          .subsampling(2)
+          .dilation(2)
+          .padding_left(2)
+          .padding_right(2)
+          .padding_top(2)
+          .padding_bottom(2)
+          .Test(xnn_f32_dwconv2d_chw_ukernel_dilated__sse_1x4, xnn_init_f32_minmax_sse_params);
+      }
+    }
+  }
+
+  TEST(F32_DWCONV2D_CHW_DILATED__SSE_1X4, kernel_5x5_dilation_2) {
+    TEST_REQUIRES_X86_SSE;
+    for (size_t input_width = 1; input_width < 25; input_width++) {
+      for (size_t input_height = 1; input_height < 7; input_height++) {
+        DWConv2DMicrokernelTester()
+          .input_width(input_width)
+          .input_height(input_height)
+          .kernel_height(5)
+          .kernel_width(5)
+          .subsampling(1)
+          .dilation(2)
+          .padding_left(4)
+          .padding_right(4)
+          .padding_top(4)
+          .padding_bottom(4)
+          .Test(xnn_f32_dwconv2d_chw_ukernel_dilated__sse_1x4, xnn_init_f32_minmax_sse_params);
+      }
+    }
+  }
+
+  TEST(F32_DWCONV2D_CHW_DILATED__SSE_1X4, kernel_7x7) {
+    TEST_REQUIRES_X86_SSE;
+    for (size_t input_width = 1; input_width < 25; input_width++) {
+      for (size_t input_height = 1; input_height < 7; input_height++) {
+        DWConv2DMicrokernelTester()
+          .input_width(input_width)
+          .input_height(input_height)
+          .kernel_height(7)
+          .kernel_width(7)
+          .subsampling(1)
+          .padding_left(3)
+          .padding_right(3)
+          .padding_top(3)
+          .padding_bottom(3)
+          .Test(xnn_f32_dwconv2d_chw_ukernel_dilated__sse_1x4, xnn_init_f32_minmax_sse_params);
+      }
+    }
+  }
+
+  TEST(F32_DWCONV2D_CHW_DILATED__SSE_1X4, kernel_7x7_subsampling_2) {
+    TEST_REQUIRES_X86_SSE;
+    for (size_t input_width = 1; input_width < 25; input_width++) {
+      for (size_t input_height = 1; input_height < 7; input_height++) {
+        DWConv2DMicrokernelTester()
+          .input_width(input_width)
+          .input_height(input_height)
+          .kernel_height(7)
+          .kernel_width(7)
+          .subsampling(2)
+          .padding_left(3)
+          .padding_right(3)
+          .padding_top(3)
+          .padding_bottom(3)
+          .Test(xnn_f32_dwconv2d_chw_ukernel_dilated__sse_1x4, xnn_init_f32_minmax_sse_params);
+      }
+    }
+  }
+
+  TEST(F32_DWCONV2D_CHW_DILATED__SSE_1X4, kernel_7x7_dilation_2) {
+    TEST_REQUIRES_X86_SSE;
+    for (size_t input_width = 1; input_width < 25; input_width++) {
+      for (size_t input_height = 1; input_height < 7; input_height++) {
+        DWConv2DMicrokernelTester()
+          .input_width(input_width)
+          .input_height(input_height)
+          .kernel_height(7)
+          .kernel_width(7)
+          .subsampling(1)
+          .dilation(2)
+          .padding_left(6)
+          .padding_right(6)
+          .padding_top(6)
+          .padding_bottom(6)
+          .Test(xnn_f32_dwconv2d_chw_ukernel_dilated__sse_1x4, xnn_init_f32_minmax_sse_params);
+      }
+    }
+  }
+
+  TEST(F32_DWCONV2D_CHW_DILATED__SSE_1X4, kernel_3x1_dilation_3) {
+    TEST_REQUIRES_X86_SSE;
+    for (size_t input_width = 1; input_width < 25; input_width++) {
+      for (size_t input_height = 1; input_height < 7; input_height++) {
+        DWConv2DMicrokernelTester()
+          .input_width(input_width)
+          .input_height(input_height)
+          .kernel_height(3)
+          .kernel_width(1)
+          .subsampling(1)
+          .dilation_height(3)
+          .dilation_width(1)
+          .padding_top(3)
+          .padding_bottom(3)
+          .Test(xnn_f32_dwconv2d_chw_ukernel_dilated__sse_1x4, xnn_init_f32_minmax_sse_params);
+      }
+    }
+  }
+
+  TEST(F32_DWCONV2D_CHW_DILATED__SSE_1X4, kernel_1x3_dilation_3) {
+    TEST_REQUIRES_X86_SSE;
+    for (size_t input_width = 1; input_width < 25; input_width++) {
+      for (size_t input_height = 1; input_height < 7; input_height++) {
+        DWConv2DMicrokernelTester()
+          .input_width(input_width)
+          .input_height(input_height)
+          .kernel_height(1)
+          .kernel_width(3)
+          .subsampling(1)
+          .dilation_height(1)
+          .dilation_width(3)
+          .padding_left(3)
+          .padding_right(3)
+          .Test(xnn_f32_dwconv2d_chw_ukernel_dilated__sse_1x4, xnn_init_f32_minmax_sse_params);
+      }
+    }
+  }
+
+  TEST(F32_DWCONV2D_CHW_DILATED__SSE_1X4, kernel_1x7) {
+    TEST_REQUIRES_X86_SSE;
+    for (size_t input_width = 1; input_width < 25; input_width++) {
+      for (size_t input_height = 1; input_height < 7; input_height++) {
+        DWConv2DMicrokernelTester()
+          .input_width(input_width)
+          .input_height(input_height)
+          .kernel_height(1)
+          .kernel_width(7)
+          .subsampling(1)
+          .padding_left(3)
+          .padding_right(3)
+          .Test(xnn_f32_dwconv2d_chw_ukernel_dilated__sse_1x4, xnn_init_f32_minmax_sse_params);
+      }
+    }
+  }
+
+  TEST(F32_DWCONV2D_CHW_DILATED__SSE_1X4, kernel_3x3_subsampling_3) {
+    TEST_REQUIRES_X86_SSE;
+    for (size_t input_width = 1; input_width < 25; input_width++) {
+      for (size_t input_height = 1; input_height < 7; input_height++) {
+        DWConv2DMicrokernelTester()
+          .input_width(input_width)
+          .input_height(input_height)
+          .kernel_height(3)
+          .kernel_width(3)
+          .subsampling(3)
+          .padding_left(1)
+          .padding_right(1)
+          .padding_top(1)
+          .padding_bottom(1)
+          .Test(xnn_f32_dwconv2d_chw_ukernel_dilated__sse_1x4, xnn_init_f32_minmax_sse_params);
+      }
+    }
+  }
+
+  TEST(F32_DWCONV2D_CHW_DILATED__SSE_1X4, kernel_3x3_asymmetric) {
+    TEST_REQUIRES_X86_SSE;
+    for (size_t input_width = 2; input_width < 26; input_width++) {
+      for (size_t input_height = 2; input_height < 8; input_height++) {
+        DWConv2DMicrokernelTester()
+          .input_width(input_width)
+          .input_height(input_height)
+          .kernel_height(3)
+          .kernel_width(3)
+          .subsampling_height(2)
+          .subsampling_width(1)
+          .dilation_height(1)
+          .dilation_width(3)
+          .padding_left(3)
+          .padding_right(2)
+          .padding_top(1)
+          .Test(xnn_f32_dwconv2d_chw_ukernel_dilated__sse_1x4, xnn_init_f32_minmax_sse_params);
+      }
+    }
+  }
+
+  TEST(F32_DWCONV2D_CHW_DILATED__SSE_1X4, kernel_3x3_no_padding) {
+    TEST_REQUIRES_X86_SSE;
+    for (size_t input_width = 5; input_width < 29; input_width++) {
+      for (size_t input_height = 5; input_height < 11; input_height++) {
+        DWConv2DMicrokernelTester()
+          .input_width(input_width)
+          .input_height(input_height)
+          .kernel_height(3)
+          .kernel_width(3)
+          .subsampling(1)
+          .dilation(2)
+          .Test(xnn_f32_dwconv2d_chw_ukernel_dilated__sse_1x4, xnn_init_f32_minmax_sse_params);
+      }
+    }
+  }
+
+  TEST(F32_DWCONV2D_CHW_DILATED__SSE_1X4, qmin) {
+    TEST_REQUIRES_X86_SSE;
+    for (size_t input_width = 1; input_width < 24; input_width++) {
+      DWConv2DMicrokernelTester()
+        .input_width(input_width)
+        .input_height(7)
+        .kernel_height(3)
+        .kernel_width(3)
+        .dilation(2)
+        .padding_left(2)
+        .padding_right(2)
+        .padding_top(2)
+        .padding_bottom(2)
+        .qmin(128)
+        .Test(xnn_f32_dwconv2d_chw_ukernel_dilated__sse_1x4, xnn_init_f32_minmax_sse_params);
+    }
+  }
+
+  TEST(F32_DWCONV2D_CHW_DILATED__SSE_1X4, qmax) {
+    TEST_REQUIRES_X86_SSE;
+    for (size_t input_width = 1; input_width < 24; input_width++) {
+      DWConv2DMicrokernelTester()
+        .input_width(input_width)
+        .input_height(7)
+        .kernel_height(3)
+        .kernel_width(3)
+        .dilation(2)
+        .padding_left(2)
+        .padding_right(2)
+        .padding_top(2)
+        .padding_bottom(2)
+        .qmax(128)
+        .Test(xnn_f32_dwconv2d_chw_ukernel_dilated__sse_1x4, xnn_init_f32_minmax_sse_params);
+    }
+  }
+#endif  // XNN_ARCH_X86 || XNN_ARCH_X86_64
+
+
+TEST(F32_DWCONV2D_CHW_DILATED__SCALAR_1X1, kernel_3x3_dilation_2) {
+  for (size_t input_width = 1; input_width < 25; input_width++) {
+    for (size_t input_height = 1; input_height < 7; input_height++) {
+      DWConv2DMicrokernelTester()
+        .input_width(input_width)
+        .input_height(input_height)
+        .kernel_height(3)
+        .kernel_width(3)
+        .subsampling(1)
+        .dilation(2)
+        .padding_left(2)
+        .padding_right(2)
+        .padding_top(2)
+        .padding_bottom(2)
+        .Test(xnn_f32_dwconv2d_chw_ukernel_dilated__scalar_1x1, xnn_init_f32_minmax_scalar_params);
+    }
+  }
+}
+
+TEST(F32_DWCONV2D_CHW_DILATED__SCALAR_1X1, kernel_3x3_dilation_4) {
+  for (size_t input_width = 1; input_width < 25; input_width++) {
+    for (size_t input_height = 1; input_height < 7; input_height++) {
+      DWConv2DMicrokernelTester()
+        .input_width(input_width)
+        .input_height(input_height)
+        .kernel_height(3)
+        .kernel_width(3)
+        .subsampling(1)
+        .dilation(4)
+        .padding_left(4)
+        .padding_right(4)
+        .padding_top(4)
+        .padding_bottom(4)
+        .Test(xnn_f32_dwconv2d_chw_ukernel_dilated__scalar_1x1, xnn_init_f32_minmax_scalar_params);
+    }
+  }
+}
+
+TEST(F32_DWCONV2D_CHW_DILATED__SCALAR_1X1, kernel_3x3_dilation_2_subsampling_2) {
+  for (size_t input_width = 1; input_width < 25; input_width++) {
+    for (size_t input_height = 1; input_height < 7; input_height++) {
+      DWConv2DMicrokernelTester()
+        .input_width(input_width)
+        .input_height(input_height)
+        .kernel_height(3)
+        .kernel_width(3)
+        .subsampling(2)
+        .dilation(2)
+        .padding_left(2)
+        .padding_right(2)
+        .padding_top(2)
+        .padding_bottom(2)
+        .Test(xnn_f32_dwconv2d_chw_ukernel_dilated__scalar_1x1, xnn_init_f32_minmax_scalar_params);
+    }
+  }
+}
+
+TEST(F32_DWCONV2D_CHW_DILATED__SCALAR_1X1, kernel_5x5_dilation_2) {
+  for (size_t input_width = 1; input_width < 25; input_width++) {
+    for (size_t input_height = 1; input_height < 7; input_height++) {
+      DWConv2DMicrokernelTester()
+        .input_width(input_width)
+        .input_height(input_height)
+        .kernel_height(5)
+        .kernel_width(5)
+        .subsampling(1)
+        .dilation(2)
+        .padding_left(4)
+        .padding_right(4)
+        .padding_top(4)
+        .padding_bottom(4)
+        .Test(xnn_f32_dwconv2d_chw_ukernel_dilated__scalar_1x1, xnn_init_f32_minmax_scalar_params);
+    }
+  }
+}
+
+TEST(F32_DWCONV2D_CHW_DILATED__SCALAR_1X1, kernel_7x7) {
+  for (size_t input_width = 1; input_width < 25; input_width++) {
+    for (size_t input_height = 1; input_height < 7; input_height++) {
+      DWConv2DMicrokernelTester()
+        .input_width(input_width)
+        .input_height(input_height)
+        .kernel_height(7)
+        .kernel_width(7)
+        .subsampling(1)
+        .padding_left(3)
+        .padding_right(3)
+        .padding_top(3)
+        .padding_bottom(3)
+        .Test(xnn_f32_dwconv2d_chw_ukernel_dilated__scalar_1x1, xnn_init_f32_minmax_scalar_params);
+    }
+  }
+}
+
+TEST(F32_DWCONV2D_CHW_DILATED__SCALAR_1X1, kernel_7x7_subsampling_2) {
+  for (size_t input_width = 1; input_width < 25; input_width++) {
+    for (size_t input_height = 1; input_height < 7; input_height++) {
+      DWConv2DMicrokernelTester()
+        .input_width(input_width)
+        .input_height(input_height)
+        .kernel_height(7)
+        .kernel_width(7)
+        .subsampling(2)
+        .padding_left(3)
+        .padding_right(3)
+        .padding_top(3)
+        .padding_bottom(3)
+        .Test(xnn_f32_dwconv2d_chw_ukernel_dilated__scalar_1x1, xnn_init_f32_minmax_scalar_params);
+    }
+  }
+}
+
+TEST(F32_DWCONV2D_CHW_DILATED__SCALAR_1X1, kernel_7x7_dilation_2) {
+  for (size_t input_width = 1; input_width < 25; input_width++) {
+    for (size_t input_height = 1; input_height < 7; input_height++) {
+      DWConv2DMicrokernelTester()
+        .input_width(input_width)
+        .input_height(input_height)
+        .kernel_height(7)
+        .kernel_width(7)
+        .subsampling(1)
+        .dilation(2)
+        .padding_left(6)
+        .padding_right(6)
+        .padding_top(6)
+        .padding_bottom(6)
+        .Test(xnn_f32_dwconv2d_chw_ukernel_dilated__scalar_1x1, xnn_init_f32_minmax_scalar_params);
+    }
+  }
+}
+
+TEST(F32_DWCONV2D_CHW_DILATED__SCALAR_1X1, kernel_3x1_dilation_3) {
+  for (size_t input_width = 1; input_width < 25; input_width++) {
+    for (size_t input_height = 1; input_height < 7; input_height++) {
+      DWConv2DMicrokernelTester()
+        .input_width(input_width)
+        .input_height(input_height)
+        .kernel_height(3)
+        .kernel_width(1)
+        .subsampling(1)
+        .dilation_height(3)
+        .dilation_width(1)
+        .padding_top(3)
+        .padding_bottom(3)
+        .Test(xnn_f32_dwconv2d_chw_ukernel_dilated__scalar_1x1, xnn_init_f32_minmax_scalar_params);
+    }
+  }
+}
+
+TEST(F32_DWCONV2D_CHW_DILATED__SCALAR_1X1, kernel_1x3_dilation_3) {
+  for (size_t input_width = 1; input_width < 25; input_width++) {
+    for (size_t input_height = 1; input_height < 7; input_height++) {
+      DWConv2DMicrokernelTester()
+        .input_width(input_width)
+        .input_height(input_height)
+        .kernel_height(1)
+        .kernel_width(3)
+        .subsampling(1)
+        .dilation_height(1)
+        .dilation_width(3)
+        .padding_left(3)
+        .padding_right(3)
+        .Test(xnn_f32_dwconv2d_chw_ukernel_dilated__scalar_1x1, xnn_init_f32_minmax_scalar_params);
+    }
+  }
+}
+
+TEST(F32_DWCONV2D_CHW_DILATED__SCALAR_1X1, kernel_1x7) {
+  for (size_t input_width = 1; input_width < 25; input_width++) {
+    for (size_t input_height = 1; input_height < 7; input_height++) {
+      DWConv2DMicrokernelTester()
+        .input_width(input_width)
+        .input_height(input_height)
+        .kernel_height(1)
+        .kernel_width(7)
+        .subsampling(1)
+        .padding_left(3)
+        .padding_right(3)
+        .Test(xnn_f32_dwconv2d_chw_ukernel_dilated__scalar_1x1, xnn_init_f32_minmax_scalar_params);
+    }
+  }
+}
+
+TEST(F32_DWCONV2D_CHW_DILATED__SCALAR_1X1, kernel_3x3_subsampling_3) {
+  for (size_t input_width = 1; input_width < 25; input_width++) {
+    for (size_t input_height = 1; input_height < 7; input_height++) {
+      DWConv2DMicrokernelTester()
+        .input_width(input_width)
+        .input_height(input_height)
+        .kernel_height(3)
+        .kernel_width(3)
+        .subsampling(3)
+        .padding_left(1)
+        .padding_right(1)
+        .padding_top(1)
+        .padding_bottom(1)
+        .Test(xnn_f32_dwconv2d_chw_ukernel_dilated__scalar_1x1, xnn_init_f32_minmax_scalar_params);
+    }
+  }
+}
+
+TEST(F32_DWCONV2D_CHW_DILATED__SCALAR_1X1, kernel_3x3_asymmetric) {
+  for (size_t input_width = 2; input_width < 26; input_width++) {
+    for (size_t input_height = 2; input_height < 8; input_height++) {
+      DWConv2DMicrokernelTester()
+        .input_width(input_width)
+        .input_height(input_height)
+        .kernel_height(3)
+        .kernel_width(3)
+        .subsampling_height(2)
+        .subsampling_width(1)
+        .dilation_height(1)
+        .dilation_width(3)
+        .padding_left(3)
+        .padding_right(2)
+        .padding_top(1)
+        .Test(xnn_f32_dwconv2d_chw_ukernel_dilated__scalar_1x1, xnn_init_f32_minmax_scalar_params);
+    }
+  }
+}
+
+TEST(F32_DWCONV2D_CHW_DILATED__SCALAR_1X1, kernel_3x3_no_padding) {
+  for (size_t input_width = 5; input_width < 29; input_width++) {
+    for (size_t input_height = 5; input_height < 11; input_height++) {
+      DWConv2DMicrokernelTester()
+        .input_width(input_width)
+        .input_height(input_height)
+        .kernel_height(3)
+        .kernel_width(3)
+        .subsampling(1)
+        .dilation(2)
+        .Test(xnn_f32_dwconv2d_chw_ukernel_dilated__scalar_1x1, xnn_init_f32_minmax_scalar_params);
+    }
+  }
+}
+
+TEST(F32_DWCONV2D_CHW_DILATED__SCALAR_1X1, qmin) {
+  for (size_t input_width = 1; input_width < 24; input_width++) {
+    DWConv2DMicrokernelTester()
+      .input_width(input_width)
+      .input_height(7)
+      .kernel_height(3)
+      .kernel_width(3)
+      .dilation(2)
+      .padding_left(2)
+      .padding_right(2)
+      .padding_top(2)
+      .padding_bottom(2)
+      .qmin(128)
+      .Test(xnn_f32_dwconv2d_chw_ukernel_dilated__scalar_1x1, xnn_init_f32_minmax_scalar_params);
+  }
+}
+
+TEST(F32_DWCONV2D_CHW_DILATED__SCALAR_1X1, qmax) {
+  for (size_t input_width = 1; input_width < 24; input_width++) {
+    DWConv2DMicrokernelTester()
+      .input_width(input_width)
+      .input_height(7)
+      .kernel_height(3)
+      .kernel_width(3)
+      .dilation(2)
+      .padding_left(2)
+      .padding_right(2)
+      .padding_top(2)
+      .padding_bottom(2)
+      .qmax(128)
+      .Test(xnn_f32_dwconv2d_chw_ukernel_dilated__scalar_1x1, xnn_init_f32_minmax_scalar_params);
+  }
+}
@@ -8289,8 +8289,8 @@
 
 
 #if XNN_ARCH_ARM || XNN_ARCH_ARM64
-  TEST(F32_GEMM_MINMAX_1X8__NEONFMA_DUP_LD64, k_eq_2) {
-    TEST_REQUIRES_ARM_NEON_FMA;
+  TEST(F32_GEMM_MINMAX_1X8__NEON_DUP_ACC4, k_eq_4) {
+    TEST_REQUIRES_ARM_NEON;
     GemmMicrokernelTester()
       .mr(1)
       .nr(8)
@@ -8298,12 +8298,12 @@
       .sr(1)
       .m(1)
       .n(8)
-      .k(2)
-      .Test(xnn_f32_gemm_minmax_ukernel_1x8__neonfma_dup_ld64, xnn_init_f32_minmax_scalar_params);
+      .k(4)
+      .Test(xnn_f32_gemm_minmax_ukernel_1x8__neon_dup_acc4, xnn_init_f32_minmax_scalar_params);
   }
 
-  TEST(F32_GEMM_MINMAX_1X8__NEONFMA_DUP_LD64, strided_cn) {
-    TEST_REQUIRES_ARM_NEON_FMA;
+  TEST(F32_GEMM_MINMAX_1X8__NEON_DUP_ACC4, strided_cn) {
+    TEST_REQUIRES_ARM_NEON;
     GemmMicrokernelTester()
       .mr(1)
       .nr(8)
@@ -8311,13 +8311,13 @@
       .sr(1)
       .m(1)
       .n(8)
-      .k(2)
+      .k(4)
       .cn_stride(11)
-      .Test(xnn_f32_gemm_minmax_ukernel_1x8__neonfma_dup_ld64, xnn_init_f32_minmax_scalar_params);
+      .Test(xnn_f32_gemm_minmax_ukernel_1x8__neon_dup_acc4, xnn_init_f32_minmax_scalar_params);
   }
 
-  TEST(F32_GEMM_MINMAX_1X8__NEONFMA_DUP_LD64, k_eq_2_strided_a) {
-    TEST_REQUIRES_ARM_NEON_FMA;
+  TEST(F32_GEMM_MINMAX_1X8__NEON_DUP_ACC4, k_eq_4_strided_a) {
+    TEST_REQUIRES_ARM_NEON;
     GemmMicrokernelTester()
       .mr(1)
       .nr(8)
@@ -8325,13 +8325,13 @@
       .sr(1)
       .m(1)
       .n(8)
-      .k(2)
-      .a_stride(5)
-      .Test(xnn_f32_gemm_minmax_ukernel_1x8__neonfma_dup_ld64, xnn_init_f32_minmax_scalar_params);
+      .k(4)
+      .a_stride(7)
+      .Test(xnn_f32_gemm_minmax_ukernel_1x8__neon_dup_acc4, xnn_init_f32_minmax_scalar_params);
   }
 
-  TEST(F32_GEMM_MINMAX_1X8__NEONFMA_DUP_LD64, k_eq_2_subtile) {
-    TEST_REQUIRES_ARM_NEON_FMA;
+  TEST(F32_GEMM_MINMAX_1X8__NEON_DUP_ACC4, k_eq_4_subtile) {
+    TEST_REQUIRES_ARM_NEON;
     for (uint32_t n = 1; n <= 8; n++) {
       for (uint32_t m = 1; m <= 1; m++) {
         GemmMicrokernelTester()
@@ -8341,15 +8341,15 @@
           .sr(1)
           .m(m)
           .n(n)
-          .k(2)
+          .k(4)
           .iterations(1)
-          .Test(xnn_f32_gemm_minmax_ukernel_1x8__neonfma_dup_ld64, xnn_init_f32_minmax_scalar_params);
+          .Test(xnn_f32_gemm_minmax_ukernel_1x8__neon_dup_acc4, xnn_init_f32_minmax_scalar_params);
       }
     }
   }
 
-  TEST(F32_GEMM_MINMAX_1X8__NEONFMA_DUP_LD64, k_eq_2_subtile_m) {
-    TEST_REQUIRES_ARM_NEON_FMA;
+  TEST(F32_GEMM_MINMAX_1X8__NEON_DUP_ACC4, k_eq_4_subtile_m) {
+    TEST_REQUIRES_ARM_NEON;
     for (uint32_t m = 1; m <= 1; m++) {
       GemmMicrokernelTester()
         .mr(1)
@@ -8358,14 +8358,14 @@
         .sr(1)
         .m(m)
         .n(8)
-        .k(2)
+        .k(4)
         .iterations(1)
-        .Test(xnn_f32_gemm_minmax_ukernel_1x8__neonfma_dup_ld64, xnn_init_f32_minmax_scalar_params);
+        .Test(xnn_f32_gemm_minmax_ukernel_1x8__neon_dup_acc4, xnn_init_f32_minmax_scalar_params);
     }
   }
 
-  TEST(F32_GEMM_MINMAX_1X8__NEONFMA_DUP_LD64, k_eq_2_subtile_n) {
-    TEST_REQUIRES_ARM_NEON_FMA;
+  TEST(F32_GEMM_MINMAX_1X8__NEON_DUP_ACC4, k_eq_4_subtile_n) {
+    TEST_REQUIRES_ARM_NEON;
     for (uint32_t n = 1; n <= 8; n++) {
       GemmMicrokernelTester()
         .mr(1)
@@ -8374,15 +8374,15 @@
         .sr(1)
         .m(1)
         .n(n)
-        .k(2)
+        .k(4)
         .iterations(1)
-        .Test(xnn_f32_gemm_minmax_ukernel_1x8__neonfma_dup_ld64, xnn_init_f32_minmax_scalar_params);
+        .Test(xnn_f32_gemm_minmax_ukernel_1x8__neon_dup_acc4, xnn_init_f32_minmax_scalar_params);
     }
   }
 
-  TEST(F32_GEMM_MINMAX_1X8__NEONFMA_DUP_LD64, k_lt_2) {
-    TEST_REQUIRES_ARM_NEON_FMA;
-    for (size_t k = 1; k < 2; k++) {
+  TEST(F32_GEMM_MINMAX_1X8__NEON_DUP_ACC4, k_lt_4) {
+    TEST_REQUIRES_ARM_NEON;
+    for (size_t k = 1; k < 4; k++) {
       GemmMicrokernelTester()
         .mr(1)
         .nr(8)
@@ -8391,13 +8391,13 @@
         .m(1)
         .n(8)
         .k(k)
-        .Test(xnn_f32_gemm_minmax_ukernel_1x8__neonfma_dup_ld64, xnn_init_f32_minmax_scalar_params);
+        .Test(xnn_f32_gemm_minmax_ukernel_1x8__neon_dup_acc4, xnn_init_f32_minmax_scalar_params);
     }
   }
 
-  TEST(F32_GEMM_MINMAX_1X8__NEONFMA_DUP_LD64, k_lt_2_strided_a) {
-    TEST_REQUIRES_ARM_NEON_FMA;
-    for (size_t k = 1; k < 2; k++) {
+  TEST(F32_GEMM_MINMAX_1X8__NEON_DUP_ACC4, k_lt_4_strided_a) {
+    TEST_REQUIRES_ARM_NEON;
+    for (size_t k = 1; k < 4; k++) {
       GemmMicrokernelTester()
         .mr(1)
         .nr(8)
@@ -8406,14 +8406,14 @@
         .m(1)
         .n(8)
         .k(k)
-        .a_stride(5)
-        .Test(xnn_f32_gemm_minmax_ukernel_1x8__neonfma_dup_ld64, xnn_init_f32_minmax_scalar_params);
+        .a_stride(7)
+        .Test(xnn_f32_gemm_minmax_ukernel_1x8__neon_dup_acc4, xnn_init_f32_minmax_scalar_params);
     }
   }
 
-  TEST(F32_GEMM_MINMAX_1X8__NEONFMA_DUP_LD64, k_lt_2_subtile) {
-    TEST_REQUIRES_ARM_NEON_FMA;
-    for (size_t k = 1; k < 2; k++) {
+  TEST(F32_GEMM_MINMAX_1X8__NEON_DUP_ACC4, k_lt_4_subtile) {
+    TEST_REQUIRES_ARM_NEON;
+    for (size_t k = 1; k < 4; k++) {
       for (uint32_t n = 1; n <= 8; n++) {
         for (uint32_t m = 1; m <= 1; m++) {
           GemmMicrokernelTester()
@@ -8425,15 +8425,15 @@
             .n(n)
             .k(k)
             .iterations(1)
-            .Test(xnn_f32_gemm_minmax_ukernel_1x8__neonfma_dup_ld64, xnn_init_f32_minmax_scalar_params);
+            .Test(xnn_f32_gemm_minmax_ukernel_1x8__neon_dup_acc4, xnn_init_f32_minmax_scalar_params);
         }
       }
     }
   }
 
-  TEST(F32_GEMM_MINMAX_1X8__NEONFMA_DUP_LD64, k_gt_2) {
-    TEST_REQUIRES_ARM_NEON_FMA;
-    for (size_t k = 3; k < 4; k++) {
+  TEST(F32_GEMM_MINMAX_1X8__NEON_DUP_ACC4, k_gt_4) {
+    TEST_REQUIRES_ARM_NEON;
+    for (size_t k = 5; k < 8; k++) {
       GemmMicrokernelTester()
         .mr(1)
         .nr(8)
@@ -8442,13 +8442,13 @@
         .m(1)
         .n(8)
         .k(k)
-        .Test(xnn_f32_gemm_minmax_ukernel_1x8__neonfma_dup_ld64, xnn_init_f32_minmax_scalar_params);
+        .Test(xnn_f32_gemm_minmax_ukernel_1x8__neon_dup_acc4, xnn_init_f32_minmax_scalar_params);
     }
   }
 
-  TEST(F32_GEMM_MINMAX_1X8__NEONFMA_DUP_LD64, k_gt_2_strided_a) {
-    TEST_REQUIRES_ARM_NEON_FMA;
-    for (size_t k = 3; k < 4; k++) {
+  TEST(F32_GEMM_MINMAX_1X8__NEON_DUP_ACC4, k_gt_4_strided_a) {
+    TEST_REQUIRES_ARM_NEON;
+    for (size_t k = 5; k < 8; k++) {
       GemmMicrokernelTester()
         .mr(1)
         .nr(8)
@@ -8457,14 +8457,14 @@
         .m(1)
         .n(8)
         .k(k)
-        .a_stride(7)
-        .Test(xnn_f32_gemm_minmax_ukernel_1x8__neonfma_dup_ld64, xnn_init_f32_minmax_scalar_params);
+        .a_stride(11)
+        .Test(xnn_f32_gemm_minmax_ukernel_1x8__neon_dup_acc4, xnn_init_f32_minmax_scalar_params);
     }
   }
 
-  TEST(F32_GEMM_MINMAX_1X8__NEONFMA_DUP_LD64, k_gt_2_subtile) {
-    TEST_REQUIRES_ARM_NEON_FMA;
-    for (size_t k = 3; k < 4; k++) {
+  TEST(F32_GEMM_MINMAX_1X8__NEON_DUP_ACC4, k_gt_4_subtile) {
+    TEST_REQUIRES_ARM_NEON;
+    for (size_t k = 5; k < 8; k++) {
       for (uint32_t n = 1; n <= 8; n++) {
         for (uint32_t m = 1; m <= 1; m++) {
           GemmMicrokernelTester()
@@ -8476,15 +8476,15 @@
             .n(n)
             .k(k)
             .iterations(1)
-            .Test(xnn_f32_gemm_minmax_ukernel_1x8__neonfma_dup_ld64, xnn_init_f32_minmax_scalar_params);
+            .Test(xnn_f32_gemm_minmax_ukernel_1x8__neon_dup_acc4, xnn_init_f32_minmax_scalar_params);
         }
       }
     }
   }
 
-  TEST(F32_GEMM_MINMAX_1X8__NEONFMA_DUP_LD64, k_div_2) {
-    TEST_REQUIRES_ARM_NEON_FMA;
-    for (size_t k = 4; k <= 20; k += 2) {
+  TEST(F32_GEMM_MINMAX_1X8__NEON_DUP_ACC4, k_div_4) {
+    TEST_REQUIRES_ARM_NEON;
+    for (size_t k = 8; k <= 40; k += 4) {
       GemmMicrokernelTester()
         .mr(1)
         .nr(8)
@@ -8493,13 +8493,13 @@
         .m(1)
         .n(8)
         .k(k)
-        .Test(xnn_f32_gemm_minmax_ukernel_1x8__neonfma_dup_ld64, xnn_init_f32_minmax_scalar_params);
+        .Test(xnn_f32_gemm_minmax_ukernel_1x8__neon_dup_acc4, xnn_init_f32_minmax_scalar_params);
     }
   }
 
-  TEST(F32_GEMM_MINMAX_1X8__NEONFMA_DUP_LD64, k_div_2_strided_a) {
-    TEST_REQUIRES_ARM_NEON_FMA;
-    for (size_t k = 4; k <= 20; k += 2) {
+  TEST(F32_GEMM_MINMAX_1X8__NEON_DUP_ACC4, k_div_4_strided_a) {
+    TEST_REQUIRES_ARM_NEON;
+    for (size_t k = 8; k <= 40; k += 4) {
       GemmMicrokernelTester()
         .mr(1)
         .nr(8)
@@ -8508,14 +8508,14 @@
         .m(1)
         .n(8)
         .k(k)
-        .a_stride(23)
-        .Test(xnn_f32_gemm_minmax_ukernel_1x8__neonfma_dup_ld64, xnn_init_f32_minmax_scalar_params);
+        .a_stride(43)
+        .Test(xnn_f32_gemm_minmax_ukernel_1x8__neon_dup_acc4, xnn_init_f32_minmax_scalar_params);
     }
   }
 
-  TEST(F32_GEMM_MINMAX_1X8__NEONFMA_DUP_LD64, k_div_2_subtile) {
-    TEST_REQUIRES_ARM_NEON_FMA;
-    for (size_t k = 4; k <= 20; k += 2) {
+  TEST(F32_GEMM_MINMAX_1X8__NEON_DUP_ACC4, k_div_4_subtile) {
+    TEST_REQUIRES_ARM_NEON;
+    for (size_t k = 8; k <= 40; k += 4) {
       for (uint32_t n = 1; n <= 8; n++) {
         for (uint32_t m = 1; m <= 1; m++) {
           GemmMicrokernelTester()
@@ -8527,16 +8527,16 @@
             .n(n)
             .k(k)
             .iterations(1)
-            .Test(xnn_f32_gemm_minmax_ukernel_1x8__neonfma_dup_ld64, xnn_init_f32_minmax_scalar_params);
+            .Test(xnn_f32_gemm_minmax_ukernel_1x8__neon_dup_acc4, xnn_init_f32_minmax_scalar_params);
         }
       }
     }
   }
 
-  TEST(F32_GEMM_MINMAX_1X8__NEONFMA_DUP_LD64, n_gt_8) {
-    TEST_REQUIRES_ARM_NEON_FMA;
+  TEST(F32_GEMM_MINMAX_1X8__NEON_DUP_ACC4, n_gt_8) {
+    TEST_REQUIRES_ARM_NEON;
     for (uint32_t n = 9; n < 16; n++) {
-      for (size_t k = 1; k <= 10; k += 3) {
+      for (size_t k = 1; k <= 20; k += 5) {
         GemmMicrokernelTester()
           .mr(1)
           .nr(8)
@@ -8545,15 +8545,15 @@
           .m(1)
           .n(n)
           .k(k)
-          .Test(xnn_f32_gemm_minmax_ukernel_1x8__neonfma_dup_ld64, xnn_init_f32_minmax_scalar_params);
+          .Test(xnn_f32_gemm_minmax_ukernel_1x8__neon_dup_acc4, xnn_init_f32_minmax_scalar_params);
       }
     }
   }
 
-  TEST(F32_GEMM_MINMAX_1X8__NEONFMA_DUP_LD64, n_gt_8_strided_cn) {
-    TEST_REQUIRES_ARM_NEON_FMA;
+  TEST(F32_GEMM_MINMAX_1X8__NEON_DUP_ACC4, n_gt_8_strided_cn) {
+    TEST_REQUIRES_ARM_NEON;
     for (uint32_t n = 9; n < 16; n++) {
-      for (size_t k = 1; k <= 10; k += 3) {
+      for (size_t k = 1; k <= 20; k += 5) {
         GemmMicrokernelTester()
           .mr(1)
           .nr(8)
@@ -8563,15 +8563,15 @@
           .n(n)
           .k(k)
           .cn_stride(11)
-          .Test(xnn_f32_gemm_minmax_ukernel_1x8__neonfma_dup_ld64, xnn_init_f32_minmax_scalar_params);
+          .Test(xnn_f32_gemm_minmax_ukernel_1x8__neon_dup_acc4, xnn_init_f32_minmax_scalar_params);
       }
     }
   }
 
-  TEST(F32_GEMM_MINMAX_1X8__NEONFMA_DUP_LD64, n_gt_8_strided_a) {
-    TEST_REQUIRES_ARM_NEON_FMA;
+  TEST(F32_GEMM_MINMAX_1X8__NEON_DUP_ACC4, n_gt_8_strided_a) {
+    TEST_REQUIRES_ARM_NEON;
     for (uint32_t n = 9; n < 16; n++) {
-      for (size_t k = 1; k <= 10; k += 3) {
+      for (size_t k = 1; k <= 20; k += 5) {
         GemmMicrokernelTester()
           .mr(1)
           .nr(8)
@@ -8580,16 +8580,16 @@
           .m(1)
           .n(n)
           .k(k)
-          .a_stride(13)
-          .Test(xnn_f32_gemm_minmax_ukernel_1x8__neonfma_dup_ld64, xnn_init_f32_minmax_scalar_params);
+          .a_stride(23)
+          .Test(xnn_f32_gemm_minmax_ukernel_1x8__neon_dup_acc4, xnn_init_f32_minmax_scalar_params);
       }
     }
   }
 
-  TEST(F32_GEMM_MINMAX_1X8__NEONFMA_DUP_LD64, n_gt_8_subtile) {
-    TEST_REQUIRES_ARM_NEON_FMA;
+  TEST(F32_GEMM_MINMAX_1X8__NEON_DUP_ACC4, n_gt_8_subtile) {
+    TEST_REQUIRES_ARM_NEON;
     for (uint32_t n = 9; n < 16; n++) {
-      for (size_t k = 1; k <= 10; k += 3) {
+      for (size_t k = 1; k <= 20; k += 5) {
         for (uint32_t m = 1; m <= 1; m++) {
           GemmMicrokernelTester()
             .mr(1)
@@ -8600,16 +8600,16 @@
             .n(n)
             .k(k)
             .iterations(1)
-            .Test(xnn_f32_gemm_minmax_ukernel_1x8__neonfma_dup_ld64, xnn_init_f32_minmax_scalar_params);
+            .Test(xnn_f32_gemm_minmax_ukernel_1x8__neon_dup_acc4, xnn_init_f32_minmax_scalar_params);
         }
       }
     }
   }
 
-  TEST(F32_GEMM_MINMAX_1X8__NEONFMA_DUP_LD64, n_div_8) {
-    TEST_REQUIRES_ARM_NEON_FMA;
+  TEST(F32_GEMM_MINMAX_1X8__NEON_DUP_ACC4, n_div_8) {
+    TEST_REQUIRES_ARM_NEON;
     for (uint32_t n = 16; n <= 24; n += 8) {
-      for (size_t k = 1; k <= 10; k += 3) {
+      for (size_t k = 1; k <= 20; k += 5) {
         GemmMicrokernelTester()
           .mr(1)
           .nr(8)
@@ -8618,15 +8618,15 @@
           .m(1)
           .n(n)
           .k(k)
-          .Test(xnn_f32_gemm_minmax_ukernel_1x8__neonfma_dup_ld64, xnn_init_f32_minmax_scalar_params);
+          .Test(xnn_f32_gemm_minmax_ukernel_1x8__neon_dup_acc4, xnn_init_f32_minmax_scalar_params);
       }
     }
   }
 
-  TEST(F32_GEMM_MINMAX_1X8__NEONFMA_DUP_LD64, n_div_8_strided_cn) {
-    TEST_REQUIRES_ARM_NEON_FMA;
+  TEST(F32_GEMM_MINMAX_1X8__NEON_DUP_ACC4, n_div_8_strided_cn) {
+    TEST_REQUIRES_ARM_NEON;
     for (uint32_t n = 16; n <= 24; n += 8) {
-      for (size_t k = 1; k <= 10; k += 3) {
+      for (size_t k = 1; k <= 20; k += 5) {
         GemmMicrokernelTester()
           .mr(1)
           .nr(8)
@@ -8636,15 +8636,15 @@
           .n(n)
           .k(k)
           .cn_stride(11)
-          .Test(xnn_f32_gemm_minmax_ukernel_1x8__neonfma_dup_ld64, xnn_init_f32_minmax_scalar_params);
+          .Test(xnn_f32_gemm_minmax_ukernel_1x8__neon_dup_acc4, xnn_init_f32_minmax_scalar_params);
       }
     }
   }
 
-  TEST(F32_GEMM_MINMAX_1X8__NEONFMA_DUP_LD64, n_div_8_strided_a) {
-    TEST_REQUIRES_ARM_NEON_FMA;
+  TEST(F32_GEMM_MINMAX_1X8__NEON_DUP_ACC4, n_div_8_strided_a) {
+    TEST_REQUIRES_ARM_NEON;
     for (uint32_t n = 16; n <= 24; n += 8) {
-      for (size_t k = 1; k <= 10; k += 3) {
+      for (size_t k = 1; k <= 20; k += 5) {
         GemmMicrokernelTester()
           .mr(1)
           .nr(8)
@@ -8653,16 +8653,16 @@
           .m(1)
           .n(n)
           .k(k)
-          .a_stride(13)
-          .Test(xnn_f32_gemm_minmax_ukernel_1x8__neonfma_dup_ld64, xnn_init_f32_minmax_scalar_params);
+          .a_stride(23)
+          .Test(xnn_f32_gemm_minmax_ukernel_1x8__neon_dup_acc4, xnn_init_f32_minmax_scalar_params);
       }
     }
   }
 
-  TEST(F32_GEMM_MINMAX_1X8__NEONFMA_DUP_LD64, n_div_8_subtile) {
-    TEST_REQUIRES_ARM_NEON_FMA;
+  TEST(F32_GEMM_MINMAX_1X8__NEON_DUP_ACC4, n_div_8_subtile) {
+    TEST_REQUIRES_ARM_NEON;
     for (uint32_t n = 16; n <= 24; n += 8) {
-      for (size_t k = 1; k <= 10; k += 3) {
+      for (size_t k = 1; k <= 20; k += 5) {
         for (uint32_t m = 1; m <= 1; m++) {
           GemmMicrokernelTester()
             .mr(1)
@@ -8673,15 +8673,15 @@
             .n(n)
             .k(k)
             .iterations(1)
-            .Test(xnn_f32_gemm_minmax_ukernel_1x8__neonfma_dup_ld64, xnn_init_f32_minmax_scalar_params);
+            .Test(xnn_f32_gemm_minmax_ukernel_1x8__neon_dup_acc4, xnn_init_f32_minmax_scalar_params);
         }
       }
     }
   }
 
-  TEST(F32_GEMM_MINMAX_1X8__NEONFMA_DUP_LD64, strided_cm_subtile) {
-    TEST_REQUIRES_ARM_NEON_FMA;
-    for (size_t k = 1; k <= 10; k += 3) {
+  TEST(F32_GEMM_MINMAX_1X8__NEON_DUP_ACC4, strided_cm_subtile) {
+    TEST_REQUIRES_ARM_NEON;
+    for (size_t k = 1; k <= 20; k += 5) {
       for (uint32_t n = 1; n <= 8; n++) {
         for (uint32_t m = 1; m <= 1; m++) {
           GemmMicrokernelTester()
@@ -8694,14 +8694,14 @@
             .k(k)
             .cm_stride(11)
             .iterations(1)
-            .Test(xnn_f32_gemm_minmax_ukernel_1x8__neonfma_dup_ld64, xnn_init_f32_minmax_scalar_params);
+            .Test(xnn_f32_gemm_minmax_ukernel_1x8__neon_dup_acc4, xnn_init_f32_minmax_scalar_params);
         }
       }
     }
   }
 
-  TEST(F32_GEMM_MINMAX_1X8__NEONFMA_DUP_LD64, qmin) {
-    TEST_REQUIRES_ARM_NEON_FMA;
+  TEST(F32_GEMM_MINMAX_1X8__NEON_DUP_ACC4, qmin) {
+    TEST_REQUIRES_ARM_NEON;
     GemmMicrokernelTester()
       .mr(1)
       .nr(8)
@@ -8709,13 +8709,13 @@
       .sr(1)
       .m(1)
       .n(8)
-      .k(2)
+      .k(4)
       .qmin(128)
-      .Test(xnn_f32_gemm_minmax_ukernel_1x8__neonfma_dup_ld64, xnn_init_f32_minmax_scalar_params);
+      .Test(xnn_f32_gemm_minmax_ukernel_1x8__neon_dup_acc4, xnn_init_f32_minmax_scalar_params);
   }
 
-  TEST(F32_GEMM_MINMAX_1X8__NEONFMA_DUP_LD64, qmax) {
-    TEST_REQUIRES_ARM_NEON_FMA;
+  TEST(F32_GEMM_MINMAX_1X8__NEON_DUP_ACC4, qmax) {
+    TEST_REQUIRES_ARM_NEON;
     GemmMicrokernelTester()
       .mr(1)
       .nr(8)
@@ -8723,13 +8723,13 @@
       .sr(1)
       .m(1)
       .n(8)
-      .k(2)
+      .k(4)
       .qmax(128)
-      .Test(xnn_f32_gemm_minmax_ukernel_1x8__neonfma_dup_ld64, xnn_init_f32_minmax_scalar_params);
+      .Test(xnn_f32_gemm_minmax_ukernel_1x8__neon_dup_acc4, xnn_init_f32_minmax_scalar_params);
   }
 
-  TEST(F32_GEMM_MINMAX_1X8__NEONFMA_DUP_LD64, strided_cm) {
-    TEST_REQUIRES_ARM_NEON_FMA;
+  TEST(F32_GEMM_MINMAX_1X8__NEON_DUP_ACC4, strided_cm) {
+    TEST_REQUIRES_ARM_NEON;
     GemmMicrokernelTester()
       .mr(1)
       .nr(8)
@@ -8737,15 +8737,15 @@
       .sr(1)
       .m(1)
       .n(8)
-      .k(2)
+      .k(4)
       .cm_stride(11)
-      .Test(xnn_f32_gemm_minmax_ukernel_1x8__neonfma_dup_ld64, xnn_init_f32_minmax_scalar_params);
+      .Test(xnn_f32_gemm_minmax_ukernel_1x8__neon_dup_acc4, xnn_init_f32_minmax_scalar_params);
   }
 #endif  // XNN_ARCH_ARM || XNN_ARCH_ARM64
 
 
-#if XNN_ARCH_ARM64
-  TEST(F32_GEMM_MINMAX_1X8__NEONFMA_LANE_LD64, k_eq_2) {
+#if XNN_ARCH_ARM || XNN_ARCH_ARM64
+  TEST(F32_GEMM_MINMAX_1X8__NEONFMA_DUP_LD64, k_eq_2) {
     TEST_REQUIRES_ARM_NEON_FMA;
     GemmMicrokernelTester()
       .mr(1)
@@ -8755,10 +8755,10 @@
       .m(1)
       .n(8)
       .k(2)
-      .Test(xnn_f32_gemm_minmax_ukernel_1x8__neonfma_lane_ld64, xnn_init_f32_minmax_scalar_params);
+      .Test(xnn_f32_gemm_minmax_ukernel_1x8__neonfma_dup_ld64, xnn_init_f32_minmax_scalar_params);
   }
 
-  TEST(F32_GEMM_MINMAX_1X8__NEONFMA_LANE_LD64, strided_cn) {
+  TEST(F32_GEMM_MINMAX_1X8__NEONFMA_DUP_LD64, strided_cn) {
     TEST_REQUIRES_ARM_NEON_FMA;
     GemmMicrokernelTester()
       .mr(1)
@@ -8769,10 +8769,10 @@
       .n(8)
       .k(2)
       .cn_stride(11)
-      .Test(xnn_f32_gemm_minmax_ukernel_1x8__neonfma_lane_ld64, xnn_init_f32_minmax_scalar_params);
+      .Test(xnn_f32_gemm_minmax_ukernel_1x8__neonfma_dup_ld64, xnn_init_f32_minmax_scalar_params);
   }
 
-  TEST(F32_GEMM_MINMAX_1X8__NEONFMA_LANE_LD64, k_eq_2_strided_a) {
+  TEST(F32_GEMM_MINMAX_1X8__NEONFMA_DUP_LD64, k_eq_2_strided_a) {
     TEST_REQUIRES_ARM_NEON_FMA;
     GemmMicrokernelTester()
       .mr(1)
@@ -8783,10 +8783,10 @@
       .n(8)
       .k(2)
       .a_stride(5)
-      .Test(xnn_f32_gemm_minmax_ukernel_1x8__neonfma_lane_ld64, xnn_init_f32_minmax_scalar_params);
+      .Test(xnn_f32_gemm_minmax_ukernel_1x8__neonfma_dup_ld64, xnn_init_f32_minmax_scalar_params);
   }
 
-  TEST(F32_GEMM_MINMAX_1X8__NEONFMA_LANE_LD64, k_eq_2_subtile) {
+  TEST(F32_GEMM_MINMAX_1X8__NEONFMA_DUP_LD64, k_eq_2_subtile) {
     TEST_REQUIRES_ARM_NEON_FMA;
     for (uint32_t n = 1; n <= 8; n++) {
       for (uint32_t m = 1; m <= 1; m++) {
@@ -8799,12 +8799,12 @@
           .n(n)
           .k(2)
           .iterations(1)
-          .Test(xnn_f32_gemm_minmax_ukernel_1x8__neonfma_lane_ld64, xnn_init_f32_minmax_scalar_params);
+          .Test(xnn_f32_gemm_minmax_ukernel_1x8__neonfma_dup_ld64, xnn_init_f32_minmax_scalar_params);
       }
     }
   }
 
-  TEST(F32_GEMM_MINMAX_1X8__NEONFMA_LANE_LD64, k_eq_2_subtile_m) {
+  TEST(F32_GEMM_MINMAX_1X8__NEONFMA_DUP_LD64, k_eq_2_subtile_m) {
     TEST_REQUIRES_ARM_NEON_FMA;
     for (uint32_t m = 1; m <= 1; m++) {
       GemmMicrokernelTester()
@@ -8816,11 +8816,11 @@
         .n(8)
         .k(2)
         .iterations(1)
-        .Test(xnn_f32_gemm_minmax_ukernel_1x8__neonfma_lane_ld64, xnn_init_f32_minmax_scalar_params);
+        .Test(xnn_f32_gemm_minmax_ukernel_1x8__neonfma_dup_ld64, xnn_init_f32_minmax_scalar_params);
     }
   }
 
-  TEST(F32_GEMM_MINMAX_1X8__NEONFMA_LANE_LD64, k_eq_2_subtile_n) {
+  TEST(F32_GEMM_MINMAX_1X8__NEONFMA_DUP_LD64, k_eq_2_subtile_n) {
     TEST_REQUIRES_ARM_NEON_FMA;
     for (uint32_t n = 1; n <= 8; n++) {
       GemmMicrokernelTester()
@@ -8832,11 +8832,11 @@
         .n(n)
         .k(2)
         .iterations(1)
-        .Test(xnn_f32_gemm_minmax_ukernel_1x8__neonfma_lane_ld64, xnn_init_f32_minmax_scalar_params);
+        .Test(xnn_f32_gemm_minmax_ukernel_1x8__neonfma_dup_ld64, xnn_init_f32_minmax_scalar_params);
     }
   }
 
-  TEST(F32_GEMM_MINMAX_1X8__NEONFMA_LANE_LD64, k_lt_2) {
+  TEST(F32_GEMM_MINMAX_1X8__NEONFMA_DUP_LD64, k_lt_2) {
     TEST_REQUIRES_ARM_NEON_FMA;
     for (size_t k = 1; k < 2; k++) {
       GemmMicrokernelTester()
@@ -8847,11 +8847,11 @@
         .m(1)
         .n(8)
         .k(k)
-        .Test(xnn_f32_gemm_minmax_ukernel_1x8__neonfma_lane_ld64, xnn_init_f32_minmax_scalar_params);
+        .Test(xnn_f32_gemm_minmax_ukernel_1x8__neonfma_dup_ld64, xnn_init_f32_minmax_scalar_params);
     }
   }
 
-  TEST(F32_GEMM_MINMAX_1X8__NEONFMA_LANE_LD64, k_lt_2_strided_a) {
+  TEST(F32_GEMM_MINMAX_1X8__NEONFMA_DUP_LD64, k_lt_2_strided_a) {
     TEST_REQUIRES_ARM_NEON_FMA;
     for (size_t k = 1; k < 2; k++) {
       GemmMicrokernelTester()
@@ -8863,11 +8863,11 @@
         .n(8)
         .k(k)
         .a_stride(5)
-        .Test(xnn_f32_gemm_minmax_ukernel_1x8__neonfma_lane_ld64, xnn_init_f32_minmax_scalar_params);
+        .Test(xnn_f32_gemm_minmax_ukernel_1x8__neonfma_dup_ld64, xnn_init_f32_minmax_scalar_params);
     }
   }
 
-  TEST(F32_GEMM_MINMAX_1X8__NEONFMA_LANE_LD64, k_lt_2_subtile) {
+  TEST(F32_GEMM_MINMAX_1X8__NEONFMA_DUP_LD64, k_lt_2_subtile) {
     TEST_REQUIRES_ARM_NEON_FMA;
     for (size_t k = 1; k < 2; k++) {
       for (uint32_t n = 1; n <= 8; n++) {
@@ -8881,13 +8881,13 @@
             .n(n)
             .k(k)
             .iterations(1)
-            .Test(xnn_f32_gemm_minmax_ukernel_1x8__neonfma_lane_ld64, xnn_init_f32_minmax_scalar_params);
+            .Test(xnn_f32_gemm_minmax_ukernel_1x8__neonfma_dup_ld64, xnn_init_f32_minmax_scalar_params);
         }
       }
     }
   }
 
-  TEST(F32_GEMM_MINMAX_1X8__NEONFMA_LANE_LD64, k_gt_2) {
+  TEST(F32_GEMM_MINMAX_1X8__NEONFMA_DUP_LD64, k_gt_2) {
     TEST_REQUIRES_ARM_NEON_FMA;
     for (size_t k = 3; k < 4; k++) {
       GemmMicrokernelTester()
@@ -8898,11 +8898,11 @@
         .m(1)
         .n(8)
         .k(k)
-        .Test(xnn_f32_gemm_minmax_ukernel_1x8__neonfma_lane_ld64, xnn_init_f32_minmax_scalar_params);
+        .Test(xnn_f32_gemm_minmax_ukernel_1x8__neonfma_dup_ld64, xnn_init_f32_minmax_scalar_params);
     }
   }
 
-  TEST(F32_GEMM_MINMAX_1X8__NEONFMA_LANE_LD64, k_gt_2_strided_a) {
+  TEST(F32_GEMM_MINMAX_1X8__NEONFMA_DUP_LD64, k_gt_2_strided_a) {
     TEST_REQUIRES_ARM_NEON_FMA;
     for (size_t k = 3; k < 4; k++) {
       GemmMicrokernelTester()
@@ -8914,11 +8914,11 @@
         .n(8)
         .k(k)
         .a_stride(7)
-        .Test(xnn_f32_gemm_minmax_ukernel_1x8__neonfma_lane_ld64, xnn_init_f32_minmax_scalar_params);
+        .Test(xnn_f32_gemm_minmax_ukernel_1x8__neonfma_dup_ld64, xnn_init_f32_minmax_scalar_params);
     }
   }
 
-  TEST(F32_GEMM_MINMAX_1X8__NEONFMA_LANE_LD64, k_gt_2_subtile) {
+  TEST(F32_GEMM_MINMAX_1X8__NEONFMA_DUP_LD64, k_gt_2_subtile) {
     TEST_REQUIRES_ARM_NEON_FMA;
     for (size_t k = 3; k < 4; k++) {
       for (uint32_t n = 1; n <= 8; n++) {
@@ -8932,13 +8932,13 @@
             .n(n)
             .k(k)
             .iterations(1)
-            .Test(xnn_f32_gemm_minmax_ukernel_1x8__neonfma_lane_ld64, xnn_init_f32_minmax_scalar_params);
+            .Test(xnn_f32_gemm_minmax_ukernel_1x8__neonfma_dup_ld64, xnn_init_f32_minmax_scalar_params);
         }
       }
     }
   }
 
-  TEST(F32_GEMM_MINMAX_1X8__NEONFMA_LANE_LD64, k_div_2) {
+  TEST(F32_GEMM_MINMAX_1X8__NEONFMA_DUP_LD64, k_div_2) {
     TEST_REQUIRES_ARM_NEON_FMA;
     for (size_t k = 4; k <= 20; k += 2) {
       GemmMicrokernelTester()
@@ -8949,11 +8949,11 @@
         .m(1)
         .n(8)
         .k(k)
-        .Test(xnn_f32_gemm_minmax_ukernel_1x8__neonfma_lane_ld64, xnn_init_f32_minmax_scalar_params);
+        .Test(xnn_f32_gemm_minmax_ukernel_1x8__neonfma_dup_ld64, xnn_init_f32_minmax_scalar_params);
     }
   }
 
-  TEST(F32_GEMM_MINMAX_1X8__NEONFMA_LANE_LD64, k_div_2_strided_a) {
+  TEST(F32_GEMM_MINMAX_1X8__NEONFMA_DUP_LD64, k_div_2_strided_a) {
     TEST_REQUIRES_ARM_NEON_FMA;
     for (size_t k = 4; k <= 20; k += 2) {
       GemmMicrokernelTester()
@@ -8965,11 +8965,11 @@
         .n(8)
         .k(k)
         .a_stride(23)
-        .Test(xnn_f32_gemm_minmax_ukernel_1x8__neonfma_lane_ld64, xnn_init_f32_minmax_scalar_params);
+        .Test(xnn_f32_gemm_minmax_ukernel_1x8__neonfma_dup_ld64, xnn_init_f32_minmax_scalar_params);
     }
   }
 
-  TEST(F32_GEMM_MINMAX_1X8__NEONFMA_LANE_LD64, k_div_2_subtile) {
+  TEST(F32_GEMM_MINMAX_1X8__NEONFMA_DUP_LD64, k_div_2_subtile) {
     TEST_REQUIRES_ARM_NEON_FMA;
     for (size_t k = 4; k <= 20; k += 2) {
       for (uint32_t n = 1; n <= 8; n++) {
@@ -8983,13 +8983,13 @@
             .n(n)
             .k(k)
             .iterations(1)
-            .Test(xnn_f32_gemm_minmax_ukernel_1x8__neonfma_lane_ld64, xnn_init_f32_minmax_scalar_params);
+            .Test(xnn_f32_gemm_minmax_ukernel_1x8__neonfma_dup_ld64, xnn_init_f32_minmax_scalar_params);
         }
       }
     }
   }
 
-  TEST(F32_GEMM_MINMAX_1X8__NEONFMA_LANE_LD64, n_gt_8) {
+  TEST(F32_GEMM_MINMAX_1X8__NEONFMA_DUP_LD64, n_gt_8) {
     TEST_REQUIRES_ARM_NEON_FMA;
     for (uint32_t n = 9; n < 16; n++) {
       for (size_t k = 1; k <= 10; k += 3) {
@@ -9001,12 +9001,12 @@
           .m(1)
           .n(n)
           .k(k)
-          .Test(xnn_f32_gemm_minmax_ukernel_1x8__neonfma_lane_ld64, xnn_init_f32_minmax_scalar_params);
+          .Test(xnn_f32_gemm_minmax_ukernel_1x8__neonfma_dup_ld64, xnn_init_f32_minmax_scalar_params);
       }
     }
   }
 
-  TEST(F32_GEMM_MINMAX_1X8__NEONFMA_LANE_LD64, n_gt_8_strided_cn) {
+  TEST(F32_GEMM_MINMAX_1X8__NEONFMA_DUP_LD64, n_gt_8_strided_cn) {
     TEST_REQUIRES_ARM_NEON_FMA;
     for (uint32_t n = 9; n < 16; n++) {
       for (size_t k = 1; k <= 10; k += 3) {
@@ -9019,12 +9019,12 @@
           .n(n)
           .k(k)
           .cn_stride(11)
-          .Test(xnn_f32_gemm_minmax_ukernel_1x8__neonfma_lane_ld64, xnn_init_f32_minmax_scalar_params);
+          .Test(xnn_f32_gemm_minmax_ukernel_1x8__neonfma_dup_ld64, xnn_init_f32_minmax_scalar_params);
       }
     }
   }
 
-  TEST(F32_GEMM_MINMAX_1X8__NEONFMA_LANE_LD64, n_gt_8_strided_a) {
+  TEST(F32_GEMM_MINMAX_1X8__NEONFMA_DUP_LD64, n_gt_8_strided_a) {
     TEST_REQUIRES_ARM_NEON_FMA;
     for (uint32_t n = 9; n < 16; n++) {
       for (size_t k = 1; k <= 10; k += 3) {
@@ -9037,12 +9037,12 @@
           .n(n)
           .k(k)
           .a_stride(13)
-          .Test(xnn_f32_gemm_minmax_ukernel_1x8__neonfma_lane_ld64, xnn_init_f32_minmax_scalar_params);
+          .Test(xnn_f32_gemm_minmax_ukernel_1x8__neonfma_dup_ld64, xnn_init_f32_minmax_scalar_params);
       }
     }
   }
 
-  TEST(F32_GEMM_MINMAX_1X8__NEONFMA_LANE_LD64, n_gt_8_subtile) {
+  TEST(F32_GEMM_MINMAX_1X8__NEONFMA_DUP_LD64, n_gt_8_subtile) {
     TEST_REQUIRES_ARM_NEON_FMA;
     for (uint32_t n = 9; n < 16; n++) {
       for (size_t k = 1; k <= 10; k += 3) {
@@ -9056,13 +9056,13 @@
             .n(n)
             .k(k)
             .iterations(1)
-            .Test(xnn_f32_gemm_minmax_ukernel_1x8__neonfma_lane_ld64, xnn_init_f32_minmax_scalar_params);
+            .Test(xnn_f32_gemm_minmax_ukernel_1x8__neonfma_dup_ld64, xnn_init_f32_minmax_scalar_params);
         }
       }
     }
   }
 
-  TEST(F32_GEMM_MINMAX_1X8__NEONFMA_LANE_LD64, n_div_8) {
+  TEST(F32_GEMM_MINMAX_1X8__NEONFMA_DUP_LD64, n_div_8) {
     TEST_REQUIRES_ARM_NEON_FMA;
     for (uint32_t n = 16; n <= 24; n += 8) {
       for (size_t k = 1; k <= 10; k += 3) {
@@ -9074,12 +9074,12 @@
           .m(1)
           .n(n)
           .k(k)
-          .Test(xnn_f32_gemm_minmax_ukernel_1x8__neonfma_lane_ld64, xnn_init_f32_minmax_scalar_params);
+          .Test(xnn_f32_gemm_minmax_ukernel_1x8__neonfma_dup_ld64, xnn_init_f32_minmax_scalar_params);
       }
     }
   }
 
-  TEST(F32_GEMM_MINMAX_1X8__NEONFMA_LANE_LD64, n_div_8_strided_cn) {
+  TEST(F32_GEMM_MINMAX_1X8__NEONFMA_DUP_LD64, n_div_8_strided_cn) {
     TEST_REQUIRES_ARM_NEON_FMA;
     for (uint32_t n = 16; n <= 24; n += 8) {
       for (size_t k = 1; k <= 10; k += 3) {
@@ -9092,12 +9092,12 @@
           .n(n)
           .k(k)
           .cn_stride(11)
-          .Test(xnn_f32_gemm_minmax_ukernel_1x8__neonfma_lane_ld64, xnn_init_f32_minmax_scalar_params);
+          .Test(xnn_f32_gemm_minmax_ukernel_1x8__neonfma_dup_ld64, xnn_init_f32_minmax_scalar_params);
       }
     }
   }
 
-  TEST(F32_GEMM_MINMAX_1X8__NEONFMA_LANE_LD64, n_div_8_strided_a) {
+  TEST(F32_GEMM_MINMAX_1X8__NEONFMA_DUP_LD64, n_div_8_strided_a) {
     TEST_REQUIRES_ARM_NEON_FMA;
     for (uint32_t n = 16; n <= 24; n += 8) {
       for (size_t k = 1; k <= 10; k += 3) {
@@ -9110,12 +9110,12 @@
           .n(n)
           .k(k)
           .a_stride(13)
-          .Test(xnn_f32_gemm_minmax_ukernel_1x8__neonfma_lane_ld64, xnn_init_f32_minmax_scalar_params);
+          .Test(xnn_f32_gemm_minmax_ukernel_1x8__neonfma_dup_ld64, xnn_init_f32_minmax_scalar_params);
       }
     }
   }
 
-  TEST(F32_GEMM_MINMAX_1X8__NEONFMA_LANE_LD64, n_div_8_subtile) {
+  TEST(F32_GEMM_MINMAX_1X8__NEONFMA_DUP_LD64, n_div_8_subtile) {
     TEST_REQUIRES_ARM_NEON_FMA;
     for (uint32_t n = 16; n <= 24; n += 8) {
       for (size_t k = 1; k <= 10; k += 3) {
@@ -9129,13 +9129,13 @@
             .n(n)
             .k(k)
             .iterations(1)
-            .Test(xnn_f32_gemm_minmax_ukernel_1x8__neonfma_lane_ld64, xnn_init_f32_minmax_scalar_params);
+            .Test(xnn_f32_gemm_minmax_ukernel_1x8__neonfma_dup_ld64, xnn_init_f32_minmax_scalar_params);
         }
       }
     }
   }
 
-  TEST(F32_GEMM_MINMAX_1X8__NEONFMA_LANE_LD64, strided_cm_subtile) {
+  TEST(F32_GEMM_MINMAX_1X8__NEONFMA_DUP_LD64, strided_cm_subtile) {
     TEST_REQUIRES_ARM_NEON_FMA;
     for (size_t k = 1; k <= 10; k += 3) {
       for (uint32_t n = 1; n <= 8; n++) {
@@ -9150,13 +9150,13 @@
             .k(k)
             .cm_stride(11)
             .iterations(1)
-            .Test(xnn_f32_gemm_minmax_ukernel_1x8__neonfma_lane_ld64, xnn_init_f32_minmax_scalar_params);
+            .Test(xnn_f32_gemm_minmax_ukernel_1x8__neonfma_dup_ld64, xnn_init_f32_minmax_scalar_params);
         }
       }
     }
   }
 
-  TEST(F32_GEMM_MINMAX_1X8__NEONFMA_LANE_LD64, qmin) {
+  TEST(F32_GEMM_MINMAX_1X8__NEONFMA_DUP_LD64, qmin) {
     TEST_REQUIRES_ARM_NEON_FMA;
     GemmMicrokernelTester()
       .mr(1)
@@ -9167,10 +9167,10 @@
       .n(8)
       .k(2)
       .qmin(128)
-      .Test(xnn_f32_gemm_minmax_ukernel_1x8__neonfma_lane_ld64, xnn_init_f32_minmax_scalar_params);
+      .Test(xnn_f32_gemm_minmax_ukernel_1x8__neonfma_dup_ld64, xnn_init_f32_minmax_scalar_params);
   }
 
-  TEST(F32_GEMM_MINMAX_1X8__NEONFMA_LANE_LD64, qmax) {
+  TEST(F32_GEMM_MINMAX_1X8__NEONFMA_DUP_LD64, qmax) {
     TEST_REQUIRES_ARM_NEON_FMA;
     GemmMicrokernelTester()
       .mr(1)
@@ -9181,10 +9181,10 @@
       .n(8)
       .k(2)
       .qmax(128)
-      .Test(xnn_f32_gemm_minmax_ukernel_1x8__neonfma_lane_ld64, xnn_init_f32_minmax_scalar_params);
+      .Test(xnn_f32_gemm_minmax_ukernel_1x8__neonfma_dup_ld64, xnn_init_f32_minmax_scalar_params);
   }
 
-  TEST(F32_GEMM_MINMAX_1X8__NEONFMA_LANE_LD64, strided_cm) {
+  TEST(F32_GEMM_MINMAX_1X8__NEONFMA_DUP_LD64, strided_cm) {
     TEST_REQUIRES_ARM_NEON_FMA;
     GemmMicrokernelTester()
       .mr(1)
@@ -9195,926 +9195,926 @@
       .n(8)
       .k(2)
       .cm_stride(11)
-      .Test(xnn_f32_gemm_minmax_ukernel_1x8__neonfma_lane_ld64, xnn_init_f32_minmax_scalar_params);
+      .Test(xnn_f32_gemm_minmax_ukernel_1x8__neonfma_dup_ld64, xnn_init_f32_minmax_scalar_params);
   }
-#endif  // XNN_ARCH_ARM64
+#endif  // XNN_ARCH_ARM || XNN_ARCH_ARM64
 
 
-#if XNN_ARCH_ARM || XNN_ARCH_ARM64
-  TEST(F32_GEMM_MINMAX_4X2__NEON_LANE_LD64, k_eq_2) {
-    TEST_REQUIRES_ARM_NEON;
+#if XNN_ARCH_ARM64
+  TEST(F32_GEMM_MINMAX_1X8__NEONFMA_LANE_LD64, k_eq_2) {
+    TEST_REQUIRES_ARM_NEON_FMA;
     GemmMicrokernelTester()
-      .mr(4)
-      .nr(2)
+      .mr(1)
+      .nr(8)
       .kr(1)
       .sr(1)
-      .m(4)
-      .n(2)
+      .m(1)
+      .n(8)
       .k(2)
-      .Test(xnn_f32_gemm_minmax_ukernel_4x2__neon_lane_ld64, xnn_init_f32_minmax_scalar_params);
+      .Test(xnn_f32_gemm_minmax_ukernel_1x8__neonfma_lane_ld64, xnn_init_f32_minmax_scalar_params);
   }
 
-  TEST(F32_GEMM_MINMAX_4X2__NEON_LANE_LD64, strided_cn) {
-    TEST_REQUIRES_ARM_NEON;
+  TEST(F32_GEMM_MINMAX_1X8__NEONFMA_LANE_LD64, strided_cn) {
+    TEST_REQUIRES_ARM_NEON_FMA;
     GemmMicrokernelTester()
-      .mr(4)
-      .nr(2)
+      .mr(1)
+      .nr(8)
       .kr(1)
       .sr(1)
-      .m(4)
-      .n(2)
+      .m(1)
+      .n(8)
       .k(2)
-      .cn_stride(5)
-      .Test(xnn_f32_gemm_minmax_ukernel_4x2__neon_lane_ld64, xnn_init_f32_minmax_scalar_params);
+      .cn_stride(11)
+      .Test(xnn_f32_gemm_minmax_ukernel_1x8__neonfma_lane_ld64, xnn_init_f32_minmax_scalar_params);
   }
 
-  TEST(F32_GEMM_MINMAX_4X2__NEON_LANE_LD64, k_eq_2_strided_a) {
-    TEST_REQUIRES_ARM_NEON;
+  TEST(F32_GEMM_MINMAX_1X8__NEONFMA_LANE_LD64, k_eq_2_strided_a) {
+    TEST_REQUIRES_ARM_NEON_FMA;
     GemmMicrokernelTester()
-      .mr(4)
-      .nr(2)
+      .mr(1)
+      .nr(8)
       .kr(1)
       .sr(1)
-      .m(4)
-      .n(2)
+      .m(1)
+      .n(8)
       .k(2)
       .a_stride(5)
-      .Test(xnn_f32_gemm_minmax_ukernel_4x2__neon_lane_ld64, xnn_init_f32_minmax_scalar_params);
+      .Test(xnn_f32_gemm_minmax_ukernel_1x8__neonfma_lane_ld64, xnn_init_f32_minmax_scalar_params);
   }
 
-  TEST(F32_GEMM_MINMAX_4X2__NEON_LANE_LD64, k_eq_2_subtile) {
-    TEST_REQUIRES_ARM_NEON;
-    for (uint32_t n = 1; n <= 2; n++) {
-      for (uint32_t m = 1; m <= 4; m++) {
+  TEST(F32_GEMM_MINMAX_1X8__NEONFMA_LANE_LD64, k_eq_2_subtile) {
+    TEST_REQUIRES_ARM_NEON_FMA;
+    for (uint32_t n = 1; n <= 8; n++) {
+      for (uint32_t m = 1; m <= 1; m++) {
         GemmMicrokernelTester()
-          .mr(4)
-          .nr(2)
+          .mr(1)
+          .nr(8)
           .kr(1)
           .sr(1)
           .m(m)
           .n(n)
           .k(2)
           .iterations(1)
-          .Test(xnn_f32_gemm_minmax_ukernel_4x2__neon_lane_ld64, xnn_init_f32_minmax_scalar_params);
+          .Test(xnn_f32_gemm_minmax_ukernel_1x8__neonfma_lane_ld64, xnn_init_f32_minmax_scalar_params);
       }
     }
   }
 
-  TEST(F32_GEMM_MINMAX_4X2__NEON_LANE_LD64, k_eq_2_subtile_m) {
-    TEST_REQUIRES_ARM_NEON;
-    for (uint32_t m = 1; m <= 4; m++) {
+  TEST(F32_GEMM_MINMAX_1X8__NEONFMA_LANE_LD64, k_eq_2_subtile_m) {
+    TEST_REQUIRES_ARM_NEON_FMA;
+    for (uint32_t m = 1; m <= 1; m++) {
       GemmMicrokernelTester()
-        .mr(4)
-        .nr(2)
+        .mr(1)
+        .nr(8)
         .kr(1)
         .sr(1)
         .m(m)
-        .n(2)
+        .n(8)
         .k(2)
         .iterations(1)
-        .Test(xnn_f32_gemm_minmax_ukernel_4x2__neon_lane_ld64, xnn_init_f32_minmax_scalar_params);
+        .Test(xnn_f32_gemm_minmax_ukernel_1x8__neonfma_lane_ld64, xnn_init_f32_minmax_scalar_params);
     }
   }
 
-  TEST(F32_GEMM_MINMAX_4X2__NEON_LANE_LD64, k_eq_2_subtile_n) {
-    TEST_REQUIRES_ARM_NEON;
-    for (uint32_t n = 1; n <= 2; n++) {
+  TEST(F32_GEMM_MINMAX_1X8__NEONFMA_LANE_LD64, k_eq_2_subtile_n) {
+    TEST_REQUIRES_ARM_NEON_FMA;
+    for (uint32_t n = 1; n <= 8; n++) {
       GemmMicrokernelTester()
-        .mr(4)
-        .nr(2)
+        .mr(1)
+        .nr(8)
         .kr(1)
         .sr(1)
-        .m(4)
+        .m(1)
         .n(n)
         .k(2)
         .iterations(1)
-        .Test(xnn_f32_gemm_minmax_ukernel_4x2__neon_lane_ld64, xnn_init_f32_minmax_scalar_params);
+        .Test(xnn_f32_gemm_minmax_ukernel_1x8__neonfma_lane_ld64, xnn_init_f32_minmax_scalar_params);
     }
   }
 
-  TEST(F32_GEMM_MINMAX_4X2__NEON_LANE_LD64, k_lt_2) {
-    TEST_REQUIRES_ARM_NEON;
+  TEST(F32_GEMM_MINMAX_1X8__NEONFMA_LANE_LD64, k_lt_2) {
+    TEST_REQUIRES_ARM_NEON_FMA;
     for (size_t k = 1; k < 2; k++) {
       GemmMicrokernelTester()
-        .mr(4)
-        .nr(2)
+        .mr(1)
+        .nr(8)
         .kr(1)
         .sr(1)
-        .m(4)
-        .n(2)
+        .m(1)
+        .n(8)
         .k(k)
-        .Test(xnn_f32_gemm_minmax_ukernel_4x2__neon_lane_ld64, xnn_init_f32_minmax_scalar_params);
+        .Test(xnn_f32_gemm_minmax_ukernel_1x8__neonfma_lane_ld64, xnn_init_f32_minmax_scalar_params);
     }
   }
 
-  TEST(F32_GEMM_MINMAX_4X2__NEON_LANE_LD64, k_lt_2_strided_a) {
-    TEST_REQUIRES_ARM_NEON;
+  TEST(F32_GEMM_MINMAX_1X8__NEONFMA_LANE_LD64, k_lt_2_strided_a) {
+    TEST_REQUIRES_ARM_NEON_FMA;
     for (size_t k = 1; k < 2; k++) {
       GemmMicrokernelTester()
-        .mr(4)
-        .nr(2)
+        .mr(1)
+        .nr(8)
         .kr(1)
         .sr(1)
-        .m(4)
-        .n(2)
+        .m(1)
+        .n(8)
         .k(k)
         .a_stride(5)
-        .Test(xnn_f32_gemm_minmax_ukernel_4x2__neon_lane_ld64, xnn_init_f32_minmax_scalar_params);
+        .Test(xnn_f32_gemm_minmax_ukernel_1x8__neonfma_lane_ld64, xnn_init_f32_minmax_scalar_params);
     }
   }
 
-  TEST(F32_GEMM_MINMAX_4X2__NEON_LANE_LD64, k_lt_2_subtile) {
-    TEST_REQUIRES_ARM_NEON;
+  TEST(F32_GEMM_MINMAX_1X8__NEONFMA_LANE_LD64, k_lt_2_subtile) {
+    TEST_REQUIRES_ARM_NEON_FMA;
     for (size_t k = 1; k < 2; k++) {
-      for (uint32_t n = 1; n <= 2; n++) {
-        for (uint32_t m = 1; m <= 4; m++) {
+      for (uint32_t n = 1; n <= 8; n++) {
+        for (uint32_t m = 1; m <= 1; m++) {
           GemmMicrokernelTester()
-            .mr(4)
-            .nr(2)
+            .mr(1)
+            .nr(8)
             .kr(1)
             .sr(1)
             .m(m)
             .n(n)
             .k(k)
             .iterations(1)
-            .Test(xnn_f32_gemm_minmax_ukernel_4x2__neon_lane_ld64, xnn_init_f32_minmax_scalar_params);
+            .Test(xnn_f32_gemm_minmax_ukernel_1x8__neonfma_lane_ld64, xnn_init_f32_minmax_scalar_params);
         }
       }
     }
   }
 
-  TEST(F32_GEMM_MINMAX_4X2__NEON_LANE_LD64, k_gt_2) {
-    TEST_REQUIRES_ARM_NEON;
+  TEST(F32_GEMM_MINMAX_1X8__NEONFMA_LANE_LD64, k_gt_2) {
+    TEST_REQUIRES_ARM_NEON_FMA;
     for (size_t k = 3; k < 4; k++) {
       GemmMicrokernelTester()
-        .mr(4)
-        .nr(2)
+        .mr(1)
+        .nr(8)
         .kr(1)
         .sr(1)
-        .m(4)
-        .n(2)
+        .m(1)
+        .n(8)
         .k(k)
-        .Test(xnn_f32_gemm_minmax_ukernel_4x2__neon_lane_ld64, xnn_init_f32_minmax_scalar_params);
+        .Test(xnn_f32_gemm_minmax_ukernel_1x8__neonfma_lane_ld64, xnn_init_f32_minmax_scalar_params);
     }
   }
 
-  TEST(F32_GEMM_MINMAX_4X2__NEON_LANE_LD64, k_gt_2_strided_a) {
-    TEST_REQUIRES_ARM_NEON;
+  TEST(F32_GEMM_MINMAX_1X8__NEONFMA_LANE_LD64, k_gt_2_strided_a) {
+    TEST_REQUIRES_ARM_NEON_FMA;
     for (size_t k = 3; k < 4; k++) {
       GemmMicrokernelTester()
-        .mr(4)
-        .nr(2)
+        .mr(1)
+        .nr(8)
         .kr(1)
         .sr(1)
-        .m(4)
-        .n(2)
+        .m(1)
+        .n(8)
         .k(k)
         .a_stride(7)
-        .Test(xnn_f32_gemm_minmax_ukernel_4x2__neon_lane_ld64, xnn_init_f32_minmax_scalar_params);
+        .Test(xnn_f32_gemm_minmax_ukernel_1x8__neonfma_lane_ld64, xnn_init_f32_minmax_scalar_params);
     }
   }
 
-  TEST(F32_GEMM_MINMAX_4X2__NEON_LANE_LD64, k_gt_2_subtile) {
-    TEST_REQUIRES_ARM_NEON;
+  TEST(F32_GEMM_MINMAX_1X8__NEONFMA_LANE_LD64, k_gt_2_subtile) {
+    TEST_REQUIRES_ARM_NEON_FMA;
     for (size_t k = 3; k < 4; k++) {
-      for (uint32_t n = 1; n <= 2; n++) {
-        for (uint32_t m = 1; m <= 4; m++) {
+      for (uint32_t n = 1; n <= 8; n++) {
+        for (uint32_t m = 1; m <= 1; m++) {
           GemmMicrokernelTester()
-            .mr(4)
-            .nr(2)
+            .mr(1)
+            .nr(8)
             .kr(1)
             .sr(1)
             .m(m)
             .n(n)
             .k(k)
             .iterations(1)
-            .Test(xnn_f32_gemm_minmax_ukernel_4x2__neon_lane_ld64, xnn_init_f32_minmax_scalar_params);
+            .Test(xnn_f32_gemm_minmax_ukernel_1x8__neonfma_lane_ld64, xnn_init_f32_minmax_scalar_params);
         }
       }
     }
   }
 
-  TEST(F32_GEMM_MINMAX_4X2__NEON_LANE_LD64, k_div_2) {
-    TEST_REQUIRES_ARM_NEON;
+  TEST(F32_GEMM_MINMAX_1X8__NEONFMA_LANE_LD64, k_div_2) {
+    TEST_REQUIRES_ARM_NEON_FMA;
     for (size_t k = 4; k <= 20; k += 2) {
       GemmMicrokernelTester()
-        .mr(4)
-        .nr(2)
+        .mr(1)
+        .nr(8)
         .kr(1)
         .sr(1)
-        .m(4)
-        .n(2)
+        .m(1)
+        .n(8)
         .k(k)
-        .Test(xnn_f32_gemm_minmax_ukernel_4x2__neon_lane_ld64, xnn_init_f32_minmax_scalar_params);
+        .Test(xnn_f32_gemm_minmax_ukernel_1x8__neonfma_lane_ld64, xnn_init_f32_minmax_scalar_params);
     }
   }
 
-  TEST(F32_GEMM_MINMAX_4X2__NEON_LANE_LD64, k_div_2_strided_a) {
-    TEST_REQUIRES_ARM_NEON;
+  TEST(F32_GEMM_MINMAX_1X8__NEONFMA_LANE_LD64, k_div_2_strided_a) {
+    TEST_REQUIRES_ARM_NEON_FMA;
     for (size_t k = 4; k <= 20; k += 2) {
       GemmMicrokernelTester()
-        .mr(4)
-        .nr(2)
+        .mr(1)
+        .nr(8)
         .kr(1)
         .sr(1)
-        .m(4)
-        .n(2)
+        .m(1)
+        .n(8)
         .k(k)
         .a_stride(23)
-        .Test(xnn_f32_gemm_minmax_ukernel_4x2__neon_lane_ld64, xnn_init_f32_minmax_scalar_params);
+        .Test(xnn_f32_gemm_minmax_ukernel_1x8__neonfma_lane_ld64, xnn_init_f32_minmax_scalar_params);
     }
   }
 
-  TEST(F32_GEMM_MINMAX_4X2__NEON_LANE_LD64, k_div_2_subtile) {
-    TEST_REQUIRES_ARM_NEON;
+  TEST(F32_GEMM_MINMAX_1X8__NEONFMA_LANE_LD64, k_div_2_subtile) {
+    TEST_REQUIRES_ARM_NEON_FMA;
     for (size_t k = 4; k <= 20; k += 2) {
-      for (uint32_t n = 1; n <= 2; n++) {
-        for (uint32_t m = 1; m <= 4; m++) {
+      for (uint32_t n = 1; n <= 8; n++) {
+        for (uint32_t m = 1; m <= 1; m++) {
           GemmMicrokernelTester()
-            .mr(4)
-            .nr(2)
+            .mr(1)
+            .nr(8)
             .kr(1)
             .sr(1)
             .m(m)
             .n(n)
             .k(k)
             .iterations(1)
-            .Test(xnn_f32_gemm_minmax_ukernel_4x2__neon_lane_ld64, xnn_init_f32_minmax_scalar_params);
+            .Test(xnn_f32_gemm_minmax_ukernel_1x8__neonfma_lane_ld64, xnn_init_f32_minmax_scalar_params);
         }
       }
     }
   }
 
-  TEST(F32_GEMM_MINMAX_4X2__NEON_LANE_LD64, n_gt_2) {
-    TEST_REQUIRES_ARM_NEON;
-    for (uint32_t n = 3; n < 4; n++) {
+  TEST(F32_GEMM_MINMAX_1X8__NEONFMA_LANE_LD64, n_gt_8) {
+    TEST_REQUIRES_ARM_NEON_FMA;
+    for (uint32_t n = 9; n < 16; n++) {
       for (size_t k = 1; k <= 10; k += 3) {
         GemmMicrokernelTester()
-          .mr(4)
-          .nr(2)
+          .mr(1)
+          .nr(8)
           .kr(1)
           .sr(1)
-          .m(4)
+          .m(1)
           .n(n)
           .k(k)
-          .Test(xnn_f32_gemm_minmax_ukernel_4x2__neon_lane_ld64, xnn_init_f32_minmax_scalar_params);
+          .Test(xnn_f32_gemm_minmax_ukernel_1x8__neonfma_lane_ld64, xnn_init_f32_minmax_scalar_params);
       }
     }
   }
 
-  TEST(F32_GEMM_MINMAX_4X2__NEON_LANE_LD64, n_gt_2_strided_cn) {
-    TEST_REQUIRES_ARM_NEON;
-    for (uint32_t n = 3; n < 4; n++) {
+  TEST(F32_GEMM_MINMAX_1X8__NEONFMA_LANE_LD64, n_gt_8_strided_cn) {
+    TEST_REQUIRES_ARM_NEON_FMA;
+    for (uint32_t n = 9; n < 16; n++) {
       for (size_t k = 1; k <= 10; k += 3) {
         GemmMicrokernelTester()
-          .mr(4)
-          .nr(2)
+          .mr(1)
+          .nr(8)
           .kr(1)
           .sr(1)
-          .m(4)
+          .m(1)
           .n(n)
           .k(k)
-          .cn_stride(5)
-          .Test(xnn_f32_gemm_minmax_ukernel_4x2__neon_lane_ld64, xnn_init_f32_minmax_scalar_params);
+          .cn_stride(11)
+          .Test(xnn_f32_gemm_minmax_ukernel_1x8__neonfma_lane_ld64, xnn_init_f32_minmax_scalar_params);
       }
     }
   }
 
-  TEST(F32_GEMM_MINMAX_4X2__NEON_LANE_LD64, n_gt_2_strided_a) {
-    TEST_REQUIRES_ARM_NEON;
-    for (uint32_t n = 3; n < 4; n++) {
+  TEST(F32_GEMM_MINMAX_1X8__NEONFMA_LANE_LD64, n_gt_8_strided_a) {
+    TEST_REQUIRES_ARM_NEON_FMA;
+    for (uint32_t n = 9; n < 16; n++) {
       for (size_t k = 1; k <= 10; k += 3) {
         GemmMicrokernelTester()
-          .mr(4)
-          .nr(2)
+          .mr(1)
+          .nr(8)
           .kr(1)
           .sr(1)
-          .m(4)
+          .m(1)
           .n(n)
           .k(k)
           .a_stride(13)
-          .Test(xnn_f32_gemm_minmax_ukernel_4x2__neon_lane_ld64, xnn_init_f32_minmax_scalar_params);
+          .Test(xnn_f32_gemm_minmax_ukernel_1x8__neonfma_lane_ld64, xnn_init_f32_minmax_scalar_params);
       }
     }
   }
 
-  TEST(F32_GEMM_MINMAX_4X2__NEON_LANE_LD64, n_gt_2_subtile) {
-    TEST_REQUIRES_ARM_NEON;
-    for (uint32_t n = 3; n < 4; n++) {
+  TEST(F32_GEMM_MINMAX_1X8__NEONFMA_LANE_LD64, n_gt_8_subtile) {
+    TEST_REQUIRES_ARM_NEON_FMA;
+    for (uint32_t n = 9; n < 16; n++) {
       for (size_t k = 1; k <= 10; k += 3) {
-        for (uint32_t m = 1; m <= 4; m++) {
+        for (uint32_t m = 1; m <= 1; m++) {
           GemmMicrokernelTester()
-            .mr(4)
-            .nr(2)
+            .mr(1)
+            .nr(8)
             .kr(1)
             .sr(1)
             .m(m)
             .n(n)
             .k(k)
             .iterations(1)
-            .Test(xnn_f32_gemm_minmax_ukernel_4x2__neon_lane_ld64, xnn_init_f32_minmax_scalar_params);
+            .Test(xnn_f32_gemm_minmax_ukernel_1x8__neonfma_lane_ld64, xnn_init_f32_minmax_scalar_params);
         }
       }
     }
   }
 
-  TEST(F32_GEMM_MINMAX_4X2__NEON_LANE_LD64, n_div_2) {
-    TEST_REQUIRES_ARM_NEON;
-    for (uint32_t n = 4; n <= 6; n += 2) {
+  TEST(F32_GEMM_MINMAX_1X8__NEONFMA_LANE_LD64, n_div_8) {
+    TEST_REQUIRES_ARM_NEON_FMA;
+    for (uint32_t n = 16; n <= 24; n += 8) {
       for (size_t k = 1; k <= 10; k += 3) {
         GemmMicrokernelTester()
-          .mr(4)
-          .nr(2)
+          .mr(1)
+          .nr(8)
           .kr(1)
           .sr(1)
-          .m(4)
+          .m(1)
           .n(n)
           .k(k)
-          .Test(xnn_f32_gemm_minmax_ukernel_4x2__neon_lane_ld64, xnn_init_f32_minmax_scalar_params);
+          .Test(xnn_f32_gemm_minmax_ukernel_1x8__neonfma_lane_ld64, xnn_init_f32_minmax_scalar_params);
       }
     }
   }
 
-  TEST(F32_GEMM_MINMAX_4X2__NEON_LANE_LD64, n_div_2_strided_cn) {
-    TEST_REQUIRES_ARM_NEON;
-    for (uint32_t n = 4; n <= 6; n += 2) {
+  TEST(F32_GEMM_MINMAX_1X8__NEONFMA_LANE_LD64, n_div_8_strided_cn) {
+    TEST_REQUIRES_ARM_NEON_FMA;
+    for (uint32_t n = 16; n <= 24; n += 8) {
       for (size_t k = 1; k <= 10; k += 3) {
         GemmMicrokernelTester()
-          .mr(4)
-          .nr(2)
+          .mr(1)
+          .nr(8)
           .kr(1)
           .sr(1)
-          .m(4)
+          .m(1)
           .n(n)
           .k(k)
-          .cn_stride(5)
-          .Test(xnn_f32_gemm_minmax_ukernel_4x2__neon_lane_ld64, xnn_init_f32_minmax_scalar_params);
+          .cn_stride(11)
+          .Test(xnn_f32_gemm_minmax_ukernel_1x8__neonfma_lane_ld64, xnn_init_f32_minmax_scalar_params);
       }
     }
   }
 
-  TEST(F32_GEMM_MINMAX_4X2__NEON_LANE_LD64, n_div_2_strided_a) {
-    TEST_REQUIRES_ARM_NEON;
-    for (uint32_t n = 4; n <= 6; n += 2) {
+  TEST(F32_GEMM_MINMAX_1X8__NEONFMA_LANE_LD64, n_div_8_strided_a) {
+    TEST_REQUIRES_ARM_NEON_FMA;
+    for (uint32_t n = 16; n <= 24; n += 8) {
       for (size_t k = 1; k <= 10; k += 3) {
         GemmMicrokernelTester()
-          .mr(4)
-          .nr(2)
+          .mr(1)
+          .nr(8)
           .kr(1)
           .sr(1)
-          .m(4)
+          .m(1)
           .n(n)
           .k(k)
           .a_stride(13)
-          .Test(xnn_f32_gemm_minmax_ukernel_4x2__neon_lane_ld64, xnn_init_f32_minmax_scalar_params);
+          .Test(xnn_f32_gemm_minmax_ukernel_1x8__neonfma_lane_ld64, xnn_init_f32_minmax_scalar_params);
       }
     }
   }
 
-  TEST(F32_GEMM_MINMAX_4X2__NEON_LANE_LD64, n_div_2_subtile) {
-    TEST_REQUIRES_ARM_NEON;
-    for (uint32_t n = 4; n <= 6; n += 2) {
+  TEST(F32_GEMM_MINMAX_1X8__NEONFMA_LANE_LD64, n_div_8_subtile) {
+    TEST_REQUIRES_ARM_NEON_FMA;
+    for (uint32_t n = 16; n <= 24; n += 8) {
       for (size_t k = 1; k <= 10; k += 3) {
-        for (uint32_t m = 1; m <= 4; m++) {
+        for (uint32_t m = 1; m <= 1; m++) {
           GemmMicrokernelTester()
-            .mr(4)
-            .nr(2)
+            .mr(1)
+            .nr(8)
             .kr(1)
             .sr(1)
             .m(m)
             .n(n)
             .k(k)
             .iterations(1)
-            .Test(xnn_f32_gemm_minmax_ukernel_4x2__neon_lane_ld64, xnn_init_f32_minmax_scalar_params);
+            .Test(xnn_f32_gemm_minmax_ukernel_1x8__neonfma_lane_ld64, xnn_init_f32_minmax_scalar_params);
         }
       }
     }
   }
 
-  TEST(F32_GEMM_MINMAX_4X2__NEON_LANE_LD64, strided_cm_subtile) {
-    TEST_REQUIRES_ARM_NEON;
+  TEST(F32_GEMM_MINMAX_1X8__NEONFMA_LANE_LD64, strided_cm_subtile) {
+    TEST_REQUIRES_ARM_NEON_FMA;
     for (size_t k = 1; k <= 10; k += 3) {
-      for (uint32_t n = 1; n <= 2; n++) {
-        for (uint32_t m = 1; m <= 4; m++) {
+      for (uint32_t n = 1; n <= 8; n++) {
+        for (uint32_t m = 1; m <= 1; m++) {
           GemmMicrokernelTester()
-            .mr(4)
-            .nr(2)
+            .mr(1)
+            .nr(8)
             .kr(1)
             .sr(1)
             .m(m)
             .n(n)
             .k(k)
-            .cm_stride(5)
+            .cm_stride(11)
             .iterations(1)
-            .Test(xnn_f32_gemm_minmax_ukernel_4x2__neon_lane_ld64, xnn_init_f32_minmax_scalar_params);
+            .Test(xnn_f32_gemm_minmax_ukernel_1x8__neonfma_lane_ld64, xnn_init_f32_minmax_scalar_params);
         }
       }
     }
   }
 
-  TEST(F32_GEMM_MINMAX_4X2__NEON_LANE_LD64, qmin) {
-    TEST_REQUIRES_ARM_NEON;
+  TEST(F32_GEMM_MINMAX_1X8__NEONFMA_LANE_LD64, qmin) {
+    TEST_REQUIRES_ARM_NEON_FMA;
     GemmMicrokernelTester()
-      .mr(4)
-      .nr(2)
+      .mr(1)
+      .nr(8)
       .kr(1)
       .sr(1)
-      .m(4)
-      .n(2)
+      .m(1)
+      .n(8)
       .k(2)
       .qmin(128)
-      .Test(xnn_f32_gemm_minmax_ukernel_4x2__neon_lane_ld64, xnn_init_f32_minmax_scalar_params);
+      .Test(xnn_f32_gemm_minmax_ukernel_1x8__neonfma_lane_ld64, xnn_init_f32_minmax_scalar_params);
   }
 
-  TEST(F32_GEMM_MINMAX_4X2__NEON_LANE_LD64, qmax) {
-    TEST_REQUIRES_ARM_NEON;
+  TEST(F32_GEMM_MINMAX_1X8__NEONFMA_LANE_LD64, qmax) {
+    TEST_REQUIRES_ARM_NEON_FMA;
     GemmMicrokernelTester()
-      .mr(4)
-      .nr(2)
+      .mr(1)
+      .nr(8)
       .kr(1)
       .sr(1)
-      .m(4)
-      .n(2)
+      .m(1)
+      .n(8)
       .k(2)
       .qmax(128)
-      .Test(xnn_f32_gemm_minmax_ukernel_4x2__neon_lane_ld64, xnn_init_f32_minmax_scalar_params);
+      .Test(xnn_f32_gemm_minmax_ukernel_1x8__neonfma_lane_ld64, xnn_init_f32_minmax_scalar_params);
   }
 
-  TEST(F32_GEMM_MINMAX_4X2__NEON_LANE_LD64, strided_cm) {
-    TEST_REQUIRES_ARM_NEON;
+  TEST(F32_GEMM_MINMAX_1X8__NEONFMA_LANE_LD64, strided_cm) {
+    TEST_REQUIRES_ARM_NEON_FMA;
     GemmMicrokernelTester()
-      .mr(4)
-      .nr(2)
+      .mr(1)
+      .nr(8)
       .kr(1)
       .sr(1)
-      .m(4)
-      .n(2)
+      .m(1)
+      .n(8)
       .k(2)
-      .cm_stride(5)
-      .Test(xnn_f32_gemm_minmax_ukernel_4x2__neon_lane_ld64, xnn_init_f32_minmax_scalar_params);
+      .cm_stride(11)
+      .Test(xnn_f32_gemm_minmax_ukernel_1x8__neonfma_lane_ld64, xnn_init_f32_minmax_scalar_params);
   }
-#endif  // XNN_ARCH_ARM || XNN_ARCH_ARM64
+#endif  // XNN_ARCH_ARM64
 
 
 #if XNN_ARCH_ARM || XNN_ARCH_ARM64
-  TEST(F32_GEMM_MINMAX_4X8__NEON_DUP_LD64, k_eq_2) {
+  TEST(F32_GEMM_MINMAX_4X2__NEON_LANE_LD64, k_eq_2) {
     TEST_REQUIRES_ARM_NEON;
     GemmMicrokernelTester()
       .mr(4)
-      .nr(8)
+      .nr(2)
       .kr(1)
       .sr(1)
       .m(4)
-      .n(8)
+      .n(2)
       .k(2)
-      .Test(xnn_f32_gemm_minmax_ukernel_4x8__neon_dup_ld64, xnn_init_f32_minmax_scalar_params);
+      .Test(xnn_f32_gemm_minmax_ukernel_4x2__neon_lane_ld64, xnn_init_f32_minmax_scalar_params);
   }
 
-  TEST(F32_GEMM_MINMAX_4X8__NEON_DUP_LD64, strided_cn) {
+  TEST(F32_GEMM_MINMAX_4X2__NEON_LANE_LD64, strided_cn) {
     TEST_REQUIRES_ARM_NEON;
     GemmMicrokernelTester()
       .mr(4)
-      .nr(8)
+      .nr(2)
       .kr(1)
       .sr(1)
       .m(4)
-      .n(8)
+      .n(2)
       .k(2)
-      .cn_stride(11)
-      .Test(xnn_f32_gemm_minmax_ukernel_4x8__neon_dup_ld64, xnn_init_f32_minmax_scalar_params);
+      .cn_stride(5)
+      .Test(xnn_f32_gemm_minmax_ukernel_4x2__neon_lane_ld64, xnn_init_f32_minmax_scalar_params);
   }
 
-  TEST(F32_GEMM_MINMAX_4X8__NEON_DUP_LD64, k_eq_2_strided_a) {
+  TEST(F32_GEMM_MINMAX_4X2__NEON_LANE_LD64, k_eq_2_strided_a) {
     TEST_REQUIRES_ARM_NEON;
     GemmMicrokernelTester()
       .mr(4)
-      .nr(8)
+      .nr(2)
       .kr(1)
       .sr(1)
       .m(4)
-      .n(8)
+      .n(2)
       .k(2)
       .a_stride(5)
-      .Test(xnn_f32_gemm_minmax_ukernel_4x8__neon_dup_ld64, xnn_init_f32_minmax_scalar_params);
+      .Test(xnn_f32_gemm_minmax_ukernel_4x2__neon_lane_ld64, xnn_init_f32_minmax_scalar_params);
   }
 
-  TEST(F32_GEMM_MINMAX_4X8__NEON_DUP_LD64, k_eq_2_subtile) {
+  TEST(F32_GEMM_MINMAX_4X2__NEON_LANE_LD64, k_eq_2_subtile) {
     TEST_REQUIRES_ARM_NEON;
-    for (uint32_t n = 1; n <= 8; n++) {
+    for (uint32_t n = 1; n <= 2; n++) {
       for (uint32_t m = 1; m <= 4; m++) {
         GemmMicrokernelTester()
           .mr(4)
-          .nr(8)
+          .nr(2)
           .kr(1)
           .sr(1)
           .m(m)
           .n(n)
           .k(2)
           .iterations(1)
-          .Test(xnn_f32_gemm_minmax_ukernel_4x8__neon_dup_ld64, xnn_init_f32_minmax_scalar_params);
+          .Test(xnn_f32_gemm_minmax_ukernel_4x2__neon_lane_ld64, xnn_init_f32_minmax_scalar_params);
       }
     }
   }
 
-  TEST(F32_GEMM_MINMAX_4X8__NEON_DUP_LD64, k_eq_2_subtile_m) {
+  TEST(F32_GEMM_MINMAX_4X2__NEON_LANE_LD64, k_eq_2_subtile_m) {
     TEST_REQUIRES_ARM_NEON;
     for (uint32_t m = 1; m <= 4; m++) {
       GemmMicrokernelTester()
         .mr(4)
-        .nr(8)
+        .nr(2)
         .kr(1)
         .sr(1)
         .m(m)
-        .n(8)
+        .n(2)
         .k(2)
         .iterations(1)
-        .Test(xnn_f32_gemm_minmax_ukernel_4x8__neon_dup_ld64, xnn_init_f32_minmax_scalar_params);
+        .Test(xnn_f32_gemm_minmax_ukernel_4x2__neon_lane_ld64, xnn_init_f32_minmax_scalar_params);
     }
   }
 
-  TEST(F32_GEMM_MINMAX_4X8__NEON_DUP_LD64, k_eq_2_subtile_n) {
+  TEST(F32_GEMM_MINMAX_4X2__NEON_LANE_LD64, k_eq_2_subtile_n) {
     TEST_REQUIRES_ARM_NEON;
-    for (uint32_t n = 1; n <= 8; n++) {
+    for (uint32_t n = 1; n <= 2; n++) {
       GemmMicrokernelTester()
         .mr(4)
-        .nr(8)
+        .nr(2)
         .kr(1)
         .sr(1)
         .m(4)
         .n(n)
         .k(2)
         .iterations(1)
-        .Test(xnn_f32_gemm_minmax_ukernel_4x8__neon_dup_ld64, xnn_init_f32_minmax_scalar_params);
+        .Test(xnn_f32_gemm_minmax_ukernel_4x2__neon_lane_ld64, xnn_init_f32_minmax_scalar_params);
     }
   }
 
-  TEST(F32_GEMM_MINMAX_4X8__NEON_DUP_LD64, k_lt_2) {
+  TEST(F32_GEMM_MINMAX_4X2__NEON_LANE_LD64, k_lt_2) {
     TEST_REQUIRES_ARM_NEON;
     for (size_t k = 1; k < 2; k++) {
       GemmMicrokernelTester()
         .mr(4)
-        .nr(8)
+        .nr(2)
         .kr(1)
         .sr(1)
         .m(4)
-        .n(8)
+        .n(2)
         .k(k)
-        .Test(xnn_f32_gemm_minmax_ukernel_4x8__neon_dup_ld64, xnn_init_f32_minmax_scalar_params);
+        .Test(xnn_f32_gemm_minmax_ukernel_4x2__neon_lane_ld64, xnn_init_f32_minmax_scalar_params);
     }
   }
 
-  TEST(F32_GEMM_MINMAX_4X8__NEON_DUP_LD64, k_lt_2_strided_a) {
+  TEST(F32_GEMM_MINMAX_4X2__NEON_LANE_LD64, k_lt_2_strided_a) {
     TEST_REQUIRES_ARM_NEON;
     for (size_t k = 1; k < 2; k++) {
       GemmMicrokernelTester()
         .mr(4)
-        .nr(8)
+        .nr(2)
         .kr(1)
         .sr(1)
         .m(4)
-        .n(8)
+        .n(2)
         .k(k)
         .a_stride(5)
-        .Test(xnn_f32_gemm_minmax_ukernel_4x8__neon_dup_ld64, xnn_init_f32_minmax_scalar_params);
+        .Test(xnn_f32_gemm_minmax_ukernel_4x2__neon_lane_ld64, xnn_init_f32_minmax_scalar_params);
     }
   }
 
-  TEST(F32_GEMM_MINMAX_4X8__NEON_DUP_LD64, k_lt_2_subtile) {
+  TEST(F32_GEMM_MINMAX_4X2__NEON_LANE_LD64, k_lt_2_subtile) {
     TEST_REQUIRES_ARM_NEON;
     for (size_t k = 1; k < 2; k++) {
-      for (uint32_t n = 1; n <= 8; n++) {
+      for (uint32_t n = 1; n <= 2; n++) {
         for (uint32_t m = 1; m <= 4; m++) {
           GemmMicrokernelTester()
             .mr(4)
-            .nr(8)
+            .nr(2)
             .kr(1)
             .sr(1)
             .m(m)
             .n(n)
             .k(k)
             .iterations(1)
-            .Test(xnn_f32_gemm_minmax_ukernel_4x8__neon_dup_ld64, xnn_init_f32_minmax_scalar_params);
+            .Test(xnn_f32_gemm_minmax_ukernel_4x2__neon_lane_ld64, xnn_init_f32_minmax_scalar_params);
         }
       }
     }
   }
 
-  TEST(F32_GEMM_MINMAX_4X8__NEON_DUP_LD64, k_gt_2) {
+  TEST(F32_GEMM_MINMAX_4X2__NEON_LANE_LD64, k_gt_2) {
     TEST_REQUIRES_ARM_NEON;
     for (size_t k = 3; k < 4; k++) {
       GemmMicrokernelTester()
         .mr(4)
-        .nr(8)
+        .nr(2)
         .kr(1)
         .sr(1)
         .m(4)
-        .n(8)
+        .n(2)
         .k(k)
-        .Test(xnn_f32_gemm_minmax_ukernel_4x8__neon_dup_ld64, xnn_init_f32_minmax_scalar_params);
+        .Test(xnn_f32_gemm_minmax_ukernel_4x2__neon_lane_ld64, xnn_init_f32_minmax_scalar_params);
     }
   }
 
-  TEST(F32_GEMM_MINMAX_4X8__NEON_DUP_LD64, k_gt_2_strided_a) {
+  TEST(F32_GEMM_MINMAX_4X2__NEON_LANE_LD64, k_gt_2_strided_a) {
     TEST_REQUIRES_ARM_NEON;
     for (size_t k = 3; k < 4; k++) {
       GemmMicrokernelTester()
         .mr(4)
-        .nr(8)
+        .nr(2)
         .kr(1)
         .sr(1)
         .m(4)
-        .n(8)
+        .n(2)
         .k(k)
         .a_stride(7)
-        .Test(xnn_f32_gemm_minmax_ukernel_4x8__neon_dup_ld64, xnn_init_f32_minmax_scalar_params);
+        .Test(xnn_f32_gemm_minmax_ukernel_4x2__neon_lane_ld64, xnn_init_f32_minmax_scalar_params);
     }
   }
 
-  TEST(F32_GEMM_MINMAX_4X8__NEON_DUP_LD64, k_gt_2_subtile) {
+  TEST(F32_GEMM_MINMAX_4X2__NEON_LANE_LD64, k_gt_2_subtile) {
     TEST_REQUIRES_ARM_NEON;
     for (size_t k = 3; k < 4; k++) {
-      for (uint32_t n = 1; n <= 8; n++) {
+      for (uint32_t n = 1; n <= 2; n++) {
         for (uint32_t m = 1; m <= 4; m++) {
           GemmMicrokernelTester()
             .mr(4)
-            .nr(8)
+            .nr(2)
             .kr(1)
             .sr(1)
             .m(m)
             .n(n)
             .k(k)
             .iterations(1)
-            .Test(xnn_f32_gemm_minmax_ukernel_4x8__neon_dup_ld64, xnn_init_f32_minmax_scalar_params);
+            .Test(xnn_f32_gemm_minmax_ukernel_4x2__neon_lane_ld64, xnn_init_f32_minmax_scalar_params);
         }
       }
     }
   }
 
-  TEST(F32_GEMM_MINMAX_4X8__NEON_DUP_LD64, k_div_2) {
+  TEST(F32_GEMM_MINMAX_4X2__NEON_LANE_LD64, k_div_2) {
     TEST_REQUIRES_ARM_NEON;
     for (size_t k = 4; k <= 20; k += 2) {
       GemmMicrokernelTester()
         .mr(4)
-        .nr(8)
+        .nr(2)
         .kr(1)
         .sr(1)
         .m(4)
-        .n(8)
+        .n(2)
         .k(k)
-        .Test(xnn_f32_gemm_minmax_ukernel_4x8__neon_dup_ld64, xnn_init_f32_minmax_scalar_params);
+        .Test(xnn_f32_gemm_minmax_ukernel_4x2__neon_lane_ld64, xnn_init_f32_minmax_scalar_params);
     }
   }
 
-  TEST(F32_GEMM_MINMAX_4X8__NEON_DUP_LD64, k_div_2_strided_a) {
+  TEST(F32_GEMM_MINMAX_4X2__NEON_LANE_LD64, k_div_2_strided_a) {
     TEST_REQUIRES_ARM_NEON;
     for (size_t k = 4; k <= 20; k += 2) {
       GemmMicrokernelTester()
         .mr(4)
-        .nr(8)
+        .nr(2)
         .kr(1)
         .sr(1)
         .m(4)
-        .n(8)
+        .n(2)
         .k(k)
         .a_stride(23)
-        .Test(xnn_f32_gemm_minmax_ukernel_4x8__neon_dup_ld64, xnn_init_f32_minmax_scalar_params);
+        .Test(xnn_f32_gemm_minmax_ukernel_4x2__neon_lane_ld64, xnn_init_f32_minmax_scalar_params);
     }
   }
 
-  TEST(F32_GEMM_MINMAX_4X8__NEON_DUP_LD64, k_div_2_subtile) {
+  TEST(F32_GEMM_MINMAX_4X2__NEON_LANE_LD64, k_div_2_subtile) {
     TEST_REQUIRES_ARM_NEON;
     for (size_t k = 4; k <= 20; k += 2) {
-      for (uint32_t n = 1; n <= 8; n++) {
+      for (uint32_t n = 1; n <= 2; n++) {
         for (uint32_t m = 1; m <= 4; m++) {
           GemmMicrokernelTester()
             .mr(4)
-            .nr(8)
+            .nr(2)
             .kr(1)
             .sr(1)
             .m(m)
             .n(n)
             .k(k)
             .iterations(1)
-            .Test(xnn_f32_gemm_minmax_ukernel_4x8__neon_dup_ld64, xnn_init_f32_minmax_scalar_params);
+            .Test(xnn_f32_gemm_minmax_ukernel_4x2__neon_lane_ld64, xnn_init_f32_minmax_scalar_params);
         }
       }
     }
   }
 
-  TEST(F32_GEMM_MINMAX_4X8__NEON_DUP_LD64, n_gt_8) {
+  TEST(F32_GEMM_MINMAX_4X2__NEON_LANE_LD64, n_gt_2) {
     TEST_REQUIRES_ARM_NEON;
-    for (uint32_t n = 9; n < 16; n++) {
+    for (uint32_t n = 3; n < 4; n++) {
       for (size_t k = 1; k <= 10; k += 3) {
         GemmMicrokernelTester()
           .mr(4)
-          .nr(8)
+          .nr(2)
           .kr(1)
           .sr(1)
           .m(4)
           .n(n)
           .k(k)
-          .Test(xnn_f32_gemm_minmax_ukernel_4x8__neon_dup_ld64, xnn_init_f32_minmax_scalar_params);
+          .Test(xnn_f32_gemm_minmax_ukernel_4x2__neon_lane_ld64, xnn_init_f32_minmax_scalar_params);
       }
     }
   }
 
-  TEST(F32_GEMM_MINMAX_4X8__NEON_DUP_LD64, n_gt_8_strided_cn) {
+  TEST(F32_GEMM_MINMAX_4X2__NEON_LANE_LD64, n_gt_2_strided_cn) {
     TEST_REQUIRES_ARM_NEON;
-    for (uint32_t n = 9; n < 16; n++) {
+    for (uint32_t n = 3; n < 4; n++) {
       for (size_t k = 1; k <= 10; k += 3) {
         GemmMicrokernelTester()
           .mr(4)
-          .nr(8)
+          .nr(2)
           .kr(1)
           .sr(1)
           .m(4)
           .n(n)
           .k(k)
-          .cn_stride(11)
-          .Test(xnn_f32_gemm_minmax_ukernel_4x8__neon_dup_ld64, xnn_init_f32_minmax_scalar_params);
+          .cn_stride(5)
+          .Test(xnn_f32_gemm_minmax_ukernel_4x2__neon_lane_ld64, xnn_init_f32_minmax_scalar_params);
       }
     }
   }
 
-  TEST(F32_GEMM_MINMAX_4X8__NEON_DUP_LD64, n_gt_8_strided_a) {
+  TEST(F32_GEMM_MINMAX_4X2__NEON_LANE_LD64, n_gt_2_strided_a) {
     TEST_REQUIRES_ARM_NEON;
-    for (uint32_t n = 9; n < 16; n++) {
+    for (uint32_t n = 3; n < 4; n++) {
       for (size_t k = 1; k <= 10; k += 3) {
         GemmMicrokernelTester()
           .mr(4)
-          .nr(8)
+          .nr(2)
           .kr(1)
           .sr(1)
           .m(4)
           .n(n)
           .k(k)
           .a_stride(13)
-          .Test(xnn_f32_gemm_minmax_ukernel_4x8__neon_dup_ld64, xnn_init_f32_minmax_scalar_params);
+          .Test(xnn_f32_gemm_minmax_ukernel_4x2__neon_lane_ld64, xnn_init_f32_minmax_scalar_params);
       }
     }
   }
 
-  TEST(F32_GEMM_MINMAX_4X8__NEON_DUP_LD64, n_gt_8_subtile) {
+  TEST(F32_GEMM_MINMAX_4X2__NEON_LANE_LD64, n_gt_2_subtile) {
     TEST_REQUIRES_ARM_NEON;
-    for (uint32_t n = 9; n < 16; n++) {
+    for (uint32_t n = 3; n < 4; n++) {
       for (size_t k = 1; k <= 10; k += 3) {
         for (uint32_t m = 1; m <= 4; m++) {
           GemmMicrokernelTester()
             .mr(4)
-            .nr(8)
+            .nr(2)
             .kr(1)
             .sr(1)
             .m(m)
             .n(n)
             .k(k)
             .iterations(1)
-            .Test(xnn_f32_gemm_minmax_ukernel_4x8__neon_dup_ld64, xnn_init_f32_minmax_scalar_params);
+            .Test(xnn_f32_gemm_minmax_ukernel_4x2__neon_lane_ld64, xnn_init_f32_minmax_scalar_params);
         }
       }
     }
   }
 
-  TEST(F32_GEMM_MINMAX_4X8__NEON_DUP_LD64, n_div_8) {
+  TEST(F32_GEMM_MINMAX_4X2__NEON_LANE_LD64, n_div_2) {
     TEST_REQUIRES_ARM_NEON;
-    for (uint32_t n = 16; n <= 24; n += 8) {
+    for (uint32_t n = 4; n <= 6; n += 2) {
       for (size_t k = 1; k <= 10; k += 3) {
         GemmMicrokernelTester()
           .mr(4)
-          .nr(8)
+          .nr(2)
           .kr(1)
           .sr(1)
           .m(4)
           .n(n)
           .k(k)
-          .Test(xnn_f32_gemm_minmax_ukernel_4x8__neon_dup_ld64, xnn_init_f32_minmax_scalar_params);
+          .Test(xnn_f32_gemm_minmax_ukernel_4x2__neon_lane_ld64, xnn_init_f32_minmax_scalar_params);
       }
     }
   }
 
-  TEST(F32_GEMM_MINMAX_4X8__NEON_DUP_LD64, n_div_8_strided_cn) {
+  TEST(F32_GEMM_MINMAX_4X2__NEON_LANE_LD64, n_div_2_strided_cn) {
     TEST_REQUIRES_ARM_NEON;
-    for (uint32_t n = 16; n <= 24; n += 8) {
+    for (uint32_t n = 4; n <= 6; n += 2) {
       for (size_t k = 1; k <= 10; k += 3) {
         GemmMicrokernelTester()
           .mr(4)
-          .nr(8)
+          .nr(2)
           .kr(1)
           .sr(1)
           .m(4)
           .n(n)
           .k(k)
-          .cn_stride(11)
-          .Test(xnn_f32_gemm_minmax_ukernel_4x8__neon_dup_ld64, xnn_init_f32_minmax_scalar_params);
+          .cn_stride(5)
+          .Test(xnn_f32_gemm_minmax_ukernel_4x2__neon_lane_ld64, xnn_init_f32_minmax_scalar_params);
       }
     }
   }
 
-  TEST(F32_GEMM_MINMAX_4X8__NEON_DUP_LD64, n_div_8_strided_a) {
+  TEST(F32_GEMM_MINMAX_4X2__NEON_LANE_LD64, n_div_2_strided_a) {
     TEST_REQUIRES_ARM_NEON;
-    for (uint32_t n = 16; n <= 24; n += 8) {
+    for (uint32_t n = 4; n <= 6; n += 2) {
       for (size_t k = 1; k <= 10; k += 3) {
         GemmMicrokernelTester()
           .mr(4)
-          .nr(8)
+          .nr(2)
           .kr(1)
           .sr(1)
           .m(4)
           .n(n)
           .k(k)
           .a_stride(13)
-          .Test(xnn_f32_gemm_minmax_ukernel_4x8__neon_dup_ld64, xnn_init_f32_minmax_scalar_params);
+          .Test(xnn_f32_gemm_minmax_ukernel_4x2__neon_lane_ld64, xnn_init_f32_minmax_scalar_params);
       }
     }
   }
 
-  TEST(F32_GEMM_MINMAX_4X8__NEON_DUP_LD64, n_div_8_subtile) {
+  TEST(F32_GEMM_MINMAX_4X2__NEON_LANE_LD64, n_div_2_subtile) {
     TEST_REQUIRES_ARM_NEON;
-    for (uint32_t n = 16; n <= 24; n += 8) {
+    for (uint32_t n = 4; n <= 6; n += 2) {
       for (size_t k = 1; k <= 10; k += 3) {
         for (uint32_t m = 1; m <= 4; m++) {
           GemmMicrokernelTester()
             .mr(4)
-            .nr(8)
+            .nr(2)
             .kr(1)
             .sr(1)
             .m(m)
             .n(n)
             .k(k)
             .iterations(1)
-            .Test(xnn_f32_gemm_minmax_ukernel_4x8__neon_dup_ld64, xnn_init_f32_minmax_scalar_params);
+            .Test(xnn_f32_gemm_minmax_ukernel_4x2__neon_lane_ld64, xnn_init_f32_minmax_scalar_params);
         }
       }
     }
   }
 
-  TEST(F32_GEMM_MINMAX_4X8__NEON_DUP_LD64, strided_cm_subtile) {
+  TEST(F32_GEMM_MINMAX_4X2__NEON_LANE_LD64, strided_cm_subtile) {
     TEST_REQUIRES_ARM_NEON;
     for (size_t k = 1; k <= 10; k += 3) {
-      for (uint32_t n = 1; n <= 8; n++) {
+      for (uint32_t n = 1; n <= 2; n++) {
         for (uint32_t m = 1; m <= 4; m++) {
           GemmMicrokernelTester()
             .mr(4)
-            .nr(8)
+            .nr(2)
             .kr(1)
             .sr(1)
             .m(m)
             .n(n)
             .k(k)
-            .cm_stride(11)
+            .cm_stride(5)
             .iterations(1)
-            .Test(xnn_f32_gemm_minmax_ukernel_4x8__neon_dup_ld64, xnn_init_f32_minmax_scalar_params);
+            .Test(xnn_f32_gemm_minmax_ukernel_4x2__neon_lane_ld64, xnn_init_f32_minmax_scalar_params);
         }
       }
     }
   }
 
-  TEST(F32_GEMM_MINMAX_4X8__NEON_DUP_LD64, qmin) {
+  TEST(F32_GEMM_MINMAX_4X2__NEON_LANE_LD64, qmin) {
     TEST_REQUIRES_ARM_NEON;
     GemmMicrokernelTester()
       .mr(4)
-      .nr(8)
+      .nr(2)
       .kr(1)
       .sr(1)
       .m(4)
-      .n(8)
+      .n(2)
       .k(2)
       .qmin(128)
-      .Test(xnn_f32_gemm_minmax_ukernel_4x8__neon_dup_ld64, xnn_init_f32_minmax_scalar_params);
+      .Test(xnn_f32_gemm_minmax_ukernel_4x2__neon_lane_ld64, xnn_init_f32_minmax_scalar_params);
   }
 
-  TEST(F32_GEMM_MINMAX_4X8__NEON_DUP_LD64, qmax) {
+  TEST(F32_GEMM_MINMAX_4X2__NEON_LANE_LD64, qmax) {
     TEST_REQUIRES_ARM_NEON;
     GemmMicrokernelTester()
       .mr(4)
-      .nr(8)
+      .nr(2)
       .kr(1)
       .sr(1)
       .m(4)
-      .n(8)
+      .n(2)
       .k(2)
       .qmax(128)
-      .Test(xnn_f32_gemm_minmax_ukernel_4x8__neon_dup_ld64, xnn_init_f32_minmax_scalar_params);
+      .Test(xnn_f32_gemm_minmax_ukernel_4x2__neon_lane_ld64, xnn_init_f32_minmax_scalar_params);
   }
 
-  TEST(F32_GEMM_MINMAX_4X8__NEON_DUP_LD64, strided_cm) {
+  TEST(F32_GEMM_MINMAX_4X2__NEON_LANE_LD64, strided_cm) {
     TEST_REQUIRES_ARM_NEON;
     GemmMicrokernelTester()
       .mr(4)
-      .nr(8)
+      .nr(2)
       .kr(1)
       .sr(1)
       .m(4)
-      .n(8)
+      .n(2)
       .k(2)
-      .cm_stride(11)
-      .Test(xnn_f32_gemm_minmax_ukernel_4x8__neon_dup_ld64, xnn_init_f32_minmax_scalar_params);
+      .cm_stride(5)
+      .Test(xnn_f32_gemm_minmax_ukernel_4x2__neon_lane_ld64, xnn_init_f32_minmax_scalar_params);
   }
 #endif  // XNN_ARCH_ARM || XNN_ARCH_ARM64
 
 
 #if XNN_ARCH_ARM || XNN_ARCH_ARM64
-  TEST(F32_GEMM_MINMAX_4X8__NEONFMA_DUP_LD128, k_eq_4) {
-    TEST_REQUIRES_ARM_NEON_FMA;
+  TEST(F32_GEMM_MINMAX_4X8__NEON_DUP_LD64, k_eq_2) {
+    TEST_REQUIRES_ARM_NEON;
     GemmMicrokernelTester()
       .mr(4)
       .nr(8)
@@ -10122,12 +10122,12 @@
       .sr(1)
       .m(4)
       .n(8)
-      .k(4)
-      .Test(xnn_f32_gemm_minmax_ukernel_4x8__neonfma_dup_ld128, xnn_init_f32_minmax_scalar_params);
+      .k(2)
+      .Test(xnn_f32_gemm_minmax_ukernel_4x8__neon_dup_ld64, xnn_init_f32_minmax_scalar_params);
   }
 
-  TEST(F32_GEMM_MINMAX_4X8__NEONFMA_DUP_LD128, strided_cn) {
-    TEST_REQUIRES_ARM_NEON_FMA;
+  TEST(F32_GEMM_MINMAX_4X8__NEON_DUP_LD64, strided_cn) {
+    TEST_REQUIRES_ARM_NEON;
     GemmMicrokernelTester()
       .mr(4)
       .nr(8)
@@ -10135,13 +10135,13 @@
       .sr(1)
       .m(4)
       .n(8)
-      .k(4)
+      .k(2)
       .cn_stride(11)
-      .Test(xnn_f32_gemm_minmax_ukernel_4x8__neonfma_dup_ld128, xnn_init_f32_minmax_scalar_params);
+      .Test(xnn_f32_gemm_minmax_ukernel_4x8__neon_dup_ld64, xnn_init_f32_minmax_scalar_params);
   }
 
-  TEST(F32_GEMM_MINMAX_4X8__NEONFMA_DUP_LD128, k_eq_4_strided_a) {
-    TEST_REQUIRES_ARM_NEON_FMA;
+  TEST(F32_GEMM_MINMAX_4X8__NEON_DUP_LD64, k_eq_2_strided_a) {
+    TEST_REQUIRES_ARM_NEON;
     GemmMicrokernelTester()
       .mr(4)
       .nr(8)
@@ -10149,13 +10149,13 @@
       .sr(1)
       .m(4)
       .n(8)
-      .k(4)
-      .a_stride(7)
-      .Test(xnn_f32_gemm_minmax_ukernel_4x8__neonfma_dup_ld128, xnn_init_f32_minmax_scalar_params);
+      .k(2)
+      .a_stride(5)
+      .Test(xnn_f32_gemm_minmax_ukernel_4x8__neon_dup_ld64, xnn_init_f32_minmax_scalar_params);
   }
 
-  TEST(F32_GEMM_MINMAX_4X8__NEONFMA_DUP_LD128, k_eq_4_subtile) {
-    TEST_REQUIRES_ARM_NEON_FMA;
+  TEST(F32_GEMM_MINMAX_4X8__NEON_DUP_LD64, k_eq_2_subtile) {
+    TEST_REQUIRES_ARM_NEON;
     for (uint32_t n = 1; n <= 8; n++) {
       for (uint32_t m = 1; m <= 4; m++) {
         GemmMicrokernelTester()
@@ -10165,15 +10165,15 @@
           .sr(1)
           .m(m)
           .n(n)
-          .k(4)
+          .k(2)
           .iterations(1)
-          .Test(xnn_f32_gemm_minmax_ukernel_4x8__neonfma_dup_ld128, xnn_init_f32_minmax_scalar_params);
+          .Test(xnn_f32_gemm_minmax_ukernel_4x8__neon_dup_ld64, xnn_init_f32_minmax_scalar_params);
       }
     }
   }
 
-  TEST(F32_GEMM_MINMAX_4X8__NEONFMA_DUP_LD128, k_eq_4_subtile_m) {
-    TEST_REQUIRES_ARM_NEON_FMA;
+  TEST(F32_GEMM_MINMAX_4X8__NEON_DUP_LD64, k_eq_2_subtile_m) {
+    TEST_REQUIRES_ARM_NEON;
     for (uint32_t m = 1; m <= 4; m++) {
       GemmMicrokernelTester()
         .mr(4)
@@ -10182,14 +10182,14 @@
         .sr(1)
         .m(m)
         .n(8)
-        .k(4)
+        .k(2)
         .iterations(1)
-        .Test(xnn_f32_gemm_minmax_ukernel_4x8__neonfma_dup_ld128, xnn_init_f32_minmax_scalar_params);
+        .Test(xnn_f32_gemm_minmax_ukernel_4x8__neon_dup_ld64, xnn_init_f32_minmax_scalar_params);
     }
   }
 
-  TEST(F32_GEMM_MINMAX_4X8__NEONFMA_DUP_LD128, k_eq_4_subtile_n) {
-    TEST_REQUIRES_ARM_NEON_FMA;
+  TEST(F32_GEMM_MINMAX_4X8__NEON_DUP_LD64, k_eq_2_subtile_n) {
+    TEST_REQUIRES_ARM_NEON;
     for (uint32_t n = 1; n <= 8; n++) {
       GemmMicrokernelTester()
         .mr(4)
@@ -10198,15 +10198,15 @@
         .sr(1)
         .m(4)
         .n(n)
-        .k(4)
+        .k(2)
         .iterations(1)
-        .Test(xnn_f32_gemm_minmax_ukernel_4x8__neonfma_dup_ld128, xnn_init_f32_minmax_scalar_params);
+        .Test(xnn_f32_gemm_minmax_ukernel_4x8__neon_dup_ld64, xnn_init_f32_minmax_scalar_params);
     }
   }
 
-  TEST(F32_GEMM_MINMAX_4X8__NEONFMA_DUP_LD128, k_lt_4) {
-    TEST_REQUIRES_ARM_NEON_FMA;
-    for (size_t k = 1; k < 4; k++) {
+  TEST(F32_GEMM_MINMAX_4X8__NEON_DUP_LD64, k_lt_2) {
+    TEST_REQUIRES_ARM_NEON;
+    for (size_t k = 1; k < 2; k++) {
       GemmMicrokernelTester()
         .mr(4)
         .nr(8)
@@ -10215,13 +10215,13 @@
         .m(4)
         .n(8)
         .k(k)
-        .Test(xnn_f32_gemm_minmax_ukernel_4x8__neonfma_dup_ld128, xnn_init_f32_minmax_scalar_params);
+        .Test(xnn_f32_gemm_minmax_ukernel_4x8__neon_dup_ld64, xnn_init_f32_minmax_scalar_params);
     }
   }
 
-  TEST(F32_GEMM_MINMAX_4X8__NEONFMA_DUP_LD128, k_lt_4_strided_a) {
-    TEST_REQUIRES_ARM_NEON_FMA;
-    for (size_t k = 1; k < 4; k++) {
+  TEST(F32_GEMM_MINMAX_4X8__NEON_DUP_LD64, k_lt_2_strided_a) {
+    TEST_REQUIRES_ARM_NEON;
+    for (size_t k = 1; k < 2; k++) {
       GemmMicrokernelTester()
         .mr(4)
         .nr(8)
@@ -10230,14 +10230,14 @@
         .m(4)
         .n(8)
         .k(k)
-        .a_stride(7)
-        .Test(xnn_f32_gemm_minmax_ukernel_4x8__neonfma_dup_ld128, xnn_init_f32_minmax_scalar_params);
+        .a_stride(5)
+        .Test(xnn_f32_gemm_minmax_ukernel_4x8__neon_dup_ld64, xnn_init_f32_minmax_scalar_params);
     }
   }
 
-  TEST(F32_GEMM_MINMAX_4X8__NEONFMA_DUP_LD128, k_lt_4_subtile) {
-    TEST_REQUIRES_ARM_NEON_FMA;
-    for (size_t k = 1; k < 4; k++) {
+  TEST(F32_GEMM_MINMAX_4X8__NEON_DUP_LD64, k_lt_2_subtile) {
+    TEST_REQUIRES_ARM_NEON;
+    for (size_t k = 1; k < 2; k++) {
       for (uint32_t n = 1; n <= 8; n++) {
         for (uint32_t m = 1; m <= 4; m++) {
           GemmMicrokernelTester()
@@ -10249,15 +10249,15 @@
             .n(n)
             .k(k)
             .iterations(1)
-            .Test(xnn_f32_gemm_minmax_ukernel_4x8__neonfma_dup_ld128, xnn_init_f32_minmax_scalar_params);
+            .Test(xnn_f32_gemm_minmax_ukernel_4x8__neon_dup_ld64, xnn_init_f32_minmax_scalar_params);
         }
       }
     }
   }
 
-  TEST(F32_GEMM_MINMAX_4X8__NEONFMA_DUP_LD128, k_gt_4) {
-    TEST_REQUIRES_ARM_NEON_FMA;
-    for (size_t k = 5; k < 8; k++) {
+  TEST(F32_GEMM_MINMAX_4X8__NEON_DUP_LD64, k_gt_2) {
+    TEST_REQUIRES_ARM_NEON;
+    for (size_t k = 3; k < 4; k++) {
       GemmMicrokernelTester()
         .mr(4)
         .nr(8)
@@ -10266,13 +10266,13 @@
         .m(4)
         .n(8)
         .k(k)
-        .Test(xnn_f32_gemm_minmax_ukernel_4x8__neonfma_dup_ld128, xnn_init_f32_minmax_scalar_params);
+        .Test(xnn_f32_gemm_minmax_ukernel_4x8__neon_dup_ld64, xnn_init_f32_minmax_scalar_params);
     }
   }
 
-  TEST(F32_GEMM_MINMAX_4X8__NEONFMA_DUP_LD128, k_gt_4_strided_a) {
-    TEST_REQUIRES_ARM_NEON_FMA;
-    for (size_t k = 5; k < 8; k++) {
+  TEST(F32_GEMM_MINMAX_4X8__NEON_DUP_LD64, k_gt_2_strided_a) {
+    TEST_REQUIRES_ARM_NEON;
+    for (size_t k = 3; k < 4; k++) {
       GemmMicrokernelTester()
         .mr(4)
         .nr(8)
@@ -10281,14 +10281,14 @@
         .m(4)
         .n(8)
         .k(k)
-        .a_stride(11)
-        .Test(xnn_f32_gemm_minmax_ukernel_4x8__neonfma_dup_ld128, xnn_init_f32_minmax_scalar_params);
+        .a_stride(7)
+        .Test(xnn_f32_gemm_minmax_ukernel_4x8__neon_dup_ld64, xnn_init_f32_minmax_scalar_params);
     }
   }
 
-  TEST(F32_GEMM_MINMAX_4X8__NEONFMA_DUP_LD128, k_gt_4_subtile) {
-    TEST_REQUIRES_ARM_NEON_FMA;
-    for (size_t k = 5; k < 8; k++) {
+  TEST(F32_GEMM_MINMAX_4X8__NEON_DUP_LD64, k_gt_2_subtile) {
+    TEST_REQUIRES_ARM_NEON;
+    for (size_t k = 3; k < 4; k++) {
       for (uint32_t n = 1; n <= 8; n++) {
         for (uint32_t m = 1; m <= 4; m++) {
           GemmMicrokernelTester()
@@ -10300,15 +10300,15 @@
             .n(n)
             .k(k)
             .iterations(1)
-            .Test(xnn_f32_gemm_minmax_ukernel_4x8__neonfma_dup_ld128, xnn_init_f32_minmax_scalar_params);
+            .Test(xnn_f32_gemm_minmax_ukernel_4x8__neon_dup_ld64, xnn_init_f32_minmax_scalar_params);
         }
       }
     }
   }
 
-  TEST(F32_GEMM_MINMAX_4X8__NEONFMA_DUP_LD128, k_div_4) {
-    TEST_REQUIRES_ARM_NEON_FMA;
-    for (size_t k = 8; k <= 40; k += 4) {
+  TEST(F32_GEMM_MINMAX_4X8__NEON_DUP_LD64, k_div_2) {
+    TEST_REQUIRES_ARM_NEON;
+    for (size_t k = 4; k <= 20; k += 2) {
       GemmMicrokernelTester()
         .mr(4)
         .nr(8)
@@ -10317,13 +10317,13 @@
         .m(4)
         .n(8)
         .k(k)
-        .Test(xnn_f32_gemm_minmax_ukernel_4x8__neonfma_dup_ld128, xnn_init_f32_minmax_scalar_params);
+        .Test(xnn_f32_gemm_minmax_ukernel_4x8__neon_dup_ld64, xnn_init_f32_minmax_scalar_params);
     }
   }
 
-  TEST(F32_GEMM_MINMAX_4X8__NEONFMA_DUP_LD128, k_div_4_strided_a) {
-    TEST_REQUIRES_ARM_NEON_FMA;
-    for (size_t k = 8; k <= 40; k += 4) {
+  TEST(F32_GEMM_MINMAX_4X8__NEON_DUP_LD64, k_div_2_strided_a) {
+    TEST_REQUIRES_ARM_NEON;
+    for (size_t k = 4; k <= 20; k += 2) {
       GemmMicrokernelTester()
         .mr(4)
         .nr(8)
@@ -10332,14 +10332,14 @@
         .m(4)
         .n(8)
         .k(k)
-        .a_stride(43)
-        .Test(xnn_f32_gemm_minmax_ukernel_4x8__neonfma_dup_ld128, xnn_init_f32_minmax_scalar_params);
+        .a_stride(23)
+        .Test(xnn_f32_gemm_minmax_ukernel_4x8__neon_dup_ld64, xnn_init_f32_minmax_scalar_params);
     }
   }
 
-  TEST(F32_GEMM_MINMAX_4X8__NEONFMA_DUP_LD128, k_div_4_subtile) {
-    TEST_REQUIRES_ARM_NEON_FMA;
-    for (size_t k = 8; k <= 40; k += 4) {
+  TEST(F32_GEMM_MINMAX_4X8__NEON_DUP_LD64, k_div_2_subtile) {
+    TEST_REQUIRES_ARM_NEON;
+    for (size_t k = 4; k <= 20; k += 2) {
       for (uint32_t n = 1; n <= 8; n++) {
         for (uint32_t m = 1; m <= 4; m++) {
           GemmMicrokernelTester()
@@ -10351,16 +10351,16 @@
             .n(n)
             .k(k)
             .iterations(1)
-            .Test(xnn_f32_gemm_minmax_ukernel_4x8__neonfma_dup_ld128, xnn_init_f32_minmax_scalar_params);
+            .Test(xnn_f32_gemm_minmax_ukernel_4x8__neon_dup_ld64, xnn_init_f32_minmax_scalar_params);
         }
       }
     }
   }
 
-  TEST(F32_GEMM_MINMAX_4X8__NEONFMA_DUP_LD128, n_gt_8) {
-    TEST_REQUIRES_ARM_NEON_FMA;
+  TEST(F32_GEMM_MINMAX_4X8__NEON_DUP_LD64, n_gt_8) {
+    TEST_REQUIRES_ARM_NEON;
     for (uint32_t n = 9; n < 16; n++) {
-      for (size_t k = 1; k <= 20; k += 5) {
+      for (size_t k = 1; k <= 10; k += 3) {
         GemmMicrokernelTester()
           .mr(4)
           .nr(8)
@@ -10369,15 +10369,15 @@
           .m(4)
           .n(n)
           .k(k)
-          .Test(xnn_f32_gemm_minmax_ukernel_4x8__neonfma_dup_ld128, xnn_init_f32_minmax_scalar_params);
+          .Test(xnn_f32_gemm_minmax_ukernel_4x8__neon_dup_ld64, xnn_init_f32_minmax_scalar_params);
       }
     }
   }
 
-  TEST(F32_GEMM_MINMAX_4X8__NEONFMA_DUP_LD128, n_gt_8_strided_cn) {
-    TEST_REQUIRES_ARM_NEON_FMA;
+  TEST(F32_GEMM_MINMAX_4X8__NEON_DUP_LD64, n_gt_8_strided_cn) {
+    TEST_REQUIRES_ARM_NEON;
     for (uint32_t n = 9; n < 16; n++) {
-      for (size_t k = 1; k <= 20; k += 5) {
+      for (size_t k = 1; k <= 10; k += 3) {
         GemmMicrokernelTester()
           .mr(4)
           .nr(8)
@@ -10387,15 +10387,15 @@
           .n(n)
           .k(k)
           .cn_stride(11)
-          .Test(xnn_f32_gemm_minmax_ukernel_4x8__neonfma_dup_ld128, xnn_init_f32_minmax_scalar_params);
+          .Test(xnn_f32_gemm_minmax_ukernel_4x8__neon_dup_ld64, xnn_init_f32_minmax_scalar_params);
       }
     }
   }
 
-  TEST(F32_GEMM_MINMAX_4X8__NEONFMA_DUP_LD128, n_gt_8_strided_a) {
-    TEST_REQUIRES_ARM_NEON_FMA;
+  TEST(F32_GEMM_MINMAX_4X8__NEON_DUP_LD64, n_gt_8_strided_a) {
+    TEST_REQUIRES_ARM_NEON;
     for (uint32_t n = 9; n < 16; n++) {
-      for (size_t k = 1; k <= 20; k += 5) {
+      for (size_t k = 1; k <= 10; k += 3) {
         GemmMicrokernelTester()
           .mr(4)
           .nr(8)
@@ -10404,16 +10404,16 @@
           .m(4)
           .n(n)
           .k(k)
-          .a_stride(23)
-          .Test(xnn_f32_gemm_minmax_ukernel_4x8__neonfma_dup_ld128, xnn_init_f32_minmax_scalar_params);
+          .a_stride(13)
+          .Test(xnn_f32_gemm_minmax_ukernel_4x8__neon_dup_ld64, xnn_init_f32_minmax_scalar_params);
       }
     }
   }
 
-  TEST(F32_GEMM_MINMAX_4X8__NEONFMA_DUP_LD128, n_gt_8_subtile) {
-    TEST_REQUIRES_ARM_NEON_FMA;
+  TEST(F32_GEMM_MINMAX_4X8__NEON_DUP_LD64, n_gt_8_subtile) {
+    TEST_REQUIRES_ARM_NEON;
     for (uint32_t n = 9; n < 16; n++) {
-      for (size_t k = 1; k <= 20; k += 5) {
+      for (size_t k = 1; k <= 10; k += 3) {
         for (uint32_t m = 1; m <= 4; m++) {
           GemmMicrokernelTester()
             .mr(4)
@@ -10424,16 +10424,16 @@
             .n(n)
             .k(k)
             .iterations(1)
-            .Test(xnn_f32_gemm_minmax_ukernel_4x8__neonfma_dup_ld128, xnn_init_f32_minmax_scalar_params);
+            .Test(xnn_f32_gemm_minmax_ukernel_4x8__neon_dup_ld64, xnn_init_f32_minmax_scalar_params);
         }
       }
     }
   }
 
-  TEST(F32_GEMM_MINMAX_4X8__NEONFMA_DUP_LD128, n_div_8) {
-    TEST_REQUIRES_ARM_NEON_FMA;
+  TEST(F32_GEMM_MINMAX_4X8__NEON_DUP_LD64, n_div_8) {
+    TEST_REQUIRES_ARM_NEON;
     for (uint32_t n = 16; n <= 24; n += 8) {
-      for (size_t k = 1; k <= 20; k += 5) {
+      for (size_t k = 1; k <= 10; k += 3) {
         GemmMicrokernelTester()
           .mr(4)
           .nr(8)
@@ -10442,15 +10442,15 @@
           .m(4)
           .n(n)
           .k(k)
-          .Test(xnn_f32_gemm_minmax_ukernel_4x8__neonfma_dup_ld128, xnn_init_f32_minmax_scalar_params);
+          .Test(xnn_f32_gemm_minmax_ukernel_4x8__neon_dup_ld64, xnn_init_f32_minmax_scalar_params);
       }
     }
   }
 
-  TEST(F32_GEMM_MINMAX_4X8__NEONFMA_DUP_LD128, n_div_8_strided_cn) {
-    TEST_REQUIRES_ARM_NEON_FMA;
+  TEST(F32_GEMM_MINMAX_4X8__NEON_DUP_LD64, n_div_8_strided_cn) {
+    TEST_REQUIRES_ARM_NEON;
     for (uint32_t n = 16; n <= 24; n += 8) {
-      for (size_t k = 1; k <= 20; k += 5) {
+      for (size_t k = 1; k <= 10; k += 3) {
         GemmMicrokernelTester()
           .mr(4)
           .nr(8)
@@ -10460,15 +10460,15 @@
           .n(n)
           .k(k)
           .cn_stride(11)
-          .Test(xnn_f32_gemm_minmax_ukernel_4x8__neonfma_dup_ld128, xnn_init_f32_minmax_scalar_params);
+          .Test(xnn_f32_gemm_minmax_ukernel_4x8__neon_dup_ld64, xnn_init_f32_minmax_scalar_params);
       }
     }
   }
 
-  TEST(F32_GEMM_MINMAX_4X8__NEONFMA_DUP_LD128, n_div_8_strided_a) {
-    TEST_REQUIRES_ARM_NEON_FMA;
+  TEST(F32_GEMM_MINMAX_4X8__NEON_DUP_LD64, n_div_8_strided_a) {
+    TEST_REQUIRES_ARM_NEON;
     for (uint32_t n = 16; n <= 24; n += 8) {
-      for (size_t k = 1; k <= 20; k += 5) {
+      for (size_t k = 1; k <= 10; k += 3) {
         GemmMicrokernelTester()
           .mr(4)
           .nr(8)
@@ -10477,16 +10477,16 @@
           .m(4)
           .n(n)
           .k(k)
-          .a_stride(23)
-          .Test(xnn_f32_gemm_minmax_ukernel_4x8__neonfma_dup_ld128, xnn_init_f32_minmax_scalar_params);
+          .a_stride(13)
+          .Test(xnn_f32_gemm_minmax_ukernel_4x8__neon_dup_ld64, xnn_init_f32_minmax_scalar_params);
       }
     }
   }
 
-  TEST(F32_GEMM_MINMAX_4X8__NEONFMA_DUP_LD128, n_div_8_subtile) {
-    TEST_REQUIRES_ARM_NEON_FMA;
+  TEST(F32_GEMM_MINMAX_4X8__NEON_DUP_LD64, n_div_8_subtile) {
+    TEST_REQUIRES_ARM_NEON;
     for (uint32_t n = 16; n <= 24; n += 8) {
-      for (size_t k = 1; k <= 20; k += 5) {
+      for (size_t k = 1; k <= 10; k += 3) {
         for (uint32_t m = 1; m <= 4; m++) {
           GemmMicrokernelTester()
             .mr(4)
@@ -10497,15 +10497,15 @@
             .n(n)
             .k(k)
             .iterations(1)
-            .Test(xnn_f32_gemm_minmax_ukernel_4x8__neonfma_dup_ld128, xnn_init_f32_minmax_scalar_params);
+            .Test(xnn_f32_gemm_minmax_ukernel_4x8__neon_dup_ld64, xnn_init_f32_minmax_scalar_params);
         }
       }
     }
   }
 
-  TEST(F32_GEMM_MINMAX_4X8__NEONFMA_DUP_LD128, strided_cm_subtile) {
-    TEST_REQUIRES_ARM_NEON_FMA;
-    for (size_t k = 1; k <= 20; k += 5) {
+  TEST(F32_GEMM_MINMAX_4X8__NEON_DUP_LD64, strided_cm_subtile) {
+    TEST_REQUIRES_ARM_NEON;
+    for (size_t k = 1; k <= 10; k += 3) {
       for (uint32_t n = 1; n <= 8; n++) {
         for (uint32_t m = 1; m <= 4; m++) {
           GemmMicrokernelTester()
@@ -10518,14 +10518,14 @@
             .k(k)
             .cm_stride(11)
             .iterations(1)
-            .Test(xnn_f32_gemm_minmax_ukernel_4x8__neonfma_dup_ld128, xnn_init_f32_minmax_scalar_params);
+            .Test(xnn_f32_gemm_minmax_ukernel_4x8__neon_dup_ld64, xnn_init_f32_minmax_scalar_params);
         }
       }
     }
   }
 
-  TEST(F32_GEMM_MINMAX_4X8__NEONFMA_DUP_LD128, qmin) {
-    TEST_REQUIRES_ARM_NEON_FMA;
+  TEST(F32_GEMM_MINMAX_4X8__NEON_DUP_LD64, qmin) {
+    TEST_REQUIRES_ARM_NEON;
     GemmMicrokernelTester()
       .mr(4)
       .nr(8)
@@ -10533,13 +10533,13 @@
       .sr(1)
       .m(4)
       .n(8)
-      .k(4)
+      .k(2)
       .qmin(128)
-      .Test(xnn_f32_gemm_minmax_ukernel_4x8__neonfma_dup_ld128, xnn_init_f32_minmax_scalar_params);
+      .Test(xnn_f32_gemm_minmax_ukernel_4x8__neon_dup_ld64, xnn_init_f32_minmax_scalar_params);
   }
 
-  TEST(F32_GEMM_MINMAX_4X8__NEONFMA_DUP_LD128, qmax) {
-    TEST_REQUIRES_ARM_NEON_FMA;
+  TEST(F32_GEMM_MINMAX_4X8__NEON_DUP_LD64, qmax) {
+    TEST_REQUIRES_ARM_NEON;
     GemmMicrokernelTester()
       .mr(4)
       .nr(8)
@@ -10547,13 +10547,13 @@
       .sr(1)
       .m(4)
       .n(8)
-      .k(4)
+      .k(2)
       .qmax(128)
-      .Test(xnn_f32_gemm_minmax_ukernel_4x8__neonfma_dup_ld128, xnn_init_f32_minmax_scalar_params);
+      .Test(xnn_f32_gemm_minmax_ukernel_4x8__neon_dup_ld64, xnn_init_f32_minmax_scalar_params);
   }
 
-  TEST(F32_GEMM_MINMAX_4X8__NEONFMA_DUP_LD128, strided_cm) {
-    TEST_REQUIRES_ARM_NEON_FMA;
+  TEST(F32_GEMM_MINMAX_4X8__NEON_DUP_LD64, strided_cm) {
+    TEST_REQUIRES_ARM_NEON;
     GemmMicrokernelTester()
       .mr(4)
       .nr(8)
@@ -10561,15 +10561,15 @@
       .sr(1)
       .m(4)
       .n(8)
-      .k(4)
+      .k(2)
       .cm_stride(11)
-      .Test(xnn_f32_gemm_minmax_ukernel_4x8__neonfma_dup_ld128, xnn_init_f32_minmax_scalar_params);
+      .Test(xnn_f32_gemm_minmax_ukernel_4x8__neon_dup_ld64, xnn_init_f32_minmax_scalar_params);
   }
 #endif  // XNN_ARCH_ARM || XNN_ARCH_ARM64
 
 
-#if XNN_ARCH_ARM64
-  TEST(F32_GEMM_MINMAX_4X8__NEONFMA_LANE_LD64, k_eq_2) {
+#if XNN_ARCH_ARM || XNN_ARCH_ARM64
+  TEST(F32_GEMM_MINMAX_4X8__NEONFMA_DUP_LD128, k_eq_4) {
     TEST_REQUIRES_ARM_NEON_FMA;
     GemmMicrokernelTester()
       .mr(4)
@@ -10578,11 +10578,11 @@
       .sr(1)
       .m(4)
       .n(8)
-      .k(2)
-      .Test(xnn_f32_gemm_minmax_ukernel_4x8__neonfma_lane_ld64, xnn_init_f32_minmax_scalar_params);
+      .k(4)
+      .Test(xnn_f32_gemm_minmax_ukernel_4x8__neonfma_dup_ld128, xnn_init_f32_minmax_scalar_params);
   }
 
-  TEST(F32_GEMM_MINMAX_4X8__NEONFMA_LANE_LD64, strided_cn) {
+  TEST(F32_GEMM_MINMAX_4X8__NEONFMA_DUP_LD128, strided_cn) {
     TEST_REQUIRES_ARM_NEON_FMA;
     GemmMicrokernelTester()
       .mr(4)
@@ -10591,12 +10591,12 @@
       .sr(1)
       .m(4)
       .n(8)
-      .k(2)
+      .k(4)
       .cn_stride(11)
-      .Test(xnn_f32_gemm_minmax_ukernel_4x8__neonfma_lane_ld64, xnn_init_f32_minmax_scalar_params);
+      .Test(xnn_f32_gemm_minmax_ukernel_4x8__neonfma_dup_ld128, xnn_init_f32_minmax_scalar_params);
   }
 
-  TEST(F32_GEMM_MINMAX_4X8__NEONFMA_LANE_LD64, k_eq_2_strided_a) {
+  TEST(F32_GEMM_MINMAX_4X8__NEONFMA_DUP_LD128, k_eq_4_strided_a) {
     TEST_REQUIRES_ARM_NEON_FMA;
     GemmMicrokernelTester()
       .mr(4)
@@ -10605,12 +10605,12 @@
       .sr(1)
       .m(4)
       .n(8)
-      .k(2)
-      .a_stride(5)
-      .Test(xnn_f32_gemm_minmax_ukernel_4x8__neonfma_lane_ld64, xnn_init_f32_minmax_scalar_params);
+      .k(4)
+      .a_stride(7)
+      .Test(xnn_f32_gemm_minmax_ukernel_4x8__neonfma_dup_ld128, xnn_init_f32_minmax_scalar_params);
   }
 
-  TEST(F32_GEMM_MINMAX_4X8__NEONFMA_LANE_LD64, k_eq_2_subtile) {
+  TEST(F32_GEMM_MINMAX_4X8__NEONFMA_DUP_LD128, k_eq_4_subtile) {
     TEST_REQUIRES_ARM_NEON_FMA;
     for (uint32_t n = 1; n <= 8; n++) {
       for (uint32_t m = 1; m <= 4; m++) {
@@ -10621,14 +10621,14 @@
           .sr(1)
           .m(m)
           .n(n)
-          .k(2)
+          .k(4)
           .iterations(1)
-          .Test(xnn_f32_gemm_minmax_ukernel_4x8__neonfma_lane_ld64, xnn_init_f32_minmax_scalar_params);
+          .Test(xnn_f32_gemm_minmax_ukernel_4x8__neonfma_dup_ld128, xnn_init_f32_minmax_scalar_params);
       }
     }
   }
 
-  TEST(F32_GEMM_MINMAX_4X8__NEONFMA_LANE_LD64, k_eq_2_subtile_m) {
+  TEST(F32_GEMM_MINMAX_4X8__NEONFMA_DUP_LD128, k_eq_4_subtile_m) {
     TEST_REQUIRES_ARM_NEON_FMA;
     for (uint32_t m = 1; m <= 4; m++) {
       GemmMicrokernelTester()
@@ -10638,13 +10638,13 @@
         .sr(1)
         .m(m)
         .n(8)
-        .k(2)
+        .k(4)
         .iterations(1)
-        .Test(xnn_f32_gemm_minmax_ukernel_4x8__neonfma_lane_ld64, xnn_init_f32_minmax_scalar_params);
+        .Test(xnn_f32_gemm_minmax_ukernel_4x8__neonfma_dup_ld128, xnn_init_f32_minmax_scalar_params);
     }
   }
 
-  TEST(F32_GEMM_MINMAX_4X8__NEONFMA_LANE_LD64, k_eq_2_subtile_n) {
+  TEST(F32_GEMM_MINMAX_4X8__NEONFMA_DUP_LD128, k_eq_4_subtile_n) {
     TEST_REQUIRES_ARM_NEON_FMA;
     for (uint32_t n = 1; n <= 8; n++) {
       GemmMicrokernelTester()
@@ -10654,15 +10654,15 @@
         .sr(1)
         .m(4)
         .n(n)
-        .k(2)
+        .k(4)
         .iterations(1)
-        .Test(xnn_f32_gemm_minmax_ukernel_4x8__neonfma_lane_ld64, xnn_init_f32_minmax_scalar_params);
+        .Test(xnn_f32_gemm_minmax_ukernel_4x8__neonfma_dup_ld128, xnn_init_f32_minmax_scalar_params);
     }
   }
 
-  TEST(F32_GEMM_MINMAX_4X8__NEONFMA_LANE_LD64, k_lt_2) {
+  TEST(F32_GEMM_MINMAX_4X8__NEONFMA_DUP_LD128, k_lt_4) {
     TEST_REQUIRES_ARM_NEON_FMA;
-    for (size_t k = 1; k < 2; k++) {
+    for (size_t k = 1; k < 4; k++) {
       GemmMicrokernelTester()
         .mr(4)
         .nr(8)
@@ -10671,13 +10671,13 @@
         .m(4)
         .n(8)
         .k(k)
-        .Test(xnn_f32_gemm_minmax_ukernel_4x8__neonfma_lane_ld64, xnn_init_f32_minmax_scalar_params);
+        .Test(xnn_f32_gemm_minmax_ukernel_4x8__neonfma_dup_ld128, xnn_init_f32_minmax_scalar_params);
     }
   }
 
-  TEST(F32_GEMM_MINMAX_4X8__NEONFMA_LANE_LD64, k_lt_2_strided_a) {
+  TEST(F32_GEMM_MINMAX_4X8__NEONFMA_DUP_LD128, k_lt_4_strided_a) {
     TEST_REQUIRES_ARM_NEON_FMA;
-    for (size_t k = 1; k < 2; k++) {
+    for (size_t k = 1; k < 4; k++) {
       GemmMicrokernelTester()
         .mr(4)
         .nr(8)
@@ -10686,14 +10686,14 @@
         .m(4)
         .n(8)
         .k(k)
-        .a_stride(5)
-        .Test(xnn_f32_gemm_minmax_ukernel_4x8__neonfma_lane_ld64, xnn_init_f32_minmax_scalar_params);
+        .a_stride(7)
+        .Test(xnn_f32_gemm_minmax_ukernel_4x8__neonfma_dup_ld128, xnn_init_f32_minmax_scalar_params);
     }
   }
 
-  TEST(F32_GEMM_MINMAX_4X8__NEONFMA_LANE_LD64, k_lt_2_subtile) {
+  TEST(F32_GEMM_MINMAX_4X8__NEONFMA_DUP_LD128, k_lt_4_subtile) {
     TEST_REQUIRES_ARM_NEON_FMA;
-    for (size_t k = 1; k < 2; k++) {
+    for (size_t k = 1; k < 4; k++) {
       for (uint32_t n = 1; n <= 8; n++) {
         for (uint32_t m = 1; m <= 4; m++) {
           GemmMicrokernelTester()
@@ -10705,15 +10705,15 @@
             .n(n)
             .k(k)
             .iterations(1)
-            .Test(xnn_f32_gemm_minmax_ukernel_4x8__neonfma_lane_ld64, xnn_init_f32_minmax_scalar_params);
+            .Test(xnn_f32_gemm_minmax_ukernel_4x8__neonfma_dup_ld128, xnn_init_f32_minmax_scalar_params);
         }
       }
     }
   }
 
-  TEST(F32_GEMM_MINMAX_4X8__NEONFMA_LANE_LD64, k_gt_2) {
+  TEST(F32_GEMM_MINMAX_4X8__NEONFMA_DUP_LD128, k_gt_4) {
     TEST_REQUIRES_ARM_NEON_FMA;
-    for (size_t k = 3; k < 4; k++) {
+    for (size_t k = 5; k < 8; k++) {
       GemmMicrokernelTester()
         .mr(4)
         .nr(8)
@@ -10722,13 +10722,13 @@
         .m(4)
         .n(8)
         .k(k)
-        .Test(xnn_f32_gemm_minmax_ukernel_4x8__neonfma_lane_ld64, xnn_init_f32_minmax_scalar_params);
+        .Test(xnn_f32_gemm_minmax_ukernel_4x8__neonfma_dup_ld128, xnn_init_f32_minmax_scalar_params);
     }
   }
 
-  TEST(F32_GEMM_MINMAX_4X8__NEONFMA_LANE_LD64, k_gt_2_strided_a) {
+  TEST(F32_GEMM_MINMAX_4X8__NEONFMA_DUP_LD128, k_gt_4_strided_a) {
     TEST_REQUIRES_ARM_NEON_FMA;
-    for (size_t k = 3; k < 4; k++) {
+    for (size_t k = 5; k < 8; k++) {
       GemmMicrokernelTester()
         .mr(4)
         .nr(8)
@@ -10737,14 +10737,14 @@
         .m(4)
         .n(8)
         .k(k)
-        .a_stride(7)
-        .Test(xnn_f32_gemm_minmax_ukernel_4x8__neonfma_lane_ld64, xnn_init_f32_minmax_scalar_params);
+        .a_stride(11)
+        .Test(xnn_f32_gemm_minmax_ukernel_4x8__neonfma_dup_ld128, xnn_init_f32_minmax_scalar_params);
     }
   }
 
-  TEST(F32_GEMM_MINMAX_4X8__NEONFMA_LANE_LD64, k_gt_2_subtile) {
+  TEST(F32_GEMM_MINMAX_4X8__NEONFMA_DUP_LD128, k_gt_4_subtile) {
     TEST_REQUIRES_ARM_NEON_FMA;
-    for (size_t k = 3; k < 4; k++) {
+    for (size_t k = 5; k < 8; k++) {
       for (uint32_t n = 1; n <= 8; n++) {
         for (uint32_t m = 1; m <= 4; m++) {
           GemmMicrokernelTester()
@@ -10756,15 +10756,15 @@
             .n(n)
             .k(k)
             .iterations(1)
-            .Test(xnn_f32_gemm_minmax_ukernel_4x8__neonfma_lane_ld64, xnn_init_f32_minmax_scalar_params);
+            .Test(xnn_f32_gemm_minmax_ukernel_4x8__neonfma_dup_ld128, xnn_init_f32_minmax_scalar_params);
         }
       }
     }
   }
 
-  TEST(F32_GEMM_MINMAX_4X8__NEONFMA_LANE_LD64, k_div_2) {
+  TEST(F32_GEMM_MINMAX_4X8__NEONFMA_DUP_LD128, k_div_4) {
     TEST_REQUIRES_ARM_NEON_FMA;
-    for (size_t k = 4; k <= 20; k += 2) {
+    for (size_t k = 8; k <= 40; k += 4) {
       GemmMicrokernelTester()
         .mr(4)
         .nr(8)
@@ -10773,13 +10773,13 @@
         .m(4)
         .n(8)
         .k(k)
-        .Test(xnn_f32_gemm_minmax_ukernel_4x8__neonfma_lane_ld64, xnn_init_f32_minmax_scalar_params);
+        .Test(xnn_f32_gemm_minmax_ukernel_4x8__neonfma_dup_ld128, xnn_init_f32_minmax_scalar_params);
     }
   }
 
-  TEST(F32_GEMM_MINMAX_4X8__NEONFMA_LANE_LD64, k_div_2_strided_a) {
+  TEST(F32_GEMM_MINMAX_4X8__NEONFMA_DUP_LD128, k_div_4_strided_a) {
     TEST_REQUIRES_ARM_NEON_FMA;
-    for (size_t k = 4; k <= 20; k += 2) {
+    for (size_t k = 8; k <= 40; k += 4) {
       GemmMicrokernelTester()
         .mr(4)
         .nr(8)
@@ -10788,14 +10788,14 @@
         .m(4)
         .n(8)
         .k(k)
-        .a_stride(23)
-        .Test(xnn_f32_gemm_minmax_ukernel_4x8__neonfma_lane_ld64, xnn_init_f32_minmax_scalar_params);
+        .a_stride(43)
+        .Test(xnn_f32_gemm_minmax_ukernel_4x8__neonfma_dup_ld128, xnn_init_f32_minmax_scalar_params);
     }
   }
 
-  TEST(F32_GEMM_MINMAX_4X8__NEONFMA_LANE_LD64, k_div_2_subtile) {
+  TEST(F32_GEMM_MINMAX_4X8__NEONFMA_DUP_LD128, k_div_4_subtile) {
     TEST_REQUIRES_ARM_NEON_FMA;
-    for (size_t k = 4; k <= 20; k += 2) {
+    for (size_t k = 8; k <= 40; k += 4) {
       for (uint32_t n = 1; n <= 8; n++) {
         for (uint32_t m = 1; m <= 4; m++) {
           GemmMicrokernelTester()
@@ -10807,16 +10807,16 @@
             .n(n)
             .k(k)
             .iterations(1)
-            .Test(xnn_f32_gemm_minmax_ukernel_4x8__neonfma_lane_ld64, xnn_init_f32_minmax_scalar_params);
+            .Test(xnn_f32_gemm_minmax_ukernel_4x8__neonfma_dup_ld128, xnn_init_f32_minmax_scalar_params);
         }
       }
     }
   }
 
-  TEST(F32_GEMM_MINMAX_4X8__NEONFMA_LANE_LD64, n_gt_8) {
+  TEST(F32_GEMM_MINMAX_4X8__NEONFMA_DUP_LD128, n_gt_8) {
     TEST_REQUIRES_ARM_NEON_FMA;
     for (uint32_t n = 9; n < 16; n++) {
-      for (size_t k = 1; k <= 10; k += 3) {
+      for (size_t k = 1; k <= 20; k += 5) {
         GemmMicrokernelTester()
           .mr(4)
           .nr(8)
@@ -10825,15 +10825,15 @@
           .m(4)
           .n(n)
           .k(k)
-          .Test(xnn_f32_gemm_minmax_ukernel_4x8__neonfma_lane_ld64, xnn_init_f32_minmax_scalar_params);
+          .Test(xnn_f32_gemm_minmax_ukernel_4x8__neonfma_dup_ld128, xnn_init_f32_minmax_scalar_params);
       }
     }
   }
 
-  TEST(F32_GEMM_MINMAX_4X8__NEONFMA_LANE_LD64, n_gt_8_strided_cn) {
+  TEST(F32_GEMM_MINMAX_4X8__NEONFMA_DUP_LD128, n_gt_8_strided_cn) {
     TEST_REQUIRES_ARM_NEON_FMA;
     for (uint32_t n = 9; n < 16; n++) {
-      for (size_t k = 1; k <= 10; k += 3) {
+      for (size_t k = 1; k <= 20; k += 5) {
         GemmMicrokernelTester()
           .mr(4)
           .nr(8)
@@ -10843,15 +10843,15 @@
           .n(n)
           .k(k)
           .cn_stride(11)
-          .Test(xnn_f32_gemm_minmax_ukernel_4x8__neonfma_lane_ld64, xnn_init_f32_minmax_scalar_params);
+          .Test(xnn_f32_gemm_minmax_ukernel_4x8__neonfma_dup_ld128, xnn_init_f32_minmax_scalar_params);
       }
     }
   }
 
-  TEST(F32_GEMM_MINMAX_4X8__NEONFMA_LANE_LD64, n_gt_8_strided_a) {
+  TEST(F32_GEMM_MINMAX_4X8__NEONFMA_DUP_LD128, n_gt_8_strided_a) {
     TEST_REQUIRES_ARM_NEON_FMA;
     for (uint32_t n = 9; n < 16; n++) {
-      for (size_t k = 1; k <= 10; k += 3) {
+      for (size_t k = 1; k <= 20; k += 5) {
         GemmMicrokernelTester()
           .mr(4)
           .nr(8)
@@ -10860,16 +10860,16 @@
           .m(4)
           .n(n)
           .k(k)
-          .a_stride(13)
-          .Test(xnn_f32_gemm_minmax_ukernel_4x8__neonfma_lane_ld64, xnn_init_f32_minmax_scalar_params);
+          .a_stride(23)
+          .Test(xnn_f32_gemm_minmax_ukernel_4x8__neonfma_dup_ld128, xnn_init_f32_minmax_scalar_params);
       }
     }
   }
 
-  TEST(F32_GEMM_MINMAX_4X8__NEONFMA_LANE_LD64, n_gt_8_subtile) {
+  TEST(F32_GEMM_MINMAX_4X8__NEONFMA_DUP_LD128, n_gt_8_subtile) {
     TEST_REQUIRES_ARM_NEON_FMA;
     for (uint32_t n = 9; n < 16; n++) {
-      for (size_t k = 1; k <= 10; k += 3) {
+      for (size_t k = 1; k <= 20; k += 5) {
         for (uint32_t m = 1; m <= 4; m++) {
           GemmMicrokernelTester()
             .mr(4)
@@ -10880,16 +10880,16 @@
             .n(n)
             .k(k)
             .iterations(1)
-            .Test(xnn_f32_gemm_minmax_ukernel_4x8__neonfma_lane_ld64, xnn_init_f32_minmax_scalar_params);
+            .Test(xnn_f32_gemm_minmax_ukernel_4x8__neonfma_dup_ld128, xnn_init_f32_minmax_scalar_params);
         }
       }
     }
   }
 
-  TEST(F32_GEMM_MINMAX_4X8__NEONFMA_LANE_LD64, n_div_8) {
+  TEST(F32_GEMM_MINMAX_4X8__NEONFMA_DUP_LD128, n_div_8) {
     TEST_REQUIRES_ARM_NEON_FMA;
     for (uint32_t n = 16; n <= 24; n += 8) {
-      for (size_t k = 1; k <= 10; k += 3) {
+      for (size_t k = 1; k <= 20; k += 5) {
         GemmMicrokernelTester()
           .mr(4)
           .nr(8)
@@ -10898,15 +10898,15 @@
           .m(4)
           .n(n)
           .k(k)
-          .Test(xnn_f32_gemm_minmax_ukernel_4x8__neonfma_lane_ld64, xnn_init_f32_minmax_scalar_params);
+          .Test(xnn_f32_gemm_minmax_ukernel_4x8__neonfma_dup_ld128, xnn_init_f32_minmax_scalar_params);
       }
     }
   }
 
-  TEST(F32_GEMM_MINMAX_4X8__NEONFMA_LANE_LD64, n_div_8_strided_cn) {
+  TEST(F32_GEMM_MINMAX_4X8__NEONFMA_DUP_LD128, n_div_8_strided_cn) {
     TEST_REQUIRES_ARM_NEON_FMA;
     for (uint32_t n = 16; n <= 24; n += 8) {
-      for (size_t k = 1; k <= 10; k += 3) {
+      for (size_t k = 1; k <= 20; k += 5) {
         GemmMicrokernelTester()
           .mr(4)
           .nr(8)
@@ -10916,15 +10916,15 @@
           .n(n)
           .k(k)
           .cn_stride(11)
-          .Test(xnn_f32_gemm_minmax_ukernel_4x8__neonfma_lane_ld64, xnn_init_f32_minmax_scalar_params);
+          .Test(xnn_f32_gemm_minmax_ukernel_4x8__neonfma_dup_ld128, xnn_init_f32_minmax_scalar_params);
       }
     }
   }
 
-  TEST(F32_GEMM_MINMAX_4X8__NEONFMA_LANE_LD64, n_div_8_strided_a) {
+  TEST(F32_GEMM_MINMAX_4X8__NEONFMA_DUP_LD128, n_div_8_strided_a) {
     TEST_REQUIRES_ARM_NEON_FMA;
     for (uint32_t n = 16; n <= 24; n += 8) {
-      for (size_t k = 1; k <= 10; k += 3) {
+      for (size_t k = 1; k <= 20; k += 5) {
         GemmMicrokernelTester()
           .mr(4)
           .nr(8)
@@ -10933,16 +10933,16 @@
           .m(4)
           .n(n)
           .k(k)
-          .a_stride(13)
-          .Test(xnn_f32_gemm_minmax_ukernel_4x8__neonfma_lane_ld64, xnn_init_f32_minmax_scalar_params);
+          .a_stride(23)
+          .Test(xnn_f32_gemm_minmax_ukernel_4x8__neonfma_dup_ld128, xnn_init_f32_minmax_scalar_params);
       }
     }
   }
 
-  TEST(F32_GEMM_MINMAX_4X8__NEONFMA_LANE_LD64, n_div_8_subtile) {
+  TEST(F32_GEMM_MINMAX_4X8__NEONFMA_DUP_LD128, n_div_8_subtile) {
     TEST_REQUIRES_ARM_NEON_FMA;
     for (uint32_t n = 16; n <= 24; n += 8) {
-      for (size_t k = 1; k <= 10; k += 3) {
+      for (size_t k = 1; k <= 20; k += 5) {
         for (uint32_t m = 1; m <= 4; m++) {
           GemmMicrokernelTester()
             .mr(4)
@@ -10953,15 +10953,15 @@
             .n(n)
             .k(k)
             .iterations(1)
-            .Test(xnn_f32_gemm_minmax_ukernel_4x8__neonfma_lane_ld64, xnn_init_f32_minmax_scalar_params);
+            .Test(xnn_f32_gemm_minmax_ukernel_4x8__neonfma_dup_ld128, xnn_init_f32_minmax_scalar_params);
         }
       }
     }
   }
 
-  TEST(F32_GEMM_MINMAX_4X8__NEONFMA_LANE_LD64, strided_cm_subtile) {
+  TEST(F32_GEMM_MINMAX_4X8__NEONFMA_DUP_LD128, strided_cm_subtile) {
     TEST_REQUIRES_ARM_NEON_FMA;
-    for (size_t k = 1; k <= 10; k += 3) {
+    for (size_t k = 1; k <= 20; k += 5) {
       for (uint32_t n = 1; n <= 8; n++) {
         for (uint32_t m = 1; m <= 4; m++) {
           GemmMicrokernelTester()
@@ -10974,13 +10974,13 @@
             .k(k)
             .cm_stride(11)
             .iterations(1)
-            .Test(xnn_f32_gemm_minmax_ukernel_4x8__neonfma_lane_ld64, xnn_init_f32_minmax_scalar_params);
+            .Test(xnn_f32_gemm_minmax_ukernel_4x8__neonfma_dup_ld128, xnn_init_f32_minmax_scalar_params);
         }
       }
     }
   }
 
-  TEST(F32_GEMM_MINMAX_4X8__NEONFMA_LANE_LD64, qmin) {
+  TEST(F32_GEMM_MINMAX_4X8__NEONFMA_DUP_LD128, qmin) {
     TEST_REQUIRES_ARM_NEON_FMA;
     GemmMicrokernelTester()
       .mr(4)
@@ -10989,12 +10989,12 @@
       .sr(1)
       .m(4)
       .n(8)
-      .k(2)
+      .k(4)
       .qmin(128)
-      .Test(xnn_f32_gemm_minmax_ukernel_4x8__neonfma_lane_ld64, xnn_init_f32_minmax_scalar_params);
+      .Test(xnn_f32_gemm_minmax_ukernel_4x8__neonfma_dup_ld128, xnn_init_f32_minmax_scalar_params);
   }
 
-  TEST(F32_GEMM_MINMAX_4X8__NEONFMA_LANE_LD64, qmax) {
+  TEST(F32_GEMM_MINMAX_4X8__NEONFMA_DUP_LD128, qmax) {
     TEST_REQUIRES_ARM_NEON_FMA;
     GemmMicrokernelTester()
       .mr(4)
@@ -11003,12 +11003,12 @@
       .sr(1)
       .m(4)
       .n(8)
-      .k(2)
+      .k(4)
       .qmax(128)
-      .Test(xnn_f32_gemm_minmax_ukernel_4x8__neonfma_lane_ld64, xnn_init_f32_minmax_scalar_params);
+      .Test(xnn_f32_gemm_minmax_ukernel_4x8__neonfma_dup_ld128, xnn_init_f32_minmax_scalar_params);
   }
 
-  TEST(F32_GEMM_MINMAX_4X8__NEONFMA_LANE_LD64, strided_cm) {
+  TEST(F32_GEMM_MINMAX_4X8__NEONFMA_DUP_LD128, strided_cm) {
     TEST_REQUIRES_ARM_NEON_FMA;
     GemmMicrokernelTester()
       .mr(4)
@@ -11017,56 +11017,56 @@
       .sr(1)
       .m(4)
       .n(8)
-      .k(2)
+      .k(4)
       .cm_stride(11)
-      .Test(xnn_f32_gemm_minmax_ukernel_4x8__neonfma_lane_ld64, xnn_init_f32_minmax_scalar_params);
+      .Test(xnn_f32_gemm_minmax_ukernel_4x8__neonfma_dup_ld128, xnn_init_f32_minmax_scalar_params);
   }
-#endif  // XNN_ARCH_ARM64
+#endif  // XNN_ARCH_ARM || XNN_ARCH_ARM64
 
 
-#if XNN_ARCH_ARM || XNN_ARCH_ARM64
-  TEST(F32_GEMM_MINMAX_4X8S4__NEONFMA, k_eq_4) {
+#if XNN_ARCH_ARM64
+  TEST(F32_GEMM_MINMAX_4X8__NEONFMA_LANE_LD64, k_eq_2) {
     TEST_REQUIRES_ARM_NEON_FMA;
     GemmMicrokernelTester()
       .mr(4)
       .nr(8)
       .kr(1)
-      .sr(4)
+      .sr(1)
       .m(4)
       .n(8)
-      .k(4)
-      .Test(xnn_f32_gemm_minmax_ukernel_4x8s4__neonfma, xnn_init_f32_minmax_scalar_params);
+      .k(2)
+      .Test(xnn_f32_gemm_minmax_ukernel_4x8__neonfma_lane_ld64, xnn_init_f32_minmax_scalar_params);
   }
 
-  TEST(F32_GEMM_MINMAX_4X8S4__NEONFMA, strided_cn) {
+  TEST(F32_GEMM_MINMAX_4X8__NEONFMA_LANE_LD64, strided_cn) {
     TEST_REQUIRES_ARM_NEON_FMA;
     GemmMicrokernelTester()
       .mr(4)
       .nr(8)
       .kr(1)
-      .sr(4)
+      .sr(1)
       .m(4)
       .n(8)
-      .k(4)
+      .k(2)
       .cn_stride(11)
-      .Test(xnn_f32_gemm_minmax_ukernel_4x8s4__neonfma, xnn_init_f32_minmax_scalar_params);
+      .Test(xnn_f32_gemm_minmax_ukernel_4x8__neonfma_lane_ld64, xnn_init_f32_minmax_scalar_params);
   }
 
-  TEST(F32_GEMM_MINMAX_4X8S4__NEONFMA, k_eq_4_strided_a) {
+  TEST(F32_GEMM_MINMAX_4X8__NEONFMA_LANE_LD64, k_eq_2_strided_a) {
     TEST_REQUIRES_ARM_NEON_FMA;
     GemmMicrokernelTester()
       .mr(4)
       .nr(8)
       .kr(1)
-      .sr(4)
+      .sr(1)
       .m(4)
       .n(8)
-      .k(4)
-      .a_stride(7)
-      .Test(xnn_f32_gemm_minmax_ukernel_4x8s4__neonfma, xnn_init_f32_minmax_scalar_params);
+      .k(2)
+      .a_stride(5)
+      .Test(xnn_f32_gemm_minmax_ukernel_4x8__neonfma_lane_ld64, xnn_init_f32_minmax_scalar_params);
   }
 
-  TEST(F32_GEMM_MINMAX_4X8S4__NEONFMA, k_eq_4_subtile) {
+  TEST(F32_GEMM_MINMAX_4X8__NEONFMA_LANE_LD64, k_eq_2_subtile) {
     TEST_REQUIRES_ARM_NEON_FMA;
     for (uint32_t n = 1; n <= 8; n++) {
       for (uint32_t m = 1; m <= 4; m++) {
@@ -11074,414 +11074,1281 @@
           .mr(4)
           .nr(8)
           .kr(1)
-          .sr(4)
+          .sr(1)
           .m(m)
           .n(n)
-          .k(4)
+          .k(2)
           .iterations(1)
-          .Test(xnn_f32_gemm_minmax_ukernel_4x8s4__neonfma, xnn_init_f32_minmax_scalar_params);
+          .Test(xnn_f32_gemm_minmax_ukernel_4x8__neonfma_lane_ld64, xnn_init_f32_minmax_scalar_params);
       }
     }
   }
 
-  TEST(F32_GEMM_MINMAX_4X8S4__NEONFMA, k_eq_4_subtile_m) {
+  TEST(F32_GEMM_MINMAX_4X8__NEONFMA_LANE_LD64, k_eq_2_subtile_m) {
     TEST_REQUIRES_ARM_NEON_FMA;
     for (uint32_t m = 1; m <= 4; m++) {
       GemmMicrokernelTester()
         .mr(4)
         .nr(8)
         .kr(1)
-        .sr(4)
+        .sr(1)
         .m(m)
         .n(8)
-        .k(4)
+        .k(2)
         .iterations(1)
-        .Test(xnn_f32_gemm_minmax_ukernel_4x8s4__neonfma, xnn_init_f32_minmax_scalar_params);
+        .Test(xnn_f32_gemm_minmax_ukernel_4x8__neonfma_lane_ld64, xnn_init_f32_minmax_scalar_params);
     }
   }
 
-  TEST(F32_GEMM_MINMAX_4X8S4__NEONFMA, k_eq_4_subtile_n) {
+  TEST(F32_GEMM_MINMAX_4X8__NEONFMA_LANE_LD64, k_eq_2_subtile_n) {
     TEST_REQUIRES_ARM_NEON_FMA;
     for (uint32_t n = 1; n <= 8; n++) {
       GemmMicrokernelTester()
         .mr(4)
         .nr(8)
         .kr(1)
-        .sr(4)
+        .sr(1)
         .m(4)
         .n(n)
-        .k(4)
+        .k(2)
         .iterations(1)
-        .Test(xnn_f32_gemm_minmax_ukernel_4x8s4__neonfma, xnn_init_f32_minmax_scalar_params);
+        .Test(xnn_f32_gemm_minmax_ukernel_4x8__neonfma_lane_ld64, xnn_init_f32_minmax_scalar_params);
     }
   }
 
-  TEST(F32_GEMM_MINMAX_4X8S4__NEONFMA, k_lt_4) {
+  TEST(F32_GEMM_MINMAX_4X8__NEONFMA_LANE_LD64, k_lt_2) {
     TEST_REQUIRES_ARM_NEON_FMA;
-    for (size_t k = 1; k < 4; k++) {
+    for (size_t k = 1; k < 2; k++) {
       GemmMicrokernelTester()
         .mr(4)
         .nr(8)
         .kr(1)
-        .sr(4)
+        .sr(1)
         .m(4)
         .n(8)
         .k(k)
-        .Test(xnn_f32_gemm_minmax_ukernel_4x8s4__neonfma, xnn_init_f32_minmax_scalar_params);
+        .Test(xnn_f32_gemm_minmax_ukernel_4x8__neonfma_lane_ld64, xnn_init_f32_minmax_scalar_params);
     }
   }
 
-  TEST(F32_GEMM_MINMAX_4X8S4__NEONFMA, k_lt_4_strided_a) {
+  TEST(F32_GEMM_MINMAX_4X8__NEONFMA_LANE_LD64, k_lt_2_strided_a) {
     TEST_REQUIRES_ARM_NEON_FMA;
-    for (size_t k = 1; k < 4; k++) {
+    for (size_t k = 1; k < 2; k++) {
       GemmMicrokernelTester()
         .mr(4)
         .nr(8)
         .kr(1)
-        .sr(4)
+        .sr(1)
         .m(4)
         .n(8)
         .k(k)
-        .a_stride(7)
-        .Test(xnn_f32_gemm_minmax_ukernel_4x8s4__neonfma, xnn_init_f32_minmax_scalar_params);
+        .a_stride(5)
+        .Test(xnn_f32_gemm_minmax_ukernel_4x8__neonfma_lane_ld64, xnn_init_f32_minmax_scalar_params);
     }
   }
 
-  TEST(F32_GEMM_MINMAX_4X8S4__NEONFMA, k_lt_4_subtile) {
+  TEST(F32_GEMM_MINMAX_4X8__NEONFMA_LANE_LD64, k_lt_2_subtile) {
     TEST_REQUIRES_ARM_NEON_FMA;
-    for (size_t k = 1; k < 4; k++) {
+    for (size_t k = 1; k < 2; k++) {
       for (uint32_t n = 1; n <= 8; n++) {
         for (uint32_t m = 1; m <= 4; m++) {
           GemmMicrokernelTester()
             .mr(4)
             .nr(8)
             .kr(1)
-            .sr(4)
+            .sr(1)
             .m(m)
             .n(n)
             .k(k)
             .iterations(1)
-            .Test(xnn_f32_gemm_minmax_ukernel_4x8s4__neonfma, xnn_init_f32_minmax_scalar_params);
+            .Test(xnn_f32_gemm_minmax_ukernel_4x8__neonfma_lane_ld64, xnn_init_f32_minmax_scalar_params);
         }
       }
     }
   }
 
-  TEST(F32_GEMM_MINMAX_4X8S4__NEONFMA, k_gt_4) {
+  TEST(F32_GEMM_MINMAX_4X8__NEONFMA_LANE_LD64, k_gt_2) {
     TEST_REQUIRES_ARM_NEON_FMA;
-    for (size_t k = 5; k < 8; k++) {
+    for (size_t k = 3; k < 4; k++) {
       GemmMicrokernelTester()
         .mr(4)
         .nr(8)
         .kr(1)
-        .sr(4)
+        .sr(1)
         .m(4)
         .n(8)
         .k(k)
-        .Test(xnn_f32_gemm_minmax_ukernel_4x8s4__neonfma, xnn_init_f32_minmax_scalar_params);
+        .Test(xnn_f32_gemm_minmax_ukernel_4x8__neonfma_lane_ld64, xnn_init_f32_minmax_scalar_params);
     }
   }
 
-  TEST(F32_GEMM_MINMAX_4X8S4__NEONFMA, k_gt_4_strided_a) {
+  TEST(F32_GEMM_MINMAX_4X8__NEONFMA_LANE_LD64, k_gt_2_strided_a) {
     TEST_REQUIRES_ARM_NEON_FMA;
-    for (size_t k = 5; k < 8; k++) {
+    for (size_t k = 3; k < 4; k++) {
       GemmMicrokernelTester()
         .mr(4)
         .nr(8)
         .kr(1)
-        .sr(4)
+        .sr(1)
         .m(4)
         .n(8)
         .k(k)
-        .a_stride(11)
-        .Test(xnn_f32_gemm_minmax_ukernel_4x8s4__neonfma, xnn_init_f32_minmax_scalar_params);
+        .a_stride(7)
+        .Test(xnn_f32_gemm_minmax_ukernel_4x8__neonfma_lane_ld64, xnn_init_f32_minmax_scalar_params);
     }
   }
 
-  TEST(F32_GEMM_MINMAX_4X8S4__NEONFMA, k_gt_4_subtile) {
+  TEST(F32_GEMM_MINMAX_4X8__NEONFMA_LANE_LD64, k_gt_2_subtile) {
     TEST_REQUIRES_ARM_NEON_FMA;
-    for (size_t k = 5; k < 8; k++) {
+    for (size_t k = 3; k < 4; k++) {
       for (uint32_t n = 1; n <= 8; n++) {
         for (uint32_t m = 1; m <= 4; m++) {
           GemmMicrokernelTester()
             .mr(4)
             .nr(8)
             .kr(1)
-            .sr(4)
+            .sr(1)
             .m(m)
             .n(n)
             .k(k)
             .iterations(1)
-            .Test(xnn_f32_gemm_minmax_ukernel_4x8s4__neonfma, xnn_init_f32_minmax_scalar_params);
+            .Test(xnn_f32_gemm_minmax_ukernel_4x8__neonfma_lane_ld64, xnn_init_f32_minmax_scalar_params);
         }
       }
     }
   }
 
-  TEST(F32_GEMM_MINMAX_4X8S4__NEONFMA, k_div_4) {
+  TEST(F32_GEMM_MINMAX_4X8__NEONFMA_LANE_LD64, k_div_2) {
     TEST_REQUIRES_ARM_NEON_FMA;
-    for (size_t k = 8; k <= 40; k += 4) {
+    for (size_t k = 4; k <= 20; k += 2) {
       GemmMicrokernelTester()
         .mr(4)
         .nr(8)
         .kr(1)
-        .sr(4)
+        .sr(1)
         .m(4)
         .n(8)
         .k(k)
-        .Test(xnn_f32_gemm_minmax_ukernel_4x8s4__neonfma, xnn_init_f32_minmax_scalar_params);
+        .Test(xnn_f32_gemm_minmax_ukernel_4x8__neonfma_lane_ld64, xnn_init_f32_minmax_scalar_params);
     }
   }
 
-  TEST(F32_GEMM_MINMAX_4X8S4__NEONFMA, k_div_4_strided_a) {
+  TEST(F32_GEMM_MINMAX_4X8__NEONFMA_LANE_LD64, k_div_2_strided_a) {
     TEST_REQUIRES_ARM_NEON_FMA;
-    for (size_t k = 8; k <= 40; k += 4) {
+    for (size_t k = 4; k <= 20; k += 2) {
       GemmMicrokernelTester()
         .mr(4)
         .nr(8)
         .kr(1)
-        .sr(4)
+        .sr(1)
         .m(4)
         .n(8)
         .k(k)
-        .a_stride(43)
-        .Test(xnn_f32_gemm_minmax_ukernel_4x8s4__neonfma, xnn_init_f32_minmax_scalar_params);
+        .a_stride(23)
+        .Test(xnn_f32_gemm_minmax_ukernel_4x8__neonfma_lane_ld64, xnn_init_f32_minmax_scalar_params);
     }
   }
 
-  TEST(F32_GEMM_MINMAX_4X8S4__NEONFMA, k_div_4_subtile) {
+  TEST(F32_GEMM_MINMAX_4X8__NEONFMA_LANE_LD64, k_div_2_subtile) {
     TEST_REQUIRES_ARM_NEON_FMA;
-    for (size_t k = 8; k <= 40; k += 4) {
+    for (size_t k = 4; k <= 20; k += 2) {
       for (uint32_t n = 1; n <= 8; n++) {
         for (uint32_t m = 1; m <= 4; m++) {
           GemmMicrokernelTester()
             .mr(4)
             .nr(8)
             .kr(1)
-            .sr(4)
+            .sr(1)
             .m(m)
             .n(n)
             .k(k)
             .iterations(1)
-            .Test(xnn_f32_gemm_minmax_ukernel_4x8s4__neonfma, xnn_init_f32_minmax_scalar_params);
+            .Test(xnn_f32_gemm_minmax_ukernel_4x8__neonfma_lane_ld64, xnn_init_f32_minmax_scalar_params);
         }
       }
     }
   }
 
-  TEST(F32_GEMM_MINMAX_4X8S4__NEONFMA, n_gt_8) {
+  TEST(F32_GEMM_MINMAX_4X8__NEONFMA_LANE_LD64, n_gt_8) {
     TEST_REQUIRES_ARM_NEON_FMA;
     for (uint32_t n = 9; n < 16; n++) {
-      for (size_t k = 1; k <= 20; k += 5) {
+      for (size_t k = 1; k <= 10; k += 3) {
         GemmMicrokernelTester()
           .mr(4)
           .nr(8)
           .kr(1)
-          .sr(4)
+          .sr(1)
           .m(4)
           .n(n)
           .k(k)
-          .Test(xnn_f32_gemm_minmax_ukernel_4x8s4__neonfma, xnn_init_f32_minmax_scalar_params);
+          .Test(xnn_f32_gemm_minmax_ukernel_4x8__neonfma_lane_ld64, xnn_init_f32_minmax_scalar_params);
       }
     }
   }
 
-  TEST(F32_GEMM_MINMAX_4X8S4__NEONFMA, n_gt_8_strided_cn) {
+  TEST(F32_GEMM_MINMAX_4X8__NEONFMA_LANE_LD64, n_gt_8_strided_cn) {
     TEST_REQUIRES_ARM_NEON_FMA;
     for (uint32_t n = 9; n < 16; n++) {
-      for (size_t k = 1; k <= 20; k += 5) {
+      for (size_t k = 1; k <= 10; k += 3) {
         GemmMicrokernelTester()
           .mr(4)
           .nr(8)
           .kr(1)
-          .sr(4)
+          .sr(1)
           .m(4)
           .n(n)
           .k(k)
           .cn_stride(11)
-          .Test(xnn_f32_gemm_minmax_ukernel_4x8s4__neonfma, xnn_init_f32_minmax_scalar_params);
+          .Test(xnn_f32_gemm_minmax_ukernel_4x8__neonfma_lane_ld64, xnn_init_f32_minmax_scalar_params);
       }
     }
   }
 
-  TEST(F32_GEMM_MINMAX_4X8S4__NEONFMA, n_gt_8_strided_a) {
+  TEST(F32_GEMM_MINMAX_4X8__NEONFMA_LANE_LD64, n_gt_8_strided_a) {
     TEST_REQUIRES_ARM_NEON_FMA;
     for (uint32_t n = 9; n < 16; n++) {
-      for (size_t k = 1; k <= 20; k += 5) {
+      for (size_t k = 1; k <= 10; k += 3) {
         GemmMicrokernelTester()
           .mr(4)
           .nr(8)
           .kr(1)
-          .sr(4)
+          .sr(1)
           .m(4)
           .n(n)
           .k(k)
-          .a_stride(23)
-          .Test(xnn_f32_gemm_minmax_ukernel_4x8s4__neonfma, xnn_init_f32_minmax_scalar_params);
+          .a_stride(13)
+          .Test(xnn_f32_gemm_minmax_ukernel_4x8__neonfma_lane_ld64, xnn_init_f32_minmax_scalar_params);
       }
     }
   }
 
-  TEST(F32_GEMM_MINMAX_4X8S4__NEONFMA, n_gt_8_subtile) {
+  TEST(F32_GEMM_MINMAX_4X8__NEONFMA_LANE_LD64, n_gt_8_subtile) {
     TEST_REQUIRES_ARM_NEON_FMA;
     for (uint32_t n = 9; n < 16; n++) {
-      for (size_t k = 1; k <= 20; k += 5) {
+      for (size_t k = 1; k <= 10; k += 3) {
         for (uint32_t m = 1; m <= 4; m++) {
           GemmMicrokernelTester()
             .mr(4)
             .nr(8)
             .kr(1)
-            .sr(4)
+            .sr(1)
             .m(m)
             .n(n)
             .k(k)
             .iterations(1)
-            .Test(xnn_f32_gemm_minmax_ukernel_4x8s4__neonfma, xnn_init_f32_minmax_scalar_params);
+            .Test(xnn_f32_gemm_minmax_ukernel_4x8__neonfma_lane_ld64, xnn_init_f32_minmax_scalar_params);
         }
       }
     }
   }
 
-  TEST(F32_GEMM_MINMAX_4X8S4__NEONFMA, n_div_8) {
+  TEST(F32_GEMM_MINMAX_4X8__NEONFMA_LANE_LD64, n_div_8) {
     TEST_REQUIRES_ARM_NEON_FMA;
     for (uint32_t n = 16; n <= 24; n += 8) {
-      for (size_t k = 1; k <= 20; k += 5) {
+      for (size_t k = 1; k <= 10; k += 3) {
         GemmMicrokernelTester()
           .mr(4)
           .nr(8)
           .kr(1)
-          .sr(4)
+          .sr(1)
           .m(4)
           .n(n)
           .k(k)
-          .Test(xnn_f32_gemm_minmax_ukernel_4x8s4__neonfma, xnn_init_f32_minmax_scalar_params);
+          .Test(xnn_f32_gemm_minmax_ukernel_4x8__neonfma_lane_ld64, xnn_init_f32_minmax_scalar_params);
       }
     }
   }
 
-  TEST(F32_GEMM_MINMAX_4X8S4__NEONFMA, n_div_8_strided_cn) {
+  TEST(F32_GEMM_MINMAX_4X8__NEONFMA_LANE_LD64, n_div_8_strided_cn) {
     TEST_REQUIRES_ARM_NEON_FMA;
     for (uint32_t n = 16; n <= 24; n += 8) {
-      for (size_t k = 1; k <= 20; k += 5) {
+      for (size_t k = 1; k <= 10; k += 3) {
         GemmMicrokernelTester()
           .mr(4)
           .nr(8)
           .kr(1)
-          .sr(4)
+          .sr(1)
           .m(4)
           .n(n)
           .k(k)
           .cn_stride(11)
-          .Test(xnn_f32_gemm_minmax_ukernel_4x8s4__neonfma, xnn_init_f32_minmax_scalar_params);
+          .Test(xnn_f32_gemm_minmax_ukernel_4x8__neonfma_lane_ld64, xnn_init_f32_minmax_scalar_params);
       }
     }
   }
 
-  TEST(F32_GEMM_MINMAX_4X8S4__NEONFMA, n_div_8_strided_a) {
+  TEST(F32_GEMM_MINMAX_4X8__NEONFMA_LANE_LD64, n_div_8_strided_a) {
     TEST_REQUIRES_ARM_NEON_FMA;
     for (uint32_t n = 16; n <= 24; n += 8) {
-      for (size_t k = 1; k <= 20; k += 5) {
+      for (size_t k = 1; k <= 10; k += 3) {
         GemmMicrokernelTester()
           .mr(4)
           .nr(8)
           .kr(1)
-          .sr(4)
+          .sr(1)
           .m(4)
           .n(n)
           .k(k)
-          .a_stride(23)
-          .Test(xnn_f32_gemm_minmax_ukernel_4x8s4__neonfma, xnn_init_f32_minmax_scalar_params);
+          .a_stride(13)
+          .Test(xnn_f32_gemm_minmax_ukernel_4x8__neonfma_lane_ld64, xnn_init_f32_minmax_scalar_params);
       }
     }
   }
 
-  TEST(F32_GEMM_MINMAX_4X8S4__NEONFMA, n_div_8_subtile) {
+  TEST(F32_GEMM_MINMAX_4X8__NEONFMA_LANE_LD64, n_div_8_subtile) {
     TEST_REQUIRES_ARM_NEON_FMA;
     for (uint32_t n = 16; n <= 24; n += 8) {
-      for (size_t k = 1; k <= 20; k += 5) {
+      for (size_t k = 1; k <= 10; k += 3) {
         for (uint32_t m = 1; m <= 4; m++) {
           GemmMicrokernelTester()
             .mr(4)
             .nr(8)
             .kr(1)
-            .sr(4)
+            .sr(1)
             .m(m)
             .n(n)
             .k(k)
             .iterations(1)
-            .Test(xnn_f32_gemm_minmax_ukernel_4x8s4__neonfma, xnn_init_f32_minmax_scalar_params);
+            .Test(xnn_f32_gemm_minmax_ukernel_4x8__neonfma_lane_ld64, xnn_init_f32_minmax_scalar_params);
         }
       }
     }
   }
 
-  TEST(F32_GEMM_MINMAX_4X8S4__NEONFMA, strided_cm_subtile) {
+  TEST(F32_GEMM_MINMAX_4X8__NEONFMA_LANE_LD64, strided_cm_subtile) {
     TEST_REQUIRES_ARM_NEON_FMA;
-    for (size_t k = 1; k <= 20; k += 5) {
+    for (size_t k = 1; k <= 10; k += 3) {
       for (uint32_t n = 1; n <= 8; n++) {
         for (uint32_t m = 1; m <= 4; m++) {
           GemmMicrokernelTester()
             .mr(4)
             .nr(8)
             .kr(1)
-            .sr(4)
+            .sr(1)
             .m(m)
             .n(n)
             .k(k)
             .cm_stride(11)
             .iterations(1)
-            .Test(xnn_f32_gemm_minmax_ukernel_4x8s4__neonfma, xnn_init_f32_minmax_scalar_params);
+            .Test(xnn_f32_gemm_minmax_ukernel_4x8__neonfma_lane_ld64, xnn_init_f32_minmax_scalar_params);
         }
       }
     }
   }
 
-  TEST(F32_GEMM_MINMAX_4X8S4__NEONFMA, qmin) {
+  TEST(F32_GEMM_MINMAX_4X8__NEONFMA_LANE_LD64, qmin) {
     TEST_REQUIRES_ARM_NEON_FMA;
     GemmMicrokernelTester()
       .mr(4)
       .nr(8)
       .kr(1)
-      .sr(4)
+      .sr(1)
       .m(4)
       .n(8)
-      .k(4)
+      .k(2)
       .qmin(128)
-      .Test(xnn_f32_gemm_minmax_ukernel_4x8s4__neonfma, xnn_init_f32_minmax_scalar_params);
+      .Test(xnn_f32_gemm_minmax_ukernel_4x8__neonfma_lane_ld64, xnn_init_f32_minmax_scalar_params);
   }
 
-  TEST(F32_GEMM_MINMAX_4X8S4__NEONFMA, qmax) {
+  TEST(F32_GEMM_MINMAX_4X8__NEONFMA_LANE_LD64, qmax) {
     TEST_REQUIRES_ARM_NEON_FMA;
     GemmMicrokernelTester()
       .mr(4)
       .nr(8)
       .kr(1)
-      .sr(4)
+      .sr(1)
       .m(4)
       .n(8)
-      .k(4)
+      .k(2)
       .qmax(128)
-      .Test(xnn_f32_gemm_minmax_ukernel_4x8s4__neonfma, xnn_init_f32_minmax_scalar_params);
+      .Test(xnn_f32_gemm_minmax_ukernel_4x8__neonfma_lane_ld64, xnn_init_f32_minmax_scalar_params);
   }
 
-  TEST(F32_GEMM_MINMAX_4X8S4__NEONFMA, strided_cm) {
+  TEST(F32_GEMM_MINMAX_4X8__NEONFMA_LANE_LD64, strided_cm) {
     TEST_REQUIRES_ARM_NEON_FMA;
     GemmMicrokernelTester()
       .mr(4)
       .nr(8)
       .kr(1)
-      .sr(4)
+      .sr(1)
       .m(4)
       .n(8)
-      .k(4)
+      .k(2)
       .cm_stride(11)
+      .Test(xnn_f32_gemm_minmax_ukernel_4x8__neonfma_lane_ld64, xnn_init_f32_minmax_scalar_params);
+  }
+#endif  // XNN_ARCH_ARM64
+
+
+#if XNN_ARCH_ARM || XNN_ARCH_ARM64
+  TEST(F32_GEMM_MINMAX_4X8S4__NEONFMA, k_eq_4) {
+    TEST_REQUIRES_ARM_NEON_FMA;
+    GemmMicrokernelTester()
+      .mr(4)
+      .nr(8)
+      .kr(1)
+      .sr(4)
+      .m(4)
+      .n(8)
+      .k(4)
+      .Test(xnn_f32_gemm_minmax_ukernel_4x8s4__neonfma, xnn_init_f32_minmax_scalar_params);
+  }
+
+  TEST(F32_GEMM_MINMAX_4X8S4__NEONFMA, strided_cn) {
+    TEST_REQUIRES_ARM_NEON_FMA;
+    GemmMicrokernelTester()
+      .mr(4)
+      .nr(8)
+      .kr(1)
+      .sr(4)
+      .m(4)
+      .n(8)
+      .k(4)
+      .cn_stride(11)
       .Test(xnn_f32_gemm_minmax_ukernel_4x8s4__neonfma, xnn_init_f32_minmax_scalar_params);
   }
-#endif  // XNN_ARCH_ARM || XNN_ARCH_ARM64
-
 
-#if XNN_ARCH_ARM64
-  TEST(F32_GEMM_MINMAX_5X8__NEONFMA_LANE_LD64, k_eq_2) {
+  TEST(F32_GEMM_MINMAX_4X8S4__NEONFMA, k_eq_4_strided_a) {
+    TEST_REQUIRES_ARM_NEON_FMA;
+    GemmMicrokernelTester()
+      .mr(4)
+      .nr(8)
+      .kr(1)
+      .sr(4)
+      .m(4)
+      .n(8)
+      .k(4)
+      .a_stride(7)
+      .Test(xnn_f32_gemm_minmax_ukernel_4x8s4__neonfma, xnn_init_f32_minmax_scalar_params);
+  }
+
+  TEST(F32_GEMM_MINMAX_4X8S4__NEONFMA, k_eq_4_subtile) {
+    TEST_REQUIRES_ARM_NEON_FMA;
+    for (uint32_t n = 1; n <= 8; n++) {
+      for (uint32_t m = 1; m <= 4; m++) {
+        GemmMicrokernelTester()
+          .mr(4)
+          .nr(8)
+          .kr(1)
+          .sr(4)
+          .m(m)
+          .n(n)
+          .k(4)
+          .iterations(1)
+          .Test(xnn_f32_gemm_minmax_ukernel_4x8s4__neonfma, xnn_init_f32_minmax_scalar_params);
+      }
+    }
+  }
+
+  TEST(F32_GEMM_MINMAX_4X8S4__NEONFMA, k_eq_4_subtile_m) {
+    TEST_REQUIRES_ARM_NEON_FMA;
+    for (uint32_t m = 1; m <= 4; m++) {
+      GemmMicrokernelTester()
+        .mr(4)
+        .nr(8)
+        .kr(1)
+        .sr(4)
+        .m(m)
+        .n(8)
+        .k(4)
+        .iterations(1)
+        .Test(xnn_f32_gemm_minmax_ukernel_4x8s4__neonfma, xnn_init_f32_minmax_scalar_params);
+    }
+  }
+
+  TEST(F32_GEMM_MINMAX_4X8S4__NEONFMA, k_eq_4_subtile_n) {
+    TEST_REQUIRES_ARM_NEON_FMA;
+    for (uint32_t n = 1; n <= 8; n++) {
+      GemmMicrokernelTester()
+        .mr(4)
+        .nr(8)
+        .kr(1)
+        .sr(4)
+        .m(4)
+        .n(n)
+        .k(4)
+        .iterations(1)
+        .Test(xnn_f32_gemm_minmax_ukernel_4x8s4__neonfma, xnn_init_f32_minmax_scalar_params);
+    }
+  }
+
+  TEST(F32_GEMM_MINMAX_4X8S4__NEONFMA, k_lt_4) {
+    TEST_REQUIRES_ARM_NEON_FMA;
+    for (size_t k = 1; k < 4; k++) {
+      GemmMicrokernelTester()
+        .mr(4)
+        .nr(8)
+        .kr(1)
+        .sr(4)
+        .m(4)
+        .n(8)
+        .k(k)
+        .Test(xnn_f32_gemm_minmax_ukernel_4x8s4__neonfma, xnn_init_f32_minmax_scalar_params);
+    }
+  }
+
+  TEST(F32_GEMM_MINMAX_4X8S4__NEONFMA, k_lt_4_strided_a) {
+    TEST_REQUIRES_ARM_NEON_FMA;
+    for (size_t k = 1; k < 4; k++) {
+      GemmMicrokernelTester()
+        .mr(4)
+        .nr(8)
+        .kr(1)
+        .sr(4)
+        .m(4)
+        .n(8)
+        .k(k)
+        .a_stride(7)
+        .Test(xnn_f32_gemm_minmax_ukernel_4x8s4__neonfma, xnn_init_f32_minmax_scalar_params);
+    }
+  }
+
+  TEST(F32_GEMM_MINMAX_4X8S4__NEONFMA, k_lt_4_subtile) {
+    TEST_REQUIRES_ARM_NEON_FMA;
+    for (size_t k = 1; k < 4; k++) {
+      for (uint32_t n = 1; n <= 8; n++) {
+        for (uint32_t m = 1; m <= 4; m++) {
+          GemmMicrokernelTester()
+            .mr(4)
+            .nr(8)
+            .kr(1)
+            .sr(4)
+            .m(m)
+            .n(n)
+            .k(k)
+            .iterations(1)
+            .Test(xnn_f32_gemm_minmax_ukernel_4x8s4__neonfma, xnn_init_f32_minmax_scalar_params);
+        }
+      }
+    }
+  }
+
+  TEST(F32_GEMM_MINMAX_4X8S4__NEONFMA, k_gt_4) {
+    TEST_REQUIRES_ARM_NEON_FMA;
+    for (size_t k = 5; k < 8; k++) {
+      GemmMicrokernelTester()
+        .mr(4)
+        .nr(8)
+        .kr(1)
+        .sr(4)
+        .m(4)
+        .n(8)
+        .k(k)
+        .Test(xnn_f32_gemm_minmax_ukernel_4x8s4__neonfma, xnn_init_f32_minmax_scalar_params);
+    }
+  }
+
+  TEST(F32_GEMM_MINMAX_4X8S4__NEONFMA, k_gt_4_strided_a) {
+    TEST_REQUIRES_ARM_NEON_FMA;
+    for (size_t k = 5; k < 8; k++) {
+      GemmMicrokernelTester()
+        .mr(4)
+        .nr(8)
+        .kr(1)
+        .sr(4)
+        .m(4)
+        .n(8)
+        .k(k)
+        .a_stride(11)
+        .Test(xnn_f32_gemm_minmax_ukernel_4x8s4__neonfma, xnn_init_f32_minmax_scalar_params);
+    }
+  }
+
+  TEST(F32_GEMM_MINMAX_4X8S4__NEONFMA, k_gt_4_subtile) {
+    TEST_REQUIRES_ARM_NEON_FMA;
+    for (size_t k = 5; k < 8; k++) {
+      for (uint32_t n = 1; n <= 8; n++) {
+        for (uint32_t m = 1; m <= 4; m++) {
+          GemmMicrokernelTester()
+            .mr(4)
+            .nr(8)
+            .kr(1)
+            .sr(4)
+            .m(m)
+            .n(n)
+            .k(k)
+            .iterations(1)
+            .Test(xnn_f32_gemm_minmax_ukernel_4x8s4__neonfma, xnn_init_f32_minmax_scalar_params);
+        }
+      }
+    }
+  }
+
+  TEST(F32_GEMM_MINMAX_4X8S4__NEONFMA, k_div_4) {
+    TEST_REQUIRES_ARM_NEON_FMA;
+    for (size_t k = 8; k <= 40; k += 4) {
+      GemmMicrokernelTester()
+        .mr(4)
+        .nr(8)
+        .kr(1)
+        .sr(4)
+        .m(4)
+        .n(8)
+        .k(k)
+        .Test(xnn_f32_gemm_minmax_ukernel_4x8s4__neonfma, xnn_init_f32_minmax_scalar_params);
+    }
+  }
+
+  TEST(F32_GEMM_MINMAX_4X8S4__NEONFMA, k_div_4_strided_a) {
+    TEST_REQUIRES_ARM_NEON_FMA;
+    for (size_t k = 8; k <= 40; k += 4) {
+      GemmMicrokernelTester()
+        .mr(4)
+        .nr(8)
+        .kr(1)
+        .sr(4)
+        .m(4)
+        .n(8)
+        .k(k)
+        .a_stride(43)
+        .Test(xnn_f32_gemm_minmax_ukernel_4x8s4__neonfma, xnn_init_f32_minmax_scalar_params);
+    }
+  }
+
+  TEST(F32_GEMM_MINMAX_4X8S4__NEONFMA, k_div_4_subtile) {
+    TEST_REQUIRES_ARM_NEON_FMA;
+    for (size_t k = 8; k <= 40; k += 4) {
+      for (uint32_t n = 1; n <= 8; n++) {
+        for (uint32_t m = 1; m <= 4; m++) {
+          GemmMicrokernelTester()
+            .mr(4)
+            .nr(8)
+            .kr(1)
+            .sr(4)
+            .m(m)
+            .n(n)
+            .k(k)
+            .iterations(1)
+            .Test(xnn_f32_gemm_minmax_ukernel_4x8s4__neonfma, xnn_init_f32_minmax_scalar_params);
+        }
+      }
+    }
+  }
+
+  TEST(F32_GEMM_MINMAX_4X8S4__NEONFMA, n_gt_8) {
+    TEST_REQUIRES_ARM_NEON_FMA;
+    for (uint32_t n = 9; n < 16; n++) {
+      for (size_t k = 1; k <= 20; k += 5) {
+        GemmMicrokernelTester()
+          .mr(4)
+          .nr(8)
+          .kr(1)
+          .sr(4)
+          .m(4)
+          .n(n)
+          .k(k)
+          .Test(xnn_f32_gemm_minmax_ukernel_4x8s4__neonfma, xnn_init_f32_minmax_scalar_params);
+      }
+    }
+  }
+
+  TEST(F32_GEMM_MINMAX_4X8S4__NEONFMA, n_gt_8_strided_cn) {
+    TEST_REQUIRES_ARM_NEON_FMA;
+    for (uint32_t n = 9; n < 16; n++) {
+      for (size_t k = 1; k <= 20; k += 5) {
+        GemmMicrokernelTester()
+          .mr(4)
+          .nr(8)
+          .kr(1)
+          .sr(4)
+          .m(4)
+          .n(n)
+          .k(k)
+          .cn_stride(11)
+          .Test(xnn_f32_gemm_minmax_ukernel_4x8s4__neonfma, xnn_init_f32_minmax_scalar_params);
+      }
+    }
+  }
+
+  TEST(F32_GEMM_MINMAX_4X8S4__NEONFMA, n_gt_8_strided_a) {
+    TEST_REQUIRES_ARM_NEON_FMA;
+    for (uint32_t n = 9; n < 16; n++) {
+      for (size_t k = 1; k <= 20; k += 5) {
+        GemmMicrokernelTester()
+          .mr(4)
+          .nr(8)
+          .kr(1)
+          .sr(4)
+          .m(4)
+          .n(n)
+          .k(k)
+          .a_stride(23)
+          .Test(xnn_f32_gemm_minmax_ukernel_4x8s4__neonfma, xnn_init_f32_minmax_scalar_params);
+      }
+    }
+  }
+
+  TEST(F32_GEMM_MINMAX_4X8S4__NEONFMA, n_gt_8_subtile) {
+    TEST_REQUIRES_ARM_NEON_FMA;
+    for (uint32_t n = 9; n < 16; n++) {
+      for (size_t k = 1; k <= 20; k += 5) {
+        for (uint32_t m = 1; m <= 4; m++) {
+          GemmMicrokernelTester()
+            .mr(4)
+            .nr(8)
+            .kr(1)
+            .sr(4)
+            .m(m)
+            .n(n)
+            .k(k)
+            .iterations(1)
+            .Test(xnn_f32_gemm_minmax_ukernel_4x8s4__neonfma, xnn_init_f32_minmax_scalar_params);
+        }
+      }
+    }
+  }
+
+  TEST(F32_GEMM_MINMAX_4X8S4__NEONFMA, n_div_8) {
+    TEST_REQUIRES_ARM_NEON_FMA;
+    for (uint32_t n = 16; n <= 24; n += 8) {
+      for (size_t k = 1; k <= 20; k += 5) {
+        GemmMicrokernelTester()
+          .mr(4)
+          .nr(8)
+          .kr(1)
+          .sr(4)
+          .m(4)
+          .n(n)
+          .k(k)
+          .Test(xnn_f32_gemm_minmax_ukernel_4x8s4__neonfma, xnn_init_f32_minmax_scalar_params);
+      }
+    }
+  }
+
+  TEST(F32_GEMM_MINMAX_4X8S4__NEONFMA, n_div_8_strided_cn) {
+    TEST_REQUIRES_ARM_NEON_FMA;
+    for (uint32_t n = 16; n <= 24; n += 8) {
+      for (size_t k = 1; k <= 20; k += 5) {
+        GemmMicrokernelTester()
+          .mr(4)
+          .nr(8)
+          .kr(1)
+          .sr(4)
+          .m(4)
+          .n(n)
+          .k(k)
+          .cn_stride(11)
+          .Test(xnn_f32_gemm_minmax_ukernel_4x8s4__neonfma, xnn_init_f32_minmax_scalar_params);
+      }
+    }
+  }
+
+  TEST(F32_GEMM_MINMAX_4X8S4__NEONFMA, n_div_8_strided_a) {
+    TEST_REQUIRES_ARM_NEON_FMA;
+    for (uint32_t n = 16; n <= 24; n += 8) {
+      for (size_t k = 1; k <= 20; k += 5) {
+        GemmMicrokernelTester()
+          .mr(4)
+          .nr(8)
+          .kr(1)
+          .sr(4)
+          .m(4)
+          .n(n)
+          .k(k)
+          .a_stride(23)
+          .Test(xnn_f32_gemm_minmax_ukernel_4x8s4__neonfma, xnn_init_f32_minmax_scalar_params);
+      }
+    }
+  }
+
+  TEST(F32_GEMM_MINMAX_4X8S4__NEONFMA, n_div_8_subtile) {
+    TEST_REQUIRES_ARM_NEON_FMA;
+    for (uint32_t n = 16; n <= 24; n += 8) {
+      for (size_t k = 1; k <= 20; k += 5) {
+        for (uint32_t m = 1; m <= 4; m++) {
+          GemmMicrokernelTester()
+            .mr(4)
+            .nr(8)
+            .kr(1)
+            .sr(4)
+            .m(m)
+            .n(n)
+            .k(k)
+            .iterations(1)
+            .Test(xnn_f32_gemm_minmax_ukernel_4x8s4__neonfma, xnn_init_f32_minmax_scalar_params);
+        }
+      }
+    }
+  }
+
+  TEST(F32_GEMM_MINMAX_4X8S4__NEONFMA, strided_cm_subtile) {
+    TEST_REQUIRES_ARM_NEON_FMA;
+    for (size_t k = 1; k <= 20; k += 5) {
+      for (uint32_t n = 1; n <= 8; n++) {
+        for (uint32_t m = 1; m <= 4; m++) {
+          GemmMicrokernelTester()
+            .mr(4)
+            .nr(8)
+            .kr(1)
+            .sr(4)
+            .m(m)
+            .n(n)
+            .k(k)
+            .cm_stride(11)
+            .iterations(1)
+            .Test(xnn_f32_gemm_minmax_ukernel_4x8s4__neonfma, xnn_init_f32_minmax_scalar_params);
+        }
+      }
+    }
+  }
+
+  TEST(F32_GEMM_MINMAX_4X8S4__NEONFMA, qmin) {
+    TEST_REQUIRES_ARM_NEON_FMA;
+    GemmMicrokernelTester()
+      .mr(4)
+      .nr(8)
+      .kr(1)
+      .sr(4)
+      .m(4)
+      .n(8)
+      .k(4)
+      .qmin(128)
+      .Test(xnn_f32_gemm_minmax_ukernel_4x8s4__neonfma, xnn_init_f32_minmax_scalar_params);
+  }
+
+  TEST(F32_GEMM_MINMAX_4X8S4__NEONFMA, qmax) {
+    TEST_REQUIRES_ARM_NEON_FMA;
+    GemmMicrokernelTester()
+      .mr(4)
+      .nr(8)
+      .kr(1)
+      .sr(4)
+      .m(4)
+      .n(8)
+      .k(4)
+      .qmax(128)
+      .Test(xnn_f32_gemm_minmax_ukernel_4x8s4__neonfma, xnn_init_f32_minmax_scalar_params);
+  }
+
+  TEST(F32_GEMM_MINMAX_4X8S4__NEONFMA, strided_cm) {
+    TEST_REQUIRES_ARM_NEON_FMA;
+    GemmMicrokernelTester()
+      .mr(4)
+      .nr(8)
+      .kr(1)
+      .sr(4)
+      .m(4)
+      .n(8)
+      .k(4)
+      .cm_stride(11)
+      .Test(xnn_f32_gemm_minmax_ukernel_4x8s4__neonfma, xnn_init_f32_minmax_scalar_params);
+  }
+#endif  // XNN_ARCH_ARM || XNN_ARCH_ARM64
+
+
+#if XNN_ARCH_ARM64
+  TEST(F32_GEMM_MINMAX_5X8__NEONFMA_LANE_LD64, k_eq_2) {
+    TEST_REQUIRES_ARM_NEON_FMA;
+    GemmMicrokernelTester()
+      .mr(5)
+      .nr(8)
+      .kr(1)
+      .sr(1)
+      .m(5)
+      .n(8)
+      .k(2)
+      .Test(xnn_f32_gemm_minmax_ukernel_5x8__neonfma_lane_ld64, xnn_init_f32_minmax_scalar_params);
+  }
+
+  TEST(F32_GEMM_MINMAX_5X8__NEONFMA_LANE_LD64, strided_cn) {
+    TEST_REQUIRES_ARM_NEON_FMA;
+    GemmMicrokernelTester()
+      .mr(5)
+      .nr(8)
+      .kr(1)
+      .sr(1)
+      .m(5)
+      .n(8)
+      .k(2)
+      .cn_stride(11)
+      .Test(xnn_f32_gemm_minmax_ukernel_5x8__neonfma_lane_ld64, xnn_init_f32_minmax_scalar_params);
+  }
+
+  TEST(F32_GEMM_MINMAX_5X8__NEONFMA_LANE_LD64, k_eq_2_strided_a) {
+    TEST_REQUIRES_ARM_NEON_FMA;
+    GemmMicrokernelTester()
+      .mr(5)
+      .nr(8)
+      .kr(1)
+      .sr(1)
+      .m(5)
+      .n(8)
+      .k(2)
+      .a_stride(5)
+      .Test(xnn_f32_gemm_minmax_ukernel_5x8__neonfma_lane_ld64, xnn_init_f32_minmax_scalar_params);
+  }
+
+  TEST(F32_GEMM_MINMAX_5X8__NEONFMA_LANE_LD64, k_eq_2_subtile) {
+    TEST_REQUIRES_ARM_NEON_FMA;
+    for (uint32_t n = 1; n <= 8; n++) {
+      for (uint32_t m = 1; m <= 5; m++) {
+        GemmMicrokernelTester()
+          .mr(5)
+          .nr(8)
+          .kr(1)
+          .sr(1)
+          .m(m)
+          .n(n)
+          .k(2)
+          .iterations(1)
+          .Test(xnn_f32_gemm_minmax_ukernel_5x8__neonfma_lane_ld64, xnn_init_f32_minmax_scalar_params);
+      }
+    }
+  }
+
+  TEST(F32_GEMM_MINMAX_5X8__NEONFMA_LANE_LD64, k_eq_2_subtile_m) {
+    TEST_REQUIRES_ARM_NEON_FMA;
+    for (uint32_t m = 1; m <= 5; m++) {
+      GemmMicrokernelTester()
+        .mr(5)
+        .nr(8)
+        .kr(1)
+        .sr(1)
+        .m(m)
+        .n(8)
+        .k(2)
+        .iterations(1)
+        .Test(xnn_f32_gemm_minmax_ukernel_5x8__neonfma_lane_ld64, xnn_init_f32_minmax_scalar_params);
+    }
+  }
+
+  TEST(F32_GEMM_MINMAX_5X8__NEONFMA_LANE_LD64, k_eq_2_subtile_n) {
+    TEST_REQUIRES_ARM_NEON_FMA;
+    for (uint32_t n = 1; n <= 8; n++) {
+      GemmMicrokernelTester()
+        .mr(5)
+        .nr(8)
+        .kr(1)
+        .sr(1)
+        .m(5)
+        .n(n)
+        .k(2)
+        .iterations(1)
+        .Test(xnn_f32_gemm_minmax_ukernel_5x8__neonfma_lane_ld64, xnn_init_f32_minmax_scalar_params);
+    }
+  }
+
+  TEST(F32_GEMM_MINMAX_5X8__NEONFMA_LANE_LD64, k_lt_2) {
+    TEST_REQUIRES_ARM_NEON_FMA;
+    for (size_t k = 1; k < 2; k++) {
+      GemmMicrokernelTester()
+        .mr(5)
+        .nr(8)
+        .kr(1)
+        .sr(1)
+        .m(5)
+        .n(8)
+        .k(k)
+        .Test(xnn_f32_gemm_minmax_ukernel_5x8__neonfma_lane_ld64, xnn_init_f32_minmax_scalar_params);
+    }
+  }
+
+  TEST(F32_GEMM_MINMAX_5X8__NEONFMA_LANE_LD64, k_lt_2_strided_a) {
+    TEST_REQUIRES_ARM_NEON_FMA;
+    for (size_t k = 1; k < 2; k++) {
+      GemmMicrokernelTester()
+        .mr(5)
+        .nr(8)
+        .kr(1)
+        .sr(1)
+        .m(5)
+        .n(8)
+        .k(k)
+        .a_stride(5)
+        .Test(xnn_f32_gemm_minmax_ukernel_5x8__neonfma_lane_ld64, xnn_init_f32_minmax_scalar_params);
+    }
+  }
+
+  TEST(F32_GEMM_MINMAX_5X8__NEONFMA_LANE_LD64, k_lt_2_subtile) {
+    TEST_REQUIRES_ARM_NEON_FMA;
+    for (size_t k = 1; k < 2; k++) {
+      for (uint32_t n = 1; n <= 8; n++) {
+        for (uint32_t m = 1; m <= 5; m++) {
+          GemmMicrokernelTester()
+            .mr(5)
+            .nr(8)
+            .kr(1)
+            .sr(1)
+            .m(m)
+            .n(n)
+            .k(k)
+            .iterations(1)
+            .Test(xnn_f32_gemm_minmax_ukernel_5x8__neonfma_lane_ld64, xnn_init_f32_minmax_scalar_params);
+        }
+      }
+    }
+  }
+
+  TEST(F32_GEMM_MINMAX_5X8__NEONFMA_LANE_LD64, k_gt_2) {
+    TEST_REQUIRES_ARM_NEON_FMA;
+    for (size_t k = 3; k < 4; k++) {
+      GemmMicrokernelTester()
+        .mr(5)
+        .nr(8)
+        .kr(1)
+        .sr(1)
+        .m(5)
+        .n(8)
+        .k(k)
+        .Test(xnn_f32_gemm_minmax_ukernel_5x8__neonfma_lane_ld64, xnn_init_f32_minmax_scalar_params);
+    }
+  }
+
+  TEST(F32_GEMM_MINMAX_5X8__NEONFMA_LANE_LD64, k_gt_2_strided_a) {
+    TEST_REQUIRES_ARM_NEON_FMA;
+    for (size_t k = 3; k < 4; k++) {
+      GemmMicrokernelTester()
+        .mr(5)
+        .nr(8)
+        .kr(1)
+        .sr(1)
+        .m(5)
+        .n(8)
+        .k(k)
+        .a_stride(7)
+        .Test(xnn_f32_gemm_minmax_ukernel_5x8__neonfma_lane_ld64, xnn_init_f32_minmax_scalar_params);
+    }
+  }
+
+  TEST(F32_GEMM_MINMAX_5X8__NEONFMA_LANE_LD64, k_gt_2_subtile) {
+    TEST_REQUIRES_ARM_NEON_FMA;
+    for (size_t k = 3; k < 4; k++) {
+      for (uint32_t n = 1; n <= 8; n++) {
+        for (uint32_t m = 1; m <= 5; m++) {
+          GemmMicrokernelTester()
+            .mr(5)
+            .nr(8)
+            .kr(1)
+            .sr(1)
+            .m(m)
+            .n(n)
+            .k(k)
+            .iterations(1)
+            .Test(xnn_f32_gemm_minmax_ukernel_5x8__neonfma_lane_ld64, xnn_init_f32_minmax_scalar_params);
+        }
+      }
+    }
+  }
+
+  TEST(F32_GEMM_MINMAX_5X8__NEONFMA_LANE_LD64, k_div_2) {
+    TEST_REQUIRES_ARM_NEON_FMA;
+    for (size_t k = 4; k <= 20; k += 2) {
+      GemmMicrokernelTester()
+        .mr(5)
+        .nr(8)
+        .kr(1)
+        .sr(1)
+        .m(5)
+        .n(8)
+        .k(k)
+        .Test(xnn_f32_gemm_minmax_ukernel_5x8__neonfma_lane_ld64, xnn_init_f32_minmax_scalar_params);
+    }
+  }
+
+  TEST(F32_GEMM_MINMAX_5X8__NEONFMA_LANE_LD64, k_div_2_strided_a) {
+    TEST_REQUIRES_ARM_NEON_FMA;
+    for (size_t k = 4; k <= 20; k += 2) {
+      GemmMicrokernelTester()
+        .mr(5)
+        .nr(8)
+        .kr(1)
+        .sr(1)
+        .m(5)
+        .n(8)
+        .k(k)
+        .a_stride(23)
+        .Test(xnn_f32_gemm_minmax_ukernel_5x8__neonfma_lane_ld64, xnn_init_f32_minmax_scalar_params);
+    }
+  }
+
+  TEST(F32_GEMM_MINMAX_5X8__NEONFMA_LANE_LD64, k_div_2_subtile) {
+    TEST_REQUIRES_ARM_NEON_FMA;
+    for (size_t k = 4; k <= 20; k += 2) {
+      for (uint32_t n = 1; n <= 8; n++) {
+        for (uint32_t m = 1; m <= 5; m++) {
+          GemmMicrokernelTester()
+            .mr(5)
+            .nr(8)
+            .kr(1)
+            .sr(1)
+            .m(m)
+            .n(n)
+            .k(k)
+            .iterations(1)
+            .Test(xnn_f32_gemm_minmax_ukernel_5x8__neonfma_lane_ld64, xnn_init_f32_minmax_scalar_params);
+        }
+      }
+    }
+  }
+
+  TEST(F32_GEMM_MINMAX_5X8__NEONFMA_LANE_LD64, n_gt_8) {
+    TEST_REQUIRES_ARM_NEON_FMA;
+    for (uint32_t n = 9; n < 16; n++) {
+      for (size_t k = 1; k <= 10; k += 3) {
+        GemmMicrokernelTester()
+          .mr(5)
+          .nr(8)
+          .kr(1)
+          .sr(1)
+          .m(5)
+          .n(n)
+          .k(k)
+          .Test(xnn_f32_gemm_minmax_ukernel_5x8__neonfma_lane_ld64, xnn_init_f32_minmax_scalar_params);
+      }
+    }
+  }
+
+  TEST(F32_GEMM_MINMAX_5X8__NEONFMA_LANE_LD64, n_gt_8_strided_cn) {
+    TEST_REQUIRES_ARM_NEON_FMA;
+    for (uint32_t n = 9; n < 16; n++) {
+      for (size_t k = 1; k <= 10; k += 3) {
+        GemmMicrokernelTester()
+          .mr(5)
+          .nr(8)
+          .kr(1)
+          .sr(1)
+          .m(5)
+          .n(n)
+          .k(k)
+          .cn_stride(11)
+          .Test(xnn_f32_gemm_minmax_ukernel_5x8__neonfma_lane_ld64, xnn_init_f32_minmax_scalar_params);
+      }
+    }
+  }
+
+  TEST(F32_GEMM_MINMAX_5X8__NEONFMA_LANE_LD64, n_gt_8_strided_a) {
+    TEST_REQUIRES_ARM_NEON_FMA;
+    for (uint32_t n = 9; n < 16; n++) {
+      for (size_t k = 1; k <= 10; k += 3) {
+        GemmMicrokernelTester()
+          .mr(5)
+          .nr(8)
+          .kr(1)
+          .sr(1)
+          .m(5)
+          .n(n)
+          .k(k)
+          .a_stride(13)
+          .Test(xnn_f32_gemm_minmax_ukernel_5x8__neonfma_lane_ld64, xnn_init_f32_minmax_scalar_params);
+      }
+    }
+  }
+
+  TEST(F32_GEMM_MINMAX_5X8__NEONFMA_LANE_LD64, n_gt_8_subtile) {
+    TEST_REQUIRES_ARM_NEON_FMA;
+    for (uint32_t n = 9; n < 16; n++) {
+      for (size_t k = 1; k <= 10; k += 3) {
+        for (uint32_t m = 1; m <= 5; m++) {
+          GemmMicrokernelTester()
+            .mr(5)
+            .nr(8)
+            .kr(1)
+            .sr(1)
+            .m(m)
+            .n(n)
+            .k(k)
+            .iterations(1)
+            .Test(xnn_f32_gemm_minmax_ukernel_5x8__neonfma_lane_ld64, xnn_init_f32_minmax_scalar_params);
+        }
+      }
+    }
+  }
+
+  TEST(F32_GEMM_MINMAX_5X8__NEONFMA_LANE_LD64, n_div_8) {
+    TEST_REQUIRES_ARM_NEON_FMA;
+    for (uint32_t n = 16; n <= 24; n += 8) {
+      for (size_t k = 1; k <= 10; k += 3) {
+        GemmMicrokernelTester()
+          .mr(5)
+          .nr(8)
+          .kr(1)
+          .sr(1)
+          .m(5)
+          .n(n)
+          .k(k)
+          .Test(xnn_f32_gemm_minmax_ukernel_5x8__neonfma_lane_ld64, xnn_init_f32_minmax_scalar_params);
+      }
+    }
+  }
+
+  TEST(F32_GEMM_MINMAX_5X8__NEONFMA_LANE_LD64, n_div_8_strided_cn) {
+    TEST_REQUIRES_ARM_NEON_FMA;
+    for (uint32_t n = 16; n <= 24; n += 8) {
+      for (size_t k = 1; k <= 10; k += 3) {
+        GemmMicrokernelTester()
+          .mr(5)
+          .nr(8)
+          .kr(1)
+          .sr(1)
+          .m(5)
+          .n(n)
+          .k(k)
+          .cn_stride(11)
+          .Test(xnn_f32_gemm_minmax_ukernel_5x8__neonfma_lane_ld64, xnn_init_f32_minmax_scalar_params);
+      }
+    }
+  }
+
+  TEST(F32_GEMM_MINMAX_5X8__NEONFMA_LANE_LD64, n_div_8_strided_a) {
+    TEST_REQUIRES_ARM_NEON_FMA;
+    for (uint32_t n = 16; n <= 24; n += 8) {
+      for (size_t k = 1; k <= 10; k += 3) {
+        GemmMicrokernelTester()
+          .mr(5)
+          .nr(8)
+          .kr(1)
+          .sr(1)
+          .m(5)
+          .n(n)
+          .k(k)
+          .a_stride(13)
+          .Test(xnn_f32_gemm_minmax_ukernel_5x8__neonfma_lane_ld64, xnn_init_f32_minmax_scalar_params);
+      }
+    }
+  }
+
+  TEST(F32_GEMM_MINMAX_5X8__NEONFMA_LANE_LD64, n_div_8_subtile) {
+    TEST_REQUIRES_ARM_NEON_FMA;
+    for (uint32_t n = 16; n <= 24; n += 8) {
+      for (size_t k = 1; k <= 10; k += 3) {
+        for (uint32_t m = 1; m <= 5; m++) {
+          GemmMicrokernelTester()
+            .mr(5)
+            .nr(8)
+            .kr(1)
+            .sr(1)
+            .m(m)
+            .n(n)
+            .k(k)
+            .iterations(1)
+            .Test(xnn_f32_gemm_minmax_ukernel_5x8__neonfma_lane_ld64, xnn_init_f32_minmax_scalar_params);
+        }
+      }
+    }
+  }
+
+  TEST(F32_GEMM_MINMAX_5X8__NEONFMA_LANE_LD64, strided_cm_subtile) {
+    TEST_REQUIRES_ARM_NEON_FMA;
+    for (size_t k = 1; k <= 10; k += 3) {
+      for (uint32_t n = 1; n <= 8; n++) {
+        for (uint32_t m = 1; m <= 5; m++) {
+          GemmMicrokernelTester()
+            .mr(5)
+            .nr(8)
+            .kr(1)
+            .sr(1)
+            .m(m)
+            .n(n)
+            .k(k)
+            .cm_stride(11)
+            .iterations(1)
+            .Test(xnn_f32_gemm_minmax_ukernel_5x8__neonfma_lane_ld64, xnn_init_f32_minmax_scalar_params);
+        }
+      }
+    }
+  }
+
+  TEST(F32_GEMM_MINMAX_5X8__NEONFMA_LANE_LD64, qmin) {
     TEST_REQUIRES_ARM_NEON_FMA;
     GemmMicrokernelTester()
       .mr(5)
@@ -11491,10 +12358,11 @@
       .m(5)
       .n(8)
       .k(2)
+      .qmin(128)
       .Test(xnn_f32_gemm_minmax_ukernel_5x8__neonfma_lane_ld64, xnn_init_f32_minmax_scalar_params);
   }
 
-  TEST(F32_GEMM_MINMAX_5X8__NEONFMA_LANE_LD64, strided_cn) {
+  TEST(F32_GEMM_MINMAX_5X8__NEONFMA_LANE_LD64, qmax) {
     TEST_REQUIRES_ARM_NEON_FMA;
     GemmMicrokernelTester()
       .mr(5)
@@ -11504,11 +12372,11 @@
       .m(5)
       .n(8)
       .k(2)
-      .cn_stride(11)
+      .qmax(128)
       .Test(xnn_f32_gemm_minmax_ukernel_5x8__neonfma_lane_ld64, xnn_init_f32_minmax_scalar_params);
   }
 
-  TEST(F32_GEMM_MINMAX_5X8__NEONFMA_LANE_LD64, k_eq_2_strided_a) {
+  TEST(F32_GEMM_MINMAX_5X8__NEONFMA_LANE_LD64, strided_cm) {
     TEST_REQUIRES_ARM_NEON_FMA;
     GemmMicrokernelTester()
       .mr(5)
@@ -11518,98 +12386,142 @@
       .m(5)
       .n(8)
       .k(2)
-      .a_stride(5)
+      .cm_stride(11)
       .Test(xnn_f32_gemm_minmax_ukernel_5x8__neonfma_lane_ld64, xnn_init_f32_minmax_scalar_params);
   }
+#endif  // XNN_ARCH_ARM64
 
-  TEST(F32_GEMM_MINMAX_5X8__NEONFMA_LANE_LD64, k_eq_2_subtile) {
-    TEST_REQUIRES_ARM_NEON_FMA;
+
+#if XNN_ARCH_ARM || XNN_ARCH_ARM64
+  TEST(F32_GEMM_MINMAX_6X8__NEON_DUP_LD128, k_eq_4) {
+    TEST_REQUIRES_ARM_NEON;
+    GemmMicrokernelTester()
+      .mr(6)
+      .nr(8)
+      .kr(1)
+      .sr(1)
+      .m(6)
+      .n(8)
+      .k(4)
+      .Test(xnn_f32_gemm_minmax_ukernel_6x8__neon_dup_ld128, xnn_init_f32_minmax_scalar_params);
+  }
+
+  TEST(F32_GEMM_MINMAX_6X8__NEON_DUP_LD128, strided_cn) {
+    TEST_REQUIRES_ARM_NEON;
+    GemmMicrokernelTester()
+      .mr(6)
+      .nr(8)
+      .kr(1)
+      .sr(1)
+      .m(6)
+      .n(8)
+      .k(4)
+      .cn_stride(11)
+      .Test(xnn_f32_gemm_minmax_ukernel_6x8__neon_dup_ld128, xnn_init_f32_minmax_scalar_params);
+  }
+
+  TEST(F32_GEMM_MINMAX_6X8__NEON_DUP_LD128, k_eq_4_strided_a) {
+    TEST_REQUIRES_ARM_NEON;
+    GemmMicrokernelTester()
+      .mr(6)
+      .nr(8)
+      .kr(1)
+      .sr(1)
+      .m(6)
+      .n(8)
+      .k(4)
+      .a_stride(7)
+      .Test(xnn_f32_gemm_minmax_ukernel_6x8__neon_dup_ld128, xnn_init_f32_minmax_scalar_params);
+  }
+
+  TEST(F32_GEMM_MINMAX_6X8__NEON_DUP_LD128, k_eq_4_subtile) {
+    TEST_REQUIRES_ARM_NEON;
     for (uint32_t n = 1; n <= 8; n++) {
-      for (uint32_t m = 1; m <= 5; m++) {
+      for (uint32_t m = 1; m <= 6; m++) {
         GemmMicrokernelTester()
-          .mr(5)
+          .mr(6)
           .nr(8)
           .kr(1)
           .sr(1)
           .m(m)
           .n(n)
-          .k(2)
+          .k(4)
           .iterations(1)
-          .Test(xnn_f32_gemm_minmax_ukernel_5x8__neonfma_lane_ld64, xnn_init_f32_minmax_scalar_params);
+          .Test(xnn_f32_gemm_minmax_ukernel_6x8__neon_dup_ld128, xnn_init_f32_minmax_scalar_params);
       }
     }
   }
 
-  TEST(F32_GEMM_MINMAX_5X8__NEONFMA_LANE_LD64, k_eq_2_subtile_m) {
-    TEST_REQUIRES_ARM_NEON_FMA;
-    for (uint32_t m = 1; m <= 5; m++) {
+  TEST(F32_GEMM_MINMAX_6X8__NEON_DUP_LD128, k_eq_4_subtile_m) {
+    TEST_REQUIRES_ARM_NEON;
+    for (uint32_t m = 1; m <= 6; m++) {
       GemmMicrokernelTester()
-        .mr(5)
+        .mr(6)
         .nr(8)
         .kr(1)
         .sr(1)
         .m(m)
         .n(8)
-        .k(2)
+        .k(4)
         .iterations(1)
-        .Test(xnn_f32_gemm_minmax_ukernel_5x8__neonfma_lane_ld64, xnn_init_f32_minmax_scalar_params);
+        .Test(xnn_f32_gemm_minmax_ukernel_6x8__neon_dup_ld128, xnn_init_f32_minmax_scalar_params);
     }
   }
 
-  TEST(F32_GEMM_MINMAX_5X8__NEONFMA_LANE_LD64, k_eq_2_subtile_n) {
-    TEST_REQUIRES_ARM_NEON_FMA;
+  TEST(F32_GEMM_MINMAX_6X8__NEON_DUP_LD128, k_eq_4_subtile_n) {
+    TEST_REQUIRES_ARM_NEON;
     for (uint32_t n = 1; n <= 8; n++) {
       GemmMicrokernelTester()
-        .mr(5)
+        .mr(6)
         .nr(8)
         .kr(1)
         .sr(1)
-        .m(5)
+        .m(6)
         .n(n)
-        .k(2)
+        .k(4)
         .iterations(1)
-        .Test(xnn_f32_gemm_minmax_ukernel_5x8__neonfma_lane_ld64, xnn_init_f32_minmax_scalar_params);
+        .Test(xnn_f32_gemm_minmax_ukernel_6x8__neon_dup_ld128, xnn_init_f32_minmax_scalar_params);
     }
   }
 
-  TEST(F32_GEMM_MINMAX_5X8__NEONFMA_LANE_LD64, k_lt_2) {
-    TEST_REQUIRES_ARM_NEON_FMA;
-    for (size_t k = 1; k < 2; k++) {
+  TEST(F32_GEMM_MINMAX_6X8__NEON_DUP_LD128, k_lt_4) {
+    TEST_REQUIRES_ARM_NEON;
+    for (size_t k = 1; k < 4; k++) {
       GemmMicrokernelTester()
-        .mr(5)
+        .mr(6)
         .nr(8)
         .kr(1)
         .sr(1)
-        .m(5)
+        .m(6)
         .n(8)
         .k(k)
-        .Test(xnn_f32_gemm_minmax_ukernel_5x8__neonfma_lane_ld64, xnn_init_f32_minmax_scalar_params);
+        .Test(xnn_f32_gemm_minmax_ukernel_6x8__neon_dup_ld128, xnn_init_f32_minmax_scalar_params);
     }
   }
 
-  TEST(F32_GEMM_MINMAX_5X8__NEONFMA_LANE_LD64, k_lt_2_strided_a) {
-    TEST_REQUIRES_ARM_NEON_FMA;
-    for (size_t k = 1; k < 2; k++) {
+  TEST(F32_GEMM_MINMAX_6X8__NEON_DUP_LD128, k_lt_4_strided_a) {
+    TEST_REQUIRES_ARM_NEON;
+    for (size_t k = 1; k < 4; k++) {
       GemmMicrokernelTester()
-        .mr(5)
+        .mr(6)
         .nr(8)
         .kr(1)
         .sr(1)
-        .m(5)
+        .m(6)
         .n(8)
         .k(k)
-        .a_stride(5)
-        .Test(xnn_f32_gemm_minmax_ukernel_5x8__neonfma_lane_ld64, xnn_init_f32_minmax_scalar_params);
+        .a_stride(7)
+        .Test(xnn_f32_gemm_minmax_ukernel_6x8__neon_dup_ld128, xnn_init_f32_minmax_scalar_params);
     }
   }
 
-  TEST(F32_GEMM_MINMAX_5X8__NEONFMA_LANE_LD64, k_lt_2_subtile) {
-    TEST_REQUIRES_ARM_NEON_FMA;
-    for (size_t k = 1; k < 2; k++) {
+  TEST(F32_GEMM_MINMAX_6X8__NEON_DUP_LD128, k_lt_4_subtile) {
+    TEST_REQUIRES_ARM_NEON;
+    for (size_t k = 1; k < 4; k++) {
       for (uint32_t n = 1; n <= 8; n++) {
-        for (uint32_t m = 1; m <= 5; m++) {
+        for (uint32_t m = 1; m <= 6; m++) {
           GemmMicrokernelTester()
-            .mr(5)
+            .mr(6)
             .nr(8)
             .kr(1)
             .sr(1)
@@ -11617,50 +12529,50 @@
             .n(n)
             .k(k)
             .iterations(1)
-            .Test(xnn_f32_gemm_minmax_ukernel_5x8__neonfma_lane_ld64, xnn_init_f32_minmax_scalar_params);
+            .Test(xnn_f32_gemm_minmax_ukernel_6x8__neon_dup_ld128, xnn_init_f32_minmax_scalar_params);
         }
       }
     }
   }
 
-  TEST(F32_GEMM_MINMAX_5X8__NEONFMA_LANE_LD64, k_gt_2) {
-    TEST_REQUIRES_ARM_NEON_FMA;
-    for (size_t k = 3; k < 4; k++) {
+  TEST(F32_GEMM_MINMAX_6X8__NEON_DUP_LD128, k_gt_4) {
+    TEST_REQUIRES_ARM_NEON;
+    for (size_t k = 5; k < 8; k++) {
       GemmMicrokernelTester()
-        .mr(5)
+        .mr(6)
         .nr(8)
         .kr(1)
         .sr(1)
-        .m(5)
+        .m(6)
         .n(8)
         .k(k)
-        .Test(xnn_f32_gemm_minmax_ukernel_5x8__neonfma_lane_ld64, xnn_init_f32_minmax_scalar_params);
+        .Test(xnn_f32_gemm_minmax_ukernel_6x8__neon_dup_ld128, xnn_init_f32_minmax_scalar_params);
     }
   }
 
-  TEST(F32_GEMM_MINMAX_5X8__NEONFMA_LANE_LD64, k_gt_2_strided_a) {
-    TEST_REQUIRES_ARM_NEON_FMA;
-    for (size_t k = 3; k < 4; k++) {
+  TEST(F32_GEMM_MINMAX_6X8__NEON_DUP_LD128, k_gt_4_strided_a) {
+    TEST_REQUIRES_ARM_NEON;
+    for (size_t k = 5; k < 8; k++) {
       GemmMicrokernelTester()
-        .mr(5)
+        .mr(6)
         .nr(8)
         .kr(1)
         .sr(1)
-        .m(5)
+        .m(6)
         .n(8)
         .k(k)
-        .a_stride(7)
-        .Test(xnn_f32_gemm_minmax_ukernel_5x8__neonfma_lane_ld64, xnn_init_f32_minmax_scalar_params);
+        .a_stride(11)
+        .Test(xnn_f32_gemm_minmax_ukernel_6x8__neon_dup_ld128, xnn_init_f32_minmax_scalar_params);
     }
   }
 
-  TEST(F32_GEMM_MINMAX_5X8__NEONFMA_LANE_LD64, k_gt_2_subtile) {
-    TEST_REQUIRES_ARM_NEON_FMA;
-    for (size_t k = 3; k < 4; k++) {
+  TEST(F32_GEMM_MINMAX_6X8__NEON_DUP_LD128, k_gt_4_subtile) {
+    TEST_REQUIRES_ARM_NEON;
+    for (size_t k = 5; k < 8; k++) {
       for (uint32_t n = 1; n <= 8; n++) {
-        for (uint32_t m = 1; m <= 5; m++) {
+        for (uint32_t m = 1; m <= 6; m++) {
           GemmMicrokernelTester()
-            .mr(5)
+            .mr(6)
             .nr(8)
             .kr(1)
             .sr(1)
@@ -11668,50 +12580,50 @@
             .n(n)
             .k(k)
             .iterations(1)
-            .Test(xnn_f32_gemm_minmax_ukernel_5x8__neonfma_lane_ld64, xnn_init_f32_minmax_scalar_params);
+            .Test(xnn_f32_gemm_minmax_ukernel_6x8__neon_dup_ld128, xnn_init_f32_minmax_scalar_params);
         }
       }
     }
   }
 
-  TEST(F32_GEMM_MINMAX_5X8__NEONFMA_LANE_LD64, k_div_2) {
-    TEST_REQUIRES_ARM_NEON_FMA;
-    for (size_t k = 4; k <= 20; k += 2) {
+  TEST(F32_GEMM_MINMAX_6X8__NEON_DUP_LD128, k_div_4) {
+    TEST_REQUIRES_ARM_NEON;
+    for (size_t k = 8; k <= 40; k += 4) {
       GemmMicrokernelTester()
-        .mr(5)
+        .mr(6)
         .nr(8)
         .kr(1)
         .sr(1)
-        .m(5)
+        .m(6)
         .n(8)
         .k(k)
-        .Test(xnn_f32_gemm_minmax_ukernel_5x8__neonfma_lane_ld64, xnn_init_f32_minmax_scalar_params);
+        .Test(xnn_f32_gemm_minmax_ukernel_6x8__neon_dup_ld128, xnn_init_f32_minmax_scalar_params);
     }
   }
 
-  TEST(F32_GEMM_MINMAX_5X8__NEONFMA_LANE_LD64, k_div_2_strided_a) {
-    TEST_REQUIRES_ARM_NEON_FMA;
-    for (size_t k = 4; k <= 20; k += 2) {
+  TEST(F32_GEMM_MINMAX_6X8__NEON_DUP_LD128, k_div_4_strided_a) {
+    TEST_REQUIRES_ARM_NEON;
+    for (size_t k = 8; k <= 40; k += 4) {
       GemmMicrokernelTester()
-        .mr(5)
+        .mr(6)
         .nr(8)
         .kr(1)
         .sr(1)
-        .m(5)
+        .m(6)
         .n(8)
         .k(k)
-        .a_stride(23)
-        .Test(xnn_f32_gemm_minmax_ukernel_5x8__neonfma_lane_ld64, xnn_init_f32_minmax_scalar_params);
+        .a_stride(43)
+        .Test(xnn_f32_gemm_minmax_ukernel_6x8__neon_dup_ld128, xnn_init_f32_minmax_scalar_params);
     }
   }
 
-  TEST(F32_GEMM_MINMAX_5X8__NEONFMA_LANE_LD64, k_div_2_subtile) {
-    TEST_REQUIRES_ARM_NEON_FMA;
-    for (size_t k = 4; k <= 20; k += 2) {
+  TEST(F32_GEMM_MINMAX_6X8__NEON_DUP_LD128, k_div_4_subtile) {
+    TEST_REQUIRES_ARM_NEON;
+    for (size_t k = 8; k <= 40; k += 4) {
       for (uint32_t n = 1; n <= 8; n++) {
-        for (uint32_t m = 1; m <= 5; m++) {
+        for (uint32_t m = 1; m <= 6; m++) {
           GemmMicrokernelTester()
-            .mr(5)
+            .mr(6)
             .nr(8)
             .kr(1)
             .sr(1)
@@ -11719,72 +12631,72 @@
             .n(n)
             .k(k)
             .iterations(1)
-            .Test(xnn_f32_gemm_minmax_ukernel_5x8__neonfma_lane_ld64, xnn_init_f32_minmax_scalar_params);
+            .Test(xnn_f32_gemm_minmax_ukernel_6x8__neon_dup_ld128, xnn_init_f32_minmax_scalar_params);
         }
       }
     }
   }
 
-  TEST(F32_GEMM_MINMAX_5X8__NEONFMA_LANE_LD64, n_gt_8) {
-    TEST_REQUIRES_ARM_NEON_FMA;
+  TEST(F32_GEMM_MINMAX_6X8__NEON_DUP_LD128, n_gt_8) {
+    TEST_REQUIRES_ARM_NEON;
     for (uint32_t n = 9; n < 16; n++) {
-      for (size_t k = 1; k <= 10; k += 3) {
+      for (size_t k = 1; k <= 20; k += 5) {
         GemmMicrokernelTester()
-          .mr(5)
+          .mr(6)
           .nr(8)
           .kr(1)
           .sr(1)
-          .m(5)
+          .m(6)
           .n(n)
           .k(k)
-          .Test(xnn_f32_gemm_minmax_ukernel_5x8__neonfma_lane_ld64, xnn_init_f32_minmax_scalar_params);
+          .Test(xnn_f32_gemm_minmax_ukernel_6x8__neon_dup_ld128, xnn_init_f32_minmax_scalar_params);
       }
     }
   }
 
-  TEST(F32_GEMM_MINMAX_5X8__NEONFMA_LANE_LD64, n_gt_8_strided_cn) {
-    TEST_REQUIRES_ARM_NEON_FMA;
+  TEST(F32_GEMM_MINMAX_6X8__NEON_DUP_LD128, n_gt_8_strided_cn) {
+    TEST_REQUIRES_ARM_NEON;
     for (uint32_t n = 9; n < 16; n++) {
-      for (size_t k = 1; k <= 10; k += 3) {
+      for (size_t k = 1; k <= 20; k += 5) {
         GemmMicrokernelTester()
-          .mr(5)
+          .mr(6)
           .nr(8)
           .kr(1)
           .sr(1)
-          .m(5)
+          .m(6)
           .n(n)
           .k(k)
           .cn_stride(11)
-          .Test(xnn_f32_gemm_minmax_ukernel_5x8__neonfma_lane_ld64, xnn_init_f32_minmax_scalar_params);
+          .Test(xnn_f32_gemm_minmax_ukernel_6x8__neon_dup_ld128, xnn_init_f32_minmax_scalar_params);
       }
     }
   }
 
-  TEST(F32_GEMM_MINMAX_5X8__NEONFMA_LANE_LD64, n_gt_8_strided_a) {
-    TEST_REQUIRES_ARM_NEON_FMA;
+  TEST(F32_GEMM_MINMAX_6X8__NEON_DUP_LD128, n_gt_8_strided_a) {
+    TEST_REQUIRES_ARM_NEON;
     for (uint32_t n = 9; n < 16; n++) {
-      for (size_t k = 1; k <= 10; k += 3) {
+      for (size_t k = 1; k <= 20; k += 5) {
         GemmMicrokernelTester()
-          .mr(5)
+          .mr(6)
           .nr(8)
           .kr(1)
           .sr(1)
-          .m(5)
+          .m(6)
           .n(n)
           .k(k)
-          .a_stride(13)
-          .Test(xnn_f32_gemm_minmax_ukernel_5x8__neonfma_lane_ld64, xnn_init_f32_minmax_scalar_params);
+          .a_stride(23)
+          .Test(xnn_f32_gemm_minmax_ukernel_6x8__neon_dup_ld128, xnn_init_f32_minmax_scalar_params);
       }
     }
   }
 
-  TEST(F32_GEMM_MINMAX_5X8__NEONFMA_LANE_LD64, n_gt_8_subtile) {
-    TEST_REQUIRES_ARM_NEON_FMA;
+  TEST(F32_GEMM_MINMAX_6X8__NEON_DUP_LD128, n_gt_8_subtile) {
+    TEST_REQUIRES_ARM_NEON;
     for (uint32_t n = 9; n < 16; n++) {
-      for (size_t k = 1; k <= 10; k += 3) {
-        for (uint32_t m = 1; m <= 5; m++) {
+      for (size_t k = 1; k <= 20; k += 5) {
+        for (uint32_t m = 1; m <= 6; m++) {
           GemmMicrokernelTester()
-            .mr(5)
+            .mr(6)
             .nr(8)
             .kr(1)
             .sr(1)
@@ -11792,72 +12704,72 @@
             .n(n)
             .k(k)
             .iterations(1)
-            .Test(xnn_f32_gemm_minmax_ukernel_5x8__neonfma_lane_ld64, xnn_init_f32_minmax_scalar_params);
+            .Test(xnn_f32_gemm_minmax_ukernel_6x8__neon_dup_ld128, xnn_init_f32_minmax_scalar_params);
         }
       }
     }
   }
 
-  TEST(F32_GEMM_MINMAX_5X8__NEONFMA_LANE_LD64, n_div_8) {
-    TEST_REQUIRES_ARM_NEON_FMA;
+  TEST(F32_GEMM_MINMAX_6X8__NEON_DUP_LD128, n_div_8) {
+    TEST_REQUIRES_ARM_NEON;
     for (uint32_t n = 16; n <= 24; n += 8) {
-      for (size_t k = 1; k <= 10; k += 3) {
+      for (size_t k = 1; k <= 20; k += 5) {
         GemmMicrokernelTester()
-          .mr(5)
+          .mr(6)
           .nr(8)
           .kr(1)
           .sr(1)
-          .m(5)
+          .m(6)
           .n(n)
           .k(k)
-          .Test(xnn_f32_gemm_minmax_ukernel_5x8__neonfma_lane_ld64, xnn_init_f32_minmax_scalar_params);
+          .Test(xnn_f32_gemm_minmax_ukernel_6x8__neon_dup_ld128, xnn_init_f32_minmax_scalar_params);
       }
     }
   }
 
-  TEST(F32_GEMM_MINMAX_5X8__NEONFMA_LANE_LD64, n_div_8_strided_cn) {
-    TEST_REQUIRES_ARM_NEON_FMA;
+  TEST(F32_GEMM_MINMAX_6X8__NEON_DUP_LD128, n_div_8_strided_cn) {
+    TEST_REQUIRES_ARM_NEON;
     for (uint32_t n = 16; n <= 24; n += 8) {
-      for (size_t k = 1; k <= 10; k += 3) {
+      for (size_t k = 1; k <= 20; k += 5) {
         GemmMicrokernelTester()
-          .mr(5)
+          .mr(6)
           .nr(8)
           .kr(1)
           .sr(1)
-          .m(5)
+          .m(6)
           .n(n)
           .k(k)
           .cn_stride(11)
-          .Test(xnn_f32_gemm_minmax_ukernel_5x8__neonfma_lane_ld64, xnn_init_f32_minmax_scalar_params);
+          .Test(xnn_f32_gemm_minmax_ukernel_6x8__neon_dup_ld128, xnn_init_f32_minmax_scalar_params);
       }
     }
   }
 
-  TEST(F32_GEMM_MINMAX_5X8__NEONFMA_LANE_LD64, n_div_8_strided_a) {
-    TEST_REQUIRES_ARM_NEON_FMA;
+  TEST(F32_GEMM_MINMAX_6X8__NEON_DUP_LD128, n_div_8_strided_a) {
+    TEST_REQUIRES_ARM_NEON;
     for (uint32_t n = 16; n <= 24; n += 8) {
-      for (size_t k = 1; k <= 10; k += 3) {
+      for (size_t k = 1; k <= 20; k += 5) {
         GemmMicrokernelTester()
-          .mr(5)
+          .mr(6)
           .nr(8)
           .kr(1)
           .sr(1)
-          .m(5)
+          .m(6)
           .n(n)
           .k(k)
-          .a_stride(13)
-          .Test(xnn_f32_gemm_minmax_ukernel_5x8__neonfma_lane_ld64, xnn_init_f32_minmax_scalar_params);
+          .a_stride(23)
+          .Test(xnn_f32_gemm_minmax_ukernel_6x8__neon_dup_ld128, xnn_init_f32_minmax_scalar_params);
       }
     }
   }
 
-  TEST(F32_GEMM_MINMAX_5X8__NEONFMA_LANE_LD64, n_div_8_subtile) {
-    TEST_REQUIRES_ARM_NEON_FMA;
+  TEST(F32_GEMM_MINMAX_6X8__NEON_DUP_LD128, n_div_8_subtile) {
+    TEST_REQUIRES_ARM_NEON;
     for (uint32_t n = 16; n <= 24; n += 8) {
-      for (size_t k = 1; k <= 10; k += 3) {
-        for (uint32_t m = 1; m <= 5; m++) {
+      for (size_t k = 1; k <= 20; k += 5) {
+        for (uint32_t m = 1; m <= 6; m++) {
           GemmMicrokernelTester()
-            .mr(5)
+            .mr(6)
             .nr(8)
             .kr(1)
             .sr(1)
@@ -11865,19 +12777,19 @@
             .n(n)
             .k(k)
             .iterations(1)
-            .Test(xnn_f32_gemm_minmax_ukernel_5x8__neonfma_lane_ld64, xnn_init_f32_minmax_scalar_params);
+            .Test(xnn_f32_gemm_minmax_ukernel_6x8__neon_dup_ld128, xnn_init_f32_minmax_scalar_params);
         }
       }
     }
   }
 
-  TEST(F32_GEMM_MINMAX_5X8__NEONFMA_LANE_LD64, strided_cm_subtile) {
-    TEST_REQUIRES_ARM_NEON_FMA;
-    for (size_t k = 1; k <= 10; k += 3) {
+  TEST(F32_GEMM_MINMAX_6X8__NEON_DUP_LD128, strided_cm_subtile) {
+    TEST_REQUIRES_ARM_NEON;
+    for (size_t k = 1; k <= 20; k += 5) {
       for (uint32_t n = 1; n <= 8; n++) {
-        for (uint32_t m = 1; m <= 5; m++) {
+        for (uint32_t m = 1; m <= 6; m++) {
           GemmMicrokernelTester()
-            .mr(5)
+            .mr(6)
             .nr(8)
             .kr(1)
             .sr(1)
@@ -11886,58 +12798,58 @@
             .k(k)
             .cm_stride(11)
             .iterations(1)
-            .Test(xnn_f32_gemm_minmax_ukernel_5x8__neonfma_lane_ld64, xnn_init_f32_minmax_scalar_params);
+            .Test(xnn_f32_gemm_minmax_ukernel_6x8__neon_dup_ld128, xnn_init_f32_minmax_scalar_params);
         }
       }
     }
   }
 
-  TEST(F32_GEMM_MINMAX_5X8__NEONFMA_LANE_LD64, qmin) {
-    TEST_REQUIRES_ARM_NEON_FMA;
+  TEST(F32_GEMM_MINMAX_6X8__NEON_DUP_LD128, qmin) {
+    TEST_REQUIRES_ARM_NEON;
     GemmMicrokernelTester()
-      .mr(5)
+      .mr(6)
       .nr(8)
       .kr(1)
       .sr(1)
-      .m(5)
+      .m(6)
       .n(8)
-      .k(2)
+      .k(4)
       .qmin(128)
-      .Test(xnn_f32_gemm_minmax_ukernel_5x8__neonfma_lane_ld64, xnn_init_f32_minmax_scalar_params);
+      .Test(xnn_f32_gemm_minmax_ukernel_6x8__neon_dup_ld128, xnn_init_f32_minmax_scalar_params);
   }
 
-  TEST(F32_GEMM_MINMAX_5X8__NEONFMA_LANE_LD64, qmax) {
-    TEST_REQUIRES_ARM_NEON_FMA;
+  TEST(F32_GEMM_MINMAX_6X8__NEON_DUP_LD128, qmax) {
+    TEST_REQUIRES_ARM_NEON;
     GemmMicrokernelTester()
-      .mr(5)
+      .mr(6)
       .nr(8)
       .kr(1)
       .sr(1)
-      .m(5)
+      .m(6)
       .n(8)
-      .k(2)
+      .k(4)
       .qmax(128)
-      .Test(xnn_f32_gemm_minmax_ukernel_5x8__neonfma_lane_ld64, xnn_init_f32_minmax_scalar_params);
+      .Test(xnn_f32_gemm_minmax_ukernel_6x8__neon_dup_ld128, xnn_init_f32_minmax_scalar_params);
   }
 
-  TEST(F32_GEMM_MINMAX_5X8__NEONFMA_LANE_LD64, strided_cm) {
-    TEST_REQUIRES_ARM_NEON_FMA;
+  TEST(F32_GEMM_MINMAX_6X8__NEON_DUP_LD128, strided_cm) {
+    TEST_REQUIRES_ARM_NEON;
     GemmMicrokernelTester()
-      .mr(5)
+      .mr(6)
       .nr(8)
       .kr(1)
       .sr(1)
-      .m(5)
+      .m(6)
       .n(8)
-      .k(2)
+      .k(4)
       .cm_stride(11)
-      .Test(xnn_f32_gemm_minmax_ukernel_5x8__neonfma_lane_ld64, xnn_init_f32_minmax_scalar_params);
+      .Test(xnn_f32_gemm_minmax_ukernel_6x8__neon_dup_ld128, xnn_init_f32_minmax_scalar_params);
   }
-#endif  // XNN_ARCH_ARM64
+#endif  // XNN_ARCH_ARM || XNN_ARCH_ARM64
 
 
 #if XNN_ARCH_ARM || XNN_ARCH_ARM64
-  TEST(F32_GEMM_MINMAX_6X8__NEON_DUP_LD128, k_eq_4) {
+  TEST(F32_GEMM_MINMAX_6X8__NEON_LANE_LD64, k_eq_2) {
     TEST_REQUIRES_ARM_NEON;
     GemmMicrokernelTester()
       .mr(6)
@@ -11946,11 +12858,11 @@
       .sr(1)
       .m(6)
       .n(8)
-      .k(4)
-      .Test(xnn_f32_gemm_minmax_ukernel_6x8__neon_dup_ld128, xnn_init_f32_minmax_scalar_params);
+      .k(2)
+      .Test(xnn_f32_gemm_minmax_ukernel_6x8__neon_lane_ld64, xnn_init_f32_minmax_scalar_params);
   }
 
-  TEST(F32_GEMM_MINMAX_6X8__NEON_DUP_LD128, strided_cn) {
+  TEST(F32_GEMM_MINMAX_6X8__NEON_LANE_LD64, strided_cn) {
     TEST_REQUIRES_ARM_NEON;
     GemmMicrokernelTester()
       .mr(6)
@@ -11959,12 +12871,12 @@
       .sr(1)
       .m(6)
       .n(8)
-      .k(4)
+      .k(2)
       .cn_stride(11)
-      .Test(xnn_f32_gemm_minmax_ukernel_6x8__neon_dup_ld128, xnn_init_f32_minmax_scalar_params);
+      .Test(xnn_f32_gemm_minmax_ukernel_6x8__neon_lane_ld64, xnn_init_f32_minmax_scalar_params);
   }
 
-  TEST(F32_GEMM_MINMAX_6X8__NEON_DUP_LD128, k_eq_4_strided_a) {
+  TEST(F32_GEMM_MINMAX_6X8__NEON_LANE_LD64, k_eq_2_strided_a) {
     TEST_REQUIRES_ARM_NEON;
     GemmMicrokernelTester()
       .mr(6)
@@ -11973,12 +12885,12 @@
       .sr(1)
       .m(6)
       .n(8)
-      .k(4)
-      .a_stride(7)
-      .Test(xnn_f32_gemm_minmax_ukernel_6x8__neon_dup_ld128, xnn_init_f32_minmax_scalar_params);
+      .k(2)
+      .a_stride(5)
+      .Test(xnn_f32_gemm_minmax_ukernel_6x8__neon_lane_ld64, xnn_init_f32_minmax_scalar_params);
   }
 
-  TEST(F32_GEMM_MINMAX_6X8__NEON_DUP_LD128, k_eq_4_subtile) {
+  TEST(F32_GEMM_MINMAX_6X8__NEON_LANE_LD64, k_eq_2_subtile) {
     TEST_REQUIRES_ARM_NEON;
     for (uint32_t n = 1; n <= 8; n++) {
       for (uint32_t m = 1; m <= 6; m++) {
@@ -11989,14 +12901,14 @@
           .sr(1)
           .m(m)
           .n(n)
-          .k(4)
+          .k(2)
           .iterations(1)
-          .Test(xnn_f32_gemm_minmax_ukernel_6x8__neon_dup_ld128, xnn_init_f32_minmax_scalar_params);
+          .Test(xnn_f32_gemm_minmax_ukernel_6x8__neon_lane_ld64, xnn_init_f32_minmax_scalar_params);
       }
     }
   }
 
-  TEST(F32_GEMM_MINMAX_6X8__NEON_DUP_LD128, k_eq_4_subtile_m) {
+  TEST(F32_GEMM_MINMAX_6X8__NEON_LANE_LD64, k_eq_2_subtile_m) {
     TEST_REQUIRES_ARM_NEON;
     for (uint32_t m = 1; m <= 6; m++) {
       GemmMicrokernelTester()
@@ -12006,13 +12918,13 @@
         .sr(1)
         .m(m)
         .n(8)
-        .k(4)
+        .k(2)
         .iterations(1)
-        .Test(xnn_f32_gemm_minmax_ukernel_6x8__neon_dup_ld128, xnn_init_f32_minmax_scalar_params);
+        .Test(xnn_f32_gemm_minmax_ukernel_6x8__neon_lane_ld64, xnn_init_f32_minmax_scalar_params);
     }
   }
 
-  TEST(F32_GEMM_MINMAX_6X8__NEON_DUP_LD128, k_eq_4_subtile_n) {
+  TEST(F32_GEMM_MINMAX_6X8__NEON_LANE_LD64, k_eq_2_subtile_n) {
     TEST_REQUIRES_ARM_NEON;
     for (uint32_t n = 1; n <= 8; n++) {
       GemmMicrokernelTester()
@@ -12022,15 +12934,15 @@
         .sr(1)
         .m(6)
         .n(n)
-        .k(4)
+        .k(2)
         .iterations(1)
-        .Test(xnn_f32_gemm_minmax_ukernel_6x8__neon_dup_ld128, xnn_init_f32_minmax_scalar_params);
+        .Test(xnn_f32_gemm_minmax_ukernel_6x8__neon_lane_ld64, xnn_init_f32_minmax_scalar_params);
     }
   }
 
-  TEST(F32_GEMM_MINMAX_6X8__NEON_DUP_LD128, k_lt_4) {
+  TEST(F32_GEMM_MINMAX_6X8__NEON_LANE_LD64, k_lt_2) {
     TEST_REQUIRES_ARM_NEON;
-    for (size_t k = 1; k < 4; k++) {
+    for (size_t k = 1; k < 2; k++) {
       GemmMicrokernelTester()
         .mr(6)
         .nr(8)
@@ -12039,13 +12951,13 @@
         .m(6)
         .n(8)
         .k(k)
-        .Test(xnn_f32_gemm_minmax_ukernel_6x8__neon_dup_ld128, xnn_init_f32_minmax_scalar_params);
+        .Test(xnn_f32_gemm_minmax_ukernel_6x8__neon_lane_ld64, xnn_init_f32_minmax_scalar_params);
     }
   }
 
-  TEST(F32_GEMM_MINMAX_6X8__NEON_DUP_LD128, k_lt_4_strided_a) {
+  TEST(F32_GEMM_MINMAX_6X8__NEON_LANE_LD64, k_lt_2_strided_a) {
     TEST_REQUIRES_ARM_NEON;
-    for (size_t k = 1; k < 4; k++) {
+    for (size_t k = 1; k < 2; k++) {
       GemmMicrokernelTester()
         .mr(6)
         .nr(8)
@@ -12054,14 +12966,14 @@
         .m(6)
         .n(8)
         .k(k)
-        .a_stride(7)
-        .Test(xnn_f32_gemm_minmax_ukernel_6x8__neon_dup_ld128, xnn_init_f32_minmax_scalar_params);
+        .a_stride(5)
+        .Test(xnn_f32_gemm_minmax_ukernel_6x8__neon_lane_ld64, xnn_init_f32_minmax_scalar_params);
     }
   }
 
-  TEST(F32_GEMM_MINMAX_6X8__NEON_DUP_LD128, k_lt_4_subtile) {
+  TEST(F32_GEMM_MINMAX_6X8__NEON_LANE_LD64, k_lt_2_subtile) {
     TEST_REQUIRES_ARM_NEON;
-    for (size_t k = 1; k < 4; k++) {
+    for (size_t k = 1; k < 2; k++) {
       for (uint32_t n = 1; n <= 8; n++) {
         for (uint32_t m = 1; m <= 6; m++) {
           GemmMicrokernelTester()
@@ -12073,15 +12985,15 @@
             .n(n)
             .k(k)
             .iterations(1)
-            .Test(xnn_f32_gemm_minmax_ukernel_6x8__neon_dup_ld128, xnn_init_f32_minmax_scalar_params);
+            .Test(xnn_f32_gemm_minmax_ukernel_6x8__neon_lane_ld64, xnn_init_f32_minmax_scalar_params);
         }
       }
     }
   }
 
-  TEST(F32_GEMM_MINMAX_6X8__NEON_DUP_LD128, k_gt_4) {
+  TEST(F32_GEMM_MINMAX_6X8__NEON_LANE_LD64, k_gt_2) {
     TEST_REQUIRES_ARM_NEON;
-    for (size_t k = 5; k < 8; k++) {
+    for (size_t k = 3; k < 4; k++) {
       GemmMicrokernelTester()
         .mr(6)
         .nr(8)
@@ -12090,13 +13002,13 @@
         .m(6)
         .n(8)
         .k(k)
-        .Test(xnn_f32_gemm_minmax_ukernel_6x8__neon_dup_ld128, xnn_init_f32_minmax_scalar_params);
+        .Test(xnn_f32_gemm_minmax_ukernel_6x8__neon_lane_ld64, xnn_init_f32_minmax_scalar_params);
     }
   }
 
-  TEST(F32_GEMM_MINMAX_6X8__NEON_DUP_LD128, k_gt_4_strided_a) {
+  TEST(F32_GEMM_MINMAX_6X8__NEON_LANE_LD64, k_gt_2_strided_a) {
     TEST_REQUIRES_ARM_NEON;
-    for (size_t k = 5; k < 8; k++) {
+    for (size_t k = 3; k < 4; k++) {
       GemmMicrokernelTester()
         .mr(6)
         .nr(8)
@@ -12105,14 +13017,14 @@
         .m(6)
         .n(8)
         .k(k)
-        .a_stride(11)
-        .Test(xnn_f32_gemm_minmax_ukernel_6x8__neon_dup_ld128, xnn_init_f32_minmax_scalar_params);
+        .a_stride(7)
+        .Test(xnn_f32_gemm_minmax_ukernel_6x8__neon_lane_ld64, xnn_init_f32_minmax_scalar_params);
     }
   }
 
-  TEST(F32_GEMM_MINMAX_6X8__NEON_DUP_LD128, k_gt_4_subtile) {
+  TEST(F32_GEMM_MINMAX_6X8__NEON_LANE_LD64, k_gt_2_subtile) {
     TEST_REQUIRES_ARM_NEON;
-    for (size_t k = 5; k < 8; k++) {
+    for (size_t k = 3; k < 4; k++) {
       for (uint32_t n = 1; n <= 8; n++) {
         for (uint32_t m = 1; m <= 6; m++) {
           GemmMicrokernelTester()
@@ -12124,15 +13036,15 @@
             .n(n)
             .k(k)
             .iterations(1)
-            .Test(xnn_f32_gemm_minmax_ukernel_6x8__neon_dup_ld128, xnn_init_f32_minmax_scalar_params);
+            .Test(xnn_f32_gemm_minmax_ukernel_6x8__neon_lane_ld64, xnn_init_f32_minmax_scalar_params);
         }
       }
     }
   }
 
-  TEST(F32_GEMM_MINMAX_6X8__NEON_DUP_LD128, k_div_4) {
+  TEST(F32_GEMM_MINMAX_6X8__NEON_LANE_LD64, k_div_2) {
     TEST_REQUIRES_ARM_NEON;
-    for (size_t k = 8; k <= 40; k += 4) {
+    for (size_t k = 4; k <= 20; k += 2) {
       GemmMicrokernelTester()
         .mr(6)
         .nr(8)
@@ -12141,13 +13053,13 @@
         .m(6)
         .n(8)
         .k(k)
-        .Test(xnn_f32_gemm_minmax_ukernel_6x8__neon_dup_ld128, xnn_init_f32_minmax_scalar_params);
+        .Test(xnn_f32_gemm_minmax_ukernel_6x8__neon_lane_ld64, xnn_init_f32_minmax_scalar_params);
     }
   }
 
-  TEST(F32_GEMM_MINMAX_6X8__NEON_DUP_LD128, k_div_4_strided_a) {
+  TEST(F32_GEMM_MINMAX_6X8__NEON_LANE_LD64, k_div_2_strided_a) {
     TEST_REQUIRES_ARM_NEON;
-    for (size_t k = 8; k <= 40; k += 4) {
+    for (size_t k = 4; k <= 20; k += 2) {
       GemmMicrokernelTester()
         .mr(6)
         .nr(8)
@@ -12156,14 +13068,14 @@
         .m(6)
         .n(8)
         .k(k)
-        .a_stride(43)
-        .Test(xnn_f32_gemm_minmax_ukernel_6x8__neon_dup_ld128, xnn_init_f32_minmax_scalar_params);
+        .a_stride(23)
+        .Test(xnn_f32_gemm_minmax_ukernel_6x8__neon_lane_ld64, xnn_init_f32_minmax_scalar_params);
     }
   }
 
-  TEST(F32_GEMM_MINMAX_6X8__NEON_DUP_LD128, k_div_4_subtile) {
+  TEST(F32_GEMM_MINMAX_6X8__NEON_LANE_LD64, k_div_2_subtile) {
     TEST_REQUIRES_ARM_NEON;
-    for (size_t k = 8; k <= 40; k += 4) {
+    for (size_t k = 4; k <= 20; k += 2) {
       for (uint32_t n = 1; n <= 8; n++) {
         for (uint32_t m = 1; m <= 6; m++) {
           GemmMicrokernelTester()
@@ -12175,16 +13087,16 @@
             .n(n)
             .k(k)
             .iterations(1)
-            .Test(xnn_f32_gemm_minmax_ukernel_6x8__neon_dup_ld128, xnn_init_f32_minmax_scalar_params);
+            .Test(xnn_f32_gemm_minmax_ukernel_6x8__neon_lane_ld64, xnn_init_f32_minmax_scalar_params);
         }
       }
     }
   }
 
-  TEST(F32_GEMM_MINMAX_6X8__NEON_DUP_LD128, n_gt_8) {
+  TEST(F32_GEMM_MINMAX_6X8__NEON_LANE_LD64, n_gt_8) {
     TEST_REQUIRES_ARM_NEON;
     for (uint32_t n = 9; n < 16; n++) {
-      for (size_t k = 1; k <= 20; k += 5) {
+      for (size_t k = 1; k <= 10; k += 3) {
         GemmMicrokernelTester()
           .mr(6)
           .nr(8)
@@ -12193,15 +13105,15 @@
           .m(6)
           .n(n)
           .k(k)
-          .Test(xnn_f32_gemm_minmax_ukernel_6x8__neon_dup_ld128, xnn_init_f32_minmax_scalar_params);
+          .Test(xnn_f32_gemm_minmax_ukernel_6x8__neon_lane_ld64, xnn_init_f32_minmax_scalar_params);
       }
     }
   }
 
-  TEST(F32_GEMM_MINMAX_6X8__NEON_DUP_LD128, n_gt_8_strided_cn) {
+  TEST(F32_GEMM_MINMAX_6X8__NEON_LANE_LD64, n_gt_8_strided_cn) {
     TEST_REQUIRES_ARM_NEON;
     for (uint32_t n = 9; n < 16; n++) {
-      for (size_t k = 1; k <= 20; k += 5) {
+      for (size_t k = 1; k <= 10; k += 3) {
         GemmMicrokernelTester()
           .mr(6)
           .nr(8)
@@ -12211,15 +13123,15 @@
           .n(n)
           .k(k)
           .cn_stride(11)
-          .Test(xnn_f32_gemm_minmax_ukernel_6x8__neon_dup_ld128, xnn_init_f32_minmax_scalar_params);
+          .Test(xnn_f32_gemm_minmax_ukernel_6x8__neon_lane_ld64, xnn_init_f32_minmax_scalar_params);
       }
     }
   }
 
-  TEST(F32_GEMM_MINMAX_6X8__NEON_DUP_LD128, n_gt_8_strided_a) {
+  TEST(F32_GEMM_MINMAX_6X8__NEON_LANE_LD64, n_gt_8_strided_a) {
     TEST_REQUIRES_ARM_NEON;
     for (uint32_t n = 9; n < 16; n++) {
-      for (size_t k = 1; k <= 20; k += 5) {
+      for (size_t k = 1; k <= 10; k += 3) {
         GemmMicrokernelTester()
           .mr(6)
           .nr(8)
@@ -12228,16 +13140,16 @@
           .m(6)
           .n(n)
           .k(k)
-          .a_stride(23)
-          .Test(xnn_f32_gemm_minmax_ukernel_6x8__neon_dup_ld128, xnn_init_f32_minmax_scalar_params);
+          .a_stride(13)
+          .Test(xnn_f32_gemm_minmax_ukernel_6x8__neon_lane_ld64, xnn_init_f32_minmax_scalar_params);
       }
     }
   }
 
-  TEST(F32_GEMM_MINMAX_6X8__NEON_DUP_LD128, n_gt_8_subtile) {
+  TEST(F32_GEMM_MINMAX_6X8__NEON_LANE_LD64, n_gt_8_subtile) {
     TEST_REQUIRES_ARM_NEON;
     for (uint32_t n = 9; n < 16; n++) {
-      for (size_t k = 1; k <= 20; k += 5) {
+      for (size_t k = 1; k <= 10; k += 3) {
         for (uint32_t m = 1; m <= 6; m++) {
           GemmMicrokernelTester()
             .mr(6)
@@ -12248,16 +13160,16 @@
             .n(n)
             .k(k)
             .iterations(1)
-            .Test(xnn_f32_gemm_minmax_ukernel_6x8__neon_dup_ld128, xnn_init_f32_minmax_scalar_params);
+            .Test(xnn_f32_gemm_minmax_ukernel_6x8__neon_lane_ld64, xnn_init_f32_minmax_scalar_params);
         }
       }
     }
   }
 
-  TEST(F32_GEMM_MINMAX_6X8__NEON_DUP_LD128, n_div_8) {
+  TEST(F32_GEMM_MINMAX_6X8__NEON_LANE_LD64, n_div_8) {
     TEST_REQUIRES_ARM_NEON;
     for (uint32_t n = 16; n <= 24; n += 8) {
-      for (size_t k = 1; k <= 20; k += 5) {
+      for (size_t k = 1; k <= 10; k += 3) {
         GemmMicrokernelTester()
           .mr(6)
           .nr(8)
@@ -12266,15 +13178,15 @@
           .m(6)
           .n(n)
           .k(k)
-          .Test(xnn_f32_gemm_minmax_ukernel_6x8__neon_dup_ld128, xnn_init_f32_minmax_scalar_params);
+          .Test(xnn_f32_gemm_minmax_ukernel_6x8__neon_lane_ld64, xnn_init_f32_minmax_scalar_params);
       }
     }
   }
 
-  TEST(F32_GEMM_MINMAX_6X8__NEON_DUP_LD128, n_div_8_strided_cn) {
+  TEST(F32_GEMM_MINMAX_6X8__NEON_LANE_LD64, n_div_8_strided_cn) {
     TEST_REQUIRES_ARM_NEON;
     for (uint32_t n = 16; n <= 24; n += 8) {
-      for (size_t k = 1; k <= 20; k += 5) {
+      for (size_t k = 1; k <= 10; k += 3) {
         GemmMicrokernelTester()
           .mr(6)
           .nr(8)
@@ -12284,15 +13196,15 @@
           .n(n)
           .k(k)
           .cn_stride(11)
-          .Test(xnn_f32_gemm_minmax_ukernel_6x8__neon_dup_ld128, xnn_init_f32_minmax_scalar_params);
+          .Test(xnn_f32_gemm_minmax_ukernel_6x8__neon_lane_ld64, xnn_init_f32_minmax_scalar_params);
       }
     }
   }
 
-  TEST(F32_GEMM_MINMAX_6X8__NEON_DUP_LD128, n_div_8_strided_a) {
+  TEST(F32_GEMM_MINMAX_6X8__NEON_LANE_LD64, n_div_8_strided_a) {
     TEST_REQUIRES_ARM_NEON;
     for (uint32_t n = 16; n <= 24; n += 8) {
-      for (size_t k = 1; k <= 20; k += 5) {
+      for (size_t k = 1; k <= 10; k += 3) {
         GemmMicrokernelTester()
           .mr(6)
           .nr(8)
@@ -12301,16 +13213,16 @@
           .m(6)
           .n(n)
           .k(k)
-          .a_stride(23)
-          .Test(xnn_f32_gemm_minmax_ukernel_6x8__neon_dup_ld128, xnn_init_f32_minmax_scalar_params);
+          .a_stride(13)
+          .Test(xnn_f32_gemm_minmax_ukernel_6x8__neon_lane_ld64, xnn_init_f32_minmax_scalar_params);
       }
     }
   }
 
-  TEST(F32_GEMM_MINMAX_6X8__NEON_DUP_LD128, n_div_8_subtile) {
+  TEST(F32_GEMM_MINMAX_6X8__NEON_LANE_LD64, n_div_8_subtile) {
     TEST_REQUIRES_ARM_NEON;
     for (uint32_t n = 16; n <= 24; n += 8) {
-      for (size_t k = 1; k <= 20; k += 5) {
+      for (size_t k = 1; k <= 10; k += 3) {
         for (uint32_t m = 1; m <= 6; m++) {
           GemmMicrokernelTester()
             .mr(6)
@@ -12321,15 +13233,15 @@
             .n(n)
             .k(k)
             .iterations(1)
-            .Test(xnn_f32_gemm_minmax_ukernel_6x8__neon_dup_ld128, xnn_init_f32_minmax_scalar_params);
+            .Test(xnn_f32_gemm_minmax_ukernel_6x8__neon_lane_ld64, xnn_init_f32_minmax_scalar_params);
         }
       }
     }
   }
 
-  TEST(F32_GEMM_MINMAX_6X8__NEON_DUP_LD128, strided_cm_subtile) {
+  TEST(F32_GEMM_MINMAX_6X8__NEON_LANE_LD64, strided_cm_subtile) {
     TEST_REQUIRES_ARM_NEON;
-    for (size_t k = 1; k <= 20; k += 5) {
+    for (size_t k = 1; k <= 10; k += 3) {
       for (uint32_t n = 1; n <= 8; n++) {
         for (uint32_t m = 1; m <= 6; m++) {
           GemmMicrokernelTester()
@@ -12342,13 +13254,13 @@
             .k(k)
             .cm_stride(11)
             .iterations(1)
-            .Test(xnn_f32_gemm_minmax_ukernel_6x8__neon_dup_ld128, xnn_init_f32_minmax_scalar_params);
+            .Test(xnn_f32_gemm_minmax_ukernel_6x8__neon_lane_ld64, xnn_init_f32_minmax_scalar_params);
         }
       }
     }
   }
 
-  TEST(F32_GEMM_MINMAX_6X8__NEON_DUP_LD128, qmin) {
+  TEST(F32_GEMM_MINMAX_6X8__NEON_LANE_LD64, qmin) {
     TEST_REQUIRES_ARM_NEON;
     GemmMicrokernelTester()
       .mr(6)
@@ -12357,12 +13269,12 @@
       .sr(1)
       .m(6)
       .n(8)
-      .k(4)
+      .k(2)
       .qmin(128)
-      .Test(xnn_f32_gemm_minmax_ukernel_6x8__neon_dup_ld128, xnn_init_f32_minmax_scalar_params);
+      .Test(xnn_f32_gemm_minmax_ukernel_6x8__neon_lane_ld64, xnn_init_f32_minmax_scalar_params);
   }
 
-  TEST(F32_GEMM_MINMAX_6X8__NEON_DUP_LD128, qmax) {
+  TEST(F32_GEMM_MINMAX_6X8__NEON_LANE_LD64, qmax) {
     TEST_REQUIRES_ARM_NEON;
     GemmMicrokernelTester()
       .mr(6)
@@ -12371,12 +13283,12 @@
       .sr(1)
       .m(6)
       .n(8)
-      .k(4)
+      .k(2)
       .qmax(128)
-      .Test(xnn_f32_gemm_minmax_ukernel_6x8__neon_dup_ld128, xnn_init_f32_minmax_scalar_params);
+      .Test(xnn_f32_gemm_minmax_ukernel_6x8__neon_lane_ld64, xnn_init_f32_minmax_scalar_params);
   }
 
-  TEST(F32_GEMM_MINMAX_6X8__NEON_DUP_LD128, strided_cm) {
+  TEST(F32_GEMM_MINMAX_6X8__NEON_LANE_LD64, strided_cm) {
     TEST_REQUIRES_ARM_NEON;
     GemmMicrokernelTester()
       .mr(6)
@@ -12385,16 +13297,16 @@
       .sr(1)
       .m(6)
       .n(8)
-      .k(4)
+      .k(2)
       .cm_stride(11)
-      .Test(xnn_f32_gemm_minmax_ukernel_6x8__neon_dup_ld128, xnn_init_f32_minmax_scalar_params);
+      .Test(xnn_f32_gemm_minmax_ukernel_6x8__neon_lane_ld64, xnn_init_f32_minmax_scalar_params);
   }
 #endif  // XNN_ARCH_ARM || XNN_ARCH_ARM64
 
 
 #if XNN_ARCH_ARM || XNN_ARCH_ARM64
-  TEST(F32_GEMM_MINMAX_6X8__NEON_LANE_LD64, k_eq_2) {
-    TEST_REQUIRES_ARM_NEON;
+  TEST(F32_GEMM_MINMAX_6X8__NEONFMA_DUP_LD64, k_eq_2) {
+    TEST_REQUIRES_ARM_NEON_FMA;
     GemmMicrokernelTester()
       .mr(6)
       .nr(8)
@@ -12403,11 +13315,11 @@
       .m(6)
       .n(8)
       .k(2)
-      .Test(xnn_f32_gemm_minmax_ukernel_6x8__neon_lane_ld64, xnn_init_f32_minmax_scalar_params);
+      .Test(xnn_f32_gemm_minmax_ukernel_6x8__neonfma_dup_ld64, xnn_init_f32_minmax_scalar_params);
   }
 
-  TEST(F32_GEMM_MINMAX_6X8__NEON_LANE_LD64, strided_cn) {
-    TEST_REQUIRES_ARM_NEON;
+  TEST(F32_GEMM_MINMAX_6X8__NEONFMA_DUP_LD64, strided_cn) {
+    TEST_REQUIRES_ARM_NEON_FMA;
     GemmMicrokernelTester()
       .mr(6)
       .nr(8)
@@ -12417,11 +13329,11 @@
       .n(8)
       .k(2)
       .cn_stride(11)
-      .Test(xnn_f32_gemm_minmax_ukernel_6x8__neon_lane_ld64, xnn_init_f32_minmax_scalar_params);
+      .Test(xnn_f32_gemm_minmax_ukernel_6x8__neonfma_dup_ld64, xnn_init_f32_minmax_scalar_params);
   }
 
-  TEST(F32_GEMM_MINMAX_6X8__NEON_LANE_LD64, k_eq_2_strided_a) {
-    TEST_REQUIRES_ARM_NEON;
+  TEST(F32_GEMM_MINMAX_6X8__NEONFMA_DUP_LD64, k_eq_2_strided_a) {
+    TEST_REQUIRES_ARM_NEON_FMA;
     GemmMicrokernelTester()
       .mr(6)
       .nr(8)
@@ -12431,11 +13343,11 @@
       .n(8)
       .k(2)
       .a_stride(5)
-      .Test(xnn_f32_gemm_minmax_ukernel_6x8__neon_lane_ld64, xnn_init_f32_minmax_scalar_params);
+      .Test(xnn_f32_gemm_minmax_ukernel_6x8__neonfma_dup_ld64, xnn_init_f32_minmax_scalar_params);
   }
 
-  TEST(F32_GEMM_MINMAX_6X8__NEON_LANE_LD64, k_eq_2_subtile) {
-    TEST_REQUIRES_ARM_NEON;
+  TEST(F32_GEMM_MINMAX_6X8__NEONFMA_DUP_LD64, k_eq_2_subtile) {
+    TEST_REQUIRES_ARM_NEON_FMA;
     for (uint32_t n = 1; n <= 8; n++) {
       for (uint32_t m = 1; m <= 6; m++) {
         GemmMicrokernelTester()
@@ -12447,13 +13359,13 @@
           .n(n)
           .k(2)
           .iterations(1)
-          .Test(xnn_f32_gemm_minmax_ukernel_6x8__neon_lane_ld64, xnn_init_f32_minmax_scalar_params);
+          .Test(xnn_f32_gemm_minmax_ukernel_6x8__neonfma_dup_ld64, xnn_init_f32_minmax_scalar_params);
       }
     }
   }
 
-  TEST(F32_GEMM_MINMAX_6X8__NEON_LANE_LD64, k_eq_2_subtile_m) {
-    TEST_REQUIRES_ARM_NEON;
+  TEST(F32_GEMM_MINMAX_6X8__NEONFMA_DUP_LD64, k_eq_2_subtile_m) {
+    TEST_REQUIRES_ARM_NEON_FMA;
     for (uint32_t m = 1; m <= 6; m++) {
       GemmMicrokernelTester()
         .mr(6)
@@ -12464,12 +13376,12 @@
         .n(8)
         .k(2)
         .iterations(1)
-        .Test(xnn_f32_gemm_minmax_ukernel_6x8__neon_lane_ld64, xnn_init_f32_minmax_scalar_params);
+        .Test(xnn_f32_gemm_minmax_ukernel_6x8__neonfma_dup_ld64, xnn_init_f32_minmax_scalar_params);
     }
   }
 
-  TEST(F32_GEMM_MINMAX_6X8__NEON_LANE_LD64, k_eq_2_subtile_n) {
-    TEST_REQUIRES_ARM_NEON;
+  TEST(F32_GEMM_MINMAX_6X8__NEONFMA_DUP_LD64, k_eq_2_subtile_n) {
+    TEST_REQUIRES_ARM_NEON_FMA;
     for (uint32_t n = 1; n <= 8; n++) {
       GemmMicrokernelTester()
         .mr(6)
@@ -12480,12 +13392,12 @@
         .n(n)
         .k(2)
         .iterations(1)
-        .Test(xnn_f32_gemm_minmax_ukernel_6x8__neon_lane_ld64, xnn_init_f32_minmax_scalar_params);
+        .Test(xnn_f32_gemm_minmax_ukernel_6x8__neonfma_dup_ld64, xnn_init_f32_minmax_scalar_params);
     }
   }
 
-  TEST(F32_GEMM_MINMAX_6X8__NEON_LANE_LD64, k_lt_2) {
-    TEST_REQUIRES_ARM_NEON;
+  TEST(F32_GEMM_MINMAX_6X8__NEONFMA_DUP_LD64, k_lt_2) {
+    TEST_REQUIRES_ARM_NEON_FMA;
     for (size_t k = 1; k < 2; k++) {
       GemmMicrokernelTester()
         .mr(6)
@@ -12495,12 +13407,12 @@
         .m(6)
         .n(8)
         .k(k)
-        .Test(xnn_f32_gemm_minmax_ukernel_6x8__neon_lane_ld64, xnn_init_f32_minmax_scalar_params);
+        .Test(xnn_f32_gemm_minmax_ukernel_6x8__neonfma_dup_ld64, xnn_init_f32_minmax_scalar_params);
     }
   }
 
-  TEST(F32_GEMM_MINMAX_6X8__NEON_LANE_LD64, k_lt_2_strided_a) {
-    TEST_REQUIRES_ARM_NEON;
+  TEST(F32_GEMM_MINMAX_6X8__NEONFMA_DUP_LD64, k_lt_2_strided_a) {
+    TEST_REQUIRES_ARM_NEON_FMA;
     for (size_t k = 1; k < 2; k++) {
       GemmMicrokernelTester()
         .mr(6)
@@ -12511,12 +13423,12 @@
         .n(8)
         .k(k)
         .a_stride(5)
-        .Test(xnn_f32_gemm_minmax_ukernel_6x8__neon_lane_ld64, xnn_init_f32_minmax_scalar_params);
+        .Test(xnn_f32_gemm_minmax_ukernel_6x8__neonfma_dup_ld64, xnn_init_f32_minmax_scalar_params);
     }
   }
 
-  TEST(F32_GEMM_MINMAX_6X8__NEON_LANE_LD64, k_lt_2_subtile) {
-    TEST_REQUIRES_ARM_NEON;
+  TEST(F32_GEMM_MINMAX_6X8__NEONFMA_DUP_LD64, k_lt_2_subtile) {
+    TEST_REQUIRES_ARM_NEON_FMA;
     for (size_t k = 1; k < 2; k++) {
       for (uint32_t n = 1; n <= 8; n++) {
         for (uint32_t m = 1; m <= 6; m++) {
@@ -12529,14 +13441,14 @@
             .n(n)
             .k(k)
             .iterations(1)
-            .Test(xnn_f32_gemm_minmax_ukernel_6x8__neon_lane_ld64, xnn_init_f32_minmax_scalar_params);
+            .Test(xnn_f32_gemm_minmax_ukernel_6x8__neonfma_dup_ld64, xnn_init_f32_minmax_scalar_params);
         }
       }
     }
   }
 
-  TEST(F32_GEMM_MINMAX_6X8__NEON_LANE_LD64, k_gt_2) {
-    TEST_REQUIRES_ARM_NEON;
+  TEST(F32_GEMM_MINMAX_6X8__NEONFMA_DUP_LD64, k_gt_2) {
+    TEST_REQUIRES_ARM_NEON_FMA;
     for (size_t k = 3; k < 4; k++) {
       GemmMicrokernelTester()
         .mr(6)
@@ -12546,12 +13458,12 @@
         .m(6)
         .n(8)
         .k(k)
-        .Test(xnn_f32_gemm_minmax_ukernel_6x8__neon_lane_ld64, xnn_init_f32_minmax_scalar_params);
+        .Test(xnn_f32_gemm_minmax_ukernel_6x8__neonfma_dup_ld64, xnn_init_f32_minmax_scalar_params);
     }
   }
 
-  TEST(F32_GEMM_MINMAX_6X8__NEON_LANE_LD64, k_gt_2_strided_a) {
-    TEST_REQUIRES_ARM_NEON;
+  TEST(F32_GEMM_MINMAX_6X8__NEONFMA_DUP_LD64, k_gt_2_strided_a) {
+    TEST_REQUIRES_ARM_NEON_FMA;
     for (size_t k = 3; k < 4; k++) {
       GemmMicrokernelTester()
         .mr(6)
@@ -12562,12 +13474,12 @@
         .n(8)
         .k(k)
         .a_stride(7)
-        .Test(xnn_f32_gemm_minmax_ukernel_6x8__neon_lane_ld64, xnn_init_f32_minmax_scalar_params);
+        .Test(xnn_f32_gemm_minmax_ukernel_6x8__neonfma_dup_ld64, xnn_init_f32_minmax_scalar_params);
     }
   }
 
-  TEST(F32_GEMM_MINMAX_6X8__NEON_LANE_LD64, k_gt_2_subtile) {
-    TEST_REQUIRES_ARM_NEON;
+  TEST(F32_GEMM_MINMAX_6X8__NEONFMA_DUP_LD64, k_gt_2_subtile) {
+    TEST_REQUIRES_ARM_NEON_FMA;
     for (size_t k = 3; k < 4; k++) {
       for (uint32_t n = 1; n <= 8; n++) {
         for (uint32_t m = 1; m <= 6; m++) {
@@ -12580,14 +13492,14 @@
             .n(n)
             .k(k)
             .iterations(1)
-            .Test(xnn_f32_gemm_minmax_ukernel_6x8__neon_lane_ld64, xnn_init_f32_minmax_scalar_params);
+            .Test(xnn_f32_gemm_minmax_ukernel_6x8__neonfma_dup_ld64, xnn_init_f32_minmax_scalar_params);
         }
       }
     }
   }
 
-  TEST(F32_GEMM_MINMAX_6X8__NEON_LANE_LD64, k_div_2) {
-    TEST_REQUIRES_ARM_NEON;
+  TEST(F32_GEMM_MINMAX_6X8__NEONFMA_DUP_LD64, k_div_2) {
+    TEST_REQUIRES_ARM_NEON_FMA;
     for (size_t k = 4; k <= 20; k += 2) {
       GemmMicrokernelTester()
         .mr(6)
@@ -12597,12 +13509,12 @@
         .m(6)
         .n(8)
         .k(k)
-        .Test(xnn_f32_gemm_minmax_ukernel_6x8__neon_lane_ld64, xnn_init_f32_minmax_scalar_params);
+        .Test(xnn_f32_gemm_minmax_ukernel_6x8__neonfma_dup_ld64, xnn_init_f32_minmax_scalar_params);
     }
   }
 
-  TEST(F32_GEMM_MINMAX_6X8__NEON_LANE_LD64, k_div_2_strided_a) {
-    TEST_REQUIRES_ARM_NEON;
+  TEST(F32_GEMM_MINMAX_6X8__NEONFMA_DUP_LD64, k_div_2_strided_a) {
+    TEST_REQUIRES_ARM_NEON_FMA;
     for (size_t k = 4; k <= 20; k += 2) {
       GemmMicrokernelTester()
         .mr(6)
@@ -12613,12 +13525,12 @@
         .n(8)
         .k(k)
         .a_stride(23)
-        .Test(xnn_f32_gemm_minmax_ukernel_6x8__neon_lane_ld64, xnn_init_f32_minmax_scalar_params);
+        .Test(xnn_f32_gemm_minmax_ukernel_6x8__neonfma_dup_ld64, xnn_init_f32_minmax_scalar_params);
     }
   }
 
-  TEST(F32_GEMM_MINMAX_6X8__NEON_LANE_LD64, k_div_2_subtile) {
-    TEST_REQUIRES_ARM_NEON;
+  TEST(F32_GEMM_MINMAX_6X8__NEONFMA_DUP_LD64, k_div_2_subtile) {
+    TEST_REQUIRES_ARM_NEON_FMA;
     for (size_t k = 4; k <= 20; k += 2) {
       for (uint32_t n = 1; n <= 8; n++) {
         for (uint32_t m = 1; m <= 6; m++) {
@@ -12631,14 +13543,14 @@
             .n(n)
             .k(k)
             .iterations(1)
-            .Test(xnn_f32_gemm_minmax_ukernel_6x8__neon_lane_ld64, xnn_init_f32_minmax_scalar_params);
+            .Test(xnn_f32_gemm_minmax_ukernel_6x8__neonfma_dup_ld64, xnn_init_f32_minmax_scalar_params);
         }
       }
     }
   }
 
-  TEST(F32_GEMM_MINMAX_6X8__NEON_LANE_LD64, n_gt_8) {
-    TEST_REQUIRES_ARM_NEON;
+  TEST(F32_GEMM_MINMAX_6X8__NEONFMA_DUP_LD64, n_gt_8) {
+    TEST_REQUIRES_ARM_NEON_FMA;
     for (uint32_t n = 9; n < 16; n++) {
       for (size_t k = 1; k <= 10; k += 3) {
         GemmMicrokernelTester()
@@ -12649,13 +13561,13 @@
           .m(6)
           .n(n)
           .k(k)
-          .Test(xnn_f32_gemm_minmax_ukernel_6x8__neon_lane_ld64, xnn_init_f32_minmax_scalar_params);
+          .Test(xnn_f32_gemm_minmax_ukernel_6x8__neonfma_dup_ld64, xnn_init_f32_minmax_scalar_params);
       }
     }
   }
 
-  TEST(F32_GEMM_MINMAX_6X8__NEON_LANE_LD64, n_gt_8_strided_cn) {
-    TEST_REQUIRES_ARM_NEON;
+  TEST(F32_GEMM_MINMAX_6X8__NEONFMA_DUP_LD64, n_gt_8_strided_cn) {
+    TEST_REQUIRES_ARM_NEON_FMA;
     for (uint32_t n = 9; n < 16; n++) {
       for (size_t k = 1; k <= 10; k += 3) {
         GemmMicrokernelTester()
@@ -12667,13 +13579,13 @@
           .n(n)
           .k(k)
           .cn_stride(11)
-          .Test(xnn_f32_gemm_minmax_ukernel_6x8__neon_lane_ld64, xnn_init_f32_minmax_scalar_params);
+          .Test(xnn_f32_gemm_minmax_ukernel_6x8__neonfma_dup_ld64, xnn_init_f32_minmax_scalar_params);
       }
     }
   }
 
-  TEST(F32_GEMM_MINMAX_6X8__NEON_LANE_LD64, n_gt_8_strided_a) {
-    TEST_REQUIRES_ARM_NEON;
+  TEST(F32_GEMM_MINMAX_6X8__NEONFMA_DUP_LD64, n_gt_8_strided_a) {
+    TEST_REQUIRES_ARM_NEON_FMA;
     for (uint32_t n = 9; n < 16; n++) {
       for (size_t k = 1; k <= 10; k += 3) {
         GemmMicrokernelTester()
@@ -12685,13 +13597,13 @@
           .n(n)
           .k(k)
           .a_stride(13)
-          .Test(xnn_f32_gemm_minmax_ukernel_6x8__neon_lane_ld64, xnn_init_f32_minmax_scalar_params);
+          .Test(xnn_f32_gemm_minmax_ukernel_6x8__neonfma_dup_ld64, xnn_init_f32_minmax_scalar_params);
       }
     }
   }
 
-  TEST(F32_GEMM_MINMAX_6X8__NEON_LANE_LD64, n_gt_8_subtile) {
-    TEST_REQUIRES_ARM_NEON;
+  TEST(F32_GEMM_MINMAX_6X8__NEONFMA_DUP_LD64, n_gt_8_subtile) {
+    TEST_REQUIRES_ARM_NEON_FMA;
     for (uint32_t n = 9; n < 16; n++) {
       for (size_t k = 1; k <= 10; k += 3) {
         for (uint32_t m = 1; m <= 6; m++) {
@@ -12704,14 +13616,14 @@
             .n(n)
             .k(k)
             .iterations(1)
-            .Test(xnn_f32_gemm_minmax_ukernel_6x8__neon_lane_ld64, xnn_init_f32_minmax_scalar_params);
+            .Test(xnn_f32_gemm_minmax_ukernel_6x8__neonfma_dup_ld64, xnn_init_f32_minmax_scalar_params);
         }
       }
     }
   }
 
-  TEST(F32_GEMM_MINMAX_6X8__NEON_LANE_LD64, n_div_8) {
-    TEST_REQUIRES_ARM_NEON;
+  TEST(F32_GEMM_MINMAX_6X8__NEONFMA_DUP_LD64, n_div_8) {
+    TEST_REQUIRES_ARM_NEON_FMA;
     for (uint32_t n = 16; n <= 24; n += 8) {
       for (size_t k = 1; k <= 10; k += 3) {
         GemmMicrokernelTester()
@@ -12722,13 +13634,13 @@
           .m(6)
           .n(n)
           .k(k)
-          .Test(xnn_f32_gemm_minmax_ukernel_6x8__neon_lane_ld64, xnn_init_f32_minmax_scalar_params);
+          .Test(xnn_f32_gemm_minmax_ukernel_6x8__neonfma_dup_ld64, xnn_init_f32_minmax_scalar_params);
       }
     }
   }
 
-  TEST(F32_GEMM_MINMAX_6X8__NEON_LANE_LD64, n_div_8_strided_cn) {
-    TEST_REQUIRES_ARM_NEON;
+  TEST(F32_GEMM_MINMAX_6X8__NEONFMA_DUP_LD64, n_div_8_strided_cn) {
+    TEST_REQUIRES_ARM_NEON_FMA;
     for (uint32_t n = 16; n <= 24; n += 8) {
       for (size_t k = 1; k <= 10; k += 3) {
         GemmMicrokernelTester()
@@ -12740,13 +13652,13 @@
           .n(n)
           .k(k)
           .cn_stride(11)
-          .Test(xnn_f32_gemm_minmax_ukernel_6x8__neon_lane_ld64, xnn_init_f32_minmax_scalar_params);
+          .Test(xnn_f32_gemm_minmax_ukernel_6x8__neonfma_dup_ld64, xnn_init_f32_minmax_scalar_params);
       }
     }
   }
 
-  TEST(F32_GEMM_MINMAX_6X8__NEON_LANE_LD64, n_div_8_strided_a) {
-    TEST_REQUIRES_ARM_NEON;
+  TEST(F32_GEMM_MINMAX_6X8__NEONFMA_DUP_LD64, n_div_8_strided_a) {
+    TEST_REQUIRES_ARM_NEON_FMA;
     for (uint32_t n = 16; n <= 24; n += 8) {
       for (size_t k = 1; k <= 10; k += 3) {
         GemmMicrokernelTester()
@@ -12758,13 +13670,13 @@
           .n(n)
           .k(k)
           .a_stride(13)
-          .Test(xnn_f32_gemm_minmax_ukernel_6x8__neon_lane_ld64, xnn_init_f32_minmax_scalar_params);
+          .Test(xnn_f32_gemm_minmax_ukernel_6x8__neonfma_dup_ld64, xnn_init_f32_minmax_scalar_params);
       }
     }
   }
 
-  TEST(F32_GEMM_MINMAX_6X8__NEON_LANE_LD64, n_div_8_subtile) {
-    TEST_REQUIRES_ARM_NEON;
+  TEST(F32_GEMM_MINMAX_6X8__NEONFMA_DUP_LD64, n_div_8_subtile) {
+    TEST_REQUIRES_ARM_NEON_FMA;
     for (uint32_t n = 16; n <= 24; n += 8) {
       for (size_t k = 1; k <= 10; k += 3) {
         for (uint32_t m = 1; m <= 6; m++) {
@@ -12777,14 +13689,14 @@
             .n(n)
             .k(k)
             .iterations(1)
-            .Test(xnn_f32_gemm_minmax_ukernel_6x8__neon_lane_ld64, xnn_init_f32_minmax_scalar_params);
+            .Test(xnn_f32_gemm_minmax_ukernel_6x8__neonfma_dup_ld64, xnn_init_f32_minmax_scalar_params);
         }
       }
     }
   }
 
-  TEST(F32_GEMM_MINMAX_6X8__NEON_LANE_LD64, strided_cm_subtile) {
-    TEST_REQUIRES_ARM_NEON;
+  TEST(F32_GEMM_MINMAX_6X8__NEONFMA_DUP_LD64, strided_cm_subtile) {
+    TEST_REQUIRES_ARM_NEON_FMA;
     for (size_t k = 1; k <= 10; k += 3) {
       for (uint32_t n = 1; n <= 8; n++) {
         for (uint32_t m = 1; m <= 6; m++) {
@@ -12798,14 +13710,14 @@
             .k(k)
             .cm_stride(11)
             .iterations(1)
-            .Test(xnn_f32_gemm_minmax_ukernel_6x8__neon_lane_ld64, xnn_init_f32_minmax_scalar_params);
+            .Test(xnn_f32_gemm_minmax_ukernel_6x8__neonfma_dup_ld64, xnn_init_f32_minmax_scalar_params);
         }
       }
     }
   }
 
-  TEST(F32_GEMM_MINMAX_6X8__NEON_LANE_LD64, qmin) {
-    TEST_REQUIRES_ARM_NEON;
+  TEST(F32_GEMM_MINMAX_6X8__NEONFMA_DUP_LD64, qmin) {
+    TEST_REQUIRES_ARM_NEON_FMA;
     GemmMicrokernelTester()
       .mr(6)
       .nr(8)
@@ -12815,11 +13727,11 @@
       .n(8)
       .k(2)
       .qmin(128)
-      .Test(xnn_f32_gemm_minmax_ukernel_6x8__neon_lane_ld64, xnn_init_f32_minmax_scalar_params);
+      .Test(xnn_f32_gemm_minmax_ukernel_6x8__neonfma_dup_ld64, xnn_init_f32_minmax_scalar_params);
   }
 
-  TEST(F32_GEMM_MINMAX_6X8__NEON_LANE_LD64, qmax) {
-    TEST_REQUIRES_ARM_NEON;
+  TEST(F32_GEMM_MINMAX_6X8__NEONFMA_DUP_LD64, qmax) {
+    TEST_REQUIRES_ARM_NEON_FMA;
     GemmMicrokernelTester()
       .mr(6)
       .nr(8)
@@ -12829,11 +13741,11 @@
       .n(8)
       .k(2)
       .qmax(128)
-      .Test(xnn_f32_gemm_minmax_ukernel_6x8__neon_lane_ld64, xnn_init_f32_minmax_scalar_params);
+      .Test(xnn_f32_gemm_minmax_ukernel_6x8__neonfma_dup_ld64, xnn_init_f32_minmax_scalar_params);
   }
 
-  TEST(F32_GEMM_MINMAX_6X8__NEON_LANE_LD64, strided_cm) {
-    TEST_REQUIRES_ARM_NEON;
+  TEST(F32_GEMM_MINMAX_6X8__NEONFMA_DUP_LD64, strided_cm) {
+    TEST_REQUIRES_ARM_NEON_FMA;
     GemmMicrokernelTester()
       .mr(6)
       .nr(8)
@@ -12843,13 +13755,13 @@
       .n(8)
       .k(2)
       .cm_stride(11)
-      .Test(xnn_f32_gemm_minmax_ukernel_6x8__neon_lane_ld64, xnn_init_f32_minmax_scalar_params);
+      .Test(xnn_f32_gemm_minmax_ukernel_6x8__neonfma_dup_ld64, xnn_init_f32_minmax_scalar_params);
   }
 #endif  // XNN_ARCH_ARM || XNN_ARCH_ARM64
 
 
 #if XNN_ARCH_ARM || XNN_ARCH_ARM64
-  TEST(F32_GEMM_MINMAX_6X8__NEONFMA_DUP_LD64, k_eq_2) {
+  TEST(F32_GEMM_MINMAX_6X8__NEONFMA_DUP_LD128, k_eq_4) {
     TEST_REQUIRES_ARM_NEON_FMA;
     GemmMicrokernelTester()
       .mr(6)
@@ -12858,11 +13770,11 @@
       .sr(1)
       .m(6)
       .n(8)
-      .k(2)
-      .Test(xnn_f32_gemm_minmax_ukernel_6x8__neonfma_dup_ld64, xnn_init_f32_minmax_scalar_params);
+      .k(4)
+      .Test(xnn_f32_gemm_minmax_ukernel_6x8__neonfma_dup_ld128, xnn_init_f32_minmax_scalar_params);
   }
 
-  TEST(F32_GEMM_MINMAX_6X8__NEONFMA_DUP_LD64, strided_cn) {
+  TEST(F32_GEMM_MINMAX_6X8__NEONFMA_DUP_LD128, strided_cn) {
     TEST_REQUIRES_ARM_NEON_FMA;
     GemmMicrokernelTester()
       .mr(6)
@@ -12871,12 +13783,12 @@
       .sr(1)
       .m(6)
       .n(8)
-      .k(2)
+      .k(4)
       .cn_stride(11)
-      .Test(xnn_f32_gemm_minmax_ukernel_6x8__neonfma_dup_ld64, xnn_init_f32_minmax_scalar_params);
+      .Test(xnn_f32_gemm_minmax_ukernel_6x8__neonfma_dup_ld128, xnn_init_f32_minmax_scalar_params);
   }
 
-  TEST(F32_GEMM_MINMAX_6X8__NEONFMA_DUP_LD64, k_eq_2_strided_a) {
+  TEST(F32_GEMM_MINMAX_6X8__NEONFMA_DUP_LD128, k_eq_4_strided_a) {
     TEST_REQUIRES_ARM_NEON_FMA;
     GemmMicrokernelTester()
       .mr(6)
@@ -12885,12 +13797,12 @@
       .sr(1)
       .m(6)
       .n(8)
-      .k(2)
-      .a_stride(5)
-      .Test(xnn_f32_gemm_minmax_ukernel_6x8__neonfma_dup_ld64, xnn_init_f32_minmax_scalar_params);
+      .k(4)
+      .a_stride(7)
+      .Test(xnn_f32_gemm_minmax_ukernel_6x8__neonfma_dup_ld128, xnn_init_f32_minmax_scalar_params);
   }
 
-  TEST(F32_GEMM_MINMAX_6X8__NEONFMA_DUP_LD64, k_eq_2_subtile) {
+  TEST(F32_GEMM_MINMAX_6X8__NEONFMA_DUP_LD128, k_eq_4_subtile) {
     TEST_REQUIRES_ARM_NEON_FMA;
     for (uint32_t n = 1; n <= 8; n++) {
       for (uint32_t m = 1; m <= 6; m++) {
@@ -12901,14 +13813,14 @@
           .sr(1)
           .m(m)
           .n(n)
-          .k(2)
+          .k(4)
           .iterations(1)
-          .Test(xnn_f32_gemm_minmax_ukernel_6x8__neonfma_dup_ld64, xnn_init_f32_minmax_scalar_params);
+          .Test(xnn_f32_gemm_minmax_ukernel_6x8__neonfma_dup_ld128, xnn_init_f32_minmax_scalar_params);
       }
     }
   }
 
-  TEST(F32_GEMM_MINMAX_6X8__NEONFMA_DUP_LD64, k_eq_2_subtile_m) {
+  TEST(F32_GEMM_MINMAX_6X8__NEONFMA_DUP_LD128, k_eq_4_subtile_m) {
     TEST_REQUIRES_ARM_NEON_FMA;
     for (uint32_t m = 1; m <= 6; m++) {
       GemmMicrokernelTester()
@@ -12918,13 +13830,13 @@
         .sr(1)
         .m(m)
         .n(8)
-        .k(2)
+        .k(4)
         .iterations(1)
-        .Test(xnn_f32_gemm_minmax_ukernel_6x8__neonfma_dup_ld64, xnn_init_f32_minmax_scalar_params);
+        .Test(xnn_f32_gemm_minmax_ukernel_6x8__neonfma_dup_ld128, xnn_init_f32_minmax_scalar_params);
     }
   }
 
-  TEST(F32_GEMM_MINMAX_6X8__NEONFMA_DUP_LD64, k_eq_2_subtile_n) {
+  TEST(F32_GEMM_MINMAX_6X8__NEONFMA_DUP_LD128, k_eq_4_subtile_n) {
     TEST_REQUIRES_ARM_NEON_FMA;
     for (uint32_t n = 1; n <= 8; n++) {
       GemmMicrokernelTester()
@@ -12934,15 +13846,15 @@
         .sr(1)
         .m(6)
         .n(n)
-        .k(2)
+        .k(4)
         .iterations(1)
-        .Test(xnn_f32_gemm_minmax_ukernel_6x8__neonfma_dup_ld64, xnn_init_f32_minmax_scalar_params);
+        .Test(xnn_f32_gemm_minmax_ukernel_6x8__neonfma_dup_ld128, xnn_init_f32_minmax_scalar_params);
     }
   }
 
-  TEST(F32_GEMM_MINMAX_6X8__NEONFMA_DUP_LD64, k_lt_2) {
+  TEST(F32_GEMM_MINMAX_6X8__NEONFMA_DUP_LD128, k_lt_4) {
     TEST_REQUIRES_ARM_NEON_FMA;
-    for (size_t k = 1; k < 2; k++) {
+    for (size_t k = 1; k < 4; k++) {
       GemmMicrokernelTester()
         .mr(6)
         .nr(8)
@@ -12951,13 +13863,13 @@
         .m(6)
         .n(8)
         .k(k)
-        .Test(xnn_f32_gemm_minmax_ukernel_6x8__neonfma_dup_ld64, xnn_init_f32_minmax_scalar_params);
+        .Test(xnn_f32_gemm_minmax_ukernel_6x8__neonfma_dup_ld128, xnn_init_f32_minmax_scalar_params);
     }
   }
 
-  TEST(F32_GEMM_MINMAX_6X8__NEONFMA_DUP_LD64, k_lt_2_strided_a) {
+  TEST(F32_GEMM_MINMAX_6X8__NEONFMA_DUP_LD128, k_lt_4_strided_a) {
     TEST_REQUIRES_ARM_NEON_FMA;
-    for (size_t k = 1; k < 2; k++) {
+    for (size_t k = 1; k < 4; k++) {
       GemmMicrokernelTester()
         .mr(6)
         .nr(8)
@@ -12966,14 +13878,14 @@
         .m(6)
         .n(8)
         .k(k)
-        .a_stride(5)
-        .Test(xnn_f32_gemm_minmax_ukernel_6x8__neonfma_dup_ld64, xnn_init_f32_minmax_scalar_params);
+        .a_stride(7)
+        .Test(xnn_f32_gemm_minmax_ukernel_6x8__neonfma_dup_ld128, xnn_init_f32_minmax_scalar_params);
     }
   }
 
-  TEST(F32_GEMM_MINMAX_6X8__NEONFMA_DUP_LD64, k_lt_2_subtile) {
+  TEST(F32_GEMM_MINMAX_6X8__NEONFMA_DUP_LD128, k_lt_4_subtile) {
     TEST_REQUIRES_ARM_NEON_FMA;
-    for (size_t k = 1; k < 2; k++) {
+    for (size_t k = 1; k < 4; k++) {
       for (uint32_t n = 1; n <= 8; n++) {
         for (uint32_t m = 1; m <= 6; m++) {
           GemmMicrokernelTester()
@@ -12985,15 +13897,15 @@
             .n(n)
             .k(k)
             .iterations(1)
-            .Test(xnn_f32_gemm_minmax_ukernel_6x8__neonfma_dup_ld64, xnn_init_f32_minmax_scalar_params);
+            .Test(xnn_f32_gemm_minmax_ukernel_6x8__neonfma_dup_ld128, xnn_init_f32_minmax_scalar_params);
         }
       }
     }
   }
 
-  TEST(F32_GEMM_MINMAX_6X8__NEONFMA_DUP_LD64, k_gt_2) {
+  TEST(F32_GEMM_MINMAX_6X8__NEONFMA_DUP_LD128, k_gt_4) {
     TEST_REQUIRES_ARM_NEON_FMA;
-    for (size_t k = 3; k < 4; k++) {
+    for (size_t k = 5; k < 8; k++) {
       GemmMicrokernelTester()
         .mr(6)
         .nr(8)
@@ -13002,13 +13914,13 @@
         .m(6)
         .n(8)
         .k(k)
-        .Test(xnn_f32_gemm_minmax_ukernel_6x8__neonfma_dup_ld64, xnn_init_f32_minmax_scalar_params);
+        .Test(xnn_f32_gemm_minmax_ukernel_6x8__neonfma_dup_ld128, xnn_init_f32_minmax_scalar_params);
     }
   }
 
-  TEST(F32_GEMM_MINMAX_6X8__NEONFMA_DUP_LD64, k_gt_2_strided_a) {
+  TEST(F32_GEMM_MINMAX_6X8__NEONFMA_DUP_LD128, k_gt_4_strided_a) {
     TEST_REQUIRES_ARM_NEON_FMA;
-    for (size_t k = 3; k < 4; k++) {
+    for (size_t k = 5; k < 8; k++) {
       GemmMicrokernelTester()
         .mr(6)
         .nr(8)
@@ -13017,14 +13929,14 @@
         .m(6)
         .n(8)
         .k(k)
-        .a_stride(7)
-        .Test(xnn_f32_gemm_minmax_ukernel_6x8__neonfma_dup_ld64, xnn_init_f32_minmax_scalar_params);
+        .a_stride(11)
+        .Test(xnn_f32_gemm_minmax_ukernel_6x8__neonfma_dup_ld128, xnn_init_f32_minmax_scalar_params);
     }
   }
 
-  TEST(F32_GEMM_MINMAX_6X8__NEONFMA_DUP_LD64, k_gt_2_subtile) {
+  TEST(F32_GEMM_MINMAX_6X8__NEONFMA_DUP_LD128, k_gt_4_subtile) {
     TEST_REQUIRES_ARM_NEON_FMA;
-    for (size_t k = 3; k < 4; k++) {
+    for (size_t k = 5; k < 8; k++) {
       for (uint32_t n = 1; n <= 8; n++) {
         for (uint32_t m = 1; m <= 6; m++) {
           GemmMicrokernelTester()
@@ -13036,15 +13948,15 @@
             .n(n)
             .k(k)
             .iterations(1)
-            .Test(xnn_f32_gemm_minmax_ukernel_6x8__neonfma_dup_ld64, xnn_init_f32_minmax_scalar_params);
+            .Test(xnn_f32_gemm_minmax_ukernel_6x8__neonfma_dup_ld128, xnn_init_f32_minmax_scalar_params);
         }
       }
     }
   }
 
-  TEST(F32_GEMM_MINMAX_6X8__NEONFMA_DUP_LD64, k_div_2) {
+  TEST(F32_GEMM_MINMAX_6X8__NEONFMA_DUP_LD128, k_div_4) {
     TEST_REQUIRES_ARM_NEON_FMA;
-    for (size_t k = 4; k <= 20; k += 2) {
+    for (size_t k = 8; k <= 40; k += 4) {
       GemmMicrokernelTester()
         .mr(6)
         .nr(8)
@@ -13053,13 +13965,13 @@
         .m(6)
         .n(8)
         .k(k)
-        .Test(xnn_f32_gemm_minmax_ukernel_6x8__neonfma_dup_ld64, xnn_init_f32_minmax_scalar_params);
+        .Test(xnn_f32_gemm_minmax_ukernel_6x8__neonfma_dup_ld128, xnn_init_f32_minmax_scalar_params);
     }
   }
 
-  TEST(F32_GEMM_MINMAX_6X8__NEONFMA_DUP_LD64, k_div_2_strided_a) {
+  TEST(F32_GEMM_MINMAX_6X8__NEONFMA_DUP_LD128, k_div_4_strided_a) {
     TEST_REQUIRES_ARM_NEON_FMA;
-    for (size_t k = 4; k <= 20; k += 2) {
+    for (size_t k = 8; k <= 40; k += 4) {
       GemmMicrokernelTester()
         .mr(6)
         .nr(8)
@@ -13068,14 +13980,14 @@
         .m(6)
         .n(8)
         .k(k)
-        .a_stride(23)
-        .Test(xnn_f32_gemm_minmax_ukernel_6x8__neonfma_dup_ld64, xnn_init_f32_minmax_scalar_params);
+        .a_stride(43)
+        .Test(xnn_f32_gemm_minmax_ukernel_6x8__neonfma_dup_ld128, xnn_init_f32_minmax_scalar_params);
     }
   }
 
-  TEST(F32_GEMM_MINMAX_6X8__NEONFMA_DUP_LD64, k_div_2_subtile) {
+  TEST(F32_GEMM_MINMAX_6X8__NEONFMA_DUP_LD128, k_div_4_subtile) {
     TEST_REQUIRES_ARM_NEON_FMA;
-    for (size_t k = 4; k <= 20; k += 2) {
+    for (size_t k = 8; k <= 40; k += 4) {
       for (uint32_t n = 1; n <= 8; n++) {
         for (uint32_t m = 1; m <= 6; m++) {
           GemmMicrokernelTester()
@@ -13087,16 +13999,16 @@
             .n(n)
             .k(k)
             .iterations(1)
-            .Test(xnn_f32_gemm_minmax_ukernel_6x8__neonfma_dup_ld64, xnn_init_f32_minmax_scalar_params);
+            .Test(xnn_f32_gemm_minmax_ukernel_6x8__neonfma_dup_ld128, xnn_init_f32_minmax_scalar_params);
         }
       }
     }
   }
 
-  TEST(F32_GEMM_MINMAX_6X8__NEONFMA_DUP_LD64, n_gt_8) {
+  TEST(F32_GEMM_MINMAX_6X8__NEONFMA_DUP_LD128, n_gt_8) {
     TEST_REQUIRES_ARM_NEON_FMA;
     for (uint32_t n = 9; n < 16; n++) {
-      for (size_t k = 1; k <= 10; k += 3) {
+      for (size_t k = 1; k <= 20; k += 5) {
         GemmMicrokernelTester()
           .mr(6)
           .nr(8)
@@ -13105,15 +14017,15 @@
           .m(6)
           .n(n)
           .k(k)
-          .Test(xnn_f32_gemm_minmax_ukernel_6x8__neonfma_dup_ld64, xnn_init_f32_minmax_scalar_params);
+          .Test(xnn_f32_gemm_minmax_ukernel_6x8__neonfma_dup_ld128, xnn_init_f32_minmax_scalar_params);
       }
     }
   }
 
-  TEST(F32_GEMM_MINMAX_6X8__NEONFMA_DUP_LD64, n_gt_8_strided_cn) {
+  TEST(F32_GEMM_MINMAX_6X8__NEONFMA_DUP_LD128, n_gt_8_strided_cn) {
     TEST_REQUIRES_ARM_NEON_FMA;
     for (uint32_t n = 9; n < 16; n++) {
-      for (size_t k = 1; k <= 10; k += 3) {
+      for (size_t k = 1; k <= 20; k += 5) {
         GemmMicrokernelTester()
           .mr(6)
           .nr(8)
@@ -13123,15 +14035,15 @@
           .n(n)
           .k(k)
           .cn_stride(11)
-          .Test(xnn_f32_gemm_minmax_ukernel_6x8__neonfma_dup_ld64, xnn_init_f32_minmax_scalar_params);
+          .Test(xnn_f32_gemm_minmax_ukernel_6x8__neonfma_dup_ld128, xnn_init_f32_minmax_scalar_params);
       }
     }
   }
 
-  TEST(F32_GEMM_MINMAX_6X8__NEONFMA_DUP_LD64, n_gt_8_strided_a) {
+  TEST(F32_GEMM_MINMAX_6X8__NEONFMA_DUP_LD128, n_gt_8_strided_a) {
     TEST_REQUIRES_ARM_NEON_FMA;
     for (uint32_t n = 9; n < 16; n++) {
-      for (size_t k = 1; k <= 10; k += 3) {
+      for (size_t k = 1; k <= 20; k += 5) {
         GemmMicrokernelTester()
           .mr(6)
           .nr(8)
@@ -13140,16 +14052,16 @@
           .m(6)
           .n(n)
           .k(k)
-          .a_stride(13)
-          .Test(xnn_f32_gemm_minmax_ukernel_6x8__neonfma_dup_ld64, xnn_init_f32_minmax_scalar_params);
+          .a_stride(23)
+          .Test(xnn_f32_gemm_minmax_ukernel_6x8__neonfma_dup_ld128, xnn_init_f32_minmax_scalar_params);
       }
     }
   }
 
-  TEST(F32_GEMM_MINMAX_6X8__NEONFMA_DUP_LD64, n_gt_8_subtile) {
+  TEST(F32_GEMM_MINMAX_6X8__NEONFMA_DUP_LD128, n_gt_8_subtile) {
     TEST_REQUIRES_ARM_NEON_FMA;
     for (uint32_t n = 9; n < 16; n++) {
-      for (size_t k = 1; k <= 10; k += 3) {
+      for (size_t k = 1; k <= 20; k += 5) {
         for (uint32_t m = 1; m <= 6; m++) {
           GemmMicrokernelTester()
             .mr(6)
@@ -13160,16 +14072,16 @@
             .n(n)
             .k(k)
             .iterations(1)
-            .Test(xnn_f32_gemm_minmax_ukernel_6x8__neonfma_dup_ld64, xnn_init_f32_minmax_scalar_params);
+            .Test(xnn_f32_gemm_minmax_ukernel_6x8__neonfma_dup_ld128, xnn_init_f32_minmax_scalar_params);
         }
       }
     }
   }
 
-  TEST(F32_GEMM_MINMAX_6X8__NEONFMA_DUP_LD64, n_div_8) {
+  TEST(F32_GEMM_MINMAX_6X8__NEONFMA_DUP_LD128, n_div_8) {
     TEST_REQUIRES_ARM_NEON_FMA;
     for (uint32_t n = 16; n <= 24; n += 8) {
-      for (size_t k = 1; k <= 10; k += 3) {
+      for (size_t k = 1; k <= 20; k += 5) {
         GemmMicrokernelTester()
           .mr(6)
           .nr(8)
@@ -13178,15 +14090,15 @@
           .m(6)
           .n(n)
           .k(k)
-          .Test(xnn_f32_gemm_minmax_ukernel_6x8__neonfma_dup_ld64, xnn_init_f32_minmax_scalar_params);
+          .Test(xnn_f32_gemm_minmax_ukernel_6x8__neonfma_dup_ld128, xnn_init_f32_minmax_scalar_params);
       }
     }
   }
 
-  TEST(F32_GEMM_MINMAX_6X8__NEONFMA_DUP_LD64, n_div_8_strided_cn) {
+  TEST(F32_GEMM_MINMAX_6X8__NEONFMA_DUP_LD128, n_div_8_strided_cn) {
     TEST_REQUIRES_ARM_NEON_FMA;
     for (uint32_t n = 16; n <= 24; n += 8) {
-      for (size_t k = 1; k <= 10; k += 3) {
+      for (size_t k = 1; k <= 20; k += 5) {
         GemmMicrokernelTester()
           .mr(6)
           .nr(8)
@@ -13196,15 +14108,15 @@
           .n(n)
           .k(k)
           .cn_stride(11)
-          .Test(xnn_f32_gemm_minmax_ukernel_6x8__neonfma_dup_ld64, xnn_init_f32_minmax_scalar_params);
+          .Test(xnn_f32_gemm_minmax_ukernel_6x8__neonfma_dup_ld128, xnn_init_f32_minmax_scalar_params);
       }
     }
   }
 
-  TEST(F32_GEMM_MINMAX_6X8__NEONFMA_DUP_LD64, n_div_8_strided_a) {
+  TEST(F32_GEMM_MINMAX_6X8__NEONFMA_DUP_LD128, n_div_8_strided_a) {
     TEST_REQUIRES_ARM_NEON_FMA;
     for (uint32_t n = 16; n <= 24; n += 8) {
-      for (size_t k = 1; k <= 10; k += 3) {
+      for (size_t k = 1; k <= 20; k += 5) {
         GemmMicrokernelTester()
           .mr(6)
           .nr(8)
@@ -13213,16 +14125,16 @@
           .m(6)
           .n(n)
           .k(k)
-          .a_stride(13)
-          .Test(xnn_f32_gemm_minmax_ukernel_6x8__neonfma_dup_ld64, xnn_init_f32_minmax_scalar_params);
+          .a_stride(23)
+          .Test(xnn_f32_gemm_minmax_ukernel_6x8__neonfma_dup_ld128, xnn_init_f32_minmax_scalar_params);
       }
     }
   }
 
-  TEST(F32_GEMM_MINMAX_6X8__NEONFMA_DUP_LD64, n_div_8_subtile) {
+  TEST(F32_GEMM_MINMAX_6X8__NEONFMA_DUP_LD128, n_div_8_subtile) {
     TEST_REQUIRES_ARM_NEON_FMA;
     for (uint32_t n = 16; n <= 24; n += 8) {
-      for (size_t k = 1; k <= 10; k += 3) {
+      for (size_t k = 1; k <= 20; k += 5) {
         for (uint32_t m = 1; m <= 6; m++) {
           GemmMicrokernelTester()
             .mr(6)
@@ -13233,15 +14145,15 @@
             .n(n)
             .k(k)
             .iterations(1)
-            .Test(xnn_f32_gemm_minmax_ukernel_6x8__neonfma_dup_ld64, xnn_init_f32_minmax_scalar_params);
+            .Test(xnn_f32_gemm_minmax_ukernel_6x8__neonfma_dup_ld128, xnn_init_f32_minmax_scalar_params);
         }
       }
     }
   }
 
-  TEST(F32_GEMM_MINMAX_6X8__NEONFMA_DUP_LD64, strided_cm_subtile) {
+  TEST(F32_GEMM_MINMAX_6X8__NEONFMA_DUP_LD128, strided_cm_subtile) {
     TEST_REQUIRES_ARM_NEON_FMA;
-    for (size_t k = 1; k <= 10; k += 3) {
+    for (size_t k = 1; k <= 20; k += 5) {
       for (uint32_t n = 1; n <= 8; n++) {
         for (uint32_t m = 1; m <= 6; m++) {
           GemmMicrokernelTester()
@@ -13254,13 +14166,13 @@
             .k(k)
             .cm_stride(11)
             .iterations(1)
-            .Test(xnn_f32_gemm_minmax_ukernel_6x8__neonfma_dup_ld64, xnn_init_f32_minmax_scalar_params);
+            .Test(xnn_f32_gemm_minmax_ukernel_6x8__neonfma_dup_ld128, xnn_init_f32_minmax_scalar_params);
         }
       }
     }
   }
 
-  TEST(F32_GEMM_MINMAX_6X8__NEONFMA_DUP_LD64, qmin) {
+  TEST(F32_GEMM_MINMAX_6X8__NEONFMA_DUP_LD128, qmin) {
     TEST_REQUIRES_ARM_NEON_FMA;
     GemmMicrokernelTester()
       .mr(6)
@@ -13269,12 +14181,12 @@
       .sr(1)
       .m(6)
       .n(8)
-      .k(2)
+      .k(4)
       .qmin(128)
-      .Test(xnn_f32_gemm_minmax_ukernel_6x8__neonfma_dup_ld64, xnn_init_f32_minmax_scalar_params);
+      .Test(xnn_f32_gemm_minmax_ukernel_6x8__neonfma_dup_ld128, xnn_init_f32_minmax_scalar_params);
   }
 
-  TEST(F32_GEMM_MINMAX_6X8__NEONFMA_DUP_LD64, qmax) {
+  TEST(F32_GEMM_MINMAX_6X8__NEONFMA_DUP_LD128, qmax) {
     TEST_REQUIRES_ARM_NEON_FMA;
     GemmMicrokernelTester()
       .mr(6)
@@ -13283,12 +14195,12 @@
       .sr(1)
       .m(6)
       .n(8)
-      .k(2)
+      .k(4)
       .qmax(128)
-      .Test(xnn_f32_gemm_minmax_ukernel_6x8__neonfma_dup_ld64, xnn_init_f32_minmax_scalar_params);
+      .Test(xnn_f32_gemm_minmax_ukernel_6x8__neonfma_dup_ld128, xnn_init_f32_minmax_scalar_params);
   }
 
-  TEST(F32_GEMM_MINMAX_6X8__NEONFMA_DUP_LD64, strided_cm) {
+  TEST(F32_GEMM_MINMAX_6X8__NEONFMA_DUP_LD128, strided_cm) {
     TEST_REQUIRES_ARM_NEON_FMA;
     GemmMicrokernelTester()
       .mr(6)
@@ -13297,15 +14209,15 @@
       .sr(1)
       .m(6)
       .n(8)
-      .k(2)
+      .k(4)
       .cm_stride(11)
-      .Test(xnn_f32_gemm_minmax_ukernel_6x8__neonfma_dup_ld64, xnn_init_f32_minmax_scalar_params);
+      .Test(xnn_f32_gemm_minmax_ukernel_6x8__neonfma_dup_ld128, xnn_init_f32_minmax_scalar_params);
   }
 #endif  // XNN_ARCH_ARM || XNN_ARCH_ARM64
 
 
-#if XNN_ARCH_ARM || XNN_ARCH_ARM64
-  TEST(F32_GEMM_MINMAX_6X8__NEONFMA_DUP_LD128, k_eq_4) {
+#if XNN_ARCH_ARM64
+  TEST(F32_GEMM_MINMAX_6X8__NEONFMA_LANE_LD64, k_eq_2) {
     TEST_REQUIRES_ARM_NEON_FMA;
     GemmMicrokernelTester()
       .mr(6)
@@ -13314,11 +14226,11 @@
       .sr(1)
       .m(6)
       .n(8)
-      .k(4)
-      .Test(xnn_f32_gemm_minmax_ukernel_6x8__neonfma_dup_ld128, xnn_init_f32_minmax_scalar_params);
+      .k(2)
+      .Test(xnn_f32_gemm_minmax_ukernel_6x8__neonfma_lane_ld64, xnn_init_f32_minmax_scalar_params);
   }
 
-  TEST(F32_GEMM_MINMAX_6X8__NEONFMA_DUP_LD128, strided_cn) {
+  TEST(F32_GEMM_MINMAX_6X8__NEONFMA_LANE_LD64, strided_cn) {
     TEST_REQUIRES_ARM_NEON_FMA;
     GemmMicrokernelTester()
       .mr(6)
@@ -13327,12 +14239,12 @@
       .sr(1)
       .m(6)
       .n(8)
-      .k(4)
+      .k(2)
       .cn_stride(11)
-      .Test(xnn_f32_gemm_minmax_ukernel_6x8__neonfma_dup_ld128, xnn_init_f32_minmax_scalar_params);
+      .Test(xnn_f32_gemm_minmax_ukernel_6x8__neonfma_lane_ld64, xnn_init_f32_minmax_scalar_params);
   }
 
-  TEST(F32_GEMM_MINMAX_6X8__NEONFMA_DUP_LD128, k_eq_4_strided_a) {
+  TEST(F32_GEMM_MINMAX_6X8__NEONFMA_LANE_LD64, k_eq_2_strided_a) {
     TEST_REQUIRES_ARM_NEON_FMA;
     GemmMicrokernelTester()
       .mr(6)
@@ -13341,12 +14253,12 @@
       .sr(1)
       .m(6)
       .n(8)
-      .k(4)
-      .a_stride(7)
-      .Test(xnn_f32_gemm_minmax_ukernel_6x8__neonfma_dup_ld128, xnn_init_f32_minmax_scalar_params);
+      .k(2)
+      .a_stride(5)
+      .Test(xnn_f32_gemm_minmax_ukernel_6x8__neonfma_lane_ld64, xnn_init_f32_minmax_scalar_params);
   }
 
-  TEST(F32_GEMM_MINMAX_6X8__NEONFMA_DUP_LD128, k_eq_4_subtile) {
+  TEST(F32_GEMM_MINMAX_6X8__NEONFMA_LANE_LD64, k_eq_2_subtile) {
     TEST_REQUIRES_ARM_NEON_FMA;
     for (uint32_t n = 1; n <= 8; n++) {
       for (uint32_t m = 1; m <= 6; m++) {
@@ -13357,14 +14269,14 @@
           .sr(1)
           .m(m)
           .n(n)
-          .k(4)
+          .k(2)
           .iterations(1)
-          .Test(xnn_f32_gemm_minmax_ukernel_6x8__neonfma_dup_ld128, xnn_init_f32_minmax_scalar_params);
+          .Test(xnn_f32_gemm_minmax_ukernel_6x8__neonfma_lane_ld64, xnn_init_f32_minmax_scalar_params);
       }
     }
   }
 
-  TEST(F32_GEMM_MINMAX_6X8__NEONFMA_DUP_LD128, k_eq_4_subtile_m) {
+  TEST(F32_GEMM_MINMAX_6X8__NEONFMA_LANE_LD64, k_eq_2_subtile_m) {
     TEST_REQUIRES_ARM_NEON_FMA;
     for (uint32_t m = 1; m <= 6; m++) {
       GemmMicrokernelTester()
@@ -13374,13 +14286,13 @@
         .sr(1)
         .m(m)
         .n(8)
-        .k(4)
+        .k(2)
         .iterations(1)
-        .Test(xnn_f32_gemm_minmax_ukernel_6x8__neonfma_dup_ld128, xnn_init_f32_minmax_scalar_params);
+        .Test(xnn_f32_gemm_minmax_ukernel_6x8__neonfma_lane_ld64, xnn_init_f32_minmax_scalar_params);
     }
   }
 
-  TEST(F32_GEMM_MINMAX_6X8__NEONFMA_DUP_LD128, k_eq_4_subtile_n) {
+  TEST(F32_GEMM_MINMAX_6X8__NEONFMA_LANE_LD64, k_eq_2_subtile_n) {
     TEST_REQUIRES_ARM_NEON_FMA;
     for (uint32_t n = 1; n <= 8; n++) {
       GemmMicrokernelTester()
@@ -13390,15 +14302,15 @@
         .sr(1)
         .m(6)
         .n(n)
-        .k(4)
+        .k(2)
         .iterations(1)
-        .Test(xnn_f32_gemm_minmax_ukernel_6x8__neonfma_dup_ld128, xnn_init_f32_minmax_scalar_params);
+        .Test(xnn_f32_gemm_minmax_ukernel_6x8__neonfma_lane_ld64, xnn_init_f32_minmax_scalar_params);
     }
   }
 
-  TEST(F32_GEMM_MINMAX_6X8__NEONFMA_DUP_LD128, k_lt_4) {
+  TEST(F32_GEMM_MINMAX_6X8__NEONFMA_LANE_LD64, k_lt_2) {
     TEST_REQUIRES_ARM_NEON_FMA;
-    for (size_t k = 1; k < 4; k++) {
+    for (size_t k = 1; k < 2; k++) {
       GemmMicrokernelTester()
         .mr(6)
         .nr(8)
@@ -13407,13 +14319,13 @@
         .m(6)
         .n(8)
         .k(k)
-        .Test(xnn_f32_gemm_minmax_ukernel_6x8__neonfma_dup_ld128, xnn_init_f32_minmax_scalar_params);
+        .Test(xnn_f32_gemm_minmax_ukernel_6x8__neonfma_lane_ld64, xnn_init_f32_minmax_scalar_params);
     }
   }
 
-  TEST(F32_GEMM_MINMAX_6X8__NEONFMA_DUP_LD128, k_lt_4_strided_a) {
+  TEST(F32_GEMM_MINMAX_6X8__NEONFMA_LANE_LD64, k_lt_2_strided_a) {
     TEST_REQUIRES_ARM_NEON_FMA;
-    for (size_t k = 1; k < 4; k++) {
+    for (size_t k = 1; k < 2; k++) {
       GemmMicrokernelTester()
         .mr(6)
         .nr(8)
@@ -13422,14 +14334,14 @@
         .m(6)
         .n(8)
         .k(k)
-        .a_stride(7)
-        .Test(xnn_f32_gemm_minmax_ukernel_6x8__neonfma_dup_ld128, xnn_init_f32_minmax_scalar_params);
+        .a_stride(5)
+        .Test(xnn_f32_gemm_minmax_ukernel_6x8__neonfma_lane_ld64, xnn_init_f32_minmax_scalar_params);
     }
   }
 
-  TEST(F32_GEMM_MINMAX_6X8__NEONFMA_DUP_LD128, k_lt_4_subtile) {
+  TEST(F32_GEMM_MINMAX_6X8__NEONFMA_LANE_LD64, k_lt_2_subtile) {
     TEST_REQUIRES_ARM_NEON_FMA;
-    for (size_t k = 1; k < 4; k++) {
+    for (size_t k = 1; k < 2; k++) {
       for (uint32_t n = 1; n <= 8; n++) {
         for (uint32_t m = 1; m <= 6; m++) {
           GemmMicrokernelTester()
@@ -13441,15 +14353,15 @@
             .n(n)
             .k(k)
             .iterations(1)
-            .Test(xnn_f32_gemm_minmax_ukernel_6x8__neonfma_dup_ld128, xnn_init_f32_minmax_scalar_params);
+            .Test(xnn_f32_gemm_minmax_ukernel_6x8__neonfma_lane_ld64, xnn_init_f32_minmax_scalar_params);
         }
       }
     }
   }
 
-  TEST(F32_GEMM_MINMAX_6X8__NEONFMA_DUP_LD128, k_gt_4) {
+  TEST(F32_GEMM_MINMAX_6X8__NEONFMA_LANE_LD64, k_gt_2) {
     TEST_REQUIRES_ARM_NEON_FMA;
-    for (size_t k = 5; k < 8; k++) {
+    for (size_t k = 3; k < 4; k++) {
       GemmMicrokernelTester()
         .mr(6)
         .nr(8)
@@ -13458,13 +14370,13 @@
         .m(6)
         .n(8)
         .k(k)
-        .Test(xnn_f32_gemm_minmax_ukernel_6x8__neonfma_dup_ld128, xnn_init_f32_minmax_scalar_params);
+        .Test(xnn_f32_gemm_minmax_ukernel_6x8__neonfma_lane_ld64, xnn_init_f32_minmax_scalar_params);
     }
   }
 
-  TEST(F32_GEMM_MINMAX_6X8__NEONFMA_DUP_LD128, k_gt_4_strided_a) {
+  TEST(F32_GEMM_MINMAX_6X8__NEONFMA_LANE_LD64, k_gt_2_strided_a) {
     TEST_REQUIRES_ARM_NEON_FMA;
-    for (size_t k = 5; k < 8; k++) {
+    for (size_t k = 3; k < 4; k++) {
       GemmMicrokernelTester()
         .mr(6)
         .nr(8)
@@ -13473,14 +14385,14 @@
         .m(6)
         .n(8)
         .k(k)
-        .a_stride(11)
-        .Test(xnn_f32_gemm_minmax_ukernel_6x8__neonfma_dup_ld128, xnn_init_f32_minmax_scalar_params);
+        .a_stride(7)
+        .Test(xnn_f32_gemm_minmax_ukernel_6x8__neonfma_lane_ld64, xnn_init_f32_minmax_scalar_params);
     }
   }
 
-  TEST(F32_GEMM_MINMAX_6X8__NEONFMA_DUP_LD128, k_gt_4_subtile) {
+  TEST(F32_GEMM_MINMAX_6X8__NEONFMA_LANE_LD64, k_gt_2_subtile) {
     TEST_REQUIRES_ARM_NEON_FMA;
-    for (size_t k = 5; k < 8; k++) {
+    for (size_t k = 3; k < 4; k++) {
       for (uint32_t n = 1; n <= 8; n++) {
         for (uint32_t m = 1; m <= 6; m++) {
           GemmMicrokernelTester()
@@ -13492,15 +14404,15 @@
             .n(n)
             .k(k)
             .iterations(1)
-            .Test(xnn_f32_gemm_minmax_ukernel_6x8__neonfma_dup_ld128, xnn_init_f32_minmax_scalar_params);
+            .Test(xnn_f32_gemm_minmax_ukernel_6x8__neonfma_lane_ld64, xnn_init_f32_minmax_scalar_params);
         }
       }
     }
   }
 
-  TEST(F32_GEMM_MINMAX_6X8__NEONFMA_DUP_LD128, k_div_4) {
+  TEST(F32_GEMM_MINMAX_6X8__NEONFMA_LANE_LD64, k_div_2) {
     TEST_REQUIRES_ARM_NEON_FMA;
-    for (size_t k = 8; k <= 40; k += 4) {
+    for (size_t k = 4; k <= 20; k += 2) {
       GemmMicrokernelTester()
         .mr(6)
         .nr(8)
@@ -13509,13 +14421,13 @@
         .m(6)
         .n(8)
         .k(k)
-        .Test(xnn_f32_gemm_minmax_ukernel_6x8__neonfma_dup_ld128, xnn_init_f32_minmax_scalar_params);
+        .Test(xnn_f32_gemm_minmax_ukernel_6x8__neonfma_lane_ld64, xnn_init_f32_minmax_scalar_params);
     }
   }
 
-  TEST(F32_GEMM_MINMAX_6X8__NEONFMA_DUP_LD128, k_div_4_strided_a) {
+  TEST(F32_GEMM_MINMAX_6X8__NEONFMA_LANE_LD64, k_div_2_strided_a) {
     TEST_REQUIRES_ARM_NEON_FMA;
-    for (size_t k = 8; k <= 40; k += 4) {
+    for (size_t k = 4; k <= 20; k += 2) {
       GemmMicrokernelTester()
         .mr(6)
         .nr(8)
@@ -13524,14 +14436,14 @@
         .m(6)
         .n(8)
         .k(k)
-        .a_stride(43)
-        .Test(xnn_f32_gemm_minmax_ukernel_6x8__neonfma_dup_ld128, xnn_init_f32_minmax_scalar_params);
+        .a_stride(23)
+        .Test(xnn_f32_gemm_minmax_ukernel_6x8__neonfma_lane_ld64, xnn_init_f32_minmax_scalar_params);
     }
   }
 
-  TEST(F32_GEMM_MINMAX_6X8__NEONFMA_DUP_LD128, k_div_4_subtile) {
+  TEST(F32_GEMM_MINMAX_6X8__NEONFMA_LANE_LD64, k_div_2_subtile) {
     TEST_REQUIRES_ARM_NEON_FMA;
-    for (size_t k = 8; k <= 40; k += 4) {
+    for (size_t k = 4; k <= 20; k += 2) {
       for (uint32_t n = 1; n <= 8; n++) {
         for (uint32_t m = 1; m <= 6; m++) {
           GemmMicrokernelTester()
@@ -13543,16 +14455,16 @@
             .n(n)
             .k(k)
             .iterations(1)
-            .Test(xnn_f32_gemm_minmax_ukernel_6x8__neonfma_dup_ld128, xnn_init_f32_minmax_scalar_params);
+            .Test(xnn_f32_gemm_minmax_ukernel_6x8__neonfma_lane_ld64, xnn_init_f32_minmax_scalar_params);
         }
       }
     }
   }
 
-  TEST(F32_GEMM_MINMAX_6X8__NEONFMA_DUP_LD128, n_gt_8) {
+  TEST(F32_GEMM_MINMAX_6X8__NEONFMA_LANE_LD64, n_gt_8) {
     TEST_REQUIRES_ARM_NEON_FMA;
     for (uint32_t n = 9; n < 16; n++) {
-      for (size_t k = 1; k <= 20; k += 5) {
+      for (size_t k = 1; k <= 10; k += 3) {
         GemmMicrokernelTester()
           .mr(6)
           .nr(8)
@@ -13561,15 +14473,15 @@
           .m(6)
           .n(n)
           .k(k)
-          .Test(xnn_f32_gemm_minmax_ukernel_6x8__neonfma_dup_ld128, xnn_init_f32_minmax_scalar_params);
+          .Test(xnn_f32_gemm_minmax_ukernel_6x8__neonfma_lane_ld64, xnn_init_f32_minmax_scalar_params);
       }
     }
   }
 
-  TEST(F32_GEMM_MINMAX_6X8__NEONFMA_DUP_LD128, n_gt_8_strided_cn) {
+  TEST(F32_GEMM_MINMAX_6X8__NEONFMA_LANE_LD64, n_gt_8_strided_cn) {
     TEST_REQUIRES_ARM_NEON_FMA;
     for (uint32_t n = 9; n < 16; n++) {
-      for (size_t k = 1; k <= 20; k += 5) {
+      for (size_t k = 1; k <= 10; k += 3) {
         GemmMicrokernelTester()
           .mr(6)
           .nr(8)
@@ -13579,15 +14491,15 @@
           .n(n)
           .k(k)
           .cn_stride(11)
-          .Test(xnn_f32_gemm_minmax_ukernel_6x8__neonfma_dup_ld128, xnn_init_f32_minmax_scalar_params);
+          .Test(xnn_f32_gemm_minmax_ukernel_6x8__neonfma_lane_ld64, xnn_init_f32_minmax_scalar_params);
       }
     }
   }
 
-  TEST(F32_GEMM_MINMAX_6X8__NEONFMA_DUP_LD128, n_gt_8_strided_a) {
+  TEST(F32_GEMM_MINMAX_6X8__NEONFMA_LANE_LD64, n_gt_8_strided_a) {
     TEST_REQUIRES_ARM_NEON_FMA;
     for (uint32_t n = 9; n < 16; n++) {
-      for (size_t k = 1; k <= 20; k += 5) {
+      for (size_t k = 1; k <= 10; k += 3) {
         GemmMicrokernelTester()
           .mr(6)
           .nr(8)
@@ -13596,16 +14508,16 @@
           .m(6)
           .n(n)
           .k(k)
-          .a_stride(23)
-          .Test(xnn_f32_gemm_minmax_ukernel_6x8__neonfma_dup_ld128, xnn_init_f32_minmax_scalar_params);
+          .a_stride(13)
+          .Test(xnn_f32_gemm_minmax_ukernel_6x8__neonfma_lane_ld64, xnn_init_f32_minmax_scalar_params);
       }
     }
   }
 
-  TEST(F32_GEMM_MINMAX_6X8__NEONFMA_DUP_LD128, n_gt_8_subtile) {
+  TEST(F32_GEMM_MINMAX_6X8__NEONFMA_LANE_LD64, n_gt_8_subtile) {
     TEST_REQUIRES_ARM_NEON_FMA;
     for (uint32_t n = 9; n < 16; n++) {
-      for (size_t k = 1; k <= 20; k += 5) {
+      for (size_t k = 1; k <= 10; k += 3) {
         for (uint32_t m = 1; m <= 6; m++) {
           GemmMicrokernelTester()
             .mr(6)
@@ -13616,16 +14528,16 @@
             .n(n)
             .k(k)
             .iterations(1)
-            .Test(xnn_f32_gemm_minmax_ukernel_6x8__neonfma_dup_ld128, xnn_init_f32_minmax_scalar_params);
+            .Test(xnn_f32_gemm_minmax_ukernel_6x8__neonfma_lane_ld64, xnn_init_f32_minmax_scalar_params);
         }
       }
     }
   }
 
-  TEST(F32_GEMM_MINMAX_6X8__NEONFMA_DUP_LD128, n_div_8) {
+  TEST(F32_GEMM_MINMAX_6X8__NEONFMA_LANE_LD64, n_div_8) {
     TEST_REQUIRES_ARM_NEON_FMA;
     for (uint32_t n = 16; n <= 24; n += 8) {
-      for (size_t k = 1; k <= 20; k += 5) {
+      for (size_t k = 1; k <= 10; k += 3) {
         GemmMicrokernelTester()
           .mr(6)
           .nr(8)
@@ -13634,15 +14546,15 @@
           .m(6)
           .n(n)
           .k(k)
-          .Test(xnn_f32_gemm_minmax_ukernel_6x8__neonfma_dup_ld128, xnn_init_f32_minmax_scalar_params);
+          .Test(xnn_f32_gemm_minmax_ukernel_6x8__neonfma_lane_ld64, xnn_init_f32_minmax_scalar_params);
       }
     }
   }
 
-  TEST(F32_GEMM_MINMAX_6X8__NEONFMA_DUP_LD128, n_div_8_strided_cn) {
+  TEST(F32_GEMM_MINMAX_6X8__NEONFMA_LANE_LD64, n_div_8_strided_cn) {
     TEST_REQUIRES_ARM_NEON_FMA;
     for (uint32_t n = 16; n <= 24; n += 8) {
-      for (size_t k = 1; k <= 20; k += 5) {
+      for (size_t k = 1; k <= 10; k += 3) {
         GemmMicrokernelTester()
           .mr(6)
           .nr(8)
@@ -13652,15 +14564,15 @@
           .n(n)
           .k(k)
           .cn_stride(11)
-          .Test(xnn_f32_gemm_minmax_ukernel_6x8__neonfma_dup_ld128, xnn_init_f32_minmax_scalar_params);
+          .Test(xnn_f32_gemm_minmax_ukernel_6x8__neonfma_lane_ld64, xnn_init_f32_minmax_scalar_params);
       }
     }
   }
 
-  TEST(F32_GEMM_MINMAX_6X8__NEONFMA_DUP_LD128, n_div_8_strided_a) {
+  TEST(F32_GEMM_MINMAX_6X8__NEONFMA_LANE_LD64, n_div_8_strided_a) {
     TEST_REQUIRES_ARM_NEON_FMA;
     for (uint32_t n = 16; n <= 24; n += 8) {
-      for (size_t k = 1; k <= 20; k += 5) {
+      for (size_t k = 1; k <= 10; k += 3) {
         GemmMicrokernelTester()
           .mr(6)
           .nr(8)
@@ -13669,16 +14581,16 @@
           .m(6)
           .n(n)
           .k(k)
-          .a_stride(23)
-          .Test(xnn_f32_gemm_minmax_ukernel_6x8__neonfma_dup_ld128, xnn_init_f32_minmax_scalar_params);
+          .a_stride(13)
+          .Test(xnn_f32_gemm_minmax_ukernel_6x8__neonfma_lane_ld64, xnn_init_f32_minmax_scalar_params);
       }
     }
   }
 
-  TEST(F32_GEMM_MINMAX_6X8__NEONFMA_DUP_LD128, n_div_8_subtile) {
+  TEST(F32_GEMM_MINMAX_6X8__NEONFMA_LANE_LD64, n_div_8_subtile) {
     TEST_REQUIRES_ARM_NEON_FMA;
     for (uint32_t n = 16; n <= 24; n += 8) {
-      for (size_t k = 1; k <= 20; k += 5) {
+      for (size_t k = 1; k <= 10; k += 3) {
         for (uint32_t m = 1; m <= 6; m++) {
           GemmMicrokernelTester()
             .mr(6)
@@ -13689,15 +14601,15 @@
             .n(n)
             .k(k)
             .iterations(1)
-            .Test(xnn_f32_gemm_minmax_ukernel_6x8__neonfma_dup_ld128, xnn_init_f32_minmax_scalar_params);
+            .Test(xnn_f32_gemm_minmax_ukernel_6x8__neonfma_lane_ld64, xnn_init_f32_minmax_scalar_params);
         }
       }
     }
   }
 
-  TEST(F32_GEMM_MINMAX_6X8__NEONFMA_DUP_LD128, strided_cm_subtile) {
+  TEST(F32_GEMM_MINMAX_6X8__NEONFMA_LANE_LD64, strided_cm_subtile) {
     TEST_REQUIRES_ARM_NEON_FMA;
-    for (size_t k = 1; k <= 20; k += 5) {
+    for (size_t k = 1; k <= 10; k += 3) {
       for (uint32_t n = 1; n <= 8; n++) {
         for (uint32_t m = 1; m <= 6; m++) {
           GemmMicrokernelTester()
@@ -13710,13 +14622,13 @@
             .k(k)
             .cm_stride(11)
             .iterations(1)
-            .Test(xnn_f32_gemm_minmax_ukernel_6x8__neonfma_dup_ld128, xnn_init_f32_minmax_scalar_params);
+            .Test(xnn_f32_gemm_minmax_ukernel_6x8__neonfma_lane_ld64, xnn_init_f32_minmax_scalar_params);
         }
       }
     }
   }
 
-  TEST(F32_GEMM_MINMAX_6X8__NEONFMA_DUP_LD128, qmin) {
+  TEST(F32_GEMM_MINMAX_6X8__NEONFMA_LANE_LD64, qmin) {
     TEST_REQUIRES_ARM_NEON_FMA;
     GemmMicrokernelTester()
       .mr(6)
@@ -13725,12 +14637,12 @@
       .sr(1)
       .m(6)
       .n(8)
-      .k(4)
+      .k(2)
       .qmin(128)
-      .Test(xnn_f32_gemm_minmax_ukernel_6x8__neonfma_dup_ld128, xnn_init_f32_minmax_scalar_params);
+      .Test(xnn_f32_gemm_minmax_ukernel_6x8__neonfma_lane_ld64, xnn_init_f32_minmax_scalar_params);
   }
 
-  TEST(F32_GEMM_MINMAX_6X8__NEONFMA_DUP_LD128, qmax) {
+  TEST(F32_GEMM_MINMAX_6X8__NEONFMA_LANE_LD64, qmax) {
     TEST_REQUIRES_ARM_NEON_FMA;
     GemmMicrokernelTester()
       .mr(6)
@@ -13739,12 +14651,12 @@
       .sr(1)
       .m(6)
       .n(8)
-      .k(4)
+      .k(2)
       .qmax(128)
-      .Test(xnn_f32_gemm_minmax_ukernel_6x8__neonfma_dup_ld128, xnn_init_f32_minmax_scalar_params);
+      .Test(xnn_f32_gemm_minmax_ukernel_6x8__neonfma_lane_ld64, xnn_init_f32_minmax_scalar_params);
   }
 
-  TEST(F32_GEMM_MINMAX_6X8__NEONFMA_DUP_LD128, strided_cm) {
+  TEST(F32_GEMM_MINMAX_6X8__NEONFMA_LANE_LD64, strided_cm) {
     TEST_REQUIRES_ARM_NEON_FMA;
     GemmMicrokernelTester()
       .mr(6)
@@ -13753,15 +14665,15 @@
       .sr(1)
       .m(6)
       .n(8)
-      .k(4)
+      .k(2)
       .cm_stride(11)
-      .Test(xnn_f32_gemm_minmax_ukernel_6x8__neonfma_dup_ld128, xnn_init_f32_minmax_scalar_params);
+      .Test(xnn_f32_gemm_minmax_ukernel_6x8__neonfma_lane_ld64, xnn_init_f32_minmax_scalar_params);
   }
-#endif  // XNN_ARCH_ARM || XNN_ARCH_ARM64
+#endif  // XNN_ARCH_ARM64
 
 
 #if XNN_ARCH_ARM64
-  TEST(F32_GEMM_MINMAX_6X8__NEONFMA_LANE_LD64, k_eq_2) {
+  TEST(F32_GEMM_MINMAX_6X8__NEONFMA_LANE_LD128, k_eq_4) {
     TEST_REQUIRES_ARM_NEON_FMA;
     GemmMicrokernelTester()
       .mr(6)
@@ -13770,11 +14682,11 @@
       .sr(1)
       .m(6)
       .n(8)
-      .k(2)
-      .Test(xnn_f32_gemm_minmax_ukernel_6x8__neonfma_lane_ld64, xnn_init_f32_minmax_scalar_params);
+      .k(4)
+      .Test(xnn_f32_gemm_minmax_ukernel_6x8__neonfma_lane_ld128, xnn_init_f32_minmax_scalar_params);
   }
 
-  TEST(F32_GEMM_MINMAX_6X8__NEONFMA_LANE_LD64, strided_cn) {
+  TEST(F32_GEMM_MINMAX_6X8__NEONFMA_LANE_LD128, strided_cn) {
     TEST_REQUIRES_ARM_NEON_FMA;
     GemmMicrokernelTester()
       .mr(6)
@@ -13783,12 +14695,12 @@
       .sr(1)
       .m(6)
       .n(8)
-      .k(2)
+      .k(4)
       .cn_stride(11)
-      .Test(xnn_f32_gemm_minmax_ukernel_6x8__neonfma_lane_ld64, xnn_init_f32_minmax_scalar_params);
+      .Test(xnn_f32_gemm_minmax_ukernel_6x8__neonfma_lane_ld128, xnn_init_f32_minmax_scalar_params);
   }
 
-  TEST(F32_GEMM_MINMAX_6X8__NEONFMA_LANE_LD64, k_eq_2_strided_a) {
+  TEST(F32_GEMM_MINMAX_6X8__NEONFMA_LANE_LD128, k_eq_4_strided_a) {
     TEST_REQUIRES_ARM_NEON_FMA;
     GemmMicrokernelTester()
       .mr(6)
@@ -13797,12 +14709,12 @@
       .sr(1)
       .m(6)
       .n(8)
-      .k(2)
-      .a_stride(5)
-      .Test(xnn_f32_gemm_minmax_ukernel_6x8__neonfma_lane_ld64, xnn_init_f32_minmax_scalar_params);
+      .k(4)
+      .a_stride(7)
+      .Test(xnn_f32_gemm_minmax_ukernel_6x8__neonfma_lane_ld128, xnn_init_f32_minmax_scalar_params);
   }
 
-  TEST(F32_GEMM_MINMAX_6X8__NEONFMA_LANE_LD64, k_eq_2_subtile) {
+  TEST(F32_GEMM_MINMAX_6X8__NEONFMA_LANE_LD128, k_eq_4_subtile) {
     TEST_REQUIRES_ARM_NEON_FMA;
     for (uint32_t n = 1; n <= 8; n++) {
       for (uint32_t m = 1; m <= 6; m++) {
@@ -13813,14 +14725,14 @@
           .sr(1)
           .m(m)
           .n(n)
-          .k(2)
+          .k(4)
           .iterations(1)
-          .Test(xnn_f32_gemm_minmax_ukernel_6x8__neonfma_lane_ld64, xnn_init_f32_minmax_scalar_params);
+          .Test(xnn_f32_gemm_minmax_ukernel_6x8__neonfma_lane_ld128, xnn_init_f32_minmax_scalar_params);
       }
     }
   }
 
-  TEST(F32_GEMM_MINMAX_6X8__NEONFMA_LANE_LD64, k_eq_2_subtile_m) {
+  TEST(F32_GEMM_MINMAX_6X8__NEONFMA_LANE_LD128, k_eq_4_subtile_m) {
     TEST_REQUIRES_ARM_NEON_FMA;
     for (uint32_t m = 1; m <= 6; m++) {
       GemmMicrokernelTester()
@@ -13830,13 +14742,13 @@
         .sr(1)
         .m(m)
         .n(8)
-        .k(2)
+        .k(4)
         .iterations(1)
-        .Test(xnn_f32_gemm_minmax_ukernel_6x8__neonfma_lane_ld64, xnn_init_f32_minmax_scalar_params);
+        .Test(xnn_f32_gemm_minmax_ukernel_6x8__neonfma_lane_ld128, xnn_init_f32_minmax_scalar_params);
     }
   }
 
-  TEST(F32_GEMM_MINMAX_6X8__NEONFMA_LANE_LD64, k_eq_2_subtile_n) {
+  TEST(F32_GEMM_MINMAX_6X8__NEONFMA_LANE_LD128, k_eq_4_subtile_n) {
     TEST_REQUIRES_ARM_NEON_FMA;
     for (uint32_t n = 1; n <= 8; n++) {
       GemmMicrokernelTester()
@@ -13846,15 +14758,15 @@
         .sr(1)
         .m(6)
         .n(n)
-        .k(2)
+        .k(4)
         .iterations(1)
-        .Test(xnn_f32_gemm_minmax_ukernel_6x8__neonfma_lane_ld64, xnn_init_f32_minmax_scalar_params);
+        .Test(xnn_f32_gemm_minmax_ukernel_6x8__neonfma_lane_ld128, xnn_init_f32_minmax_scalar_params);
     }
   }
 
-  TEST(F32_GEMM_MINMAX_6X8__NEONFMA_LANE_LD64, k_lt_2) {
+  TEST(F32_GEMM_MINMAX_6X8__NEONFMA_LANE_LD128, k_lt_4) {
     TEST_REQUIRES_ARM_NEON_FMA;
-    for (size_t k = 1; k < 2; k++) {
+    for (size_t k = 1; k < 4; k++) {
       GemmMicrokernelTester()
         .mr(6)
         .nr(8)
@@ -13863,13 +14775,13 @@
         .m(6)
         .n(8)
         .k(k)
-        .Test(xnn_f32_gemm_minmax_ukernel_6x8__neonfma_lane_ld64, xnn_init_f32_minmax_scalar_params);
+        .Test(xnn_f32_gemm_minmax_ukernel_6x8__neonfma_lane_ld128, xnn_init_f32_minmax_scalar_params);
     }
   }
 
-  TEST(F32_GEMM_MINMAX_6X8__NEONFMA_LANE_LD64, k_lt_2_strided_a) {
+  TEST(F32_GEMM_MINMAX_6X8__NEONFMA_LANE_LD128, k_lt_4_strided_a) {
     TEST_REQUIRES_ARM_NEON_FMA;
-    for (size_t k = 1; k < 2; k++) {
+    for (size_t k = 1; k < 4; k++) {
       GemmMicrokernelTester()
         .mr(6)
         .nr(8)
@@ -13878,14 +14790,14 @@
         .m(6)
         .n(8)
         .k(k)
-        .a_stride(5)
-        .Test(xnn_f32_gemm_minmax_ukernel_6x8__neonfma_lane_ld64, xnn_init_f32_minmax_scalar_params);
+        .a_stride(7)
+        .Test(xnn_f32_gemm_minmax_ukernel_6x8__neonfma_lane_ld128, xnn_init_f32_minmax_scalar_params);
     }
   }
 
-  TEST(F32_GEMM_MINMAX_6X8__NEONFMA_LANE_LD64, k_lt_2_subtile) {
+  TEST(F32_GEMM_MINMAX_6X8__NEONFMA_LANE_LD128, k_lt_4_subtile) {
     TEST_REQUIRES_ARM_NEON_FMA;
-    for (size_t k = 1; k < 2; k++) {
+    for (size_t k = 1; k < 4; k++) {
       for (uint32_t n = 1; n <= 8; n++) {
         for (uint32_t m = 1; m <= 6; m++) {
           GemmMicrokernelTester()
@@ -13897,15 +14809,15 @@
             .n(n)
             .k(k)
             .iterations(1)
-            .Test(xnn_f32_gemm_minmax_ukernel_6x8__neonfma_lane_ld64, xnn_init_f32_minmax_scalar_params);
+            .Test(xnn_f32_gemm_minmax_ukernel_6x8__neonfma_lane_ld128, xnn_init_f32_minmax_scalar_params);
         }
       }
     }
   }
 
-  TEST(F32_GEMM_MINMAX_6X8__NEONFMA_LANE_LD64, k_gt_2) {
+  TEST(F32_GEMM_MINMAX_6X8__NEONFMA_LANE_LD128, k_gt_4) {
     TEST_REQUIRES_ARM_NEON_FMA;
-    for (size_t k = 3; k < 4; k++) {
+    for (size_t k = 5; k < 8; k++) {
       GemmMicrokernelTester()
         .mr(6)
         .nr(8)
@@ -13914,13 +14826,13 @@
         .m(6)
         .n(8)
         .k(k)
-        .Test(xnn_f32_gemm_minmax_ukernel_6x8__neonfma_lane_ld64, xnn_init_f32_minmax_scalar_params);
+        .Test(xnn_f32_gemm_minmax_ukernel_6x8__neonfma_lane_ld128, xnn_init_f32_minmax_scalar_params);
     }
   }
 
-  TEST(F32_GEMM_MINMAX_6X8__NEONFMA_LANE_LD64, k_gt_2_strided_a) {
+  TEST(F32_GEMM_MINMAX_6X8__NEONFMA_LANE_LD128, k_gt_4_strided_a) {
     TEST_REQUIRES_ARM_NEON_FMA;
-    for (size_t k = 3; k < 4; k++) {
+    for (size_t k = 5; k < 8; k++) {
       GemmMicrokernelTester()
         .mr(6)
         .nr(8)
@@ -13929,14 +14841,14 @@
         .m(6)
         .n(8)
         .k(k)
-        .a_stride(7)
-        .Test(xnn_f32_gemm_minmax_ukernel_6x8__neonfma_lane_ld64, xnn_init_f32_minmax_scalar_params);
+        .a_stride(11)
+        .Test(xnn_f32_gemm_minmax_ukernel_6x8__neonfma_lane_ld128, xnn_init_f32_minmax_scalar_params);
     }
   }
 
-  TEST(F32_GEMM_MINMAX_6X8__NEONFMA_LANE_LD64, k_gt_2_subtile) {
+  TEST(F32_GEMM_MINMAX_6X8__NEONFMA_LANE_LD128, k_gt_4_subtile) {
     TEST_REQUIRES_ARM_NEON_FMA;
-    for (size_t k = 3; k < 4; k++) {
+    for (size_t k = 5; k < 8; k++) {
       for (uint32_t n = 1; n <= 8; n++) {
         for (uint32_t m = 1; m <= 6; m++) {
           GemmMicrokernelTester()
@@ -13948,15 +14860,15 @@
             .n(n)
             .k(k)
             .iterations(1)
-            .Test(xnn_f32_gemm_minmax_ukernel_6x8__neonfma_lane_ld64, xnn_init_f32_minmax_scalar_params);
+            .Test(xnn_f32_gemm_minmax_ukernel_6x8__neonfma_lane_ld128, xnn_init_f32_minmax_scalar_params);
         }
       }
     }
   }
 
-  TEST(F32_GEMM_MINMAX_6X8__NEONFMA_LANE_LD64, k_div_2) {
+  TEST(F32_GEMM_MINMAX_6X8__NEONFMA_LANE_LD128, k_div_4) {
     TEST_REQUIRES_ARM_NEON_FMA;
-    for (size_t k = 4; k <= 20; k += 2) {
+    for (size_t k = 8; k <= 40; k += 4) {
       GemmMicrokernelTester()
         .mr(6)
         .nr(8)
@@ -13965,13 +14877,13 @@
         .m(6)
         .n(8)
         .k(k)
-        .Test(xnn_f32_gemm_minmax_ukernel_6x8__neonfma_lane_ld64, xnn_init_f32_minmax_scalar_params);
+        .Test(xnn_f32_gemm_minmax_ukernel_6x8__neonfma_lane_ld128, xnn_init_f32_minmax_scalar_params);
     }
   }
 
-  TEST(F32_GEMM_MINMAX_6X8__NEONFMA_LANE_LD64, k_div_2_strided_a) {
+  TEST(F32_GEMM_MINMAX_6X8__NEONFMA_LANE_LD128, k_div_4_strided_a) {
     TEST_REQUIRES_ARM_NEON_FMA;
-    for (size_t k = 4; k <= 20; k += 2) {
+    for (size_t k = 8; k <= 40; k += 4) {
       GemmMicrokernelTester()
         .mr(6)
         .nr(8)
@@ -13980,14 +14892,14 @@
         .m(6)
         .n(8)
         .k(k)
-        .a_stride(23)
-        .Test(xnn_f32_gemm_minmax_ukernel_6x8__neonfma_lane_ld64, xnn_init_f32_minmax_scalar_params);
+        .a_stride(43)
+        .Test(xnn_f32_gemm_minmax_ukernel_6x8__neonfma_lane_ld128, xnn_init_f32_minmax_scalar_params);
     }
   }
 
-  TEST(F32_GEMM_MINMAX_6X8__NEONFMA_LANE_LD64, k_div_2_subtile) {
+  TEST(F32_GEMM_MINMAX_6X8__NEONFMA_LANE_LD128, k_div_4_subtile) {
     TEST_REQUIRES_ARM_NEON_FMA;
-    for (size_t k = 4; k <= 20; k += 2) {
+    for (size_t k = 8; k <= 40; k += 4) {
       for (uint32_t n = 1; n <= 8; n++) {
         for (uint32_t m = 1; m <= 6; m++) {
           GemmMicrokernelTester()
@@ -13999,16 +14911,16 @@
             .n(n)
             .k(k)
             .iterations(1)
-            .Test(xnn_f32_gemm_minmax_ukernel_6x8__neonfma_lane_ld64, xnn_init_f32_minmax_scalar_params);
+            .Test(xnn_f32_gemm_minmax_ukernel_6x8__neonfma_lane_ld128, xnn_init_f32_minmax_scalar_params);
         }
       }
     }
   }
 
-  TEST(F32_GEMM_MINMAX_6X8__NEONFMA_LANE_LD64, n_gt_8) {
+  TEST(F32_GEMM_MINMAX_6X8__NEONFMA_LANE_LD128, n_gt_8) {
     TEST_REQUIRES_ARM_NEON_FMA;
     for (uint32_t n = 9; n < 16; n++) {
-      for (size_t k = 1; k <= 10; k += 3) {
+      for (size_t k = 1; k <= 20; k += 5) {
         GemmMicrokernelTester()
           .mr(6)
           .nr(8)
@@ -14017,15 +14929,15 @@
           .m(6)
           .n(n)
           .k(k)
-          .Test(xnn_f32_gemm_minmax_ukernel_6x8__neonfma_lane_ld64, xnn_init_f32_minmax_scalar_params);
+          .Test(xnn_f32_gemm_minmax_ukernel_6x8__neonfma_lane_ld128, xnn_init_f32_minmax_scalar_params);
       }
     }
   }
 
-  TEST(F32_GEMM_MINMAX_6X8__NEONFMA_LANE_LD64, n_gt_8_strided_cn) {
+  TEST(F32_GEMM_MINMAX_6X8__NEONFMA_LANE_LD128, n_gt_8_strided_cn) {
     TEST_REQUIRES_ARM_NEON_FMA;
     for (uint32_t n = 9; n < 16; n++) {
-      for (size_t k = 1; k <= 10; k += 3) {
+      for (size_t k = 1; k <= 20; k += 5) {
         GemmMicrokernelTester()
           .mr(6)
           .nr(8)
@@ -14035,15 +14947,15 @@
           .n(n)
           .k(k)
           .cn_stride(11)
-          .Test(xnn_f32_gemm_minmax_ukernel_6x8__neonfma_lane_ld64, xnn_init_f32_minmax_scalar_params);
+          .Test(xnn_f32_gemm_minmax_ukernel_6x8__neonfma_lane_ld128, xnn_init_f32_minmax_scalar_params);
       }
     }
   }
 
-  TEST(F32_GEMM_MINMAX_6X8__NEONFMA_LANE_LD64, n_gt_8_strided_a) {
+  TEST(F32_GEMM_MINMAX_6X8__NEONFMA_LANE_LD128, n_gt_8_strided_a) {
     TEST_REQUIRES_ARM_NEON_FMA;
     for (uint32_t n = 9; n < 16; n++) {
-      for (size_t k = 1; k <= 10; k += 3) {
+      for (size_t k = 1; k <= 20; k += 5) {
         GemmMicrokernelTester()
           .mr(6)
           .nr(8)
@@ -14052,16 +14964,16 @@
           .m(6)
           .n(n)
           .k(k)
-          .a_stride(13)
-          .Test(xnn_f32_gemm_minmax_ukernel_6x8__neonfma_lane_ld64, xnn_init_f32_minmax_scalar_params);
+          .a_stride(23)
+          .Test(xnn_f32_gemm_minmax_ukernel_6x8__neonfma_lane_ld128, xnn_init_f32_minmax_scalar_params);
       }
     }
   }
 
-  TEST(F32_GEMM_MINMAX_6X8__NEONFMA_LANE_LD64, n_gt_8_subtile) {
+  TEST(F32_GEMM_MINMAX_6X8__NEONFMA_LANE_LD128, n_gt_8_subtile) {
     TEST_REQUIRES_ARM_NEON_FMA;
     for (uint32_t n = 9; n < 16; n++) {
-      for (size_t k = 1; k <= 10; k += 3) {
+      for (size_t k = 1; k <= 20; k += 5) {
         for (uint32_t m = 1; m <= 6; m++) {
           GemmMicrokernelTester()
             .mr(6)
@@ -14072,16 +14984,16 @@
             .n(n)
             .k(k)
             .iterations(1)
-            .Test(xnn_f32_gemm_minmax_ukernel_6x8__neonfma_lane_ld64, xnn_init_f32_minmax_scalar_params);
+            .Test(xnn_f32_gemm_minmax_ukernel_6x8__neonfma_lane_ld128, xnn_init_f32_minmax_scalar_params);
         }
       }
     }
   }
 
-  TEST(F32_GEMM_MINMAX_6X8__NEONFMA_LANE_LD64, n_div_8) {
+  TEST(F32_GEMM_MINMAX_6X8__NEONFMA_LANE_LD128, n_div_8) {
     TEST_REQUIRES_ARM_NEON_FMA;
     for (uint32_t n = 16; n <= 24; n += 8) {
-      for (size_t k = 1; k <= 10; k += 3) {
+      for (size_t k = 1; k <= 20; k += 5) {
         GemmMicrokernelTester()
           .mr(6)
           .nr(8)
@@ -14090,15 +15002,15 @@
           .m(6)
           .n(n)
           .k(k)
-          .Test(xnn_f32_gemm_minmax_ukernel_6x8__neonfma_lane_ld64, xnn_init_f32_minmax_scalar_params);
+          .Test(xnn_f32_gemm_minmax_ukernel_6x8__neonfma_lane_ld128, xnn_init_f32_minmax_scalar_params);
       }
     }
   }
 
-  TEST(F32_GEMM_MINMAX_6X8__NEONFMA_LANE_LD64, n_div_8_strided_cn) {
+  TEST(F32_GEMM_MINMAX_6X8__NEONFMA_LANE_LD128, n_div_8_strided_cn) {
     TEST_REQUIRES_ARM_NEON_FMA;
     for (uint32_t n = 16; n <= 24; n += 8) {
-      for (size_t k = 1; k <= 10; k += 3) {
+      for (size_t k = 1; k <= 20; k += 5) {
         GemmMicrokernelTester()
           .mr(6)
           .nr(8)
@@ -14108,15 +15020,15 @@
           .n(n)
           .k(k)
           .cn_stride(11)
-          .Test(xnn_f32_gemm_minmax_ukernel_6x8__neonfma_lane_ld64, xnn_init_f32_minmax_scalar_params);
+          .Test(xnn_f32_gemm_minmax_ukernel_6x8__neonfma_lane_ld128, xnn_init_f32_minmax_scalar_params);
       }
     }
   }
 
-  TEST(F32_GEMM_MINMAX_6X8__NEONFMA_LANE_LD64, n_div_8_strided_a) {
+  TEST(F32_GEMM_MINMAX_6X8__NEONFMA_LANE_LD128, n_div_8_strided_a) {
     TEST_REQUIRES_ARM_NEON_FMA;
     for (uint32_t n = 16; n <= 24; n += 8) {
-      for (size_t k = 1; k <= 10; k += 3) {
+      for (size_t k = 1; k <= 20; k += 5) {
         GemmMicrokernelTester()
           .mr(6)
           .nr(8)
@@ -14125,16 +15037,16 @@
           .m(6)
           .n(n)
           .k(k)
-          .a_stride(13)
-          .Test(xnn_f32_gemm_minmax_ukernel_6x8__neonfma_lane_ld64, xnn_init_f32_minmax_scalar_params);
+          .a_stride(23)
+          .Test(xnn_f32_gemm_minmax_ukernel_6x8__neonfma_lane_ld128, xnn_init_f32_minmax_scalar_params);
       }
     }
   }
 
-  TEST(F32_GEMM_MINMAX_6X8__NEONFMA_LANE_LD64, n_div_8_subtile) {
+  TEST(F32_GEMM_MINMAX_6X8__NEONFMA_LANE_LD128, n_div_8_subtile) {
     TEST_REQUIRES_ARM_NEON_FMA;
     for (uint32_t n = 16; n <= 24; n += 8) {
-      for (size_t k = 1; k <= 10; k += 3) {
+      for (size_t k = 1; k <= 20; k += 5) {
         for (uint32_t m = 1; m <= 6; m++) {
           GemmMicrokernelTester()
             .mr(6)
@@ -14145,15 +15057,15 @@
             .n(n)
             .k(k)
             .iterations(1)
-            .Test(xnn_f32_gemm_minmax_ukernel_6x8__neonfma_lane_ld64, xnn_init_f32_minmax_scalar_params);
+            .Test(xnn_f32_gemm_minmax_ukernel_6x8__neonfma_lane_ld128, xnn_init_f32_minmax_scalar_params);
         }
       }
     }
   }
 
-  TEST(F32_GEMM_MINMAX_6X8__NEONFMA_LANE_LD64, strided_cm_subtile) {
+  TEST(F32_GEMM_MINMAX_6X8__NEONFMA_LANE_LD128, strided_cm_subtile) {
     TEST_REQUIRES_ARM_NEON_FMA;
-    for (size_t k = 1; k <= 10; k += 3) {
+    for (size_t k = 1; k <= 20; k += 5) {
       for (uint32_t n = 1; n <= 8; n++) {
         for (uint32_t m = 1; m <= 6; m++) {
           GemmMicrokernelTester()
@@ -14166,13 +15078,13 @@
             .k(k)
             .cm_stride(11)
             .iterations(1)
-            .Test(xnn_f32_gemm_minmax_ukernel_6x8__neonfma_lane_ld64, xnn_init_f32_minmax_scalar_params);
+            .Test(xnn_f32_gemm_minmax_ukernel_6x8__neonfma_lane_ld128, xnn_init_f32_minmax_scalar_params);
         }
       }
     }
   }
 
-  TEST(F32_GEMM_MINMAX_6X8__NEONFMA_LANE_LD64, qmin) {
+  TEST(F32_GEMM_MINMAX_6X8__NEONFMA_LANE_LD128, qmin) {
     TEST_REQUIRES_ARM_NEON_FMA;
     GemmMicrokernelTester()
       .mr(6)
@@ -14181,12 +15093,12 @@
       .sr(1)
       .m(6)
       .n(8)
-      .k(2)
+      .k(4)
       .qmin(128)
-      .Test(xnn_f32_gemm_minmax_ukernel_6x8__neonfma_lane_ld64, xnn_init_f32_minmax_scalar_params);
+      .Test(xnn_f32_gemm_minmax_ukernel_6x8__neonfma_lane_ld128, xnn_init_f32_minmax_scalar_params);
   }
 
-  TEST(F32_GEMM_MINMAX_6X8__NEONFMA_LANE_LD64, qmax) {
+  TEST(F32_GEMM_MINMAX_6X8__NEONFMA_LANE_LD128, qmax) {
     TEST_REQUIRES_ARM_NEON_FMA;
     GemmMicrokernelTester()
       .mr(6)
@@ -14195,12 +15107,12 @@
       .sr(1)
       .m(6)
       .n(8)
-      .k(2)
+      .k(4)
       .qmax(128)
-      .Test(xnn_f32_gemm_minmax_ukernel_6x8__neonfma_lane_ld64, xnn_init_f32_minmax_scalar_params);
+      .Test(xnn_f32_gemm_minmax_ukernel_6x8__neonfma_lane_ld128, xnn_init_f32_minmax_scalar_params);
   }
 
-  TEST(F32_GEMM_MINMAX_6X8__NEONFMA_LANE_LD64, strided_cm) {
+  TEST(F32_GEMM_MINMAX_6X8__NEONFMA_LANE_LD128, strided_cm) {
     TEST_REQUIRES_ARM_NEON_FMA;
     GemmMicrokernelTester()
       .mr(6)
@@ -14209,138 +15121,138 @@
       .sr(1)
       .m(6)
       .n(8)
-      .k(2)
+      .k(4)
       .cm_stride(11)
-      .Test(xnn_f32_gemm_minmax_ukernel_6x8__neonfma_lane_ld64, xnn_init_f32_minmax_scalar_params);
+      .Test(xnn_f32_gemm_minmax_ukernel_6x8__neonfma_lane_ld128, xnn_init_f32_minmax_scalar_params);
   }
 #endif  // XNN_ARCH_ARM64
 
 
-#if XNN_ARCH_ARM64
-  TEST(F32_GEMM_MINMAX_6X8__NEONFMA_LANE_LD128, k_eq_4) {
-    TEST_REQUIRES_ARM_NEON_FMA;
+#if XNN_ARCH_ARM || XNN_ARCH_ARM64
+  TEST(F32_GEMM_MINMAX_6X8S4__NEON, k_eq_4) {
+    TEST_REQUIRES_ARM_NEON;
     GemmMicrokernelTester()
       .mr(6)
       .nr(8)
       .kr(1)
-      .sr(1)
+      .sr(4)
       .m(6)
       .n(8)
       .k(4)
-      .Test(xnn_f32_gemm_minmax_ukernel_6x8__neonfma_lane_ld128, xnn_init_f32_minmax_scalar_params);
+      .Test(xnn_f32_gemm_minmax_ukernel_6x8s4__neon, xnn_init_f32_minmax_scalar_params);
   }
 
-  TEST(F32_GEMM_MINMAX_6X8__NEONFMA_LANE_LD128, strided_cn) {
-    TEST_REQUIRES_ARM_NEON_FMA;
+  TEST(F32_GEMM_MINMAX_6X8S4__NEON, strided_cn) {
+    TEST_REQUIRES_ARM_NEON;
     GemmMicrokernelTester()
       .mr(6)
       .nr(8)
       .kr(1)
-      .sr(1)
+      .sr(4)
       .m(6)
       .n(8)
       .k(4)
       .cn_stride(11)
-      .Test(xnn_f32_gemm_minmax_ukernel_6x8__neonfma_lane_ld128, xnn_init_f32_minmax_scalar_params);
+      .Test(xnn_f32_gemm_minmax_ukernel_6x8s4__neon, xnn_init_f32_minmax_scalar_params);
   }
 
-  TEST(F32_GEMM_MINMAX_6X8__NEONFMA_LANE_LD128, k_eq_4_strided_a) {
-    TEST_REQUIRES_ARM_NEON_FMA;
+  TEST(F32_GEMM_MINMAX_6X8S4__NEON, k_eq_4_strided_a) {
+    TEST_REQUIRES_ARM_NEON;
     GemmMicrokernelTester()
       .mr(6)
       .nr(8)
       .kr(1)
-      .sr(1)
+      .sr(4)
       .m(6)
       .n(8)
       .k(4)
       .a_stride(7)
-      .Test(xnn_f32_gemm_minmax_ukernel_6x8__neonfma_lane_ld128, xnn_init_f32_minmax_scalar_params);
+      .Test(xnn_f32_gemm_minmax_ukernel_6x8s4__neon, xnn_init_f32_minmax_scalar_params);
   }
 
-  TEST(F32_GEMM_MINMAX_6X8__NEONFMA_LANE_LD128, k_eq_4_subtile) {
-    TEST_REQUIRES_ARM_NEON_FMA;
+  TEST(F32_GEMM_MINMAX_6X8S4__NEON, k_eq_4_subtile) {
+    TEST_REQUIRES_ARM_NEON;
     for (uint32_t n = 1; n <= 8; n++) {
       for (uint32_t m = 1; m <= 6; m++) {
         GemmMicrokernelTester()
           .mr(6)
           .nr(8)
           .kr(1)
-          .sr(1)
+          .sr(4)
           .m(m)
           .n(n)
           .k(4)
           .iterations(1)
-          .Test(xnn_f32_gemm_minmax_ukernel_6x8__neonfma_lane_ld128, xnn_init_f32_minmax_scalar_params);
+          .Test(xnn_f32_gemm_minmax_ukernel_6x8s4__neon, xnn_init_f32_minmax_scalar_params);
       }
     }
   }
 
-  TEST(F32_GEMM_MINMAX_6X8__NEONFMA_LANE_LD128, k_eq_4_subtile_m) {
-    TEST_REQUIRES_ARM_NEON_FMA;
+  TEST(F32_GEMM_MINMAX_6X8S4__NEON, k_eq_4_subtile_m) {
+    TEST_REQUIRES_ARM_NEON;
     for (uint32_t m = 1; m <= 6; m++) {
       GemmMicrokernelTester()
         .mr(6)
         .nr(8)
         .kr(1)
-        .sr(1)
+        .sr(4)
         .m(m)
         .n(8)
         .k(4)
         .iterations(1)
-        .Test(xnn_f32_gemm_minmax_ukernel_6x8__neonfma_lane_ld128, xnn_init_f32_minmax_scalar_params);
+        .Test(xnn_f32_gemm_minmax_ukernel_6x8s4__neon, xnn_init_f32_minmax_scalar_params);
     }
   }
 
-  TEST(F32_GEMM_MINMAX_6X8__NEONFMA_LANE_LD128, k_eq_4_subtile_n) {
-    TEST_REQUIRES_ARM_NEON_FMA;
+  TEST(F32_GEMM_MINMAX_6X8S4__NEON, k_eq_4_subtile_n) {
+    TEST_REQUIRES_ARM_NEON;
     for (uint32_t n = 1; n <= 8; n++) {
       GemmMicrokernelTester()
         .mr(6)
         .nr(8)
         .kr(1)
-        .sr(1)
+        .sr(4)
         .m(6)
         .n(n)
         .k(4)
         .iterations(1)
-        .Test(xnn_f32_gemm_minmax_ukernel_6x8__neonfma_lane_ld128, xnn_init_f32_minmax_scalar_params);
+        .Test(xnn_f32_gemm_minmax_ukernel_6x8s4__neon, xnn_init_f32_minmax_scalar_params);
     }
   }
 
-  TEST(F32_GEMM_MINMAX_6X8__NEONFMA_LANE_LD128, k_lt_4) {
-    TEST_REQUIRES_ARM_NEON_FMA;
+  TEST(F32_GEMM_MINMAX_6X8S4__NEON, k_lt_4) {
+    TEST_REQUIRES_ARM_NEON;
     for (size_t k = 1; k < 4; k++) {
       GemmMicrokernelTester()
         .mr(6)
         .nr(8)
         .kr(1)
-        .sr(1)
+        .sr(4)
         .m(6)
         .n(8)
         .k(k)
-        .Test(xnn_f32_gemm_minmax_ukernel_6x8__neonfma_lane_ld128, xnn_init_f32_minmax_scalar_params);
+        .Test(xnn_f32_gemm_minmax_ukernel_6x8s4__neon, xnn_init_f32_minmax_scalar_params);
     }
   }
 
-  TEST(F32_GEMM_MINMAX_6X8__NEONFMA_LANE_LD128, k_lt_4_strided_a) {
-    TEST_REQUIRES_ARM_NEON_FMA;
+  TEST(F32_GEMM_MINMAX_6X8S4__NEON, k_lt_4_strided_a) {
+    TEST_REQUIRES_ARM_NEON;
     for (size_t k = 1; k < 4; k++) {
       GemmMicrokernelTester()
         .mr(6)
         .nr(8)
         .kr(1)
-        .sr(1)
+        .sr(4)
         .m(6)
         .n(8)
         .k(k)
         .a_stride(7)
-        .Test(xnn_f32_gemm_minmax_ukernel_6x8__neonfma_lane_ld128, xnn_init_f32_minmax_scalar_params);
+        .Test(xnn_f32_gemm_minmax_ukernel_6x8s4__neon, xnn_init_f32_minmax_scalar_params);
     }
   }
 
-  TEST(F32_GEMM_MINMAX_6X8__NEONFMA_LANE_LD128, k_lt_4_subtile) {
-    TEST_REQUIRES_ARM_NEON_FMA;
+  TEST(F32_GEMM_MINMAX_6X8S4__NEON, k_lt_4_subtile) {
+    TEST_REQUIRES_ARM_NEON;
     for (size_t k = 1; k < 4; k++) {
       for (uint32_t n = 1; n <= 8; n++) {
         for (uint32_t m = 1; m <= 6; m++) {
@@ -14348,50 +15260,50 @@
             .mr(6)
             .nr(8)
             .kr(1)
-            .sr(1)
+            .sr(4)
             .m(m)
             .n(n)
             .k(k)
             .iterations(1)
-            .Test(xnn_f32_gemm_minmax_ukernel_6x8__neonfma_lane_ld128, xnn_init_f32_minmax_scalar_params);
+            .Test(xnn_f32_gemm_minmax_ukernel_6x8s4__neon, xnn_init_f32_minmax_scalar_params);
         }
       }
     }
   }
 
-  TEST(F32_GEMM_MINMAX_6X8__NEONFMA_LANE_LD128, k_gt_4) {
-    TEST_REQUIRES_ARM_NEON_FMA;
+  TEST(F32_GEMM_MINMAX_6X8S4__NEON, k_gt_4) {
+    TEST_REQUIRES_ARM_NEON;
     for (size_t k = 5; k < 8; k++) {
       GemmMicrokernelTester()
         .mr(6)
         .nr(8)
         .kr(1)
-        .sr(1)
+        .sr(4)
         .m(6)
         .n(8)
         .k(k)
-        .Test(xnn_f32_gemm_minmax_ukernel_6x8__neonfma_lane_ld128, xnn_init_f32_minmax_scalar_params);
+        .Test(xnn_f32_gemm_minmax_ukernel_6x8s4__neon, xnn_init_f32_minmax_scalar_params);
     }
   }
 
-  TEST(F32_GEMM_MINMAX_6X8__NEONFMA_LANE_LD128, k_gt_4_strided_a) {
-    TEST_REQUIRES_ARM_NEON_FMA;
+  TEST(F32_GEMM_MINMAX_6X8S4__NEON, k_gt_4_strided_a) {
+    TEST_REQUIRES_ARM_NEON;
     for (size_t k = 5; k < 8; k++) {
       GemmMicrokernelTester()
         .mr(6)
         .nr(8)
         .kr(1)
-        .sr(1)
+        .sr(4)
         .m(6)
         .n(8)
         .k(k)
         .a_stride(11)
-        .Test(xnn_f32_gemm_minmax_ukernel_6x8__neonfma_lane_ld128, xnn_init_f32_minmax_scalar_params);
+        .Test(xnn_f32_gemm_minmax_ukernel_6x8s4__neon, xnn_init_f32_minmax_scalar_params);
     }
   }
 
-  TEST(F32_GEMM_MINMAX_6X8__NEONFMA_LANE_LD128, k_gt_4_subtile) {
-    TEST_REQUIRES_ARM_NEON_FMA;
+  TEST(F32_GEMM_MINMAX_6X8S4__NEON, k_gt_4_subtile) {
+    TEST_REQUIRES_ARM_NEON;
     for (size_t k = 5; k < 8; k++) {
       for (uint32_t n = 1; n <= 8; n++) {
         for (uint32_t m = 1; m <= 6; m++) {
@@ -14399,50 +15311,50 @@
             .mr(6)
             .nr(8)
             .kr(1)
-            .sr(1)
+            .sr(4)
             .m(m)
             .n(n)
             .k(k)
             .iterations(1)
-            .Test(xnn_f32_gemm_minmax_ukernel_6x8__neonfma_lane_ld128, xnn_init_f32_minmax_scalar_params);
+            .Test(xnn_f32_gemm_minmax_ukernel_6x8s4__neon, xnn_init_f32_minmax_scalar_params);
         }
       }
     }
   }
 
-  TEST(F32_GEMM_MINMAX_6X8__NEONFMA_LANE_LD128, k_div_4) {
-    TEST_REQUIRES_ARM_NEON_FMA;
+  TEST(F32_GEMM_MINMAX_6X8S4__NEON, k_div_4) {
+    TEST_REQUIRES_ARM_NEON;
     for (size_t k = 8; k <= 40; k += 4) {
       GemmMicrokernelTester()
         .mr(6)
         .nr(8)
         .kr(1)
-        .sr(1)
+        .sr(4)
         .m(6)
         .n(8)
         .k(k)
-        .Test(xnn_f32_gemm_minmax_ukernel_6x8__neonfma_lane_ld128, xnn_init_f32_minmax_scalar_params);
+        .Test(xnn_f32_gemm_minmax_ukernel_6x8s4__neon, xnn_init_f32_minmax_scalar_params);
     }
   }
 
-  TEST(F32_GEMM_MINMAX_6X8__NEONFMA_LANE_LD128, k_div_4_strided_a) {
-    TEST_REQUIRES_ARM_NEON_FMA;
+  TEST(F32_GEMM_MINMAX_6X8S4__NEON, k_div_4_strided_a) {
+    TEST_REQUIRES_ARM_NEON;
     for (size_t k = 8; k <= 40; k += 4) {
       GemmMicrokernelTester()
         .mr(6)
         .nr(8)
         .kr(1)
-        .sr(1)
+        .sr(4)
         .m(6)
         .n(8)
         .k(k)
         .a_stride(43)
-        .Test(xnn_f32_gemm_minmax_ukernel_6x8__neonfma_lane_ld128, xnn_init_f32_minmax_scalar_params);
+        .Test(xnn_f32_gemm_minmax_ukernel_6x8s4__neon, xnn_init_f32_minmax_scalar_params);
     }
   }
 
-  TEST(F32_GEMM_MINMAX_6X8__NEONFMA_LANE_LD128, k_div_4_subtile) {
-    TEST_REQUIRES_ARM_NEON_FMA;
+  TEST(F32_GEMM_MINMAX_6X8S4__NEON, k_div_4_subtile) {
+    TEST_REQUIRES_ARM_NEON;
     for (size_t k = 8; k <= 40; k += 4) {
       for (uint32_t n = 1; n <= 8; n++) {
         for (uint32_t m = 1; m <= 6; m++) {
@@ -14450,72 +15362,72 @@
             .mr(6)
             .nr(8)
             .kr(1)
-            .sr(1)
+            .sr(4)
             .m(m)
             .n(n)
             .k(k)
             .iterations(1)
-            .Test(xnn_f32_gemm_minmax_ukernel_6x8__neonfma_lane_ld128, xnn_init_f32_minmax_scalar_params);
+            .Test(xnn_f32_gemm_minmax_ukernel_6x8s4__neon, xnn_init_f32_minmax_scalar_params);
         }
       }
     }
   }
 
-  TEST(F32_GEMM_MINMAX_6X8__NEONFMA_LANE_LD128, n_gt_8) {
-    TEST_REQUIRES_ARM_NEON_FMA;
+  TEST(F32_GEMM_MINMAX_6X8S4__NEON, n_gt_8) {
+    TEST_REQUIRES_ARM_NEON;
     for (uint32_t n = 9; n < 16; n++) {
       for (size_t k = 1; k <= 20; k += 5) {
         GemmMicrokernelTester()
           .mr(6)
           .nr(8)
           .kr(1)
-          .sr(1)
+          .sr(4)
           .m(6)
           .n(n)
           .k(k)
-          .Test(xnn_f32_gemm_minmax_ukernel_6x8__neonfma_lane_ld128, xnn_init_f32_minmax_scalar_params);
+          .Test(xnn_f32_gemm_minmax_ukernel_6x8s4__neon, xnn_init_f32_minmax_scalar_params);
       }
     }
   }
 
-  TEST(F32_GEMM_MINMAX_6X8__NEONFMA_LANE_LD128, n_gt_8_strided_cn) {
-    TEST_REQUIRES_ARM_NEON_FMA;
+  TEST(F32_GEMM_MINMAX_6X8S4__NEON, n_gt_8_strided_cn) {
+    TEST_REQUIRES_ARM_NEON;
     for (uint32_t n = 9; n < 16; n++) {
       for (size_t k = 1; k <= 20; k += 5) {
         GemmMicrokernelTester()
           .mr(6)
           .nr(8)
           .kr(1)
-          .sr(1)
+          .sr(4)
           .m(6)
           .n(n)
           .k(k)
           .cn_stride(11)
-          .Test(xnn_f32_gemm_minmax_ukernel_6x8__neonfma_lane_ld128, xnn_init_f32_minmax_scalar_params);
+          .Test(xnn_f32_gemm_minmax_ukernel_6x8s4__neon, xnn_init_f32_minmax_scalar_params);
       }
     }
   }
 
-  TEST(F32_GEMM_MINMAX_6X8__NEONFMA_LANE_LD128, n_gt_8_strided_a) {
-    TEST_REQUIRES_ARM_NEON_FMA;
+  TEST(F32_GEMM_MINMAX_6X8S4__NEON, n_gt_8_strided_a) {
+    TEST_REQUIRES_ARM_NEON;
     for (uint32_t n = 9; n < 16; n++) {
       for (size_t k = 1; k <= 20; k += 5) {
         GemmMicrokernelTester()
           .mr(6)
           .nr(8)
           .kr(1)
-          .sr(1)
+          .sr(4)
           .m(6)
           .n(n)
           .k(k)
           .a_stride(23)
-          .Test(xnn_f32_gemm_minmax_ukernel_6x8__neonfma_lane_ld128, xnn_init_f32_minmax_scalar_params);
+          .Test(xnn_f32_gemm_minmax_ukernel_6x8s4__neon, xnn_init_f32_minmax_scalar_params);
       }
     }
   }
 
-  TEST(F32_GEMM_MINMAX_6X8__NEONFMA_LANE_LD128, n_gt_8_subtile) {
-    TEST_REQUIRES_ARM_NEON_FMA;
+  TEST(F32_GEMM_MINMAX_6X8S4__NEON, n_gt_8_subtile) {
+    TEST_REQUIRES_ARM_NEON;
     for (uint32_t n = 9; n < 16; n++) {
       for (size_t k = 1; k <= 20; k += 5) {
         for (uint32_t m = 1; m <= 6; m++) {
@@ -14523,72 +15435,72 @@
             .mr(6)
             .nr(8)
             .kr(1)
-            .sr(1)
+            .sr(4)
             .m(m)
             .n(n)
             .k(k)
             .iterations(1)
-            .Test(xnn_f32_gemm_minmax_ukernel_6x8__neonfma_lane_ld128, xnn_init_f32_minmax_scalar_params);
+            .Test(xnn_f32_gemm_minmax_ukernel_6x8s4__neon, xnn_init_f32_minmax_scalar_params);
         }
       }
     }
   }
 
-  TEST(F32_GEMM_MINMAX_6X8__NEONFMA_LANE_LD128, n_div_8) {
-    TEST_REQUIRES_ARM_NEON_FMA;
+  TEST(F32_GEMM_MINMAX_6X8S4__NEON, n_div_8) {
+    TEST_REQUIRES_ARM_NEON;
     for (uint32_t n = 16; n <= 24; n += 8) {
       for (size_t k = 1; k <= 20; k += 5) {
         GemmMicrokernelTester()
           .mr(6)
           .nr(8)
           .kr(1)
-          .sr(1)
+          .sr(4)
           .m(6)
           .n(n)
           .k(k)
-          .Test(xnn_f32_gemm_minmax_ukernel_6x8__neonfma_lane_ld128, xnn_init_f32_minmax_scalar_params);
+          .Test(xnn_f32_gemm_minmax_ukernel_6x8s4__neon, xnn_init_f32_minmax_scalar_params);
       }
     }
   }
 
-  TEST(F32_GEMM_MINMAX_6X8__NEONFMA_LANE_LD128, n_div_8_strided_cn) {
-    TEST_REQUIRES_ARM_NEON_FMA;
+  TEST(F32_GEMM_MINMAX_6X8S4__NEON, n_div_8_strided_cn) {
+    TEST_REQUIRES_ARM_NEON;
     for (uint32_t n = 16; n <= 24; n += 8) {
       for (size_t k = 1; k <= 20; k += 5) {
         GemmMicrokernelTester()
           .mr(6)
           .nr(8)
           .kr(1)
-          .sr(1)
+          .sr(4)
           .m(6)
           .n(n)
           .k(k)
           .cn_stride(11)
-          .Test(xnn_f32_gemm_minmax_ukernel_6x8__neonfma_lane_ld128, xnn_init_f32_minmax_scalar_params);
+          .Test(xnn_f32_gemm_minmax_ukernel_6x8s4__neon, xnn_init_f32_minmax_scalar_params);
       }
     }
   }
 
-  TEST(F32_GEMM_MINMAX_6X8__NEONFMA_LANE_LD128, n_div_8_strided_a) {
-    TEST_REQUIRES_ARM_NEON_FMA;
+  TEST(F32_GEMM_MINMAX_6X8S4__NEON, n_div_8_strided_a) {
+    TEST_REQUIRES_ARM_NEON;
     for (uint32_t n = 16; n <= 24; n += 8) {
       for (size_t k = 1; k <= 20; k += 5) {
         GemmMicrokernelTester()
           .mr(6)
           .nr(8)
           .kr(1)
-          .sr(1)
+          .sr(4)
           .m(6)
           .n(n)
           .k(k)
           .a_stride(23)
-          .Test(xnn_f32_gemm_minmax_ukernel_6x8__neonfma_lane_ld128, xnn_init_f32_minmax_scalar_params);
+          .Test(xnn_f32_gemm_minmax_ukernel_6x8s4__neon, xnn_init_f32_minmax_scalar_params);
       }
     }
   }
 
-  TEST(F32_GEMM_MINMAX_6X8__NEONFMA_LANE_LD128, n_div_8_subtile) {
-    TEST_REQUIRES_ARM_NEON_FMA;
+  TEST(F32_GEMM_MINMAX_6X8S4__NEON, n_div_8_subtile) {
+    TEST_REQUIRES_ARM_NEON;
     for (uint32_t n = 16; n <= 24; n += 8) {
       for (size_t k = 1; k <= 20; k += 5) {
         for (uint32_t m = 1; m <= 6; m++) {
@@ -14596,19 +15508,19 @@
             .mr(6)
             .nr(8)
             .kr(1)
-            .sr(1)
+            .sr(4)
             .m(m)
             .n(n)
             .k(k)
             .iterations(1)
-            .Test(xnn_f32_gemm_minmax_ukernel_6x8__neonfma_lane_ld128, xnn_init_f32_minmax_scalar_params);
+            .Test(xnn_f32_gemm_minmax_ukernel_6x8s4__neon, xnn_init_f32_minmax_scalar_params);
         }
       }
     }
   }
 
-  TEST(F32_GEMM_MINMAX_6X8__NEONFMA_LANE_LD128, strided_cm_subtile) {
-    TEST_REQUIRES_ARM_NEON_FMA;
+  TEST(F32_GEMM_MINMAX_6X8S4__NEON, strided_cm_subtile) {
+    TEST_REQUIRES_ARM_NEON;
     for (size_t k = 1; k <= 20; k += 5) {
       for (uint32_t n = 1; n <= 8; n++) {
         for (uint32_t m = 1; m <= 6; m++) {
@@ -14616,110 +15528,110 @@
             .mr(6)
             .nr(8)
             .kr(1)
-            .sr(1)
+            .sr(4)
             .m(m)
             .n(n)
             .k(k)
             .cm_stride(11)
             .iterations(1)
-            .Test(xnn_f32_gemm_minmax_ukernel_6x8__neonfma_lane_ld128, xnn_init_f32_minmax_scalar_params);
+            .Test(xnn_f32_gemm_minmax_ukernel_6x8s4__neon, xnn_init_f32_minmax_scalar_params);
         }
       }
     }
   }
 
-  TEST(F32_GEMM_MINMAX_6X8__NEONFMA_LANE_LD128, qmin) {
-    TEST_REQUIRES_ARM_NEON_FMA;
+  TEST(F32_GEMM_MINMAX_6X8S4__NEON, qmin) {
+    TEST_REQUIRES_ARM_NEON;
     GemmMicrokernelTester()
       .mr(6)
       .nr(8)
       .kr(1)
-      .sr(1)
+      .sr(4)
       .m(6)
       .n(8)
       .k(4)
       .qmin(128)
-      .Test(xnn_f32_gemm_minmax_ukernel_6x8__neonfma_lane_ld128, xnn_init_f32_minmax_scalar_params);
+      .Test(xnn_f32_gemm_minmax_ukernel_6x8s4__neon, xnn_init_f32_minmax_scalar_params);
   }
 
-  TEST(F32_GEMM_MINMAX_6X8__NEONFMA_LANE_LD128, qmax) {
-    TEST_REQUIRES_ARM_NEON_FMA;
+  TEST(F32_GEMM_MINMAX_6X8S4__NEON, qmax) {
+    TEST_REQUIRES_ARM_NEON;
     GemmMicrokernelTester()
       .mr(6)
       .nr(8)
       .kr(1)
-      .sr(1)
+      .sr(4)
       .m(6)
       .n(8)
       .k(4)
       .qmax(128)
-      .Test(xnn_f32_gemm_minmax_ukernel_6x8__neonfma_lane_ld128, xnn_init_f32_minmax_scalar_params);
+      .Test(xnn_f32_gemm_minmax_ukernel_6x8s4__neon, xnn_init_f32_minmax_scalar_params);
   }
 
-  TEST(F32_GEMM_MINMAX_6X8__NEONFMA_LANE_LD128, strided_cm) {
-    TEST_REQUIRES_ARM_NEON_FMA;
+  TEST(F32_GEMM_MINMAX_6X8S4__NEON, strided_cm) {
+    TEST_REQUIRES_ARM_NEON;
     GemmMicrokernelTester()
       .mr(6)
       .nr(8)
       .kr(1)
-      .sr(1)
+      .sr(4)
       .m(6)
       .n(8)
       .k(4)
       .cm_stride(11)
-      .Test(xnn_f32_gemm_minmax_ukernel_6x8__neonfma_lane_ld128, xnn_init_f32_minmax_scalar_params);
+      .Test(xnn_f32_gemm_minmax_ukernel_6x8s4__neon, xnn_init_f32_minmax_scalar_params);
   }
-#endif  // XNN_ARCH_ARM64
+#endif  // XNN_ARCH_ARM || XNN_ARCH_ARM64
 
 
 #if XNN_ARCH_ARM || XNN_ARCH_ARM64
-  TEST(F32_GEMM_MINMAX_6X8S4__NEON, k_eq_4) {
+  TEST(F32_GEMM_MINMAX_8X8S4__NEON, k_eq_4) {
     TEST_REQUIRES_ARM_NEON;
     GemmMicrokernelTester()
-      .mr(6)
+      .mr(8)
       .nr(8)
       .kr(1)
       .sr(4)
-      .m(6)
+      .m(8)
       .n(8)
       .k(4)
-      .Test(xnn_f32_gemm_minmax_ukernel_6x8s4__neon, xnn_init_f32_minmax_scalar_params);
+      .Test(xnn_f32_gemm_minmax_ukernel_8x8s4__neon, xnn_init_f32_minmax_scalar_params);
   }
 
-  TEST(F32_GEMM_MINMAX_6X8S4__NEON, strided_cn) {
+  TEST(F32_GEMM_MINMAX_8X8S4__NEON, strided_cn) {
     TEST_REQUIRES_ARM_NEON;
     GemmMicrokernelTester()
-      .mr(6)
+      .mr(8)
       .nr(8)
       .kr(1)
       .sr(4)
-      .m(6)
+      .m(8)
       .n(8)
       .k(4)
       .cn_stride(11)
-      .Test(xnn_f32_gemm_minmax_ukernel_6x8s4__neon, xnn_init_f32_minmax_scalar_params);
+      .Test(xnn_f32_gemm_minmax_ukernel_8x8s4__neon, xnn_init_f32_minmax_scalar_params);
   }
 
-  TEST(F32_GEMM_MINMAX_6X8S4__NEON, k_eq_4_strided_a) {
+  TEST(F32_GEMM_MINMAX_8X8S4__NEON, k_eq_4_strided_a) {
     TEST_REQUIRES_ARM_NEON;
     GemmMicrokernelTester()
-      .mr(6)
+      .mr(8)
       .nr(8)
       .kr(1)
       .sr(4)
-      .m(6)
+      .m(8)
       .n(8)
       .k(4)
       .a_stride(7)
-      .Test(xnn_f32_gemm_minmax_ukernel_6x8s4__neon, xnn_init_f32_minmax_scalar_params);
+      .Test(xnn_f32_gemm_minmax_ukernel_8x8s4__neon, xnn_init_f32_minmax_scalar_params);
   }
 
-  TEST(F32_GEMM_MINMAX_6X8S4__NEON, k_eq_4_subtile) {
+  TEST(F32_GEMM_MINMAX_8X8S4__NEON, k_eq_4_subtile) {
     TEST_REQUIRES_ARM_NEON;
     for (uint32_t n = 1; n <= 8; n++) {
-      for (uint32_t m = 1; m <= 6; m++) {
+      for (uint32_t m = 1; m <= 8; m++) {
         GemmMicrokernelTester()
-          .mr(6)
+          .mr(8)
           .nr(8)
           .kr(1)
           .sr(4)
@@ -14727,16 +15639,16 @@
           .n(n)
           .k(4)
           .iterations(1)
-          .Test(xnn_f32_gemm_minmax_ukernel_6x8s4__neon, xnn_init_f32_minmax_scalar_params);
+          .Test(xnn_f32_gemm_minmax_ukernel_8x8s4__neon, xnn_init_f32_minmax_scalar_params);
       }
     }
   }
 
-  TEST(F32_GEMM_MINMAX_6X8S4__NEON, k_eq_4_subtile_m) {
+  TEST(F32_GEMM_MINMAX_8X8S4__NEON, k_eq_4_subtile_m) {
     TEST_REQUIRES_ARM_NEON;
-    for (uint32_t m = 1; m <= 6; m++) {
+    for (uint32_t m = 1; m <= 8; m++) {
       GemmMicrokernelTester()
-        .mr(6)
+        .mr(8)
         .nr(8)
         .kr(1)
         .sr(4)
@@ -14744,64 +15656,64 @@
         .n(8)
         .k(4)
         .iterations(1)
-        .Test(xnn_f32_gemm_minmax_ukernel_6x8s4__neon, xnn_init_f32_minmax_scalar_params);
+        .Test(xnn_f32_gemm_minmax_ukernel_8x8s4__neon, xnn_init_f32_minmax_scalar_params);
     }
   }
 
-  TEST(F32_GEMM_MINMAX_6X8S4__NEON, k_eq_4_subtile_n) {
+  TEST(F32_GEMM_MINMAX_8X8S4__NEON, k_eq_4_subtile_n) {
     TEST_REQUIRES_ARM_NEON;
     for (uint32_t n = 1; n <= 8; n++) {
       GemmMicrokernelTester()
-        .mr(6)
+        .mr(8)
         .nr(8)
         .kr(1)
         .sr(4)
-        .m(6)
+        .m(8)
         .n(n)
         .k(4)
         .iterations(1)
-        .Test(xnn_f32_gemm_minmax_ukernel_6x8s4__neon, xnn_init_f32_minmax_scalar_params);
+        .Test(xnn_f32_gemm_minmax_ukernel_8x8s4__neon, xnn_init_f32_minmax_scalar_params);
     }
   }
 
-  TEST(F32_GEMM_MINMAX_6X8S4__NEON, k_lt_4) {
+  TEST(F32_GEMM_MINMAX_8X8S4__NEON, k_lt_4) {
     TEST_REQUIRES_ARM_NEON;
     for (size_t k = 1; k < 4; k++) {
       GemmMicrokernelTester()
-        .mr(6)
+        .mr(8)
         .nr(8)
         .kr(1)
         .sr(4)
-        .m(6)
+        .m(8)
         .n(8)
         .k(k)
-        .Test(xnn_f32_gemm_minmax_ukernel_6x8s4__neon, xnn_init_f32_minmax_scalar_params);
+        .Test(xnn_f32_gemm_minmax_ukernel_8x8s4__neon, xnn_init_f32_minmax_scalar_params);
     }
   }
 
-  TEST(F32_GEMM_MINMAX_6X8S4__NEON, k_lt_4_strided_a) {
+  TEST(F32_GEMM_MINMAX_8X8S4__NEON, k_lt_4_strided_a) {
     TEST_REQUIRES_ARM_NEON;
     for (size_t k = 1; k < 4; k++) {
       GemmMicrokernelTester()
-        .mr(6)
+        .mr(8)
         .nr(8)
         .kr(1)
         .sr(4)
-        .m(6)
+        .m(8)
         .n(8)
         .k(k)
         .a_stride(7)
-        .Test(xnn_f32_gemm_minmax_ukernel_6x8s4__neon, xnn_init_f32_minmax_scalar_params);
+        .Test(xnn_f32_gemm_minmax_ukernel_8x8s4__neon, xnn_init_f32_minmax_scalar_params);
     }
   }
 
-  TEST(F32_GEMM_MINMAX_6X8S4__NEON, k_lt_4_subtile) {
+  TEST(F32_GEMM_MINMAX_8X8S4__NEON, k_lt_4_subtile) {
     TEST_REQUIRES_ARM_NEON;
     for (size_t k = 1; k < 4; k++) {
       for (uint32_t n = 1; n <= 8; n++) {
-        for (uint32_t m = 1; m <= 6; m++) {
+        for (uint32_t m = 1; m <= 8; m++) {
           GemmMicrokernelTester()
-            .mr(6)
+            .mr(8)
             .nr(8)
             .kr(1)
             .sr(4)
@@ -14809,50 +15721,50 @@
             .n(n)
             .k(k)
             .iterations(1)
-            .Test(xnn_f32_gemm_minmax_ukernel_6x8s4__neon, xnn_init_f32_minmax_scalar_params);
+            .Test(xnn_f32_gemm_minmax_ukernel_8x8s4__neon, xnn_init_f32_minmax_scalar_params);
         }
       }
     }
   }
 
-  TEST(F32_GEMM_MINMAX_6X8S4__NEON, k_gt_4) {
+  TEST(F32_GEMM_MINMAX_8X8S4__NEON, k_gt_4) {
     TEST_REQUIRES_ARM_NEON;
     for (size_t k = 5; k < 8; k++) {
       GemmMicrokernelTester()
-        .mr(6)
+        .mr(8)
         .nr(8)
         .kr(1)
         .sr(4)
-        .m(6)
+        .m(8)
         .n(8)
         .k(k)
-        .Test(xnn_f32_gemm_minmax_ukernel_6x8s4__neon, xnn_init_f32_minmax_scalar_params);
+        .Test(xnn_f32_gemm_minmax_ukernel_8x8s4__neon, xnn_init_f32_minmax_scalar_params);
     }
   }
 
-  TEST(F32_GEMM_MINMAX_6X8S4__NEON, k_gt_4_strided_a) {
+  TEST(F32_GEMM_MINMAX_8X8S4__NEON, k_gt_4_strided_a) {
     TEST_REQUIRES_ARM_NEON;
     for (size_t k = 5; k < 8; k++) {
       GemmMicrokernelTester()
-        .mr(6)
+        .mr(8)
         .nr(8)
         .kr(1)
         .sr(4)
-        .m(6)
+        .m(8)
         .n(8)
         .k(k)
         .a_stride(11)
-        .Test(xnn_f32_gemm_minmax_ukernel_6x8s4__neon, xnn_init_f32_minmax_scalar_params);
+        .Test(xnn_f32_gemm_minmax_ukernel_8x8s4__neon, xnn_init_f32_minmax_scalar_params);
     }
   }
 
-  TEST(F32_GEMM_MINMAX_6X8S4__NEON, k_gt_4_subtile) {
+  TEST(F32_GEMM_MINMAX_8X8S4__NEON, k_gt_4_subtile) {
     TEST_REQUIRES_ARM_NEON;
     for (size_t k = 5; k < 8; k++) {
       for (uint32_t n = 1; n <= 8; n++) {
-        for (uint32_t m = 1; m <= 6; m++) {
+        for (uint32_t m = 1; m <= 8; m++) {
           GemmMicrokernelTester()
-            .mr(6)
+            .mr(8)
             .nr(8)
             .kr(1)
             .sr(4)
@@ -14860,50 +15772,50 @@
             .n(n)
             .k(k)
             .iterations(1)
-            .Test(xnn_f32_gemm_minmax_ukernel_6x8s4__neon, xnn_init_f32_minmax_scalar_params);
+            .Test(xnn_f32_gemm_minmax_ukernel_8x8s4__neon, xnn_init_f32_minmax_scalar_params);
         }
       }
     }
   }
 
-  TEST(F32_GEMM_MINMAX_6X8S4__NEON, k_div_4) {
+  TEST(F32_GEMM_MINMAX_8X8S4__NEON, k_div_4) {
     TEST_REQUIRES_ARM_NEON;
     for (size_t k = 8; k <= 40; k += 4) {
       GemmMicrokernelTester()
-        .mr(6)
+        .mr(8)
         .nr(8)
         .kr(1)
         .sr(4)
-        .m(6)
+        .m(8)
         .n(8)
         .k(k)
-        .Test(xnn_f32_gemm_minmax_ukernel_6x8s4__neon, xnn_init_f32_minmax_scalar_params);
+        .Test(xnn_f32_gemm_minmax_ukernel_8x8s4__neon, xnn_init_f32_minmax_scalar_params);
     }
   }
 
-  TEST(F32_GEMM_MINMAX_6X8S4__NEON, k_div_4_strided_a) {
+  TEST(F32_GEMM_MINMAX_8X8S4__NEON, k_div_4_strided_a) {
     TEST_REQUIRES_ARM_NEON;
     for (size_t k = 8; k <= 40; k += 4) {
       GemmMicrokernelTester()
-        .mr(6)
+        .mr(8)
         .nr(8)
         .kr(1)
         .sr(4)
-        .m(6)
+        .m(8)
         .n(8)
         .k(k)
         .a_stride(43)
-        .Test(xnn_f32_gemm_minmax_ukernel_6x8s4__neon, xnn_init_f32_minmax_scalar_params);
+        .Test(xnn_f32_gemm_minmax_ukernel_8x8s4__neon, xnn_init_f32_minmax_scalar_params);
     }
   }
 
-  TEST(F32_GEMM_MINMAX_6X8S4__NEON, k_div_4_subtile) {
+  TEST(F32_GEMM_MINMAX_8X8S4__NEON, k_div_4_subtile) {
     TEST_REQUIRES_ARM_NEON;
     for (size_t k = 8; k <= 40; k += 4) {
       for (uint32_t n = 1; n <= 8; n++) {
-        for (uint32_t m = 1; m <= 6; m++) {
+        for (uint32_t m = 1; m <= 8; m++) {
           GemmMicrokernelTester()
-            .mr(6)
+            .mr(8)
             .nr(8)
             .kr(1)
             .sr(4)
@@ -14911,72 +15823,72 @@
             .n(n)
             .k(k)
             .iterations(1)
-            .Test(xnn_f32_gemm_minmax_ukernel_6x8s4__neon, xnn_init_f32_minmax_scalar_params);
+            .Test(xnn_f32_gemm_minmax_ukernel_8x8s4__neon, xnn_init_f32_minmax_scalar_params);
         }
       }
     }
   }
 
-  TEST(F32_GEMM_MINMAX_6X8S4__NEON, n_gt_8) {
+  TEST(F32_GEMM_MINMAX_8X8S4__NEON, n_gt_8) {
     TEST_REQUIRES_ARM_NEON;
     for (uint32_t n = 9; n < 16; n++) {
       for (size_t k = 1; k <= 20; k += 5) {
         GemmMicrokernelTester()
-          .mr(6)
+          .mr(8)
           .nr(8)
           .kr(1)
           .sr(4)
-          .m(6)
+          .m(8)
           .n(n)
           .k(k)
-          .Test(xnn_f32_gemm_minmax_ukernel_6x8s4__neon, xnn_init_f32_minmax_scalar_params);
+          .Test(xnn_f32_gemm_minmax_ukernel_8x8s4__neon, xnn_init_f32_minmax_scalar_params);
       }
     }
   }
 
-  TEST(F32_GEMM_MINMAX_6X8S4__NEON, n_gt_8_strided_cn) {
+  TEST(F32_GEMM_MINMAX_8X8S4__NEON, n_gt_8_strided_cn) {
     TEST_REQUIRES_ARM_NEON;
     for (uint32_t n = 9; n < 16; n++) {
       for (size_t k = 1; k <= 20; k += 5) {
         GemmMicrokernelTester()
-          .mr(6)
+          .mr(8)
           .nr(8)
           .kr(1)
           .sr(4)
-          .m(6)
+          .m(8)
           .n(n)
           .k(k)
           .cn_stride(11)
-          .Test(xnn_f32_gemm_minmax_ukernel_6x8s4__neon, xnn_init_f32_minmax_scalar_params);
+          .Test(xnn_f32_gemm_minmax_ukernel_8x8s4__neon, xnn_init_f32_minmax_scalar_params);
       }
     }
   }
 
-  TEST(F32_GEMM_MINMAX_6X8S4__NEON, n_gt_8_strided_a) {
+  TEST(F32_GEMM_MINMAX_8X8S4__NEON, n_gt_8_strided_a) {
     TEST_REQUIRES_ARM_NEON;
     for (uint32_t n = 9; n < 16; n++) {
       for (size_t k = 1; k <= 20; k += 5) {
         GemmMicrokernelTester()
-          .mr(6)
+          .mr(8)
           .nr(8)
           .kr(1)
           .sr(4)
-          .m(6)
+          .m(8)
           .n(n)
           .k(k)
           .a_stride(23)
-          .Test(xnn_f32_gemm_minmax_ukernel_6x8s4__neon, xnn_init_f32_minmax_scalar_params);
+          .Test(xnn_f32_gemm_minmax_ukernel_8x8s4__neon, xnn_init_f32_minmax_scalar_params);
       }
     }
   }
 
-  TEST(F32_GEMM_MINMAX_6X8S4__NEON, n_gt_8_subtile) {
+  TEST(F32_GEMM_MINMAX_8X8S4__NEON, n_gt_8_subtile) {
     TEST_REQUIRES_ARM_NEON;
     for (uint32_t n = 9; n < 16; n++) {
       for (size_t k = 1; k <= 20; k += 5) {
-        for (uint32_t m = 1; m <= 6; m++) {
+        for (uint32_t m = 1; m <= 8; m++) {
           GemmMicrokernelTester()
-            .mr(6)
+            .mr(8)
             .nr(8)
             .kr(1)
             .sr(4)
@@ -14984,72 +15896,72 @@
             .n(n)
             .k(k)
             .iterations(1)
-            .Test(xnn_f32_gemm_minmax_ukernel_6x8s4__neon, xnn_init_f32_minmax_scalar_params);
+            .Test(xnn_f32_gemm_minmax_ukernel_8x8s4__neon, xnn_init_f32_minmax_scalar_params);
         }
       }
     }
   }
 
-  TEST(F32_GEMM_MINMAX_6X8S4__NEON, n_div_8) {
+  TEST(F32_GEMM_MINMAX_8X8S4__NEON, n_div_8) {
     TEST_REQUIRES_ARM_NEON;
     for (uint32_t n = 16; n <= 24; n += 8) {
       for (size_t k = 1; k <= 20; k += 5) {
         GemmMicrokernelTester()
-          .mr(6)
+          .mr(8)
           .nr(8)
           .kr(1)
           .sr(4)
-          .m(6)
+          .m(8)
           .n(n)
           .k(k)
-          .Test(xnn_f32_gemm_minmax_ukernel_6x8s4__neon, xnn_init_f32_minmax_scalar_params);
+          .Test(xnn_f32_gemm_minmax_ukernel_8x8s4__neon, xnn_init_f32_minmax_scalar_params);
       }
     }
   }
 
-  TEST(F32_GEMM_MINMAX_6X8S4__NEON, n_div_8_strided_cn) {
+  TEST(F32_GEMM_MINMAX_8X8S4__NEON, n_div_8_strided_cn) {
     TEST_REQUIRES_ARM_NEON;
     for (uint32_t n = 16; n <= 24; n += 8) {
       for (size_t k = 1; k <= 20; k += 5) {
         GemmMicrokernelTester()
-          .mr(6)
+          .mr(8)
           .nr(8)
           .kr(1)
           .sr(4)
-          .m(6)
+          .m(8)
           .n(n)
           .k(k)
           .cn_stride(11)
-          .Test(xnn_f32_gemm_minmax_ukernel_6x8s4__neon, xnn_init_f32_minmax_scalar_params);
+          .Test(xnn_f32_gemm_minmax_ukernel_8x8s4__neon, xnn_init_f32_minmax_scalar_params);
       }
     }
   }
 
-  TEST(F32_GEMM_MINMAX_6X8S4__NEON, n_div_8_strided_a) {
+  TEST(F32_GEMM_MINMAX_8X8S4__NEON, n_div_8_strided_a) {
     TEST_REQUIRES_ARM_NEON;
     for (uint32_t n = 16; n <= 24; n += 8) {
       for (size_t k = 1; k <= 20; k += 5) {
         GemmMicrokernelTester()
-          .mr(6)
+          .mr(8)
           .nr(8)
           .kr(1)
           .sr(4)
-          .m(6)
+          .m(8)
           .n(n)
           .k(k)
           .a_stride(23)
-          .Test(xnn_f32_gemm_minmax_ukernel_6x8s4__neon, xnn_init_f32_minmax_scalar_params);
+          .Test(xnn_f32_gemm_minmax_ukernel_8x8s4__neon, xnn_init_f32_minmax_scalar_params);
       }
     }
   }
 
-  TEST(F32_GEMM_MINMAX_6X8S4__NEON, n_div_8_subtile) {
+  TEST(F32_GEMM_MINMAX_8X8S4__NEON, n_div_8_subtile) {
     TEST_REQUIRES_ARM_NEON;
     for (uint32_t n = 16; n <= 24; n += 8) {
       for (size_t k = 1; k <= 20; k += 5) {
-        for (uint32_t m = 1; m <= 6; m++) {
+        for (uint32_t m = 1; m <= 8; m++) {
           GemmMicrokernelTester()
-            .mr(6)
+            .mr(8)
             .nr(8)
             .kr(1)
             .sr(4)
@@ -15057,19 +15969,19 @@
             .n(n)
             .k(k)
             .iterations(1)
-            .Test(xnn_f32_gemm_minmax_ukernel_6x8s4__neon, xnn_init_f32_minmax_scalar_params);
+            .Test(xnn_f32_gemm_minmax_ukernel_8x8s4__neon, xnn_init_f32_minmax_scalar_params);
         }
       }
     }
   }
 
-  TEST(F32_GEMM_MINMAX_6X8S4__NEON, strided_cm_subtile) {
+  TEST(F32_GEMM_MINMAX_8X8S4__NEON, strided_cm_subtile) {
     TEST_REQUIRES_ARM_NEON;
     for (size_t k = 1; k <= 20; k += 5) {
       for (uint32_t n = 1; n <= 8; n++) {
-        for (uint32_t m = 1; m <= 6; m++) {
+        for (uint32_t m = 1; m <= 8; m++) {
           GemmMicrokernelTester()
-            .mr(6)
+            .mr(8)
             .nr(8)
             .kr(1)
             .sr(4)
@@ -15078,514 +15990,514 @@
             .k(k)
             .cm_stride(11)
             .iterations(1)
-            .Test(xnn_f32_gemm_minmax_ukernel_6x8s4__neon, xnn_init_f32_minmax_scalar_params);
+            .Test(xnn_f32_gemm_minmax_ukernel_8x8s4__neon, xnn_init_f32_minmax_scalar_params);
         }
       }
     }
   }
 
-  TEST(F32_GEMM_MINMAX_6X8S4__NEON, qmin) {
+  TEST(F32_GEMM_MINMAX_8X8S4__NEON, qmin) {
     TEST_REQUIRES_ARM_NEON;
     GemmMicrokernelTester()
-      .mr(6)
+      .mr(8)
       .nr(8)
       .kr(1)
       .sr(4)
-      .m(6)
+      .m(8)
       .n(8)
       .k(4)
       .qmin(128)
-      .Test(xnn_f32_gemm_minmax_ukernel_6x8s4__neon, xnn_init_f32_minmax_scalar_params);
+      .Test(xnn_f32_gemm_minmax_ukernel_8x8s4__neon, xnn_init_f32_minmax_scalar_params);
   }
 
-  TEST(F32_GEMM_MINMAX_6X8S4__NEON, qmax) {
+  TEST(F32_GEMM_MINMAX_8X8S4__NEON, qmax) {
     TEST_REQUIRES_ARM_NEON;
     GemmMicrokernelTester()
-      .mr(6)
+      .mr(8)
       .nr(8)
       .kr(1)
       .sr(4)
-      .m(6)
+      .m(8)
       .n(8)
       .k(4)
       .qmax(128)
-      .Test(xnn_f32_gemm_minmax_ukernel_6x8s4__neon, xnn_init_f32_minmax_scalar_params);
+      .Test(xnn_f32_gemm_minmax_ukernel_8x8s4__neon, xnn_init_f32_minmax_scalar_params);
   }
 
-  TEST(F32_GEMM_MINMAX_6X8S4__NEON, strided_cm) {
+  TEST(F32_GEMM_MINMAX_8X8S4__NEON, strided_cm) {
     TEST_REQUIRES_ARM_NEON;
     GemmMicrokernelTester()
-      .mr(6)
+      .mr(8)
       .nr(8)
       .kr(1)
       .sr(4)
-      .m(6)
+      .m(8)
       .n(8)
       .k(4)
       .cm_stride(11)
-      .Test(xnn_f32_gemm_minmax_ukernel_6x8s4__neon, xnn_init_f32_minmax_scalar_params);
+      .Test(xnn_f32_gemm_minmax_ukernel_8x8s4__neon, xnn_init_f32_minmax_scalar_params);
   }
 #endif  // XNN_ARCH_ARM || XNN_ARCH_ARM64
 
 
-#if XNN_ARCH_ARM || XNN_ARCH_ARM64
-  TEST(F32_GEMM_MINMAX_8X8S4__NEON, k_eq_4) {
-    TEST_REQUIRES_ARM_NEON;
+#if XNN_ARCH_X86 || XNN_ARCH_X86_64
+  TEST(F32_GEMM_MINMAX_1X8__SSE_DUP, k_eq_4) {
+    TEST_REQUIRES_X86_SSE;
     GemmMicrokernelTester()
-      .mr(8)
+      .mr(1)
       .nr(8)
       .kr(1)
-      .sr(4)
-      .m(8)
+      .sr(1)
+      .m(1)
       .n(8)
       .k(4)
-      .Test(xnn_f32_gemm_minmax_ukernel_8x8s4__neon, xnn_init_f32_minmax_scalar_params);
+      .Test(xnn_f32_gemm_minmax_ukernel_1x8__sse_dup, xnn_init_f32_minmax_sse_params);
   }
 
-  TEST(F32_GEMM_MINMAX_8X8S4__NEON, strided_cn) {
-    TEST_REQUIRES_ARM_NEON;
+  TEST(F32_GEMM_MINMAX_1X8__SSE_DUP, strided_cn) {
+    TEST_REQUIRES_X86_SSE;
     GemmMicrokernelTester()
-      .mr(8)
+      .mr(1)
       .nr(8)
       .kr(1)
-      .sr(4)
-      .m(8)
+      .sr(1)
+      .m(1)
       .n(8)
       .k(4)
       .cn_stride(11)
-      .Test(xnn_f32_gemm_minmax_ukernel_8x8s4__neon, xnn_init_f32_minmax_scalar_params);
+      .Test(xnn_f32_gemm_minmax_ukernel_1x8__sse_dup, xnn_init_f32_minmax_sse_params);
   }
 
-  TEST(F32_GEMM_MINMAX_8X8S4__NEON, k_eq_4_strided_a) {
-    TEST_REQUIRES_ARM_NEON;
+  TEST(F32_GEMM_MINMAX_1X8__SSE_DUP, k_eq_4_strided_a) {
+    TEST_REQUIRES_X86_SSE;
     GemmMicrokernelTester()
-      .mr(8)
+      .mr(1)
       .nr(8)
       .kr(1)
-      .sr(4)
-      .m(8)
+      .sr(1)
+      .m(1)
       .n(8)
       .k(4)
       .a_stride(7)
-      .Test(xnn_f32_gemm_minmax_ukernel_8x8s4__neon, xnn_init_f32_minmax_scalar_params);
+      .Test(xnn_f32_gemm_minmax_ukernel_1x8__sse_dup, xnn_init_f32_minmax_sse_params);
   }
 
-  TEST(F32_GEMM_MINMAX_8X8S4__NEON, k_eq_4_subtile) {
-    TEST_REQUIRES_ARM_NEON;
+  TEST(F32_GEMM_MINMAX_1X8__SSE_DUP, k_eq_4_subtile) {
+    TEST_REQUIRES_X86_SSE;
     for (uint32_t n = 1; n <= 8; n++) {
-      for (uint32_t m = 1; m <= 8; m++) {
+      for (uint32_t m = 1; m <= 1; m++) {
         GemmMicrokernelTester()
-          .mr(8)
+          .mr(1)
           .nr(8)
           .kr(1)
-          .sr(4)
+          .sr(1)
           .m(m)
           .n(n)
           .k(4)
           .iterations(1)
-          .Test(xnn_f32_gemm_minmax_ukernel_8x8s4__neon, xnn_init_f32_minmax_scalar_params);
+          .Test(xnn_f32_gemm_minmax_ukernel_1x8__sse_dup, xnn_init_f32_minmax_sse_params);
       }
     }
   }
 
-  TEST(F32_GEMM_MINMAX_8X8S4__NEON, k_eq_4_subtile_m) {
-    TEST_REQUIRES_ARM_NEON;
-    for (uint32_t m = 1; m <= 8; m++) {
+  TEST(F32_GEMM_MINMAX_1X8__SSE_DUP, k_eq_4_subtile_m) {
+    TEST_REQUIRES_X86_SSE;
+    for (uint32_t m = 1; m <= 1; m++) {
       GemmMicrokernelTester()
-        .mr(8)
+        .mr(1)
         .nr(8)
         .kr(1)
-        .sr(4)
+        .sr(1)
         .m(m)
         .n(8)
         .k(4)
         .iterations(1)
-        .Test(xnn_f32_gemm_minmax_ukernel_8x8s4__neon, xnn_init_f32_minmax_scalar_params);
+        .Test(xnn_f32_gemm_minmax_ukernel_1x8__sse_dup, xnn_init_f32_minmax_sse_params);
     }
   }
 
-  TEST(F32_GEMM_MINMAX_8X8S4__NEON, k_eq_4_subtile_n) {
-    TEST_REQUIRES_ARM_NEON;
+  TEST(F32_GEMM_MINMAX_1X8__SSE_DUP, k_eq_4_subtile_n) {
+    TEST_REQUIRES_X86_SSE;
     for (uint32_t n = 1; n <= 8; n++) {
       GemmMicrokernelTester()
-        .mr(8)
+        .mr(1)
         .nr(8)
         .kr(1)
-        .sr(4)
-        .m(8)
+        .sr(1)
+        .m(1)
         .n(n)
         .k(4)
         .iterations(1)
-        .Test(xnn_f32_gemm_minmax_ukernel_8x8s4__neon, xnn_init_f32_minmax_scalar_params);
+        .Test(xnn_f32_gemm_minmax_ukernel_1x8__sse_dup, xnn_init_f32_minmax_sse_params);
     }
   }
 
-  TEST(F32_GEMM_MINMAX_8X8S4__NEON, k_lt_4) {
-    TEST_REQUIRES_ARM_NEON;
+  TEST(F32_GEMM_MINMAX_1X8__SSE_DUP, k_lt_4) {
+    TEST_REQUIRES_X86_SSE;
     for (size_t k = 1; k < 4; k++) {
       GemmMicrokernelTester()
-        .mr(8)
+        .mr(1)
         .nr(8)
         .kr(1)
-        .sr(4)
-        .m(8)
+        .sr(1)
+        .m(1)
         .n(8)
         .k(k)
-        .Test(xnn_f32_gemm_minmax_ukernel_8x8s4__neon, xnn_init_f32_minmax_scalar_params);
+        .Test(xnn_f32_gemm_minmax_ukernel_1x8__sse_dup, xnn_init_f32_minmax_sse_params);
     }
   }
 
-  TEST(F32_GEMM_MINMAX_8X8S4__NEON, k_lt_4_strided_a) {
-    TEST_REQUIRES_ARM_NEON;
+  TEST(F32_GEMM_MINMAX_1X8__SSE_DUP, k_lt_4_strided_a) {
+    TEST_REQUIRES_X86_SSE;
     for (size_t k = 1; k < 4; k++) {
       GemmMicrokernelTester()
-        .mr(8)
+        .mr(1)
         .nr(8)
         .kr(1)
-        .sr(4)
-        .m(8)
+        .sr(1)
+        .m(1)
         .n(8)
         .k(k)
         .a_stride(7)
-        .Test(xnn_f32_gemm_minmax_ukernel_8x8s4__neon, xnn_init_f32_minmax_scalar_params);
+        .Test(xnn_f32_gemm_minmax_ukernel_1x8__sse_dup, xnn_init_f32_minmax_sse_params);
     }
   }
 
-  TEST(F32_GEMM_MINMAX_8X8S4__NEON, k_lt_4_subtile) {
-    TEST_REQUIRES_ARM_NEON;
+  TEST(F32_GEMM_MINMAX_1X8__SSE_DUP, k_lt_4_subtile) {
+    TEST_REQUIRES_X86_SSE;
     for (size_t k = 1; k < 4; k++) {
       for (uint32_t n = 1; n <= 8; n++) {
-        for (uint32_t m = 1; m <= 8; m++) {
+        for (uint32_t m = 1; m <= 1; m++) {
           GemmMicrokernelTester()
-            .mr(8)
+            .mr(1)
             .nr(8)
             .kr(1)
-            .sr(4)
+            .sr(1)
             .m(m)
             .n(n)
             .k(k)
             .iterations(1)
-            .Test(xnn_f32_gemm_minmax_ukernel_8x8s4__neon, xnn_init_f32_minmax_scalar_params);
+            .Test(xnn_f32_gemm_minmax_ukernel_1x8__sse_dup, xnn_init_f32_minmax_sse_params);
         }
       }
     }
   }
 
-  TEST(F32_GEMM_MINMAX_8X8S4__NEON, k_gt_4) {
-    TEST_REQUIRES_ARM_NEON;
+  TEST(F32_GEMM_MINMAX_1X8__SSE_DUP, k_gt_4) {
+    TEST_REQUIRES_X86_SSE;
     for (size_t k = 5; k < 8; k++) {
       GemmMicrokernelTester()
-        .mr(8)
+        .mr(1)
         .nr(8)
         .kr(1)
-        .sr(4)
-        .m(8)
+        .sr(1)
+        .m(1)
         .n(8)
         .k(k)
-        .Test(xnn_f32_gemm_minmax_ukernel_8x8s4__neon, xnn_init_f32_minmax_scalar_params);
+        .Test(xnn_f32_gemm_minmax_ukernel_1x8__sse_dup, xnn_init_f32_minmax_sse_params);
     }
   }
 
-  TEST(F32_GEMM_MINMAX_8X8S4__NEON, k_gt_4_strided_a) {
-    TEST_REQUIRES_ARM_NEON;
+  TEST(F32_GEMM_MINMAX_1X8__SSE_DUP, k_gt_4_strided_a) {
+    TEST_REQUIRES_X86_SSE;
     for (size_t k = 5; k < 8; k++) {
       GemmMicrokernelTester()
-        .mr(8)
+        .mr(1)
         .nr(8)
         .kr(1)
-        .sr(4)
-        .m(8)
+        .sr(1)
+        .m(1)
         .n(8)
         .k(k)
         .a_stride(11)
-        .Test(xnn_f32_gemm_minmax_ukernel_8x8s4__neon, xnn_init_f32_minmax_scalar_params);
+        .Test(xnn_f32_gemm_minmax_ukernel_1x8__sse_dup, xnn_init_f32_minmax_sse_params);
     }
   }
 
-  TEST(F32_GEMM_MINMAX_8X8S4__NEON, k_gt_4_subtile) {
-    TEST_REQUIRES_ARM_NEON;
+  TEST(F32_GEMM_MINMAX_1X8__SSE_DUP, k_gt_4_subtile) {
+    TEST_REQUIRES_X86_SSE;
     for (size_t k = 5; k < 8; k++) {
       for (uint32_t n = 1; n <= 8; n++) {
-        for (uint32_t m = 1; m <= 8; m++) {
+        for (uint32_t m = 1; m <= 1; m++) {
           GemmMicrokernelTester()
-            .mr(8)
+            .mr(1)
             .nr(8)
             .kr(1)
-            .sr(4)
+            .sr(1)
             .m(m)
             .n(n)
             .k(k)
             .iterations(1)
-            .Test(xnn_f32_gemm_minmax_ukernel_8x8s4__neon, xnn_init_f32_minmax_scalar_params);
+            .Test(xnn_f32_gemm_minmax_ukernel_1x8__sse_dup, xnn_init_f32_minmax_sse_params);
         }
       }
     }
   }
 
-  TEST(F32_GEMM_MINMAX_8X8S4__NEON, k_div_4) {
-    TEST_REQUIRES_ARM_NEON;
+  TEST(F32_GEMM_MINMAX_1X8__SSE_DUP, k_div_4) {
+    TEST_REQUIRES_X86_SSE;
     for (size_t k = 8; k <= 40; k += 4) {
       GemmMicrokernelTester()
-        .mr(8)
+        .mr(1)
         .nr(8)
         .kr(1)
-        .sr(4)
-        .m(8)
+        .sr(1)
+        .m(1)
         .n(8)
         .k(k)
-        .Test(xnn_f32_gemm_minmax_ukernel_8x8s4__neon, xnn_init_f32_minmax_scalar_params);
+        .Test(xnn_f32_gemm_minmax_ukernel_1x8__sse_dup, xnn_init_f32_minmax_sse_params);
     }
   }
 
-  TEST(F32_GEMM_MINMAX_8X8S4__NEON, k_div_4_strided_a) {
-    TEST_REQUIRES_ARM_NEON;
+  TEST(F32_GEMM_MINMAX_1X8__SSE_DUP, k_div_4_strided_a) {
+    TEST_REQUIRES_X86_SSE;
     for (size_t k = 8; k <= 40; k += 4) {
       GemmMicrokernelTester()
-        .mr(8)
+        .mr(1)
         .nr(8)
         .kr(1)
-        .sr(4)
-        .m(8)
+        .sr(1)
+        .m(1)
         .n(8)
         .k(k)
         .a_stride(43)
-        .Test(xnn_f32_gemm_minmax_ukernel_8x8s4__neon, xnn_init_f32_minmax_scalar_params);
+        .Test(xnn_f32_gemm_minmax_ukernel_1x8__sse_dup, xnn_init_f32_minmax_sse_params);
     }
   }
 
-  TEST(F32_GEMM_MINMAX_8X8S4__NEON, k_div_4_subtile) {
-    TEST_REQUIRES_ARM_NEON;
+  TEST(F32_GEMM_MINMAX_1X8__SSE_DUP, k_div_4_subtile) {
+    TEST_REQUIRES_X86_SSE;
     for (size_t k = 8; k <= 40; k += 4) {
       for (uint32_t n = 1; n <= 8; n++) {
-        for (uint32_t m = 1; m <= 8; m++) {
+        for (uint32_t m = 1; m <= 1; m++) {
           GemmMicrokernelTester()
-            .mr(8)
+            .mr(1)
             .nr(8)
             .kr(1)
-            .sr(4)
+            .sr(1)
             .m(m)
             .n(n)
             .k(k)
             .iterations(1)
-            .Test(xnn_f32_gemm_minmax_ukernel_8x8s4__neon, xnn_init_f32_minmax_scalar_params);
+            .Test(xnn_f32_gemm_minmax_ukernel_1x8__sse_dup, xnn_init_f32_minmax_sse_params);
         }
       }
     }
   }
 
-  TEST(F32_GEMM_MINMAX_8X8S4__NEON, n_gt_8) {
-    TEST_REQUIRES_ARM_NEON;
+  TEST(F32_GEMM_MINMAX_1X8__SSE_DUP, n_gt_8) {
+    TEST_REQUIRES_X86_SSE;
     for (uint32_t n = 9; n < 16; n++) {
       for (size_t k = 1; k <= 20; k += 5) {
         GemmMicrokernelTester()
-          .mr(8)
+          .mr(1)
           .nr(8)
           .kr(1)
-          .sr(4)
-          .m(8)
+          .sr(1)
+          .m(1)
           .n(n)
           .k(k)
-          .Test(xnn_f32_gemm_minmax_ukernel_8x8s4__neon, xnn_init_f32_minmax_scalar_params);
+          .Test(xnn_f32_gemm_minmax_ukernel_1x8__sse_dup, xnn_init_f32_minmax_sse_params);
       }
     }
   }
 
-  TEST(F32_GEMM_MINMAX_8X8S4__NEON, n_gt_8_strided_cn) {
-    TEST_REQUIRES_ARM_NEON;
+  TEST(F32_GEMM_MINMAX_1X8__SSE_DUP, n_gt_8_strided_cn) {
+    TEST_REQUIRES_X86_SSE;
     for (uint32_t n = 9; n < 16; n++) {
       for (size_t k = 1; k <= 20; k += 5) {
         GemmMicrokernelTester()
-          .mr(8)
+          .mr(1)
           .nr(8)
           .kr(1)
-          .sr(4)
-          .m(8)
+          .sr(1)
+          .m(1)
           .n(n)
           .k(k)
           .cn_stride(11)
-          .Test(xnn_f32_gemm_minmax_ukernel_8x8s4__neon, xnn_init_f32_minmax_scalar_params);
+          .Test(xnn_f32_gemm_minmax_ukernel_1x8__sse_dup, xnn_init_f32_minmax_sse_params);
       }
     }
   }
 
-  TEST(F32_GEMM_MINMAX_8X8S4__NEON, n_gt_8_strided_a) {
-    TEST_REQUIRES_ARM_NEON;
+  TEST(F32_GEMM_MINMAX_1X8__SSE_DUP, n_gt_8_strided_a) {
+    TEST_REQUIRES_X86_SSE;
     for (uint32_t n = 9; n < 16; n++) {
       for (size_t k = 1; k <= 20; k += 5) {
         GemmMicrokernelTester()
-          .mr(8)
+          .mr(1)
           .nr(8)
           .kr(1)
-          .sr(4)
-          .m(8)
+          .sr(1)
+          .m(1)
           .n(n)
           .k(k)
           .a_stride(23)
-          .Test(xnn_f32_gemm_minmax_ukernel_8x8s4__neon, xnn_init_f32_minmax_scalar_params);
+          .Test(xnn_f32_gemm_minmax_ukernel_1x8__sse_dup, xnn_init_f32_minmax_sse_params);
       }
     }
   }
 
-  TEST(F32_GEMM_MINMAX_8X8S4__NEON, n_gt_8_subtile) {
-    TEST_REQUIRES_ARM_NEON;
+  TEST(F32_GEMM_MINMAX_1X8__SSE_DUP, n_gt_8_subtile) {
+    TEST_REQUIRES_X86_SSE;
     for (uint32_t n = 9; n < 16; n++) {
       for (size_t k = 1; k <= 20; k += 5) {
-        for (uint32_t m = 1; m <= 8; m++) {
+        for (uint32_t m = 1; m <= 1; m++) {
           GemmMicrokernelTester()
-            .mr(8)
+            .mr(1)
             .nr(8)
             .kr(1)
-            .sr(4)
+            .sr(1)
             .m(m)
             .n(n)
             .k(k)
             .iterations(1)
-            .Test(xnn_f32_gemm_minmax_ukernel_8x8s4__neon, xnn_init_f32_minmax_scalar_params);
+            .Test(xnn_f32_gemm_minmax_ukernel_1x8__sse_dup, xnn_init_f32_minmax_sse_params);
         }
       }
     }
   }
 
-  TEST(F32_GEMM_MINMAX_8X8S4__NEON, n_div_8) {
-    TEST_REQUIRES_ARM_NEON;
+  TEST(F32_GEMM_MINMAX_1X8__SSE_DUP, n_div_8) {
+    TEST_REQUIRES_X86_SSE;
     for (uint32_t n = 16; n <= 24; n += 8) {
       for (size_t k = 1; k <= 20; k += 5) {
         GemmMicrokernelTester()
-          .mr(8)
+          .mr(1)
           .nr(8)
           .kr(1)
-          .sr(4)
-          .m(8)
+          .sr(1)
+          .m(1)
           .n(n)
           .k(k)
-          .Test(xnn_f32_gemm_minmax_ukernel_8x8s4__neon, xnn_init_f32_minmax_scalar_params);
+          .Test(xnn_f32_gemm_minmax_ukernel_1x8__sse_dup, xnn_init_f32_minmax_sse_params);
       }
     }
   }
 
-  TEST(F32_GEMM_MINMAX_8X8S4__NEON, n_div_8_strided_cn) {
-    TEST_REQUIRES_ARM_NEON;
+  TEST(F32_GEMM_MINMAX_1X8__SSE_DUP, n_div_8_strided_cn) {
+    TEST_REQUIRES_X86_SSE;
     for (uint32_t n = 16; n <= 24; n += 8) {
       for (size_t k = 1; k <= 20; k += 5) {
         GemmMicrokernelTester()
-          .mr(8)
+          .mr(1)
           .nr(8)
           .kr(1)
-          .sr(4)
-          .m(8)
+          .sr(1)
+          .m(1)
           .n(n)
           .k(k)
           .cn_stride(11)
-          .Test(xnn_f32_gemm_minmax_ukernel_8x8s4__neon, xnn_init_f32_minmax_scalar_params);
+          .Test(xnn_f32_gemm_minmax_ukernel_1x8__sse_dup, xnn_init_f32_minmax_sse_params);
       }
     }
   }
 
-  TEST(F32_GEMM_MINMAX_8X8S4__NEON, n_div_8_strided_a) {
-    TEST_REQUIRES_ARM_NEON;
+  TEST(F32_GEMM_MINMAX_1X8__SSE_DUP, n_div_8_strided_a) {
+    TEST_REQUIRES_X86_SSE;
     for (uint32_t n = 16; n <= 24; n += 8) {
       for (size_t k = 1; k <= 20; k += 5) {
         GemmMicrokernelTester()
-          .mr(8)
+          .mr(1)
           .nr(8)
           .kr(1)
-          .sr(4)
-          .m(8)
+          .sr(1)
+          .m(1)
           .n(n)
           .k(k)
           .a_stride(23)
-          .Test(xnn_f32_gemm_minmax_ukernel_8x8s4__neon, xnn_init_f32_minmax_scalar_params);
+          .Test(xnn_f32_gemm_minmax_ukernel_1x8__sse_dup, xnn_init_f32_minmax_sse_params);
       }
     }
   }
 
-  TEST(F32_GEMM_MINMAX_8X8S4__NEON, n_div_8_subtile) {
-    TEST_REQUIRES_ARM_NEON;
+  TEST(F32_GEMM_MINMAX_1X8__SSE_DUP, n_div_8_subtile) {
+    TEST_REQUIRES_X86_SSE;
     for (uint32_t n = 16; n <= 24; n += 8) {
       for (size_t k = 1; k <= 20; k += 5) {
-        for (uint32_t m = 1; m <= 8; m++) {
+        for (uint32_t m = 1; m <= 1; m++) {
           GemmMicrokernelTester()
-            .mr(8)
+            .mr(1)
             .nr(8)
             .kr(1)
-            .sr(4)
+            .sr(1)
             .m(m)
             .n(n)
             .k(k)
             .iterations(1)
-            .Test(xnn_f32_gemm_minmax_ukernel_8x8s4__neon, xnn_init_f32_minmax_scalar_params);
+            .Test(xnn_f32_gemm_minmax_ukernel_1x8__sse_dup, xnn_init_f32_minmax_sse_params);
         }
       }
     }
   }
 
-  TEST(F32_GEMM_MINMAX_8X8S4__NEON, strided_cm_subtile) {
-    TEST_REQUIRES_ARM_NEON;
+  TEST(F32_GEMM_MINMAX_1X8__SSE_DUP, strided_cm_subtile) {
+    TEST_REQUIRES_X86_SSE;
     for (size_t k = 1; k <= 20; k += 5) {
       for (uint32_t n = 1; n <= 8; n++) {
-        for (uint32_t m = 1; m <= 8; m++) {
+        for (uint32_t m = 1; m <= 1; m++) {
           GemmMicrokernelTester()
-            .mr(8)
+            .mr(1)
             .nr(8)
             .kr(1)
-            .sr(4)
+            .sr(1)
             .m(m)
             .n(n)
             .k(k)
             .cm_stride(11)
             .iterations(1)
-            .Test(xnn_f32_gemm_minmax_ukernel_8x8s4__neon, xnn_init_f32_minmax_scalar_params);
+            .Test(xnn_f32_gemm_minmax_ukernel_1x8__sse_dup, xnn_init_f32_minmax_sse_params);
         }
       }
     }
   }
 
-  TEST(F32_GEMM_MINMAX_8X8S4__NEON, qmin) {
-    TEST_REQUIRES_ARM_NEON;
+  TEST(F32_GEMM_MINMAX_1X8__SSE_DUP, qmin) {
+    TEST_REQUIRES_X86_SSE;
     GemmMicrokernelTester()
-      .mr(8)
+      .mr(1)
       .nr(8)
       .kr(1)
-      .sr(4)
-      .m(8)
+      .sr(1)
+      .m(1)
       .n(8)
       .k(4)
       .qmin(128)
-      .Test(xnn_f32_gemm_minmax_ukernel_8x8s4__neon, xnn_init_f32_minmax_scalar_params);
+      .Test(xnn_f32_gemm_minmax_ukernel_1x8__sse_dup, xnn_init_f32_minmax_sse_params);
   }
 
-  TEST(F32_GEMM_MINMAX_8X8S4__NEON, qmax) {
-    TEST_REQUIRES_ARM_NEON;
+  TEST(F32_GEMM_MINMAX_1X8__SSE_DUP, qmax) {
+    TEST_REQUIRES_X86_SSE;
     GemmMicrokernelTester()
-      .mr(8)
+      .mr(1)
       .nr(8)
       .kr(1)
-      .sr(4)
-      .m(8)
+      .sr(1)
+      .m(1)
       .n(8)
       .k(4)
       .qmax(128)
-      .Test(xnn_f32_gemm_minmax_ukernel_8x8s4__neon, xnn_init_f32_minmax_scalar_params);
+      .Test(xnn_f32_gemm_minmax_ukernel_1x8__sse_dup, xnn_init_f32_minmax_sse_params);
   }
 
-  TEST(F32_GEMM_MINMAX_8X8S4__NEON, strided_cm) {
-    TEST_REQUIRES_ARM_NEON;
+  TEST(F32_GEMM_MINMAX_1X8__SSE_DUP, strided_cm) {
+    TEST_REQUIRES_X86_SSE;
     GemmMicrokernelTester()
-      .mr(8)
+      .mr(1)
       .nr(8)
       .kr(1)
-      .sr(4)
-      .m(8)
+      .sr(1)
+      .m(1)
       .n(8)
       .k(4)
       .cm_stride(11)
-      .Test(xnn_f32_gemm_minmax_ukernel_8x8s4__neon, xnn_init_f32_minmax_scalar_params);
+      .Test(xnn_f32_gemm_minmax_ukernel_1x8__sse_dup, xnn_init_f32_minmax_sse_params);
   }
-#endif  // XNN_ARCH_ARM || XNN_ARCH_ARM64
+#endif  // XNN_ARCH_X86 || XNN_ARCH_X86_64
 
 
 #if XNN_ARCH_X86 || XNN_ARCH_X86_64
-  TEST(F32_GEMM_MINMAX_1X8__SSE_DUP, k_eq_4) {
+  TEST(F32_GEMM_MINMAX_1X8__SSE_DUP_ACC4, k_eq_4) {
     TEST_REQUIRES_X86_SSE;
     GemmMicrokernelTester()
       .mr(1)
@@ -15595,10 +16507,10 @@
       .m(1)
       .n(8)
       .k(4)
-      .Test(xnn_f32_gemm_minmax_ukernel_1x8__sse_dup, xnn_init_f32_minmax_sse_params);
+      .Test(xnn_f32_gemm_minmax_ukernel_1x8__sse_dup_acc4, xnn_init_f32_minmax_sse_params);
   }
 
-  TEST(F32_GEMM_MINMAX_1X8__SSE_DUP, strided_cn) {
+  TEST(F32_GEMM_MINMAX_1X8__SSE_DUP_ACC4, strided_cn) {
     TEST_REQUIRES_X86_SSE;
     GemmMicrokernelTester()
       .mr(1)
@@ -15609,10 +16521,10 @@
       .n(8)
       .k(4)
       .cn_stride(11)
-      .Test(xnn_f32_gemm_minmax_ukernel_1x8__sse_dup, xnn_init_f32_minmax_sse_params);
+      .Test(xnn_f32_gemm_minmax_ukernel_1x8__sse_dup_acc4, xnn_init_f32_minmax_sse_params);
   }
 
-  TEST(F32_GEMM_MINMAX_1X8__SSE_DUP, k_eq_4_strided_a) {
+  TEST(F32_GEMM_MINMAX_1X8__SSE_DUP_ACC4, k_eq_4_strided_a) {
     TEST_REQUIRES_X86_SSE;
     GemmMicrokernelTester()
       .mr(1)
@@ -15623,10 +16535,10 @@
       .n(8)
       .k(4)
       .a_stride(7)
-      .Test(xnn_f32_gemm_minmax_ukernel_1x8__sse_dup, xnn_init_f32_minmax_sse_params);
+      .Test(xnn_f32_gemm_minmax_ukernel_1x8__sse_dup_acc4, xnn_init_f32_minmax_sse_params);
   }
 
-  TEST(F32_GEMM_MINMAX_1X8__SSE_DUP, k_eq_4_subtile) {
+  TEST(F32_GEMM_MINMAX_1X8__SSE_DUP_ACC4, k_eq_4_subtile) {
     TEST_REQUIRES_X86_SSE;
     for (uint32_t n = 1; n <= 8; n++) {
       for (uint32_t m = 1; m <= 1; m++) {
@@ -15639,12 +16551,12 @@
           .n(n)
           .k(4)
           .iterations(1)
-          .Test(xnn_f32_gemm_minmax_ukernel_1x8__sse_dup, xnn_init_f32_minmax_sse_params);
+          .Test(xnn_f32_gemm_minmax_ukernel_1x8__sse_dup_acc4, xnn_init_f32_minmax_sse_params);
       }
     }
   }
 
-  TEST(F32_GEMM_MINMAX_1X8__SSE_DUP, k_eq_4_subtile_m) {
+  TEST(F32_GEMM_MINMAX_1X8__SSE_DUP_ACC4, k_eq_4_subtile_m) {
     TEST_REQUIRES_X86_SSE;
     for (uint32_t m = 1; m <= 1; m++) {
       GemmMicrokernelTester()
@@ -15656,11 +16568,11 @@
         .n(8)
         .k(4)
         .iterations(1)
-        .Test(xnn_f32_gemm_minmax_ukernel_1x8__sse_dup, xnn_init_f32_minmax_sse_params);
+        .Test(xnn_f32_gemm_minmax_ukernel_1x8__sse_dup_acc4, xnn_init_f32_minmax_sse_params);
     }
   }
 
-  TEST(F32_GEMM_MINMAX_1X8__SSE_DUP, k_eq_4_subtile_n) {
+  TEST(F32_GEMM_MINMAX_1X8__SSE_DUP_ACC4, k_eq_4_subtile_n) {
     TEST_REQUIRES_X86_SSE;
     for (uint32_t n = 1; n <= 8; n++) {
       GemmMicrokernelTester()
@@ -15672,11 +16584,11 @@
         .n(n)
         .k(4)
         .iterations(1)
-        .Test(xnn_f32_gemm_minmax_ukernel_1x8__sse_dup, xnn_init_f32_minmax_sse_params);
+        .Test(xnn_f32_gemm_minmax_ukernel_1x8__sse_dup_acc4, xnn_init_f32_minmax_sse_params);
     }
   }
 
-  TEST(F32_GEMM_MINMAX_1X8__SSE_DUP, k_lt_4) {
+  TEST(F32_GEMM_MINMAX_1X8__SSE_DUP_ACC4, k_lt_4) {
     TEST_REQUIRES_X86_SSE;
     for (size_t k = 1; k < 4; k++) {
       GemmMicrokernelTester()
@@ -15687,11 +16599,11 @@
         .m(1)
         .n(8)
         .k(k)
-        .Test(xnn_f32_gemm_minmax_ukernel_1x8__sse_dup, xnn_init_f32_minmax_sse_params);
+        .Test(xnn_f32_gemm_minmax_ukernel_1x8__sse_dup_acc4, xnn_init_f32_minmax_sse_params);
     }
   }
 
-  TEST(F32_GEMM_MINMAX_1X8__SSE_DUP, k_lt_4_strided_a) {
+  TEST(F32_GEMM_MINMAX_1X8__SSE_DUP_ACC4, k_lt_4_strided_a) {
     TEST_REQUIRES_X86_SSE;
     for (size_t k = 1; k < 4; k++) {
       GemmMicrokernelTester()
@@ -15703,11 +16615,11 @@
         .n(8)
         .k(k)
         .a_stride(7)
-        .Test(xnn_f32_gemm_minmax_ukernel_1x8__sse_dup, xnn_init_f32_minmax_sse_params);
+        .Test(xnn_f32_gemm_minmax_ukernel_1x8__sse_dup_acc4, xnn_init_f32_minmax_sse_params);
     }
   }
 
-  TEST(F32_GEMM_MINMAX_1X8__SSE_DUP, k_lt_4_subtile) {
+  TEST(F32_GEMM_MINMAX_1X8__SSE_DUP_ACC4, k_lt_4_subtile) {
     TEST_REQUIRES_X86_SSE;
     for (size_t k = 1; k < 4; k++) {
       for (uint32_t n = 1; n <= 8; n++) {
@@ -15721,13 +16633,13 @@
             .n(n)
             .k(k)
             .iterations(1)
-            .Test(xnn_f32_gemm_minmax_ukernel_1x8__sse_dup, xnn_init_f32_minmax_sse_params);
+            .Test(xnn_f32_gemm_minmax_ukernel_1x8__sse_dup_acc4, xnn_init_f32_minmax_sse_params);
         }
       }
     }
   }
 
-  TEST(F32_GEMM_MINMAX_1X8__SSE_DUP, k_gt_4) {
+  TEST(F32_GEMM_MINMAX_1X8__SSE_DUP_ACC4, k_gt_4) {
     TEST_REQUIRES_X86_SSE;
     for (size_t k = 5; k < 8; k++) {
       GemmMicrokernelTester()
@@ -15738,11 +16650,11 @@
         .m(1)
         .n(8)
         .k(k)
-        .Test(xnn_f32_gemm_minmax_ukernel_1x8__sse_dup, xnn_init_f32_minmax_sse_params);
+        .Test(xnn_f32_gemm_minmax_ukernel_1x8__sse_dup_acc4, xnn_init_f32_minmax_sse_params);
     }
   }
 
-  TEST(F32_GEMM_MINMAX_1X8__SSE_DUP, k_gt_4_strided_a) {
+  TEST(F32_GEMM_MINMAX_1X8__SSE_DUP_ACC4, k_gt_4_strided_a) {
     TEST_REQUIRES_X86_SSE;
     for (size_t k = 5; k < 8; k++) {
       GemmMicrokernelTester()
@@ -15754,11 +16666,11 @@
         .n(8)
         .k(k)
         .a_stride(11)
-        .Test(xnn_f32_gemm_minmax_ukernel_1x8__sse_dup, xnn_init_f32_minmax_sse_params);
+        .Test(xnn_f32_gemm_minmax_ukernel_1x8__sse_dup_acc4, xnn_init_f32_minmax_sse_params);
     }
   }
 
-  TEST(F32_GEMM_MINMAX_1X8__SSE_DUP, k_gt_4_subtile) {
+  TEST(F32_GEMM_MINMAX_1X8__SSE_DUP_ACC4, k_gt_4_subtile) {
     TEST_REQUIRES_X86_SSE;
     for (size_t k = 5; k < 8; k++) {
       for (uint32_t n = 1; n <= 8; n++) {
@@ -15772,13 +16684,13 @@
             .n(n)
             .k(k)
             .iterations(1)
-            .Test(xnn_f32_gemm_minmax_ukernel_1x8__sse_dup, xnn_init_f32_minmax_sse_params);
+            .Test(xnn_f32_gemm_minmax_ukernel_1x8__sse_dup_acc4, xnn_init_f32_minmax_sse_params);
         }
       }
     }
   }
 
-  TEST(F32_GEMM_MINMAX_1X8__SSE_DUP, k_div_4) {
+  TEST(F32_GEMM_MINMAX_1X8__SSE_DUP_ACC4, k_div_4) {
     TEST_REQUIRES_X86_SSE;
     for (size_t k = 8; k <= 40; k += 4) {
       GemmMicrokernelTester()
@@ -15789,11 +16701,11 @@
         .m(1)
         .n(8)
         .k(k)
-        .Test(xnn_f32_gemm_minmax_ukernel_1x8__sse_dup, xnn_init_f32_minmax_sse_params);
+        .Test(xnn_f32_gemm_minmax_ukernel_1x8__sse_dup_acc4, xnn_init_f32_minmax_sse_params);
     }
   }
 
-  TEST(F32_GEMM_MINMAX_1X8__SSE_DUP, k_div_4_strided_a) {
+  TEST(F32_GEMM_MINMAX_1X8__SSE_DUP_ACC4, k_div_4_strided_a) {
     TEST_REQUIRES_X86_SSE;
     for (size_t k = 8; k <= 40; k += 4) {
       GemmMicrokernelTester()
@@ -15805,11 +16717,11 @@
         .n(8)
         .k(k)
         .a_stride(43)
-        .Test(xnn_f32_gemm_minmax_ukernel_1x8__sse_dup, xnn_init_f32_minmax_sse_params);
+        .Test(xnn_f32_gemm_minmax_ukernel_1x8__sse_dup_acc4, xnn_init_f32_minmax_sse_params);
     }
   }
 
-  TEST(F32_GEMM_MINMAX_1X8__SSE_DUP, k_div_4_subtile) {
+  TEST(F32_GEMM_MINMAX_1X8__SSE_DUP_ACC4, k_div_4_subtile) {
     TEST_REQUIRES_X86_SSE;
     for (size_t k = 8; k <= 40; k += 4) {
       for (uint32_t n = 1; n <= 8; n++) {
@@ -15823,13 +16735,13 @@
             .n(n)
             .k(k)
             .iterations(1)
-            .Test(xnn_f32_gemm_minmax_ukernel_1x8__sse_dup, xnn_init_f32_minmax_sse_params);
+            .Test(xnn_f32_gemm_minmax_ukernel_1x8__sse_dup_acc4, xnn_init_f32_minmax_sse_params);
         }
       }
     }
   }
 
-  TEST(F32_GEMM_MINMAX_1X8__SSE_DUP, n_gt_8) {
+  TEST(F32_GEMM_MINMAX_1X8__SSE_DUP_ACC4, n_gt_8) {
     TEST_REQUIRES_X86_SSE;
     for (uint32_t n = 9; n < 16; n++) {
       for (size_t k = 1; k <= 20; k += 5) {
@@ -15841,12 +16753,12 @@
           .m(1)
           .n(n)
           .k(k)
-          .Test(xnn_f32_gemm_minmax_ukernel_1x8__sse_dup, xnn_init_f32_minmax_sse_params);
+          .Test(xnn_f32_gemm_minmax_ukernel_1x8__sse_dup_acc4, xnn_init_f32_minmax_sse_params);
       }
     }
   }
 
-  TEST(F32_GEMM_MINMAX_1X8__SSE_DUP, n_gt_8_strided_cn) {
+  TEST(F32_GEMM_MINMAX_1X8__SSE_DUP_ACC4, n_gt_8_strided_cn) {
     TEST_REQUIRES_X86_SSE;
     for (uint32_t n = 9; n < 16; n++) {
       for (size_t k = 1; k <= 20; k += 5) {
@@ -15859,12 +16771,12 @@
           .n(n)
           .k(k)
           .cn_stride(11)
-          .Test(xnn_f32_gemm_minmax_ukernel_1x8__sse_dup, xnn_init_f32_minmax_sse_params);
+          .Test(xnn_f32_gemm_minmax_ukernel_1x8__sse_dup_acc4, xnn_init_f32_minmax_sse_params);
       }
     }
   }
 
-  TEST(F32_GEMM_MINMAX_1X8__SSE_DUP, n_gt_8_strided_a) {
+  TEST(F32_GEMM_MINMAX_1X8__SSE_DUP_ACC4, n_gt_8_strided_a) {
     TEST_REQUIRES_X86_SSE;
     for (uint32_t n = 9; n < 16; n++) {
       for (size_t k = 1; k <= 20; k += 5) {
@@ -15877,12 +16789,12 @@
           .n(n)
           .k(k)
           .a_stride(23)
-          .Test(xnn_f32_gemm_minmax_ukernel_1x8__sse_dup, xnn_init_f32_minmax_sse_params);
+          .Test(xnn_f32_gemm_minmax_ukernel_1x8__sse_dup_acc4, xnn_init_f32_minmax_sse_params);
       }
     }
   }
 
-  TEST(F32_GEMM_MINMAX_1X8__SSE_DUP, n_gt_8_subtile) {
+  TEST(F32_GEMM_MINMAX_1X8__SSE_DUP_ACC4, n_gt_8_subtile) {
     TEST_REQUIRES_X86_SSE;
     for (uint32_t n = 9; n < 16; n++) {
       for (size_t k = 1; k <= 20; k += 5) {
@@ -15896,13 +16808,13 @@
             .n(n)
             .k(k)
             .iterations(1)
-            .Test(xnn_f32_gemm_minmax_ukernel_1x8__sse_dup, xnn_init_f32_minmax_sse_params);
+            .Test(xnn_f32_gemm_minmax_ukernel_1x8__sse_dup_acc4, xnn_init_f32_minmax_sse_params);
         }
       }
     }
   }
 
-  TEST(F32_GEMM_MINMAX_1X8__SSE_DUP, n_div_8) {
+  TEST(F32_GEMM_MINMAX_1X8__SSE_DUP_ACC4, n_div_8) {
     TEST_REQUIRES_X86_SSE;
     for (uint32_t n = 16; n <= 24; n += 8) {
       for (size_t k = 1; k <= 20; k += 5) {
@@ -15914,12 +16826,12 @@
           .m(1)
           .n(n)
           .k(k)
-          .Test(xnn_f32_gemm_minmax_ukernel_1x8__sse_dup, xnn_init_f32_minmax_sse_params);
+          .Test(xnn_f32_gemm_minmax_ukernel_1x8__sse_dup_acc4, xnn_init_f32_minmax_sse_params);
       }
     }
   }
 
-  TEST(F32_GEMM_MINMAX_1X8__SSE_DUP, n_div_8_strided_cn) {
+  TEST(F32_GEMM_MINMAX_1X8__SSE_DUP_ACC4, n_div_8_strided_cn) {
     TEST_REQUIRES_X86_SSE;
     for (uint32_t n = 16; n <= 24; n += 8) {
       for (size_t k = 1; k <= 20; k += 5) {
@@ -15932,12 +16844,12 @@
           .n(n)
           .k(k)
           .cn_stride(11)
-          .Test(xnn_f32_gemm_minmax_ukernel_1x8__sse_dup, xnn_init_f32_minmax_sse_params);
+          .Test(xnn_f32_gemm_minmax_ukernel_1x8__sse_dup_acc4, xnn_init_f32_minmax_sse_params);
       }
     }
   }
 
-  TEST(F32_GEMM_MINMAX_1X8__SSE_DUP, n_div_8_strided_a) {
+  TEST(F32_GEMM_MINMAX_1X8__SSE_DUP_ACC4, n_div_8_strided_a) {
     TEST_REQUIRES_X86_SSE;
     for (uint32_t n = 16; n <= 24; n += 8) {
       for (size_t k = 1; k <= 20; k += 5) {
@@ -15950,12 +16862,12 @@
           .n(n)
           .k(k)
           .a_stride(23)
-          .Test(xnn_f32_gemm_minmax_ukernel_1x8__sse_dup, xnn_init_f32_minmax_sse_params);
+          .Test(xnn_f32_gemm_minmax_ukernel_1x8__sse_dup_acc4, xnn_init_f32_minmax_sse_params);
       }
     }
   }
 
-  TEST(F32_GEMM_MINMAX_1X8__SSE_DUP, n_div_8_subtile) {
+  TEST(F32_GEMM_MINMAX_1X8__SSE_DUP_ACC4, n_div_8_subtile) {
     TEST_REQUIRES_X86_SSE;
     for (uint32_t n = 16; n <= 24; n += 8) {
       for (size_t k = 1; k <= 20; k += 5) {
@@ -15969,13 +16881,13 @@
             .n(n)
             .k(k)
             .iterations(1)
-            .Test(xnn_f32_gemm_minmax_ukernel_1x8__sse_dup, xnn_init_f32_minmax_sse_params);
+            .Test(xnn_f32_gemm_minmax_ukernel_1x8__sse_dup_acc4, xnn_init_f32_minmax_sse_params);
         }
       }
     }
   }
 
-  TEST(F32_GEMM_MINMAX_1X8__SSE_DUP, strided_cm_subtile) {
+  TEST(F32_GEMM_MINMAX_1X8__SSE_DUP_ACC4, strided_cm_subtile) {
     TEST_REQUIRES_X86_SSE;
     for (size_t k = 1; k <= 20; k += 5) {
       for (uint32_t n = 1; n <= 8; n++) {
@@ -15990,13 +16902,13 @@
             .k(k)
             .cm_stride(11)
             .iterations(1)
-            .Test(xnn_f32_gemm_minmax_ukernel_1x8__sse_dup, xnn_init_f32_minmax_sse_params);
+            .Test(xnn_f32_gemm_minmax_ukernel_1x8__sse_dup_acc4, xnn_init_f32_minmax_sse_params);
         }
       }
     }
   }
 
-  TEST(F32_GEMM_MINMAX_1X8__SSE_DUP, qmin) {
+  TEST(F32_GEMM_MINMAX_1X8__SSE_DUP_ACC4, qmin) {
     TEST_REQUIRES_X86_SSE;
     GemmMicrokernelTester()
       .mr(1)
@@ -16007,10 +16919,10 @@
       .n(8)
       .k(4)
       .qmin(128)
-      .Test(xnn_f32_gemm_minmax_ukernel_1x8__sse_dup, xnn_init_f32_minmax_sse_params);
+      .Test(xnn_f32_gemm_minmax_ukernel_1x8__sse_dup_acc4, xnn_init_f32_minmax_sse_params);
   }
 
-  TEST(F32_GEMM_MINMAX_1X8__SSE_DUP, qmax) {
+  TEST(F32_GEMM_MINMAX_1X8__SSE_DUP_ACC4, qmax) {
     TEST_REQUIRES_X86_SSE;
     GemmMicrokernelTester()
       .mr(1)
@@ -16021,10 +16933,10 @@
       .n(8)
       .k(4)
       .qmax(128)
-      .Test(xnn_f32_gemm_minmax_ukernel_1x8__sse_dup, xnn_init_f32_minmax_sse_params);
+      .Test(xnn_f32_gemm_minmax_ukernel_1x8__sse_dup_acc4, xnn_init_f32_minmax_sse_params);
   }
 
-  TEST(F32_GEMM_MINMAX_1X8__SSE_DUP, strided_cm) {
+  TEST(F32_GEMM_MINMAX_1X8__SSE_DUP_ACC4, strided_cm) {
     TEST_REQUIRES_X86_SSE;
     GemmMicrokernelTester()
       .mr(1)
@@ -16035,7 +16947,7 @@
       .n(8)
       .k(4)
       .cm_stride(11)
-      .Test(xnn_f32_gemm_minmax_ukernel_1x8__sse_dup, xnn_init_f32_minmax_sse_params);
+      .Test(xnn_f32_gemm_minmax_ukernel_1x8__sse_dup_acc4, xnn_init_f32_minmax_sse_params);
   }
 #endif  // XNN_ARCH_X86 || XNN_ARCH_X86_64
 
@@ -7815,130 +7815,130 @@
 
 
 #if XNN_ARCH_ARM || XNN_ARCH_ARM64
-  TEST(F32_GEMM_MINMAX_1X8S4__NEON, k_eq_4) {
-    TEST_REQUIRES_ARM_NEON;
+  TEST(F32_GEMM_MINMAX_1X8__NEONFMA_DUP_ACC4, k_eq_4) {
+    TEST_REQUIRES_ARM_NEON_FMA;
     GemmMicrokernelTester()
       .mr(1)
       .nr(8)
       .kr(1)
-      .sr(4)
+      .sr(1)
       .m(1)
       .n(8)
       .k(4)
-      .Test(xnn_f32_gemm_minmax_ukernel_1x8s4__neon, xnn_init_f32_minmax_scalar_params);
+      .Test(xnn_f32_gemm_minmax_ukernel_1x8__neonfma_dup_acc4, xnn_init_f32_minmax_scalar_params);
   }
 
-  TEST(F32_GEMM_MINMAX_1X8S4__NEON, strided_cn) {
-    TEST_REQUIRES_ARM_NEON;
+  TEST(F32_GEMM_MINMAX_1X8__NEONFMA_DUP_ACC4, strided_cn) {
+    TEST_REQUIRES_ARM_NEON_FMA;
     GemmMicrokernelTester()
       .mr(1)
       .nr(8)
       .kr(1)
-      .sr(4)
+      .sr(1)
       .m(1)
       .n(8)
       .k(4)
       .cn_stride(11)
-      .Test(xnn_f32_gemm_minmax_ukernel_1x8s4__neon, xnn_init_f32_minmax_scalar_params);
+      .Test(xnn_f32_gemm_minmax_ukernel_1x8__neonfma_dup_acc4, xnn_init_f32_minmax_scalar_params);
   }
 
-  TEST(F32_GEMM_MINMAX_1X8S4__NEON, k_eq_4_strided_a) {
-    TEST_REQUIRES_ARM_NEON;
+  TEST(F32_GEMM_MINMAX_1X8__NEONFMA_DUP_ACC4, k_eq_4_strided_a) {
+    TEST_REQUIRES_ARM_NEON_FMA;
     GemmMicrokernelTester()
       .mr(1)
       .nr(8)
       .kr(1)
-      .sr(4)
+      .sr(1)
       .m(1)
       .n(8)
       .k(4)
       .a_stride(7)
-      .Test(xnn_f32_gemm_minmax_ukernel_1x8s4__neon, xnn_init_f32_minmax_scalar_params);
+      .Test(xnn_f32_gemm_minmax_ukernel_1x8__neonfma_dup_acc4, xnn_init_f32_minmax_scalar_params);
   }
 
-  TEST(F32_GEMM_MINMAX_1X8S4__NEON, k_eq_4_subtile) {
-    TEST_REQUIRES_ARM_NEON;
+  TEST(F32_GEMM_MINMAX_1X8__NEONFMA_DUP_ACC4, k_eq_4_subtile) {
+    TEST_REQUIRES_ARM_NEON_FMA;
     for (uint32_t n = 1; n <= 8; n++) {
       for (uint32_t m = 1; m <= 1; m++) {
         GemmMicrokernelTester()
           .mr(1)
           .nr(8)
           .kr(1)
-          .sr(4)
+          .sr(1)
           .m(m)
           .n(n)
           .k(4)
           .iterations(1)
-          .Test(xnn_f32_gemm_minmax_ukernel_1x8s4__neon, xnn_init_f32_minmax_scalar_params);
+          .Test(xnn_f32_gemm_minmax_ukernel_1x8__neonfma_dup_acc4, xnn_init_f32_minmax_scalar_params);
       }
     }
   }
 
-  TEST(F32_GEMM_MINMAX_1X8S4__NEON, k_eq_4_subtile_m) {
-    TEST_REQUIRES_ARM_NEON;
+  TEST(F32_GEMM_MINMAX_1X8__NEONFMA_DUP_ACC4, k_eq_4_subtile_m) {
+    TEST_REQUIRES_ARM_NEON_FMA;
     for (uint32_t m = 1; m <= 1; m++) {
       GemmMicrokernelTester()
         .mr(1)
         .nr(8)
         .kr(1)
-        .sr(4)
+        .sr(1)
         .m(m)
         .n(8)
         .k(4)
         .iterations(1)
-        .Test(xnn_f32_gemm_minmax_ukernel_1x8s4__neon, xnn_init_f32_minmax_scalar_params);
+        .Test(xnn_f32_gemm_minmax_ukernel_1x8__neonfma_dup_acc4, xnn_init_f32_minmax_scalar_params);
     }
   }
 
-  TEST(F32_GEMM_MINMAX_1X8S4__NEON, k_eq_4_subtile_n) {
-    TEST_REQUIRES_ARM_NEON;
+  TEST(F32_GEMM_MINMAX_1X8__NEONFMA_DUP_ACC4, k_eq_4_subtile_n) {
+    TEST_REQUIRES_ARM_NEON_FMA;
     for (uint32_t n = 1; n <= 8; n++) {
       GemmMicrokernelTester()
         .mr(1)
         .nr(8)
         .kr(1)
-        .sr(4)
+        .sr(1)
         .m(1)
         .n(n)
         .k(4)
         .iterations(1)
-        .Test(xnn_f32_gemm_minmax_ukernel_1x8s4__neon, xnn_init_f32_minmax_scalar_params);
+        .Test(xnn_f32_gemm_minmax_ukernel_1x8__neonfma_dup_acc4, xnn_init_f32_minmax_scalar_params);
     }
   }
 
-  TEST(F32_GEMM_MINMAX_1X8S4__NEON, k_lt_4) {
-    TEST_REQUIRES_ARM_NEON;
+  TEST(F32_GEMM_MINMAX_1X8__NEONFMA_DUP_ACC4, k_lt_4) {
+    TEST_REQUIRES_ARM_NEON_FMA;
     for (size_t k = 1; k < 4; k++) {
       GemmMicrokernelTester()
         .mr(1)
         .nr(8)
         .kr(1)
-        .sr(4)
+        .sr(1)
         .m(1)
         .n(8)
         .k(k)
-        .Test(xnn_f32_gemm_minmax_ukernel_1x8s4__neon, xnn_init_f32_minmax_scalar_params);
+        .Test(xnn_f32_gemm_minmax_ukernel_1x8__neonfma_dup_acc4, xnn_init_f32_minmax_scalar_params);
     }
   }
 
-  TEST(F32_GEMM_MINMAX_1X8S4__NEON, k_lt_4_strided_a) {
-    TEST_REQUIRES_ARM_NEON;
+  TEST(F32_GEMM_MINMAX_1X8__NEONFMA_DUP_ACC4, k_lt_4_strided_a) {
+    TEST_REQUIRES_ARM_NEON_FMA;
     for (size_t k = 1; k < 4; k++) {
       GemmMicrokernelTester()
         .mr(1)
         .nr(8)
         .kr(1)
-        .sr(4)
+        .sr(1)
         .m(1)
         .n(8)
         .k(k)
         .a_stride(7)
-        .Test(xnn_f32_gemm_minmax_ukernel_1x8s4__neon, xnn_init_f32_minmax_scalar_params);
+        .Test(xnn_f32_gemm_minmax_ukernel_1x8__neonfma_dup_acc4, xnn_init_f32_minmax_scalar_params);
     }
   }
 
-  TEST(F32_GEMM_MINMAX_1X8S4__NEON, k_lt_4_subtile) {
-    TEST_REQUIRES_ARM_NEON;
+  TEST(F32_GEMM_MINMAX_1X8__NEONFMA_DUP_ACC4, k_lt_4_subtile) {
+    TEST_REQUIRES_ARM_NEON_FMA;
     for (size_t k = 1; k < 4; k++) {
       for (uint32_t n = 1; n <= 8; n++) {
         for (uint32_t m = 1; m <= 1; m++) {
@@ -7946,50 +7946,50 @@
             .mr(1)
             .nr(8)
             .kr(1)
-            .sr(4)
+            .sr(1)
             .m(m)
             .n(n)
             .k(k)
             .iterations(1)
-            .Test(xnn_f32_gemm_minmax_ukernel_1x8s4__neon, xnn_init_f32_minmax_scalar_params);
+            .Test(xnn_f32_gemm_minmax_ukernel_1x8__neonfma_dup_acc4, xnn_init_f32_minmax_scalar_params);
         }
       }
     }
   }
 
-  TEST(F32_GEMM_MINMAX_1X8S4__NEON, k_gt_4) {
-    TEST_REQUIRES_ARM_NEON;
+  TEST(F32_GEMM_MINMAX_1X8__NEONFMA_DUP_ACC4, k_gt_4) {
+    TEST_REQUIRES_ARM_NEON_FMA;
     for (size_t k = 5; k < 8; k++) {
       GemmMicrokernelTester()
         .mr(1)
         .nr(8)
         .kr(1)
-        .sr(4)
+        .sr(1)
         .m(1)
         .n(8)
         .k(k)
-        .Test(xnn_f32_gemm_minmax_ukernel_1x8s4__neon, xnn_init_f32_minmax_scalar_params);
+        .Test(xnn_f32_gemm_minmax_ukernel_1x8__neonfma_dup_acc4, xnn_init_f32_minmax_scalar_params);
     }
   }
 
-  TEST(F32_GEMM_MINMAX_1X8S4__NEON, k_gt_4_strided_a) {
-    TEST_REQUIRES_ARM_NEON;
+  TEST(F32_GEMM_MINMAX_1X8__NEONFMA_DUP_ACC4, k_gt_4_strided_a) {
+    TEST_REQUIRES_ARM_NEON_FMA;
     for (size_t k = 5; k < 8; k++) {
       GemmMicrokernelTester()
         .mr(1)
         .nr(8)
         .kr(1)
-        .sr(4)
+        .sr(1)
         .m(1)
         .n(8)
         .k(k)
         .a_stride(11)
-        .Test(xnn_f32_gemm_minmax_ukernel_1x8s4__neon, xnn_init_f32_minmax_scalar_params);
+        .Test(xnn_f32_gemm_minmax_ukernel_1x8__neonfma_dup_acc4, xnn_init_f32_minmax_scalar_params);
     }
   }
 
-  TEST(F32_GEMM_MINMAX_1X8S4__NEON, k_gt_4_subtile) {
-    TEST_REQUIRES_ARM_NEON;
+  TEST(F32_GEMM_MINMAX_1X8__NEONFMA_DUP_ACC4, k_gt_4_subtile) {
+    TEST_REQUIRES_ARM_NEON_FMA;
     for (size_t k = 5; k < 8; k++) {
       for (uint32_t n = 1; n <= 8; n++) {
         for (uint32_t m = 1; m <= 1; m++) {
@@ -7997,50 +7997,50 @@
             .mr(1)
             .nr(8)
             .kr(1)
-            .sr(4)
+            .sr(1)
             .m(m)
             .n(n)
             .k(k)
             .iterations(1)
-            .Test(xnn_f32_gemm_minmax_ukernel_1x8s4__neon, xnn_init_f32_minmax_scalar_params);
+            .Test(xnn_f32_gemm_minmax_ukernel_1x8__neonfma_dup_acc4, xnn_init_f32_minmax_scalar_params);
         }
       }
     }
   }
 
-  TEST(F32_GEMM_MINMAX_1X8S4__NEON, k_div_4) {
-    TEST_REQUIRES_ARM_NEON;
+  TEST(F32_GEMM_MINMAX_1X8__NEONFMA_DUP_ACC4, k_div_4) {
+    TEST_REQUIRES_ARM_NEON_FMA;
     for (size_t k = 8; k <= 40; k += 4) {
       GemmMicrokernelTester()
         .mr(1)
         .nr(8)
         .kr(1)
-        .sr(4)
+        .sr(1)
         .m(1)
         .n(8)
         .k(k)
-        .Test(xnn_f32_gemm_minmax_ukernel_1x8s4__neon, xnn_init_f32_minmax_scalar_params);
+        .Test(xnn_f32_gemm_minmax_ukernel_1x8__neonfma_dup_acc4, xnn_init_f32_minmax_scalar_params);
     }
   }
 
-  TEST(F32_GEMM_MINMAX_1X8S4__NEON, k_div_4_strided_a) {
-    TEST_REQUIRES_ARM_NEON;
+  TEST(F32_GEMM_MINMAX_1X8__NEONFMA_DUP_ACC4, k_div_4_strided_a) {
+    TEST_REQUIRES_ARM_NEON_FMA;
     for (size_t k = 8; k <= 40; k += 4) {
       GemmMicrokernelTester()
         .mr(1)
         .nr(8)
         .kr(1)
-        .sr(4)
+        .sr(1)
         .m(1)
         .n(8)
         .k(k)
         .a_stride(43)
-        .Test(xnn_f32_gemm_minmax_ukernel_1x8s4__neon, xnn_init_f32_minmax_scalar_params);
+        .Test(xnn_f32_gemm_minmax_ukernel_1x8__neonfma_dup_acc4, xnn_init_f32_minmax_scalar_params);
     }
   }
 
-  TEST(F32_GEMM_MINMAX_1X8S4__NEON, k_div_4_subtile) {
-    TEST_REQUIRES_ARM_NEON;
+  TEST(F32_GEMM_MINMAX_1X8__NEONFMA_DUP_ACC4, k_div_4_subtile) {
+    TEST_REQUIRES_ARM_NEON_FMA;
     for (size_t k = 8; k <= 40; k += 4) {
       for (uint32_t n = 1; n <= 8; n++) {
         for (uint32_t m = 1; m <= 1; m++) {
@@ -8048,72 +8048,72 @@
             .mr(1)
             .nr(8)
             .kr(1)
-            .sr(4)
+            .sr(1)
             .m(m)
             .n(n)
             .k(k)
             .iterations(1)
-            .Test(xnn_f32_gemm_minmax_ukernel_1x8s4__neon, xnn_init_f32_minmax_scalar_params);
+            .Test(xnn_f32_gemm_minmax_ukernel_1x8__neonfma_dup_acc4, xnn_init_f32_minmax_scalar_params);
         }
       }
     }
   }
 
-  TEST(F32_GEMM_MINMAX_1X8S4__NEON, n_gt_8) {
-    TEST_REQUIRES_ARM_NEON;
+  TEST(F32_GEMM_MINMAX_1X8__NEONFMA_DUP_ACC4, n_gt_8) {
+    TEST_REQUIRES_ARM_NEON_FMA;
     for (uint32_t n = 9; n < 16; n++) {
       for (size_t k = 1; k <= 20; k += 5) {
         GemmMicrokernelTester()
           .mr(1)
           .nr(8)
           .kr(1)
-          .sr(4)
+          .sr(1)
           .m(1)
           .n(n)
           .k(k)
-          .Test(xnn_f32_gemm_minmax_ukernel_1x8s4__neon, xnn_init_f32_minmax_scalar_params);
+          .Test(xnn_f32_gemm_minmax_ukernel_1x8__neonfma_dup_acc4, xnn_init_f32_minmax_scalar_params);
       }
     }
   }
 
-  TEST(F32_GEMM_MINMAX_1X8S4__NEON, n_gt_8_strided_cn) {
-    TEST_REQUIRES_ARM_NEON;
+  TEST(F32_GEMM_MINMAX_1X8__NEONFMA_DUP_ACC4, n_gt_8_strided_cn) {
+    TEST_REQUIRES_ARM_NEON_FMA;
     for (uint32_t n = 9; n < 16; n++) {
       for (size_t k = 1; k <= 20; k += 5) {
         GemmMicrokernelTester()
           .mr(1)
           .nr(8)
           .kr(1)
-          .sr(4)
+          .sr(1)
           .m(1)
           .n(n)
           .k(k)
           .cn_stride(11)
-          .Test(xnn_f32_gemm_minmax_ukernel_1x8s4__neon, xnn_init_f32_minmax_scalar_params);
+          .Test(xnn_f32_gemm_minmax_ukernel_1x8__neonfma_dup_acc4, xnn_init_f32_minmax_scalar_params);
       }
     }
   }
 
-  TEST(F32_GEMM_MINMAX_1X8S4__NEON, n_gt_8_strided_a) {
-    TEST_REQUIRES_ARM_NEON;
+  TEST(F32_GEMM_MINMAX_1X8__NEONFMA_DUP_ACC4, n_gt_8_strided_a) {
+    TEST_REQUIRES_ARM_NEON_FMA;
     for (uint32_t n = 9; n < 16; n++) {
       for (size_t k = 1; k <= 20; k += 5) {
         GemmMicrokernelTester()
           .mr(1)
           .nr(8)
           .kr(1)
-          .sr(4)
+          .sr(1)
           .m(1)
           .n(n)
           .k(k)
           .a_stride(23)
-          .Test(xnn_f32_gemm_minmax_ukernel_1x8s4__neon, xnn_init_f32_minmax_scalar_params);
+          .Test(xnn_f32_gemm_minmax_ukernel_1x8__neonfma_dup_acc4, xnn_init_f32_minmax_scalar_params);
       }
     }
   }
 
-  TEST(F32_GEMM_MINMAX_1X8S4__NEON, n_gt_8_subtile) {
-    TEST_REQUIRES_ARM_NEON;
+  TEST(F32_GEMM_MINMAX_1X8__NEONFMA_DUP_ACC4, n_gt_8_subtile) {
+    TEST_REQUIRES_ARM_NEON_FMA;
     for (uint32_t n = 9; n < 16; n++) {
       for (size_t k = 1; k <= 20; k += 5) {
         for (uint32_t m = 1; m <= 1; m++) {
@@ -8121,72 +8121,72 @@
             .mr(1)
             .nr(8)
             .kr(1)
-            .sr(4)
+            .sr(1)
             .m(m)
             .n(n)
             .k(k)
             .iterations(1)
-            .Test(xnn_f32_gemm_minmax_ukernel_1x8s4__neon, xnn_init_f32_minmax_scalar_params);
+            .Test(xnn_f32_gemm_minmax_ukernel_1x8__neonfma_dup_acc4, xnn_init_f32_minmax_scalar_params);
         }
       }
     }
   }
 
-  TEST(F32_GEMM_MINMAX_1X8S4__NEON, n_div_8) {
-    TEST_REQUIRES_ARM_NEON;
+  TEST(F32_GEMM_MINMAX_1X8__NEONFMA_DUP_ACC4, n_div_8) {
+    TEST_REQUIRES_ARM_NEON_FMA;
     for (uint32_t n = 16; n <= 24; n += 8) {
       for (size_t k = 1; k <= 20; k += 5) {
         GemmMicrokernelTester()
           .mr(1)
           .nr(8)
           .kr(1)
-          .sr(4)
+          .sr(1)
           .m(1)
           .n(n)
           .k(k)
-          .Test(xnn_f32_gemm_minmax_ukernel_1x8s4__neon, xnn_init_f32_minmax_scalar_params);
+          .Test(xnn_f32_gemm_minmax_ukernel_1x8__neonfma_dup_acc4, xnn_init_f32_minmax_scalar_params);
       }
     }
   }
 
-  TEST(F32_GEMM_MINMAX_1X8S4__NEON, n_div_8_strided_cn) {
-    TEST_REQUIRES_ARM_NEON;
+  TEST(F32_GEMM_MINMAX_1X8__NEONFMA_DUP_ACC4, n_div_8_strided_cn) {
+    TEST_REQUIRES_ARM_NEON_FMA;
     for (uint32_t n = 16; n <= 24; n += 8) {
       for (size_t k = 1; k <= 20; k += 5) {
         GemmMicrokernelTester()
           .mr(1)
           .nr(8)
           .kr(1)
-          .sr(4)
+          .sr(1)
           .m(1)
           .n(n)
           .k(k)
           .cn_stride(11)
-          .Test(xnn_f32_gemm_minmax_ukernel_1x8s4__neon, xnn_init_f32_minmax_scalar_params);
+          .Test(xnn_f32_gemm_minmax_ukernel_1x8__neonfma_dup_acc4, xnn_init_f32_minmax_scalar_params);
       }
     }
   }
 
-  TEST(F32_GEMM_MINMAX_1X8S4__NEON, n_div_8_strided_a) {
-    TEST_REQUIRES_ARM_NEON;
+  TEST(F32_GEMM_MINMAX_1X8__NEONFMA_DUP_ACC4, n_div_8_strided_a) {
+    TEST_REQUIRES_ARM_NEON_FMA;
     for (uint32_t n = 16; n <= 24; n += 8) {
       for (size_t k = 1; k <= 20; k += 5) {
         GemmMicrokernelTester()
           .mr(1)
           .nr(8)
           .kr(1)
-          .sr(4)
+          .sr(1)
           .m(1)
           .n(n)
           .k(k)
           .a_stride(23)
-          .Test(xnn_f32_gemm_minmax_ukernel_1x8s4__neon, xnn_init_f32_minmax_scalar_params);
+          .Test(xnn_f32_gemm_minmax_ukernel_1x8__neonfma_dup_acc4, xnn_init_f32_minmax_scalar_params);
       }
     }
   }
 
-  TEST(F32_GEMM_MINMAX_1X8S4__NEON, n_div_8_subtile) {
-    TEST_REQUIRES_ARM_NEON;
+  TEST(F32_GEMM_MINMAX_1X8__NEONFMA_DUP_ACC4, n_div_8_subtile) {
+    TEST_REQUIRES_ARM_NEON_FMA;
     for (uint32_t n = 16; n <= 24; n += 8) {
       for (size_t k = 1; k <= 20; k += 5) {
         for (uint32_t m = 1; m <= 1; m++) {
@@ -8194,19 +8194,19 @@
             .mr(1)
             .nr(8)
             .kr(1)
-            .sr(4)
+            .sr(1)
             .m(m)
             .n(n)
             .k(k)
             .iterations(1)
-            .Test(xnn_f32_gemm_minmax_ukernel_1x8s4__neon, xnn_init_f32_minmax_scalar_params);
+            .Test(xnn_f32_gemm_minmax_ukernel_1x8__neonfma_dup_acc4, xnn_init_f32_minmax_scalar_params);
         }
       }
     }
   }
 
-  TEST(F32_GEMM_MINMAX_1X8S4__NEON, strided_cm_subtile) {
-    TEST_REQUIRES_ARM_NEON;
+  TEST(F32_GEMM_MINMAX_1X8__NEONFMA_DUP_ACC4, strided_cm_subtile) {
+    TEST_REQUIRES_ARM_NEON_FMA;
     for (size_t k = 1; k <= 20; k += 5) {
       for (uint32_t n = 1; n <= 8; n++) {
         for (uint32_t m = 1; m <= 1; m++) {
@@ -8214,65 +8214,65 @@
             .mr(1)
             .nr(8)
             .kr(1)
-            .sr(4)
+            .sr(1)
             .m(m)
             .n(n)
             .k(k)
             .cm_stride(11)
             .iterations(1)
-            .Test(xnn_f32_gemm_minmax_ukernel_1x8s4__neon, xnn_init_f32_minmax_scalar_params);
+            .Test(xnn_f32_gemm_minmax_ukernel_1x8__neonfma_dup_acc4, xnn_init_f32_minmax_scalar_params);
         }
       }
     }
   }
 
-  TEST(F32_GEMM_MINMAX_1X8S4__NEON, qmin) {
-    TEST_REQUIRES_ARM_NEON;
+  TEST(F32_GEMM_MINMAX_1X8__NEONFMA_DUP_ACC4, qmin) {
+    TEST_REQUIRES_ARM_NEON_FMA;
     GemmMicrokernelTester()
       .mr(1)
       .nr(8)
       .kr(1)
-      .sr(4)
+      .sr(1)
       .m(1)
       .n(8)
       .k(4)
       .qmin(128)
-      .Test(xnn_f32_gemm_minmax_ukernel_1x8s4__neon, xnn_init_f32_minmax_scalar_params);
+      .Test(xnn_f32_gemm_minmax_ukernel_1x8__neonfma_dup_acc4, xnn_init_f32_minmax_scalar_params);
   }
 
-  TEST(F32_GEMM_MINMAX_1X8S4__NEON, qmax) {
-    TEST_REQUIRES_ARM_NEON;
+  TEST(F32_GEMM_MINMAX_1X8__NEONFMA_DUP_ACC4, qmax) {
+    TEST_REQUIRES_ARM_NEON_FMA;
     GemmMicrokernelTester()
       .mr(1)
       .nr(8)
       .kr(1)
-      .sr(4)
+      .sr(1)
       .m(1)
       .n(8)
       .k(4)
       .qmax(128)
-      .Test(xnn_f32_gemm_minmax_ukernel_1x8s4__neon, xnn_init_f32_minmax_scalar_params);
+      .Test(xnn_f32_gemm_minmax_ukernel_1x8__neonfma_dup_acc4, xnn_init_f32_minmax_scalar_params);
   }
 
-  TEST(F32_GEMM_MINMAX_1X8S4__NEON, strided_cm) {
-    TEST_REQUIRES_ARM_NEON;
+  TEST(F32_GEMM_MINMAX_1X8__NEONFMA_DUP_ACC4, strided_cm) {
+    TEST_REQUIRES_ARM_NEON_FMA;
     GemmMicrokernelTester()
       .mr(1)
       .nr(8)
       .kr(1)
-      .sr(4)
+      .sr(1)
       .m(1)
       .n(8)
       .k(4)
       .cm_stride(11)
-      .Test(xnn_f32_gemm_minmax_ukernel_1x8s4__neon, xnn_init_f32_minmax_scalar_params);
+      .Test(xnn_f32_gemm_minmax_ukernel_1x8__neonfma_dup_acc4, xnn_init_f32_minmax_scalar_params);
   }
 #endif  // XNN_ARCH_ARM || XNN_ARCH_ARM64
 
 
 #if XNN_ARCH_ARM || XNN_ARCH_ARM64
-  TEST(F32_GEMM_MINMAX_1X8S4__NEONFMA, k_eq_4) {
-    TEST_REQUIRES_ARM_NEON_FMA;
+  TEST(F32_GEMM_MINMAX_1X8S4__NEON, k_eq_4) {
+    TEST_REQUIRES_ARM_NEON;
     GemmMicrokernelTester()
       .mr(1)
       .nr(8)
@@ -8281,11 +8281,11 @@
       .m(1)
       .n(8)
       .k(4)
-      .Test(xnn_f32_gemm_minmax_ukernel_1x8s4__neonfma, xnn_init_f32_minmax_scalar_params);
+      .Test(xnn_f32_gemm_minmax_ukernel_1x8s4__neon, xnn_init_f32_minmax_scalar_params);
   }
 
-  TEST(F32_GEMM_MINMAX_1X8S4__NEONFMA, strided_cn) {
-    TEST_REQUIRES_ARM_NEON_FMA;
+  TEST(F32_GEMM_MINMAX_1X8S4__NEON, strided_cn) {
+    TEST_REQUIRES_ARM_NEON;
     GemmMicrokernelTester()
       .mr(1)
       .nr(8)
@@ -8295,11 +8295,11 @@
       .n(8)
       .k(4)
       .cn_stride(11)
-      .Test(xnn_f32_gemm_minmax_ukernel_1x8s4__neonfma, xnn_init_f32_minmax_scalar_params);
+      .Test(xnn_f32_gemm_minmax_ukernel_1x8s4__neon, xnn_init_f32_minmax_scalar_params);
   }
 
-  TEST(F32_GEMM_MINMAX_1X8S4__NEONFMA, k_eq_4_strided_a) {
-    TEST_REQUIRES_ARM_NEON_FMA;
+  TEST(F32_GEMM_MINMAX_1X8S4__NEON, k_eq_4_strided_a) {
+    TEST_REQUIRES_ARM_NEON;
     GemmMicrokernelTester()
       .mr(1)
       .nr(8)
@@ -8309,11 +8309,11 @@
       .n(8)
       .k(4)
       .a_stride(7)
-      .Test(xnn_f32_gemm_minmax_ukernel_1x8s4__neonfma, xnn_init_f32_minmax_scalar_params);
+      .Test(xnn_f32_gemm_minmax_ukernel_1x8s4__neon, xnn_init_f32_minmax_scalar_params);
   }
 
-  TEST(F32_GEMM_MINMAX_1X8S4__NEONFMA, k_eq_4_subtile) {
-    TEST_REQUIRES_ARM_NEON_FMA;
+  TEST(F32_GEMM_MINMAX_1X8S4__NEON, k_eq_4_subtile) {
+    TEST_REQUIRES_ARM_NEON;
     for (uint32_t n = 1; n <= 8; n++) {
       for (uint32_t m = 1; m <= 1; m++) {
         GemmMicrokernelTester()
@@ -8325,13 +8325,13 @@
           .n(n)
           .k(4)
           .iterations(1)
-          .Test(xnn_f32_gemm_minmax_ukernel_1x8s4__neonfma, xnn_init_f32_minmax_scalar_params);
+          .Test(xnn_f32_gemm_minmax_ukernel_1x8s4__neon, xnn_init_f32_minmax_scalar_params);
       }
     }
   }
 
-  TEST(F32_GEMM_MINMAX_1X8S4__NEONFMA, k_eq_4_subtile_m) {
-    TEST_REQUIRES_ARM_NEON_FMA;
+  TEST(F32_GEMM_MINMAX_1X8S4__NEON, k_eq_4_subtile_m) {
+    TEST_REQUIRES_ARM_NEON;
     for (uint32_t m = 1; m <= 1; m++) {
       GemmMicrokernelTester()
         .mr(1)
@@ -8342,12 +8342,12 @@
         .n(8)
         .k(4)
         .iterations(1)
-        .Test(xnn_f32_gemm_minmax_ukernel_1x8s4__neonfma, xnn_init_f32_minmax_scalar_params);
+        .Test(xnn_f32_gemm_minmax_ukernel_1x8s4__neon, xnn_init_f32_minmax_scalar_params);
     }
   }
 
-  TEST(F32_GEMM_MINMAX_1X8S4__NEONFMA, k_eq_4_subtile_n) {
-    TEST_REQUIRES_ARM_NEON_FMA;
+  TEST(F32_GEMM_MINMAX_1X8S4__NEON, k_eq_4_subtile_n) {
+    TEST_REQUIRES_ARM_NEON;
     for (uint32_t n = 1; n <= 8; n++) {
       GemmMicrokernelTester()
         .mr(1)
@@ -8358,12 +8358,12 @@
         .n(n)
         .k(4)
         .iterations(1)
-        .Test(xnn_f32_gemm_minmax_ukernel_1x8s4__neonfma, xnn_init_f32_minmax_scalar_params);
+        .Test(xnn_f32_gemm_minmax_ukernel_1x8s4__neon, xnn_init_f32_minmax_scalar_params);
     }
   }
 
-  TEST(F32_GEMM_MINMAX_1X8S4__NEONFMA, k_lt_4) {
-    TEST_REQUIRES_ARM_NEON_FMA;
+  TEST(F32_GEMM_MINMAX_1X8S4__NEON, k_lt_4) {
+    TEST_REQUIRES_ARM_NEON;
     for (size_t k = 1; k < 4; k++) {
       GemmMicrokernelTester()
         .mr(1)
@@ -8373,12 +8373,12 @@
         .m(1)
         .n(8)
         .k(k)
-        .Test(xnn_f32_gemm_minmax_ukernel_1x8s4__neonfma, xnn_init_f32_minmax_scalar_params);
+        .Test(xnn_f32_gemm_minmax_ukernel_1x8s4__neon, xnn_init_f32_minmax_scalar_params);
     }
   }
 
-  TEST(F32_GEMM_MINMAX_1X8S4__NEONFMA, k_lt_4_strided_a) {
-    TEST_REQUIRES_ARM_NEON_FMA;
+  TEST(F32_GEMM_MINMAX_1X8S4__NEON, k_lt_4_strided_a) {
+    TEST_REQUIRES_ARM_NEON;
     for (size_t k = 1; k < 4; k++) {
       GemmMicrokernelTester()
         .mr(1)
@@ -8389,12 +8389,12 @@
         .n(8)
         .k(k)
         .a_stride(7)
-        .Test(xnn_f32_gemm_minmax_ukernel_1x8s4__neonfma, xnn_init_f32_minmax_scalar_params);
+        .Test(xnn_f32_gemm_minmax_ukernel_1x8s4__neon, xnn_init_f32_minmax_scalar_params);
     }
   }
 
-  TEST(F32_GEMM_MINMAX_1X8S4__NEONFMA, k_lt_4_subtile) {
-    TEST_REQUIRES_ARM_NEON_FMA;
+  TEST(F32_GEMM_MINMAX_1X8S4__NEON, k_lt_4_subtile) {
+    TEST_REQUIRES_ARM_NEON;
     for (size_t k = 1; k < 4; k++) {
       for (uint32_t n = 1; n <= 8; n++) {
         for (uint32_t m = 1; m <= 1; m++) {
@@ -8407,14 +8407,14 @@
             .n(n)
             .k(k)
             .iterations(1)
-            .Test(xnn_f32_gemm_minmax_ukernel_1x8s4__neonfma, xnn_init_f32_minmax_scalar_params);
+            .Test(xnn_f32_gemm_minmax_ukernel_1x8s4__neon, xnn_init_f32_minmax_scalar_params);
         }
       }
     }
   }
 
-  TEST(F32_GEMM_MINMAX_1X8S4__NEONFMA, k_gt_4) {
-    TEST_REQUIRES_ARM_NEON_FMA;
+  TEST(F32_GEMM_MINMAX_1X8S4__NEON, k_gt_4) {
+    TEST_REQUIRES_ARM_NEON;
     for (size_t k = 5; k < 8; k++) {
       GemmMicrokernelTester()
         .mr(1)
@@ -8424,12 +8424,12 @@
         .m(1)
         .n(8)
         .k(k)
-        .Test(xnn_f32_gemm_minmax_ukernel_1x8s4__neonfma, xnn_init_f32_minmax_scalar_params);
+        .Test(xnn_f32_gemm_minmax_ukernel_1x8s4__neon, xnn_init_f32_minmax_scalar_params);
     }
   }
 
-  TEST(F32_GEMM_MINMAX_1X8S4__NEONFMA, k_gt_4_strided_a) {
-    TEST_REQUIRES_ARM_NEON_FMA;
+  TEST(F32_GEMM_MINMAX_1X8S4__NEON, k_gt_4_strided_a) {
+    TEST_REQUIRES_ARM_NEON;
     for (size_t k = 5; k < 8; k++) {
       GemmMicrokernelTester()
         .mr(1)
@@ -8440,12 +8440,12 @@
         .n(8)
         .k(k)
         .a_stride(11)
-        .Test(xnn_f32_gemm_minmax_ukernel_1x8s4__neonfma, xnn_init_f32_minmax_scalar_params);
+        .Test(xnn_f32_gemm_minmax_ukernel_1x8s4__neon, xnn_init_f32_minmax_scalar_params);
     }
   }
 
-  TEST(F32_GEMM_MINMAX_1X8S4__NEONFMA, k_gt_4_subtile) {
-    TEST_REQUIRES_ARM_NEON_FMA;
+  TEST(F32_GEMM_MINMAX_1X8S4__NEON, k_gt_4_subtile) {
+    TEST_REQUIRES_ARM_NEON;
     for (size_t k = 5; k < 8; k++) {
       for (uint32_t n = 1; n <= 8; n++) {
         for (uint32_t m = 1; m <= 1; m++) {
@@ -8458,14 +8458,14 @@
             .n(n)
             .k(k)
             .iterations(1)
-            .Test(xnn_f32_gemm_minmax_ukernel_1x8s4__neonfma, xnn_init_f32_minmax_scalar_params);
+            .Test(xnn_f32_gemm_minmax_ukernel_1x8s4__neon, xnn_init_f32_minmax_scalar_params);
         }
       }
     }
   }
 
-  TEST(F32_GEMM_MINMAX_1X8S4__NEONFMA, k_div_4) {
-    TEST_REQUIRES_ARM_NEON_FMA;
+  TEST(F32_GEMM_MINMAX_1X8S4__NEON, k_div_4) {
+    TEST_REQUIRES_ARM_NEON;
     for (size_t k = 8; k <= 40; k += 4) {
       GemmMicrokernelTester()
         .mr(1)
@@ -8475,12 +8475,12 @@
         .m(1)
         .n(8)
         .k(k)
-        .Test(xnn_f32_gemm_minmax_ukernel_1x8s4__neonfma, xnn_init_f32_minmax_scalar_params);
+        .Test(xnn_f32_gemm_minmax_ukernel_1x8s4__neon, xnn_init_f32_minmax_scalar_params);
     }
   }
 
-  TEST(F32_GEMM_MINMAX_1X8S4__NEONFMA, k_div_4_strided_a) {
-    TEST_REQUIRES_ARM_NEON_FMA;
+  TEST(F32_GEMM_MINMAX_1X8S4__NEON, k_div_4_strided_a) {
+    TEST_REQUIRES_ARM_NEON;
     for (size_t k = 8; k <= 40; k += 4) {
       GemmMicrokernelTester()
         .mr(1)
@@ -8491,12 +8491,12 @@
         .n(8)
         .k(k)
         .a_stride(43)
-        .Test(xnn_f32_gemm_minmax_ukernel_1x8s4__neonfma, xnn_init_f32_minmax_scalar_params);
+        .Test(xnn_f32_gemm_minmax_ukernel_1x8s4__neon, xnn_init_f32_minmax_scalar_params);
     }
   }
 
-  TEST(F32_GEMM_MINMAX_1X8S4__NEONFMA, k_div_4_subtile) {
-    TEST_REQUIRES_ARM_NEON_FMA;
+  TEST(F32_GEMM_MINMAX_1X8S4__NEON, k_div_4_subtile) {
+    TEST_REQUIRES_ARM_NEON;
     for (size_t k = 8; k <= 40; k += 4) {
       for (uint32_t n = 1; n <= 8; n++) {
         for (uint32_t m = 1; m <= 1; m++) {
@@ -8509,14 +8509,14 @@
             .n(n)
             .k(k)
             .iterations(1)
-            .Test(xnn_f32_gemm_minmax_ukernel_1x8s4__neonfma, xnn_init_f32_minmax_scalar_params);
+            .Test(xnn_f32_gemm_minmax_ukernel_1x8s4__neon, xnn_init_f32_minmax_scalar_params);
         }
       }
     }
   }
 
-  TEST(F32_GEMM_MINMAX_1X8S4__NEONFMA, n_gt_8) {
-    TEST_REQUIRES_ARM_NEON_FMA;
+  TEST(F32_GEMM_MINMAX_1X8S4__NEON, n_gt_8) {
+    TEST_REQUIRES_ARM_NEON;
     for (uint32_t n = 9; n < 16; n++) {
       for (size_t k = 1; k <= 20; k += 5) {
         GemmMicrokernelTester()
@@ -8527,13 +8527,13 @@
           .m(1)
           .n(n)
           .k(k)
-          .Test(xnn_f32_gemm_minmax_ukernel_1x8s4__neonfma, xnn_init_f32_minmax_scalar_params);
+          .Test(xnn_f32_gemm_minmax_ukernel_1x8s4__neon, xnn_init_f32_minmax_scalar_params);
       }
     }
   }
 
-  TEST(F32_GEMM_MINMAX_1X8S4__NEONFMA, n_gt_8_strided_cn) {
-    TEST_REQUIRES_ARM_NEON_FMA;
+  TEST(F32_GEMM_MINMAX_1X8S4__NEON, n_gt_8_strided_cn) {
+    TEST_REQUIRES_ARM_NEON;
     for (uint32_t n = 9; n < 16; n++) {
       for (size_t k = 1; k <= 20; k += 5) {
         GemmMicrokernelTester()
@@ -8545,13 +8545,13 @@
           .n(n)
           .k(k)
           .cn_stride(11)
-          .Test(xnn_f32_gemm_minmax_ukernel_1x8s4__neonfma, xnn_init_f32_minmax_scalar_params);
+          .Test(xnn_f32_gemm_minmax_ukernel_1x8s4__neon, xnn_init_f32_minmax_scalar_params);
       }
     }
   }
 
-  TEST(F32_GEMM_MINMAX_1X8S4__NEONFMA, n_gt_8_strided_a) {
-    TEST_REQUIRES_ARM_NEON_FMA;
+  TEST(F32_GEMM_MINMAX_1X8S4__NEON, n_gt_8_strided_a) {
+    TEST_REQUIRES_ARM_NEON;
     for (uint32_t n = 9; n < 16; n++) {
       for (size_t k = 1; k <= 20; k += 5) {
         GemmMicrokernelTester()
@@ -8563,13 +8563,13 @@
           .n(n)
           .k(k)
           .a_stride(23)
-          .Test(xnn_f32_gemm_minmax_ukernel_1x8s4__neonfma, xnn_init_f32_minmax_scalar_params);
+          .Test(xnn_f32_gemm_minmax_ukernel_1x8s4__neon, xnn_init_f32_minmax_scalar_params);
       }
     }
   }
 
-  TEST(F32_GEMM_MINMAX_1X8S4__NEONFMA, n_gt_8_subtile) {
-    TEST_REQUIRES_ARM_NEON_FMA;
+  TEST(F32_GEMM_MINMAX_1X8S4__NEON, n_gt_8_subtile) {
+    TEST_REQUIRES_ARM_NEON;
     for (uint32_t n = 9; n < 16; n++) {
       for (size_t k = 1; k <= 20; k += 5) {
         for (uint32_t m = 1; m <= 1; m++) {
@@ -8582,14 +8582,14 @@
             .n(n)
             .k(k)
             .iterations(1)
-            .Test(xnn_f32_gemm_minmax_ukernel_1x8s4__neonfma, xnn_init_f32_minmax_scalar_params);
+            .Test(xnn_f32_gemm_minmax_ukernel_1x8s4__neon, xnn_init_f32_minmax_scalar_params);
         }
       }
     }
   }
 
-  TEST(F32_GEMM_MINMAX_1X8S4__NEONFMA, n_div_8) {
-    TEST_REQUIRES_ARM_NEON_FMA;
+  TEST(F32_GEMM_MINMAX_1X8S4__NEON, n_div_8) {
+    TEST_REQUIRES_ARM_NEON;
     for (uint32_t n = 16; n <= 24; n += 8) {
       for (size_t k = 1; k <= 20; k += 5) {
         GemmMicrokernelTester()
@@ -8600,13 +8600,13 @@
           .m(1)
           .n(n)
           .k(k)
-          .Test(xnn_f32_gemm_minmax_ukernel_1x8s4__neonfma, xnn_init_f32_minmax_scalar_params);
+          .Test(xnn_f32_gemm_minmax_ukernel_1x8s4__neon, xnn_init_f32_minmax_scalar_params);
       }
     }
   }
 
-  TEST(F32_GEMM_MINMAX_1X8S4__NEONFMA, n_div_8_strided_cn) {
-    TEST_REQUIRES_ARM_NEON_FMA;
+  TEST(F32_GEMM_MINMAX_1X8S4__NEON, n_div_8_strided_cn) {
+    TEST_REQUIRES_ARM_NEON;
     for (uint32_t n = 16; n <= 24; n += 8) {
       for (size_t k = 1; k <= 20; k += 5) {
         GemmMicrokernelTester()
@@ -8618,13 +8618,13 @@
           .n(n)
           .k(k)
           .cn_stride(11)
-          .Test(xnn_f32_gemm_minmax_ukernel_1x8s4__neonfma, xnn_init_f32_minmax_scalar_params);
+          .Test(xnn_f32_gemm_minmax_ukernel_1x8s4__neon, xnn_init_f32_minmax_scalar_params);
       }
     }
   }
 
-  TEST(F32_GEMM_MINMAX_1X8S4__NEONFMA, n_div_8_strided_a) {
-    TEST_REQUIRES_ARM_NEON_FMA;
+  TEST(F32_GEMM_MINMAX_1X8S4__NEON, n_div_8_strided_a) {
+    TEST_REQUIRES_ARM_NEON;
     for (uint32_t n = 16; n <= 24; n += 8) {
       for (size_t k = 1; k <= 20; k += 5) {
         GemmMicrokernelTester()
@@ -8636,13 +8636,13 @@
           .n(n)
           .k(k)
           .a_stride(23)
-          .Test(xnn_f32_gemm_minmax_ukernel_1x8s4__neonfma, xnn_init_f32_minmax_scalar_params);
+          .Test(xnn_f32_gemm_minmax_ukernel_1x8s4__neon, xnn_init_f32_minmax_scalar_params);
       }
     }
   }
 
-  TEST(F32_GEMM_MINMAX_1X8S4__NEONFMA, n_div_8_subtile) {
-    TEST_REQUIRES_ARM_NEON_FMA;
+  TEST(F32_GEMM_MINMAX_1X8S4__NEON, n_div_8_subtile) {
+    TEST_REQUIRES_ARM_NEON;
     for (uint32_t n = 16; n <= 24; n += 8) {
       for (size_t k = 1; k <= 20; k += 5) {
         for (uint32_t m = 1; m <= 1; m++) {
@@ -8655,14 +8655,14 @@
             .n(n)
             .k(k)
             .iterations(1)
-            .Test(xnn_f32_gemm_minmax_ukernel_1x8s4__neonfma, xnn_init_f32_minmax_scalar_params);
+            .Test(xnn_f32_gemm_minmax_ukernel_1x8s4__neon, xnn_init_f32_minmax_scalar_params);
         }
       }
     }
   }
 
-  TEST(F32_GEMM_MINMAX_1X8S4__NEONFMA, strided_cm_subtile) {
-    TEST_REQUIRES_ARM_NEON_FMA;
+  TEST(F32_GEMM_MINMAX_1X8S4__NEON, strided_cm_subtile) {
+    TEST_REQUIRES_ARM_NEON;
     for (size_t k = 1; k <= 20; k += 5) {
       for (uint32_t n = 1; n <= 8; n++) {
         for (uint32_t m = 1; m <= 1; m++) {
@@ -8676,14 +8676,14 @@
             .k(k)
             .cm_stride(11)
             .iterations(1)
-            .Test(xnn_f32_gemm_minmax_ukernel_1x8s4__neonfma, xnn_init_f32_minmax_scalar_params);
+            .Test(xnn_f32_gemm_minmax_ukernel_1x8s4__neon, xnn_init_f32_minmax_scalar_params);
         }
       }
     }
   }
 
-  TEST(F32_GEMM_MINMAX_1X8S4__NEONFMA, qmin) {
-    TEST_REQUIRES_ARM_NEON_FMA;
+  TEST(F32_GEMM_MINMAX_1X8S4__NEON, qmin) {
+    TEST_REQUIRES_ARM_NEON;
     GemmMicrokernelTester()
       .mr(1)
       .nr(8)
@@ -8693,11 +8693,11 @@
       .n(8)
       .k(4)
       .qmin(128)
-      .Test(xnn_f32_gemm_minmax_ukernel_1x8s4__neonfma, xnn_init_f32_minmax_scalar_params);
+      .Test(xnn_f32_gemm_minmax_ukernel_1x8s4__neon, xnn_init_f32_minmax_scalar_params);
   }
 
-  TEST(F32_GEMM_MINMAX_1X8S4__NEONFMA, qmax) {
-    TEST_REQUIRES_ARM_NEON_FMA;
+  TEST(F32_GEMM_MINMAX_1X8S4__NEON, qmax) {
+    TEST_REQUIRES_ARM_NEON;
     GemmMicrokernelTester()
       .mr(1)
       .nr(8)
@@ -8707,11 +8707,11 @@
       .n(8)
       .k(4)
       .qmax(128)
-      .Test(xnn_f32_gemm_minmax_ukernel_1x8s4__neonfma, xnn_init_f32_minmax_scalar_params);
+      .Test(xnn_f32_gemm_minmax_ukernel_1x8s4__neon, xnn_init_f32_minmax_scalar_params);
   }
 
-  TEST(F32_GEMM_MINMAX_1X8S4__NEONFMA, strided_cm) {
-    TEST_REQUIRES_ARM_NEON_FMA;
+  TEST(F32_GEMM_MINMAX_1X8S4__NEON, strided_cm) {
+    TEST_REQUIRES_ARM_NEON;
     GemmMicrokernelTester()
       .mr(1)
       .nr(8)
@@ -8721,469 +8721,469 @@
       .n(8)
       .k(4)
       .cm_stride(11)
-      .Test(xnn_f32_gemm_minmax_ukernel_1x8s4__neonfma, xnn_init_f32_minmax_scalar_params);
+      .Test(xnn_f32_gemm_minmax_ukernel_1x8s4__neon, xnn_init_f32_minmax_scalar_params);
   }
 #endif  // XNN_ARCH_ARM || XNN_ARCH_ARM64
 
 
 #if XNN_ARCH_ARM || XNN_ARCH_ARM64
-  TEST(F32_GEMM_MINMAX_4X8__NEON_DUP_LD128, k_eq_4) {
-    TEST_REQUIRES_ARM_NEON;
+  TEST(F32_GEMM_MINMAX_1X8S4__NEONFMA, k_eq_4) {
+    TEST_REQUIRES_ARM_NEON_FMA;
     GemmMicrokernelTester()
-      .mr(4)
+      .mr(1)
       .nr(8)
       .kr(1)
-      .sr(1)
-      .m(4)
+      .sr(4)
+      .m(1)
       .n(8)
       .k(4)
-      .Test(xnn_f32_gemm_minmax_ukernel_4x8__neon_dup_ld128, xnn_init_f32_minmax_scalar_params);
+      .Test(xnn_f32_gemm_minmax_ukernel_1x8s4__neonfma, xnn_init_f32_minmax_scalar_params);
   }
 
-  TEST(F32_GEMM_MINMAX_4X8__NEON_DUP_LD128, strided_cn) {
-    TEST_REQUIRES_ARM_NEON;
+  TEST(F32_GEMM_MINMAX_1X8S4__NEONFMA, strided_cn) {
+    TEST_REQUIRES_ARM_NEON_FMA;
     GemmMicrokernelTester()
-      .mr(4)
+      .mr(1)
       .nr(8)
       .kr(1)
-      .sr(1)
-      .m(4)
+      .sr(4)
+      .m(1)
       .n(8)
       .k(4)
       .cn_stride(11)
-      .Test(xnn_f32_gemm_minmax_ukernel_4x8__neon_dup_ld128, xnn_init_f32_minmax_scalar_params);
+      .Test(xnn_f32_gemm_minmax_ukernel_1x8s4__neonfma, xnn_init_f32_minmax_scalar_params);
   }
 
-  TEST(F32_GEMM_MINMAX_4X8__NEON_DUP_LD128, k_eq_4_strided_a) {
-    TEST_REQUIRES_ARM_NEON;
+  TEST(F32_GEMM_MINMAX_1X8S4__NEONFMA, k_eq_4_strided_a) {
+    TEST_REQUIRES_ARM_NEON_FMA;
     GemmMicrokernelTester()
-      .mr(4)
+      .mr(1)
       .nr(8)
       .kr(1)
-      .sr(1)
-      .m(4)
+      .sr(4)
+      .m(1)
       .n(8)
       .k(4)
       .a_stride(7)
-      .Test(xnn_f32_gemm_minmax_ukernel_4x8__neon_dup_ld128, xnn_init_f32_minmax_scalar_params);
+      .Test(xnn_f32_gemm_minmax_ukernel_1x8s4__neonfma, xnn_init_f32_minmax_scalar_params);
   }
 
-  TEST(F32_GEMM_MINMAX_4X8__NEON_DUP_LD128, k_eq_4_subtile) {
-    TEST_REQUIRES_ARM_NEON;
+  TEST(F32_GEMM_MINMAX_1X8S4__NEONFMA, k_eq_4_subtile) {
+    TEST_REQUIRES_ARM_NEON_FMA;
     for (uint32_t n = 1; n <= 8; n++) {
-      for (uint32_t m = 1; m <= 4; m++) {
+      for (uint32_t m = 1; m <= 1; m++) {
         GemmMicrokernelTester()
-          .mr(4)
+          .mr(1)
           .nr(8)
           .kr(1)
-          .sr(1)
+          .sr(4)
           .m(m)
           .n(n)
           .k(4)
           .iterations(1)
-          .Test(xnn_f32_gemm_minmax_ukernel_4x8__neon_dup_ld128, xnn_init_f32_minmax_scalar_params);
+          .Test(xnn_f32_gemm_minmax_ukernel_1x8s4__neonfma, xnn_init_f32_minmax_scalar_params);
       }
     }
   }
 
-  TEST(F32_GEMM_MINMAX_4X8__NEON_DUP_LD128, k_eq_4_subtile_m) {
-    TEST_REQUIRES_ARM_NEON;
-    for (uint32_t m = 1; m <= 4; m++) {
+  TEST(F32_GEMM_MINMAX_1X8S4__NEONFMA, k_eq_4_subtile_m) {
+    TEST_REQUIRES_ARM_NEON_FMA;
+    for (uint32_t m = 1; m <= 1; m++) {
       GemmMicrokernelTester()
-        .mr(4)
+        .mr(1)
         .nr(8)
         .kr(1)
-        .sr(1)
+        .sr(4)
         .m(m)
         .n(8)
         .k(4)
         .iterations(1)
-        .Test(xnn_f32_gemm_minmax_ukernel_4x8__neon_dup_ld128, xnn_init_f32_minmax_scalar_params);
+        .Test(xnn_f32_gemm_minmax_ukernel_1x8s4__neonfma, xnn_init_f32_minmax_scalar_params);
     }
   }
 
-  TEST(F32_GEMM_MINMAX_4X8__NEON_DUP_LD128, k_eq_4_subtile_n) {
-    TEST_REQUIRES_ARM_NEON;
+  TEST(F32_GEMM_MINMAX_1X8S4__NEONFMA, k_eq_4_subtile_n) {
+    TEST_REQUIRES_ARM_NEON_FMA;
     for (uint32_t n = 1; n <= 8; n++) {
       GemmMicrokernelTester()
-        .mr(4)
+        .mr(1)
         .nr(8)
         .kr(1)
-        .sr(1)
-        .m(4)
+        .sr(4)
+        .m(1)
         .n(n)
         .k(4)
         .iterations(1)
-        .Test(xnn_f32_gemm_minmax_ukernel_4x8__neon_dup_ld128, xnn_init_f32_minmax_scalar_params);
+        .Test(xnn_f32_gemm_minmax_ukernel_1x8s4__neonfma, xnn_init_f32_minmax_scalar_params);
     }
   }
 
-  TEST(F32_GEMM_MINMAX_4X8__NEON_DUP_LD128, k_lt_4) {
-    TEST_REQUIRES_ARM_NEON;
+  TEST(F32_GEMM_MINMAX_1X8S4__NEONFMA, k_lt_4) {
+    TEST_REQUIRES_ARM_NEON_FMA;
     for (size_t k = 1; k < 4; k++) {
       GemmMicrokernelTester()
-        .mr(4)
+        .mr(1)
         .nr(8)
         .kr(1)
-        .sr(1)
-        .m(4)
+        .sr(4)
+        .m(1)
         .n(8)
         .k(k)
-        .Test(xnn_f32_gemm_minmax_ukernel_4x8__neon_dup_ld128, xnn_init_f32_minmax_scalar_params);
+        .Test(xnn_f32_gemm_minmax_ukernel_1x8s4__neonfma, xnn_init_f32_minmax_scalar_params);
     }
   }
 
-  TEST(F32_GEMM_MINMAX_4X8__NEON_DUP_LD128, k_lt_4_strided_a) {
-    TEST_REQUIRES_ARM_NEON;
+  TEST(F32_GEMM_MINMAX_1X8S4__NEONFMA, k_lt_4_strided_a) {
+    TEST_REQUIRES_ARM_NEON_FMA;
     for (size_t k = 1; k < 4; k++) {
       GemmMicrokernelTester()
-        .mr(4)
+        .mr(1)
         .nr(8)
         .kr(1)
-        .sr(1)
-        .m(4)
+        .sr(4)
+        .m(1)
         .n(8)
         .k(k)
         .a_stride(7)
-        .Test(xnn_f32_gemm_minmax_ukernel_4x8__neon_dup_ld128, xnn_init_f32_minmax_scalar_params);
+        .Test(xnn_f32_gemm_minmax_ukernel_1x8s4__neonfma, xnn_init_f32_minmax_scalar_params);
     }
   }
 
-  TEST(F32_GEMM_MINMAX_4X8__NEON_DUP_LD128, k_lt_4_subtile) {
-    TEST_REQUIRES_ARM_NEON;
+  TEST(F32_GEMM_MINMAX_1X8S4__NEONFMA, k_lt_4_subtile) {
+    TEST_REQUIRES_ARM_NEON_FMA;
     for (size_t k = 1; k < 4; k++) {
       for (uint32_t n = 1; n <= 8; n++) {
-        for (uint32_t m = 1; m <= 4; m++) {
+        for (uint32_t m = 1; m <= 1; m++) {
           GemmMicrokernelTester()
-            .mr(4)
+            .mr(1)
             .nr(8)
             .kr(1)
-            .sr(1)
+            .sr(4)
             .m(m)
             .n(n)
             .k(k)
             .iterations(1)
-            .Test(xnn_f32_gemm_minmax_ukernel_4x8__neon_dup_ld128, xnn_init_f32_minmax_scalar_params);
+            .Test(xnn_f32_gemm_minmax_ukernel_1x8s4__neonfma, xnn_init_f32_minmax_scalar_params);
         }
       }
     }
   }
 
-  TEST(F32_GEMM_MINMAX_4X8__NEON_DUP_LD128, k_gt_4) {
-    TEST_REQUIRES_ARM_NEON;
+  TEST(F32_GEMM_MINMAX_1X8S4__NEONFMA, k_gt_4) {
+    TEST_REQUIRES_ARM_NEON_FMA;
     for (size_t k = 5; k < 8; k++) {
       GemmMicrokernelTester()
-        .mr(4)
+        .mr(1)
         .nr(8)
         .kr(1)
-        .sr(1)
-        .m(4)
+        .sr(4)
+        .m(1)
         .n(8)
         .k(k)
-        .Test(xnn_f32_gemm_minmax_ukernel_4x8__neon_dup_ld128, xnn_init_f32_minmax_scalar_params);
+        .Test(xnn_f32_gemm_minmax_ukernel_1x8s4__neonfma, xnn_init_f32_minmax_scalar_params);
     }
   }
 
-  TEST(F32_GEMM_MINMAX_4X8__NEON_DUP_LD128, k_gt_4_strided_a) {
-    TEST_REQUIRES_ARM_NEON;
+  TEST(F32_GEMM_MINMAX_1X8S4__NEONFMA, k_gt_4_strided_a) {
+    TEST_REQUIRES_ARM_NEON_FMA;
     for (size_t k = 5; k < 8; k++) {
       GemmMicrokernelTester()
-        .mr(4)
+        .mr(1)
         .nr(8)
         .kr(1)
-        .sr(1)
-        .m(4)
+        .sr(4)
+        .m(1)
         .n(8)
         .k(k)
         .a_stride(11)
-        .Test(xnn_f32_gemm_minmax_ukernel_4x8__neon_dup_ld128, xnn_init_f32_minmax_scalar_params);
+        .Test(xnn_f32_gemm_minmax_ukernel_1x8s4__neonfma, xnn_init_f32_minmax_scalar_params);
     }
   }
 
-  TEST(F32_GEMM_MINMAX_4X8__NEON_DUP_LD128, k_gt_4_subtile) {
-    TEST_REQUIRES_ARM_NEON;
+  TEST(F32_GEMM_MINMAX_1X8S4__NEONFMA, k_gt_4_subtile) {
+    TEST_REQUIRES_ARM_NEON_FMA;
     for (size_t k = 5; k < 8; k++) {
       for (uint32_t n = 1; n <= 8; n++) {
-        for (uint32_t m = 1; m <= 4; m++) {
+        for (uint32_t m = 1; m <= 1; m++) {
           GemmMicrokernelTester()
-            .mr(4)
+            .mr(1)
             .nr(8)
             .kr(1)
-            .sr(1)
+            .sr(4)
             .m(m)
             .n(n)
             .k(k)
             .iterations(1)
-            .Test(xnn_f32_gemm_minmax_ukernel_4x8__neon_dup_ld128, xnn_init_f32_minmax_scalar_params);
+            .Test(xnn_f32_gemm_minmax_ukernel_1x8s4__neonfma, xnn_init_f32_minmax_scalar_params);
         }
       }
     }
   }
 
-  TEST(F32_GEMM_MINMAX_4X8__NEON_DUP_LD128, k_div_4) {
-    TEST_REQUIRES_ARM_NEON;
+  TEST(F32_GEMM_MINMAX_1X8S4__NEONFMA, k_div_4) {
+    TEST_REQUIRES_ARM_NEON_FMA;
     for (size_t k = 8; k <= 40; k += 4) {
       GemmMicrokernelTester()
-        .mr(4)
+        .mr(1)
         .nr(8)
         .kr(1)
-        .sr(1)
-        .m(4)
+        .sr(4)
+        .m(1)
         .n(8)
         .k(k)
-        .Test(xnn_f32_gemm_minmax_ukernel_4x8__neon_dup_ld128, xnn_init_f32_minmax_scalar_params);
+        .Test(xnn_f32_gemm_minmax_ukernel_1x8s4__neonfma, xnn_init_f32_minmax_scalar_params);
     }
   }
 
-  TEST(F32_GEMM_MINMAX_4X8__NEON_DUP_LD128, k_div_4_strided_a) {
-    TEST_REQUIRES_ARM_NEON;
+  TEST(F32_GEMM_MINMAX_1X8S4__NEONFMA, k_div_4_strided_a) {
+    TEST_REQUIRES_ARM_NEON_FMA;
     for (size_t k = 8; k <= 40; k += 4) {
       GemmMicrokernelTester()
-        .mr(4)
+        .mr(1)
         .nr(8)
         .kr(1)
-        .sr(1)
-        .m(4)
+        .sr(4)
+        .m(1)
         .n(8)
         .k(k)
         .a_stride(43)
-        .Test(xnn_f32_gemm_minmax_ukernel_4x8__neon_dup_ld128, xnn_init_f32_minmax_scalar_params);
+        .Test(xnn_f32_gemm_minmax_ukernel_1x8s4__neonfma, xnn_init_f32_minmax_scalar_params);
     }
   }
 
-  TEST(F32_GEMM_MINMAX_4X8__NEON_DUP_LD128, k_div_4_subtile) {
-    TEST_REQUIRES_ARM_NEON;
+  TEST(F32_GEMM_MINMAX_1X8S4__NEONFMA, k_div_4_subtile) {
+    TEST_REQUIRES_ARM_NEON_FMA;
     for (size_t k = 8; k <= 40; k += 4) {
       for (uint32_t n = 1; n <= 8; n++) {
-        for (uint32_t m = 1; m <= 4; m++) {
+        for (uint32_t m = 1; m <= 1; m++) {
           GemmMicrokernelTester()
-            .mr(4)
+            .mr(1)
             .nr(8)
             .kr(1)
-            .sr(1)
+            .sr(4)
             .m(m)
             .n(n)
             .k(k)
             .iterations(1)
-            .Test(xnn_f32_gemm_minmax_ukernel_4x8__neon_dup_ld128, xnn_init_f32_minmax_scalar_params);
+            .Test(xnn_f32_gemm_minmax_ukernel_1x8s4__neonfma, xnn_init_f32_minmax_scalar_params);
         }
       }
     }
   }
 
-  TEST(F32_GEMM_MINMAX_4X8__NEON_DUP_LD128, n_gt_8) {
-    TEST_REQUIRES_ARM_NEON;
+  TEST(F32_GEMM_MINMAX_1X8S4__NEONFMA, n_gt_8) {
+    TEST_REQUIRES_ARM_NEON_FMA;
     for (uint32_t n = 9; n < 16; n++) {
       for (size_t k = 1; k <= 20; k += 5) {
         GemmMicrokernelTester()
-          .mr(4)
+          .mr(1)
           .nr(8)
           .kr(1)
-          .sr(1)
-          .m(4)
+          .sr(4)
+          .m(1)
           .n(n)
           .k(k)
-          .Test(xnn_f32_gemm_minmax_ukernel_4x8__neon_dup_ld128, xnn_init_f32_minmax_scalar_params);
+          .Test(xnn_f32_gemm_minmax_ukernel_1x8s4__neonfma, xnn_init_f32_minmax_scalar_params);
       }
     }
   }
 
-  TEST(F32_GEMM_MINMAX_4X8__NEON_DUP_LD128, n_gt_8_strided_cn) {
-    TEST_REQUIRES_ARM_NEON;
+  TEST(F32_GEMM_MINMAX_1X8S4__NEONFMA, n_gt_8_strided_cn) {
+    TEST_REQUIRES_ARM_NEON_FMA;
     for (uint32_t n = 9; n < 16; n++) {
       for (size_t k = 1; k <= 20; k += 5) {
         GemmMicrokernelTester()
-          .mr(4)
+          .mr(1)
           .nr(8)
           .kr(1)
-          .sr(1)
-          .m(4)
+          .sr(4)
+          .m(1)
           .n(n)
           .k(k)
           .cn_stride(11)
-          .Test(xnn_f32_gemm_minmax_ukernel_4x8__neon_dup_ld128, xnn_init_f32_minmax_scalar_params);
+          .Test(xnn_f32_gemm_minmax_ukernel_1x8s4__neonfma, xnn_init_f32_minmax_scalar_params);
       }
     }
   }
 
-  TEST(F32_GEMM_MINMAX_4X8__NEON_DUP_LD128, n_gt_8_strided_a) {
-    TEST_REQUIRES_ARM_NEON;
+  TEST(F32_GEMM_MINMAX_1X8S4__NEONFMA, n_gt_8_strided_a) {
+    TEST_REQUIRES_ARM_NEON_FMA;
     for (uint32_t n = 9; n < 16; n++) {
       for (size_t k = 1; k <= 20; k += 5) {
         GemmMicrokernelTester()
-          .mr(4)
+          .mr(1)
           .nr(8)
           .kr(1)
-          .sr(1)
-          .m(4)
+          .sr(4)
+          .m(1)
           .n(n)
           .k(k)
           .a_stride(23)
-          .Test(xnn_f32_gemm_minmax_ukernel_4x8__neon_dup_ld128, xnn_init_f32_minmax_scalar_params);
+          .Test(xnn_f32_gemm_minmax_ukernel_1x8s4__neonfma, xnn_init_f32_minmax_scalar_params);
       }
     }
   }
 
-  TEST(F32_GEMM_MINMAX_4X8__NEON_DUP_LD128, n_gt_8_subtile) {
-    TEST_REQUIRES_ARM_NEON;
+  TEST(F32_GEMM_MINMAX_1X8S4__NEONFMA, n_gt_8_subtile) {
+    TEST_REQUIRES_ARM_NEON_FMA;
     for (uint32_t n = 9; n < 16; n++) {
       for (size_t k = 1; k <= 20; k += 5) {
-        for (uint32_t m = 1; m <= 4; m++) {
+        for (uint32_t m = 1; m <= 1; m++) {
           GemmMicrokernelTester()
-            .mr(4)
+            .mr(1)
             .nr(8)
             .kr(1)
-            .sr(1)
+            .sr(4)
             .m(m)
             .n(n)
             .k(k)
             .iterations(1)
-            .Test(xnn_f32_gemm_minmax_ukernel_4x8__neon_dup_ld128, xnn_init_f32_minmax_scalar_params);
+            .Test(xnn_f32_gemm_minmax_ukernel_1x8s4__neonfma, xnn_init_f32_minmax_scalar_params);
         }
       }
     }
   }
 
-  TEST(F32_GEMM_MINMAX_4X8__NEON_DUP_LD128, n_div_8) {
-    TEST_REQUIRES_ARM_NEON;
+  TEST(F32_GEMM_MINMAX_1X8S4__NEONFMA, n_div_8) {
+    TEST_REQUIRES_ARM_NEON_FMA;
     for (uint32_t n = 16; n <= 24; n += 8) {
       for (size_t k = 1; k <= 20; k += 5) {
         GemmMicrokernelTester()
-          .mr(4)
+          .mr(1)
           .nr(8)
           .kr(1)
-          .sr(1)
-          .m(4)
+          .sr(4)
+          .m(1)
           .n(n)
           .k(k)
-          .Test(xnn_f32_gemm_minmax_ukernel_4x8__neon_dup_ld128, xnn_init_f32_minmax_scalar_params);
+          .Test(xnn_f32_gemm_minmax_ukernel_1x8s4__neonfma, xnn_init_f32_minmax_scalar_params);
       }
     }
   }
 
-  TEST(F32_GEMM_MINMAX_4X8__NEON_DUP_LD128, n_div_8_strided_cn) {
-    TEST_REQUIRES_ARM_NEON;
+  TEST(F32_GEMM_MINMAX_1X8S4__NEONFMA, n_div_8_strided_cn) {
+    TEST_REQUIRES_ARM_NEON_FMA;
     for (uint32_t n = 16; n <= 24; n += 8) {
       for (size_t k = 1; k <= 20; k += 5) {
         GemmMicrokernelTester()
-          .mr(4)
+          .mr(1)
           .nr(8)
           .kr(1)
-          .sr(1)
-          .m(4)
+          .sr(4)
+          .m(1)
           .n(n)
           .k(k)
           .cn_stride(11)
-          .Test(xnn_f32_gemm_minmax_ukernel_4x8__neon_dup_ld128, xnn_init_f32_minmax_scalar_params);
+          .Test(xnn_f32_gemm_minmax_ukernel_1x8s4__neonfma, xnn_init_f32_minmax_scalar_params);
       }
     }
   }
 
-  TEST(F32_GEMM_MINMAX_4X8__NEON_DUP_LD128, n_div_8_strided_a) {
-    TEST_REQUIRES_ARM_NEON;
+  TEST(F32_GEMM_MINMAX_1X8S4__NEONFMA, n_div_8_strided_a) {
+    TEST_REQUIRES_ARM_NEON_FMA;
     for (uint32_t n = 16; n <= 24; n += 8) {
       for (size_t k = 1; k <= 20; k += 5) {
         GemmMicrokernelTester()
-          .mr(4)
+          .mr(1)
           .nr(8)
           .kr(1)
-          .sr(1)
-          .m(4)
+          .sr(4)
+          .m(1)
           .n(n)
           .k(k)
           .a_stride(23)
-          .Test(xnn_f32_gemm_minmax_ukernel_4x8__neon_dup_ld128, xnn_init_f32_minmax_scalar_params);
+          .Test(xnn_f32_gemm_minmax_ukernel_1x8s4__neonfma, xnn_init_f32_minmax_scalar_params);
       }
     }
   }
 
-  TEST(F32_GEMM_MINMAX_4X8__NEON_DUP_LD128, n_div_8_subtile) {
-    TEST_REQUIRES_ARM_NEON;
+  TEST(F32_GEMM_MINMAX_1X8S4__NEONFMA, n_div_8_subtile) {
+    TEST_REQUIRES_ARM_NEON_FMA;
     for (uint32_t n = 16; n <= 24; n += 8) {
       for (size_t k = 1; k <= 20; k += 5) {
-        for (uint32_t m = 1; m <= 4; m++) {
+        for (uint32_t m = 1; m <= 1; m++) {
           GemmMicrokernelTester()
-            .mr(4)
+            .mr(1)
             .nr(8)
             .kr(1)
-            .sr(1)
+            .sr(4)
             .m(m)
             .n(n)
             .k(k)
             .iterations(1)
-            .Test(xnn_f32_gemm_minmax_ukernel_4x8__neon_dup_ld128, xnn_init_f32_minmax_scalar_params);
+            .Test(xnn_f32_gemm_minmax_ukernel_1x8s4__neonfma, xnn_init_f32_minmax_scalar_params);
         }
       }
     }
   }
 
-  TEST(F32_GEMM_MINMAX_4X8__NEON_DUP_LD128, strided_cm_subtile) {
-    TEST_REQUIRES_ARM_NEON;
+  TEST(F32_GEMM_MINMAX_1X8S4__NEONFMA, strided_cm_subtile) {
+    TEST_REQUIRES_ARM_NEON_FMA;
     for (size_t k = 1; k <= 20; k += 5) {
       for (uint32_t n = 1; n <= 8; n++) {
-        for (uint32_t m = 1; m <= 4; m++) {
+        for (uint32_t m = 1; m <= 1; m++) {
           GemmMicrokernelTester()
-            .mr(4)
+            .mr(1)
             .nr(8)
             .kr(1)
-            .sr(1)
+            .sr(4)
             .m(m)
             .n(n)
             .k(k)
             .cm_stride(11)
             .iterations(1)
-            .Test(xnn_f32_gemm_minmax_ukernel_4x8__neon_dup_ld128, xnn_init_f32_minmax_scalar_params);
+            .Test(xnn_f32_gemm_minmax_ukernel_1x8s4__neonfma, xnn_init_f32_minmax_scalar_params);
         }
       }
     }
   }
 
-  TEST(F32_GEMM_MINMAX_4X8__NEON_DUP_LD128, qmin) {
-    TEST_REQUIRES_ARM_NEON;
+  TEST(F32_GEMM_MINMAX_1X8S4__NEONFMA, qmin) {
+    TEST_REQUIRES_ARM_NEON_FMA;
     GemmMicrokernelTester()
-      .mr(4)
+      .mr(1)
       .nr(8)
       .kr(1)
-      .sr(1)
-      .m(4)
+      .sr(4)
+      .m(1)
       .n(8)
       .k(4)
       .qmin(128)
-      .Test(xnn_f32_gemm_minmax_ukernel_4x8__neon_dup_ld128, xnn_init_f32_minmax_scalar_params);
+      .Test(xnn_f32_gemm_minmax_ukernel_1x8s4__neonfma, xnn_init_f32_minmax_scalar_params);
   }
 
-  TEST(F32_GEMM_MINMAX_4X8__NEON_DUP_LD128, qmax) {
-    TEST_REQUIRES_ARM_NEON;
+  TEST(F32_GEMM_MINMAX_1X8S4__NEONFMA, qmax) {
+    TEST_REQUIRES_ARM_NEON_FMA;
     GemmMicrokernelTester()
-      .mr(4)
+      .mr(1)
       .nr(8)
       .kr(1)
-      .sr(1)
-      .m(4)
+      .sr(4)
+      .m(1)
       .n(8)
       .k(4)
       .qmax(128)
-      .Test(xnn_f32_gemm_minmax_ukernel_4x8__neon_dup_ld128, xnn_init_f32_minmax_scalar_params);
+      .Test(xnn_f32_gemm_minmax_ukernel_1x8s4__neonfma, xnn_init_f32_minmax_scalar_params);
   }
 
-  TEST(F32_GEMM_MINMAX_4X8__NEON_DUP_LD128, strided_cm) {
-    TEST_REQUIRES_ARM_NEON;
+  TEST(F32_GEMM_MINMAX_1X8S4__NEONFMA, strided_cm) {
+    TEST_REQUIRES_ARM_NEON_FMA;
     GemmMicrokernelTester()
-      .mr(4)
+      .mr(1)
       .nr(8)
       .kr(1)
-      .sr(1)
-      .m(4)
+      .sr(4)
+      .m(1)
       .n(8)
       .k(4)
       .cm_stride(11)
-      .Test(xnn_f32_gemm_minmax_ukernel_4x8__neon_dup_ld128, xnn_init_f32_minmax_scalar_params);
+      .Test(xnn_f32_gemm_minmax_ukernel_1x8s4__neonfma, xnn_init_f32_minmax_scalar_params);
   }
 #endif  // XNN_ARCH_ARM || XNN_ARCH_ARM64
 
 
 #if XNN_ARCH_ARM || XNN_ARCH_ARM64
-  TEST(F32_GEMM_MINMAX_4X8__NEON_LANE_LD64, k_eq_2) {
+  TEST(F32_GEMM_MINMAX_4X8__NEON_DUP_LD128, k_eq_4) {
     TEST_REQUIRES_ARM_NEON;
     GemmMicrokernelTester()
       .mr(4)
@@ -9192,11 +9192,11 @@
       .sr(1)
       .m(4)
       .n(8)
-      .k(2)
-      .Test(xnn_f32_gemm_minmax_ukernel_4x8__neon_lane_ld64, xnn_init_f32_minmax_scalar_params);
+      .k(4)
+      .Test(xnn_f32_gemm_minmax_ukernel_4x8__neon_dup_ld128, xnn_init_f32_minmax_scalar_params);
   }
 
-  TEST(F32_GEMM_MINMAX_4X8__NEON_LANE_LD64, strided_cn) {
+  TEST(F32_GEMM_MINMAX_4X8__NEON_DUP_LD128, strided_cn) {
     TEST_REQUIRES_ARM_NEON;
     GemmMicrokernelTester()
       .mr(4)
@@ -9205,12 +9205,12 @@
       .sr(1)
       .m(4)
       .n(8)
-      .k(2)
+      .k(4)
       .cn_stride(11)
-      .Test(xnn_f32_gemm_minmax_ukernel_4x8__neon_lane_ld64, xnn_init_f32_minmax_scalar_params);
+      .Test(xnn_f32_gemm_minmax_ukernel_4x8__neon_dup_ld128, xnn_init_f32_minmax_scalar_params);
   }
 
-  TEST(F32_GEMM_MINMAX_4X8__NEON_LANE_LD64, k_eq_2_strided_a) {
+  TEST(F32_GEMM_MINMAX_4X8__NEON_DUP_LD128, k_eq_4_strided_a) {
     TEST_REQUIRES_ARM_NEON;
     GemmMicrokernelTester()
       .mr(4)
@@ -9219,12 +9219,12 @@
       .sr(1)
       .m(4)
       .n(8)
-      .k(2)
-      .a_stride(5)
-      .Test(xnn_f32_gemm_minmax_ukernel_4x8__neon_lane_ld64, xnn_init_f32_minmax_scalar_params);
+      .k(4)
+      .a_stride(7)
+      .Test(xnn_f32_gemm_minmax_ukernel_4x8__neon_dup_ld128, xnn_init_f32_minmax_scalar_params);
   }
 
-  TEST(F32_GEMM_MINMAX_4X8__NEON_LANE_LD64, k_eq_2_subtile) {
+  TEST(F32_GEMM_MINMAX_4X8__NEON_DUP_LD128, k_eq_4_subtile) {
     TEST_REQUIRES_ARM_NEON;
     for (uint32_t n = 1; n <= 8; n++) {
       for (uint32_t m = 1; m <= 4; m++) {
@@ -9235,14 +9235,14 @@
           .sr(1)
           .m(m)
           .n(n)
-          .k(2)
+          .k(4)
           .iterations(1)
-          .Test(xnn_f32_gemm_minmax_ukernel_4x8__neon_lane_ld64, xnn_init_f32_minmax_scalar_params);
+          .Test(xnn_f32_gemm_minmax_ukernel_4x8__neon_dup_ld128, xnn_init_f32_minmax_scalar_params);
       }
     }
   }
 
-  TEST(F32_GEMM_MINMAX_4X8__NEON_LANE_LD64, k_eq_2_subtile_m) {
+  TEST(F32_GEMM_MINMAX_4X8__NEON_DUP_LD128, k_eq_4_subtile_m) {
     TEST_REQUIRES_ARM_NEON;
     for (uint32_t m = 1; m <= 4; m++) {
       GemmMicrokernelTester()
@@ -9252,13 +9252,13 @@
         .sr(1)
         .m(m)
         .n(8)
-        .k(2)
+        .k(4)
         .iterations(1)
-        .Test(xnn_f32_gemm_minmax_ukernel_4x8__neon_lane_ld64, xnn_init_f32_minmax_scalar_params);
+        .Test(xnn_f32_gemm_minmax_ukernel_4x8__neon_dup_ld128, xnn_init_f32_minmax_scalar_params);
     }
   }
 
-  TEST(F32_GEMM_MINMAX_4X8__NEON_LANE_LD64, k_eq_2_subtile_n) {
+  TEST(F32_GEMM_MINMAX_4X8__NEON_DUP_LD128, k_eq_4_subtile_n) {
     TEST_REQUIRES_ARM_NEON;
     for (uint32_t n = 1; n <= 8; n++) {
       GemmMicrokernelTester()
@@ -9268,15 +9268,15 @@
         .sr(1)
         .m(4)
         .n(n)
-        .k(2)
+        .k(4)
         .iterations(1)
-        .Test(xnn_f32_gemm_minmax_ukernel_4x8__neon_lane_ld64, xnn_init_f32_minmax_scalar_params);
+        .Test(xnn_f32_gemm_minmax_ukernel_4x8__neon_dup_ld128, xnn_init_f32_minmax_scalar_params);
     }
   }
 
-  TEST(F32_GEMM_MINMAX_4X8__NEON_LANE_LD64, k_lt_2) {
+  TEST(F32_GEMM_MINMAX_4X8__NEON_DUP_LD128, k_lt_4) {
     TEST_REQUIRES_ARM_NEON;
-    for (size_t k = 1; k < 2; k++) {
+    for (size_t k = 1; k < 4; k++) {
       GemmMicrokernelTester()
         .mr(4)
         .nr(8)
@@ -9285,13 +9285,13 @@
         .m(4)
         .n(8)
         .k(k)
-        .Test(xnn_f32_gemm_minmax_ukernel_4x8__neon_lane_ld64, xnn_init_f32_minmax_scalar_params);
+        .Test(xnn_f32_gemm_minmax_ukernel_4x8__neon_dup_ld128, xnn_init_f32_minmax_scalar_params);
     }
   }
 
-  TEST(F32_GEMM_MINMAX_4X8__NEON_LANE_LD64, k_lt_2_strided_a) {
+  TEST(F32_GEMM_MINMAX_4X8__NEON_DUP_LD128, k_lt_4_strided_a) {
     TEST_REQUIRES_ARM_NEON;
-    for (size_t k = 1; k < 2; k++) {
+    for (size_t k = 1; k < 4; k++) {
       GemmMicrokernelTester()
         .mr(4)
         .nr(8)
@@ -9300,14 +9300,14 @@
         .m(4)
         .n(8)
         .k(k)
-        .a_stride(5)
-        .Test(xnn_f32_gemm_minmax_ukernel_4x8__neon_lane_ld64, xnn_init_f32_minmax_scalar_params);
+        .a_stride(7)
+        .Test(xnn_f32_gemm_minmax_ukernel_4x8__neon_dup_ld128, xnn_init_f32_minmax_scalar_params);
     }
   }
 
-  TEST(F32_GEMM_MINMAX_4X8__NEON_LANE_LD64, k_lt_2_subtile) {
+  TEST(F32_GEMM_MINMAX_4X8__NEON_DUP_LD128, k_lt_4_subtile) {
     TEST_REQUIRES_ARM_NEON;
-    for (size_t k = 1; k < 2; k++) {
+    for (size_t k = 1; k < 4; k++) {
       for (uint32_t n = 1; n <= 8; n++) {
         for (uint32_t m = 1; m <= 4; m++) {
           GemmMicrokernelTester()
@@ -9319,15 +9319,15 @@
             .n(n)
             .k(k)
             .iterations(1)
-            .Test(xnn_f32_gemm_minmax_ukernel_4x8__neon_lane_ld64, xnn_init_f32_minmax_scalar_params);
+            .Test(xnn_f32_gemm_minmax_ukernel_4x8__neon_dup_ld128, xnn_init_f32_minmax_scalar_params);
         }
       }
     }
   }
 
-  TEST(F32_GEMM_MINMAX_4X8__NEON_LANE_LD64, k_gt_2) {
+  TEST(F32_GEMM_MINMAX_4X8__NEON_DUP_LD128, k_gt_4) {
     TEST_REQUIRES_ARM_NEON;
-    for (size_t k = 3; k < 4; k++) {
+    for (size_t k = 5; k < 8; k++) {
       GemmMicrokernelTester()
         .mr(4)
         .nr(8)
@@ -9336,13 +9336,13 @@
         .m(4)
         .n(8)
         .k(k)
-        .Test(xnn_f32_gemm_minmax_ukernel_4x8__neon_lane_ld64, xnn_init_f32_minmax_scalar_params);
+        .Test(xnn_f32_gemm_minmax_ukernel_4x8__neon_dup_ld128, xnn_init_f32_minmax_scalar_params);
     }
   }
 
-  TEST(F32_GEMM_MINMAX_4X8__NEON_LANE_LD64, k_gt_2_strided_a) {
+  TEST(F32_GEMM_MINMAX_4X8__NEON_DUP_LD128, k_gt_4_strided_a) {
     TEST_REQUIRES_ARM_NEON;
-    for (size_t k = 3; k < 4; k++) {
+    for (size_t k = 5; k < 8; k++) {
       GemmMicrokernelTester()
         .mr(4)
         .nr(8)
@@ -9351,14 +9351,14 @@
         .m(4)
         .n(8)
         .k(k)
-        .a_stride(7)
-        .Test(xnn_f32_gemm_minmax_ukernel_4x8__neon_lane_ld64, xnn_init_f32_minmax_scalar_params);
+        .a_stride(11)
+        .Test(xnn_f32_gemm_minmax_ukernel_4x8__neon_dup_ld128, xnn_init_f32_minmax_scalar_params);
     }
   }
 
-  TEST(F32_GEMM_MINMAX_4X8__NEON_LANE_LD64, k_gt_2_subtile) {
+  TEST(F32_GEMM_MINMAX_4X8__NEON_DUP_LD128, k_gt_4_subtile) {
     TEST_REQUIRES_ARM_NEON;
-    for (size_t k = 3; k < 4; k++) {
+    for (size_t k = 5; k < 8; k++) {
       for (uint32_t n = 1; n <= 8; n++) {
         for (uint32_t m = 1; m <= 4; m++) {
           GemmMicrokernelTester()
@@ -9370,15 +9370,15 @@
             .n(n)
             .k(k)
             .iterations(1)
-            .Test(xnn_f32_gemm_minmax_ukernel_4x8__neon_lane_ld64, xnn_init_f32_minmax_scalar_params);
+            .Test(xnn_f32_gemm_minmax_ukernel_4x8__neon_dup_ld128, xnn_init_f32_minmax_scalar_params);
         }
       }
     }
   }
 
-  TEST(F32_GEMM_MINMAX_4X8__NEON_LANE_LD64, k_div_2) {
+  TEST(F32_GEMM_MINMAX_4X8__NEON_DUP_LD128, k_div_4) {
     TEST_REQUIRES_ARM_NEON;
-    for (size_t k = 4; k <= 20; k += 2) {
+    for (size_t k = 8; k <= 40; k += 4) {
       GemmMicrokernelTester()
         .mr(4)
         .nr(8)
@@ -9387,13 +9387,13 @@
         .m(4)
         .n(8)
         .k(k)
-        .Test(xnn_f32_gemm_minmax_ukernel_4x8__neon_lane_ld64, xnn_init_f32_minmax_scalar_params);
+        .Test(xnn_f32_gemm_minmax_ukernel_4x8__neon_dup_ld128, xnn_init_f32_minmax_scalar_params);
     }
   }
 
-  TEST(F32_GEMM_MINMAX_4X8__NEON_LANE_LD64, k_div_2_strided_a) {
+  TEST(F32_GEMM_MINMAX_4X8__NEON_DUP_LD128, k_div_4_strided_a) {
     TEST_REQUIRES_ARM_NEON;
-    for (size_t k = 4; k <= 20; k += 2) {
+    for (size_t k = 8; k <= 40; k += 4) {
       GemmMicrokernelTester()
         .mr(4)
         .nr(8)
@@ -9402,14 +9402,14 @@
         .m(4)
         .n(8)
         .k(k)
-        .a_stride(23)
-        .Test(xnn_f32_gemm_minmax_ukernel_4x8__neon_lane_ld64, xnn_init_f32_minmax_scalar_params);
+        .a_stride(43)
+        .Test(xnn_f32_gemm_minmax_ukernel_4x8__neon_dup_ld128, xnn_init_f32_minmax_scalar_params);
     }
   }
 
-  TEST(F32_GEMM_MINMAX_4X8__NEON_LANE_LD64, k_div_2_subtile) {
+  TEST(F32_GEMM_MINMAX_4X8__NEON_DUP_LD128, k_div_4_subtile) {
     TEST_REQUIRES_ARM_NEON;
-    for (size_t k = 4; k <= 20; k += 2) {
+    for (size_t k = 8; k <= 40; k += 4) {
       for (uint32_t n = 1; n <= 8; n++) {
         for (uint32_t m = 1; m <= 4; m++) {
           GemmMicrokernelTester()
@@ -9421,16 +9421,16 @@
             .n(n)
             .k(k)
             .iterations(1)
-            .Test(xnn_f32_gemm_minmax_ukernel_4x8__neon_lane_ld64, xnn_init_f32_minmax_scalar_params);
+            .Test(xnn_f32_gemm_minmax_ukernel_4x8__neon_dup_ld128, xnn_init_f32_minmax_scalar_params);
         }
       }
     }
   }
 
-  TEST(F32_GEMM_MINMAX_4X8__NEON_LANE_LD64, n_gt_8) {
+  TEST(F32_GEMM_MINMAX_4X8__NEON_DUP_LD128, n_gt_8) {
     TEST_REQUIRES_ARM_NEON;
     for (uint32_t n = 9; n < 16; n++) {
-      for (size_t k = 1; k <= 10; k += 3) {
+      for (size_t k = 1; k <= 20; k += 5) {
         GemmMicrokernelTester()
           .mr(4)
           .nr(8)
@@ -9439,15 +9439,15 @@
           .m(4)
           .n(n)
           .k(k)
-          .Test(xnn_f32_gemm_minmax_ukernel_4x8__neon_lane_ld64, xnn_init_f32_minmax_scalar_params);
+          .Test(xnn_f32_gemm_minmax_ukernel_4x8__neon_dup_ld128, xnn_init_f32_minmax_scalar_params);
       }
     }
   }
 
-  TEST(F32_GEMM_MINMAX_4X8__NEON_LANE_LD64, n_gt_8_strided_cn) {
+  TEST(F32_GEMM_MINMAX_4X8__NEON_DUP_LD128, n_gt_8_strided_cn) {
     TEST_REQUIRES_ARM_NEON;
     for (uint32_t n = 9; n < 16; n++) {
-      for (size_t k = 1; k <= 10; k += 3) {
+      for (size_t k = 1; k <= 20; k += 5) {
         GemmMicrokernelTester()
           .mr(4)
           .nr(8)
@@ -9457,15 +9457,15 @@
           .n(n)
           .k(k)
           .cn_stride(11)
-          .Test(xnn_f32_gemm_minmax_ukernel_4x8__neon_lane_ld64, xnn_init_f32_minmax_scalar_params);
+          .Test(xnn_f32_gemm_minmax_ukernel_4x8__neon_dup_ld128, xnn_init_f32_minmax_scalar_params);
       }
     }
   }
 
-  TEST(F32_GEMM_MINMAX_4X8__NEON_LANE_LD64, n_gt_8_strided_a) {
+  TEST(F32_GEMM_MINMAX_4X8__NEON_DUP_LD128, n_gt_8_strided_a) {
     TEST_REQUIRES_ARM_NEON;
     for (uint32_t n = 9; n < 16; n++) {
-      for (size_t k = 1; k <= 10; k += 3) {
+      for (size_t k = 1; k <= 20; k += 5) {
         GemmMicrokernelTester()
           .mr(4)
           .nr(8)
@@ -9474,16 +9474,16 @@
           .m(4)
           .n(n)
           .k(k)
-          .a_stride(13)
-          .Test(xnn_f32_gemm_minmax_ukernel_4x8__neon_lane_ld64, xnn_init_f32_minmax_scalar_params);
+          .a_stride(23)
+          .Test(xnn_f32_gemm_minmax_ukernel_4x8__neon_dup_ld128, xnn_init_f32_minmax_scalar_params);
       }
     }
   }
 
-  TEST(F32_GEMM_MINMAX_4X8__NEON_LANE_LD64, n_gt_8_subtile) {
+  TEST(F32_GEMM_MINMAX_4X8__NEON_DUP_LD128, n_gt_8_subtile) {
     TEST_REQUIRES_ARM_NEON;
     for (uint32_t n = 9; n < 16; n++) {
-      for (size_t k = 1; k <= 10; k += 3) {
+      for (size_t k = 1; k <= 20; k += 5) {
         for (uint32_t m = 1; m <= 4; m++) {
           GemmMicrokernelTester()
             .mr(4)
@@ -9494,16 +9494,16 @@
             .n(n)
             .k(k)
             .iterations(1)
-            .Test(xnn_f32_gemm_minmax_ukernel_4x8__neon_lane_ld64, xnn_init_f32_minmax_scalar_params);
+            .Test(xnn_f32_gemm_minmax_ukernel_4x8__neon_dup_ld128, xnn_init_f32_minmax_scalar_params);
         }
       }
     }
   }
 
-  TEST(F32_GEMM_MINMAX_4X8__NEON_LANE_LD64, n_div_8) {
+  TEST(F32_GEMM_MINMAX_4X8__NEON_DUP_LD128, n_div_8) {
     TEST_REQUIRES_ARM_NEON;
     for (uint32_t n = 16; n <= 24; n += 8) {
-      for (size_t k = 1; k <= 10; k += 3) {
+      for (size_t k = 1; k <= 20; k += 5) {
         GemmMicrokernelTester()
           .mr(4)
           .nr(8)
@@ -9512,15 +9512,15 @@
           .m(4)
           .n(n)
           .k(k)
-          .Test(xnn_f32_gemm_minmax_ukernel_4x8__neon_lane_ld64, xnn_init_f32_minmax_scalar_params);
+          .Test(xnn_f32_gemm_minmax_ukernel_4x8__neon_dup_ld128, xnn_init_f32_minmax_scalar_params);
       }
     }
   }
 
-  TEST(F32_GEMM_MINMAX_4X8__NEON_LANE_LD64, n_div_8_strided_cn) {
+  TEST(F32_GEMM_MINMAX_4X8__NEON_DUP_LD128, n_div_8_strided_cn) {
     TEST_REQUIRES_ARM_NEON;
     for (uint32_t n = 16; n <= 24; n += 8) {
-      for (size_t k = 1; k <= 10; k += 3) {
+      for (size_t k = 1; k <= 20; k += 5) {
         GemmMicrokernelTester()
           .mr(4)
           .nr(8)
@@ -9530,15 +9530,15 @@
           .n(n)
           .k(k)
           .cn_stride(11)
-          .Test(xnn_f32_gemm_minmax_ukernel_4x8__neon_lane_ld64, xnn_init_f32_minmax_scalar_params);
+          .Test(xnn_f32_gemm_minmax_ukernel_4x8__neon_dup_ld128, xnn_init_f32_minmax_scalar_params);
       }
     }
   }
 
-  TEST(F32_GEMM_MINMAX_4X8__NEON_LANE_LD64, n_div_8_strided_a) {
+  TEST(F32_GEMM_MINMAX_4X8__NEON_DUP_LD128, n_div_8_strided_a) {
     TEST_REQUIRES_ARM_NEON;
     for (uint32_t n = 16; n <= 24; n += 8) {
-      for (size_t k = 1; k <= 10; k += 3) {
+      for (size_t k = 1; k <= 20; k += 5) {
         GemmMicrokernelTester()
           .mr(4)
           .nr(8)
@@ -9547,16 +9547,16 @@
           .m(4)
           .n(n)
           .k(k)
-          .a_stride(13)
-          .Test(xnn_f32_gemm_minmax_ukernel_4x8__neon_lane_ld64, xnn_init_f32_minmax_scalar_params);
+          .a_stride(23)
+          .Test(xnn_f32_gemm_minmax_ukernel_4x8__neon_dup_ld128, xnn_init_f32_minmax_scalar_params);
       }
     }
   }
 
-  TEST(F32_GEMM_MINMAX_4X8__NEON_LANE_LD64, n_div_8_subtile) {
+  TEST(F32_GEMM_MINMAX_4X8__NEON_DUP_LD128, n_div_8_subtile) {
     TEST_REQUIRES_ARM_NEON;
     for (uint32_t n = 16; n <= 24; n += 8) {
-      for (size_t k = 1; k <= 10; k += 3) {
+      for (size_t k = 1; k <= 20; k += 5) {
         for (uint32_t m = 1; m <= 4; m++) {
           GemmMicrokernelTester()
             .mr(4)
@@ -9567,15 +9567,15 @@
             .n(n)
             .k(k)
             .iterations(1)
-            .Test(xnn_f32_gemm_minmax_ukernel_4x8__neon_lane_ld64, xnn_init_f32_minmax_scalar_params);
+            .Test(xnn_f32_gemm_minmax_ukernel_4x8__neon_dup_ld128, xnn_init_f32_minmax_scalar_params);
         }
       }
     }
   }
 
-  TEST(F32_GEMM_MINMAX_4X8__NEON_LANE_LD64, strided_cm_subtile) {
+  TEST(F32_GEMM_MINMAX_4X8__NEON_DUP_LD128, strided_cm_subtile) {
     TEST_REQUIRES_ARM_NEON;
-    for (size_t k = 1; k <= 10; k += 3) {
+    for (size_t k = 1; k <= 20; k += 5) {
       for (uint32_t n = 1; n <= 8; n++) {
         for (uint32_t m = 1; m <= 4; m++) {
           GemmMicrokernelTester()
@@ -9588,13 +9588,13 @@
             .k(k)
             .cm_stride(11)
             .iterations(1)
-            .Test(xnn_f32_gemm_minmax_ukernel_4x8__neon_lane_ld64, xnn_init_f32_minmax_scalar_params);
+            .Test(xnn_f32_gemm_minmax_ukernel_4x8__neon_dup_ld128, xnn_init_f32_minmax_scalar_params);
         }
       }
     }
   }
 
-  TEST(F32_GEMM_MINMAX_4X8__NEON_LANE_LD64, qmin) {
+  TEST(F32_GEMM_MINMAX_4X8__NEON_DUP_LD128, qmin) {
     TEST_REQUIRES_ARM_NEON;
     GemmMicrokernelTester()
       .mr(4)
@@ -9603,12 +9603,12 @@
       .sr(1)
       .m(4)
       .n(8)
-      .k(2)
+      .k(4)
       .qmin(128)
-      .Test(xnn_f32_gemm_minmax_ukernel_4x8__neon_lane_ld64, xnn_init_f32_minmax_scalar_params);
+      .Test(xnn_f32_gemm_minmax_ukernel_4x8__neon_dup_ld128, xnn_init_f32_minmax_scalar_params);
   }
 
-  TEST(F32_GEMM_MINMAX_4X8__NEON_LANE_LD64, qmax) {
+  TEST(F32_GEMM_MINMAX_4X8__NEON_DUP_LD128, qmax) {
     TEST_REQUIRES_ARM_NEON;
     GemmMicrokernelTester()
       .mr(4)
@@ -9617,12 +9617,12 @@
       .sr(1)
       .m(4)
       .n(8)
-      .k(2)
+      .k(4)
       .qmax(128)
-      .Test(xnn_f32_gemm_minmax_ukernel_4x8__neon_lane_ld64, xnn_init_f32_minmax_scalar_params);
+      .Test(xnn_f32_gemm_minmax_ukernel_4x8__neon_dup_ld128, xnn_init_f32_minmax_scalar_params);
   }
 
-  TEST(F32_GEMM_MINMAX_4X8__NEON_LANE_LD64, strided_cm) {
+  TEST(F32_GEMM_MINMAX_4X8__NEON_DUP_LD128, strided_cm) {
     TEST_REQUIRES_ARM_NEON;
     GemmMicrokernelTester()
       .mr(4)
@@ -9631,15 +9631,15 @@
       .sr(1)
       .m(4)
       .n(8)
-      .k(2)
+      .k(4)
       .cm_stride(11)
-      .Test(xnn_f32_gemm_minmax_ukernel_4x8__neon_lane_ld64, xnn_init_f32_minmax_scalar_params);
+      .Test(xnn_f32_gemm_minmax_ukernel_4x8__neon_dup_ld128, xnn_init_f32_minmax_scalar_params);
   }
 #endif  // XNN_ARCH_ARM || XNN_ARCH_ARM64
 
 
 #if XNN_ARCH_ARM || XNN_ARCH_ARM64
-  TEST(F32_GEMM_MINMAX_4X8__NEON_LANE_LD128, k_eq_4) {
+  TEST(F32_GEMM_MINMAX_4X8__NEON_LANE_LD64, k_eq_2) {
     TEST_REQUIRES_ARM_NEON;
     GemmMicrokernelTester()
       .mr(4)
@@ -9648,11 +9648,11 @@
       .sr(1)
       .m(4)
       .n(8)
-      .k(4)
-      .Test(xnn_f32_gemm_minmax_ukernel_4x8__neon_lane_ld128, xnn_init_f32_minmax_scalar_params);
+      .k(2)
+      .Test(xnn_f32_gemm_minmax_ukernel_4x8__neon_lane_ld64, xnn_init_f32_minmax_scalar_params);
   }
 
-  TEST(F32_GEMM_MINMAX_4X8__NEON_LANE_LD128, strided_cn) {
+  TEST(F32_GEMM_MINMAX_4X8__NEON_LANE_LD64, strided_cn) {
     TEST_REQUIRES_ARM_NEON;
     GemmMicrokernelTester()
       .mr(4)
@@ -9661,12 +9661,12 @@
       .sr(1)
       .m(4)
       .n(8)
-      .k(4)
+      .k(2)
       .cn_stride(11)
-      .Test(xnn_f32_gemm_minmax_ukernel_4x8__neon_lane_ld128, xnn_init_f32_minmax_scalar_params);
+      .Test(xnn_f32_gemm_minmax_ukernel_4x8__neon_lane_ld64, xnn_init_f32_minmax_scalar_params);
   }
 
-  TEST(F32_GEMM_MINMAX_4X8__NEON_LANE_LD128, k_eq_4_strided_a) {
+  TEST(F32_GEMM_MINMAX_4X8__NEON_LANE_LD64, k_eq_2_strided_a) {
     TEST_REQUIRES_ARM_NEON;
     GemmMicrokernelTester()
       .mr(4)
@@ -9675,12 +9675,12 @@
       .sr(1)
       .m(4)
       .n(8)
-      .k(4)
-      .a_stride(7)
-      .Test(xnn_f32_gemm_minmax_ukernel_4x8__neon_lane_ld128, xnn_init_f32_minmax_scalar_params);
+      .k(2)
+      .a_stride(5)
+      .Test(xnn_f32_gemm_minmax_ukernel_4x8__neon_lane_ld64, xnn_init_f32_minmax_scalar_params);
   }
 
-  TEST(F32_GEMM_MINMAX_4X8__NEON_LANE_LD128, k_eq_4_subtile) {
+  TEST(F32_GEMM_MINMAX_4X8__NEON_LANE_LD64, k_eq_2_subtile) {
     TEST_REQUIRES_ARM_NEON;
     for (uint32_t n = 1; n <= 8; n++) {
       for (uint32_t m = 1; m <= 4; m++) {
@@ -9691,14 +9691,14 @@
           .sr(1)
           .m(m)
           .n(n)
-          .k(4)
+          .k(2)
           .iterations(1)
-          .Test(xnn_f32_gemm_minmax_ukernel_4x8__neon_lane_ld128, xnn_init_f32_minmax_scalar_params);
+          .Test(xnn_f32_gemm_minmax_ukernel_4x8__neon_lane_ld64, xnn_init_f32_minmax_scalar_params);
       }
     }
   }
 
-  TEST(F32_GEMM_MINMAX_4X8__NEON_LANE_LD128, k_eq_4_subtile_m) {
+  TEST(F32_GEMM_MINMAX_4X8__NEON_LANE_LD64, k_eq_2_subtile_m) {
     TEST_REQUIRES_ARM_NEON;
     for (uint32_t m = 1; m <= 4; m++) {
       GemmMicrokernelTester()
@@ -9708,13 +9708,13 @@
         .sr(1)
         .m(m)
         .n(8)
-        .k(4)
+        .k(2)
         .iterations(1)
-        .Test(xnn_f32_gemm_minmax_ukernel_4x8__neon_lane_ld128, xnn_init_f32_minmax_scalar_params);
+        .Test(xnn_f32_gemm_minmax_ukernel_4x8__neon_lane_ld64, xnn_init_f32_minmax_scalar_params);
     }
   }
 
-  TEST(F32_GEMM_MINMAX_4X8__NEON_LANE_LD128, k_eq_4_subtile_n) {
+  TEST(F32_GEMM_MINMAX_4X8__NEON_LANE_LD64, k_eq_2_subtile_n) {
     TEST_REQUIRES_ARM_NEON;
     for (uint32_t n = 1; n <= 8; n++) {
       GemmMicrokernelTester()
@@ -9724,15 +9724,15 @@
         .sr(1)
         .m(4)
         .n(n)
-        .k(4)
+        .k(2)
         .iterations(1)
-        .Test(xnn_f32_gemm_minmax_ukernel_4x8__neon_lane_ld128, xnn_init_f32_minmax_scalar_params);
+        .Test(xnn_f32_gemm_minmax_ukernel_4x8__neon_lane_ld64, xnn_init_f32_minmax_scalar_params);
     }
   }
 
-  TEST(F32_GEMM_MINMAX_4X8__NEON_LANE_LD128, k_lt_4) {
+  TEST(F32_GEMM_MINMAX_4X8__NEON_LANE_LD64, k_lt_2) {
     TEST_REQUIRES_ARM_NEON;
-    for (size_t k = 1; k < 4; k++) {
+    for (size_t k = 1; k < 2; k++) {
       GemmMicrokernelTester()
         .mr(4)
         .nr(8)
@@ -9741,13 +9741,13 @@
         .m(4)
         .n(8)
         .k(k)
-        .Test(xnn_f32_gemm_minmax_ukernel_4x8__neon_lane_ld128, xnn_init_f32_minmax_scalar_params);
+        .Test(xnn_f32_gemm_minmax_ukernel_4x8__neon_lane_ld64, xnn_init_f32_minmax_scalar_params);
     }
   }
 
-  TEST(F32_GEMM_MINMAX_4X8__NEON_LANE_LD128, k_lt_4_strided_a) {
+  TEST(F32_GEMM_MINMAX_4X8__NEON_LANE_LD64, k_lt_2_strided_a) {
     TEST_REQUIRES_ARM_NEON;
-    for (size_t k = 1; k < 4; k++) {
+    for (size_t k = 1; k < 2; k++) {
       GemmMicrokernelTester()
         .mr(4)
         .nr(8)
@@ -9756,14 +9756,14 @@
         .m(4)
         .n(8)
         .k(k)
-        .a_stride(7)
-        .Test(xnn_f32_gemm_minmax_ukernel_4x8__neon_lane_ld128, xnn_init_f32_minmax_scalar_params);
+        .a_stride(5)
+        .Test(xnn_f32_gemm_minmax_ukernel_4x8__neon_lane_ld64, xnn_init_f32_minmax_scalar_params);
     }
   }
 
-  TEST(F32_GEMM_MINMAX_4X8__NEON_LANE_LD128, k_lt_4_subtile) {
+  TEST(F32_GEMM_MINMAX_4X8__NEON_LANE_LD64, k_lt_2_subtile) {
     TEST_REQUIRES_ARM_NEON;
-    for (size_t k = 1; k < 4; k++) {
+    for (size_t k = 1; k < 2; k++) {
       for (uint32_t n = 1; n <= 8; n++) {
         for (uint32_t m = 1; m <= 4; m++) {
           GemmMicrokernelTester()
@@ -9775,15 +9775,15 @@
             .n(n)
             .k(k)
             .iterations(1)
-            .Test(xnn_f32_gemm_minmax_ukernel_4x8__neon_lane_ld128, xnn_init_f32_minmax_scalar_params);
+            .Test(xnn_f32_gemm_minmax_ukernel_4x8__neon_lane_ld64, xnn_init_f32_minmax_scalar_params);
         }
       }
     }
   }
 
-  TEST(F32_GEMM_MINMAX_4X8__NEON_LANE_LD128, k_gt_4) {
+  TEST(F32_GEMM_MINMAX_4X8__NEON_LANE_LD64, k_gt_2) {
     TEST_REQUIRES_ARM_NEON;
-    for (size_t k = 5; k < 8; k++) {
+    for (size_t k = 3; k < 4; k++) {
       GemmMicrokernelTester()
         .mr(4)
         .nr(8)
@@ -9792,13 +9792,13 @@
         .m(4)
         .n(8)
         .k(k)
-        .Test(xnn_f32_gemm_minmax_ukernel_4x8__neon_lane_ld128, xnn_init_f32_minmax_scalar_params);
+        .Test(xnn_f32_gemm_minmax_ukernel_4x8__neon_lane_ld64, xnn_init_f32_minmax_scalar_params);
     }
   }
 
-  TEST(F32_GEMM_MINMAX_4X8__NEON_LANE_LD128, k_gt_4_strided_a) {
+  TEST(F32_GEMM_MINMAX_4X8__NEON_LANE_LD64, k_gt_2_strided_a) {
     TEST_REQUIRES_ARM_NEON;
-    for (size_t k = 5; k < 8; k++) {
+    for (size_t k = 3; k < 4; k++) {
       GemmMicrokernelTester()
         .mr(4)
         .nr(8)
@@ -9807,14 +9807,14 @@
         .m(4)
         .n(8)
         .k(k)
-        .a_stride(11)
-        .Test(xnn_f32_gemm_minmax_ukernel_4x8__neon_lane_ld128, xnn_init_f32_minmax_scalar_params);
+        .a_stride(7)
+        .Test(xnn_f32_gemm_minmax_ukernel_4x8__neon_lane_ld64, xnn_init_f32_minmax_scalar_params);
     }
   }
 
-  TEST(F32_GEMM_MINMAX_4X8__NEON_LANE_LD128, k_gt_4_subtile) {
+  TEST(F32_GEMM_MINMAX_4X8__NEON_LANE_LD64, k_gt_2_subtile) {
     TEST_REQUIRES_ARM_NEON;
-    for (size_t k = 5; k < 8; k++) {
+    for (size_t k = 3; k < 4; k++) {
       for (uint32_t n = 1; n <= 8; n++) {
         for (uint32_t m = 1; m <= 4; m++) {
           GemmMicrokernelTester()
@@ -9826,15 +9826,15 @@
             .n(n)
             .k(k)
             .iterations(1)
-            .Test(xnn_f32_gemm_minmax_ukernel_4x8__neon_lane_ld128, xnn_init_f32_minmax_scalar_params);
+            .Test(xnn_f32_gemm_minmax_ukernel_4x8__neon_lane_ld64, xnn_init_f32_minmax_scalar_params);
         }
       }
     }
   }
 
-  TEST(F32_GEMM_MINMAX_4X8__NEON_LANE_LD128, k_div_4) {
+  TEST(F32_GEMM_MINMAX_4X8__NEON_LANE_LD64, k_div_2) {
     TEST_REQUIRES_ARM_NEON;
-    for (size_t k = 8; k <= 40; k += 4) {
+    for (size_t k = 4; k <= 20; k += 2) {
       GemmMicrokernelTester()
         .mr(4)
         .nr(8)
@@ -9843,13 +9843,13 @@
         .m(4)
         .n(8)
         .k(k)
-        .Test(xnn_f32_gemm_minmax_ukernel_4x8__neon_lane_ld128, xnn_init_f32_minmax_scalar_params);
+        .Test(xnn_f32_gemm_minmax_ukernel_4x8__neon_lane_ld64, xnn_init_f32_minmax_scalar_params);
     }
   }
 
-  TEST(F32_GEMM_MINMAX_4X8__NEON_LANE_LD128, k_div_4_strided_a) {
+  TEST(F32_GEMM_MINMAX_4X8__NEON_LANE_LD64, k_div_2_strided_a) {
     TEST_REQUIRES_ARM_NEON;
-    for (size_t k = 8; k <= 40; k += 4) {
+    for (size_t k = 4; k <= 20; k += 2) {
       GemmMicrokernelTester()
         .mr(4)
         .nr(8)
@@ -9858,14 +9858,14 @@
         .m(4)
         .n(8)
         .k(k)
-        .a_stride(43)
-        .Test(xnn_f32_gemm_minmax_ukernel_4x8__neon_lane_ld128, xnn_init_f32_minmax_scalar_params);
+        .a_stride(23)
+        .Test(xnn_f32_gemm_minmax_ukernel_4x8__neon_lane_ld64, xnn_init_f32_minmax_scalar_params);
     }
   }
 
-  TEST(F32_GEMM_MINMAX_4X8__NEON_LANE_LD128, k_div_4_subtile) {
+  TEST(F32_GEMM_MINMAX_4X8__NEON_LANE_LD64, k_div_2_subtile) {
     TEST_REQUIRES_ARM_NEON;
-    for (size_t k = 8; k <= 40; k += 4) {
+    for (size_t k = 4; k <= 20; k += 2) {
       for (uint32_t n = 1; n <= 8; n++) {
         for (uint32_t m = 1; m <= 4; m++) {
           GemmMicrokernelTester()
@@ -9877,16 +9877,16 @@
             .n(n)
             .k(k)
             .iterations(1)
-            .Test(xnn_f32_gemm_minmax_ukernel_4x8__neon_lane_ld128, xnn_init_f32_minmax_scalar_params);
+            .Test(xnn_f32_gemm_minmax_ukernel_4x8__neon_lane_ld64, xnn_init_f32_minmax_scalar_params);
         }
       }
     }
   }
 
-  TEST(F32_GEMM_MINMAX_4X8__NEON_LANE_LD128, n_gt_8) {
+  TEST(F32_GEMM_MINMAX_4X8__NEON_LANE_LD64, n_gt_8) {
     TEST_REQUIRES_ARM_NEON;
     for (uint32_t n = 9; n < 16; n++) {
-      for (size_t k = 1; k <= 20; k += 5) {
+      for (size_t k = 1; k <= 10; k += 3) {
         GemmMicrokernelTester()
           .mr(4)
           .nr(8)
@@ -9895,15 +9895,15 @@
           .m(4)
           .n(n)
           .k(k)
-          .Test(xnn_f32_gemm_minmax_ukernel_4x8__neon_lane_ld128, xnn_init_f32_minmax_scalar_params);
+          .Test(xnn_f32_gemm_minmax_ukernel_4x8__neon_lane_ld64, xnn_init_f32_minmax_scalar_params);
       }
     }
   }
 
-  TEST(F32_GEMM_MINMAX_4X8__NEON_LANE_LD128, n_gt_8_strided_cn) {
+  TEST(F32_GEMM_MINMAX_4X8__NEON_LANE_LD64, n_gt_8_strided_cn) {
     TEST_REQUIRES_ARM_NEON;
     for (uint32_t n = 9; n < 16; n++) {
-      for (size_t k = 1; k <= 20; k += 5) {
+      for (size_t k = 1; k <= 10; k += 3) {
         GemmMicrokernelTester()
           .mr(4)
           .nr(8)
@@ -9913,15 +9913,15 @@
           .n(n)
           .k(k)
           .cn_stride(11)
-          .Test(xnn_f32_gemm_minmax_ukernel_4x8__neon_lane_ld128, xnn_init_f32_minmax_scalar_params);
+          .Test(xnn_f32_gemm_minmax_ukernel_4x8__neon_lane_ld64, xnn_init_f32_minmax_scalar_params);
       }
     }
   }
 
-  TEST(F32_GEMM_MINMAX_4X8__NEON_LANE_LD128, n_gt_8_strided_a) {
+  TEST(F32_GEMM_MINMAX_4X8__NEON_LANE_LD64, n_gt_8_strided_a) {
     TEST_REQUIRES_ARM_NEON;
     for (uint32_t n = 9; n < 16; n++) {
-      for (size_t k = 1; k <= 20; k += 5) {
+      for (size_t k = 1; k <= 10; k += 3) {
         GemmMicrokernelTester()
           .mr(4)
           .nr(8)
@@ -9930,16 +9930,16 @@
           .m(4)
           .n(n)
           .k(k)
-          .a_stride(23)
-          .Test(xnn_f32_gemm_minmax_ukernel_4x8__neon_lane_ld128, xnn_init_f32_minmax_scalar_params);
+          .a_stride(13)
+          .Test(xnn_f32_gemm_minmax_ukernel_4x8__neon_lane_ld64, xnn_init_f32_minmax_scalar_params);
       }
     }
   }
 
-  TEST(F32_GEMM_MINMAX_4X8__NEON_LANE_LD128, n_gt_8_subtile) {
+  TEST(F32_GEMM_MINMAX_4X8__NEON_LANE_LD64, n_gt_8_subtile) {
     TEST_REQUIRES_ARM_NEON;
     for (uint32_t n = 9; n < 16; n++) {
-      for (size_t k = 1; k <= 20; k += 5) {
+      for (size_t k = 1; k <= 10; k += 3) {
         for (uint32_t m = 1; m <= 4; m++) {
           GemmMicrokernelTester()
             .mr(4)
@@ -9950,16 +9950,16 @@
             .n(n)
             .k(k)
             .iterations(1)
-            .Test(xnn_f32_gemm_minmax_ukernel_4x8__neon_lane_ld128, xnn_init_f32_minmax_scalar_params);
+            .Test(xnn_f32_gemm_minmax_ukernel_4x8__neon_lane_ld64, xnn_init_f32_minmax_scalar_params);
         }
       }
     }
   }
 
-  TEST(F32_GEMM_MINMAX_4X8__NEON_LANE_LD128, n_div_8) {
+  TEST(F32_GEMM_MINMAX_4X8__NEON_LANE_LD64, n_div_8) {
     TEST_REQUIRES_ARM_NEON;
     for (uint32_t n = 16; n <= 24; n += 8) {
-      for (size_t k = 1; k <= 20; k += 5) {
+      for (size_t k = 1; k <= 10; k += 3) {
         GemmMicrokernelTester()
           .mr(4)
           .nr(8)
@@ -9968,15 +9968,15 @@
           .m(4)
           .n(n)
           .k(k)
-          .Test(xnn_f32_gemm_minmax_ukernel_4x8__neon_lane_ld128, xnn_init_f32_minmax_scalar_params);
+          .Test(xnn_f32_gemm_minmax_ukernel_4x8__neon_lane_ld64, xnn_init_f32_minmax_scalar_params);
       }
     }
   }
 
-  TEST(F32_GEMM_MINMAX_4X8__NEON_LANE_LD128, n_div_8_strided_cn) {
+  TEST(F32_GEMM_MINMAX_4X8__NEON_LANE_LD64, n_div_8_strided_cn) {
     TEST_REQUIRES_ARM_NEON;
     for (uint32_t n = 16; n <= 24; n += 8) {
-      for (size_t k = 1; k <= 20; k += 5) {
+      for (size_t k = 1; k <= 10; k += 3) {
         GemmMicrokernelTester()
           .mr(4)
           .nr(8)
@@ -9986,15 +9986,15 @@
           .n(n)
           .k(k)
           .cn_stride(11)
-          .Test(xnn_f32_gemm_minmax_ukernel_4x8__neon_lane_ld128, xnn_init_f32_minmax_scalar_params);
+          .Test(xnn_f32_gemm_minmax_ukernel_4x8__neon_lane_ld64, xnn_init_f32_minmax_scalar_params);
       }
     }
   }
 
-  TEST(F32_GEMM_MINMAX_4X8__NEON_LANE_LD128, n_div_8_strided_a) {
+  TEST(F32_GEMM_MINMAX_4X8__NEON_LANE_LD64, n_div_8_strided_a) {
     TEST_REQUIRES_ARM_NEON;
     for (uint32_t n = 16; n <= 24; n += 8) {
-      for (size_t k = 1; k <= 20; k += 5) {
+      for (size_t k = 1; k <= 10; k += 3) {
         GemmMicrokernelTester()
           .mr(4)
           .nr(8)
@@ -10003,16 +10003,16 @@
           .m(4)
           .n(n)
           .k(k)
-          .a_stride(23)
-          .Test(xnn_f32_gemm_minmax_ukernel_4x8__neon_lane_ld128, xnn_init_f32_minmax_scalar_params);
+          .a_stride(13)
+          .Test(xnn_f32_gemm_minmax_ukernel_4x8__neon_lane_ld64, xnn_init_f32_minmax_scalar_params);
       }
     }
   }
 
-  TEST(F32_GEMM_MINMAX_4X8__NEON_LANE_LD128, n_div_8_subtile) {
+  TEST(F32_GEMM_MINMAX_4X8__NEON_LANE_LD64, n_div_8_subtile) {
     TEST_REQUIRES_ARM_NEON;
     for (uint32_t n = 16; n <= 24; n += 8) {
-      for (size_t k = 1; k <= 20; k += 5) {
+      for (size_t k = 1; k <= 10; k += 3) {
         for (uint32_t m = 1; m <= 4; m++) {
           GemmMicrokernelTester()
             .mr(4)
@@ -10023,15 +10023,15 @@
             .n(n)
             .k(k)
             .iterations(1)
-            .Test(xnn_f32_gemm_minmax_ukernel_4x8__neon_lane_ld128, xnn_init_f32_minmax_scalar_params);
+            .Test(xnn_f32_gemm_minmax_ukernel_4x8__neon_lane_ld64, xnn_init_f32_minmax_scalar_params);
         }
       }
     }
   }
 
-  TEST(F32_GEMM_MINMAX_4X8__NEON_LANE_LD128, strided_cm_subtile) {
+  TEST(F32_GEMM_MINMAX_4X8__NEON_LANE_LD64, strided_cm_subtile) {
     TEST_REQUIRES_ARM_NEON;
-    for (size_t k = 1; k <= 20; k += 5) {
+    for (size_t k = 1; k <= 10; k += 3) {
       for (uint32_t n = 1; n <= 8; n++) {
         for (uint32_t m = 1; m <= 4; m++) {
           GemmMicrokernelTester()
@@ -10044,13 +10044,13 @@
             .k(k)
             .cm_stride(11)
             .iterations(1)
-            .Test(xnn_f32_gemm_minmax_ukernel_4x8__neon_lane_ld128, xnn_init_f32_minmax_scalar_params);
+            .Test(xnn_f32_gemm_minmax_ukernel_4x8__neon_lane_ld64, xnn_init_f32_minmax_scalar_params);
         }
       }
     }
   }
 
-  TEST(F32_GEMM_MINMAX_4X8__NEON_LANE_LD128, qmin) {
+  TEST(F32_GEMM_MINMAX_4X8__NEON_LANE_LD64, qmin) {
     TEST_REQUIRES_ARM_NEON;
     GemmMicrokernelTester()
       .mr(4)
@@ -10059,12 +10059,12 @@
       .sr(1)
       .m(4)
       .n(8)
-      .k(4)
+      .k(2)
       .qmin(128)
-      .Test(xnn_f32_gemm_minmax_ukernel_4x8__neon_lane_ld128, xnn_init_f32_minmax_scalar_params);
+      .Test(xnn_f32_gemm_minmax_ukernel_4x8__neon_lane_ld64, xnn_init_f32_minmax_scalar_params);
   }
 
-  TEST(F32_GEMM_MINMAX_4X8__NEON_LANE_LD128, qmax) {
+  TEST(F32_GEMM_MINMAX_4X8__NEON_LANE_LD64, qmax) {
     TEST_REQUIRES_ARM_NEON;
     GemmMicrokernelTester()
       .mr(4)
@@ -10073,12 +10073,12 @@
       .sr(1)
       .m(4)
       .n(8)
-      .k(4)
+      .k(2)
       .qmax(128)
-      .Test(xnn_f32_gemm_minmax_ukernel_4x8__neon_lane_ld128, xnn_init_f32_minmax_scalar_params);
+      .Test(xnn_f32_gemm_minmax_ukernel_4x8__neon_lane_ld64, xnn_init_f32_minmax_scalar_params);
   }
 
-  TEST(F32_GEMM_MINMAX_4X8__NEON_LANE_LD128, strided_cm) {
+  TEST(F32_GEMM_MINMAX_4X8__NEON_LANE_LD64, strided_cm) {
     TEST_REQUIRES_ARM_NEON;
     GemmMicrokernelTester()
       .mr(4)
@@ -10087,16 +10087,16 @@
       .sr(1)
       .m(4)
       .n(8)
-      .k(4)
+      .k(2)
       .cm_stride(11)
-      .Test(xnn_f32_gemm_minmax_ukernel_4x8__neon_lane_ld128, xnn_init_f32_minmax_scalar_params);
+      .Test(xnn_f32_gemm_minmax_ukernel_4x8__neon_lane_ld64, xnn_init_f32_minmax_scalar_params);
   }
 #endif  // XNN_ARCH_ARM || XNN_ARCH_ARM64
 
 
 #if XNN_ARCH_ARM || XNN_ARCH_ARM64
-  TEST(F32_GEMM_MINMAX_4X8__NEONFMA_DUP_LD64, k_eq_2) {
-    TEST_REQUIRES_ARM_NEON_FMA;
+  TEST(F32_GEMM_MINMAX_4X8__NEON_LANE_LD128, k_eq_4) {
+    TEST_REQUIRES_ARM_NEON;
     GemmMicrokernelTester()
       .mr(4)
       .nr(8)
@@ -10104,12 +10104,12 @@
       .sr(1)
       .m(4)
       .n(8)
-      .k(2)
-      .Test(xnn_f32_gemm_minmax_ukernel_4x8__neonfma_dup_ld64, xnn_init_f32_minmax_scalar_params);
+      .k(4)
+      .Test(xnn_f32_gemm_minmax_ukernel_4x8__neon_lane_ld128, xnn_init_f32_minmax_scalar_params);
   }
 
-  TEST(F32_GEMM_MINMAX_4X8__NEONFMA_DUP_LD64, strided_cn) {
-    TEST_REQUIRES_ARM_NEON_FMA;
+  TEST(F32_GEMM_MINMAX_4X8__NEON_LANE_LD128, strided_cn) {
+    TEST_REQUIRES_ARM_NEON;
     GemmMicrokernelTester()
       .mr(4)
       .nr(8)
@@ -10117,13 +10117,13 @@
       .sr(1)
       .m(4)
       .n(8)
-      .k(2)
+      .k(4)
       .cn_stride(11)
-      .Test(xnn_f32_gemm_minmax_ukernel_4x8__neonfma_dup_ld64, xnn_init_f32_minmax_scalar_params);
+      .Test(xnn_f32_gemm_minmax_ukernel_4x8__neon_lane_ld128, xnn_init_f32_minmax_scalar_params);
   }
 
-  TEST(F32_GEMM_MINMAX_4X8__NEONFMA_DUP_LD64, k_eq_2_strided_a) {
-    TEST_REQUIRES_ARM_NEON_FMA;
+  TEST(F32_GEMM_MINMAX_4X8__NEON_LANE_LD128, k_eq_4_strided_a) {
+    TEST_REQUIRES_ARM_NEON;
     GemmMicrokernelTester()
       .mr(4)
       .nr(8)
@@ -10131,13 +10131,13 @@
       .sr(1)
       .m(4)
       .n(8)
-      .k(2)
-      .a_stride(5)
-      .Test(xnn_f32_gemm_minmax_ukernel_4x8__neonfma_dup_ld64, xnn_init_f32_minmax_scalar_params);
+      .k(4)
+      .a_stride(7)
+      .Test(xnn_f32_gemm_minmax_ukernel_4x8__neon_lane_ld128, xnn_init_f32_minmax_scalar_params);
   }
 
-  TEST(F32_GEMM_MINMAX_4X8__NEONFMA_DUP_LD64, k_eq_2_subtile) {
-    TEST_REQUIRES_ARM_NEON_FMA;
+  TEST(F32_GEMM_MINMAX_4X8__NEON_LANE_LD128, k_eq_4_subtile) {
+    TEST_REQUIRES_ARM_NEON;
     for (uint32_t n = 1; n <= 8; n++) {
       for (uint32_t m = 1; m <= 4; m++) {
         GemmMicrokernelTester()
@@ -10147,15 +10147,15 @@
           .sr(1)
           .m(m)
           .n(n)
-          .k(2)
+          .k(4)
           .iterations(1)
-          .Test(xnn_f32_gemm_minmax_ukernel_4x8__neonfma_dup_ld64, xnn_init_f32_minmax_scalar_params);
+          .Test(xnn_f32_gemm_minmax_ukernel_4x8__neon_lane_ld128, xnn_init_f32_minmax_scalar_params);
       }
     }
   }
 
-  TEST(F32_GEMM_MINMAX_4X8__NEONFMA_DUP_LD64, k_eq_2_subtile_m) {
-    TEST_REQUIRES_ARM_NEON_FMA;
+  TEST(F32_GEMM_MINMAX_4X8__NEON_LANE_LD128, k_eq_4_subtile_m) {
+    TEST_REQUIRES_ARM_NEON;
     for (uint32_t m = 1; m <= 4; m++) {
       GemmMicrokernelTester()
         .mr(4)
@@ -10164,14 +10164,14 @@
         .sr(1)
         .m(m)
         .n(8)
-        .k(2)
+        .k(4)
         .iterations(1)
-        .Test(xnn_f32_gemm_minmax_ukernel_4x8__neonfma_dup_ld64, xnn_init_f32_minmax_scalar_params);
+        .Test(xnn_f32_gemm_minmax_ukernel_4x8__neon_lane_ld128, xnn_init_f32_minmax_scalar_params);
     }
   }
 
-  TEST(F32_GEMM_MINMAX_4X8__NEONFMA_DUP_LD64, k_eq_2_subtile_n) {
-    TEST_REQUIRES_ARM_NEON_FMA;
+  TEST(F32_GEMM_MINMAX_4X8__NEON_LANE_LD128, k_eq_4_subtile_n) {
+    TEST_REQUIRES_ARM_NEON;
     for (uint32_t n = 1; n <= 8; n++) {
       GemmMicrokernelTester()
         .mr(4)
@@ -10180,15 +10180,15 @@
         .sr(1)
         .m(4)
         .n(n)
-        .k(2)
+        .k(4)
         .iterations(1)
-        .Test(xnn_f32_gemm_minmax_ukernel_4x8__neonfma_dup_ld64, xnn_init_f32_minmax_scalar_params);
+        .Test(xnn_f32_gemm_minmax_ukernel_4x8__neon_lane_ld128, xnn_init_f32_minmax_scalar_params);
     }
   }
 
-  TEST(F32_GEMM_MINMAX_4X8__NEONFMA_DUP_LD64, k_lt_2) {
-    TEST_REQUIRES_ARM_NEON_FMA;
-    for (size_t k = 1; k < 2; k++) {
+  TEST(F32_GEMM_MINMAX_4X8__NEON_LANE_LD128, k_lt_4) {
+    TEST_REQUIRES_ARM_NEON;
+    for (size_t k = 1; k < 4; k++) {
       GemmMicrokernelTester()
         .mr(4)
         .nr(8)
@@ -10197,13 +10197,13 @@
         .m(4)
         .n(8)
         .k(k)
-        .Test(xnn_f32_gemm_minmax_ukernel_4x8__neonfma_dup_ld64, xnn_init_f32_minmax_scalar_params);
+        .Test(xnn_f32_gemm_minmax_ukernel_4x8__neon_lane_ld128, xnn_init_f32_minmax_scalar_params);
     }
   }
 
-  TEST(F32_GEMM_MINMAX_4X8__NEONFMA_DUP_LD64, k_lt_2_strided_a) {
-    TEST_REQUIRES_ARM_NEON_FMA;
-    for (size_t k = 1; k < 2; k++) {
+  TEST(F32_GEMM_MINMAX_4X8__NEON_LANE_LD128, k_lt_4_strided_a) {
+    TEST_REQUIRES_ARM_NEON;
+    for (size_t k = 1; k < 4; k++) {
       GemmMicrokernelTester()
         .mr(4)
         .nr(8)
@@ -10212,14 +10212,14 @@
         .m(4)
         .n(8)
         .k(k)
-        .a_stride(5)
-        .Test(xnn_f32_gemm_minmax_ukernel_4x8__neonfma_dup_ld64, xnn_init_f32_minmax_scalar_params);
+        .a_stride(7)
+        .Test(xnn_f32_gemm_minmax_ukernel_4x8__neon_lane_ld128, xnn_init_f32_minmax_scalar_params);
     }
   }
 
-  TEST(F32_GEMM_MINMAX_4X8__NEONFMA_DUP_LD64, k_lt_2_subtile) {
-    TEST_REQUIRES_ARM_NEON_FMA;
-    for (size_t k = 1; k < 2; k++) {
+  TEST(F32_GEMM_MINMAX_4X8__NEON_LANE_LD128, k_lt_4_subtile) {
+    TEST_REQUIRES_ARM_NEON;
+    for (size_t k = 1; k < 4; k++) {
       for (uint32_t n = 1; n <= 8; n++) {
         for (uint32_t m = 1; m <= 4; m++) {
           GemmMicrokernelTester()
@@ -10231,15 +10231,15 @@
             .n(n)
             .k(k)
             .iterations(1)
-            .Test(xnn_f32_gemm_minmax_ukernel_4x8__neonfma_dup_ld64, xnn_init_f32_minmax_scalar_params);
+            .Test(xnn_f32_gemm_minmax_ukernel_4x8__neon_lane_ld128, xnn_init_f32_minmax_scalar_params);
         }
       }
     }
   }
 
-  TEST(F32_GEMM_MINMAX_4X8__NEONFMA_DUP_LD64, k_gt_2) {
-    TEST_REQUIRES_ARM_NEON_FMA;
-    for (size_t k = 3; k < 4; k++) {
+  TEST(F32_GEMM_MINMAX_4X8__NEON_LANE_LD128, k_gt_4) {
+    TEST_REQUIRES_ARM_NEON;
+    for (size_t k = 5; k < 8; k++) {
       GemmMicrokernelTester()
         .mr(4)
         .nr(8)
@@ -10248,13 +10248,13 @@
         .m(4)
         .n(8)
         .k(k)
-        .Test(xnn_f32_gemm_minmax_ukernel_4x8__neonfma_dup_ld64, xnn_init_f32_minmax_scalar_params);
+        .Test(xnn_f32_gemm_minmax_ukernel_4x8__neon_lane_ld128, xnn_init_f32_minmax_scalar_params);
     }
   }
 
-  TEST(F32_GEMM_MINMAX_4X8__NEONFMA_DUP_LD64, k_gt_2_strided_a) {
-    TEST_REQUIRES_ARM_NEON_FMA;
-    for (size_t k = 3; k < 4; k++) {
+  TEST(F32_GEMM_MINMAX_4X8__NEON_LANE_LD128, k_gt_4_strided_a) {
+    TEST_REQUIRES_ARM_NEON;
+    for (size_t k = 5; k < 8; k++) {
       GemmMicrokernelTester()
         .mr(4)
         .nr(8)
@@ -10263,14 +10263,14 @@
         .m(4)
         .n(8)
         .k(k)
-        .a_stride(7)
-        .Test(xnn_f32_gemm_minmax_ukernel_4x8__neonfma_dup_ld64, xnn_init_f32_minmax_scalar_params);
+        .a_stride(11)
+        .Test(xnn_f32_gemm_minmax_ukernel_4x8__neon_lane_ld128, xnn_init_f32_minmax_scalar_params);
     }
   }
 
-  TEST(F32_GEMM_MINMAX_4X8__NEONFMA_DUP_LD64, k_gt_2_subtile) {
-    TEST_REQUIRES_ARM_NEON_FMA;
-    for (size_t k = 3; k < 4; k++) {
+  TEST(F32_GEMM_MINMAX_4X8__NEON_LANE_LD128, k_gt_4_subtile) {
+    TEST_REQUIRES_ARM_NEON;
+    for (size_t k = 5; k < 8; k++) {
       for (uint32_t n = 1; n <= 8; n++) {
         for (uint32_t m = 1; m <= 4; m++) {
           GemmMicrokernelTester()
@@ -10282,15 +10282,15 @@
             .n(n)
             .k(k)
             .iterations(1)
-            .Test(xnn_f32_gemm_minmax_ukernel_4x8__neonfma_dup_ld64, xnn_init_f32_minmax_scalar_params);
+            .Test(xnn_f32_gemm_minmax_ukernel_4x8__neon_lane_ld128, xnn_init_f32_minmax_scalar_params);
         }
       }
     }
   }
 
-  TEST(F32_GEMM_MINMAX_4X8__NEONFMA_DUP_LD64, k_div_2) {
-    TEST_REQUIRES_ARM_NEON_FMA;
-    for (size_t k = 4; k <= 20; k += 2) {
+  TEST(F32_GEMM_MINMAX_4X8__NEON_LANE_LD128, k_div_4) {
+    TEST_REQUIRES_ARM_NEON;
+    for (size_t k = 8; k <= 40; k += 4) {
       GemmMicrokernelTester()
         .mr(4)
         .nr(8)
@@ -10299,13 +10299,13 @@
         .m(4)
         .n(8)
         .k(k)
-        .Test(xnn_f32_gemm_minmax_ukernel_4x8__neonfma_dup_ld64, xnn_init_f32_minmax_scalar_params);
+        .Test(xnn_f32_gemm_minmax_ukernel_4x8__neon_lane_ld128, xnn_init_f32_minmax_scalar_params);
     }
   }
 
-  TEST(F32_GEMM_MINMAX_4X8__NEONFMA_DUP_LD64, k_div_2_strided_a) {
-    TEST_REQUIRES_ARM_NEON_FMA;
-    for (size_t k = 4; k <= 20; k += 2) {
+  TEST(F32_GEMM_MINMAX_4X8__NEON_LANE_LD128, k_div_4_strided_a) {
+    TEST_REQUIRES_ARM_NEON;
+    for (size_t k = 8; k <= 40; k += 4) {
       GemmMicrokernelTester()
         .mr(4)
         .nr(8)
@@ -10314,14 +10314,14 @@
         .m(4)
         .n(8)
         .k(k)
-        .a_stride(23)
-        .Test(xnn_f32_gemm_minmax_ukernel_4x8__neonfma_dup_ld64, xnn_init_f32_minmax_scalar_params);
+        .a_stride(43)
+        .Test(xnn_f32_gemm_minmax_ukernel_4x8__neon_lane_ld128, xnn_init_f32_minmax_scalar_params);
     }
   }
 
-  TEST(F32_GEMM_MINMAX_4X8__NEONFMA_DUP_LD64, k_div_2_subtile) {
-    TEST_REQUIRES_ARM_NEON_FMA;
-    for (size_t k = 4; k <= 20; k += 2) {
+  TEST(F32_GEMM_MINMAX_4X8__NEON_LANE_LD128, k_div_4_subtile) {
+    TEST_REQUIRES_ARM_NEON;
+    for (size_t k = 8; k <= 40; k += 4) {
       for (uint32_t n = 1; n <= 8; n++) {
         for (uint32_t m = 1; m <= 4; m++) {
           GemmMicrokernelTester()
@@ -10333,16 +10333,16 @@
             .n(n)
             .k(k)
             .iterations(1)
-            .Test(xnn_f32_gemm_minmax_ukernel_4x8__neonfma_dup_ld64, xnn_init_f32_minmax_scalar_params);
+            .Test(xnn_f32_gemm_minmax_ukernel_4x8__neon_lane_ld128, xnn_init_f32_minmax_scalar_params);
         }
       }
     }
   }
 
-  TEST(F32_GEMM_MINMAX_4X8__NEONFMA_DUP_LD64, n_gt_8) {
-    TEST_REQUIRES_ARM_NEON_FMA;
+  TEST(F32_GEMM_MINMAX_4X8__NEON_LANE_LD128, n_gt_8) {
+    TEST_REQUIRES_ARM_NEON;
     for (uint32_t n = 9; n < 16; n++) {
-      for (size_t k = 1; k <= 10; k += 3) {
+      for (size_t k = 1; k <= 20; k += 5) {
         GemmMicrokernelTester()
           .mr(4)
           .nr(8)
@@ -10351,15 +10351,15 @@
           .m(4)
           .n(n)
           .k(k)
-          .Test(xnn_f32_gemm_minmax_ukernel_4x8__neonfma_dup_ld64, xnn_init_f32_minmax_scalar_params);
+          .Test(xnn_f32_gemm_minmax_ukernel_4x8__neon_lane_ld128, xnn_init_f32_minmax_scalar_params);
       }
     }
   }
 
-  TEST(F32_GEMM_MINMAX_4X8__NEONFMA_DUP_LD64, n_gt_8_strided_cn) {
-    TEST_REQUIRES_ARM_NEON_FMA;
+  TEST(F32_GEMM_MINMAX_4X8__NEON_LANE_LD128, n_gt_8_strided_cn) {
+    TEST_REQUIRES_ARM_NEON;
     for (uint32_t n = 9; n < 16; n++) {
-      for (size_t k = 1; k <= 10; k += 3) {
+      for (size_t k = 1; k <= 20; k += 5) {
         GemmMicrokernelTester()
           .mr(4)
           .nr(8)
@@ -10369,15 +10369,15 @@
           .n(n)
           .k(k)
           .cn_stride(11)
-          .Test(xnn_f32_gemm_minmax_ukernel_4x8__neonfma_dup_ld64, xnn_init_f32_minmax_scalar_params);
+          .Test(xnn_f32_gemm_minmax_ukernel_4x8__neon_lane_ld128, xnn_init_f32_minmax_scalar_params);
       }
     }
   }
 
-  TEST(F32_GEMM_MINMAX_4X8__NEONFMA_DUP_LD64, n_gt_8_strided_a) {
-    TEST_REQUIRES_ARM_NEON_FMA;
+  TEST(F32_GEMM_MINMAX_4X8__NEON_LANE_LD128, n_gt_8_strided_a) {
+    TEST_REQUIRES_ARM_NEON;
     for (uint32_t n = 9; n < 16; n++) {
-      for (size_t k = 1; k <= 10; k += 3) {
+      for (size_t k = 1; k <= 20; k += 5) {
         GemmMicrokernelTester()
           .mr(4)
           .nr(8)
@@ -10386,16 +10386,16 @@
           .m(4)
           .n(n)
           .k(k)
-          .a_stride(13)
-          .Test(xnn_f32_gemm_minmax_ukernel_4x8__neonfma_dup_ld64, xnn_init_f32_minmax_scalar_params);
+          .a_stride(23)
+          .Test(xnn_f32_gemm_minmax_ukernel_4x8__neon_lane_ld128, xnn_init_f32_minmax_scalar_params);
       }
     }
   }
 
-  TEST(F32_GEMM_MINMAX_4X8__NEONFMA_DUP_LD64, n_gt_8_subtile) {
-    TEST_REQUIRES_ARM_NEON_FMA;
+  TEST(F32_GEMM_MINMAX_4X8__NEON_LANE_LD128, n_gt_8_subtile) {
+    TEST_REQUIRES_ARM_NEON;
     for (uint32_t n = 9; n < 16; n++) {
-      for (size_t k = 1; k <= 10; k += 3) {
+      for (size_t k = 1; k <= 20; k += 5) {
         for (uint32_t m = 1; m <= 4; m++) {
           GemmMicrokernelTester()
             .mr(4)
@@ -10406,16 +10406,16 @@
             .n(n)
             .k(k)
             .iterations(1)
-            .Test(xnn_f32_gemm_minmax_ukernel_4x8__neonfma_dup_ld64, xnn_init_f32_minmax_scalar_params);
+            .Test(xnn_f32_gemm_minmax_ukernel_4x8__neon_lane_ld128, xnn_init_f32_minmax_scalar_params);
         }
       }
     }
   }
 
-  TEST(F32_GEMM_MINMAX_4X8__NEONFMA_DUP_LD64, n_div_8) {
-    TEST_REQUIRES_ARM_NEON_FMA;
+  TEST(F32_GEMM_MINMAX_4X8__NEON_LANE_LD128, n_div_8) {
+    TEST_REQUIRES_ARM_NEON;
     for (uint32_t n = 16; n <= 24; n += 8) {
-      for (size_t k = 1; k <= 10; k += 3) {
+      for (size_t k = 1; k <= 20; k += 5) {
         GemmMicrokernelTester()
           .mr(4)
           .nr(8)
@@ -10424,15 +10424,15 @@
           .m(4)
           .n(n)
           .k(k)
-          .Test(xnn_f32_gemm_minmax_ukernel_4x8__neonfma_dup_ld64, xnn_init_f32_minmax_scalar_params);
+          .Test(xnn_f32_gemm_minmax_ukernel_4x8__neon_lane_ld128, xnn_init_f32_minmax_scalar_params);
       }
     }
   }
 
-  TEST(F32_GEMM_MINMAX_4X8__NEONFMA_DUP_LD64, n_div_8_strided_cn) {
-    TEST_REQUIRES_ARM_NEON_FMA;
+  TEST(F32_GEMM_MINMAX_4X8__NEON_LANE_LD128, n_div_8_strided_cn) {
+    TEST_REQUIRES_ARM_NEON;
     for (uint32_t n = 16; n <= 24; n += 8) {
-      for (size_t k = 1; k <= 10; k += 3) {
+      for (size_t k = 1; k <= 20; k += 5) {
         GemmMicrokernelTester()
           .mr(4)
           .nr(8)
@@ -10442,15 +10442,15 @@
           .n(n)
           .k(k)
           .cn_stride(11)
-          .Test(xnn_f32_gemm_minmax_ukernel_4x8__neonfma_dup_ld64, xnn_init_f32_minmax_scalar_params);
+          .Test(xnn_f32_gemm_minmax_ukernel_4x8__neon_lane_ld128, xnn_init_f32_minmax_scalar_params);
       }
     }
   }
 
-  TEST(F32_GEMM_MINMAX_4X8__NEONFMA_DUP_LD64, n_div_8_strided_a) {
-    TEST_REQUIRES_ARM_NEON_FMA;
+  TEST(F32_GEMM_MINMAX_4X8__NEON_LANE_LD128, n_div_8_strided_a) {
+    TEST_REQUIRES_ARM_NEON;
     for (uint32_t n = 16; n <= 24; n += 8) {
-      for (size_t k = 1; k <= 10; k += 3) {
+      for (size_t k = 1; k <= 20; k += 5) {
         GemmMicrokernelTester()
           .mr(4)
           .nr(8)
@@ -10459,16 +10459,16 @@
           .m(4)
           .n(n)
           .k(k)
-          .a_stride(13)
-          .Test(xnn_f32_gemm_minmax_ukernel_4x8__neonfma_dup_ld64, xnn_init_f32_minmax_scalar_params);
+          .a_stride(23)
+          .Test(xnn_f32_gemm_minmax_ukernel_4x8__neon_lane_ld128, xnn_init_f32_minmax_scalar_params);
       }
     }
   }
 
-  TEST(F32_GEMM_MINMAX_4X8__NEONFMA_DUP_LD64, n_div_8_subtile) {
-    TEST_REQUIRES_ARM_NEON_FMA;
+  TEST(F32_GEMM_MINMAX_4X8__NEON_LANE_LD128, n_div_8_subtile) {
+    TEST_REQUIRES_ARM_NEON;
     for (uint32_t n = 16; n <= 24; n += 8) {
-      for (size_t k = 1; k <= 10; k += 3) {
+      for (size_t k = 1; k <= 20; k += 5) {
         for (uint32_t m = 1; m <= 4; m++) {
           GemmMicrokernelTester()
             .mr(4)
@@ -10479,15 +10479,15 @@
             .n(n)
             .k(k)
             .iterations(1)
-            .Test(xnn_f32_gemm_minmax_ukernel_4x8__neonfma_dup_ld64, xnn_init_f32_minmax_scalar_params);
+            .Test(xnn_f32_gemm_minmax_ukernel_4x8__neon_lane_ld128, xnn_init_f32_minmax_scalar_params);
         }
       }
     }
   }
 
-  TEST(F32_GEMM_MINMAX_4X8__NEONFMA_DUP_LD64, strided_cm_subtile) {
-    TEST_REQUIRES_ARM_NEON_FMA;
-    for (size_t k = 1; k <= 10; k += 3) {
+  TEST(F32_GEMM_MINMAX_4X8__NEON_LANE_LD128, strided_cm_subtile) {
+    TEST_REQUIRES_ARM_NEON;
+    for (size_t k = 1; k <= 20; k += 5) {
       for (uint32_t n = 1; n <= 8; n++) {
         for (uint32_t m = 1; m <= 4; m++) {
           GemmMicrokernelTester()
@@ -10500,14 +10500,14 @@
             .k(k)
             .cm_stride(11)
             .iterations(1)
-            .Test(xnn_f32_gemm_minmax_ukernel_4x8__neonfma_dup_ld64, xnn_init_f32_minmax_scalar_params);
+            .Test(xnn_f32_gemm_minmax_ukernel_4x8__neon_lane_ld128, xnn_init_f32_minmax_scalar_params);
         }
       }
     }
   }
 
-  TEST(F32_GEMM_MINMAX_4X8__NEONFMA_DUP_LD64, qmin) {
-    TEST_REQUIRES_ARM_NEON_FMA;
+  TEST(F32_GEMM_MINMAX_4X8__NEON_LANE_LD128, qmin) {
+    TEST_REQUIRES_ARM_NEON;
     GemmMicrokernelTester()
       .mr(4)
       .nr(8)
@@ -10515,13 +10515,13 @@
       .sr(1)
       .m(4)
       .n(8)
-      .k(2)
+      .k(4)
       .qmin(128)
-      .Test(xnn_f32_gemm_minmax_ukernel_4x8__neonfma_dup_ld64, xnn_init_f32_minmax_scalar_params);
+      .Test(xnn_f32_gemm_minmax_ukernel_4x8__neon_lane_ld128, xnn_init_f32_minmax_scalar_params);
   }
 
-  TEST(F32_GEMM_MINMAX_4X8__NEONFMA_DUP_LD64, qmax) {
-    TEST_REQUIRES_ARM_NEON_FMA;
+  TEST(F32_GEMM_MINMAX_4X8__NEON_LANE_LD128, qmax) {
+    TEST_REQUIRES_ARM_NEON;
     GemmMicrokernelTester()
       .mr(4)
       .nr(8)
@@ -10529,13 +10529,13 @@
       .sr(1)
       .m(4)
       .n(8)
-      .k(2)
+      .k(4)
       .qmax(128)
-      .Test(xnn_f32_gemm_minmax_ukernel_4x8__neonfma_dup_ld64, xnn_init_f32_minmax_scalar_params);
+      .Test(xnn_f32_gemm_minmax_ukernel_4x8__neon_lane_ld128, xnn_init_f32_minmax_scalar_params);
   }
 
-  TEST(F32_GEMM_MINMAX_4X8__NEONFMA_DUP_LD64, strided_cm) {
-    TEST_REQUIRES_ARM_NEON_FMA;
+  TEST(F32_GEMM_MINMAX_4X8__NEON_LANE_LD128, strided_cm) {
+    TEST_REQUIRES_ARM_NEON;
     GemmMicrokernelTester()
       .mr(4)
       .nr(8)
@@ -10543,15 +10543,15 @@
       .sr(1)
       .m(4)
       .n(8)
-      .k(2)
+      .k(4)
       .cm_stride(11)
-      .Test(xnn_f32_gemm_minmax_ukernel_4x8__neonfma_dup_ld64, xnn_init_f32_minmax_scalar_params);
+      .Test(xnn_f32_gemm_minmax_ukernel_4x8__neon_lane_ld128, xnn_init_f32_minmax_scalar_params);
   }
 #endif  // XNN_ARCH_ARM || XNN_ARCH_ARM64
 
 
-#if XNN_ARCH_ARM64
-  TEST(F32_GEMM_MINMAX_4X8__NEONFMA_LANE_LD128, k_eq_4) {
+#if XNN_ARCH_ARM || XNN_ARCH_ARM64
+  TEST(F32_GEMM_MINMAX_4X8__NEONFMA_DUP_LD64, k_eq_2) {
     TEST_REQUIRES_ARM_NEON_FMA;
     GemmMicrokernelTester()
       .mr(4)
@@ -10560,11 +10560,11 @@
       .sr(1)
       .m(4)
       .n(8)
-      .k(4)
-      .Test(xnn_f32_gemm_minmax_ukernel_4x8__neonfma_lane_ld128, xnn_init_f32_minmax_scalar_params);
+      .k(2)
+      .Test(xnn_f32_gemm_minmax_ukernel_4x8__neonfma_dup_ld64, xnn_init_f32_minmax_scalar_params);
   }
 
-  TEST(F32_GEMM_MINMAX_4X8__NEONFMA_LANE_LD128, strided_cn) {
+  TEST(F32_GEMM_MINMAX_4X8__NEONFMA_DUP_LD64, strided_cn) {
     TEST_REQUIRES_ARM_NEON_FMA;
     GemmMicrokernelTester()
       .mr(4)
@@ -10573,12 +10573,12 @@
       .sr(1)
       .m(4)
       .n(8)
-      .k(4)
+      .k(2)
       .cn_stride(11)
-      .Test(xnn_f32_gemm_minmax_ukernel_4x8__neonfma_lane_ld128, xnn_init_f32_minmax_scalar_params);
+      .Test(xnn_f32_gemm_minmax_ukernel_4x8__neonfma_dup_ld64, xnn_init_f32_minmax_scalar_params);
   }
 
-  TEST(F32_GEMM_MINMAX_4X8__NEONFMA_LANE_LD128, k_eq_4_strided_a) {
+  TEST(F32_GEMM_MINMAX_4X8__NEONFMA_DUP_LD64, k_eq_2_strided_a) {
     TEST_REQUIRES_ARM_NEON_FMA;
     GemmMicrokernelTester()
       .mr(4)
@@ -10587,12 +10587,12 @@
       .sr(1)
       .m(4)
       .n(8)
-      .k(4)
-      .a_stride(7)
-      .Test(xnn_f32_gemm_minmax_ukernel_4x8__neonfma_lane_ld128, xnn_init_f32_minmax_scalar_params);
+      .k(2)
+      .a_stride(5)
+      .Test(xnn_f32_gemm_minmax_ukernel_4x8__neonfma_dup_ld64, xnn_init_f32_minmax_scalar_params);
   }
 
-  TEST(F32_GEMM_MINMAX_4X8__NEONFMA_LANE_LD128, k_eq_4_subtile) {
+  TEST(F32_GEMM_MINMAX_4X8__NEONFMA_DUP_LD64, k_eq_2_subtile) {
     TEST_REQUIRES_ARM_NEON_FMA;
     for (uint32_t n = 1; n <= 8; n++) {
       for (uint32_t m = 1; m <= 4; m++) {
@@ -10603,14 +10603,14 @@
           .sr(1)
           .m(m)
           .n(n)
-          .k(4)
+          .k(2)
           .iterations(1)
-          .Test(xnn_f32_gemm_minmax_ukernel_4x8__neonfma_lane_ld128, xnn_init_f32_minmax_scalar_params);
+          .Test(xnn_f32_gemm_minmax_ukernel_4x8__neonfma_dup_ld64, xnn_init_f32_minmax_scalar_params);
       }
     }
   }
 
-  TEST(F32_GEMM_MINMAX_4X8__NEONFMA_LANE_LD128, k_eq_4_subtile_m) {
+  TEST(F32_GEMM_MINMAX_4X8__NEONFMA_DUP_LD64, k_eq_2_subtile_m) {
     TEST_REQUIRES_ARM_NEON_FMA;
     for (uint32_t m = 1; m <= 4; m++) {
       GemmMicrokernelTester()
@@ -10620,13 +10620,13 @@
         .sr(1)
         .m(m)
         .n(8)
-        .k(4)
+        .k(2)
         .iterations(1)
-        .Test(xnn_f32_gemm_minmax_ukernel_4x8__neonfma_lane_ld128, xnn_init_f32_minmax_scalar_params);
+        .Test(xnn_f32_gemm_minmax_ukernel_4x8__neonfma_dup_ld64, xnn_init_f32_minmax_scalar_params);
     }
   }
 
-  TEST(F32_GEMM_MINMAX_4X8__NEONFMA_LANE_LD128, k_eq_4_subtile_n) {
+  TEST(F32_GEMM_MINMAX_4X8__NEONFMA_DUP_LD64, k_eq_2_subtile_n) {
     TEST_REQUIRES_ARM_NEON_FMA;
     for (uint32_t n = 1; n <= 8; n++) {
       GemmMicrokernelTester()
@@ -10636,15 +10636,15 @@
         .sr(1)
         .m(4)
         .n(n)
-        .k(4)
+        .k(2)
         .iterations(1)
-        .Test(xnn_f32_gemm_minmax_ukernel_4x8__neonfma_lane_ld128, xnn_init_f32_minmax_scalar_params);
+        .Test(xnn_f32_gemm_minmax_ukernel_4x8__neonfma_dup_ld64, xnn_init_f32_minmax_scalar_params);
     }
   }
 
-  TEST(F32_GEMM_MINMAX_4X8__NEONFMA_LANE_LD128, k_lt_4) {
+  TEST(F32_GEMM_MINMAX_4X8__NEONFMA_DUP_LD64, k_lt_2) {
     TEST_REQUIRES_ARM_NEON_FMA;
-    for (size_t k = 1; k < 4; k++) {
+    for (size_t k = 1; k < 2; k++) {
       GemmMicrokernelTester()
         .mr(4)
         .nr(8)
@@ -10653,13 +10653,13 @@
         .m(4)
         .n(8)
         .k(k)
-        .Test(xnn_f32_gemm_minmax_ukernel_4x8__neonfma_lane_ld128, xnn_init_f32_minmax_scalar_params);
+        .Test(xnn_f32_gemm_minmax_ukernel_4x8__neonfma_dup_ld64, xnn_init_f32_minmax_scalar_params);
     }
   }
 
-  TEST(F32_GEMM_MINMAX_4X8__NEONFMA_LANE_LD128, k_lt_4_strided_a) {
+  TEST(F32_GEMM_MINMAX_4X8__NEONFMA_DUP_LD64, k_lt_2_strided_a) {
     TEST_REQUIRES_ARM_NEON_FMA;
-    for (size_t k = 1; k < 4; k++) {
+    for (size_t k = 1; k < 2; k++) {
       GemmMicrokernelTester()
         .mr(4)
         .nr(8)
@@ -10668,14 +10668,14 @@
         .m(4)
         .n(8)
         .k(k)
-        .a_stride(7)
-        .Test(xnn_f32_gemm_minmax_ukernel_4x8__neonfma_lane_ld128, xnn_init_f32_minmax_scalar_params);
+        .a_stride(5)
+        .Test(xnn_f32_gemm_minmax_ukernel_4x8__neonfma_dup_ld64, xnn_init_f32_minmax_scalar_params);
     }
   }
 
-  TEST(F32_GEMM_MINMAX_4X8__NEONFMA_LANE_LD128, k_lt_4_subtile) {
+  TEST(F32_GEMM_MINMAX_4X8__NEONFMA_DUP_LD64, k_lt_2_subtile) {
     TEST_REQUIRES_ARM_NEON_FMA;
-    for (size_t k = 1; k < 4; k++) {
+    for (size_t k = 1; k < 2; k++) {
       for (uint32_t n = 1; n <= 8; n++) {
         for (uint32_t m = 1; m <= 4; m++) {
           GemmMicrokernelTester()
@@ -10687,15 +10687,15 @@
             .n(n)
             .k(k)
             .iterations(1)
-            .Test(xnn_f32_gemm_minmax_ukernel_4x8__neonfma_lane_ld128, xnn_init_f32_minmax_scalar_params);
+            .Test(xnn_f32_gemm_minmax_ukernel_4x8__neonfma_dup_ld64, xnn_init_f32_minmax_scalar_params);
         }
       }
     }
   }
 
-  TEST(F32_GEMM_MINMAX_4X8__NEONFMA_LANE_LD128, k_gt_4) {
+  TEST(F32_GEMM_MINMAX_4X8__NEONFMA_DUP_LD64, k_gt_2) {
     TEST_REQUIRES_ARM_NEON_FMA;
-    for (size_t k = 5; k < 8; k++) {
+    for (size_t k = 3; k < 4; k++) {
       GemmMicrokernelTester()
         .mr(4)
         .nr(8)
@@ -10704,13 +10704,13 @@
         .m(4)
         .n(8)
         .k(k)
-        .Test(xnn_f32_gemm_minmax_ukernel_4x8__neonfma_lane_ld128, xnn_init_f32_minmax_scalar_params);
+        .Test(xnn_f32_gemm_minmax_ukernel_4x8__neonfma_dup_ld64, xnn_init_f32_minmax_scalar_params);
     }
   }
 
-  TEST(F32_GEMM_MINMAX_4X8__NEONFMA_LANE_LD128, k_gt_4_strided_a) {
+  TEST(F32_GEMM_MINMAX_4X8__NEONFMA_DUP_LD64, k_gt_2_strided_a) {
     TEST_REQUIRES_ARM_NEON_FMA;
-    for (size_t k = 5; k < 8; k++) {
+    for (size_t k = 3; k < 4; k++) {
       GemmMicrokernelTester()
         .mr(4)
         .nr(8)
@@ -10719,14 +10719,14 @@
         .m(4)
         .n(8)
         .k(k)
-        .a_stride(11)
-        .Test(xnn_f32_gemm_minmax_ukernel_4x8__neonfma_lane_ld128, xnn_init_f32_minmax_scalar_params);
+        .a_stride(7)
+        .Test(xnn_f32_gemm_minmax_ukernel_4x8__neonfma_dup_ld64, xnn_init_f32_minmax_scalar_params);
     }
   }
 
-  TEST(F32_GEMM_MINMAX_4X8__NEONFMA_LANE_LD128, k_gt_4_subtile) {
+  TEST(F32_GEMM_MINMAX_4X8__NEONFMA_DUP_LD64, k_gt_2_subtile) {
     TEST_REQUIRES_ARM_NEON_FMA;
-    for (size_t k = 5; k < 8; k++) {
+    for (size_t k = 3; k < 4; k++) {
       for (uint32_t n = 1; n <= 8; n++) {
         for (uint32_t m = 1; m <= 4; m++) {
           GemmMicrokernelTester()
@@ -10738,15 +10738,15 @@
             .n(n)
             .k(k)
             .iterations(1)
-            .Test(xnn_f32_gemm_minmax_ukernel_4x8__neonfma_lane_ld128, xnn_init_f32_minmax_scalar_params);
+            .Test(xnn_f32_gemm_minmax_ukernel_4x8__neonfma_dup_ld64, xnn_init_f32_minmax_scalar_params);
         }
       }
     }
   }
 
-  TEST(F32_GEMM_MINMAX_4X8__NEONFMA_LANE_LD128, k_div_4) {
+  TEST(F32_GEMM_MINMAX_4X8__NEONFMA_DUP_LD64, k_div_2) {
     TEST_REQUIRES_ARM_NEON_FMA;
-    for (size_t k = 8; k <= 40; k += 4) {
+    for (size_t k = 4; k <= 20; k += 2) {
       GemmMicrokernelTester()
         .mr(4)
         .nr(8)
@@ -10755,13 +10755,13 @@
         .m(4)
         .n(8)
         .k(k)
-        .Test(xnn_f32_gemm_minmax_ukernel_4x8__neonfma_lane_ld128, xnn_init_f32_minmax_scalar_params);
+        .Test(xnn_f32_gemm_minmax_ukernel_4x8__neonfma_dup_ld64, xnn_init_f32_minmax_scalar_params);
     }
   }
 
-  TEST(F32_GEMM_MINMAX_4X8__NEONFMA_LANE_LD128, k_div_4_strided_a) {
+  TEST(F32_GEMM_MINMAX_4X8__NEONFMA_DUP_LD64, k_div_2_strided_a) {
     TEST_REQUIRES_ARM_NEON_FMA;
-    for (size_t k = 8; k <= 40; k += 4) {
+    for (size_t k = 4; k <= 20; k += 2) {
       GemmMicrokernelTester()
         .mr(4)
         .nr(8)
@@ -10770,14 +10770,14 @@
         .m(4)
         .n(8)
         .k(k)
-        .a_stride(43)
-        .Test(xnn_f32_gemm_minmax_ukernel_4x8__neonfma_lane_ld128, xnn_init_f32_minmax_scalar_params);
+        .a_stride(23)
+        .Test(xnn_f32_gemm_minmax_ukernel_4x8__neonfma_dup_ld64, xnn_init_f32_minmax_scalar_params);
     }
   }
 
-  TEST(F32_GEMM_MINMAX_4X8__NEONFMA_LANE_LD128, k_div_4_subtile) {
+  TEST(F32_GEMM_MINMAX_4X8__NEONFMA_DUP_LD64, k_div_2_subtile) {
     TEST_REQUIRES_ARM_NEON_FMA;
-    for (size_t k = 8; k <= 40; k += 4) {
+    for (size_t k = 4; k <= 20; k += 2) {
       for (uint32_t n = 1; n <= 8; n++) {
         for (uint32_t m = 1; m <= 4; m++) {
           GemmMicrokernelTester()
@@ -10789,16 +10789,16 @@
             .n(n)
             .k(k)
             .iterations(1)
-            .Test(xnn_f32_gemm_minmax_ukernel_4x8__neonfma_lane_ld128, xnn_init_f32_minmax_scalar_params);
+            .Test(xnn_f32_gemm_minmax_ukernel_4x8__neonfma_dup_ld64, xnn_init_f32_minmax_scalar_params);
         }
       }
     }
   }
 
-  TEST(F32_GEMM_MINMAX_4X8__NEONFMA_LANE_LD128, n_gt_8) {
+  TEST(F32_GEMM_MINMAX_4X8__NEONFMA_DUP_LD64, n_gt_8) {
     TEST_REQUIRES_ARM_NEON_FMA;
     for (uint32_t n = 9; n < 16; n++) {
-      for (size_t k = 1; k <= 20; k += 5) {
+      for (size_t k = 1; k <= 10; k += 3) {
         GemmMicrokernelTester()
           .mr(4)
           .nr(8)
@@ -10807,15 +10807,15 @@
           .m(4)
           .n(n)
           .k(k)
-          .Test(xnn_f32_gemm_minmax_ukernel_4x8__neonfma_lane_ld128, xnn_init_f32_minmax_scalar_params);
+          .Test(xnn_f32_gemm_minmax_ukernel_4x8__neonfma_dup_ld64, xnn_init_f32_minmax_scalar_params);
       }
     }
   }
 
-  TEST(F32_GEMM_MINMAX_4X8__NEONFMA_LANE_LD128, n_gt_8_strided_cn) {
+  TEST(F32_GEMM_MINMAX_4X8__NEONFMA_DUP_LD64, n_gt_8_strided_cn) {
     TEST_REQUIRES_ARM_NEON_FMA;
     for (uint32_t n = 9; n < 16; n++) {
-      for (size_t k = 1; k <= 20; k += 5) {
+      for (size_t k = 1; k <= 10; k += 3) {
         GemmMicrokernelTester()
           .mr(4)
           .nr(8)
@@ -10825,15 +10825,15 @@
           .n(n)
           .k(k)
           .cn_stride(11)
-          .Test(xnn_f32_gemm_minmax_ukernel_4x8__neonfma_lane_ld128, xnn_init_f32_minmax_scalar_params);
+          .Test(xnn_f32_gemm_minmax_ukernel_4x8__neonfma_dup_ld64, xnn_init_f32_minmax_scalar_params);
       }
     }
   }
 
-  TEST(F32_GEMM_MINMAX_4X8__NEONFMA_LANE_LD128, n_gt_8_strided_a) {
+  TEST(F32_GEMM_MINMAX_4X8__NEONFMA_DUP_LD64, n_gt_8_strided_a) {
     TEST_REQUIRES_ARM_NEON_FMA;
     for (uint32_t n = 9; n < 16; n++) {
-      for (size_t k = 1; k <= 20; k += 5) {
+      for (size_t k = 1; k <= 10; k += 3) {
         GemmMicrokernelTester()
           .mr(4)
           .nr(8)
@@ -10842,16 +10842,16 @@
           .m(4)
           .n(n)
           .k(k)
-          .a_stride(23)
-          .Test(xnn_f32_gemm_minmax_ukernel_4x8__neonfma_lane_ld128, xnn_init_f32_minmax_scalar_params);
+          .a_stride(13)
+          .Test(xnn_f32_gemm_minmax_ukernel_4x8__neonfma_dup_ld64, xnn_init_f32_minmax_scalar_params);
       }
     }
   }
 
-  TEST(F32_GEMM_MINMAX_4X8__NEONFMA_LANE_LD128, n_gt_8_subtile) {
+  TEST(F32_GEMM_MINMAX_4X8__NEONFMA_DUP_LD64, n_gt_8_subtile) {
     TEST_REQUIRES_ARM_NEON_FMA;
     for (uint32_t n = 9; n < 16; n++) {
-      for (size_t k = 1; k <= 20; k += 5) {
+      for (size_t k = 1; k <= 10; k += 3) {
         for (uint32_t m = 1; m <= 4; m++) {
           GemmMicrokernelTester()
             .mr(4)
@@ -10862,16 +10862,16 @@
             .n(n)
             .k(k)
             .iterations(1)
-            .Test(xnn_f32_gemm_minmax_ukernel_4x8__neonfma_lane_ld128, xnn_init_f32_minmax_scalar_params);
+            .Test(xnn_f32_gemm_minmax_ukernel_4x8__neonfma_dup_ld64, xnn_init_f32_minmax_scalar_params);
         }
       }
     }
   }
 
-  TEST(F32_GEMM_MINMAX_4X8__NEONFMA_LANE_LD128, n_div_8) {
+  TEST(F32_GEMM_MINMAX_4X8__NEONFMA_DUP_LD64, n_div_8) {
     TEST_REQUIRES_ARM_NEON_FMA;
     for (uint32_t n = 16; n <= 24; n += 8) {
-      for (size_t k = 1; k <= 20; k += 5) {
+      for (size_t k = 1; k <= 10; k += 3) {
         GemmMicrokernelTester()
           .mr(4)
           .nr(8)
@@ -10880,15 +10880,15 @@
           .m(4)
           .n(n)
           .k(k)
-          .Test(xnn_f32_gemm_minmax_ukernel_4x8__neonfma_lane_ld128, xnn_init_f32_minmax_scalar_params);
+          .Test(xnn_f32_gemm_minmax_ukernel_4x8__neonfma_dup_ld64, xnn_init_f32_minmax_scalar_params);
       }
     }
   }
 
-  TEST(F32_GEMM_MINMAX_4X8__NEONFMA_LANE_LD128, n_div_8_strided_cn) {
+  TEST(F32_GEMM_MINMAX_4X8__NEONFMA_DUP_LD64, n_div_8_strided_cn) {
     TEST_REQUIRES_ARM_NEON_FMA;
     for (uint32_t n = 16; n <= 24; n += 8) {
-      for (size_t k = 1; k <= 20; k += 5) {
+      for (size_t k = 1; k <= 10; k += 3) {
         GemmMicrokernelTester()
           .mr(4)
           .nr(8)
@@ -10898,15 +10898,15 @@
           .n(n)
           .k(k)
           .cn_stride(11)
-          .Test(xnn_f32_gemm_minmax_ukernel_4x8__neonfma_lane_ld128, xnn_init_f32_minmax_scalar_params);
+          .Test(xnn_f32_gemm_minmax_ukernel_4x8__neonfma_dup_ld64, xnn_init_f32_minmax_scalar_params);
       }
     }
   }
 
-  TEST(F32_GEMM_MINMAX_4X8__NEONFMA_LANE_LD128, n_div_8_strided_a) {
+  TEST(F32_GEMM_MINMAX_4X8__NEONFMA_DUP_LD64, n_div_8_strided_a) {
     TEST_REQUIRES_ARM_NEON_FMA;
     for (uint32_t n = 16; n <= 24; n += 8) {
-      for (size_t k = 1; k <= 20; k += 5) {
+      for (size_t k = 1; k <= 10; k += 3) {
         GemmMicrokernelTester()
           .mr(4)
           .nr(8)
@@ -10915,16 +10915,16 @@
           .m(4)
           .n(n)
           .k(k)
-          .a_stride(23)
-          .Test(xnn_f32_gemm_minmax_ukernel_4x8__neonfma_lane_ld128, xnn_init_f32_minmax_scalar_params);
+          .a_stride(13)
+          .Test(xnn_f32_gemm_minmax_ukernel_4x8__neonfma_dup_ld64, xnn_init_f32_minmax_scalar_params);
       }
     }
   }
 
-  TEST(F32_GEMM_MINMAX_4X8__NEONFMA_LANE_LD128, n_div_8_subtile) {
+  TEST(F32_GEMM_MINMAX_4X8__NEONFMA_DUP_LD64, n_div_8_subtile) {
     TEST_REQUIRES_ARM_NEON_FMA;
     for (uint32_t n = 16; n <= 24; n += 8) {
-      for (size_t k = 1; k <= 20; k += 5) {
+      for (size_t k = 1; k <= 10; k += 3) {
         for (uint32_t m = 1; m <= 4; m++) {
           GemmMicrokernelTester()
             .mr(4)
@@ -10935,15 +10935,15 @@
             .n(n)
             .k(k)
             .iterations(1)
-            .Test(xnn_f32_gemm_minmax_ukernel_4x8__neonfma_lane_ld128, xnn_init_f32_minmax_scalar_params);
+            .Test(xnn_f32_gemm_minmax_ukernel_4x8__neonfma_dup_ld64, xnn_init_f32_minmax_scalar_params);
         }
       }
     }
   }
 
-  TEST(F32_GEMM_MINMAX_4X8__NEONFMA_LANE_LD128, strided_cm_subtile) {
+  TEST(F32_GEMM_MINMAX_4X8__NEONFMA_DUP_LD64, strided_cm_subtile) {
     TEST_REQUIRES_ARM_NEON_FMA;
-    for (size_t k = 1; k <= 20; k += 5) {
+    for (size_t k = 1; k <= 10; k += 3) {
       for (uint32_t n = 1; n <= 8; n++) {
         for (uint32_t m = 1; m <= 4; m++) {
           GemmMicrokernelTester()
@@ -10956,13 +10956,13 @@
             .k(k)
             .cm_stride(11)
             .iterations(1)
-            .Test(xnn_f32_gemm_minmax_ukernel_4x8__neonfma_lane_ld128, xnn_init_f32_minmax_scalar_params);
+            .Test(xnn_f32_gemm_minmax_ukernel_4x8__neonfma_dup_ld64, xnn_init_f32_minmax_scalar_params);
         }
       }
     }
   }
 
-  TEST(F32_GEMM_MINMAX_4X8__NEONFMA_LANE_LD128, qmin) {
+  TEST(F32_GEMM_MINMAX_4X8__NEONFMA_DUP_LD64, qmin) {
     TEST_REQUIRES_ARM_NEON_FMA;
     GemmMicrokernelTester()
       .mr(4)
@@ -10971,12 +10971,12 @@
       .sr(1)
       .m(4)
       .n(8)
-      .k(4)
+      .k(2)
       .qmin(128)
-      .Test(xnn_f32_gemm_minmax_ukernel_4x8__neonfma_lane_ld128, xnn_init_f32_minmax_scalar_params);
+      .Test(xnn_f32_gemm_minmax_ukernel_4x8__neonfma_dup_ld64, xnn_init_f32_minmax_scalar_params);
   }
 
-  TEST(F32_GEMM_MINMAX_4X8__NEONFMA_LANE_LD128, qmax) {
+  TEST(F32_GEMM_MINMAX_4X8__NEONFMA_DUP_LD64, qmax) {
     TEST_REQUIRES_ARM_NEON_FMA;
     GemmMicrokernelTester()
       .mr(4)
@@ -10985,12 +10985,12 @@
       .sr(1)
       .m(4)
       .n(8)
-      .k(4)
+      .k(2)
       .qmax(128)
-      .Test(xnn_f32_gemm_minmax_ukernel_4x8__neonfma_lane_ld128, xnn_init_f32_minmax_scalar_params);
+      .Test(xnn_f32_gemm_minmax_ukernel_4x8__neonfma_dup_ld64, xnn_init_f32_minmax_scalar_params);
   }
 
-  TEST(F32_GEMM_MINMAX_4X8__NEONFMA_LANE_LD128, strided_cm) {
+  TEST(F32_GEMM_MINMAX_4X8__NEONFMA_DUP_LD64, strided_cm) {
     TEST_REQUIRES_ARM_NEON_FMA;
     GemmMicrokernelTester()
       .mr(4)
@@ -10999,138 +10999,138 @@
       .sr(1)
       .m(4)
       .n(8)
-      .k(4)
+      .k(2)
       .cm_stride(11)
-      .Test(xnn_f32_gemm_minmax_ukernel_4x8__neonfma_lane_ld128, xnn_init_f32_minmax_scalar_params);
+      .Test(xnn_f32_gemm_minmax_ukernel_4x8__neonfma_dup_ld64, xnn_init_f32_minmax_scalar_params);
   }
-#endif  // XNN_ARCH_ARM64
+#endif  // XNN_ARCH_ARM || XNN_ARCH_ARM64
 
 
-#if XNN_ARCH_ARM || XNN_ARCH_ARM64
-  TEST(F32_GEMM_MINMAX_4X8S4__NEON, k_eq_4) {
-    TEST_REQUIRES_ARM_NEON;
+#if XNN_ARCH_ARM64
+  TEST(F32_GEMM_MINMAX_4X8__NEONFMA_LANE_LD128, k_eq_4) {
+    TEST_REQUIRES_ARM_NEON_FMA;
     GemmMicrokernelTester()
       .mr(4)
       .nr(8)
       .kr(1)
-      .sr(4)
+      .sr(1)
       .m(4)
       .n(8)
       .k(4)
-      .Test(xnn_f32_gemm_minmax_ukernel_4x8s4__neon, xnn_init_f32_minmax_scalar_params);
+      .Test(xnn_f32_gemm_minmax_ukernel_4x8__neonfma_lane_ld128, xnn_init_f32_minmax_scalar_params);
   }
 
-  TEST(F32_GEMM_MINMAX_4X8S4__NEON, strided_cn) {
-    TEST_REQUIRES_ARM_NEON;
+  TEST(F32_GEMM_MINMAX_4X8__NEONFMA_LANE_LD128, strided_cn) {
+    TEST_REQUIRES_ARM_NEON_FMA;
     GemmMicrokernelTester()
       .mr(4)
       .nr(8)
       .kr(1)
-      .sr(4)
+      .sr(1)
       .m(4)
       .n(8)
       .k(4)
       .cn_stride(11)
-      .Test(xnn_f32_gemm_minmax_ukernel_4x8s4__neon, xnn_init_f32_minmax_scalar_params);
+      .Test(xnn_f32_gemm_minmax_ukernel_4x8__neonfma_lane_ld128, xnn_init_f32_minmax_scalar_params);
   }
 
-  TEST(F32_GEMM_MINMAX_4X8S4__NEON, k_eq_4_strided_a) {
-    TEST_REQUIRES_ARM_NEON;
+  TEST(F32_GEMM_MINMAX_4X8__NEONFMA_LANE_LD128, k_eq_4_strided_a) {
+    TEST_REQUIRES_ARM_NEON_FMA;
     GemmMicrokernelTester()
       .mr(4)
       .nr(8)
       .kr(1)
-      .sr(4)
+      .sr(1)
       .m(4)
       .n(8)
       .k(4)
       .a_stride(7)
-      .Test(xnn_f32_gemm_minmax_ukernel_4x8s4__neon, xnn_init_f32_minmax_scalar_params);
+      .Test(xnn_f32_gemm_minmax_ukernel_4x8__neonfma_lane_ld128, xnn_init_f32_minmax_scalar_params);
   }
 
-  TEST(F32_GEMM_MINMAX_4X8S4__NEON, k_eq_4_subtile) {
-    TEST_REQUIRES_ARM_NEON;
+  TEST(F32_GEMM_MINMAX_4X8__NEONFMA_LANE_LD128, k_eq_4_subtile) {
+    TEST_REQUIRES_ARM_NEON_FMA;
     for (uint32_t n = 1; n <= 8; n++) {
       for (uint32_t m = 1; m <= 4; m++) {
         GemmMicrokernelTester()
           .mr(4)
           .nr(8)
           .kr(1)
-          .sr(4)
+          .sr(1)
           .m(m)
           .n(n)
           .k(4)
           .iterations(1)
-          .Test(xnn_f32_gemm_minmax_ukernel_4x8s4__neon, xnn_init_f32_minmax_scalar_params);
+          .Test(xnn_f32_gemm_minmax_ukernel_4x8__neonfma_lane_ld128, xnn_init_f32_minmax_scalar_params);
       }
     }
   }
 
-  TEST(F32_GEMM_MINMAX_4X8S4__NEON, k_eq_4_subtile_m) {
-    TEST_REQUIRES_ARM_NEON;
+  TEST(F32_GEMM_MINMAX_4X8__NEONFMA_LANE_LD128, k_eq_4_subtile_m) {
+    TEST_REQUIRES_ARM_NEON_FMA;
     for (uint32_t m = 1; m <= 4; m++) {
       GemmMicrokernelTester()
         .mr(4)
         .nr(8)
         .kr(1)
-        .sr(4)
+        .sr(1)
         .m(m)
         .n(8)
         .k(4)
         .iterations(1)
-        .Test(xnn_f32_gemm_minmax_ukernel_4x8s4__neon, xnn_init_f32_minmax_scalar_params);
+        .Test(xnn_f32_gemm_minmax_ukernel_4x8__neonfma_lane_ld128, xnn_init_f32_minmax_scalar_params);
     }
   }
 
-  TEST(F32_GEMM_MINMAX_4X8S4__NEON, k_eq_4_subtile_n) {
-    TEST_REQUIRES_ARM_NEON;
+  TEST(F32_GEMM_MINMAX_4X8__NEONFMA_LANE_LD128, k_eq_4_subtile_n) {
+    TEST_REQUIRES_ARM_NEON_FMA;
     for (uint32_t n = 1; n <= 8; n++) {
       GemmMicrokernelTester()
         .mr(4)
         .nr(8)
         .kr(1)
-        .sr(4)
+        .sr(1)
         .m(4)
         .n(n)
         .k(4)
         .iterations(1)
-        .Test(xnn_f32_gemm_minmax_ukernel_4x8s4__neon, xnn_init_f32_minmax_scalar_params);
+        .Test(xnn_f32_gemm_minmax_ukernel_4x8__neonfma_lane_ld128, xnn_init_f32_minmax_scalar_params);
     }
   }
 
-  TEST(F32_GEMM_MINMAX_4X8S4__NEON, k_lt_4) {
-    TEST_REQUIRES_ARM_NEON;
+  TEST(F32_GEMM_MINMAX_4X8__NEONFMA_LANE_LD128, k_lt_4) {
+    TEST_REQUIRES_ARM_NEON_FMA;
     for (size_t k = 1; k < 4; k++) {
       GemmMicrokernelTester()
         .mr(4)
         .nr(8)
         .kr(1)
-        .sr(4)
+        .sr(1)
         .m(4)
         .n(8)
         .k(k)
-        .Test(xnn_f32_gemm_minmax_ukernel_4x8s4__neon, xnn_init_f32_minmax_scalar_params);
+        .Test(xnn_f32_gemm_minmax_ukernel_4x8__neonfma_lane_ld128, xnn_init_f32_minmax_scalar_params);
     }
   }
 
-  TEST(F32_GEMM_MINMAX_4X8S4__NEON, k_lt_4_strided_a) {
-    TEST_REQUIRES_ARM_NEON;
+  TEST(F32_GEMM_MINMAX_4X8__NEONFMA_LANE_LD128, k_lt_4_strided_a) {
+    TEST_REQUIRES_ARM_NEON_FMA;
     for (size_t k = 1; k < 4; k++) {
       GemmMicrokernelTester()
         .mr(4)
         .nr(8)
         .kr(1)
-        .sr(4)
+        .sr(1)
         .m(4)
         .n(8)
         .k(k)
         .a_stride(7)
-        .Test(xnn_f32_gemm_minmax_ukernel_4x8s4__neon, xnn_init_f32_minmax_scalar_params);
+        .Test(xnn_f32_gemm_minmax_ukernel_4x8__neonfma_lane_ld128, xnn_init_f32_minmax_scalar_params);
     }
   }
 
-  TEST(F32_GEMM_MINMAX_4X8S4__NEON, k_lt_4_subtile) {
-    TEST_REQUIRES_ARM_NEON;
+  TEST(F32_GEMM_MINMAX_4X8__NEONFMA_LANE_LD128, k_lt_4_subtile) {
+    TEST_REQUIRES_ARM_NEON_FMA;
     for (size_t k = 1; k < 4; k++) {
       for (uint32_t n = 1; n <= 8; n++) {
         for (uint32_t m = 1; m <= 4; m++) {
@@ -11138,50 +11138,50 @@
             .mr(4)
             .nr(8)
             .kr(1)
-            .sr(4)
+            .sr(1)
             .m(m)
             .n(n)
             .k(k)
             .iterations(1)
-            .Test(xnn_f32_gemm_minmax_ukernel_4x8s4__neon, xnn_init_f32_minmax_scalar_params);
+            .Test(xnn_f32_gemm_minmax_ukernel_4x8__neonfma_lane_ld128, xnn_init_f32_minmax_scalar_params);
         }
       }
     }
   }
 
-  TEST(F32_GEMM_MINMAX_4X8S4__NEON, k_gt_4) {
-    TEST_REQUIRES_ARM_NEON;
+  TEST(F32_GEMM_MINMAX_4X8__NEONFMA_LANE_LD128, k_gt_4) {
+    TEST_REQUIRES_ARM_NEON_FMA;
     for (size_t k = 5; k < 8; k++) {
       GemmMicrokernelTester()
         .mr(4)
         .nr(8)
         .kr(1)
-        .sr(4)
+        .sr(1)
         .m(4)
         .n(8)
         .k(k)
-        .Test(xnn_f32_gemm_minmax_ukernel_4x8s4__neon, xnn_init_f32_minmax_scalar_params);
+        .Test(xnn_f32_gemm_minmax_ukernel_4x8__neonfma_lane_ld128, xnn_init_f32_minmax_scalar_params);
     }
   }
 
-  TEST(F32_GEMM_MINMAX_4X8S4__NEON, k_gt_4_strided_a) {
-    TEST_REQUIRES_ARM_NEON;
+  TEST(F32_GEMM_MINMAX_4X8__NEONFMA_LANE_LD128, k_gt_4_strided_a) {
+    TEST_REQUIRES_ARM_NEON_FMA;
     for (size_t k = 5; k < 8; k++) {
       GemmMicrokernelTester()
         .mr(4)
         .nr(8)
         .kr(1)
-        .sr(4)
+        .sr(1)
         .m(4)
         .n(8)
         .k(k)
         .a_stride(11)
-        .Test(xnn_f32_gemm_minmax_ukernel_4x8s4__neon, xnn_init_f32_minmax_scalar_params);
+        .Test(xnn_f32_gemm_minmax_ukernel_4x8__neonfma_lane_ld128, xnn_init_f32_minmax_scalar_params);
     }
   }
 
-  TEST(F32_GEMM_MINMAX_4X8S4__NEON, k_gt_4_subtile) {
-    TEST_REQUIRES_ARM_NEON;
+  TEST(F32_GEMM_MINMAX_4X8__NEONFMA_LANE_LD128, k_gt_4_subtile) {
+    TEST_REQUIRES_ARM_NEON_FMA;
     for (size_t k = 5; k < 8; k++) {
       for (uint32_t n = 1; n <= 8; n++) {
         for (uint32_t m = 1; m <= 4; m++) {
@@ -11189,50 +11189,50 @@
             .mr(4)
             .nr(8)
             .kr(1)
-            .sr(4)
+            .sr(1)
             .m(m)
             .n(n)
             .k(k)
             .iterations(1)
-            .Test(xnn_f32_gemm_minmax_ukernel_4x8s4__neon, xnn_init_f32_minmax_scalar_params);
+            .Test(xnn_f32_gemm_minmax_ukernel_4x8__neonfma_lane_ld128, xnn_init_f32_minmax_scalar_params);
         }
       }
     }
   }
 
-  TEST(F32_GEMM_MINMAX_4X8S4__NEON, k_div_4) {
-    TEST_REQUIRES_ARM_NEON;
+  TEST(F32_GEMM_MINMAX_4X8__NEONFMA_LANE_LD128, k_div_4) {
+    TEST_REQUIRES_ARM_NEON_FMA;
     for (size_t k = 8; k <= 40; k += 4) {
       GemmMicrokernelTester()
         .mr(4)
         .nr(8)
         .kr(1)
-        .sr(4)
+        .sr(1)
         .m(4)
         .n(8)
         .k(k)
-        .Test(xnn_f32_gemm_minmax_ukernel_4x8s4__neon, xnn_init_f32_minmax_scalar_params);
+        .Test(xnn_f32_gemm_minmax_ukernel_4x8__neonfma_lane_ld128, xnn_init_f32_minmax_scalar_params);
     }
   }
 
-  TEST(F32_GEMM_MINMAX_4X8S4__NEON, k_div_4_strided_a) {
-    TEST_REQUIRES_ARM_NEON;
+  TEST(F32_GEMM_MINMAX_4X8__NEONFMA_LANE_LD128, k_div_4_strided_a) {
+    TEST_REQUIRES_ARM_NEON_FMA;
     for (size_t k = 8; k <= 40; k += 4) {
       GemmMicrokernelTester()
         .mr(4)
         .nr(8)
         .kr(1)
-        .sr(4)
+        .sr(1)
         .m(4)
         .n(8)
         .k(k)
         .a_stride(43)
-        .Test(xnn_f32_gemm_minmax_ukernel_4x8s4__neon, xnn_init_f32_minmax_scalar_params);
+        .Test(xnn_f32_gemm_minmax_ukernel_4x8__neonfma_lane_ld128, xnn_init_f32_minmax_scalar_params);
     }
   }
 
-  TEST(F32_GEMM_MINMAX_4X8S4__NEON, k_div_4_subtile) {
-    TEST_REQUIRES_ARM_NEON;
+  TEST(F32_GEMM_MINMAX_4X8__NEONFMA_LANE_LD128, k_div_4_subtile) {
+    TEST_REQUIRES_ARM_NEON_FMA;
     for (size_t k = 8; k <= 40; k += 4) {
       for (uint32_t n = 1; n <= 8; n++) {
         for (uint32_t m = 1; m <= 4; m++) {
@@ -11240,72 +11240,72 @@
             .mr(4)
             .nr(8)
             .kr(1)
-            .sr(4)
+            .sr(1)
             .m(m)
             .n(n)
             .k(k)
             .iterations(1)
-            .Test(xnn_f32_gemm_minmax_ukernel_4x8s4__neon, xnn_init_f32_minmax_scalar_params);
+            .Test(xnn_f32_gemm_minmax_ukernel_4x8__neonfma_lane_ld128, xnn_init_f32_minmax_scalar_params);
         }
       }
     }
   }
 
-  TEST(F32_GEMM_MINMAX_4X8S4__NEON, n_gt_8) {
-    TEST_REQUIRES_ARM_NEON;
+  TEST(F32_GEMM_MINMAX_4X8__NEONFMA_LANE_LD128, n_gt_8) {
+    TEST_REQUIRES_ARM_NEON_FMA;
     for (uint32_t n = 9; n < 16; n++) {
       for (size_t k = 1; k <= 20; k += 5) {
         GemmMicrokernelTester()
           .mr(4)
           .nr(8)
           .kr(1)
-          .sr(4)
+          .sr(1)
           .m(4)
           .n(n)
           .k(k)
-          .Test(xnn_f32_gemm_minmax_ukernel_4x8s4__neon, xnn_init_f32_minmax_scalar_params);
+          .Test(xnn_f32_gemm_minmax_ukernel_4x8__neonfma_lane_ld128, xnn_init_f32_minmax_scalar_params);
       }
     }
   }
 
-  TEST(F32_GEMM_MINMAX_4X8S4__NEON, n_gt_8_strided_cn) {
-    TEST_REQUIRES_ARM_NEON;
+  TEST(F32_GEMM_MINMAX_4X8__NEONFMA_LANE_LD128, n_gt_8_strided_cn) {
+    TEST_REQUIRES_ARM_NEON_FMA;
     for (uint32_t n = 9; n < 16; n++) {
       for (size_t k = 1; k <= 20; k += 5) {
         GemmMicrokernelTester()
           .mr(4)
           .nr(8)
           .kr(1)
-          .sr(4)
+          .sr(1)
           .m(4)
           .n(n)
           .k(k)
           .cn_stride(11)
-          .Test(xnn_f32_gemm_minmax_ukernel_4x8s4__neon, xnn_init_f32_minmax_scalar_params);
+          .Test(xnn_f32_gemm_minmax_ukernel_4x8__neonfma_lane_ld128, xnn_init_f32_minmax_scalar_params);
       }
     }
   }
 
-  TEST(F32_GEMM_MINMAX_4X8S4__NEON, n_gt_8_strided_a) {
-    TEST_REQUIRES_ARM_NEON;
+  TEST(F32_GEMM_MINMAX_4X8__NEONFMA_LANE_LD128, n_gt_8_strided_a) {
+    TEST_REQUIRES_ARM_NEON_FMA;
     for (uint32_t n = 9; n < 16; n++) {
       for (size_t k = 1; k <= 20; k += 5) {
         GemmMicrokernelTester()
           .mr(4)
           .nr(8)
           .kr(1)
-          .sr(4)
+          .sr(1)
           .m(4)
           .n(n)
           .k(k)
           .a_stride(23)
-          .Test(xnn_f32_gemm_minmax_ukernel_4x8s4__neon, xnn_init_f32_minmax_scalar_params);
+          .Test(xnn_f32_gemm_minmax_ukernel_4x8__neonfma_lane_ld128, xnn_init_f32_minmax_scalar_params);
       }
     }
   }
 
-  TEST(F32_GEMM_MINMAX_4X8S4__NEON, n_gt_8_subtile) {
-    TEST_REQUIRES_ARM_NEON;
+  TEST(F32_GEMM_MINMAX_4X8__NEONFMA_LANE_LD128, n_gt_8_subtile) {
+    TEST_REQUIRES_ARM_NEON_FMA;
     for (uint32_t n = 9; n < 16; n++) {
       for (size_t k = 1; k <= 20; k += 5) {
         for (uint32_t m = 1; m <= 4; m++) {
@@ -11313,72 +11313,72 @@
             .mr(4)
             .nr(8)
             .kr(1)
-            .sr(4)
+            .sr(1)
             .m(m)
             .n(n)
             .k(k)
             .iterations(1)
-            .Test(xnn_f32_gemm_minmax_ukernel_4x8s4__neon, xnn_init_f32_minmax_scalar_params);
+            .Test(xnn_f32_gemm_minmax_ukernel_4x8__neonfma_lane_ld128, xnn_init_f32_minmax_scalar_params);
         }
       }
     }
   }
 
-  TEST(F32_GEMM_MINMAX_4X8S4__NEON, n_div_8) {
-    TEST_REQUIRES_ARM_NEON;
+  TEST(F32_GEMM_MINMAX_4X8__NEONFMA_LANE_LD128, n_div_8) {
+    TEST_REQUIRES_ARM_NEON_FMA;
     for (uint32_t n = 16; n <= 24; n += 8) {
       for (size_t k = 1; k <= 20; k += 5) {
         GemmMicrokernelTester()
           .mr(4)
           .nr(8)
           .kr(1)
-          .sr(4)
+          .sr(1)
           .m(4)
           .n(n)
           .k(k)
-          .Test(xnn_f32_gemm_minmax_ukernel_4x8s4__neon, xnn_init_f32_minmax_scalar_params);
+          .Test(xnn_f32_gemm_minmax_ukernel_4x8__neonfma_lane_ld128, xnn_init_f32_minmax_scalar_params);
       }
     }
   }
 
-  TEST(F32_GEMM_MINMAX_4X8S4__NEON, n_div_8_strided_cn) {
-    TEST_REQUIRES_ARM_NEON;
+  TEST(F32_GEMM_MINMAX_4X8__NEONFMA_LANE_LD128, n_div_8_strided_cn) {
+    TEST_REQUIRES_ARM_NEON_FMA;
     for (uint32_t n = 16; n <= 24; n += 8) {
       for (size_t k = 1; k <= 20; k += 5) {
         GemmMicrokernelTester()
           .mr(4)
           .nr(8)
           .kr(1)
-          .sr(4)
+          .sr(1)
           .m(4)
           .n(n)
           .k(k)
           .cn_stride(11)
-          .Test(xnn_f32_gemm_minmax_ukernel_4x8s4__neon, xnn_init_f32_minmax_scalar_params);
+          .Test(xnn_f32_gemm_minmax_ukernel_4x8__neonfma_lane_ld128, xnn_init_f32_minmax_scalar_params);
       }
     }
   }
 
-  TEST(F32_GEMM_MINMAX_4X8S4__NEON, n_div_8_strided_a) {
-    TEST_REQUIRES_ARM_NEON;
+  TEST(F32_GEMM_MINMAX_4X8__NEONFMA_LANE_LD128, n_div_8_strided_a) {
+    TEST_REQUIRES_ARM_NEON_FMA;
     for (uint32_t n = 16; n <= 24; n += 8) {
       for (size_t k = 1; k <= 20; k += 5) {
         GemmMicrokernelTester()
           .mr(4)
           .nr(8)
           .kr(1)
-          .sr(4)
+          .sr(1)
           .m(4)
           .n(n)
           .k(k)
           .a_stride(23)
-          .Test(xnn_f32_gemm_minmax_ukernel_4x8s4__neon, xnn_init_f32_minmax_scalar_params);
+          .Test(xnn_f32_gemm_minmax_ukernel_4x8__neonfma_lane_ld128, xnn_init_f32_minmax_scalar_params);
       }
     }
   }
 
-  TEST(F32_GEMM_MINMAX_4X8S4__NEON, n_div_8_subtile) {
-    TEST_REQUIRES_ARM_NEON;
+  TEST(F32_GEMM_MINMAX_4X8__NEONFMA_LANE_LD128, n_div_8_subtile) {
+    TEST_REQUIRES_ARM_NEON_FMA;
     for (uint32_t n = 16; n <= 24; n += 8) {
       for (size_t k = 1; k <= 20; k += 5) {
         for (uint32_t m = 1; m <= 4; m++) {
@@ -11386,19 +11386,19 @@
             .mr(4)
             .nr(8)
             .kr(1)
-            .sr(4)
+            .sr(1)
             .m(m)
             .n(n)
             .k(k)
             .iterations(1)
-            .Test(xnn_f32_gemm_minmax_ukernel_4x8s4__neon, xnn_init_f32_minmax_scalar_params);
+            .Test(xnn_f32_gemm_minmax_ukernel_4x8__neonfma_lane_ld128, xnn_init_f32_minmax_scalar_params);
         }
       }
     }
   }
 
-  TEST(F32_GEMM_MINMAX_4X8S4__NEON, strided_cm_subtile) {
-    TEST_REQUIRES_ARM_NEON;
+  TEST(F32_GEMM_MINMAX_4X8__NEONFMA_LANE_LD128, strided_cm_subtile) {
+    TEST_REQUIRES_ARM_NEON_FMA;
     for (size_t k = 1; k <= 20; k += 5) {
       for (uint32_t n = 1; n <= 8; n++) {
         for (uint32_t m = 1; m <= 4; m++) {
@@ -11406,566 +11406,566 @@
             .mr(4)
             .nr(8)
             .kr(1)
-            .sr(4)
+            .sr(1)
             .m(m)
             .n(n)
             .k(k)
             .cm_stride(11)
             .iterations(1)
-            .Test(xnn_f32_gemm_minmax_ukernel_4x8s4__neon, xnn_init_f32_minmax_scalar_params);
+            .Test(xnn_f32_gemm_minmax_ukernel_4x8__neonfma_lane_ld128, xnn_init_f32_minmax_scalar_params);
         }
       }
     }
   }
 
-  TEST(F32_GEMM_MINMAX_4X8S4__NEON, qmin) {
-    TEST_REQUIRES_ARM_NEON;
+  TEST(F32_GEMM_MINMAX_4X8__NEONFMA_LANE_LD128, qmin) {
+    TEST_REQUIRES_ARM_NEON_FMA;
     GemmMicrokernelTester()
       .mr(4)
       .nr(8)
       .kr(1)
-      .sr(4)
+      .sr(1)
       .m(4)
       .n(8)
       .k(4)
       .qmin(128)
-      .Test(xnn_f32_gemm_minmax_ukernel_4x8s4__neon, xnn_init_f32_minmax_scalar_params);
+      .Test(xnn_f32_gemm_minmax_ukernel_4x8__neonfma_lane_ld128, xnn_init_f32_minmax_scalar_params);
   }
 
-  TEST(F32_GEMM_MINMAX_4X8S4__NEON, qmax) {
-    TEST_REQUIRES_ARM_NEON;
+  TEST(F32_GEMM_MINMAX_4X8__NEONFMA_LANE_LD128, qmax) {
+    TEST_REQUIRES_ARM_NEON_FMA;
     GemmMicrokernelTester()
       .mr(4)
       .nr(8)
       .kr(1)
-      .sr(4)
+      .sr(1)
       .m(4)
       .n(8)
       .k(4)
       .qmax(128)
-      .Test(xnn_f32_gemm_minmax_ukernel_4x8s4__neon, xnn_init_f32_minmax_scalar_params);
+      .Test(xnn_f32_gemm_minmax_ukernel_4x8__neonfma_lane_ld128, xnn_init_f32_minmax_scalar_params);
   }
 
-  TEST(F32_GEMM_MINMAX_4X8S4__NEON, strided_cm) {
-    TEST_REQUIRES_ARM_NEON;
+  TEST(F32_GEMM_MINMAX_4X8__NEONFMA_LANE_LD128, strided_cm) {
+    TEST_REQUIRES_ARM_NEON_FMA;
     GemmMicrokernelTester()
       .mr(4)
       .nr(8)
       .kr(1)
-      .sr(4)
+      .sr(1)
       .m(4)
       .n(8)
       .k(4)
       .cm_stride(11)
-      .Test(xnn_f32_gemm_minmax_ukernel_4x8s4__neon, xnn_init_f32_minmax_scalar_params);
+      .Test(xnn_f32_gemm_minmax_ukernel_4x8__neonfma_lane_ld128, xnn_init_f32_minmax_scalar_params);
   }
-#endif  // XNN_ARCH_ARM || XNN_ARCH_ARM64
+#endif  // XNN_ARCH_ARM64
 
 
 #if XNN_ARCH_ARM || XNN_ARCH_ARM64
-  TEST(F32_GEMM_MINMAX_5X8__NEON_LANE_LD64, k_eq_2) {
+  TEST(F32_GEMM_MINMAX_4X8S4__NEON, k_eq_4) {
     TEST_REQUIRES_ARM_NEON;
     GemmMicrokernelTester()
-      .mr(5)
+      .mr(4)
       .nr(8)
       .kr(1)
-      .sr(1)
-      .m(5)
+      .sr(4)
+      .m(4)
       .n(8)
-      .k(2)
-      .Test(xnn_f32_gemm_minmax_ukernel_5x8__neon_lane_ld64, xnn_init_f32_minmax_scalar_params);
+      .k(4)
+      .Test(xnn_f32_gemm_minmax_ukernel_4x8s4__neon, xnn_init_f32_minmax_scalar_params);
   }
 
-  TEST(F32_GEMM_MINMAX_5X8__NEON_LANE_LD64, strided_cn) {
+  TEST(F32_GEMM_MINMAX_4X8S4__NEON, strided_cn) {
     TEST_REQUIRES_ARM_NEON;
     GemmMicrokernelTester()
-      .mr(5)
+      .mr(4)
       .nr(8)
       .kr(1)
-      .sr(1)
-      .m(5)
+      .sr(4)
+      .m(4)
       .n(8)
-      .k(2)
+      .k(4)
       .cn_stride(11)
-      .Test(xnn_f32_gemm_minmax_ukernel_5x8__neon_lane_ld64, xnn_init_f32_minmax_scalar_params);
+      .Test(xnn_f32_gemm_minmax_ukernel_4x8s4__neon, xnn_init_f32_minmax_scalar_params);
   }
 
-  TEST(F32_GEMM_MINMAX_5X8__NEON_LANE_LD64, k_eq_2_strided_a) {
+  TEST(F32_GEMM_MINMAX_4X8S4__NEON, k_eq_4_strided_a) {
     TEST_REQUIRES_ARM_NEON;
     GemmMicrokernelTester()
-      .mr(5)
+      .mr(4)
       .nr(8)
       .kr(1)
-      .sr(1)
-      .m(5)
+      .sr(4)
+      .m(4)
       .n(8)
-      .k(2)
-      .a_stride(5)
-      .Test(xnn_f32_gemm_minmax_ukernel_5x8__neon_lane_ld64, xnn_init_f32_minmax_scalar_params);
+      .k(4)
+      .a_stride(7)
+      .Test(xnn_f32_gemm_minmax_ukernel_4x8s4__neon, xnn_init_f32_minmax_scalar_params);
   }
 
-  TEST(F32_GEMM_MINMAX_5X8__NEON_LANE_LD64, k_eq_2_subtile) {
+  TEST(F32_GEMM_MINMAX_4X8S4__NEON, k_eq_4_subtile) {
     TEST_REQUIRES_ARM_NEON;
     for (uint32_t n = 1; n <= 8; n++) {
-      for (uint32_t m = 1; m <= 5; m++) {
+      for (uint32_t m = 1; m <= 4; m++) {
         GemmMicrokernelTester()
-          .mr(5)
+          .mr(4)
           .nr(8)
           .kr(1)
-          .sr(1)
+          .sr(4)
           .m(m)
           .n(n)
-          .k(2)
+          .k(4)
           .iterations(1)
-          .Test(xnn_f32_gemm_minmax_ukernel_5x8__neon_lane_ld64, xnn_init_f32_minmax_scalar_params);
+          .Test(xnn_f32_gemm_minmax_ukernel_4x8s4__neon, xnn_init_f32_minmax_scalar_params);
       }
     }
   }
 
-  TEST(F32_GEMM_MINMAX_5X8__NEON_LANE_LD64, k_eq_2_subtile_m) {
+  TEST(F32_GEMM_MINMAX_4X8S4__NEON, k_eq_4_subtile_m) {
     TEST_REQUIRES_ARM_NEON;
-    for (uint32_t m = 1; m <= 5; m++) {
+    for (uint32_t m = 1; m <= 4; m++) {
       GemmMicrokernelTester()
-        .mr(5)
+        .mr(4)
         .nr(8)
         .kr(1)
-        .sr(1)
+        .sr(4)
         .m(m)
         .n(8)
-        .k(2)
+        .k(4)
         .iterations(1)
-        .Test(xnn_f32_gemm_minmax_ukernel_5x8__neon_lane_ld64, xnn_init_f32_minmax_scalar_params);
+        .Test(xnn_f32_gemm_minmax_ukernel_4x8s4__neon, xnn_init_f32_minmax_scalar_params);
     }
   }
 
-  TEST(F32_GEMM_MINMAX_5X8__NEON_LANE_LD64, k_eq_2_subtile_n) {
+  TEST(F32_GEMM_MINMAX_4X8S4__NEON, k_eq_4_subtile_n) {
     TEST_REQUIRES_ARM_NEON;
     for (uint32_t n = 1; n <= 8; n++) {
       GemmMicrokernelTester()
-        .mr(5)
+        .mr(4)
         .nr(8)
         .kr(1)
-        .sr(1)
-        .m(5)
+        .sr(4)
+        .m(4)
         .n(n)
-        .k(2)
+        .k(4)
         .iterations(1)
-        .Test(xnn_f32_gemm_minmax_ukernel_5x8__neon_lane_ld64, xnn_init_f32_minmax_scalar_params);
+        .Test(xnn_f32_gemm_minmax_ukernel_4x8s4__neon, xnn_init_f32_minmax_scalar_params);
     }
   }
 
-  TEST(F32_GEMM_MINMAX_5X8__NEON_LANE_LD64, k_lt_2) {
+  TEST(F32_GEMM_MINMAX_4X8S4__NEON, k_lt_4) {
     TEST_REQUIRES_ARM_NEON;
-    for (size_t k = 1; k < 2; k++) {
+    for (size_t k = 1; k < 4; k++) {
       GemmMicrokernelTester()
-        .mr(5)
+        .mr(4)
         .nr(8)
         .kr(1)
-        .sr(1)
-        .m(5)
+        .sr(4)
+        .m(4)
         .n(8)
         .k(k)
-        .Test(xnn_f32_gemm_minmax_ukernel_5x8__neon_lane_ld64, xnn_init_f32_minmax_scalar_params);
+        .Test(xnn_f32_gemm_minmax_ukernel_4x8s4__neon, xnn_init_f32_minmax_scalar_params);
     }
   }
 
-  TEST(F32_GEMM_MINMAX_5X8__NEON_LANE_LD64, k_lt_2_strided_a) {
+  TEST(F32_GEMM_MINMAX_4X8S4__NEON, k_lt_4_strided_a) {
     TEST_REQUIRES_ARM_NEON;
-    for (size_t k = 1; k < 2; k++) {
+    for (size_t k = 1; k < 4; k++) {
       GemmMicrokernelTester()
-        .mr(5)
+        .mr(4)
         .nr(8)
         .kr(1)
-        .sr(1)
-        .m(5)
+        .sr(4)
+        .m(4)
         .n(8)
         .k(k)
-        .a_stride(5)
-        .Test(xnn_f32_gemm_minmax_ukernel_5x8__neon_lane_ld64, xnn_init_f32_minmax_scalar_params);
+        .a_stride(7)
+        .Test(xnn_f32_gemm_minmax_ukernel_4x8s4__neon, xnn_init_f32_minmax_scalar_params);
     }
   }
 
-  TEST(F32_GEMM_MINMAX_5X8__NEON_LANE_LD64, k_lt_2_subtile) {
+  TEST(F32_GEMM_MINMAX_4X8S4__NEON, k_lt_4_subtile) {
     TEST_REQUIRES_ARM_NEON;
-    for (size_t k = 1; k < 2; k++) {
+    for (size_t k = 1; k < 4; k++) {
       for (uint32_t n = 1; n <= 8; n++) {
-        for (uint32_t m = 1; m <= 5; m++) {
+        for (uint32_t m = 1; m <= 4; m++) {
           GemmMicrokernelTester()
-            .mr(5)
+            .mr(4)
             .nr(8)
             .kr(1)
-            .sr(1)
+            .sr(4)
             .m(m)
             .n(n)
             .k(k)
             .iterations(1)
-            .Test(xnn_f32_gemm_minmax_ukernel_5x8__neon_lane_ld64, xnn_init_f32_minmax_scalar_params);
+            .Test(xnn_f32_gemm_minmax_ukernel_4x8s4__neon, xnn_init_f32_minmax_scalar_params);
         }
       }
     }
   }
 
-  TEST(F32_GEMM_MINMAX_5X8__NEON_LANE_LD64, k_gt_2) {
+  TEST(F32_GEMM_MINMAX_4X8S4__NEON, k_gt_4) {
     TEST_REQUIRES_ARM_NEON;
-    for (size_t k = 3; k < 4; k++) {
+    for (size_t k = 5; k < 8; k++) {
       GemmMicrokernelTester()
-        .mr(5)
+        .mr(4)
         .nr(8)
         .kr(1)
-        .sr(1)
-        .m(5)
+        .sr(4)
+        .m(4)
         .n(8)
         .k(k)
-        .Test(xnn_f32_gemm_minmax_ukernel_5x8__neon_lane_ld64, xnn_init_f32_minmax_scalar_params);
+        .Test(xnn_f32_gemm_minmax_ukernel_4x8s4__neon, xnn_init_f32_minmax_scalar_params);
     }
   }
 
-  TEST(F32_GEMM_MINMAX_5X8__NEON_LANE_LD64, k_gt_2_strided_a) {
+  TEST(F32_GEMM_MINMAX_4X8S4__NEON, k_gt_4_strided_a) {
     TEST_REQUIRES_ARM_NEON;
-    for (size_t k = 3; k < 4; k++) {
+    for (size_t k = 5; k < 8; k++) {
       GemmMicrokernelTester()
-        .mr(5)
+        .mr(4)
         .nr(8)
         .kr(1)
-        .sr(1)
-        .m(5)
+        .sr(4)
+        .m(4)
         .n(8)
         .k(k)
-        .a_stride(7)
-        .Test(xnn_f32_gemm_minmax_ukernel_5x8__neon_lane_ld64, xnn_init_f32_minmax_scalar_params);
+        .a_stride(11)
+        .Test(xnn_f32_gemm_minmax_ukernel_4x8s4__neon, xnn_init_f32_minmax_scalar_params);
     }
   }
 
-  TEST(F32_GEMM_MINMAX_5X8__NEON_LANE_LD64, k_gt_2_subtile) {
+  TEST(F32_GEMM_MINMAX_4X8S4__NEON, k_gt_4_subtile) {
     TEST_REQUIRES_ARM_NEON;
-    for (size_t k = 3; k < 4; k++) {
+    for (size_t k = 5; k < 8; k++) {
       for (uint32_t n = 1; n <= 8; n++) {
-        for (uint32_t m = 1; m <= 5; m++) {
+        for (uint32_t m = 1; m <= 4; m++) {
           GemmMicrokernelTester()
-            .mr(5)
+            .mr(4)
             .nr(8)
             .kr(1)
-            .sr(1)
+            .sr(4)
             .m(m)
             .n(n)
             .k(k)
             .iterations(1)
-            .Test(xnn_f32_gemm_minmax_ukernel_5x8__neon_lane_ld64, xnn_init_f32_minmax_scalar_params);
+            .Test(xnn_f32_gemm_minmax_ukernel_4x8s4__neon, xnn_init_f32_minmax_scalar_params);
         }
       }
     }
   }
 
-  TEST(F32_GEMM_MINMAX_5X8__NEON_LANE_LD64, k_div_2) {
+  TEST(F32_GEMM_MINMAX_4X8S4__NEON, k_div_4) {
     TEST_REQUIRES_ARM_NEON;
-    for (size_t k = 4; k <= 20; k += 2) {
+    for (size_t k = 8; k <= 40; k += 4) {
       GemmMicrokernelTester()
-        .mr(5)
+        .mr(4)
         .nr(8)
         .kr(1)
-        .sr(1)
-        .m(5)
+        .sr(4)
+        .m(4)
         .n(8)
         .k(k)
-        .Test(xnn_f32_gemm_minmax_ukernel_5x8__neon_lane_ld64, xnn_init_f32_minmax_scalar_params);
+        .Test(xnn_f32_gemm_minmax_ukernel_4x8s4__neon, xnn_init_f32_minmax_scalar_params);
     }
   }
 
-  TEST(F32_GEMM_MINMAX_5X8__NEON_LANE_LD64, k_div_2_strided_a) {
+  TEST(F32_GEMM_MINMAX_4X8S4__NEON, k_div_4_strided_a) {
     TEST_REQUIRES_ARM_NEON;
-    for (size_t k = 4; k <= 20; k += 2) {
+    for (size_t k = 8; k <= 40; k += 4) {
       GemmMicrokernelTester()
-        .mr(5)
+        .mr(4)
         .nr(8)
         .kr(1)
-        .sr(1)
-        .m(5)
+        .sr(4)
+        .m(4)
         .n(8)
         .k(k)
-        .a_stride(23)
-        .Test(xnn_f32_gemm_minmax_ukernel_5x8__neon_lane_ld64, xnn_init_f32_minmax_scalar_params);
+        .a_stride(43)
+        .Test(xnn_f32_gemm_minmax_ukernel_4x8s4__neon, xnn_init_f32_minmax_scalar_params);
     }
   }
 
-  TEST(F32_GEMM_MINMAX_5X8__NEON_LANE_LD64, k_div_2_subtile) {
+  TEST(F32_GEMM_MINMAX_4X8S4__NEON, k_div_4_subtile) {
     TEST_REQUIRES_ARM_NEON;
-    for (size_t k = 4; k <= 20; k += 2) {
+    for (size_t k = 8; k <= 40; k += 4) {
       for (uint32_t n = 1; n <= 8; n++) {
-        for (uint32_t m = 1; m <= 5; m++) {
+        for (uint32_t m = 1; m <= 4; m++) {
           GemmMicrokernelTester()
-            .mr(5)
+            .mr(4)
             .nr(8)
             .kr(1)
-            .sr(1)
+            .sr(4)
             .m(m)
             .n(n)
             .k(k)
             .iterations(1)
-            .Test(xnn_f32_gemm_minmax_ukernel_5x8__neon_lane_ld64, xnn_init_f32_minmax_scalar_params);
+            .Test(xnn_f32_gemm_minmax_ukernel_4x8s4__neon, xnn_init_f32_minmax_scalar_params);
         }
       }
     }
   }
 
-  TEST(F32_GEMM_MINMAX_5X8__NEON_LANE_LD64, n_gt_8) {
+  TEST(F32_GEMM_MINMAX_4X8S4__NEON, n_gt_8) {
     TEST_REQUIRES_ARM_NEON;
     for (uint32_t n = 9; n < 16; n++) {
-      for (size_t k = 1; k <= 10; k += 3) {
+      for (size_t k = 1; k <= 20; k += 5) {
         GemmMicrokernelTester()
-          .mr(5)
+          .mr(4)
           .nr(8)
           .kr(1)
-          .sr(1)
-          .m(5)
+          .sr(4)
+          .m(4)
           .n(n)
           .k(k)
-          .Test(xnn_f32_gemm_minmax_ukernel_5x8__neon_lane_ld64, xnn_init_f32_minmax_scalar_params);
+          .Test(xnn_f32_gemm_minmax_ukernel_4x8s4__neon, xnn_init_f32_minmax_scalar_params);
       }
     }
   }
 
-  TEST(F32_GEMM_MINMAX_5X8__NEON_LANE_LD64, n_gt_8_strided_cn) {
+  TEST(F32_GEMM_MINMAX_4X8S4__NEON, n_gt_8_strided_cn) {
     TEST_REQUIRES_ARM_NEON;
     for (uint32_t n = 9; n < 16; n++) {
-      for (size_t k = 1; k <= 10; k += 3) {
+      for (size_t k = 1; k <= 20; k += 5) {
         GemmMicrokernelTester()
-          .mr(5)
+          .mr(4)
           .nr(8)
           .kr(1)
-          .sr(1)
-          .m(5)
+          .sr(4)
+          .m(4)
           .n(n)
           .k(k)
           .cn_stride(11)
-          .Test(xnn_f32_gemm_minmax_ukernel_5x8__neon_lane_ld64, xnn_init_f32_minmax_scalar_params);
+          .Test(xnn_f32_gemm_minmax_ukernel_4x8s4__neon, xnn_init_f32_minmax_scalar_params);
       }
     }
   }
 
-  TEST(F32_GEMM_MINMAX_5X8__NEON_LANE_LD64, n_gt_8_strided_a) {
+  TEST(F32_GEMM_MINMAX_4X8S4__NEON, n_gt_8_strided_a) {
     TEST_REQUIRES_ARM_NEON;
     for (uint32_t n = 9; n < 16; n++) {
-      for (size_t k = 1; k <= 10; k += 3) {
+      for (size_t k = 1; k <= 20; k += 5) {
         GemmMicrokernelTester()
-          .mr(5)
+          .mr(4)
           .nr(8)
           .kr(1)
-          .sr(1)
-          .m(5)
+          .sr(4)
+          .m(4)
           .n(n)
           .k(k)
-          .a_stride(13)
-          .Test(xnn_f32_gemm_minmax_ukernel_5x8__neon_lane_ld64, xnn_init_f32_minmax_scalar_params);
+          .a_stride(23)
+          .Test(xnn_f32_gemm_minmax_ukernel_4x8s4__neon, xnn_init_f32_minmax_scalar_params);
       }
     }
   }
 
-  TEST(F32_GEMM_MINMAX_5X8__NEON_LANE_LD64, n_gt_8_subtile) {
+  TEST(F32_GEMM_MINMAX_4X8S4__NEON, n_gt_8_subtile) {
     TEST_REQUIRES_ARM_NEON;
     for (uint32_t n = 9; n < 16; n++) {
-      for (size_t k = 1; k <= 10; k += 3) {
-        for (uint32_t m = 1; m <= 5; m++) {
+      for (size_t k = 1; k <= 20; k += 5) {
+        for (uint32_t m = 1; m <= 4; m++) {
           GemmMicrokernelTester()
-            .mr(5)
+            .mr(4)
             .nr(8)
             .kr(1)
-            .sr(1)
+            .sr(4)
             .m(m)
             .n(n)
             .k(k)
             .iterations(1)
-            .Test(xnn_f32_gemm_minmax_ukernel_5x8__neon_lane_ld64, xnn_init_f32_minmax_scalar_params);
+            .Test(xnn_f32_gemm_minmax_ukernel_4x8s4__neon, xnn_init_f32_minmax_scalar_params);
         }
       }
     }
   }
 
-  TEST(F32_GEMM_MINMAX_5X8__NEON_LANE_LD64, n_div_8) {
+  TEST(F32_GEMM_MINMAX_4X8S4__NEON, n_div_8) {
     TEST_REQUIRES_ARM_NEON;
     for (uint32_t n = 16; n <= 24; n += 8) {
-      for (size_t k = 1; k <= 10; k += 3) {
+      for (size_t k = 1; k <= 20; k += 5) {
         GemmMicrokernelTester()
-          .mr(5)
+          .mr(4)
           .nr(8)
           .kr(1)
-          .sr(1)
-          .m(5)
+          .sr(4)
+          .m(4)
           .n(n)
           .k(k)
-          .Test(xnn_f32_gemm_minmax_ukernel_5x8__neon_lane_ld64, xnn_init_f32_minmax_scalar_params);
+          .Test(xnn_f32_gemm_minmax_ukernel_4x8s4__neon, xnn_init_f32_minmax_scalar_params);
       }
     }
   }
 
-  TEST(F32_GEMM_MINMAX_5X8__NEON_LANE_LD64, n_div_8_strided_cn) {
+  TEST(F32_GEMM_MINMAX_4X8S4__NEON, n_div_8_strided_cn) {
     TEST_REQUIRES_ARM_NEON;
     for (uint32_t n = 16; n <= 24; n += 8) {
-      for (size_t k = 1; k <= 10; k += 3) {
+      for (size_t k = 1; k <= 20; k += 5) {
         GemmMicrokernelTester()
-          .mr(5)
+          .mr(4)
           .nr(8)
           .kr(1)
-          .sr(1)
-          .m(5)
+          .sr(4)
+          .m(4)
           .n(n)
           .k(k)
           .cn_stride(11)
-          .Test(xnn_f32_gemm_minmax_ukernel_5x8__neon_lane_ld64, xnn_init_f32_minmax_scalar_params);
+          .Test(xnn_f32_gemm_minmax_ukernel_4x8s4__neon, xnn_init_f32_minmax_scalar_params);
       }
     }
   }
 
-  TEST(F32_GEMM_MINMAX_5X8__NEON_LANE_LD64, n_div_8_strided_a) {
+  TEST(F32_GEMM_MINMAX_4X8S4__NEON, n_div_8_strided_a) {
     TEST_REQUIRES_ARM_NEON;
     for (uint32_t n = 16; n <= 24; n += 8) {
-      for (size_t k = 1; k <= 10; k += 3) {
+      for (size_t k = 1; k <= 20; k += 5) {
         GemmMicrokernelTester()
-          .mr(5)
+          .mr(4)
           .nr(8)
           .kr(1)
-          .sr(1)
-          .m(5)
+          .sr(4)
+          .m(4)
           .n(n)
           .k(k)
-          .a_stride(13)
-          .Test(xnn_f32_gemm_minmax_ukernel_5x8__neon_lane_ld64, xnn_init_f32_minmax_scalar_params);
+          .a_stride(23)
+          .Test(xnn_f32_gemm_minmax_ukernel_4x8s4__neon, xnn_init_f32_minmax_scalar_params);
       }
     }
   }
 
-  TEST(F32_GEMM_MINMAX_5X8__NEON_LANE_LD64, n_div_8_subtile) {
+  TEST(F32_GEMM_MINMAX_4X8S4__NEON, n_div_8_subtile) {
     TEST_REQUIRES_ARM_NEON;
     for (uint32_t n = 16; n <= 24; n += 8) {
-      for (size_t k = 1; k <= 10; k += 3) {
-        for (uint32_t m = 1; m <= 5; m++) {
+      for (size_t k = 1; k <= 20; k += 5) {
+        for (uint32_t m = 1; m <= 4; m++) {
           GemmMicrokernelTester()
-            .mr(5)
+            .mr(4)
             .nr(8)
             .kr(1)
-            .sr(1)
+            .sr(4)
             .m(m)
             .n(n)
             .k(k)
             .iterations(1)
-            .Test(xnn_f32_gemm_minmax_ukernel_5x8__neon_lane_ld64, xnn_init_f32_minmax_scalar_params);
+            .Test(xnn_f32_gemm_minmax_ukernel_4x8s4__neon, xnn_init_f32_minmax_scalar_params);
         }
       }
     }
   }
 
-  TEST(F32_GEMM_MINMAX_5X8__NEON_LANE_LD64, strided_cm_subtile) {
+  TEST(F32_GEMM_MINMAX_4X8S4__NEON, strided_cm_subtile) {
     TEST_REQUIRES_ARM_NEON;
-    for (size_t k = 1; k <= 10; k += 3) {
+    for (size_t k = 1; k <= 20; k += 5) {
       for (uint32_t n = 1; n <= 8; n++) {
-        for (uint32_t m = 1; m <= 5; m++) {
+        for (uint32_t m = 1; m <= 4; m++) {
           GemmMicrokernelTester()
-            .mr(5)
+            .mr(4)
             .nr(8)
             .kr(1)
-            .sr(1)
+            .sr(4)
             .m(m)
             .n(n)
             .k(k)
             .cm_stride(11)
             .iterations(1)
-            .Test(xnn_f32_gemm_minmax_ukernel_5x8__neon_lane_ld64, xnn_init_f32_minmax_scalar_params);
+            .Test(xnn_f32_gemm_minmax_ukernel_4x8s4__neon, xnn_init_f32_minmax_scalar_params);
         }
       }
     }
   }
 
-  TEST(F32_GEMM_MINMAX_5X8__NEON_LANE_LD64, qmin) {
+  TEST(F32_GEMM_MINMAX_4X8S4__NEON, qmin) {
     TEST_REQUIRES_ARM_NEON;
     GemmMicrokernelTester()
-      .mr(5)
+      .mr(4)
       .nr(8)
       .kr(1)
-      .sr(1)
-      .m(5)
+      .sr(4)
+      .m(4)
       .n(8)
-      .k(2)
+      .k(4)
       .qmin(128)
-      .Test(xnn_f32_gemm_minmax_ukernel_5x8__neon_lane_ld64, xnn_init_f32_minmax_scalar_params);
+      .Test(xnn_f32_gemm_minmax_ukernel_4x8s4__neon, xnn_init_f32_minmax_scalar_params);
   }
 
-  TEST(F32_GEMM_MINMAX_5X8__NEON_LANE_LD64, qmax) {
+  TEST(F32_GEMM_MINMAX_4X8S4__NEON, qmax) {
     TEST_REQUIRES_ARM_NEON;
     GemmMicrokernelTester()
-      .mr(5)
+      .mr(4)
       .nr(8)
       .kr(1)
-      .sr(1)
-      .m(5)
+      .sr(4)
+      .m(4)
       .n(8)
-      .k(2)
+      .k(4)
       .qmax(128)
-      .Test(xnn_f32_gemm_minmax_ukernel_5x8__neon_lane_ld64, xnn_init_f32_minmax_scalar_params);
+      .Test(xnn_f32_gemm_minmax_ukernel_4x8s4__neon, xnn_init_f32_minmax_scalar_params);
   }
 
-  TEST(F32_GEMM_MINMAX_5X8__NEON_LANE_LD64, strided_cm) {
+  TEST(F32_GEMM_MINMAX_4X8S4__NEON, strided_cm) {
     TEST_REQUIRES_ARM_NEON;
     GemmMicrokernelTester()
-      .mr(5)
+      .mr(4)
       .nr(8)
       .kr(1)
-      .sr(1)
-      .m(5)
+      .sr(4)
+      .m(4)
       .n(8)
-      .k(2)
+      .k(4)
       .cm_stride(11)
-      .Test(xnn_f32_gemm_minmax_ukernel_5x8__neon_lane_ld64, xnn_init_f32_minmax_scalar_params);
+      .Test(xnn_f32_gemm_minmax_ukernel_4x8s4__neon, xnn_init_f32_minmax_scalar_params);
   }
 #endif  // XNN_ARCH_ARM || XNN_ARCH_ARM64
 
 
 #if XNN_ARCH_ARM || XNN_ARCH_ARM64
-  TEST(F32_GEMM_MINMAX_6X8__NEON_DUP_LD64, k_eq_2) {
+  TEST(F32_GEMM_MINMAX_5X8__NEON_LANE_LD64, k_eq_2) {
     TEST_REQUIRES_ARM_NEON;
     GemmMicrokernelTester()
-      .mr(6)
+      .mr(5)
       .nr(8)
       .kr(1)
       .sr(1)
-      .m(6)
+      .m(5)
       .n(8)
       .k(2)
-      .Test(xnn_f32_gemm_minmax_ukernel_6x8__neon_dup_ld64, xnn_init_f32_minmax_scalar_params);
+      .Test(xnn_f32_gemm_minmax_ukernel_5x8__neon_lane_ld64, xnn_init_f32_minmax_scalar_params);
   }
 
-  TEST(F32_GEMM_MINMAX_6X8__NEON_DUP_LD64, strided_cn) {
+  TEST(F32_GEMM_MINMAX_5X8__NEON_LANE_LD64, strided_cn) {
     TEST_REQUIRES_ARM_NEON;
     GemmMicrokernelTester()
-      .mr(6)
+      .mr(5)
       .nr(8)
       .kr(1)
       .sr(1)
-      .m(6)
+      .m(5)
       .n(8)
       .k(2)
       .cn_stride(11)
-      .Test(xnn_f32_gemm_minmax_ukernel_6x8__neon_dup_ld64, xnn_init_f32_minmax_scalar_params);
+      .Test(xnn_f32_gemm_minmax_ukernel_5x8__neon_lane_ld64, xnn_init_f32_minmax_scalar_params);
   }
 
-  TEST(F32_GEMM_MINMAX_6X8__NEON_DUP_LD64, k_eq_2_strided_a) {
+  TEST(F32_GEMM_MINMAX_5X8__NEON_LANE_LD64, k_eq_2_strided_a) {
     TEST_REQUIRES_ARM_NEON;
     GemmMicrokernelTester()
-      .mr(6)
+      .mr(5)
       .nr(8)
       .kr(1)
       .sr(1)
-      .m(6)
+      .m(5)
       .n(8)
       .k(2)
       .a_stride(5)
-      .Test(xnn_f32_gemm_minmax_ukernel_6x8__neon_dup_ld64, xnn_init_f32_minmax_scalar_params);
+      .Test(xnn_f32_gemm_minmax_ukernel_5x8__neon_lane_ld64, xnn_init_f32_minmax_scalar_params);
   }
 
-  TEST(F32_GEMM_MINMAX_6X8__NEON_DUP_LD64, k_eq_2_subtile) {
+  TEST(F32_GEMM_MINMAX_5X8__NEON_LANE_LD64, k_eq_2_subtile) {
     TEST_REQUIRES_ARM_NEON;
     for (uint32_t n = 1; n <= 8; n++) {
-      for (uint32_t m = 1; m <= 6; m++) {
+      for (uint32_t m = 1; m <= 5; m++) {
         GemmMicrokernelTester()
-          .mr(6)
+          .mr(5)
           .nr(8)
           .kr(1)
           .sr(1)
@@ -11973,16 +11973,16 @@
           .n(n)
           .k(2)
           .iterations(1)
-          .Test(xnn_f32_gemm_minmax_ukernel_6x8__neon_dup_ld64, xnn_init_f32_minmax_scalar_params);
+          .Test(xnn_f32_gemm_minmax_ukernel_5x8__neon_lane_ld64, xnn_init_f32_minmax_scalar_params);
       }
     }
   }
 
-  TEST(F32_GEMM_MINMAX_6X8__NEON_DUP_LD64, k_eq_2_subtile_m) {
+  TEST(F32_GEMM_MINMAX_5X8__NEON_LANE_LD64, k_eq_2_subtile_m) {
     TEST_REQUIRES_ARM_NEON;
-    for (uint32_t m = 1; m <= 6; m++) {
+    for (uint32_t m = 1; m <= 5; m++) {
       GemmMicrokernelTester()
-        .mr(6)
+        .mr(5)
         .nr(8)
         .kr(1)
         .sr(1)
@@ -11990,64 +11990,64 @@
         .n(8)
         .k(2)
         .iterations(1)
-        .Test(xnn_f32_gemm_minmax_ukernel_6x8__neon_dup_ld64, xnn_init_f32_minmax_scalar_params);
+        .Test(xnn_f32_gemm_minmax_ukernel_5x8__neon_lane_ld64, xnn_init_f32_minmax_scalar_params);
     }
   }
 
-  TEST(F32_GEMM_MINMAX_6X8__NEON_DUP_LD64, k_eq_2_subtile_n) {
+  TEST(F32_GEMM_MINMAX_5X8__NEON_LANE_LD64, k_eq_2_subtile_n) {
     TEST_REQUIRES_ARM_NEON;
     for (uint32_t n = 1; n <= 8; n++) {
       GemmMicrokernelTester()
-        .mr(6)
+        .mr(5)
         .nr(8)
         .kr(1)
         .sr(1)
-        .m(6)
+        .m(5)
         .n(n)
         .k(2)
         .iterations(1)
-        .Test(xnn_f32_gemm_minmax_ukernel_6x8__neon_dup_ld64, xnn_init_f32_minmax_scalar_params);
+        .Test(xnn_f32_gemm_minmax_ukernel_5x8__neon_lane_ld64, xnn_init_f32_minmax_scalar_params);
     }
   }
 
-  TEST(F32_GEMM_MINMAX_6X8__NEON_DUP_LD64, k_lt_2) {
+  TEST(F32_GEMM_MINMAX_5X8__NEON_LANE_LD64, k_lt_2) {
     TEST_REQUIRES_ARM_NEON;
     for (size_t k = 1; k < 2; k++) {
       GemmMicrokernelTester()
-        .mr(6)
+        .mr(5)
         .nr(8)
         .kr(1)
         .sr(1)
-        .m(6)
+        .m(5)
         .n(8)
         .k(k)
-        .Test(xnn_f32_gemm_minmax_ukernel_6x8__neon_dup_ld64, xnn_init_f32_minmax_scalar_params);
+        .Test(xnn_f32_gemm_minmax_ukernel_5x8__neon_lane_ld64, xnn_init_f32_minmax_scalar_params);
     }
   }
 
-  TEST(F32_GEMM_MINMAX_6X8__NEON_DUP_LD64, k_lt_2_strided_a) {
+  TEST(F32_GEMM_MINMAX_5X8__NEON_LANE_LD64, k_lt_2_strided_a) {
     TEST_REQUIRES_ARM_NEON;
     for (size_t k = 1; k < 2; k++) {
       GemmMicrokernelTester()
-        .mr(6)
+        .mr(5)
         .nr(8)
         .kr(1)
         .sr(1)
-        .m(6)
+        .m(5)
         .n(8)
         .k(k)
         .a_stride(5)
-        .Test(xnn_f32_gemm_minmax_ukernel_6x8__neon_dup_ld64, xnn_init_f32_minmax_scalar_params);
+        .Test(xnn_f32_gemm_minmax_ukernel_5x8__neon_lane_ld64, xnn_init_f32_minmax_scalar_params);
     }
   }
 
-  TEST(F32_GEMM_MINMAX_6X8__NEON_DUP_LD64, k_lt_2_subtile) {
+  TEST(F32_GEMM_MINMAX_5X8__NEON_LANE_LD64, k_lt_2_subtile) {
     TEST_REQUIRES_ARM_NEON;
     for (size_t k = 1; k < 2; k++) {
       for (uint32_t n = 1; n <= 8; n++) {
-        for (uint32_t m = 1; m <= 6; m++) {
+        for (uint32_t m = 1; m <= 5; m++) {
           GemmMicrokernelTester()
-            .mr(6)
+            .mr(5)
             .nr(8)
             .kr(1)
             .sr(1)
@@ -12055,50 +12055,50 @@
             .n(n)
             .k(k)
             .iterations(1)
-            .Test(xnn_f32_gemm_minmax_ukernel_6x8__neon_dup_ld64, xnn_init_f32_minmax_scalar_params);
+            .Test(xnn_f32_gemm_minmax_ukernel_5x8__neon_lane_ld64, xnn_init_f32_minmax_scalar_params);
         }
       }
     }
   }
 
-  TEST(F32_GEMM_MINMAX_6X8__NEON_DUP_LD64, k_gt_2) {
+  TEST(F32_GEMM_MINMAX_5X8__NEON_LANE_LD64, k_gt_2) {
     TEST_REQUIRES_ARM_NEON;
     for (size_t k = 3; k < 4; k++) {
       GemmMicrokernelTester()
-        .mr(6)
+        .mr(5)
         .nr(8)
         .kr(1)
         .sr(1)
-        .m(6)
+        .m(5)
         .n(8)
         .k(k)
-        .Test(xnn_f32_gemm_minmax_ukernel_6x8__neon_dup_ld64, xnn_init_f32_minmax_scalar_params);
+        .Test(xnn_f32_gemm_minmax_ukernel_5x8__neon_lane_ld64, xnn_init_f32_minmax_scalar_params);
     }
   }
 
-  TEST(F32_GEMM_MINMAX_6X8__NEON_DUP_LD64, k_gt_2_strided_a) {
+  TEST(F32_GEMM_MINMAX_5X8__NEON_LANE_LD64, k_gt_2_strided_a) {
     TEST_REQUIRES_ARM_NEON;
     for (size_t k = 3; k < 4; k++) {
       GemmMicrokernelTester()
-        .mr(6)
+        .mr(5)
         .nr(8)
         .kr(1)
         .sr(1)
-        .m(6)
+        .m(5)
         .n(8)
         .k(k)
         .a_stride(7)
-        .Test(xnn_f32_gemm_minmax_ukernel_6x8__neon_dup_ld64, xnn_init_f32_minmax_scalar_params);
+        .Test(xnn_f32_gemm_minmax_ukernel_5x8__neon_lane_ld64, xnn_init_f32_minmax_scalar_params);
     }
   }
 
-  TEST(F32_GEMM_MINMAX_6X8__NEON_DUP_LD64, k_gt_2_subtile) {
+  TEST(F32_GEMM_MINMAX_5X8__NEON_LANE_LD64, k_gt_2_subtile) {
     TEST_REQUIRES_ARM_NEON;
     for (size_t k = 3; k < 4; k++) {
       for (uint32_t n = 1; n <= 8; n++) {
-        for (uint32_t m = 1; m <= 6; m++) {
+        for (uint32_t m = 1; m <= 5; m++) {
           GemmMicrokernelTester()
-            .mr(6)
+            .mr(5)
             .nr(8)
             .kr(1)
             .sr(1)
@@ -12106,50 +12106,50 @@
             .n(n)
             .k(k)
             .iterations(1)
-            .Test(xnn_f32_gemm_minmax_ukernel_6x8__neon_dup_ld64, xnn_init_f32_minmax_scalar_params);
+            .Test(xnn_f32_gemm_minmax_ukernel_5x8__neon_lane_ld64, xnn_init_f32_minmax_scalar_params);
         }
       }
     }
   }
 
-  TEST(F32_GEMM_MINMAX_6X8__NEON_DUP_LD64, k_div_2) {
+  TEST(F32_GEMM_MINMAX_5X8__NEON_LANE_LD64, k_div_2) {
     TEST_REQUIRES_ARM_NEON;
     for (size_t k = 4; k <= 20; k += 2) {
       GemmMicrokernelTester()
-        .mr(6)
+        .mr(5)
         .nr(8)
         .kr(1)
         .sr(1)
-        .m(6)
+        .m(5)
         .n(8)
         .k(k)
-        .Test(xnn_f32_gemm_minmax_ukernel_6x8__neon_dup_ld64, xnn_init_f32_minmax_scalar_params);
+        .Test(xnn_f32_gemm_minmax_ukernel_5x8__neon_lane_ld64, xnn_init_f32_minmax_scalar_params);
     }
   }
 
-  TEST(F32_GEMM_MINMAX_6X8__NEON_DUP_LD64, k_div_2_strided_a) {
+  TEST(F32_GEMM_MINMAX_5X8__NEON_LANE_LD64, k_div_2_strided_a) {
     TEST_REQUIRES_ARM_NEON;
     for (size_t k = 4; k <= 20; k += 2) {
       GemmMicrokernelTester()
-        .mr(6)
+        .mr(5)
         .nr(8)
         .kr(1)
         .sr(1)
-        .m(6)
+        .m(5)
         .n(8)
         .k(k)
         .a_stride(23)
-        .Test(xnn_f32_gemm_minmax_ukernel_6x8__neon_dup_ld64, xnn_init_f32_minmax_scalar_params);
+        .Test(xnn_f32_gemm_minmax_ukernel_5x8__neon_lane_ld64, xnn_init_f32_minmax_scalar_params);
     }
   }
 
-  TEST(F32_GEMM_MINMAX_6X8__NEON_DUP_LD64, k_div_2_subtile) {
+  TEST(F32_GEMM_MINMAX_5X8__NEON_LANE_LD64, k_div_2_subtile) {
     TEST_REQUIRES_ARM_NEON;
     for (size_t k = 4; k <= 20; k += 2) {
       for (uint32_t n = 1; n <= 8; n++) {
-        for (uint32_t m = 1; m <= 6; m++) {
+        for (uint32_t m = 1; m <= 5; m++) {
           GemmMicrokernelTester()
-            .mr(6)
+            .mr(5)
             .nr(8)
             .kr(1)
             .sr(1)
@@ -12157,72 +12157,72 @@
             .n(n)
             .k(k)
             .iterations(1)
-            .Test(xnn_f32_gemm_minmax_ukernel_6x8__neon_dup_ld64, xnn_init_f32_minmax_scalar_params);
+            .Test(xnn_f32_gemm_minmax_ukernel_5x8__neon_lane_ld64, xnn_init_f32_minmax_scalar_params);
         }
       }
     }
   }
 
-  TEST(F32_GEMM_MINMAX_6X8__NEON_DUP_LD64, n_gt_8) {
+  TEST(F32_GEMM_MINMAX_5X8__NEON_LANE_LD64, n_gt_8) {
     TEST_REQUIRES_ARM_NEON;
     for (uint32_t n = 9; n < 16; n++) {
       for (size_t k = 1; k <= 10; k += 3) {
         GemmMicrokernelTester()
-          .mr(6)
+          .mr(5)
           .nr(8)
           .kr(1)
           .sr(1)
-          .m(6)
+          .m(5)
           .n(n)
           .k(k)
-          .Test(xnn_f32_gemm_minmax_ukernel_6x8__neon_dup_ld64, xnn_init_f32_minmax_scalar_params);
+          .Test(xnn_f32_gemm_minmax_ukernel_5x8__neon_lane_ld64, xnn_init_f32_minmax_scalar_params);
       }
     }
   }
 
-  TEST(F32_GEMM_MINMAX_6X8__NEON_DUP_LD64, n_gt_8_strided_cn) {
+  TEST(F32_GEMM_MINMAX_5X8__NEON_LANE_LD64, n_gt_8_strided_cn) {
     TEST_REQUIRES_ARM_NEON;
     for (uint32_t n = 9; n < 16; n++) {
       for (size_t k = 1; k <= 10; k += 3) {
         GemmMicrokernelTester()
-          .mr(6)
+          .mr(5)
           .nr(8)
           .kr(1)
           .sr(1)
-          .m(6)
+          .m(5)
           .n(n)
           .k(k)
           .cn_stride(11)
-          .Test(xnn_f32_gemm_minmax_ukernel_6x8__neon_dup_ld64, xnn_init_f32_minmax_scalar_params);
+          .Test(xnn_f32_gemm_minmax_ukernel_5x8__neon_lane_ld64, xnn_init_f32_minmax_scalar_params);
       }
     }
   }
 
-  TEST(F32_GEMM_MINMAX_6X8__NEON_DUP_LD64, n_gt_8_strided_a) {
+  TEST(F32_GEMM_MINMAX_5X8__NEON_LANE_LD64, n_gt_8_strided_a) {
     TEST_REQUIRES_ARM_NEON;
     for (uint32_t n = 9; n < 16; n++) {
       for (size_t k = 1; k <= 10; k += 3) {
         GemmMicrokernelTester()
-          .mr(6)
+          .mr(5)
           .nr(8)
           .kr(1)
           .sr(1)
-          .m(6)
+          .m(5)
           .n(n)
           .k(k)
           .a_stride(13)
-          .Test(xnn_f32_gemm_minmax_ukernel_6x8__neon_dup_ld64, xnn_init_f32_minmax_scalar_params);
+          .Test(xnn_f32_gemm_minmax_ukernel_5x8__neon_lane_ld64, xnn_init_f32_minmax_scalar_params);
       }
     }
   }
 
-  TEST(F32_GEMM_MINMAX_6X8__NEON_DUP_LD64, n_gt_8_subtile) {
+  TEST(F32_GEMM_MINMAX_5X8__NEON_LANE_LD64, n_gt_8_subtile) {
     TEST_REQUIRES_ARM_NEON;
     for (uint32_t n = 9; n < 16; n++) {
       for (size_t k = 1; k <= 10; k += 3) {
-        for (uint32_t m = 1; m <= 6; m++) {
+        for (uint32_t m = 1; m <= 5; m++) {
           GemmMicrokernelTester()
-            .mr(6)
+            .mr(5)
             .nr(8)
             .kr(1)
             .sr(1)
@@ -12230,72 +12230,72 @@
             .n(n)
             .k(k)
             .iterations(1)
-            .Test(xnn_f32_gemm_minmax_ukernel_6x8__neon_dup_ld64, xnn_init_f32_minmax_scalar_params);
+            .Test(xnn_f32_gemm_minmax_ukernel_5x8__neon_lane_ld64, xnn_init_f32_minmax_scalar_params);
         }
       }
     }
   }
 
-  TEST(F32_GEMM_MINMAX_6X8__NEON_DUP_LD64, n_div_8) {
+  TEST(F32_GEMM_MINMAX_5X8__NEON_LANE_LD64, n_div_8) {
     TEST_REQUIRES_ARM_NEON;
     for (uint32_t n = 16; n <= 24; n += 8) {
       for (size_t k = 1; k <= 10; k += 3) {
         GemmMicrokernelTester()
-          .mr(6)
+          .mr(5)
           .nr(8)
           .kr(1)
           .sr(1)
-          .m(6)
+          .m(5)
           .n(n)
           .k(k)
-          .Test(xnn_f32_gemm_minmax_ukernel_6x8__neon_dup_ld64, xnn_init_f32_minmax_scalar_params);
+          .Test(xnn_f32_gemm_minmax_ukernel_5x8__neon_lane_ld64, xnn_init_f32_minmax_scalar_params);
       }
     }
   }
 
-  TEST(F32_GEMM_MINMAX_6X8__NEON_DUP_LD64, n_div_8_strided_cn) {
+  TEST(F32_GEMM_MINMAX_5X8__NEON_LANE_LD64, n_div_8_strided_cn) {
     TEST_REQUIRES_ARM_NEON;
     for (uint32_t n = 16; n <= 24; n += 8) {
       for (size_t k = 1; k <= 10; k += 3) {
         GemmMicrokernelTester()
-          .mr(6)
+          .mr(5)
           .nr(8)
           .kr(1)
           .sr(1)
-          .m(6)
+          .m(5)
           .n(n)
           .k(k)
           .cn_stride(11)
-          .Test(xnn_f32_gemm_minmax_ukernel_6x8__neon_dup_ld64, xnn_init_f32_minmax_scalar_params);
+          .Test(xnn_f32_gemm_minmax_ukernel_5x8__neon_lane_ld64, xnn_init_f32_minmax_scalar_params);
       }
     }
   }
 
-  TEST(F32_GEMM_MINMAX_6X8__NEON_DUP_LD64, n_div_8_strided_a) {
+  TEST(F32_GEMM_MINMAX_5X8__NEON_LANE_LD64, n_div_8_strided_a) {
     TEST_REQUIRES_ARM_NEON;
     for (uint32_t n = 16; n <= 24; n += 8) {
       for (size_t k = 1; k <= 10; k += 3) {
         GemmMicrokernelTester()
-          .mr(6)
+          .mr(5)
           .nr(8)
           .kr(1)
           .sr(1)
-          .m(6)
+          .m(5)
           .n(n)
           .k(k)
           .a_stride(13)
-          .Test(xnn_f32_gemm_minmax_ukernel_6x8__neon_dup_ld64, xnn_init_f32_minmax_scalar_params);
+          .Test(xnn_f32_gemm_minmax_ukernel_5x8__neon_lane_ld64, xnn_init_f32_minmax_scalar_params);
       }
     }
   }
 
-  TEST(F32_GEMM_MINMAX_6X8__NEON_DUP_LD64, n_div_8_subtile) {
+  TEST(F32_GEMM_MINMAX_5X8__NEON_LANE_LD64, n_div_8_subtile) {
     TEST_REQUIRES_ARM_NEON;
     for (uint32_t n = 16; n <= 24; n += 8) {
       for (size_t k = 1; k <= 10; k += 3) {
-        for (uint32_t m = 1; m <= 6; m++) {
+        for (uint32_t m = 1; m <= 5; m++) {
           GemmMicrokernelTester()
-            .mr(6)
+            .mr(5)
             .nr(8)
             .kr(1)
             .sr(1)
@@ -12303,19 +12303,19 @@
             .n(n)
             .k(k)
             .iterations(1)
-            .Test(xnn_f32_gemm_minmax_ukernel_6x8__neon_dup_ld64, xnn_init_f32_minmax_scalar_params);
+            .Test(xnn_f32_gemm_minmax_ukernel_5x8__neon_lane_ld64, xnn_init_f32_minmax_scalar_params);
         }
       }
     }
   }
 
-  TEST(F32_GEMM_MINMAX_6X8__NEON_DUP_LD64, strided_cm_subtile) {
+  TEST(F32_GEMM_MINMAX_5X8__NEON_LANE_LD64, strided_cm_subtile) {
     TEST_REQUIRES_ARM_NEON;
     for (size_t k = 1; k <= 10; k += 3) {
       for (uint32_t n = 1; n <= 8; n++) {
-        for (uint32_t m = 1; m <= 6; m++) {
+        for (uint32_t m = 1; m <= 5; m++) {
           GemmMicrokernelTester()
-            .mr(6)
+            .mr(5)
             .nr(8)
             .kr(1)
             .sr(1)
@@ -12324,58 +12324,58 @@
             .k(k)
             .cm_stride(11)
             .iterations(1)
-            .Test(xnn_f32_gemm_minmax_ukernel_6x8__neon_dup_ld64, xnn_init_f32_minmax_scalar_params);
+            .Test(xnn_f32_gemm_minmax_ukernel_5x8__neon_lane_ld64, xnn_init_f32_minmax_scalar_params);
         }
       }
     }
   }
 
-  TEST(F32_GEMM_MINMAX_6X8__NEON_DUP_LD64, qmin) {
+  TEST(F32_GEMM_MINMAX_5X8__NEON_LANE_LD64, qmin) {
     TEST_REQUIRES_ARM_NEON;
     GemmMicrokernelTester()
-      .mr(6)
+      .mr(5)
       .nr(8)
       .kr(1)
       .sr(1)
-      .m(6)
+      .m(5)
       .n(8)
       .k(2)
       .qmin(128)
-      .Test(xnn_f32_gemm_minmax_ukernel_6x8__neon_dup_ld64, xnn_init_f32_minmax_scalar_params);
+      .Test(xnn_f32_gemm_minmax_ukernel_5x8__neon_lane_ld64, xnn_init_f32_minmax_scalar_params);
   }
 
-  TEST(F32_GEMM_MINMAX_6X8__NEON_DUP_LD64, qmax) {
+  TEST(F32_GEMM_MINMAX_5X8__NEON_LANE_LD64, qmax) {
     TEST_REQUIRES_ARM_NEON;
     GemmMicrokernelTester()
-      .mr(6)
+      .mr(5)
       .nr(8)
       .kr(1)
       .sr(1)
-      .m(6)
+      .m(5)
       .n(8)
       .k(2)
       .qmax(128)
-      .Test(xnn_f32_gemm_minmax_ukernel_6x8__neon_dup_ld64, xnn_init_f32_minmax_scalar_params);
+      .Test(xnn_f32_gemm_minmax_ukernel_5x8__neon_lane_ld64, xnn_init_f32_minmax_scalar_params);
   }
 
-  TEST(F32_GEMM_MINMAX_6X8__NEON_DUP_LD64, strided_cm) {
+  TEST(F32_GEMM_MINMAX_5X8__NEON_LANE_LD64, strided_cm) {
     TEST_REQUIRES_ARM_NEON;
     GemmMicrokernelTester()
-      .mr(6)
+      .mr(5)
       .nr(8)
       .kr(1)
       .sr(1)
-      .m(6)
+      .m(5)
       .n(8)
       .k(2)
       .cm_stride(11)
-      .Test(xnn_f32_gemm_minmax_ukernel_6x8__neon_dup_ld64, xnn_init_f32_minmax_scalar_params);
+      .Test(xnn_f32_gemm_minmax_ukernel_5x8__neon_lane_ld64, xnn_init_f32_minmax_scalar_params);
   }
 #endif  // XNN_ARCH_ARM || XNN_ARCH_ARM64
 
 
 #if XNN_ARCH_ARM || XNN_ARCH_ARM64
-  TEST(F32_GEMM_MINMAX_6X8__NEON_LANE_LD128, k_eq_4) {
+  TEST(F32_GEMM_MINMAX_6X8__NEON_DUP_LD64, k_eq_2) {
     TEST_REQUIRES_ARM_NEON;
     GemmMicrokernelTester()
       .mr(6)
@@ -12384,11 +12384,11 @@
       .sr(1)
       .m(6)
       .n(8)
-      .k(4)
-      .Test(xnn_f32_gemm_minmax_ukernel_6x8__neon_lane_ld128, xnn_init_f32_minmax_scalar_params);
+      .k(2)
+      .Test(xnn_f32_gemm_minmax_ukernel_6x8__neon_dup_ld64, xnn_init_f32_minmax_scalar_params);
   }
 
-  TEST(F32_GEMM_MINMAX_6X8__NEON_LANE_LD128, strided_cn) {
+  TEST(F32_GEMM_MINMAX_6X8__NEON_DUP_LD64, strided_cn) {
     TEST_REQUIRES_ARM_NEON;
     GemmMicrokernelTester()
       .mr(6)
@@ -12397,12 +12397,12 @@
       .sr(1)
       .m(6)
       .n(8)
-      .k(4)
+      .k(2)
       .cn_stride(11)
-      .Test(xnn_f32_gemm_minmax_ukernel_6x8__neon_lane_ld128, xnn_init_f32_minmax_scalar_params);
+      .Test(xnn_f32_gemm_minmax_ukernel_6x8__neon_dup_ld64, xnn_init_f32_minmax_scalar_params);
   }
 
-  TEST(F32_GEMM_MINMAX_6X8__NEON_LANE_LD128, k_eq_4_strided_a) {
+  TEST(F32_GEMM_MINMAX_6X8__NEON_DUP_LD64, k_eq_2_strided_a) {
     TEST_REQUIRES_ARM_NEON;
     GemmMicrokernelTester()
       .mr(6)
@@ -12411,12 +12411,12 @@
       .sr(1)
       .m(6)
       .n(8)
-      .k(4)
-      .a_stride(7)
-      .Test(xnn_f32_gemm_minmax_ukernel_6x8__neon_lane_ld128, xnn_init_f32_minmax_scalar_params);
+      .k(2)
+      .a_stride(5)
+      .Test(xnn_f32_gemm_minmax_ukernel_6x8__neon_dup_ld64, xnn_init_f32_minmax_scalar_params);
   }
 
-  TEST(F32_GEMM_MINMAX_6X8__NEON_LANE_LD128, k_eq_4_subtile) {
+  TEST(F32_GEMM_MINMAX_6X8__NEON_DUP_LD64, k_eq_2_subtile) {
     TEST_REQUIRES_ARM_NEON;
     for (uint32_t n = 1; n <= 8; n++) {
       for (uint32_t m = 1; m <= 6; m++) {
@@ -12427,14 +12427,14 @@
           .sr(1)
           .m(m)
           .n(n)
-          .k(4)
+          .k(2)
           .iterations(1)
-          .Test(xnn_f32_gemm_minmax_ukernel_6x8__neon_lane_ld128, xnn_init_f32_minmax_scalar_params);
+          .Test(xnn_f32_gemm_minmax_ukernel_6x8__neon_dup_ld64, xnn_init_f32_minmax_scalar_params);
       }
     }
   }
 
-  TEST(F32_GEMM_MINMAX_6X8__NEON_LANE_LD128, k_eq_4_subtile_m) {
+  TEST(F32_GEMM_MINMAX_6X8__NEON_DUP_LD64, k_eq_2_subtile_m) {
     TEST_REQUIRES_ARM_NEON;
     for (uint32_t m = 1; m <= 6; m++) {
       GemmMicrokernelTester()
@@ -12444,13 +12444,13 @@
         .sr(1)
         .m(m)
         .n(8)
-        .k(4)
+        .k(2)
         .iterations(1)
-        .Test(xnn_f32_gemm_minmax_ukernel_6x8__neon_lane_ld128, xnn_init_f32_minmax_scalar_params);
+        .Test(xnn_f32_gemm_minmax_ukernel_6x8__neon_dup_ld64, xnn_init_f32_minmax_scalar_params);
     }
   }
 
-  TEST(F32_GEMM_MINMAX_6X8__NEON_LANE_LD128, k_eq_4_subtile_n) {
+  TEST(F32_GEMM_MINMAX_6X8__NEON_DUP_LD64, k_eq_2_subtile_n) {
     TEST_REQUIRES_ARM_NEON;
     for (uint32_t n = 1; n <= 8; n++) {
       GemmMicrokernelTester()
@@ -12460,15 +12460,15 @@
         .sr(1)
         .m(6)
         .n(n)
-        .k(4)
+        .k(2)
         .iterations(1)
-        .Test(xnn_f32_gemm_minmax_ukernel_6x8__neon_lane_ld128, xnn_init_f32_minmax_scalar_params);
+        .Test(xnn_f32_gemm_minmax_ukernel_6x8__neon_dup_ld64, xnn_init_f32_minmax_scalar_params);
     }
   }
 
-  TEST(F32_GEMM_MINMAX_6X8__NEON_LANE_LD128, k_lt_4) {
+  TEST(F32_GEMM_MINMAX_6X8__NEON_DUP_LD64, k_lt_2) {
     TEST_REQUIRES_ARM_NEON;
-    for (size_t k = 1; k < 4; k++) {
+    for (size_t k = 1; k < 2; k++) {
       GemmMicrokernelTester()
         .mr(6)
         .nr(8)
@@ -12477,13 +12477,13 @@
         .m(6)
         .n(8)
         .k(k)
-        .Test(xnn_f32_gemm_minmax_ukernel_6x8__neon_lane_ld128, xnn_init_f32_minmax_scalar_params);
+        .Test(xnn_f32_gemm_minmax_ukernel_6x8__neon_dup_ld64, xnn_init_f32_minmax_scalar_params);
     }
   }
 
-  TEST(F32_GEMM_MINMAX_6X8__NEON_LANE_LD128, k_lt_4_strided_a) {
+  TEST(F32_GEMM_MINMAX_6X8__NEON_DUP_LD64, k_lt_2_strided_a) {
     TEST_REQUIRES_ARM_NEON;
-    for (size_t k = 1; k < 4; k++) {
+    for (size_t k = 1; k < 2; k++) {
       GemmMicrokernelTester()
         .mr(6)
         .nr(8)
@@ -12492,14 +12492,14 @@
         .m(6)
         .n(8)
         .k(k)
-        .a_stride(7)
-        .Test(xnn_f32_gemm_minmax_ukernel_6x8__neon_lane_ld128, xnn_init_f32_minmax_scalar_params);
+        .a_stride(5)
+        .Test(xnn_f32_gemm_minmax_ukernel_6x8__neon_dup_ld64, xnn_init_f32_minmax_scalar_params);
     }
   }
 
-  TEST(F32_GEMM_MINMAX_6X8__NEON_LANE_LD128, k_lt_4_subtile) {
+  TEST(F32_GEMM_MINMAX_6X8__NEON_DUP_LD64, k_lt_2_subtile) {
     TEST_REQUIRES_ARM_NEON;
-    for (size_t k = 1; k < 4; k++) {
+    for (size_t k = 1; k < 2; k++) {
       for (uint32_t n = 1; n <= 8; n++) {
         for (uint32_t m = 1; m <= 6; m++) {
           GemmMicrokernelTester()
@@ -12511,15 +12511,15 @@
             .n(n)
             .k(k)
             .iterations(1)
-            .Test(xnn_f32_gemm_minmax_ukernel_6x8__neon_lane_ld128, xnn_init_f32_minmax_scalar_params);
+            .Test(xnn_f32_gemm_minmax_ukernel_6x8__neon_dup_ld64, xnn_init_f32_minmax_scalar_params);
         }
       }
     }
   }
 
-  TEST(F32_GEMM_MINMAX_6X8__NEON_LANE_LD128, k_gt_4) {
+  TEST(F32_GEMM_MINMAX_6X8__NEON_DUP_LD64, k_gt_2) {
     TEST_REQUIRES_ARM_NEON;
-    for (size_t k = 5; k < 8; k++) {
+    for (size_t k = 3; k < 4; k++) {
       GemmMicrokernelTester()
         .mr(6)
         .nr(8)
@@ -12528,13 +12528,13 @@
         .m(6)
         .n(8)
         .k(k)
-        .Test(xnn_f32_gemm_minmax_ukernel_6x8__neon_lane_ld128, xnn_init_f32_minmax_scalar_params);
+        .Test(xnn_f32_gemm_minmax_ukernel_6x8__neon_dup_ld64, xnn_init_f32_minmax_scalar_params);
     }
   }
 
-  TEST(F32_GEMM_MINMAX_6X8__NEON_LANE_LD128, k_gt_4_strided_a) {
+  TEST(F32_GEMM_MINMAX_6X8__NEON_DUP_LD64, k_gt_2_strided_a) {
     TEST_REQUIRES_ARM_NEON;
-    for (size_t k = 5; k < 8; k++) {
+    for (size_t k = 3; k < 4; k++) {
       GemmMicrokernelTester()
         .mr(6)
         .nr(8)
@@ -12543,14 +12543,14 @@
         .m(6)
         .n(8)
         .k(k)
-        .a_stride(11)
-        .Test(xnn_f32_gemm_minmax_ukernel_6x8__neon_lane_ld128, xnn_init_f32_minmax_scalar_params);
+        .a_stride(7)
+        .Test(xnn_f32_gemm_minmax_ukernel_6x8__neon_dup_ld64, xnn_init_f32_minmax_scalar_params);
     }
   }
 
-  TEST(F32_GEMM_MINMAX_6X8__NEON_LANE_LD128, k_gt_4_subtile) {
+  TEST(F32_GEMM_MINMAX_6X8__NEON_DUP_LD64, k_gt_2_subtile) {
     TEST_REQUIRES_ARM_NEON;
-    for (size_t k = 5; k < 8; k++) {
+    for (size_t k = 3; k < 4; k++) {
       for (uint32_t n = 1; n <= 8; n++) {
         for (uint32_t m = 1; m <= 6; m++) {
           GemmMicrokernelTester()
@@ -12562,15 +12562,15 @@
             .n(n)
             .k(k)
             .iterations(1)
-            .Test(xnn_f32_gemm_minmax_ukernel_6x8__neon_lane_ld128, xnn_init_f32_minmax_scalar_params);
+            .Test(xnn_f32_gemm_minmax_ukernel_6x8__neon_dup_ld64, xnn_init_f32_minmax_scalar_params);
         }
       }
     }
   }
 
-  TEST(F32_GEMM_MINMAX_6X8__NEON_LANE_LD128, k_div_4) {
+  TEST(F32_GEMM_MINMAX_6X8__NEON_DUP_LD64, k_div_2) {
     TEST_REQUIRES_ARM_NEON;
-    for (size_t k = 8; k <= 40; k += 4) {
+    for (size_t k = 4; k <= 20; k += 2) {
       GemmMicrokernelTester()
         .mr(6)
         .nr(8)
@@ -12579,13 +12579,13 @@
         .m(6)
         .n(8)
         .k(k)
-        .Test(xnn_f32_gemm_minmax_ukernel_6x8__neon_lane_ld128, xnn_init_f32_minmax_scalar_params);
+        .Test(xnn_f32_gemm_minmax_ukernel_6x8__neon_dup_ld64, xnn_init_f32_minmax_scalar_params);
     }
   }
 
-  TEST(F32_GEMM_MINMAX_6X8__NEON_LANE_LD128, k_div_4_strided_a) {
+  TEST(F32_GEMM_MINMAX_6X8__NEON_DUP_LD64, k_div_2_strided_a) {
     TEST_REQUIRES_ARM_NEON;
-    for (size_t k = 8; k <= 40; k += 4) {
+    for (size_t k = 4; k <= 20; k += 2) {
       GemmMicrokernelTester()
         .mr(6)
         .nr(8)
@@ -12594,14 +12594,14 @@
         .m(6)
         .n(8)
         .k(k)
-        .a_stride(43)
-        .Test(xnn_f32_gemm_minmax_ukernel_6x8__neon_lane_ld128, xnn_init_f32_minmax_scalar_params);
+        .a_stride(23)
+        .Test(xnn_f32_gemm_minmax_ukernel_6x8__neon_dup_ld64, xnn_init_f32_minmax_scalar_params);
     }
   }
 
-  TEST(F32_GEMM_MINMAX_6X8__NEON_LANE_LD128, k_div_4_subtile) {
+  TEST(F32_GEMM_MINMAX_6X8__NEON_DUP_LD64, k_div_2_subtile) {
     TEST_REQUIRES_ARM_NEON;
-    for (size_t k = 8; k <= 40; k += 4) {
+    for (size_t k = 4; k <= 20; k += 2) {
       for (uint32_t n = 1; n <= 8; n++) {
         for (uint32_t m = 1; m <= 6; m++) {
           GemmMicrokernelTester()
@@ -12613,16 +12613,16 @@
             .n(n)
             .k(k)
             .iterations(1)
-            .Test(xnn_f32_gemm_minmax_ukernel_6x8__neon_lane_ld128, xnn_init_f32_minmax_scalar_params);
+            .Test(xnn_f32_gemm_minmax_ukernel_6x8__neon_dup_ld64, xnn_init_f32_minmax_scalar_params);
         }
       }
     }
   }
 
-  TEST(F32_GEMM_MINMAX_6X8__NEON_LANE_LD128, n_gt_8) {
+  TEST(F32_GEMM_MINMAX_6X8__NEON_DUP_LD64, n_gt_8) {
     TEST_REQUIRES_ARM_NEON;
     for (uint32_t n = 9; n < 16; n++) {
-      for (size_t k = 1; k <= 20; k += 5) {
+      for (size_t k = 1; k <= 10; k += 3) {
         GemmMicrokernelTester()
           .mr(6)
           .nr(8)
@@ -12631,15 +12631,15 @@
           .m(6)
           .n(n)
           .k(k)
-          .Test(xnn_f32_gemm_minmax_ukernel_6x8__neon_lane_ld128, xnn_init_f32_minmax_scalar_params);
+          .Test(xnn_f32_gemm_minmax_ukernel_6x8__neon_dup_ld64, xnn_init_f32_minmax_scalar_params);
       }
     }
   }
 
-  TEST(F32_GEMM_MINMAX_6X8__NEON_LANE_LD128, n_gt_8_strided_cn) {
+  TEST(F32_GEMM_MINMAX_6X8__NEON_DUP_LD64, n_gt_8_strided_cn) {
     TEST_REQUIRES_ARM_NEON;
     for (uint32_t n = 9; n < 16; n++) {
-      for (size_t k = 1; k <= 20; k += 5) {
+      for (size_t k = 1; k <= 10; k += 3) {
         GemmMicrokernelTester()
           .mr(6)
           .nr(8)
@@ -12649,15 +12649,15 @@
           .n(n)
           .k(k)
           .cn_stride(11)
-          .Test(xnn_f32_gemm_minmax_ukernel_6x8__neon_lane_ld128, xnn_init_f32_minmax_scalar_params);
+          .Test(xnn_f32_gemm_minmax_ukernel_6x8__neon_dup_ld64, xnn_init_f32_minmax_scalar_params);
       }
     }
   }
 
-  TEST(F32_GEMM_MINMAX_6X8__NEON_LANE_LD128, n_gt_8_strided_a) {
+  TEST(F32_GEMM_MINMAX_6X8__NEON_DUP_LD64, n_gt_8_strided_a) {
     TEST_REQUIRES_ARM_NEON;
     for (uint32_t n = 9; n < 16; n++) {
-      for (size_t k = 1; k <= 20; k += 5) {
+      for (size_t k = 1; k <= 10; k += 3) {
         GemmMicrokernelTester()
           .mr(6)
           .nr(8)
@@ -12666,16 +12666,16 @@
           .m(6)
           .n(n)
           .k(k)
-          .a_stride(23)
-          .Test(xnn_f32_gemm_minmax_ukernel_6x8__neon_lane_ld128, xnn_init_f32_minmax_scalar_params);
+          .a_stride(13)
+          .Test(xnn_f32_gemm_minmax_ukernel_6x8__neon_dup_ld64, xnn_init_f32_minmax_scalar_params);
       }
     }
   }
 
-  TEST(F32_GEMM_MINMAX_6X8__NEON_LANE_LD128, n_gt_8_subtile) {
+  TEST(F32_GEMM_MINMAX_6X8__NEON_DUP_LD64, n_gt_8_subtile) {
     TEST_REQUIRES_ARM_NEON;
     for (uint32_t n = 9; n < 16; n++) {
-      for (size_t k = 1; k <= 20; k += 5) {
+      for (size_t k = 1; k <= 10; k += 3) {
         for (uint32_t m = 1; m <= 6; m++) {
           GemmMicrokernelTester()
             .mr(6)
@@ -12686,16 +12686,16 @@
             .n(n)
             .k(k)
             .iterations(1)
-            .Test(xnn_f32_gemm_minmax_ukernel_6x8__neon_lane_ld128, xnn_init_f32_minmax_scalar_params);
+            .Test(xnn_f32_gemm_minmax_ukernel_6x8__neon_dup_ld64, xnn_init_f32_minmax_scalar_params);
         }
       }
     }
   }
 
-  TEST(F32_GEMM_MINMAX_6X8__NEON_LANE_LD128, n_div_8) {
+  TEST(F32_GEMM_MINMAX_6X8__NEON_DUP_LD64, n_div_8) {
     TEST_REQUIRES_ARM_NEON;
     for (uint32_t n = 16; n <= 24; n += 8) {
-      for (size_t k = 1; k <= 20; k += 5) {
+      for (size_t k = 1; k <= 10; k += 3) {
         GemmMicrokernelTester()
           .mr(6)
           .nr(8)
@@ -12704,15 +12704,15 @@
           .m(6)
           .n(n)
           .k(k)
-          .Test(xnn_f32_gemm_minmax_ukernel_6x8__neon_lane_ld128, xnn_init_f32_minmax_scalar_params);
+          .Test(xnn_f32_gemm_minmax_ukernel_6x8__neon_dup_ld64, xnn_init_f32_minmax_scalar_params);
       }
     }
   }
 
-  TEST(F32_GEMM_MINMAX_6X8__NEON_LANE_LD128, n_div_8_strided_cn) {
+  TEST(F32_GEMM_MINMAX_6X8__NEON_DUP_LD64, n_div_8_strided_cn) {
     TEST_REQUIRES_ARM_NEON;
     for (uint32_t n = 16; n <= 24; n += 8) {
-      for (size_t k = 1; k <= 20; k += 5) {
+      for (size_t k = 1; k <= 10; k += 3) {
         GemmMicrokernelTester()
           .mr(6)
           .nr(8)
@@ -12722,15 +12722,15 @@
           .n(n)
           .k(k)
           .cn_stride(11)
-          .Test(xnn_f32_gemm_minmax_ukernel_6x8__neon_lane_ld128, xnn_init_f32_minmax_scalar_params);
+          .Test(xnn_f32_gemm_minmax_ukernel_6x8__neon_dup_ld64, xnn_init_f32_minmax_scalar_params);
       }
     }
   }
 
-  TEST(F32_GEMM_MINMAX_6X8__NEON_LANE_LD128, n_div_8_strided_a) {
+  TEST(F32_GEMM_MINMAX_6X8__NEON_DUP_LD64, n_div_8_strided_a) {
     TEST_REQUIRES_ARM_NEON;
     for (uint32_t n = 16; n <= 24; n += 8) {
-      for (size_t k = 1; k <= 20; k += 5) {
+      for (size_t k = 1; k <= 10; k += 3) {
         GemmMicrokernelTester()
           .mr(6)
           .nr(8)
@@ -12739,16 +12739,16 @@
           .m(6)
           .n(n)
           .k(k)
-          .a_stride(23)
-          .Test(xnn_f32_gemm_minmax_ukernel_6x8__neon_lane_ld128, xnn_init_f32_minmax_scalar_params);
+          .a_stride(13)
+          .Test(xnn_f32_gemm_minmax_ukernel_6x8__neon_dup_ld64, xnn_init_f32_minmax_scalar_params);
       }
     }
   }
 
-  TEST(F32_GEMM_MINMAX_6X8__NEON_LANE_LD128, n_div_8_subtile) {
+  TEST(F32_GEMM_MINMAX_6X8__NEON_DUP_LD64, n_div_8_subtile) {
     TEST_REQUIRES_ARM_NEON;
     for (uint32_t n = 16; n <= 24; n += 8) {
-      for (size_t k = 1; k <= 20; k += 5) {
+      for (size_t k = 1; k <= 10; k += 3) {
         for (uint32_t m = 1; m <= 6; m++) {
           GemmMicrokernelTester()
             .mr(6)
@@ -12759,15 +12759,15 @@
             .n(n)
             .k(k)
             .iterations(1)
-            .Test(xnn_f32_gemm_minmax_ukernel_6x8__neon_lane_ld128, xnn_init_f32_minmax_scalar_params);
+            .Test(xnn_f32_gemm_minmax_ukernel_6x8__neon_dup_ld64, xnn_init_f32_minmax_scalar_params);
         }
       }
     }
   }
 
-  TEST(F32_GEMM_MINMAX_6X8__NEON_LANE_LD128, strided_cm_subtile) {
+  TEST(F32_GEMM_MINMAX_6X8__NEON_DUP_LD64, strided_cm_subtile) {
     TEST_REQUIRES_ARM_NEON;
-    for (size_t k = 1; k <= 20; k += 5) {
+    for (size_t k = 1; k <= 10; k += 3) {
       for (uint32_t n = 1; n <= 8; n++) {
         for (uint32_t m = 1; m <= 6; m++) {
           GemmMicrokernelTester()
@@ -12780,13 +12780,13 @@
             .k(k)
             .cm_stride(11)
             .iterations(1)
-            .Test(xnn_f32_gemm_minmax_ukernel_6x8__neon_lane_ld128, xnn_init_f32_minmax_scalar_params);
+            .Test(xnn_f32_gemm_minmax_ukernel_6x8__neon_dup_ld64, xnn_init_f32_minmax_scalar_params);
         }
       }
     }
   }
 
-  TEST(F32_GEMM_MINMAX_6X8__NEON_LANE_LD128, qmin) {
+  TEST(F32_GEMM_MINMAX_6X8__NEON_DUP_LD64, qmin) {
     TEST_REQUIRES_ARM_NEON;
     GemmMicrokernelTester()
       .mr(6)
@@ -12795,12 +12795,12 @@
       .sr(1)
       .m(6)
       .n(8)
-      .k(4)
+      .k(2)
       .qmin(128)
-      .Test(xnn_f32_gemm_minmax_ukernel_6x8__neon_lane_ld128, xnn_init_f32_minmax_scalar_params);
+      .Test(xnn_f32_gemm_minmax_ukernel_6x8__neon_dup_ld64, xnn_init_f32_minmax_scalar_params);
   }
 
-  TEST(F32_GEMM_MINMAX_6X8__NEON_LANE_LD128, qmax) {
+  TEST(F32_GEMM_MINMAX_6X8__NEON_DUP_LD64, qmax) {
     TEST_REQUIRES_ARM_NEON;
     GemmMicrokernelTester()
       .mr(6)
@@ -12809,12 +12809,12 @@
       .sr(1)
       .m(6)
       .n(8)
-      .k(4)
+      .k(2)
       .qmax(128)
-      .Test(xnn_f32_gemm_minmax_ukernel_6x8__neon_lane_ld128, xnn_init_f32_minmax_scalar_params);
+      .Test(xnn_f32_gemm_minmax_ukernel_6x8__neon_dup_ld64, xnn_init_f32_minmax_scalar_params);
   }
 
-  TEST(F32_GEMM_MINMAX_6X8__NEON_LANE_LD128, strided_cm) {
+  TEST(F32_GEMM_MINMAX_6X8__NEON_DUP_LD64, strided_cm) {
     TEST_REQUIRES_ARM_NEON;
     GemmMicrokernelTester()
       .mr(6)
@@ -12823,138 +12823,138 @@
       .sr(1)
       .m(6)
       .n(8)
-      .k(4)
+      .k(2)
       .cm_stride(11)
-      .Test(xnn_f32_gemm_minmax_ukernel_6x8__neon_lane_ld128, xnn_init_f32_minmax_scalar_params);
+      .Test(xnn_f32_gemm_minmax_ukernel_6x8__neon_dup_ld64, xnn_init_f32_minmax_scalar_params);
   }
 #endif  // XNN_ARCH_ARM || XNN_ARCH_ARM64
 
 
 #if XNN_ARCH_ARM || XNN_ARCH_ARM64
-  TEST(F32_GEMM_MINMAX_6X8S4__NEONFMA, k_eq_4) {
-    TEST_REQUIRES_ARM_NEON_FMA;
+  TEST(F32_GEMM_MINMAX_6X8__NEON_LANE_LD128, k_eq_4) {
+    TEST_REQUIRES_ARM_NEON;
     GemmMicrokernelTester()
       .mr(6)
       .nr(8)
       .kr(1)
-      .sr(4)
+      .sr(1)
       .m(6)
       .n(8)
       .k(4)
-      .Test(xnn_f32_gemm_minmax_ukernel_6x8s4__neonfma, xnn_init_f32_minmax_scalar_params);
+      .Test(xnn_f32_gemm_minmax_ukernel_6x8__neon_lane_ld128, xnn_init_f32_minmax_scalar_params);
   }
 
-  TEST(F32_GEMM_MINMAX_6X8S4__NEONFMA, strided_cn) {
-    TEST_REQUIRES_ARM_NEON_FMA;
+  TEST(F32_GEMM_MINMAX_6X8__NEON_LANE_LD128, strided_cn) {
+    TEST_REQUIRES_ARM_NEON;
     GemmMicrokernelTester()
       .mr(6)
       .nr(8)
       .kr(1)
-      .sr(4)
+      .sr(1)
       .m(6)
       .n(8)
       .k(4)
       .cn_stride(11)
-      .Test(xnn_f32_gemm_minmax_ukernel_6x8s4__neonfma, xnn_init_f32_minmax_scalar_params);
+      .Test(xnn_f32_gemm_minmax_ukernel_6x8__neon_lane_ld128, xnn_init_f32_minmax_scalar_params);
   }
 
-  TEST(F32_GEMM_MINMAX_6X8S4__NEONFMA, k_eq_4_strided_a) {
-    TEST_REQUIRES_ARM_NEON_FMA;
+  TEST(F32_GEMM_MINMAX_6X8__NEON_LANE_LD128, k_eq_4_strided_a) {
+    TEST_REQUIRES_ARM_NEON;
     GemmMicrokernelTester()
       .mr(6)
       .nr(8)
       .kr(1)
-      .sr(4)
+      .sr(1)
       .m(6)
       .n(8)
       .k(4)
       .a_stride(7)
-      .Test(xnn_f32_gemm_minmax_ukernel_6x8s4__neonfma, xnn_init_f32_minmax_scalar_params);
+      .Test(xnn_f32_gemm_minmax_ukernel_6x8__neon_lane_ld128, xnn_init_f32_minmax_scalar_params);
   }
 
-  TEST(F32_GEMM_MINMAX_6X8S4__NEONFMA, k_eq_4_subtile) {
-    TEST_REQUIRES_ARM_NEON_FMA;
+  TEST(F32_GEMM_MINMAX_6X8__NEON_LANE_LD128, k_eq_4_subtile) {
+    TEST_REQUIRES_ARM_NEON;
     for (uint32_t n = 1; n <= 8; n++) {
       for (uint32_t m = 1; m <= 6; m++) {
         GemmMicrokernelTester()
           .mr(6)
           .nr(8)
           .kr(1)
-          .sr(4)
+          .sr(1)
           .m(m)
           .n(n)
           .k(4)
           .iterations(1)
-          .Test(xnn_f32_gemm_minmax_ukernel_6x8s4__neonfma, xnn_init_f32_minmax_scalar_params);
+          .Test(xnn_f32_gemm_minmax_ukernel_6x8__neon_lane_ld128, xnn_init_f32_minmax_scalar_params);
       }
     }
   }
 
-  TEST(F32_GEMM_MINMAX_6X8S4__NEONFMA, k_eq_4_subtile_m) {
-    TEST_REQUIRES_ARM_NEON_FMA;
+  TEST(F32_GEMM_MINMAX_6X8__NEON_LANE_LD128, k_eq_4_subtile_m) {
+    TEST_REQUIRES_ARM_NEON;
     for (uint32_t m = 1; m <= 6; m++) {
       GemmMicrokernelTester()
         .mr(6)
         .nr(8)
         .kr(1)
-        .sr(4)
+        .sr(1)
         .m(m)
         .n(8)
         .k(4)
         .iterations(1)
-        .Test(xnn_f32_gemm_minmax_ukernel_6x8s4__neonfma, xnn_init_f32_minmax_scalar_params);
+        .Test(xnn_f32_gemm_minmax_ukernel_6x8__neon_lane_ld128, xnn_init_f32_minmax_scalar_params);
     }
   }
 
-  TEST(F32_GEMM_MINMAX_6X8S4__NEONFMA, k_eq_4_subtile_n) {
-    TEST_REQUIRES_ARM_NEON_FMA;
+  TEST(F32_GEMM_MINMAX_6X8__NEON_LANE_LD128, k_eq_4_subtile_n) {
+    TEST_REQUIRES_ARM_NEON;
     for (uint32_t n = 1; n <= 8; n++) {
       GemmMicrokernelTester()
         .mr(6)
         .nr(8)
         .kr(1)
-        .sr(4)
+        .sr(1)
         .m(6)
         .n(n)
         .k(4)
         .iterations(1)
-        .Test(xnn_f32_gemm_minmax_ukernel_6x8s4__neonfma, xnn_init_f32_minmax_scalar_params);
+        .Test(xnn_f32_gemm_minmax_ukernel_6x8__neon_lane_ld128, xnn_init_f32_minmax_scalar_params);
     }
   }
 
-  TEST(F32_GEMM_MINMAX_6X8S4__NEONFMA, k_lt_4) {
-    TEST_REQUIRES_ARM_NEON_FMA;
+  TEST(F32_GEMM_MINMAX_6X8__NEON_LANE_LD128, k_lt_4) {
+    TEST_REQUIRES_ARM_NEON;
     for (size_t k = 1; k < 4; k++) {
       GemmMicrokernelTester()
         .mr(6)
         .nr(8)
         .kr(1)
-        .sr(4)
+        .sr(1)
         .m(6)
         .n(8)
         .k(k)
-        .Test(xnn_f32_gemm_minmax_ukernel_6x8s4__neonfma, xnn_init_f32_minmax_scalar_params);
+        .Test(xnn_f32_gemm_minmax_ukernel_6x8__neon_lane_ld128, xnn_init_f32_minmax_scalar_params);
     }
   }
 
-  TEST(F32_GEMM_MINMAX_6X8S4__NEONFMA, k_lt_4_strided_a) {
-    TEST_REQUIRES_ARM_NEON_FMA;
+  TEST(F32_GEMM_MINMAX_6X8__NEON_LANE_LD128, k_lt_4_strided_a) {
+    TEST_REQUIRES_ARM_NEON;
     for (size_t k = 1; k < 4; k++) {
       GemmMicrokernelTester()
         .mr(6)
         .nr(8)
         .kr(1)
-        .sr(4)
+        .sr(1)
         .m(6)
         .n(8)
         .k(k)
         .a_stride(7)
-        .Test(xnn_f32_gemm_minmax_ukernel_6x8s4__neonfma, xnn_init_f32_minmax_scalar_params);
+        .Test(xnn_f32_gemm_minmax_ukernel_6x8__neon_lane_ld128, xnn_init_f32_minmax_scalar_params);
     }
   }
 
-  TEST(F32_GEMM_MINMAX_6X8S4__NEONFMA, k_lt_4_subtile) {
-    TEST_REQUIRES_ARM_NEON_FMA;
+  TEST(F32_GEMM_MINMAX_6X8__NEON_LANE_LD128, k_lt_4_subtile) {
+    TEST_REQUIRES_ARM_NEON;
     for (size_t k = 1; k < 4; k++) {
       for (uint32_t n = 1; n <= 8; n++) {
         for (uint32_t m = 1; m <= 6; m++) {
@@ -12962,50 +12962,50 @@
             .mr(6)
             .nr(8)
             .kr(1)
-            .sr(4)
+            .sr(1)
             .m(m)
             .n(n)
             .k(k)
             .iterations(1)
-            .Test(xnn_f32_gemm_minmax_ukernel_6x8s4__neonfma, xnn_init_f32_minmax_scalar_params);
+            .Test(xnn_f32_gemm_minmax_ukernel_6x8__neon_lane_ld128, xnn_init_f32_minmax_scalar_params);
         }
       }
     }
   }
 
-  TEST(F32_GEMM_MINMAX_6X8S4__NEONFMA, k_gt_4) {
-    TEST_REQUIRES_ARM_NEON_FMA;
+  TEST(F32_GEMM_MINMAX_6X8__NEON_LANE_LD128, k_gt_4) {
+    TEST_REQUIRES_ARM_NEON;
     for (size_t k = 5; k < 8; k++) {
       GemmMicrokernelTester()
         .mr(6)
         .nr(8)
         .kr(1)
-        .sr(4)
+        .sr(1)
         .m(6)
         .n(8)
         .k(k)
-        .Test(xnn_f32_gemm_minmax_ukernel_6x8s4__neonfma, xnn_init_f32_minmax_scalar_params);
+        .Test(xnn_f32_gemm_minmax_ukernel_6x8__neon_lane_ld128, xnn_init_f32_minmax_scalar_params);
     }
   }
 
-  TEST(F32_GEMM_MINMAX_6X8S4__NEONFMA, k_gt_4_strided_a) {
-    TEST_REQUIRES_ARM_NEON_FMA;
+  TEST(F32_GEMM_MINMAX_6X8__NEON_LANE_LD128, k_gt_4_strided_a) {
+    TEST_REQUIRES_ARM_NEON;
     for (size_t k = 5; k < 8; k++) {
       GemmMicrokernelTester()
         .mr(6)
         .nr(8)
         .kr(1)
-        .sr(4)
+        .sr(1)
         .m(6)
         .n(8)
         .k(k)
         .a_stride(11)
-        .Test(xnn_f32_gemm_minmax_ukernel_6x8s4__neonfma, xnn_init_f32_minmax_scalar_params);
+        .Test(xnn_f32_gemm_minmax_ukernel_6x8__neon_lane_ld128, xnn_init_f32_minmax_scalar_params);
     }
   }
 
-  TEST(F32_GEMM_MINMAX_6X8S4__NEONFMA, k_gt_4_subtile) {
-    TEST_REQUIRES_ARM_NEON_FMA;
+  TEST(F32_GEMM_MINMAX_6X8__NEON_LANE_LD128, k_gt_4_subtile) {
+    TEST_REQUIRES_ARM_NEON;
     for (size_t k = 5; k < 8; k++) {
       for (uint32_t n = 1; n <= 8; n++) {
         for (uint32_t m = 1; m <= 6; m++) {
@@ -13013,50 +13013,50 @@
             .mr(6)
             .nr(8)
             .kr(1)
-            .sr(4)
+            .sr(1)
             .m(m)
             .n(n)
             .k(k)
             .iterations(1)
-            .Test(xnn_f32_gemm_minmax_ukernel_6x8s4__neonfma, xnn_init_f32_minmax_scalar_params);
+            .Test(xnn_f32_gemm_minmax_ukernel_6x8__neon_lane_ld128, xnn_init_f32_minmax_scalar_params);
         }
       }
     }
   }
 
-  TEST(F32_GEMM_MINMAX_6X8S4__NEONFMA, k_div_4) {
-    TEST_REQUIRES_ARM_NEON_FMA;
+  TEST(F32_GEMM_MINMAX_6X8__NEON_LANE_LD128, k_div_4) {
+    TEST_REQUIRES_ARM_NEON;
     for (size_t k = 8; k <= 40; k += 4) {
       GemmMicrokernelTester()
         .mr(6)
         .nr(8)
         .kr(1)
-        .sr(4)
+        .sr(1)
         .m(6)
         .n(8)
         .k(k)
-        .Test(xnn_f32_gemm_minmax_ukernel_6x8s4__neonfma, xnn_init_f32_minmax_scalar_params);
+        .Test(xnn_f32_gemm_minmax_ukernel_6x8__neon_lane_ld128, xnn_init_f32_minmax_scalar_params);
     }
   }
 
-  TEST(F32_GEMM_MINMAX_6X8S4__NEONFMA, k_div_4_strided_a) {
-    TEST_REQUIRES_ARM_NEON_FMA;
+  TEST(F32_GEMM_MINMAX_6X8__NEON_LANE_LD128, k_div_4_strided_a) {
+    TEST_REQUIRES_ARM_NEON;
     for (size_t k = 8; k <= 40; k += 4) {
       GemmMicrokernelTester()
         .mr(6)
         .nr(8)
         .kr(1)
-        .sr(4)
+        .sr(1)
         .m(6)
         .n(8)
         .k(k)
         .a_stride(43)
-        .Test(xnn_f32_gemm_minmax_ukernel_6x8s4__neonfma, xnn_init_f32_minmax_scalar_params);
+        .Test(xnn_f32_gemm_minmax_ukernel_6x8__neon_lane_ld128, xnn_init_f32_minmax_scalar_params);
     }
   }
 
-  TEST(F32_GEMM_MINMAX_6X8S4__NEONFMA, k_div_4_subtile) {
-    TEST_REQUIRES_ARM_NEON_FMA;
+  TEST(F32_GEMM_MINMAX_6X8__NEON_LANE_LD128, k_div_4_subtile) {
+    TEST_REQUIRES_ARM_NEON;
     for (size_t k = 8; k <= 40; k += 4) {
       for (uint32_t n = 1; n <= 8; n++) {
         for (uint32_t m = 1; m <= 6; m++) {
@@ -13064,72 +13064,72 @@
             .mr(6)
             .nr(8)
             .kr(1)
-            .sr(4)
+            .sr(1)
             .m(m)
             .n(n)
             .k(k)
             .iterations(1)
-            .Test(xnn_f32_gemm_minmax_ukernel_6x8s4__neonfma, xnn_init_f32_minmax_scalar_params);
+            .Test(xnn_f32_gemm_minmax_ukernel_6x8__neon_lane_ld128, xnn_init_f32_minmax_scalar_params);
         }
       }
     }
   }
 
-  TEST(F32_GEMM_MINMAX_6X8S4__NEONFMA, n_gt_8) {
-    TEST_REQUIRES_ARM_NEON_FMA;
+  TEST(F32_GEMM_MINMAX_6X8__NEON_LANE_LD128, n_gt_8) {
+    TEST_REQUIRES_ARM_NEON;
     for (uint32_t n = 9; n < 16; n++) {
       for (size_t k = 1; k <= 20; k += 5) {
         GemmMicrokernelTester()
           .mr(6)
           .nr(8)
           .kr(1)
-          .sr(4)
+          .sr(1)
           .m(6)
           .n(n)
           .k(k)
-          .Test(xnn_f32_gemm_minmax_ukernel_6x8s4__neonfma, xnn_init_f32_minmax_scalar_params);
+          .Test(xnn_f32_gemm_minmax_ukernel_6x8__neon_lane_ld128, xnn_init_f32_minmax_scalar_params);
       }
     }
   }
 
-  TEST(F32_GEMM_MINMAX_6X8S4__NEONFMA, n_gt_8_strided_cn) {
-    TEST_REQUIRES_ARM_NEON_FMA;
+  TEST(F32_GEMM_MINMAX_6X8__NEON_LANE_LD128, n_gt_8_strided_cn) {
+    TEST_REQUIRES_ARM_NEON;
     for (uint32_t n = 9; n < 16; n++) {
       for (size_t k = 1; k <= 20; k += 5) {
         GemmMicrokernelTester()
           .mr(6)
           .nr(8)
           .kr(1)
-          .sr(4)
+          .sr(1)
           .m(6)
           .n(n)
           .k(k)
           .cn_stride(11)
-          .Test(xnn_f32_gemm_minmax_ukernel_6x8s4__neonfma, xnn_init_f32_minmax_scalar_params);
+          .Test(xnn_f32_gemm_minmax_ukernel_6x8__neon_lane_ld128, xnn_init_f32_minmax_scalar_params);
       }
     }
   }
 
-  TEST(F32_GEMM_MINMAX_6X8S4__NEONFMA, n_gt_8_strided_a) {
-    TEST_REQUIRES_ARM_NEON_FMA;
+  TEST(F32_GEMM_MINMAX_6X8__NEON_LANE_LD128, n_gt_8_strided_a) {
+    TEST_REQUIRES_ARM_NEON;
     for (uint32_t n = 9; n < 16; n++) {
       for (size_t k = 1; k <= 20; k += 5) {
         GemmMicrokernelTester()
           .mr(6)
           .nr(8)
           .kr(1)
-          .sr(4)
+          .sr(1)
           .m(6)
           .n(n)
           .k(k)
           .a_stride(23)
-          .Test(xnn_f32_gemm_minmax_ukernel_6x8s4__neonfma, xnn_init_f32_minmax_scalar_params);
+          .Test(xnn_f32_gemm_minmax_ukernel_6x8__neon_lane_ld128, xnn_init_f32_minmax_scalar_params);
       }
     }
   }
 
-  TEST(F32_GEMM_MINMAX_6X8S4__NEONFMA, n_gt_8_subtile) {
-    TEST_REQUIRES_ARM_NEON_FMA;
+  TEST(F32_GEMM_MINMAX_6X8__NEON_LANE_LD128, n_gt_8_subtile) {
+    TEST_REQUIRES_ARM_NEON;
     for (uint32_t n = 9; n < 16; n++) {
       for (size_t k = 1; k <= 20; k += 5) {
         for (uint32_t m = 1; m <= 6; m++) {
@@ -13137,72 +13137,72 @@
             .mr(6)
             .nr(8)
             .kr(1)
-            .sr(4)
+            .sr(1)
             .m(m)
             .n(n)
             .k(k)
             .iterations(1)
-            .Test(xnn_f32_gemm_minmax_ukernel_6x8s4__neonfma, xnn_init_f32_minmax_scalar_params);
+            .Test(xnn_f32_gemm_minmax_ukernel_6x8__neon_lane_ld128, xnn_init_f32_minmax_scalar_params);
         }
       }
     }
   }
 
-  TEST(F32_GEMM_MINMAX_6X8S4__NEONFMA, n_div_8) {
-    TEST_REQUIRES_ARM_NEON_FMA;
+  TEST(F32_GEMM_MINMAX_6X8__NEON_LANE_LD128, n_div_8) {
+    TEST_REQUIRES_ARM_NEON;
     for (uint32_t n = 16; n <= 24; n += 8) {
       for (size_t k = 1; k <= 20; k += 5) {
         GemmMicrokernelTester()
           .mr(6)
           .nr(8)
           .kr(1)
-          .sr(4)
+          .sr(1)
           .m(6)
           .n(n)
           .k(k)
-          .Test(xnn_f32_gemm_minmax_ukernel_6x8s4__neonfma, xnn_init_f32_minmax_scalar_params);
+          .Test(xnn_f32_gemm_minmax_ukernel_6x8__neon_lane_ld128, xnn_init_f32_minmax_scalar_params);
       }
     }
   }
 
-  TEST(F32_GEMM_MINMAX_6X8S4__NEONFMA, n_div_8_strided_cn) {
-    TEST_REQUIRES_ARM_NEON_FMA;
+  TEST(F32_GEMM_MINMAX_6X8__NEON_LANE_LD128, n_div_8_strided_cn) {
+    TEST_REQUIRES_ARM_NEON;
     for (uint32_t n = 16; n <= 24; n += 8) {
       for (size_t k = 1; k <= 20; k += 5) {
         GemmMicrokernelTester()
           .mr(6)
           .nr(8)
           .kr(1)
-          .sr(4)
+          .sr(1)
           .m(6)
           .n(n)
           .k(k)
           .cn_stride(11)
-          .Test(xnn_f32_gemm_minmax_ukernel_6x8s4__neonfma, xnn_init_f32_minmax_scalar_params);
+          .Test(xnn_f32_gemm_minmax_ukernel_6x8__neon_lane_ld128, xnn_init_f32_minmax_scalar_params);
       }
     }
   }
 
-  TEST(F32_GEMM_MINMAX_6X8S4__NEONFMA, n_div_8_strided_a) {
-    TEST_REQUIRES_ARM_NEON_FMA;
+  TEST(F32_GEMM_MINMAX_6X8__NEON_LANE_LD128, n_div_8_strided_a) {
+    TEST_REQUIRES_ARM_NEON;
     for (uint32_t n = 16; n <= 24; n += 8) {
       for (size_t k = 1; k <= 20; k += 5) {
         GemmMicrokernelTester()
           .mr(6)
           .nr(8)
           .kr(1)
-          .sr(4)
+          .sr(1)
           .m(6)
           .n(n)
           .k(k)
           .a_stride(23)
-          .Test(xnn_f32_gemm_minmax_ukernel_6x8s4__neonfma, xnn_init_f32_minmax_scalar_params);
+          .Test(xnn_f32_gemm_minmax_ukernel_6x8__neon_lane_ld128, xnn_init_f32_minmax_scalar_params);
       }
     }
   }
 
-  TEST(F32_GEMM_MINMAX_6X8S4__NEONFMA, n_div_8_subtile) {
-    TEST_REQUIRES_ARM_NEON_FMA;
+  TEST(F32_GEMM_MINMAX_6X8__NEON_LANE_LD128, n_div_8_subtile) {
+    TEST_REQUIRES_ARM_NEON;
     for (uint32_t n = 16; n <= 24; n += 8) {
       for (size_t k = 1; k <= 20; k += 5) {
         for (uint32_t m = 1; m <= 6; m++) {
@@ -13210,19 +13210,19 @@
             .mr(6)
             .nr(8)
             .kr(1)
-            .sr(4)
+            .sr(1)
             .m(m)
             .n(n)
             .k(k)
             .iterations(1)
-            .Test(xnn_f32_gemm_minmax_ukernel_6x8s4__neonfma, xnn_init_f32_minmax_scalar_params);
+            .Test(xnn_f32_gemm_minmax_ukernel_6x8__neon_lane_ld128, xnn_init_f32_minmax_scalar_params);
         }
       }
     }
   }
 
-  TEST(F32_GEMM_MINMAX_6X8S4__NEONFMA, strided_cm_subtile) {
-    TEST_REQUIRES_ARM_NEON_FMA;
+  TEST(F32_GEMM_MINMAX_6X8__NEON_LANE_LD128, strided_cm_subtile) {
+    TEST_REQUIRES_ARM_NEON;
     for (size_t k = 1; k <= 20; k += 5) {
       for (uint32_t n = 1; n <= 8; n++) {
         for (uint32_t m = 1; m <= 6; m++) {
@@ -13230,110 +13230,110 @@
             .mr(6)
             .nr(8)
             .kr(1)
-            .sr(4)
+            .sr(1)
             .m(m)
             .n(n)
             .k(k)
             .cm_stride(11)
             .iterations(1)
-            .Test(xnn_f32_gemm_minmax_ukernel_6x8s4__neonfma, xnn_init_f32_minmax_scalar_params);
+            .Test(xnn_f32_gemm_minmax_ukernel_6x8__neon_lane_ld128, xnn_init_f32_minmax_scalar_params);
         }
       }
     }
   }
 
-  TEST(F32_GEMM_MINMAX_6X8S4__NEONFMA, qmin) {
-    TEST_REQUIRES_ARM_NEON_FMA;
+  TEST(F32_GEMM_MINMAX_6X8__NEON_LANE_LD128, qmin) {
+    TEST_REQUIRES_ARM_NEON;
     GemmMicrokernelTester()
       .mr(6)
       .nr(8)
       .kr(1)
-      .sr(4)
+      .sr(1)
       .m(6)
       .n(8)
       .k(4)
       .qmin(128)
-      .Test(xnn_f32_gemm_minmax_ukernel_6x8s4__neonfma, xnn_init_f32_minmax_scalar_params);
+      .Test(xnn_f32_gemm_minmax_ukernel_6x8__neon_lane_ld128, xnn_init_f32_minmax_scalar_params);
   }
 
-  TEST(F32_GEMM_MINMAX_6X8S4__NEONFMA, qmax) {
-    TEST_REQUIRES_ARM_NEON_FMA;
+  TEST(F32_GEMM_MINMAX_6X8__NEON_LANE_LD128, qmax) {
+    TEST_REQUIRES_ARM_NEON;
     GemmMicrokernelTester()
       .mr(6)
       .nr(8)
       .kr(1)
-      .sr(4)
+      .sr(1)
       .m(6)
       .n(8)
       .k(4)
       .qmax(128)
-      .Test(xnn_f32_gemm_minmax_ukernel_6x8s4__neonfma, xnn_init_f32_minmax_scalar_params);
+      .Test(xnn_f32_gemm_minmax_ukernel_6x8__neon_lane_ld128, xnn_init_f32_minmax_scalar_params);
   }
 
-  TEST(F32_GEMM_MINMAX_6X8S4__NEONFMA, strided_cm) {
-    TEST_REQUIRES_ARM_NEON_FMA;
+  TEST(F32_GEMM_MINMAX_6X8__NEON_LANE_LD128, strided_cm) {
+    TEST_REQUIRES_ARM_NEON;
     GemmMicrokernelTester()
       .mr(6)
       .nr(8)
       .kr(1)
-      .sr(4)
+      .sr(1)
       .m(6)
       .n(8)
       .k(4)
       .cm_stride(11)
-      .Test(xnn_f32_gemm_minmax_ukernel_6x8s4__neonfma, xnn_init_f32_minmax_scalar_params);
+      .Test(xnn_f32_gemm_minmax_ukernel_6x8__neon_lane_ld128, xnn_init_f32_minmax_scalar_params);
   }
 #endif  // XNN_ARCH_ARM || XNN_ARCH_ARM64
 
 
 #if XNN_ARCH_ARM || XNN_ARCH_ARM64
-  TEST(F32_GEMM_MINMAX_8X8S4__NEONFMA, k_eq_4) {
+  TEST(F32_GEMM_MINMAX_6X8S4__NEONFMA, k_eq_4) {
     TEST_REQUIRES_ARM_NEON_FMA;
     GemmMicrokernelTester()
-      .mr(8)
+      .mr(6)
       .nr(8)
       .kr(1)
       .sr(4)
-      .m(8)
+      .m(6)
       .n(8)
       .k(4)
-      .Test(xnn_f32_gemm_minmax_ukernel_8x8s4__neonfma, xnn_init_f32_minmax_scalar_params);
+      .Test(xnn_f32_gemm_minmax_ukernel_6x8s4__neonfma, xnn_init_f32_minmax_scalar_params);
   }
 
-  TEST(F32_GEMM_MINMAX_8X8S4__NEONFMA, strided_cn) {
+  TEST(F32_GEMM_MINMAX_6X8S4__NEONFMA, strided_cn) {
     TEST_REQUIRES_ARM_NEON_FMA;
     GemmMicrokernelTester()
-      .mr(8)
+      .mr(6)
       .nr(8)
       .kr(1)
       .sr(4)
-      .m(8)
+      .m(6)
       .n(8)
       .k(4)
       .cn_stride(11)
-      .Test(xnn_f32_gemm_minmax_ukernel_8x8s4__neonfma, xnn_init_f32_minmax_scalar_params);
+      .Test(xnn_f32_gemm_minmax_ukernel_6x8s4__neonfma, xnn_init_f32_minmax_scalar_params);
   }
 
-  TEST(F32_GEMM_MINMAX_8X8S4__NEONFMA, k_eq_4_strided_a) {
+  TEST(F32_GEMM_MINMAX_6X8S4__NEONFMA, k_eq_4_strided_a) {
     TEST_REQUIRES_ARM_NEON_FMA;
     GemmMicrokernelTester()
-      .mr(8)
+      .mr(6)
       .nr(8)
       .kr(1)
       .sr(4)
-      .m(8)
+      .m(6)
       .n(8)
       .k(4)
       .a_stride(7)
-      .Test(xnn_f32_gemm_minmax_ukernel_8x8s4__neonfma, xnn_init_f32_minmax_scalar_params);
+      .Test(xnn_f32_gemm_minmax_ukernel_6x8s4__neonfma, xnn_init_f32_minmax_scalar_params);
   }
 
-  TEST(F32_GEMM_MINMAX_8X8S4__NEONFMA, k_eq_4_subtile) {
+  TEST(F32_GEMM_MINMAX_6X8S4__NEONFMA, k_eq_4_subtile) {
     TEST_REQUIRES_ARM_NEON_FMA;
     for (uint32_t n = 1; n <= 8; n++) {
-      for (uint32_t m = 1; m <= 8; m++) {
+      for (uint32_t m = 1; m <= 6; m++) {
         GemmMicrokernelTester()
-          .mr(8)
+          .mr(6)
           .nr(8)
           .kr(1)
           .sr(4)
@@ -13341,16 +13341,16 @@
           .n(n)
           .k(4)
           .iterations(1)
-          .Test(xnn_f32_gemm_minmax_ukernel_8x8s4__neonfma, xnn_init_f32_minmax_scalar_params);
+          .Test(xnn_f32_gemm_minmax_ukernel_6x8s4__neonfma, xnn_init_f32_minmax_scalar_params);
       }
     }
   }
 
-  TEST(F32_GEMM_MINMAX_8X8S4__NEONFMA, k_eq_4_subtile_m) {
+  TEST(F32_GEMM_MINMAX_6X8S4__NEONFMA, k_eq_4_subtile_m) {
     TEST_REQUIRES_ARM_NEON_FMA;
-    for (uint32_t m = 1; m <= 8; m++) {
+    for (uint32_t m = 1; m <= 6; m++) {
       GemmMicrokernelTester()
-        .mr(8)
+        .mr(6)
         .nr(8)
         .kr(1)
         .sr(4)
@@ -13358,64 +13358,64 @@
         .n(8)
         .k(4)
         .iterations(1)
-        .Test(xnn_f32_gemm_minmax_ukernel_8x8s4__neonfma, xnn_init_f32_minmax_scalar_params);
+        .Test(xnn_f32_gemm_minmax_ukernel_6x8s4__neonfma, xnn_init_f32_minmax_scalar_params);
     }
   }
 
-  TEST(F32_GEMM_MINMAX_8X8S4__NEONFMA, k_eq_4_subtile_n) {
+  TEST(F32_GEMM_MINMAX_6X8S4__NEONFMA, k_eq_4_subtile_n) {
     TEST_REQUIRES_ARM_NEON_FMA;
     for (uint32_t n = 1; n <= 8; n++) {
       GemmMicrokernelTester()
-        .mr(8)
+        .mr(6)
         .nr(8)
         .kr(1)
         .sr(4)
-        .m(8)
+        .m(6)
         .n(n)
         .k(4)
         .iterations(1)
-        .Test(xnn_f32_gemm_minmax_ukernel_8x8s4__neonfma, xnn_init_f32_minmax_scalar_params);
+        .Test(xnn_f32_gemm_minmax_ukernel_6x8s4__neonfma, xnn_init_f32_minmax_scalar_params);
     }
   }
 
-  TEST(F32_GEMM_MINMAX_8X8S4__NEONFMA, k_lt_4) {
+  TEST(F32_GEMM_MINMAX_6X8S4__NEONFMA, k_lt_4) {
     TEST_REQUIRES_ARM_NEON_FMA;
     for (size_t k = 1; k < 4; k++) {
       GemmMicrokernelTester()
-        .mr(8)
+        .mr(6)
         .nr(8)
         .kr(1)
         .sr(4)
-        .m(8)
+        .m(6)
         .n(8)
         .k(k)
-        .Test(xnn_f32_gemm_minmax_ukernel_8x8s4__neonfma, xnn_init_f32_minmax_scalar_params);
+        .Test(xnn_f32_gemm_minmax_ukernel_6x8s4__neonfma, xnn_init_f32_minmax_scalar_params);
     }
   }
 
-  TEST(F32_GEMM_MINMAX_8X8S4__NEONFMA, k_lt_4_strided_a) {
+  TEST(F32_GEMM_MINMAX_6X8S4__NEONFMA, k_lt_4_strided_a) {
     TEST_REQUIRES_ARM_NEON_FMA;
     for (size_t k = 1; k < 4; k++) {
       GemmMicrokernelTester()
-        .mr(8)
+        .mr(6)
         .nr(8)
         .kr(1)
         .sr(4)
-        .m(8)
+        .m(6)
         .n(8)
         .k(k)
         .a_stride(7)
-        .Test(xnn_f32_gemm_minmax_ukernel_8x8s4__neonfma, xnn_init_f32_minmax_scalar_params);
+        .Test(xnn_f32_gemm_minmax_ukernel_6x8s4__neonfma, xnn_init_f32_minmax_scalar_params);
     }
   }
 
-  TEST(F32_GEMM_MINMAX_8X8S4__NEONFMA, k_lt_4_subtile) {
+  TEST(F32_GEMM_MINMAX_6X8S4__NEONFMA, k_lt_4_subtile) {
     TEST_REQUIRES_ARM_NEON_FMA;
     for (size_t k = 1; k < 4; k++) {
       for (uint32_t n = 1; n <= 8; n++) {
-        for (uint32_t m = 1; m <= 8; m++) {
+        for (uint32_t m = 1; m <= 6; m++) {
           GemmMicrokernelTester()
-            .mr(8)
+            .mr(6)
             .nr(8)
             .kr(1)
             .sr(4)
@@ -13423,50 +13423,50 @@
             .n(n)
             .k(k)
             .iterations(1)
-            .Test(xnn_f32_gemm_minmax_ukernel_8x8s4__neonfma, xnn_init_f32_minmax_scalar_params);
+            .Test(xnn_f32_gemm_minmax_ukernel_6x8s4__neonfma, xnn_init_f32_minmax_scalar_params);
         }
       }
     }
   }
 
-  TEST(F32_GEMM_MINMAX_8X8S4__NEONFMA, k_gt_4) {
+  TEST(F32_GEMM_MINMAX_6X8S4__NEONFMA, k_gt_4) {
     TEST_REQUIRES_ARM_NEON_FMA;
     for (size_t k = 5; k < 8; k++) {
       GemmMicrokernelTester()
-        .mr(8)
+        .mr(6)
         .nr(8)
         .kr(1)
         .sr(4)
-        .m(8)
+        .m(6)
         .n(8)
         .k(k)
-        .Test(xnn_f32_gemm_minmax_ukernel_8x8s4__neonfma, xnn_init_f32_minmax_scalar_params);
+        .Test(xnn_f32_gemm_minmax_ukernel_6x8s4__neonfma, xnn_init_f32_minmax_scalar_params);
     }
   }
 
-  TEST(F32_GEMM_MINMAX_8X8S4__NEONFMA, k_gt_4_strided_a) {
+  TEST(F32_GEMM_MINMAX_6X8S4__NEONFMA, k_gt_4_strided_a) {
     TEST_REQUIRES_ARM_NEON_FMA;
     for (size_t k = 5; k < 8; k++) {
       GemmMicrokernelTester()
-        .mr(8)
+        .mr(6)
         .nr(8)
         .kr(1)
         .sr(4)
-        .m(8)
+        .m(6)
         .n(8)
         .k(k)
         .a_stride(11)
-        .Test(xnn_f32_gemm_minmax_ukernel_8x8s4__neonfma, xnn_init_f32_minmax_scalar_params);
+        .Test(xnn_f32_gemm_minmax_ukernel_6x8s4__neonfma, xnn_init_f32_minmax_scalar_params);
     }
   }
 
-  TEST(F32_GEMM_MINMAX_8X8S4__NEONFMA, k_gt_4_subtile) {
+  TEST(F32_GEMM_MINMAX_6X8S4__NEONFMA, k_gt_4_subtile) {
     TEST_REQUIRES_ARM_NEON_FMA;
     for (size_t k = 5; k < 8; k++) {
       for (uint32_t n = 1; n <= 8; n++) {
-        for (uint32_t m = 1; m <= 8; m++) {
+        for (uint32_t m = 1; m <= 6; m++) {
           GemmMicrokernelTester()
-            .mr(8)
+            .mr(6)
             .nr(8)
             .kr(1)
             .sr(4)
@@ -13474,50 +13474,50 @@
             .n(n)
             .k(k)
             .iterations(1)
-            .Test(xnn_f32_gemm_minmax_ukernel_8x8s4__neonfma, xnn_init_f32_minmax_scalar_params);
+            .Test(xnn_f32_gemm_minmax_ukernel_6x8s4__neonfma, xnn_init_f32_minmax_scalar_params);
         }
       }
     }
   }
 
-  TEST(F32_GEMM_MINMAX_8X8S4__NEONFMA, k_div_4) {
+  TEST(F32_GEMM_MINMAX_6X8S4__NEONFMA, k_div_4) {
     TEST_REQUIRES_ARM_NEON_FMA;
     for (size_t k = 8; k <= 40; k += 4) {
       GemmMicrokernelTester()
-        .mr(8)
+        .mr(6)
         .nr(8)
         .kr(1)
         .sr(4)
-        .m(8)
+        .m(6)
         .n(8)
         .k(k)
-        .Test(xnn_f32_gemm_minmax_ukernel_8x8s4__neonfma, xnn_init_f32_minmax_scalar_params);
+        .Test(xnn_f32_gemm_minmax_ukernel_6x8s4__neonfma, xnn_init_f32_minmax_scalar_params);
     }
   }
 
-  TEST(F32_GEMM_MINMAX_8X8S4__NEONFMA, k_div_4_strided_a) {
+  TEST(F32_GEMM_MINMAX_6X8S4__NEONFMA, k_div_4_strided_a) {
     TEST_REQUIRES_ARM_NEON_FMA;
     for (size_t k = 8; k <= 40; k += 4) {
       GemmMicrokernelTester()
-        .mr(8)
+        .mr(6)
         .nr(8)
         .kr(1)
         .sr(4)
-        .m(8)
+        .m(6)
         .n(8)
         .k(k)
         .a_stride(43)
-        .Test(xnn_f32_gemm_minmax_ukernel_8x8s4__neonfma, xnn_init_f32_minmax_scalar_params);
+        .Test(xnn_f32_gemm_minmax_ukernel_6x8s4__neonfma, xnn_init_f32_minmax_scalar_params);
     }
   }
 
-  TEST(F32_GEMM_MINMAX_8X8S4__NEONFMA, k_div_4_subtile) {
+  TEST(F32_GEMM_MINMAX_6X8S4__NEONFMA, k_div_4_subtile) {
     TEST_REQUIRES_ARM_NEON_FMA;
     for (size_t k = 8; k <= 40; k += 4) {
       for (uint32_t n = 1; n <= 8; n++) {
-        for (uint32_t m = 1; m <= 8; m++) {
+        for (uint32_t m = 1; m <= 6; m++) {
           GemmMicrokernelTester()
-            .mr(8)
+            .mr(6)
             .nr(8)
             .kr(1)
             .sr(4)
@@ -13525,72 +13525,72 @@
             .n(n)
             .k(k)
             .iterations(1)
-            .Test(xnn_f32_gemm_minmax_ukernel_8x8s4__neonfma, xnn_init_f32_minmax_scalar_params);
+            .Test(xnn_f32_gemm_minmax_ukernel_6x8s4__neonfma, xnn_init_f32_minmax_scalar_params);
         }
       }
     }
   }
 
-  TEST(F32_GEMM_MINMAX_8X8S4__NEONFMA, n_gt_8) {
+  TEST(F32_GEMM_MINMAX_6X8S4__NEONFMA, n_gt_8) {
     TEST_REQUIRES_ARM_NEON_FMA;
     for (uint32_t n = 9; n < 16; n++) {
       for (size_t k = 1; k <= 20; k += 5) {
         GemmMicrokernelTester()
-          .mr(8)
+          .mr(6)
           .nr(8)
           .kr(1)
           .sr(4)
-          .m(8)
+          .m(6)
           .n(n)
           .k(k)
-          .Test(xnn_f32_gemm_minmax_ukernel_8x8s4__neonfma, xnn_init_f32_minmax_scalar_params);
+          .Test(xnn_f32_gemm_minmax_ukernel_6x8s4__neonfma, xnn_init_f32_minmax_scalar_params);
       }
     }
   }
 
-  TEST(F32_GEMM_MINMAX_8X8S4__NEONFMA, n_gt_8_strided_cn) {
+  TEST(F32_GEMM_MINMAX_6X8S4__NEONFMA, n_gt_8_strided_cn) {
     TEST_REQUIRES_ARM_NEON_FMA;
     for (uint32_t n = 9; n < 16; n++) {
       for (size_t k = 1; k <= 20; k += 5) {
         GemmMicrokernelTester()
-          .mr(8)
+          .mr(6)
           .nr(8)
           .kr(1)
           .sr(4)
-          .m(8)
+          .m(6)
           .n(n)
           .k(k)
           .cn_stride(11)
-          .Test(xnn_f32_gemm_minmax_ukernel_8x8s4__neonfma, xnn_init_f32_minmax_scalar_params);
+          .Test(xnn_f32_gemm_minmax_ukernel_6x8s4__neonfma, xnn_init_f32_minmax_scalar_params);
       }
     }
   }
 
-  TEST(F32_GEMM_MINMAX_8X8S4__NEONFMA, n_gt_8_strided_a) {
+  TEST(F32_GEMM_MINMAX_6X8S4__NEONFMA, n_gt_8_strided_a) {
     TEST_REQUIRES_ARM_NEON_FMA;
     for (uint32_t n = 9; n < 16; n++) {
       for (size_t k = 1; k <= 20; k += 5) {
         GemmMicrokernelTester()
-          .mr(8)
+          .mr(6)
           .nr(8)
           .kr(1)
           .sr(4)
-          .m(8)
+          .m(6)
           .n(n)
           .k(k)
           .a_stride(23)
-          .Test(xnn_f32_gemm_minmax_ukernel_8x8s4__neonfma, xnn_init_f32_minmax_scalar_params);
+          .Test(xnn_f32_gemm_minmax_ukernel_6x8s4__neonfma, xnn_init_f32_minmax_scalar_params);
       }
     }
   }
 
-  TEST(F32_GEMM_MINMAX_8X8S4__NEONFMA, n_gt_8_subtile) {
+  TEST(F32_GEMM_MINMAX_6X8S4__NEONFMA, n_gt_8_subtile) {
     TEST_REQUIRES_ARM_NEON_FMA;
     for (uint32_t n = 9; n < 16; n++) {
       for (size_t k = 1; k <= 20; k += 5) {
-        for (uint32_t m = 1; m <= 8; m++) {
+        for (uint32_t m = 1; m <= 6; m++) {
           GemmMicrokernelTester()
-            .mr(8)
+            .mr(6)
             .nr(8)
             .kr(1)
             .sr(4)
@@ -13598,72 +13598,72 @@
             .n(n)
             .k(k)
             .iterations(1)
-            .Test(xnn_f32_gemm_minmax_ukernel_8x8s4__neonfma, xnn_init_f32_minmax_scalar_params);
+            .Test(xnn_f32_gemm_minmax_ukernel_6x8s4__neonfma, xnn_init_f32_minmax_scalar_params);
         }
       }
     }
   }
 
-  TEST(F32_GEMM_MINMAX_8X8S4__NEONFMA, n_div_8) {
+  TEST(F32_GEMM_MINMAX_6X8S4__NEONFMA, n_div_8) {
     TEST_REQUIRES_ARM_NEON_FMA;
     for (uint32_t n = 16; n <= 24; n += 8) {
       for (size_t k = 1; k <= 20; k += 5) {
         GemmMicrokernelTester()
-          .mr(8)
+          .mr(6)
           .nr(8)
           .kr(1)
           .sr(4)
-          .m(8)
+          .m(6)
           .n(n)
           .k(k)
-          .Test(xnn_f32_gemm_minmax_ukernel_8x8s4__neonfma, xnn_init_f32_minmax_scalar_params);
+          .Test(xnn_f32_gemm_minmax_ukernel_6x8s4__neonfma, xnn_init_f32_minmax_scalar_params);
       }
     }
   }
 
-  TEST(F32_GEMM_MINMAX_8X8S4__NEONFMA, n_div_8_strided_cn) {
+  TEST(F32_GEMM_MINMAX_6X8S4__NEONFMA, n_div_8_strided_cn) {
     TEST_REQUIRES_ARM_NEON_FMA;
     for (uint32_t n = 16; n <= 24; n += 8) {
       for (size_t k = 1; k <= 20; k += 5) {
         GemmMicrokernelTester()
-          .mr(8)
+          .mr(6)
           .nr(8)
           .kr(1)
           .sr(4)
-          .m(8)
+          .m(6)
           .n(n)
           .k(k)
           .cn_stride(11)
-          .Test(xnn_f32_gemm_minmax_ukernel_8x8s4__neonfma, xnn_init_f32_minmax_scalar_params);
+          .Test(xnn_f32_gemm_minmax_ukernel_6x8s4__neonfma, xnn_init_f32_minmax_scalar_params);
       }
     }
   }
 
-  TEST(F32_GEMM_MINMAX_8X8S4__NEONFMA, n_div_8_strided_a) {
+  TEST(F32_GEMM_MINMAX_6X8S4__NEONFMA, n_div_8_strided_a) {
     TEST_REQUIRES_ARM_NEON_FMA;
     for (uint32_t n = 16; n <= 24; n += 8) {
       for (size_t k = 1; k <= 20; k += 5) {
         GemmMicrokernelTester()
-          .mr(8)
+          .mr(6)
           .nr(8)
           .kr(1)
           .sr(4)
-          .m(8)
+          .m(6)
           .n(n)
           .k(k)
           .a_stride(23)
-          .Test(xnn_f32_gemm_minmax_ukernel_8x8s4__neonfma, xnn_init_f32_minmax_scalar_params);
+          .Test(xnn_f32_gemm_minmax_ukernel_6x8s4__neonfma, xnn_init_f32_minmax_scalar_params);
       }
     }
   }
 
-  TEST(F32_GEMM_MINMAX_8X8S4__NEONFMA, n_div_8_subtile) {
+  TEST(F32_GEMM_MINMAX_6X8S4__NEONFMA, n_div_8_subtile) {
     TEST_REQUIRES_ARM_NEON_FMA;
     for (uint32_t n = 16; n <= 24; n += 8) {
       for (size_t k = 1; k <= 20; k += 5) {
-        for (uint32_t m = 1; m <= 8; m++) {
+        for (uint32_t m = 1; m <= 6; m++) {
           GemmMicrokernelTester()
-            .mr(8)
+            .mr(6)
             .nr(8)
             .kr(1)
             .sr(4)
@@ -13671,19 +13671,19 @@
             .n(n)
             .k(k)
             .iterations(1)
-            .Test(xnn_f32_gemm_minmax_ukernel_8x8s4__neonfma, xnn_init_f32_minmax_scalar_params);
+            .Test(xnn_f32_gemm_minmax_ukernel_6x8s4__neonfma, xnn_init_f32_minmax_scalar_params);
         }
       }
     }
   }
 
-  TEST(F32_GEMM_MINMAX_8X8S4__NEONFMA, strided_cm_subtile) {
+  TEST(F32_GEMM_MINMAX_6X8S4__NEONFMA, strided_cm_subtile) {
     TEST_REQUIRES_ARM_NEON_FMA;
     for (size_t k = 1; k <= 20; k += 5) {
       for (uint32_t n = 1; n <= 8; n++) {
-        for (uint32_t m = 1; m <= 8; m++) {
+        for (uint32_t m = 1; m <= 6; m++) {
           GemmMicrokernelTester()
-            .mr(8)
+            .mr(6)
             .nr(8)
             .kr(1)
             .sr(4)
@@ -13692,560 +13692,560 @@
             .k(k)
             .cm_stride(11)
             .iterations(1)
-            .Test(xnn_f32_gemm_minmax_ukernel_8x8s4__neonfma, xnn_init_f32_minmax_scalar_params);
+            .Test(xnn_f32_gemm_minmax_ukernel_6x8s4__neonfma, xnn_init_f32_minmax_scalar_params);
         }
       }
     }
   }
 
-  TEST(F32_GEMM_MINMAX_8X8S4__NEONFMA, qmin) {
+  TEST(F32_GEMM_MINMAX_6X8S4__NEONFMA, qmin) {
     TEST_REQUIRES_ARM_NEON_FMA;
     GemmMicrokernelTester()
-      .mr(8)
+      .mr(6)
       .nr(8)
       .kr(1)
       .sr(4)
-      .m(8)
+      .m(6)
       .n(8)
       .k(4)
       .qmin(128)
-      .Test(xnn_f32_gemm_minmax_ukernel_8x8s4__neonfma, xnn_init_f32_minmax_scalar_params);
+      .Test(xnn_f32_gemm_minmax_ukernel_6x8s4__neonfma, xnn_init_f32_minmax_scalar_params);
   }
 
-  TEST(F32_GEMM_MINMAX_8X8S4__NEONFMA, qmax) {
+  TEST(F32_GEMM_MINMAX_6X8S4__NEONFMA, qmax) {
     TEST_REQUIRES_ARM_NEON_FMA;
     GemmMicrokernelTester()
-      .mr(8)
+      .mr(6)
       .nr(8)
       .kr(1)
       .sr(4)
-      .m(8)
+      .m(6)
       .n(8)
       .k(4)
       .qmax(128)
-      .Test(xnn_f32_gemm_minmax_ukernel_8x8s4__neonfma, xnn_init_f32_minmax_scalar_params);
+      .Test(xnn_f32_gemm_minmax_ukernel_6x8s4__neonfma, xnn_init_f32_minmax_scalar_params);
   }
 
-  TEST(F32_GEMM_MINMAX_8X8S4__NEONFMA, strided_cm) {
+  TEST(F32_GEMM_MINMAX_6X8S4__NEONFMA, strided_cm) {
     TEST_REQUIRES_ARM_NEON_FMA;
     GemmMicrokernelTester()
-      .mr(8)
+      .mr(6)
       .nr(8)
       .kr(1)
       .sr(4)
-      .m(8)
+      .m(6)
       .n(8)
       .k(4)
       .cm_stride(11)
-      .Test(xnn_f32_gemm_minmax_ukernel_8x8s4__neonfma, xnn_init_f32_minmax_scalar_params);
+      .Test(xnn_f32_gemm_minmax_ukernel_6x8s4__neonfma, xnn_init_f32_minmax_scalar_params);
   }
 #endif  // XNN_ARCH_ARM || XNN_ARCH_ARM64
 
 
-#if XNN_ARCH_X86 || XNN_ARCH_X86_64
-  TEST(F32_GEMM_MINMAX_1X8__SSE2_DUP, k_eq_4) {
-    TEST_REQUIRES_X86_SSE2;
+#if XNN_ARCH_ARM || XNN_ARCH_ARM64
+  TEST(F32_GEMM_MINMAX_8X8S4__NEONFMA, k_eq_4) {
+    TEST_REQUIRES_ARM_NEON_FMA;
     GemmMicrokernelTester()
-      .mr(1)
+      .mr(8)
       .nr(8)
       .kr(1)
-      .sr(1)
-      .m(1)
+      .sr(4)
+      .m(8)
       .n(8)
       .k(4)
-      .Test(xnn_f32_gemm_minmax_ukernel_1x8__sse2_dup, xnn_init_f32_minmax_sse_params);
+      .Test(xnn_f32_gemm_minmax_ukernel_8x8s4__neonfma, xnn_init_f32_minmax_scalar_params);
   }
 
-  TEST(F32_GEMM_MINMAX_1X8__SSE2_DUP, strided_cn) {
-    TEST_REQUIRES_X86_SSE2;
+  TEST(F32_GEMM_MINMAX_8X8S4__NEONFMA, strided_cn) {
+    TEST_REQUIRES_ARM_NEON_FMA;
     GemmMicrokernelTester()
-      .mr(1)
+      .mr(8)
       .nr(8)
       .kr(1)
-      .sr(1)
-      .m(1)
+      .sr(4)
+      .m(8)
       .n(8)
       .k(4)
       .cn_stride(11)
-      .Test(xnn_f32_gemm_minmax_ukernel_1x8__sse2_dup, xnn_init_f32_minmax_sse_params);
+      .Test(xnn_f32_gemm_minmax_ukernel_8x8s4__neonfma, xnn_init_f32_minmax_scalar_params);
   }
 
-  TEST(F32_GEMM_MINMAX_1X8__SSE2_DUP, k_eq_4_strided_a) {
-    TEST_REQUIRES_X86_SSE2;
+  TEST(F32_GEMM_MINMAX_8X8S4__NEONFMA, k_eq_4_strided_a) {
+    TEST_REQUIRES_ARM_NEON_FMA;
     GemmMicrokernelTester()
-      .mr(1)
+      .mr(8)
       .nr(8)
       .kr(1)
-      .sr(1)
-      .m(1)
+      .sr(4)
+      .m(8)
       .n(8)
       .k(4)
       .a_stride(7)
-      .Test(xnn_f32_gemm_minmax_ukernel_1x8__sse2_dup, xnn_init_f32_minmax_sse_params);
+      .Test(xnn_f32_gemm_minmax_ukernel_8x8s4__neonfma, xnn_init_f32_minmax_scalar_params);
   }
 
-  TEST(F32_GEMM_MINMAX_1X8__SSE2_DUP, k_eq_4_subtile) {
-    TEST_REQUIRES_X86_SSE2;
+  TEST(F32_GEMM_MINMAX_8X8S4__NEONFMA, k_eq_4_subtile) {
+    TEST_REQUIRES_ARM_NEON_FMA;
     for (uint32_t n = 1; n <= 8; n++) {
-      for (uint32_t m = 1; m <= 1; m++) {
+      for (uint32_t m = 1; m <= 8; m++) {
         GemmMicrokernelTester()
-          .mr(1)
+          .mr(8)
           .nr(8)
           .kr(1)
-          .sr(1)
+          .sr(4)
           .m(m)
           .n(n)
           .k(4)
           .iterations(1)
-          .Test(xnn_f32_gemm_minmax_ukernel_1x8__sse2_dup, xnn_init_f32_minmax_sse_params);
+          .Test(xnn_f32_gemm_minmax_ukernel_8x8s4__neonfma, xnn_init_f32_minmax_scalar_params);
       }
     }
   }
 
-  TEST(F32_GEMM_MINMAX_1X8__SSE2_DUP, k_eq_4_subtile_m) {
-    TEST_REQUIRES_X86_SSE2;
-    for (uint32_t m = 1; m <= 1; m++) {
+  TEST(F32_GEMM_MINMAX_8X8S4__NEONFMA, k_eq_4_subtile_m) {
+    TEST_REQUIRES_ARM_NEON_FMA;
+    for (uint32_t m = 1; m <= 8; m++) {
       GemmMicrokernelTester()
-        .mr(1)
+        .mr(8)
         .nr(8)
         .kr(1)
-        .sr(1)
+        .sr(4)
         .m(m)
         .n(8)
         .k(4)
         .iterations(1)
-        .Test(xnn_f32_gemm_minmax_ukernel_1x8__sse2_dup, xnn_init_f32_minmax_sse_params);
+        .Test(xnn_f32_gemm_minmax_ukernel_8x8s4__neonfma, xnn_init_f32_minmax_scalar_params);
     }
   }
 
-  TEST(F32_GEMM_MINMAX_1X8__SSE2_DUP, k_eq_4_subtile_n) {
-    TEST_REQUIRES_X86_SSE2;
+  TEST(F32_GEMM_MINMAX_8X8S4__NEONFMA, k_eq_4_subtile_n) {
+    TEST_REQUIRES_ARM_NEON_FMA;
     for (uint32_t n = 1; n <= 8; n++) {
       GemmMicrokernelTester()
-        .mr(1)
+        .mr(8)
         .nr(8)
         .kr(1)
-        .sr(1)
-        .m(1)
+        .sr(4)
+        .m(8)
         .n(n)
         .k(4)
         .iterations(1)
-        .Test(xnn_f32_gemm_minmax_ukernel_1x8__sse2_dup, xnn_init_f32_minmax_sse_params);
+        .Test(xnn_f32_gemm_minmax_ukernel_8x8s4__neonfma, xnn_init_f32_minmax_scalar_params);
     }
   }
 
-  TEST(F32_GEMM_MINMAX_1X8__SSE2_DUP, k_lt_4) {
-    TEST_REQUIRES_X86_SSE2;
+  TEST(F32_GEMM_MINMAX_8X8S4__NEONFMA, k_lt_4) {
+    TEST_REQUIRES_ARM_NEON_FMA;
     for (size_t k = 1; k < 4; k++) {
       GemmMicrokernelTester()
-        .mr(1)
+        .mr(8)
         .nr(8)
         .kr(1)
-        .sr(1)
-        .m(1)
+        .sr(4)
+        .m(8)
         .n(8)
         .k(k)
-        .Test(xnn_f32_gemm_minmax_ukernel_1x8__sse2_dup, xnn_init_f32_minmax_sse_params);
+        .Test(xnn_f32_gemm_minmax_ukernel_8x8s4__neonfma, xnn_init_f32_minmax_scalar_params);
     }
   }
 
-  TEST(F32_GEMM_MINMAX_1X8__SSE2_DUP, k_lt_4_strided_a) {
-    TEST_REQUIRES_X86_SSE2;
+  TEST(F32_GEMM_MINMAX_8X8S4__NEONFMA, k_lt_4_strided_a) {
+    TEST_REQUIRES_ARM_NEON_FMA;
     for (size_t k = 1; k < 4; k++) {
       GemmMicrokernelTester()
-        .mr(1)
+        .mr(8)
         .nr(8)
         .kr(1)
-        .sr(1)
-        .m(1)
+        .sr(4)
+        .m(8)
         .n(8)
         .k(k)
         .a_stride(7)
-        .Test(xnn_f32_gemm_minmax_ukernel_1x8__sse2_dup, xnn_init_f32_minmax_sse_params);
+        .Test(xnn_f32_gemm_minmax_ukernel_8x8s4__neonfma, xnn_init_f32_minmax_scalar_params);
     }
   }
 
-  TEST(F32_GEMM_MINMAX_1X8__SSE2_DUP, k_lt_4_subtile) {
-    TEST_REQUIRES_X86_SSE2;
+  TEST(F32_GEMM_MINMAX_8X8S4__NEONFMA, k_lt_4_subtile) {
+    TEST_REQUIRES_ARM_NEON_FMA;
     for (size_t k = 1; k < 4; k++) {
       for (uint32_t n = 1; n <= 8; n++) {
-        for (uint32_t m = 1; m <= 1; m++) {
+        for (uint32_t m = 1; m <= 8; m++) {
           GemmMicrokernelTester()
-            .mr(1)
+            .mr(8)
             .nr(8)
             .kr(1)
-            .sr(1)
+            .sr(4)
             .m(m)
             .n(n)
             .k(k)
             .iterations(1)
-            .Test(xnn_f32_gemm_minmax_ukernel_1x8__sse2_dup, xnn_init_f32_minmax_sse_params);
+            .Test(xnn_f32_gemm_minmax_ukernel_8x8s4__neonfma, xnn_init_f32_minmax_scalar_params);
         }
       }
     }
   }
 
-  TEST(F32_GEMM_MINMAX_1X8__SSE2_DUP, k_gt_4) {
-    TEST_REQUIRES_X86_SSE2;
+  TEST(F32_GEMM_MINMAX_8X8S4__NEONFMA, k_gt_4) {
+    TEST_REQUIRES_ARM_NEON_FMA;
     for (size_t k = 5; k < 8; k++) {
       GemmMicrokernelTester()
-        .mr(1)
+        .mr(8)
         .nr(8)
         .kr(1)
-        .sr(1)
-        .m(1)
+        .sr(4)
+        .m(8)
         .n(8)
         .k(k)
-        .Test(xnn_f32_gemm_minmax_ukernel_1x8__sse2_dup, xnn_init_f32_minmax_sse_params);
+        .Test(xnn_f32_gemm_minmax_ukernel_8x8s4__neonfma, xnn_init_f32_minmax_scalar_params);
     }
   }
 
-  TEST(F32_GEMM_MINMAX_1X8__SSE2_DUP, k_gt_4_strided_a) {
-    TEST_REQUIRES_X86_SSE2;
+  TEST(F32_GEMM_MINMAX_8X8S4__NEONFMA, k_gt_4_strided_a) {
+    TEST_REQUIRES_ARM_NEON_FMA;
     for (size_t k = 5; k < 8; k++) {
       GemmMicrokernelTester()
-        .mr(1)
+        .mr(8)
         .nr(8)
         .kr(1)
-        .sr(1)
-        .m(1)
+        .sr(4)
+        .m(8)
         .n(8)
         .k(k)
         .a_stride(11)
-        .Test(xnn_f32_gemm_minmax_ukernel_1x8__sse2_dup, xnn_init_f32_minmax_sse_params);
+        .Test(xnn_f32_gemm_minmax_ukernel_8x8s4__neonfma, xnn_init_f32_minmax_scalar_params);
     }
   }
 
-  TEST(F32_GEMM_MINMAX_1X8__SSE2_DUP, k_gt_4_subtile) {
-    TEST_REQUIRES_X86_SSE2;
+  TEST(F32_GEMM_MINMAX_8X8S4__NEONFMA, k_gt_4_subtile) {
+    TEST_REQUIRES_ARM_NEON_FMA;
     for (size_t k = 5; k < 8; k++) {
       for (uint32_t n = 1; n <= 8; n++) {
-        for (uint32_t m = 1; m <= 1; m++) {
+        for (uint32_t m = 1; m <= 8; m++) {
           GemmMicrokernelTester()
-            .mr(1)
+            .mr(8)
             .nr(8)
             .kr(1)
-            .sr(1)
+            .sr(4)
             .m(m)
             .n(n)
             .k(k)
             .iterations(1)
-            .Test(xnn_f32_gemm_minmax_ukernel_1x8__sse2_dup, xnn_init_f32_minmax_sse_params);
+            .Test(xnn_f32_gemm_minmax_ukernel_8x8s4__neonfma, xnn_init_f32_minmax_scalar_params);
         }
       }
     }
   }
 
-  TEST(F32_GEMM_MINMAX_1X8__SSE2_DUP, k_div_4) {
-    TEST_REQUIRES_X86_SSE2;
+  TEST(F32_GEMM_MINMAX_8X8S4__NEONFMA, k_div_4) {
+    TEST_REQUIRES_ARM_NEON_FMA;
     for (size_t k = 8; k <= 40; k += 4) {
       GemmMicrokernelTester()
-        .mr(1)
+        .mr(8)
         .nr(8)
         .kr(1)
-        .sr(1)
-        .m(1)
+        .sr(4)
+        .m(8)
         .n(8)
         .k(k)
-        .Test(xnn_f32_gemm_minmax_ukernel_1x8__sse2_dup, xnn_init_f32_minmax_sse_params);
+        .Test(xnn_f32_gemm_minmax_ukernel_8x8s4__neonfma, xnn_init_f32_minmax_scalar_params);
     }
   }
 
-  TEST(F32_GEMM_MINMAX_1X8__SSE2_DUP, k_div_4_strided_a) {
-    TEST_REQUIRES_X86_SSE2;
+  TEST(F32_GEMM_MINMAX_8X8S4__NEONFMA, k_div_4_strided_a) {
+    TEST_REQUIRES_ARM_NEON_FMA;
     for (size_t k = 8; k <= 40; k += 4) {
       GemmMicrokernelTester()
-        .mr(1)
+        .mr(8)
         .nr(8)
         .kr(1)
-        .sr(1)
-        .m(1)
+        .sr(4)
+        .m(8)
         .n(8)
         .k(k)
         .a_stride(43)
-        .Test(xnn_f32_gemm_minmax_ukernel_1x8__sse2_dup, xnn_init_f32_minmax_sse_params);
+        .Test(xnn_f32_gemm_minmax_ukernel_8x8s4__neonfma, xnn_init_f32_minmax_scalar_params);
     }
   }
 
-  TEST(F32_GEMM_MINMAX_1X8__SSE2_DUP, k_div_4_subtile) {
-    TEST_REQUIRES_X86_SSE2;
+  TEST(F32_GEMM_MINMAX_8X8S4__NEONFMA, k_div_4_subtile) {
+    TEST_REQUIRES_ARM_NEON_FMA;
     for (size_t k = 8; k <= 40; k += 4) {
       for (uint32_t n = 1; n <= 8; n++) {
-        for (uint32_t m = 1; m <= 1; m++) {
+        for (uint32_t m = 1; m <= 8; m++) {
           GemmMicrokernelTester()
-            .mr(1)
+            .mr(8)
             .nr(8)
             .kr(1)
-            .sr(1)
+            .sr(4)
             .m(m)
             .n(n)
             .k(k)
             .iterations(1)
-            .Test(xnn_f32_gemm_minmax_ukernel_1x8__sse2_dup, xnn_init_f32_minmax_sse_params);
+            .Test(xnn_f32_gemm_minmax_ukernel_8x8s4__neonfma, xnn_init_f32_minmax_scalar_params);
         }
       }
     }
   }
 
-  TEST(F32_GEMM_MINMAX_1X8__SSE2_DUP, n_gt_8) {
-    TEST_REQUIRES_X86_SSE2;
+  TEST(F32_GEMM_MINMAX_8X8S4__NEONFMA, n_gt_8) {
+    TEST_REQUIRES_ARM_NEON_FMA;
     for (uint32_t n = 9; n < 16; n++) {
       for (size_t k = 1; k <= 20; k += 5) {
         GemmMicrokernelTester()
-          .mr(1)
+          .mr(8)
           .nr(8)
           .kr(1)
-          .sr(1)
-          .m(1)
+          .sr(4)
+          .m(8)
           .n(n)
           .k(k)
-          .Test(xnn_f32_gemm_minmax_ukernel_1x8__sse2_dup, xnn_init_f32_minmax_sse_params);
+          .Test(xnn_f32_gemm_minmax_ukernel_8x8s4__neonfma, xnn_init_f32_minmax_scalar_params);
       }
     }
   }
 
-  TEST(F32_GEMM_MINMAX_1X8__SSE2_DUP, n_gt_8_strided_cn) {
-    TEST_REQUIRES_X86_SSE2;
+  TEST(F32_GEMM_MINMAX_8X8S4__NEONFMA, n_gt_8_strided_cn) {
+    TEST_REQUIRES_ARM_NEON_FMA;
     for (uint32_t n = 9; n < 16; n++) {
       for (size_t k = 1; k <= 20; k += 5) {
         GemmMicrokernelTester()
-          .mr(1)
+          .mr(8)
           .nr(8)
           .kr(1)
-          .sr(1)
-          .m(1)
+          .sr(4)
+          .m(8)
           .n(n)
           .k(k)
           .cn_stride(11)
-          .Test(xnn_f32_gemm_minmax_ukernel_1x8__sse2_dup, xnn_init_f32_minmax_sse_params);
+          .Test(xnn_f32_gemm_minmax_ukernel_8x8s4__neonfma, xnn_init_f32_minmax_scalar_params);
       }
     }
   }
 
-  TEST(F32_GEMM_MINMAX_1X8__SSE2_DUP, n_gt_8_strided_a) {
-    TEST_REQUIRES_X86_SSE2;
+  TEST(F32_GEMM_MINMAX_8X8S4__NEONFMA, n_gt_8_strided_a) {
+    TEST_REQUIRES_ARM_NEON_FMA;
     for (uint32_t n = 9; n < 16; n++) {
       for (size_t k = 1; k <= 20; k += 5) {
         GemmMicrokernelTester()
-          .mr(1)
+          .mr(8)
           .nr(8)
           .kr(1)
-          .sr(1)
-          .m(1)
+          .sr(4)
+          .m(8)
           .n(n)
           .k(k)
           .a_stride(23)
-          .Test(xnn_f32_gemm_minmax_ukernel_1x8__sse2_dup, xnn_init_f32_minmax_sse_params);
+          .Test(xnn_f32_gemm_minmax_ukernel_8x8s4__neonfma, xnn_init_f32_minmax_scalar_params);
       }
     }
   }
 
-  TEST(F32_GEMM_MINMAX_1X8__SSE2_DUP, n_gt_8_subtile) {
-    TEST_REQUIRES_X86_SSE2;
+  TEST(F32_GEMM_MINMAX_8X8S4__NEONFMA, n_gt_8_subtile) {
+    TEST_REQUIRES_ARM_NEON_FMA;
     for (uint32_t n = 9; n < 16; n++) {
       for (size_t k = 1; k <= 20; k += 5) {
-        for (uint32_t m = 1; m <= 1; m++) {
+        for (uint32_t m = 1; m <= 8; m++) {
           GemmMicrokernelTester()
-            .mr(1)
+            .mr(8)
             .nr(8)
             .kr(1)
-            .sr(1)
+            .sr(4)
             .m(m)
             .n(n)
             .k(k)
             .iterations(1)
-            .Test(xnn_f32_gemm_minmax_ukernel_1x8__sse2_dup, xnn_init_f32_minmax_sse_params);
+            .Test(xnn_f32_gemm_minmax_ukernel_8x8s4__neonfma, xnn_init_f32_minmax_scalar_params);
         }
       }
     }
   }
 
-  TEST(F32_GEMM_MINMAX_1X8__SSE2_DUP, n_div_8) {
-    TEST_REQUIRES_X86_SSE2;
+  TEST(F32_GEMM_MINMAX_8X8S4__NEONFMA, n_div_8) {
+    TEST_REQUIRES_ARM_NEON_FMA;
     for (uint32_t n = 16; n <= 24; n += 8) {
       for (size_t k = 1; k <= 20; k += 5) {
         GemmMicrokernelTester()
-          .mr(1)
+          .mr(8)
           .nr(8)
           .kr(1)
-          .sr(1)
-          .m(1)
+          .sr(4)
+          .m(8)
           .n(n)
           .k(k)
-          .Test(xnn_f32_gemm_minmax_ukernel_1x8__sse2_dup, xnn_init_f32_minmax_sse_params);
+          .Test(xnn_f32_gemm_minmax_ukernel_8x8s4__neonfma, xnn_init_f32_minmax_scalar_params);
       }
     }
   }
 
-  TEST(F32_GEMM_MINMAX_1X8__SSE2_DUP, n_div_8_strided_cn) {
-    TEST_REQUIRES_X86_SSE2;
+  TEST(F32_GEMM_MINMAX_8X8S4__NEONFMA, n_div_8_strided_cn) {
+    TEST_REQUIRES_ARM_NEON_FMA;
     for (uint32_t n = 16; n <= 24; n += 8) {
       for (size_t k = 1; k <= 20; k += 5) {
         GemmMicrokernelTester()
-          .mr(1)
+          .mr(8)
           .nr(8)
           .kr(1)
-          .sr(1)
-          .m(1)
+          .sr(4)
+          .m(8)
           .n(n)
           .k(k)
           .cn_stride(11)
-          .Test(xnn_f32_gemm_minmax_ukernel_1x8__sse2_dup, xnn_init_f32_minmax_sse_params);
+          .Test(xnn_f32_gemm_minmax_ukernel_8x8s4__neonfma, xnn_init_f32_minmax_scalar_params);
       }
     }
   }
 
-  TEST(F32_GEMM_MINMAX_1X8__SSE2_DUP, n_div_8_strided_a) {
-    TEST_REQUIRES_X86_SSE2;
+  TEST(F32_GEMM_MINMAX_8X8S4__NEONFMA, n_div_8_strided_a) {
+    TEST_REQUIRES_ARM_NEON_FMA;
     for (uint32_t n = 16; n <= 24; n += 8) {
       for (size_t k = 1; k <= 20; k += 5) {
         GemmMicrokernelTester()
-          .mr(1)
+          .mr(8)
           .nr(8)
           .kr(1)
-          .sr(1)
-          .m(1)
+          .sr(4)
+          .m(8)
           .n(n)
           .k(k)
           .a_stride(23)
-          .Test(xnn_f32_gemm_minmax_ukernel_1x8__sse2_dup, xnn_init_f32_minmax_sse_params);
+          .Test(xnn_f32_gemm_minmax_ukernel_8x8s4__neonfma, xnn_init_f32_minmax_scalar_params);
       }
     }
   }
 
-  TEST(F32_GEMM_MINMAX_1X8__SSE2_DUP, n_div_8_subtile) {
-    TEST_REQUIRES_X86_SSE2;
+  TEST(F32_GEMM_MINMAX_8X8S4__NEONFMA, n_div_8_subtile) {
+    TEST_REQUIRES_ARM_NEON_FMA;
     for (uint32_t n = 16; n <= 24; n += 8) {
       for (size_t k = 1; k <= 20; k += 5) {
-        for (uint32_t m = 1; m <= 1; m++) {
+        for (uint32_t m = 1; m <= 8; m++) {
           GemmMicrokernelTester()
-            .mr(1)
+            .mr(8)
             .nr(8)
             .kr(1)
-            .sr(1)
+            .sr(4)
             .m(m)
             .n(n)
             .k(k)
             .iterations(1)
-            .Test(xnn_f32_gemm_minmax_ukernel_1x8__sse2_dup, xnn_init_f32_minmax_sse_params);
+            .Test(xnn_f32_gemm_minmax_ukernel_8x8s4__neonfma, xnn_init_f32_minmax_scalar_params);
         }
       }
     }
   }
 
-  TEST(F32_GEMM_MINMAX_1X8__SSE2_DUP, strided_cm_subtile) {
-    TEST_REQUIRES_X86_SSE2;
+  TEST(F32_GEMM_MINMAX_8X8S4__NEONFMA, strided_cm_subtile) {
+    TEST_REQUIRES_ARM_NEON_FMA;
     for (size_t k = 1; k <= 20; k += 5) {
       for (uint32_t n = 1; n <= 8; n++) {
-        for (uint32_t m = 1; m <= 1; m++) {
+        for (uint32_t m = 1; m <= 8; m++) {
           GemmMicrokernelTester()
-            .mr(1)
+            .mr(8)
             .nr(8)
             .kr(1)
-            .sr(1)
+            .sr(4)
             .m(m)
             .n(n)
             .k(k)
             .cm_stride(11)
             .iterations(1)
-            .Test(xnn_f32_gemm_minmax_ukernel_1x8__sse2_dup, xnn_init_f32_minmax_sse_params);
+            .Test(xnn_f32_gemm_minmax_ukernel_8x8s4__neonfma, xnn_init_f32_minmax_scalar_params);
         }
       }
     }
   }
 
-  TEST(F32_GEMM_MINMAX_1X8__SSE2_DUP, qmin) {
-    TEST_REQUIRES_X86_SSE2;
+  TEST(F32_GEMM_MINMAX_8X8S4__NEONFMA, qmin) {
+    TEST_REQUIRES_ARM_NEON_FMA;
     GemmMicrokernelTester()
-      .mr(1)
+      .mr(8)
       .nr(8)
       .kr(1)
-      .sr(1)
-      .m(1)
+      .sr(4)
+      .m(8)
       .n(8)
       .k(4)
       .qmin(128)
-      .Test(xnn_f32_gemm_minmax_ukernel_1x8__sse2_dup, xnn_init_f32_minmax_sse_params);
+      .Test(xnn_f32_gemm_minmax_ukernel_8x8s4__neonfma, xnn_init_f32_minmax_scalar_params);
   }
 
-  TEST(F32_GEMM_MINMAX_1X8__SSE2_DUP, qmax) {
-    TEST_REQUIRES_X86_SSE2;
+  TEST(F32_GEMM_MINMAX_8X8S4__NEONFMA, qmax) {
+    TEST_REQUIRES_ARM_NEON_FMA;
     GemmMicrokernelTester()
-      .mr(1)
+      .mr(8)
       .nr(8)
       .kr(1)
-      .sr(1)
-      .m(1)
+      .sr(4)
+      .m(8)
       .n(8)
       .k(4)
       .qmax(128)
-      .Test(xnn_f32_gemm_minmax_ukernel_1x8__sse2_dup, xnn_init_f32_minmax_sse_params);
+      .Test(xnn_f32_gemm_minmax_ukernel_8x8s4__neonfma, xnn_init_f32_minmax_scalar_params);
   }
 
-  TEST(F32_GEMM_MINMAX_1X8__SSE2_DUP, strided_cm) {
-    TEST_REQUIRES_X86_SSE2;
+  TEST(F32_GEMM_MINMAX_8X8S4__NEONFMA, strided_cm) {
+    TEST_REQUIRES_ARM_NEON_FMA;
     GemmMicrokernelTester()
-      .mr(1)
+      .mr(8)
       .nr(8)
       .kr(1)
-      .sr(1)
-      .m(1)
+      .sr(4)
+      .m(8)
       .n(8)
       .k(4)
       .cm_stride(11)
-      .Test(xnn_f32_gemm_minmax_ukernel_1x8__sse2_dup, xnn_init_f32_minmax_sse_params);
+      .Test(xnn_f32_gemm_minmax_ukernel_8x8s4__neonfma, xnn_init_f32_minmax_scalar_params);
   }
-#endif  // XNN_ARCH_X86 || XNN_ARCH_X86_64
+#endif  // XNN_ARCH_ARM || XNN_ARCH_ARM64
 
 
 #if XNN_ARCH_X86 || XNN_ARCH_X86_64
-  TEST(F32_GEMM_MINMAX_3X8__SSE_DUP, k_eq_4) {
-    TEST_REQUIRES_X86_SSE;
+  TEST(F32_GEMM_MINMAX_1X8__SSE2_DUP, k_eq_4) {
+    TEST_REQUIRES_X86_SSE2;
     GemmMicrokernelTester()
-      .mr(3)
+      .mr(1)
       .nr(8)
       .kr(1)
       .sr(1)
-      .m(3)
+      .m(1)
       .n(8)
       .k(4)
-      .Test(xnn_f32_gemm_minmax_ukernel_3x8__sse_dup, xnn_init_f32_minmax_sse_params);
+      .Test(xnn_f32_gemm_minmax_ukernel_1x8__sse2_dup, xnn_init_f32_minmax_sse_params);
   }
 
-  TEST(F32_GEMM_MINMAX_3X8__SSE_DUP, strided_cn) {
-    TEST_REQUIRES_X86_SSE;
+  TEST(F32_GEMM_MINMAX_1X8__SSE2_DUP, strided_cn) {
+    TEST_REQUIRES_X86_SSE2;
     GemmMicrokernelTester()
-      .mr(3)
+      .mr(1)
       .nr(8)
       .kr(1)
       .sr(1)
-      .m(3)
+      .m(1)
       .n(8)
       .k(4)
       .cn_stride(11)
-      .Test(xnn_f32_gemm_minmax_ukernel_3x8__sse_dup, xnn_init_f32_minmax_sse_params);
+      .Test(xnn_f32_gemm_minmax_ukernel_1x8__sse2_dup, xnn_init_f32_minmax_sse_params);
   }
 
-  TEST(F32_GEMM_MINMAX_3X8__SSE_DUP, k_eq_4_strided_a) {
-    TEST_REQUIRES_X86_SSE;
+  TEST(F32_GEMM_MINMAX_1X8__SSE2_DUP, k_eq_4_strided_a) {
+    TEST_REQUIRES_X86_SSE2;
     GemmMicrokernelTester()
-      .mr(3)
+      .mr(1)
       .nr(8)
       .kr(1)
       .sr(1)
-      .m(3)
+      .m(1)
       .n(8)
       .k(4)
       .a_stride(7)
-      .Test(xnn_f32_gemm_minmax_ukernel_3x8__sse_dup, xnn_init_f32_minmax_sse_params);
+      .Test(xnn_f32_gemm_minmax_ukernel_1x8__sse2_dup, xnn_init_f32_minmax_sse_params);
   }
 
-  TEST(F32_GEMM_MINMAX_3X8__SSE_DUP, k_eq_4_subtile) {
-    TEST_REQUIRES_X86_SSE;
+  TEST(F32_GEMM_MINMAX_1X8__SSE2_DUP, k_eq_4_subtile) {
+    TEST_REQUIRES_X86_SSE2;
     for (uint32_t n = 1; n <= 8; n++) {
-      for (uint32_t m = 1; m <= 3; m++) {
+      for (uint32_t m = 1; m <= 1; m++) {
         GemmMicrokernelTester()
-          .mr(3)
+          .mr(1)
           .nr(8)
           .kr(1)
           .sr(1)
@@ -14253,16 +14253,16 @@
           .n(n)
           .k(4)
           .iterations(1)
-          .Test(xnn_f32_gemm_minmax_ukernel_3x8__sse_dup, xnn_init_f32_minmax_sse_params);
+          .Test(xnn_f32_gemm_minmax_ukernel_1x8__sse2_dup, xnn_init_f32_minmax_sse_params);
       }
     }
   }
 
-  TEST(F32_GEMM_MINMAX_3X8__SSE_DUP, k_eq_4_subtile_m) {
-    TEST_REQUIRES_X86_SSE;
-    for (uint32_t m = 1; m <= 3; m++) {
+  TEST(F32_GEMM_MINMAX_1X8__SSE2_DUP, k_eq_4_subtile_m) {
+    TEST_REQUIRES_X86_SSE2;
+    for (uint32_t m = 1; m <= 1; m++) {
       GemmMicrokernelTester()
-        .mr(3)
+        .mr(1)
         .nr(8)
         .kr(1)
         .sr(1)
@@ -14270,64 +14270,64 @@
         .n(8)
         .k(4)
         .iterations(1)
-        .Test(xnn_f32_gemm_minmax_ukernel_3x8__sse_dup, xnn_init_f32_minmax_sse_params);
+        .Test(xnn_f32_gemm_minmax_ukernel_1x8__sse2_dup, xnn_init_f32_minmax_sse_params);
     }
   }
 
-  TEST(F32_GEMM_MINMAX_3X8__SSE_DUP, k_eq_4_subtile_n) {
-    TEST_REQUIRES_X86_SSE;
+  TEST(F32_GEMM_MINMAX_1X8__SSE2_DUP, k_eq_4_subtile_n) {
+    TEST_REQUIRES_X86_SSE2;
     for (uint32_t n = 1; n <= 8; n++) {
       GemmMicrokernelTester()
-        .mr(3)
+        .mr(1)
         .nr(8)
         .kr(1)
         .sr(1)
-        .m(3)
+        .m(1)
         .n(n)
         .k(4)
         .iterations(1)
-        .Test(xnn_f32_gemm_minmax_ukernel_3x8__sse_dup, xnn_init_f32_minmax_sse_params);
+        .Test(xnn_f32_gemm_minmax_ukernel_1x8__sse2_dup, xnn_init_f32_minmax_sse_params);
     }
   }
 
-  TEST(F32_GEMM_MINMAX_3X8__SSE_DUP, k_lt_4) {
-    TEST_REQUIRES_X86_SSE;
+  TEST(F32_GEMM_MINMAX_1X8__SSE2_DUP, k_lt_4) {
+    TEST_REQUIRES_X86_SSE2;
     for (size_t k = 1; k < 4; k++) {
       GemmMicrokernelTester()
-        .mr(3)
+        .mr(1)
         .nr(8)
         .kr(1)
         .sr(1)
-        .m(3)
+        .m(1)
         .n(8)
         .k(k)
-        .Test(xnn_f32_gemm_minmax_ukernel_3x8__sse_dup, xnn_init_f32_minmax_sse_params);
+        .Test(xnn_f32_gemm_minmax_ukernel_1x8__sse2_dup, xnn_init_f32_minmax_sse_params);
     }
   }
 
-  TEST(F32_GEMM_MINMAX_3X8__SSE_DUP, k_lt_4_strided_a) {
-    TEST_REQUIRES_X86_SSE;
+  TEST(F32_GEMM_MINMAX_1X8__SSE2_DUP, k_lt_4_strided_a) {
+    TEST_REQUIRES_X86_SSE2;
     for (size_t k = 1; k < 4; k++) {
       GemmMicrokernelTester()
-        .mr(3)
+        .mr(1)
         .nr(8)
         .kr(1)
         .sr(1)
-        .m(3)
+        .m(1)
         .n(8)
         .k(k)
         .a_stride(7)
-        .Test(xnn_f32_gemm_minmax_ukernel_3x8__sse_dup, xnn_init_f32_minmax_sse_params);
+        .Test(xnn_f32_gemm_minmax_ukernel_1x8__sse2_dup, xnn_init_f32_minmax_sse_params);
     }
   }
 
-  TEST(F32_GEMM_MINMAX_3X8__SSE_DUP, k_lt_4_subtile) {
-    TEST_REQUIRES_X86_SSE;
+  TEST(F32_GEMM_MINMAX_1X8__SSE2_DUP, k_lt_4_subtile) {
+    TEST_REQUIRES_X86_SSE2;
     for (size_t k = 1; k < 4; k++) {
       for (uint32_t n = 1; n <= 8; n++) {
-        for (uint32_t m = 1; m <= 3; m++) {
+        for (uint32_t m = 1; m <= 1; m++) {
           GemmMicrokernelTester()
-            .mr(3)
+            .mr(1)
             .nr(8)
             .kr(1)
             .sr(1)
@@ -14335,50 +14335,50 @@
             .n(n)
             .k(k)
             .iterations(1)
-            .Test(xnn_f32_gemm_minmax_ukernel_3x8__sse_dup, xnn_init_f32_minmax_sse_params);
+            .Test(xnn_f32_gemm_minmax_ukernel_1x8__sse2_dup, xnn_init_f32_minmax_sse_params);
         }
       }
     }
   }
 
-  TEST(F32_GEMM_MINMAX_3X8__SSE_DUP, k_gt_4) {
-    TEST_REQUIRES_X86_SSE;
+  TEST(F32_GEMM_MINMAX_1X8__SSE2_DUP, k_gt_4) {
+    TEST_REQUIRES_X86_SSE2;
     for (size_t k = 5; k < 8; k++) {
       GemmMicrokernelTester()
-        .mr(3)
+        .mr(1)
         .nr(8)
         .kr(1)
         .sr(1)
-        .m(3)
+        .m(1)
         .n(8)
         .k(k)
-        .Test(xnn_f32_gemm_minmax_ukernel_3x8__sse_dup, xnn_init_f32_minmax_sse_params);
+        .Test(xnn_f32_gemm_minmax_ukernel_1x8__sse2_dup, xnn_init_f32_minmax_sse_params);
     }
   }
 
-  TEST(F32_GEMM_MINMAX_3X8__SSE_DUP, k_gt_4_strided_a) {
-    TEST_REQUIRES_X86_SSE;
+  TEST(F32_GEMM_MINMAX_1X8__SSE2_DUP, k_gt_4_strided_a) {
+    TEST_REQUIRES_X86_SSE2;
     for (size_t k = 5; k < 8; k++) {
       GemmMicrokernelTester()
-        .mr(3)
+        .mr(1)
         .nr(8)
         .kr(1)
         .sr(1)
-        .m(3)
+        .m(1)
         .n(8)
         .k(k)
         .a_stride(11)
-        .Test(xnn_f32_gemm_minmax_ukernel_3x8__sse_dup, xnn_init_f32_minmax_sse_params);
+        .Test(xnn_f32_gemm_minmax_ukernel_1x8__sse2_dup, xnn_init_f32_minmax_sse_params);
     }
   }
 
-  TEST(F32_GEMM_MINMAX_3X8__SSE_DUP, k_gt_4_subtile) {
-    TEST_REQUIRES_X86_SSE;
+  TEST(F32_GEMM_MINMAX_1X8__SSE2_DUP, k_gt_4_subtile) {
+    TEST_REQUIRES_X86_SSE2;
     for (size_t k = 5; k < 8; k++) {
       for (uint32_t n = 1; n <= 8; n++) {
-        for (uint32_t m = 1; m <= 3; m++) {
+        for (uint32_t m = 1; m <= 1; m++) {
           GemmMicrokernelTester()
-            .mr(3)
+            .mr(1)
             .nr(8)
             .kr(1)
             .sr(1)
@@ -14386,50 +14386,50 @@
             .n(n)
             .k(k)
             .iterations(1)
-            .Test(xnn_f32_gemm_minmax_ukernel_3x8__sse_dup, xnn_init_f32_minmax_sse_params);
+            .Test(xnn_f32_gemm_minmax_ukernel_1x8__sse2_dup, xnn_init_f32_minmax_sse_params);
         }
       }
     }
   }
 
-  TEST(F32_GEMM_MINMAX_3X8__SSE_DUP, k_div_4) {
-    TEST_REQUIRES_X86_SSE;
+  TEST(F32_GEMM_MINMAX_1X8__SSE2_DUP, k_div_4) {
+    TEST_REQUIRES_X86_SSE2;
     for (size_t k = 8; k <= 40; k += 4) {
       GemmMicrokernelTester()
-        .mr(3)
+        .mr(1)
         .nr(8)
         .kr(1)
         .sr(1)
-        .m(3)
+        .m(1)
         .n(8)
         .k(k)
-        .Test(xnn_f32_gemm_minmax_ukernel_3x8__sse_dup, xnn_init_f32_minmax_sse_params);
+        .Test(xnn_f32_gemm_minmax_ukernel_1x8__sse2_dup, xnn_init_f32_minmax_sse_params);
     }
   }
 
-  TEST(F32_GEMM_MINMAX_3X8__SSE_DUP, k_div_4_strided_a) {
-    TEST_REQUIRES_X86_SSE;
+  TEST(F32_GEMM_MINMAX_1X8__SSE2_DUP, k_div_4_strided_a) {
+    TEST_REQUIRES_X86_SSE2;
     for (size_t k = 8; k <= 40; k += 4) {
       GemmMicrokernelTester()
-        .mr(3)
+        .mr(1)
         .nr(8)
         .kr(1)
         .sr(1)
-        .m(3)
+        .m(1)
         .n(8)
         .k(k)
         .a_stride(43)
-        .Test(xnn_f32_gemm_minmax_ukernel_3x8__sse_dup, xnn_init_f32_minmax_sse_params);
+        .Test(xnn_f32_gemm_minmax_ukernel_1x8__sse2_dup, xnn_init_f32_minmax_sse_params);
     }
   }
 
-  TEST(F32_GEMM_MINMAX_3X8__SSE_DUP, k_div_4_subtile) {
-    TEST_REQUIRES_X86_SSE;
+  TEST(F32_GEMM_MINMAX_1X8__SSE2_DUP, k_div_4_subtile) {
+    TEST_REQUIRES_X86_SSE2;
     for (size_t k = 8; k <= 40; k += 4) {
       for (uint32_t n = 1; n <= 8; n++) {
-        for (uint32_t m = 1; m <= 3; m++) {
+        for (uint32_t m = 1; m <= 1; m++) {
           GemmMicrokernelTester()
-            .mr(3)
+            .mr(1)
             .nr(8)
             .kr(1)
             .sr(1)
@@ -14437,72 +14437,72 @@
             .n(n)
             .k(k)
             .iterations(1)
-            .Test(xnn_f32_gemm_minmax_ukernel_3x8__sse_dup, xnn_init_f32_minmax_sse_params);
+            .Test(xnn_f32_gemm_minmax_ukernel_1x8__sse2_dup, xnn_init_f32_minmax_sse_params);
         }
       }
     }
   }
 
-  TEST(F32_GEMM_MINMAX_3X8__SSE_DUP, n_gt_8) {
-    TEST_REQUIRES_X86_SSE;
+  TEST(F32_GEMM_MINMAX_1X8__SSE2_DUP, n_gt_8) {
+    TEST_REQUIRES_X86_SSE2;
     for (uint32_t n = 9; n < 16; n++) {
       for (size_t k = 1; k <= 20; k += 5) {
         GemmMicrokernelTester()
-          .mr(3)
+          .mr(1)
           .nr(8)
           .kr(1)
           .sr(1)
-          .m(3)
+          .m(1)
           .n(n)
           .k(k)
-          .Test(xnn_f32_gemm_minmax_ukernel_3x8__sse_dup, xnn_init_f32_minmax_sse_params);
+          .Test(xnn_f32_gemm_minmax_ukernel_1x8__sse2_dup, xnn_init_f32_minmax_sse_params);
       }
     }
   }
 
-  TEST(F32_GEMM_MINMAX_3X8__SSE_DUP, n_gt_8_strided_cn) {
-    TEST_REQUIRES_X86_SSE;
+  TEST(F32_GEMM_MINMAX_1X8__SSE2_DUP, n_gt_8_strided_cn) {
+    TEST_REQUIRES_X86_SSE2;
     for (uint32_t n = 9; n < 16; n++) {
       for (size_t k = 1; k <= 20; k += 5) {
         GemmMicrokernelTester()
-          .mr(3)
+          .mr(1)
           .nr(8)
           .kr(1)
           .sr(1)
-          .m(3)
+          .m(1)
           .n(n)
           .k(k)
           .cn_stride(11)
-          .Test(xnn_f32_gemm_minmax_ukernel_3x8__sse_dup, xnn_init_f32_minmax_sse_params);
+          .Test(xnn_f32_gemm_minmax_ukernel_1x8__sse2_dup, xnn_init_f32_minmax_sse_params);
       }
     }
   }
 
-  TEST(F32_GEMM_MINMAX_3X8__SSE_DUP, n_gt_8_strided_a) {
-    TEST_REQUIRES_X86_SSE;
+  TEST(F32_GEMM_MINMAX_1X8__SSE2_DUP, n_gt_8_strided_a) {
+    TEST_REQUIRES_X86_SSE2;
     for (uint32_t n = 9; n < 16; n++) {
       for (size_t k = 1; k <= 20; k += 5) {
         GemmMicrokernelTester()
-          .mr(3)
+          .mr(1)
           .nr(8)
           .kr(1)
           .sr(1)
-          .m(3)
+          .m(1)
           .n(n)
           .k(k)
           .a_stride(23)
-          .Test(xnn_f32_gemm_minmax_ukernel_3x8__sse_dup, xnn_init_f32_minmax_sse_params);
+          .Test(xnn_f32_gemm_minmax_ukernel_1x8__sse2_dup, xnn_init_f32_minmax_sse_params);
       }
     }
   }
 
-  TEST(F32_GEMM_MINMAX_3X8__SSE_DUP, n_gt_8_subtile) {
-    TEST_REQUIRES_X86_SSE;
+  TEST(F32_GEMM_MINMAX_1X8__SSE2_DUP, n_gt_8_subtile) {
+    TEST_REQUIRES_X86_SSE2;
     for (uint32_t n = 9; n < 16; n++) {
       for (size_t k = 1; k <= 20; k += 5) {
-        for (uint32_t m = 1; m <= 3; m++) {
+        for (uint32_t m = 1; m <= 1; m++) {
           GemmMicrokernelTester()
-            .mr(3)
+            .mr(1)
             .nr(8)
             .kr(1)
             .sr(1)
@@ -14510,72 +14510,72 @@
             .n(n)
             .k(k)
             .iterations(1)
-            .Test(xnn_f32_gemm_minmax_ukernel_3x8__sse_dup, xnn_init_f32_minmax_sse_params);
+            .Test(xnn_f32_gemm_minmax_ukernel_1x8__sse2_dup, xnn_init_f32_minmax_sse_params);
         }
       }
     }
   }
 
-  TEST(F32_GEMM_MINMAX_3X8__SSE_DUP, n_div_8) {
-    TEST_REQUIRES_X86_SSE;
+  TEST(F32_GEMM_MINMAX_1X8__SSE2_DUP, n_div_8) {
+    TEST_REQUIRES_X86_SSE2;
     for (uint32_t n = 16; n <= 24; n += 8) {
       for (size_t k = 1; k <= 20; k += 5) {
         GemmMicrokernelTester()
-          .mr(3)
+          .mr(1)
           .nr(8)
           .kr(1)
           .sr(1)
-          .m(3)
+          .m(1)
           .n(n)
           .k(k)
-          .Test(xnn_f32_gemm_minmax_ukernel_3x8__sse_dup, xnn_init_f32_minmax_sse_params);
+          .Test(xnn_f32_gemm_minmax_ukernel_1x8__sse2_dup, xnn_init_f32_minmax_sse_params);
       }
     }
   }
 
-  TEST(F32_GEMM_MINMAX_3X8__SSE_DUP, n_div_8_strided_cn) {
-    TEST_REQUIRES_X86_SSE;
+  TEST(F32_GEMM_MINMAX_1X8__SSE2_DUP, n_div_8_strided_cn) {
+    TEST_REQUIRES_X86_SSE2;
     for (uint32_t n = 16; n <= 24; n += 8) {
       for (size_t k = 1; k <= 20; k += 5) {
         GemmMicrokernelTester()
-          .mr(3)
+          .mr(1)
           .nr(8)
           .kr(1)
           .sr(1)
-          .m(3)
+          .m(1)
           .n(n)
           .k(k)
           .cn_stride(11)
-          .Test(xnn_f32_gemm_minmax_ukernel_3x8__sse_dup, xnn_init_f32_minmax_sse_params);
+          .Test(xnn_f32_gemm_minmax_ukernel_1x8__sse2_dup, xnn_init_f32_minmax_sse_params);
       }
     }
   }
 
-  TEST(F32_GEMM_MINMAX_3X8__SSE_DUP, n_div_8_strided_a) {
-    TEST_REQUIRES_X86_SSE;
+  TEST(F32_GEMM_MINMAX_1X8__SSE2_DUP, n_div_8_strided_a) {
+    TEST_REQUIRES_X86_SSE2;
     for (uint32_t n = 16; n <= 24; n += 8) {
       for (size_t k = 1; k <= 20; k += 5) {
         GemmMicrokernelTester()
-          .mr(3)
+          .mr(1)
           .nr(8)
           .kr(1)
           .sr(1)
-          .m(3)
+          .m(1)
           .n(n)
           .k(k)
           .a_stride(23)
-          .Test(xnn_f32_gemm_minmax_ukernel_3x8__sse_dup, xnn_init_f32_minmax_sse_params);
+          .Test(xnn_f32_gemm_minmax_ukernel_1x8__sse2_dup, xnn_init_f32_minmax_sse_params);
       }
     }
   }
 
-  TEST(F32_GEMM_MINMAX_3X8__SSE_DUP, n_div_8_subtile) {
-    TEST_REQUIRES_X86_SSE;
+  TEST(F32_GEMM_MINMAX_1X8__SSE2_DUP, n_div_8_subtile) {
+    TEST_REQUIRES_X86_SSE2;
     for (uint32_t n = 16; n <= 24; n += 8) {
       for (size_t k = 1; k <= 20; k += 5) {
-        for (uint32_t m = 1; m <= 3; m++) {
+        for (uint32_t m = 1; m <= 1; m++) {
           GemmMicrokernelTester()
-            .mr(3)
+            .mr(1)
             .nr(8)
             .kr(1)
             .sr(1)
@@ -14583,19 +14583,19 @@
             .n(n)
             .k(k)
             .iterations(1)
-            .Test(xnn_f32_gemm_minmax_ukernel_3x8__sse_dup, xnn_init_f32_minmax_sse_params);
+            .Test(xnn_f32_gemm_minmax_ukernel_1x8__sse2_dup, xnn_init_f32_minmax_sse_params);
         }
       }
     }
   }
 
-  TEST(F32_GEMM_MINMAX_3X8__SSE_DUP, strided_cm_subtile) {
-    TEST_REQUIRES_X86_SSE;
+  TEST(F32_GEMM_MINMAX_1X8__SSE2_DUP, strided_cm_subtile) {
+    TEST_REQUIRES_X86_SSE2;
     for (size_t k = 1; k <= 20; k += 5) {
       for (uint32_t n = 1; n <= 8; n++) {
-        for (uint32_t m = 1; m <= 3; m++) {
+        for (uint32_t m = 1; m <= 1; m++) {
           GemmMicrokernelTester()
-            .mr(3)
+            .mr(1)
             .nr(8)
             .kr(1)
             .sr(1)
@@ -14604,58 +14604,58 @@
             .k(k)
             .cm_stride(11)
             .iterations(1)
-            .Test(xnn_f32_gemm_minmax_ukernel_3x8__sse_dup, xnn_init_f32_minmax_sse_params);
+            .Test(xnn_f32_gemm_minmax_ukernel_1x8__sse2_dup, xnn_init_f32_minmax_sse_params);
         }
       }
     }
   }
 
-  TEST(F32_GEMM_MINMAX_3X8__SSE_DUP, qmin) {
-    TEST_REQUIRES_X86_SSE;
+  TEST(F32_GEMM_MINMAX_1X8__SSE2_DUP, qmin) {
+    TEST_REQUIRES_X86_SSE2;
     GemmMicrokernelTester()
-      .mr(3)
+      .mr(1)
       .nr(8)
       .kr(1)
       .sr(1)
-      .m(3)
+      .m(1)
       .n(8)
       .k(4)
       .qmin(128)
-      .Test(xnn_f32_gemm_minmax_ukernel_3x8__sse_dup, xnn_init_f32_minmax_sse_params);
+      .Test(xnn_f32_gemm_minmax_ukernel_1x8__sse2_dup, xnn_init_f32_minmax_sse_params);
   }
 
-  TEST(F32_GEMM_MINMAX_3X8__SSE_DUP, qmax) {
-    TEST_REQUIRES_X86_SSE;
+  TEST(F32_GEMM_MINMAX_1X8__SSE2_DUP, qmax) {
+    TEST_REQUIRES_X86_SSE2;
     GemmMicrokernelTester()
-      .mr(3)
+      .mr(1)
       .nr(8)
       .kr(1)
       .sr(1)
-      .m(3)
+      .m(1)
       .n(8)
       .k(4)
       .qmax(128)
-      .Test(xnn_f32_gemm_minmax_ukernel_3x8__sse_dup, xnn_init_f32_minmax_sse_params);
+      .Test(xnn_f32_gemm_minmax_ukernel_1x8__sse2_dup, xnn_init_f32_minmax_sse_params);
   }
 
-  TEST(F32_GEMM_MINMAX_3X8__SSE_DUP, strided_cm) {
-    TEST_REQUIRES_X86_SSE;
+  TEST(F32_GEMM_MINMAX_1X8__SSE2_DUP, strided_cm) {
+    TEST_REQUIRES_X86_SSE2;
     GemmMicrokernelTester()
-      .mr(3)
+      .mr(1)
       .nr(8)
       .kr(1)
       .sr(1)
-      .m(3)
+      .m(1)
       .n(8)
       .k(4)
       .cm_stride(11)
-      .Test(xnn_f32_gemm_minmax_ukernel_3x8__sse_dup, xnn_init_f32_minmax_sse_params);
+      .Test(xnn_f32_gemm_minmax_ukernel_1x8__sse2_dup, xnn_init_f32_minmax_sse_params);
   }
 #endif  // XNN_ARCH_X86 || XNN_ARCH_X86_64
 
 
 #if XNN_ARCH_X86 || XNN_ARCH_X86_64
-  TEST(F32_GEMM_MINMAX_3X8__SSE_LOAD1, k_eq_1) {
+  TEST(F32_GEMM_MINMAX_3X8__SSE_DUP, k_eq_4) {
     TEST_REQUIRES_X86_SSE;
     GemmMicrokernelTester()
       .mr(3)
@@ -14664,11 +14664,11 @@
       .sr(1)
       .m(3)
       .n(8)
-      .k(1)
-      .Test(xnn_f32_gemm_minmax_ukernel_3x8__sse_load1, xnn_init_f32_minmax_sse_params);
+      .k(4)
+      .Test(xnn_f32_gemm_minmax_ukernel_3x8__sse_dup, xnn_init_f32_minmax_sse_params);
   }
 
-  TEST(F32_GEMM_MINMAX_3X8__SSE_LOAD1, strided_cn) {
+  TEST(F32_GEMM_MINMAX_3X8__SSE_DUP, strided_cn) {
     TEST_REQUIRES_X86_SSE;
     GemmMicrokernelTester()
       .mr(3)
@@ -14677,12 +14677,12 @@
       .sr(1)
       .m(3)
       .n(8)
-      .k(1)
+      .k(4)
       .cn_stride(11)
-      .Test(xnn_f32_gemm_minmax_ukernel_3x8__sse_load1, xnn_init_f32_minmax_sse_params);
+      .Test(xnn_f32_gemm_minmax_ukernel_3x8__sse_dup, xnn_init_f32_minmax_sse_params);
   }
 
-  TEST(F32_GEMM_MINMAX_3X8__SSE_LOAD1, k_eq_1_strided_a) {
+  TEST(F32_GEMM_MINMAX_3X8__SSE_DUP, k_eq_4_strided_a) {
     TEST_REQUIRES_X86_SSE;
     GemmMicrokernelTester()
       .mr(3)
@@ -14691,12 +14691,12 @@
       .sr(1)
       .m(3)
       .n(8)
-      .k(1)
-      .a_stride(3)
-      .Test(xnn_f32_gemm_minmax_ukernel_3x8__sse_load1, xnn_init_f32_minmax_sse_params);
+      .k(4)
+      .a_stride(7)
+      .Test(xnn_f32_gemm_minmax_ukernel_3x8__sse_dup, xnn_init_f32_minmax_sse_params);
   }
 
-  TEST(F32_GEMM_MINMAX_3X8__SSE_LOAD1, k_eq_1_subtile) {
+  TEST(F32_GEMM_MINMAX_3X8__SSE_DUP, k_eq_4_subtile) {
     TEST_REQUIRES_X86_SSE;
     for (uint32_t n = 1; n <= 8; n++) {
       for (uint32_t m = 1; m <= 3; m++) {
@@ -14707,14 +14707,14 @@
           .sr(1)
           .m(m)
           .n(n)
-          .k(1)
+          .k(4)
           .iterations(1)
-          .Test(xnn_f32_gemm_minmax_ukernel_3x8__sse_load1, xnn_init_f32_minmax_sse_params);
+          .Test(xnn_f32_gemm_minmax_ukernel_3x8__sse_dup, xnn_init_f32_minmax_sse_params);
       }
     }
   }
 
-  TEST(F32_GEMM_MINMAX_3X8__SSE_LOAD1, k_eq_1_subtile_m) {
+  TEST(F32_GEMM_MINMAX_3X8__SSE_DUP, k_eq_4_subtile_m) {
     TEST_REQUIRES_X86_SSE;
     for (uint32_t m = 1; m <= 3; m++) {
       GemmMicrokernelTester()
@@ -14724,13 +14724,13 @@
         .sr(1)
         .m(m)
         .n(8)
-        .k(1)
+        .k(4)
         .iterations(1)
-        .Test(xnn_f32_gemm_minmax_ukernel_3x8__sse_load1, xnn_init_f32_minmax_sse_params);
+        .Test(xnn_f32_gemm_minmax_ukernel_3x8__sse_dup, xnn_init_f32_minmax_sse_params);
     }
   }
 
-  TEST(F32_GEMM_MINMAX_3X8__SSE_LOAD1, k_eq_1_subtile_n) {
+  TEST(F32_GEMM_MINMAX_3X8__SSE_DUP, k_eq_4_subtile_n) {
     TEST_REQUIRES_X86_SSE;
     for (uint32_t n = 1; n <= 8; n++) {
       GemmMicrokernelTester()
@@ -14740,15 +14740,15 @@
         .sr(1)
         .m(3)
         .n(n)
-        .k(1)
+        .k(4)
         .iterations(1)
-        .Test(xnn_f32_gemm_minmax_ukernel_3x8__sse_load1, xnn_init_f32_minmax_sse_params);
+        .Test(xnn_f32_gemm_minmax_ukernel_3x8__sse_dup, xnn_init_f32_minmax_sse_params);
     }
   }
 
-  TEST(F32_GEMM_MINMAX_3X8__SSE_LOAD1, k_gt_1) {
+  TEST(F32_GEMM_MINMAX_3X8__SSE_DUP, k_lt_4) {
     TEST_REQUIRES_X86_SSE;
-    for (size_t k = 2; k < 10; k++) {
+    for (size_t k = 1; k < 4; k++) {
       GemmMicrokernelTester()
         .mr(3)
         .nr(8)
@@ -14757,13 +14757,64 @@
         .m(3)
         .n(8)
         .k(k)
-        .Test(xnn_f32_gemm_minmax_ukernel_3x8__sse_load1, xnn_init_f32_minmax_sse_params);
+        .Test(xnn_f32_gemm_minmax_ukernel_3x8__sse_dup, xnn_init_f32_minmax_sse_params);
     }
   }
 
-  TEST(F32_GEMM_MINMAX_3X8__SSE_LOAD1, k_gt_1_strided_a) {
+  TEST(F32_GEMM_MINMAX_3X8__SSE_DUP, k_lt_4_strided_a) {
     TEST_REQUIRES_X86_SSE;
-    for (size_t k = 2; k < 10; k++) {
+    for (size_t k = 1; k < 4; k++) {
+      GemmMicrokernelTester()
+        .mr(3)
+        .nr(8)
+        .kr(1)
+        .sr(1)
+        .m(3)
+        .n(8)
+        .k(k)
+        .a_stride(7)
+        .Test(xnn_f32_gemm_minmax_ukernel_3x8__sse_dup, xnn_init_f32_minmax_sse_params);
+    }
+  }
+
+  TEST(F32_GEMM_MINMAX_3X8__SSE_DUP, k_lt_4_subtile) {
+    TEST_REQUIRES_X86_SSE;
+    for (size_t k = 1; k < 4; k++) {
+      for (uint32_t n = 1; n <= 8; n++) {
+        for (uint32_t m = 1; m <= 3; m++) {
+          GemmMicrokernelTester()
+            .mr(3)
+            .nr(8)
+            .kr(1)
+            .sr(1)
+            .m(m)
+            .n(n)
+            .k(k)
+            .iterations(1)
+            .Test(xnn_f32_gemm_minmax_ukernel_3x8__sse_dup, xnn_init_f32_minmax_sse_params);
+        }
+      }
+    }
+  }
+
+  TEST(F32_GEMM_MINMAX_3X8__SSE_DUP, k_gt_4) {
+    TEST_REQUIRES_X86_SSE;
+    for (size_t k = 5; k < 8; k++) {
+      GemmMicrokernelTester()
+        .mr(3)
+        .nr(8)
+        .kr(1)
+        .sr(1)
+        .m(3)
+        .n(8)
+        .k(k)
+        .Test(xnn_f32_gemm_minmax_ukernel_3x8__sse_dup, xnn_init_f32_minmax_sse_params);
+    }
+  }
+
+  TEST(F32_GEMM_MINMAX_3X8__SSE_DUP, k_gt_4_strided_a) {
+    TEST_REQUIRES_X86_SSE;
+    for (size_t k = 5; k < 8; k++) {
       GemmMicrokernelTester()
         .mr(3)
         .nr(8)
@@ -14773,13 +14824,13 @@
         .n(8)
         .k(k)
         .a_stride(11)
-        .Test(xnn_f32_gemm_minmax_ukernel_3x8__sse_load1, xnn_init_f32_minmax_sse_params);
+        .Test(xnn_f32_gemm_minmax_ukernel_3x8__sse_dup, xnn_init_f32_minmax_sse_params);
     }
   }
 
-  TEST(F32_GEMM_MINMAX_3X8__SSE_LOAD1, k_gt_1_subtile) {
+  TEST(F32_GEMM_MINMAX_3X8__SSE_DUP, k_gt_4_subtile) {
     TEST_REQUIRES_X86_SSE;
-    for (size_t k = 2; k < 10; k++) {
+    for (size_t k = 5; k < 8; k++) {
       for (uint32_t n = 1; n <= 8; n++) {
         for (uint32_t m = 1; m <= 3; m++) {
           GemmMicrokernelTester()
@@ -14791,16 +14842,67 @@
             .n(n)
             .k(k)
             .iterations(1)
-            .Test(xnn_f32_gemm_minmax_ukernel_3x8__sse_load1, xnn_init_f32_minmax_sse_params);
+            .Test(xnn_f32_gemm_minmax_ukernel_3x8__sse_dup, xnn_init_f32_minmax_sse_params);
         }
       }
     }
   }
 
-  TEST(F32_GEMM_MINMAX_3X8__SSE_LOAD1, n_gt_8) {
+  TEST(F32_GEMM_MINMAX_3X8__SSE_DUP, k_div_4) {
+    TEST_REQUIRES_X86_SSE;
+    for (size_t k = 8; k <= 40; k += 4) {
+      GemmMicrokernelTester()
+        .mr(3)
+        .nr(8)
+        .kr(1)
+        .sr(1)
+        .m(3)
+        .n(8)
+        .k(k)
+        .Test(xnn_f32_gemm_minmax_ukernel_3x8__sse_dup, xnn_init_f32_minmax_sse_params);
+    }
+  }
+
+  TEST(F32_GEMM_MINMAX_3X8__SSE_DUP, k_div_4_strided_a) {
+    TEST_REQUIRES_X86_SSE;
+    for (size_t k = 8; k <= 40; k += 4) {
+      GemmMicrokernelTester()
+        .mr(3)
+        .nr(8)
+        .kr(1)
+        .sr(1)
+        .m(3)
+        .n(8)
+        .k(k)
+        .a_stride(43)
+        .Test(xnn_f32_gemm_minmax_ukernel_3x8__sse_dup, xnn_init_f32_minmax_sse_params);
+    }
+  }
+
+  TEST(F32_GEMM_MINMAX_3X8__SSE_DUP, k_div_4_subtile) {
+    TEST_REQUIRES_X86_SSE;
+    for (size_t k = 8; k <= 40; k += 4) {
+      for (uint32_t n = 1; n <= 8; n++) {
+        for (uint32_t m = 1; m <= 3; m++) {
+          GemmMicrokernelTester()
+            .mr(3)
+            .nr(8)
+            .kr(1)
+            .sr(1)
+            .m(m)
+            .n(n)
+            .k(k)
+            .iterations(1)
+            .Test(xnn_f32_gemm_minmax_ukernel_3x8__sse_dup, xnn_init_f32_minmax_sse_params);
+        }
+      }
+    }
+  }
+
+  TEST(F32_GEMM_MINMAX_3X8__SSE_DUP, n_gt_8) {
     TEST_REQUIRES_X86_SSE;
     for (uint32_t n = 9; n < 16; n++) {
-      for (size_t k = 1; k <= 5; k += 2) {
+      for (size_t k = 1; k <= 20; k += 5) {
         GemmMicrokernelTester()
           .mr(3)
           .nr(8)
@@ -14809,15 +14911,15 @@
           .m(3)
           .n(n)
           .k(k)
-          .Test(xnn_f32_gemm_minmax_ukernel_3x8__sse_load1, xnn_init_f32_minmax_sse_params);
+          .Test(xnn_f32_gemm_minmax_ukernel_3x8__sse_dup, xnn_init_f32_minmax_sse_params);
       }
     }
   }
 
-  TEST(F32_GEMM_MINMAX_3X8__SSE_LOAD1, n_gt_8_strided_cn) {
+  TEST(F32_GEMM_MINMAX_3X8__SSE_DUP, n_gt_8_strided_cn) {
     TEST_REQUIRES_X86_SSE;
     for (uint32_t n = 9; n < 16; n++) {
-      for (size_t k = 1; k <= 5; k += 2) {
+      for (size_t k = 1; k <= 20; k += 5) {
         GemmMicrokernelTester()
           .mr(3)
           .nr(8)
@@ -14827,15 +14929,15 @@
           .n(n)
           .k(k)
           .cn_stride(11)
-          .Test(xnn_f32_gemm_minmax_ukernel_3x8__sse_load1, xnn_init_f32_minmax_sse_params);
+          .Test(xnn_f32_gemm_minmax_ukernel_3x8__sse_dup, xnn_init_f32_minmax_sse_params);
       }
     }
   }
 
-  TEST(F32_GEMM_MINMAX_3X8__SSE_LOAD1, n_gt_8_strided_a) {
+  TEST(F32_GEMM_MINMAX_3X8__SSE_DUP, n_gt_8_strided_a) {
     TEST_REQUIRES_X86_SSE;
     for (uint32_t n = 9; n < 16; n++) {
-      for (size_t k = 1; k <= 5; k += 2) {
+      for (size_t k = 1; k <= 20; k += 5) {
         GemmMicrokernelTester()
           .mr(3)
           .nr(8)
@@ -14844,16 +14946,16 @@
           .m(3)
           .n(n)
           .k(k)
-          .a_stride(7)
-          .Test(xnn_f32_gemm_minmax_ukernel_3x8__sse_load1, xnn_init_f32_minmax_sse_params);
+          .a_stride(23)
+          .Test(xnn_f32_gemm_minmax_ukernel_3x8__sse_dup, xnn_init_f32_minmax_sse_params);
       }
     }
   }
 
-  TEST(F32_GEMM_MINMAX_3X8__SSE_LOAD1, n_gt_8_subtile) {
+  TEST(F32_GEMM_MINMAX_3X8__SSE_DUP, n_gt_8_subtile) {
     TEST_REQUIRES_X86_SSE;
     for (uint32_t n = 9; n < 16; n++) {
-      for (size_t k = 1; k <= 5; k += 2) {
+      for (size_t k = 1; k <= 20; k += 5) {
         for (uint32_t m = 1; m <= 3; m++) {
           GemmMicrokernelTester()
             .mr(3)
@@ -14864,16 +14966,16 @@
             .n(n)
             .k(k)
             .iterations(1)
-            .Test(xnn_f32_gemm_minmax_ukernel_3x8__sse_load1, xnn_init_f32_minmax_sse_params);
+            .Test(xnn_f32_gemm_minmax_ukernel_3x8__sse_dup, xnn_init_f32_minmax_sse_params);
         }
       }
     }
   }
 
-  TEST(F32_GEMM_MINMAX_3X8__SSE_LOAD1, n_div_8) {
+  TEST(F32_GEMM_MINMAX_3X8__SSE_DUP, n_div_8) {
     TEST_REQUIRES_X86_SSE;
     for (uint32_t n = 16; n <= 24; n += 8) {
-      for (size_t k = 1; k <= 5; k += 2) {
+      for (size_t k = 1; k <= 20; k += 5) {
         GemmMicrokernelTester()
           .mr(3)
           .nr(8)
@@ -14882,15 +14984,15 @@
           .m(3)
           .n(n)
           .k(k)
-          .Test(xnn_f32_gemm_minmax_ukernel_3x8__sse_load1, xnn_init_f32_minmax_sse_params);
+          .Test(xnn_f32_gemm_minmax_ukernel_3x8__sse_dup, xnn_init_f32_minmax_sse_params);
       }
     }
   }
 
-  TEST(F32_GEMM_MINMAX_3X8__SSE_LOAD1, n_div_8_strided_cn) {
+  TEST(F32_GEMM_MINMAX_3X8__SSE_DUP, n_div_8_strided_cn) {
     TEST_REQUIRES_X86_SSE;
     for (uint32_t n = 16; n <= 24; n += 8) {
-      for (size_t k = 1; k <= 5; k += 2) {
+      for (size_t k = 1; k <= 20; k += 5) {
         GemmMicrokernelTester()
           .mr(3)
           .nr(8)
@@ -14900,15 +15002,15 @@
           .n(n)
           .k(k)
           .cn_stride(11)
-          .Test(xnn_f32_gemm_minmax_ukernel_3x8__sse_load1, xnn_init_f32_minmax_sse_params);
+          .Test(xnn_f32_gemm_minmax_ukernel_3x8__sse_dup, xnn_init_f32_minmax_sse_params);
       }
     }
   }
 
-  TEST(F32_GEMM_MINMAX_3X8__SSE_LOAD1, n_div_8_strided_a) {
+  TEST(F32_GEMM_MINMAX_3X8__SSE_DUP, n_div_8_strided_a) {
     TEST_REQUIRES_X86_SSE;
     for (uint32_t n = 16; n <= 24; n += 8) {
-      for (size_t k = 1; k <= 5; k += 2) {
+      for (size_t k = 1; k <= 20; k += 5) {
         GemmMicrokernelTester()
           .mr(3)
           .nr(8)
@@ -14917,16 +15019,16 @@
           .m(3)
           .n(n)
           .k(k)
-          .a_stride(7)
-          .Test(xnn_f32_gemm_minmax_ukernel_3x8__sse_load1, xnn_init_f32_minmax_sse_params);
+          .a_stride(23)
+          .Test(xnn_f32_gemm_minmax_ukernel_3x8__sse_dup, xnn_init_f32_minmax_sse_params);
       }
     }
   }
 
-  TEST(F32_GEMM_MINMAX_3X8__SSE_LOAD1, n_div_8_subtile) {
+  TEST(F32_GEMM_MINMAX_3X8__SSE_DUP, n_div_8_subtile) {
     TEST_REQUIRES_X86_SSE;
     for (uint32_t n = 16; n <= 24; n += 8) {
-      for (size_t k = 1; k <= 5; k += 2) {
+      for (size_t k = 1; k <= 20; k += 5) {
         for (uint32_t m = 1; m <= 3; m++) {
           GemmMicrokernelTester()
             .mr(3)
@@ -14937,15 +15039,15 @@
             .n(n)
             .k(k)
             .iterations(1)
-            .Test(xnn_f32_gemm_minmax_ukernel_3x8__sse_load1, xnn_init_f32_minmax_sse_params);
+            .Test(xnn_f32_gemm_minmax_ukernel_3x8__sse_dup, xnn_init_f32_minmax_sse_params);
         }
       }
     }
   }
 
-  TEST(F32_GEMM_MINMAX_3X8__SSE_LOAD1, strided_cm_subtile) {
+  TEST(F32_GEMM_MINMAX_3X8__SSE_DUP, strided_cm_subtile) {
     TEST_REQUIRES_X86_SSE;
-    for (size_t k = 1; k <= 5; k += 2) {
+    for (size_t k = 1; k <= 20; k += 5) {
       for (uint32_t n = 1; n <= 8; n++) {
         for (uint32_t m = 1; m <= 3; m++) {
           GemmMicrokernelTester()
@@ -14958,13 +15060,13 @@
             .k(k)
             .cm_stride(11)
             .iterations(1)
-            .Test(xnn_f32_gemm_minmax_ukernel_3x8__sse_load1, xnn_init_f32_minmax_sse_params);
+            .Test(xnn_f32_gemm_minmax_ukernel_3x8__sse_dup, xnn_init_f32_minmax_sse_params);
         }
       }
     }
   }
 
-  TEST(F32_GEMM_MINMAX_3X8__SSE_LOAD1, qmin) {
+  TEST(F32_GEMM_MINMAX_3X8__SSE_DUP, qmin) {
     TEST_REQUIRES_X86_SSE;
     GemmMicrokernelTester()
       .mr(3)
@@ -14973,12 +15075,12 @@
       .sr(1)
       .m(3)
       .n(8)
-      .k(1)
+      .k(4)
       .qmin(128)
-      .Test(xnn_f32_gemm_minmax_ukernel_3x8__sse_load1, xnn_init_f32_minmax_sse_params);
+      .Test(xnn_f32_gemm_minmax_ukernel_3x8__sse_dup, xnn_init_f32_minmax_sse_params);
   }
 
-  TEST(F32_GEMM_MINMAX_3X8__SSE_LOAD1, qmax) {
+  TEST(F32_GEMM_MINMAX_3X8__SSE_DUP, qmax) {
     TEST_REQUIRES_X86_SSE;
     GemmMicrokernelTester()
       .mr(3)
@@ -14987,12 +15089,12 @@
       .sr(1)
       .m(3)
       .n(8)
-      .k(1)
+      .k(4)
       .qmax(128)
-      .Test(xnn_f32_gemm_minmax_ukernel_3x8__sse_load1, xnn_init_f32_minmax_sse_params);
+      .Test(xnn_f32_gemm_minmax_ukernel_3x8__sse_dup, xnn_init_f32_minmax_sse_params);
   }
 
-  TEST(F32_GEMM_MINMAX_3X8__SSE_LOAD1, strided_cm) {
+  TEST(F32_GEMM_MINMAX_3X8__SSE_DUP, strided_cm) {
     TEST_REQUIRES_X86_SSE;
     GemmMicrokernelTester()
       .mr(3)
@@ -15001,56 +15103,56 @@
       .sr(1)
       .m(3)
       .n(8)
-      .k(1)
+      .k(4)
       .cm_stride(11)
-      .Test(xnn_f32_gemm_minmax_ukernel_3x8__sse_load1, xnn_init_f32_minmax_sse_params);
+      .Test(xnn_f32_gemm_minmax_ukernel_3x8__sse_dup, xnn_init_f32_minmax_sse_params);
   }
 #endif  // XNN_ARCH_X86 || XNN_ARCH_X86_64
 
 
 #if XNN_ARCH_X86 || XNN_ARCH_X86_64
-  TEST(F32_GEMM_MINMAX_3X8S4__SSE, k_eq_4) {
+  TEST(F32_GEMM_MINMAX_3X8__SSE_LOAD1, k_eq_1) {
     TEST_REQUIRES_X86_SSE;
     GemmMicrokernelTester()
       .mr(3)
       .nr(8)
       .kr(1)
-      .sr(4)
+      .sr(1)
       .m(3)
       .n(8)
-      .k(4)
-      .Test(xnn_f32_gemm_minmax_ukernel_3x8s4__sse, xnn_init_f32_minmax_sse_params);
+      .k(1)
+      .Test(xnn_f32_gemm_minmax_ukernel_3x8__sse_load1, xnn_init_f32_minmax_sse_params);
   }
 
-  TEST(F32_GEMM_MINMAX_3X8S4__SSE, strided_cn) {
+  TEST(F32_GEMM_MINMAX_3X8__SSE_LOAD1, strided_cn) {
     TEST_REQUIRES_X86_SSE;
     GemmMicrokernelTester()
       .mr(3)
       .nr(8)
       .kr(1)
-      .sr(4)
+      .sr(1)
       .m(3)
       .n(8)
-      .k(4)
+      .k(1)
       .cn_stride(11)
-      .Test(xnn_f32_gemm_minmax_ukernel_3x8s4__sse, xnn_init_f32_minmax_sse_params);
+      .Test(xnn_f32_gemm_minmax_ukernel_3x8__sse_load1, xnn_init_f32_minmax_sse_params);
   }
 
-  TEST(F32_GEMM_MINMAX_3X8S4__SSE, k_eq_4_strided_a) {
+  TEST(F32_GEMM_MINMAX_3X8__SSE_LOAD1, k_eq_1_strided_a) {
     TEST_REQUIRES_X86_SSE;
     GemmMicrokernelTester()
       .mr(3)
       .nr(8)
       .kr(1)
-      .sr(4)
+      .sr(1)
       .m(3)
       .n(8)
-      .k(4)
-      .a_stride(7)
-      .Test(xnn_f32_gemm_minmax_ukernel_3x8s4__sse, xnn_init_f32_minmax_sse_params);
+      .k(1)
+      .a_stride(3)
+      .Test(xnn_f32_gemm_minmax_ukernel_3x8__sse_load1, xnn_init_f32_minmax_sse_params);
   }
 
-  TEST(F32_GEMM_MINMAX_3X8S4__SSE, k_eq_4_subtile) {
+  TEST(F32_GEMM_MINMAX_3X8__SSE_LOAD1, k_eq_1_subtile) {
     TEST_REQUIRES_X86_SSE;
     for (uint32_t n = 1; n <= 8; n++) {
       for (uint32_t m = 1; m <= 3; m++) {
@@ -15058,998 +15160,896 @@
           .mr(3)
           .nr(8)
           .kr(1)
-          .sr(4)
+          .sr(1)
           .m(m)
           .n(n)
-          .k(4)
+          .k(1)
           .iterations(1)
-          .Test(xnn_f32_gemm_minmax_ukernel_3x8s4__sse, xnn_init_f32_minmax_sse_params);
+          .Test(xnn_f32_gemm_minmax_ukernel_3x8__sse_load1, xnn_init_f32_minmax_sse_params);
       }
     }
   }
 
-  TEST(F32_GEMM_MINMAX_3X8S4__SSE, k_eq_4_subtile_m) {
+  TEST(F32_GEMM_MINMAX_3X8__SSE_LOAD1, k_eq_1_subtile_m) {
     TEST_REQUIRES_X86_SSE;
     for (uint32_t m = 1; m <= 3; m++) {
       GemmMicrokernelTester()
         .mr(3)
         .nr(8)
         .kr(1)
-        .sr(4)
+        .sr(1)
         .m(m)
         .n(8)
-        .k(4)
+        .k(1)
         .iterations(1)
-        .Test(xnn_f32_gemm_minmax_ukernel_3x8s4__sse, xnn_init_f32_minmax_sse_params);
+        .Test(xnn_f32_gemm_minmax_ukernel_3x8__sse_load1, xnn_init_f32_minmax_sse_params);
     }
   }
 
-  TEST(F32_GEMM_MINMAX_3X8S4__SSE, k_eq_4_subtile_n) {
+  TEST(F32_GEMM_MINMAX_3X8__SSE_LOAD1, k_eq_1_subtile_n) {
     TEST_REQUIRES_X86_SSE;
     for (uint32_t n = 1; n <= 8; n++) {
       GemmMicrokernelTester()
         .mr(3)
         .nr(8)
         .kr(1)
-        .sr(4)
+        .sr(1)
         .m(3)
         .n(n)
-        .k(4)
+        .k(1)
         .iterations(1)
-        .Test(xnn_f32_gemm_minmax_ukernel_3x8s4__sse, xnn_init_f32_minmax_sse_params);
-    }
-  }
-
-  TEST(F32_GEMM_MINMAX_3X8S4__SSE, k_lt_4) {
-    TEST_REQUIRES_X86_SSE;
-    for (size_t k = 1; k < 4; k++) {
-      GemmMicrokernelTester()
-        .mr(3)
-        .nr(8)
-        .kr(1)
-        .sr(4)
-        .m(3)
-        .n(8)
-        .k(k)
-        .Test(xnn_f32_gemm_minmax_ukernel_3x8s4__sse, xnn_init_f32_minmax_sse_params);
-    }
-  }
-
-  TEST(F32_GEMM_MINMAX_3X8S4__SSE, k_lt_4_strided_a) {
-    TEST_REQUIRES_X86_SSE;
-    for (size_t k = 1; k < 4; k++) {
-      GemmMicrokernelTester()
-        .mr(3)
-        .nr(8)
-        .kr(1)
-        .sr(4)
-        .m(3)
-        .n(8)
-        .k(k)
-        .a_stride(7)
-        .Test(xnn_f32_gemm_minmax_ukernel_3x8s4__sse, xnn_init_f32_minmax_sse_params);
-    }
-  }
-
-  TEST(F32_GEMM_MINMAX_3X8S4__SSE, k_lt_4_subtile) {
-    TEST_REQUIRES_X86_SSE;
-    for (size_t k = 1; k < 4; k++) {
-      for (uint32_t n = 1; n <= 8; n++) {
-        for (uint32_t m = 1; m <= 3; m++) {
-          GemmMicrokernelTester()
-            .mr(3)
-            .nr(8)
-            .kr(1)
-            .sr(4)
-            .m(m)
-            .n(n)
-            .k(k)
-            .iterations(1)
-            .Test(xnn_f32_gemm_minmax_ukernel_3x8s4__sse, xnn_init_f32_minmax_sse_params);
-        }
-      }
+        .Test(xnn_f32_gemm_minmax_ukernel_3x8__sse_load1, xnn_init_f32_minmax_sse_params);
     }
   }
 
-  TEST(F32_GEMM_MINMAX_3X8S4__SSE, k_gt_4) {
+  TEST(F32_GEMM_MINMAX_3X8__SSE_LOAD1, k_gt_1) {
     TEST_REQUIRES_X86_SSE;
-    for (size_t k = 5; k < 8; k++) {
+    for (size_t k = 2; k < 10; k++) {
       GemmMicrokernelTester()
         .mr(3)
         .nr(8)
         .kr(1)
-        .sr(4)
+        .sr(1)
         .m(3)
         .n(8)
         .k(k)
-        .Test(xnn_f32_gemm_minmax_ukernel_3x8s4__sse, xnn_init_f32_minmax_sse_params);
+        .Test(xnn_f32_gemm_minmax_ukernel_3x8__sse_load1, xnn_init_f32_minmax_sse_params);
     }
   }
 
-  TEST(F32_GEMM_MINMAX_3X8S4__SSE, k_gt_4_strided_a) {
+  TEST(F32_GEMM_MINMAX_3X8__SSE_LOAD1, k_gt_1_strided_a) {
     TEST_REQUIRES_X86_SSE;
-    for (size_t k = 5; k < 8; k++) {
+    for (size_t k = 2; k < 10; k++) {
       GemmMicrokernelTester()
         .mr(3)
         .nr(8)
         .kr(1)
-        .sr(4)
+        .sr(1)
         .m(3)
         .n(8)
         .k(k)
         .a_stride(11)
-        .Test(xnn_f32_gemm_minmax_ukernel_3x8s4__sse, xnn_init_f32_minmax_sse_params);
-    }
-  }
-
-  TEST(F32_GEMM_MINMAX_3X8S4__SSE, k_gt_4_subtile) {
-    TEST_REQUIRES_X86_SSE;
-    for (size_t k = 5; k < 8; k++) {
-      for (uint32_t n = 1; n <= 8; n++) {
-        for (uint32_t m = 1; m <= 3; m++) {
-          GemmMicrokernelTester()
-            .mr(3)
-            .nr(8)
-            .kr(1)
-            .sr(4)
-            .m(m)
-            .n(n)
-            .k(k)
-            .iterations(1)
-            .Test(xnn_f32_gemm_minmax_ukernel_3x8s4__sse, xnn_init_f32_minmax_sse_params);
-        }
-      }
-    }
-  }
-
-  TEST(F32_GEMM_MINMAX_3X8S4__SSE, k_div_4) {
-    TEST_REQUIRES_X86_SSE;
-    for (size_t k = 8; k <= 40; k += 4) {
-      GemmMicrokernelTester()
-        .mr(3)
-        .nr(8)
-        .kr(1)
-        .sr(4)
-        .m(3)
-        .n(8)
-        .k(k)
-        .Test(xnn_f32_gemm_minmax_ukernel_3x8s4__sse, xnn_init_f32_minmax_sse_params);
-    }
-  }
-
-  TEST(F32_GEMM_MINMAX_3X8S4__SSE, k_div_4_strided_a) {
-    TEST_REQUIRES_X86_SSE;
-    for (size_t k = 8; k <= 40; k += 4) {
-      GemmMicrokernelTester()
-        .mr(3)
-        .nr(8)
-        .kr(1)
-        .sr(4)
-        .m(3)
-        .n(8)
-        .k(k)
-        .a_stride(43)
-        .Test(xnn_f32_gemm_minmax_ukernel_3x8s4__sse, xnn_init_f32_minmax_sse_params);
+        .Test(xnn_f32_gemm_minmax_ukernel_3x8__sse_load1, xnn_init_f32_minmax_sse_params);
     }
   }
 
-  TEST(F32_GEMM_MINMAX_3X8S4__SSE, k_div_4_subtile) {
+  TEST(F32_GEMM_MINMAX_3X8__SSE_LOAD1, k_gt_1_subtile) {
     TEST_REQUIRES_X86_SSE;
-    for (size_t k = 8; k <= 40; k += 4) {
+    for (size_t k = 2; k < 10; k++) {
       for (uint32_t n = 1; n <= 8; n++) {
         for (uint32_t m = 1; m <= 3; m++) {
           GemmMicrokernelTester()
             .mr(3)
             .nr(8)
             .kr(1)
-            .sr(4)
+            .sr(1)
             .m(m)
             .n(n)
             .k(k)
             .iterations(1)
-            .Test(xnn_f32_gemm_minmax_ukernel_3x8s4__sse, xnn_init_f32_minmax_sse_params);
+            .Test(xnn_f32_gemm_minmax_ukernel_3x8__sse_load1, xnn_init_f32_minmax_sse_params);
         }
       }
     }
   }
 
-  TEST(F32_GEMM_MINMAX_3X8S4__SSE, n_gt_8) {
+  TEST(F32_GEMM_MINMAX_3X8__SSE_LOAD1, n_gt_8) {
     TEST_REQUIRES_X86_SSE;
     for (uint32_t n = 9; n < 16; n++) {
-      for (size_t k = 1; k <= 20; k += 5) {
+      for (size_t k = 1; k <= 5; k += 2) {
         GemmMicrokernelTester()
           .mr(3)
           .nr(8)
           .kr(1)
-          .sr(4)
+          .sr(1)
           .m(3)
           .n(n)
           .k(k)
-          .Test(xnn_f32_gemm_minmax_ukernel_3x8s4__sse, xnn_init_f32_minmax_sse_params);
+          .Test(xnn_f32_gemm_minmax_ukernel_3x8__sse_load1, xnn_init_f32_minmax_sse_params);
       }
     }
   }
 
-  TEST(F32_GEMM_MINMAX_3X8S4__SSE, n_gt_8_strided_cn) {
+  TEST(F32_GEMM_MINMAX_3X8__SSE_LOAD1, n_gt_8_strided_cn) {
     TEST_REQUIRES_X86_SSE;
     for (uint32_t n = 9; n < 16; n++) {
-      for (size_t k = 1; k <= 20; k += 5) {
+      for (size_t k = 1; k <= 5; k += 2) {
         GemmMicrokernelTester()
           .mr(3)
           .nr(8)
           .kr(1)
-          .sr(4)
+          .sr(1)
           .m(3)
           .n(n)
           .k(k)
           .cn_stride(11)
-          .Test(xnn_f32_gemm_minmax_ukernel_3x8s4__sse, xnn_init_f32_minmax_sse_params);
+          .Test(xnn_f32_gemm_minmax_ukernel_3x8__sse_load1, xnn_init_f32_minmax_sse_params);
       }
     }
   }
 
-  TEST(F32_GEMM_MINMAX_3X8S4__SSE, n_gt_8_strided_a) {
+  TEST(F32_GEMM_MINMAX_3X8__SSE_LOAD1, n_gt_8_strided_a) {
     TEST_REQUIRES_X86_SSE;
     for (uint32_t n = 9; n < 16; n++) {
-      for (size_t k = 1; k <= 20; k += 5) {
+      for (size_t k = 1; k <= 5; k += 2) {
         GemmMicrokernelTester()
           .mr(3)
           .nr(8)
           .kr(1)
-          .sr(4)
+          .sr(1)
           .m(3)
           .n(n)
           .k(k)
-          .a_stride(23)
-          .Test(xnn_f32_gemm_minmax_ukernel_3x8s4__sse, xnn_init_f32_minmax_sse_params);
+          .a_stride(7)
+          .Test(xnn_f32_gemm_minmax_ukernel_3x8__sse_load1, xnn_init_f32_minmax_sse_params);
       }
     }
   }
 
-  TEST(F32_GEMM_MINMAX_3X8S4__SSE, n_gt_8_subtile) {
+  TEST(F32_GEMM_MINMAX_3X8__SSE_LOAD1, n_gt_8_subtile) {
     TEST_REQUIRES_X86_SSE;
     for (uint32_t n = 9; n < 16; n++) {
-      for (size_t k = 1; k <= 20; k += 5) {
+      for (size_t k = 1; k <= 5; k += 2) {
         for (uint32_t m = 1; m <= 3; m++) {
           GemmMicrokernelTester()
             .mr(3)
             .nr(8)
             .kr(1)
-            .sr(4)
+            .sr(1)
             .m(m)
             .n(n)
             .k(k)
             .iterations(1)
-            .Test(xnn_f32_gemm_minmax_ukernel_3x8s4__sse, xnn_init_f32_minmax_sse_params);
+            .Test(xnn_f32_gemm_minmax_ukernel_3x8__sse_load1, xnn_init_f32_minmax_sse_params);
         }
       }
     }
   }
 
-  TEST(F32_GEMM_MINMAX_3X8S4__SSE, n_div_8) {
+  TEST(F32_GEMM_MINMAX_3X8__SSE_LOAD1, n_div_8) {
     TEST_REQUIRES_X86_SSE;
     for (uint32_t n = 16; n <= 24; n += 8) {
-      for (size_t k = 1; k <= 20; k += 5) {
+      for (size_t k = 1; k <= 5; k += 2) {
         GemmMicrokernelTester()
           .mr(3)
           .nr(8)
           .kr(1)
-          .sr(4)
+          .sr(1)
           .m(3)
           .n(n)
           .k(k)
-          .Test(xnn_f32_gemm_minmax_ukernel_3x8s4__sse, xnn_init_f32_minmax_sse_params);
+          .Test(xnn_f32_gemm_minmax_ukernel_3x8__sse_load1, xnn_init_f32_minmax_sse_params);
       }
     }
   }
 
-  TEST(F32_GEMM_MINMAX_3X8S4__SSE, n_div_8_strided_cn) {
+  TEST(F32_GEMM_MINMAX_3X8__SSE_LOAD1, n_div_8_strided_cn) {
     TEST_REQUIRES_X86_SSE;
     for (uint32_t n = 16; n <= 24; n += 8) {
-      for (size_t k = 1; k <= 20; k += 5) {
+      for (size_t k = 1; k <= 5; k += 2) {
         GemmMicrokernelTester()
           .mr(3)
           .nr(8)
           .kr(1)
-          .sr(4)
+          .sr(1)
           .m(3)
           .n(n)
           .k(k)
           .cn_stride(11)
-          .Test(xnn_f32_gemm_minmax_ukernel_3x8s4__sse, xnn_init_f32_minmax_sse_params);
+          .Test(xnn_f32_gemm_minmax_ukernel_3x8__sse_load1, xnn_init_f32_minmax_sse_params);
       }
     }
   }
 
-  TEST(F32_GEMM_MINMAX_3X8S4__SSE, n_div_8_strided_a) {
+  TEST(F32_GEMM_MINMAX_3X8__SSE_LOAD1, n_div_8_strided_a) {
     TEST_REQUIRES_X86_SSE;
     for (uint32_t n = 16; n <= 24; n += 8) {
-      for (size_t k = 1; k <= 20; k += 5) {
+      for (size_t k = 1; k <= 5; k += 2) {
         GemmMicrokernelTester()
           .mr(3)
           .nr(8)
           .kr(1)
-          .sr(4)
+          .sr(1)
           .m(3)
           .n(n)
           .k(k)
-          .a_stride(23)
-          .Test(xnn_f32_gemm_minmax_ukernel_3x8s4__sse, xnn_init_f32_minmax_sse_params);
+          .a_stride(7)
+          .Test(xnn_f32_gemm_minmax_ukernel_3x8__sse_load1, xnn_init_f32_minmax_sse_params);
       }
     }
   }
 
-  TEST(F32_GEMM_MINMAX_3X8S4__SSE, n_div_8_subtile) {
+  TEST(F32_GEMM_MINMAX_3X8__SSE_LOAD1, n_div_8_subtile) {
     TEST_REQUIRES_X86_SSE;
     for (uint32_t n = 16; n <= 24; n += 8) {
-      for (size_t k = 1; k <= 20; k += 5) {
+      for (size_t k = 1; k <= 5; k += 2) {
         for (uint32_t m = 1; m <= 3; m++) {
           GemmMicrokernelTester()
             .mr(3)
             .nr(8)
             .kr(1)
-            .sr(4)
+            .sr(1)
             .m(m)
             .n(n)
             .k(k)
             .iterations(1)
-            .Test(xnn_f32_gemm_minmax_ukernel_3x8s4__sse, xnn_init_f32_minmax_sse_params);
+            .Test(xnn_f32_gemm_minmax_ukernel_3x8__sse_load1, xnn_init_f32_minmax_sse_params);
         }
       }
     }
   }
 
-  TEST(F32_GEMM_MINMAX_3X8S4__SSE, strided_cm_subtile) {
+  TEST(F32_GEMM_MINMAX_3X8__SSE_LOAD1, strided_cm_subtile) {
     TEST_REQUIRES_X86_SSE;
-    for (size_t k = 1; k <= 20; k += 5) {
+    for (size_t k = 1; k <= 5; k += 2) {
       for (uint32_t n = 1; n <= 8; n++) {
         for (uint32_t m = 1; m <= 3; m++) {
           GemmMicrokernelTester()
             .mr(3)
             .nr(8)
             .kr(1)
-            .sr(4)
+            .sr(1)
             .m(m)
             .n(n)
             .k(k)
             .cm_stride(11)
             .iterations(1)
-            .Test(xnn_f32_gemm_minmax_ukernel_3x8s4__sse, xnn_init_f32_minmax_sse_params);
+            .Test(xnn_f32_gemm_minmax_ukernel_3x8__sse_load1, xnn_init_f32_minmax_sse_params);
         }
       }
     }
   }
 
-  TEST(F32_GEMM_MINMAX_3X8S4__SSE, qmin) {
+  TEST(F32_GEMM_MINMAX_3X8__SSE_LOAD1, qmin) {
     TEST_REQUIRES_X86_SSE;
     GemmMicrokernelTester()
       .mr(3)
       .nr(8)
       .kr(1)
-      .sr(4)
+      .sr(1)
       .m(3)
       .n(8)
-      .k(4)
+      .k(1)
       .qmin(128)
-      .Test(xnn_f32_gemm_minmax_ukernel_3x8s4__sse, xnn_init_f32_minmax_sse_params);
+      .Test(xnn_f32_gemm_minmax_ukernel_3x8__sse_load1, xnn_init_f32_minmax_sse_params);
   }
 
-  TEST(F32_GEMM_MINMAX_3X8S4__SSE, qmax) {
+  TEST(F32_GEMM_MINMAX_3X8__SSE_LOAD1, qmax) {
     TEST_REQUIRES_X86_SSE;
     GemmMicrokernelTester()
       .mr(3)
       .nr(8)
       .kr(1)
-      .sr(4)
+      .sr(1)
       .m(3)
       .n(8)
-      .k(4)
+      .k(1)
       .qmax(128)
-      .Test(xnn_f32_gemm_minmax_ukernel_3x8s4__sse, xnn_init_f32_minmax_sse_params);
+      .Test(xnn_f32_gemm_minmax_ukernel_3x8__sse_load1, xnn_init_f32_minmax_sse_params);
   }
 
-  TEST(F32_GEMM_MINMAX_3X8S4__SSE, strided_cm) {
+  TEST(F32_GEMM_MINMAX_3X8__SSE_LOAD1, strided_cm) {
     TEST_REQUIRES_X86_SSE;
     GemmMicrokernelTester()
       .mr(3)
       .nr(8)
       .kr(1)
-      .sr(4)
+      .sr(1)
       .m(3)
       .n(8)
-      .k(4)
+      .k(1)
       .cm_stride(11)
-      .Test(xnn_f32_gemm_minmax_ukernel_3x8s4__sse, xnn_init_f32_minmax_sse_params);
+      .Test(xnn_f32_gemm_minmax_ukernel_3x8__sse_load1, xnn_init_f32_minmax_sse_params);
   }
 #endif  // XNN_ARCH_X86 || XNN_ARCH_X86_64
 
 
 #if XNN_ARCH_X86 || XNN_ARCH_X86_64
-  TEST(F32_GEMM_MINMAX_4X8__SSE_LOAD1, k_eq_1) {
+  TEST(F32_GEMM_MINMAX_3X8S4__SSE, k_eq_4) {
     TEST_REQUIRES_X86_SSE;
     GemmMicrokernelTester()
-      .mr(4)
+      .mr(3)
       .nr(8)
       .kr(1)
-      .sr(1)
-      .m(4)
+      .sr(4)
+      .m(3)
       .n(8)
-      .k(1)
-      .Test(xnn_f32_gemm_minmax_ukernel_4x8__sse_load1, xnn_init_f32_minmax_sse_params);
+      .k(4)
+      .Test(xnn_f32_gemm_minmax_ukernel_3x8s4__sse, xnn_init_f32_minmax_sse_params);
   }
 
-  TEST(F32_GEMM_MINMAX_4X8__SSE_LOAD1, strided_cn) {
+  TEST(F32_GEMM_MINMAX_3X8S4__SSE, strided_cn) {
     TEST_REQUIRES_X86_SSE;
     GemmMicrokernelTester()
-      .mr(4)
+      .mr(3)
       .nr(8)
       .kr(1)
-      .sr(1)
-      .m(4)
+      .sr(4)
+      .m(3)
       .n(8)
-      .k(1)
+      .k(4)
       .cn_stride(11)
-      .Test(xnn_f32_gemm_minmax_ukernel_4x8__sse_load1, xnn_init_f32_minmax_sse_params);
+      .Test(xnn_f32_gemm_minmax_ukernel_3x8s4__sse, xnn_init_f32_minmax_sse_params);
   }
 
-  TEST(F32_GEMM_MINMAX_4X8__SSE_LOAD1, k_eq_1_strided_a) {
+  TEST(F32_GEMM_MINMAX_3X8S4__SSE, k_eq_4_strided_a) {
     TEST_REQUIRES_X86_SSE;
     GemmMicrokernelTester()
-      .mr(4)
+      .mr(3)
       .nr(8)
       .kr(1)
-      .sr(1)
-      .m(4)
+      .sr(4)
+      .m(3)
       .n(8)
-      .k(1)
-      .a_stride(3)
-      .Test(xnn_f32_gemm_minmax_ukernel_4x8__sse_load1, xnn_init_f32_minmax_sse_params);
+      .k(4)
+      .a_stride(7)
+      .Test(xnn_f32_gemm_minmax_ukernel_3x8s4__sse, xnn_init_f32_minmax_sse_params);
   }
 
-  TEST(F32_GEMM_MINMAX_4X8__SSE_LOAD1, k_eq_1_subtile) {
+  TEST(F32_GEMM_MINMAX_3X8S4__SSE, k_eq_4_subtile) {
     TEST_REQUIRES_X86_SSE;
     for (uint32_t n = 1; n <= 8; n++) {
-      for (uint32_t m = 1; m <= 4; m++) {
+      for (uint32_t m = 1; m <= 3; m++) {
         GemmMicrokernelTester()
-          .mr(4)
+          .mr(3)
           .nr(8)
           .kr(1)
-          .sr(1)
+          .sr(4)
           .m(m)
           .n(n)
-          .k(1)
+          .k(4)
           .iterations(1)
-          .Test(xnn_f32_gemm_minmax_ukernel_4x8__sse_load1, xnn_init_f32_minmax_sse_params);
+          .Test(xnn_f32_gemm_minmax_ukernel_3x8s4__sse, xnn_init_f32_minmax_sse_params);
       }
     }
   }
 
-  TEST(F32_GEMM_MINMAX_4X8__SSE_LOAD1, k_eq_1_subtile_m) {
+  TEST(F32_GEMM_MINMAX_3X8S4__SSE, k_eq_4_subtile_m) {
     TEST_REQUIRES_X86_SSE;
-    for (uint32_t m = 1; m <= 4; m++) {
+    for (uint32_t m = 1; m <= 3; m++) {
       GemmMicrokernelTester()
-        .mr(4)
+        .mr(3)
         .nr(8)
         .kr(1)
-        .sr(1)
+        .sr(4)
         .m(m)
         .n(8)
-        .k(1)
+        .k(4)
         .iterations(1)
-        .Test(xnn_f32_gemm_minmax_ukernel_4x8__sse_load1, xnn_init_f32_minmax_sse_params);
+        .Test(xnn_f32_gemm_minmax_ukernel_3x8s4__sse, xnn_init_f32_minmax_sse_params);
     }
   }
 
-  TEST(F32_GEMM_MINMAX_4X8__SSE_LOAD1, k_eq_1_subtile_n) {
+  TEST(F32_GEMM_MINMAX_3X8S4__SSE, k_eq_4_subtile_n) {
     TEST_REQUIRES_X86_SSE;
     for (uint32_t n = 1; n <= 8; n++) {
       GemmMicrokernelTester()
-        .mr(4)
+        .mr(3)
         .nr(8)
         .kr(1)
-        .sr(1)
-        .m(4)
+        .sr(4)
+        .m(3)
         .n(n)
-        .k(1)
+        .k(4)
         .iterations(1)
-        .Test(xnn_f32_gemm_minmax_ukernel_4x8__sse_load1, xnn_init_f32_minmax_sse_params);
+        .Test(xnn_f32_gemm_minmax_ukernel_3x8s4__sse, xnn_init_f32_minmax_sse_params);
     }
   }
 
-  TEST(F32_GEMM_MINMAX_4X8__SSE_LOAD1, k_gt_1) {
+  TEST(F32_GEMM_MINMAX_3X8S4__SSE, k_lt_4) {
     TEST_REQUIRES_X86_SSE;
-    for (size_t k = 2; k < 10; k++) {
+    for (size_t k = 1; k < 4; k++) {
       GemmMicrokernelTester()
-        .mr(4)
+        .mr(3)
         .nr(8)
         .kr(1)
-        .sr(1)
-        .m(4)
+        .sr(4)
+        .m(3)
         .n(8)
         .k(k)
-        .Test(xnn_f32_gemm_minmax_ukernel_4x8__sse_load1, xnn_init_f32_minmax_sse_params);
+        .Test(xnn_f32_gemm_minmax_ukernel_3x8s4__sse, xnn_init_f32_minmax_sse_params);
     }
   }
 
-  TEST(F32_GEMM_MINMAX_4X8__SSE_LOAD1, k_gt_1_strided_a) {
+  TEST(F32_GEMM_MINMAX_3X8S4__SSE, k_lt_4_strided_a) {
     TEST_REQUIRES_X86_SSE;
-    for (size_t k = 2; k < 10; k++) {
+    for (size_t k = 1; k < 4; k++) {
       GemmMicrokernelTester()
-        .mr(4)
+        .mr(3)
         .nr(8)
         .kr(1)
-        .sr(1)
-        .m(4)
+        .sr(4)
+        .m(3)
         .n(8)
         .k(k)
-        .a_stride(11)
-        .Test(xnn_f32_gemm_minmax_ukernel_4x8__sse_load1, xnn_init_f32_minmax_sse_params);
+        .a_stride(7)
+        .Test(xnn_f32_gemm_minmax_ukernel_3x8s4__sse, xnn_init_f32_minmax_sse_params);
     }
   }
 
-  TEST(F32_GEMM_MINMAX_4X8__SSE_LOAD1, k_gt_1_subtile) {
+  TEST(F32_GEMM_MINMAX_3X8S4__SSE, k_lt_4_subtile) {
     TEST_REQUIRES_X86_SSE;
-    for (size_t k = 2; k < 10; k++) {
+    for (size_t k = 1; k < 4; k++) {
       for (uint32_t n = 1; n <= 8; n++) {
-        for (uint32_t m = 1; m <= 4; m++) {
+        for (uint32_t m = 1; m <= 3; m++) {
           GemmMicrokernelTester()
-            .mr(4)
+            .mr(3)
             .nr(8)
             .kr(1)
-            .sr(1)
+            .sr(4)
             .m(m)
             .n(n)
             .k(k)
             .iterations(1)
-            .Test(xnn_f32_gemm_minmax_ukernel_4x8__sse_load1, xnn_init_f32_minmax_sse_params);
+            .Test(xnn_f32_gemm_minmax_ukernel_3x8s4__sse, xnn_init_f32_minmax_sse_params);
         }
       }
     }
   }
 
-  TEST(F32_GEMM_MINMAX_4X8__SSE_LOAD1, n_gt_8) {
-    TEST_REQUIRES_X86_SSE;
-    for (uint32_t n = 9; n < 16; n++) {
-      for (size_t k = 1; k <= 5; k += 2) {
-        GemmMicrokernelTester()
-          .mr(4)
-          .nr(8)
-          .kr(1)
-          .sr(1)
-          .m(4)
-          .n(n)
-          .k(k)
-          .Test(xnn_f32_gemm_minmax_ukernel_4x8__sse_load1, xnn_init_f32_minmax_sse_params);
-      }
-    }
-  }
-
-  TEST(F32_GEMM_MINMAX_4X8__SSE_LOAD1, n_gt_8_strided_cn) {
+  TEST(F32_GEMM_MINMAX_3X8S4__SSE, k_gt_4) {
     TEST_REQUIRES_X86_SSE;
-    for (uint32_t n = 9; n < 16; n++) {
-      for (size_t k = 1; k <= 5; k += 2) {
-        GemmMicrokernelTester()
-          .mr(4)
-          .nr(8)
-          .kr(1)
-          .sr(1)
-          .m(4)
-          .n(n)
-          .k(k)
-          .cn_stride(11)
-          .Test(xnn_f32_gemm_minmax_ukernel_4x8__sse_load1, xnn_init_f32_minmax_sse_params);
-      }
+    for (size_t k = 5; k < 8; k++) {
+      GemmMicrokernelTester()
+        .mr(3)
+        .nr(8)
+        .kr(1)
+        .sr(4)
+        .m(3)
+        .n(8)
+        .k(k)
+        .Test(xnn_f32_gemm_minmax_ukernel_3x8s4__sse, xnn_init_f32_minmax_sse_params);
     }
   }
 
-  TEST(F32_GEMM_MINMAX_4X8__SSE_LOAD1, n_gt_8_strided_a) {
+  TEST(F32_GEMM_MINMAX_3X8S4__SSE, k_gt_4_strided_a) {
     TEST_REQUIRES_X86_SSE;
-    for (uint32_t n = 9; n < 16; n++) {
-      for (size_t k = 1; k <= 5; k += 2) {
-        GemmMicrokernelTester()
-          .mr(4)
-          .nr(8)
-          .kr(1)
-          .sr(1)
-          .m(4)
-          .n(n)
-          .k(k)
-          .a_stride(7)
-          .Test(xnn_f32_gemm_minmax_ukernel_4x8__sse_load1, xnn_init_f32_minmax_sse_params);
-      }
+    for (size_t k = 5; k < 8; k++) {
+      GemmMicrokernelTester()
+        .mr(3)
+        .nr(8)
+        .kr(1)
+        .sr(4)
+        .m(3)
+        .n(8)
+        .k(k)
+        .a_stride(11)
+        .Test(xnn_f32_gemm_minmax_ukernel_3x8s4__sse, xnn_init_f32_minmax_sse_params);
     }
   }
 
-  TEST(F32_GEMM_MINMAX_4X8__SSE_LOAD1, n_gt_8_subtile) {
+  TEST(F32_GEMM_MINMAX_3X8S4__SSE, k_gt_4_subtile) {
     TEST_REQUIRES_X86_SSE;
-    for (uint32_t n = 9; n < 16; n++) {
-      for (size_t k = 1; k <= 5; k += 2) {
-        for (uint32_t m = 1; m <= 4; m++) {
+    for (size_t k = 5; k < 8; k++) {
+      for (uint32_t n = 1; n <= 8; n++) {
+        for (uint32_t m = 1; m <= 3; m++) {
           GemmMicrokernelTester()
-            .mr(4)
+            .mr(3)
             .nr(8)
             .kr(1)
-            .sr(1)
+            .sr(4)
             .m(m)
             .n(n)
             .k(k)
             .iterations(1)
-            .Test(xnn_f32_gemm_minmax_ukernel_4x8__sse_load1, xnn_init_f32_minmax_sse_params);
+            .Test(xnn_f32_gemm_minmax_ukernel_3x8s4__sse, xnn_init_f32_minmax_sse_params);
         }
       }
     }
   }
 
-  TEST(F32_GEMM_MINMAX_4X8__SSE_LOAD1, n_div_8) {
+  TEST(F32_GEMM_MINMAX_3X8S4__SSE, k_div_4) {
     TEST_REQUIRES_X86_SSE;
-    for (uint32_t n = 16; n <= 24; n += 8) {
-      for (size_t k = 1; k <= 5; k += 2) {
-        GemmMicrokernelTester()
-          .mr(4)
-          .nr(8)
-          .kr(1)
-          .sr(1)
-          .m(4)
-          .n(n)
-          .k(k)
-          .Test(xnn_f32_gemm_minmax_ukernel_4x8__sse_load1, xnn_init_f32_minmax_sse_params);
-      }
+    for (size_t k = 8; k <= 40; k += 4) {
+      GemmMicrokernelTester()
+        .mr(3)
+        .nr(8)
+        .kr(1)
+        .sr(4)
+        .m(3)
+        .n(8)
+        .k(k)
+        .Test(xnn_f32_gemm_minmax_ukernel_3x8s4__sse, xnn_init_f32_minmax_sse_params);
     }
   }
 
-  TEST(F32_GEMM_MINMAX_4X8__SSE_LOAD1, n_div_8_strided_cn) {
+  TEST(F32_GEMM_MINMAX_3X8S4__SSE, k_div_4_strided_a) {
+    TEST_REQUIRES_X86_SSE;
+    for (size_t k = 8; k <= 40; k += 4) {
+      GemmMicrokernelTester()
+        .mr(3)
+        .nr(8)
+        .kr(1)
+        .sr(4)
+        .m(3)
+        .n(8)
+        .k(k)
+        .a_stride(43)
+        .Test(xnn_f32_gemm_minmax_ukernel_3x8s4__sse, xnn_init_f32_minmax_sse_params);
+    }
+  }
+
+  TEST(F32_GEMM_MINMAX_3X8S4__SSE, k_div_4_subtile) {
+    TEST_REQUIRES_X86_SSE;
+    for (size_t k = 8; k <= 40; k += 4) {
+      for (uint32_t n = 1; n <= 8; n++) {
+        for (uint32_t m = 1; m <= 3; m++) {
+          GemmMicrokernelTester()
+            .mr(3)
+            .nr(8)
+            .kr(1)
+            .sr(4)
+            .m(m)
+            .n(n)
+            .k(k)
+            .iterations(1)
+            .Test(xnn_f32_gemm_minmax_ukernel_3x8s4__sse, xnn_init_f32_minmax_sse_params);
+        }
+      }
+    }
+  }
+
+  TEST(F32_GEMM_MINMAX_3X8S4__SSE, n_gt_8) {
+    TEST_REQUIRES_X86_SSE;
+    for (uint32_t n = 9; n < 16; n++) {
+      for (size_t k = 1; k <= 20; k += 5) {
+        GemmMicrokernelTester()
+          .mr(3)
+          .nr(8)
+          .kr(1)
+          .sr(4)
+          .m(3)
+          .n(n)
+          .k(k)
+          .Test(xnn_f32_gemm_minmax_ukernel_3x8s4__sse, xnn_init_f32_minmax_sse_params);
+      }
+    }
+  }
+
+  TEST(F32_GEMM_MINMAX_3X8S4__SSE, n_gt_8_strided_cn) {
+    TEST_REQUIRES_X86_SSE;
+    for (uint32_t n = 9; n < 16; n++) {
+      for (size_t k = 1; k <= 20; k += 5) {
+        GemmMicrokernelTester()
+          .mr(3)
+          .nr(8)
+          .kr(1)
+          .sr(4)
+          .m(3)
+          .n(n)
+          .k(k)
+          .cn_stride(11)
+          .Test(xnn_f32_gemm_minmax_ukernel_3x8s4__sse, xnn_init_f32_minmax_sse_params);
+      }
+    }
+  }
+
+  TEST(F32_GEMM_MINMAX_3X8S4__SSE, n_gt_8_strided_a) {
+    TEST_REQUIRES_X86_SSE;
+    for (uint32_t n = 9; n < 16; n++) {
+      for (size_t k = 1; k <= 20; k += 5) {
+        GemmMicrokernelTester()
+          .mr(3)
+          .nr(8)
+          .kr(1)
+          .sr(4)
+          .m(3)
+          .n(n)
+          .k(k)
+          .a_stride(23)
+          .Test(xnn_f32_gemm_minmax_ukernel_3x8s4__sse, xnn_init_f32_minmax_sse_params);
+      }
+    }
+  }
+
+  TEST(F32_GEMM_MINMAX_3X8S4__SSE, n_gt_8_subtile) {
+    TEST_REQUIRES_X86_SSE;
+    for (uint32_t n = 9; n < 16; n++) {
+      for (size_t k = 1; k <= 20; k += 5) {
+        for (uint32_t m = 1; m <= 3; m++) {
+          GemmMicrokernelTester()
+            .mr(3)
+            .nr(8)
+            .kr(1)
+            .sr(4)
+            .m(m)
+            .n(n)
+            .k(k)
+            .iterations(1)
+            .Test(xnn_f32_gemm_minmax_ukernel_3x8s4__sse, xnn_init_f32_minmax_sse_params);
+        }
+      }
+    }
+  }
+
+  TEST(F32_GEMM_MINMAX_3X8S4__SSE, n_div_8) {
     TEST_REQUIRES_X86_SSE;
     for (uint32_t n = 16; n <= 24; n += 8) {
-      for (size_t k = 1; k <= 5; k += 2) {
+      for (size_t k = 1; k <= 20; k += 5) {
         GemmMicrokernelTester()
-          .mr(4)
+          .mr(3)
           .nr(8)
           .kr(1)
-          .sr(1)
-          .m(4)
+          .sr(4)
+          .m(3)
+          .n(n)
+          .k(k)
+          .Test(xnn_f32_gemm_minmax_ukernel_3x8s4__sse, xnn_init_f32_minmax_sse_params);
+      }
+    }
+  }
+
+  TEST(F32_GEMM_MINMAX_3X8S4__SSE, n_div_8_strided_cn) {
+    TEST_REQUIRES_X86_SSE;
+    for (uint32_t n = 16; n <= 24; n += 8) {
+      for (size_t k = 1; k <= 20; k += 5) {
+        GemmMicrokernelTester()
+          .mr(3)
+          .nr(8)
+          .kr(1)
+          .sr(4)
+          .m(3)
           .n(n)
           .k(k)
           .cn_stride(11)
-          .Test(xnn_f32_gemm_minmax_ukernel_4x8__sse_load1, xnn_init_f32_minmax_sse_params);
+          .Test(xnn_f32_gemm_minmax_ukernel_3x8s4__sse, xnn_init_f32_minmax_sse_params);
       }
     }
   }
 
-  TEST(F32_GEMM_MINMAX_4X8__SSE_LOAD1, n_div_8_strided_a) {
+  TEST(F32_GEMM_MINMAX_3X8S4__SSE, n_div_8_strided_a) {
     TEST_REQUIRES_X86_SSE;
     for (uint32_t n = 16; n <= 24; n += 8) {
-      for (size_t k = 1; k <= 5; k += 2) {
+      for (size_t k = 1; k <= 20; k += 5) {
         GemmMicrokernelTester()
-          .mr(4)
+          .mr(3)
           .nr(8)
           .kr(1)
-          .sr(1)
-          .m(4)
+          .sr(4)
+          .m(3)
           .n(n)
           .k(k)
-          .a_stride(7)
-          .Test(xnn_f32_gemm_minmax_ukernel_4x8__sse_load1, xnn_init_f32_minmax_sse_params);
+          .a_stride(23)
+          .Test(xnn_f32_gemm_minmax_ukernel_3x8s4__sse, xnn_init_f32_minmax_sse_params);
       }
     }
   }
 
-  TEST(F32_GEMM_MINMAX_4X8__SSE_LOAD1, n_div_8_subtile) {
+  TEST(F32_GEMM_MINMAX_3X8S4__SSE, n_div_8_subtile) {
     TEST_REQUIRES_X86_SSE;
     for (uint32_t n = 16; n <= 24; n += 8) {
-      for (size_t k = 1; k <= 5; k += 2) {
-        for (uint32_t m = 1; m <= 4; m++) {
+      for (size_t k = 1; k <= 20; k += 5) {
+        for (uint32_t m = 1; m <= 3; m++) {
           GemmMicrokernelTester()
-            .mr(4)
+            .mr(3)
             .nr(8)
             .kr(1)
-            .sr(1)
+            .sr(4)
             .m(m)
             .n(n)
             .k(k)
             .iterations(1)
-            .Test(xnn_f32_gemm_minmax_ukernel_4x8__sse_load1, xnn_init_f32_minmax_sse_params);
+            .Test(xnn_f32_gemm_minmax_ukernel_3x8s4__sse, xnn_init_f32_minmax_sse_params);
         }
       }
     }
   }
 
-  TEST(F32_GEMM_MINMAX_4X8__SSE_LOAD1, strided_cm_subtile) {
+  TEST(F32_GEMM_MINMAX_3X8S4__SSE, strided_cm_subtile) {
     TEST_REQUIRES_X86_SSE;
-    for (size_t k = 1; k <= 5; k += 2) {
+    for (size_t k = 1; k <= 20; k += 5) {
       for (uint32_t n = 1; n <= 8; n++) {
-        for (uint32_t m = 1; m <= 4; m++) {
+        for (uint32_t m = 1; m <= 3; m++) {
           GemmMicrokernelTester()
-            .mr(4)
+            .mr(3)
             .nr(8)
             .kr(1)
-            .sr(1)
+            .sr(4)
             .m(m)
             .n(n)
             .k(k)
             .cm_stride(11)
             .iterations(1)
-            .Test(xnn_f32_gemm_minmax_ukernel_4x8__sse_load1, xnn_init_f32_minmax_sse_params);
+            .Test(xnn_f32_gemm_minmax_ukernel_3x8s4__sse, xnn_init_f32_minmax_sse_params);
         }
       }
     }
   }
 
-  TEST(F32_GEMM_MINMAX_4X8__SSE_LOAD1, qmin) {
+  TEST(F32_GEMM_MINMAX_3X8S4__SSE, qmin) {
     TEST_REQUIRES_X86_SSE;
     GemmMicrokernelTester()
-      .mr(4)
+      .mr(3)
       .nr(8)
       .kr(1)
-      .sr(1)
-      .m(4)
+      .sr(4)
+      .m(3)
       .n(8)
-      .k(1)
+      .k(4)
       .qmin(128)
-      .Test(xnn_f32_gemm_minmax_ukernel_4x8__sse_load1, xnn_init_f32_minmax_sse_params);
+      .Test(xnn_f32_gemm_minmax_ukernel_3x8s4__sse, xnn_init_f32_minmax_sse_params);
   }
 
-  TEST(F32_GEMM_MINMAX_4X8__SSE_LOAD1, qmax) {
+  TEST(F32_GEMM_MINMAX_3X8S4__SSE, qmax) {
     TEST_REQUIRES_X86_SSE;
     GemmMicrokernelTester()
-      .mr(4)
+      .mr(3)
       .nr(8)
       .kr(1)
-      .sr(1)
-      .m(4)
+      .sr(4)
+      .m(3)
       .n(8)
-      .k(1)
+      .k(4)
       .qmax(128)
-      .Test(xnn_f32_gemm_minmax_ukernel_4x8__sse_load1, xnn_init_f32_minmax_sse_params);
+      .Test(xnn_f32_gemm_minmax_ukernel_3x8s4__sse, xnn_init_f32_minmax_sse_params);
   }
 
-  TEST(F32_GEMM_MINMAX_4X8__SSE_LOAD1, strided_cm) {
+  TEST(F32_GEMM_MINMAX_3X8S4__SSE, strided_cm) {
     TEST_REQUIRES_X86_SSE;
     GemmMicrokernelTester()
-      .mr(4)
+      .mr(3)
       .nr(8)
       .kr(1)
-      .sr(1)
-      .m(4)
+      .sr(4)
+      .m(3)
       .n(8)
-      .k(1)
+      .k(4)
       .cm_stride(11)
-      .Test(xnn_f32_gemm_minmax_ukernel_4x8__sse_load1, xnn_init_f32_minmax_sse_params);
+      .Test(xnn_f32_gemm_minmax_ukernel_3x8s4__sse, xnn_init_f32_minmax_sse_params);
   }
 #endif  // XNN_ARCH_X86 || XNN_ARCH_X86_64
 
 
 #if XNN_ARCH_X86 || XNN_ARCH_X86_64
-  TEST(F32_GEMM_MINMAX_5X8__SSE_DUP, k_eq_4) {
+  TEST(F32_GEMM_MINMAX_4X8__SSE_LOAD1, k_eq_1) {
     TEST_REQUIRES_X86_SSE;
     GemmMicrokernelTester()
-      .mr(5)
+      .mr(4)
       .nr(8)
       .kr(1)
       .sr(1)
-      .m(5)
+      .m(4)
       .n(8)
-      .k(4)
-      .Test(xnn_f32_gemm_minmax_ukernel_5x8__sse_dup, xnn_init_f32_minmax_sse_params);
+      .k(1)
+      .Test(xnn_f32_gemm_minmax_ukernel_4x8__sse_load1, xnn_init_f32_minmax_sse_params);
   }
 
-  TEST(F32_GEMM_MINMAX_5X8__SSE_DUP, strided_cn) {
+  TEST(F32_GEMM_MINMAX_4X8__SSE_LOAD1, strided_cn) {
     TEST_REQUIRES_X86_SSE;
     GemmMicrokernelTester()
-      .mr(5)
+      .mr(4)
       .nr(8)
       .kr(1)
       .sr(1)
-      .m(5)
+      .m(4)
       .n(8)
-      .k(4)
+      .k(1)
       .cn_stride(11)
-      .Test(xnn_f32_gemm_minmax_ukernel_5x8__sse_dup, xnn_init_f32_minmax_sse_params);
+      .Test(xnn_f32_gemm_minmax_ukernel_4x8__sse_load1, xnn_init_f32_minmax_sse_params);
   }
 
-  TEST(F32_GEMM_MINMAX_5X8__SSE_DUP, k_eq_4_strided_a) {
+  TEST(F32_GEMM_MINMAX_4X8__SSE_LOAD1, k_eq_1_strided_a) {
     TEST_REQUIRES_X86_SSE;
     GemmMicrokernelTester()
-      .mr(5)
+      .mr(4)
       .nr(8)
       .kr(1)
       .sr(1)
-      .m(5)
+      .m(4)
       .n(8)
-      .k(4)
-      .a_stride(7)
-      .Test(xnn_f32_gemm_minmax_ukernel_5x8__sse_dup, xnn_init_f32_minmax_sse_params);
+      .k(1)
+      .a_stride(3)
+      .Test(xnn_f32_gemm_minmax_ukernel_4x8__sse_load1, xnn_init_f32_minmax_sse_params);
   }
 
-  TEST(F32_GEMM_MINMAX_5X8__SSE_DUP, k_eq_4_subtile) {
+  TEST(F32_GEMM_MINMAX_4X8__SSE_LOAD1, k_eq_1_subtile) {
     TEST_REQUIRES_X86_SSE;
     for (uint32_t n = 1; n <= 8; n++) {
-      for (uint32_t m = 1; m <= 5; m++) {
+      for (uint32_t m = 1; m <= 4; m++) {
         GemmMicrokernelTester()
-          .mr(5)
+          .mr(4)
           .nr(8)
           .kr(1)
           .sr(1)
           .m(m)
           .n(n)
-          .k(4)
+          .k(1)
           .iterations(1)
-          .Test(xnn_f32_gemm_minmax_ukernel_5x8__sse_dup, xnn_init_f32_minmax_sse_params);
+          .Test(xnn_f32_gemm_minmax_ukernel_4x8__sse_load1, xnn_init_f32_minmax_sse_params);
       }
     }
   }
 
-  TEST(F32_GEMM_MINMAX_5X8__SSE_DUP, k_eq_4_subtile_m) {
+  TEST(F32_GEMM_MINMAX_4X8__SSE_LOAD1, k_eq_1_subtile_m) {
     TEST_REQUIRES_X86_SSE;
-    for (uint32_t m = 1; m <= 5; m++) {
+    for (uint32_t m = 1; m <= 4; m++) {
       GemmMicrokernelTester()
-        .mr(5)
+        .mr(4)
         .nr(8)
         .kr(1)
         .sr(1)
         .m(m)
         .n(8)
-        .k(4)
+        .k(1)
         .iterations(1)
-        .Test(xnn_f32_gemm_minmax_ukernel_5x8__sse_dup, xnn_init_f32_minmax_sse_params);
+        .Test(xnn_f32_gemm_minmax_ukernel_4x8__sse_load1, xnn_init_f32_minmax_sse_params);
     }
   }
 
-  TEST(F32_GEMM_MINMAX_5X8__SSE_DUP, k_eq_4_subtile_n) {
+  TEST(F32_GEMM_MINMAX_4X8__SSE_LOAD1, k_eq_1_subtile_n) {
     TEST_REQUIRES_X86_SSE;
     for (uint32_t n = 1; n <= 8; n++) {
       GemmMicrokernelTester()
-        .mr(5)
+        .mr(4)
         .nr(8)
         .kr(1)
         .sr(1)
-        .m(5)
+        .m(4)
         .n(n)
-        .k(4)
+        .k(1)
         .iterations(1)
-        .Test(xnn_f32_gemm_minmax_ukernel_5x8__sse_dup, xnn_init_f32_minmax_sse_params);
-    }
-  }
-
-  TEST(F32_GEMM_MINMAX_5X8__SSE_DUP, k_lt_4) {
-    TEST_REQUIRES_X86_SSE;
-    for (size_t k = 1; k < 4; k++) {
-      GemmMicrokernelTester()
-        .mr(5)
-        .nr(8)
-        .kr(1)
-        .sr(1)
-        .m(5)
-        .n(8)
-        .k(k)
-        .Test(xnn_f32_gemm_minmax_ukernel_5x8__sse_dup, xnn_init_f32_minmax_sse_params);
-    }
-  }
-
-  TEST(F32_GEMM_MINMAX_5X8__SSE_DUP, k_lt_4_strided_a) {
-    TEST_REQUIRES_X86_SSE;
-    for (size_t k = 1; k < 4; k++) {
-      GemmMicrokernelTester()
-        .mr(5)
-        .nr(8)
-        .kr(1)
-        .sr(1)
-        .m(5)
-        .n(8)
-        .k(k)
-        .a_stride(7)
-        .Test(xnn_f32_gemm_minmax_ukernel_5x8__sse_dup, xnn_init_f32_minmax_sse_params);
-    }
-  }
-
-  TEST(F32_GEMM_MINMAX_5X8__SSE_DUP, k_lt_4_subtile) {
-    TEST_REQUIRES_X86_SSE;
-    for (size_t k = 1; k < 4; k++) {
-      for (uint32_t n = 1; n <= 8; n++) {
-        for (uint32_t m = 1; m <= 5; m++) {
-          GemmMicrokernelTester()
-            .mr(5)
-            .nr(8)
-            .kr(1)
-            .sr(1)
-            .m(m)
-            .n(n)
-            .k(k)
-            .iterations(1)
-            .Test(xnn_f32_gemm_minmax_ukernel_5x8__sse_dup, xnn_init_f32_minmax_sse_params);
-        }
-      }
+        .Test(xnn_f32_gemm_minmax_ukernel_4x8__sse_load1, xnn_init_f32_minmax_sse_params);
     }
   }
 
-  TEST(F32_GEMM_MINMAX_5X8__SSE_DUP, k_gt_4) {
+  TEST(F32_GEMM_MINMAX_4X8__SSE_LOAD1, k_gt_1) {
     TEST_REQUIRES_X86_SSE;
-    for (size_t k = 5; k < 8; k++) {
+    for (size_t k = 2; k < 10; k++) {
       GemmMicrokernelTester()
-        .mr(5)
+        .mr(4)
         .nr(8)
         .kr(1)
         .sr(1)
-        .m(5)
+        .m(4)
         .n(8)
         .k(k)
-        .Test(xnn_f32_gemm_minmax_ukernel_5x8__sse_dup, xnn_init_f32_minmax_sse_params);
+        .Test(xnn_f32_gemm_minmax_ukernel_4x8__sse_load1, xnn_init_f32_minmax_sse_params);
     }
   }
 
-  TEST(F32_GEMM_MINMAX_5X8__SSE_DUP, k_gt_4_strided_a) {
+  TEST(F32_GEMM_MINMAX_4X8__SSE_LOAD1, k_gt_1_strided_a) {
     TEST_REQUIRES_X86_SSE;
-    for (size_t k = 5; k < 8; k++) {
+    for (size_t k = 2; k < 10; k++) {
       GemmMicrokernelTester()
-        .mr(5)
+        .mr(4)
         .nr(8)
         .kr(1)
         .sr(1)
-        .m(5)
+        .m(4)
         .n(8)
         .k(k)
         .a_stride(11)
-        .Test(xnn_f32_gemm_minmax_ukernel_5x8__sse_dup, xnn_init_f32_minmax_sse_params);
-    }
-  }
-
-  TEST(F32_GEMM_MINMAX_5X8__SSE_DUP, k_gt_4_subtile) {
-    TEST_REQUIRES_X86_SSE;
-    for (size_t k = 5; k < 8; k++) {
-      for (uint32_t n = 1; n <= 8; n++) {
-        for (uint32_t m = 1; m <= 5; m++) {
-          GemmMicrokernelTester()
-            .mr(5)
-            .nr(8)
-            .kr(1)
-            .sr(1)
-            .m(m)
-            .n(n)
-            .k(k)
-            .iterations(1)
-            .Test(xnn_f32_gemm_minmax_ukernel_5x8__sse_dup, xnn_init_f32_minmax_sse_params);
-        }
-      }
-    }
-  }
-
-  TEST(F32_GEMM_MINMAX_5X8__SSE_DUP, k_div_4) {
-    TEST_REQUIRES_X86_SSE;
-    for (size_t k = 8; k <= 40; k += 4) {
-      GemmMicrokernelTester()
-        .mr(5)
-        .nr(8)
-        .kr(1)
-        .sr(1)
-        .m(5)
-        .n(8)
-        .k(k)
-        .Test(xnn_f32_gemm_minmax_ukernel_5x8__sse_dup, xnn_init_f32_minmax_sse_params);
-    }
-  }
-
-  TEST(F32_GEMM_MINMAX_5X8__SSE_DUP, k_div_4_strided_a) {
-    TEST_REQUIRES_X86_SSE;
-    for (size_t k = 8; k <= 40; k += 4) {
-      GemmMicrokernelTester()
-        .mr(5)
-        .nr(8)
-        .kr(1)
-        .sr(1)
-        .m(5)
-        .n(8)
-        .k(k)
-        .a_stride(43)
-        .Test(xnn_f32_gemm_minmax_ukernel_5x8__sse_dup, xnn_init_f32_minmax_sse_params);
+        .Test(xnn_f32_gemm_minmax_ukernel_4x8__sse_load1, xnn_init_f32_minmax_sse_params);
     }
   }
 
-  TEST(F32_GEMM_MINMAX_5X8__SSE_DUP, k_div_4_subtile) {
+  TEST(F32_GEMM_MINMAX_4X8__SSE_LOAD1, k_gt_1_subtile) {
     TEST_REQUIRES_X86_SSE;
-    for (size_t k = 8; k <= 40; k += 4) {
+    for (size_t k = 2; k < 10; k++) {
       for (uint32_t n = 1; n <= 8; n++) {
-        for (uint32_t m = 1; m <= 5; m++) {
+        for (uint32_t m = 1; m <= 4; m++) {
           GemmMicrokernelTester()
-            .mr(5)
+            .mr(4)
             .nr(8)
             .kr(1)
             .sr(1)
@@ -16057,72 +16057,72 @@
             .n(n)
             .k(k)
             .iterations(1)
-            .Test(xnn_f32_gemm_minmax_ukernel_5x8__sse_dup, xnn_init_f32_minmax_sse_params);
+            .Test(xnn_f32_gemm_minmax_ukernel_4x8__sse_load1, xnn_init_f32_minmax_sse_params);
         }
       }
     }
   }
 
-  TEST(F32_GEMM_MINMAX_5X8__SSE_DUP, n_gt_8) {
+  TEST(F32_GEMM_MINMAX_4X8__SSE_LOAD1, n_gt_8) {
     TEST_REQUIRES_X86_SSE;
     for (uint32_t n = 9; n < 16; n++) {
-      for (size_t k = 1; k <= 20; k += 5) {
+      for (size_t k = 1; k <= 5; k += 2) {
         GemmMicrokernelTester()
-          .mr(5)
+          .mr(4)
           .nr(8)
           .kr(1)
           .sr(1)
-          .m(5)
+          .m(4)
           .n(n)
           .k(k)
-          .Test(xnn_f32_gemm_minmax_ukernel_5x8__sse_dup, xnn_init_f32_minmax_sse_params);
+          .Test(xnn_f32_gemm_minmax_ukernel_4x8__sse_load1, xnn_init_f32_minmax_sse_params);
       }
     }
   }
 
-  TEST(F32_GEMM_MINMAX_5X8__SSE_DUP, n_gt_8_strided_cn) {
+  TEST(F32_GEMM_MINMAX_4X8__SSE_LOAD1, n_gt_8_strided_cn) {
     TEST_REQUIRES_X86_SSE;
     for (uint32_t n = 9; n < 16; n++) {
-      for (size_t k = 1; k <= 20; k += 5) {
+      for (size_t k = 1; k <= 5; k += 2) {
         GemmMicrokernelTester()
-          .mr(5)
+          .mr(4)
           .nr(8)
           .kr(1)
           .sr(1)
-          .m(5)
+          .m(4)
           .n(n)
           .k(k)
           .cn_stride(11)
-          .Test(xnn_f32_gemm_minmax_ukernel_5x8__sse_dup, xnn_init_f32_minmax_sse_params);
+          .Test(xnn_f32_gemm_minmax_ukernel_4x8__sse_load1, xnn_init_f32_minmax_sse_params);
       }
     }
   }
 
-  TEST(F32_GEMM_MINMAX_5X8__SSE_DUP, n_gt_8_strided_a) {
+  TEST(F32_GEMM_MINMAX_4X8__SSE_LOAD1, n_gt_8_strided_a) {
     TEST_REQUIRES_X86_SSE;
     for (uint32_t n = 9; n < 16; n++) {
-      for (size_t k = 1; k <= 20; k += 5) {
+      for (size_t k = 1; k <= 5; k += 2) {
         GemmMicrokernelTester()
-          .mr(5)
+          .mr(4)
           .nr(8)
           .kr(1)
           .sr(1)
-          .m(5)
+          .m(4)
           .n(n)
           .k(k)
-          .a_stride(23)
-          .Test(xnn_f32_gemm_minmax_ukernel_5x8__sse_dup, xnn_init_f32_minmax_sse_params);
+          .a_stride(7)
+          .Test(xnn_f32_gemm_minmax_ukernel_4x8__sse_load1, xnn_init_f32_minmax_sse_params);
       }
     }
   }
 
-  TEST(F32_GEMM_MINMAX_5X8__SSE_DUP, n_gt_8_subtile) {
+  TEST(F32_GEMM_MINMAX_4X8__SSE_LOAD1, n_gt_8_subtile) {
     TEST_REQUIRES_X86_SSE;
     for (uint32_t n = 9; n < 16; n++) {
-      for (size_t k = 1; k <= 20; k += 5) {
-        for (uint32_t m = 1; m <= 5; m++) {
+      for (size_t k = 1; k <= 5; k += 2) {
+        for (uint32_t m = 1; m <= 4; m++) {
           GemmMicrokernelTester()
-            .mr(5)
+            .mr(4)
             .nr(8)
             .kr(1)
             .sr(1)
@@ -16130,72 +16130,72 @@
             .n(n)
             .k(k)
             .iterations(1)
-            .Test(xnn_f32_gemm_minmax_ukernel_5x8__sse_dup, xnn_init_f32_minmax_sse_params);
+            .Test(xnn_f32_gemm_minmax_ukernel_4x8__sse_load1, xnn_init_f32_minmax_sse_params);
         }
       }
     }
   }
 
-  TEST(F32_GEMM_MINMAX_5X8__SSE_DUP, n_div_8) {
+  TEST(F32_GEMM_MINMAX_4X8__SSE_LOAD1, n_div_8) {
     TEST_REQUIRES_X86_SSE;
     for (uint32_t n = 16; n <= 24; n += 8) {
-      for (size_t k = 1; k <= 20; k += 5) {
+      for (size_t k = 1; k <= 5; k += 2) {
         GemmMicrokernelTester()
-          .mr(5)
+          .mr(4)
           .nr(8)
           .kr(1)
           .sr(1)
-          .m(5)
+          .m(4)
           .n(n)
           .k(k)
-          .Test(xnn_f32_gemm_minmax_ukernel_5x8__sse_dup, xnn_init_f32_minmax_sse_params);
+          .Test(xnn_f32_gemm_minmax_ukernel_4x8__sse_load1, xnn_init_f32_minmax_sse_params);
       }
     }
   }
 
-  TEST(F32_GEMM_MINMAX_5X8__SSE_DUP, n_div_8_strided_cn) {
+  TEST(F32_GEMM_MINMAX_4X8__SSE_LOAD1, n_div_8_strided_cn) {
     TEST_REQUIRES_X86_SSE;
     for (uint32_t n = 16; n <= 24; n += 8) {
-      for (size_t k = 1; k <= 20; k += 5) {
+      for (size_t k = 1; k <= 5; k += 2) {
         GemmMicrokernelTester()
-          .mr(5)
+          .mr(4)
           .nr(8)
           .kr(1)
           .sr(1)
-          .m(5)
+          .m(4)
           .n(n)
           .k(k)
           .cn_stride(11)
-          .Test(xnn_f32_gemm_minmax_ukernel_5x8__sse_dup, xnn_init_f32_minmax_sse_params);
+          .Test(xnn_f32_gemm_minmax_ukernel_4x8__sse_load1, xnn_init_f32_minmax_sse_params);
       }
     }
   }
 
-  TEST(F32_GEMM_MINMAX_5X8__SSE_DUP, n_div_8_strided_a) {
+  TEST(F32_GEMM_MINMAX_4X8__SSE_LOAD1, n_div_8_strided_a) {
     TEST_REQUIRES_X86_SSE;
     for (uint32_t n = 16; n <= 24; n += 8) {
-      for (size_t k = 1; k <= 20; k += 5) {
+      for (size_t k = 1; k <= 5; k += 2) {
         GemmMicrokernelTester()
-          .mr(5)
+          .mr(4)
           .nr(8)
           .kr(1)
           .sr(1)
-          .m(5)
+          .m(4)
           .n(n)
           .k(k)
-          .a_stride(23)
-          .Test(xnn_f32_gemm_minmax_ukernel_5x8__sse_dup, xnn_init_f32_minmax_sse_params);
+          .a_stride(7)
+          .Test(xnn_f32_gemm_minmax_ukernel_4x8__sse_load1, xnn_init_f32_minmax_sse_params);
       }
     }
   }
 
-  TEST(F32_GEMM_MINMAX_5X8__SSE_DUP, n_div_8_subtile) {
+  TEST(F32_GEMM_MINMAX_4X8__SSE_LOAD1, n_div_8_subtile) {
     TEST_REQUIRES_X86_SSE;
     for (uint32_t n = 16; n <= 24; n += 8) {
-      for (size_t k = 1; k <= 20; k += 5) {
-        for (uint32_t m = 1; m <= 5; m++) {
+      for (size_t k = 1; k <= 5; k += 2) {
+        for (uint32_t m = 1; m <= 4; m++) {
           GemmMicrokernelTester()
-            .mr(5)
+            .mr(4)
             .nr(8)
             .kr(1)
             .sr(1)
@@ -16203,19 +16203,19 @@
             .n(n)
             .k(k)
             .iterations(1)
-            .Test(xnn_f32_gemm_minmax_ukernel_5x8__sse_dup, xnn_init_f32_minmax_sse_params);
+            .Test(xnn_f32_gemm_minmax_ukernel_4x8__sse_load1, xnn_init_f32_minmax_sse_params);
         }
       }
     }
   }
 
-  TEST(F32_GEMM_MINMAX_5X8__SSE_DUP, strided_cm_subtile) {
+  TEST(F32_GEMM_MINMAX_4X8__SSE_LOAD1, strided_cm_subtile) {
     TEST_REQUIRES_X86_SSE;
-    for (size_t k = 1; k <= 20; k += 5) {
+    for (size_t k = 1; k <= 5; k += 2) {
       for (uint32_t n = 1; n <= 8; n++) {
-        for (uint32_t m = 1; m <= 5; m++) {
+        for (uint32_t m = 1; m <= 4; m++) {
           GemmMicrokernelTester()
-            .mr(5)
+            .mr(4)
             .nr(8)
             .kr(1)
             .sr(1)
@@ -16224,58 +16224,58 @@
             .k(k)
             .cm_stride(11)
             .iterations(1)
-            .Test(xnn_f32_gemm_minmax_ukernel_5x8__sse_dup, xnn_init_f32_minmax_sse_params);
+            .Test(xnn_f32_gemm_minmax_ukernel_4x8__sse_load1, xnn_init_f32_minmax_sse_params);
         }
       }
     }
   }
 
-  TEST(F32_GEMM_MINMAX_5X8__SSE_DUP, qmin) {
+  TEST(F32_GEMM_MINMAX_4X8__SSE_LOAD1, qmin) {
     TEST_REQUIRES_X86_SSE;
     GemmMicrokernelTester()
-      .mr(5)
+      .mr(4)
       .nr(8)
       .kr(1)
       .sr(1)
-      .m(5)
+      .m(4)
       .n(8)
-      .k(4)
+      .k(1)
       .qmin(128)
-      .Test(xnn_f32_gemm_minmax_ukernel_5x8__sse_dup, xnn_init_f32_minmax_sse_params);
+      .Test(xnn_f32_gemm_minmax_ukernel_4x8__sse_load1, xnn_init_f32_minmax_sse_params);
   }
 
-  TEST(F32_GEMM_MINMAX_5X8__SSE_DUP, qmax) {
+  TEST(F32_GEMM_MINMAX_4X8__SSE_LOAD1, qmax) {
     TEST_REQUIRES_X86_SSE;
     GemmMicrokernelTester()
-      .mr(5)
+      .mr(4)
       .nr(8)
       .kr(1)
       .sr(1)
-      .m(5)
+      .m(4)
       .n(8)
-      .k(4)
+      .k(1)
       .qmax(128)
-      .Test(xnn_f32_gemm_minmax_ukernel_5x8__sse_dup, xnn_init_f32_minmax_sse_params);
+      .Test(xnn_f32_gemm_minmax_ukernel_4x8__sse_load1, xnn_init_f32_minmax_sse_params);
   }
 
-  TEST(F32_GEMM_MINMAX_5X8__SSE_DUP, strided_cm) {
+  TEST(F32_GEMM_MINMAX_4X8__SSE_LOAD1, strided_cm) {
     TEST_REQUIRES_X86_SSE;
     GemmMicrokernelTester()
-      .mr(5)
+      .mr(4)
       .nr(8)
       .kr(1)
       .sr(1)
-      .m(5)
+      .m(4)
       .n(8)
-      .k(4)
+      .k(1)
       .cm_stride(11)
-      .Test(xnn_f32_gemm_minmax_ukernel_5x8__sse_dup, xnn_init_f32_minmax_sse_params);
+      .Test(xnn_f32_gemm_minmax_ukernel_4x8__sse_load1, xnn_init_f32_minmax_sse_params);
   }
 #endif  // XNN_ARCH_X86 || XNN_ARCH_X86_64
 
 
 #if XNN_ARCH_X86 || XNN_ARCH_X86_64
-  TEST(F32_GEMM_MINMAX_5X8__SSE_LOAD1, k_eq_1) {
+  TEST(F32_GEMM_MINMAX_5X8__SSE_DUP, k_eq_4) {
     TEST_REQUIRES_X86_SSE;
     GemmMicrokernelTester()
       .mr(5)
@@ -16284,11 +16284,11 @@
       .sr(1)
       .m(5)
       .n(8)
-      .k(1)
-      .Test(xnn_f32_gemm_minmax_ukernel_5x8__sse_load1, xnn_init_f32_minmax_sse_params);
+      .k(4)
+      .Test(xnn_f32_gemm_minmax_ukernel_5x8__sse_dup, xnn_init_f32_minmax_sse_params);
   }
 
-  TEST(F32_GEMM_MINMAX_5X8__SSE_LOAD1, strided_cn) {
+  TEST(F32_GEMM_MINMAX_5X8__SSE_DUP, strided_cn) {
     TEST_REQUIRES_X86_SSE;
     GemmMicrokernelTester()
       .mr(5)
@@ -16297,12 +16297,12 @@
       .sr(1)
       .m(5)
       .n(8)
-      .k(1)
+      .k(4)
       .cn_stride(11)
-      .Test(xnn_f32_gemm_minmax_ukernel_5x8__sse_load1, xnn_init_f32_minmax_sse_params);
+      .Test(xnn_f32_gemm_minmax_ukernel_5x8__sse_dup, xnn_init_f32_minmax_sse_params);
   }
 
-  TEST(F32_GEMM_MINMAX_5X8__SSE_LOAD1, k_eq_1_strided_a) {
+  TEST(F32_GEMM_MINMAX_5X8__SSE_DUP, k_eq_4_strided_a) {
     TEST_REQUIRES_X86_SSE;
     GemmMicrokernelTester()
       .mr(5)
@@ -16311,12 +16311,12 @@
       .sr(1)
       .m(5)
       .n(8)
-      .k(1)
-      .a_stride(3)
-      .Test(xnn_f32_gemm_minmax_ukernel_5x8__sse_load1, xnn_init_f32_minmax_sse_params);
+      .k(4)
+      .a_stride(7)
+      .Test(xnn_f32_gemm_minmax_ukernel_5x8__sse_dup, xnn_init_f32_minmax_sse_params);
   }
 
-  TEST(F32_GEMM_MINMAX_5X8__SSE_LOAD1, k_eq_1_subtile) {
+  TEST(F32_GEMM_MINMAX_5X8__SSE_DUP, k_eq_4_subtile) {
     TEST_REQUIRES_X86_SSE;
     for (uint32_t n = 1; n <= 8; n++) {
       for (uint32_t m = 1; m <= 5; m++) {
@@ -16327,14 +16327,14 @@
           .sr(1)
           .m(m)
           .n(n)
-          .k(1)
+          .k(4)
           .iterations(1)
-          .Test(xnn_f32_gemm_minmax_ukernel_5x8__sse_load1, xnn_init_f32_minmax_sse_params);
+          .Test(xnn_f32_gemm_minmax_ukernel_5x8__sse_dup, xnn_init_f32_minmax_sse_params);
       }
     }
   }
 
-  TEST(F32_GEMM_MINMAX_5X8__SSE_LOAD1, k_eq_1_subtile_m) {
+  TEST(F32_GEMM_MINMAX_5X8__SSE_DUP, k_eq_4_subtile_m) {
     TEST_REQUIRES_X86_SSE;
     for (uint32_t m = 1; m <= 5; m++) {
       GemmMicrokernelTester()
@@ -16344,13 +16344,13 @@
         .sr(1)
         .m(m)
         .n(8)
-        .k(1)
+        .k(4)
         .iterations(1)
-        .Test(xnn_f32_gemm_minmax_ukernel_5x8__sse_load1, xnn_init_f32_minmax_sse_params);
+        .Test(xnn_f32_gemm_minmax_ukernel_5x8__sse_dup, xnn_init_f32_minmax_sse_params);
     }
   }
 
-  TEST(F32_GEMM_MINMAX_5X8__SSE_LOAD1, k_eq_1_subtile_n) {
+  TEST(F32_GEMM_MINMAX_5X8__SSE_DUP, k_eq_4_subtile_n) {
     TEST_REQUIRES_X86_SSE;
     for (uint32_t n = 1; n <= 8; n++) {
       GemmMicrokernelTester()
@@ -16360,15 +16360,15 @@
         .sr(1)
         .m(5)
         .n(n)
-        .k(1)
+        .k(4)
         .iterations(1)
-        .Test(xnn_f32_gemm_minmax_ukernel_5x8__sse_load1, xnn_init_f32_minmax_sse_params);
+        .Test(xnn_f32_gemm_minmax_ukernel_5x8__sse_dup, xnn_init_f32_minmax_sse_params);
     }
   }
 
-  TEST(F32_GEMM_MINMAX_5X8__SSE_LOAD1, k_gt_1) {
+  TEST(F32_GEMM_MINMAX_5X8__SSE_DUP, k_lt_4) {
     TEST_REQUIRES_X86_SSE;
-    for (size_t k = 2; k < 10; k++) {
+    for (size_t k = 1; k < 4; k++) {
       GemmMicrokernelTester()
         .mr(5)
         .nr(8)
@@ -16377,13 +16377,64 @@
         .m(5)
         .n(8)
         .k(k)
-        .Test(xnn_f32_gemm_minmax_ukernel_5x8__sse_load1, xnn_init_f32_minmax_sse_params);
+        .Test(xnn_f32_gemm_minmax_ukernel_5x8__sse_dup, xnn_init_f32_minmax_sse_params);
     }
   }
 
-  TEST(F32_GEMM_MINMAX_5X8__SSE_LOAD1, k_gt_1_strided_a) {
+  TEST(F32_GEMM_MINMAX_5X8__SSE_DUP, k_lt_4_strided_a) {
     TEST_REQUIRES_X86_SSE;
-    for (size_t k = 2; k < 10; k++) {
+    for (size_t k = 1; k < 4; k++) {
+      GemmMicrokernelTester()
+        .mr(5)
+        .nr(8)
+        .kr(1)
+        .sr(1)
+        .m(5)
+        .n(8)
+        .k(k)
+        .a_stride(7)
+        .Test(xnn_f32_gemm_minmax_ukernel_5x8__sse_dup, xnn_init_f32_minmax_sse_params);
+    }
+  }
+
+  TEST(F32_GEMM_MINMAX_5X8__SSE_DUP, k_lt_4_subtile) {
+    TEST_REQUIRES_X86_SSE;
+    for (size_t k = 1; k < 4; k++) {
+      for (uint32_t n = 1; n <= 8; n++) {
+        for (uint32_t m = 1; m <= 5; m++) {
+          GemmMicrokernelTester()
+            .mr(5)
+            .nr(8)
+            .kr(1)
+            .sr(1)
+            .m(m)
+            .n(n)
+            .k(k)
+            .iterations(1)
+            .Test(xnn_f32_gemm_minmax_ukernel_5x8__sse_dup, xnn_init_f32_minmax_sse_params);
+        }
+      }
+    }
+  }
+
+  TEST(F32_GEMM_MINMAX_5X8__SSE_DUP, k_gt_4) {
+    TEST_REQUIRES_X86_SSE;
+    for (size_t k = 5; k < 8; k++) {
+      GemmMicrokernelTester()
+        .mr(5)
+        .nr(8)
+        .kr(1)
+        .sr(1)
+        .m(5)
+        .n(8)
+        .k(k)
+        .Test(xnn_f32_gemm_minmax_ukernel_5x8__sse_dup, xnn_init_f32_minmax_sse_params);
+    }
+  }
+
+  TEST(F32_GEMM_MINMAX_5X8__SSE_DUP, k_gt_4_strided_a) {
+    TEST_REQUIRES_X86_SSE;
+    for (size_t k = 5; k < 8; k++) {
       GemmMicrokernelTester()
         .mr(5)
         .nr(8)
@@ -16393,13 +16444,13 @@
         .n(8)
         .k(k)
         .a_stride(11)
-        .Test(xnn_f32_gemm_minmax_ukernel_5x8__sse_load1, xnn_init_f32_minmax_sse_params);
+        .Test(xnn_f32_gemm_minmax_ukernel_5x8__sse_dup, xnn_init_f32_minmax_sse_params);
     }
   }
 
-  TEST(F32_GEMM_MINMAX_5X8__SSE_LOAD1, k_gt_1_subtile) {
+  TEST(F32_GEMM_MINMAX_5X8__SSE_DUP, k_gt_4_subtile) {
     TEST_REQUIRES_X86_SSE;
-    for (size_t k = 2; k < 10; k++) {
+    for (size_t k = 5; k < 8; k++) {
       for (uint32_t n = 1; n <= 8; n++) {
         for (uint32_t m = 1; m <= 5; m++) {
           GemmMicrokernelTester()
@@ -16411,16 +16462,67 @@
             .n(n)
             .k(k)
             .iterations(1)
-            .Test(xnn_f32_gemm_minmax_ukernel_5x8__sse_load1, xnn_init_f32_minmax_sse_params);
+            .Test(xnn_f32_gemm_minmax_ukernel_5x8__sse_dup, xnn_init_f32_minmax_sse_params);
         }
       }
     }
   }
 
-  TEST(F32_GEMM_MINMAX_5X8__SSE_LOAD1, n_gt_8) {
+  TEST(F32_GEMM_MINMAX_5X8__SSE_DUP, k_div_4) {
+    TEST_REQUIRES_X86_SSE;
+    for (size_t k = 8; k <= 40; k += 4) {
+      GemmMicrokernelTester()
+        .mr(5)
+        .nr(8)
+        .kr(1)
+        .sr(1)
+        .m(5)
+        .n(8)
+        .k(k)
+        .Test(xnn_f32_gemm_minmax_ukernel_5x8__sse_dup, xnn_init_f32_minmax_sse_params);
+    }
+  }
+
+  TEST(F32_GEMM_MINMAX_5X8__SSE_DUP, k_div_4_strided_a) {
+    TEST_REQUIRES_X86_SSE;
+    for (size_t k = 8; k <= 40; k += 4) {
+      GemmMicrokernelTester()
+        .mr(5)
+        .nr(8)
+        .kr(1)
+        .sr(1)
+        .m(5)
+        .n(8)
+        .k(k)
+        .a_stride(43)
+        .Test(xnn_f32_gemm_minmax_ukernel_5x8__sse_dup, xnn_init_f32_minmax_sse_params);
+    }
+  }
+
+  TEST(F32_GEMM_MINMAX_5X8__SSE_DUP, k_div_4_subtile) {
+    TEST_REQUIRES_X86_SSE;
+    for (size_t k = 8; k <= 40; k += 4) {
+      for (uint32_t n = 1; n <= 8; n++) {
+        for (uint32_t m = 1; m <= 5; m++) {
+          GemmMicrokernelTester()
+            .mr(5)
+            .nr(8)
+            .kr(1)
+            .sr(1)
+            .m(m)
+            .n(n)
+            .k(k)
+            .iterations(1)
+            .Test(xnn_f32_gemm_minmax_ukernel_5x8__sse_dup, xnn_init_f32_minmax_sse_params);
+        }
+      }
+    }
+  }
+
+  TEST(F32_GEMM_MINMAX_5X8__SSE_DUP, n_gt_8) {
     TEST_REQUIRES_X86_SSE;
     for (uint32_t n = 9; n < 16; n++) {
-      for (size_t k = 1; k <= 5; k += 2) {
+      for (size_t k = 1; k <= 20; k += 5) {
         GemmMicrokernelTester()
           .mr(5)
           .nr(8)
@@ -16429,15 +16531,15 @@
           .m(5)
           .n(n)
           .k(k)
-          .Test(xnn_f32_gemm_minmax_ukernel_5x8__sse_load1, xnn_init_f32_minmax_sse_params);
+          .Test(xnn_f32_gemm_minmax_ukernel_5x8__sse_dup, xnn_init_f32_minmax_sse_params);
       }
     }
   }
 
-  TEST(F32_GEMM_MINMAX_5X8__SSE_LOAD1, n_gt_8_strided_cn) {
+  TEST(F32_GEMM_MINMAX_5X8__SSE_DUP, n_gt_8_strided_cn) {
     TEST_REQUIRES_X86_SSE;
     for (uint32_t n = 9; n < 16; n++) {
-      for (size_t k = 1; k <= 5; k += 2) {
+      for (size_t k = 1; k <= 20; k += 5) {
         GemmMicrokernelTester()
           .mr(5)
           .nr(8)
@@ -16447,15 +16549,15 @@
           .n(n)
           .k(k)
           .cn_stride(11)
-          .Test(xnn_f32_gemm_minmax_ukernel_5x8__sse_load1, xnn_init_f32_minmax_sse_params);
+          .Test(xnn_f32_gemm_minmax_ukernel_5x8__sse_dup, xnn_init_f32_minmax_sse_params);
       }
     }
   }
 
-  TEST(F32_GEMM_MINMAX_5X8__SSE_LOAD1, n_gt_8_strided_a) {
+  TEST(F32_GEMM_MINMAX_5X8__SSE_DUP, n_gt_8_strided_a) {
     TEST_REQUIRES_X86_SSE;
     for (uint32_t n = 9; n < 16; n++) {
-      for (size_t k = 1; k <= 5; k += 2) {
+      for (size_t k = 1; k <= 20; k += 5) {
         GemmMicrokernelTester()
           .mr(5)
           .nr(8)
@@ -16464,16 +16566,16 @@
           .m(5)
           .n(n)
           .k(k)
-          .a_stride(7)
-          .Test(xnn_f32_gemm_minmax_ukernel_5x8__sse_load1, xnn_init_f32_minmax_sse_params);
+          .a_stride(23)
+          .Test(xnn_f32_gemm_minmax_ukernel_5x8__sse_dup, xnn_init_f32_minmax_sse_params);
       }
     }
   }
 
-  TEST(F32_GEMM_MINMAX_5X8__SSE_LOAD1, n_gt_8_subtile) {
+  TEST(F32_GEMM_MINMAX_5X8__SSE_DUP, n_gt_8_subtile) {
     TEST_REQUIRES_X86_SSE;
     for (uint32_t n = 9; n < 16; n++) {
-      for (size_t k = 1; k <= 5; k += 2) {
+      for (size_t k = 1; k <= 20; k += 5) {
         for (uint32_t m = 1; m <= 5; m++) {
           GemmMicrokernelTester()
             .mr(5)
@@ -16484,16 +16586,16 @@
             .n(n)
             .k(k)
             .iterations(1)
-            .Test(xnn_f32_gemm_minmax_ukernel_5x8__sse_load1, xnn_init_f32_minmax_sse_params);
+            .Test(xnn_f32_gemm_minmax_ukernel_5x8__sse_dup, xnn_init_f32_minmax_sse_params);
         }
       }
     }
   }
 
-  TEST(F32_GEMM_MINMAX_5X8__SSE_LOAD1, n_div_8) {
+  TEST(F32_GEMM_MINMAX_5X8__SSE_DUP, n_div_8) {
     TEST_REQUIRES_X86_SSE;
     for (uint32_t n = 16; n <= 24; n += 8) {
-      for (size_t k = 1; k <= 5; k += 2) {
+      for (size_t k = 1; k <= 20; k += 5) {
         GemmMicrokernelTester()
           .mr(5)
           .nr(8)
@@ -16502,15 +16604,15 @@
           .m(5)
           .n(n)
           .k(k)
-          .Test(xnn_f32_gemm_minmax_ukernel_5x8__sse_load1, xnn_init_f32_minmax_sse_params);
+          .Test(xnn_f32_gemm_minmax_ukernel_5x8__sse_dup, xnn_init_f32_minmax_sse_params);
       }
     }
   }
 
-  TEST(F32_GEMM_MINMAX_5X8__SSE_LOAD1, n_div_8_strided_cn) {
+  TEST(F32_GEMM_MINMAX_5X8__SSE_DUP, n_div_8_strided_cn) {
     TEST_REQUIRES_X86_SSE;
     for (uint32_t n = 16; n <= 24; n += 8) {
-      for (size_t k = 1; k <= 5; k += 2) {
+      for (size_t k = 1; k <= 20; k += 5) {
         GemmMicrokernelTester()
           .mr(5)
           .nr(8)
@@ -16520,15 +16622,15 @@
           .n(n)
           .k(k)
           .cn_stride(11)
-          .Test(xnn_f32_gemm_minmax_ukernel_5x8__sse_load1, xnn_init_f32_minmax_sse_params);
+          .Test(xnn_f32_gemm_minmax_ukernel_5x8__sse_dup, xnn_init_f32_minmax_sse_params);
       }
     }
   }
 
-  TEST(F32_GEMM_MINMAX_5X8__SSE_LOAD1, n_div_8_strided_a) {
+  TEST(F32_GEMM_MINMAX_5X8__SSE_DUP, n_div_8_strided_a) {
     TEST_REQUIRES_X86_SSE;
     for (uint32_t n = 16; n <= 24; n += 8) {
-      for (size_t k = 1; k <= 5; k += 2) {
+      for (size_t k = 1; k <= 20; k += 5) {
         GemmMicrokernelTester()
           .mr(5)
           .nr(8)
@@ -16537,16 +16639,16 @@
           .m(5)
           .n(n)
           .k(k)
-          .a_stride(7)
-          .Test(xnn_f32_gemm_minmax_ukernel_5x8__sse_load1, xnn_init_f32_minmax_sse_params);
+          .a_stride(23)
+          .Test(xnn_f32_gemm_minmax_ukernel_5x8__sse_dup, xnn_init_f32_minmax_sse_params);
       }
     }
   }
 
-  TEST(F32_GEMM_MINMAX_5X8__SSE_LOAD1, n_div_8_subtile) {
+  TEST(F32_GEMM_MINMAX_5X8__SSE_DUP, n_div_8_subtile) {
     TEST_REQUIRES_X86_SSE;
     for (uint32_t n = 16; n <= 24; n += 8) {
-      for (size_t k = 1; k <= 5; k += 2) {
+      for (size_t k = 1; k <= 20; k += 5) {
         for (uint32_t m = 1; m <= 5; m++) {
           GemmMicrokernelTester()
             .mr(5)
@@ -16557,15 +16659,15 @@
             .n(n)
             .k(k)
             .iterations(1)
-            .Test(xnn_f32_gemm_minmax_ukernel_5x8__sse_load1, xnn_init_f32_minmax_sse_params);
+            .Test(xnn_f32_gemm_minmax_ukernel_5x8__sse_dup, xnn_init_f32_minmax_sse_params);
         }
       }
     }
   }
 
-  TEST(F32_GEMM_MINMAX_5X8__SSE_LOAD1, strided_cm_subtile) {
+  TEST(F32_GEMM_MINMAX_5X8__SSE_DUP, strided_cm_subtile) {
     TEST_REQUIRES_X86_SSE;
-    for (size_t k = 1; k <= 5; k += 2) {
+    for (size_t k = 1; k <= 20; k += 5) {
       for (uint32_t n = 1; n <= 8; n++) {
         for (uint32_t m = 1; m <= 5; m++) {
           GemmMicrokernelTester()
@@ -16578,13 +16680,13 @@
             .k(k)
             .cm_stride(11)
             .iterations(1)
-            .Test(xnn_f32_gemm_minmax_ukernel_5x8__sse_load1, xnn_init_f32_minmax_sse_params);
+            .Test(xnn_f32_gemm_minmax_ukernel_5x8__sse_dup, xnn_init_f32_minmax_sse_params);
         }
       }
     }
   }
 
-  TEST(F32_GEMM_MINMAX_5X8__SSE_LOAD1, qmin) {
+  TEST(F32_GEMM_MINMAX_5X8__SSE_DUP, qmin) {
     TEST_REQUIRES_X86_SSE;
     GemmMicrokernelTester()
       .mr(5)
@@ -16593,12 +16695,12 @@
       .sr(1)
       .m(5)
       .n(8)
-      .k(1)
+      .k(4)
       .qmin(128)
-      .Test(xnn_f32_gemm_minmax_ukernel_5x8__sse_load1, xnn_init_f32_minmax_sse_params);
+      .Test(xnn_f32_gemm_minmax_ukernel_5x8__sse_dup, xnn_init_f32_minmax_sse_params);
   }
 
-  TEST(F32_GEMM_MINMAX_5X8__SSE_LOAD1, qmax) {
+  TEST(F32_GEMM_MINMAX_5X8__SSE_DUP, qmax) {
     TEST_REQUIRES_X86_SSE;
     GemmMicrokernelTester()
       .mr(5)
@@ -16607,12 +16709,12 @@
       .sr(1)
       .m(5)
       .n(8)
-      .k(1)
+      .k(4)
       .qmax(128)
-      .Test(xnn_f32_gemm_minmax_ukernel_5x8__sse_load1, xnn_init_f32_minmax_sse_params);
+      .Test(xnn_f32_gemm_minmax_ukernel_5x8__sse_dup, xnn_init_f32_minmax_sse_params);
   }
 
-  TEST(F32_GEMM_MINMAX_5X8__SSE_LOAD1, strided_cm) {
+  TEST(F32_GEMM_MINMAX_5X8__SSE_DUP, strided_cm) {
     TEST_REQUIRES_X86_SSE;
     GemmMicrokernelTester()
       .mr(5)
@@ -16621,16 +16723,16 @@
       .sr(1)
       .m(5)
       .n(8)
-      .k(1)
+      .k(4)
       .cm_stride(11)
-      .Test(xnn_f32_gemm_minmax_ukernel_5x8__sse_load1, xnn_init_f32_minmax_sse_params);
+      .Test(xnn_f32_gemm_minmax_ukernel_5x8__sse_dup, xnn_init_f32_minmax_sse_params);
   }
 #endif  // XNN_ARCH_X86 || XNN_ARCH_X86_64
 
 
 #if XNN_ARCH_X86 || XNN_ARCH_X86_64
-  TEST(F32_GEMM_MINMAX_5X8__SSE2_DUP, k_eq_4) {
-    TEST_REQUIRES_X86_SSE2;
+  TEST(F32_GEMM_MINMAX_5X8__SSE_LOAD1, k_eq_1) {
+    TEST_REQUIRES_X86_SSE;
     GemmMicrokernelTester()
       .mr(5)
       .nr(8)
@@ -16638,12 +16740,12 @@
       .sr(1)
       .m(5)
       .n(8)
-      .k(4)
-      .Test(xnn_f32_gemm_minmax_ukernel_5x8__sse2_dup, xnn_init_f32_minmax_sse_params);
+      .k(1)
+      .Test(xnn_f32_gemm_minmax_ukernel_5x8__sse_load1, xnn_init_f32_minmax_sse_params);
   }
 
-  TEST(F32_GEMM_MINMAX_5X8__SSE2_DUP, strided_cn) {
-    TEST_REQUIRES_X86_SSE2;
+  TEST(F32_GEMM_MINMAX_5X8__SSE_LOAD1, strided_cn) {
+    TEST_REQUIRES_X86_SSE;
     GemmMicrokernelTester()
       .mr(5)
       .nr(8)
@@ -16651,13 +16753,13 @@
       .sr(1)
       .m(5)
       .n(8)
-      .k(4)
+      .k(1)
       .cn_stride(11)
-      .Test(xnn_f32_gemm_minmax_ukernel_5x8__sse2_dup, xnn_init_f32_minmax_sse_params);
+      .Test(xnn_f32_gemm_minmax_ukernel_5x8__sse_load1, xnn_init_f32_minmax_sse_params);
   }
 
-  TEST(F32_GEMM_MINMAX_5X8__SSE2_DUP, k_eq_4_strided_a) {
-    TEST_REQUIRES_X86_SSE2;
+  TEST(F32_GEMM_MINMAX_5X8__SSE_LOAD1, k_eq_1_strided_a) {
+    TEST_REQUIRES_X86_SSE;
     GemmMicrokernelTester()
       .mr(5)
       .nr(8)
@@ -16665,13 +16767,13 @@
       .sr(1)
       .m(5)
       .n(8)
-      .k(4)
-      .a_stride(7)
-      .Test(xnn_f32_gemm_minmax_ukernel_5x8__sse2_dup, xnn_init_f32_minmax_sse_params);
+      .k(1)
+      .a_stride(3)
+      .Test(xnn_f32_gemm_minmax_ukernel_5x8__sse_load1, xnn_init_f32_minmax_sse_params);
   }
 
-  TEST(F32_GEMM_MINMAX_5X8__SSE2_DUP, k_eq_4_subtile) {
-    TEST_REQUIRES_X86_SSE2;
+  TEST(F32_GEMM_MINMAX_5X8__SSE_LOAD1, k_eq_1_subtile) {
+    TEST_REQUIRES_X86_SSE;
     for (uint32_t n = 1; n <= 8; n++) {
       for (uint32_t m = 1; m <= 5; m++) {
         GemmMicrokernelTester()
@@ -16681,15 +16783,15 @@
           .sr(1)
           .m(m)
           .n(n)
-          .k(4)
+          .k(1)
           .iterations(1)
-          .Test(xnn_f32_gemm_minmax_ukernel_5x8__sse2_dup, xnn_init_f32_minmax_sse_params);
+          .Test(xnn_f32_gemm_minmax_ukernel_5x8__sse_load1, xnn_init_f32_minmax_sse_params);
       }
     }
   }
 
-  TEST(F32_GEMM_MINMAX_5X8__SSE2_DUP, k_eq_4_subtile_m) {
-    TEST_REQUIRES_X86_SSE2;
+  TEST(F32_GEMM_MINMAX_5X8__SSE_LOAD1, k_eq_1_subtile_m) {
+    TEST_REQUIRES_X86_SSE;
     for (uint32_t m = 1; m <= 5; m++) {
       GemmMicrokernelTester()
         .mr(5)
@@ -16698,14 +16800,14 @@
         .sr(1)
         .m(m)
         .n(8)
-        .k(4)
+        .k(1)
         .iterations(1)
-        .Test(xnn_f32_gemm_minmax_ukernel_5x8__sse2_dup, xnn_init_f32_minmax_sse_params);
+        .Test(xnn_f32_gemm_minmax_ukernel_5x8__sse_load1, xnn_init_f32_minmax_sse_params);
     }
   }
 
-  TEST(F32_GEMM_MINMAX_5X8__SSE2_DUP, k_eq_4_subtile_n) {
-    TEST_REQUIRES_X86_SSE2;
+  TEST(F32_GEMM_MINMAX_5X8__SSE_LOAD1, k_eq_1_subtile_n) {
+    TEST_REQUIRES_X86_SSE;
     for (uint32_t n = 1; n <= 8; n++) {
       GemmMicrokernelTester()
         .mr(5)
@@ -16714,15 +16816,15 @@
         .sr(1)
         .m(5)
         .n(n)
-        .k(4)
+        .k(1)
         .iterations(1)
-        .Test(xnn_f32_gemm_minmax_ukernel_5x8__sse2_dup, xnn_init_f32_minmax_sse_params);
+        .Test(xnn_f32_gemm_minmax_ukernel_5x8__sse_load1, xnn_init_f32_minmax_sse_params);
     }
   }
 
-  TEST(F32_GEMM_MINMAX_5X8__SSE2_DUP, k_lt_4) {
-    TEST_REQUIRES_X86_SSE2;
-    for (size_t k = 1; k < 4; k++) {
+  TEST(F32_GEMM_MINMAX_5X8__SSE_LOAD1, k_gt_1) {
+    TEST_REQUIRES_X86_SSE;
+    for (size_t k = 2; k < 10; k++) {
       GemmMicrokernelTester()
         .mr(5)
         .nr(8)
@@ -16731,13 +16833,13 @@
         .m(5)
         .n(8)
         .k(k)
-        .Test(xnn_f32_gemm_minmax_ukernel_5x8__sse2_dup, xnn_init_f32_minmax_sse_params);
+        .Test(xnn_f32_gemm_minmax_ukernel_5x8__sse_load1, xnn_init_f32_minmax_sse_params);
     }
   }
 
-  TEST(F32_GEMM_MINMAX_5X8__SSE2_DUP, k_lt_4_strided_a) {
-    TEST_REQUIRES_X86_SSE2;
-    for (size_t k = 1; k < 4; k++) {
+  TEST(F32_GEMM_MINMAX_5X8__SSE_LOAD1, k_gt_1_strided_a) {
+    TEST_REQUIRES_X86_SSE;
+    for (size_t k = 2; k < 10; k++) {
       GemmMicrokernelTester()
         .mr(5)
         .nr(8)
@@ -16746,14 +16848,14 @@
         .m(5)
         .n(8)
         .k(k)
-        .a_stride(7)
-        .Test(xnn_f32_gemm_minmax_ukernel_5x8__sse2_dup, xnn_init_f32_minmax_sse_params);
+        .a_stride(11)
+        .Test(xnn_f32_gemm_minmax_ukernel_5x8__sse_load1, xnn_init_f32_minmax_sse_params);
     }
   }
 
-  TEST(F32_GEMM_MINMAX_5X8__SSE2_DUP, k_lt_4_subtile) {
-    TEST_REQUIRES_X86_SSE2;
-    for (size_t k = 1; k < 4; k++) {
+  TEST(F32_GEMM_MINMAX_5X8__SSE_LOAD1, k_gt_1_subtile) {
+    TEST_REQUIRES_X86_SSE;
+    for (size_t k = 2; k < 10; k++) {
       for (uint32_t n = 1; n <= 8; n++) {
         for (uint32_t m = 1; m <= 5; m++) {
           GemmMicrokernelTester()
@@ -16765,46 +16867,161 @@
             .n(n)
             .k(k)
             .iterations(1)
-            .Test(xnn_f32_gemm_minmax_ukernel_5x8__sse2_dup, xnn_init_f32_minmax_sse_params);
+            .Test(xnn_f32_gemm_minmax_ukernel_5x8__sse_load1, xnn_init_f32_minmax_sse_params);
         }
       }
     }
   }
 
-  TEST(F32_GEMM_MINMAX_5X8__SSE2_DUP, k_gt_4) {
-    TEST_REQUIRES_X86_SSE2;
-    for (size_t k = 5; k < 8; k++) {
-      GemmMicrokernelTester()
-        .mr(5)
-        .nr(8)
-        .kr(1)
-        .sr(1)
-        .m(5)
-        .n(8)
-        .k(k)
-        .Test(xnn_f32_gemm_minmax_ukernel_5x8__sse2_dup, xnn_init_f32_minmax_sse_params);
+  TEST(F32_GEMM_MINMAX_5X8__SSE_LOAD1, n_gt_8) {
+    TEST_REQUIRES_X86_SSE;
+    for (uint32_t n = 9; n < 16; n++) {
+      for (size_t k = 1; k <= 5; k += 2) {
+        GemmMicrokernelTester()
+          .mr(5)
+          .nr(8)
+          .kr(1)
+          .sr(1)
+          .m(5)
+          .n(n)
+          .k(k)
+          .Test(xnn_f32_gemm_minmax_ukernel_5x8__sse_load1, xnn_init_f32_minmax_sse_params);
+      }
     }
   }
 
-  TEST(F32_GEMM_MINMAX_5X8__SSE2_DUP, k_gt_4_strided_a) {
-    TEST_REQUIRES_X86_SSE2;
-    for (size_t k = 5; k < 8; k++) {
-      GemmMicrokernelTester()
-        .mr(5)
-        .nr(8)
-        .kr(1)
-        .sr(1)
-        .m(5)
-        .n(8)
-        .k(k)
-        .a_stride(11)
-        .Test(xnn_f32_gemm_minmax_ukernel_5x8__sse2_dup, xnn_init_f32_minmax_sse_params);
+  TEST(F32_GEMM_MINMAX_5X8__SSE_LOAD1, n_gt_8_strided_cn) {
+    TEST_REQUIRES_X86_SSE;
+    for (uint32_t n = 9; n < 16; n++) {
+      for (size_t k = 1; k <= 5; k += 2) {
+        GemmMicrokernelTester()
+          .mr(5)
+          .nr(8)
+          .kr(1)
+          .sr(1)
+          .m(5)
+          .n(n)
+          .k(k)
+          .cn_stride(11)
+          .Test(xnn_f32_gemm_minmax_ukernel_5x8__sse_load1, xnn_init_f32_minmax_sse_params);
+      }
     }
   }
 
-  TEST(F32_GEMM_MINMAX_5X8__SSE2_DUP, k_gt_4_subtile) {
-    TEST_REQUIRES_X86_SSE2;
-    for (size_t k = 5; k < 8; k++) {
+  TEST(F32_GEMM_MINMAX_5X8__SSE_LOAD1, n_gt_8_strided_a) {
+    TEST_REQUIRES_X86_SSE;
+    for (uint32_t n = 9; n < 16; n++) {
+      for (size_t k = 1; k <= 5; k += 2) {
+        GemmMicrokernelTester()
+          .mr(5)
+          .nr(8)
+          .kr(1)
+          .sr(1)
+          .m(5)
+          .n(n)
+          .k(k)
+          .a_stride(7)
+          .Test(xnn_f32_gemm_minmax_ukernel_5x8__sse_load1, xnn_init_f32_minmax_sse_params);
+      }
+    }
+  }
+
+  TEST(F32_GEMM_MINMAX_5X8__SSE_LOAD1, n_gt_8_subtile) {
+    TEST_REQUIRES_X86_SSE;
+    for (uint32_t n = 9; n < 16; n++) {
+      for (size_t k = 1; k <= 5; k += 2) {
+        for (uint32_t m = 1; m <= 5; m++) {
+          GemmMicrokernelTester()
+            .mr(5)
+            .nr(8)
+            .kr(1)
+            .sr(1)
+            .m(m)
+            .n(n)
+            .k(k)
+            .iterations(1)
+            .Test(xnn_f32_gemm_minmax_ukernel_5x8__sse_load1, xnn_init_f32_minmax_sse_params);
+        }
+      }
+    }
+  }
+
+  TEST(F32_GEMM_MINMAX_5X8__SSE_LOAD1, n_div_8) {
+    TEST_REQUIRES_X86_SSE;
+    for (uint32_t n = 16; n <= 24; n += 8) {
+      for (size_t k = 1; k <= 5; k += 2) {
+        GemmMicrokernelTester()
+          .mr(5)
+          .nr(8)
+          .kr(1)
+          .sr(1)
+          .m(5)
+          .n(n)
+          .k(k)
+          .Test(xnn_f32_gemm_minmax_ukernel_5x8__sse_load1, xnn_init_f32_minmax_sse_params);
+      }
+    }
+  }
+
+  TEST(F32_GEMM_MINMAX_5X8__SSE_LOAD1, n_div_8_strided_cn) {
+    TEST_REQUIRES_X86_SSE;
+    for (uint32_t n = 16; n <= 24; n += 8) {
+      for (size_t k = 1; k <= 5; k += 2) {
+        GemmMicrokernelTester()
+          .mr(5)
+          .nr(8)
+          .kr(1)
+          .sr(1)
+          .m(5)
+          .n(n)
+          .k(k)
+          .cn_stride(11)
+          .Test(xnn_f32_gemm_minmax_ukernel_5x8__sse_load1, xnn_init_f32_minmax_sse_params);
+      }
+    }
+  }
+
+  TEST(F32_GEMM_MINMAX_5X8__SSE_LOAD1, n_div_8_strided_a) {
+    TEST_REQUIRES_X86_SSE;
+    for (uint32_t n = 16; n <= 24; n += 8) {
+      for (size_t k = 1; k <= 5; k += 2) {
+        GemmMicrokernelTester()
+          .mr(5)
+          .nr(8)
+          .kr(1)
+          .sr(1)
+          .m(5)
+          .n(n)
+          .k(k)
+          .a_stride(7)
+          .Test(xnn_f32_gemm_minmax_ukernel_5x8__sse_load1, xnn_init_f32_minmax_sse_params);
+      }
+    }
+  }
+
+  TEST(F32_GEMM_MINMAX_5X8__SSE_LOAD1, n_div_8_subtile) {
+    TEST_REQUIRES_X86_SSE;
+    for (uint32_t n = 16; n <= 24; n += 8) {
+      for (size_t k = 1; k <= 5; k += 2) {
+        for (uint32_t m = 1; m <= 5; m++) {
+          GemmMicrokernelTester()
+            .mr(5)
+            .nr(8)
+            .kr(1)
+            .sr(1)
+            .m(m)
+            .n(n)
+            .k(k)
+            .iterations(1)
+            .Test(xnn_f32_gemm_minmax_ukernel_5x8__sse_load1, xnn_init_f32_minmax_sse_params);
+        }
+      }
+    }
+  }
+
+  TEST(F32_GEMM_MINMAX_5X8__SSE_LOAD1, strided_cm_subtile) {
+    TEST_REQUIRES_X86_SSE;
+    for (size_t k = 1; k <= 5; k += 2) {
       for (uint32_t n = 1; n <= 8; n++) {
         for (uint32_t m = 1; m <= 5; m++) {
           GemmMicrokernelTester()
@@ -16815,8 +17032,247 @@
             .m(m)
             .n(n)
             .k(k)
+            .cm_stride(11)
             .iterations(1)
-            .Test(xnn_f32_gemm_minmax_ukernel_5x8__sse2_dup, xnn_init_f32_minmax_sse_params);
+            .Test(xnn_f32_gemm_minmax_ukernel_5x8__sse_load1, xnn_init_f32_minmax_sse_params);
+        }
+      }
+    }
+  }
+
+  TEST(F32_GEMM_MINMAX_5X8__SSE_LOAD1, qmin) {
+    TEST_REQUIRES_X86_SSE;
+    GemmMicrokernelTester()
+      .mr(5)
+      .nr(8)
+      .kr(1)
+      .sr(1)
+      .m(5)
+      .n(8)
+      .k(1)
+      .qmin(128)
+      .Test(xnn_f32_gemm_minmax_ukernel_5x8__sse_load1, xnn_init_f32_minmax_sse_params);
+  }
+
+  TEST(F32_GEMM_MINMAX_5X8__SSE_LOAD1, qmax) {
+    TEST_REQUIRES_X86_SSE;
+    GemmMicrokernelTester()
+      .mr(5)
+      .nr(8)
+      .kr(1)
+      .sr(1)
+      .m(5)
+      .n(8)
+      .k(1)
+      .qmax(128)
+      .Test(xnn_f32_gemm_minmax_ukernel_5x8__sse_load1, xnn_init_f32_minmax_sse_params);
+  }
+
+  TEST(F32_GEMM_MINMAX_5X8__SSE_LOAD1, strided_cm) {
+    TEST_REQUIRES_X86_SSE;
+    GemmMicrokernelTester()
+      .mr(5)
+      .nr(8)
+      .kr(1)
+      .sr(1)
+      .m(5)
+      .n(8)
+      .k(1)
+      .cm_stride(11)
+      .Test(xnn_f32_gemm_minmax_ukernel_5x8__sse_load1, xnn_init_f32_minmax_sse_params);
+  }
+#endif  // XNN_ARCH_X86 || XNN_ARCH_X86_64
+
+
+#if XNN_ARCH_X86 || XNN_ARCH_X86_64
+  TEST(F32_GEMM_MINMAX_5X8__SSE2_DUP, k_eq_4) {
+    TEST_REQUIRES_X86_SSE2;
+    GemmMicrokernelTester()
+      .mr(5)
+      .nr(8)
+      .kr(1)
+      .sr(1)
+      .m(5)
+      .n(8)
+      .k(4)
+      .Test(xnn_f32_gemm_minmax_ukernel_5x8__sse2_dup, xnn_init_f32_minmax_sse_params);
+  }
+
+  TEST(F32_GEMM_MINMAX_5X8__SSE2_DUP, strided_cn) {
+    TEST_REQUIRES_X86_SSE2;
+    GemmMicrokernelTester()
+      .mr(5)
+      .nr(8)
+      .kr(1)
+      .sr(1)
+      .m(5)
+      .n(8)
+      .k(4)
+      .cn_stride(11)
+      .Test(xnn_f32_gemm_minmax_ukernel_5x8__sse2_dup, xnn_init_f32_minmax_sse_params);
+  }
+
+  TEST(F32_GEMM_MINMAX_5X8__SSE2_DUP, k_eq_4_strided_a) {
+    TEST_REQUIRES_X86_SSE2;
+    GemmMicrokernelTester()
+      .mr(5)
+      .nr(8)
+      .kr(1)
+      .sr(1)
+      .m(5)
+      .n(8)
+      .k(4)
+      .a_stride(7)
+      .Test(xnn_f32_gemm_minmax_ukernel_5x8__sse2_dup, xnn_init_f32_minmax_sse_params);
+  }
+
+  TEST(F32_GEMM_MINMAX_5X8__SSE2_DUP, k_eq_4_subtile) {
+    TEST_REQUIRES_X86_SSE2;
+    for (uint32_t n = 1; n <= 8; n++) {
+      for (uint32_t m = 1; m <= 5; m++) {
+        GemmMicrokernelTester()
+          .mr(5)
+          .nr(8)
+          .kr(1)
+          .sr(1)
+          .m(m)
+          .n(n)
+          .k(4)
+          .iterations(1)
+          .Test(xnn_f32_gemm_minmax_ukernel_5x8__sse2_dup, xnn_init_f32_minmax_sse_params);
+      }
+    }
+  }
+
+  TEST(F32_GEMM_MINMAX_5X8__SSE2_DUP, k_eq_4_subtile_m) {
+    TEST_REQUIRES_X86_SSE2;
+    for (uint32_t m = 1; m <= 5; m++) {
+      GemmMicrokernelTester()
+        .mr(5)
+        .nr(8)
+        .kr(1)
+        .sr(1)
+        .m(m)
+        .n(8)
+        .k(4)
+        .iterations(1)
+        .Test(xnn_f32_gemm_minmax_ukernel_5x8__sse2_dup, xnn_init_f32_minmax_sse_params);
+    }
+  }
+
+  TEST(F32_GEMM_MINMAX_5X8__SSE2_DUP, k_eq_4_subtile_n) {
+    TEST_REQUIRES_X86_SSE2;
+    for (uint32_t n = 1; n <= 8; n++) {
+      GemmMicrokernelTester()
+        .mr(5)
+        .nr(8)
+        .kr(1)
+        .sr(1)
+        .m(5)
+        .n(n)
+        .k(4)
+        .iterations(1)
+        .Test(xnn_f32_gemm_minmax_ukernel_5x8__sse2_dup, xnn_init_f32_minmax_sse_params);
+    }
+  }
+
+  TEST(F32_GEMM_MINMAX_5X8__SSE2_DUP, k_lt_4) {
+    TEST_REQUIRES_X86_SSE2;
+    for (size_t k = 1; k < 4; k++) {
+      GemmMicrokernelTester()
+        .mr(5)
+        .nr(8)
+        .kr(1)
+        .sr(1)
+        .m(5)
+        .n(8)
+        .k(k)
+        .Test(xnn_f32_gemm_minmax_ukernel_5x8__sse2_dup, xnn_init_f32_minmax_sse_params);
+    }
+  }
+
+  TEST(F32_GEMM_MINMAX_5X8__SSE2_DUP, k_lt_4_strided_a) {
+    TEST_REQUIRES_X86_SSE2;
+    for (size_t k = 1; k < 4; k++) {
+      GemmMicrokernelTester()
+        .mr(5)
+        .nr(8)
+        .kr(1)
+        .sr(1)
+        .m(5)
+        .n(8)
+        .k(k)
+        .a_stride(7)
+        .Test(xnn_f32_gemm_minmax_ukernel_5x8__sse2_dup, xnn_init_f32_minmax_sse_params);
+    }
+  }
+
+  TEST(F32_GEMM_MINMAX_5X8__SSE2_DUP, k_lt_4_subtile) {
+    TEST_REQUIRES_X86_SSE2;
+    for (size_t k = 1; k < 4; k++) {
+      for (uint32_t n = 1; n <= 8; n++) {
+        for (uint32_t m = 1; m <= 5; m++) {
+          GemmMicrokernelTester()
+            .mr(5)
+            .nr(8)
+            .kr(1)
+            .sr(1)
+            .m(m)
+            .n(n)
+            .k(k)
+            .iterations(1)
+            .Test(xnn_f32_gemm_minmax_ukernel_5x8__sse2_dup, xnn_init_f32_minmax_sse_params);
+        }
+      }
+    }
+  }
+
+  TEST(F32_GEMM_MINMAX_5X8__SSE2_DUP, k_gt_4) {
+    TEST_REQUIRES_X86_SSE2;
+    for (size_t k = 5; k < 8; k++) {
+      GemmMicrokernelTester()
+        .mr(5)
+        .nr(8)
+        .kr(1)
+        .sr(1)
+        .m(5)
+        .n(8)
+        .k(k)
+        .Test(xnn_f32_gemm_minmax_ukernel_5x8__sse2_dup, xnn_init_f32_minmax_sse_params);
+    }
+  }
+
+  TEST(F32_GEMM_MINMAX_5X8__SSE2_DUP, k_gt_4_strided_a) {
+    TEST_REQUIRES_X86_SSE2;
+    for (size_t k = 5; k < 8; k++) {
+      GemmMicrokernelTester()
+        .mr(5)
+        .nr(8)
+        .kr(1)
+        .sr(1)
+        .m(5)
+        .n(8)
+        .k(k)
+        .a_stride(11)
+        .Test(xnn_f32_gemm_minmax_ukernel_5x8__sse2_dup, xnn_init_f32_minmax_sse_params);
+    }
+  }
+
+  TEST(F32_GEMM_MINMAX_5X8__SSE2_DUP, k_gt_4_subtile) {
+    TEST_REQUIRES_X86_SSE2;
+    for (size_t k = 5; k < 8; k++) {
+      for (uint32_t n = 1; n <= 8; n++) {
+        for (uint32_t m = 1; m <= 5; m++) {
+          GemmMicrokernelTester()
+            .mr(5)
+            .nr(8)
+            .kr(1)
+            .sr(1)
+            .m(m)
+            .n(n)
+            .k(k)
+            .iterations(1)
+            .Test(xnn_f32_gemm_minmax_ukernel_5x8__sse2_dup, xnn_init_f32_minmax_sse_params);
         }
       }
     }
@@ -16826,312 +17282,1476 @@
     TEST_REQUIRES_X86_SSE2;
     for (size_t k = 8; k <= 40; k += 4) {
       GemmMicrokernelTester()
-        .mr(5)
-        .nr(8)
+        .mr(5)
+        .nr(8)
+        .kr(1)
+        .sr(1)
+        .m(5)
+        .n(8)
+        .k(k)
+        .Test(xnn_f32_gemm_minmax_ukernel_5x8__sse2_dup, xnn_init_f32_minmax_sse_params);
+    }
+  }
+
+  TEST(F32_GEMM_MINMAX_5X8__SSE2_DUP, k_div_4_strided_a) {
+    TEST_REQUIRES_X86_SSE2;
+    for (size_t k = 8; k <= 40; k += 4) {
+      GemmMicrokernelTester()
+        .mr(5)
+        .nr(8)
+        .kr(1)
+        .sr(1)
+        .m(5)
+        .n(8)
+        .k(k)
+        .a_stride(43)
+        .Test(xnn_f32_gemm_minmax_ukernel_5x8__sse2_dup, xnn_init_f32_minmax_sse_params);
+    }
+  }
+
+  TEST(F32_GEMM_MINMAX_5X8__SSE2_DUP, k_div_4_subtile) {
+    TEST_REQUIRES_X86_SSE2;
+    for (size_t k = 8; k <= 40; k += 4) {
+      for (uint32_t n = 1; n <= 8; n++) {
+        for (uint32_t m = 1; m <= 5; m++) {
+          GemmMicrokernelTester()
+            .mr(5)
+            .nr(8)
+            .kr(1)
+            .sr(1)
+            .m(m)
+            .n(n)
+            .k(k)
+            .iterations(1)
+            .Test(xnn_f32_gemm_minmax_ukernel_5x8__sse2_dup, xnn_init_f32_minmax_sse_params);
+        }
+      }
+    }
+  }
+
+  TEST(F32_GEMM_MINMAX_5X8__SSE2_DUP, n_gt_8) {
+    TEST_REQUIRES_X86_SSE2;
+    for (uint32_t n = 9; n < 16; n++) {
+      for (size_t k = 1; k <= 20; k += 5) {
+        GemmMicrokernelTester()
+          .mr(5)
+          .nr(8)
+          .kr(1)
+          .sr(1)
+          .m(5)
+          .n(n)
+          .k(k)
+          .Test(xnn_f32_gemm_minmax_ukernel_5x8__sse2_dup, xnn_init_f32_minmax_sse_params);
+      }
+    }
+  }
+
+  TEST(F32_GEMM_MINMAX_5X8__SSE2_DUP, n_gt_8_strided_cn) {
+    TEST_REQUIRES_X86_SSE2;
+    for (uint32_t n = 9; n < 16; n++) {
+      for (size_t k = 1; k <= 20; k += 5) {
+        GemmMicrokernelTester()
+          .mr(5)
+          .nr(8)
+          .kr(1)
+          .sr(1)
+          .m(5)
+          .n(n)
+          .k(k)
+          .cn_stride(11)
+          .Test(xnn_f32_gemm_minmax_ukernel_5x8__sse2_dup, xnn_init_f32_minmax_sse_params);
+      }
+    }
+  }
+
+  TEST(F32_GEMM_MINMAX_5X8__SSE2_DUP, n_gt_8_strided_a) {
+    TEST_REQUIRES_X86_SSE2;
+    for (uint32_t n = 9; n < 16; n++) {
+      for (size_t k = 1; k <= 20; k += 5) {
+        GemmMicrokernelTester()
+          .mr(5)
+          .nr(8)
+          .kr(1)
+          .sr(1)
+          .m(5)
+          .n(n)
+          .k(k)
+          .a_stride(23)
+          .Test(xnn_f32_gemm_minmax_ukernel_5x8__sse2_dup, xnn_init_f32_minmax_sse_params);
+      }
+    }
+  }
+
+  TEST(F32_GEMM_MINMAX_5X8__SSE2_DUP, n_gt_8_subtile) {
+    TEST_REQUIRES_X86_SSE2;
+    for (uint32_t n = 9; n < 16; n++) {
+      for (size_t k = 1; k <= 20; k += 5) {
+        for (uint32_t m = 1; m <= 5; m++) {
+          GemmMicrokernelTester()
+            .mr(5)
+            .nr(8)
+            .kr(1)
+            .sr(1)
+            .m(m)
+            .n(n)
+            .k(k)
+            .iterations(1)
+            .Test(xnn_f32_gemm_minmax_ukernel_5x8__sse2_dup, xnn_init_f32_minmax_sse_params);
+        }
+      }
+    }
+  }
+
+  TEST(F32_GEMM_MINMAX_5X8__SSE2_DUP, n_div_8) {
+    TEST_REQUIRES_X86_SSE2;
+    for (uint32_t n = 16; n <= 24; n += 8) {
+      for (size_t k = 1; k <= 20; k += 5) {
+        GemmMicrokernelTester()
+          .mr(5)
+          .nr(8)
+          .kr(1)
+          .sr(1)
+          .m(5)
+          .n(n)
+          .k(k)
+          .Test(xnn_f32_gemm_minmax_ukernel_5x8__sse2_dup, xnn_init_f32_minmax_sse_params);
+      }
+    }
+  }
+
+  TEST(F32_GEMM_MINMAX_5X8__SSE2_DUP, n_div_8_strided_cn) {
+    TEST_REQUIRES_X86_SSE2;
+    for (uint32_t n = 16; n <= 24; n += 8) {
+      for (size_t k = 1; k <= 20; k += 5) {
+        GemmMicrokernelTester()
+          .mr(5)
+          .nr(8)
+          .kr(1)
+          .sr(1)
+          .m(5)
+          .n(n)
+          .k(k)
+          .cn_stride(11)
+          .Test(xnn_f32_gemm_minmax_ukernel_5x8__sse2_dup, xnn_init_f32_minmax_sse_params);
+      }
+    }
+  }
+
+  TEST(F32_GEMM_MINMAX_5X8__SSE2_DUP, n_div_8_strided_a) {
+    TEST_REQUIRES_X86_SSE2;
+    for (uint32_t n = 16; n <= 24; n += 8) {
+      for (size_t k = 1; k <= 20; k += 5) {
+        GemmMicrokernelTester()
+          .mr(5)
+          .nr(8)
+          .kr(1)
+          .sr(1)
+          .m(5)
+          .n(n)
+          .k(k)
+          .a_stride(23)
+          .Test(xnn_f32_gemm_minmax_ukernel_5x8__sse2_dup, xnn_init_f32_minmax_sse_params);
+      }
+    }
+  }
+
+  TEST(F32_GEMM_MINMAX_5X8__SSE2_DUP, n_div_8_subtile) {
+    TEST_REQUIRES_X86_SSE2;
+    for (uint32_t n = 16; n <= 24; n += 8) {
+      for (size_t k = 1; k <= 20; k += 5) {
+        for (uint32_t m = 1; m <= 5; m++) {
+          GemmMicrokernelTester()
+            .mr(5)
+            .nr(8)
+            .kr(1)
+            .sr(1)
+            .m(m)
+            .n(n)
+            .k(k)
+            .iterations(1)
+            .Test(xnn_f32_gemm_minmax_ukernel_5x8__sse2_dup, xnn_init_f32_minmax_sse_params);
+        }
+      }
+    }
+  }
+
+  TEST(F32_GEMM_MINMAX_5X8__SSE2_DUP, strided_cm_subtile) {
+    TEST_REQUIRES_X86_SSE2;
+    for (size_t k = 1; k <= 20; k += 5) {
+      for (uint32_t n = 1; n <= 8; n++) {
+        for (uint32_t m = 1; m <= 5; m++) {
+          GemmMicrokernelTester()
+            .mr(5)
+            .nr(8)
+            .kr(1)
+            .sr(1)
+            .m(m)
+            .n(n)
+            .k(k)
+            .cm_stride(11)
+            .iterations(1)
+            .Test(xnn_f32_gemm_minmax_ukernel_5x8__sse2_dup, xnn_init_f32_minmax_sse_params);
+        }
+      }
+    }
+  }
+
+  TEST(F32_GEMM_MINMAX_5X8__SSE2_DUP, qmin) {
+    TEST_REQUIRES_X86_SSE2;
+    GemmMicrokernelTester()
+      .mr(5)
+      .nr(8)
+      .kr(1)
+      .sr(1)
+      .m(5)
+      .n(8)
+      .k(4)
+      .qmin(128)
+      .Test(xnn_f32_gemm_minmax_ukernel_5x8__sse2_dup, xnn_init_f32_minmax_sse_params);
+  }
+
+  TEST(F32_GEMM_MINMAX_5X8__SSE2_DUP, qmax) {
+    TEST_REQUIRES_X86_SSE2;
+    GemmMicrokernelTester()
+      .mr(5)
+      .nr(8)
+      .kr(1)
+      .sr(1)
+      .m(5)
+      .n(8)
+      .k(4)
+      .qmax(128)
+      .Test(xnn_f32_gemm_minmax_ukernel_5x8__sse2_dup, xnn_init_f32_minmax_sse_params);
+  }
+
+  TEST(F32_GEMM_MINMAX_5X8__SSE2_DUP, strided_cm) {
+    TEST_REQUIRES_X86_SSE2;
+    GemmMicrokernelTester()
+      .mr(5)
+      .nr(8)
+      .kr(1)
+      .sr(1)
+      .m(5)
+      .n(8)
+      .k(4)
+      .cm_stride(11)
+      .Test(xnn_f32_gemm_minmax_ukernel_5x8__sse2_dup, xnn_init_f32_minmax_sse_params);
+  }
+#endif  // XNN_ARCH_X86 || XNN_ARCH_X86_64
+
+
+#if XNN_ARCH_X86 || XNN_ARCH_X86_64
+  TEST(F32_GEMM_MINMAX_1X8__AVX_BROADCAST, k_eq_1) {
+    TEST_REQUIRES_X86_AVX;
+    GemmMicrokernelTester()
+      .mr(1)
+      .nr(8)
+      .kr(1)
+      .sr(1)
+      .m(1)
+      .n(8)
+      .k(1)
+      .Test(xnn_f32_gemm_minmax_ukernel_1x8__avx_broadcast, xnn_init_f32_minmax_avx_params);
+  }
+
+  TEST(F32_GEMM_MINMAX_1X8__AVX_BROADCAST, strided_cn) {
+    TEST_REQUIRES_X86_AVX;
+    GemmMicrokernelTester()
+      .mr(1)
+      .nr(8)
+      .kr(1)
+      .sr(1)
+      .m(1)
+      .n(8)
+      .k(1)
+      .cn_stride(11)
+      .Test(xnn_f32_gemm_minmax_ukernel_1x8__avx_broadcast, xnn_init_f32_minmax_avx_params);
+  }
+
+  TEST(F32_GEMM_MINMAX_1X8__AVX_BROADCAST, k_eq_1_strided_a) {
+    TEST_REQUIRES_X86_AVX;
+    GemmMicrokernelTester()
+      .mr(1)
+      .nr(8)
+      .kr(1)
+      .sr(1)
+      .m(1)
+      .n(8)
+      .k(1)
+      .a_stride(3)
+      .Test(xnn_f32_gemm_minmax_ukernel_1x8__avx_broadcast, xnn_init_f32_minmax_avx_params);
+  }
+
+  TEST(F32_GEMM_MINMAX_1X8__AVX_BROADCAST, k_eq_1_subtile) {
+    TEST_REQUIRES_X86_AVX;
+    for (uint32_t n = 1; n <= 8; n++) {
+      for (uint32_t m = 1; m <= 1; m++) {
+        GemmMicrokernelTester()
+          .mr(1)
+          .nr(8)
+          .kr(1)
+          .sr(1)
+          .m(m)
+          .n(n)
+          .k(1)
+          .iterations(1)
+          .Test(xnn_f32_gemm_minmax_ukernel_1x8__avx_broadcast, xnn_init_f32_minmax_avx_params);
+      }
+    }
+  }
+
+  TEST(F32_GEMM_MINMAX_1X8__AVX_BROADCAST, k_eq_1_subtile_m) {
+    TEST_REQUIRES_X86_AVX;
+    for (uint32_t m = 1; m <= 1; m++) {
+      GemmMicrokernelTester()
+        .mr(1)
+        .nr(8)
+        .kr(1)
+        .sr(1)
+        .m(m)
+        .n(8)
+        .k(1)
+        .iterations(1)
+        .Test(xnn_f32_gemm_minmax_ukernel_1x8__avx_broadcast, xnn_init_f32_minmax_avx_params);
+    }
+  }
+
+  TEST(F32_GEMM_MINMAX_1X8__AVX_BROADCAST, k_eq_1_subtile_n) {
+    TEST_REQUIRES_X86_AVX;
+    for (uint32_t n = 1; n <= 8; n++) {
+      GemmMicrokernelTester()
+        .mr(1)
+        .nr(8)
+        .kr(1)
+        .sr(1)
+        .m(1)
+        .n(n)
+        .k(1)
+        .iterations(1)
+        .Test(xnn_f32_gemm_minmax_ukernel_1x8__avx_broadcast, xnn_init_f32_minmax_avx_params);
+    }
+  }
+
+  TEST(F32_GEMM_MINMAX_1X8__AVX_BROADCAST, k_gt_1) {
+    TEST_REQUIRES_X86_AVX;
+    for (size_t k = 2; k < 10; k++) {
+      GemmMicrokernelTester()
+        .mr(1)
+        .nr(8)
+        .kr(1)
+        .sr(1)
+        .m(1)
+        .n(8)
+        .k(k)
+        .Test(xnn_f32_gemm_minmax_ukernel_1x8__avx_broadcast, xnn_init_f32_minmax_avx_params);
+    }
+  }
+
+  TEST(F32_GEMM_MINMAX_1X8__AVX_BROADCAST, k_gt_1_strided_a) {
+    TEST_REQUIRES_X86_AVX;
+    for (size_t k = 2; k < 10; k++) {
+      GemmMicrokernelTester()
+        .mr(1)
+        .nr(8)
+        .kr(1)
+        .sr(1)
+        .m(1)
+        .n(8)
+        .k(k)
+        .a_stride(11)
+        .Test(xnn_f32_gemm_minmax_ukernel_1x8__avx_broadcast, xnn_init_f32_minmax_avx_params);
+    }
+  }
+
+  TEST(F32_GEMM_MINMAX_1X8__AVX_BROADCAST, k_gt_1_subtile) {
+    TEST_REQUIRES_X86_AVX;
+    for (size_t k = 2; k < 10; k++) {
+      for (uint32_t n = 1; n <= 8; n++) {
+        for (uint32_t m = 1; m <= 1; m++) {
+          GemmMicrokernelTester()
+            .mr(1)
+            .nr(8)
+            .kr(1)
+            .sr(1)
+            .m(m)
+            .n(n)
+            .k(k)
+            .iterations(1)
+            .Test(xnn_f32_gemm_minmax_ukernel_1x8__avx_broadcast, xnn_init_f32_minmax_avx_params);
+        }
+      }
+    }
+  }
+
+  TEST(F32_GEMM_MINMAX_1X8__AVX_BROADCAST, n_gt_8) {
+    TEST_REQUIRES_X86_AVX;
+    for (uint32_t n = 9; n < 16; n++) {
+      for (size_t k = 1; k <= 5; k += 2) {
+        GemmMicrokernelTester()
+          .mr(1)
+          .nr(8)
+          .kr(1)
+          .sr(1)
+          .m(1)
+          .n(n)
+          .k(k)
+          .Test(xnn_f32_gemm_minmax_ukernel_1x8__avx_broadcast, xnn_init_f32_minmax_avx_params);
+      }
+    }
+  }
+
+  TEST(F32_GEMM_MINMAX_1X8__AVX_BROADCAST, n_gt_8_strided_cn) {
+    TEST_REQUIRES_X86_AVX;
+    for (uint32_t n = 9; n < 16; n++) {
+      for (size_t k = 1; k <= 5; k += 2) {
+        GemmMicrokernelTester()
+          .mr(1)
+          .nr(8)
+          .kr(1)
+          .sr(1)
+          .m(1)
+          .n(n)
+          .k(k)
+          .cn_stride(11)
+          .Test(xnn_f32_gemm_minmax_ukernel_1x8__avx_broadcast, xnn_init_f32_minmax_avx_params);
+      }
+    }
+  }
+
+  TEST(F32_GEMM_MINMAX_1X8__AVX_BROADCAST, n_gt_8_strided_a) {
+    TEST_REQUIRES_X86_AVX;
+    for (uint32_t n = 9; n < 16; n++) {
+      for (size_t k = 1; k <= 5; k += 2) {
+        GemmMicrokernelTester()
+          .mr(1)
+          .nr(8)
+          .kr(1)
+          .sr(1)
+          .m(1)
+          .n(n)
+          .k(k)
+          .a_stride(7)
+          .Test(xnn_f32_gemm_minmax_ukernel_1x8__avx_broadcast, xnn_init_f32_minmax_avx_params);
+      }
+    }
+  }
+
+  TEST(F32_GEMM_MINMAX_1X8__AVX_BROADCAST, n_gt_8_subtile) {
+    TEST_REQUIRES_X86_AVX;
+    for (uint32_t n = 9; n < 16; n++) {
+      for (size_t k = 1; k <= 5; k += 2) {
+        for (uint32_t m = 1; m <= 1; m++) {
+          GemmMicrokernelTester()
+            .mr(1)
+            .nr(8)
+            .kr(1)
+            .sr(1)
+            .m(m)
+            .n(n)
+            .k(k)
+            .iterations(1)
+            .Test(xnn_f32_gemm_minmax_ukernel_1x8__avx_broadcast, xnn_init_f32_minmax_avx_params);
+        }
+      }
+    }
+  }
+
+  TEST(F32_GEMM_MINMAX_1X8__AVX_BROADCAST, n_div_8) {
+    TEST_REQUIRES_X86_AVX;
+    for (uint32_t n = 16; n <= 24; n += 8) {
+      for (size_t k = 1; k <= 5; k += 2) {
+        GemmMicrokernelTester()
+          .mr(1)
+          .nr(8)
+          .kr(1)
+          .sr(1)
+          .m(1)
+          .n(n)
+          .k(k)
+          .Test(xnn_f32_gemm_minmax_ukernel_1x8__avx_broadcast, xnn_init_f32_minmax_avx_params);
+      }
+    }
+  }
+
+  TEST(F32_GEMM_MINMAX_1X8__AVX_BROADCAST, n_div_8_strided_cn) {
+    TEST_REQUIRES_X86_AVX;
+    for (uint32_t n = 16; n <= 24; n += 8) {
+      for (size_t k = 1; k <= 5; k += 2) {
+        GemmMicrokernelTester()
+          .mr(1)
+          .nr(8)
+          .kr(1)
+          .sr(1)
+          .m(1)
+          .n(n)
+          .k(k)
+          .cn_stride(11)
+          .Test(xnn_f32_gemm_minmax_ukernel_1x8__avx_broadcast, xnn_init_f32_minmax_avx_params);
+      }
+    }
+  }
+
+  TEST(F32_GEMM_MINMAX_1X8__AVX_BROADCAST, n_div_8_strided_a) {
+    TEST_REQUIRES_X86_AVX;
+    for (uint32_t n = 16; n <= 24; n += 8) {
+      for (size_t k = 1; k <= 5; k += 2) {
+        GemmMicrokernelTester()
+          .mr(1)
+          .nr(8)
+          .kr(1)
+          .sr(1)
+          .m(1)
+          .n(n)
+          .k(k)
+          .a_stride(7)
+          .Test(xnn_f32_gemm_minmax_ukernel_1x8__avx_broadcast, xnn_init_f32_minmax_avx_params);
+      }
+    }
+  }
+
+  TEST(F32_GEMM_MINMAX_1X8__AVX_BROADCAST, n_div_8_subtile) {
+    TEST_REQUIRES_X86_AVX;
+    for (uint32_t n = 16; n <= 24; n += 8) {
+      for (size_t k = 1; k <= 5; k += 2) {
+        for (uint32_t m = 1; m <= 1; m++) {
+          GemmMicrokernelTester()
+            .mr(1)
+            .nr(8)
+            .kr(1)
+            .sr(1)
+            .m(m)
+            .n(n)
+            .k(k)
+            .iterations(1)
+            .Test(xnn_f32_gemm_minmax_ukernel_1x8__avx_broadcast, xnn_init_f32_minmax_avx_params);
+        }
+      }
+    }
+  }
+
+  TEST(F32_GEMM_MINMAX_1X8__AVX_BROADCAST, strided_cm_subtile) {
+    TEST_REQUIRES_X86_AVX;
+    for (size_t k = 1; k <= 5; k += 2) {
+      for (uint32_t n = 1; n <= 8; n++) {
+        for (uint32_t m = 1; m <= 1; m++) {
+          GemmMicrokernelTester()
+            .mr(1)
+            .nr(8)
+            .kr(1)
+            .sr(1)
+            .m(m)
+            .n(n)
+            .k(k)
+            .cm_stride(11)
+            .iterations(1)
+            .Test(xnn_f32_gemm_minmax_ukernel_1x8__avx_broadcast, xnn_init_f32_minmax_avx_params);
+        }
+      }
+    }
+  }
+
+  TEST(F32_GEMM_MINMAX_1X8__AVX_BROADCAST, qmin) {
+    TEST_REQUIRES_X86_AVX;
+    GemmMicrokernelTester()
+      .mr(1)
+      .nr(8)
+      .kr(1)
+      .sr(1)
+      .m(1)
+      .n(8)
+      .k(1)
+      .qmin(128)
+      .Test(xnn_f32_gemm_minmax_ukernel_1x8__avx_broadcast, xnn_init_f32_minmax_avx_params);
+  }
+
+  TEST(F32_GEMM_MINMAX_1X8__AVX_BROADCAST, qmax) {
+    TEST_REQUIRES_X86_AVX;
+    GemmMicrokernelTester()
+      .mr(1)
+      .nr(8)
+      .kr(1)
+      .sr(1)
+      .m(1)
+      .n(8)
+      .k(1)
+      .qmax(128)
+      .Test(xnn_f32_gemm_minmax_ukernel_1x8__avx_broadcast, xnn_init_f32_minmax_avx_params);
+  }
+
+  TEST(F32_GEMM_MINMAX_1X8__AVX_BROADCAST, strided_cm) {
+    TEST_REQUIRES_X86_AVX;
+    GemmMicrokernelTester()
+      .mr(1)
+      .nr(8)
+      .kr(1)
+      .sr(1)
+      .m(1)
+      .n(8)
+      .k(1)
+      .cm_stride(11)
+      .Test(xnn_f32_gemm_minmax_ukernel_1x8__avx_broadcast, xnn_init_f32_minmax_avx_params);
+  }
+#endif  // XNN_ARCH_X86 || XNN_ARCH_X86_64
+
+
+#if XNN_ARCH_X86 || XNN_ARCH_X86_64
+  TEST(F32_GEMM_MINMAX_1X16__AVX_BROADCAST_ACC4, k_eq_4) {
+    TEST_REQUIRES_X86_AVX;
+    GemmMicrokernelTester()
+      .mr(1)
+      .nr(16)
+      .kr(1)
+      .sr(1)
+      .m(1)
+      .n(16)
+      .k(4)
+      .Test(xnn_f32_gemm_minmax_ukernel_1x16__avx_broadcast_acc4, xnn_init_f32_minmax_avx_params);
+  }
+
+  TEST(F32_GEMM_MINMAX_1X16__AVX_BROADCAST_ACC4, strided_cn) {
+    TEST_REQUIRES_X86_AVX;
+    GemmMicrokernelTester()
+      .mr(1)
+      .nr(16)
+      .kr(1)
+      .sr(1)
+      .m(1)
+      .n(16)
+      .k(4)
+      .cn_stride(19)
+      .Test(xnn_f32_gemm_minmax_ukernel_1x16__avx_broadcast_acc4, xnn_init_f32_minmax_avx_params);
+  }
+
+  TEST(F32_GEMM_MINMAX_1X16__AVX_BROADCAST_ACC4, k_eq_4_strided_a) {
+    TEST_REQUIRES_X86_AVX;
+    GemmMicrokernelTester()
+      .mr(1)
+      .nr(16)
+      .kr(1)
+      .sr(1)
+      .m(1)
+      .n(16)
+      .k(4)
+      .a_stride(7)
+      .Test(xnn_f32_gemm_minmax_ukernel_1x16__avx_broadcast_acc4, xnn_init_f32_minmax_avx_params);
+  }
+
+  TEST(F32_GEMM_MINMAX_1X16__AVX_BROADCAST_ACC4, k_eq_4_subtile) {
+    TEST_REQUIRES_X86_AVX;
+    for (uint32_t n = 1; n <= 16; n++) {
+      for (uint32_t m = 1; m <= 1; m++) {
+        GemmMicrokernelTester()
+          .mr(1)
+          .nr(16)
+          .kr(1)
+          .sr(1)
+          .m(m)
+          .n(n)
+          .k(4)
+          .iterations(1)
+          .Test(xnn_f32_gemm_minmax_ukernel_1x16__avx_broadcast_acc4, xnn_init_f32_minmax_avx_params);
+      }
+    }
+  }
+
+  TEST(F32_GEMM_MINMAX_1X16__AVX_BROADCAST_ACC4, k_eq_4_subtile_m) {
+    TEST_REQUIRES_X86_AVX;
+    for (uint32_t m = 1; m <= 1; m++) {
+      GemmMicrokernelTester()
+        .mr(1)
+        .nr(16)
+        .kr(1)
+        .sr(1)
+        .m(m)
+        .n(16)
+        .k(4)
+        .iterations(1)
+        .Test(xnn_f32_gemm_minmax_ukernel_1x16__avx_broadcast_acc4, xnn_init_f32_minmax_avx_params);
+    }
+  }
+
+  TEST(F32_GEMM_MINMAX_1X16__AVX_BROADCAST_ACC4, k_eq_4_subtile_n) {
+    TEST_REQUIRES_X86_AVX;
+    for (uint32_t n = 1; n <= 16; n++) {
+      GemmMicrokernelTester()
+        .mr(1)
+        .nr(16)
+        .kr(1)
+        .sr(1)
+        .m(1)
+        .n(n)
+        .k(4)
+        .iterations(1)
+        .Test(xnn_f32_gemm_minmax_ukernel_1x16__avx_broadcast_acc4, xnn_init_f32_minmax_avx_params);
+    }
+  }
+
+  TEST(F32_GEMM_MINMAX_1X16__AVX_BROADCAST_ACC4, k_lt_4) {
+    TEST_REQUIRES_X86_AVX;
+    for (size_t k = 1; k < 4; k++) {
+      GemmMicrokernelTester()
+        .mr(1)
+        .nr(16)
+        .kr(1)
+        .sr(1)
+        .m(1)
+        .n(16)
+        .k(k)
+        .Test(xnn_f32_gemm_minmax_ukernel_1x16__avx_broadcast_acc4, xnn_init_f32_minmax_avx_params);
+    }
+  }
+
+  TEST(F32_GEMM_MINMAX_1X16__AVX_BROADCAST_ACC4, k_lt_4_strided_a) {
+    TEST_REQUIRES_X86_AVX;
+    for (size_t k = 1; k < 4; k++) {
+      GemmMicrokernelTester()
+        .mr(1)
+        .nr(16)
+        .kr(1)
+        .sr(1)
+        .m(1)
+        .n(16)
+        .k(k)
+        .a_stride(7)
+        .Test(xnn_f32_gemm_minmax_ukernel_1x16__avx_broadcast_acc4, xnn_init_f32_minmax_avx_params);
+    }
+  }
+
+  TEST(F32_GEMM_MINMAX_1X16__AVX_BROADCAST_ACC4, k_lt_4_subtile) {
+    TEST_REQUIRES_X86_AVX;
+    for (size_t k = 1; k < 4; k++) {
+      for (uint32_t n = 1; n <= 16; n++) {
+        for (uint32_t m = 1; m <= 1; m++) {
+          GemmMicrokernelTester()
+            .mr(1)
+            .nr(16)
+            .kr(1)
+            .sr(1)
+            .m(m)
+            .n(n)
+            .k(k)
+            .iterations(1)
+            .Test(xnn_f32_gemm_minmax_ukernel_1x16__avx_broadcast_acc4, xnn_init_f32_minmax_avx_params);
+        }
+      }
+    }
+  }
+
+  TEST(F32_GEMM_MINMAX_1X16__AVX_BROADCAST_ACC4, k_gt_4) {
+    TEST_REQUIRES_X86_AVX;
+    for (size_t k = 5; k < 8; k++) {
+      GemmMicrokernelTester()
+        .mr(1)
+        .nr(16)
+        .kr(1)
+        .sr(1)
+        .m(1)
+        .n(16)
+        .k(k)
+        .Test(xnn_f32_gemm_minmax_ukernel_1x16__avx_broadcast_acc4, xnn_init_f32_minmax_avx_params);
+    }
+  }
+
+  TEST(F32_GEMM_MINMAX_1X16__AVX_BROADCAST_ACC4, k_gt_4_strided_a) {
+    TEST_REQUIRES_X86_AVX;
+    for (size_t k = 5; k < 8; k++) {
+      GemmMicrokernelTester()
+        .mr(1)
+        .nr(16)
+        .kr(1)
+        .sr(1)
+        .m(1)
+        .n(16)
+        .k(k)
+        .a_stride(11)
+        .Test(xnn_f32_gemm_minmax_ukernel_1x16__avx_broadcast_acc4, xnn_init_f32_minmax_avx_params);
+    }
+  }
+
+  TEST(F32_GEMM_MINMAX_1X16__AVX_BROADCAST_ACC4, k_gt_4_subtile) {
+    TEST_REQUIRES_X86_AVX;
+    for (size_t k = 5; k < 8; k++) {
+      for (uint32_t n = 1; n <= 16; n++) {
+        for (uint32_t m = 1; m <= 1; m++) {
+          GemmMicrokernelTester()
+            .mr(1)
+            .nr(16)
+            .kr(1)
+            .sr(1)
+            .m(m)
+            .n(n)
+            .k(k)
+            .iterations(1)
+            .Test(xnn_f32_gemm_minmax_ukernel_1x16__avx_broadcast_acc4, xnn_init_f32_minmax_avx_params);
+        }
+      }
+    }
+  }
+
+  TEST(F32_GEMM_MINMAX_1X16__AVX_BROADCAST_ACC4, k_div_4) {
+    TEST_REQUIRES_X86_AVX;
+    for (size_t k = 8; k <= 40; k += 4) {
+      GemmMicrokernelTester()
+        .mr(1)
+        .nr(16)
+        .kr(1)
+        .sr(1)
+        .m(1)
+        .n(16)
+        .k(k)
+        .Test(xnn_f32_gemm_minmax_ukernel_1x16__avx_broadcast_acc4, xnn_init_f32_minmax_avx_params);
+    }
+  }
+
+  TEST(F32_GEMM_MINMAX_1X16__AVX_BROADCAST_ACC4, k_div_4_strided_a) {
+    TEST_REQUIRES_X86_AVX;
+    for (size_t k = 8; k <= 40; k += 4) {
+      GemmMicrokernelTester()
+        .mr(1)
+        .nr(16)
+        .kr(1)
+        .sr(1)
+        .m(1)
+        .n(16)
+        .k(k)
+        .a_stride(43)
+        .Test(xnn_f32_gemm_minmax_ukernel_1x16__avx_broadcast_acc4, xnn_init_f32_minmax_avx_params);
+    }
+  }
+
+  TEST(F32_GEMM_MINMAX_1X16__AVX_BROADCAST_ACC4, k_div_4_subtile) {
+    TEST_REQUIRES_X86_AVX;
+    for (size_t k = 8; k <= 40; k += 4) {
+      for (uint32_t n = 1; n <= 16; n++) {
+        for (uint32_t m = 1; m <= 1; m++) {
+          GemmMicrokernelTester()
+            .mr(1)
+            .nr(16)
+            .kr(1)
+            .sr(1)
+            .m(m)
+            .n(n)
+            .k(k)
+            .iterations(1)
+            .Test(xnn_f32_gemm_minmax_ukernel_1x16__avx_broadcast_acc4, xnn_init_f32_minmax_avx_params);
+        }
+      }
+    }
+  }
+
+  TEST(F32_GEMM_MINMAX_1X16__AVX_BROADCAST_ACC4, n_gt_16) {
+    TEST_REQUIRES_X86_AVX;
+    for (uint32_t n = 17; n < 32; n++) {
+      for (size_t k = 1; k <= 20; k += 5) {
+        GemmMicrokernelTester()
+          .mr(1)
+          .nr(16)
+          .kr(1)
+          .sr(1)
+          .m(1)
+          .n(n)
+          .k(k)
+          .Test(xnn_f32_gemm_minmax_ukernel_1x16__avx_broadcast_acc4, xnn_init_f32_minmax_avx_params);
+      }
+    }
+  }
+
+  TEST(F32_GEMM_MINMAX_1X16__AVX_BROADCAST_ACC4, n_gt_16_strided_cn) {
+    TEST_REQUIRES_X86_AVX;
+    for (uint32_t n = 17; n < 32; n++) {
+      for (size_t k = 1; k <= 20; k += 5) {
+        GemmMicrokernelTester()
+          .mr(1)
+          .nr(16)
+          .kr(1)
+          .sr(1)
+          .m(1)
+          .n(n)
+          .k(k)
+          .cn_stride(19)
+          .Test(xnn_f32_gemm_minmax_ukernel_1x16__avx_broadcast_acc4, xnn_init_f32_minmax_avx_params);
+      }
+    }
+  }
+
+  TEST(F32_GEMM_MINMAX_1X16__AVX_BROADCAST_ACC4, n_gt_16_strided_a) {
+    TEST_REQUIRES_X86_AVX;
+    for (uint32_t n = 17; n < 32; n++) {
+      for (size_t k = 1; k <= 20; k += 5) {
+        GemmMicrokernelTester()
+          .mr(1)
+          .nr(16)
+          .kr(1)
+          .sr(1)
+          .m(1)
+          .n(n)
+          .k(k)
+          .a_stride(23)
+          .Test(xnn_f32_gemm_minmax_ukernel_1x16__avx_broadcast_acc4, xnn_init_f32_minmax_avx_params);
+      }
+    }
+  }
+
+  TEST(F32_GEMM_MINMAX_1X16__AVX_BROADCAST_ACC4, n_gt_16_subtile) {
+    TEST_REQUIRES_X86_AVX;
+    for (uint32_t n = 17; n < 32; n++) {
+      for (size_t k = 1; k <= 20; k += 5) {
+        for (uint32_t m = 1; m <= 1; m++) {
+          GemmMicrokernelTester()
+            .mr(1)
+            .nr(16)
+            .kr(1)
+            .sr(1)
+            .m(m)
+            .n(n)
+            .k(k)
+            .iterations(1)
+            .Test(xnn_f32_gemm_minmax_ukernel_1x16__avx_broadcast_acc4, xnn_init_f32_minmax_avx_params);
+        }
+      }
+    }
+  }
+
+  TEST(F32_GEMM_MINMAX_1X16__AVX_BROADCAST_ACC4, n_div_16) {
+    TEST_REQUIRES_X86_AVX;
+    for (uint32_t n = 32; n <= 48; n += 16) {
+      for (size_t k = 1; k <= 20; k += 5) {
+        GemmMicrokernelTester()
+          .mr(1)
+          .nr(16)
+          .kr(1)
+          .sr(1)
+          .m(1)
+          .n(n)
+          .k(k)
+          .Test(xnn_f32_gemm_minmax_ukernel_1x16__avx_broadcast_acc4, xnn_init_f32_minmax_avx_params);
+      }
+    }
+  }
+
+  TEST(F32_GEMM_MINMAX_1X16__AVX_BROADCAST_ACC4, n_div_16_strided_cn) {
+    TEST_REQUIRES_X86_AVX;
+    for (uint32_t n = 32; n <= 48; n += 16) {
+      for (size_t k = 1; k <= 20; k += 5) {
+        GemmMicrokernelTester()
+          .mr(1)
+          .nr(16)
+          .kr(1)
+          .sr(1)
+          .m(1)
+          .n(n)
+          .k(k)
+          .cn_stride(19)
+          .Test(xnn_f32_gemm_minmax_ukernel_1x16__avx_broadcast_acc4, xnn_init_f32_minmax_avx_params);
+      }
+    }
+  }
+
+  TEST(F32_GEMM_MINMAX_1X16__AVX_BROADCAST_ACC4, n_div_16_strided_a) {
+    TEST_REQUIRES_X86_AVX;
+    for (uint32_t n = 32; n <= 48; n += 16) {
+      for (size_t k = 1; k <= 20; k += 5) {
+        GemmMicrokernelTester()
+          .mr(1)
+          .nr(16)
+          .kr(1)
+          .sr(1)
+          .m(1)
+          .n(n)
+          .k(k)
+          .a_stride(23)
+          .Test(xnn_f32_gemm_minmax_ukernel_1x16__avx_broadcast_acc4, xnn_init_f32_minmax_avx_params);
+      }
+    }
+  }
+
+  TEST(F32_GEMM_MINMAX_1X16__AVX_BROADCAST_ACC4, n_div_16_subtile) {
+    TEST_REQUIRES_X86_AVX;
+    for (uint32_t n = 32; n <= 48; n += 16) {
+      for (size_t k = 1; k <= 20; k += 5) {
+        for (uint32_t m = 1; m <= 1; m++) {
+          GemmMicrokernelTester()
+            .mr(1)
+            .nr(16)
+            .kr(1)
+            .sr(1)
+            .m(m)
+            .n(n)
+            .k(k)
+            .iterations(1)
+            .Test(xnn_f32_gemm_minmax_ukernel_1x16__avx_broadcast_acc4, xnn_init_f32_minmax_avx_params);
+        }
+      }
+    }
+  }
+
+  TEST(F32_GEMM_MINMAX_1X16__AVX_BROADCAST_ACC4, strided_cm_subtile) {
+    TEST_REQUIRES_X86_AVX;
+    for (size_t k = 1; k <= 20; k += 5) {
+      for (uint32_t n = 1; n <= 16; n++) {
+        for (uint32_t m = 1; m <= 1; m++) {
+          GemmMicrokernelTester()
+            .mr(1)
+            .nr(16)
+            .kr(1)
+            .sr(1)
+            .m(m)
+            .n(n)
+            .k(k)
+            .cm_stride(19)
+            .iterations(1)
+            .Test(xnn_f32_gemm_minmax_ukernel_1x16__avx_broadcast_acc4, xnn_init_f32_minmax_avx_params);
+        }
+      }
+    }
+  }
+
+  TEST(F32_GEMM_MINMAX_1X16__AVX_BROADCAST_ACC4, qmin) {
+    TEST_REQUIRES_X86_AVX;
+    GemmMicrokernelTester()
+      .mr(1)
+      .nr(16)
+      .kr(1)
+      .sr(1)
+      .m(1)
+      .n(16)
+      .k(4)
+      .qmin(128)
+      .Test(xnn_f32_gemm_minmax_ukernel_1x16__avx_broadcast_acc4, xnn_init_f32_minmax_avx_params);
+  }
+
+  TEST(F32_GEMM_MINMAX_1X16__AVX_BROADCAST_ACC4, qmax) {
+    TEST_REQUIRES_X86_AVX;
+    GemmMicrokernelTester()
+      .mr(1)
+      .nr(16)
+      .kr(1)
+      .sr(1)
+      .m(1)
+      .n(16)
+      .k(4)
+      .qmax(128)
+      .Test(xnn_f32_gemm_minmax_ukernel_1x16__avx_broadcast_acc4, xnn_init_f32_minmax_avx_params);
+  }
+
+  TEST(F32_GEMM_MINMAX_1X16__AVX_BROADCAST_ACC4, strided_cm) {
+    TEST_REQUIRES_X86_AVX;
+    GemmMicrokernelTester()
+      .mr(1)
+      .nr(16)
+      .kr(1)
+      .sr(1)
+      .m(1)
+      .n(16)
+      .k(4)
+      .cm_stride(19)
+      .Test(xnn_f32_gemm_minmax_ukernel_1x16__avx_broadcast_acc4, xnn_init_f32_minmax_avx_params);
+  }
+#endif  // XNN_ARCH_X86 || XNN_ARCH_X86_64
+
+
+#if XNN_ARCH_X86 || XNN_ARCH_X86_64
+  TEST(F32_GEMM_MINMAX_3X16__AVX_BROADCAST, k_eq_1) {
+    TEST_REQUIRES_X86_AVX;
+    GemmMicrokernelTester()
+      .mr(3)
+      .nr(16)
+      .kr(1)
+      .sr(1)
+      .m(3)
+      .n(16)
+      .k(1)
+      .Test(xnn_f32_gemm_minmax_ukernel_3x16__avx_broadcast, xnn_init_f32_minmax_avx_params);
+  }
+
+  TEST(F32_GEMM_MINMAX_3X16__AVX_BROADCAST, strided_cn) {
+    TEST_REQUIRES_X86_AVX;
+    GemmMicrokernelTester()
+      .mr(3)
+      .nr(16)
+      .kr(1)
+      .sr(1)
+      .m(3)
+      .n(16)
+      .k(1)
+      .cn_stride(19)
+      .Test(xnn_f32_gemm_minmax_ukernel_3x16__avx_broadcast, xnn_init_f32_minmax_avx_params);
+  }
+
+  TEST(F32_GEMM_MINMAX_3X16__AVX_BROADCAST, k_eq_1_strided_a) {
+    TEST_REQUIRES_X86_AVX;
+    GemmMicrokernelTester()
+      .mr(3)
+      .nr(16)
+      .kr(1)
+      .sr(1)
+      .m(3)
+      .n(16)
+      .k(1)
+      .a_stride(3)
+      .Test(xnn_f32_gemm_minmax_ukernel_3x16__avx_broadcast, xnn_init_f32_minmax_avx_params);
+  }
+
+  TEST(F32_GEMM_MINMAX_3X16__AVX_BROADCAST, k_eq_1_subtile) {
+    TEST_REQUIRES_X86_AVX;
+    for (uint32_t n = 1; n <= 16; n++) {
+      for (uint32_t m = 1; m <= 3; m++) {
+        GemmMicrokernelTester()
+          .mr(3)
+          .nr(16)
+          .kr(1)
+          .sr(1)
+          .m(m)
+          .n(n)
+          .k(1)
+          .iterations(1)
+          .Test(xnn_f32_gemm_minmax_ukernel_3x16__avx_broadcast, xnn_init_f32_minmax_avx_params);
+      }
+    }
+  }
+
+  TEST(F32_GEMM_MINMAX_3X16__AVX_BROADCAST, k_eq_1_subtile_m) {
+    TEST_REQUIRES_X86_AVX;
+    for (uint32_t m = 1; m <= 3; m++) {
+      GemmMicrokernelTester()
+        .mr(3)
+        .nr(16)
+        .kr(1)
+        .sr(1)
+        .m(m)
+        .n(16)
+        .k(1)
+        .iterations(1)
+        .Test(xnn_f32_gemm_minmax_ukernel_3x16__avx_broadcast, xnn_init_f32_minmax_avx_params);
+    }
+  }
+
+  TEST(F32_GEMM_MINMAX_3X16__AVX_BROADCAST, k_eq_1_subtile_n) {
+    TEST_REQUIRES_X86_AVX;
+    for (uint32_t n = 1; n <= 16; n++) {
+      GemmMicrokernelTester()
+        .mr(3)
+        .nr(16)
+        .kr(1)
+        .sr(1)
+        .m(3)
+        .n(n)
+        .k(1)
+        .iterations(1)
+        .Test(xnn_f32_gemm_minmax_ukernel_3x16__avx_broadcast, xnn_init_f32_minmax_avx_params);
+    }
+  }
+
+  TEST(F32_GEMM_MINMAX_3X16__AVX_BROADCAST, k_gt_1) {
+    TEST_REQUIRES_X86_AVX;
+    for (size_t k = 2; k < 10; k++) {
+      GemmMicrokernelTester()
+        .mr(3)
+        .nr(16)
         .kr(1)
         .sr(1)
-        .m(5)
-        .n(8)
+        .m(3)
+        .n(16)
         .k(k)
-        .Test(xnn_f32_gemm_minmax_ukernel_5x8__sse2_dup, xnn_init_f32_minmax_sse_params);
+        .Test(xnn_f32_gemm_minmax_ukernel_3x16__avx_broadcast, xnn_init_f32_minmax_avx_params);
     }
   }
 
-  TEST(F32_GEMM_MINMAX_5X8__SSE2_DUP, k_div_4_strided_a) {
-    TEST_REQUIRES_X86_SSE2;
-    for (size_t k = 8; k <= 40; k += 4) {
+  TEST(F32_GEMM_MINMAX_3X16__AVX_BROADCAST, k_gt_1_strided_a) {
+    TEST_REQUIRES_X86_AVX;
+    for (size_t k = 2; k < 10; k++) {
       GemmMicrokernelTester()
-        .mr(5)
-        .nr(8)
+        .mr(3)
+        .nr(16)
         .kr(1)
         .sr(1)
-        .m(5)
-        .n(8)
+        .m(3)
+        .n(16)
         .k(k)
-        .a_stride(43)
-        .Test(xnn_f32_gemm_minmax_ukernel_5x8__sse2_dup, xnn_init_f32_minmax_sse_params);
+        .a_stride(11)
+        .Test(xnn_f32_gemm_minmax_ukernel_3x16__avx_broadcast, xnn_init_f32_minmax_avx_params);
     }
   }
 
-  TEST(F32_GEMM_MINMAX_5X8__SSE2_DUP, k_div_4_subtile) {
-    TEST_REQUIRES_X86_SSE2;
-    for (size_t k = 8; k <= 40; k += 4) {
-      for (uint32_t n = 1; n <= 8; n++) {
-        for (uint32_t m = 1; m <= 5; m++) {
+  TEST(F32_GEMM_MINMAX_3X16__AVX_BROADCAST, k_gt_1_subtile) {
+    TEST_REQUIRES_X86_AVX;
+    for (size_t k = 2; k < 10; k++) {
+      for (uint32_t n = 1; n <= 16; n++) {
+        for (uint32_t m = 1; m <= 3; m++) {
           GemmMicrokernelTester()
-            .mr(5)
-            .nr(8)
+            .mr(3)
+            .nr(16)
             .kr(1)
             .sr(1)
             .m(m)
             .n(n)
             .k(k)
             .iterations(1)
-            .Test(xnn_f32_gemm_minmax_ukernel_5x8__sse2_dup, xnn_init_f32_minmax_sse_params);
+            .Test(xnn_f32_gemm_minmax_ukernel_3x16__avx_broadcast, xnn_init_f32_minmax_avx_params);
         }
       }
     }
   }
 
-  TEST(F32_GEMM_MINMAX_5X8__SSE2_DUP, n_gt_8) {
-    TEST_REQUIRES_X86_SSE2;
-    for (uint32_t n = 9; n < 16; n++) {
-      for (size_t k = 1; k <= 20; k += 5) {
+  TEST(F32_GEMM_MINMAX_3X16__AVX_BROADCAST, n_gt_16) {
+    TEST_REQUIRES_X86_AVX;
+    for (uint32_t n = 17; n < 32; n++) {
+      for (size_t k = 1; k <= 5; k += 2) {
         GemmMicrokernelTester()
-          .mr(5)
-          .nr(8)
+          .mr(3)
+          .nr(16)
           .kr(1)
           .sr(1)
-          .m(5)
+          .m(3)
           .n(n)
           .k(k)
-          .Test(xnn_f32_gemm_minmax_ukernel_5x8__sse2_dup, xnn_init_f32_minmax_sse_params);
+          .Test(xnn_f32_gemm_minmax_ukernel_3x16__avx_broadcast, xnn_init_f32_minmax_avx_params);
       }
     }
   }
 
-  TEST(F32_GEMM_MINMAX_5X8__SSE2_DUP, n_gt_8_strided_cn) {
-    TEST_REQUIRES_X86_SSE2;
-    for (uint32_t n = 9; n < 16; n++) {
-      for (size_t k = 1; k <= 20; k += 5) {
+  TEST(F32_GEMM_MINMAX_3X16__AVX_BROADCAST, n_gt_16_strided_cn) {
+    TEST_REQUIRES_X86_AVX;
+    for (uint32_t n = 17; n < 32; n++) {
+      for (size_t k = 1; k <= 5; k += 2) {
         GemmMicrokernelTester()
-          .mr(5)
-          .nr(8)
+          .mr(3)
+          .nr(16)
           .kr(1)
           .sr(1)
-          .m(5)
+          .m(3)
           .n(n)
           .k(k)
-          .cn_stride(11)
-          .Test(xnn_f32_gemm_minmax_ukernel_5x8__sse2_dup, xnn_init_f32_minmax_sse_params);
+          .cn_stride(19)
+          .Test(xnn_f32_gemm_minmax_ukernel_3x16__avx_broadcast, xnn_init_f32_minmax_avx_params);
       }
     }
   }
 
-  TEST(F32_GEMM_MINMAX_5X8__SSE2_DUP, n_gt_8_strided_a) {
-    TEST_REQUIRES_X86_SSE2;
-    for (uint32_t n = 9; n < 16; n++) {
-      for (size_t k = 1; k <= 20; k += 5) {
+  TEST(F32_GEMM_MINMAX_3X16__AVX_BROADCAST, n_gt_16_strided_a) {
+    TEST_REQUIRES_X86_AVX;
+    for (uint32_t n = 17; n < 32; n++) {
+      for (size_t k = 1; k <= 5; k += 2) {
         GemmMicrokernelTester()
-          .mr(5)
-          .nr(8)
+          .mr(3)
+          .nr(16)
           .kr(1)
           .sr(1)
-          .m(5)
+          .m(3)
           .n(n)
           .k(k)
-          .a_stride(23)
-          .Test(xnn_f32_gemm_minmax_ukernel_5x8__sse2_dup, xnn_init_f32_minmax_sse_params);
+          .a_stride(7)
+          .Test(xnn_f32_gemm_minmax_ukernel_3x16__avx_broadcast, xnn_init_f32_minmax_avx_params);
       }
     }
   }
 
-  TEST(F32_GEMM_MINMAX_5X8__SSE2_DUP, n_gt_8_subtile) {
-    TEST_REQUIRES_X86_SSE2;
-    for (uint32_t n = 9; n < 16; n++) {
-      for (size_t k = 1; k <= 20; k += 5) {
-        for (uint32_t m = 1; m <= 5; m++) {
+  TEST(F32_GEMM_MINMAX_3X16__AVX_BROADCAST, n_gt_16_subtile) {
+    TEST_REQUIRES_X86_AVX;
+    for (uint32_t n = 17; n < 32; n++) {
+      for (size_t k = 1; k <= 5; k += 2) {
+        for (uint32_t m = 1; m <= 3; m++) {
           GemmMicrokernelTester()
-            .mr(5)
-            .nr(8)
+            .mr(3)
+            .nr(16)
             .kr(1)
             .sr(1)
             .m(m)
             .n(n)
             .k(k)
             .iterations(1)
-            .Test(xnn_f32_gemm_minmax_ukernel_5x8__sse2_dup, xnn_init_f32_minmax_sse_params);
+            .Test(xnn_f32_gemm_minmax_ukernel_3x16__avx_broadcast, xnn_init_f32_minmax_avx_params);
         }
       }
     }
   }
 
-  TEST(F32_GEMM_MINMAX_5X8__SSE2_DUP, n_div_8) {
-    TEST_REQUIRES_X86_SSE2;
-    for (uint32_t n = 16; n <= 24; n += 8) {
-      for (size_t k = 1; k <= 20; k += 5) {
+  TEST(F32_GEMM_MINMAX_3X16__AVX_BROADCAST, n_div_16) {
+    TEST_REQUIRES_X86_AVX;
+    for (uint32_t n = 32; n <= 48; n += 16) {
+      for (size_t k = 1; k <= 5; k += 2) {
         GemmMicrokernelTester()
-          .mr(5)
-          .nr(8)
+          .mr(3)
+          .nr(16)
           .kr(1)
           .sr(1)
-          .m(5)
+          .m(3)
           .n(n)
           .k(k)
-          .Test(xnn_f32_gemm_minmax_ukernel_5x8__sse2_dup, xnn_init_f32_minmax_sse_params);
+          .Test(xnn_f32_gemm_minmax_ukernel_3x16__avx_broadcast, xnn_init_f32_minmax_avx_params);
       }
     }
   }
 
-  TEST(F32_GEMM_MINMAX_5X8__SSE2_DUP, n_div_8_strided_cn) {
-    TEST_REQUIRES_X86_SSE2;
-    for (uint32_t n = 16; n <= 24; n += 8) {
-      for (size_t k = 1; k <= 20; k += 5) {
+  TEST(F32_GEMM_MINMAX_3X16__AVX_BROADCAST, n_div_16_strided_cn) {
+    TEST_REQUIRES_X86_AVX;
+    for (uint32_t n = 32; n <= 48; n += 16) {
+      for (size_t k = 1; k <= 5; k += 2) {
         GemmMicrokernelTester()
-          .mr(5)
-          .nr(8)
+          .mr(3)
+          .nr(16)
           .kr(1)
           .sr(1)
-          .m(5)
+          .m(3)
           .n(n)
           .k(k)
-          .cn_stride(11)
-          .Test(xnn_f32_gemm_minmax_ukernel_5x8__sse2_dup, xnn_init_f32_minmax_sse_params);
+          .cn_stride(19)
+          .Test(xnn_f32_gemm_minmax_ukernel_3x16__avx_broadcast, xnn_init_f32_minmax_avx_params);
       }
     }
   }
 
-  TEST(F32_GEMM_MINMAX_5X8__SSE2_DUP, n_div_8_strided_a) {
-    TEST_REQUIRES_X86_SSE2;
-    for (uint32_t n = 16; n <= 24; n += 8) {
-      for (size_t k = 1; k <= 20; k += 5) {
+  TEST(F32_GEMM_MINMAX_3X16__AVX_BROADCAST, n_div_16_strided_a) {
+    TEST_REQUIRES_X86_AVX;
+    for (uint32_t n = 32; n <= 48; n += 16) {
+      for (size_t k = 1; k <= 5; k += 2) {
         GemmMicrokernelTester()
-          .mr(5)
-          .nr(8)
+          .mr(3)
+          .nr(16)
           .kr(1)
           .sr(1)
-          .m(5)
+          .m(3)
           .n(n)
           .k(k)
-          .a_stride(23)
-          .Test(xnn_f32_gemm_minmax_ukernel_5x8__sse2_dup, xnn_init_f32_minmax_sse_params);
+          .a_stride(7)
+          .Test(xnn_f32_gemm_minmax_ukernel_3x16__avx_broadcast, xnn_init_f32_minmax_avx_params);
       }
     }
   }
 
-  TEST(F32_GEMM_MINMAX_5X8__SSE2_DUP, n_div_8_subtile) {
-    TEST_REQUIRES_X86_SSE2;
-    for (uint32_t n = 16; n <= 24; n += 8) {
-      for (size_t k = 1; k <= 20; k += 5) {
-        for (uint32_t m = 1; m <= 5; m++) {
+  TEST(F32_GEMM_MINMAX_3X16__AVX_BROADCAST, n_div_16_subtile) {
+    TEST_REQUIRES_X86_AVX;
+    for (uint32_t n = 32; n <= 48; n += 16) {
+      for (size_t k = 1; k <= 5; k += 2) {
+        for (uint32_t m = 1; m <= 3; m++) {
           GemmMicrokernelTester()
-            .mr(5)
-            .nr(8)
+            .mr(3)
+            .nr(16)
             .kr(1)
             .sr(1)
             .m(m)
             .n(n)
             .k(k)
             .iterations(1)
-            .Test(xnn_f32_gemm_minmax_ukernel_5x8__sse2_dup, xnn_init_f32_minmax_sse_params);
+            .Test(xnn_f32_gemm_minmax_ukernel_3x16__avx_broadcast, xnn_init_f32_minmax_avx_params);
         }
       }
     }
   }
 
-  TEST(F32_GEMM_MINMAX_5X8__SSE2_DUP, strided_cm_subtile) {
-    TEST_REQUIRES_X86_SSE2;
-    for (size_t k = 1; k <= 20; k += 5) {
-      for (uint32_t n = 1; n <= 8; n++) {
-        for (uint32_t m = 1; m <= 5; m++) {
+  TEST(F32_GEMM_MINMAX_3X16__AVX_BROADCAST, strided_cm_subtile) {
+    TEST_REQUIRES_X86_AVX;
+    for (size_t k = 1; k <= 5; k += 2) {
+      for (uint32_t n = 1; n <= 16; n++) {
+        for (uint32_t m = 1; m <= 3; m++) {
           GemmMicrokernelTester()
-            .mr(5)
-            .nr(8)
+            .mr(3)
+            .nr(16)
             .kr(1)
             .sr(1)
             .m(m)
             .n(n)
             .k(k)
-            .cm_stride(11)
+            .cm_stride(19)
             .iterations(1)
-            .Test(xnn_f32_gemm_minmax_ukernel_5x8__sse2_dup, xnn_init_f32_minmax_sse_params);
+            .Test(xnn_f32_gemm_minmax_ukernel_3x16__avx_broadcast, xnn_init_f32_minmax_avx_params);
         }
       }
     }
   }
 
-  TEST(F32_GEMM_MINMAX_5X8__SSE2_DUP, qmin) {
-    TEST_REQUIRES_X86_SSE2;
+  TEST(F32_GEMM_MINMAX_3X16__AVX_BROADCAST, qmin) {
+    TEST_REQUIRES_X86_AVX;
     GemmMicrokernelTester()
-      .mr(5)
-      .nr(8)
+      .mr(3)
+      .nr(16)
       .kr(1)
       .sr(1)
-      .m(5)
-      .n(8)
-      .k(4)
+      .m(3)
+      .n(16)
+      .k(1)
       .qmin(128)
-      .Test(xnn_f32_gemm_minmax_ukernel_5x8__sse2_dup, xnn_init_f32_minmax_sse_params);
+      .Test(xnn_f32_gemm_minmax_ukernel_3x16__avx_broadcast, xnn_init_f32_minmax_avx_params);
   }
 
-  TEST(F32_GEMM_MINMAX_5X8__SSE2_DUP, qmax) {
-    TEST_REQUIRES_X86_SSE2;
+  TEST(F32_GEMM_MINMAX_3X16__AVX_BROADCAST, qmax) {
+    TEST_REQUIRES_X86_AVX;
     GemmMicrokernelTester()
-      .mr(5)
-      .nr(8)
+      .mr(3)
+      .nr(16)
       .kr(1)
       .sr(1)
-      .m(5)
-      .n(8)
-      .k(4)
+      .m(3)
+      .n(16)
+      .k(1)
       .qmax(128)
-      .Test(xnn_f32_gemm_minmax_ukernel_5x8__sse2_dup, xnn_init_f32_minmax_sse_params);
+      .Test(xnn_f32_gemm_minmax_ukernel_3x16__avx_broadcast, xnn_init_f32_minmax_avx_params);
   }
 
-  TEST(F32_GEMM_MINMAX_5X8__SSE2_DUP, strided_cm) {
-    TEST_REQUIRES_X86_SSE2;
+  TEST(F32_GEMM_MINMAX_3X16__AVX_BROADCAST, strided_cm) {
+    TEST_REQUIRES_X86_AVX;
     GemmMicrokernelTester()
-      .mr(5)
-      .nr(8)
+      .mr(3)
+      .nr(16)
       .kr(1)
       .sr(1)
-      .m(5)
-      .n(8)
-      .k(4)
-      .cm_stride(11)
-      .Test(xnn_f32_gemm_minmax_ukernel_5x8__sse2_dup, xnn_init_f32_minmax_sse_params);
+      .m(3)
+      .n(16)
+      .k(1)
+      .cm_stride(19)
+      .Test(xnn_f32_gemm_minmax_ukernel_3x16__avx_broadcast, xnn_init_f32_minmax_avx_params);
   }
 #endif  // XNN_ARCH_X86 || XNN_ARCH_X86_64
 
 
 #if XNN_ARCH_X86 || XNN_ARCH_X86_64
-  TEST(F32_GEMM_MINMAX_1X8__AVX_BROADCAST, k_eq_1) {
+  TEST(F32_GEMM_MINMAX_5X8__AVX_BROADCAST, k_eq_1) {
     TEST_REQUIRES_X86_AVX;
     GemmMicrokernelTester()
-      .mr(1)
+      .mr(5)
       .nr(8)
       .kr(1)
       .sr(1)
-      .m(1)
+      .m(5)
       .n(8)
       .k(1)
-      .Test(xnn_f32_gemm_minmax_ukernel_1x8__avx_broadcast, xnn_init_f32_minmax_avx_params);
+      .Test(xnn_f32_gemm_minmax_ukernel_5x8__avx_broadcast, xnn_init_f32_minmax_avx_params);
   }
 
-  TEST(F32_GEMM_MINMAX_1X8__AVX_BROADCAST, strided_cn) {
+  TEST(F32_GEMM_MINMAX_5X8__AVX_BROADCAST, strided_cn) {
     TEST_REQUIRES_X86_AVX;
     GemmMicrokernelTester()
-      .mr(1)
+      .mr(5)
       .nr(8)
       .kr(1)
       .sr(1)
-      .m(1)
+      .m(5)
       .n(8)
       .k(1)
       .cn_stride(11)
-      .Test(xnn_f32_gemm_minmax_ukernel_1x8__avx_broadcast, xnn_init_f32_minmax_avx_params);
+      .Test(xnn_f32_gemm_minmax_ukernel_5x8__avx_broadcast, xnn_init_f32_minmax_avx_params);
   }
 
-  TEST(F32_GEMM_MINMAX_1X8__AVX_BROADCAST, k_eq_1_strided_a) {
+  TEST(F32_GEMM_MINMAX_5X8__AVX_BROADCAST, k_eq_1_strided_a) {
     TEST_REQUIRES_X86_AVX;
     GemmMicrokernelTester()
-      .mr(1)
+      .mr(5)
       .nr(8)
       .kr(1)
       .sr(1)
-      .m(1)
+      .m(5)
       .n(8)
       .k(1)
       .a_stride(3)
-      .Test(xnn_f32_gemm_minmax_ukernel_1x8__avx_broadcast, xnn_init_f32_minmax_avx_params);
+      .Test(xnn_f32_gemm_minmax_ukernel_5x8__avx_broadcast, xnn_init_f32_minmax_avx_params);
   }
 
-  TEST(F32_GEMM_MINMAX_1X8__AVX_BROADCAST, k_eq_1_subtile) {
+  TEST(F32_GEMM_MINMAX_5X8__AVX_BROADCAST, k_eq_1_subtile) {
     TEST_REQUIRES_X86_AVX;
     for (uint32_t n = 1; n <= 8; n++) {
-      for (uint32_t m = 1; m <= 1; m++) {
+      for (uint32_t m = 1; m <= 5; m++) {
         GemmMicrokernelTester()
-          .mr(1)
+          .mr(5)
           .nr(8)
           .kr(1)
           .sr(1)
@@ -17139,16 +18759,16 @@
           .n(n)
           .k(1)
           .iterations(1)
-          .Test(xnn_f32_gemm_minmax_ukernel_1x8__avx_broadcast, xnn_init_f32_minmax_avx_params);
+          .Test(xnn_f32_gemm_minmax_ukernel_5x8__avx_broadcast, xnn_init_f32_minmax_avx_params);
       }
     }
   }
 
-  TEST(F32_GEMM_MINMAX_1X8__AVX_BROADCAST, k_eq_1_subtile_m) {
+  TEST(F32_GEMM_MINMAX_5X8__AVX_BROADCAST, k_eq_1_subtile_m) {
     TEST_REQUIRES_X86_AVX;
-    for (uint32_t m = 1; m <= 1; m++) {
+    for (uint32_t m = 1; m <= 5; m++) {
       GemmMicrokernelTester()
-        .mr(1)
+        .mr(5)
         .nr(8)
         .kr(1)
         .sr(1)
@@ -17156,64 +18776,64 @@
         .n(8)
         .k(1)
         .iterations(1)
-        .Test(xnn_f32_gemm_minmax_ukernel_1x8__avx_broadcast, xnn_init_f32_minmax_avx_params);
+        .Test(xnn_f32_gemm_minmax_ukernel_5x8__avx_broadcast, xnn_init_f32_minmax_avx_params);
     }
   }
 
-  TEST(F32_GEMM_MINMAX_1X8__AVX_BROADCAST, k_eq_1_subtile_n) {
+  TEST(F32_GEMM_MINMAX_5X8__AVX_BROADCAST, k_eq_1_subtile_n) {
     TEST_REQUIRES_X86_AVX;
     for (uint32_t n = 1; n <= 8; n++) {
       GemmMicrokernelTester()
-        .mr(1)
+        .mr(5)
         .nr(8)
         .kr(1)
         .sr(1)
-        .m(1)
+        .m(5)
         .n(n)
         .k(1)
         .iterations(1)
-        .Test(xnn_f32_gemm_minmax_ukernel_1x8__avx_broadcast, xnn_init_f32_minmax_avx_params);
+        .Test(xnn_f32_gemm_minmax_ukernel_5x8__avx_broadcast, xnn_init_f32_minmax_avx_params);
     }
   }
 
-  TEST(F32_GEMM_MINMAX_1X8__AVX_BROADCAST, k_gt_1) {
+  TEST(F32_GEMM_MINMAX_5X8__AVX_BROADCAST, k_gt_1) {
     TEST_REQUIRES_X86_AVX;
     for (size_t k = 2; k < 10; k++) {
       GemmMicrokernelTester()
-        .mr(1)
+        .mr(5)
         .nr(8)
         .kr(1)
         .sr(1)
-        .m(1)
+        .m(5)
         .n(8)
         .k(k)
-        .Test(xnn_f32_gemm_minmax_ukernel_1x8__avx_broadcast, xnn_init_f32_minmax_avx_params);
+        .Test(xnn_f32_gemm_minmax_ukernel_5x8__avx_broadcast, xnn_init_f32_minmax_avx_params);
     }
   }
 
-  TEST(F32_GEMM_MINMAX_1X8__AVX_BROADCAST, k_gt_1_strided_a) {
+  TEST(F32_GEMM_MINMAX_5X8__AVX_BROADCAST, k_gt_1_strided_a) {
     TEST_REQUIRES_X86_AVX;
     for (size_t k = 2; k < 10; k++) {
       GemmMicrokernelTester()
-        .mr(1)
+        .mr(5)
         .nr(8)
         .kr(1)
         .sr(1)
-        .m(1)
+        .m(5)
         .n(8)
         .k(k)
         .a_stride(11)
-        .Test(xnn_f32_gemm_minmax_ukernel_1x8__avx_broadcast, xnn_init_f32_minmax_avx_params);
+        .Test(xnn_f32_gemm_minmax_ukernel_5x8__avx_broadcast, xnn_init_f32_minmax_avx_params);
     }
   }
 
-  TEST(F32_GEMM_MINMAX_1X8__AVX_BROADCAST, k_gt_1_subtile) {
+  TEST(F32_GEMM_MINMAX_5X8__AVX_BROADCAST, k_gt_1_subtile) {
     TEST_REQUIRES_X86_AVX;
     for (size_t k = 2; k < 10; k++) {
       for (uint32_t n = 1; n <= 8; n++) {
-        for (uint32_t m = 1; m <= 1; m++) {
+        for (uint32_t m = 1; m <= 5; m++) {
           GemmMicrokernelTester()
-            .mr(1)
+            .mr(5)
             .nr(8)
             .kr(1)
             .sr(1)
@@ -17221,72 +18841,72 @@
             .n(n)
             .k(k)
             .iterations(1)
-            .Test(xnn_f32_gemm_minmax_ukernel_1x8__avx_broadcast, xnn_init_f32_minmax_avx_params);
+            .Test(xnn_f32_gemm_minmax_ukernel_5x8__avx_broadcast, xnn_init_f32_minmax_avx_params);
         }
       }
     }
   }
 
-  TEST(F32_GEMM_MINMAX_1X8__AVX_BROADCAST, n_gt_8) {
+  TEST(F32_GEMM_MINMAX_5X8__AVX_BROADCAST, n_gt_8) {
     TEST_REQUIRES_X86_AVX;
     for (uint32_t n = 9; n < 16; n++) {
       for (size_t k = 1; k <= 5; k += 2) {
         GemmMicrokernelTester()
-          .mr(1)
+          .mr(5)
           .nr(8)
           .kr(1)
           .sr(1)
-          .m(1)
+          .m(5)
           .n(n)
           .k(k)
-          .Test(xnn_f32_gemm_minmax_ukernel_1x8__avx_broadcast, xnn_init_f32_minmax_avx_params);
+          .Test(xnn_f32_gemm_minmax_ukernel_5x8__avx_broadcast, xnn_init_f32_minmax_avx_params);
       }
     }
   }
 
-  TEST(F32_GEMM_MINMAX_1X8__AVX_BROADCAST, n_gt_8_strided_cn) {
+  TEST(F32_GEMM_MINMAX_5X8__AVX_BROADCAST, n_gt_8_strided_cn) {
     TEST_REQUIRES_X86_AVX;
     for (uint32_t n = 9; n < 16; n++) {
       for (size_t k = 1; k <= 5; k += 2) {
         GemmMicrokernelTester()
-          .mr(1)
+          .mr(5)
           .nr(8)
           .kr(1)
           .sr(1)
-          .m(1)
+          .m(5)
           .n(n)
           .k(k)
           .cn_stride(11)
-          .Test(xnn_f32_gemm_minmax_ukernel_1x8__avx_broadcast, xnn_init_f32_minmax_avx_params);
+          .Test(xnn_f32_gemm_minmax_ukernel_5x8__avx_broadcast, xnn_init_f32_minmax_avx_params);
       }
     }
   }
 
-  TEST(F32_GEMM_MINMAX_1X8__AVX_BROADCAST, n_gt_8_strided_a) {
+  TEST(F32_GEMM_MINMAX_5X8__AVX_BROADCAST, n_gt_8_strided_a) {
     TEST_REQUIRES_X86_AVX;
     for (uint32_t n = 9; n < 16; n++) {
       for (size_t k = 1; k <= 5; k += 2) {
         GemmMicrokernelTester()
-          .mr(1)
+          .mr(5)
           .nr(8)
           .kr(1)
           .sr(1)
-          .m(1)
+          .m(5)
           .n(n)
           .k(k)
           .a_stride(7)
-          .Test(xnn_f32_gemm_minmax_ukernel_1x8__avx_broadcast, xnn_init_f32_minmax_avx_params);
+          .Test(xnn_f32_gemm_minmax_ukernel_5x8__avx_broadcast, xnn_init_f32_minmax_avx_params);
       }
     }
   }
 
-  TEST(F32_GEMM_MINMAX_1X8__AVX_BROADCAST, n_gt_8_subtile) {
+  TEST(F32_GEMM_MINMAX_5X8__AVX_BROADCAST, n_gt_8_subtile) {
     TEST_REQUIRES_X86_AVX;
     for (uint32_t n = 9; n < 16; n++) {
       for (size_t k = 1; k <= 5; k += 2) {
-        for (uint32_t m = 1; m <= 1; m++) {
+        for (uint32_t m = 1; m <= 5; m++) {
           GemmMicrokernelTester()
-            .mr(1)
+            .mr(5)
             .nr(8)
             .kr(1)
             .sr(1)
@@ -17294,72 +18914,72 @@
             .n(n)
             .k(k)
             .iterations(1)
-            .Test(xnn_f32_gemm_minmax_ukernel_1x8__avx_broadcast, xnn_init_f32_minmax_avx_params);
+            .Test(xnn_f32_gemm_minmax_ukernel_5x8__avx_broadcast, xnn_init_f32_minmax_avx_params);
         }
       }
     }
   }
 
-  TEST(F32_GEMM_MINMAX_1X8__AVX_BROADCAST, n_div_8) {
+  TEST(F32_GEMM_MINMAX_5X8__AVX_BROADCAST, n_div_8) {
     TEST_REQUIRES_X86_AVX;
     for (uint32_t n = 16; n <= 24; n += 8) {
       for (size_t k = 1; k <= 5; k += 2) {
         GemmMicrokernelTester()
-          .mr(1)
+          .mr(5)
           .nr(8)
           .kr(1)
           .sr(1)
-          .m(1)
+          .m(5)
           .n(n)
           .k(k)
-          .Test(xnn_f32_gemm_minmax_ukernel_1x8__avx_broadcast, xnn_init_f32_minmax_avx_params);
+          .Test(xnn_f32_gemm_minmax_ukernel_5x8__avx_broadcast, xnn_init_f32_minmax_avx_params);
       }
     }
   }
 
-  TEST(F32_GEMM_MINMAX_1X8__AVX_BROADCAST, n_div_8_strided_cn) {
+  TEST(F32_GEMM_MINMAX_5X8__AVX_BROADCAST, n_div_8_strided_cn) {
     TEST_REQUIRES_X86_AVX;
     for (uint32_t n = 16; n <= 24; n += 8) {
       for (size_t k = 1; k <= 5; k += 2) {
         GemmMicrokernelTester()
-          .mr(1)
+          .mr(5)
           .nr(8)
           .kr(1)
           .sr(1)
-          .m(1)
+          .m(5)
           .n(n)
           .k(k)
           .cn_stride(11)
-          .Test(xnn_f32_gemm_minmax_ukernel_1x8__avx_broadcast, xnn_init_f32_minmax_avx_params);
+          .Test(xnn_f32_gemm_minmax_ukernel_5x8__avx_broadcast, xnn_init_f32_minmax_avx_params);
       }
     }
   }
 
-  TEST(F32_GEMM_MINMAX_1X8__AVX_BROADCAST, n_div_8_strided_a) {
+  TEST(F32_GEMM_MINMAX_5X8__AVX_BROADCAST, n_div_8_strided_a) {
     TEST_REQUIRES_X86_AVX;
     for (uint32_t n = 16; n <= 24; n += 8) {
       for (size_t k = 1; k <= 5; k += 2) {
         GemmMicrokernelTester()
-          .mr(1)
+          .mr(5)
           .nr(8)
           .kr(1)
           .sr(1)
-          .m(1)
+          .m(5)
           .n(n)
           .k(k)
           .a_stride(7)
-          .Test(xnn_f32_gemm_minmax_ukernel_1x8__avx_broadcast, xnn_init_f32_minmax_avx_params);
+          .Test(xnn_f32_gemm_minmax_ukernel_5x8__avx_broadcast, xnn_init_f32_minmax_avx_params);
       }
     }
   }
 
-  TEST(F32_GEMM_MINMAX_1X8__AVX_BROADCAST, n_div_8_subtile) {
+  TEST(F32_GEMM_MINMAX_5X8__AVX_BROADCAST, n_div_8_subtile) {
     TEST_REQUIRES_X86_AVX;
     for (uint32_t n = 16; n <= 24; n += 8) {
       for (size_t k = 1; k <= 5; k += 2) {
-        for (uint32_t m = 1; m <= 1; m++) {
+        for (uint32_t m = 1; m <= 5; m++) {
           GemmMicrokernelTester()
-            .mr(1)
+            .mr(5)
             .nr(8)
             .kr(1)
             .sr(1)
@@ -17367,19 +18987,19 @@
             .n(n)
             .k(k)
             .iterations(1)
-            .Test(xnn_f32_gemm_minmax_ukernel_1x8__avx_broadcast, xnn_init_f32_minmax_avx_params);
+            .Test(xnn_f32_gemm_minmax_ukernel_5x8__avx_broadcast, xnn_init_f32_minmax_avx_params);
         }
       }
     }
   }
 
-  TEST(F32_GEMM_MINMAX_1X8__AVX_BROADCAST, strided_cm_subtile) {
+  TEST(F32_GEMM_MINMAX_5X8__AVX_BROADCAST, strided_cm_subtile) {
     TEST_REQUIRES_X86_AVX;
     for (size_t k = 1; k <= 5; k += 2) {
       for (uint32_t n = 1; n <= 8; n++) {
-        for (uint32_t m = 1; m <= 1; m++) {
+        for (uint32_t m = 1; m <= 5; m++) {
           GemmMicrokernelTester()
-            .mr(1)
+            .mr(5)
             .nr(8)
             .kr(1)
             .sr(1)
@@ -17388,458 +19008,458 @@
             .k(k)
             .cm_stride(11)
             .iterations(1)
-            .Test(xnn_f32_gemm_minmax_ukernel_1x8__avx_broadcast, xnn_init_f32_minmax_avx_params);
+            .Test(xnn_f32_gemm_minmax_ukernel_5x8__avx_broadcast, xnn_init_f32_minmax_avx_params);
         }
       }
     }
   }
 
-  TEST(F32_GEMM_MINMAX_1X8__AVX_BROADCAST, qmin) {
+  TEST(F32_GEMM_MINMAX_5X8__AVX_BROADCAST, qmin) {
     TEST_REQUIRES_X86_AVX;
     GemmMicrokernelTester()
-      .mr(1)
+      .mr(5)
       .nr(8)
       .kr(1)
       .sr(1)
-      .m(1)
+      .m(5)
       .n(8)
       .k(1)
       .qmin(128)
-      .Test(xnn_f32_gemm_minmax_ukernel_1x8__avx_broadcast, xnn_init_f32_minmax_avx_params);
+      .Test(xnn_f32_gemm_minmax_ukernel_5x8__avx_broadcast, xnn_init_f32_minmax_avx_params);
   }
 
-  TEST(F32_GEMM_MINMAX_1X8__AVX_BROADCAST, qmax) {
+  TEST(F32_GEMM_MINMAX_5X8__AVX_BROADCAST, qmax) {
     TEST_REQUIRES_X86_AVX;
     GemmMicrokernelTester()
-      .mr(1)
+      .mr(5)
       .nr(8)
       .kr(1)
       .sr(1)
-      .m(1)
+      .m(5)
       .n(8)
       .k(1)
       .qmax(128)
-      .Test(xnn_f32_gemm_minmax_ukernel_1x8__avx_broadcast, xnn_init_f32_minmax_avx_params);
+      .Test(xnn_f32_gemm_minmax_ukernel_5x8__avx_broadcast, xnn_init_f32_minmax_avx_params);
   }
 
-  TEST(F32_GEMM_MINMAX_1X8__AVX_BROADCAST, strided_cm) {
+  TEST(F32_GEMM_MINMAX_5X8__AVX_BROADCAST, strided_cm) {
     TEST_REQUIRES_X86_AVX;
     GemmMicrokernelTester()
-      .mr(1)
+      .mr(5)
       .nr(8)
       .kr(1)
       .sr(1)
-      .m(1)
+      .m(5)
       .n(8)
       .k(1)
       .cm_stride(11)
-      .Test(xnn_f32_gemm_minmax_ukernel_1x8__avx_broadcast, xnn_init_f32_minmax_avx_params);
+      .Test(xnn_f32_gemm_minmax_ukernel_5x8__avx_broadcast, xnn_init_f32_minmax_avx_params);
   }
 #endif  // XNN_ARCH_X86 || XNN_ARCH_X86_64
 
 
 #if XNN_ARCH_X86 || XNN_ARCH_X86_64
-  TEST(F32_GEMM_MINMAX_3X16__AVX_BROADCAST, k_eq_1) {
+  TEST(F32_GEMM_MINMAX_6X8__AVX_BROADCAST, k_eq_1) {
     TEST_REQUIRES_X86_AVX;
     GemmMicrokernelTester()
-      .mr(3)
-      .nr(16)
+      .mr(6)
+      .nr(8)
       .kr(1)
       .sr(1)
-      .m(3)
-      .n(16)
+      .m(6)
+      .n(8)
       .k(1)
-      .Test(xnn_f32_gemm_minmax_ukernel_3x16__avx_broadcast, xnn_init_f32_minmax_avx_params);
+      .Test(xnn_f32_gemm_minmax_ukernel_6x8__avx_broadcast, xnn_init_f32_minmax_avx_params);
   }
 
-  TEST(F32_GEMM_MINMAX_3X16__AVX_BROADCAST, strided_cn) {
+  TEST(F32_GEMM_MINMAX_6X8__AVX_BROADCAST, strided_cn) {
     TEST_REQUIRES_X86_AVX;
     GemmMicrokernelTester()
-      .mr(3)
-      .nr(16)
+      .mr(6)
+      .nr(8)
       .kr(1)
       .sr(1)
-      .m(3)
-      .n(16)
+      .m(6)
+      .n(8)
       .k(1)
-      .cn_stride(19)
-      .Test(xnn_f32_gemm_minmax_ukernel_3x16__avx_broadcast, xnn_init_f32_minmax_avx_params);
+      .cn_stride(11)
+      .Test(xnn_f32_gemm_minmax_ukernel_6x8__avx_broadcast, xnn_init_f32_minmax_avx_params);
   }
 
-  TEST(F32_GEMM_MINMAX_3X16__AVX_BROADCAST, k_eq_1_strided_a) {
+  TEST(F32_GEMM_MINMAX_6X8__AVX_BROADCAST, k_eq_1_strided_a) {
     TEST_REQUIRES_X86_AVX;
     GemmMicrokernelTester()
-      .mr(3)
-      .nr(16)
+      .mr(6)
+      .nr(8)
       .kr(1)
       .sr(1)
-      .m(3)
-      .n(16)
+      .m(6)
+      .n(8)
       .k(1)
       .a_stride(3)
-      .Test(xnn_f32_gemm_minmax_ukernel_3x16__avx_broadcast, xnn_init_f32_minmax_avx_params);
+      .Test(xnn_f32_gemm_minmax_ukernel_6x8__avx_broadcast, xnn_init_f32_minmax_avx_params);
   }
 
-  TEST(F32_GEMM_MINMAX_3X16__AVX_BROADCAST, k_eq_1_subtile) {
+  TEST(F32_GEMM_MINMAX_6X8__AVX_BROADCAST, k_eq_1_subtile) {
     TEST_REQUIRES_X86_AVX;
-    for (uint32_t n = 1; n <= 16; n++) {
-      for (uint32_t m = 1; m <= 3; m++) {
+    for (uint32_t n = 1; n <= 8; n++) {
+      for (uint32_t m = 1; m <= 6; m++) {
         GemmMicrokernelTester()
-          .mr(3)
-          .nr(16)
+          .mr(6)
+          .nr(8)
           .kr(1)
           .sr(1)
           .m(m)
           .n(n)
           .k(1)
           .iterations(1)
-          .Test(xnn_f32_gemm_minmax_ukernel_3x16__avx_broadcast, xnn_init_f32_minmax_avx_params);
+          .Test(xnn_f32_gemm_minmax_ukernel_6x8__avx_broadcast, xnn_init_f32_minmax_avx_params);
       }
     }
   }
 
-  TEST(F32_GEMM_MINMAX_3X16__AVX_BROADCAST, k_eq_1_subtile_m) {
+  TEST(F32_GEMM_MINMAX_6X8__AVX_BROADCAST, k_eq_1_subtile_m) {
     TEST_REQUIRES_X86_AVX;
-    for (uint32_t m = 1; m <= 3; m++) {
+    for (uint32_t m = 1; m <= 6; m++) {
       GemmMicrokernelTester()
-        .mr(3)
-        .nr(16)
+        .mr(6)
+        .nr(8)
         .kr(1)
         .sr(1)
         .m(m)
-        .n(16)
+        .n(8)
         .k(1)
         .iterations(1)
-        .Test(xnn_f32_gemm_minmax_ukernel_3x16__avx_broadcast, xnn_init_f32_minmax_avx_params);
+        .Test(xnn_f32_gemm_minmax_ukernel_6x8__avx_broadcast, xnn_init_f32_minmax_avx_params);
     }
   }
 
-  TEST(F32_GEMM_MINMAX_3X16__AVX_BROADCAST, k_eq_1_subtile_n) {
+  TEST(F32_GEMM_MINMAX_6X8__AVX_BROADCAST, k_eq_1_subtile_n) {
     TEST_REQUIRES_X86_AVX;
-    for (uint32_t n = 1; n <= 16; n++) {
+    for (uint32_t n = 1; n <= 8; n++) {
       GemmMicrokernelTester()
-        .mr(3)
-        .nr(16)
+        .mr(6)
+        .nr(8)
         .kr(1)
         .sr(1)
-        .m(3)
+        .m(6)
         .n(n)
         .k(1)
         .iterations(1)
-        .Test(xnn_f32_gemm_minmax_ukernel_3x16__avx_broadcast, xnn_init_f32_minmax_avx_params);
+        .Test(xnn_f32_gemm_minmax_ukernel_6x8__avx_broadcast, xnn_init_f32_minmax_avx_params);
     }
   }
 
-  TEST(F32_GEMM_MINMAX_3X16__AVX_BROADCAST, k_gt_1) {
+  TEST(F32_GEMM_MINMAX_6X8__AVX_BROADCAST, k_gt_1) {
     TEST_REQUIRES_X86_AVX;
     for (size_t k = 2; k < 10; k++) {
       GemmMicrokernelTester()
-        .mr(3)
-        .nr(16)
+        .mr(6)
+        .nr(8)
         .kr(1)
         .sr(1)
-        .m(3)
-        .n(16)
+        .m(6)
+        .n(8)
         .k(k)
-        .Test(xnn_f32_gemm_minmax_ukernel_3x16__avx_broadcast, xnn_init_f32_minmax_avx_params);
+        .Test(xnn_f32_gemm_minmax_ukernel_6x8__avx_broadcast, xnn_init_f32_minmax_avx_params);
     }
   }
 
-  TEST(F32_GEMM_MINMAX_3X16__AVX_BROADCAST, k_gt_1_strided_a) {
+  TEST(F32_GEMM_MINMAX_6X8__AVX_BROADCAST, k_gt_1_strided_a) {
     TEST_REQUIRES_X86_AVX;
     for (size_t k = 2; k < 10; k++) {
       GemmMicrokernelTester()
-        .mr(3)
-        .nr(16)
+        .mr(6)
+        .nr(8)
         .kr(1)
         .sr(1)
-        .m(3)
-        .n(16)
+        .m(6)
+        .n(8)
         .k(k)
         .a_stride(11)
-        .Test(xnn_f32_gemm_minmax_ukernel_3x16__avx_broadcast, xnn_init_f32_minmax_avx_params);
+        .Test(xnn_f32_gemm_minmax_ukernel_6x8__avx_broadcast, xnn_init_f32_minmax_avx_params);
     }
   }
 
-  TEST(F32_GEMM_MINMAX_3X16__AVX_BROADCAST, k_gt_1_subtile) {
+  TEST(F32_GEMM_MINMAX_6X8__AVX_BROADCAST, k_gt_1_subtile) {
     TEST_REQUIRES_X86_AVX;
     for (size_t k = 2; k < 10; k++) {
-      for (uint32_t n = 1; n <= 16; n++) {
-        for (uint32_t m = 1; m <= 3; m++) {
+      for (uint32_t n = 1; n <= 8; n++) {
+        for (uint32_t m = 1; m <= 6; m++) {
           GemmMicrokernelTester()
-            .mr(3)
-            .nr(16)
+            .mr(6)
+            .nr(8)
             .kr(1)
             .sr(1)
             .m(m)
             .n(n)
             .k(k)
             .iterations(1)
-            .Test(xnn_f32_gemm_minmax_ukernel_3x16__avx_broadcast, xnn_init_f32_minmax_avx_params);
+            .Test(xnn_f32_gemm_minmax_ukernel_6x8__avx_broadcast, xnn_init_f32_minmax_avx_params);
         }
       }
     }
   }
 
-  TEST(F32_GEMM_MINMAX_3X16__AVX_BROADCAST, n_gt_16) {
+  TEST(F32_GEMM_MINMAX_6X8__AVX_BROADCAST, n_gt_8) {
     TEST_REQUIRES_X86_AVX;
-    for (uint32_t n = 17; n < 32; n++) {
+    for (uint32_t n = 9; n < 16; n++) {
       for (size_t k = 1; k <= 5; k += 2) {
         GemmMicrokernelTester()
-          .mr(3)
-          .nr(16)
+          .mr(6)
+          .nr(8)
           .kr(1)
           .sr(1)
-          .m(3)
+          .m(6)
           .n(n)
           .k(k)
-          .Test(xnn_f32_gemm_minmax_ukernel_3x16__avx_broadcast, xnn_init_f32_minmax_avx_params);
+          .Test(xnn_f32_gemm_minmax_ukernel_6x8__avx_broadcast, xnn_init_f32_minmax_avx_params);
       }
     }
   }
 
-  TEST(F32_GEMM_MINMAX_3X16__AVX_BROADCAST, n_gt_16_strided_cn) {
+  TEST(F32_GEMM_MINMAX_6X8__AVX_BROADCAST, n_gt_8_strided_cn) {
     TEST_REQUIRES_X86_AVX;
-    for (uint32_t n = 17; n < 32; n++) {
+    for (uint32_t n = 9; n < 16; n++) {
       for (size_t k = 1; k <= 5; k += 2) {
         GemmMicrokernelTester()
-          .mr(3)
-          .nr(16)
+          .mr(6)
+          .nr(8)
           .kr(1)
           .sr(1)
-          .m(3)
+          .m(6)
           .n(n)
           .k(k)
-          .cn_stride(19)
-          .Test(xnn_f32_gemm_minmax_ukernel_3x16__avx_broadcast, xnn_init_f32_minmax_avx_params);
+          .cn_stride(11)
+          .Test(xnn_f32_gemm_minmax_ukernel_6x8__avx_broadcast, xnn_init_f32_minmax_avx_params);
       }
     }
   }
 
-  TEST(F32_GEMM_MINMAX_3X16__AVX_BROADCAST, n_gt_16_strided_a) {
+  TEST(F32_GEMM_MINMAX_6X8__AVX_BROADCAST, n_gt_8_strided_a) {
     TEST_REQUIRES_X86_AVX;
-    for (uint32_t n = 17; n < 32; n++) {
+    for (uint32_t n = 9; n < 16; n++) {
       for (size_t k = 1; k <= 5; k += 2) {
         GemmMicrokernelTester()
-          .mr(3)
-          .nr(16)
+          .mr(6)
+          .nr(8)
           .kr(1)
           .sr(1)
-          .m(3)
+          .m(6)
           .n(n)
           .k(k)
           .a_stride(7)
-          .Test(xnn_f32_gemm_minmax_ukernel_3x16__avx_broadcast, xnn_init_f32_minmax_avx_params);
+          .Test(xnn_f32_gemm_minmax_ukernel_6x8__avx_broadcast, xnn_init_f32_minmax_avx_params);
       }
     }
   }
 
-  TEST(F32_GEMM_MINMAX_3X16__AVX_BROADCAST, n_gt_16_subtile) {
+  TEST(F32_GEMM_MINMAX_6X8__AVX_BROADCAST, n_gt_8_subtile) {
     TEST_REQUIRES_X86_AVX;
-    for (uint32_t n = 17; n < 32; n++) {
+    for (uint32_t n = 9; n < 16; n++) {
       for (size_t k = 1; k <= 5; k += 2) {
-        for (uint32_t m = 1; m <= 3; m++) {
+        for (uint32_t m = 1; m <= 6; m++) {
           GemmMicrokernelTester()
-            .mr(3)
-            .nr(16)
+            .mr(6)
+            .nr(8)
             .kr(1)
             .sr(1)
             .m(m)
             .n(n)
             .k(k)
             .iterations(1)
-            .Test(xnn_f32_gemm_minmax_ukernel_3x16__avx_broadcast, xnn_init_f32_minmax_avx_params);
+            .Test(xnn_f32_gemm_minmax_ukernel_6x8__avx_broadcast, xnn_init_f32_minmax_avx_params);
         }
       }
     }
   }
 
-  TEST(F32_GEMM_MINMAX_3X16__AVX_BROADCAST, n_div_16) {
+  TEST(F32_GEMM_MINMAX_6X8__AVX_BROADCAST, n_div_8) {
     TEST_REQUIRES_X86_AVX;
-    for (uint32_t n = 32; n <= 48; n += 16) {
+    for (uint32_t n = 16; n <= 24; n += 8) {
       for (size_t k = 1; k <= 5; k += 2) {
         GemmMicrokernelTester()
-          .mr(3)
-          .nr(16)
+          .mr(6)
+          .nr(8)
           .kr(1)
           .sr(1)
-          .m(3)
+          .m(6)
           .n(n)
           .k(k)
-          .Test(xnn_f32_gemm_minmax_ukernel_3x16__avx_broadcast, xnn_init_f32_minmax_avx_params);
+          .Test(xnn_f32_gemm_minmax_ukernel_6x8__avx_broadcast, xnn_init_f32_minmax_avx_params);
       }
     }
   }
 
-  TEST(F32_GEMM_MINMAX_3X16__AVX_BROADCAST, n_div_16_strided_cn) {
+  TEST(F32_GEMM_MINMAX_6X8__AVX_BROADCAST, n_div_8_strided_cn) {
     TEST_REQUIRES_X86_AVX;
-    for (uint32_t n = 32; n <= 48; n += 16) {
+    for (uint32_t n = 16; n <= 24; n += 8) {
       for (size_t k = 1; k <= 5; k += 2) {
         GemmMicrokernelTester()
-          .mr(3)
-          .nr(16)
+          .mr(6)
+          .nr(8)
           .kr(1)
           .sr(1)
-          .m(3)
+          .m(6)
           .n(n)
           .k(k)
-          .cn_stride(19)
-          .Test(xnn_f32_gemm_minmax_ukernel_3x16__avx_broadcast, xnn_init_f32_minmax_avx_params);
+          .cn_stride(11)
+          .Test(xnn_f32_gemm_minmax_ukernel_6x8__avx_broadcast, xnn_init_f32_minmax_avx_params);
       }
     }
   }
 
-  TEST(F32_GEMM_MINMAX_3X16__AVX_BROADCAST, n_div_16_strided_a) {
+  TEST(F32_GEMM_MINMAX_6X8__AVX_BROADCAST, n_div_8_strided_a) {
     TEST_REQUIRES_X86_AVX;
-    for (uint32_t n = 32; n <= 48; n += 16) {
+    for (uint32_t n = 16; n <= 24; n += 8) {
       for (size_t k = 1; k <= 5; k += 2) {
         GemmMicrokernelTester()
-          .mr(3)
-          .nr(16)
+          .mr(6)
+          .nr(8)
           .kr(1)
           .sr(1)
-          .m(3)
+          .m(6)
           .n(n)
           .k(k)
           .a_stride(7)
-          .Test(xnn_f32_gemm_minmax_ukernel_3x16__avx_broadcast, xnn_init_f32_minmax_avx_params);
+          .Test(xnn_f32_gemm_minmax_ukernel_6x8__avx_broadcast, xnn_init_f32_minmax_avx_params);
       }
     }
   }
 
-  TEST(F32_GEMM_MINMAX_3X16__AVX_BROADCAST, n_div_16_subtile) {
+  TEST(F32_GEMM_MINMAX_6X8__AVX_BROADCAST, n_div_8_subtile) {
     TEST_REQUIRES_X86_AVX;
-    for (uint32_t n = 32; n <= 48; n += 16) {
+    for (uint32_t n = 16; n <= 24; n += 8) {
       for (size_t k = 1; k <= 5; k += 2) {
-        for (uint32_t m = 1; m <= 3; m++) {
+        for (uint32_t m = 1; m <= 6; m++) {
           GemmMicrokernelTester()
-            .mr(3)
-            .nr(16)
+            .mr(6)
+            .nr(8)
             .kr(1)
             .sr(1)
             .m(m)
             .n(n)
             .k(k)
             .iterations(1)
-            .Test(xnn_f32_gemm_minmax_ukernel_3x16__avx_broadcast, xnn_init_f32_minmax_avx_params);
+            .Test(xnn_f32_gemm_minmax_ukernel_6x8__avx_broadcast, xnn_init_f32_minmax_avx_params);
         }
       }
     }
   }
 
-  TEST(F32_GEMM_MINMAX_3X16__AVX_BROADCAST, strided_cm_subtile) {
+  TEST(F32_GEMM_MINMAX_6X8__AVX_BROADCAST, strided_cm_subtile) {
     TEST_REQUIRES_X86_AVX;
     for (size_t k = 1; k <= 5; k += 2) {
-      for (uint32_t n = 1; n <= 16; n++) {
-        for (uint32_t m = 1; m <= 3; m++) {
+      for (uint32_t n = 1; n <= 8; n++) {
+        for (uint32_t m = 1; m <= 6; m++) {
           GemmMicrokernelTester()
-            .mr(3)
-            .nr(16)
+            .mr(6)
+            .nr(8)
             .kr(1)
             .sr(1)
             .m(m)
             .n(n)
             .k(k)
-            .cm_stride(19)
+            .cm_stride(11)
             .iterations(1)
-            .Test(xnn_f32_gemm_minmax_ukernel_3x16__avx_broadcast, xnn_init_f32_minmax_avx_params);
+            .Test(xnn_f32_gemm_minmax_ukernel_6x8__avx_broadcast, xnn_init_f32_minmax_avx_params);
         }
       }
     }
   }
 
-  TEST(F32_GEMM_MINMAX_3X16__AVX_BROADCAST, qmin) {
+  TEST(F32_GEMM_MINMAX_6X8__AVX_BROADCAST, qmin) {
     TEST_REQUIRES_X86_AVX;
     GemmMicrokernelTester()
-      .mr(3)
-      .nr(16)
+      .mr(6)
+      .nr(8)
       .kr(1)
       .sr(1)
-      .m(3)
-      .n(16)
+      .m(6)
+      .n(8)
       .k(1)
       .qmin(128)
-      .Test(xnn_f32_gemm_minmax_ukernel_3x16__avx_broadcast, xnn_init_f32_minmax_avx_params);
+      .Test(xnn_f32_gemm_minmax_ukernel_6x8__avx_broadcast, xnn_init_f32_minmax_avx_params);
   }
 
-  TEST(F32_GEMM_MINMAX_3X16__AVX_BROADCAST, qmax) {
+  TEST(F32_GEMM_MINMAX_6X8__AVX_BROADCAST, qmax) {
     TEST_REQUIRES_X86_AVX;
     GemmMicrokernelTester()
-      .mr(3)
-      .nr(16)
+      .mr(6)
+      .nr(8)
       .kr(1)
       .sr(1)
-      .m(3)
-      .n(16)
+      .m(6)
+      .n(8)
       .k(1)
       .qmax(128)
-      .Test(xnn_f32_gemm_minmax_ukernel_3x16__avx_broadcast, xnn_init_f32_minmax_avx_params);
+      .Test(xnn_f32_gemm_minmax_ukernel_6x8__avx_broadcast, xnn_init_f32_minmax_avx_params);
   }
 
-  TEST(F32_GEMM_MINMAX_3X16__AVX_BROADCAST, strided_cm) {
+  TEST(F32_GEMM_MINMAX_6X8__AVX_BROADCAST, strided_cm) {
     TEST_REQUIRES_X86_AVX;
     GemmMicrokernelTester()
-      .mr(3)
-      .nr(16)
+      .mr(6)
+      .nr(8)
       .kr(1)
       .sr(1)
-      .m(3)
-      .n(16)
+      .m(6)
+      .n(8)
       .k(1)
-      .cm_stride(19)
-      .Test(xnn_f32_gemm_minmax_ukernel_3x16__avx_broadcast, xnn_init_f32_minmax_avx_params);
+      .cm_stride(11)
+      .Test(xnn_f32_gemm_minmax_ukernel_6x8__avx_broadcast, xnn_init_f32_minmax_avx_params);
   }
 #endif  // XNN_ARCH_X86 || XNN_ARCH_X86_64
 
 
 #if XNN_ARCH_X86 || XNN_ARCH_X86_64
-  TEST(F32_GEMM_MINMAX_5X8__AVX_BROADCAST, k_eq_1) {
-    TEST_REQUIRES_X86_AVX;
+  TEST(F32_GEMM_MINMAX_1X8__FMA3_BROADCAST, k_eq_1) {
+    TEST_REQUIRES_X86_FMA3;
     GemmMicrokernelTester()
-      .mr(5)
+      .mr(1)
       .nr(8)
       .kr(1)
       .sr(1)
-      .m(5)
+      .m(1)
       .n(8)
       .k(1)
-      .Test(xnn_f32_gemm_minmax_ukernel_5x8__avx_broadcast, xnn_init_f32_minmax_avx_params);
+      .Test(xnn_f32_gemm_minmax_ukernel_1x8__fma3_broadcast, xnn_init_f32_minmax_avx_params);
   }
 
-  TEST(F32_GEMM_MINMAX_5X8__AVX_BROADCAST, strided_cn) {
-    TEST_REQUIRES_X86_AVX;
+  TEST(F32_GEMM_MINMAX_1X8__FMA3_BROADCAST, strided_cn) {
+    TEST_REQUIRES_X86_FMA3;
     GemmMicrokernelTester()
-      .mr(5)
+      .mr(1)
       .nr(8)
       .kr(1)
       .sr(1)
-      .m(5)
+      .m(1)
       .n(8)
       .k(1)
       .cn_stride(11)
-      .Test(xnn_f32_gemm_minmax_ukernel_5x8__avx_broadcast, xnn_init_f32_minmax_avx_params);
+      .Test(xnn_f32_gemm_minmax_ukernel_1x8__fma3_broadcast, xnn_init_f32_minmax_avx_params);
   }
 
-  TEST(F32_GEMM_MINMAX_5X8__AVX_BROADCAST, k_eq_1_strided_a) {
-    TEST_REQUIRES_X86_AVX;
+  TEST(F32_GEMM_MINMAX_1X8__FMA3_BROADCAST, k_eq_1_strided_a) {
+    TEST_REQUIRES_X86_FMA3;
     GemmMicrokernelTester()
-      .mr(5)
+      .mr(1)
       .nr(8)
       .kr(1)
       .sr(1)
-      .m(5)
+      .m(1)
       .n(8)
       .k(1)
       .a_stride(3)
-      .Test(xnn_f32_gemm_minmax_ukernel_5x8__avx_broadcast, xnn_init_f32_minmax_avx_params);
+      .Test(xnn_f32_gemm_minmax_ukernel_1x8__fma3_broadcast, xnn_init_f32_minmax_avx_params);
   }
 
-  TEST(F32_GEMM_MINMAX_5X8__AVX_BROADCAST, k_eq_1_subtile) {
-    TEST_REQUIRES_X86_AVX;
+  TEST(F32_GEMM_MINMAX_1X8__FMA3_BROADCAST, k_eq_1_subtile) {
+    TEST_REQUIRES_X86_FMA3;
     for (uint32_t n = 1; n <= 8; n++) {
-      for (uint32_t m = 1; m <= 5; m++) {
+      for (uint32_t m = 1; m <= 1; m++) {
         GemmMicrokernelTester()
-          .mr(5)
+          .mr(1)
           .nr(8)
           .kr(1)
           .sr(1)
@@ -17847,16 +19467,16 @@
           .n(n)
           .k(1)
           .iterations(1)
-          .Test(xnn_f32_gemm_minmax_ukernel_5x8__avx_broadcast, xnn_init_f32_minmax_avx_params);
+          .Test(xnn_f32_gemm_minmax_ukernel_1x8__fma3_broadcast, xnn_init_f32_minmax_avx_params);
       }
     }
   }
 
-  TEST(F32_GEMM_MINMAX_5X8__AVX_BROADCAST, k_eq_1_subtile_m) {
-    TEST_REQUIRES_X86_AVX;
-    for (uint32_t m = 1; m <= 5; m++) {
+  TEST(F32_GEMM_MINMAX_1X8__FMA3_BROADCAST, k_eq_1_subtile_m) {
+    TEST_REQUIRES_X86_FMA3;
+    for (uint32_t m = 1; m <= 1; m++) {
       GemmMicrokernelTester()
-        .mr(5)
+        .mr(1)
         .nr(8)
         .kr(1)
         .sr(1)
@@ -17864,64 +19484,64 @@
         .n(8)
         .k(1)
         .iterations(1)
-        .Test(xnn_f32_gemm_minmax_ukernel_5x8__avx_broadcast, xnn_init_f32_minmax_avx_params);
+        .Test(xnn_f32_gemm_minmax_ukernel_1x8__fma3_broadcast, xnn_init_f32_minmax_avx_params);
     }
   }
 
-  TEST(F32_GEMM_MINMAX_5X8__AVX_BROADCAST, k_eq_1_subtile_n) {
-    TEST_REQUIRES_X86_AVX;
+  TEST(F32_GEMM_MINMAX_1X8__FMA3_BROADCAST, k_eq_1_subtile_n) {
+    TEST_REQUIRES_X86_FMA3;
     for (uint32_t n = 1; n <= 8; n++) {
       GemmMicrokernelTester()
-        .mr(5)
+        .mr(1)
         .nr(8)
         .kr(1)
         .sr(1)
-        .m(5)
+        .m(1)
         .n(n)
         .k(1)
         .iterations(1)
-        .Test(xnn_f32_gemm_minmax_ukernel_5x8__avx_broadcast, xnn_init_f32_minmax_avx_params);
+        .Test(xnn_f32_gemm_minmax_ukernel_1x8__fma3_broadcast, xnn_init_f32_minmax_avx_params);
     }
   }
 
-  TEST(F32_GEMM_MINMAX_5X8__AVX_BROADCAST, k_gt_1) {
-    TEST_REQUIRES_X86_AVX;
+  TEST(F32_GEMM_MINMAX_1X8__FMA3_BROADCAST, k_gt_1) {
+    TEST_REQUIRES_X86_FMA3;
     for (size_t k = 2; k < 10; k++) {
       GemmMicrokernelTester()
-        .mr(5)
+        .mr(1)
         .nr(8)
         .kr(1)
         .sr(1)
-        .m(5)
+        .m(1)
         .n(8)
         .k(k)
-        .Test(xnn_f32_gemm_minmax_ukernel_5x8__avx_broadcast, xnn_init_f32_minmax_avx_params);
+        .Test(xnn_f32_gemm_minmax_ukernel_1x8__fma3_broadcast, xnn_init_f32_minmax_avx_params);
     }
   }
 
-  TEST(F32_GEMM_MINMAX_5X8__AVX_BROADCAST, k_gt_1_strided_a) {
-    TEST_REQUIRES_X86_AVX;
+  TEST(F32_GEMM_MINMAX_1X8__FMA3_BROADCAST, k_gt_1_strided_a) {
+    TEST_REQUIRES_X86_FMA3;
     for (size_t k = 2; k < 10; k++) {
       GemmMicrokernelTester()
-        .mr(5)
+        .mr(1)
         .nr(8)
         .kr(1)
         .sr(1)
-        .m(5)
+        .m(1)
         .n(8)
         .k(k)
         .a_stride(11)
-        .Test(xnn_f32_gemm_minmax_ukernel_5x8__avx_broadcast, xnn_init_f32_minmax_avx_params);
+        .Test(xnn_f32_gemm_minmax_ukernel_1x8__fma3_broadcast, xnn_init_f32_minmax_avx_params);
     }
   }
 
-  TEST(F32_GEMM_MINMAX_5X8__AVX_BROADCAST, k_gt_1_subtile) {
-    TEST_REQUIRES_X86_AVX;
+  TEST(F32_GEMM_MINMAX_1X8__FMA3_BROADCAST, k_gt_1_subtile) {
+    TEST_REQUIRES_X86_FMA3;
     for (size_t k = 2; k < 10; k++) {
       for (uint32_t n = 1; n <= 8; n++) {
-        for (uint32_t m = 1; m <= 5; m++) {
+        for (uint32_t m = 1; m <= 1; m++) {
           GemmMicrokernelTester()
-            .mr(5)
+            .mr(1)
             .nr(8)
             .kr(1)
             .sr(1)
@@ -17929,72 +19549,72 @@
             .n(n)
             .k(k)
             .iterations(1)
-            .Test(xnn_f32_gemm_minmax_ukernel_5x8__avx_broadcast, xnn_init_f32_minmax_avx_params);
+            .Test(xnn_f32_gemm_minmax_ukernel_1x8__fma3_broadcast, xnn_init_f32_minmax_avx_params);
         }
       }
     }
   }
 
-  TEST(F32_GEMM_MINMAX_5X8__AVX_BROADCAST, n_gt_8) {
-    TEST_REQUIRES_X86_AVX;
+  TEST(F32_GEMM_MINMAX_1X8__FMA3_BROADCAST, n_gt_8) {
+    TEST_REQUIRES_X86_FMA3;
     for (uint32_t n = 9; n < 16; n++) {
       for (size_t k = 1; k <= 5; k += 2) {
         GemmMicrokernelTester()
-          .mr(5)
+          .mr(1)
           .nr(8)
           .kr(1)
           .sr(1)
-          .m(5)
+          .m(1)
           .n(n)
           .k(k)
-          .Test(xnn_f32_gemm_minmax_ukernel_5x8__avx_broadcast, xnn_init_f32_minmax_avx_params);
+          .Test(xnn_f32_gemm_minmax_ukernel_1x8__fma3_broadcast, xnn_init_f32_minmax_avx_params);
       }
     }
   }
 
-  TEST(F32_GEMM_MINMAX_5X8__AVX_BROADCAST, n_gt_8_strided_cn) {
-    TEST_REQUIRES_X86_AVX;
+  TEST(F32_GEMM_MINMAX_1X8__FMA3_BROADCAST, n_gt_8_strided_cn) {
+    TEST_REQUIRES_X86_FMA3;
     for (uint32_t n = 9; n < 16; n++) {
       for (size_t k = 1; k <= 5; k += 2) {
         GemmMicrokernelTester()
-          .mr(5)
+          .mr(1)
           .nr(8)
           .kr(1)
           .sr(1)
-          .m(5)
+          .m(1)
           .n(n)
           .k(k)
           .cn_stride(11)
-          .Test(xnn_f32_gemm_minmax_ukernel_5x8__avx_broadcast, xnn_init_f32_minmax_avx_params);
+          .Test(xnn_f32_gemm_minmax_ukernel_1x8__fma3_broadcast, xnn_init_f32_minmax_avx_params);
       }
     }
   }
 
-  TEST(F32_GEMM_MINMAX_5X8__AVX_BROADCAST, n_gt_8_strided_a) {
-    TEST_REQUIRES_X86_AVX;
+  TEST(F32_GEMM_MINMAX_1X8__FMA3_BROADCAST, n_gt_8_strided_a) {
+    TEST_REQUIRES_X86_FMA3;
     for (uint32_t n = 9; n < 16; n++) {
       for (size_t k = 1; k <= 5; k += 2) {
         GemmMicrokernelTester()
-          .mr(5)
+          .mr(1)
           .nr(8)
           .kr(1)
           .sr(1)
-          .m(5)
+          .m(1)
           .n(n)
           .k(k)
           .a_stride(7)
-          .Test(xnn_f32_gemm_minmax_ukernel_5x8__avx_broadcast, xnn_init_f32_minmax_avx_params);
+          .Test(xnn_f32_gemm_minmax_ukernel_1x8__fma3_broadcast, xnn_init_f32_minmax_avx_params);
       }
     }
   }
 
-  TEST(F32_GEMM_MINMAX_5X8__AVX_BROADCAST, n_gt_8_subtile) {
-    TEST_REQUIRES_X86_AVX;
+  TEST(F32_GEMM_MINMAX_1X8__FMA3_BROADCAST, n_gt_8_subtile) {
+    TEST_REQUIRES_X86_FMA3;
     for (uint32_t n = 9; n < 16; n++) {
       for (size_t k = 1; k <= 5; k += 2) {
-        for (uint32_t m = 1; m <= 5; m++) {
+        for (uint32_t m = 1; m <= 1; m++) {
           GemmMicrokernelTester()
-            .mr(5)
+            .mr(1)
             .nr(8)
             .kr(1)
             .sr(1)
@@ -18002,72 +19622,72 @@
             .n(n)
             .k(k)
             .iterations(1)
-            .Test(xnn_f32_gemm_minmax_ukernel_5x8__avx_broadcast, xnn_init_f32_minmax_avx_params);
+            .Test(xnn_f32_gemm_minmax_ukernel_1x8__fma3_broadcast, xnn_init_f32_minmax_avx_params);
         }
       }
     }
   }
 
-  TEST(F32_GEMM_MINMAX_5X8__AVX_BROADCAST, n_div_8) {
-    TEST_REQUIRES_X86_AVX;
+  TEST(F32_GEMM_MINMAX_1X8__FMA3_BROADCAST, n_div_8) {
+    TEST_REQUIRES_X86_FMA3;
     for (uint32_t n = 16; n <= 24; n += 8) {
       for (size_t k = 1; k <= 5; k += 2) {
         GemmMicrokernelTester()
-          .mr(5)
+          .mr(1)
           .nr(8)
           .kr(1)
           .sr(1)
-          .m(5)
+          .m(1)
           .n(n)
           .k(k)
-          .Test(xnn_f32_gemm_minmax_ukernel_5x8__avx_broadcast, xnn_init_f32_minmax_avx_params);
+          .Test(xnn_f32_gemm_minmax_ukernel_1x8__fma3_broadcast, xnn_init_f32_minmax_avx_params);
       }
     }
   }
 
-  TEST(F32_GEMM_MINMAX_5X8__AVX_BROADCAST, n_div_8_strided_cn) {
-    TEST_REQUIRES_X86_AVX;
+  TEST(F32_GEMM_MINMAX_1X8__FMA3_BROADCAST, n_div_8_strided_cn) {
+    TEST_REQUIRES_X86_FMA3;
     for (uint32_t n = 16; n <= 24; n += 8) {
       for (size_t k = 1; k <= 5; k += 2) {
         GemmMicrokernelTester()
-          .mr(5)
+          .mr(1)
           .nr(8)
           .kr(1)
           .sr(1)
-          .m(5)
+          .m(1)
           .n(n)
           .k(k)
           .cn_stride(11)
-          .Test(xnn_f32_gemm_minmax_ukernel_5x8__avx_broadcast, xnn_init_f32_minmax_avx_params);
+          .Test(xnn_f32_gemm_minmax_ukernel_1x8__fma3_broadcast, xnn_init_f32_minmax_avx_params);
       }
     }
   }
 
-  TEST(F32_GEMM_MINMAX_5X8__AVX_BROADCAST, n_div_8_strided_a) {
-    TEST_REQUIRES_X86_AVX;
+  TEST(F32_GEMM_MINMAX_1X8__FMA3_BROADCAST, n_div_8_strided_a) {
+    TEST_REQUIRES_X86_FMA3;
     for (uint32_t n = 16; n <= 24; n += 8) {
       for (size_t k = 1; k <= 5; k += 2) {
         GemmMicrokernelTester()
-          .mr(5)
+          .mr(1)
           .nr(8)
           .kr(1)
           .sr(1)
-          .m(5)
+          .m(1)
           .n(n)
           .k(k)
           .a_stride(7)
-          .Test(xnn_f32_gemm_minmax_ukernel_5x8__avx_broadcast, xnn_init_f32_minmax_avx_params);
+          .Test(xnn_f32_gemm_minmax_ukernel_1x8__fma3_broadcast, xnn_init_f32_minmax_avx_params);
       }
     }
   }
 
-  TEST(F32_GEMM_MINMAX_5X8__AVX_BROADCAST, n_div_8_subtile) {
-    TEST_REQUIRES_X86_AVX;
+  TEST(F32_GEMM_MINMAX_1X8__FMA3_BROADCAST, n_div_8_subtile) {
+    TEST_REQUIRES_X86_FMA3;
     for (uint32_t n = 16; n <= 24; n += 8) {
       for (size_t k = 1; k <= 5; k += 2) {
-        for (uint32_t m = 1; m <= 5; m++) {
+        for (uint32_t m = 1; m <= 1; m++) {
           GemmMicrokernelTester()
-            .mr(5)
+            .mr(1)
             .nr(8)
             .kr(1)
             .sr(1)
@@ -18075,19 +19695,19 @@
             .n(n)
             .k(k)
             .iterations(1)
-            .Test(xnn_f32_gemm_minmax_ukernel_5x8__avx_broadcast, xnn_init_f32_minmax_avx_params);
+            .Test(xnn_f32_gemm_minmax_ukernel_1x8__fma3_broadcast, xnn_init_f32_minmax_avx_params);
         }
       }
     }
   }
 
-  TEST(F32_GEMM_MINMAX_5X8__AVX_BROADCAST, strided_cm_subtile) {
-    TEST_REQUIRES_X86_AVX;
+  TEST(F32_GEMM_MINMAX_1X8__FMA3_BROADCAST, strided_cm_subtile) {
+    TEST_REQUIRES_X86_FMA3;
     for (size_t k = 1; k <= 5; k += 2) {
       for (uint32_t n = 1; n <= 8; n++) {
-        for (uint32_t m = 1; m <= 5; m++) {
+        for (uint32_t m = 1; m <= 1; m++) {
           GemmMicrokernelTester()
-            .mr(5)
+            .mr(1)
             .nr(8)
             .kr(1)
             .sr(1)
@@ -18096,812 +19716,914 @@
             .k(k)
             .cm_stride(11)
             .iterations(1)
-            .Test(xnn_f32_gemm_minmax_ukernel_5x8__avx_broadcast, xnn_init_f32_minmax_avx_params);
+            .Test(xnn_f32_gemm_minmax_ukernel_1x8__fma3_broadcast, xnn_init_f32_minmax_avx_params);
         }
       }
     }
   }
 
-  TEST(F32_GEMM_MINMAX_5X8__AVX_BROADCAST, qmin) {
-    TEST_REQUIRES_X86_AVX;
+  TEST(F32_GEMM_MINMAX_1X8__FMA3_BROADCAST, qmin) {
+    TEST_REQUIRES_X86_FMA3;
     GemmMicrokernelTester()
-      .mr(5)
+      .mr(1)
       .nr(8)
       .kr(1)
       .sr(1)
-      .m(5)
+      .m(1)
       .n(8)
       .k(1)
       .qmin(128)
-      .Test(xnn_f32_gemm_minmax_ukernel_5x8__avx_broadcast, xnn_init_f32_minmax_avx_params);
+      .Test(xnn_f32_gemm_minmax_ukernel_1x8__fma3_broadcast, xnn_init_f32_minmax_avx_params);
   }
 
-  TEST(F32_GEMM_MINMAX_5X8__AVX_BROADCAST, qmax) {
-    TEST_REQUIRES_X86_AVX;
+  TEST(F32_GEMM_MINMAX_1X8__FMA3_BROADCAST, qmax) {
+    TEST_REQUIRES_X86_FMA3;
     GemmMicrokernelTester()
-      .mr(5)
+      .mr(1)
       .nr(8)
       .kr(1)
       .sr(1)
-      .m(5)
+      .m(1)
       .n(8)
       .k(1)
       .qmax(128)
-      .Test(xnn_f32_gemm_minmax_ukernel_5x8__avx_broadcast, xnn_init_f32_minmax_avx_params);
+      .Test(xnn_f32_gemm_minmax_ukernel_1x8__fma3_broadcast, xnn_init_f32_minmax_avx_params);
   }
 
-  TEST(F32_GEMM_MINMAX_5X8__AVX_BROADCAST, strided_cm) {
-    TEST_REQUIRES_X86_AVX;
+  TEST(F32_GEMM_MINMAX_1X8__FMA3_BROADCAST, strided_cm) {
+    TEST_REQUIRES_X86_FMA3;
     GemmMicrokernelTester()
-      .mr(5)
+      .mr(1)
       .nr(8)
       .kr(1)
       .sr(1)
-      .m(5)
+      .m(1)
       .n(8)
       .k(1)
       .cm_stride(11)
-      .Test(xnn_f32_gemm_minmax_ukernel_5x8__avx_broadcast, xnn_init_f32_minmax_avx_params);
+      .Test(xnn_f32_gemm_minmax_ukernel_1x8__fma3_broadcast, xnn_init_f32_minmax_avx_params);
   }
 #endif  // XNN_ARCH_X86 || XNN_ARCH_X86_64
 
 
 #if XNN_ARCH_X86 || XNN_ARCH_X86_64
-  TEST(F32_GEMM_MINMAX_6X8__AVX_BROADCAST, k_eq_1) {
-    TEST_REQUIRES_X86_AVX;
+  TEST(F32_GEMM_MINMAX_1X16__FMA3_BROADCAST, k_eq_1) {
+    TEST_REQUIRES_X86_FMA3;
     GemmMicrokernelTester()
-      .mr(6)
-      .nr(8)
+      .mr(1)
+      .nr(16)
       .kr(1)
       .sr(1)
-      .m(6)
-      .n(8)
+      .m(1)
+      .n(16)
       .k(1)
-      .Test(xnn_f32_gemm_minmax_ukernel_6x8__avx_broadcast, xnn_init_f32_minmax_avx_params);
+      .Test(xnn_f32_gemm_minmax_ukernel_1x16__fma3_broadcast, xnn_init_f32_minmax_avx_params);
   }
 
-  TEST(F32_GEMM_MINMAX_6X8__AVX_BROADCAST, strided_cn) {
-    TEST_REQUIRES_X86_AVX;
+  TEST(F32_GEMM_MINMAX_1X16__FMA3_BROADCAST, strided_cn) {
+    TEST_REQUIRES_X86_FMA3;
     GemmMicrokernelTester()
-      .mr(6)
-      .nr(8)
+      .mr(1)
+      .nr(16)
       .kr(1)
       .sr(1)
-      .m(6)
-      .n(8)
+      .m(1)
+      .n(16)
       .k(1)
-      .cn_stride(11)
-      .Test(xnn_f32_gemm_minmax_ukernel_6x8__avx_broadcast, xnn_init_f32_minmax_avx_params);
+      .cn_stride(19)
+      .Test(xnn_f32_gemm_minmax_ukernel_1x16__fma3_broadcast, xnn_init_f32_minmax_avx_params);
   }
 
-  TEST(F32_GEMM_MINMAX_6X8__AVX_BROADCAST, k_eq_1_strided_a) {
-    TEST_REQUIRES_X86_AVX;
+  TEST(F32_GEMM_MINMAX_1X16__FMA3_BROADCAST, k_eq_1_strided_a) {
+    TEST_REQUIRES_X86_FMA3;
     GemmMicrokernelTester()
-      .mr(6)
-      .nr(8)
+      .mr(1)
+      .nr(16)
       .kr(1)
       .sr(1)
-      .m(6)
-      .n(8)
+      .m(1)
+      .n(16)
       .k(1)
       .a_stride(3)
-      .Test(xnn_f32_gemm_minmax_ukernel_6x8__avx_broadcast, xnn_init_f32_minmax_avx_params);
+      .Test(xnn_f32_gemm_minmax_ukernel_1x16__fma3_broadcast, xnn_init_f32_minmax_avx_params);
   }
 
-  TEST(F32_GEMM_MINMAX_6X8__AVX_BROADCAST, k_eq_1_subtile) {
-    TEST_REQUIRES_X86_AVX;
-    for (uint32_t n = 1; n <= 8; n++) {
-      for (uint32_t m = 1; m <= 6; m++) {
+  TEST(F32_GEMM_MINMAX_1X16__FMA3_BROADCAST, k_eq_1_subtile) {
+    TEST_REQUIRES_X86_FMA3;
+    for (uint32_t n = 1; n <= 16; n++) {
+      for (uint32_t m = 1; m <= 1; m++) {
         GemmMicrokernelTester()
-          .mr(6)
-          .nr(8)
+          .mr(1)
+          .nr(16)
           .kr(1)
           .sr(1)
           .m(m)
           .n(n)
           .k(1)
           .iterations(1)
-          .Test(xnn_f32_gemm_minmax_ukernel_6x8__avx_broadcast, xnn_init_f32_minmax_avx_params);
+          .Test(xnn_f32_gemm_minmax_ukernel_1x16__fma3_broadcast, xnn_init_f32_minmax_avx_params);
       }
     }
   }
 
-  TEST(F32_GEMM_MINMAX_6X8__AVX_BROADCAST, k_eq_1_subtile_m) {
-    TEST_REQUIRES_X86_AVX;
-    for (uint32_t m = 1; m <= 6; m++) {
+  TEST(F32_GEMM_MINMAX_1X16__FMA3_BROADCAST, k_eq_1_subtile_m) {
+    TEST_REQUIRES_X86_FMA3;
+    for (uint32_t m = 1; m <= 1; m++) {
       GemmMicrokernelTester()
-        .mr(6)
-        .nr(8)
+        .mr(1)
+        .nr(16)
         .kr(1)
         .sr(1)
         .m(m)
-        .n(8)
+        .n(16)
         .k(1)
         .iterations(1)
-        .Test(xnn_f32_gemm_minmax_ukernel_6x8__avx_broadcast, xnn_init_f32_minmax_avx_params);
+        .Test(xnn_f32_gemm_minmax_ukernel_1x16__fma3_broadcast, xnn_init_f32_minmax_avx_params);
     }
   }
 
-  TEST(F32_GEMM_MINMAX_6X8__AVX_BROADCAST, k_eq_1_subtile_n) {
-    TEST_REQUIRES_X86_AVX;
-    for (uint32_t n = 1; n <= 8; n++) {
+  TEST(F32_GEMM_MINMAX_1X16__FMA3_BROADCAST, k_eq_1_subtile_n) {
+    TEST_REQUIRES_X86_FMA3;
+    for (uint32_t n = 1; n <= 16; n++) {
       GemmMicrokernelTester()
-        .mr(6)
-        .nr(8)
+        .mr(1)
+        .nr(16)
         .kr(1)
         .sr(1)
-        .m(6)
+        .m(1)
         .n(n)
         .k(1)
         .iterations(1)
-        .Test(xnn_f32_gemm_minmax_ukernel_6x8__avx_broadcast, xnn_init_f32_minmax_avx_params);
+        .Test(xnn_f32_gemm_minmax_ukernel_1x16__fma3_broadcast, xnn_init_f32_minmax_avx_params);
     }
   }
 
-  TEST(F32_GEMM_MINMAX_6X8__AVX_BROADCAST, k_gt_1) {
-    TEST_REQUIRES_X86_AVX;
+  TEST(F32_GEMM_MINMAX_1X16__FMA3_BROADCAST, k_gt_1) {
+    TEST_REQUIRES_X86_FMA3;
     for (size_t k = 2; k < 10; k++) {
       GemmMicrokernelTester()
-        .mr(6)
-        .nr(8)
+        .mr(1)
+        .nr(16)
         .kr(1)
         .sr(1)
-        .m(6)
-        .n(8)
+        .m(1)
+        .n(16)
         .k(k)
-        .Test(xnn_f32_gemm_minmax_ukernel_6x8__avx_broadcast, xnn_init_f32_minmax_avx_params);
+        .Test(xnn_f32_gemm_minmax_ukernel_1x16__fma3_broadcast, xnn_init_f32_minmax_avx_params);
     }
   }
 
-  TEST(F32_GEMM_MINMAX_6X8__AVX_BROADCAST, k_gt_1_strided_a) {
-    TEST_REQUIRES_X86_AVX;
+  TEST(F32_GEMM_MINMAX_1X16__FMA3_BROADCAST, k_gt_1_strided_a) {
+    TEST_REQUIRES_X86_FMA3;
     for (size_t k = 2; k < 10; k++) {
       GemmMicrokernelTester()
-        .mr(6)
-        .nr(8)
+        .mr(1)
+        .nr(16)
         .kr(1)
         .sr(1)
-        .m(6)
-        .n(8)
+        .m(1)
+        .n(16)
         .k(k)
         .a_stride(11)
-        .Test(xnn_f32_gemm_minmax_ukernel_6x8__avx_broadcast, xnn_init_f32_minmax_avx_params);
+        .Test(xnn_f32_gemm_minmax_ukernel_1x16__fma3_broadcast, xnn_init_f32_minmax_avx_params);
     }
   }
 
-  TEST(F32_GEMM_MINMAX_6X8__AVX_BROADCAST, k_gt_1_subtile) {
-    TEST_REQUIRES_X86_AVX;
+  TEST(F32_GEMM_MINMAX_1X16__FMA3_BROADCAST, k_gt_1_subtile) {
+    TEST_REQUIRES_X86_FMA3;
     for (size_t k = 2; k < 10; k++) {
-      for (uint32_t n = 1; n <= 8; n++) {
-        for (uint32_t m = 1; m <= 6; m++) {
+      for (uint32_t n = 1; n <= 16; n++) {
+        for (uint32_t m = 1; m <= 1; m++) {
           GemmMicrokernelTester()
-            .mr(6)
-            .nr(8)
+            .mr(1)
+            .nr(16)
             .kr(1)
             .sr(1)
             .m(m)
             .n(n)
             .k(k)
             .iterations(1)
-            .Test(xnn_f32_gemm_minmax_ukernel_6x8__avx_broadcast, xnn_init_f32_minmax_avx_params);
+            .Test(xnn_f32_gemm_minmax_ukernel_1x16__fma3_broadcast, xnn_init_f32_minmax_avx_params);
         }
       }
     }
   }
 
-  TEST(F32_GEMM_MINMAX_6X8__AVX_BROADCAST, n_gt_8) {
-    TEST_REQUIRES_X86_AVX;
-    for (uint32_t n = 9; n < 16; n++) {
+  TEST(F32_GEMM_MINMAX_1X16__FMA3_BROADCAST, n_gt_16) {
+    TEST_REQUIRES_X86_FMA3;
+    for (uint32_t n = 17; n < 32; n++) {
       for (size_t k = 1; k <= 5; k += 2) {
         GemmMicrokernelTester()
-          .mr(6)
-          .nr(8)
+          .mr(1)
+          .nr(16)
           .kr(1)
           .sr(1)
-          .m(6)
+          .m(1)
           .n(n)
           .k(k)
-          .Test(xnn_f32_gemm_minmax_ukernel_6x8__avx_broadcast, xnn_init_f32_minmax_avx_params);
+          .Test(xnn_f32_gemm_minmax_ukernel_1x16__fma3_broadcast, xnn_init_f32_minmax_avx_params);
       }
     }
   }
 
-  TEST(F32_GEMM_MINMAX_6X8__AVX_BROADCAST, n_gt_8_strided_cn) {
-    TEST_REQUIRES_X86_AVX;
-    for (uint32_t n = 9; n < 16; n++) {
+  TEST(F32_GEMM_MINMAX_1X16__FMA3_BROADCAST, n_gt_16_strided_cn) {
+    TEST_REQUIRES_X86_FMA3;
+    for (uint32_t n = 17; n < 32; n++) {
       for (size_t k = 1; k <= 5; k += 2) {
         GemmMicrokernelTester()
-          .mr(6)
-          .nr(8)
+          .mr(1)
+          .nr(16)
           .kr(1)
           .sr(1)
-          .m(6)
+          .m(1)
           .n(n)
           .k(k)
-          .cn_stride(11)
-          .Test(xnn_f32_gemm_minmax_ukernel_6x8__avx_broadcast, xnn_init_f32_minmax_avx_params);
+          .cn_stride(19)
+          .Test(xnn_f32_gemm_minmax_ukernel_1x16__fma3_broadcast, xnn_init_f32_minmax_avx_params);
       }
     }
   }
 
-  TEST(F32_GEMM_MINMAX_6X8__AVX_BROADCAST, n_gt_8_strided_a) {
-    TEST_REQUIRES_X86_AVX;
-    for (uint32_t n = 9; n < 16; n++) {
+  TEST(F32_GEMM_MINMAX_1X16__FMA3_BROADCAST, n_gt_16_strided_a) {
+    TEST_REQUIRES_X86_FMA3;
+    for (uint32_t n = 17; n < 32; n++) {
       for (size_t k = 1; k <= 5; k += 2) {
         GemmMicrokernelTester()
-          .mr(6)
-          .nr(8)
+          .mr(1)
+          .nr(16)
           .kr(1)
           .sr(1)
-          .m(6)
+          .m(1)
           .n(n)
           .k(k)
           .a_stride(7)
-          .Test(xnn_f32_gemm_minmax_ukernel_6x8__avx_broadcast, xnn_init_f32_minmax_avx_params);
+          .Test(xnn_f32_gemm_minmax_ukernel_1x16__fma3_broadcast, xnn_init_f32_minmax_avx_params);
       }
     }
   }
 
-  TEST(F32_GEMM_MINMAX_6X8__AVX_BROADCAST, n_gt_8_subtile) {
-    TEST_REQUIRES_X86_AVX;
-    for (uint32_t n = 9; n < 16; n++) {
+  TEST(F32_GEMM_MINMAX_1X16__FMA3_BROADCAST, n_gt_16_subtile) {
+    TEST_REQUIRES_X86_FMA3;
+    for (uint32_t n = 17; n < 32; n++) {
       for (size_t k = 1; k <= 5; k += 2) {
-        for (uint32_t m = 1; m <= 6; m++) {
+        for (uint32_t m = 1; m <= 1; m++) {
           GemmMicrokernelTester()
-            .mr(6)
-            .nr(8)
+            .mr(1)
+            .nr(16)
             .kr(1)
             .sr(1)
             .m(m)
             .n(n)
             .k(k)
             .iterations(1)
-            .Test(xnn_f32_gemm_minmax_ukernel_6x8__avx_broadcast, xnn_init_f32_minmax_avx_params);
+            .Test(xnn_f32_gemm_minmax_ukernel_1x16__fma3_broadcast, xnn_init_f32_minmax_avx_params);
         }
       }
     }
   }
 
-  TEST(F32_GEMM_MINMAX_6X8__AVX_BROADCAST, n_div_8) {
-    TEST_REQUIRES_X86_AVX;
-    for (uint32_t n = 16; n <= 24; n += 8) {
+  TEST(F32_GEMM_MINMAX_1X16__FMA3_BROADCAST, n_div_16) {
+    TEST_REQUIRES_X86_FMA3;
+    for (uint32_t n = 32; n <= 48; n += 16) {
       for (size_t k = 1; k <= 5; k += 2) {
         GemmMicrokernelTester()
-          .mr(6)
-          .nr(8)
+          .mr(1)
+          .nr(16)
           .kr(1)
           .sr(1)
-          .m(6)
+          .m(1)
           .n(n)
           .k(k)
-          .Test(xnn_f32_gemm_minmax_ukernel_6x8__avx_broadcast, xnn_init_f32_minmax_avx_params);
+          .Test(xnn_f32_gemm_minmax_ukernel_1x16__fma3_broadcast, xnn_init_f32_minmax_avx_params);
       }
     }
   }
 
-  TEST(F32_GEMM_MINMAX_6X8__AVX_BROADCAST, n_div_8_strided_cn) {
-    TEST_REQUIRES_X86_AVX;
-    for (uint32_t n = 16; n <= 24; n += 8) {
+  TEST(F32_GEMM_MINMAX_1X16__FMA3_BROADCAST, n_div_16_strided_cn) {
+    TEST_REQUIRES_X86_FMA3;
+    for (uint32_t n = 32; n <= 48; n += 16) {
       for (size_t k = 1; k <= 5; k += 2) {
         GemmMicrokernelTester()
-          .mr(6)
-          .nr(8)
+          .mr(1)
+          .nr(16)
           .kr(1)
           .sr(1)
-          .m(6)
+          .m(1)
           .n(n)
           .k(k)
-          .cn_stride(11)
-          .Test(xnn_f32_gemm_minmax_ukernel_6x8__avx_broadcast, xnn_init_f32_minmax_avx_params);
+          .cn_stride(19)
+          .Test(xnn_f32_gemm_minmax_ukernel_1x16__fma3_broadcast, xnn_init_f32_minmax_avx_params);
       }
     }
   }
 
-  TEST(F32_GEMM_MINMAX_6X8__AVX_BROADCAST, n_div_8_strided_a) {
-    TEST_REQUIRES_X86_AVX;
-    for (uint32_t n = 16; n <= 24; n += 8) {
+  TEST(F32_GEMM_MINMAX_1X16__FMA3_BROADCAST, n_div_16_strided_a) {
+    TEST_REQUIRES_X86_FMA3;
+    for (uint32_t n = 32; n <= 48; n += 16) {
       for (size_t k = 1; k <= 5; k += 2) {
         GemmMicrokernelTester()
-          .mr(6)
-          .nr(8)
+          .mr(1)
+          .nr(16)
           .kr(1)
           .sr(1)
-          .m(6)
+          .m(1)
           .n(n)
           .k(k)
           .a_stride(7)
-          .Test(xnn_f32_gemm_minmax_ukernel_6x8__avx_broadcast, xnn_init_f32_minmax_avx_params);
+          .Test(xnn_f32_gemm_minmax_ukernel_1x16__fma3_broadcast, xnn_init_f32_minmax_avx_params);
       }
     }
   }
 
-  TEST(F32_GEMM_MINMAX_6X8__AVX_BROADCAST, n_div_8_subtile) {
-    TEST_REQUIRES_X86_AVX;
-    for (uint32_t n = 16; n <= 24; n += 8) {
+  TEST(F32_GEMM_MINMAX_1X16__FMA3_BROADCAST, n_div_16_subtile) {
+    TEST_REQUIRES_X86_FMA3;
+    for (uint32_t n = 32; n <= 48; n += 16) {
       for (size_t k = 1; k <= 5; k += 2) {
-        for (uint32_t m = 1; m <= 6; m++) {
+        for (uint32_t m = 1; m <= 1; m++) {
           GemmMicrokernelTester()
-            .mr(6)
-            .nr(8)
+            .mr(1)
+            .nr(16)
             .kr(1)
             .sr(1)
             .m(m)
             .n(n)
             .k(k)
             .iterations(1)
-            .Test(xnn_f32_gemm_minmax_ukernel_6x8__avx_broadcast, xnn_init_f32_minmax_avx_params);
+            .Test(xnn_f32_gemm_minmax_ukernel_1x16__fma3_broadcast, xnn_init_f32_minmax_avx_params);
         }
       }
     }
   }
 
-  TEST(F32_GEMM_MINMAX_6X8__AVX_BROADCAST, strided_cm_subtile) {
-    TEST_REQUIRES_X86_AVX;
+  TEST(F32_GEMM_MINMAX_1X16__FMA3_BROADCAST, strided_cm_subtile) {
+    TEST_REQUIRES_X86_FMA3;
     for (size_t k = 1; k <= 5; k += 2) {
-      for (uint32_t n = 1; n <= 8; n++) {
-        for (uint32_t m = 1; m <= 6; m++) {
+      for (uint32_t n = 1; n <= 16; n++) {
+        for (uint32_t m = 1; m <= 1; m++) {
           GemmMicrokernelTester()
-            .mr(6)
-            .nr(8)
+            .mr(1)
+            .nr(16)
             .kr(1)
             .sr(1)
             .m(m)
             .n(n)
             .k(k)
-            .cm_stride(11)
+            .cm_stride(19)
             .iterations(1)
-            .Test(xnn_f32_gemm_minmax_ukernel_6x8__avx_broadcast, xnn_init_f32_minmax_avx_params);
+            .Test(xnn_f32_gemm_minmax_ukernel_1x16__fma3_broadcast, xnn_init_f32_minmax_avx_params);
         }
       }
     }
   }
 
-  TEST(F32_GEMM_MINMAX_6X8__AVX_BROADCAST, qmin) {
-    TEST_REQUIRES_X86_AVX;
+  TEST(F32_GEMM_MINMAX_1X16__FMA3_BROADCAST, qmin) {
+    TEST_REQUIRES_X86_FMA3;
     GemmMicrokernelTester()
-      .mr(6)
-      .nr(8)
+      .mr(1)
+      .nr(16)
       .kr(1)
       .sr(1)
-      .m(6)
-      .n(8)
+      .m(1)
+      .n(16)
       .k(1)
       .qmin(128)
-      .Test(xnn_f32_gemm_minmax_ukernel_6x8__avx_broadcast, xnn_init_f32_minmax_avx_params);
+      .Test(xnn_f32_gemm_minmax_ukernel_1x16__fma3_broadcast, xnn_init_f32_minmax_avx_params);
   }
 
-  TEST(F32_GEMM_MINMAX_6X8__AVX_BROADCAST, qmax) {
-    TEST_REQUIRES_X86_AVX;
+  TEST(F32_GEMM_MINMAX_1X16__FMA3_BROADCAST, qmax) {
+    TEST_REQUIRES_X86_FMA3;
     GemmMicrokernelTester()
-      .mr(6)
-      .nr(8)
+      .mr(1)
+      .nr(16)
       .kr(1)
       .sr(1)
-      .m(6)
-      .n(8)
+      .m(1)
+      .n(16)
       .k(1)
       .qmax(128)
-      .Test(xnn_f32_gemm_minmax_ukernel_6x8__avx_broadcast, xnn_init_f32_minmax_avx_params);
+      .Test(xnn_f32_gemm_minmax_ukernel_1x16__fma3_broadcast, xnn_init_f32_minmax_avx_params);
   }
 
-  TEST(F32_GEMM_MINMAX_6X8__AVX_BROADCAST, strided_cm) {
-    TEST_REQUIRES_X86_AVX;
+  TEST(F32_GEMM_MINMAX_1X16__FMA3_BROADCAST, strided_cm) {
+    TEST_REQUIRES_X86_FMA3;
     GemmMicrokernelTester()
-      .mr(6)
-      .nr(8)
+      .mr(1)
+      .nr(16)
       .kr(1)
       .sr(1)
-      .m(6)
-      .n(8)
+      .m(1)
+      .n(16)
       .k(1)
-      .cm_stride(11)
-      .Test(xnn_f32_gemm_minmax_ukernel_6x8__avx_broadcast, xnn_init_f32_minmax_avx_params);
+      .cm_stride(19)
+      .Test(xnn_f32_gemm_minmax_ukernel_1x16__fma3_broadcast, xnn_init_f32_minmax_avx_params);
   }
 #endif  // XNN_ARCH_X86 || XNN_ARCH_X86_64
 
 
 #if XNN_ARCH_X86 || XNN_ARCH_X86_64
-  TEST(F32_GEMM_MINMAX_1X8__FMA3_BROADCAST, k_eq_1) {
+  TEST(F32_GEMM_MINMAX_1X16__FMA3_BROADCAST_ACC4, k_eq_4) {
     TEST_REQUIRES_X86_FMA3;
     GemmMicrokernelTester()
       .mr(1)
-      .nr(8)
+      .nr(16)
       .kr(1)
       .sr(1)
       .m(1)
-      .n(8)
-      .k(1)
-      .Test(xnn_f32_gemm_minmax_ukernel_1x8__fma3_broadcast, xnn_init_f32_minmax_avx_params);
+      .n(16)
+      .k(4)
+      .Test(xnn_f32_gemm_minmax_ukernel_1x16__fma3_broadcast_acc4, xnn_init_f32_minmax_avx_params);
   }
 
-  TEST(F32_GEMM_MINMAX_1X8__FMA3_BROADCAST, strided_cn) {
+  TEST(F32_GEMM_MINMAX_1X16__FMA3_BROADCAST_ACC4, strided_cn) {
     TEST_REQUIRES_X86_FMA3;
     GemmMicrokernelTester()
       .mr(1)
-      .nr(8)
+      .nr(16)
       .kr(1)
       .sr(1)
       .m(1)
-      .n(8)
-      .k(1)
-      .cn_stride(11)
-      .Test(xnn_f32_gemm_minmax_ukernel_1x8__fma3_broadcast, xnn_init_f32_minmax_avx_params);
+      .n(16)
+      .k(4)
+      .cn_stride(19)
+      .Test(xnn_f32_gemm_minmax_ukernel_1x16__fma3_broadcast_acc4, xnn_init_f32_minmax_avx_params);
   }
 
-  TEST(F32_GEMM_MINMAX_1X8__FMA3_BROADCAST, k_eq_1_strided_a) {
+  TEST(F32_GEMM_MINMAX_1X16__FMA3_BROADCAST_ACC4, k_eq_4_strided_a) {
     TEST_REQUIRES_X86_FMA3;
     GemmMicrokernelTester()
       .mr(1)
-      .nr(8)
+      .nr(16)
       .kr(1)
       .sr(1)
       .m(1)
-      .n(8)
-      .k(1)
-      .a_stride(3)
-      .Test(xnn_f32_gemm_minmax_ukernel_1x8__fma3_broadcast, xnn_init_f32_minmax_avx_params);
+      .n(16)
+      .k(4)
+      .a_stride(7)
+      .Test(xnn_f32_gemm_minmax_ukernel_1x16__fma3_broadcast_acc4, xnn_init_f32_minmax_avx_params);
   }
 
-  TEST(F32_GEMM_MINMAX_1X8__FMA3_BROADCAST, k_eq_1_subtile) {
+  TEST(F32_GEMM_MINMAX_1X16__FMA3_BROADCAST_ACC4, k_eq_4_subtile) {
     TEST_REQUIRES_X86_FMA3;
-    for (uint32_t n = 1; n <= 8; n++) {
+    for (uint32_t n = 1; n <= 16; n++) {
       for (uint32_t m = 1; m <= 1; m++) {
         GemmMicrokernelTester()
           .mr(1)
-          .nr(8)
+          .nr(16)
           .kr(1)
           .sr(1)
           .m(m)
           .n(n)
-          .k(1)
+          .k(4)
           .iterations(1)
-          .Test(xnn_f32_gemm_minmax_ukernel_1x8__fma3_broadcast, xnn_init_f32_minmax_avx_params);
+          .Test(xnn_f32_gemm_minmax_ukernel_1x16__fma3_broadcast_acc4, xnn_init_f32_minmax_avx_params);
+      }
+    }
+  }
+
+  TEST(F32_GEMM_MINMAX_1X16__FMA3_BROADCAST_ACC4, k_eq_4_subtile_m) {
+    TEST_REQUIRES_X86_FMA3;
+    for (uint32_t m = 1; m <= 1; m++) {
+      GemmMicrokernelTester()
+        .mr(1)
+        .nr(16)
+        .kr(1)
+        .sr(1)
+        .m(m)
+        .n(16)
+        .k(4)
+        .iterations(1)
+        .Test(xnn_f32_gemm_minmax_ukernel_1x16__fma3_broadcast_acc4, xnn_init_f32_minmax_avx_params);
+    }
+  }
+
+  TEST(F32_GEMM_MINMAX_1X16__FMA3_BROADCAST_ACC4, k_eq_4_subtile_n) {
+    TEST_REQUIRES_X86_FMA3;
+    for (uint32_t n = 1; n <= 16; n++) {
+      GemmMicrokernelTester()
+        .mr(1)
+        .nr(16)
+        .kr(1)
+        .sr(1)
+        .m(1)
+        .n(n)
+        .k(4)
+        .iterations(1)
+        .Test(xnn_f32_gemm_minmax_ukernel_1x16__fma3_broadcast_acc4, xnn_init_f32_minmax_avx_params);
+    }
+  }
+
+  TEST(F32_GEMM_MINMAX_1X16__FMA3_BROADCAST_ACC4, k_lt_4) {
+    TEST_REQUIRES_X86_FMA3;
+    for (size_t k = 1; k < 4; k++) {
+      GemmMicrokernelTester()
+        .mr(1)
+        .nr(16)
+        .kr(1)
+        .sr(1)
+        .m(1)
+        .n(16)
+        .k(k)
+        .Test(xnn_f32_gemm_minmax_ukernel_1x16__fma3_broadcast_acc4, xnn_init_f32_minmax_avx_params);
+    }
+  }
+
+  TEST(F32_GEMM_MINMAX_1X16__FMA3_BROADCAST_ACC4, k_lt_4_strided_a) {
+    TEST_REQUIRES_X86_FMA3;
+    for (size_t k = 1; k < 4; k++) {
+      GemmMicrokernelTester()
+        .mr(1)
+        .nr(16)
+        .kr(1)
+        .sr(1)
+        .m(1)
+        .n(16)
+        .k(k)
+        .a_stride(7)
+        .Test(xnn_f32_gemm_minmax_ukernel_1x16__fma3_broadcast_acc4, xnn_init_f32_minmax_avx_params);
+    }
+  }
+
+  TEST(F32_GEMM_MINMAX_1X16__FMA3_BROADCAST_ACC4, k_lt_4_subtile) {
+    TEST_REQUIRES_X86_FMA3;
+    for (size_t k = 1; k < 4; k++) {
+      for (uint32_t n = 1; n <= 16; n++) {
+        for (uint32_t m = 1; m <= 1; m++) {
+          GemmMicrokernelTester()
+            .mr(1)
+            .nr(16)
+            .kr(1)
+            .sr(1)
+            .m(m)
+            .n(n)
+            .k(k)
+            .iterations(1)
+            .Test(xnn_f32_gemm_minmax_ukernel_1x16__fma3_broadcast_acc4, xnn_init_f32_minmax_avx_params);
+        }
       }
     }
   }
 
-  TEST(F32_GEMM_MINMAX_1X8__FMA3_BROADCAST, k_eq_1_subtile_m) {
+  TEST(F32_GEMM_MINMAX_1X16__FMA3_BROADCAST_ACC4, k_gt_4) {
     TEST_REQUIRES_X86_FMA3;
-    for (uint32_t m = 1; m <= 1; m++) {
+    for (size_t k = 5; k < 8; k++) {
       GemmMicrokernelTester()
         .mr(1)
-        .nr(8)
+        .nr(16)
         .kr(1)
         .sr(1)
-        .m(m)
-        .n(8)
-        .k(1)
-        .iterations(1)
-        .Test(xnn_f32_gemm_minmax_ukernel_1x8__fma3_broadcast, xnn_init_f32_minmax_avx_params);
+        .m(1)
+        .n(16)
+        .k(k)
+        .Test(xnn_f32_gemm_minmax_ukernel_1x16__fma3_broadcast_acc4, xnn_init_f32_minmax_avx_params);
     }
   }
 
-  TEST(F32_GEMM_MINMAX_1X8__FMA3_BROADCAST, k_eq_1_subtile_n) {
+  TEST(F32_GEMM_MINMAX_1X16__FMA3_BROADCAST_ACC4, k_gt_4_strided_a) {
     TEST_REQUIRES_X86_FMA3;
-    for (uint32_t n = 1; n <= 8; n++) {
+    for (size_t k = 5; k < 8; k++) {
       GemmMicrokernelTester()
         .mr(1)
-        .nr(8)
+        .nr(16)
         .kr(1)
         .sr(1)
         .m(1)
-        .n(n)
-        .k(1)
-        .iterations(1)
-        .Test(xnn_f32_gemm_minmax_ukernel_1x8__fma3_broadcast, xnn_init_f32_minmax_avx_params);
+        .n(16)
+        .k(k)
+        .a_stride(11)
+        .Test(xnn_f32_gemm_minmax_ukernel_1x16__fma3_broadcast_acc4, xnn_init_f32_minmax_avx_params);
     }
   }
 
-  TEST(F32_GEMM_MINMAX_1X8__FMA3_BROADCAST, k_gt_1) {
+  TEST(F32_GEMM_MINMAX_1X16__FMA3_BROADCAST_ACC4, k_gt_4_subtile) {
     TEST_REQUIRES_X86_FMA3;
-    for (size_t k = 2; k < 10; k++) {
+    for (size_t k = 5; k < 8; k++) {
+      for (uint32_t n = 1; n <= 16; n++) {
+        for (uint32_t m = 1; m <= 1; m++) {
+          GemmMicrokernelTester()
+            .mr(1)
+            .nr(16)
+            .kr(1)
+            .sr(1)
+            .m(m)
+            .n(n)
+            .k(k)
+            .iterations(1)
+            .Test(xnn_f32_gemm_minmax_ukernel_1x16__fma3_broadcast_acc4, xnn_init_f32_minmax_avx_params);
+        }
+      }
+    }
+  }
+
+  TEST(F32_GEMM_MINMAX_1X16__FMA3_BROADCAST_ACC4, k_div_4) {
+    TEST_REQUIRES_X86_FMA3;
+    for (size_t k = 8; k <= 40; k += 4) {
       GemmMicrokernelTester()
         .mr(1)
-        .nr(8)
+        .nr(16)
         .kr(1)
         .sr(1)
         .m(1)
-        .n(8)
+        .n(16)
         .k(k)
-        .Test(xnn_f32_gemm_minmax_ukernel_1x8__fma3_broadcast, xnn_init_f32_minmax_avx_params);
+        .Test(xnn_f32_gemm_minmax_ukernel_1x16__fma3_broadcast_acc4, xnn_init_f32_minmax_avx_params);
     }
   }
 
-  TEST(F32_GEMM_MINMAX_1X8__FMA3_BROADCAST, k_gt_1_strided_a) {
+  TEST(F32_GEMM_MINMAX_1X16__FMA3_BROADCAST_ACC4, k_div_4_strided_a) {
     TEST_REQUIRES_X86_FMA3;
-    for (size_t k = 2; k < 10; k++) {
+    for (size_t k = 8; k <= 40; k += 4) {
       GemmMicrokernelTester()
         .mr(1)
-        .nr(8)
+        .nr(16)
         .kr(1)
         .sr(1)
         .m(1)
-        .n(8)
+        .n(16)
         .k(k)
-        .a_stride(11)
-        .Test(xnn_f32_gemm_minmax_ukernel_1x8__fma3_broadcast, xnn_init_f32_minmax_avx_params);
+        .a_stride(43)
+        .Test(xnn_f32_gemm_minmax_ukernel_1x16__fma3_broadcast_acc4, xnn_init_f32_minmax_avx_params);
     }
   }
 
-  TEST(F32_GEMM_MINMAX_1X8__FMA3_BROADCAST, k_gt_1_subtile) {
+  TEST(F32_GEMM_MINMAX_1X16__FMA3_BROADCAST_ACC4, k_div_4_subtile) {
     TEST_REQUIRES_X86_FMA3;
-    for (size_t k = 2; k < 10; k++) {
-      for (uint32_t n = 1; n <= 8; n++) {
+    for (size_t k = 8; k <= 40; k += 4) {
+      for (uint32_t n = 1; n <= 16; n++) {
         for (uint32_t m = 1; m <= 1; m++) {
           GemmMicrokernelTester()
             .mr(1)
-            .nr(8)
+            .nr(16)
             .kr(1)
             .sr(1)
             .m(m)
             .n(n)
             .k(k)
             .iterations(1)
-            .Test(xnn_f32_gemm_minmax_ukernel_1x8__fma3_broadcast, xnn_init_f32_minmax_avx_params);
+            .Test(xnn_f32_gemm_minmax_ukernel_1x16__fma3_broadcast_acc4, xnn_init_f32_minmax_avx_params);
         }
       }
     }
   }
 
-  TEST(F32_GEMM_MINMAX_1X8__FMA3_BROADCAST, n_gt_8) {
+  TEST(F32_GEMM_MINMAX_1X16__FMA3_BROADCAST_ACC4, n_gt_16) {
     TEST_REQUIRES_X86_FMA3;
-    for (uint32_t n = 9; n < 16; n++) {
-      for (size_t k = 1; k <= 5; k += 2) {
+    for (uint32_t n = 17; n < 32; n++) {
+      for (size_t k = 1; k <= 20; k += 5) {
         GemmMicrokernelTester()
           .mr(1)
-          .nr(8)
+          .nr(16)
           .kr(1)
           .sr(1)
           .m(1)
           .n(n)
           .k(k)
-          .Test(xnn_f32_gemm_minmax_ukernel_1x8__fma3_broadcast, xnn_init_f32_minmax_avx_params);
+          .Test(xnn_f32_gemm_minmax_ukernel_1x16__fma3_broadcast_acc4, xnn_init_f32_minmax_avx_params);
       }
     }
   }
 
-  TEST(F32_GEMM_MINMAX_1X8__FMA3_BROADCAST, n_gt_8_strided_cn) {
+  TEST(F32_GEMM_MINMAX_1X16__FMA3_BROADCAST_ACC4, n_gt_16_strided_cn) {
     TEST_REQUIRES_X86_FMA3;
-    for (uint32_t n = 9; n < 16; n++) {
-      for (size_t k = 1; k <= 5; k += 2) {
+    for (uint32_t n = 17; n < 32; n++) {
+      for (size_t k = 1; k <= 20; k += 5) {
         GemmMicrokernelTester()
           .mr(1)
-          .nr(8)
+          .nr(16)
           .kr(1)
           .sr(1)
           .m(1)
           .n(n)
           .k(k)
-          .cn_stride(11)
-          .Test(xnn_f32_gemm_minmax_ukernel_1x8__fma3_broadcast, xnn_init_f32_minmax_avx_params);
+          .cn_stride(19)
+          .Test(xnn_f32_gemm_minmax_ukernel_1x16__fma3_broadcast_acc4, xnn_init_f32_minmax_avx_params);
       }
     }
   }
 
-  TEST(F32_GEMM_MINMAX_1X8__FMA3_BROADCAST, n_gt_8_strided_a) {
+  TEST(F32_GEMM_MINMAX_1X16__FMA3_BROADCAST_ACC4, n_gt_16_strided_a) {
     TEST_REQUIRES_X86_FMA3;
-    for (uint32_t n = 9; n < 16; n++) {
-      for (size_t k = 1; k <= 5; k += 2) {
+    for (uint32_t n = 17; n < 32; n++) {
+      for (size_t k = 1; k <= 20; k += 5) {
         GemmMicrokernelTester()
           .mr(1)
-          .nr(8)
+          .nr(16)
           .kr(1)
           .sr(1)
           .m(1)
           .n(n)
           .k(k)
-          .a_stride(7)
-          .Test(xnn_f32_gemm_minmax_ukernel_1x8__fma3_broadcast, xnn_init_f32_minmax_avx_params);
+          .a_stride(23)
+          .Test(xnn_f32_gemm_minmax_ukernel_1x16__fma3_broadcast_acc4, xnn_init_f32_minmax_avx_params);
       }
     }
   }
 
-  TEST(F32_GEMM_MINMAX_1X8__FMA3_BROADCAST, n_gt_8_subtile) {
+  TEST(F32_GEMM_MINMAX_1X16__FMA3_BROADCAST_ACC4, n_gt_16_subtile) {
     TEST_REQUIRES_X86_FMA3;
-    for (uint32_t n = 9; n < 16; n++) {
-      for (size_t k = 1; k <= 5; k += 2) {
+    for (uint32_t n = 17; n < 32; n++) {
+      for (size_t k = 1; k <= 20; k += 5) {
         for (uint32_t m = 1; m <= 1; m++) {
           GemmMicrokernelTester()
             .mr(1)
-            .nr(8)
+            .nr(16)
             .kr(1)
             .sr(1)
             .m(m)
             .n(n)
             .k(k)
             .iterations(1)
-            .Test(xnn_f32_gemm_minmax_ukernel_1x8__fma3_broadcast, xnn_init_f32_minmax_avx_params);
+            .Test(xnn_f32_gemm_minmax_ukernel_1x16__fma3_broadcast_acc4, xnn_init_f32_minmax_avx_params);
         }
       }
     }
   }
 
-  TEST(F32_GEMM_MINMAX_1X8__FMA3_BROADCAST, n_div_8) {
+  TEST(F32_GEMM_MINMAX_1X16__FMA3_BROADCAST_ACC4, n_div_16) {
     TEST_REQUIRES_X86_FMA3;
-    for (uint32_t n = 16; n <= 24; n += 8) {
-      for (size_t k = 1; k <= 5; k += 2) {
+    for (uint32_t n = 32; n <= 48; n += 16) {
+      for (size_t k = 1; k <= 20; k += 5) {
         GemmMicrokernelTester()
           .mr(1)
-          .nr(8)
+          .nr(16)
           .kr(1)
           .sr(1)
           .m(1)
           .n(n)
           .k(k)
-          .Test(xnn_f32_gemm_minmax_ukernel_1x8__fma3_broadcast, xnn_init_f32_minmax_avx_params);
+          .Test(xnn_f32_gemm_minmax_ukernel_1x16__fma3_broadcast_acc4, xnn_init_f32_minmax_avx_params);
       }
     }
   }
 
-  TEST(F32_GEMM_MINMAX_1X8__FMA3_BROADCAST, n_div_8_strided_cn) {
+  TEST(F32_GEMM_MINMAX_1X16__FMA3_BROADCAST_ACC4, n_div_16_strided_cn) {
     TEST_REQUIRES_X86_FMA3;
-    for (uint32_t n = 16; n <= 24; n += 8) {
-      for (size_t k = 1; k <= 5; k += 2) {
+    for (uint32_t n = 32; n <= 48; n += 16) {
+      for (size_t k = 1; k <= 20; k += 5) {
         GemmMicrokernelTester()
           .mr(1)
-          .nr(8)
+          .nr(16)
           .kr(1)
           .sr(1)
           .m(1)
           .n(n)
           .k(k)
-          .cn_stride(11)
-          .Test(xnn_f32_gemm_minmax_ukernel_1x8__fma3_broadcast, xnn_init_f32_minmax_avx_params);
+          .cn_stride(19)
+          .Test(xnn_f32_gemm_minmax_ukernel_1x16__fma3_broadcast_acc4, xnn_init_f32_minmax_avx_params);
       }
     }
   }
 
-  TEST(F32_GEMM_MINMAX_1X8__FMA3_BROADCAST, n_div_8_strided_a) {
+  TEST(F32_GEMM_MINMAX_1X16__FMA3_BROADCAST_ACC4, n_div_16_strided_a) {
     TEST_REQUIRES_X86_FMA3;
-    for (uint32_t n = 16; n <= 24; n += 8) {
-      for (size_t k = 1; k <= 5; k += 2) {
+    for (uint32_t n = 32; n <= 48; n += 16) {
+      for (size_t k = 1; k <= 20; k += 5) {
         GemmMicrokernelTester()
           .mr(1)
-          .nr(8)
+          .nr(16)
           .kr(1)
           .sr(1)
           .m(1)
           .n(n)
           .k(k)
-          .a_stride(7)
-          .Test(xnn_f32_gemm_minmax_ukernel_1x8__fma3_broadcast, xnn_init_f32_minmax_avx_params);
+          .a_stride(23)
+          .Test(xnn_f32_gemm_minmax_ukernel_1x16__fma3_broadcast_acc4, xnn_init_f32_minmax_avx_params);
       }
     }
   }
 
-  TEST(F32_GEMM_MINMAX_1X8__FMA3_BROADCAST, n_div_8_subtile) {
+  TEST(F32_GEMM_MINMAX_1X16__FMA3_BROADCAST_ACC4, n_div_16_subtile) {
     TEST_REQUIRES_X86_FMA3;
-    for (uint32_t n = 16; n <= 24; n += 8) {
-      for (size_t k = 1; k <= 5; k += 2) {
+    for (uint32_t n = 32; n <= 48; n += 16) {
+      for (size_t k = 1; k <= 20; k += 5) {
         for (uint32_t m = 1; m <= 1; m++) {
           GemmMicrokernelTester()
             .mr(1)
-            .nr(8)
+            .nr(16)
             .kr(1)
             .sr(1)
             .m(m)
             .n(n)
             .k(k)
             .iterations(1)
-            .Test(xnn_f32_gemm_minmax_ukernel_1x8__fma3_broadcast, xnn_init_f32_minmax_avx_params);
+            .Test(xnn_f32_gemm_minmax_ukernel_1x16__fma3_broadcast_acc4, xnn_init_f32_minmax_avx_params);
         }
       }
     }
   }
 
-  TEST(F32_GEMM_MINMAX_1X8__FMA3_BROADCAST, strided_cm_subtile) {
+  TEST(F32_GEMM_MINMAX_1X16__FMA3_BROADCAST_ACC4, strided_cm_subtile) {
     TEST_REQUIRES_X86_FMA3;
-    for (size_t k = 1; k <= 5; k += 2) {
-      for (uint32_t n = 1; n <= 8; n++) {
+    for (size_t k = 1; k <= 20; k += 5) {
+      for (uint32_t n = 1; n <= 16; n++) {
         for (uint32_t m = 1; m <= 1; m++) {
           GemmMicrokernelTester()
             .mr(1)
-            .nr(8)
+            .nr(16)
             .kr(1)
             .sr(1)
             .m(m)
             .n(n)
             .k(k)
-            .cm_stride(11)
+            .cm_stride(19)
             .iterations(1)
-            .Test(xnn_f32_gemm_minmax_ukernel_1x8__fma3_broadcast, xnn_init_f32_minmax_avx_params);
+            .Test(xnn_f32_gemm_minmax_ukernel_1x16__fma3_broadcast_acc4, xnn_init_f32_minmax_avx_params);
         }
       }
     }
   }
 
-  TEST(F32_GEMM_MINMAX_1X8__FMA3_BROADCAST, qmin) {
+  TEST(F32_GEMM_MINMAX_1X16__FMA3_BROADCAST_ACC4, qmin) {
     TEST_REQUIRES_X86_FMA3;
     GemmMicrokernelTester()
       .mr(1)
-      .nr(8)
+      .nr(16)
       .kr(1)
       .sr(1)
       .m(1)
-      .n(8)
-      .k(1)
+      .n(16)
+      .k(4)
       .qmin(128)
-      .Test(xnn_f32_gemm_minmax_ukernel_1x8__fma3_broadcast, xnn_init_f32_minmax_avx_params);
+      .Test(xnn_f32_gemm_minmax_ukernel_1x16__fma3_broadcast_acc4, xnn_init_f32_minmax_avx_params);
   }
 
-  TEST(F32_GEMM_MINMAX_1X8__FMA3_BROADCAST, qmax) {
+  TEST(F32_GEMM_MINMAX_1X16__FMA3_BROADCAST_ACC4, qmax) {
     TEST_REQUIRES_X86_FMA3;
     GemmMicrokernelTester()
       .mr(1)
-      .nr(8)
+      .nr(16)
       .kr(1)
       .sr(1)
       .m(1)
-      .n(8)
-      .k(1)
+      .n(16)
+      .k(4)
       .qmax(128)
-      .Test(xnn_f32_gemm_minmax_ukernel_1x8__fma3_broadcast, xnn_init_f32_minmax_avx_params);
+      .Test(xnn_f32_gemm_minmax_ukernel_1x16__fma3_broadcast_acc4, xnn_init_f32_minmax_avx_params);
   }
 
-  TEST(F32_GEMM_MINMAX_1X8__FMA3_BROADCAST, strided_cm) {
+  TEST(F32_GEMM_MINMAX_1X16__FMA3_BROADCAST_ACC4, strided_cm) {
     TEST_REQUIRES_X86_FMA3;
     GemmMicrokernelTester()
       .mr(1)
-      .nr(8)
+      .nr(16)
       .kr(1)
       .sr(1)
       .m(1)
-      .n(8)
-      .k(1)
-      .cm_stride(11)
-      .Test(xnn_f32_gemm_minmax_ukernel_1x8__fma3_broadcast, xnn_init_f32_minmax_avx_params);
+      .n(16)
+      .k(4)
+      .cm_stride(19)
+      .Test(xnn_f32_gemm_minmax_ukernel_1x16__fma3_broadcast_acc4, xnn_init_f32_minmax_avx_params);
   }
 #endif  // XNN_ARCH_X86 || XNN_ARCH_X86_64
 
 
 #if XNN_ARCH_X86 || XNN_ARCH_X86_64
-  TEST(F32_GEMM_MINMAX_1X16__FMA3_BROADCAST, k_eq_1) {
+  TEST(F32_GEMM_MINMAX_3X16__FMA3_BROADCAST, k_eq_1) {
     TEST_REQUIRES_X86_FMA3;
     GemmMicrokernelTester()
-      .mr(1)
+      .mr(3)
       .nr(16)
       .kr(1)
       .sr(1)
-      .m(1)
+      .m(3)
       .n(16)
       .k(1)
-      .Test(xnn_f32_gemm_minmax_ukernel_1x16__fma3_broadcast, xnn_init_f32_minmax_avx_params);
+      .Test(xnn_f32_gemm_minmax_ukernel_3x16__fma3_broadcast, xnn_init_f32_minmax_avx_params);
   }
 
-  TEST(F32_GEMM_MINMAX_1X16__FMA3_BROADCAST, strided_cn) {
+  TEST(F32_GEMM_MINMAX_3X16__FMA3_BROADCAST, strided_cn) {
     TEST_REQUIRES_X86_FMA3;
     GemmMicrokernelTester()
-      .mr(1)
+      .mr(3)
       .nr(16)
       .kr(1)
       .sr(1)
-      .m(1)
+      .m(3)
       .n(16)
       .k(1)
       .cn_stride(19)
-      .Test(xnn_f32_gemm_minmax_ukernel_1x16__fma3_broadcast, xnn_init_f32_minmax_avx_params);
+      .Test(xnn_f32_gemm_minmax_ukernel_3x16__fma3_broadcast, xnn_init_f32_minmax_avx_params);
   }
 
-  TEST(F32_GEMM_MINMAX_1X16__FMA3_BROADCAST, k_eq_1_strided_a) {
+  TEST(F32_GEMM_MINMAX_3X16__FMA3_BROADCAST, k_eq_1_strided_a) {
     TEST_REQUIRES_X86_FMA3;
     GemmMicrokernelTester()
-      .mr(1)
+      .mr(3)
       .nr(16)
       .kr(1)
       .sr(1)
-      .m(1)
+      .m(3)
       .n(16)
       .k(1)
       .a_stride(3)
-      .Test(xnn_f32_gemm_minmax_ukernel_1x16__fma3_broadcast, xnn_init_f32_minmax_avx_params);
+      .Test(xnn_f32_gemm_minmax_ukernel_3x16__fma3_broadcast, xnn_init_f32_minmax_avx_params);
   }
 
-  TEST(F32_GEMM_MINMAX_1X16__FMA3_BROADCAST, k_eq_1_subtile) {
+  TEST(F32_GEMM_MINMAX_3X16__FMA3_BROADCAST, k_eq_1_subtile) {
     TEST_REQUIRES_X86_FMA3;
     for (uint32_t n = 1; n <= 16; n++) {
-      for (uint32_t m = 1; m <= 1; m++) {
+      for (uint32_t m = 1; m <= 3; m++) {
         GemmMicrokernelTester()
-          .mr(1)
+          .mr(3)
           .nr(16)
           .kr(1)
           .sr(1)
@@ -18909,16 +20631,16 @@
           .n(n)
           .k(1)
           .iterations(1)
-          .Test(xnn_f32_gemm_minmax_ukernel_1x16__fma3_broadcast, xnn_init_f32_minmax_avx_params);
+          .Test(xnn_f32_gemm_minmax_ukernel_3x16__fma3_broadcast, xnn_init_f32_minmax_avx_params);
       }
     }
   }
 
-  TEST(F32_GEMM_MINMAX_1X16__FMA3_BROADCAST, k_eq_1_subtile_m) {
+  TEST(F32_GEMM_MINMAX_3X16__FMA3_BROADCAST, k_eq_1_subtile_m) {
     TEST_REQUIRES_X86_FMA3;
-    for (uint32_t m = 1; m <= 1; m++) {
+    for (uint32_t m = 1; m <= 3; m++) {
       GemmMicrokernelTester()
-        .mr(1)
+        .mr(3)
         .nr(16)
         .kr(1)
         .sr(1)
@@ -18926,64 +20648,64 @@
         .n(16)
         .k(1)
         .iterations(1)
-        .Test(xnn_f32_gemm_minmax_ukernel_1x16__fma3_broadcast, xnn_init_f32_minmax_avx_params);
+        .Test(xnn_f32_gemm_minmax_ukernel_3x16__fma3_broadcast, xnn_init_f32_minmax_avx_params);
     }
   }
 
-  TEST(F32_GEMM_MINMAX_1X16__FMA3_BROADCAST, k_eq_1_subtile_n) {
+  TEST(F32_GEMM_MINMAX_3X16__FMA3_BROADCAST, k_eq_1_subtile_n) {
     TEST_REQUIRES_X86_FMA3;
     for (uint32_t n = 1; n <= 16; n++) {
       GemmMicrokernelTester()
-        .mr(1)
+        .mr(3)
         .nr(16)
         .kr(1)
         .sr(1)
-        .m(1)
+        .m(3)
         .n(n)
         .k(1)
         .iterations(1)
-        .Test(xnn_f32_gemm_minmax_ukernel_1x16__fma3_broadcast, xnn_init_f32_minmax_avx_params);
+        .Test(xnn_f32_gemm_minmax_ukernel_3x16__fma3_broadcast, xnn_init_f32_minmax_avx_params);
     }
   }
 
-  TEST(F32_GEMM_MINMAX_1X16__FMA3_BROADCAST, k_gt_1) {
+  TEST(F32_GEMM_MINMAX_3X16__FMA3_BROADCAST, k_gt_1) {
     TEST_REQUIRES_X86_FMA3;
     for (size_t k = 2; k < 10; k++) {
       GemmMicrokernelTester()
-        .mr(1)
+        .mr(3)
         .nr(16)
         .kr(1)
         .sr(1)
-        .m(1)
+        .m(3)
         .n(16)
         .k(k)
-        .Test(xnn_f32_gemm_minmax_ukernel_1x16__fma3_broadcast, xnn_init_f32_minmax_avx_params);
+        .Test(xnn_f32_gemm_minmax_ukernel_3x16__fma3_broadcast, xnn_init_f32_minmax_avx_params);
     }
   }
 
-  TEST(F32_GEMM_MINMAX_1X16__FMA3_BROADCAST, k_gt_1_strided_a) {
+  TEST(F32_GEMM_MINMAX_3X16__FMA3_BROADCAST, k_gt_1_strided_a) {
     TEST_REQUIRES_X86_FMA3;
     for (size_t k = 2; k < 10; k++) {
       GemmMicrokernelTester()
-        .mr(1)
+        .mr(3)
         .nr(16)
         .kr(1)
         .sr(1)
-        .m(1)
+        .m(3)
         .n(16)
         .k(k)
         .a_stride(11)
-        .Test(xnn_f32_gemm_minmax_ukernel_1x16__fma3_broadcast, xnn_init_f32_minmax_avx_params);
+        .Test(xnn_f32_gemm_minmax_ukernel_3x16__fma3_broadcast, xnn_init_f32_minmax_avx_params);
     }
   }
 
-  TEST(F32_GEMM_MINMAX_1X16__FMA3_BROADCAST, k_gt_1_subtile) {
+  TEST(F32_GEMM_MINMAX_3X16__FMA3_BROADCAST, k_gt_1_subtile) {
     TEST_REQUIRES_X86_FMA3;
     for (size_t k = 2; k < 10; k++) {
       for (uint32_t n = 1; n <= 16; n++) {
-        for (uint32_t m = 1; m <= 1; m++) {
+        for (uint32_t m = 1; m <= 3; m++) {
           GemmMicrokernelTester()
-            .mr(1)
+            .mr(3)
             .nr(16)
             .kr(1)
             .sr(1)
@@ -18991,72 +20713,72 @@
             .n(n)
             .k(k)
             .iterations(1)
-            .Test(xnn_f32_gemm_minmax_ukernel_1x16__fma3_broadcast, xnn_init_f32_minmax_avx_params);
+            .Test(xnn_f32_gemm_minmax_ukernel_3x16__fma3_broadcast, xnn_init_f32_minmax_avx_params);
         }
       }
     }
   }
 
-  TEST(F32_GEMM_MINMAX_1X16__FMA3_BROADCAST, n_gt_16) {
+  TEST(F32_GEMM_MINMAX_3X16__FMA3_BROADCAST, n_gt_16) {
     TEST_REQUIRES_X86_FMA3;
     for (uint32_t n = 17; n < 32; n++) {
       for (size_t k = 1; k <= 5; k += 2) {
         GemmMicrokernelTester()
-          .mr(1)
+          .mr(3)
           .nr(16)
           .kr(1)
           .sr(1)
-          .m(1)
+          .m(3)
           .n(n)
           .k(k)
-          .Test(xnn_f32_gemm_minmax_ukernel_1x16__fma3_broadcast, xnn_init_f32_minmax_avx_params);
+          .Test(xnn_f32_gemm_minmax_ukernel_3x16__fma3_broadcast, xnn_init_f32_minmax_avx_params);
       }
     }
   }
 
-  TEST(F32_GEMM_MINMAX_1X16__FMA3_BROADCAST, n_gt_16_strided_cn) {
+  TEST(F32_GEMM_MINMAX_3X16__FMA3_BROADCAST, n_gt_16_strided_cn) {
     TEST_REQUIRES_X86_FMA3;
     for (uint32_t n = 17; n < 32; n++) {
       for (size_t k = 1; k <= 5; k += 2) {
         GemmMicrokernelTester()
-          .mr(1)
+          .mr(3)
           .nr(16)
           .kr(1)
           .sr(1)
-          .m(1)
+          .m(3)
           .n(n)
           .k(k)
           .cn_stride(19)
-          .Test(xnn_f32_gemm_minmax_ukernel_1x16__fma3_broadcast, xnn_init_f32_minmax_avx_params);
+          .Test(xnn_f32_gemm_minmax_ukernel_3x16__fma3_broadcast, xnn_init_f32_minmax_avx_params);
       }
     }
   }
 
-  TEST(F32_GEMM_MINMAX_1X16__FMA3_BROADCAST, n_gt_16_strided_a) {
+  TEST(F32_GEMM_MINMAX_3X16__FMA3_BROADCAST, n_gt_16_strided_a) {
     TEST_REQUIRES_X86_FMA3;
     for (uint32_t n = 17; n < 32; n++) {
       for (size_t k = 1; k <= 5; k += 2) {
         GemmMicrokernelTester()
-          .mr(1)
+          .mr(3)
           .nr(16)
           .kr(1)
           .sr(1)
-          .m(1)
+          .m(3)
           .n(n)
           .k(k)
           .a_stride(7)
-          .Test(xnn_f32_gemm_minmax_ukernel_1x16__fma3_broadcast, xnn_init_f32_minmax_avx_params);
+          .Test(xnn_f32_gemm_minmax_ukernel_3x16__fma3_broadcast, xnn_init_f32_minmax_avx_params);
       }
     }
   }
 
-  TEST(F32_GEMM_MINMAX_1X16__FMA3_BROADCAST, n_gt_16_subtile) {
+  TEST(F32_GEMM_MINMAX_3X16__FMA3_BROADCAST, n_gt_16_subtile) {
     TEST_REQUIRES_X86_FMA3;
     for (uint32_t n = 17; n < 32; n++) {
       for (size_t k = 1; k <= 5; k += 2) {
-        for (uint32_t m = 1; m <= 1; m++) {
+        for (uint32_t m = 1; m <= 3; m++) {
           GemmMicrokernelTester()
-            .mr(1)
+            .mr(3)
             .nr(16)
             .kr(1)
             .sr(1)
@@ -19064,72 +20786,72 @@
             .n(n)
             .k(k)
             .iterations(1)
-            .Test(xnn_f32_gemm_minmax_ukernel_1x16__fma3_broadcast, xnn_init_f32_minmax_avx_params);
+            .Test(xnn_f32_gemm_minmax_ukernel_3x16__fma3_broadcast, xnn_init_f32_minmax_avx_params);
         }
       }
     }
   }
 
-  TEST(F32_GEMM_MINMAX_1X16__FMA3_BROADCAST, n_div_16) {
+  TEST(F32_GEMM_MINMAX_3X16__FMA3_BROADCAST, n_div_16) {
     TEST_REQUIRES_X86_FMA3;
     for (uint32_t n = 32; n <= 48; n += 16) {
       for (size_t k = 1; k <= 5; k += 2) {
         GemmMicrokernelTester()
-          .mr(1)
+          .mr(3)
           .nr(16)
           .kr(1)
           .sr(1)
-          .m(1)
+          .m(3)
           .n(n)
           .k(k)
-          .Test(xnn_f32_gemm_minmax_ukernel_1x16__fma3_broadcast, xnn_init_f32_minmax_avx_params);
+          .Test(xnn_f32_gemm_minmax_ukernel_3x16__fma3_broadcast, xnn_init_f32_minmax_avx_params);
       }
     }
   }
 
-  TEST(F32_GEMM_MINMAX_1X16__FMA3_BROADCAST, n_div_16_strided_cn) {
+  TEST(F32_GEMM_MINMAX_3X16__FMA3_BROADCAST, n_div_16_strided_cn) {
     TEST_REQUIRES_X86_FMA3;
     for (uint32_t n = 32; n <= 48; n += 16) {
       for (size_t k = 1; k <= 5; k += 2) {
         GemmMicrokernelTester()
-          .mr(1)
+          .mr(3)
           .nr(16)
           .kr(1)
           .sr(1)
-          .m(1)
+          .m(3)
           .n(n)
           .k(k)
           .cn_stride(19)
-          .Test(xnn_f32_gemm_minmax_ukernel_1x16__fma3_broadcast, xnn_init_f32_minmax_avx_params);
+          .Test(xnn_f32_gemm_minmax_ukernel_3x16__fma3_broadcast, xnn_init_f32_minmax_avx_params);
       }
     }
   }
 
-  TEST(F32_GEMM_MINMAX_1X16__FMA3_BROADCAST, n_div_16_strided_a) {
+  TEST(F32_GEMM_MINMAX_3X16__FMA3_BROADCAST, n_div_16_strided_a) {
     TEST_REQUIRES_X86_FMA3;
     for (uint32_t n = 32; n <= 48; n += 16) {
       for (size_t k = 1; k <= 5; k += 2) {
         GemmMicrokernelTester()
-          .mr(1)
+          .mr(3)
           .nr(16)
           .kr(1)
           .sr(1)
-          .m(1)
+          .m(3)
           .n(n)
           .k(k)
           .a_stride(7)
-          .Test(xnn_f32_gemm_minmax_ukernel_1x16__fma3_broadcast, xnn_init_f32_minmax_avx_params);
+          .Test(xnn_f32_gemm_minmax_ukernel_3x16__fma3_broadcast, xnn_init_f32_minmax_avx_params);
       }
     }
   }
 
-  TEST(F32_GEMM_MINMAX_1X16__FMA3_BROADCAST, n_div_16_subtile) {
+  TEST(F32_GEMM_MINMAX_3X16__FMA3_BROADCAST, n_div_16_subtile) {
     TEST_REQUIRES_X86_FMA3;
     for (uint32_t n = 32; n <= 48; n += 16) {
       for (size_t k = 1; k <= 5; k += 2) {
-        for (uint32_t m = 1; m <= 1; m++) {
+        for (uint32_t m = 1; m <= 3; m++) {
           GemmMicrokernelTester()
-            .mr(1)
+            .mr(3)
             .nr(16)
             .kr(1)
             .sr(1)
@@ -19137,19 +20859,19 @@
             .n(n)
             .k(k)
             .iterations(1)
-            .Test(xnn_f32_gemm_minmax_ukernel_1x16__fma3_broadcast, xnn_init_f32_minmax_avx_params);
+            .Test(xnn_f32_gemm_minmax_ukernel_3x16__fma3_broadcast, xnn_init_f32_minmax_avx_params);
         }
       }
     }
   }
 
-  TEST(F32_GEMM_MINMAX_1X16__FMA3_BROADCAST, strided_cm_subtile) {
+  TEST(F32_GEMM_MINMAX_3X16__FMA3_BROADCAST, strided_cm_subtile) {
     TEST_REQUIRES_X86_FMA3;
     for (size_t k = 1; k <= 5; k += 2) {
       for (uint32_t n = 1; n <= 16; n++) {
-        for (uint32_t m = 1; m <= 1; m++) {
+        for (uint32_t m = 1; m <= 3; m++) {
           GemmMicrokernelTester()
-            .mr(1)
+            .mr(3)
             .nr(16)
             .kr(1)
             .sr(1)
@@ -19158,458 +20880,458 @@
             .k(k)
             .cm_stride(19)
             .iterations(1)
-            .Test(xnn_f32_gemm_minmax_ukernel_1x16__fma3_broadcast, xnn_init_f32_minmax_avx_params);
+            .Test(xnn_f32_gemm_minmax_ukernel_3x16__fma3_broadcast, xnn_init_f32_minmax_avx_params);
         }
       }
     }
   }
 
-  TEST(F32_GEMM_MINMAX_1X16__FMA3_BROADCAST, qmin) {
+  TEST(F32_GEMM_MINMAX_3X16__FMA3_BROADCAST, qmin) {
     TEST_REQUIRES_X86_FMA3;
     GemmMicrokernelTester()
-      .mr(1)
+      .mr(3)
       .nr(16)
       .kr(1)
       .sr(1)
-      .m(1)
+      .m(3)
       .n(16)
       .k(1)
       .qmin(128)
-      .Test(xnn_f32_gemm_minmax_ukernel_1x16__fma3_broadcast, xnn_init_f32_minmax_avx_params);
+      .Test(xnn_f32_gemm_minmax_ukernel_3x16__fma3_broadcast, xnn_init_f32_minmax_avx_params);
   }
 
-  TEST(F32_GEMM_MINMAX_1X16__FMA3_BROADCAST, qmax) {
+  TEST(F32_GEMM_MINMAX_3X16__FMA3_BROADCAST, qmax) {
     TEST_REQUIRES_X86_FMA3;
     GemmMicrokernelTester()
-      .mr(1)
+      .mr(3)
       .nr(16)
       .kr(1)
       .sr(1)
-      .m(1)
+      .m(3)
       .n(16)
       .k(1)
       .qmax(128)
-      .Test(xnn_f32_gemm_minmax_ukernel_1x16__fma3_broadcast, xnn_init_f32_minmax_avx_params);
+      .Test(xnn_f32_gemm_minmax_ukernel_3x16__fma3_broadcast, xnn_init_f32_minmax_avx_params);
   }
 
-  TEST(F32_GEMM_MINMAX_1X16__FMA3_BROADCAST, strided_cm) {
+  TEST(F32_GEMM_MINMAX_3X16__FMA3_BROADCAST, strided_cm) {
     TEST_REQUIRES_X86_FMA3;
     GemmMicrokernelTester()
-      .mr(1)
+      .mr(3)
       .nr(16)
       .kr(1)
       .sr(1)
-      .m(1)
+      .m(3)
       .n(16)
       .k(1)
       .cm_stride(19)
-      .Test(xnn_f32_gemm_minmax_ukernel_1x16__fma3_broadcast, xnn_init_f32_minmax_avx_params);
+      .Test(xnn_f32_gemm_minmax_ukernel_3x16__fma3_broadcast, xnn_init_f32_minmax_avx_params);
   }
 #endif  // XNN_ARCH_X86 || XNN_ARCH_X86_64
 
 
 #if XNN_ARCH_X86 || XNN_ARCH_X86_64
-  TEST(F32_GEMM_MINMAX_3X16__FMA3_BROADCAST, k_eq_1) {
+  TEST(F32_GEMM_MINMAX_4X8__FMA3_BROADCAST, k_eq_1) {
     TEST_REQUIRES_X86_FMA3;
     GemmMicrokernelTester()
-      .mr(3)
-      .nr(16)
+      .mr(4)
+      .nr(8)
       .kr(1)
       .sr(1)
-      .m(3)
-      .n(16)
+      .m(4)
+      .n(8)
       .k(1)
-      .Test(xnn_f32_gemm_minmax_ukernel_3x16__fma3_broadcast, xnn_init_f32_minmax_avx_params);
+      .Test(xnn_f32_gemm_minmax_ukernel_4x8__fma3_broadcast, xnn_init_f32_minmax_avx_params);
   }
 
-  TEST(F32_GEMM_MINMAX_3X16__FMA3_BROADCAST, strided_cn) {
+  TEST(F32_GEMM_MINMAX_4X8__FMA3_BROADCAST, strided_cn) {
     TEST_REQUIRES_X86_FMA3;
     GemmMicrokernelTester()
-      .mr(3)
-      .nr(16)
+      .mr(4)
+      .nr(8)
       .kr(1)
       .sr(1)
-      .m(3)
-      .n(16)
+      .m(4)
+      .n(8)
       .k(1)
-      .cn_stride(19)
-      .Test(xnn_f32_gemm_minmax_ukernel_3x16__fma3_broadcast, xnn_init_f32_minmax_avx_params);
+      .cn_stride(11)
+      .Test(xnn_f32_gemm_minmax_ukernel_4x8__fma3_broadcast, xnn_init_f32_minmax_avx_params);
   }
 
-  TEST(F32_GEMM_MINMAX_3X16__FMA3_BROADCAST, k_eq_1_strided_a) {
+  TEST(F32_GEMM_MINMAX_4X8__FMA3_BROADCAST, k_eq_1_strided_a) {
     TEST_REQUIRES_X86_FMA3;
     GemmMicrokernelTester()
-      .mr(3)
-      .nr(16)
+      .mr(4)
+      .nr(8)
       .kr(1)
       .sr(1)
-      .m(3)
-      .n(16)
+      .m(4)
+      .n(8)
       .k(1)
       .a_stride(3)
-      .Test(xnn_f32_gemm_minmax_ukernel_3x16__fma3_broadcast, xnn_init_f32_minmax_avx_params);
+      .Test(xnn_f32_gemm_minmax_ukernel_4x8__fma3_broadcast, xnn_init_f32_minmax_avx_params);
   }
 
-  TEST(F32_GEMM_MINMAX_3X16__FMA3_BROADCAST, k_eq_1_subtile) {
+  TEST(F32_GEMM_MINMAX_4X8__FMA3_BROADCAST, k_eq_1_subtile) {
     TEST_REQUIRES_X86_FMA3;
-    for (uint32_t n = 1; n <= 16; n++) {
-      for (uint32_t m = 1; m <= 3; m++) {
+    for (uint32_t n = 1; n <= 8; n++) {
+      for (uint32_t m = 1; m <= 4; m++) {
         GemmMicrokernelTester()
-          .mr(3)
-          .nr(16)
+          .mr(4)
+          .nr(8)
           .kr(1)
           .sr(1)
           .m(m)
           .n(n)
           .k(1)
           .iterations(1)
-          .Test(xnn_f32_gemm_minmax_ukernel_3x16__fma3_broadcast, xnn_init_f32_minmax_avx_params);
+          .Test(xnn_f32_gemm_minmax_ukernel_4x8__fma3_broadcast, xnn_init_f32_minmax_avx_params);
       }
     }
   }
 
-  TEST(F32_GEMM_MINMAX_3X16__FMA3_BROADCAST, k_eq_1_subtile_m) {
+  TEST(F32_GEMM_MINMAX_4X8__FMA3_BROADCAST, k_eq_1_subtile_m) {
     TEST_REQUIRES_X86_FMA3;
-    for (uint32_t m = 1; m <= 3; m++) {
+    for (uint32_t m = 1; m <= 4; m++) {
       GemmMicrokernelTester()
-        .mr(3)
-        .nr(16)
+        .mr(4)
+        .nr(8)
         .kr(1)
         .sr(1)
         .m(m)
-        .n(16)
+        .n(8)
         .k(1)
         .iterations(1)
-        .Test(xnn_f32_gemm_minmax_ukernel_3x16__fma3_broadcast, xnn_init_f32_minmax_avx_params);
+        .Test(xnn_f32_gemm_minmax_ukernel_4x8__fma3_broadcast, xnn_init_f32_minmax_avx_params);
     }
   }
 
-  TEST(F32_GEMM_MINMAX_3X16__FMA3_BROADCAST, k_eq_1_subtile_n) {
+  TEST(F32_GEMM_MINMAX_4X8__FMA3_BROADCAST, k_eq_1_subtile_n) {
     TEST_REQUIRES_X86_FMA3;
-    for (uint32_t n = 1; n <= 16; n++) {
+    for (uint32_t n = 1; n <= 8; n++) {
       GemmMicrokernelTester()
-        .mr(3)
-        .nr(16)
+        .mr(4)
+        .nr(8)
         .kr(1)
         .sr(1)
-        .m(3)
+        .m(4)
         .n(n)
         .k(1)
         .iterations(1)
-        .Test(xnn_f32_gemm_minmax_ukernel_3x16__fma3_broadcast, xnn_init_f32_minmax_avx_params);
+        .Test(xnn_f32_gemm_minmax_ukernel_4x8__fma3_broadcast, xnn_init_f32_minmax_avx_params);
     }
   }
 
-  TEST(F32_GEMM_MINMAX_3X16__FMA3_BROADCAST, k_gt_1) {
+  TEST(F32_GEMM_MINMAX_4X8__FMA3_BROADCAST, k_gt_1) {
     TEST_REQUIRES_X86_FMA3;
     for (size_t k = 2; k < 10; k++) {
       GemmMicrokernelTester()
-        .mr(3)
-        .nr(16)
+        .mr(4)
+        .nr(8)
         .kr(1)
         .sr(1)
-        .m(3)
-        .n(16)
+        .m(4)
+        .n(8)
         .k(k)
-        .Test(xnn_f32_gemm_minmax_ukernel_3x16__fma3_broadcast, xnn_init_f32_minmax_avx_params);
+        .Test(xnn_f32_gemm_minmax_ukernel_4x8__fma3_broadcast, xnn_init_f32_minmax_avx_params);
     }
   }
 
-  TEST(F32_GEMM_MINMAX_3X16__FMA3_BROADCAST, k_gt_1_strided_a) {
+  TEST(F32_GEMM_MINMAX_4X8__FMA3_BROADCAST, k_gt_1_strided_a) {
     TEST_REQUIRES_X86_FMA3;
     for (size_t k = 2; k < 10; k++) {
       GemmMicrokernelTester()
-        .mr(3)
-        .nr(16)
+        .mr(4)
+        .nr(8)
         .kr(1)
         .sr(1)
-        .m(3)
-        .n(16)
+        .m(4)
+        .n(8)
         .k(k)
         .a_stride(11)
-        .Test(xnn_f32_gemm_minmax_ukernel_3x16__fma3_broadcast, xnn_init_f32_minmax_avx_params);
+        .Test(xnn_f32_gemm_minmax_ukernel_4x8__fma3_broadcast, xnn_init_f32_minmax_avx_params);
     }
   }
 
-  TEST(F32_GEMM_MINMAX_3X16__FMA3_BROADCAST, k_gt_1_subtile) {
+  TEST(F32_GEMM_MINMAX_4X8__FMA3_BROADCAST, k_gt_1_subtile) {
     TEST_REQUIRES_X86_FMA3;
     for (size_t k = 2; k < 10; k++) {
-      for (uint32_t n = 1; n <= 16; n++) {
-        for (uint32_t m = 1; m <= 3; m++) {
+      for (uint32_t n = 1; n <= 8; n++) {
+        for (uint32_t m = 1; m <= 4; m++) {
           GemmMicrokernelTester()
-            .mr(3)
-            .nr(16)
+            .mr(4)
+            .nr(8)
             .kr(1)
             .sr(1)
             .m(m)
             .n(n)
             .k(k)
             .iterations(1)
-            .Test(xnn_f32_gemm_minmax_ukernel_3x16__fma3_broadcast, xnn_init_f32_minmax_avx_params);
+            .Test(xnn_f32_gemm_minmax_ukernel_4x8__fma3_broadcast, xnn_init_f32_minmax_avx_params);
         }
       }
     }
   }
 
-  TEST(F32_GEMM_MINMAX_3X16__FMA3_BROADCAST, n_gt_16) {
+  TEST(F32_GEMM_MINMAX_4X8__FMA3_BROADCAST, n_gt_8) {
     TEST_REQUIRES_X86_FMA3;
-    for (uint32_t n = 17; n < 32; n++) {
+    for (uint32_t n = 9; n < 16; n++) {
       for (size_t k = 1; k <= 5; k += 2) {
         GemmMicrokernelTester()
-          .mr(3)
-          .nr(16)
+          .mr(4)
+          .nr(8)
           .kr(1)
           .sr(1)
-          .m(3)
+          .m(4)
           .n(n)
           .k(k)
-          .Test(xnn_f32_gemm_minmax_ukernel_3x16__fma3_broadcast, xnn_init_f32_minmax_avx_params);
+          .Test(xnn_f32_gemm_minmax_ukernel_4x8__fma3_broadcast, xnn_init_f32_minmax_avx_params);
       }
     }
   }
 
-  TEST(F32_GEMM_MINMAX_3X16__FMA3_BROADCAST, n_gt_16_strided_cn) {
+  TEST(F32_GEMM_MINMAX_4X8__FMA3_BROADCAST, n_gt_8_strided_cn) {
     TEST_REQUIRES_X86_FMA3;
-    for (uint32_t n = 17; n < 32; n++) {
+    for (uint32_t n = 9; n < 16; n++) {
       for (size_t k = 1; k <= 5; k += 2) {
         GemmMicrokernelTester()
-          .mr(3)
-          .nr(16)
+          .mr(4)
+          .nr(8)
           .kr(1)
           .sr(1)
-          .m(3)
+          .m(4)
           .n(n)
           .k(k)
-          .cn_stride(19)
-          .Test(xnn_f32_gemm_minmax_ukernel_3x16__fma3_broadcast, xnn_init_f32_minmax_avx_params);
+          .cn_stride(11)
+          .Test(xnn_f32_gemm_minmax_ukernel_4x8__fma3_broadcast, xnn_init_f32_minmax_avx_params);
       }
     }
   }
 
-  TEST(F32_GEMM_MINMAX_3X16__FMA3_BROADCAST, n_gt_16_strided_a) {
+  TEST(F32_GEMM_MINMAX_4X8__FMA3_BROADCAST, n_gt_8_strided_a) {
     TEST_REQUIRES_X86_FMA3;
-    for (uint32_t n = 17; n < 32; n++) {
+    for (uint32_t n = 9; n < 16; n++) {
       for (size_t k = 1; k <= 5; k += 2) {
         GemmMicrokernelTester()
-          .mr(3)
-          .nr(16)
+          .mr(4)
+          .nr(8)
           .kr(1)
           .sr(1)
-          .m(3)
+          .m(4)
           .n(n)
           .k(k)
           .a_stride(7)
-          .Test(xnn_f32_gemm_minmax_ukernel_3x16__fma3_broadcast, xnn_init_f32_minmax_avx_params);
+          .Test(xnn_f32_gemm_minmax_ukernel_4x8__fma3_broadcast, xnn_init_f32_minmax_avx_params);
       }
     }
   }
 
-  TEST(F32_GEMM_MINMAX_3X16__FMA3_BROADCAST, n_gt_16_subtile) {
+  TEST(F32_GEMM_MINMAX_4X8__FMA3_BROADCAST, n_gt_8_subtile) {
     TEST_REQUIRES_X86_FMA3;
-    for (uint32_t n = 17; n < 32; n++) {
+    for (uint32_t n = 9; n < 16; n++) {
       for (size_t k = 1; k <= 5; k += 2) {
-        for (uint32_t m = 1; m <= 3; m++) {
+        for (uint32_t m = 1; m <= 4; m++) {
           GemmMicrokernelTester()
-            .mr(3)
-            .nr(16)
+            .mr(4)
+            .nr(8)
             .kr(1)
             .sr(1)
             .m(m)
             .n(n)
             .k(k)
             .iterations(1)
-            .Test(xnn_f32_gemm_minmax_ukernel_3x16__fma3_broadcast, xnn_init_f32_minmax_avx_params);
+            .Test(xnn_f32_gemm_minmax_ukernel_4x8__fma3_broadcast, xnn_init_f32_minmax_avx_params);
         }
       }
     }
   }
 
-  TEST(F32_GEMM_MINMAX_3X16__FMA3_BROADCAST, n_div_16) {
+  TEST(F32_GEMM_MINMAX_4X8__FMA3_BROADCAST, n_div_8) {
     TEST_REQUIRES_X86_FMA3;
-    for (uint32_t n = 32; n <= 48; n += 16) {
+    for (uint32_t n = 16; n <= 24; n += 8) {
       for (size_t k = 1; k <= 5; k += 2) {
         GemmMicrokernelTester()
-          .mr(3)
-          .nr(16)
+          .mr(4)
+          .nr(8)
           .kr(1)
           .sr(1)
-          .m(3)
+          .m(4)
           .n(n)
           .k(k)
-          .Test(xnn_f32_gemm_minmax_ukernel_3x16__fma3_broadcast, xnn_init_f32_minmax_avx_params);
+          .Test(xnn_f32_gemm_minmax_ukernel_4x8__fma3_broadcast, xnn_init_f32_minmax_avx_params);
       }
     }
   }
 
-  TEST(F32_GEMM_MINMAX_3X16__FMA3_BROADCAST, n_div_16_strided_cn) {
+  TEST(F32_GEMM_MINMAX_4X8__FMA3_BROADCAST, n_div_8_strided_cn) {
     TEST_REQUIRES_X86_FMA3;
-    for (uint32_t n = 32; n <= 48; n += 16) {
+    for (uint32_t n = 16; n <= 24; n += 8) {
       for (size_t k = 1; k <= 5; k += 2) {
         GemmMicrokernelTester()
-          .mr(3)
-          .nr(16)
+          .mr(4)
+          .nr(8)
           .kr(1)
           .sr(1)
-          .m(3)
+          .m(4)
           .n(n)
           .k(k)
-          .cn_stride(19)
-          .Test(xnn_f32_gemm_minmax_ukernel_3x16__fma3_broadcast, xnn_init_f32_minmax_avx_params);
+          .cn_stride(11)
+          .Test(xnn_f32_gemm_minmax_ukernel_4x8__fma3_broadcast, xnn_init_f32_minmax_avx_params);
       }
     }
   }
 
-  TEST(F32_GEMM_MINMAX_3X16__FMA3_BROADCAST, n_div_16_strided_a) {
+  TEST(F32_GEMM_MINMAX_4X8__FMA3_BROADCAST, n_div_8_strided_a) {
     TEST_REQUIRES_X86_FMA3;
-    for (uint32_t n = 32; n <= 48; n += 16) {
+    for (uint32_t n = 16; n <= 24; n += 8) {
       for (size_t k = 1; k <= 5; k += 2) {
         GemmMicrokernelTester()
-          .mr(3)
-          .nr(16)
+          .mr(4)
+          .nr(8)
           .kr(1)
           .sr(1)
-          .m(3)
+          .m(4)
           .n(n)
           .k(k)
           .a_stride(7)
-          .Test(xnn_f32_gemm_minmax_ukernel_3x16__fma3_broadcast, xnn_init_f32_minmax_avx_params);
+          .Test(xnn_f32_gemm_minmax_ukernel_4x8__fma3_broadcast, xnn_init_f32_minmax_avx_params);
       }
     }
   }
 
-  TEST(F32_GEMM_MINMAX_3X16__FMA3_BROADCAST, n_div_16_subtile) {
+  TEST(F32_GEMM_MINMAX_4X8__FMA3_BROADCAST, n_div_8_subtile) {
     TEST_REQUIRES_X86_FMA3;
-    for (uint32_t n = 32; n <= 48; n += 16) {
+    for (uint32_t n = 16; n <= 24; n += 8) {
       for (size_t k = 1; k <= 5; k += 2) {
-        for (uint32_t m = 1; m <= 3; m++) {
+        for (uint32_t m = 1; m <= 4; m++) {
           GemmMicrokernelTester()
-            .mr(3)
-            .nr(16)
+            .mr(4)
+            .nr(8)
             .kr(1)
             .sr(1)
             .m(m)
             .n(n)
             .k(k)
             .iterations(1)
-            .Test(xnn_f32_gemm_minmax_ukernel_3x16__fma3_broadcast, xnn_init_f32_minmax_avx_params);
+            .Test(xnn_f32_gemm_minmax_ukernel_4x8__fma3_broadcast, xnn_init_f32_minmax_avx_params);
         }
       }
     }
   }
 
-  TEST(F32_GEMM_MINMAX_3X16__FMA3_BROADCAST, strided_cm_subtile) {
+  TEST(F32_GEMM_MINMAX_4X8__FMA3_BROADCAST, strided_cm_subtile) {
     TEST_REQUIRES_X86_FMA3;
     for (size_t k = 1; k <= 5; k += 2) {
-      for (uint32_t n = 1; n <= 16; n++) {
-        for (uint32_t m = 1; m <= 3; m++) {
+      for (uint32_t n = 1; n <= 8; n++) {
+        for (uint32_t m = 1; m <= 4; m++) {
           GemmMicrokernelTester()
-            .mr(3)
-            .nr(16)
+            .mr(4)
+            .nr(8)
             .kr(1)
             .sr(1)
             .m(m)
             .n(n)
             .k(k)
-            .cm_stride(19)
+            .cm_stride(11)
             .iterations(1)
-            .Test(xnn_f32_gemm_minmax_ukernel_3x16__fma3_broadcast, xnn_init_f32_minmax_avx_params);
+            .Test(xnn_f32_gemm_minmax_ukernel_4x8__fma3_broadcast, xnn_init_f32_minmax_avx_params);
         }
       }
     }
   }
 
-  TEST(F32_GEMM_MINMAX_3X16__FMA3_BROADCAST, qmin) {
+  TEST(F32_GEMM_MINMAX_4X8__FMA3_BROADCAST, qmin) {
     TEST_REQUIRES_X86_FMA3;
     GemmMicrokernelTester()
-      .mr(3)
-      .nr(16)
+      .mr(4)
+      .nr(8)
       .kr(1)
       .sr(1)
-      .m(3)
-      .n(16)
+      .m(4)
+      .n(8)
       .k(1)
       .qmin(128)
-      .Test(xnn_f32_gemm_minmax_ukernel_3x16__fma3_broadcast, xnn_init_f32_minmax_avx_params);
+      .Test(xnn_f32_gemm_minmax_ukernel_4x8__fma3_broadcast, xnn_init_f32_minmax_avx_params);
   }
 
-  TEST(F32_GEMM_MINMAX_3X16__FMA3_BROADCAST, qmax) {
+  TEST(F32_GEMM_MINMAX_4X8__FMA3_BROADCAST, qmax) {
     TEST_REQUIRES_X86_FMA3;
     GemmMicrokernelTester()
-      .mr(3)
-      .nr(16)
+      .mr(4)
+      .nr(8)
       .kr(1)
       .sr(1)
-      .m(3)
-      .n(16)
+      .m(4)
+      .n(8)
       .k(1)
       .qmax(128)
-      .Test(xnn_f32_gemm_minmax_ukernel_3x16__fma3_broadcast, xnn_init_f32_minmax_avx_params);
+      .Test(xnn_f32_gemm_minmax_ukernel_4x8__fma3_broadcast, xnn_init_f32_minmax_avx_params);
   }
 
-  TEST(F32_GEMM_MINMAX_3X16__FMA3_BROADCAST, strided_cm) {
+  TEST(F32_GEMM_MINMAX_4X8__FMA3_BROADCAST, strided_cm) {
     TEST_REQUIRES_X86_FMA3;
     GemmMicrokernelTester()
-      .mr(3)
-      .nr(16)
+      .mr(4)
+      .nr(8)
       .kr(1)
       .sr(1)
-      .m(3)
-      .n(16)
+      .m(4)
+      .n(8)
       .k(1)
-      .cm_stride(19)
-      .Test(xnn_f32_gemm_minmax_ukernel_3x16__fma3_broadcast, xnn_init_f32_minmax_avx_params);
+      .cm_stride(11)
+      .Test(xnn_f32_gemm_minmax_ukernel_4x8__fma3_broadcast, xnn_init_f32_minmax_avx_params);
   }
 #endif  // XNN_ARCH_X86 || XNN_ARCH_X86_64
 
 
 #if XNN_ARCH_X86 || XNN_ARCH_X86_64
-  TEST(F32_GEMM_MINMAX_4X8__FMA3_BROADCAST, k_eq_1) {
+  TEST(F32_GEMM_MINMAX_5X8__FMA3_BROADCAST, k_eq_1) {
     TEST_REQUIRES_X86_FMA3;
     GemmMicrokernelTester()
-      .mr(4)
+      .mr(5)
       .nr(8)
       .kr(1)
       .sr(1)
-      .m(4)
+      .m(5)
       .n(8)
       .k(1)
-      .Test(xnn_f32_gemm_minmax_ukernel_4x8__fma3_broadcast, xnn_init_f32_minmax_avx_params);
+      .Test(xnn_f32_gemm_minmax_ukernel_5x8__fma3_broadcast, xnn_init_f32_minmax_avx_params);
   }
 
-  TEST(F32_GEMM_MINMAX_4X8__FMA3_BROADCAST, strided_cn) {
+  TEST(F32_GEMM_MINMAX_5X8__FMA3_BROADCAST, strided_cn) {
     TEST_REQUIRES_X86_FMA3;
     GemmMicrokernelTester()
-      .mr(4)
+      .mr(5)
       .nr(8)
       .kr(1)
       .sr(1)
-      .m(4)
+      .m(5)
       .n(8)
       .k(1)
       .cn_stride(11)
-      .Test(xnn_f32_gemm_minmax_ukernel_4x8__fma3_broadcast, xnn_init_f32_minmax_avx_params);
+      .Test(xnn_f32_gemm_minmax_ukernel_5x8__fma3_broadcast, xnn_init_f32_minmax_avx_params);
   }
 
-  TEST(F32_GEMM_MINMAX_4X8__FMA3_BROADCAST, k_eq_1_strided_a) {
+  TEST(F32_GEMM_MINMAX_5X8__FMA3_BROADCAST, k_eq_1_strided_a) {
     TEST_REQUIRES_X86_FMA3;
     GemmMicrokernelTester()
-      .mr(4)
+      .mr(5)
       .nr(8)
       .kr(1)
       .sr(1)
-      .m(4)
+      .m(5)
       .n(8)
       .k(1)
       .a_stride(3)
-      .Test(xnn_f32_gemm_minmax_ukernel_4x8__fma3_broadcast, xnn_init_f32_minmax_avx_params);
+      .Test(xnn_f32_gemm_minmax_ukernel_5x8__fma3_broadcast, xnn_init_f32_minmax_avx_params);
   }
 
-  TEST(F32_GEMM_MINMAX_4X8__FMA3_BROADCAST, k_eq_1_subtile) {
+  TEST(F32_GEMM_MINMAX_5X8__FMA3_BROADCAST, k_eq_1_subtile) {
     TEST_REQUIRES_X86_FMA3;
     for (uint32_t n = 1; n <= 8; n++) {
-      for (uint32_t m = 1; m <= 4; m++) {
+      for (uint32_t m = 1; m <= 5; m++) {
         GemmMicrokernelTester()
-          .mr(4)
+          .mr(5)
           .nr(8)
           .kr(1)
           .sr(1)
@@ -19617,16 +21339,16 @@
           .n(n)
           .k(1)
           .iterations(1)
-          .Test(xnn_f32_gemm_minmax_ukernel_4x8__fma3_broadcast, xnn_init_f32_minmax_avx_params);
+          .Test(xnn_f32_gemm_minmax_ukernel_5x8__fma3_broadcast, xnn_init_f32_minmax_avx_params);
       }
     }
   }
 
-  TEST(F32_GEMM_MINMAX_4X8__FMA3_BROADCAST, k_eq_1_subtile_m) {
+  TEST(F32_GEMM_MINMAX_5X8__FMA3_BROADCAST, k_eq_1_subtile_m) {
     TEST_REQUIRES_X86_FMA3;
-    for (uint32_t m = 1; m <= 4; m++) {
+    for (uint32_t m = 1; m <= 5; m++) {
       GemmMicrokernelTester()
-        .mr(4)
+        .mr(5)
         .nr(8)
         .kr(1)
         .sr(1)
@@ -19634,64 +21356,64 @@
         .n(8)
         .k(1)
         .iterations(1)
-        .Test(xnn_f32_gemm_minmax_ukernel_4x8__fma3_broadcast, xnn_init_f32_minmax_avx_params);
+        .Test(xnn_f32_gemm_minmax_ukernel_5x8__fma3_broadcast, xnn_init_f32_minmax_avx_params);
     }
   }
 
-  TEST(F32_GEMM_MINMAX_4X8__FMA3_BROADCAST, k_eq_1_subtile_n) {
+  TEST(F32_GEMM_MINMAX_5X8__FMA3_BROADCAST, k_eq_1_subtile_n) {
     TEST_REQUIRES_X86_FMA3;
     for (uint32_t n = 1; n <= 8; n++) {
       GemmMicrokernelTester()
-        .mr(4)
+        .mr(5)
         .nr(8)
         .kr(1)
         .sr(1)
-        .m(4)
+        .m(5)
         .n(n)
         .k(1)
         .iterations(1)
-        .Test(xnn_f32_gemm_minmax_ukernel_4x8__fma3_broadcast, xnn_init_f32_minmax_avx_params);
+        .Test(xnn_f32_gemm_minmax_ukernel_5x8__fma3_broadcast, xnn_init_f32_minmax_avx_params);
     }
   }
 
-  TEST(F32_GEMM_MINMAX_4X8__FMA3_BROADCAST, k_gt_1) {
+  TEST(F32_GEMM_MINMAX_5X8__FMA3_BROADCAST, k_gt_1) {
     TEST_REQUIRES_X86_FMA3;
     for (size_t k = 2; k < 10; k++) {
       GemmMicrokernelTester()
-        .mr(4)
+        .mr(5)
         .nr(8)
         .kr(1)
         .sr(1)
-        .m(4)
+        .m(5)
         .n(8)
         .k(k)
-        .Test(xnn_f32_gemm_minmax_ukernel_4x8__fma3_broadcast, xnn_init_f32_minmax_avx_params);
+        .Test(xnn_f32_gemm_minmax_ukernel_5x8__fma3_broadcast, xnn_init_f32_minmax_avx_params);
     }
   }
 
-  TEST(F32_GEMM_MINMAX_4X8__FMA3_BROADCAST, k_gt_1_strided_a) {
+  TEST(F32_GEMM_MINMAX_5X8__FMA3_BROADCAST, k_gt_1_strided_a) {
     TEST_REQUIRES_X86_FMA3;
     for (size_t k = 2; k < 10; k++) {
       GemmMicrokernelTester()
-        .mr(4)
+        .mr(5)
         .nr(8)
         .kr(1)
         .sr(1)
-        .m(4)
+        .m(5)
         .n(8)
         .k(k)
         .a_stride(11)
-        .Test(xnn_f32_gemm_minmax_ukernel_4x8__fma3_broadcast, xnn_init_f32_minmax_avx_params);
+        .Test(xnn_f32_gemm_minmax_ukernel_5x8__fma3_broadcast, xnn_init_f32_minmax_avx_params);
     }
   }
 
-  TEST(F32_GEMM_MINMAX_4X8__FMA3_BROADCAST, k_gt_1_subtile) {
+  TEST(F32_GEMM_MINMAX_5X8__FMA3_BROADCAST, k_gt_1_subtile) {
     TEST_REQUIRES_X86_FMA3;
     for (size_t k = 2; k < 10; k++) {
       for (uint32_t n = 1; n <= 8; n++) {
-        for (uint32_t m = 1; m <= 4; m++) {
+        for (uint32_t m = 1; m <= 5; m++) {
           GemmMicrokernelTester()
-            .mr(4)
+            .mr(5)
             .nr(8)
             .kr(1)
             .sr(1)
@@ -19699,72 +21421,72 @@
             .n(n)
             .k(k)
             .iterations(1)
-            .Test(xnn_f32_gemm_minmax_ukernel_4x8__fma3_broadcast, xnn_init_f32_minmax_avx_params);
+            .Test(xnn_f32_gemm_minmax_ukernel_5x8__fma3_broadcast, xnn_init_f32_minmax_avx_params);
         }
       }
     }
   }
 
-  TEST(F32_GEMM_MINMAX_4X8__FMA3_BROADCAST, n_gt_8) {
+  TEST(F32_GEMM_MINMAX_5X8__FMA3_BROADCAST, n_gt_8) {
     TEST_REQUIRES_X86_FMA3;
     for (uint32_t n = 9; n < 16; n++) {
       for (size_t k = 1; k <= 5; k += 2) {
         GemmMicrokernelTester()
-          .mr(4)
+          .mr(5)
           .nr(8)
           .kr(1)
           .sr(1)
-          .m(4)
+          .m(5)
           .n(n)
           .k(k)
-          .Test(xnn_f32_gemm_minmax_ukernel_4x8__fma3_broadcast, xnn_init_f32_minmax_avx_params);
+          .Test(xnn_f32_gemm_minmax_ukernel_5x8__fma3_broadcast, xnn_init_f32_minmax_avx_params);
       }
     }
   }
 
-  TEST(F32_GEMM_MINMAX_4X8__FMA3_BROADCAST, n_gt_8_strided_cn) {
+  TEST(F32_GEMM_MINMAX_5X8__FMA3_BROADCAST, n_gt_8_strided_cn) {
     TEST_REQUIRES_X86_FMA3;
     for (uint32_t n = 9; n < 16; n++) {
       for (size_t k = 1; k <= 5; k += 2) {
         GemmMicrokernelTester()
-          .mr(4)
+          .mr(5)
           .nr(8)
           .kr(1)
           .sr(1)
-          .m(4)
+          .m(5)
           .n(n)
           .k(k)
           .cn_stride(11)
-          .Test(xnn_f32_gemm_minmax_ukernel_4x8__fma3_broadcast, xnn_init_f32_minmax_avx_params);
+          .Test(xnn_f32_gemm_minmax_ukernel_5x8__fma3_broadcast, xnn_init_f32_minmax_avx_params);
       }
     }
   }
 
-  TEST(F32_GEMM_MINMAX_4X8__FMA3_BROADCAST, n_gt_8_strided_a) {
+  TEST(F32_GEMM_MINMAX_5X8__FMA3_BROADCAST, n_gt_8_strided_a) {
     TEST_REQUIRES_X86_FMA3;
     for (uint32_t n = 9; n < 16; n++) {
       for (size_t k = 1; k <= 5; k += 2) {
         GemmMicrokernelTester()
-          .mr(4)
+          .mr(5)
           .nr(8)
           .kr(1)
           .sr(1)
-          .m(4)
+          .m(5)
           .n(n)
           .k(k)
           .a_stride(7)
-          .Test(xnn_f32_gemm_minmax_ukernel_4x8__fma3_broadcast, xnn_init_f32_minmax_avx_params);
+          .Test(xnn_f32_gemm_minmax_ukernel_5x8__fma3_broadcast, xnn_init_f32_minmax_avx_params);
       }
     }
   }
 
-  TEST(F32_GEMM_MINMAX_4X8__FMA3_BROADCAST, n_gt_8_subtile) {
+  TEST(F32_GEMM_MINMAX_5X8__FMA3_BROADCAST, n_gt_8_subtile) {
     TEST_REQUIRES_X86_FMA3;
     for (uint32_t n = 9; n < 16; n++) {
       for (size_t k = 1; k <= 5; k += 2) {
-        for (uint32_t m = 1; m <= 4; m++) {
+        for (uint32_t m = 1; m <= 5; m++) {
           GemmMicrokernelTester()
-            .mr(4)
+            .mr(5)
             .nr(8)
             .kr(1)
             .sr(1)
@@ -19772,72 +21494,72 @@
             .n(n)
             .k(k)
             .iterations(1)
-            .Test(xnn_f32_gemm_minmax_ukernel_4x8__fma3_broadcast, xnn_init_f32_minmax_avx_params);
+            .Test(xnn_f32_gemm_minmax_ukernel_5x8__fma3_broadcast, xnn_init_f32_minmax_avx_params);
         }
       }
     }
   }
 
-  TEST(F32_GEMM_MINMAX_4X8__FMA3_BROADCAST, n_div_8) {
+  TEST(F32_GEMM_MINMAX_5X8__FMA3_BROADCAST, n_div_8) {
     TEST_REQUIRES_X86_FMA3;
     for (uint32_t n = 16; n <= 24; n += 8) {
       for (size_t k = 1; k <= 5; k += 2) {
         GemmMicrokernelTester()
-          .mr(4)
+          .mr(5)
           .nr(8)
           .kr(1)
           .sr(1)
-          .m(4)
+          .m(5)
           .n(n)
           .k(k)
-          .Test(xnn_f32_gemm_minmax_ukernel_4x8__fma3_broadcast, xnn_init_f32_minmax_avx_params);
+          .Test(xnn_f32_gemm_minmax_ukernel_5x8__fma3_broadcast, xnn_init_f32_minmax_avx_params);
       }
     }
   }
 
-  TEST(F32_GEMM_MINMAX_4X8__FMA3_BROADCAST, n_div_8_strided_cn) {
+  TEST(F32_GEMM_MINMAX_5X8__FMA3_BROADCAST, n_div_8_strided_cn) {
     TEST_REQUIRES_X86_FMA3;
     for (uint32_t n = 16; n <= 24; n += 8) {
       for (size_t k = 1; k <= 5; k += 2) {
         GemmMicrokernelTester()
-          .mr(4)
+          .mr(5)
           .nr(8)
           .kr(1)
           .sr(1)
-          .m(4)
+          .m(5)
           .n(n)
           .k(k)
           .cn_stride(11)
-          .Test(xnn_f32_gemm_minmax_ukernel_4x8__fma3_broadcast, xnn_init_f32_minmax_avx_params);
+          .Test(xnn_f32_gemm_minmax_ukernel_5x8__fma3_broadcast, xnn_init_f32_minmax_avx_params);
       }
     }
   }
 
-  TEST(F32_GEMM_MINMAX_4X8__FMA3_BROADCAST, n_div_8_strided_a) {
+  TEST(F32_GEMM_MINMAX_5X8__FMA3_BROADCAST, n_div_8_strided_a) {
     TEST_REQUIRES_X86_FMA3;
     for (uint32_t n = 16; n <= 24; n += 8) {
       for (size_t k = 1; k <= 5; k += 2) {
         GemmMicrokernelTester()
-          .mr(4)
+          .mr(5)
           .nr(8)
           .kr(1)
           .sr(1)
-          .m(4)
+          .m(5)
           .n(n)
           .k(k)
           .a_stride(7)
-          .Test(xnn_f32_gemm_minmax_ukernel_4x8__fma3_broadcast, xnn_init_f32_minmax_avx_params);
+          .Test(xnn_f32_gemm_minmax_ukernel_5x8__fma3_broadcast, xnn_init_f32_minmax_avx_params);
       }
     }
   }
 
-  TEST(F32_GEMM_MINMAX_4X8__FMA3_BROADCAST, n_div_8_subtile) {
+  TEST(F32_GEMM_MINMAX_5X8__FMA3_BROADCAST, n_div_8_subtile) {
     TEST_REQUIRES_X86_FMA3;
     for (uint32_t n = 16; n <= 24; n += 8) {
       for (size_t k = 1; k <= 5; k += 2) {
-        for (uint32_t m = 1; m <= 4; m++) {
+        for (uint32_t m = 1; m <= 5; m++) {
           GemmMicrokernelTester()
-            .mr(4)
+            .mr(5)
             .nr(8)
             .kr(1)
             .sr(1)
@@ -19845,19 +21567,19 @@
             .n(n)
             .k(k)
             .iterations(1)
-            .Test(xnn_f32_gemm_minmax_ukernel_4x8__fma3_broadcast, xnn_init_f32_minmax_avx_params);
+            .Test(xnn_f32_gemm_minmax_ukernel_5x8__fma3_broadcast, xnn_init_f32_minmax_avx_params);
         }
       }
     }
   }
 
-  TEST(F32_GEMM_MINMAX_4X8__FMA3_BROADCAST, strided_cm_subtile) {
+  TEST(F32_GEMM_MINMAX_5X8__FMA3_BROADCAST, strided_cm_subtile) {
     TEST_REQUIRES_X86_FMA3;
     for (size_t k = 1; k <= 5; k += 2) {
       for (uint32_t n = 1; n <= 8; n++) {
-        for (uint32_t m = 1; m <= 4; m++) {
+        for (uint32_t m = 1; m <= 5; m++) {
           GemmMicrokernelTester()
-            .mr(4)
+            .mr(5)
             .nr(8)
             .kr(1)
             .sr(1)
@@ -19866,412 +21588,412 @@
             .k(k)
             .cm_stride(11)
             .iterations(1)
-            .Test(xnn_f32_gemm_minmax_ukernel_4x8__fma3_broadcast, xnn_init_f32_minmax_avx_params);
+            .Test(xnn_f32_gemm_minmax_ukernel_5x8__fma3_broadcast, xnn_init_f32_minmax_avx_params);
         }
       }
     }
   }
 
-  TEST(F32_GEMM_MINMAX_4X8__FMA3_BROADCAST, qmin) {
+  TEST(F32_GEMM_MINMAX_5X8__FMA3_BROADCAST, qmin) {
     TEST_REQUIRES_X86_FMA3;
     GemmMicrokernelTester()
-      .mr(4)
+      .mr(5)
       .nr(8)
       .kr(1)
       .sr(1)
-      .m(4)
+      .m(5)
       .n(8)
       .k(1)
       .qmin(128)
-      .Test(xnn_f32_gemm_minmax_ukernel_4x8__fma3_broadcast, xnn_init_f32_minmax_avx_params);
+      .Test(xnn_f32_gemm_minmax_ukernel_5x8__fma3_broadcast, xnn_init_f32_minmax_avx_params);
   }
 
-  TEST(F32_GEMM_MINMAX_4X8__FMA3_BROADCAST, qmax) {
+  TEST(F32_GEMM_MINMAX_5X8__FMA3_BROADCAST, qmax) {
     TEST_REQUIRES_X86_FMA3;
     GemmMicrokernelTester()
-      .mr(4)
+      .mr(5)
       .nr(8)
       .kr(1)
       .sr(1)
-      .m(4)
+      .m(5)
       .n(8)
       .k(1)
       .qmax(128)
-      .Test(xnn_f32_gemm_minmax_ukernel_4x8__fma3_broadcast, xnn_init_f32_minmax_avx_params);
+      .Test(xnn_f32_gemm_minmax_ukernel_5x8__fma3_broadcast, xnn_init_f32_minmax_avx_params);
   }
 
-  TEST(F32_GEMM_MINMAX_4X8__FMA3_BROADCAST, strided_cm) {
+  TEST(F32_GEMM_MINMAX_5X8__FMA3_BROADCAST, strided_cm) {
     TEST_REQUIRES_X86_FMA3;
     GemmMicrokernelTester()
-      .mr(4)
+      .mr(5)
       .nr(8)
       .kr(1)
       .sr(1)
-      .m(4)
+      .m(5)
       .n(8)
       .k(1)
       .cm_stride(11)
-      .Test(xnn_f32_gemm_minmax_ukernel_4x8__fma3_broadcast, xnn_init_f32_minmax_avx_params);
+      .Test(xnn_f32_gemm_minmax_ukernel_5x8__fma3_broadcast, xnn_init_f32_minmax_avx_params);
   }
 #endif  // XNN_ARCH_X86 || XNN_ARCH_X86_64
 
 
 #if XNN_ARCH_X86 || XNN_ARCH_X86_64
-  TEST(F32_GEMM_MINMAX_5X8__FMA3_BROADCAST, k_eq_1) {
-    TEST_REQUIRES_X86_FMA3;
+  TEST(F32_GEMM_MINMAX_1X16__AVX512F_BROADCAST, k_eq_1) {
+    TEST_REQUIRES_X86_AVX512F;
     GemmMicrokernelTester()
-      .mr(5)
-      .nr(8)
+      .mr(1)
+      .nr(16)
       .kr(1)
       .sr(1)
-      .m(5)
-      .n(8)
+      .m(1)
+      .n(16)
       .k(1)
-      .Test(xnn_f32_gemm_minmax_ukernel_5x8__fma3_broadcast, xnn_init_f32_minmax_avx_params);
+      .Test(xnn_f32_gemm_minmax_ukernel_1x16__avx512f_broadcast, xnn_init_f32_minmax_scalar_params);
   }
 
-  TEST(F32_GEMM_MINMAX_5X8__FMA3_BROADCAST, strided_cn) {
-    TEST_REQUIRES_X86_FMA3;
+  TEST(F32_GEMM_MINMAX_1X16__AVX512F_BROADCAST, strided_cn) {
+    TEST_REQUIRES_X86_AVX512F;
     GemmMicrokernelTester()
-      .mr(5)
-      .nr(8)
+      .mr(1)
+      .nr(16)
       .kr(1)
       .sr(1)
-      .m(5)
-      .n(8)
+      .m(1)
+      .n(16)
       .k(1)
-      .cn_stride(11)
-      .Test(xnn_f32_gemm_minmax_ukernel_5x8__fma3_broadcast, xnn_init_f32_minmax_avx_params);
+      .cn_stride(19)
+      .Test(xnn_f32_gemm_minmax_ukernel_1x16__avx512f_broadcast, xnn_init_f32_minmax_scalar_params);
   }
 
-  TEST(F32_GEMM_MINMAX_5X8__FMA3_BROADCAST, k_eq_1_strided_a) {
-    TEST_REQUIRES_X86_FMA3;
+  TEST(F32_GEMM_MINMAX_1X16__AVX512F_BROADCAST, k_eq_1_strided_a) {
+    TEST_REQUIRES_X86_AVX512F;
     GemmMicrokernelTester()
-      .mr(5)
-      .nr(8)
+      .mr(1)
+      .nr(16)
       .kr(1)
       .sr(1)
-      .m(5)
-      .n(8)
+      .m(1)
+      .n(16)
       .k(1)
       .a_stride(3)
-      .Test(xnn_f32_gemm_minmax_ukernel_5x8__fma3_broadcast, xnn_init_f32_minmax_avx_params);
+      .Test(xnn_f32_gemm_minmax_ukernel_1x16__avx512f_broadcast, xnn_init_f32_minmax_scalar_params);
   }
 
-  TEST(F32_GEMM_MINMAX_5X8__FMA3_BROADCAST, k_eq_1_subtile) {
-    TEST_REQUIRES_X86_FMA3;
-    for (uint32_t n = 1; n <= 8; n++) {
-      for (uint32_t m = 1; m <= 5; m++) {
+  TEST(F32_GEMM_MINMAX_1X16__AVX512F_BROADCAST, k_eq_1_subtile) {
+    TEST_REQUIRES_X86_AVX512F;
+    for (uint32_t n = 1; n <= 16; n++) {
+      for (uint32_t m = 1; m <= 1; m++) {
         GemmMicrokernelTester()
-          .mr(5)
-          .nr(8)
+          .mr(1)
+          .nr(16)
           .kr(1)
           .sr(1)
           .m(m)
           .n(n)
           .k(1)
           .iterations(1)
-          .Test(xnn_f32_gemm_minmax_ukernel_5x8__fma3_broadcast, xnn_init_f32_minmax_avx_params);
+          .Test(xnn_f32_gemm_minmax_ukernel_1x16__avx512f_broadcast, xnn_init_f32_minmax_scalar_params);
       }
     }
   }
 
-  TEST(F32_GEMM_MINMAX_5X8__FMA3_BROADCAST, k_eq_1_subtile_m) {
-    TEST_REQUIRES_X86_FMA3;
-    for (uint32_t m = 1; m <= 5; m++) {
+  TEST(F32_GEMM_MINMAX_1X16__AVX512F_BROADCAST, k_eq_1_subtile_m) {
+    TEST_REQUIRES_X86_AVX512F;
+    for (uint32_t m = 1; m <= 1; m++) {
       GemmMicrokernelTester()
-        .mr(5)
-        .nr(8)
+        .mr(1)
+        .nr(16)
         .kr(1)
         .sr(1)
         .m(m)
-        .n(8)
+        .n(16)
         .k(1)
         .iterations(1)
-        .Test(xnn_f32_gemm_minmax_ukernel_5x8__fma3_broadcast, xnn_init_f32_minmax_avx_params);
+        .Test(xnn_f32_gemm_minmax_ukernel_1x16__avx512f_broadcast, xnn_init_f32_minmax_scalar_params);
     }
   }
 
-  TEST(F32_GEMM_MINMAX_5X8__FMA3_BROADCAST, k_eq_1_subtile_n) {
-    TEST_REQUIRES_X86_FMA3;
-    for (uint32_t n = 1; n <= 8; n++) {
+  TEST(F32_GEMM_MINMAX_1X16__AVX512F_BROADCAST, k_eq_1_subtile_n) {
+    TEST_REQUIRES_X86_AVX512F;
+    for (uint32_t n = 1; n <= 16; n++) {
       GemmMicrokernelTester()
-        .mr(5)
-        .nr(8)
+        .mr(1)
+        .nr(16)
         .kr(1)
         .sr(1)
-        .m(5)
+        .m(1)
         .n(n)
         .k(1)
         .iterations(1)
-        .Test(xnn_f32_gemm_minmax_ukernel_5x8__fma3_broadcast, xnn_init_f32_minmax_avx_params);
+        .Test(xnn_f32_gemm_minmax_ukernel_1x16__avx512f_broadcast, xnn_init_f32_minmax_scalar_params);
     }
   }
 
-  TEST(F32_GEMM_MINMAX_5X8__FMA3_BROADCAST, k_gt_1) {
-    TEST_REQUIRES_X86_FMA3;
+  TEST(F32_GEMM_MINMAX_1X16__AVX512F_BROADCAST, k_gt_1) {
+    TEST_REQUIRES_X86_AVX512F;
     for (size_t k = 2; k < 10; k++) {
       GemmMicrokernelTester()
-        .mr(5)
-        .nr(8)
+        .mr(1)
+        .nr(16)
         .kr(1)
         .sr(1)
-        .m(5)
-        .n(8)
+        .m(1)
+        .n(16)
         .k(k)
-        .Test(xnn_f32_gemm_minmax_ukernel_5x8__fma3_broadcast, xnn_init_f32_minmax_avx_params);
+        .Test(xnn_f32_gemm_minmax_ukernel_1x16__avx512f_broadcast, xnn_init_f32_minmax_scalar_params);
     }
   }
 
-  TEST(F32_GEMM_MINMAX_5X8__FMA3_BROADCAST, k_gt_1_strided_a) {
-    TEST_REQUIRES_X86_FMA3;
+  TEST(F32_GEMM_MINMAX_1X16__AVX512F_BROADCAST, k_gt_1_strided_a) {
+    TEST_REQUIRES_X86_AVX512F;
     for (size_t k = 2; k < 10; k++) {
       GemmMicrokernelTester()
-        .mr(5)
-        .nr(8)
+        .mr(1)
+        .nr(16)
         .kr(1)
         .sr(1)
-        .m(5)
-        .n(8)
+        .m(1)
+        .n(16)
         .k(k)
         .a_stride(11)
-        .Test(xnn_f32_gemm_minmax_ukernel_5x8__fma3_broadcast, xnn_init_f32_minmax_avx_params);
+        .Test(xnn_f32_gemm_minmax_ukernel_1x16__avx512f_broadcast, xnn_init_f32_minmax_scalar_params);
     }
   }
 
-  TEST(F32_GEMM_MINMAX_5X8__FMA3_BROADCAST, k_gt_1_subtile) {
-    TEST_REQUIRES_X86_FMA3;
+  TEST(F32_GEMM_MINMAX_1X16__AVX512F_BROADCAST, k_gt_1_subtile) {
+    TEST_REQUIRES_X86_AVX512F;
     for (size_t k = 2; k < 10; k++) {
-      for (uint32_t n = 1; n <= 8; n++) {
-        for (uint32_t m = 1; m <= 5; m++) {
+      for (uint32_t n = 1; n <= 16; n++) {
+        for (uint32_t m = 1; m <= 1; m++) {
           GemmMicrokernelTester()
-            .mr(5)
-            .nr(8)
+            .mr(1)
+            .nr(16)
             .kr(1)
             .sr(1)
             .m(m)
             .n(n)
             .k(k)
             .iterations(1)
-            .Test(xnn_f32_gemm_minmax_ukernel_5x8__fma3_broadcast, xnn_init_f32_minmax_avx_params);
+            .Test(xnn_f32_gemm_minmax_ukernel_1x16__avx512f_broadcast, xnn_init_f32_minmax_scalar_params);
         }
       }
     }
   }
 
-  TEST(F32_GEMM_MINMAX_5X8__FMA3_BROADCAST, n_gt_8) {
-    TEST_REQUIRES_X86_FMA3;
-    for (uint32_t n = 9; n < 16; n++) {
+  TEST(F32_GEMM_MINMAX_1X16__AVX512F_BROADCAST, n_gt_16) {
+    TEST_REQUIRES_X86_AVX512F;
+    for (uint32_t n = 17; n < 32; n++) {
       for (size_t k = 1; k <= 5; k += 2) {
         GemmMicrokernelTester()
-          .mr(5)
-          .nr(8)
+          .mr(1)
+          .nr(16)
           .kr(1)
           .sr(1)
-          .m(5)
+          .m(1)
           .n(n)
           .k(k)
-          .Test(xnn_f32_gemm_minmax_ukernel_5x8__fma3_broadcast, xnn_init_f32_minmax_avx_params);
+          .Test(xnn_f32_gemm_minmax_ukernel_1x16__avx512f_broadcast, xnn_init_f32_minmax_scalar_params);
       }
     }
   }
 
-  TEST(F32_GEMM_MINMAX_5X8__FMA3_BROADCAST, n_gt_8_strided_cn) {
-    TEST_REQUIRES_X86_FMA3;
-    for (uint32_t n = 9; n < 16; n++) {
+  TEST(F32_GEMM_MINMAX_1X16__AVX512F_BROADCAST, n_gt_16_strided_cn) {
+    TEST_REQUIRES_X86_AVX512F;
+    for (uint32_t n = 17; n < 32; n++) {
       for (size_t k = 1; k <= 5; k += 2) {
         GemmMicrokernelTester()
-          .mr(5)
-          .nr(8)
+          .mr(1)
+          .nr(16)
           .kr(1)
           .sr(1)
-          .m(5)
+          .m(1)
           .n(n)
           .k(k)
-          .cn_stride(11)
-          .Test(xnn_f32_gemm_minmax_ukernel_5x8__fma3_broadcast, xnn_init_f32_minmax_avx_params);
+          .cn_stride(19)
+          .Test(xnn_f32_gemm_minmax_ukernel_1x16__avx512f_broadcast, xnn_init_f32_minmax_scalar_params);
       }
     }
   }
 
-  TEST(F32_GEMM_MINMAX_5X8__FMA3_BROADCAST, n_gt_8_strided_a) {
-    TEST_REQUIRES_X86_FMA3;
-    for (uint32_t n = 9; n < 16; n++) {
+  TEST(F32_GEMM_MINMAX_1X16__AVX512F_BROADCAST, n_gt_16_strided_a) {
+    TEST_REQUIRES_X86_AVX512F;
+    for (uint32_t n = 17; n < 32; n++) {
       for (size_t k = 1; k <= 5; k += 2) {
         GemmMicrokernelTester()
-          .mr(5)
-          .nr(8)
+          .mr(1)
+          .nr(16)
           .kr(1)
           .sr(1)
-          .m(5)
+          .m(1)
           .n(n)
           .k(k)
           .a_stride(7)
-          .Test(xnn_f32_gemm_minmax_ukernel_5x8__fma3_broadcast, xnn_init_f32_minmax_avx_params);
+          .Test(xnn_f32_gemm_minmax_ukernel_1x16__avx512f_broadcast, xnn_init_f32_minmax_scalar_params);
       }
     }
   }
 
-  TEST(F32_GEMM_MINMAX_5X8__FMA3_BROADCAST, n_gt_8_subtile) {
-    TEST_REQUIRES_X86_FMA3;
-    for (uint32_t n = 9; n < 16; n++) {
+  TEST(F32_GEMM_MINMAX_1X16__AVX512F_BROADCAST, n_gt_16_subtile) {
+    TEST_REQUIRES_X86_AVX512F;
+    for (uint32_t n = 17; n < 32; n++) {
       for (size_t k = 1; k <= 5; k += 2) {
-        for (uint32_t m = 1; m <= 5; m++) {
+        for (uint32_t m = 1; m <= 1; m++) {
           GemmMicrokernelTester()
-            .mr(5)
-            .nr(8)
+            .mr(1)
+            .nr(16)
             .kr(1)
             .sr(1)
             .m(m)
             .n(n)
             .k(k)
             .iterations(1)
-            .Test(xnn_f32_gemm_minmax_ukernel_5x8__fma3_broadcast, xnn_init_f32_minmax_avx_params);
+            .Test(xnn_f32_gemm_minmax_ukernel_1x16__avx512f_broadcast, xnn_init_f32_minmax_scalar_params);
         }
       }
     }
   }
 
-  TEST(F32_GEMM_MINMAX_5X8__FMA3_BROADCAST, n_div_8) {
-    TEST_REQUIRES_X86_FMA3;
-    for (uint32_t n = 16; n <= 24; n += 8) {
+  TEST(F32_GEMM_MINMAX_1X16__AVX512F_BROADCAST, n_div_16) {
+    TEST_REQUIRES_X86_AVX512F;
+    for (uint32_t n = 32; n <= 48; n += 16) {
       for (size_t k = 1; k <= 5; k += 2) {
         GemmMicrokernelTester()
-          .mr(5)
-          .nr(8)
+          .mr(1)
+          .nr(16)
           .kr(1)
           .sr(1)
-          .m(5)
+          .m(1)
           .n(n)
           .k(k)
-          .Test(xnn_f32_gemm_minmax_ukernel_5x8__fma3_broadcast, xnn_init_f32_minmax_avx_params);
+          .Test(xnn_f32_gemm_minmax_ukernel_1x16__avx512f_broadcast, xnn_init_f32_minmax_scalar_params);
       }
     }
   }
 
-  TEST(F32_GEMM_MINMAX_5X8__FMA3_BROADCAST, n_div_8_strided_cn) {
-    TEST_REQUIRES_X86_FMA3;
-    for (uint32_t n = 16; n <= 24; n += 8) {
+  TEST(F32_GEMM_MINMAX_1X16__AVX512F_BROADCAST, n_div_16_strided_cn) {
+    TEST_REQUIRES_X86_AVX512F;
+    for (uint32_t n = 32; n <= 48; n += 16) {
       for (size_t k = 1; k <= 5; k += 2) {
         GemmMicrokernelTester()
-          .mr(5)
-          .nr(8)
+          .mr(1)
+          .nr(16)
           .kr(1)
           .sr(1)
-          .m(5)
+          .m(1)
           .n(n)
           .k(k)
-          .cn_stride(11)
-          .Test(xnn_f32_gemm_minmax_ukernel_5x8__fma3_broadcast, xnn_init_f32_minmax_avx_params);
+          .cn_stride(19)
+          .Test(xnn_f32_gemm_minmax_ukernel_1x16__avx512f_broadcast, xnn_init_f32_minmax_scalar_params);
       }
     }
   }
 
-  TEST(F32_GEMM_MINMAX_5X8__FMA3_BROADCAST, n_div_8_strided_a) {
-    TEST_REQUIRES_X86_FMA3;
-    for (uint32_t n = 16; n <= 24; n += 8) {
+  TEST(F32_GEMM_MINMAX_1X16__AVX512F_BROADCAST, n_div_16_strided_a) {
+    TEST_REQUIRES_X86_AVX512F;
+    for (uint32_t n = 32; n <= 48; n += 16) {
       for (size_t k = 1; k <= 5; k += 2) {
         GemmMicrokernelTester()
-          .mr(5)
-          .nr(8)
+          .mr(1)
+          .nr(16)
           .kr(1)
           .sr(1)
-          .m(5)
+          .m(1)
           .n(n)
           .k(k)
           .a_stride(7)
-          .Test(xnn_f32_gemm_minmax_ukernel_5x8__fma3_broadcast, xnn_init_f32_minmax_avx_params);
+          .Test(xnn_f32_gemm_minmax_ukernel_1x16__avx512f_broadcast, xnn_init_f32_minmax_scalar_params);
       }
     }
   }
 
-  TEST(F32_GEMM_MINMAX_5X8__FMA3_BROADCAST, n_div_8_subtile) {
-    TEST_REQUIRES_X86_FMA3;
-    for (uint32_t n = 16; n <= 24; n += 8) {
+  TEST(F32_GEMM_MINMAX_1X16__AVX512F_BROADCAST, n_div_16_subtile) {
+    TEST_REQUIRES_X86_AVX512F;
+    for (uint32_t n = 32; n <= 48; n += 16) {
       for (size_t k = 1; k <= 5; k += 2) {
-        for (uint32_t m = 1; m <= 5; m++) {
+        for (uint32_t m = 1; m <= 1; m++) {
           GemmMicrokernelTester()
-            .mr(5)
-            .nr(8)
+            .mr(1)
+            .nr(16)
             .kr(1)
             .sr(1)
             .m(m)
             .n(n)
             .k(k)
             .iterations(1)
-            .Test(xnn_f32_gemm_minmax_ukernel_5x8__fma3_broadcast, xnn_init_f32_minmax_avx_params);
+            .Test(xnn_f32_gemm_minmax_ukernel_1x16__avx512f_broadcast, xnn_init_f32_minmax_scalar_params);
         }
       }
     }
   }
 
-  TEST(F32_GEMM_MINMAX_5X8__FMA3_BROADCAST, strided_cm_subtile) {
-    TEST_REQUIRES_X86_FMA3;
+  TEST(F32_GEMM_MINMAX_1X16__AVX512F_BROADCAST, strided_cm_subtile) {
+    TEST_REQUIRES_X86_AVX512F;
     for (size_t k = 1; k <= 5; k += 2) {
-      for (uint32_t n = 1; n <= 8; n++) {
-        for (uint32_t m = 1; m <= 5; m++) {
+      for (uint32_t n = 1; n <= 16; n++) {
+        for (uint32_t m = 1; m <= 1; m++) {
           GemmMicrokernelTester()
-            .mr(5)
-            .nr(8)
+            .mr(1)
+            .nr(16)
             .kr(1)
             .sr(1)
             .m(m)
             .n(n)
             .k(k)
-            .cm_stride(11)
+            .cm_stride(19)
             .iterations(1)
-            .Test(xnn_f32_gemm_minmax_ukernel_5x8__fma3_broadcast, xnn_init_f32_minmax_avx_params);
+            .Test(xnn_f32_gemm_minmax_ukernel_1x16__avx512f_broadcast, xnn_init_f32_minmax_scalar_params);
         }
       }
     }
   }
 
-  TEST(F32_GEMM_MINMAX_5X8__FMA3_BROADCAST, qmin) {
-    TEST_REQUIRES_X86_FMA3;
+  TEST(F32_GEMM_MINMAX_1X16__AVX512F_BROADCAST, qmin) {
+    TEST_REQUIRES_X86_AVX512F;
     GemmMicrokernelTester()
-      .mr(5)
-      .nr(8)
+      .mr(1)
+      .nr(16)
       .kr(1)
       .sr(1)
-      .m(5)
-      .n(8)
+      .m(1)
+      .n(16)
       .k(1)
       .qmin(128)
-      .Test(xnn_f32_gemm_minmax_ukernel_5x8__fma3_broadcast, xnn_init_f32_minmax_avx_params);
+      .Test(xnn_f32_gemm_minmax_ukernel_1x16__avx512f_broadcast, xnn_init_f32_minmax_scalar_params);
   }
 
-  TEST(F32_GEMM_MINMAX_5X8__FMA3_BROADCAST, qmax) {
-    TEST_REQUIRES_X86_FMA3;
+  TEST(F32_GEMM_MINMAX_1X16__AVX512F_BROADCAST, qmax) {
+    TEST_REQUIRES_X86_AVX512F;
     GemmMicrokernelTester()
-      .mr(5)
-      .nr(8)
+      .mr(1)
+      .nr(16)
       .kr(1)
       .sr(1)
-      .m(5)
-      .n(8)
+      .m(1)
+      .n(16)
       .k(1)
       .qmax(128)
-      .Test(xnn_f32_gemm_minmax_ukernel_5x8__fma3_broadcast, xnn_init_f32_minmax_avx_params);
+      .Test(xnn_f32_gemm_minmax_ukernel_1x16__avx512f_broadcast, xnn_init_f32_minmax_scalar_params);
   }
 
-  TEST(F32_GEMM_MINMAX_5X8__FMA3_BROADCAST, strided_cm) {
-    TEST_REQUIRES_X86_FMA3;
+  TEST(F32_GEMM_MINMAX_1X16__AVX512F_BROADCAST, strided_cm) {
+    TEST_REQUIRES_X86_AVX512F;
     GemmMicrokernelTester()
-      .mr(5)
-      .nr(8)
+      .mr(1)
+      .nr(16)
       .kr(1)
       .sr(1)
-      .m(5)
-      .n(8)
+      .m(1)
+      .n(16)
       .k(1)
-      .cm_stride(11)
-      .Test(xnn_f32_gemm_minmax_ukernel_5x8__fma3_broadcast, xnn_init_f32_minmax_avx_params);
+      .cm_stride(19)
+      .Test(xnn_f32_gemm_minmax_ukernel_1x16__avx512f_broadcast, xnn_init_f32_minmax_scalar_params);
   }
 #endif  // XNN_ARCH_X86 || XNN_ARCH_X86_64
 
 
 #if XNN_ARCH_X86 || XNN_ARCH_X86_64
-  TEST(F32_GEMM_MINMAX_1X16__AVX512F_BROADCAST, k_eq_1) {
+  TEST(F32_GEMM_MINMAX_1X16__AVX512F_BROADCAST_ACC4, k_eq_4) {
     TEST_REQUIRES_X86_AVX512F;
     GemmMicrokernelTester()
       .mr(1)
@@ -20280,11 +22002,11 @@
       .sr(1)
       .m(1)
       .n(16)
-      .k(1)
-      .Test(xnn_f32_gemm_minmax_ukernel_1x16__avx512f_broadcast, xnn_init_f32_minmax_scalar_params);
+      .k(4)
+      .Test(xnn_f32_gemm_minmax_ukernel_1x16__avx512f_broadcast_acc4, xnn_init_f32_minmax_scalar_params);
   }
 
-  TEST(F32_GEMM_MINMAX_1X16__AVX512F_BROADCAST, strided_cn) {
+  TEST(F32_GEMM_MINMAX_1X16__AVX512F_BROADCAST_ACC4, strided_cn) {
     TEST_REQUIRES_X86_AVX512F;
     GemmMicrokernelTester()
       .mr(1)
@@ -20293,12 +22015,12 @@
       .sr(1)
       .m(1)
       .n(16)
-      .k(1)
+      .k(4)
       .cn_stride(19)
-      .Test(xnn_f32_gemm_minmax_ukernel_1x16__avx512f_broadcast, xnn_init_f32_minmax_scalar_params);
+      .Test(xnn_f32_gemm_minmax_ukernel_1x16__avx512f_broadcast_acc4, xnn_init_f32_minmax_scalar_params);
   }
 
-  TEST(F32_GEMM_MINMAX_1X16__AVX512F_BROADCAST, k_eq_1_strided_a) {
+  TEST(F32_GEMM_MINMAX_1X16__AVX512F_BROADCAST_ACC4, k_eq_4_strided_a) {
     TEST_REQUIRES_X86_AVX512F;
     GemmMicrokernelTester()
       .mr(1)
@@ -20307,12 +22029,12 @@
       .sr(1)
       .m(1)
       .n(16)
-      .k(1)
-      .a_stride(3)
-      .Test(xnn_f32_gemm_minmax_ukernel_1x16__avx512f_broadcast, xnn_init_f32_minmax_scalar_params);
+      .k(4)
+      .a_stride(7)
+      .Test(xnn_f32_gemm_minmax_ukernel_1x16__avx512f_broadcast_acc4, xnn_init_f32_minmax_scalar_params);
   }
 
-  TEST(F32_GEMM_MINMAX_1X16__AVX512F_BROADCAST, k_eq_1_subtile) {
+  TEST(F32_GEMM_MINMAX_1X16__AVX512F_BROADCAST_ACC4, k_eq_4_subtile) {
     TEST_REQUIRES_X86_AVX512F;
     for (uint32_t n = 1; n <= 16; n++) {
       for (uint32_t m = 1; m <= 1; m++) {
@@ -20323,14 +22045,14 @@
           .sr(1)
           .m(m)
           .n(n)
-          .k(1)
+          .k(4)
           .iterations(1)
-          .Test(xnn_f32_gemm_minmax_ukernel_1x16__avx512f_broadcast, xnn_init_f32_minmax_scalar_params);
+          .Test(xnn_f32_gemm_minmax_ukernel_1x16__avx512f_broadcast_acc4, xnn_init_f32_minmax_scalar_params);
       }
     }
   }
 
-  TEST(F32_GEMM_MINMAX_1X16__AVX512F_BROADCAST, k_eq_1_subtile_m) {
+  TEST(F32_GEMM_MINMAX_1X16__AVX512F_BROADCAST_ACC4, k_eq_4_subtile_m) {
     TEST_REQUIRES_X86_AVX512F;
     for (uint32_t m = 1; m <= 1; m++) {
       GemmMicrokernelTester()
@@ -20340,13 +22062,13 @@
         .sr(1)
         .m(m)
         .n(16)
-        .k(1)
+        .k(4)
         .iterations(1)
-        .Test(xnn_f32_gemm_minmax_ukernel_1x16__avx512f_broadcast, xnn_init_f32_minmax_scalar_params);
+        .Test(xnn_f32_gemm_minmax_ukernel_1x16__avx512f_broadcast_acc4, xnn_init_f32_minmax_scalar_params);
     }
   }
 
-  TEST(F32_GEMM_MINMAX_1X16__AVX512F_BROADCAST, k_eq_1_subtile_n) {
+  TEST(F32_GEMM_MINMAX_1X16__AVX512F_BROADCAST_ACC4, k_eq_4_subtile_n) {
     TEST_REQUIRES_X86_AVX512F;
     for (uint32_t n = 1; n <= 16; n++) {
       GemmMicrokernelTester()
@@ -20356,15 +22078,15 @@
         .sr(1)
         .m(1)
         .n(n)
-        .k(1)
+        .k(4)
         .iterations(1)
-        .Test(xnn_f32_gemm_minmax_ukernel_1x16__avx512f_broadcast, xnn_init_f32_minmax_scalar_params);
+        .Test(xnn_f32_gemm_minmax_ukernel_1x16__avx512f_broadcast_acc4, xnn_init_f32_minmax_scalar_params);
     }
   }
 
-  TEST(F32_GEMM_MINMAX_1X16__AVX512F_BROADCAST, k_gt_1) {
+  TEST(F32_GEMM_MINMAX_1X16__AVX512F_BROADCAST_ACC4, k_lt_4) {
     TEST_REQUIRES_X86_AVX512F;
-    for (size_t k = 2; k < 10; k++) {
+    for (size_t k = 1; k < 4; k++) {
       GemmMicrokernelTester()
         .mr(1)
         .nr(16)
@@ -20373,13 +22095,64 @@
         .m(1)
         .n(16)
         .k(k)
-        .Test(xnn_f32_gemm_minmax_ukernel_1x16__avx512f_broadcast, xnn_init_f32_minmax_scalar_params);
+        .Test(xnn_f32_gemm_minmax_ukernel_1x16__avx512f_broadcast_acc4, xnn_init_f32_minmax_scalar_params);
     }
   }
 
-  TEST(F32_GEMM_MINMAX_1X16__AVX512F_BROADCAST, k_gt_1_strided_a) {
+  TEST(F32_GEMM_MINMAX_1X16__AVX512F_BROADCAST_ACC4, k_lt_4_strided_a) {
     TEST_REQUIRES_X86_AVX512F;
-    for (size_t k = 2; k < 10; k++) {
+    for (size_t k = 1; k < 4; k++) {
+      GemmMicrokernelTester()
+        .mr(1)
+        .nr(16)
+        .kr(1)
+        .sr(1)
+        .m(1)
+        .n(16)
+        .k(k)
+        .a_stride(7)
+        .Test(xnn_f32_gemm_minmax_ukernel_1x16__avx512f_broadcast_acc4, xnn_init_f32_minmax_scalar_params);
+    }
+  }
+
+  TEST(F32_GEMM_MINMAX_1X16__AVX512F_BROADCAST_ACC4, k_lt_4_subtile) {
+    TEST_REQUIRES_X86_AVX512F;
+    for (size_t k = 1; k < 4; k++) {
+      for (uint32_t n = 1; n <= 16; n++) {
+        for (uint32_t m = 1; m <= 1; m++) {
+          GemmMicrokernelTester()
+            .mr(1)
+            .nr(16)
+            .kr(1)
+            .sr(1)
+            .m(m)
+            .n(n)
+            .k(k)
+            .iterations(1)
+            .Test(xnn_f32_gemm_minmax_ukernel_1x16__avx512f_broadcast_acc4, xnn_init_f32_minmax_scalar_params);
+        }
+      }
+    }
+  }
+
+  TEST(F32_GEMM_MINMAX_1X16__AVX512F_BROADCAST_ACC4, k_gt_4) {
+    TEST_REQUIRES_X86_AVX512F;
+    for (size_t k = 5; k < 8; k++) {
+      GemmMicrokernelTester()
+        .mr(1)
+        .nr(16)
+        .kr(1)
+        .sr(1)
+        .m(1)
+        .n(16)
+        .k(k)
+        .Test(xnn_f32_gemm_minmax_ukernel_1x16__avx512f_broadcast_acc4, xnn_init_f32_minmax_scalar_params);
+    }
+  }
+
+  TEST(F32_GEMM_MINMAX_1X16__AVX512F_BROADCAST_ACC4, k_gt_4_strided_a) {
+    TEST_REQUIRES_X86_AVX512F;
+    for (size_t k = 5; k < 8; k++) {
       GemmMicrokernelTester()
         .mr(1)
         .nr(16)
@@ -20389,13 +22162,13 @@
         .n(16)
         .k(k)
         .a_stride(11)
-        .Test(xnn_f32_gemm_minmax_ukernel_1x16__avx512f_broadcast, xnn_init_f32_minmax_scalar_params);
+        .Test(xnn_f32_gemm_minmax_ukernel_1x16__avx512f_broadcast_acc4, xnn_init_f32_minmax_scalar_params);
     }
   }
 
-  TEST(F32_GEMM_MINMAX_1X16__AVX512F_BROADCAST, k_gt_1_subtile) {
+  TEST(F32_GEMM_MINMAX_1X16__AVX512F_BROADCAST_ACC4, k_gt_4_subtile) {
     TEST_REQUIRES_X86_AVX512F;
-    for (size_t k = 2; k < 10; k++) {
+    for (size_t k = 5; k < 8; k++) {
       for (uint32_t n = 1; n <= 16; n++) {
         for (uint32_t m = 1; m <= 1; m++) {
           GemmMicrokernelTester()
@@ -20407,16 +22180,67 @@
             .n(n)
             .k(k)
             .iterations(1)
-            .Test(xnn_f32_gemm_minmax_ukernel_1x16__avx512f_broadcast, xnn_init_f32_minmax_scalar_params);
+            .Test(xnn_f32_gemm_minmax_ukernel_1x16__avx512f_broadcast_acc4, xnn_init_f32_minmax_scalar_params);
         }
       }
     }
   }
 
-  TEST(F32_GEMM_MINMAX_1X16__AVX512F_BROADCAST, n_gt_16) {
+  TEST(F32_GEMM_MINMAX_1X16__AVX512F_BROADCAST_ACC4, k_div_4) {
+    TEST_REQUIRES_X86_AVX512F;
+    for (size_t k = 8; k <= 40; k += 4) {
+      GemmMicrokernelTester()
+        .mr(1)
+        .nr(16)
+        .kr(1)
+        .sr(1)
+        .m(1)
+        .n(16)
+        .k(k)
+        .Test(xnn_f32_gemm_minmax_ukernel_1x16__avx512f_broadcast_acc4, xnn_init_f32_minmax_scalar_params);
+    }
+  }
+
+  TEST(F32_GEMM_MINMAX_1X16__AVX512F_BROADCAST_ACC4, k_div_4_strided_a) {
+    TEST_REQUIRES_X86_AVX512F;
+    for (size_t k = 8; k <= 40; k += 4) {
+      GemmMicrokernelTester()
+        .mr(1)
+        .nr(16)
+        .kr(1)
+        .sr(1)
+        .m(1)
+        .n(16)
+        .k(k)
+        .a_stride(43)
+        .Test(xnn_f32_gemm_minmax_ukernel_1x16__avx512f_broadcast_acc4, xnn_init_f32_minmax_scalar_params);
+    }
+  }
+
+  TEST(F32_GEMM_MINMAX_1X16__AVX512F_BROADCAST_ACC4, k_div_4_subtile) {
+    TEST_REQUIRES_X86_AVX512F;
+    for (size_t k = 8; k <= 40; k += 4) {
+      for (uint32_t n = 1; n <= 16; n++) {
+        for (uint32_t m = 1; m <= 1; m++) {
+          GemmMicrokernelTester()
+            .mr(1)
+            .nr(16)
+            .kr(1)
+            .sr(1)
+            .m(m)
+            .n(n)
+            .k(k)
+            .iterations(1)
+            .Test(xnn_f32_gemm_minmax_ukernel_1x16__avx512f_broadcast_acc4, xnn_init_f32_minmax_scalar_params);
+        }
+      }
+    }
+  }
+
+  TEST(F32_GEMM_MINMAX_1X16__AVX512F_BROADCAST_ACC4, n_gt_16) {
     TEST_REQUIRES_X86_AVX512F;
     for (uint32_t n = 17; n < 32; n++) {
-      for (size_t k = 1; k <= 5; k += 2) {
+      for (size_t k = 1; k <= 20; k += 5) {
         GemmMicrokernelTester()
           .mr(1)
           .nr(16)
@@ -20425,15 +22249,15 @@
           .m(1)
           .n(n)
           .k(k)
-          .Test(xnn_f32_gemm_minmax_ukernel_1x16__avx512f_broadcast, xnn_init_f32_minmax_scalar_params);
+          .Test(xnn_f32_gemm_minmax_ukernel_1x16__avx512f_broadcast_acc4, xnn_init_f32_minmax_scalar_params);
       }
     }
   }
 
-  TEST(F32_GEMM_MINMAX_1X16__AVX512F_BROADCAST, n_gt_16_strided_cn) {
+  TEST(F32_GEMM_MINMAX_1X16__AVX512F_BROADCAST_ACC4, n_gt_16_strided_cn) {
     TEST_REQUIRES_X86_AVX512F;
     for (uint32_t n = 17; n < 32; n++) {
-      for (size_t k = 1; k <= 5; k += 2) {
+      for (size_t k = 1; k <= 20; k += 5) {
         GemmMicrokernelTester()
           .mr(1)
           .nr(16)
@@ -20443,15 +22267,15 @@
           .n(n)
           .k(k)
           .cn_stride(19)
-          .Test(xnn_f32_gemm_minmax_ukernel_1x16__avx512f_broadcast, xnn_init_f32_minmax_scalar_params);
+          .Test(xnn_f32_gemm_minmax_ukernel_1x16__avx512f_broadcast_acc4, xnn_init_f32_minmax_scalar_params);
       }
     }
   }
 
-  TEST(F32_GEMM_MINMAX_1X16__AVX512F_BROADCAST, n_gt_16_strided_a) {
+  TEST(F32_GEMM_MINMAX_1X16__AVX512F_BROADCAST_ACC4, n_gt_16_strided_a) {
     TEST_REQUIRES_X86_AVX512F;
     for (uint32_t n = 17; n < 32; n++) {
-      for (size_t k = 1; k <= 5; k += 2) {
+      for (size_t k = 1; k <= 20; k += 5) {
         GemmMicrokernelTester()
           .mr(1)
           .nr(16)
@@ -20460,16 +22284,16 @@
           .m(1)
           .n(n)
           .k(k)
-          .a_stride(7)
-          .Test(xnn_f32_gemm_minmax_ukernel_1x16__avx512f_broadcast, xnn_init_f32_minmax_scalar_params);
+          .a_stride(23)
+          .Test(xnn_f32_gemm_minmax_ukernel_1x16__avx512f_broadcast_acc4, xnn_init_f32_minmax_scalar_params);
       }
     }
   }
 
-  TEST(F32_GEMM_MINMAX_1X16__AVX512F_BROADCAST, n_gt_16_subtile) {
+  TEST(F32_GEMM_MINMAX_1X16__AVX512F_BROADCAST_ACC4, n_gt_16_subtile) {
     TEST_REQUIRES_X86_AVX512F;
     for (uint32_t n = 17; n < 32; n++) {
-      for (size_t k = 1; k <= 5; k += 2) {
+      for (size_t k = 1; k <= 20; k += 5) {
         for (uint32_t m = 1; m <= 1; m++) {
           GemmMicrokernelTester()
             .mr(1)
@@ -20480,16 +22304,16 @@
             .n(n)
             .k(k)
             .iterations(1)
-            .Test(xnn_f32_gemm_minmax_ukernel_1x16__avx512f_broadcast, xnn_init_f32_minmax_scalar_params);
+            .Test(xnn_f32_gemm_minmax_ukernel_1x16__avx512f_broadcast_acc4, xnn_init_f32_minmax_scalar_params);
         }
       }
     }
   }
 
-  TEST(F32_GEMM_MINMAX_1X16__AVX512F_BROADCAST, n_div_16) {
+  TEST(F32_GEMM_MINMAX_1X16__AVX512F_BROADCAST_ACC4, n_div_16) {
     TEST_REQUIRES_X86_AVX512F;
     for (uint32_t n = 32; n <= 48; n += 16) {
-      for (size_t k = 1; k <= 5; k += 2) {
+      for (size_t k = 1; k <= 20; k += 5) {
         GemmMicrokernelTester()
           .mr(1)
           .nr(16)
@@ -20498,15 +22322,15 @@
           .m(1)
           .n(n)
           .k(k)
-          .Test(xnn_f32_gemm_minmax_ukernel_1x16__avx512f_broadcast, xnn_init_f32_minmax_scalar_params);
+          .Test(xnn_f32_gemm_minmax_ukernel_1x16__avx512f_broadcast_acc4, xnn_init_f32_minmax_scalar_params);
       }
     }
   }
 
-  TEST(F32_GEMM_MINMAX_1X16__AVX512F_BROADCAST, n_div_16_strided_cn) {
+  TEST(F32_GEMM_MINMAX_1X16__AVX512F_BROADCAST_ACC4, n_div_16_strided_cn) {
     TEST_REQUIRES_X86_AVX512F;
     for (uint32_t n = 32; n <= 48; n += 16) {
-      for (size_t k = 1; k <= 5; k += 2) {
+      for (size_t k = 1; k <= 20; k += 5) {
         GemmMicrokernelTester()
           .mr(1)
           .nr(16)
@@ -20516,15 +22340,15 @@
           .n(n)
           .k(k)
           .cn_stride(19)
-          .Test(xnn_f32_gemm_minmax_ukernel_1x16__avx512f_broadcast, xnn_init_f32_minmax_scalar_params);
+          .Test(xnn_f32_gemm_minmax_ukernel_1x16__avx512f_broadcast_acc4, xnn_init_f32_minmax_scalar_params);
       }
     }
   }
 
-  TEST(F32_GEMM_MINMAX_1X16__AVX512F_BROADCAST, n_div_16_strided_a) {
+  TEST(F32_GEMM_MINMAX_1X16__AVX512F_BROADCAST_ACC4, n_div_16_strided_a) {
     TEST_REQUIRES_X86_AVX512F;
     for (uint32_t n = 32; n <= 48; n += 16) {
-      for (size_t k = 1; k <= 5; k += 2) {
+      for (size_t k = 1; k <= 20; k += 5) {
         GemmMicrokernelTester()
           .mr(1)
           .nr(16)
@@ -20533,16 +22357,16 @@
           .m(1)
           .n(n)
           .k(k)
-          .a_stride(7)
-          .Test(xnn_f32_gemm_minmax_ukernel_1x16__avx512f_broadcast, xnn_init_f32_minmax_scalar_params);
+          .a_stride(23)
+          .Test(xnn_f32_gemm_minmax_ukernel_1x16__avx512f_broadcast_acc4, xnn_init_f32_minmax_scalar_params);
       }
     }
   }
 
-  TEST(F32_GEMM_MINMAX_1X16__AVX512F_BROADCAST, n_div_16_subtile) {
+  TEST(F32_GEMM_MINMAX_1X16__AVX512F_BROADCAST_ACC4, n_div_16_subtile) {
     TEST_REQUIRES_X86_AVX512F;
     for (uint32_t n = 32; n <= 48; n += 16) {
-      for (size_t k = 1; k <= 5; k += 2) {
+      for (size_t k = 1; k <= 20; k += 5) {
         for (uint32_t m = 1; m <= 1; m++) {
           GemmMicrokernelTester()
             .mr(1)
@@ -20553,15 +22377,15 @@
             .n(n)
             .k(k)
             .iterations(1)
-            .Test(xnn_f32_gemm_minmax_ukernel_1x16__avx512f_broadcast, xnn_init_f32_minmax_scalar_params);
+            .Test(xnn_f32_gemm_minmax_ukernel_1x16__avx512f_broadcast_acc4, xnn_init_f32_minmax_scalar_params);
         }
       }
     }
   }
 
-  TEST(F32_GEMM_MINMAX_1X16__AVX512F_BROADCAST, strided_cm_subtile) {
+  TEST(F32_GEMM_MINMAX_1X16__AVX512F_BROADCAST_ACC4, strided_cm_subtile) {
     TEST_REQUIRES_X86_AVX512F;
-    for (size_t k = 1; k <= 5; k += 2) {
+    for (size_t k = 1; k <= 20; k += 5) {
       for (uint32_t n = 1; n <= 16; n++) {
         for (uint32_t m = 1; m <= 1; m++) {
           GemmMicrokernelTester()
@@ -20574,13 +22398,13 @@
             .k(k)
             .cm_stride(19)
             .iterations(1)
-            .Test(xnn_f32_gemm_minmax_ukernel_1x16__avx512f_broadcast, xnn_init_f32_minmax_scalar_params);
+            .Test(xnn_f32_gemm_minmax_ukernel_1x16__avx512f_broadcast_acc4, xnn_init_f32_minmax_scalar_params);
         }
       }
     }
   }
 
-  TEST(F32_GEMM_MINMAX_1X16__AVX512F_BROADCAST, qmin) {
+  TEST(F32_GEMM_MINMAX_1X16__AVX512F_BROADCAST_ACC4, qmin) {
     TEST_REQUIRES_X86_AVX512F;
     GemmMicrokernelTester()
       .mr(1)
@@ -20589,12 +22413,12 @@
       .sr(1)
       .m(1)
       .n(16)
-      .k(1)
+      .k(4)
       .qmin(128)
-      .Test(xnn_f32_gemm_minmax_ukernel_1x16__avx512f_broadcast, xnn_init_f32_minmax_scalar_params);
+      .Test(xnn_f32_gemm_minmax_ukernel_1x16__avx512f_broadcast_acc4, xnn_init_f32_minmax_scalar_params);
   }
 
-  TEST(F32_GEMM_MINMAX_1X16__AVX512F_BROADCAST, qmax) {
+  TEST(F32_GEMM_MINMAX_1X16__AVX512F_BROADCAST_ACC4, qmax) {
     TEST_REQUIRES_X86_AVX512F;
     GemmMicrokernelTester()
       .mr(1)
@@ -20603,12 +22427,12 @@
       .sr(1)
       .m(1)
       .n(16)
-      .k(1)
+      .k(4)
       .qmax(128)
-      .Test(xnn_f32_gemm_minmax_ukernel_1x16__avx512f_broadcast, xnn_init_f32_minmax_scalar_params);
+      .Test(xnn_f32_gemm_minmax_ukernel_1x16__avx512f_broadcast_acc4, xnn_init_f32_minmax_scalar_params);
   }
 
-  TEST(F32_GEMM_MINMAX_1X16__AVX512F_BROADCAST, strided_cm) {
+  TEST(F32_GEMM_MINMAX_1X16__AVX512F_BROADCAST_ACC4, strided_cm) {
     TEST_REQUIRES_X86_AVX512F;
     GemmMicrokernelTester()
       .mr(1)
@@ -20617,9 +22441,9 @@
       .sr(1)
       .m(1)
       .n(16)
-      .k(1)
+      .k(4)
       .cm_stride(19)
-      .Test(xnn_f32_gemm_minmax_ukernel_1x16__avx512f_broadcast, xnn_init_f32_minmax_scalar_params);
+      .Test(xnn_f32_gemm_minmax_ukernel_1x16__avx512f_broadcast_acc4, xnn_init_f32_minmax_scalar_params);
   }
 #endif  // XNN_ARCH_X86 || XNN_ARCH_X86_64
 
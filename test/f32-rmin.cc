@@ -0,0 +1,179 @@
+// Copyright 2022 Google LLC
+//
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree.
+
+#include <gtest/gtest.h>
+
+#include <xnnpack/common.h>
+#include <xnnpack/isa-checks.h>
+
+#include <xnnpack/rmin.h>
+#include "rmin-microkernel-tester.h"
+
+
+#if XNN_ARCH_ARM || XNN_ARCH_ARM64
+  TEST(F32_RMIN__NEON, n_lt_16) {
+    TEST_REQUIRES_ARM_NEON;
+    for (size_t n = 1; n < 16; n++) {
+      RMinMicrokernelTester()
+        .n(n)
+        .Test(xnn_f32_rmin_ukernel__neon);
+    }
+  }
+
+  TEST(F32_RMIN__NEON, n_eq_16) {
+    TEST_REQUIRES_ARM_NEON;
+    RMinMicrokernelTester()
+      .n(16)
+      .Test(xnn_f32_rmin_ukernel__neon);
+  }
+
+  TEST(F32_RMIN__NEON, n_div_16) {
+    TEST_REQUIRES_ARM_NEON;
+    for (size_t n = 16; n < 128; n += 16) {
+      RMinMicrokernelTester()
+        .n(n)
+        .Test(xnn_f32_rmin_ukernel__neon);
+    }
+  }
+
+  TEST(F32_RMIN__NEON, n_gt_16) {
+    TEST_REQUIRES_ARM_NEON;
+    for (size_t n = 16; n < 32; n++) {
+      RMinMicrokernelTester()
+        .n(n)
+        .Test(xnn_f32_rmin_ukernel__neon);
+    }
+  }
+#endif  // XNN_ARCH_ARM || XNN_ARCH_ARM64
+
+#if XNN_ARCH_X86 || XNN_ARCH_X86_64
+  TEST(F32_RMIN__SSE, n_lt_16) {
+    TEST_REQUIRES_X86_SSE2;
+    for (size_t n = 1; n < 16; n++) {
+      RMinMicrokernelTester()
+        .n(n)
+        .Test(xnn_f32_rmin_ukernel__sse);
+    }
+  }
+
+  TEST(F32_RMIN__SSE, n_eq_16) {
+    TEST_REQUIRES_X86_SSE2;
+    RMinMicrokernelTester()
+      .n(16)
+      .Test(xnn_f32_rmin_ukernel__sse);
+  }
+
+  TEST(F32_RMIN__SSE, n_div_16) {
+    TEST_REQUIRES_X86_SSE2;
+    for (size_t n = 16; n < 128; n += 16) {
+      RMinMicrokernelTester()
+        .n(n)
+        .Test(xnn_f32_rmin_ukernel__sse);
+    }
+  }
+
+  TEST(F32_RMIN__SSE, n_gt_16) {
+    TEST_REQUIRES_X86_SSE2;
+    for (size_t n = 16; n < 32; n++) {
+      RMinMicrokernelTester()
+        .n(n)
+        .Test(xnn_f32_rmin_ukernel__sse);
+    }
+  }
+#endif  // XNN_ARCH_X86 || XNN_ARCH_X86_64
+
+#if XNN_ARCH_WASMSIMD
+  TEST(F32_RMIN__WASMSIMD_ARM, n_lt_16) {
+    for (size_t n = 1; n < 16; n++) {
+      RMinMicrokernelTester()
+        .n(n)
+        .Test(xnn_f32_rmin_ukernel__wasmsimd_arm);
+    }
+  }
+
+  TEST(F32_RMIN__WASMSIMD_ARM, n_eq_16) {
+    RMinMicrokernelTester()
+      .n(16)
+      .Test(xnn_f32_rmin_ukernel__wasmsimd_arm);
+  }
+
+  TEST(F32_RMIN__WASMSIMD_ARM, n_div_16) {
+    for (size_t n = 16; n < 128; n += 16) {
+      RMinMicrokernelTester()
+        .n(n)
+        .Test(xnn_f32_rmin_ukernel__wasmsimd_arm);
+    }
+  }
+
+  TEST(F32_RMIN__WASMSIMD_ARM, n_gt_16) {
+    for (size_t n = 16; n < 32; n++) {
+      RMinMicrokernelTester()
+        .n(n)
+        .Test(xnn_f32_rmin_ukernel__wasmsimd_arm);
+    }
+  }
+#endif  // XNN_ARCH_WASMSIMD
+
+#if XNN_ARCH_WASMSIMD
+  TEST(F32_RMIN__WASMSIMD_X86, n_lt_16) {
+    for (size_t n = 1; n < 16; n++) {
+      RMinMicrokernelTester()
+        .n(n)
+        .Test(xnn_f32_rmin_ukernel__wasmsimd_x86);
+    }
+  }
+
+  TEST(F32_RMIN__WASMSIMD_X86, n_eq_16) {
+    RMinMicrokernelTester()
+      .n(16)
+      .Test(xnn_f32_rmin_ukernel__wasmsimd_x86);
+  }
+
+  TEST(F32_RMIN__WASMSIMD_X86, n_div_16) {
+    for (size_t n = 16; n < 128; n += 16) {
+      RMinMicrokernelTester()
+        .n(n)
+        .Test(xnn_f32_rmin_ukernel__wasmsimd_x86);
+    }
+  }
+
+  TEST(F32_RMIN__WASMSIMD_X86, n_gt_16) {
+    for (size_t n = 16; n < 32; n++) {
+      RMinMicrokernelTester()
+        .n(n)
+        .Test(xnn_f32_rmin_ukernel__wasmsimd_x86);
+    }
+  }
+#endif  // XNN_ARCH_WASMSIMD
+
+TEST(F32_RMIN__SCALAR, n_lt_4) {
+  for (size_t n = 1; n < 4; n++) {
+    RMinMicrokernelTester()
+      .n(n)
+      .Test(xnn_f32_rmin_ukernel__scalar);
+  }
+}
+
+TEST(F32_RMIN__SCALAR, n_eq_4) {
+  RMinMicrokernelTester()
+    .n(4)
+    .Test(xnn_f32_rmin_ukernel__scalar);
+}
+
+TEST(F32_RMIN__SCALAR, n_div_4) {
+  for (size_t n = 4; n < 32; n += 4) {
+    RMinMicrokernelTester()
+      .n(n)
+      .Test(xnn_f32_rmin_ukernel__scalar);
+  }
+}
+
+TEST(F32_RMIN__SCALAR, n_gt_4) {
+  for (size_t n = 4; n < 8; n++) {
+    RMinMicrokernelTester()
+      .n(n)
+      .Test(xnn_f32_rmin_ukernel__scalar);
+  }
+}
@@ -0,0 +1,147 @@
+// Copyright 2022 Google LLC
+//
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree.
+
+#include <gtest/gtest.h>
+
+#include <xnnpack/common.h>
+#include <xnnpack/isa-checks.h>
+
+#include <xnnpack/rsum.h>
+#include "rsum-microkernel-tester.h"
+
+
+#if XNN_ARCH_ARM || XNN_ARCH_ARM64
+  TEST(F32_RSUM__NEON, n_lt_16) {
+    TEST_REQUIRES_ARM_NEON;
+    for (size_t n = 1; n < 16; n++) {
+      RSumMicrokernelTester()
+        .n(n)
+        .Test(xnn_f32_rsum_ukernel__neon);
+    }
+  }
+
+  TEST(F32_RSUM__NEON, n_eq_16) {
+    TEST_REQUIRES_ARM_NEON;
+    RSumMicrokernelTester()
+      .n(16)
+      .Test(xnn_f32_rsum_ukernel__neon);
+  }
+
+  TEST(F32_RSUM__NEON, n_div_16) {
+    TEST_REQUIRES_ARM_NEON;
+    for (size_t n = 16; n < 128; n += 16) {
+      RSumMicrokernelTester()
+        .n(n)
+        .Test(xnn_f32_rsum_ukernel__neon);
+    }
+  }
+
+  TEST(F32_RSUM__NEON, n_gt_16) {
+    TEST_REQUIRES_ARM_NEON;
+    for (size_t n = 16; n < 32; n++) {
+      RSumMicrokernelTester()
+        .n(n)
+        .Test(xnn_f32_rsum_ukernel__neon);
+    }
+  }
+#endif  // XNN_ARCH_ARM || XNN_ARCH_ARM64
+
+#if XNN_ARCH_X86 || XNN_ARCH_X86_64
+  TEST(F32_RSUM__SSE, n_lt_16) {
+    TEST_REQUIRES_X86_SSE2;
+    for (size_t n = 1; n < 16; n++) {
+      RSumMicrokernelTester()
+        .n(n)
+        .Test(xnn_f32_rsum_ukernel__sse);
+    }
+  }
+
+  TEST(F32_RSUM__SSE, n_eq_16) {
+    TEST_REQUIRES_X86_SSE2;
+    RSumMicrokernelTester()
+      .n(16)
+      .Test(xnn_f32_rsum_ukernel__sse);
+  }
+
+  TEST(F32_RSUM__SSE, n_div_16) {
+    TEST_REQUIRES_X86_SSE2;
+    for (size_t n = 16; n < 128; n += 16) {
+      RSumMicrokernelTester()
+        .n(n)
+        .Test(xnn_f32_rsum_ukernel__sse);
+    }
+  }
+
+  TEST(F32_RSUM__SSE, n_gt_16) {
+    TEST_REQUIRES_X86_SSE2;
+    for (size_t n = 16; n < 32; n++) {
+      RSumMicrokernelTester()
+        .n(n)
+        .Test(xnn_f32_rsum_ukernel__sse);
+    }
+  }
+#endif  // XNN_ARCH_X86 || XNN_ARCH_X86_64
+
+#if XNN_ARCH_WASMSIMD
+  TEST(F32_RSUM__WASMSIMD, n_lt_16) {
+    for (size_t n = 1; n < 16; n++) {
+      RSumMicrokernelTester()
+        .n(n)
+        .Test(xnn_f32_rsum_ukernel__wasmsimd);
+    }
+  }
+
+  TEST(F32_RSUM__WASMSIMD, n_eq_16) {
+    RSumMicrokernelTester()
+      .n(16)
+      .Test(xnn_f32_rsum_ukernel__wasmsimd);
+  }
+
+  TEST(F32_RSUM__WASMSIMD, n_div_16) {
+    for (size_t n = 16; n < 128; n += 16) {
+      RSumMicrokernelTester()
+        .n(n)
+        .Test(xnn_f32_rsum_ukernel__wasmsimd);
+    }
+  }
+
+  TEST(F32_RSUM__WASMSIMD, n_gt_16) {
+    for (size_t n = 16; n < 32; n++) {
+      RSumMicrokernelTester()
+        .n(n)
+        .Test(xnn_f32_rsum_ukernel__wasmsimd);
+    }
+  }
+#endif  // XNN_ARCH_WASMSIMD
+
+TEST(F32_RSUM__SCALAR, n_lt_4) {
+  for (size_t n = 1; n < 4; n++) {
+    RSumMicrokernelTester()
+      .n(n)
+      .Test(xnn_f32_rsum_ukernel__scalar);
+  }
+}
+
+TEST(F32_RSUM__SCALAR, n_eq_4) {
+  RSumMicrokernelTester()
+    .n(4)
+    .Test(xnn_f32_rsum_ukernel__scalar);
+}
+
+TEST(F32_RSUM__SCALAR, n_div_4) {
+  for (size_t n = 4; n < 32; n += 4) {
+    RSumMicrokernelTester()
+      .n(n)
+      .Test(xnn_f32_rsum_ukernel__scalar);
+  }
+}
+
+TEST(F32_RSUM__SCALAR, n_gt_4) {
+  for (size_t n = 4; n < 8; n++) {
+    RSumMicrokernelTester()
+      .n(n)
+      .Test(xnn_f32_rsum_ukernel__scalar);
+  }
+}
@@ -6,6 +6,11 @@
 // This source code is licensed under the BSD-style license found in the
 // LICENSE file in the root directory of this source tree.
 
+#include <cstdio>
+#include <limits>
+#include <string>
+#include <vector>
+
 #include <gtest/gtest.h>
 
 #include "fully-connected-operator-tester.h"
@@ -149,6 +154,37 @@ TEST(FULLY_CONNECTED_NC_QS8, small_batch_without_bias) {
     .TestQS8();
 }
 
+TEST(FULLY_CONNECTED_NC_QS8, small_batch_with_defer_packing) {
+  FullyConnectedOperatorTester()
+    .defer_packing(true)
+    .batch_size(12)
+    .input_channels(23)
+    .output_channels(19)
+    .iterations(3)
+    .TestQS8();
+}
+
+TEST(FULLY_CONNECTED_NC_QS8, small_batch_with_prepacked_weights) {
+  FullyConnectedOperatorTester()
+    .prepacked_weights(true)
+    .batch_size(12)
+    .input_channels(23)
+    .output_channels(19)
+    .iterations(3)
+    .TestQS8();
+}
+
+TEST(FULLY_CONNECTED_NC_QS8, small_batch_transpose_weights_with_prepacked_weights) {
+  FullyConnectedOperatorTester()
+    .prepacked_weights(true)
+    .transpose_weights(true)
+    .batch_size(12)
+    .input_channels(23)
+    .output_channels(19)
+    .iterations(3)
+    .TestQS8();
+}
+
 TEST(FULLY_CONNECTED_NC_QU8, unit_batch) {
   FullyConnectedOperatorTester()
     .batch_size(1)
@@ -425,6 +461,361 @@ TEST(FULLY_CONNECTED_NC_F32, small_batch_without_bias) {
     .TestF32();
 }
 
+TEST(FULLY_CONNECTED_NC_F32, unit_batch_with_residual) {
+  FullyConnectedOperatorTester()
+    .has_residual(true)
+    .batch_size(1)
+    .input_channels(23)
+    .output_channels(19)
+    .iterations(3)
+    .TestF32();
+}
+
+TEST(FULLY_CONNECTED_NC_F32, small_batch_with_residual) {
+  FullyConnectedOperatorTester()
+    .has_residual(true)
+    .batch_size(12)
+    .input_channels(23)
+    .output_channels(19)
+    .iterations(3)
+    .TestF32();
+}
+
+TEST(FULLY_CONNECTED_NC_F32, small_batch_with_residual_and_output_stride) {
+  FullyConnectedOperatorTester()
+    .has_residual(true)
+    .batch_size(12)
+    .input_channels(23)
+    .output_channels(19)
+    .output_stride(29)
+    .iterations(3)
+    .TestF32();
+}
+
+TEST(FULLY_CONNECTED_NC_F32, small_batch_with_large_weights) {
+  FullyConnectedOperatorTester()
+    .batch_size(37)
+    .input_channels(2048)
+    .output_channels(259)
+    .TestF32();
+}
+
+TEST(FULLY_CONNECTED_NC_F32, small_batch_with_large_weights_and_residual) {
+  FullyConnectedOperatorTester()
+    .has_residual(true)
+    .batch_size(37)
+    .input_channels(2048)
+    .output_channels(259)
+    .TestF32();
+}
+
+TEST(FULLY_CONNECTED_NC_F32, unit_batch_with_long_reduction) {
+  FullyConnectedOperatorTester()
+    .batch_size(1)
+    .input_channels(4099)
+    .output_channels(19)
+    .TestF32();
+}
+
+TEST(FULLY_CONNECTED_NC_F32, unit_batch_with_long_reduction_and_qmin) {
+  FullyConnectedOperatorTester()
+    .batch_size(1)
+    .input_channels(4099)
+    .output_channels(19)
+    .qmin(128)
+    .TestF32();
+}
+
+TEST(FULLY_CONNECTED_NC_F32, unit_batch_with_long_reduction_and_qmax) {
+  FullyConnectedOperatorTester()
+    .batch_size(1)
+    .input_channels(4099)
+    .output_channels(19)
+    .qmax(128)
+    .TestF32();
+}
+
+TEST(FULLY_CONNECTED_NC_F32, unit_batch_with_long_reduction_multithreaded) {
+  for (size_t num_threads = 2; num_threads <= 8; num_threads *= 2) {
+    FullyConnectedOperatorTester()
+      .batch_size(1)
+      .input_channels(4099)
+      .output_channels(19)
+      .num_threads(num_threads)
+      .TestF32();
+  }
+}
+
+TEST(FULLY_CONNECTED_NC_F32, unit_batch_with_long_reduction_multithreaded_and_qmax) {
+  FullyConnectedOperatorTester()
+    .batch_size(1)
+    .input_channels(4099)
+    .output_channels(19)
+    .qmax(128)
+    .num_threads(4)
+    .TestF32();
+}
+
+TEST(FULLY_CONNECTED_NC_F32, unit_batch_with_long_reduction_multithreaded_and_residual) {
+  FullyConnectedOperatorTester()
+    .has_residual(true)
+    .batch_size(1)
+    .input_channels(4099)
+    .output_channels(19)
+    .num_threads(4)
+    .TestF32();
+}
+
+TEST(FULLY_CONNECTED_NC_F32, small_batch_with_long_reduction_multithreaded_and_transpose_weights) {
+  FullyConnectedOperatorTester()
+    .transpose_weights(true)
+    .batch_size(3)
+    .input_channels(4099)
+    .output_channels(19)
+    .num_threads(8)
+    .TestF32();
+}
+
+TEST(FULLY_CONNECTED_NC_F32, unit_batch_with_long_reduction_multithreaded_splits_k) {
+  FullyConnectedOperatorTester()
+    .batch_size(1)
+    .input_channels(4099)
+    .output_channels(19)
+    .num_threads(4)
+    .expect_split_k(true)
+    .TestF32();
+}
+
+TEST(FULLY_CONNECTED_NC_F32, large_batch_with_long_reduction_multithreaded_doesnt_split_k) {
+  FullyConnectedOperatorTester()
+    .batch_size(64)
+    .input_channels(4099)
+    .output_channels(37)
+    .num_threads(4)
+    .expect_split_k(false)
+    .TestF32();
+}
+
+TEST(FULLY_CONNECTED_NC_F32, large_batch_with_long_reduction_multithreaded_and_residual) {
+  FullyConnectedOperatorTester()
+    .has_residual(true)
+    .batch_size(64)
+    .input_channels(4099)
+    .output_channels(37)
+    .num_threads(4)
+    .expect_split_k(false)
+    .TestF32();
+}
+
+TEST(FULLY_CONNECTED_NC_F32, small_batch_with_fewer_useful_threads_than_thread_pool) {
+  // Too little work to keep all 16 threads busy: the operator runs on a subset of the thread pool.
+  FullyConnectedOperatorTester()
+    .batch_size(8)
+    .input_channels(256)
+    .output_channels(192)
+    .num_threads(16)
+    .TestF32();
+}
+
+TEST(FULLY_CONNECTED_NC_F32, large_batch_with_long_reduction) {
+  FullyConnectedOperatorTester()
+    .batch_size(29)
+    .input_channels(4099)
+    .output_channels(37)
+    .input_stride(4111)
+    .output_stride(41)
+    .TestF32();
+}
+
+TEST(FULLY_CONNECTED_NC_F32, unit_batch_with_autotune) {
+  FullyConnectedOperatorTester()
+    .autotune(true)
+    .batch_size(1)
+    .input_channels(263)
+    .output_channels(35)
+    .TestF32();
+}
+
+TEST(FULLY_CONNECTED_NC_F32, small_batch_with_autotune) {
+  FullyConnectedOperatorTester()
+    .autotune(true)
+    .batch_size(12)
+    .input_channels(23)
+    .output_channels(19)
+    .iterations(3)
+    .TestF32();
+}
+
+TEST(FULLY_CONNECTED_NC_F32, small_batch_with_autotune_and_qmin) {
+  FullyConnectedOperatorTester()
+    .autotune(true)
+    .batch_size(12)
+    .input_channels(23)
+    .output_channels(19)
+    .qmin(128)
+    .TestF32();
+}
+
+TEST(FULLY_CONNECTED_NC_F32, large_batch_with_autotune_and_long_reduction) {
+  FullyConnectedOperatorTester()
+    .autotune(true)
+    .batch_size(29)
+    .input_channels(4099)
+    .output_channels(37)
+    .num_threads(4)
+    .TestF32();
+}
+
+TEST(FULLY_CONNECTED_NC_F32, autotune_with_saved_cache) {
+  ASSERT_EQ(xnn_status_success, xnn_initialize(nullptr /* allocator */));
+  const std::string path = testing::TempDir() + "/fully-connected-nc-autotune-cache.txt";
+
+  FullyConnectedOperatorTester()
+    .autotune(true)
+    .batch_size(12)
+    .input_channels(71)
+    .output_channels(45)
+    .TestF32();
+  ASSERT_EQ(xnn_status_success, xnn_save_autotuning_cache(path.c_str()));
+  ASSERT_EQ(xnn_status_success, xnn_load_autotuning_cache(path.c_str()));
+  FullyConnectedOperatorTester()
+    .autotune(true)
+    .batch_size(12)
+    .input_channels(71)
+    .output_channels(45)
+    .TestF32();
+  std::remove(path.c_str());
+}
+
+TEST(FULLY_CONNECTED_NC_F32, small_batch_with_defer_packing) {
+  FullyConnectedOperatorTester()
+    .defer_packing(true)
+    .batch_size(12)
+    .input_channels(23)
+    .output_channels(19)
+    .iterations(3)
+    .TestF32();
+}
+
+TEST(FULLY_CONNECTED_NC_F32, small_batch_with_defer_packing_without_bias) {
+  FullyConnectedOperatorTester()
+    .defer_packing(true)
+    .has_bias(false)
+    .batch_size(12)
+    .input_channels(23)
+    .output_channels(19)
+    .iterations(3)
+    .TestF32();
+}
+
+TEST(FULLY_CONNECTED_NC_F32, small_batch_with_defer_packing_multithreaded) {
+  for (size_t num_threads = 2; num_threads <= 8; num_threads *= 2) {
+    FullyConnectedOperatorTester()
+      .defer_packing(true)
+      .batch_size(3)
+      .input_channels(517)
+      .output_channels(1031)
+      .num_threads(num_threads)
+      .TestF32();
+  }
+}
+
+TEST(FULLY_CONNECTED_NC_F32, small_batch_with_prepacked_weights) {
+  FullyConnectedOperatorTester()
+    .prepacked_weights(true)
+    .batch_size(12)
+    .input_channels(23)
+    .output_channels(19)
+    .iterations(3)
+    .TestF32();
+}
+
+TEST(FULLY_CONNECTED_NC_F32, small_batch_with_prepacked_weights_without_bias) {
+  FullyConnectedOperatorTester()
+    .prepacked_weights(true)
+    .has_bias(false)
+    .batch_size(12)
+    .input_channels(23)
+    .output_channels(19)
+    .iterations(3)
+    .TestF32();
+}
+
+TEST(FULLY_CONNECTED_NC_F32, small_batch_transpose_weights_with_prepacked_weights) {
+  FullyConnectedOperatorTester()
+    .prepacked_weights(true)
+    .transpose_weights(true)
+    .batch_size(12)
+    .input_channels(23)
+    .output_channels(19)
+    .iterations(3)
+    .TestF32();
+}
+
+TEST(FULLY_CONNECTED_NC_F32, unit_batch_large_input_channels_with_prepacked_weights) {
+  FullyConnectedOperatorTester()
+    .prepacked_weights(true)
+    .batch_size(1)
+    .input_channels(2048)
+    .output_channels(67)
+    .TestF32();
+}
+
+TEST(FULLY_CONNECTED_NC_F32, small_batch_with_huge_pages) {
+  FullyConnectedOperatorTester()
+    .huge_pages(true)
+    .batch_size(12)
+    .input_channels(1024)
+    .output_channels(1027)
+    .TestF32();
+}
+
+TEST(FULLY_CONNECTED_NC_F32, small_batch_with_huge_pages_and_small_weights) {
+  FullyConnectedOperatorTester()
+    .huge_pages(true)
+    .batch_size(12)
+    .input_channels(23)
+    .output_channels(19)
+    .TestF32();
+}
+
+TEST(FULLY_CONNECTED_NC_F32, memory_usage) {
+  ASSERT_EQ(xnn_status_success, xnn_initialize(nullptr /* allocator */));
+
+  const size_t input_channels = 23;
+  const size_t output_channels = 19;
+  std::vector<float> kernel(output_channels * input_channels, 1.0f);
+  std::vector<float> bias(output_channels, 0.0f);
+
+  xnn_memory_usage usage_before = { };
+  xnn_get_memory_usage(&usage_before);
+
+  xnn_operator_t fully_connected_op = nullptr;
+  ASSERT_EQ(xnn_status_success,
+    xnn_create_fully_connected_nc_f32(
+      input_channels, output_channels, input_channels, output_channels, kernel.data(), bias.data(),
+      -std::numeric_limits<float>::infinity(), std::numeric_limits<float>::infinity(),
+      0 /* flags */, &fully_connected_op));
+  ASSERT_NE(nullptr, fully_connected_op);
+
+  xnn_memory_usage usage_created = { };
+  xnn_get_memory_usage(&usage_created);
+  EXPECT_GE(usage_created.current_bytes[xnn_memory_category_packed_weights] -
+      usage_before.current_bytes[xnn_memory_category_packed_weights],
+    (kernel.size() + bias.size()) * sizeof(float));
+  EXPECT_GT(usage_created.current_total_bytes, usage_before.current_total_bytes);
+  EXPECT_GE(usage_created.peak_total_bytes, usage_created.current_total_bytes);
+
+  ASSERT_EQ(xnn_status_success, xnn_delete_operator(fully_connected_op));
+
+  xnn_memory_usage usage_deleted = { };
+  xnn_get_memory_usage(&usage_deleted);
+  EXPECT_EQ(usage_before.current_total_bytes, usage_deleted.current_total_bytes);
+  for (size_t i = 0; i < XNN_NUM_MEMORY_CATEGORIES; i++) {
+    EXPECT_EQ(usage_before.current_bytes[i], usage_deleted.current_bytes[i]) << "category " << i;
+  }
+}
+
 
 TEST(FULLY_CONNECTED_NC_F16, unit_batch) {
   FullyConnectedOperatorTester()
@@ -574,3 +965,14 @@ TEST(FULLY_CONNECTED_NC_F16, small_batch_without_bias) {
     .iterations(3)
     .TestF16();
 }
+
+TEST(FULLY_CONNECTED_NC_F16, small_batch_fp32_weights_with_defer_packing) {
+  FullyConnectedOperatorTester()
+    .weights_type(FullyConnectedOperatorTester::WeightsType::FP32)
+    .defer_packing(true)
+    .batch_size(12)
+    .input_channels(23)
+    .output_channels(19)
+    .iterations(3)
+    .TestF16();
+}
@@ -10,18 +10,23 @@
 
 #include <gtest/gtest.h>
 
+#include <cassert>
 #include <cstddef>
 #include <cstdlib>
 #include <algorithm>
 #include <cmath>
 #include <functional>
 #include <limits>
+#include <memory>
 #include <random>
 #include <vector>
 
 #include <fp16.h>
+#include <pthreadpool.h>
 
 #include <xnnpack.h>
+#include <xnnpack/AlignedAllocator.h>
+#include <xnnpack/operator.h>
 
 
 class FullyConnectedOperatorTester {
@@ -127,6 +132,15 @@ class FullyConnectedOperatorTester {
     return this->has_bias_;
   }
 
+  inline FullyConnectedOperatorTester& has_residual(bool has_residual) {
+    this->has_residual_ = has_residual;
+    return *this;
+  }
+
+  inline bool has_residual() const {
+    return this->has_residual_;
+  }
+
   inline FullyConnectedOperatorTester& weights_type(WeightsType weights_type) {
     this->weights_type_ = weights_type;
     return *this;
@@ -136,6 +150,59 @@ class FullyConnectedOperatorTester {
     return this->weights_type_;
   }
 
+  inline FullyConnectedOperatorTester& autotune(bool autotune) {
+    this->autotune_ = autotune;
+    return *this;
+  }
+
+  inline bool autotune() const {
+    return this->autotune_;
+  }
+
+  inline FullyConnectedOperatorTester& defer_packing(bool defer_packing) {
+    this->defer_packing_ = defer_packing;
+    return *this;
+  }
+
+  inline bool defer_packing() const {
+    return this->defer_packing_;
+  }
+
+  inline FullyConnectedOperatorTester& prepacked_weights(bool prepacked_weights) {
+    this->prepacked_weights_ = prepacked_weights;
+    return *this;
+  }
+
+  inline bool prepacked_weights() const {
+    return this->prepacked_weights_;
+  }
+
+  inline FullyConnectedOperatorTester& huge_pages(bool huge_pages) {
+    this->huge_pages_ = huge_pages;
+    return *this;
+  }
+
+  inline bool huge_pages() const {
+    return this->huge_pages_;
+  }
+
+  inline FullyConnectedOperatorTester& num_threads(size_t num_threads) {
+    assert(num_threads >= 1);
+    this->num_threads_ = num_threads;
+    return *this;
+  }
+
+  inline size_t num_threads() const {
+    return this->num_threads_;
+  }
+
+  // Expect F32 setup to split the reduction dimension across threads (true) or not (false).
+  inline FullyConnectedOperatorTester& expect_split_k(bool expect_split_k) {
+    this->check_split_k_ = true;
+    this->expect_split_k_ = expect_split_k;
+    return *this;
+  }
+
   inline FullyConnectedOperatorTester& iterations(size_t iterations) {
     this->iterations_ = iterations;
     return *this;
@@ -223,15 +290,62 @@ class FullyConnectedOperatorTester {
       ASSERT_EQ(xnn_status_success, xnn_initialize(nullptr /* allocator */));
       xnn_operator_t fully_connected_op = nullptr;
 
-      const xnn_status status = xnn_create_fully_connected_nc_qs8(
+      const uint32_t flags =
+        (transpose_weights() ? XNN_FLAG_TRANSPOSE_WEIGHTS : 0) | (defer_packing() ? XNN_FLAG_DEFER_PACKING : 0);
+      std::vector<uint8_t, AlignedAllocator<uint8_t, XNN_PACKED_WEIGHTS_ALIGNMENT>> packed_weights;
+      xnn_status status = xnn_status_success;
+      if (prepacked_weights()) {
+        size_t packed_weights_size = 0;
+        uint64_t fingerprint = 0;
+        status = xnn_pack_fully_connected_nc_qs8_weights(
+          input_channels(), output_channels(), input_zero_point,
+          kernel.data(), has_bias() ? bias.data() : nullptr,
+          flags, nullptr /* packed weights */, &packed_weights_size, &fingerprint);
+        if (status == xnn_status_unsupported_hardware) {
+          GTEST_SKIP();
+        }
+        ASSERT_EQ(xnn_status_success, status);
+        packed_weights.resize(packed_weights_size);
+        uint64_t packed_fingerprint = 0;
+        ASSERT_EQ(xnn_status_success,
+          xnn_pack_fully_connected_nc_qs8_weights(
+            input_channels(), output_channels(), input_zero_point,
+            kernel.data(), has_bias() ? bias.data() : nullptr,
+            flags, packed_weights.data(), &packed_weights_size, &packed_fingerprint));
+        ASSERT_EQ(fingerprint, packed_fingerprint);
+        ASSERT_EQ(packed_weights.size(), packed_weights_size);
+
+        ASSERT_EQ(xnn_status_unsupported_parameter,
+          xnn_create_fully_connected_nc_qs8_with_packed_weights(
+            input_channels(), output_channels(),
+            input_stride(), output_stride(),
+            input_zero_point, 1.0f /* input scale */,
+            1.0f /* kernel scale */,
+            packed_weights.data(), packed_weights.size(), fingerprint + 1,
+            output_zero_point, output_scale, int8_t(qmin() - 0x80), int8_t(qmax() - 0x80),
+            flags, &fully_connected_op));
+
+        // Clobber the original weights to check that the operator does not reference them.
+        std::fill(kernel.begin(), kernel.end(), 0);
+        std::fill(bias.begin(), bias.end(), 0);
+        status = xnn_create_fully_connected_nc_qs8_with_packed_weights(
+          input_channels(), output_channels(),
+          input_stride(), output_stride(),
+          input_zero_point, 1.0f /* input scale */,
+          1.0f /* kernel scale */,
+          packed_weights.data(), packed_weights.size(), fingerprint,
+          output_zero_point, output_scale, int8_t(qmin() - 0x80), int8_t(qmax() - 0x80),
+          flags, &fully_connected_op);
+      } else {
+        status = xnn_create_fully_connected_nc_qs8(
           input_channels(), output_channels(),
           input_stride(), output_stride(),
           input_zero_point, 1.0f /* input scale */,
           1.0f /* kernel scale */,
           kernel.data(), has_bias() ? bias.data() : nullptr,
           output_zero_point, output_scale, int8_t(qmin() - 0x80), int8_t(qmax() - 0x80),
-          transpose_weights() ? XNN_FLAG_TRANSPOSE_WEIGHTS : 0,
-          &fully_connected_op);
+          flags, &fully_connected_op);
+      }
       if (status == xnn_status_unsupported_hardware) {
         GTEST_SKIP();
       }
@@ -352,7 +466,7 @@ class FullyConnectedOperatorTester {
           kernel_zero_point, 1.0f /* kernel scale */,
           kernel.data(), has_bias() ? bias.data() : nullptr,
           output_zero_point, output_scale, qmin(), qmax(),
-          transpose_weights() ? XNN_FLAG_TRANSPOSE_WEIGHTS : 0,
+          (transpose_weights() ? XNN_FLAG_TRANSPOSE_WEIGHTS : 0) | (defer_packing() ? XNN_FLAG_DEFER_PACKING : 0),
           &fully_connected_op);
       if (status == xnn_status_unsupported_hardware) {
         GTEST_SKIP();
@@ -401,13 +515,20 @@ class FullyConnectedOperatorTester {
       (batch_size() - 1) * input_stride() + input_channels());
     std::vector<float> kernel(output_channels() * input_channels());
     std::vector<float> bias(output_channels());
+    std::vector<float> residual(batch_size() * output_channels() + XNN_EXTRA_BYTES / sizeof(float));
     std::vector<float> output((batch_size() - 1) * output_stride() + output_channels());
     std::vector<float> output_ref(batch_size() * output_channels());
 
+    std::unique_ptr<pthreadpool, decltype(&pthreadpool_destroy)> auto_threadpool(nullptr, pthreadpool_destroy);
+    if (num_threads() > 1) {
+      auto_threadpool.reset(pthreadpool_create(num_threads()));
+    }
+
     for (size_t iteration = 0; iteration < iterations(); iteration++) {
       std::generate(input.begin(), input.end(), std::ref(f32rng));
       std::generate(kernel.begin(), kernel.end(), std::ref(f32rng));
       std::generate(bias.begin(), bias.end(), std::ref(f32rng));
+      std::generate(residual.begin(), residual.end(), std::ref(f32rng));
       std::fill(output.begin(), output.end(), nanf(""));
 
       // Compute reference results, without renormalization.
@@ -454,17 +575,79 @@ class FullyConnectedOperatorTester {
         value = std::max(std::min(value, output_max), output_min);
       }
 
+      // Add residual to reference results.
+      if (has_residual()) {
+        for (size_t i = 0; i < output_ref.size(); i++) {
+          output_ref[i] += residual[i];
+        }
+      }
+
       // Create, setup, run, and destroy Fully Connected operator.
       ASSERT_EQ(xnn_status_success, xnn_initialize(nullptr /* allocator */));
       xnn_operator_t fully_connected_op = nullptr;
 
-      const xnn_status status = xnn_create_fully_connected_nc_f32(
+      uint32_t flags = 0;
+      if (transpose_weights()) {
+        flags |= XNN_FLAG_TRANSPOSE_WEIGHTS;
+      }
+      if (autotune()) {
+        flags |= XNN_FLAG_AUTOTUNE;
+      }
+      if (defer_packing()) {
+        flags |= XNN_FLAG_DEFER_PACKING;
+      }
+      if (huge_pages()) {
+        flags |= XNN_FLAG_HUGE_PAGES;
+      }
+      std::vector<uint8_t, AlignedAllocator<uint8_t, XNN_PACKED_WEIGHTS_ALIGNMENT>> packed_weights;
+      xnn_status status = xnn_status_success;
+      if (prepacked_weights()) {
+        size_t packed_weights_size = 0;
+        uint64_t fingerprint = 0;
+        status = xnn_pack_fully_connected_nc_f32_weights(
+          input_channels(), output_channels(),
+          kernel.data(), has_bias() ? bias.data() : nullptr,
+          flags, nullptr /* packed weights */, &packed_weights_size, &fingerprint);
+        if (status == xnn_status_unsupported_hardware) {
+          GTEST_SKIP();
+        }
+        ASSERT_EQ(xnn_status_success, status);
+        packed_weights.resize(packed_weights_size);
+        uint64_t packed_fingerprint = 0;
+        ASSERT_EQ(xnn_status_success,
+          xnn_pack_fully_connected_nc_f32_weights(
+            input_channels(), output_channels(),
+            kernel.data(), has_bias() ? bias.data() : nullptr,
+            flags, packed_weights.data(), &packed_weights_size, &packed_fingerprint));
+        ASSERT_EQ(fingerprint, packed_fingerprint);
+        ASSERT_EQ(packed_weights.size(), packed_weights_size);
+
+        ASSERT_EQ(xnn_status_unsupported_parameter,
+          xnn_create_fully_connected_nc_f32_with_packed_weights(
+            input_channels(), output_channels(),
+            input_stride(), output_stride(),
+            packed_weights.data(), packed_weights.size(), fingerprint + 1,
+            output_min, output_max,
+            flags, &fully_connected_op));
+
+        // Clobber the original weights to check that the operator does not reference them.
+        std::fill(kernel.begin(), kernel.end(), std::nanf(""));
+        std::fill(bias.begin(), bias.end(), std::nanf(""));
+        status = xnn_create_fully_connected_nc_f32_with_packed_weights(
+          input_channels(), output_channels(),
+          input_stride(), output_stride(),
+          packed_weights.data(), packed_weights.size(), fingerprint,
+          output_min, output_max,
+          flags, &fully_connected_op);
+      } else {
+        status = xnn_create_fully_connected_nc_f32(
           input_channels(), output_channels(),
           input_stride(), output_stride(),
           kernel.data(), has_bias() ? bias.data() : nullptr,
           output_min, output_max,
-          transpose_weights() ? XNN_FLAG_TRANSPOSE_WEIGHTS : 0,
+          flags,
           &fully_connected_op);
+      }
       if (status == xnn_status_unsupported_hardware) {
         GTEST_SKIP();
       }
@@ -474,23 +657,40 @@ class FullyConnectedOperatorTester {
       // Smart pointer to automatically delete fully_connected_op.
       std::unique_ptr<xnn_operator, decltype(&xnn_delete_operator)> auto_fully_connected_op(fully_connected_op, xnn_delete_operator);
 
+      if (has_residual()) {
+        ASSERT_EQ(xnn_status_success,
+          xnn_fuse_residual_add_f32(
+            fully_connected_op,
+            -std::numeric_limits<float>::infinity(), std::numeric_limits<float>::infinity()));
+        ASSERT_EQ(xnn_status_success,
+          xnn_setup_residual_add(fully_connected_op, residual.data(), output_channels()));
+      }
+
       ASSERT_EQ(xnn_status_success,
         xnn_setup_fully_connected_nc_f32(
           fully_connected_op,
           batch_size(),
           input.data(), output.data(),
-          nullptr /* thread pool */));
+          auto_threadpool.get()));
+      if (check_split_k_) {
+        // Only split reduction dimension partitions the output by reduction segments, and sums up partitions in a
+        // second compute pass.
+        ASSERT_EQ(expect_split_k_, fully_connected_op->compute.type == xnn_parallelization_type_3d_tile_2d);
+        ASSERT_EQ(expect_split_k_, fully_connected_op->compute2.type != xnn_parallelization_type_invalid);
+      }
 
       ASSERT_EQ(xnn_status_success,
-        xnn_run_operator(fully_connected_op, nullptr /* thread pool */));
+        xnn_run_operator(fully_connected_op, auto_threadpool.get()));
 
       // Verify results.
       for (size_t i = 0; i < batch_size(); i++) {
         for (size_t c = 0; c < output_channels(); c++) {
-          ASSERT_LE(output[i * output_stride() + c], output_max)
-            << "batch index = " << i << ", channel = " << c;
-          ASSERT_GE(output[i * output_stride() + c], output_min)
-            << "batch index = " << i << ", channel = " << c;
+          if (!has_residual()) {
+            ASSERT_LE(output[i * output_stride() + c], output_max)
+              << "batch index = " << i << ", channel = " << c;
+            ASSERT_GE(output[i * output_stride() + c], output_min)
+              << "batch index = " << i << ", channel = " << c;
+          }
           ASSERT_NEAR(
               output_ref[i * output_channels() + c],
               output[i * output_stride() + c],
@@ -594,6 +794,9 @@ class FullyConnectedOperatorTester {
       if (weights_type() == WeightsType::FP32) {
         flags |= XNN_FLAG_FP32_STATIC_WEIGHTS;
       }
+      if (defer_packing()) {
+        flags |= XNN_FLAG_DEFER_PACKING;
+      }
       const xnn_status status = xnn_create_fully_connected_nc_f16(
           input_channels(), output_channels(),
           input_stride(), output_stride(),
@@ -647,6 +850,14 @@ class FullyConnectedOperatorTester {
   uint8_t qmax_{255};
   bool transpose_weights_{false};
   bool has_bias_{true};
+  bool has_residual_{false};
   WeightsType weights_type_{WeightsType::Default};
+  bool autotune_{false};
+  bool defer_packing_{false};
+  bool prepacked_weights_{false};
+  bool huge_pages_{false};
+  size_t num_threads_{1};
+  bool check_split_k_{false};
+  bool expect_split_k_{false};
   size_t iterations_{1};
 };
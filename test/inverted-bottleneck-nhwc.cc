@@ -0,0 +1,143 @@
+// Copyright 2022 Google LLC
+//
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree.
+
+#include <gtest/gtest.h>
+
+#include "inverted-bottleneck-operator-tester.h"
+
+
+TEST(INVERTED_BOTTLENECK_NHWC_F32, 3x3) {
+  InvertedBottleneckOperatorTester()
+    .input_size(13, 14)
+    .padding(1)
+    .kernel_size(3)
+    .input_channels(7)
+    .expanded_channels(42)
+    .output_channels(9)
+    .iterations(3)
+    .TestF32();
+}
+
+TEST(INVERTED_BOTTLENECK_NHWC_F32, 3x3_without_padding) {
+  InvertedBottleneckOperatorTester()
+    .input_size(13, 14)
+    .kernel_size(3)
+    .input_channels(7)
+    .expanded_channels(42)
+    .output_channels(9)
+    .iterations(3)
+    .TestF32();
+}
+
+TEST(INVERTED_BOTTLENECK_NHWC_F32, 3x3_with_reflect_padding_unsupported) {
+  InvertedBottleneckOperatorTester()
+    .input_size(13, 14)
+    .padding(1)
+    .padding_mode(XNN_FLAG_REFLECT_PADDING)
+    .kernel_size(3)
+    .input_channels(7)
+    .expanded_channels(42)
+    .output_channels(9)
+    .TestF32();
+}
+
+TEST(INVERTED_BOTTLENECK_NHWC_F32, 3x3_with_symmetric_padding_unsupported) {
+  InvertedBottleneckOperatorTester()
+    .input_size(13, 14)
+    .padding(1)
+    .padding_mode(XNN_FLAG_SYMMETRIC_PADDING)
+    .kernel_size(3)
+    .input_channels(7)
+    .expanded_channels(42)
+    .output_channels(9)
+    .TestF32();
+}
+
+TEST(INVERTED_BOTTLENECK_NHWC_F32, 3x3_with_edge_padding_unsupported) {
+  InvertedBottleneckOperatorTester()
+    .input_size(13, 14)
+    .padding(1)
+    .padding_mode(XNN_FLAG_EDGE_PADDING)
+    .kernel_size(3)
+    .input_channels(7)
+    .expanded_channels(42)
+    .output_channels(9)
+    .TestF32();
+}
+
+TEST(INVERTED_BOTTLENECK_NHWC_F32, 3x3s2) {
+  InvertedBottleneckOperatorTester()
+    .input_size(13, 14)
+    .padding(1)
+    .kernel_size(3)
+    .subsampling(2)
+    .input_channels(7)
+    .expanded_channels(42)
+    .output_channels(9)
+    .iterations(3)
+    .TestF32();
+}
+
+TEST(INVERTED_BOTTLENECK_NHWC_F32, 3x3_with_dilation) {
+  InvertedBottleneckOperatorTester()
+    .input_size(13, 14)
+    .padding(2)
+    .kernel_size(3)
+    .dilation(2)
+    .input_channels(7)
+    .expanded_channels(42)
+    .output_channels(9)
+    .iterations(3)
+    .TestF32();
+}
+
+TEST(INVERTED_BOTTLENECK_NHWC_F32, 5x5) {
+  InvertedBottleneckOperatorTester()
+    .input_size(13, 14)
+    .padding(2)
+    .kernel_size(5)
+    .input_channels(7)
+    .expanded_channels(42)
+    .output_channels(9)
+    .iterations(3)
+    .TestF32();
+}
+
+TEST(INVERTED_BOTTLENECK_NHWC_F32, 3x3_with_batch) {
+  InvertedBottleneckOperatorTester()
+    .batch_size(3)
+    .input_size(13, 14)
+    .padding(1)
+    .kernel_size(3)
+    .input_channels(7)
+    .expanded_channels(42)
+    .output_channels(9)
+    .iterations(3)
+    .TestF32();
+}
+
+TEST(INVERTED_BOTTLENECK_NHWC_F32, large_image_in_multiple_strips) {
+  InvertedBottleneckOperatorTester()
+    .input_size(112, 112)
+    .padding(1)
+    .kernel_size(3)
+    .input_channels(16)
+    .expanded_channels(96)
+    .output_channels(24)
+    .TestF32();
+}
+
+TEST(INVERTED_BOTTLENECK_NHWC_F32, multithreaded) {
+  InvertedBottleneckOperatorTester()
+    .batch_size(2)
+    .input_size(56, 56)
+    .padding(1)
+    .kernel_size(3)
+    .input_channels(24)
+    .expanded_channels(144)
+    .output_channels(24)
+    .num_threads(4)
+    .TestF32();
+}
@@ -0,0 +1,309 @@
+// Copyright 2022 Google LLC
+//
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree.
+
+#pragma once
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <cstddef>
+#include <cstdlib>
+#include <functional>
+#include <limits>
+#include <memory>
+#include <random>
+#include <vector>
+
+#include <pthreadpool.h>
+
+#include <xnnpack.h>
+
+
+class InvertedBottleneckOperatorTester {
+ public:
+  inline InvertedBottleneckOperatorTester& padding(uint32_t padding) {
+    this->padding_ = padding;
+    return *this;
+  }
+
+  inline uint32_t padding() const {
+    return this->padding_;
+  }
+
+  inline InvertedBottleneckOperatorTester& padding_mode(uint32_t padding_mode) {
+    this->padding_mode_ = padding_mode;
+    return *this;
+  }
+
+  inline uint32_t padding_mode() const {
+    return this->padding_mode_;
+  }
+
+  inline InvertedBottleneckOperatorTester& input_size(uint32_t input_height, uint32_t input_width) {
+    assert(input_height >= 1);
+    assert(input_width >= 1);
+    this->input_height_ = input_height;
+    this->input_width_ = input_width;
+    return *this;
+  }
+
+  inline uint32_t input_height() const {
+    return this->input_height_;
+  }
+
+  inline uint32_t input_width() const {
+    return this->input_width_;
+  }
+
+  inline InvertedBottleneckOperatorTester& kernel_size(uint32_t kernel_size) {
+    assert(kernel_size >= 1);
+    this->kernel_size_ = kernel_size;
+    return *this;
+  }
+
+  inline uint32_t kernel_size() const {
+    return this->kernel_size_;
+  }
+
+  inline InvertedBottleneckOperatorTester& subsampling(uint32_t subsampling) {
+    assert(subsampling >= 1);
+    this->subsampling_ = subsampling;
+    return *this;
+  }
+
+  inline uint32_t subsampling() const {
+    return this->subsampling_;
+  }
+
+  inline InvertedBottleneckOperatorTester& dilation(uint32_t dilation) {
+    assert(dilation >= 1);
+    this->dilation_ = dilation;
+    return *this;
+  }
+
+  inline uint32_t dilation() const {
+    return this->dilation_;
+  }
+
+  inline InvertedBottleneckOperatorTester& input_channels(size_t input_channels) {
+    assert(input_channels >= 1);
+    this->input_channels_ = input_channels;
+    return *this;
+  }
+
+  inline size_t input_channels() const {
+    return this->input_channels_;
+  }
+
+  inline InvertedBottleneckOperatorTester& expanded_channels(size_t expanded_channels) {
+    assert(expanded_channels >= 1);
+    this->expanded_channels_ = expanded_channels;
+    return *this;
+  }
+
+  inline size_t expanded_channels() const {
+    return this->expanded_channels_;
+  }
+
+  inline InvertedBottleneckOperatorTester& output_channels(size_t output_channels) {
+    assert(output_channels >= 1);
+    this->output_channels_ = output_channels;
+    return *this;
+  }
+
+  inline size_t output_channels() const {
+    return this->output_channels_;
+  }
+
+  inline InvertedBottleneckOperatorTester& batch_size(size_t batch_size) {
+    assert(batch_size >= 1);
+    this->batch_size_ = batch_size;
+    return *this;
+  }
+
+  inline size_t batch_size() const {
+    return this->batch_size_;
+  }
+
+  inline InvertedBottleneckOperatorTester& num_threads(size_t num_threads) {
+    assert(num_threads >= 1);
+    this->num_threads_ = num_threads;
+    return *this;
+  }
+
+  inline size_t num_threads() const {
+    return this->num_threads_;
+  }
+
+  inline size_t output_height() const {
+    const size_t effective_kernel_size = (kernel_size() - 1) * dilation() + 1;
+    return (input_height() + 2 * padding() - effective_kernel_size) / subsampling() + 1;
+  }
+
+  inline size_t output_width() const {
+    const size_t effective_kernel_size = (kernel_size() - 1) * dilation() + 1;
+    return (input_width() + 2 * padding() - effective_kernel_size) / subsampling() + 1;
+  }
+
+  inline InvertedBottleneckOperatorTester& iterations(size_t iterations) {
+    this->iterations_ = iterations;
+    return *this;
+  }
+
+  inline size_t iterations() const {
+    return this->iterations_;
+  }
+
+  void TestF32() const {
+    std::random_device random_device;
+    auto rng = std::mt19937(random_device());
+    auto f32rng = std::bind(std::uniform_real_distribution<float>(-1.0f, 1.0f), std::ref(rng));
+
+    const size_t input_pixels = batch_size() * input_height() * input_width();
+    const size_t output_pixels = batch_size() * output_height() * output_width();
+    std::vector<float> input(XNN_EXTRA_BYTES / sizeof(float) + input_pixels * input_channels());
+    std::vector<float> expand_kernel(expanded_channels() * input_channels());
+    std::vector<float> expand_bias(expanded_channels());
+    std::vector<float> depthwise_kernel(kernel_size() * kernel_size() * expanded_channels());
+    std::vector<float> depthwise_bias(expanded_channels());
+    std::vector<float> project_kernel(output_channels() * expanded_channels());
+    std::vector<float> project_bias(output_channels());
+    std::vector<float> expanded(XNN_EXTRA_BYTES / sizeof(float) + input_pixels * expanded_channels());
+    std::vector<float> depthwise_output(XNN_EXTRA_BYTES / sizeof(float) + output_pixels * expanded_channels());
+    std::vector<float> output(output_pixels * output_channels());
+    std::vector<float> output_ref(output_pixels * output_channels());
+
+    std::unique_ptr<pthreadpool, decltype(&pthreadpool_destroy)> auto_threadpool(nullptr, pthreadpool_destroy);
+    if (num_threads() > 1) {
+      auto_threadpool.reset(pthreadpool_create(num_threads()));
+    }
+
+    for (size_t iteration = 0; iteration < iterations(); iteration++) {
+      std::generate(input.begin(), input.end(), std::ref(f32rng));
+      std::generate(expand_kernel.begin(), expand_kernel.end(), std::ref(f32rng));
+      std::generate(expand_bias.begin(), expand_bias.end(), std::ref(f32rng));
+      std::generate(depthwise_kernel.begin(), depthwise_kernel.end(), std::ref(f32rng));
+      std::generate(depthwise_bias.begin(), depthwise_bias.end(), std::ref(f32rng));
+      std::generate(project_kernel.begin(), project_kernel.end(), std::ref(f32rng));
+      std::generate(project_bias.begin(), project_bias.end(), std::ref(f32rng));
+      std::fill(output.begin(), output.end(), nanf(""));
+
+      ASSERT_EQ(xnn_status_success, xnn_initialize(nullptr /* allocator */));
+
+      // Compute reference results by running the three Convolution operators one after another.
+      xnn_operator_t ops[2][3] = {};
+      for (size_t i = 0; i < 2; i++) {
+        xnn_status status = xnn_create_convolution2d_nhwc_f32(
+          0, 0, 0, 0, 1, 1, 1, 1, 1, 1,
+          1, input_channels(), expanded_channels(),
+          input_channels(), expanded_channels(),
+          expand_kernel.data(), expand_bias.data(),
+          0.0f, 6.0f,
+          0, &ops[i][0]);
+        if (status == xnn_status_unsupported_hardware) {
+          GTEST_SKIP();
+        }
+        ASSERT_EQ(xnn_status_success, status);
+        ASSERT_EQ(xnn_status_success,
+          xnn_create_convolution2d_nhwc_f32(
+            padding(), padding(), padding(), padding(),
+            kernel_size(), kernel_size(),
+            subsampling(), subsampling(),
+            dilation(), dilation(),
+            expanded_channels(), 1, 1,
+            expanded_channels(), expanded_channels(),
+            depthwise_kernel.data(), depthwise_bias.data(),
+            0.0f, 6.0f,
+            XNN_FLAG_DEPTHWISE_CONVOLUTION | padding_mode(), &ops[i][1]));
+        ASSERT_EQ(xnn_status_success,
+          xnn_create_convolution2d_nhwc_f32(
+            0, 0, 0, 0, 1, 1, 1, 1, 1, 1,
+            1, expanded_channels(), output_channels(),
+            expanded_channels(), output_channels(),
+            project_kernel.data(), project_bias.data(),
+            -std::numeric_limits<float>::infinity(), std::numeric_limits<float>::infinity(),
+            0, &ops[i][2]));
+      }
+
+      std::unique_ptr<xnn_operator, decltype(&xnn_delete_operator)> auto_expand_op(ops[0][0], xnn_delete_operator);
+      std::unique_ptr<xnn_operator, decltype(&xnn_delete_operator)> auto_depthwise_op(ops[0][1], xnn_delete_operator);
+      std::unique_ptr<xnn_operator, decltype(&xnn_delete_operator)> auto_project_op(ops[0][2], xnn_delete_operator);
+
+      ASSERT_EQ(xnn_status_success,
+        xnn_setup_convolution2d_nhwc_f32(
+          ops[0][0], batch_size(), input_height(), input_width(),
+          input.data(), expanded.data(), nullptr /* thread pool */));
+      ASSERT_EQ(xnn_status_success, xnn_run_operator(ops[0][0], nullptr /* thread pool */));
+      ASSERT_EQ(xnn_status_success,
+        xnn_setup_convolution2d_nhwc_f32(
+          ops[0][1], batch_size(), input_height(), input_width(),
+          expanded.data(), depthwise_output.data(), nullptr /* thread pool */));
+      ASSERT_EQ(xnn_status_success, xnn_run_operator(ops[0][1], nullptr /* thread pool */));
+      ASSERT_EQ(xnn_status_success,
+        xnn_setup_convolution2d_nhwc_f32(
+          ops[0][2], batch_size(), output_height(), output_width(),
+          depthwise_output.data(), output_ref.data(), nullptr /* thread pool */));
+      ASSERT_EQ(xnn_status_success, xnn_run_operator(ops[0][2], nullptr /* thread pool */));
+
+      // Create, setup, run, and destroy Inverted Bottleneck operator.
+      xnn_operator_t inverted_bottleneck_op = nullptr;
+      if (padding_mode() != 0) {
+        // The fused operator can only pad the expanded tensor with zeroes.
+        ASSERT_EQ(xnn_status_unsupported_parameter,
+          xnn_create_inverted_bottleneck_nhwc_f32(
+            ops[1][0], ops[1][1], ops[1][2], 0, &inverted_bottleneck_op));
+        for (xnn_operator_t op : ops[1]) {
+          ASSERT_EQ(xnn_status_success, xnn_delete_operator(op));
+        }
+        continue;
+      }
+      ASSERT_EQ(xnn_status_success,
+        xnn_create_inverted_bottleneck_nhwc_f32(
+          ops[1][0], ops[1][1], ops[1][2], 0, &inverted_bottleneck_op));
+      ASSERT_NE(nullptr, inverted_bottleneck_op);
+
+      // Smart pointer to automatically delete inverted_bottleneck_op.
+      std::unique_ptr<xnn_operator, decltype(&xnn_delete_operator)> auto_inverted_bottleneck_op(inverted_bottleneck_op, xnn_delete_operator);
+
+      ASSERT_EQ(xnn_status_success,
+        xnn_setup_inverted_bottleneck_nhwc_f32(
+          inverted_bottleneck_op,
+          batch_size(), input_height(), input_width(),
+          input.data(), output.data(),
+          auto_threadpool.get()));
+
+      ASSERT_EQ(xnn_status_success,
+        xnn_run_operator(inverted_bottleneck_op, auto_threadpool.get()));
+
+      // Verify results.
+      for (size_t i = 0; i < output_pixels; i++) {
+        for (size_t c = 0; c < output_channels(); c++) {
+          ASSERT_NEAR(
+              output_ref[i * output_channels() + c],
+              output[i * output_channels() + c],
+              1.0e-5f * std::max(1.0f, std::abs(output_ref[i * output_channels() + c])))
+            << "pixel = " << i << ", channel = " << c;
+        }
+      }
+    }
+  }
+
+ private:
+  uint32_t padding_{0};
+  uint32_t padding_mode_{0};
+  uint32_t input_height_{1};
+  uint32_t input_width_{1};
+  uint32_t kernel_size_{3};
+  uint32_t subsampling_{1};
+  uint32_t dilation_{1};
+  size_t input_channels_{1};
+  size_t expanded_channels_{1};
+  size_t output_channels_{1};
+  size_t batch_size_{1};
+  size_t num_threads_{1};
+  size_t iterations_{1};
+};
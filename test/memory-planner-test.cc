@@ -49,6 +49,48 @@ TEST(MemoryPlanner, ValueLiveInfo) {
   xnn_release_value_allocation_tracker(&tracker);
 }
 
+TEST(MemoryPlanner, AliasedValueLiveInfo) {
+  EXPECT_EQ(xnn_status_success, xnn_initialize(nullptr /* allocator */));
+  // Create simple subgraph where it has 3 nodes and 4 tensors as illustrated below:
+  // T0 ----> N0 ----> T1  and T1 ----> N1 ----> T2  and T2 ----> N2 ----> T3
+  // T1 is an alias of T0 (e.g. a zero-copy slice), so T0 must stay live until N1.
+  struct xnn_subgraph subgraph;
+  subgraph.num_values = 4;
+  subgraph.num_nodes = 3;
+  struct xnn_node nodes[3];
+  for (uint32_t i = 0; i < 3; i++) {
+    nodes[i].num_inputs = 1;
+    nodes[i].inputs[0] = i;
+    nodes[i].num_outputs = 1;
+    nodes[i].outputs[0] = i + 1;
+  }
+  subgraph.nodes = nodes;
+
+  struct xnn_value_allocation_tracker tracker;
+  xnn_init_value_allocation_tracker(&tracker, &subgraph);
+  xnn_alias_value_allocation_tracker(&tracker, 0, 1);
+
+#if XNN_ENABLE_MEMOPT
+  EXPECT_EQ(0, tracker.usage[0].first_node);
+  EXPECT_EQ(1, tracker.usage[0].last_node);
+#endif
+
+  EXPECT_EQ(0, tracker.usage[1].first_node);
+  EXPECT_EQ(1, tracker.usage[1].last_node);
+
+  xnn_add_value_allocation_tracker(&tracker, 0, 64);
+  xnn_add_value_allocation_tracker(&tracker, 2, 64);
+  xnn_plan_value_allocation_tracker(&tracker);
+
+#if XNN_ENABLE_MEMOPT
+  // T0 and T2 are both live at N1, so they must not share memory.
+  EXPECT_EQ(128, tracker.mem_arena_size);
+  EXPECT_NE(tracker.usage[0].alloc_offset, tracker.usage[2].alloc_offset);
+#endif
+
+  xnn_release_value_allocation_tracker(&tracker);
+}
+
 TEST(MemoryPlanner, MemoryBlocksCoalescing) {
   EXPECT_EQ(xnn_status_success, xnn_initialize(nullptr /* allocator */));
   struct xnn_subgraph subgraph;
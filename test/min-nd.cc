@@ -0,0 +1,114 @@
+// Copyright 2022 Google LLC
+//
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree.
+
+#include <gtest/gtest.h>
+
+#include <vector>
+
+#include "reduce-operator-tester.h"
+
+constexpr size_t kDim1 = 3;
+constexpr size_t kDim2 = 5;
+constexpr size_t kDim3 = 4;
+constexpr size_t kDim4 = 7;
+constexpr size_t kDim5 = 2;
+constexpr size_t kDim6 = 3;
+
+
+TEST(MIN_ND_F32, reduce_1d) {
+  for (uint32_t axes_mask = 1; axes_mask < (UINT32_C(1) << 1); axes_mask++) {
+    std::vector<size_t> reduction_axes;
+    for (size_t axis = 0; axis < 1; axis++) {
+      if (axes_mask & (UINT32_C(1) << axis)) {
+        reduction_axes.push_back(axis);
+      }
+    }
+    ReduceOperatorTester()
+      .operation_type(ReduceOperatorTester::OperationType::Min)
+      .input_shape({kDim1})
+      .reduction_axes(reduction_axes)
+      .TestF32();
+  }
+}
+
+TEST(MIN_ND_F32, reduce_2d) {
+  for (uint32_t axes_mask = 1; axes_mask < (UINT32_C(1) << 2); axes_mask++) {
+    std::vector<size_t> reduction_axes;
+    for (size_t axis = 0; axis < 2; axis++) {
+      if (axes_mask & (UINT32_C(1) << axis)) {
+        reduction_axes.push_back(axis);
+      }
+    }
+    ReduceOperatorTester()
+      .operation_type(ReduceOperatorTester::OperationType::Min)
+      .input_shape({kDim1, kDim2})
+      .reduction_axes(reduction_axes)
+      .TestF32();
+  }
+}
+
+TEST(MIN_ND_F32, reduce_3d) {
+  for (uint32_t axes_mask = 1; axes_mask < (UINT32_C(1) << 3); axes_mask++) {
+    std::vector<size_t> reduction_axes;
+    for (size_t axis = 0; axis < 3; axis++) {
+      if (axes_mask & (UINT32_C(1) << axis)) {
+        reduction_axes.push_back(axis);
+      }
+    }
+    ReduceOperatorTester()
+      .operation_type(ReduceOperatorTester::OperationType::Min)
+      .input_shape({kDim1, kDim2, kDim3})
+      .reduction_axes(reduction_axes)
+      .TestF32();
+  }
+}
+
+TEST(MIN_ND_F32, reduce_4d) {
+  for (uint32_t axes_mask = 1; axes_mask < (UINT32_C(1) << 4); axes_mask++) {
+    std::vector<size_t> reduction_axes;
+    for (size_t axis = 0; axis < 4; axis++) {
+      if (axes_mask & (UINT32_C(1) << axis)) {
+        reduction_axes.push_back(axis);
+      }
+    }
+    ReduceOperatorTester()
+      .operation_type(ReduceOperatorTester::OperationType::Min)
+      .input_shape({kDim1, kDim2, kDim3, kDim4})
+      .reduction_axes(reduction_axes)
+      .TestF32();
+  }
+}
+
+TEST(MIN_ND_F32, reduce_5d) {
+  for (uint32_t axes_mask = 1; axes_mask < (UINT32_C(1) << 5); axes_mask++) {
+    std::vector<size_t> reduction_axes;
+    for (size_t axis = 0; axis < 5; axis++) {
+      if (axes_mask & (UINT32_C(1) << axis)) {
+        reduction_axes.push_back(axis);
+      }
+    }
+    ReduceOperatorTester()
+      .operation_type(ReduceOperatorTester::OperationType::Min)
+      .input_shape({kDim1, kDim2, kDim3, kDim4, kDim5})
+      .reduction_axes(reduction_axes)
+      .TestF32();
+  }
+}
+
+TEST(MIN_ND_F32, reduce_6d) {
+  for (uint32_t axes_mask = 1; axes_mask < (UINT32_C(1) << 6); axes_mask++) {
+    std::vector<size_t> reduction_axes;
+    for (size_t axis = 0; axis < 6; axis++) {
+      if (axes_mask & (UINT32_C(1) << axis)) {
+        reduction_axes.push_back(axis);
+      }
+    }
+    ReduceOperatorTester()
+      .operation_type(ReduceOperatorTester::OperationType::Min)
+      .input_shape({kDim1, kDim2, kDim3, kDim4, kDim5, kDim6})
+      .reduction_axes(reduction_axes)
+      .TestF32();
+  }
+}
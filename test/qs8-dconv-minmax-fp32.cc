@@ -0,0 +1,443 @@
+// Copyright 2022 Google LLC
+//
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree.
+
+#include <gtest/gtest.h>
+
+#include <xnnpack/common.h>
+#include <xnnpack/isa-checks.h>
+
+#include <xnnpack/conv.h>
+#include "dconv-microkernel-tester.h"
+
+
+#if XNN_ARCH_X86 || XNN_ARCH_X86_64
+  TEST(QS8_DCONV_MINMAX_FP32_2X8__SSE41, kernel_7x7_subsampling_2) {
+    TEST_REQUIRES_X86_SSE41;
+    DConvMicrokernelTester()
+      .nr(8)
+      .kernel_size(7)
+      .subsampling(2)
+      .padding_left(3)
+      .padding_right(3)
+      .input_channels(3)
+      .output_channels(8)
+      .input_width(16)
+      .Test(xnn_qs8_dconv_minmax_fp32_ukernel_2x8__sse41, xnn_init_qs8_conv_minmax_fp32_sse4_params, xnn_qs8_requantize_fp32);
+  }
+
+  TEST(QS8_DCONV_MINMAX_FP32_2X8__SSE41, kernel_4x4_subsampling_4) {
+    TEST_REQUIRES_X86_SSE41;
+    DConvMicrokernelTester()
+      .nr(8)
+      .kernel_size(4)
+      .subsampling(4)
+      .input_channels(3)
+      .output_channels(8)
+      .input_width(16)
+      .Test(xnn_qs8_dconv_minmax_fp32_ukernel_2x8__sse41, xnn_init_qs8_conv_minmax_fp32_sse4_params, xnn_qs8_requantize_fp32);
+  }
+
+  TEST(QS8_DCONV_MINMAX_FP32_2X8__SSE41, kernel_3x5) {
+    TEST_REQUIRES_X86_SSE41;
+    DConvMicrokernelTester()
+      .nr(8)
+      .kernel_height(3)
+      .kernel_width(5)
+      .subsampling(2)
+      .padding_left(2)
+      .padding_right(2)
+      .input_channels(3)
+      .output_channels(8)
+      .input_width(9)
+      .Test(xnn_qs8_dconv_minmax_fp32_ukernel_2x8__sse41, xnn_init_qs8_conv_minmax_fp32_sse4_params, xnn_qs8_requantize_fp32);
+  }
+
+  TEST(QS8_DCONV_MINMAX_FP32_2X8__SSE41, input_channels_le_4) {
+    TEST_REQUIRES_X86_SSE41;
+    for (size_t input_channels = 1; input_channels <= 4; input_channels++) {
+      DConvMicrokernelTester()
+        .nr(8)
+        .kernel_size(3)
+        .subsampling(2)
+        .padding_left(1)
+        .input_channels(input_channels)
+        .output_channels(8)
+        .input_width(9)
+        .Test(xnn_qs8_dconv_minmax_fp32_ukernel_2x8__sse41, xnn_init_qs8_conv_minmax_fp32_sse4_params, xnn_qs8_requantize_fp32);
+    }
+  }
+
+  TEST(QS8_DCONV_MINMAX_FP32_2X8__SSE41, input_width) {
+    TEST_REQUIRES_X86_SSE41;
+    for (size_t input_width = 1; input_width <= 17; input_width++) {
+      DConvMicrokernelTester()
+        .nr(8)
+        .kernel_size(3)
+        .subsampling(2)
+        .padding_left(1)
+        .padding_right(1)
+        .input_channels(3)
+        .output_channels(8)
+        .input_width(input_width)
+        .Test(xnn_qs8_dconv_minmax_fp32_ukernel_2x8__sse41, xnn_init_qs8_conv_minmax_fp32_sse4_params, xnn_qs8_requantize_fp32);
+    }
+  }
+
+  TEST(QS8_DCONV_MINMAX_FP32_2X8__SSE41, output_channels_lt_8) {
+    TEST_REQUIRES_X86_SSE41;
+    for (size_t output_channels = 1; output_channels < 8; output_channels++) {
+      DConvMicrokernelTester()
+        .nr(8)
+        .kernel_size(3)
+        .subsampling(2)
+        .padding_left(1)
+        .input_channels(3)
+        .output_channels(output_channels)
+        .input_width(7)
+        .Test(xnn_qs8_dconv_minmax_fp32_ukernel_2x8__sse41, xnn_init_qs8_conv_minmax_fp32_sse4_params, xnn_qs8_requantize_fp32);
+    }
+  }
+
+  TEST(QS8_DCONV_MINMAX_FP32_2X8__SSE41, output_channels_div_8) {
+    TEST_REQUIRES_X86_SSE41;
+    for (size_t output_channels = 16; output_channels <= 24; output_channels += 8) {
+      DConvMicrokernelTester()
+        .nr(8)
+        .kernel_size(3)
+        .subsampling(2)
+        .padding_left(1)
+        .input_channels(3)
+        .output_channels(output_channels)
+        .input_width(7)
+        .Test(xnn_qs8_dconv_minmax_fp32_ukernel_2x8__sse41, xnn_init_qs8_conv_minmax_fp32_sse4_params, xnn_qs8_requantize_fp32);
+    }
+  }
+
+  TEST(QS8_DCONV_MINMAX_FP32_2X8__SSE41, output_channels_gt_8) {
+    TEST_REQUIRES_X86_SSE41;
+    for (size_t output_channels = 9; output_channels < 16; output_channels++) {
+      DConvMicrokernelTester()
+        .nr(8)
+        .kernel_size(3)
+        .subsampling(2)
+        .padding_left(1)
+        .input_channels(3)
+        .output_channels(output_channels)
+        .input_width(7)
+        .Test(xnn_qs8_dconv_minmax_fp32_ukernel_2x8__sse41, xnn_init_qs8_conv_minmax_fp32_sse4_params, xnn_qs8_requantize_fp32);
+    }
+  }
+
+  TEST(QS8_DCONV_MINMAX_FP32_2X8__SSE41, padding_left) {
+    TEST_REQUIRES_X86_SSE41;
+    for (uint32_t padding_left = 0; padding_left <= 4; padding_left++) {
+      DConvMicrokernelTester()
+        .nr(8)
+        .kernel_size(5)
+        .subsampling(2)
+        .padding_left(padding_left)
+        .input_channels(3)
+        .output_channels(8)
+        .input_width(11)
+        .Test(xnn_qs8_dconv_minmax_fp32_ukernel_2x8__sse41, xnn_init_qs8_conv_minmax_fp32_sse4_params, xnn_qs8_requantize_fp32);
+    }
+  }
+
+  TEST(QS8_DCONV_MINMAX_FP32_2X8__SSE41, padding_top) {
+    TEST_REQUIRES_X86_SSE41;
+    for (uint32_t padding_top = 1; padding_top <= 4; padding_top++) {
+      DConvMicrokernelTester()
+        .nr(8)
+        .kernel_size(5)
+        .subsampling(2)
+        .padding_left(2)
+        .padding_top(padding_top)
+        .input_channels(3)
+        .output_channels(8)
+        .input_width(11)
+        .Test(xnn_qs8_dconv_minmax_fp32_ukernel_2x8__sse41, xnn_init_qs8_conv_minmax_fp32_sse4_params, xnn_qs8_requantize_fp32);
+    }
+  }
+
+  TEST(QS8_DCONV_MINMAX_FP32_2X8__SSE41, input_offset) {
+    TEST_REQUIRES_X86_SSE41;
+    DConvMicrokernelTester()
+      .nr(8)
+      .kernel_size(3)
+      .subsampling(2)
+      .padding_left(1)
+      .padding_top(1)
+      .input_channels(3)
+      .output_channels(8)
+      .input_width(9)
+      .input_offset(37)
+      .Test(xnn_qs8_dconv_minmax_fp32_ukernel_2x8__sse41, xnn_init_qs8_conv_minmax_fp32_sse4_params, xnn_qs8_requantize_fp32);
+  }
+
+  TEST(QS8_DCONV_MINMAX_FP32_2X8__SSE41, input_pixel_stride) {
+    TEST_REQUIRES_X86_SSE41;
+    DConvMicrokernelTester()
+      .nr(8)
+      .kernel_size(3)
+      .subsampling(2)
+      .padding_left(1)
+      .input_channels(3)
+      .input_pixel_stride(5)
+      .output_channels(8)
+      .input_width(9)
+      .Test(xnn_qs8_dconv_minmax_fp32_ukernel_2x8__sse41, xnn_init_qs8_conv_minmax_fp32_sse4_params, xnn_qs8_requantize_fp32);
+  }
+
+  TEST(QS8_DCONV_MINMAX_FP32_2X8__SSE41, output_pixel_stride) {
+    TEST_REQUIRES_X86_SSE41;
+    for (size_t output_channels = 1; output_channels <= 24; output_channels += 7) {
+      DConvMicrokernelTester()
+        .nr(8)
+        .kernel_size(3)
+        .subsampling(2)
+        .padding_left(1)
+        .input_channels(3)
+        .output_channels(output_channels)
+        .output_pixel_stride(27)
+        .input_width(9)
+        .Test(xnn_qs8_dconv_minmax_fp32_ukernel_2x8__sse41, xnn_init_qs8_conv_minmax_fp32_sse4_params, xnn_qs8_requantize_fp32);
+    }
+  }
+
+  TEST(QS8_DCONV_MINMAX_FP32_2X8__SSE41, qmin) {
+    TEST_REQUIRES_X86_SSE41;
+    DConvMicrokernelTester()
+      .nr(8)
+      .kernel_size(3)
+      .subsampling(2)
+      .padding_left(1)
+      .input_channels(3)
+      .output_channels(8)
+      .input_width(9)
+      .qmin(128)
+      .Test(xnn_qs8_dconv_minmax_fp32_ukernel_2x8__sse41, xnn_init_qs8_conv_minmax_fp32_sse4_params, xnn_qs8_requantize_fp32);
+  }
+
+  TEST(QS8_DCONV_MINMAX_FP32_2X8__SSE41, qmax) {
+    TEST_REQUIRES_X86_SSE41;
+    DConvMicrokernelTester()
+      .nr(8)
+      .kernel_size(3)
+      .subsampling(2)
+      .padding_left(1)
+      .input_channels(3)
+      .output_channels(8)
+      .input_width(9)
+      .qmax(128)
+      .Test(xnn_qs8_dconv_minmax_fp32_ukernel_2x8__sse41, xnn_init_qs8_conv_minmax_fp32_sse4_params, xnn_qs8_requantize_fp32);
+  }
+#endif  // XNN_ARCH_X86 || XNN_ARCH_X86_64
+
+
+TEST(QS8_DCONV_MINMAX_FP32_1X4__SCALAR_FMAGIC, kernel_7x7_subsampling_2) {
+  DConvMicrokernelTester()
+    .nr(4)
+    .kernel_size(7)
+    .subsampling(2)
+    .padding_left(3)
+    .padding_right(3)
+    .input_channels(3)
+    .output_channels(4)
+    .input_width(16)
+    .Test(xnn_qs8_dconv_minmax_fp32_ukernel_1x4__scalar_fmagic, xnn_init_qs8_conv_minmax_fp32_scalar_fmagic_params, xnn_qs8_requantize_fp32);
+}
+
+TEST(QS8_DCONV_MINMAX_FP32_1X4__SCALAR_FMAGIC, kernel_4x4_subsampling_4) {
+  DConvMicrokernelTester()
+    .nr(4)
+    .kernel_size(4)
+    .subsampling(4)
+    .input_channels(3)
+    .output_channels(4)
+    .input_width(16)
+    .Test(xnn_qs8_dconv_minmax_fp32_ukernel_1x4__scalar_fmagic, xnn_init_qs8_conv_minmax_fp32_scalar_fmagic_params, xnn_qs8_requantize_fp32);
+}
+
+TEST(QS8_DCONV_MINMAX_FP32_1X4__SCALAR_FMAGIC, kernel_3x5) {
+  DConvMicrokernelTester()
+    .nr(4)
+    .kernel_height(3)
+    .kernel_width(5)
+    .subsampling(2)
+    .padding_left(2)
+    .padding_right(2)
+    .input_channels(3)
+    .output_channels(4)
+    .input_width(9)
+    .Test(xnn_qs8_dconv_minmax_fp32_ukernel_1x4__scalar_fmagic, xnn_init_qs8_conv_minmax_fp32_scalar_fmagic_params, xnn_qs8_requantize_fp32);
+}
+
+TEST(QS8_DCONV_MINMAX_FP32_1X4__SCALAR_FMAGIC, input_channels_le_4) {
+  for (size_t input_channels = 1; input_channels <= 4; input_channels++) {
+    DConvMicrokernelTester()
+      .nr(4)
+      .kernel_size(3)
+      .subsampling(2)
+      .padding_left(1)
+      .input_channels(input_channels)
+      .output_channels(4)
+      .input_width(9)
+      .Test(xnn_qs8_dconv_minmax_fp32_ukernel_1x4__scalar_fmagic, xnn_init_qs8_conv_minmax_fp32_scalar_fmagic_params, xnn_qs8_requantize_fp32);
+  }
+}
+
+TEST(QS8_DCONV_MINMAX_FP32_1X4__SCALAR_FMAGIC, input_width) {
+  for (size_t input_width = 1; input_width <= 17; input_width++) {
+    DConvMicrokernelTester()
+      .nr(4)
+      .kernel_size(3)
+      .subsampling(2)
+      .padding_left(1)
+      .padding_right(1)
+      .input_channels(3)
+      .output_channels(4)
+      .input_width(input_width)
+      .Test(xnn_qs8_dconv_minmax_fp32_ukernel_1x4__scalar_fmagic, xnn_init_qs8_conv_minmax_fp32_scalar_fmagic_params, xnn_qs8_requantize_fp32);
+  }
+}
+
+TEST(QS8_DCONV_MINMAX_FP32_1X4__SCALAR_FMAGIC, output_channels_lt_4) {
+  for (size_t output_channels = 1; output_channels < 4; output_channels++) {
+    DConvMicrokernelTester()
+      .nr(4)
+      .kernel_size(3)
+      .subsampling(2)
+      .padding_left(1)
+      .input_channels(3)
+      .output_channels(output_channels)
+      .input_width(7)
+      .Test(xnn_qs8_dconv_minmax_fp32_ukernel_1x4__scalar_fmagic, xnn_init_qs8_conv_minmax_fp32_scalar_fmagic_params, xnn_qs8_requantize_fp32);
+  }
+}
+
+TEST(QS8_DCONV_MINMAX_FP32_1X4__SCALAR_FMAGIC, output_channels_div_4) {
+  for (size_t output_channels = 8; output_channels <= 12; output_channels += 4) {
+    DConvMicrokernelTester()
+      .nr(4)
+      .kernel_size(3)
+      .subsampling(2)
+      .padding_left(1)
+      .input_channels(3)
+      .output_channels(output_channels)
+      .input_width(7)
+      .Test(xnn_qs8_dconv_minmax_fp32_ukernel_1x4__scalar_fmagic, xnn_init_qs8_conv_minmax_fp32_scalar_fmagic_params, xnn_qs8_requantize_fp32);
+  }
+}
+
+TEST(QS8_DCONV_MINMAX_FP32_1X4__SCALAR_FMAGIC, output_channels_gt_4) {
+  for (size_t output_channels = 5; output_channels < 8; output_channels++) {
+    DConvMicrokernelTester()
+      .nr(4)
+      .kernel_size(3)
+      .subsampling(2)
+      .padding_left(1)
+      .input_channels(3)
+      .output_channels(output_channels)
+      .input_width(7)
+      .Test(xnn_qs8_dconv_minmax_fp32_ukernel_1x4__scalar_fmagic, xnn_init_qs8_conv_minmax_fp32_scalar_fmagic_params, xnn_qs8_requantize_fp32);
+  }
+}
+
+TEST(QS8_DCONV_MINMAX_FP32_1X4__SCALAR_FMAGIC, padding_left) {
+  for (uint32_t padding_left = 0; padding_left <= 4; padding_left++) {
+    DConvMicrokernelTester()
+      .nr(4)
+      .kernel_size(5)
+      .subsampling(2)
+      .padding_left(padding_left)
+      .input_channels(3)
+      .output_channels(4)
+      .input_width(11)
+      .Test(xnn_qs8_dconv_minmax_fp32_ukernel_1x4__scalar_fmagic, xnn_init_qs8_conv_minmax_fp32_scalar_fmagic_params, xnn_qs8_requantize_fp32);
+  }
+}
+
+TEST(QS8_DCONV_MINMAX_FP32_1X4__SCALAR_FMAGIC, padding_top) {
+  for (uint32_t padding_top = 1; padding_top <= 4; padding_top++) {
+    DConvMicrokernelTester()
+      .nr(4)
+      .kernel_size(5)
+      .subsampling(2)
+      .padding_left(2)
+      .padding_top(padding_top)
+      .input_channels(3)
+      .output_channels(4)
+      .input_width(11)
+      .Test(xnn_qs8_dconv_minmax_fp32_ukernel_1x4__scalar_fmagic, xnn_init_qs8_conv_minmax_fp32_scalar_fmagic_params, xnn_qs8_requantize_fp32);
+  }
+}
+
+TEST(QS8_DCONV_MINMAX_FP32_1X4__SCALAR_FMAGIC, input_offset) {
+  DConvMicrokernelTester()
+    .nr(4)
+    .kernel_size(3)
+    .subsampling(2)
+    .padding_left(1)
+    .padding_top(1)
+    .input_channels(3)
+    .output_channels(4)
+    .input_width(9)
+    .input_offset(37)
+    .Test(xnn_qs8_dconv_minmax_fp32_ukernel_1x4__scalar_fmagic, xnn_init_qs8_conv_minmax_fp32_scalar_fmagic_params, xnn_qs8_requantize_fp32);
+}
+
+TEST(QS8_DCONV_MINMAX_FP32_1X4__SCALAR_FMAGIC, input_pixel_stride) {
+  DConvMicrokernelTester()
+    .nr(4)
+    .kernel_size(3)
+    .subsampling(2)
+    .padding_left(1)
+    .input_channels(3)
+    .input_pixel_stride(5)
+    .output_channels(4)
+    .input_width(9)
+    .Test(xnn_qs8_dconv_minmax_fp32_ukernel_1x4__scalar_fmagic, xnn_init_qs8_conv_minmax_fp32_scalar_fmagic_params, xnn_qs8_requantize_fp32);
+}
+
+TEST(QS8_DCONV_MINMAX_FP32_1X4__SCALAR_FMAGIC, output_pixel_stride) {
+  for (size_t output_channels = 1; output_channels <= 12; output_channels += 3) {
+    DConvMicrokernelTester()
+      .nr(4)
+      .kernel_size(3)
+      .subsampling(2)
+      .padding_left(1)
+      .input_channels(3)
+      .output_channels(output_channels)
+      .output_pixel_stride(15)
+      .input_width(9)
+      .Test(xnn_qs8_dconv_minmax_fp32_ukernel_1x4__scalar_fmagic, xnn_init_qs8_conv_minmax_fp32_scalar_fmagic_params, xnn_qs8_requantize_fp32);
+  }
+}
+
+TEST(QS8_DCONV_MINMAX_FP32_1X4__SCALAR_FMAGIC, qmin) {
+  DConvMicrokernelTester()
+    .nr(4)
+    .kernel_size(3)
+    .subsampling(2)
+    .padding_left(1)
+    .input_channels(3)
+    .output_channels(4)
+    .input_width(9)
+    .qmin(128)
+    .Test(xnn_qs8_dconv_minmax_fp32_ukernel_1x4__scalar_fmagic, xnn_init_qs8_conv_minmax_fp32_scalar_fmagic_params, xnn_qs8_requantize_fp32);
+}
+
+TEST(QS8_DCONV_MINMAX_FP32_1X4__SCALAR_FMAGIC, qmax) {
+  DConvMicrokernelTester()
+    .nr(4)
+    .kernel_size(3)
+    .subsampling(2)
+    .padding_left(1)
+    .input_channels(3)
+    .output_channels(4)
+    .input_width(9)
+    .qmax(128)
+    .Test(xnn_qs8_dconv_minmax_fp32_ukernel_1x4__scalar_fmagic, xnn_init_qs8_conv_minmax_fp32_scalar_fmagic_params, xnn_qs8_requantize_fp32);
+}
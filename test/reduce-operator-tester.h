@@ -0,0 +1,472 @@
+// Copyright 2022 Google LLC
+//
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree.
+
+#pragma once
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <cstddef>
+#include <cstdlib>
+#include <functional>
+#include <initializer_list>
+#include <limits>
+#include <memory>
+#include <numeric>
+#include <random>
+#include <vector>
+
+#include <fp16.h>
+
+#include <xnnpack.h>
+
+
+class ReduceOperatorTester {
+ public:
+  enum class OperationType {
+    Unknown,
+    Max,
+    Mean,
+    Min,
+    Sum,
+  };
+
+  inline ReduceOperatorTester& input_shape(std::initializer_list<size_t> input_shape) {
+    assert(input_shape.size() <= XNN_MAX_TENSOR_DIMS);
+    this->input_shape_ = std::vector<size_t>(input_shape);
+    return *this;
+  }
+
+  inline const std::vector<size_t>& input_shape() const {
+    return this->input_shape_;
+  }
+
+  inline size_t num_input_dims() const {
+    return this->input_shape_.size();
+  }
+
+  inline size_t num_input_elements() const {
+    return std::accumulate(
+      this->input_shape_.cbegin(), this->input_shape_.cend(), size_t(1), std::multiplies<size_t>());
+  }
+
+  inline ReduceOperatorTester& reduction_axes(std::initializer_list<size_t> reduction_axes) {
+    assert(reduction_axes.size() <= XNN_MAX_TENSOR_DIMS);
+    this->reduction_axes_ = std::vector<size_t>(reduction_axes);
+    return *this;
+  }
+
+  inline ReduceOperatorTester& reduction_axes(const std::vector<size_t>& reduction_axes) {
+    assert(reduction_axes.size() <= XNN_MAX_TENSOR_DIMS);
+    this->reduction_axes_ = reduction_axes;
+    return *this;
+  }
+
+  inline const std::vector<size_t>& reduction_axes() const {
+    return this->reduction_axes_;
+  }
+
+  inline size_t num_reduction_axes() const {
+    return this->reduction_axes_.size();
+  }
+
+  inline bool is_reduced(size_t axis) const {
+    return std::find(this->reduction_axes_.cbegin(), this->reduction_axes_.cend(), axis) != this->reduction_axes_.cend();
+  }
+
+  inline size_t num_reduced_elements() const {
+    size_t elements = 1;
+    for (size_t axis : this->reduction_axes_) {
+      elements *= this->input_shape_[axis];
+    }
+    return elements;
+  }
+
+  inline size_t num_output_elements() const {
+    return num_input_elements() / num_reduced_elements();
+  }
+
+  inline ReduceOperatorTester& operation_type(OperationType operation_type) {
+    this->operation_type_ = operation_type;
+    return *this;
+  }
+
+  inline OperationType operation_type() const {
+    return this->operation_type_;
+  }
+
+  inline ReduceOperatorTester& input_scale(float input_scale) {
+    assert(input_scale > 0.0f);
+    assert(std::isnormal(input_scale));
+    this->input_scale_ = input_scale;
+    return *this;
+  }
+
+  inline float input_scale() const {
+    return this->input_scale_;
+  }
+
+  inline ReduceOperatorTester& input_zero_point(int8_t input_zero_point) {
+    this->input_zero_point_ = input_zero_point;
+    return *this;
+  }
+
+  inline int8_t input_zero_point() const {
+    return this->input_zero_point_;
+  }
+
+  inline ReduceOperatorTester& output_zero_point(int8_t output_zero_point) {
+    this->output_zero_point_ = output_zero_point;
+    return *this;
+  }
+
+  inline int8_t output_zero_point() const {
+    return this->output_zero_point_;
+  }
+
+  inline ReduceOperatorTester& iterations(size_t iterations) {
+    this->iterations_ = iterations;
+    return *this;
+  }
+
+  inline size_t iterations() const {
+    return this->iterations_;
+  }
+
+  void TestF16() const {
+    ASSERT_TRUE(operation_type() == OperationType::Mean || operation_type() == OperationType::Sum);
+
+    std::random_device random_device;
+    auto rng = std::mt19937(random_device());
+    auto f32rng = std::bind(std::uniform_real_distribution<float>(0.01f, 1.0f), rng);
+    auto f16rng = std::bind(fp16_ieee_from_fp32_value, f32rng);
+
+    std::vector<uint16_t> input(XNN_EXTRA_BYTES / sizeof(uint16_t) + num_input_elements());
+    std::vector<uint16_t> output(num_output_elements());
+    std::vector<float> output_ref(num_output_elements());
+    for (size_t iteration = 0; iteration < iterations(); iteration++) {
+      std::generate(input.begin(), input.end(), std::ref(f16rng));
+      std::fill(output.begin(), output.end(), UINT16_C(0x7E00) /* NaN */);
+
+      // Compute reference results.
+      std::fill(output_ref.begin(), output_ref.end(), 0.0f);
+      for (size_t i = 0; i < num_input_elements(); i++) {
+        output_ref[OutputIndex(i)] += fp16_ieee_to_fp32_value(input[i]);
+      }
+      if (operation_type() == OperationType::Mean) {
+        for (float& value : output_ref) {
+          value /= float(num_reduced_elements());
+        }
+      }
+
+      // Create, setup, run, and destroy a reduction operator.
+      ASSERT_EQ(xnn_status_success, xnn_initialize(nullptr /* allocator */));
+      xnn_operator_t reduce_op = nullptr;
+
+      xnn_status status = xnn_status_unsupported_parameter;
+      switch (operation_type()) {
+        case OperationType::Mean:
+          status = xnn_create_mean_nd_f16(0, &reduce_op);
+          break;
+        case OperationType::Sum:
+          status = xnn_create_sum_nd_f16(0, &reduce_op);
+          break;
+        default:
+          FAIL() << "Unsupported operation type";
+      }
+      if (status == xnn_status_unsupported_hardware) {
+        GTEST_SKIP();
+      }
+      ASSERT_EQ(xnn_status_success, status);
+      ASSERT_NE(nullptr, reduce_op);
+
+      // Smart pointer to automatically delete reduce_op.
+      std::unique_ptr<xnn_operator, decltype(&xnn_delete_operator)> auto_reduce_op(reduce_op, xnn_delete_operator);
+
+      switch (operation_type()) {
+        case OperationType::Mean:
+          ASSERT_EQ(xnn_status_success,
+            xnn_setup_mean_nd_f16(
+              reduce_op,
+              num_reduction_axes(), reduction_axes().data(),
+              num_input_dims(), input_shape().data(),
+              input.data(), output.data(),
+              nullptr /* thread pool */));
+          break;
+        case OperationType::Sum:
+          ASSERT_EQ(xnn_status_success,
+            xnn_setup_sum_nd_f16(
+              reduce_op,
+              num_reduction_axes(), reduction_axes().data(),
+              num_input_dims(), input_shape().data(),
+              input.data(), output.data(),
+              nullptr /* thread pool */));
+          break;
+        default:
+          FAIL() << "Unsupported operation type";
+      }
+
+      ASSERT_EQ(xnn_status_success,
+        xnn_run_operator(reduce_op, nullptr /* thread pool */));
+
+      // Verify results. Partial sums are accumulated in FP16, so the tolerance is relaxed for long reductions.
+      const float tolerance = num_reduced_elements() > 256 ? 3.0e-2f : 1.0e-2f;
+      for (size_t i = 0; i < num_output_elements(); i++) {
+        ASSERT_NEAR(fp16_ieee_to_fp32_value(output[i]), output_ref[i], std::max(1.0e-3f, std::abs(output_ref[i]) * tolerance))
+          << "at output index " << i << " / " << num_output_elements();
+      }
+    }
+  }
+
+  void TestF32() const {
+    std::random_device random_device;
+    auto rng = std::mt19937(random_device());
+    auto f32rng = std::bind(std::uniform_real_distribution<float>(-1.0f, 1.0f), rng);
+
+    std::vector<float> input(XNN_EXTRA_BYTES / sizeof(float) + num_input_elements());
+    std::vector<float> output(num_output_elements() + XNN_EXTRA_BYTES / sizeof(float));
+    std::vector<double> output_ref(num_output_elements());
+    std::vector<double> output_abs_ref(num_output_elements());
+    for (size_t iteration = 0; iteration < iterations(); iteration++) {
+      std::generate(input.begin(), input.end(), std::ref(f32rng));
+      std::fill(output.begin(), output.end(), std::nanf(""));
+
+      // Compute reference results.
+      switch (operation_type()) {
+        case OperationType::Max:
+          std::fill(output_ref.begin(), output_ref.end(), -std::numeric_limits<double>::infinity());
+          for (size_t i = 0; i < num_input_elements(); i++) {
+            output_ref[OutputIndex(i)] = std::max<double>(output_ref[OutputIndex(i)], input[i]);
+          }
+          break;
+        case OperationType::Min:
+          std::fill(output_ref.begin(), output_ref.end(), +std::numeric_limits<double>::infinity());
+          for (size_t i = 0; i < num_input_elements(); i++) {
+            output_ref[OutputIndex(i)] = std::min<double>(output_ref[OutputIndex(i)], input[i]);
+          }
+          break;
+        case OperationType::Mean:
+        case OperationType::Sum:
+          std::fill(output_ref.begin(), output_ref.end(), 0.0);
+          std::fill(output_abs_ref.begin(), output_abs_ref.end(), 0.0);
+          for (size_t i = 0; i < num_input_elements(); i++) {
+            output_ref[OutputIndex(i)] += double(input[i]);
+            output_abs_ref[OutputIndex(i)] += std::abs(double(input[i]));
+          }
+          if (operation_type() == OperationType::Mean) {
+            for (size_t i = 0; i < num_output_elements(); i++) {
+              output_ref[i] /= double(num_reduced_elements());
+              output_abs_ref[i] /= double(num_reduced_elements());
+            }
+          }
+          break;
+        case OperationType::Unknown:
+          FAIL() << "Unsupported operation type";
+      }
+
+      // Create, setup, run, and destroy a reduction operator.
+      ASSERT_EQ(xnn_status_success, xnn_initialize(nullptr /* allocator */));
+      xnn_operator_t reduce_op = nullptr;
+
+      switch (operation_type()) {
+        case OperationType::Max:
+          ASSERT_EQ(xnn_status_success, xnn_create_max_nd_f32(0, &reduce_op));
+          break;
+        case OperationType::Mean:
+          ASSERT_EQ(xnn_status_success, xnn_create_mean_nd_f32(0, &reduce_op));
+          break;
+        case OperationType::Min:
+          ASSERT_EQ(xnn_status_success, xnn_create_min_nd_f32(0, &reduce_op));
+          break;
+        case OperationType::Sum:
+          ASSERT_EQ(xnn_status_success, xnn_create_sum_nd_f32(0, &reduce_op));
+          break;
+        case OperationType::Unknown:
+          FAIL() << "Unsupported operation type";
+      }
+      ASSERT_NE(nullptr, reduce_op);
+
+      // Smart pointer to automatically delete reduce_op.
+      std::unique_ptr<xnn_operator, decltype(&xnn_delete_operator)> auto_reduce_op(reduce_op, xnn_delete_operator);
+
+      switch (operation_type()) {
+        case OperationType::Max:
+          ASSERT_EQ(xnn_status_success,
+            xnn_setup_max_nd_f32(
+              reduce_op,
+              num_reduction_axes(), reduction_axes().data(),
+              num_input_dims(), input_shape().data(),
+              input.data(), output.data(),
+              nullptr /* thread pool */));
+          break;
+        case OperationType::Mean:
+          ASSERT_EQ(xnn_status_success,
+            xnn_setup_mean_nd_f32(
+              reduce_op,
+              num_reduction_axes(), reduction_axes().data(),
+              num_input_dims(), input_shape().data(),
+              input.data(), output.data(),
+              nullptr /* thread pool */));
+          break;
+        case OperationType::Min:
+          ASSERT_EQ(xnn_status_success,
+            xnn_setup_min_nd_f32(
+              reduce_op,
+              num_reduction_axes(), reduction_axes().data(),
+              num_input_dims(), input_shape().data(),
+              input.data(), output.data(),
+              nullptr /* thread pool */));
+          break;
+        case OperationType::Sum:
+          ASSERT_EQ(xnn_status_success,
+            xnn_setup_sum_nd_f32(
+              reduce_op,
+              num_reduction_axes(), reduction_axes().data(),
+              num_input_dims(), input_shape().data(),
+              input.data(), output.data(),
+              nullptr /* thread pool */));
+          break;
+        case OperationType::Unknown:
+          FAIL() << "Unsupported operation type";
+      }
+
+      ASSERT_EQ(xnn_status_success,
+        xnn_run_operator(reduce_op, nullptr /* thread pool */));
+
+      // Verify results.
+      // Max and Min are exact, while the rounding error of Mean and Sum is bounded relative to the sum of magnitudes.
+      for (size_t i = 0; i < num_output_elements(); i++) {
+        if (operation_type() == OperationType::Max || operation_type() == OperationType::Min) {
+          ASSERT_EQ(output[i], output_ref[i])
+            << "at output index " << i << " / " << num_output_elements();
+        } else {
+          ASSERT_NEAR(output[i], output_ref[i], std::max(1.0e-6, output_abs_ref[i] * 1.0e-5))
+            << "at output index " << i << " / " << num_output_elements();
+        }
+      }
+    }
+  }
+
+  void TestQS8() const {
+    ASSERT_TRUE(operation_type() == OperationType::Mean || operation_type() == OperationType::Sum);
+
+    std::random_device random_device;
+    auto rng = std::mt19937(random_device());
+    auto i8rng = std::bind(
+      std::uniform_int_distribution<int32_t>(std::numeric_limits<int8_t>::min(), std::numeric_limits<int8_t>::max()), rng);
+
+    // Sums grow with the number of reduced elements: pick an output scale which keeps most of them in range.
+    const float output_scale = operation_type() == OperationType::Sum ?
+      input_scale() * std::sqrt(float(num_reduced_elements())) : input_scale() * 0.75f;
+
+    std::vector<int8_t> input(XNN_EXTRA_BYTES / sizeof(int8_t) + num_input_elements());
+    std::vector<int8_t> output(num_output_elements());
+    std::vector<float> output_ref(num_output_elements());
+    std::vector<int32_t> accumulator(num_output_elements());
+    for (size_t iteration = 0; iteration < iterations(); iteration++) {
+      std::generate(input.begin(), input.end(), std::ref(i8rng));
+      std::fill(output.begin(), output.end(), INT8_C(0xA5));
+
+      // Compute reference results.
+      std::fill(accumulator.begin(), accumulator.end(), 0);
+      for (size_t i = 0; i < num_input_elements(); i++) {
+        accumulator[OutputIndex(i)] += int32_t(input[i]) - int32_t(input_zero_point());
+      }
+      double scale = double(input_scale()) / double(output_scale);
+      if (operation_type() == OperationType::Mean) {
+        scale /= double(num_reduced_elements());
+      }
+      for (size_t i = 0; i < num_output_elements(); i++) {
+        output_ref[i] = float(double(accumulator[i]) * scale + double(output_zero_point()));
+        output_ref[i] = std::min<float>(output_ref[i], float(std::numeric_limits<int8_t>::max()));
+        output_ref[i] = std::max<float>(output_ref[i], float(std::numeric_limits<int8_t>::min()));
+      }
+
+      // Create, setup, run, and destroy a reduction operator.
+      ASSERT_EQ(xnn_status_success, xnn_initialize(nullptr /* allocator */));
+      xnn_operator_t reduce_op = nullptr;
+
+      switch (operation_type()) {
+        case OperationType::Mean:
+          ASSERT_EQ(xnn_status_success,
+            xnn_create_mean_nd_qs8(
+              input_zero_point(), input_scale(), output_zero_point(), output_scale,
+              0, &reduce_op));
+          break;
+        case OperationType::Sum:
+          ASSERT_EQ(xnn_status_success,
+            xnn_create_sum_nd_qs8(
+              input_zero_point(), input_scale(), output_zero_point(), output_scale,
+              0, &reduce_op));
+          break;
+        default:
+          FAIL() << "Unsupported operation type";
+      }
+      ASSERT_NE(nullptr, reduce_op);
+
+      // Smart pointer to automatically delete reduce_op.
+      std::unique_ptr<xnn_operator, decltype(&xnn_delete_operator)> auto_reduce_op(reduce_op, xnn_delete_operator);
+
+      switch (operation_type()) {
+        case OperationType::Mean:
+          ASSERT_EQ(xnn_status_success,
+            xnn_setup_mean_nd_qs8(
+              reduce_op,
+              num_reduction_axes(), reduction_axes().data(),
+              num_input_dims(), input_shape().data(),
+              input.data(), output.data(),
+              nullptr /* thread pool */));
+          break;
+        case OperationType::Sum:
+          ASSERT_EQ(xnn_status_success,
+            xnn_setup_sum_nd_qs8(
+              reduce_op,
+              num_reduction_axes(), reduction_axes().data(),
+              num_input_dims(), input_shape().data(),
+              input.data(), output.data(),
+              nullptr /* thread pool */));
+          break;
+        default:
+          FAIL() << "Unsupported operation type";
+      }
+
+      ASSERT_EQ(xnn_status_success,
+        xnn_run_operator(reduce_op, nullptr /* thread pool */));
+
+      // Verify results.
+      for (size_t i = 0; i < num_output_elements(); i++) {
+        ASSERT_NEAR(float(int32_t(output[i])), output_ref[i], 0.80f)
+          << "at output index " << i << " / " << num_output_elements();
+      }
+    }
+  }
+
+ private:
+  // Maps a linear input index to the linear index of the output element it is reduced into.
+  size_t OutputIndex(size_t input_index) const {
+    size_t output_index = 0;
+    size_t output_stride = 1;
+    for (size_t i = num_input_dims(); i != 0; i--) {
+      const size_t dim = input_shape()[i - 1];
+      const size_t coordinate = input_index % dim;
+      input_index /= dim;
+      if (!is_reduced(i - 1)) {
+        output_index += coordinate * output_stride;
+        output_stride *= dim;
+      }
+    }
+    return output_index;
+  }
+
+  std::vector<size_t> input_shape_;
+  std::vector<size_t> reduction_axes_;
+  OperationType operation_type_{OperationType::Unknown};
+  float input_scale_{0.75f};
+  int8_t input_zero_point_{-1};
+  int8_t output_zero_point_{1};
+  size_t iterations_{3};
+};
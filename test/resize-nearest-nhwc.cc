@@ -0,0 +1,1951 @@
+// Copyright 2022 Google LLC
+//
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree.
+
+#include <gtest/gtest.h>
+
+#include "resize-nearest-operator-tester.h"
+
+
+TEST(RESIZE_NEAREST_NHWC_X8, aligned_centers_upscale_y) {
+  for (size_t input_height = 1; input_height <= 3; input_height++) {
+    for (size_t output_height = input_height + 1; output_height < 15; output_height *= 3) {
+      ResizeNearestOperatorTester()
+        .input_size(input_height, 1)
+        .output_size(output_height, 1)
+        .channels(17)
+        .iterations(3)
+        .TestNHWCxX8();
+    }
+  }
+}
+
+TEST(RESIZE_NEAREST_NHWC_X8, aligned_centers_upscale_x) {
+  for (size_t input_width = 1; input_width <= 3; input_width++) {
+    for (size_t output_width = input_width + 1; output_width < 15; output_width *= 3) {
+      ResizeNearestOperatorTester()
+        .input_size(1, input_width)
+        .output_size(1, output_width)
+        .channels(17)
+        .iterations(3)
+        .TestNHWCxX8();
+    }
+  }
+}
+
+TEST(RESIZE_NEAREST_NHWC_X8, aligned_centers_upscale) {
+  for (size_t output_height = 3; output_height <= 5; output_height += 2) {
+    for (size_t output_width = 3; output_width <= 5; output_width += 2) {
+      ResizeNearestOperatorTester()
+        .input_size(2, 2)
+        .output_size(output_height, output_width)
+        .channels(17)
+        .iterations(3)
+        .TestNHWCxX8();
+    }
+  }
+}
+
+TEST(RESIZE_NEAREST_NHWC_X8, aligned_centers_integer_upscale) {
+  for (size_t height_scale = 1; height_scale <= 3; height_scale++) {
+    for (size_t width_scale = 1; width_scale <= 3; width_scale++) {
+      ResizeNearestOperatorTester()
+        .input_size(3, 5)
+        .output_size(3 * height_scale, 5 * width_scale)
+        .channels(17)
+        .iterations(3)
+        .TestNHWCxX8();
+    }
+  }
+}
+
+TEST(RESIZE_NEAREST_NHWC_X8, aligned_centers_downscale_y) {
+  for (size_t output_height = 1; output_height <= 3; output_height++) {
+    for (size_t input_height = output_height + 1; input_height < 15; input_height *= 3) {
+      ResizeNearestOperatorTester()
+        .input_size(input_height, 1)
+        .output_size(output_height, 1)
+        .channels(17)
+        .iterations(3)
+        .TestNHWCxX8();
+    }
+  }
+}
+
+TEST(RESIZE_NEAREST_NHWC_X8, aligned_centers_downscale_x) {
+  for (size_t output_width = 1; output_width <= 3; output_width++) {
+    for (size_t input_width = output_width + 1; input_width < 15; input_width *= 3) {
+      ResizeNearestOperatorTester()
+        .input_size(1, input_width)
+        .output_size(1, output_width)
+        .channels(17)
+        .iterations(3)
+        .TestNHWCxX8();
+    }
+  }
+}
+
+TEST(RESIZE_NEAREST_NHWC_X8, aligned_centers_downscale) {
+  for (size_t input_height = 3; input_height <= 5; input_height += 2) {
+    for (size_t input_width = 3; input_width <= 5; input_width += 2) {
+      ResizeNearestOperatorTester()
+        .input_size(input_height, input_width)
+        .output_size(2, 2)
+        .channels(17)
+        .iterations(3)
+        .TestNHWCxX8();
+    }
+  }
+}
+
+TEST(RESIZE_NEAREST_NHWC_X8, aligned_centers_identical_size) {
+  for (size_t height = 1; height < 10; height *= 3) {
+    for (size_t width = 1; width < 10; width *= 3) {
+      ResizeNearestOperatorTester()
+        .input_size(height, width)
+        .output_size(height, width)
+        .channels(17)
+        .iterations(3)
+        .TestNHWCxX8();
+    }
+  }
+}
+
+TEST(RESIZE_NEAREST_NHWC_X8, aligned_centers_varying_channels) {
+  for (size_t channels = 1; channels <= 25; channels += 3) {
+    ResizeNearestOperatorTester()
+      .input_size(2, 2)
+      .output_size(4, 6)
+      .channels(channels)
+      .iterations(3)
+      .TestNHWCxX8();
+  }
+}
+
+TEST(RESIZE_NEAREST_NHWC_X8, aligned_centers_with_input_stride) {
+  for (size_t channels = 1; channels <= 25; channels += 3) {
+    ResizeNearestOperatorTester()
+      .input_size(2, 2)
+      .output_size(4, 6)
+      .channels(channels)
+      .input_pixel_stride(29)
+      .iterations(3)
+      .TestNHWCxX8();
+  }
+}
+
+TEST(RESIZE_NEAREST_NHWC_X8, aligned_centers_with_output_stride) {
+  for (size_t channels = 1; channels <= 25; channels += 3) {
+    ResizeNearestOperatorTester()
+      .input_size(2, 2)
+      .output_size(4, 6)
+      .channels(channels)
+      .output_pixel_stride(29)
+      .iterations(3)
+      .TestNHWCxX8();
+  }
+}
+
+TEST(RESIZE_NEAREST_NHWC_X8, aligned_centers_varying_batch_size) {
+  for (size_t batch_size = 2; batch_size <= 3 * 3; batch_size *= 3) {
+    ResizeNearestOperatorTester()
+      .batch_size(batch_size)
+      .input_size(2, 2)
+      .output_size(4, 6)
+      .channels(17)
+      .iterations(3)
+      .TestNHWCxX8();
+  }
+}
+
+TEST(RESIZE_NEAREST_NHWC_X8, aligned_centers_varying_channels_fractional) {
+  for (size_t channels = 1; channels <= 25; channels += 3) {
+    ResizeNearestOperatorTester()
+      .input_size(3, 4)
+      .output_size(5, 7)
+      .channels(channels)
+      .iterations(3)
+      .TestNHWCxX8();
+  }
+}
+
+TEST(RESIZE_NEAREST_NHWC_X8, aligned_centers_with_input_stride_fractional) {
+  for (size_t channels = 1; channels <= 25; channels += 3) {
+    ResizeNearestOperatorTester()
+      .input_size(3, 4)
+      .output_size(5, 7)
+      .channels(channels)
+      .input_pixel_stride(29)
+      .iterations(3)
+      .TestNHWCxX8();
+  }
+}
+
+TEST(RESIZE_NEAREST_NHWC_X8, aligned_centers_with_output_stride_fractional) {
+  for (size_t channels = 1; channels <= 25; channels += 3) {
+    ResizeNearestOperatorTester()
+      .input_size(3, 4)
+      .output_size(5, 7)
+      .channels(channels)
+      .output_pixel_stride(29)
+      .iterations(3)
+      .TestNHWCxX8();
+  }
+}
+
+TEST(RESIZE_NEAREST_NHWC_X8, aligned_centers_varying_batch_size_fractional) {
+  for (size_t batch_size = 2; batch_size <= 3 * 3; batch_size *= 3) {
+    ResizeNearestOperatorTester()
+      .batch_size(batch_size)
+      .input_size(3, 4)
+      .output_size(5, 7)
+      .channels(17)
+      .iterations(3)
+      .TestNHWCxX8();
+  }
+}
+
+TEST(RESIZE_NEAREST_NHWC_X8, aligned_corners_upscale_y) {
+  for (size_t input_height = 1; input_height <= 3; input_height++) {
+    for (size_t output_height = input_height + 1; output_height < 15; output_height *= 3) {
+      ResizeNearestOperatorTester()
+        .input_size(input_height, 1)
+        .output_size(output_height, 1)
+        .channels(17)
+        .align_corners(true)
+        .iterations(3)
+        .TestNHWCxX8();
+    }
+  }
+}
+
+TEST(RESIZE_NEAREST_NHWC_X8, aligned_corners_upscale_x) {
+  for (size_t input_width = 1; input_width <= 3; input_width++) {
+    for (size_t output_width = input_width + 1; output_width < 15; output_width *= 3) {
+      ResizeNearestOperatorTester()
+        .input_size(1, input_width)
+        .output_size(1, output_width)
+        .channels(17)
+        .align_corners(true)
+        .iterations(3)
+        .TestNHWCxX8();
+    }
+  }
+}
+
+TEST(RESIZE_NEAREST_NHWC_X8, aligned_corners_upscale) {
+  for (size_t output_height = 3; output_height <= 5; output_height += 2) {
+    for (size_t output_width = 3; output_width <= 5; output_width += 2) {
+      ResizeNearestOperatorTester()
+        .input_size(2, 2)
+        .output_size(output_height, output_width)
+        .channels(17)
+        .align_corners(true)
+        .iterations(3)
+        .TestNHWCxX8();
+    }
+  }
+}
+
+TEST(RESIZE_NEAREST_NHWC_X8, aligned_corners_integer_upscale) {
+  for (size_t height_scale = 1; height_scale <= 3; height_scale++) {
+    for (size_t width_scale = 1; width_scale <= 3; width_scale++) {
+      ResizeNearestOperatorTester()
+        .input_size(3, 5)
+        .output_size(3 * height_scale, 5 * width_scale)
+        .channels(17)
+        .align_corners(true)
+        .iterations(3)
+        .TestNHWCxX8();
+    }
+  }
+}
+
+TEST(RESIZE_NEAREST_NHWC_X8, aligned_corners_downscale_y) {
+  for (size_t output_height = 1; output_height <= 3; output_height++) {
+    for (size_t input_height = output_height + 1; input_height < 15; input_height *= 3) {
+      ResizeNearestOperatorTester()
+        .input_size(input_height, 1)
+        .output_size(output_height, 1)
+        .channels(17)
+        .align_corners(true)
+        .iterations(3)
+        .TestNHWCxX8();
+    }
+  }
+}
+
+TEST(RESIZE_NEAREST_NHWC_X8, aligned_corners_downscale_x) {
+  for (size_t output_width = 1; output_width <= 3; output_width++) {
+    for (size_t input_width = output_width + 1; input_width < 15; input_width *= 3) {
+      ResizeNearestOperatorTester()
+        .input_size(1, input_width)
+        .output_size(1, output_width)
+        .channels(17)
+        .align_corners(true)
+        .iterations(3)
+        .TestNHWCxX8();
+    }
+  }
+}
+
+TEST(RESIZE_NEAREST_NHWC_X8, aligned_corners_downscale) {
+  for (size_t input_height = 3; input_height <= 5; input_height += 2) {
+    for (size_t input_width = 3; input_width <= 5; input_width += 2) {
+      ResizeNearestOperatorTester()
+        .input_size(input_height, input_width)
+        .output_size(2, 2)
+        .channels(17)
+        .align_corners(true)
+        .iterations(3)
+        .TestNHWCxX8();
+    }
+  }
+}
+
+TEST(RESIZE_NEAREST_NHWC_X8, aligned_corners_identical_size) {
+  for (size_t height = 1; height < 10; height *= 3) {
+    for (size_t width = 1; width < 10; width *= 3) {
+      ResizeNearestOperatorTester()
+        .input_size(height, width)
+        .output_size(height, width)
+        .channels(17)
+        .align_corners(true)
+        .iterations(3)
+        .TestNHWCxX8();
+    }
+  }
+}
+
+TEST(RESIZE_NEAREST_NHWC_X8, aligned_corners_varying_channels) {
+  for (size_t channels = 1; channels <= 25; channels += 3) {
+    ResizeNearestOperatorTester()
+      .input_size(2, 2)
+      .output_size(4, 6)
+      .channels(channels)
+      .align_corners(true)
+      .iterations(3)
+      .TestNHWCxX8();
+  }
+}
+
+TEST(RESIZE_NEAREST_NHWC_X8, aligned_corners_with_input_stride) {
+  for (size_t channels = 1; channels <= 25; channels += 3) {
+    ResizeNearestOperatorTester()
+      .input_size(2, 2)
+      .output_size(4, 6)
+      .channels(channels)
+      .input_pixel_stride(29)
+      .align_corners(true)
+      .iterations(3)
+      .TestNHWCxX8();
+  }
+}
+
+TEST(RESIZE_NEAREST_NHWC_X8, aligned_corners_with_output_stride) {
+  for (size_t channels = 1; channels <= 25; channels += 3) {
+    ResizeNearestOperatorTester()
+      .input_size(2, 2)
+      .output_size(4, 6)
+      .channels(channels)
+      .output_pixel_stride(29)
+      .align_corners(true)
+      .iterations(3)
+      .TestNHWCxX8();
+  }
+}
+
+TEST(RESIZE_NEAREST_NHWC_X8, aligned_corners_varying_batch_size) {
+  for (size_t batch_size = 2; batch_size <= 3 * 3; batch_size *= 3) {
+    ResizeNearestOperatorTester()
+      .batch_size(batch_size)
+      .input_size(2, 2)
+      .output_size(4, 6)
+      .channels(17)
+      .align_corners(true)
+      .iterations(3)
+      .TestNHWCxX8();
+  }
+}
+
+TEST(RESIZE_NEAREST_NHWC_X8, aligned_corners_varying_channels_fractional) {
+  for (size_t channels = 1; channels <= 25; channels += 3) {
+    ResizeNearestOperatorTester()
+      .input_size(3, 4)
+      .output_size(5, 7)
+      .channels(channels)
+      .align_corners(true)
+      .iterations(3)
+      .TestNHWCxX8();
+  }
+}
+
+TEST(RESIZE_NEAREST_NHWC_X8, aligned_corners_with_input_stride_fractional) {
+  for (size_t channels = 1; channels <= 25; channels += 3) {
+    ResizeNearestOperatorTester()
+      .input_size(3, 4)
+      .output_size(5, 7)
+      .channels(channels)
+      .input_pixel_stride(29)
+      .align_corners(true)
+      .iterations(3)
+      .TestNHWCxX8();
+  }
+}
+
+TEST(RESIZE_NEAREST_NHWC_X8, aligned_corners_with_output_stride_fractional) {
+  for (size_t channels = 1; channels <= 25; channels += 3) {
+    ResizeNearestOperatorTester()
+      .input_size(3, 4)
+      .output_size(5, 7)
+      .channels(channels)
+      .output_pixel_stride(29)
+      .align_corners(true)
+      .iterations(3)
+      .TestNHWCxX8();
+  }
+}
+
+TEST(RESIZE_NEAREST_NHWC_X8, aligned_corners_varying_batch_size_fractional) {
+  for (size_t batch_size = 2; batch_size <= 3 * 3; batch_size *= 3) {
+    ResizeNearestOperatorTester()
+      .batch_size(batch_size)
+      .input_size(3, 4)
+      .output_size(5, 7)
+      .channels(17)
+      .align_corners(true)
+      .iterations(3)
+      .TestNHWCxX8();
+  }
+}
+
+TEST(RESIZE_NEAREST_NHWC_X8, tf_mode_aligned_centers_upscale_y) {
+  for (size_t input_height = 1; input_height <= 3; input_height++) {
+    for (size_t output_height = input_height + 1; output_height < 15; output_height *= 3) {
+      ResizeNearestOperatorTester()
+        .input_size(input_height, 1)
+        .output_size(output_height, 1)
+        .channels(17)
+        .tf_legacy_mode(true)
+        .iterations(3)
+        .TestNHWCxX8();
+    }
+  }
+}
+
+TEST(RESIZE_NEAREST_NHWC_X8, tf_mode_aligned_centers_upscale_x) {
+  for (size_t input_width = 1; input_width <= 3; input_width++) {
+    for (size_t output_width = input_width + 1; output_width < 15; output_width *= 3) {
+      ResizeNearestOperatorTester()
+        .input_size(1, input_width)
+        .output_size(1, output_width)
+        .channels(17)
+        .tf_legacy_mode(true)
+        .iterations(3)
+        .TestNHWCxX8();
+    }
+  }
+}
+
+TEST(RESIZE_NEAREST_NHWC_X8, tf_mode_aligned_centers_upscale) {
+  for (size_t output_height = 3; output_height <= 5; output_height += 2) {
+    for (size_t output_width = 3; output_width <= 5; output_width += 2) {
+      ResizeNearestOperatorTester()
+        .input_size(2, 2)
+        .output_size(output_height, output_width)
+        .channels(17)
+        .tf_legacy_mode(true)
+        .iterations(3)
+        .TestNHWCxX8();
+    }
+  }
+}
+
+TEST(RESIZE_NEAREST_NHWC_X8, tf_mode_aligned_centers_integer_upscale) {
+  for (size_t height_scale = 1; height_scale <= 3; height_scale++) {
+    for (size_t width_scale = 1; width_scale <= 3; width_scale++) {
+      ResizeNearestOperatorTester()
+        .input_size(3, 5)
+        .output_size(3 * height_scale, 5 * width_scale)
+        .channels(17)
+        .tf_legacy_mode(true)
+        .iterations(3)
+        .TestNHWCxX8();
+    }
+  }
+}
+
+TEST(RESIZE_NEAREST_NHWC_X8, tf_mode_aligned_centers_downscale_y) {
+  for (size_t output_height = 1; output_height <= 3; output_height++) {
+    for (size_t input_height = output_height + 1; input_height < 15; input_height *= 3) {
+      ResizeNearestOperatorTester()
+        .input_size(input_height, 1)
+        .output_size(output_height, 1)
+        .channels(17)
+        .tf_legacy_mode(true)
+        .iterations(3)
+        .TestNHWCxX8();
+    }
+  }
+}
+
+TEST(RESIZE_NEAREST_NHWC_X8, tf_mode_aligned_centers_downscale_x) {
+  for (size_t output_width = 1; output_width <= 3; output_width++) {
+    for (size_t input_width = output_width + 1; input_width < 15; input_width *= 3) {
+      ResizeNearestOperatorTester()
+        .input_size(1, input_width)
+        .output_size(1, output_width)
+        .channels(17)
+        .tf_legacy_mode(true)
+        .iterations(3)
+        .TestNHWCxX8();
+    }
+  }
+}
+
+TEST(RESIZE_NEAREST_NHWC_X8, tf_mode_aligned_centers_downscale) {
+  for (size_t input_height = 3; input_height <= 5; input_height += 2) {
+    for (size_t input_width = 3; input_width <= 5; input_width += 2) {
+      ResizeNearestOperatorTester()
+        .input_size(input_height, input_width)
+        .output_size(2, 2)
+        .channels(17)
+        .tf_legacy_mode(true)
+        .iterations(3)
+        .TestNHWCxX8();
+    }
+  }
+}
+
+TEST(RESIZE_NEAREST_NHWC_X8, tf_mode_aligned_centers_identical_size) {
+  for (size_t height = 1; height < 10; height *= 3) {
+    for (size_t width = 1; width < 10; width *= 3) {
+      ResizeNearestOperatorTester()
+        .input_size(height, width)
+        .output_size(height, width)
+        .channels(17)
+        .tf_legacy_mode(true)
+        .iterations(3)
+        .TestNHWCxX8();
+    }
+  }
+}
+
+TEST(RESIZE_NEAREST_NHWC_X8, tf_mode_aligned_centers_varying_channels) {
+  for (size_t channels = 1; channels <= 25; channels += 3) {
+    ResizeNearestOperatorTester()
+      .input_size(2, 2)
+      .output_size(4, 6)
+      .channels(channels)
+      .tf_legacy_mode(true)
+      .iterations(3)
+      .TestNHWCxX8();
+  }
+}
+
+TEST(RESIZE_NEAREST_NHWC_X8, tf_mode_aligned_centers_with_input_stride) {
+  for (size_t channels = 1; channels <= 25; channels += 3) {
+    ResizeNearestOperatorTester()
+      .input_size(2, 2)
+      .output_size(4, 6)
+      .channels(channels)
+      .input_pixel_stride(29)
+      .tf_legacy_mode(true)
+      .iterations(3)
+      .TestNHWCxX8();
+  }
+}
+
+TEST(RESIZE_NEAREST_NHWC_X8, tf_mode_aligned_centers_with_output_stride) {
+  for (size_t channels = 1; channels <= 25; channels += 3) {
+    ResizeNearestOperatorTester()
+      .input_size(2, 2)
+      .output_size(4, 6)
+      .channels(channels)
+      .output_pixel_stride(29)
+      .tf_legacy_mode(true)
+      .iterations(3)
+      .TestNHWCxX8();
+  }
+}
+
+TEST(RESIZE_NEAREST_NHWC_X8, tf_mode_aligned_centers_varying_batch_size) {
+  for (size_t batch_size = 2; batch_size <= 3 * 3; batch_size *= 3) {
+    ResizeNearestOperatorTester()
+      .batch_size(batch_size)
+      .input_size(2, 2)
+      .output_size(4, 6)
+      .channels(17)
+      .tf_legacy_mode(true)
+      .iterations(3)
+      .TestNHWCxX8();
+  }
+}
+
+TEST(RESIZE_NEAREST_NHWC_X8, tf_mode_aligned_centers_varying_channels_fractional) {
+  for (size_t channels = 1; channels <= 25; channels += 3) {
+    ResizeNearestOperatorTester()
+      .input_size(3, 4)
+      .output_size(5, 7)
+      .channels(channels)
+      .tf_legacy_mode(true)
+      .iterations(3)
+      .TestNHWCxX8();
+  }
+}
+
+TEST(RESIZE_NEAREST_NHWC_X8, tf_mode_aligned_centers_with_input_stride_fractional) {
+  for (size_t channels = 1; channels <= 25; channels += 3) {
+    ResizeNearestOperatorTester()
+      .input_size(3, 4)
+      .output_size(5, 7)
+      .channels(channels)
+      .input_pixel_stride(29)
+      .tf_legacy_mode(true)
+      .iterations(3)
+      .TestNHWCxX8();
+  }
+}
+
+TEST(RESIZE_NEAREST_NHWC_X8, tf_mode_aligned_centers_with_output_stride_fractional) {
+  for (size_t channels = 1; channels <= 25; channels += 3) {
+    ResizeNearestOperatorTester()
+      .input_size(3, 4)
+      .output_size(5, 7)
+      .channels(channels)
+      .output_pixel_stride(29)
+      .tf_legacy_mode(true)
+      .iterations(3)
+      .TestNHWCxX8();
+  }
+}
+
+TEST(RESIZE_NEAREST_NHWC_X8, tf_mode_aligned_centers_varying_batch_size_fractional) {
+  for (size_t batch_size = 2; batch_size <= 3 * 3; batch_size *= 3) {
+    ResizeNearestOperatorTester()
+      .batch_size(batch_size)
+      .input_size(3, 4)
+      .output_size(5, 7)
+      .channels(17)
+      .tf_legacy_mode(true)
+      .iterations(3)
+      .TestNHWCxX8();
+  }
+}
+
+TEST(RESIZE_NEAREST_NHWC_X16, aligned_centers_upscale_y) {
+  for (size_t input_height = 1; input_height <= 3; input_height++) {
+    for (size_t output_height = input_height + 1; output_height < 15; output_height *= 3) {
+      ResizeNearestOperatorTester()
+        .input_size(input_height, 1)
+        .output_size(output_height, 1)
+        .channels(17)
+        .iterations(3)
+        .TestNHWCxX16();
+    }
+  }
+}
+
+TEST(RESIZE_NEAREST_NHWC_X16, aligned_centers_upscale_x) {
+  for (size_t input_width = 1; input_width <= 3; input_width++) {
+    for (size_t output_width = input_width + 1; output_width < 15; output_width *= 3) {
+      ResizeNearestOperatorTester()
+        .input_size(1, input_width)
+        .output_size(1, output_width)
+        .channels(17)
+        .iterations(3)
+        .TestNHWCxX16();
+    }
+  }
+}
+
+TEST(RESIZE_NEAREST_NHWC_X16, aligned_centers_upscale) {
+  for (size_t output_height = 3; output_height <= 5; output_height += 2) {
+    for (size_t output_width = 3; output_width <= 5; output_width += 2) {
+      ResizeNearestOperatorTester()
+        .input_size(2, 2)
+        .output_size(output_height, output_width)
+        .channels(17)
+        .iterations(3)
+        .TestNHWCxX16();
+    }
+  }
+}
+
+TEST(RESIZE_NEAREST_NHWC_X16, aligned_centers_integer_upscale) {
+  for (size_t height_scale = 1; height_scale <= 3; height_scale++) {
+    for (size_t width_scale = 1; width_scale <= 3; width_scale++) {
+      ResizeNearestOperatorTester()
+        .input_size(3, 5)
+        .output_size(3 * height_scale, 5 * width_scale)
+        .channels(17)
+        .iterations(3)
+        .TestNHWCxX16();
+    }
+  }
+}
+
+TEST(RESIZE_NEAREST_NHWC_X16, aligned_centers_downscale_y) {
+  for (size_t output_height = 1; output_height <= 3; output_height++) {
+    for (size_t input_height = output_height + 1; input_height < 15; input_height *= 3) {
+      ResizeNearestOperatorTester()
+        .input_size(input_height, 1)
+        .output_size(output_height, 1)
+        .channels(17)
+        .iterations(3)
+        .TestNHWCxX16();
+    }
+  }
+}
+
+TEST(RESIZE_NEAREST_NHWC_X16, aligned_centers_downscale_x) {
+  for (size_t output_width = 1; output_width <= 3; output_width++) {
+    for (size_t input_width = output_width + 1; input_width < 15; input_width *= 3) {
+      ResizeNearestOperatorTester()
+        .input_size(1, input_width)
+        .output_size(1, output_width)
+        .channels(17)
+        .iterations(3)
+        .TestNHWCxX16();
+    }
+  }
+}
+
+TEST(RESIZE_NEAREST_NHWC_X16, aligned_centers_downscale) {
+  for (size_t input_height = 3; input_height <= 5; input_height += 2) {
+    for (size_t input_width = 3; input_width <= 5; input_width += 2) {
+      ResizeNearestOperatorTester()
+        .input_size(input_height, input_width)
+        .output_size(2, 2)
+        .channels(17)
+        .iterations(3)
+        .TestNHWCxX16();
+    }
+  }
+}
+
+TEST(RESIZE_NEAREST_NHWC_X16, aligned_centers_identical_size) {
+  for (size_t height = 1; height < 10; height *= 3) {
+    for (size_t width = 1; width < 10; width *= 3) {
+      ResizeNearestOperatorTester()
+        .input_size(height, width)
+        .output_size(height, width)
+        .channels(17)
+        .iterations(3)
+        .TestNHWCxX16();
+    }
+  }
+}
+
+TEST(RESIZE_NEAREST_NHWC_X16, aligned_centers_varying_channels) {
+  for (size_t channels = 1; channels <= 25; channels += 3) {
+    ResizeNearestOperatorTester()
+      .input_size(2, 2)
+      .output_size(4, 6)
+      .channels(channels)
+      .iterations(3)
+      .TestNHWCxX16();
+  }
+}
+
+TEST(RESIZE_NEAREST_NHWC_X16, aligned_centers_with_input_stride) {
+  for (size_t channels = 1; channels <= 25; channels += 3) {
+    ResizeNearestOperatorTester()
+      .input_size(2, 2)
+      .output_size(4, 6)
+      .channels(channels)
+      .input_pixel_stride(29)
+      .iterations(3)
+      .TestNHWCxX16();
+  }
+}
+
+TEST(RESIZE_NEAREST_NHWC_X16, aligned_centers_with_output_stride) {
+  for (size_t channels = 1; channels <= 25; channels += 3) {
+    ResizeNearestOperatorTester()
+      .input_size(2, 2)
+      .output_size(4, 6)
+      .channels(channels)
+      .output_pixel_stride(29)
+      .iterations(3)
+      .TestNHWCxX16();
+  }
+}
+
+TEST(RESIZE_NEAREST_NHWC_X16, aligned_centers_varying_batch_size) {
+  for (size_t batch_size = 2; batch_size <= 3 * 3; batch_size *= 3) {
+    ResizeNearestOperatorTester()
+      .batch_size(batch_size)
+      .input_size(2, 2)
+      .output_size(4, 6)
+      .channels(17)
+      .iterations(3)
+      .TestNHWCxX16();
+  }
+}
+
+TEST(RESIZE_NEAREST_NHWC_X16, aligned_centers_varying_channels_fractional) {
+  for (size_t channels = 1; channels <= 25; channels += 3) {
+    ResizeNearestOperatorTester()
+      .input_size(3, 4)
+      .output_size(5, 7)
+      .channels(channels)
+      .iterations(3)
+      .TestNHWCxX16();
+  }
+}
+
+TEST(RESIZE_NEAREST_NHWC_X16, aligned_centers_with_input_stride_fractional) {
+  for (size_t channels = 1; channels <= 25; channels += 3) {
+    ResizeNearestOperatorTester()
+      .input_size(3, 4)
+      .output_size(5, 7)
+      .channels(channels)
+      .input_pixel_stride(29)
+      .iterations(3)
+      .TestNHWCxX16();
+  }
+}
+
+TEST(RESIZE_NEAREST_NHWC_X16, aligned_centers_with_output_stride_fractional) {
+  for (size_t channels = 1; channels <= 25; channels += 3) {
+    ResizeNearestOperatorTester()
+      .input_size(3, 4)
+      .output_size(5, 7)
+      .channels(channels)
+      .output_pixel_stride(29)
+      .iterations(3)
+      .TestNHWCxX16();
+  }
+}
+
+TEST(RESIZE_NEAREST_NHWC_X16, aligned_centers_varying_batch_size_fractional) {
+  for (size_t batch_size = 2; batch_size <= 3 * 3; batch_size *= 3) {
+    ResizeNearestOperatorTester()
+      .batch_size(batch_size)
+      .input_size(3, 4)
+      .output_size(5, 7)
+      .channels(17)
+      .iterations(3)
+      .TestNHWCxX16();
+  }
+}
+
+TEST(RESIZE_NEAREST_NHWC_X16, aligned_corners_upscale_y) {
+  for (size_t input_height = 1; input_height <= 3; input_height++) {
+    for (size_t output_height = input_height + 1; output_height < 15; output_height *= 3) {
+      ResizeNearestOperatorTester()
+        .input_size(input_height, 1)
+        .output_size(output_height, 1)
+        .channels(17)
+        .align_corners(true)
+        .iterations(3)
+        .TestNHWCxX16();
+    }
+  }
+}
+
+TEST(RESIZE_NEAREST_NHWC_X16, aligned_corners_upscale_x) {
+  for (size_t input_width = 1; input_width <= 3; input_width++) {
+    for (size_t output_width = input_width + 1; output_width < 15; output_width *= 3) {
+      ResizeNearestOperatorTester()
+        .input_size(1, input_width)
+        .output_size(1, output_width)
+        .channels(17)
+        .align_corners(true)
+        .iterations(3)
+        .TestNHWCxX16();
+    }
+  }
+}
+
+TEST(RESIZE_NEAREST_NHWC_X16, aligned_corners_upscale) {
+  for (size_t output_height = 3; output_height <= 5; output_height += 2) {
+    for (size_t output_width = 3; output_width <= 5; output_width += 2) {
+      ResizeNearestOperatorTester()
+        .input_size(2, 2)
+        .output_size(output_height, output_width)
+        .channels(17)
+        .align_corners(true)
+        .iterations(3)
+        .TestNHWCxX16();
+    }
+  }
+}
+
+TEST(RESIZE_NEAREST_NHWC_X16, aligned_corners_integer_upscale) {
+  for (size_t height_scale = 1; height_scale <= 3; height_scale++) {
+    for (size_t width_scale = 1; width_scale <= 3; width_scale++) {
+      ResizeNearestOperatorTester()
+        .input_size(3, 5)
+        .output_size(3 * height_scale, 5 * width_scale)
+        .channels(17)
+        .align_corners(true)
+        .iterations(3)
+        .TestNHWCxX16();
+    }
+  }
+}
+
+TEST(RESIZE_NEAREST_NHWC_X16, aligned_corners_downscale_y) {
+  for (size_t output_height = 1; output_height <= 3; output_height++) {
+    for (size_t input_height = output_height + 1; input_height < 15; input_height *= 3) {
+      ResizeNearestOperatorTester()
+        .input_size(input_height, 1)
+        .output_size(output_height, 1)
+        .channels(17)
+        .align_corners(true)
+        .iterations(3)
+        .TestNHWCxX16();
+    }
+  }
+}
+
+TEST(RESIZE_NEAREST_NHWC_X16, aligned_corners_downscale_x) {
+  for (size_t output_width = 1; output_width <= 3; output_width++) {
+    for (size_t input_width = output_width + 1; input_width < 15; input_width *= 3) {
+      ResizeNearestOperatorTester()
+        .input_size(1, input_width)
+        .output_size(1, output_width)
+        .channels(17)
+        .align_corners(true)
+        .iterations(3)
+        .TestNHWCxX16();
+    }
+  }
+}
+
+TEST(RESIZE_NEAREST_NHWC_X16, aligned_corners_downscale) {
+  for (size_t input_height = 3; input_height <= 5; input_height += 2) {
+    for (size_t input_width = 3; input_width <= 5; input_width += 2) {
+      ResizeNearestOperatorTester()
+        .input_size(input_height, input_width)
+        .output_size(2, 2)
+        .channels(17)
+        .align_corners(true)
+        .iterations(3)
+        .TestNHWCxX16();
+    }
+  }
+}
+
+TEST(RESIZE_NEAREST_NHWC_X16, aligned_corners_identical_size) {
+  for (size_t height = 1; height < 10; height *= 3) {
+    for (size_t width = 1; width < 10; width *= 3) {
+      ResizeNearestOperatorTester()
+        .input_size(height, width)
+        .output_size(height, width)
+        .channels(17)
+        .align_corners(true)
+        .iterations(3)
+        .TestNHWCxX16();
+    }
+  }
+}
+
+TEST(RESIZE_NEAREST_NHWC_X16, aligned_corners_varying_channels) {
+  for (size_t channels = 1; channels <= 25; channels += 3) {
+    ResizeNearestOperatorTester()
+      .input_size(2, 2)
+      .output_size(4, 6)
+      .channels(channels)
+      .align_corners(true)
+      .iterations(3)
+      .TestNHWCxX16();
+  }
+}
+
+TEST(RESIZE_NEAREST_NHWC_X16, aligned_corners_with_input_stride) {
+  for (size_t channels = 1; channels <= 25; channels += 3) {
+    ResizeNearestOperatorTester()
+      .input_size(2, 2)
+      .output_size(4, 6)
+      .channels(channels)
+      .input_pixel_stride(29)
+      .align_corners(true)
+      .iterations(3)
+      .TestNHWCxX16();
+  }
+}
+
+TEST(RESIZE_NEAREST_NHWC_X16, aligned_corners_with_output_stride) {
+  for (size_t channels = 1; channels <= 25; channels += 3) {
+    ResizeNearestOperatorTester()
+      .input_size(2, 2)
+      .output_size(4, 6)
+      .channels(channels)
+      .output_pixel_stride(29)
+      .align_corners(true)
+      .iterations(3)
+      .TestNHWCxX16();
+  }
+}
+
+TEST(RESIZE_NEAREST_NHWC_X16, aligned_corners_varying_batch_size) {
+  for (size_t batch_size = 2; batch_size <= 3 * 3; batch_size *= 3) {
+    ResizeNearestOperatorTester()
+      .batch_size(batch_size)
+      .input_size(2, 2)
+      .output_size(4, 6)
+      .channels(17)
+      .align_corners(true)
+      .iterations(3)
+      .TestNHWCxX16();
+  }
+}
+
+TEST(RESIZE_NEAREST_NHWC_X16, aligned_corners_varying_channels_fractional) {
+  for (size_t channels = 1; channels <= 25; channels += 3) {
+    ResizeNearestOperatorTester()
+      .input_size(3, 4)
+      .output_size(5, 7)
+      .channels(channels)
+      .align_corners(true)
+      .iterations(3)
+      .TestNHWCxX16();
+  }
+}
+
+TEST(RESIZE_NEAREST_NHWC_X16, aligned_corners_with_input_stride_fractional) {
+  for (size_t channels = 1; channels <= 25; channels += 3) {
+    ResizeNearestOperatorTester()
+      .input_size(3, 4)
+      .output_size(5, 7)
+      .channels(channels)
+      .input_pixel_stride(29)
+      .align_corners(true)
+      .iterations(3)
+      .TestNHWCxX16();
+  }
+}
+
+TEST(RESIZE_NEAREST_NHWC_X16, aligned_corners_with_output_stride_fractional) {
+  for (size_t channels = 1; channels <= 25; channels += 3) {
+    ResizeNearestOperatorTester()
+      .input_size(3, 4)
+      .output_size(5, 7)
+      .channels(channels)
+      .output_pixel_stride(29)
+      .align_corners(true)
+      .iterations(3)
+      .TestNHWCxX16();
+  }
+}
+
+TEST(RESIZE_NEAREST_NHWC_X16, aligned_corners_varying_batch_size_fractional) {
+  for (size_t batch_size = 2; batch_size <= 3 * 3; batch_size *= 3) {
+    ResizeNearestOperatorTester()
+      .batch_size(batch_size)
+      .input_size(3, 4)
+      .output_size(5, 7)
+      .channels(17)
+      .align_corners(true)
+      .iterations(3)
+      .TestNHWCxX16();
+  }
+}
+
+TEST(RESIZE_NEAREST_NHWC_X16, tf_mode_aligned_centers_upscale_y) {
+  for (size_t input_height = 1; input_height <= 3; input_height++) {
+    for (size_t output_height = input_height + 1; output_height < 15; output_height *= 3) {
+      ResizeNearestOperatorTester()
+        .input_size(input_height, 1)
+        .output_size(output_height, 1)
+        .channels(17)
+        .tf_legacy_mode(true)
+        .iterations(3)
+        .TestNHWCxX16();
+    }
+  }
+}
+
+TEST(RESIZE_NEAREST_NHWC_X16, tf_mode_aligned_centers_upscale_x) {
+  for (size_t input_width = 1; input_width <= 3; input_width++) {
+    for (size_t output_width = input_width + 1; output_width < 15; output_width *= 3) {
+      ResizeNearestOperatorTester()
+        .input_size(1, input_width)
+        .output_size(1, output_width)
+        .channels(17)
+        .tf_legacy_mode(true)
+        .iterations(3)
+        .TestNHWCxX16();
+    }
+  }
+}
+
+TEST(RESIZE_NEAREST_NHWC_X16, tf_mode_aligned_centers_upscale) {
+  for (size_t output_height = 3; output_height <= 5; output_height += 2) {
+    for (size_t output_width = 3; output_width <= 5; output_width += 2) {
+      ResizeNearestOperatorTester()
+        .input_size(2, 2)
+        .output_size(output_height, output_width)
+        .channels(17)
+        .tf_legacy_mode(true)
+        .iterations(3)
+        .TestNHWCxX16();
+    }
+  }
+}
+
+TEST(RESIZE_NEAREST_NHWC_X16, tf_mode_aligned_centers_integer_upscale) {
+  for (size_t height_scale = 1; height_scale <= 3; height_scale++) {
+    for (size_t width_scale = 1; width_scale <= 3; width_scale++) {
+      ResizeNearestOperatorTester()
+        .input_size(3, 5)
+        .output_size(3 * height_scale, 5 * width_scale)
+        .channels(17)
+        .tf_legacy_mode(true)
+        .iterations(3)
+        .TestNHWCxX16();
+    }
+  }
+}
+
+TEST(RESIZE_NEAREST_NHWC_X16, tf_mode_aligned_centers_downscale_y) {
+  for (size_t output_height = 1; output_height <= 3; output_height++) {
+    for (size_t input_height = output_height + 1; input_height < 15; input_height *= 3) {
+      ResizeNearestOperatorTester()
+        .input_size(input_height, 1)
+        .output_size(output_height, 1)
+        .channels(17)
+        .tf_legacy_mode(true)
+        .iterations(3)
+        .TestNHWCxX16();
+    }
+  }
+}
+
+TEST(RESIZE_NEAREST_NHWC_X16, tf_mode_aligned_centers_downscale_x) {
+  for (size_t output_width = 1; output_width <= 3; output_width++) {
+    for (size_t input_width = output_width + 1; input_width < 15; input_width *= 3) {
+      ResizeNearestOperatorTester()
+        .input_size(1, input_width)
+        .output_size(1, output_width)
+        .channels(17)
+        .tf_legacy_mode(true)
+        .iterations(3)
+        .TestNHWCxX16();
+    }
+  }
+}
+
+TEST(RESIZE_NEAREST_NHWC_X16, tf_mode_aligned_centers_downscale) {
+  for (size_t input_height = 3; input_height <= 5; input_height += 2) {
+    for (size_t input_width = 3; input_width <= 5; input_width += 2) {
+      ResizeNearestOperatorTester()
+        .input_size(input_height, input_width)
+        .output_size(2, 2)
+        .channels(17)
+        .tf_legacy_mode(true)
+        .iterations(3)
+        .TestNHWCxX16();
+    }
+  }
+}
+
+TEST(RESIZE_NEAREST_NHWC_X16, tf_mode_aligned_centers_identical_size) {
+  for (size_t height = 1; height < 10; height *= 3) {
+    for (size_t width = 1; width < 10; width *= 3) {
+      ResizeNearestOperatorTester()
+        .input_size(height, width)
+        .output_size(height, width)
+        .channels(17)
+        .tf_legacy_mode(true)
+        .iterations(3)
+        .TestNHWCxX16();
+    }
+  }
+}
+
+TEST(RESIZE_NEAREST_NHWC_X16, tf_mode_aligned_centers_varying_channels) {
+  for (size_t channels = 1; channels <= 25; channels += 3) {
+    ResizeNearestOperatorTester()
+      .input_size(2, 2)
+      .output_size(4, 6)
+      .channels(channels)
+      .tf_legacy_mode(true)
+      .iterations(3)
+      .TestNHWCxX16();
+  }
+}
+
+TEST(RESIZE_NEAREST_NHWC_X16, tf_mode_aligned_centers_with_input_stride) {
+  for (size_t channels = 1; channels <= 25; channels += 3) {
+    ResizeNearestOperatorTester()
+      .input_size(2, 2)
+      .output_size(4, 6)
+      .channels(channels)
+      .input_pixel_stride(29)
+      .tf_legacy_mode(true)
+      .iterations(3)
+      .TestNHWCxX16();
+  }
+}
+
+TEST(RESIZE_NEAREST_NHWC_X16, tf_mode_aligned_centers_with_output_stride) {
+  for (size_t channels = 1; channels <= 25; channels += 3) {
+    ResizeNearestOperatorTester()
+      .input_size(2, 2)
+      .output_size(4, 6)
+      .channels(channels)
+      .output_pixel_stride(29)
+      .tf_legacy_mode(true)
+      .iterations(3)
+      .TestNHWCxX16();
+  }
+}
+
+TEST(RESIZE_NEAREST_NHWC_X16, tf_mode_aligned_centers_varying_batch_size) {
+  for (size_t batch_size = 2; batch_size <= 3 * 3; batch_size *= 3) {
+    ResizeNearestOperatorTester()
+      .batch_size(batch_size)
+      .input_size(2, 2)
+      .output_size(4, 6)
+      .channels(17)
+      .tf_legacy_mode(true)
+      .iterations(3)
+      .TestNHWCxX16();
+  }
+}
+
+TEST(RESIZE_NEAREST_NHWC_X16, tf_mode_aligned_centers_varying_channels_fractional) {
+  for (size_t channels = 1; channels <= 25; channels += 3) {
+    ResizeNearestOperatorTester()
+      .input_size(3, 4)
+      .output_size(5, 7)
+      .channels(channels)
+      .tf_legacy_mode(true)
+      .iterations(3)
+      .TestNHWCxX16();
+  }
+}
+
+TEST(RESIZE_NEAREST_NHWC_X16, tf_mode_aligned_centers_with_input_stride_fractional) {
+  for (size_t channels = 1; channels <= 25; channels += 3) {
+    ResizeNearestOperatorTester()
+      .input_size(3, 4)
+      .output_size(5, 7)
+      .channels(channels)
+      .input_pixel_stride(29)
+      .tf_legacy_mode(true)
+      .iterations(3)
+      .TestNHWCxX16();
+  }
+}
+
+TEST(RESIZE_NEAREST_NHWC_X16, tf_mode_aligned_centers_with_output_stride_fractional) {
+  for (size_t channels = 1; channels <= 25; channels += 3) {
+    ResizeNearestOperatorTester()
+      .input_size(3, 4)
+      .output_size(5, 7)
+      .channels(channels)
+      .output_pixel_stride(29)
+      .tf_legacy_mode(true)
+      .iterations(3)
+      .TestNHWCxX16();
+  }
+}
+
+TEST(RESIZE_NEAREST_NHWC_X16, tf_mode_aligned_centers_varying_batch_size_fractional) {
+  for (size_t batch_size = 2; batch_size <= 3 * 3; batch_size *= 3) {
+    ResizeNearestOperatorTester()
+      .batch_size(batch_size)
+      .input_size(3, 4)
+      .output_size(5, 7)
+      .channels(17)
+      .tf_legacy_mode(true)
+      .iterations(3)
+      .TestNHWCxX16();
+  }
+}
+
+TEST(RESIZE_NEAREST_NHWC_X32, aligned_centers_upscale_y) {
+  for (size_t input_height = 1; input_height <= 3; input_height++) {
+    for (size_t output_height = input_height + 1; output_height < 15; output_height *= 3) {
+      ResizeNearestOperatorTester()
+        .input_size(input_height, 1)
+        .output_size(output_height, 1)
+        .channels(17)
+        .iterations(3)
+        .TestNHWCxX32();
+    }
+  }
+}
+
+TEST(RESIZE_NEAREST_NHWC_X32, aligned_centers_upscale_x) {
+  for (size_t input_width = 1; input_width <= 3; input_width++) {
+    for (size_t output_width = input_width + 1; output_width < 15; output_width *= 3) {
+      ResizeNearestOperatorTester()
+        .input_size(1, input_width)
+        .output_size(1, output_width)
+        .channels(17)
+        .iterations(3)
+        .TestNHWCxX32();
+    }
+  }
+}
+
+TEST(RESIZE_NEAREST_NHWC_X32, aligned_centers_upscale) {
+  for (size_t output_height = 3; output_height <= 5; output_height += 2) {
+    for (size_t output_width = 3; output_width <= 5; output_width += 2) {
+      ResizeNearestOperatorTester()
+        .input_size(2, 2)
+        .output_size(output_height, output_width)
+        .channels(17)
+        .iterations(3)
+        .TestNHWCxX32();
+    }
+  }
+}
+
+TEST(RESIZE_NEAREST_NHWC_X32, aligned_centers_integer_upscale) {
+  for (size_t height_scale = 1; height_scale <= 3; height_scale++) {
+    for (size_t width_scale = 1; width_scale <= 3; width_scale++) {
+      ResizeNearestOperatorTester()
+        .input_size(3, 5)
+        .output_size(3 * height_scale, 5 * width_scale)
+        .channels(17)
+        .iterations(3)
+        .TestNHWCxX32();
+    }
+  }
+}
+
+TEST(RESIZE_NEAREST_NHWC_X32, aligned_centers_downscale_y) {
+  for (size_t output_height = 1; output_height <= 3; output_height++) {
+    for (size_t input_height = output_height + 1; input_height < 15; input_height *= 3) {
+      ResizeNearestOperatorTester()
+        .input_size(input_height, 1)
+        .output_size(output_height, 1)
+        .channels(17)
+        .iterations(3)
+        .TestNHWCxX32();
+    }
+  }
+}
+
+TEST(RESIZE_NEAREST_NHWC_X32, aligned_centers_downscale_x) {
+  for (size_t output_width = 1; output_width <= 3; output_width++) {
+    for (size_t input_width = output_width + 1; input_width < 15; input_width *= 3) {
+      ResizeNearestOperatorTester()
+        .input_size(1, input_width)
+        .output_size(1, output_width)
+        .channels(17)
+        .iterations(3)
+        .TestNHWCxX32();
+    }
+  }
+}
+
+TEST(RESIZE_NEAREST_NHWC_X32, aligned_centers_downscale) {
+  for (size_t input_height = 3; input_height <= 5; input_height += 2) {
+    for (size_t input_width = 3; input_width <= 5; input_width += 2) {
+      ResizeNearestOperatorTester()
+        .input_size(input_height, input_width)
+        .output_size(2, 2)
+        .channels(17)
+        .iterations(3)
+        .TestNHWCxX32();
+    }
+  }
+}
+
+TEST(RESIZE_NEAREST_NHWC_X32, aligned_centers_identical_size) {
+  for (size_t height = 1; height < 10; height *= 3) {
+    for (size_t width = 1; width < 10; width *= 3) {
+      ResizeNearestOperatorTester()
+        .input_size(height, width)
+        .output_size(height, width)
+        .channels(17)
+        .iterations(3)
+        .TestNHWCxX32();
+    }
+  }
+}
+
+TEST(RESIZE_NEAREST_NHWC_X32, aligned_centers_varying_channels) {
+  for (size_t channels = 1; channels <= 25; channels += 3) {
+    ResizeNearestOperatorTester()
+      .input_size(2, 2)
+      .output_size(4, 6)
+      .channels(channels)
+      .iterations(3)
+      .TestNHWCxX32();
+  }
+}
+
+TEST(RESIZE_NEAREST_NHWC_X32, aligned_centers_with_input_stride) {
+  for (size_t channels = 1; channels <= 25; channels += 3) {
+    ResizeNearestOperatorTester()
+      .input_size(2, 2)
+      .output_size(4, 6)
+      .channels(channels)
+      .input_pixel_stride(29)
+      .iterations(3)
+      .TestNHWCxX32();
+  }
+}
+
+TEST(RESIZE_NEAREST_NHWC_X32, aligned_centers_with_output_stride) {
+  for (size_t channels = 1; channels <= 25; channels += 3) {
+    ResizeNearestOperatorTester()
+      .input_size(2, 2)
+      .output_size(4, 6)
+      .channels(channels)
+      .output_pixel_stride(29)
+      .iterations(3)
+      .TestNHWCxX32();
+  }
+}
+
+TEST(RESIZE_NEAREST_NHWC_X32, aligned_centers_varying_batch_size) {
+  for (size_t batch_size = 2; batch_size <= 3 * 3; batch_size *= 3) {
+    ResizeNearestOperatorTester()
+      .batch_size(batch_size)
+      .input_size(2, 2)
+      .output_size(4, 6)
+      .channels(17)
+      .iterations(3)
+      .TestNHWCxX32();
+  }
+}
+
+TEST(RESIZE_NEAREST_NHWC_X32, aligned_centers_varying_channels_fractional) {
+  for (size_t channels = 1; channels <= 25; channels += 3) {
+    ResizeNearestOperatorTester()
+      .input_size(3, 4)
+      .output_size(5, 7)
+      .channels(channels)
+      .iterations(3)
+      .TestNHWCxX32();
+  }
+}
+
+TEST(RESIZE_NEAREST_NHWC_X32, aligned_centers_with_input_stride_fractional) {
+  for (size_t channels = 1; channels <= 25; channels += 3) {
+    ResizeNearestOperatorTester()
+      .input_size(3, 4)
+      .output_size(5, 7)
+      .channels(channels)
+      .input_pixel_stride(29)
+      .iterations(3)
+      .TestNHWCxX32();
+  }
+}
+
+TEST(RESIZE_NEAREST_NHWC_X32, aligned_centers_with_output_stride_fractional) {
+  for (size_t channels = 1; channels <= 25; channels += 3) {
+    ResizeNearestOperatorTester()
+      .input_size(3, 4)
+      .output_size(5, 7)
+      .channels(channels)
+      .output_pixel_stride(29)
+      .iterations(3)
+      .TestNHWCxX32();
+  }
+}
+
+TEST(RESIZE_NEAREST_NHWC_X32, aligned_centers_varying_batch_size_fractional) {
+  for (size_t batch_size = 2; batch_size <= 3 * 3; batch_size *= 3) {
+    ResizeNearestOperatorTester()
+      .batch_size(batch_size)
+      .input_size(3, 4)
+      .output_size(5, 7)
+      .channels(17)
+      .iterations(3)
+      .TestNHWCxX32();
+  }
+}
+
+TEST(RESIZE_NEAREST_NHWC_X32, aligned_corners_upscale_y) {
+  for (size_t input_height = 1; input_height <= 3; input_height++) {
+    for (size_t output_height = input_height + 1; output_height < 15; output_height *= 3) {
+      ResizeNearestOperatorTester()
+        .input_size(input_height, 1)
+        .output_size(output_height, 1)
+        .channels(17)
+        .align_corners(true)
+        .iterations(3)
+        .TestNHWCxX32();
+    }
+  }
+}
+
+TEST(RESIZE_NEAREST_NHWC_X32, aligned_corners_upscale_x) {
+  for (size_t input_width = 1; input_width <= 3; input_width++) {
+    for (size_t output_width = input_width + 1; output_width < 15; output_width *= 3) {
+      ResizeNearestOperatorTester()
+        .input_size(1, input_width)
+        .output_size(1, output_width)
+        .channels(17)
+        .align_corners(true)
+        .iterations(3)
+        .TestNHWCxX32();
+    }
+  }
+}
+
+TEST(RESIZE_NEAREST_NHWC_X32, aligned_corners_upscale) {
+  for (size_t output_height = 3; output_height <= 5; output_height += 2) {
+    for (size_t output_width = 3; output_width <= 5; output_width += 2) {
+      ResizeNearestOperatorTester()
+        .input_size(2, 2)
+        .output_size(output_height, output_width)
+        .channels(17)
+        .align_corners(true)
+        .iterations(3)
+        .TestNHWCxX32();
+    }
+  }
+}
+
+TEST(RESIZE_NEAREST_NHWC_X32, aligned_corners_integer_upscale) {
+  for (size_t height_scale = 1; height_scale <= 3; height_scale++) {
+    for (size_t width_scale = 1; width_scale <= 3; width_scale++) {
+      ResizeNearestOperatorTester()
+        .input_size(3, 5)
+        .output_size(3 * height_scale, 5 * width_scale)
+        .channels(17)
+        .align_corners(true)
+        .iterations(3)
+        .TestNHWCxX32();
+    }
+  }
+}
+
+TEST(RESIZE_NEAREST_NHWC_X32, aligned_corners_downscale_y) {
+  for (size_t output_height = 1; output_height <= 3; output_height++) {
+    for (size_t input_height = output_height + 1; input_height < 15; input_height *= 3) {
+      ResizeNearestOperatorTester()
+        .input_size(input_height, 1)
+        .output_size(output_height, 1)
+        .channels(17)
+        .align_corners(true)
+        .iterations(3)
+        .TestNHWCxX32();
+    }
+  }
+}
+
+TEST(RESIZE_NEAREST_NHWC_X32, aligned_corners_downscale_x) {
+  for (size_t output_width = 1; output_width <= 3; output_width++) {
+    for (size_t input_width = output_width + 1; input_width < 15; input_width *= 3) {
+      ResizeNearestOperatorTester()
+        .input_size(1, input_width)
+        .output_size(1, output_width)
+        .channels(17)
+        .align_corners(true)
+        .iterations(3)
+        .TestNHWCxX32();
+    }
+  }
+}
+
+TEST(RESIZE_NEAREST_NHWC_X32, aligned_corners_downscale) {
+  for (size_t input_height = 3; input_height <= 5; input_height += 2) {
+    for (size_t input_width = 3; input_width <= 5; input_width += 2) {
+      ResizeNearestOperatorTester()
+        .input_size(input_height, input_width)
+        .output_size(2, 2)
+        .channels(17)
+        .align_corners(true)
+        .iterations(3)
+        .TestNHWCxX32();
+    }
+  }
+}
+
+TEST(RESIZE_NEAREST_NHWC_X32, aligned_corners_identical_size) {
+  for (size_t height = 1; height < 10; height *= 3) {
+    for (size_t width = 1; width < 10; width *= 3) {
+      ResizeNearestOperatorTester()
+        .input_size(height, width)
+        .output_size(height, width)
+        .channels(17)
+        .align_corners(true)
+        .iterations(3)
+        .TestNHWCxX32();
+    }
+  }
+}
+
+TEST(RESIZE_NEAREST_NHWC_X32, aligned_corners_varying_channels) {
+  for (size_t channels = 1; channels <= 25; channels += 3) {
+    ResizeNearestOperatorTester()
+      .input_size(2, 2)
+      .output_size(4, 6)
+      .channels(channels)
+      .align_corners(true)
+      .iterations(3)
+      .TestNHWCxX32();
+  }
+}
+
+TEST(RESIZE_NEAREST_NHWC_X32, aligned_corners_with_input_stride) {
+  for (size_t channels = 1; channels <= 25; channels += 3) {
+    ResizeNearestOperatorTester()
+      .input_size(2, 2)
+      .output_size(4, 6)
+      .channels(channels)
+      .input_pixel_stride(29)
+      .align_corners(true)
+      .iterations(3)
+      .TestNHWCxX32();
+  }
+}
+
+TEST(RESIZE_NEAREST_NHWC_X32, aligned_corners_with_output_stride) {
+  for (size_t channels = 1; channels <= 25; channels += 3) {
+    ResizeNearestOperatorTester()
+      .input_size(2, 2)
+      .output_size(4, 6)
+      .channels(channels)
+      .output_pixel_stride(29)
+      .align_corners(true)
+      .iterations(3)
+      .TestNHWCxX32();
+  }
+}
+
+TEST(RESIZE_NEAREST_NHWC_X32, aligned_corners_varying_batch_size) {
+  for (size_t batch_size = 2; batch_size <= 3 * 3; batch_size *= 3) {
+    ResizeNearestOperatorTester()
+      .batch_size(batch_size)
+      .input_size(2, 2)
+      .output_size(4, 6)
+      .channels(17)
+      .align_corners(true)
+      .iterations(3)
+      .TestNHWCxX32();
+  }
+}
+
+TEST(RESIZE_NEAREST_NHWC_X32, aligned_corners_varying_channels_fractional) {
+  for (size_t channels = 1; channels <= 25; channels += 3) {
+    ResizeNearestOperatorTester()
+      .input_size(3, 4)
+      .output_size(5, 7)
+      .channels(channels)
+      .align_corners(true)
+      .iterations(3)
+      .TestNHWCxX32();
+  }
+}
+
+TEST(RESIZE_NEAREST_NHWC_X32, aligned_corners_with_input_stride_fractional) {
+  for (size_t channels = 1; channels <= 25; channels += 3) {
+    ResizeNearestOperatorTester()
+      .input_size(3, 4)
+      .output_size(5, 7)
+      .channels(channels)
+      .input_pixel_stride(29)
+      .align_corners(true)
+      .iterations(3)
+      .TestNHWCxX32();
+  }
+}
+
+TEST(RESIZE_NEAREST_NHWC_X32, aligned_corners_with_output_stride_fractional) {
+  for (size_t channels = 1; channels <= 25; channels += 3) {
+    ResizeNearestOperatorTester()
+      .input_size(3, 4)
+      .output_size(5, 7)
+      .channels(channels)
+      .output_pixel_stride(29)
+      .align_corners(true)
+      .iterations(3)
+      .TestNHWCxX32();
+  }
+}
+
+TEST(RESIZE_NEAREST_NHWC_X32, aligned_corners_varying_batch_size_fractional) {
+  for (size_t batch_size = 2; batch_size <= 3 * 3; batch_size *= 3) {
+    ResizeNearestOperatorTester()
+      .batch_size(batch_size)
+      .input_size(3, 4)
+      .output_size(5, 7)
+      .channels(17)
+      .align_corners(true)
+      .iterations(3)
+      .TestNHWCxX32();
+  }
+}
+
+TEST(RESIZE_NEAREST_NHWC_X32, tf_mode_aligned_centers_upscale_y) {
+  for (size_t input_height = 1; input_height <= 3; input_height++) {
+    for (size_t output_height = input_height + 1; output_height < 15; output_height *= 3) {
+      ResizeNearestOperatorTester()
+        .input_size(input_height, 1)
+        .output_size(output_height, 1)
+        .channels(17)
+        .tf_legacy_mode(true)
+        .iterations(3)
+        .TestNHWCxX32();
+    }
+  }
+}
+
+TEST(RESIZE_NEAREST_NHWC_X32, tf_mode_aligned_centers_upscale_x) {
+  for (size_t input_width = 1; input_width <= 3; input_width++) {
+    for (size_t output_width = input_width + 1; output_width < 15; output_width *= 3) {
+      ResizeNearestOperatorTester()
+        .input_size(1, input_width)
+        .output_size(1, output_width)
+        .channels(17)
+        .tf_legacy_mode(true)
+        .iterations(3)
+        .TestNHWCxX32();
+    }
+  }
+}
+
+TEST(RESIZE_NEAREST_NHWC_X32, tf_mode_aligned_centers_upscale) {
+  for (size_t output_height = 3; output_height <= 5; output_height += 2) {
+    for (size_t output_width = 3; output_width <= 5; output_width += 2) {
+      ResizeNearestOperatorTester()
+        .input_size(2, 2)
+        .output_size(output_height, output_width)
+        .channels(17)
+        .tf_legacy_mode(true)
+        .iterations(3)
+        .TestNHWCxX32();
+    }
+  }
+}
+
+TEST(RESIZE_NEAREST_NHWC_X32, tf_mode_aligned_centers_integer_upscale) {
+  for (size_t height_scale = 1; height_scale <= 3; height_scale++) {
+    for (size_t width_scale = 1; width_scale <= 3; width_scale++) {
+      ResizeNearestOperatorTester()
+        .input_size(3, 5)
+        .output_size(3 * height_scale, 5 * width_scale)
+        .channels(17)
+        .tf_legacy_mode(true)
+        .iterations(3)
+        .TestNHWCxX32();
+    }
+  }
+}
+
+TEST(RESIZE_NEAREST_NHWC_X32, tf_mode_aligned_centers_downscale_y) {
+  for (size_t output_height = 1; output_height <= 3; output_height++) {
+    for (size_t input_height = output_height + 1; input_height < 15; input_height *= 3) {
+      ResizeNearestOperatorTester()
+        .input_size(input_height, 1)
+        .output_size(output_height, 1)
+        .channels(17)
+        .tf_legacy_mode(true)
+        .iterations(3)
+        .TestNHWCxX32();
+    }
+  }
+}
+
+TEST(RESIZE_NEAREST_NHWC_X32, tf_mode_aligned_centers_downscale_x) {
+  for (size_t output_width = 1; output_width <= 3; output_width++) {
+    for (size_t input_width = output_width + 1; input_width < 15; input_width *= 3) {
+      ResizeNearestOperatorTester()
+        .input_size(1, input_width)
+        .output_size(1, output_width)
+        .channels(17)
+        .tf_legacy_mode(true)
+        .iterations(3)
+        .TestNHWCxX32();
+    }
+  }
+}
+
+TEST(RESIZE_NEAREST_NHWC_X32, tf_mode_aligned_centers_downscale) {
+  for (size_t input_height = 3; input_height <= 5; input_height += 2) {
+    for (size_t input_width = 3; input_width <= 5; input_width += 2) {
+      ResizeNearestOperatorTester()
+        .input_size(input_height, input_width)
+        .output_size(2, 2)
+        .channels(17)
+        .tf_legacy_mode(true)
+        .iterations(3)
+        .TestNHWCxX32();
+    }
+  }
+}
+
+TEST(RESIZE_NEAREST_NHWC_X32, tf_mode_aligned_centers_identical_size) {
+  for (size_t height = 1; height < 10; height *= 3) {
+    for (size_t width = 1; width < 10; width *= 3) {
+      ResizeNearestOperatorTester()
+        .input_size(height, width)
+        .output_size(height, width)
+        .channels(17)
+        .tf_legacy_mode(true)
+        .iterations(3)
+        .TestNHWCxX32();
+    }
+  }
+}
+
+TEST(RESIZE_NEAREST_NHWC_X32, tf_mode_aligned_centers_varying_channels) {
+  for (size_t channels = 1; channels <= 25; channels += 3) {
+    ResizeNearestOperatorTester()
+      .input_size(2, 2)
+      .output_size(4, 6)
+      .channels(channels)
+      .tf_legacy_mode(true)
+      .iterations(3)
+      .TestNHWCxX32();
+  }
+}
+
+TEST(RESIZE_NEAREST_NHWC_X32, tf_mode_aligned_centers_with_input_stride) {
+  for (size_t channels = 1; channels <= 25; channels += 3) {
+    ResizeNearestOperatorTester()
+      .input_size(2, 2)
+      .output_size(4, 6)
+      .channels(channels)
+      .input_pixel_stride(29)
+      .tf_legacy_mode(true)
+      .iterations(3)
+      .TestNHWCxX32();
+  }
+}
+
+TEST(RESIZE_NEAREST_NHWC_X32, tf_mode_aligned_centers_with_output_stride) {
+  for (size_t channels = 1; channels <= 25; channels += 3) {
+    ResizeNearestOperatorTester()
+      .input_size(2, 2)
+      .output_size(4, 6)
+      .channels(channels)
+      .output_pixel_stride(29)
+      .tf_legacy_mode(true)
+      .iterations(3)
+      .TestNHWCxX32();
+  }
+}
+
+TEST(RESIZE_NEAREST_NHWC_X32, tf_mode_aligned_centers_varying_batch_size) {
+  for (size_t batch_size = 2; batch_size <= 3 * 3; batch_size *= 3) {
+    ResizeNearestOperatorTester()
+      .batch_size(batch_size)
+      .input_size(2, 2)
+      .output_size(4, 6)
+      .channels(17)
+      .tf_legacy_mode(true)
+      .iterations(3)
+      .TestNHWCxX32();
+  }
+}
+
+TEST(RESIZE_NEAREST_NHWC_X32, tf_mode_aligned_centers_varying_channels_fractional) {
+  for (size_t channels = 1; channels <= 25; channels += 3) {
+    ResizeNearestOperatorTester()
+      .input_size(3, 4)
+      .output_size(5, 7)
+      .channels(channels)
+      .tf_legacy_mode(true)
+      .iterations(3)
+      .TestNHWCxX32();
+  }
+}
+
+TEST(RESIZE_NEAREST_NHWC_X32, tf_mode_aligned_centers_with_input_stride_fractional) {
+  for (size_t channels = 1; channels <= 25; channels += 3) {
+    ResizeNearestOperatorTester()
+      .input_size(3, 4)
+      .output_size(5, 7)
+      .channels(channels)
+      .input_pixel_stride(29)
+      .tf_legacy_mode(true)
+      .iterations(3)
+      .TestNHWCxX32();
+  }
+}
+
+TEST(RESIZE_NEAREST_NHWC_X32, tf_mode_aligned_centers_with_output_stride_fractional) {
+  for (size_t channels = 1; channels <= 25; channels += 3) {
+    ResizeNearestOperatorTester()
+      .input_size(3, 4)
+      .output_size(5, 7)
+      .channels(channels)
+      .output_pixel_stride(29)
+      .tf_legacy_mode(true)
+      .iterations(3)
+      .TestNHWCxX32();
+  }
+}
+
+TEST(RESIZE_NEAREST_NHWC_X32, tf_mode_aligned_centers_varying_batch_size_fractional) {
+  for (size_t batch_size = 2; batch_size <= 3 * 3; batch_size *= 3) {
+    ResizeNearestOperatorTester()
+      .batch_size(batch_size)
+      .input_size(3, 4)
+      .output_size(5, 7)
+      .channels(17)
+      .tf_legacy_mode(true)
+      .iterations(3)
+      .TestNHWCxX32();
+  }
+}
+
+TEST(RESIZE_NEAREST_NHWC_X32, aligned_centers_setup_changing_input_size) {
+  ResizeNearestOperatorTester()
+    .input_size(3, 5)
+    .next_input_size(4, 6)
+    .output_size(12, 30)
+    .channels(17)
+    .iterations(3)
+    .TestSetupNHWCxX32();
+}
+
+TEST(RESIZE_NEAREST_NHWC_X32, aligned_centers_setup_changing_input_size_fractional) {
+  ResizeNearestOperatorTester()
+    .input_size(3, 5)
+    .next_input_size(5, 7)
+    .output_size(12, 30)
+    .channels(17)
+    .iterations(3)
+    .TestSetupNHWCxX32();
+}
+
+TEST(RESIZE_NEAREST_NHWC_X32, aligned_corners_setup_changing_input_size) {
+  ResizeNearestOperatorTester()
+    .input_size(3, 5)
+    .next_input_size(4, 6)
+    .output_size(12, 30)
+    .channels(17)
+    .align_corners(true)
+    .iterations(3)
+    .TestSetupNHWCxX32();
+}
+
+TEST(RESIZE_NEAREST_NHWC_X32, aligned_corners_setup_changing_input_size_fractional) {
+  ResizeNearestOperatorTester()
+    .input_size(3, 5)
+    .next_input_size(5, 7)
+    .output_size(12, 30)
+    .channels(17)
+    .align_corners(true)
+    .iterations(3)
+    .TestSetupNHWCxX32();
+}
+
+TEST(RESIZE_NEAREST_NHWC_X32, tf_mode_aligned_centers_setup_changing_input_size) {
+  ResizeNearestOperatorTester()
+    .input_size(3, 5)
+    .next_input_size(4, 6)
+    .output_size(12, 30)
+    .channels(17)
+    .tf_legacy_mode(true)
+    .iterations(3)
+    .TestSetupNHWCxX32();
+}
+
+TEST(RESIZE_NEAREST_NHWC_X32, tf_mode_aligned_centers_setup_changing_input_size_fractional) {
+  ResizeNearestOperatorTester()
+    .input_size(3, 5)
+    .next_input_size(5, 7)
+    .output_size(12, 30)
+    .channels(17)
+    .tf_legacy_mode(true)
+    .iterations(3)
+    .TestSetupNHWCxX32();
+}
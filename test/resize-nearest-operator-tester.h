@@ -0,0 +1,353 @@
+// Copyright 2022 Google LLC
+//
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree.
+
+#pragma once
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <functional>
+#include <limits>
+#include <memory>
+#include <random>
+#include <vector>
+
+#include <xnnpack.h>
+
+
+class ResizeNearestOperatorTester {
+ public:
+  inline ResizeNearestOperatorTester& input_size(size_t input_height, size_t input_width) {
+    assert(input_height >= 1);
+    assert(input_width >= 1);
+    this->input_height_ = input_height;
+    this->input_width_ = input_width;
+    return *this;
+  }
+
+  inline ResizeNearestOperatorTester& input_height(size_t input_height) {
+    assert(input_height >= 1);
+    this->input_height_ = input_height;
+    return *this;
+  }
+
+  inline size_t input_height() const {
+    return this->input_height_;
+  }
+
+  inline ResizeNearestOperatorTester& input_width(size_t input_width) {
+    assert(input_width >= 1);
+    this->input_width_ = input_width;
+    return *this;
+  }
+
+  inline size_t input_width() const {
+    return this->input_width_;
+  }
+
+  inline ResizeNearestOperatorTester& output_size(size_t output_height, size_t output_width) {
+    assert(output_height >= 1);
+    assert(output_width >= 1);
+    this->output_height_ = output_height;
+    this->output_width_ = output_width;
+    return *this;
+  }
+
+  inline ResizeNearestOperatorTester& output_height(size_t output_height) {
+    assert(output_height >= 1);
+    this->output_height_ = output_height;
+    return *this;
+  }
+
+  inline size_t output_height() const {
+    return this->output_height_;
+  }
+
+  inline ResizeNearestOperatorTester& output_width(size_t output_width) {
+    assert(output_width >= 1);
+    this->output_width_ = output_width;
+    return *this;
+  }
+
+  inline size_t output_width() const {
+    return this->output_width_;
+  }
+
+  inline ResizeNearestOperatorTester& channels(size_t channels) {
+    assert(channels != 0);
+    this->channels_ = channels;
+    return *this;
+  }
+
+  inline size_t channels() const {
+    return this->channels_;
+  }
+
+  inline ResizeNearestOperatorTester& batch_size(size_t batch_size) {
+    assert(batch_size != 0);
+    this->batch_size_ = batch_size;
+    return *this;
+  }
+
+  inline size_t batch_size() const {
+    return this->batch_size_;
+  }
+
+  inline ResizeNearestOperatorTester& input_pixel_stride(size_t input_pixel_stride) {
+    assert(input_pixel_stride != 0);
+    this->input_pixel_stride_ = input_pixel_stride;
+    return *this;
+  }
+
+  inline size_t input_pixel_stride() const {
+    if (this->input_pixel_stride_ == 0) {
+      return channels();
+    } else {
+      assert(this->input_pixel_stride_ >= channels());
+      return this->input_pixel_stride_;
+    }
+  }
+
+  inline ResizeNearestOperatorTester& output_pixel_stride(size_t output_pixel_stride) {
+    assert(output_pixel_stride != 0);
+    this->output_pixel_stride_ = output_pixel_stride;
+    return *this;
+  }
+
+  inline size_t output_pixel_stride() const {
+    if (this->output_pixel_stride_ == 0) {
+      return channels();
+    } else {
+      assert(this->output_pixel_stride_ >= channels());
+      return this->output_pixel_stride_;
+    }
+  }
+
+  inline ResizeNearestOperatorTester& next_input_size(size_t next_input_height, size_t next_input_width) {
+    assert(next_input_height >= 1);
+    assert(next_input_width >= 1);
+    this->next_input_height_ = next_input_height;
+    this->next_input_width_ = next_input_width;
+    return *this;
+  }
+
+  inline size_t next_input_height() const {
+    if (this->next_input_height_ == 0) {
+      return input_height();
+    } else {
+      return this->next_input_height_;
+    }
+  }
+
+  inline size_t next_input_width() const {
+    if (this->next_input_width_ == 0) {
+      return input_width();
+    } else {
+      return this->next_input_width_;
+    }
+  }
+
+  inline ResizeNearestOperatorTester& align_corners(bool align_corners) {
+    this->align_corners_ = align_corners;
+    return *this;
+  }
+
+  inline bool align_corners() const {
+    return this->align_corners_;
+  }
+
+  inline ResizeNearestOperatorTester& tf_legacy_mode(bool tf_legacy_mode) {
+    this->tf_legacy_mode_ = tf_legacy_mode;
+    return *this;
+  }
+
+  inline bool tf_legacy_mode() const {
+    return this->tf_legacy_mode_;
+  }
+
+  inline ResizeNearestOperatorTester& iterations(size_t iterations) {
+    this->iterations_ = iterations;
+    return *this;
+  }
+
+  inline size_t iterations() const {
+    return this->iterations_;
+  }
+
+  void TestNHWCxX8() const {
+    TestNHWC<uint8_t>(xnn_create_resize_nearest2d_nhwc_x8, xnn_setup_resize_nearest2d_nhwc_x8);
+  }
+
+  void TestNHWCxX16() const {
+    TestNHWC<uint16_t>(xnn_create_resize_nearest2d_nhwc_x16, xnn_setup_resize_nearest2d_nhwc_x16);
+  }
+
+  void TestNHWCxX32() const {
+    TestNHWC<uint32_t>(xnn_create_resize_nearest2d_nhwc_x32, xnn_setup_resize_nearest2d_nhwc_x32);
+  }
+
+  void TestSetupNHWCxX32() const {
+    if (align_corners()) {
+      ASSERT_FALSE(tf_legacy_mode());
+    }
+
+    std::random_device random_device;
+    auto rng = std::mt19937(random_device());
+    auto u32rng = std::bind(std::uniform_int_distribution<uint32_t>(), rng);
+
+    const size_t max_input_height = std::max(input_height(), next_input_height());
+    const size_t max_input_width = std::max(input_width(), next_input_width());
+    std::vector<uint32_t> input(XNN_EXTRA_BYTES / sizeof(uint32_t) +
+      (batch_size() * max_input_height * max_input_width - 1) * input_pixel_stride() + channels());
+    std::vector<uint32_t> output((batch_size() * output_height() * output_width() - 1) * output_pixel_stride() + channels());
+    for (size_t iteration = 0; iteration < iterations(); iteration++) {
+      // Create, setup, and run Resize Nearest operator once.
+      ASSERT_EQ(xnn_status_success, xnn_initialize(nullptr /* allocator */));
+      xnn_operator_t resize_nearest_op = nullptr;
+
+      ASSERT_EQ(xnn_status_success,
+        xnn_create_resize_nearest2d_nhwc_x32(
+          channels(), input_pixel_stride(), output_pixel_stride(),
+          (align_corners() ? XNN_FLAG_ALIGN_CORNERS : 0) | (tf_legacy_mode() ? XNN_FLAG_TENSORFLOW_LEGACY_MODE : 0),
+          &resize_nearest_op));
+      ASSERT_NE(nullptr, resize_nearest_op);
+
+      // Smart pointer to automatically delete resize_nearest_op.
+      std::unique_ptr<xnn_operator, decltype(&xnn_delete_operator)> auto_resize_nearest_op(resize_nearest_op, xnn_delete_operator);
+
+      std::generate(input.begin(), input.end(), std::ref(u32rng));
+      ASSERT_EQ(xnn_status_success,
+        xnn_setup_resize_nearest2d_nhwc_x32(
+          resize_nearest_op,
+          batch_size(), input_height(), input_width(),
+          output_height(), output_width(),
+          input.data(), output.data(),
+          nullptr /* thread pool */));
+      ASSERT_EQ(xnn_status_success,
+        xnn_run_operator(resize_nearest_op, nullptr /* thread pool */));
+      VerifyNHWC(input, output, input_height(), input_width());
+
+      // Setup and run Resize Nearest operator the second time, and destroy the operator.
+      std::generate(input.begin(), input.end(), std::ref(u32rng));
+      ASSERT_EQ(xnn_status_success,
+        xnn_setup_resize_nearest2d_nhwc_x32(
+          resize_nearest_op,
+          batch_size(), next_input_height(), next_input_width(),
+          output_height(), output_width(),
+          input.data(), output.data(),
+          nullptr /* thread pool */));
+      ASSERT_EQ(xnn_status_success,
+        xnn_run_operator(resize_nearest_op, nullptr /* thread pool */));
+      VerifyNHWC(input, output, next_input_height(), next_input_width());
+    }
+  }
+
+ private:
+  // Index of the input pixel that TensorFlow Lite reads for the output pixel output_index along one dimension.
+  size_t NearestInputIndex(size_t output_index, size_t input_size, size_t output_size) const {
+    double input_index;
+    if (align_corners() && output_size > 1) {
+      input_index = std::round(double(output_index * (input_size - 1)) / double(output_size - 1));
+    } else if (align_corners() || tf_legacy_mode()) {
+      input_index = std::floor(double(output_index * input_size) / double(output_size));
+    } else {
+      input_index = std::floor(double((2 * output_index + 1) * input_size) / double(2 * output_size));
+    }
+    return std::min(size_t(input_index), input_size - 1);
+  }
+
+  template<class T>
+  void VerifyNHWC(
+    const std::vector<T>& input, const std::vector<T>& output,
+    size_t input_height, size_t input_width) const
+  {
+    for (size_t i = 0; i < batch_size(); i++) {
+      for (size_t y = 0; y < output_height(); y++) {
+        const size_t input_y = NearestInputIndex(y, input_height, output_height());
+        for (size_t x = 0; x < output_width(); x++) {
+          const size_t input_x = NearestInputIndex(x, input_width, output_width());
+          for (size_t c = 0; c < channels(); c++) {
+            ASSERT_EQ(output[((i * output_height() + y) * output_width() + x) * output_pixel_stride() + c],
+                input[((i * input_height + input_y) * input_width + input_x) * input_pixel_stride() + c]) <<
+              "in batch index " << i << ", pixel (" << y << ", " << x << "), channel " << c;
+          }
+        }
+      }
+    }
+  }
+
+  template<class T, class CreateFunction, class SetupFunction>
+  void TestNHWC(CreateFunction create_fn, SetupFunction setup_fn) const {
+    if (align_corners()) {
+      ASSERT_FALSE(tf_legacy_mode());
+    }
+
+    std::random_device random_device;
+    auto rng = std::mt19937(random_device());
+    auto trng = std::bind(std::uniform_int_distribution<uint32_t>(0, std::numeric_limits<T>::max()), rng);
+
+    std::vector<T> input((batch_size() * input_height() * input_width() - 1) * input_pixel_stride() + channels() + XNN_EXTRA_BYTES / sizeof(T));
+    std::vector<T> output((batch_size() * output_height() * output_width() - 1) * output_pixel_stride() + channels());
+    for (size_t iteration = 0; iteration < iterations(); iteration++) {
+      std::generate(input.begin(), input.end(), [&]() { return T(trng()); });
+      std::fill(output.begin(), output.end(), T(0xA5A5A5A5));
+
+      // Create, setup, run, and destroy Resize Nearest operator.
+      ASSERT_EQ(xnn_status_success, xnn_initialize(nullptr /* allocator */));
+      xnn_operator_t resize_nearest_op = nullptr;
+
+      ASSERT_EQ(xnn_status_success,
+        create_fn(
+          channels(), input_pixel_stride(), output_pixel_stride(),
+          (align_corners() ? XNN_FLAG_ALIGN_CORNERS : 0) | (tf_legacy_mode() ? XNN_FLAG_TENSORFLOW_LEGACY_MODE : 0),
+          &resize_nearest_op));
+      ASSERT_NE(nullptr, resize_nearest_op);
+
+      // Smart pointer to automatically delete resize_nearest_op.
+      std::unique_ptr<xnn_operator, decltype(&xnn_delete_operator)> auto_resize_nearest_op(resize_nearest_op, xnn_delete_operator);
+
+      ASSERT_EQ(xnn_status_success,
+        setup_fn(
+          resize_nearest_op,
+          batch_size(), input_height(), input_width(),
+          output_height(), output_width(),
+          input.data(), output.data(),
+          nullptr /* thread pool */));
+
+      ASSERT_EQ(xnn_status_success,
+        xnn_run_operator(resize_nearest_op, nullptr /* thread pool */));
+
+      // Verify results.
+      VerifyNHWC(input, output, input_height(), input_width());
+
+      // Verify that the padding between output pixels is intact.
+      for (size_t p = 0; p + 1 < batch_size() * output_height() * output_width(); p++) {
+        for (size_t c = channels(); c < output_pixel_stride(); c++) {
+          ASSERT_EQ(output[p * output_pixel_stride() + c], T(0xA5A5A5A5)) <<
+            "in output pixel " << p << ", padding element " << c;
+        }
+      }
+    }
+  }
+
+  size_t input_height_{1};
+  size_t input_width_{1};
+  size_t output_height_{1};
+  size_t output_width_{1};
+  size_t channels_{1};
+  size_t batch_size_{1};
+  size_t input_pixel_stride_{0};
+  size_t output_pixel_stride_{0};
+  size_t next_input_height_{0};
+  size_t next_input_width_{0};
+  bool align_corners_{false};
+  bool tf_legacy_mode_{false};
+  size_t iterations_{1};
+};
@@ -0,0 +1,73 @@
+// Copyright 2022 Google LLC
+//
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree.
+
+#pragma once
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <cstddef>
+#include <cstdlib>
+#include <functional>
+#include <limits>
+#include <random>
+#include <vector>
+
+#include <xnnpack/params.h>
+
+
+class RSumMicrokernelTester {
+ public:
+  inline RSumMicrokernelTester& n(size_t n) {
+    assert(n != 0);
+    this->n_ = n;
+    return *this;
+  }
+
+  inline size_t n() const {
+    return this->n_;
+  }
+
+  inline RSumMicrokernelTester& iterations(size_t iterations) {
+    this->iterations_ = iterations;
+    return *this;
+  }
+
+  inline size_t iterations() const {
+    return this->iterations_;
+  }
+
+  void Test(xnn_f32_rsum_ukernel_function rsum) const {
+    std::random_device random_device;
+    auto rng = std::mt19937(random_device());
+    auto f32rng = std::bind(std::uniform_real_distribution<float>(-1.0f, 1.0f), rng);
+
+    std::vector<float> x(n());
+    for (size_t iteration = 0; iteration < iterations(); iteration++) {
+      std::generate(x.begin(), x.end(), std::ref(f32rng));
+
+      // Compute reference results.
+      double y_ref = 0.0;
+      double y_abs = 0.0;
+      for (size_t i = 0; i < n(); i++) {
+        y_ref += double(x[i]);
+        y_abs += std::abs(double(x[i]));
+      }
+
+      // Call optimized micro-kernel.
+      float y = std::nanf("");
+      rsum(n() * sizeof(float), x.data(), &y);
+
+      // Verify results.
+      ASSERT_NEAR(y_ref, double(y), y_abs * 1.0e-5) << "n = " << n();
+    }
+  }
+
+ private:
+  size_t n_{1};
+  size_t iterations_{15};
+};
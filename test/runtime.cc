@@ -0,0 +1,814 @@
+// Copyright 2022 Google LLC
+//
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree.
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <limits>
+#include <memory>
+#include <random>
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <pthreadpool.h>
+
+#include <xnnpack.h>
+#include <xnnpack/operator.h>
+#include <xnnpack/subgraph.h>
+
+
+namespace {
+
+// Conv 3x3 -> Resize Bilinear -> Conv 1x1 network. Resize Bilinear operators re-create their packed weights in setup,
+// while Convolution operators pack their weights once.
+class ResizeNetwork {
+ public:
+  static constexpr size_t kHeight = 9;
+  static constexpr size_t kWidth = 13;
+  static constexpr size_t kChannels = 8;
+  static constexpr size_t kHiddenChannels = 16;
+  static constexpr size_t kOutputHeight = 2 * kHeight;
+  static constexpr size_t kOutputWidth = 2 * kWidth;
+  static constexpr uint32_t kInputId = 0;
+  static constexpr uint32_t kOutputId = 1;
+
+  ResizeNetwork() {
+    std::random_device random_device;
+    auto rng = std::mt19937(random_device());
+    auto f32rng = std::bind(std::uniform_real_distribution<float>(-1.0f, 1.0f), std::ref(rng));
+
+    conv1_filter_.resize(kHiddenChannels * 3 * 3 * kChannels);
+    conv1_bias_.resize(kHiddenChannels);
+    conv2_filter_.resize(kChannels * kHiddenChannels);
+    conv2_bias_.resize(kChannels);
+    std::generate(conv1_filter_.begin(), conv1_filter_.end(), std::ref(f32rng));
+    std::generate(conv1_bias_.begin(), conv1_bias_.end(), std::ref(f32rng));
+    std::generate(conv2_filter_.begin(), conv2_filter_.end(), std::ref(f32rng));
+    std::generate(conv2_bias_.begin(), conv2_bias_.end(), std::ref(f32rng));
+  }
+
+  size_t input_size() const {
+    return kHeight * kWidth * kChannels;
+  }
+
+  size_t output_size() const {
+    return kOutputHeight * kOutputWidth * kChannels;
+  }
+
+  xnn_subgraph_t CreateSubgraph() const {
+    xnn_subgraph_t subgraph = nullptr;
+    EXPECT_EQ(xnn_status_success, xnn_create_subgraph(2 /* external value IDs */, 0 /* flags */, &subgraph));
+
+    const std::array<size_t, 4> input_dims = {{1, kHeight, kWidth, kChannels}};
+    const std::array<size_t, 4> hidden_dims = {{1, kHeight, kWidth, kHiddenChannels}};
+    const std::array<size_t, 4> resized_dims = {{1, kOutputHeight, kOutputWidth, kHiddenChannels}};
+    const std::array<size_t, 4> output_dims = {{1, kOutputHeight, kOutputWidth, kChannels}};
+    const std::array<size_t, 4> conv1_filter_dims = {{kHiddenChannels, 3, 3, kChannels}};
+    const std::array<size_t, 1> conv1_bias_dims = {{kHiddenChannels}};
+    const std::array<size_t, 4> conv2_filter_dims = {{kChannels, 1, 1, kHiddenChannels}};
+    const std::array<size_t, 1> conv2_bias_dims = {{kChannels}};
+
+    uint32_t input_id = XNN_INVALID_VALUE_ID;
+    EXPECT_EQ(xnn_status_success, xnn_define_tensor_value(
+      subgraph, xnn_datatype_fp32, input_dims.size(), input_dims.data(), nullptr,
+      kInputId, XNN_VALUE_FLAG_EXTERNAL_INPUT, &input_id));
+    uint32_t output_id = XNN_INVALID_VALUE_ID;
+    EXPECT_EQ(xnn_status_success, xnn_define_tensor_value(
+      subgraph, xnn_datatype_fp32, output_dims.size(), output_dims.data(), nullptr,
+      kOutputId, XNN_VALUE_FLAG_EXTERNAL_OUTPUT, &output_id));
+
+    uint32_t conv1_filter_id = XNN_INVALID_VALUE_ID;
+    EXPECT_EQ(xnn_status_success, xnn_define_tensor_value(
+      subgraph, xnn_datatype_fp32, conv1_filter_dims.size(), conv1_filter_dims.data(), conv1_filter_.data(),
+      XNN_INVALID_VALUE_ID, 0 /* flags */, &conv1_filter_id));
+    uint32_t conv1_bias_id = XNN_INVALID_VALUE_ID;
+    EXPECT_EQ(xnn_status_success, xnn_define_tensor_value(
+      subgraph, xnn_datatype_fp32, conv1_bias_dims.size(), conv1_bias_dims.data(), conv1_bias_.data(),
+      XNN_INVALID_VALUE_ID, 0 /* flags */, &conv1_bias_id));
+    uint32_t hidden_id = XNN_INVALID_VALUE_ID;
+    EXPECT_EQ(xnn_status_success, xnn_define_tensor_value(
+      subgraph, xnn_datatype_fp32, hidden_dims.size(), hidden_dims.data(), nullptr,
+      XNN_INVALID_VALUE_ID, 0 /* flags */, &hidden_id));
+    EXPECT_EQ(xnn_status_success, xnn_define_convolution_2d(
+      subgraph,
+      1 /* top padding */, 1 /* right padding */, 1 /* bottom padding */, 1 /* left padding */,
+      3 /* kernel height */, 3 /* kernel width */,
+      1 /* subsampling height */, 1 /* subsampling width */,
+      1 /* dilation_height */, 1 /* dilation_width */,
+      1 /* groups */, kChannels /* input channels per group */, kHiddenChannels /* output_channels_per_group */,
+      -std::numeric_limits<float>::infinity(), std::numeric_limits<float>::infinity(),
+      input_id, conv1_filter_id, conv1_bias_id, hidden_id, 0 /* flags */));
+
+    uint32_t resized_id = XNN_INVALID_VALUE_ID;
+    EXPECT_EQ(xnn_status_success, xnn_define_tensor_value(
+      subgraph, xnn_datatype_fp32, resized_dims.size(), resized_dims.data(), nullptr,
+      XNN_INVALID_VALUE_ID, 0 /* flags */, &resized_id));
+    EXPECT_EQ(xnn_status_success, xnn_define_static_resize_bilinear_2d(
+      subgraph, kOutputHeight, kOutputWidth, hidden_id, resized_id, 0 /* flags */));
+
+    uint32_t conv2_filter_id = XNN_INVALID_VALUE_ID;
+    EXPECT_EQ(xnn_status_success, xnn_define_tensor_value(
+      subgraph, xnn_datatype_fp32, conv2_filter_dims.size(), conv2_filter_dims.data(), conv2_filter_.data(),
+      XNN_INVALID_VALUE_ID, 0 /* flags */, &conv2_filter_id));
+    uint32_t conv2_bias_id = XNN_INVALID_VALUE_ID;
+    EXPECT_EQ(xnn_status_success, xnn_define_tensor_value(
+      subgraph, xnn_datatype_fp32, conv2_bias_dims.size(), conv2_bias_dims.data(), conv2_bias_.data(),
+      XNN_INVALID_VALUE_ID, 0 /* flags */, &conv2_bias_id));
+    EXPECT_EQ(xnn_status_success, xnn_define_convolution_2d(
+      subgraph,
+      0 /* top padding */, 0 /* right padding */, 0 /* bottom padding */, 0 /* left padding */,
+      1 /* kernel height */, 1 /* kernel width */,
+      1 /* subsampling height */, 1 /* subsampling width */,
+      1 /* dilation_height */, 1 /* dilation_width */,
+      1 /* groups */, kHiddenChannels /* input channels per group */, kChannels /* output_channels_per_group */,
+      -std::numeric_limits<float>::infinity(), std::numeric_limits<float>::infinity(),
+      resized_id, conv2_filter_id, conv2_bias_id, output_id, 0 /* flags */));
+
+    return subgraph;
+  }
+
+  std::vector<float> RandomInput() const {
+    std::random_device random_device;
+    auto rng = std::mt19937(random_device());
+    auto f32rng = std::bind(std::uniform_real_distribution<float>(-1.0f, 1.0f), std::ref(rng));
+
+    std::vector<float> input(input_size() + XNN_EXTRA_BYTES / sizeof(float));
+    std::generate(input.begin(), input.end(), std::ref(f32rng));
+    return input;
+  }
+
+  static std::vector<float> Run(xnn_runtime_t runtime, const std::vector<float>& input, size_t output_size) {
+    std::vector<float> output(output_size, std::nanf(""));
+    const std::array<xnn_external_value, 2> external = {{
+      xnn_external_value{kInputId, const_cast<float*>(input.data())},
+      xnn_external_value{kOutputId, output.data()},
+    }};
+    EXPECT_EQ(xnn_status_success, xnn_setup_runtime(runtime, external.size(), external.data()));
+    EXPECT_EQ(xnn_status_success, xnn_invoke_runtime(runtime));
+    return output;
+  }
+
+  std::vector<float> Run(xnn_runtime_t runtime, const std::vector<float>& input) const {
+    return Run(runtime, input, output_size());
+  }
+
+ private:
+  std::vector<float> conv1_filter_;
+  std::vector<float> conv1_bias_;
+  std::vector<float> conv2_filter_;
+  std::vector<float> conv2_bias_;
+};
+
+constexpr size_t ResizeNetwork::kHeight;
+constexpr size_t ResizeNetwork::kWidth;
+constexpr size_t ResizeNetwork::kChannels;
+constexpr size_t ResizeNetwork::kHiddenChannels;
+constexpr size_t ResizeNetwork::kOutputHeight;
+constexpr size_t ResizeNetwork::kOutputWidth;
+constexpr uint32_t ResizeNetwork::kInputId;
+constexpr uint32_t ResizeNetwork::kOutputId;
+
+using SubgraphPtr = std::unique_ptr<xnn_subgraph, decltype(&xnn_delete_subgraph)>;
+using RuntimePtr = std::unique_ptr<xnn_runtime, decltype(&xnn_delete_runtime)>;
+using ThreadpoolPtr = std::unique_ptr<pthreadpool, decltype(&pthreadpool_destroy)>;
+
+RuntimePtr CreateRuntime(xnn_subgraph_t subgraph, pthreadpool_t threadpool, uint32_t flags) {
+  xnn_runtime_t runtime = nullptr;
+  EXPECT_EQ(xnn_status_success, xnn_create_runtime_v2(subgraph, threadpool, flags, &runtime));
+  return RuntimePtr(runtime, xnn_delete_runtime);
+}
+
+RuntimePtr CloneRuntime(xnn_runtime_t runtime, pthreadpool_t threadpool, uint32_t flags) {
+  xnn_runtime_t clone = nullptr;
+  EXPECT_EQ(xnn_status_success, xnn_clone_runtime(runtime, threadpool, flags, &clone));
+  return RuntimePtr(clone, xnn_delete_runtime);
+}
+
+}  // namespace
+
+
+TEST(CLONE_RUNTIME, resize_bilinear) {
+  ASSERT_EQ(xnn_status_success, xnn_initialize(nullptr /* allocator */));
+  const ResizeNetwork network;
+  SubgraphPtr subgraph(network.CreateSubgraph(), xnn_delete_subgraph);
+  RuntimePtr runtime = CreateRuntime(subgraph.get(), nullptr /* thread pool */, 0 /* flags */);
+
+  const std::vector<float> input = network.RandomInput();
+  const std::vector<float> reference = network.Run(runtime.get(), input);
+
+  RuntimePtr clone = CloneRuntime(runtime.get(), nullptr /* thread pool */, 0 /* flags */);
+  ASSERT_EQ(reference, network.Run(clone.get(), input));
+  // Setup of the original must not invalidate the weights of the clone, and vice versa.
+  ASSERT_EQ(reference, network.Run(runtime.get(), input));
+  ASSERT_EQ(reference, network.Run(clone.get(), input));
+}
+
+TEST(CLONE_RUNTIME, before_first_setup) {
+  ASSERT_EQ(xnn_status_success, xnn_initialize(nullptr /* allocator */));
+  const ResizeNetwork network;
+  SubgraphPtr subgraph(network.CreateSubgraph(), xnn_delete_subgraph);
+  RuntimePtr runtime = CreateRuntime(subgraph.get(), nullptr /* thread pool */, 0 /* flags */);
+  RuntimePtr clone = CloneRuntime(runtime.get(), nullptr /* thread pool */, 0 /* flags */);
+
+  const std::vector<float> input = network.RandomInput();
+  const std::vector<float> reference = network.Run(runtime.get(), input);
+  ASSERT_EQ(reference, network.Run(clone.get(), input));
+}
+
+TEST(CLONE_RUNTIME, deferred_packing) {
+  ASSERT_EQ(xnn_status_success, xnn_initialize(nullptr /* allocator */));
+  const ResizeNetwork network;
+  SubgraphPtr subgraph(network.CreateSubgraph(), xnn_delete_subgraph);
+  RuntimePtr runtime = CreateRuntime(subgraph.get(), nullptr /* thread pool */, XNN_FLAG_DEFER_PACKING);
+  RuntimePtr clone = CloneRuntime(runtime.get(), nullptr /* thread pool */, 0 /* flags */);
+
+  const std::vector<float> input = network.RandomInput();
+  const std::vector<float> reference = network.Run(clone.get(), input);
+  ASSERT_EQ(reference, network.Run(runtime.get(), input));
+}
+
+TEST(CLONE_RUNTIME, concurrent_invocation) {
+  ASSERT_EQ(xnn_status_success, xnn_initialize(nullptr /* allocator */));
+  const ResizeNetwork network;
+  SubgraphPtr subgraph(network.CreateSubgraph(), xnn_delete_subgraph);
+  ThreadpoolPtr threadpool(pthreadpool_create(2), pthreadpool_destroy);
+  RuntimePtr runtime = CreateRuntime(subgraph.get(), threadpool.get(), 0 /* flags */);
+
+  constexpr size_t kNumClones = 3;
+  std::vector<ThreadpoolPtr> threadpools;
+  std::vector<RuntimePtr> runtimes;
+  // The first clone is taken before the original Runtime is setup, the other ones after.
+  threadpools.emplace_back(pthreadpool_create(2), pthreadpool_destroy);
+  runtimes.push_back(CloneRuntime(runtime.get(), threadpools.back().get(), 0 /* flags */));
+  const std::vector<float> warmup_input = network.RandomInput();
+  network.Run(runtime.get(), warmup_input);
+  for (size_t i = 1; i < kNumClones; i++) {
+    threadpools.emplace_back(pthreadpool_create(2), pthreadpool_destroy);
+    runtimes.push_back(CloneRuntime(runtime.get(), threadpools.back().get(), 0 /* flags */));
+  }
+  runtimes.push_back(std::move(runtime));
+
+  std::vector<std::vector<float>> inputs;
+  for (size_t i = 0; i < runtimes.size(); i++) {
+    inputs.push_back(network.RandomInput());
+  }
+
+  std::vector<std::vector<float>> outputs(runtimes.size());
+  std::vector<std::thread> threads;
+  for (size_t i = 0; i < runtimes.size(); i++) {
+    threads.emplace_back([&, i]() {
+      for (size_t iteration = 0; iteration < 3; iteration++) {
+        outputs[i] = network.Run(runtimes[i].get(), inputs[i]);
+      }
+    });
+  }
+  for (std::thread& thread : threads) {
+    thread.join();
+  }
+
+  // Reference outputs are computed sequentially by a Runtime of its own.
+  RuntimePtr reference_runtime = CreateRuntime(subgraph.get(), nullptr /* thread pool */, 0 /* flags */);
+  for (size_t i = 0; i < runtimes.size(); i++) {
+    const std::vector<float> reference = network.Run(reference_runtime.get(), inputs[i]);
+    ASSERT_EQ(reference, outputs[i]) << "runtime #" << i;
+  }
+
+  // Clones must stay valid until they are deleted, regardless of the state of other clones.
+  runtimes.front().reset();
+  ASSERT_EQ(network.Run(reference_runtime.get(), inputs[1]), network.Run(runtimes[1].get(), inputs[1]));
+}
+
+
+TEST(CLONE_RUNTIME, reduce_mean) {
+  ASSERT_EQ(xnn_status_success, xnn_initialize(nullptr /* allocator */));
+
+  // Reduce operators allocate their zero buffer in setup.
+  xnn_subgraph_t subgraph_ptr = nullptr;
+  ASSERT_EQ(xnn_status_success, xnn_create_subgraph(2 /* external value IDs */, 0 /* flags */, &subgraph_ptr));
+  SubgraphPtr subgraph(subgraph_ptr, xnn_delete_subgraph);
+  const std::array<size_t, 4> input_dims = {{2, 5, 7, 12}};
+  const std::array<size_t, 2> output_dims = {{2, 12}};
+  uint32_t input_id = XNN_INVALID_VALUE_ID;
+  ASSERT_EQ(xnn_status_success, xnn_define_tensor_value(
+    subgraph.get(), xnn_datatype_fp32, input_dims.size(), input_dims.data(), nullptr,
+    0 /* external ID */, XNN_VALUE_FLAG_EXTERNAL_INPUT, &input_id));
+  uint32_t output_id = XNN_INVALID_VALUE_ID;
+  ASSERT_EQ(xnn_status_success, xnn_define_tensor_value(
+    subgraph.get(), xnn_datatype_fp32, output_dims.size(), output_dims.data(), nullptr,
+    1 /* external ID */, XNN_VALUE_FLAG_EXTERNAL_OUTPUT, &output_id));
+  const std::array<size_t, 2> reduction_axes = {{1, 2}};
+  ASSERT_EQ(xnn_status_success, xnn_define_static_reduce_mean(
+    subgraph.get(), reduction_axes.size(), reduction_axes.data(), input_id, output_id, 0 /* flags */));
+
+  std::random_device random_device;
+  auto rng = std::mt19937(random_device());
+  auto f32rng = std::bind(std::uniform_real_distribution<float>(-1.0f, 1.0f), std::ref(rng));
+  std::vector<float> input(2 * 5 * 7 * 12 + XNN_EXTRA_BYTES / sizeof(float));
+  std::generate(input.begin(), input.end(), std::ref(f32rng));
+
+  const auto run = [&](xnn_runtime_t runtime) {
+    std::vector<float> output(2 * 12, std::nanf(""));
+    const std::array<xnn_external_value, 2> external = {{
+      xnn_external_value{input_id, input.data()},
+      xnn_external_value{output_id, output.data()},
+    }};
+    EXPECT_EQ(xnn_status_success, xnn_setup_runtime(runtime, external.size(), external.data()));
+    EXPECT_EQ(xnn_status_success, xnn_invoke_runtime(runtime));
+    return output;
+  };
+
+  RuntimePtr runtime = CreateRuntime(subgraph.get(), nullptr /* thread pool */, 0 /* flags */);
+  RuntimePtr early_clone = CloneRuntime(runtime.get(), nullptr /* thread pool */, 0 /* flags */);
+  const std::vector<float> reference = run(runtime.get());
+  RuntimePtr late_clone = CloneRuntime(runtime.get(), nullptr /* thread pool */, 0 /* flags */);
+  ASSERT_EQ(reference, run(early_clone.get()));
+  ASSERT_EQ(reference, run(late_clone.get()));
+  early_clone.reset();
+  late_clone.reset();
+  ASSERT_EQ(reference, run(runtime.get()));
+}
+
+
+namespace {
+
+// Two 3x3 Convolutions of the same input with the same geometry: one with implicit zero padding, and one fused with a
+// Pad Node which replicates the input with the padding mode in flags.
+class PaddedConvolutionNetwork {
+ public:
+  static constexpr size_t kHeight = 7;
+  static constexpr size_t kWidth = 11;
+  static constexpr size_t kInputChannels = 4;
+  static constexpr size_t kOutputChannels = 8;
+  static constexpr uint32_t kInputId = 0;
+  static constexpr uint32_t kZeroPaddedOutputId = 1;
+  static constexpr uint32_t kModePaddedOutputId = 2;
+
+  PaddedConvolutionNetwork() {
+    std::random_device random_device;
+    auto rng = std::mt19937(random_device());
+    auto f32rng = std::bind(std::uniform_real_distribution<float>(-1.0f, 1.0f), std::ref(rng));
+
+    for (std::vector<float>* filter : {&zero_padded_filter_, &mode_padded_filter_}) {
+      filter->resize(kOutputChannels * 3 * 3 * kInputChannels);
+      std::generate(filter->begin(), filter->end(), std::ref(f32rng));
+    }
+    for (std::vector<float>* bias : {&zero_padded_bias_, &mode_padded_bias_}) {
+      bias->resize(kOutputChannels);
+      std::generate(bias->begin(), bias->end(), std::ref(f32rng));
+    }
+    input_.resize(kHeight * kWidth * kInputChannels + XNN_EXTRA_BYTES / sizeof(float));
+    std::generate(input_.begin(), input_.end(), std::ref(f32rng));
+  }
+
+  // Creates a Subgraph with the zero-padded Convolution, the Pad and Convolution pair, or both in the specified order.
+  xnn_subgraph_t CreateSubgraph(
+    bool with_zero_padded, bool with_mode_padded, bool mode_padded_first, uint32_t padding_mode) const
+  {
+    xnn_subgraph_t subgraph = nullptr;
+    EXPECT_EQ(xnn_status_success, xnn_create_subgraph(3 /* external value IDs */, 0 /* flags */, &subgraph));
+
+    const std::array<size_t, 4> input_dims = {{1, kHeight, kWidth, kInputChannels}};
+    const std::array<size_t, 4> padded_dims = {{1, kHeight + 2, kWidth + 2, kInputChannels}};
+    const std::array<size_t, 4> output_dims = {{1, kHeight, kWidth, kOutputChannels}};
+
+    uint32_t input_id = XNN_INVALID_VALUE_ID;
+    EXPECT_EQ(xnn_status_success, xnn_define_tensor_value(
+      subgraph, xnn_datatype_fp32, input_dims.size(), input_dims.data(), nullptr,
+      kInputId, XNN_VALUE_FLAG_EXTERNAL_INPUT, &input_id));
+
+    const std::function<void()> define_zero_padded = [&]() {
+      uint32_t output_id = XNN_INVALID_VALUE_ID;
+      EXPECT_EQ(xnn_status_success, xnn_define_tensor_value(
+        subgraph, xnn_datatype_fp32, output_dims.size(), output_dims.data(), nullptr,
+        kZeroPaddedOutputId, XNN_VALUE_FLAG_EXTERNAL_OUTPUT, &output_id));
+      DefineConvolution(subgraph, 1 /* padding */, input_id, zero_padded_filter_, zero_padded_bias_, output_id);
+    };
+    const std::function<void()> define_mode_padded = [&]() {
+      uint32_t padded_id = XNN_INVALID_VALUE_ID;
+      EXPECT_EQ(xnn_status_success, xnn_define_tensor_value(
+        subgraph, xnn_datatype_fp32, padded_dims.size(), padded_dims.data(), nullptr,
+        XNN_INVALID_VALUE_ID, 0 /* flags */, &padded_id));
+      const std::array<size_t, 4> pre_paddings = {{0, 1, 1, 0}};
+      const std::array<size_t, 4> post_paddings = {{0, 1, 1, 0}};
+      EXPECT_EQ(xnn_status_success, xnn_define_static_pad(
+        subgraph, pre_paddings.data(), post_paddings.data(), input_id, padded_id, padding_mode));
+
+      uint32_t output_id = XNN_INVALID_VALUE_ID;
+      EXPECT_EQ(xnn_status_success, xnn_define_tensor_value(
+        subgraph, xnn_datatype_fp32, output_dims.size(), output_dims.data(), nullptr,
+        kModePaddedOutputId, XNN_VALUE_FLAG_EXTERNAL_OUTPUT, &output_id));
+      DefineConvolution(subgraph, 0 /* padding */, padded_id, mode_padded_filter_, mode_padded_bias_, output_id);
+    };
+
+    if (mode_padded_first) {
+      if (with_mode_padded) {
+        define_mode_padded();
+      }
+      if (with_zero_padded) {
+        define_zero_padded();
+      }
+    } else {
+      if (with_zero_padded) {
+        define_zero_padded();
+      }
+      if (with_mode_padded) {
+        define_mode_padded();
+      }
+    }
+    return subgraph;
+  }
+
+  std::vector<float> Run(xnn_runtime_t runtime, uint32_t output_id) const {
+    std::vector<float> output(kHeight * kWidth * kOutputChannels, std::nanf(""));
+    std::vector<float> unused_output(kHeight * kWidth * kOutputChannels);
+    const std::array<xnn_external_value, 3> external = {{
+      xnn_external_value{kInputId, const_cast<float*>(input_.data())},
+      xnn_external_value{output_id, output.data()},
+      xnn_external_value{output_id == kZeroPaddedOutputId ? kModePaddedOutputId : kZeroPaddedOutputId,
+        unused_output.data()},
+    }};
+    EXPECT_EQ(xnn_status_success, xnn_setup_runtime(runtime, external.size(), external.data()));
+    EXPECT_EQ(xnn_status_success, xnn_invoke_runtime(runtime));
+    return output;
+  }
+
+  std::vector<float> RunSingle(xnn_runtime_t runtime, uint32_t output_id) const {
+    std::vector<float> output(kHeight * kWidth * kOutputChannels, std::nanf(""));
+    const std::array<xnn_external_value, 2> external = {{
+      xnn_external_value{kInputId, const_cast<float*>(input_.data())},
+      xnn_external_value{output_id, output.data()},
+    }};
+    EXPECT_EQ(xnn_status_success, xnn_setup_runtime(runtime, external.size(), external.data()));
+    EXPECT_EQ(xnn_status_success, xnn_invoke_runtime(runtime));
+    return output;
+  }
+
+ private:
+  static void DefineConvolution(
+    xnn_subgraph_t subgraph, uint32_t padding, uint32_t input_id,
+    const std::vector<float>& filter, const std::vector<float>& bias, uint32_t output_id)
+  {
+    const std::array<size_t, 4> filter_dims = {{kOutputChannels, 3, 3, kInputChannels}};
+    const std::array<size_t, 1> bias_dims = {{kOutputChannels}};
+    uint32_t filter_id = XNN_INVALID_VALUE_ID;
+    EXPECT_EQ(xnn_status_success, xnn_define_tensor_value(
+      subgraph, xnn_datatype_fp32, filter_dims.size(), filter_dims.data(), filter.data(),
+      XNN_INVALID_VALUE_ID, 0 /* flags */, &filter_id));
+    uint32_t bias_id = XNN_INVALID_VALUE_ID;
+    EXPECT_EQ(xnn_status_success, xnn_define_tensor_value(
+      subgraph, xnn_datatype_fp32, bias_dims.size(), bias_dims.data(), bias.data(),
+      XNN_INVALID_VALUE_ID, 0 /* flags */, &bias_id));
+    EXPECT_EQ(xnn_status_success, xnn_define_convolution_2d(
+      subgraph,
+      padding /* top padding */, padding /* right padding */, padding /* bottom padding */, padding /* left padding */,
+      3 /* kernel height */, 3 /* kernel width */,
+      1 /* subsampling height */, 1 /* subsampling width */,
+      1 /* dilation_height */, 1 /* dilation_width */,
+      1 /* groups */, kInputChannels /* input channels per group */, kOutputChannels /* output_channels_per_group */,
+      -std::numeric_limits<float>::infinity(), std::numeric_limits<float>::infinity(),
+      input_id, filter_id, bias_id, output_id, 0 /* flags */));
+  }
+
+  std::vector<float> zero_padded_filter_;
+  std::vector<float> zero_padded_bias_;
+  std::vector<float> mode_padded_filter_;
+  std::vector<float> mode_padded_bias_;
+  std::vector<float> input_;
+};
+
+constexpr size_t PaddedConvolutionNetwork::kHeight;
+constexpr size_t PaddedConvolutionNetwork::kWidth;
+constexpr size_t PaddedConvolutionNetwork::kInputChannels;
+constexpr size_t PaddedConvolutionNetwork::kOutputChannels;
+constexpr uint32_t PaddedConvolutionNetwork::kInputId;
+constexpr uint32_t PaddedConvolutionNetwork::kZeroPaddedOutputId;
+constexpr uint32_t PaddedConvolutionNetwork::kModePaddedOutputId;
+
+void TestPaddingModes(uint32_t padding_mode, bool mode_padded_first) {
+  ASSERT_EQ(xnn_status_success, xnn_initialize(nullptr /* allocator */));
+  const PaddedConvolutionNetwork network;
+
+  // References: each Convolution in a Runtime of its own.
+  SubgraphPtr zero_padded_subgraph(
+    network.CreateSubgraph(true, false, mode_padded_first, padding_mode), xnn_delete_subgraph);
+  RuntimePtr zero_padded_runtime = CreateRuntime(zero_padded_subgraph.get(), nullptr /* thread pool */, 0 /* flags */);
+  const std::vector<float> zero_padded_reference =
+    network.RunSingle(zero_padded_runtime.get(), PaddedConvolutionNetwork::kZeroPaddedOutputId);
+  SubgraphPtr mode_padded_subgraph(
+    network.CreateSubgraph(false, true, mode_padded_first, padding_mode), xnn_delete_subgraph);
+  RuntimePtr mode_padded_runtime = CreateRuntime(mode_padded_subgraph.get(), nullptr /* thread pool */, 0 /* flags */);
+  const std::vector<float> mode_padded_reference =
+    network.RunSingle(mode_padded_runtime.get(), PaddedConvolutionNetwork::kModePaddedOutputId);
+  ASSERT_NE(zero_padded_reference, mode_padded_reference);
+
+  SubgraphPtr subgraph(network.CreateSubgraph(true, true, mode_padded_first, padding_mode), xnn_delete_subgraph);
+  for (uint32_t flags : {0u, static_cast<uint32_t>(XNN_FLAG_COMPACT_INDIRECTION)}) {
+    RuntimePtr runtime = CreateRuntime(subgraph.get(), nullptr /* thread pool */, flags);
+    ASSERT_EQ(zero_padded_reference, network.Run(runtime.get(), PaddedConvolutionNetwork::kZeroPaddedOutputId));
+    ASSERT_EQ(mode_padded_reference, network.Run(runtime.get(), PaddedConvolutionNetwork::kModePaddedOutputId));
+
+    RuntimePtr clone = CloneRuntime(runtime.get(), nullptr /* thread pool */, 0 /* flags */);
+    ASSERT_EQ(zero_padded_reference, network.Run(clone.get(), PaddedConvolutionNetwork::kZeroPaddedOutputId));
+    ASSERT_EQ(mode_padded_reference, network.Run(clone.get(), PaddedConvolutionNetwork::kModePaddedOutputId));
+  }
+}
+
+}  // namespace
+
+
+TEST(SHARED_INDIRECTION, zero_and_reflect_padding) {
+  TestPaddingModes(XNN_FLAG_REFLECT_PADDING, false /* mode padded first */);
+}
+
+TEST(SHARED_INDIRECTION, reflect_and_zero_padding) {
+  TestPaddingModes(XNN_FLAG_REFLECT_PADDING, true /* mode padded first */);
+}
+
+TEST(SHARED_INDIRECTION, zero_and_edge_padding) {
+  TestPaddingModes(XNN_FLAG_EDGE_PADDING, false /* mode padded first */);
+}
+
+TEST(SHARED_INDIRECTION, edge_and_zero_padding) {
+  TestPaddingModes(XNN_FLAG_EDGE_PADDING, true /* mode padded first */);
+}
+
+
+namespace {
+
+// Two independent branches:
+// - Fully Connected with a long reduction dimension and a single row, which splits K across threads and adds up the
+//   partial sums in a second pass, followed by a Fully Connected too small to be worth more than one thread.
+// - PReLU on a tensor large enough for a few threads, but not for a whole thread pool.
+class MixedParallelismNetwork {
+ public:
+  static constexpr size_t kInputChannels = 4096;
+  static constexpr size_t kHiddenChannels = 8;
+  static constexpr size_t kOutputChannels = 16;
+  static constexpr size_t kPReLUHeight = 25;
+  static constexpr size_t kPReLUWidth = 40;
+  static constexpr size_t kPReLUChannels = 16;
+  static constexpr uint32_t kFullyConnectedInputId = 0;
+  static constexpr uint32_t kFullyConnectedOutputId = 1;
+  static constexpr uint32_t kPReLUInputId = 2;
+  static constexpr uint32_t kPReLUOutputId = 3;
+
+  MixedParallelismNetwork() {
+    std::random_device random_device;
+    auto rng = std::mt19937(random_device());
+    auto f32rng = std::bind(std::uniform_real_distribution<float>(-1.0f, 1.0f), std::ref(rng));
+
+    fc1_filter_.resize(kHiddenChannels * kInputChannels);
+    fc1_bias_.resize(kHiddenChannels);
+    fc2_filter_.resize(kOutputChannels * kHiddenChannels);
+    fc2_bias_.resize(kOutputChannels);
+    slope_.resize(kPReLUChannels);
+    fc_input_.resize(kInputChannels + XNN_EXTRA_BYTES / sizeof(float));
+    prelu_input_.resize(kPReLUHeight * kPReLUWidth * kPReLUChannels + XNN_EXTRA_BYTES / sizeof(float));
+    for (std::vector<float>* data : {&fc1_filter_, &fc1_bias_, &fc2_filter_, &fc2_bias_, &slope_, &fc_input_, &prelu_input_}) {
+      std::generate(data->begin(), data->end(), std::ref(f32rng));
+    }
+  }
+
+  xnn_subgraph_t CreateSubgraph() const {
+    xnn_subgraph_t subgraph = nullptr;
+    EXPECT_EQ(xnn_status_success, xnn_create_subgraph(4 /* external value IDs */, 0 /* flags */, &subgraph));
+
+    const std::array<size_t, 2> fc_input_dims = {{1, kInputChannels}};
+    const std::array<size_t, 2> fc_hidden_dims = {{1, kHiddenChannels}};
+    const std::array<size_t, 2> fc_output_dims = {{1, kOutputChannels}};
+    const std::array<size_t, 2> fc1_filter_dims = {{kHiddenChannels, kInputChannels}};
+    const std::array<size_t, 1> fc1_bias_dims = {{kHiddenChannels}};
+    const std::array<size_t, 2> fc2_filter_dims = {{kOutputChannels, kHiddenChannels}};
+    const std::array<size_t, 1> fc2_bias_dims = {{kOutputChannels}};
+    const std::array<size_t, 4> prelu_dims = {{1, kPReLUHeight, kPReLUWidth, kPReLUChannels}};
+    const std::array<size_t, 1> slope_dims = {{kPReLUChannels}};
+
+    uint32_t fc_input_id = XNN_INVALID_VALUE_ID;
+    EXPECT_EQ(xnn_status_success, xnn_define_tensor_value(
+      subgraph, xnn_datatype_fp32, fc_input_dims.size(), fc_input_dims.data(), nullptr,
+      kFullyConnectedInputId, XNN_VALUE_FLAG_EXTERNAL_INPUT, &fc_input_id));
+    uint32_t fc_output_id = XNN_INVALID_VALUE_ID;
+    EXPECT_EQ(xnn_status_success, xnn_define_tensor_value(
+      subgraph, xnn_datatype_fp32, fc_output_dims.size(), fc_output_dims.data(), nullptr,
+      kFullyConnectedOutputId, XNN_VALUE_FLAG_EXTERNAL_OUTPUT, &fc_output_id));
+    uint32_t prelu_input_id = XNN_INVALID_VALUE_ID;
+    EXPECT_EQ(xnn_status_success, xnn_define_tensor_value(
+      subgraph, xnn_datatype_fp32, prelu_dims.size(), prelu_dims.data(), nullptr,
+      kPReLUInputId, XNN_VALUE_FLAG_EXTERNAL_INPUT, &prelu_input_id));
+    uint32_t prelu_output_id = XNN_INVALID_VALUE_ID;
+    EXPECT_EQ(xnn_status_success, xnn_define_tensor_value(
+      subgraph, xnn_datatype_fp32, prelu_dims.size(), prelu_dims.data(), nullptr,
+      kPReLUOutputId, XNN_VALUE_FLAG_EXTERNAL_OUTPUT, &prelu_output_id));
+
+    uint32_t fc1_filter_id = XNN_INVALID_VALUE_ID;
+    EXPECT_EQ(xnn_status_success, xnn_define_tensor_value(
+      subgraph, xnn_datatype_fp32, fc1_filter_dims.size(), fc1_filter_dims.data(), fc1_filter_.data(),
+      XNN_INVALID_VALUE_ID, 0 /* flags */, &fc1_filter_id));
+    uint32_t fc1_bias_id = XNN_INVALID_VALUE_ID;
+    EXPECT_EQ(xnn_status_success, xnn_define_tensor_value(
+      subgraph, xnn_datatype_fp32, fc1_bias_dims.size(), fc1_bias_dims.data(), fc1_bias_.data(),
+      XNN_INVALID_VALUE_ID, 0 /* flags */, &fc1_bias_id));
+    uint32_t fc_hidden_id = XNN_INVALID_VALUE_ID;
+    EXPECT_EQ(xnn_status_success, xnn_define_tensor_value(
+      subgraph, xnn_datatype_fp32, fc_hidden_dims.size(), fc_hidden_dims.data(), nullptr,
+      XNN_INVALID_VALUE_ID, 0 /* flags */, &fc_hidden_id));
+    EXPECT_EQ(xnn_status_success, xnn_define_fully_connected(
+      subgraph, -std::numeric_limits<float>::infinity(), std::numeric_limits<float>::infinity(),
+      fc_input_id, fc1_filter_id, fc1_bias_id, fc_hidden_id, 0 /* flags */));
+
+    uint32_t fc2_filter_id = XNN_INVALID_VALUE_ID;
+    EXPECT_EQ(xnn_status_success, xnn_define_tensor_value(
+      subgraph, xnn_datatype_fp32, fc2_filter_dims.size(), fc2_filter_dims.data(), fc2_filter_.data(),
+      XNN_INVALID_VALUE_ID, 0 /* flags */, &fc2_filter_id));
+    uint32_t fc2_bias_id = XNN_INVALID_VALUE_ID;
+    EXPECT_EQ(xnn_status_success, xnn_define_tensor_value(
+      subgraph, xnn_datatype_fp32, fc2_bias_dims.size(), fc2_bias_dims.data(), fc2_bias_.data(),
+      XNN_INVALID_VALUE_ID, 0 /* flags */, &fc2_bias_id));
+    EXPECT_EQ(xnn_status_success, xnn_define_fully_connected(
+      subgraph, -std::numeric_limits<float>::infinity(), std::numeric_limits<float>::infinity(),
+      fc_hidden_id, fc2_filter_id, fc2_bias_id, fc_output_id, 0 /* flags */));
+
+    uint32_t slope_id = XNN_INVALID_VALUE_ID;
+    EXPECT_EQ(xnn_status_success, xnn_define_tensor_value(
+      subgraph, xnn_datatype_fp32, slope_dims.size(), slope_dims.data(), slope_.data(),
+      XNN_INVALID_VALUE_ID, 0 /* flags */, &slope_id));
+    EXPECT_EQ(xnn_status_success, xnn_define_prelu(
+      subgraph, prelu_input_id, slope_id, prelu_output_id, 0 /* flags */));
+
+    return subgraph;
+  }
+
+  // Returns the outputs of both branches, concatenated.
+  std::vector<float> Run(xnn_runtime_t runtime) const {
+    std::vector<float> fc_output(kOutputChannels, std::nanf(""));
+    std::vector<float> prelu_output(kPReLUHeight * kPReLUWidth * kPReLUChannels, std::nanf(""));
+    const std::array<xnn_external_value, 4> external = {{
+      xnn_external_value{kFullyConnectedInputId, const_cast<float*>(fc_input_.data())},
+      xnn_external_value{kFullyConnectedOutputId, fc_output.data()},
+      xnn_external_value{kPReLUInputId, const_cast<float*>(prelu_input_.data())},
+      xnn_external_value{kPReLUOutputId, prelu_output.data()},
+    }};
+    EXPECT_EQ(xnn_status_success, xnn_setup_runtime(runtime, external.size(), external.data()));
+    EXPECT_EQ(xnn_status_success, xnn_invoke_runtime(runtime));
+    fc_output.insert(fc_output.end(), prelu_output.begin(), prelu_output.end());
+    return fc_output;
+  }
+
+ private:
+  std::vector<float> fc1_filter_;
+  std::vector<float> fc1_bias_;
+  std::vector<float> fc2_filter_;
+  std::vector<float> fc2_bias_;
+  std::vector<float> slope_;
+  std::vector<float> fc_input_;
+  std::vector<float> prelu_input_;
+};
+
+constexpr size_t MixedParallelismNetwork::kInputChannels;
+constexpr size_t MixedParallelismNetwork::kHiddenChannels;
+constexpr size_t MixedParallelismNetwork::kOutputChannels;
+constexpr size_t MixedParallelismNetwork::kPReLUHeight;
+constexpr size_t MixedParallelismNetwork::kPReLUWidth;
+constexpr size_t MixedParallelismNetwork::kPReLUChannels;
+constexpr uint32_t MixedParallelismNetwork::kFullyConnectedInputId;
+constexpr uint32_t MixedParallelismNetwork::kFullyConnectedOutputId;
+constexpr uint32_t MixedParallelismNetwork::kPReLUInputId;
+constexpr uint32_t MixedParallelismNetwork::kPReLUOutputId;
+
+}  // namespace
+
+
+TEST(PERSISTENT_PARALLEL_REGION, resize_bilinear) {
+  ASSERT_EQ(xnn_status_success, xnn_initialize(nullptr /* allocator */));
+  const ResizeNetwork network;
+  SubgraphPtr subgraph(network.CreateSubgraph(), xnn_delete_subgraph);
+  const std::vector<float> input = network.RandomInput();
+
+  for (size_t num_threads : {2, 3, 4}) {
+    ThreadpoolPtr threadpool(pthreadpool_create(num_threads), pthreadpool_destroy);
+    RuntimePtr runtime = CreateRuntime(subgraph.get(), threadpool.get(), 0 /* flags */);
+    RuntimePtr persistent_runtime = CreateRuntime(subgraph.get(), threadpool.get(), XNN_FLAG_PERSISTENT_PARALLEL_REGION);
+    const std::vector<float> reference = network.Run(runtime.get(), input);
+    for (size_t iteration = 0; iteration < 3; iteration++) {
+      ASSERT_EQ(reference, network.Run(persistent_runtime.get(), input)) << num_threads << " threads";
+    }
+  }
+}
+
+TEST(PERSISTENT_PARALLEL_REGION, split_k_and_capped_threads) {
+  ASSERT_EQ(xnn_status_success, xnn_initialize(nullptr /* allocator */));
+  const MixedParallelismNetwork network;
+  SubgraphPtr subgraph(network.CreateSubgraph(), xnn_delete_subgraph);
+
+  for (size_t num_threads : {3, 4, 8}) {
+    ThreadpoolPtr threadpool(pthreadpool_create(num_threads), pthreadpool_destroy);
+    RuntimePtr runtime = CreateRuntime(subgraph.get(), threadpool.get(), 0 /* flags */);
+    RuntimePtr persistent_runtime = CreateRuntime(subgraph.get(), threadpool.get(), XNN_FLAG_PERSISTENT_PARALLEL_REGION);
+    const std::vector<float> reference = network.Run(runtime.get());
+    for (size_t iteration = 0; iteration < 3; iteration++) {
+      ASSERT_EQ(reference, network.Run(persistent_runtime.get())) << num_threads << " threads";
+    }
+
+    // The network must exercise a second parallelized pass, and an operator limited to fewer threads than the pool.
+    bool has_second_pass = false;
+    bool has_capped_threads = false;
+    for (size_t i = 0; i < persistent_runtime->num_ops; i++) {
+      const xnn_operator_t op = persistent_runtime->opdata[i].operator_object;
+      if (op == nullptr) {
+        continue;
+      }
+      has_second_pass |= op->compute2.type != xnn_parallelization_type_invalid;
+      has_capped_threads |= op->compute.num_threads > 1 && op->compute.num_threads < num_threads;
+    }
+    ASSERT_TRUE(has_second_pass) << num_threads << " threads";
+    ASSERT_TRUE(has_capped_threads) << num_threads << " threads";
+  }
+}
+
+
+namespace {
+
+using WorkspacePtr = std::unique_ptr<xnn_workspace, decltype(&xnn_release_workspace)>;
+
+WorkspacePtr CreateWorkspace() {
+  xnn_workspace_t workspace = nullptr;
+  EXPECT_EQ(xnn_status_success, xnn_create_workspace(&workspace));
+  return WorkspacePtr(workspace, xnn_release_workspace);
+}
+
+RuntimePtr CreateRuntime(xnn_subgraph_t subgraph, xnn_workspace_t workspace, pthreadpool_t threadpool, uint32_t flags) {
+  xnn_runtime_t runtime = nullptr;
+  EXPECT_EQ(xnn_status_success, xnn_create_runtime_v3(subgraph, workspace, threadpool, flags, &runtime));
+  return RuntimePtr(runtime, xnn_delete_runtime);
+}
+
+// Offsets of the intermediate values of a runtime within its workspace, indexed by value ID, or SIZE_MAX for values
+// which are not in the workspace.
+std::vector<size_t> WorkspaceOffsets(xnn_runtime_t runtime) {
+  const uintptr_t workspace_start = reinterpret_cast<uintptr_t>(runtime->workspace->data);
+  const uintptr_t workspace_end = workspace_start + runtime->workspace->size;
+  std::vector<size_t> offsets(runtime->num_blobs, SIZE_MAX);
+  for (size_t i = 0; i < runtime->num_blobs; i++) {
+    const uintptr_t data = reinterpret_cast<uintptr_t>(runtime->blobs[i].data);
+    if (data >= workspace_start && data < workspace_end) {
+      offsets[i] = data - workspace_start;
+    }
+  }
+  return offsets;
+}
+
+}  // namespace
+
+
+TEST(WORKSPACE, grow_workspace) {
+  ASSERT_EQ(xnn_status_success, xnn_initialize(nullptr /* allocator */));
+  const MixedParallelismNetwork small_network;
+  SubgraphPtr small_subgraph(small_network.CreateSubgraph(), xnn_delete_subgraph);
+  const ResizeNetwork large_network;
+  SubgraphPtr large_subgraph(large_network.CreateSubgraph(), xnn_delete_subgraph);
+  const std::vector<float> large_input = large_network.RandomInput();
+
+  // References: each network in a Runtime with a private workspace.
+  RuntimePtr small_reference_runtime = CreateRuntime(small_subgraph.get(), nullptr /* thread pool */, 0 /* flags */);
+  const std::vector<float> small_reference = small_network.Run(small_reference_runtime.get());
+  RuntimePtr large_reference_runtime = CreateRuntime(large_subgraph.get(), nullptr /* thread pool */, 0 /* flags */);
+  const std::vector<float> large_reference = large_network.Run(large_reference_runtime.get(), large_input);
+
+  WorkspacePtr workspace = CreateWorkspace();
+  RuntimePtr small_runtime = CreateRuntime(small_subgraph.get(), workspace.get(), nullptr /* thread pool */, 0 /* flags */);
+  ASSERT_EQ(small_reference, small_network.Run(small_runtime.get()));
+  const void* small_workspace_data = workspace->data;
+  const std::vector<size_t> small_offsets = WorkspaceOffsets(small_runtime.get());
+  ASSERT_NE(small_offsets.end(), std::find_if(small_offsets.begin(), small_offsets.end(),
+    [](size_t offset) { return offset != SIZE_MAX; }));
+
+  // The second Runtime needs a larger workspace: the shared workspace is reallocated.
+  RuntimePtr large_runtime = CreateRuntime(large_subgraph.get(), workspace.get(), nullptr /* thread pool */, 0 /* flags */);
+  size_t small_workspace_size = 0;
+  size_t large_workspace_size = 0;
+  ASSERT_EQ(xnn_status_success, xnn_get_runtime_workspace_size(small_runtime.get(), &small_workspace_size));
+  ASSERT_EQ(xnn_status_success, xnn_get_runtime_workspace_size(large_runtime.get(), &large_workspace_size));
+  ASSERT_LT(small_workspace_size, large_workspace_size);
+  ASSERT_EQ(large_workspace_size, workspace->size);
+  ASSERT_NE(small_workspace_data, workspace->data);
+
+  // Intermediate values of the first Runtime are re-bound to the new memory, at the same offsets.
+  ASSERT_EQ(workspace.get(), small_runtime->workspace);
+  ASSERT_EQ(small_offsets, WorkspaceOffsets(small_runtime.get()));
+
+  ASSERT_EQ(large_reference, large_network.Run(large_runtime.get(), large_input));
+  ASSERT_EQ(small_reference, small_network.Run(small_runtime.get()));
+  ASSERT_EQ(large_reference, large_network.Run(large_runtime.get(), large_input));
+
+  // The workspace outlives the reference of the caller while Runtime objects use it.
+  workspace.reset();
+  ASSERT_EQ(small_reference, small_network.Run(small_runtime.get()));
+  ASSERT_EQ(large_reference, large_network.Run(large_runtime.get(), large_input));
+}
@@ -0,0 +1,904 @@
+// Copyright 2022 Google LLC
+//
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree.
+
+#include <gtest/gtest.h>
+
+#include "slice-operator-tester.h"
+
+constexpr size_t kDim1 = 3;
+constexpr size_t kDim2 = 4;
+constexpr size_t kDim3 = 3;
+constexpr size_t kDim4 = 4;
+constexpr size_t kDim5 = 3;
+constexpr size_t kDim6 = 4;
+
+
+TEST(SLICE_ND_X8, 0d) {
+  SliceOperatorTester()
+    .TestX8();
+}
+
+TEST(SLICE_ND_X8, 1d) {
+  for (size_t dim1_offset = 0; dim1_offset <= 1; dim1_offset++) {
+    for (size_t dim1_size = 1; dim1_size <= kDim1 - dim1_offset; dim1_size += kDim1 - dim1_offset - 1) {
+      SliceOperatorTester()
+        .input_shape({kDim1})
+        .offsets({dim1_offset})
+        .sizes({dim1_size})
+        .TestX8();
+    }
+  }
+}
+
+TEST(SLICE_ND_X8, 2d) {
+  for (size_t dim1_offset = 0; dim1_offset <= 1; dim1_offset++) {
+    for (size_t dim1_size = 1; dim1_size <= kDim1 - dim1_offset; dim1_size += kDim1 - dim1_offset - 1) {
+      for (size_t dim2_offset = 0; dim2_offset <= 1; dim2_offset++) {
+        for (size_t dim2_size = 1; dim2_size <= kDim2 - dim2_offset; dim2_size += kDim2 - dim2_offset - 1) {
+          SliceOperatorTester()
+            .input_shape({kDim1, kDim2})
+            .offsets({dim1_offset, dim2_offset})
+            .sizes({dim1_size, dim2_size})
+            .TestX8();
+        }
+      }
+    }
+  }
+}
+
+TEST(SLICE_ND_X8, 3d) {
+  for (size_t dim1_offset = 0; dim1_offset <= 1; dim1_offset++) {
+    for (size_t dim1_size = 1; dim1_size <= kDim1 - dim1_offset; dim1_size += kDim1 - dim1_offset - 1) {
+      for (size_t dim2_offset = 0; dim2_offset <= 1; dim2_offset++) {
+        for (size_t dim2_size = 1; dim2_size <= kDim2 - dim2_offset; dim2_size += kDim2 - dim2_offset - 1) {
+          for (size_t dim3_offset = 0; dim3_offset <= 1; dim3_offset++) {
+            for (size_t dim3_size = 1; dim3_size <= kDim3 - dim3_offset; dim3_size += kDim3 - dim3_offset - 1) {
+              SliceOperatorTester()
+                .input_shape({kDim1, kDim2, kDim3})
+                .offsets({dim1_offset, dim2_offset, dim3_offset})
+                .sizes({dim1_size, dim2_size, dim3_size})
+                .TestX8();
+            }
+          }
+        }
+      }
+    }
+  }
+}
+
+TEST(SLICE_ND_X8, 4d) {
+  for (size_t dim1_offset = 0; dim1_offset <= 1; dim1_offset++) {
+    for (size_t dim1_size = 1; dim1_size <= kDim1 - dim1_offset; dim1_size += kDim1 - dim1_offset - 1) {
+      for (size_t dim2_offset = 0; dim2_offset <= 1; dim2_offset++) {
+        for (size_t dim2_size = 1; dim2_size <= kDim2 - dim2_offset; dim2_size += kDim2 - dim2_offset - 1) {
+          for (size_t dim3_offset = 0; dim3_offset <= 1; dim3_offset++) {
+            for (size_t dim3_size = 1; dim3_size <= kDim3 - dim3_offset; dim3_size += kDim3 - dim3_offset - 1) {
+              for (size_t dim4_offset = 0; dim4_offset <= 1; dim4_offset++) {
+                for (size_t dim4_size = 1; dim4_size <= kDim4 - dim4_offset; dim4_size += kDim4 - dim4_offset - 1) {
+                  SliceOperatorTester()
+                    .input_shape({kDim1, kDim2, kDim3, kDim4})
+                    .offsets({dim1_offset, dim2_offset, dim3_offset, dim4_offset})
+                    .sizes({dim1_size, dim2_size, dim3_size, dim4_size})
+                    .TestX8();
+                }
+              }
+            }
+          }
+        }
+      }
+    }
+  }
+}
+
+TEST(SLICE_ND_X8, 5d) {
+  for (size_t dim1_offset = 0; dim1_offset <= 1; dim1_offset++) {
+    for (size_t dim1_size = 1; dim1_size <= kDim1 - dim1_offset; dim1_size += kDim1 - dim1_offset - 1) {
+      for (size_t dim2_offset = 0; dim2_offset <= 1; dim2_offset++) {
+        for (size_t dim2_size = 1; dim2_size <= kDim2 - dim2_offset; dim2_size += kDim2 - dim2_offset - 1) {
+          for (size_t dim3_offset = 0; dim3_offset <= 1; dim3_offset++) {
+            for (size_t dim3_size = 1; dim3_size <= kDim3 - dim3_offset; dim3_size += kDim3 - dim3_offset - 1) {
+              for (size_t dim4_offset = 0; dim4_offset <= 1; dim4_offset++) {
+                for (size_t dim4_size = 1; dim4_size <= kDim4 - dim4_offset; dim4_size += kDim4 - dim4_offset - 1) {
+                  for (size_t dim5_offset = 0; dim5_offset <= 1; dim5_offset++) {
+                    for (size_t dim5_size = 1; dim5_size <= kDim5 - dim5_offset; dim5_size += kDim5 - dim5_offset - 1) {
+                      SliceOperatorTester()
+                        .input_shape({kDim1, kDim2, kDim3, kDim4, kDim5})
+                        .offsets({dim1_offset, dim2_offset, dim3_offset, dim4_offset, dim5_offset})
+                        .sizes({dim1_size, dim2_size, dim3_size, dim4_size, dim5_size})
+                        .TestX8();
+                    }
+                  }
+                }
+              }
+            }
+          }
+        }
+      }
+    }
+  }
+}
+
+TEST(SLICE_ND_X8, 6d) {
+  for (size_t dim1_offset = 0; dim1_offset <= 1; dim1_offset++) {
+    for (size_t dim1_size = 1; dim1_size <= kDim1 - dim1_offset; dim1_size += kDim1 - dim1_offset - 1) {
+      for (size_t dim2_offset = 0; dim2_offset <= 1; dim2_offset++) {
+        for (size_t dim2_size = 1; dim2_size <= kDim2 - dim2_offset; dim2_size += kDim2 - dim2_offset - 1) {
+          for (size_t dim3_offset = 0; dim3_offset <= 1; dim3_offset++) {
+            for (size_t dim3_size = 1; dim3_size <= kDim3 - dim3_offset; dim3_size += kDim3 - dim3_offset - 1) {
+              for (size_t dim4_offset = 0; dim4_offset <= 1; dim4_offset++) {
+                for (size_t dim4_size = 1; dim4_size <= kDim4 - dim4_offset; dim4_size += kDim4 - dim4_offset - 1) {
+                  for (size_t dim5_offset = 0; dim5_offset <= 1; dim5_offset++) {
+                    for (size_t dim5_size = 1; dim5_size <= kDim5 - dim5_offset; dim5_size += kDim5 - dim5_offset - 1) {
+                      for (size_t dim6_offset = 0; dim6_offset <= 1; dim6_offset++) {
+                        for (size_t dim6_size = 1; dim6_size <= kDim6 - dim6_offset; dim6_size += kDim6 - dim6_offset - 1) {
+                          SliceOperatorTester()
+                            .input_shape({kDim1, kDim2, kDim3, kDim4, kDim5, kDim6})
+                            .offsets({dim1_offset, dim2_offset, dim3_offset, dim4_offset, dim5_offset, dim6_offset})
+                            .sizes({dim1_size, dim2_size, dim3_size, dim4_size, dim5_size, dim6_size})
+                            .TestX8();
+                        }
+                      }
+                    }
+                  }
+                }
+              }
+            }
+          }
+        }
+      }
+    }
+  }
+}
+
+TEST(SLICE_ND_X8, 1d_strided) {
+  for (size_t dim1_offset = 0; dim1_offset <= 1; dim1_offset++) {
+    for (size_t dim1_stride = 1; dim1_stride <= 2; dim1_stride++) {
+      const size_t dim1_size = (kDim1 - dim1_offset - 1) / dim1_stride + 1;
+      SliceOperatorTester()
+        .input_shape({kDim1})
+        .offsets({dim1_offset})
+        .sizes({dim1_size})
+        .strides({dim1_stride})
+        .TestX8();
+    }
+  }
+}
+
+TEST(SLICE_ND_X8, 2d_strided) {
+  for (size_t dim1_offset = 0; dim1_offset <= 1; dim1_offset++) {
+    for (size_t dim1_stride = 1; dim1_stride <= 2; dim1_stride++) {
+      const size_t dim1_size = (kDim1 - dim1_offset - 1) / dim1_stride + 1;
+      for (size_t dim2_offset = 0; dim2_offset <= 1; dim2_offset++) {
+        for (size_t dim2_stride = 1; dim2_stride <= 2; dim2_stride++) {
+          const size_t dim2_size = (kDim2 - dim2_offset - 1) / dim2_stride + 1;
+          SliceOperatorTester()
+            .input_shape({kDim1, kDim2})
+            .offsets({dim1_offset, dim2_offset})
+            .sizes({dim1_size, dim2_size})
+            .strides({dim1_stride, dim2_stride})
+            .TestX8();
+        }
+      }
+    }
+  }
+}
+
+TEST(SLICE_ND_X8, 3d_strided) {
+  for (size_t dim1_offset = 0; dim1_offset <= 1; dim1_offset++) {
+    for (size_t dim1_stride = 1; dim1_stride <= 2; dim1_stride++) {
+      const size_t dim1_size = (kDim1 - dim1_offset - 1) / dim1_stride + 1;
+      for (size_t dim2_offset = 0; dim2_offset <= 1; dim2_offset++) {
+        for (size_t dim2_stride = 1; dim2_stride <= 2; dim2_stride++) {
+          const size_t dim2_size = (kDim2 - dim2_offset - 1) / dim2_stride + 1;
+          for (size_t dim3_offset = 0; dim3_offset <= 1; dim3_offset++) {
+            for (size_t dim3_stride = 1; dim3_stride <= 2; dim3_stride++) {
+              const size_t dim3_size = (kDim3 - dim3_offset - 1) / dim3_stride + 1;
+              SliceOperatorTester()
+                .input_shape({kDim1, kDim2, kDim3})
+                .offsets({dim1_offset, dim2_offset, dim3_offset})
+                .sizes({dim1_size, dim2_size, dim3_size})
+                .strides({dim1_stride, dim2_stride, dim3_stride})
+                .TestX8();
+            }
+          }
+        }
+      }
+    }
+  }
+}
+
+TEST(SLICE_ND_X8, 4d_strided) {
+  for (size_t dim1_offset = 0; dim1_offset <= 1; dim1_offset++) {
+    for (size_t dim1_stride = 1; dim1_stride <= 2; dim1_stride++) {
+      const size_t dim1_size = (kDim1 - dim1_offset - 1) / dim1_stride + 1;
+      for (size_t dim2_offset = 0; dim2_offset <= 1; dim2_offset++) {
+        for (size_t dim2_stride = 1; dim2_stride <= 2; dim2_stride++) {
+          const size_t dim2_size = (kDim2 - dim2_offset - 1) / dim2_stride + 1;
+          for (size_t dim3_offset = 0; dim3_offset <= 1; dim3_offset++) {
+            for (size_t dim3_stride = 1; dim3_stride <= 2; dim3_stride++) {
+              const size_t dim3_size = (kDim3 - dim3_offset - 1) / dim3_stride + 1;
+              for (size_t dim4_offset = 0; dim4_offset <= 1; dim4_offset++) {
+                for (size_t dim4_stride = 1; dim4_stride <= 2; dim4_stride++) {
+                  const size_t dim4_size = (kDim4 - dim4_offset - 1) / dim4_stride + 1;
+                  SliceOperatorTester()
+                    .input_shape({kDim1, kDim2, kDim3, kDim4})
+                    .offsets({dim1_offset, dim2_offset, dim3_offset, dim4_offset})
+                    .sizes({dim1_size, dim2_size, dim3_size, dim4_size})
+                    .strides({dim1_stride, dim2_stride, dim3_stride, dim4_stride})
+                    .TestX8();
+                }
+              }
+            }
+          }
+        }
+      }
+    }
+  }
+}
+
+TEST(SLICE_ND_X8, 5d_strided) {
+  for (size_t dim1_offset = 0; dim1_offset <= 1; dim1_offset++) {
+    for (size_t dim1_stride = 1; dim1_stride <= 2; dim1_stride++) {
+      const size_t dim1_size = (kDim1 - dim1_offset - 1) / dim1_stride + 1;
+      for (size_t dim2_offset = 0; dim2_offset <= 1; dim2_offset++) {
+        for (size_t dim2_stride = 1; dim2_stride <= 2; dim2_stride++) {
+          const size_t dim2_size = (kDim2 - dim2_offset - 1) / dim2_stride + 1;
+          for (size_t dim3_offset = 0; dim3_offset <= 1; dim3_offset++) {
+            for (size_t dim3_stride = 1; dim3_stride <= 2; dim3_stride++) {
+              const size_t dim3_size = (kDim3 - dim3_offset - 1) / dim3_stride + 1;
+              for (size_t dim4_offset = 0; dim4_offset <= 1; dim4_offset++) {
+                for (size_t dim4_stride = 1; dim4_stride <= 2; dim4_stride++) {
+                  const size_t dim4_size = (kDim4 - dim4_offset - 1) / dim4_stride + 1;
+                  for (size_t dim5_offset = 0; dim5_offset <= 1; dim5_offset++) {
+                    for (size_t dim5_stride = 1; dim5_stride <= 2; dim5_stride++) {
+                      const size_t dim5_size = (kDim5 - dim5_offset - 1) / dim5_stride + 1;
+                      SliceOperatorTester()
+                        .input_shape({kDim1, kDim2, kDim3, kDim4, kDim5})
+                        .offsets({dim1_offset, dim2_offset, dim3_offset, dim4_offset, dim5_offset})
+                        .sizes({dim1_size, dim2_size, dim3_size, dim4_size, dim5_size})
+                        .strides({dim1_stride, dim2_stride, dim3_stride, dim4_stride, dim5_stride})
+                        .TestX8();
+                    }
+                  }
+                }
+              }
+            }
+          }
+        }
+      }
+    }
+  }
+}
+
+TEST(SLICE_ND_X8, 6d_strided) {
+  for (size_t dim1_offset = 0; dim1_offset <= 1; dim1_offset++) {
+    for (size_t dim1_stride = 1; dim1_stride <= 2; dim1_stride++) {
+      const size_t dim1_size = (kDim1 - dim1_offset - 1) / dim1_stride + 1;
+      for (size_t dim2_offset = 0; dim2_offset <= 1; dim2_offset++) {
+        for (size_t dim2_stride = 1; dim2_stride <= 2; dim2_stride++) {
+          const size_t dim2_size = (kDim2 - dim2_offset - 1) / dim2_stride + 1;
+          for (size_t dim3_offset = 0; dim3_offset <= 1; dim3_offset++) {
+            for (size_t dim3_stride = 1; dim3_stride <= 2; dim3_stride++) {
+              const size_t dim3_size = (kDim3 - dim3_offset - 1) / dim3_stride + 1;
+              for (size_t dim4_offset = 0; dim4_offset <= 1; dim4_offset++) {
+                for (size_t dim4_stride = 1; dim4_stride <= 2; dim4_stride++) {
+                  const size_t dim4_size = (kDim4 - dim4_offset - 1) / dim4_stride + 1;
+                  for (size_t dim5_offset = 0; dim5_offset <= 1; dim5_offset++) {
+                    for (size_t dim5_stride = 1; dim5_stride <= 2; dim5_stride++) {
+                      const size_t dim5_size = (kDim5 - dim5_offset - 1) / dim5_stride + 1;
+                      for (size_t dim6_offset = 0; dim6_offset <= 1; dim6_offset++) {
+                        for (size_t dim6_stride = 1; dim6_stride <= 2; dim6_stride++) {
+                          const size_t dim6_size = (kDim6 - dim6_offset - 1) / dim6_stride + 1;
+                          SliceOperatorTester()
+                            .input_shape({kDim1, kDim2, kDim3, kDim4, kDim5, kDim6})
+                            .offsets({dim1_offset, dim2_offset, dim3_offset, dim4_offset, dim5_offset, dim6_offset})
+                            .sizes({dim1_size, dim2_size, dim3_size, dim4_size, dim5_size, dim6_size})
+                            .strides({dim1_stride, dim2_stride, dim3_stride, dim4_stride, dim5_stride, dim6_stride})
+                            .TestX8();
+                        }
+                      }
+                    }
+                  }
+                }
+              }
+            }
+          }
+        }
+      }
+    }
+  }
+}
+
+TEST(SLICE_ND_X16, 0d) {
+  SliceOperatorTester()
+    .TestX16();
+}
+
+TEST(SLICE_ND_X16, 1d) {
+  for (size_t dim1_offset = 0; dim1_offset <= 1; dim1_offset++) {
+    for (size_t dim1_size = 1; dim1_size <= kDim1 - dim1_offset; dim1_size += kDim1 - dim1_offset - 1) {
+      SliceOperatorTester()
+        .input_shape({kDim1})
+        .offsets({dim1_offset})
+        .sizes({dim1_size})
+        .TestX16();
+    }
+  }
+}
+
+TEST(SLICE_ND_X16, 2d) {
+  for (size_t dim1_offset = 0; dim1_offset <= 1; dim1_offset++) {
+    for (size_t dim1_size = 1; dim1_size <= kDim1 - dim1_offset; dim1_size += kDim1 - dim1_offset - 1) {
+      for (size_t dim2_offset = 0; dim2_offset <= 1; dim2_offset++) {
+        for (size_t dim2_size = 1; dim2_size <= kDim2 - dim2_offset; dim2_size += kDim2 - dim2_offset - 1) {
+          SliceOperatorTester()
+            .input_shape({kDim1, kDim2})
+            .offsets({dim1_offset, dim2_offset})
+            .sizes({dim1_size, dim2_size})
+            .TestX16();
+        }
+      }
+    }
+  }
+}
+
+TEST(SLICE_ND_X16, 3d) {
+  for (size_t dim1_offset = 0; dim1_offset <= 1; dim1_offset++) {
+    for (size_t dim1_size = 1; dim1_size <= kDim1 - dim1_offset; dim1_size += kDim1 - dim1_offset - 1) {
+      for (size_t dim2_offset = 0; dim2_offset <= 1; dim2_offset++) {
+        for (size_t dim2_size = 1; dim2_size <= kDim2 - dim2_offset; dim2_size += kDim2 - dim2_offset - 1) {
+          for (size_t dim3_offset = 0; dim3_offset <= 1; dim3_offset++) {
+            for (size_t dim3_size = 1; dim3_size <= kDim3 - dim3_offset; dim3_size += kDim3 - dim3_offset - 1) {
+              SliceOperatorTester()
+                .input_shape({kDim1, kDim2, kDim3})
+                .offsets({dim1_offset, dim2_offset, dim3_offset})
+                .sizes({dim1_size, dim2_size, dim3_size})
+                .TestX16();
+            }
+          }
+        }
+      }
+    }
+  }
+}
+
+TEST(SLICE_ND_X16, 4d) {
+  for (size_t dim1_offset = 0; dim1_offset <= 1; dim1_offset++) {
+    for (size_t dim1_size = 1; dim1_size <= kDim1 - dim1_offset; dim1_size += kDim1 - dim1_offset - 1) {
+      for (size_t dim2_offset = 0; dim2_offset <= 1; dim2_offset++) {
+        for (size_t dim2_size = 1; dim2_size <= kDim2 - dim2_offset; dim2_size += kDim2 - dim2_offset - 1) {
+          for (size_t dim3_offset = 0; dim3_offset <= 1; dim3_offset++) {
+            for (size_t dim3_size = 1; dim3_size <= kDim3 - dim3_offset; dim3_size += kDim3 - dim3_offset - 1) {
+              for (size_t dim4_offset = 0; dim4_offset <= 1; dim4_offset++) {
+                for (size_t dim4_size = 1; dim4_size <= kDim4 - dim4_offset; dim4_size += kDim4 - dim4_offset - 1) {
+                  SliceOperatorTester()
+                    .input_shape({kDim1, kDim2, kDim3, kDim4})
+                    .offsets({dim1_offset, dim2_offset, dim3_offset, dim4_offset})
+                    .sizes({dim1_size, dim2_size, dim3_size, dim4_size})
+                    .TestX16();
+                }
+              }
+            }
+          }
+        }
+      }
+    }
+  }
+}
+
+TEST(SLICE_ND_X16, 5d) {
+  for (size_t dim1_offset = 0; dim1_offset <= 1; dim1_offset++) {
+    for (size_t dim1_size = 1; dim1_size <= kDim1 - dim1_offset; dim1_size += kDim1 - dim1_offset - 1) {
+      for (size_t dim2_offset = 0; dim2_offset <= 1; dim2_offset++) {
+        for (size_t dim2_size = 1; dim2_size <= kDim2 - dim2_offset; dim2_size += kDim2 - dim2_offset - 1) {
+          for (size_t dim3_offset = 0; dim3_offset <= 1; dim3_offset++) {
+            for (size_t dim3_size = 1; dim3_size <= kDim3 - dim3_offset; dim3_size += kDim3 - dim3_offset - 1) {
+              for (size_t dim4_offset = 0; dim4_offset <= 1; dim4_offset++) {
+                for (size_t dim4_size = 1; dim4_size <= kDim4 - dim4_offset; dim4_size += kDim4 - dim4_offset - 1) {
+                  for (size_t dim5_offset = 0; dim5_offset <= 1; dim5_offset++) {
+                    for (size_t dim5_size = 1; dim5_size <= kDim5 - dim5_offset; dim5_size += kDim5 - dim5_offset - 1) {
+                      SliceOperatorTester()
+                        .input_shape({kDim1, kDim2, kDim3, kDim4, kDim5})
+                        .offsets({dim1_offset, dim2_offset, dim3_offset, dim4_offset, dim5_offset})
+                        .sizes({dim1_size, dim2_size, dim3_size, dim4_size, dim5_size})
+                        .TestX16();
+                    }
+                  }
+                }
+              }
+            }
+          }
+        }
+      }
+    }
+  }
+}
+
+TEST(SLICE_ND_X16, 6d) {
+  for (size_t dim1_offset = 0; dim1_offset <= 1; dim1_offset++) {
+    for (size_t dim1_size = 1; dim1_size <= kDim1 - dim1_offset; dim1_size += kDim1 - dim1_offset - 1) {
+      for (size_t dim2_offset = 0; dim2_offset <= 1; dim2_offset++) {
+        for (size_t dim2_size = 1; dim2_size <= kDim2 - dim2_offset; dim2_size += kDim2 - dim2_offset - 1) {
+          for (size_t dim3_offset = 0; dim3_offset <= 1; dim3_offset++) {
+            for (size_t dim3_size = 1; dim3_size <= kDim3 - dim3_offset; dim3_size += kDim3 - dim3_offset - 1) {
+              for (size_t dim4_offset = 0; dim4_offset <= 1; dim4_offset++) {
+                for (size_t dim4_size = 1; dim4_size <= kDim4 - dim4_offset; dim4_size += kDim4 - dim4_offset - 1) {
+                  for (size_t dim5_offset = 0; dim5_offset <= 1; dim5_offset++) {
+                    for (size_t dim5_size = 1; dim5_size <= kDim5 - dim5_offset; dim5_size += kDim5 - dim5_offset - 1) {
+                      for (size_t dim6_offset = 0; dim6_offset <= 1; dim6_offset++) {
+                        for (size_t dim6_size = 1; dim6_size <= kDim6 - dim6_offset; dim6_size += kDim6 - dim6_offset - 1) {
+                          SliceOperatorTester()
+                            .input_shape({kDim1, kDim2, kDim3, kDim4, kDim5, kDim6})
+                            .offsets({dim1_offset, dim2_offset, dim3_offset, dim4_offset, dim5_offset, dim6_offset})
+                            .sizes({dim1_size, dim2_size, dim3_size, dim4_size, dim5_size, dim6_size})
+                            .TestX16();
+                        }
+                      }
+                    }
+                  }
+                }
+              }
+            }
+          }
+        }
+      }
+    }
+  }
+}
+
+TEST(SLICE_ND_X16, 1d_strided) {
+  for (size_t dim1_offset = 0; dim1_offset <= 1; dim1_offset++) {
+    for (size_t dim1_stride = 1; dim1_stride <= 2; dim1_stride++) {
+      const size_t dim1_size = (kDim1 - dim1_offset - 1) / dim1_stride + 1;
+      SliceOperatorTester()
+        .input_shape({kDim1})
+        .offsets({dim1_offset})
+        .sizes({dim1_size})
+        .strides({dim1_stride})
+        .TestX16();
+    }
+  }
+}
+
+TEST(SLICE_ND_X16, 2d_strided) {
+  for (size_t dim1_offset = 0; dim1_offset <= 1; dim1_offset++) {
+    for (size_t dim1_stride = 1; dim1_stride <= 2; dim1_stride++) {
+      const size_t dim1_size = (kDim1 - dim1_offset - 1) / dim1_stride + 1;
+      for (size_t dim2_offset = 0; dim2_offset <= 1; dim2_offset++) {
+        for (size_t dim2_stride = 1; dim2_stride <= 2; dim2_stride++) {
+          const size_t dim2_size = (kDim2 - dim2_offset - 1) / dim2_stride + 1;
+          SliceOperatorTester()
+            .input_shape({kDim1, kDim2})
+            .offsets({dim1_offset, dim2_offset})
+            .sizes({dim1_size, dim2_size})
+            .strides({dim1_stride, dim2_stride})
+            .TestX16();
+        }
+      }
+    }
+  }
+}
+
+TEST(SLICE_ND_X16, 3d_strided) {
+  for (size_t dim1_offset = 0; dim1_offset <= 1; dim1_offset++) {
+    for (size_t dim1_stride = 1; dim1_stride <= 2; dim1_stride++) {
+      const size_t dim1_size = (kDim1 - dim1_offset - 1) / dim1_stride + 1;
+      for (size_t dim2_offset = 0; dim2_offset <= 1; dim2_offset++) {
+        for (size_t dim2_stride = 1; dim2_stride <= 2; dim2_stride++) {
+          const size_t dim2_size = (kDim2 - dim2_offset - 1) / dim2_stride + 1;
+          for (size_t dim3_offset = 0; dim3_offset <= 1; dim3_offset++) {
+            for (size_t dim3_stride = 1; dim3_stride <= 2; dim3_stride++) {
+              const size_t dim3_size = (kDim3 - dim3_offset - 1) / dim3_stride + 1;
+              SliceOperatorTester()
+                .input_shape({kDim1, kDim2, kDim3})
+                .offsets({dim1_offset, dim2_offset, dim3_offset})
+                .sizes({dim1_size, dim2_size, dim3_size})
+                .strides({dim1_stride, dim2_stride, dim3_stride})
+                .TestX16();
+            }
+          }
+        }
+      }
+    }
+  }
+}
+
+TEST(SLICE_ND_X16, 4d_strided) {
+  for (size_t dim1_offset = 0; dim1_offset <= 1; dim1_offset++) {
+    for (size_t dim1_stride = 1; dim1_stride <= 2; dim1_stride++) {
+      const size_t dim1_size = (kDim1 - dim1_offset - 1) / dim1_stride + 1;
+      for (size_t dim2_offset = 0; dim2_offset <= 1; dim2_offset++) {
+        for (size_t dim2_stride = 1; dim2_stride <= 2; dim2_stride++) {
+          const size_t dim2_size = (kDim2 - dim2_offset - 1) / dim2_stride + 1;
+          for (size_t dim3_offset = 0; dim3_offset <= 1; dim3_offset++) {
+            for (size_t dim3_stride = 1; dim3_stride <= 2; dim3_stride++) {
+              const size_t dim3_size = (kDim3 - dim3_offset - 1) / dim3_stride + 1;
+              for (size_t dim4_offset = 0; dim4_offset <= 1; dim4_offset++) {
+                for (size_t dim4_stride = 1; dim4_stride <= 2; dim4_stride++) {
+                  const size_t dim4_size = (kDim4 - dim4_offset - 1) / dim4_stride + 1;
+                  SliceOperatorTester()
+                    .input_shape({kDim1, kDim2, kDim3, kDim4})
+                    .offsets({dim1_offset, dim2_offset, dim3_offset, dim4_offset})
+                    .sizes({dim1_size, dim2_size, dim3_size, dim4_size})
+                    .strides({dim1_stride, dim2_stride, dim3_stride, dim4_stride})
+                    .TestX16();
+                }
+              }
+            }
+          }
+        }
+      }
+    }
+  }
+}
+
+TEST(SLICE_ND_X16, 5d_strided) {
+  for (size_t dim1_offset = 0; dim1_offset <= 1; dim1_offset++) {
+    for (size_t dim1_stride = 1; dim1_stride <= 2; dim1_stride++) {
+      const size_t dim1_size = (kDim1 - dim1_offset - 1) / dim1_stride + 1;
+      for (size_t dim2_offset = 0; dim2_offset <= 1; dim2_offset++) {
+        for (size_t dim2_stride = 1; dim2_stride <= 2; dim2_stride++) {
+          const size_t dim2_size = (kDim2 - dim2_offset - 1) / dim2_stride + 1;
+          for (size_t dim3_offset = 0; dim3_offset <= 1; dim3_offset++) {
+            for (size_t dim3_stride = 1; dim3_stride <= 2; dim3_stride++) {
+              const size_t dim3_size = (kDim3 - dim3_offset - 1) / dim3_stride + 1;
+              for (size_t dim4_offset = 0; dim4_offset <= 1; dim4_offset++) {
+                for (size_t dim4_stride = 1; dim4_stride <= 2; dim4_stride++) {
+                  const size_t dim4_size = (kDim4 - dim4_offset - 1) / dim4_stride + 1;
+                  for (size_t dim5_offset = 0; dim5_offset <= 1; dim5_offset++) {
+                    for (size_t dim5_stride = 1; dim5_stride <= 2; dim5_stride++) {
+                      const size_t dim5_size = (kDim5 - dim5_offset - 1) / dim5_stride + 1;
+                      SliceOperatorTester()
+                        .input_shape({kDim1, kDim2, kDim3, kDim4, kDim5})
+                        .offsets({dim1_offset, dim2_offset, dim3_offset, dim4_offset, dim5_offset})
+                        .sizes({dim1_size, dim2_size, dim3_size, dim4_size, dim5_size})
+                        .strides({dim1_stride, dim2_stride, dim3_stride, dim4_stride, dim5_stride})
+                        .TestX16();
+                    }
+                  }
+                }
+              }
+            }
+          }
+        }
+      }
+    }
+  }
+}
+
+TEST(SLICE_ND_X16, 6d_strided) {
+  for (size_t dim1_offset = 0; dim1_offset <= 1; dim1_offset++) {
+    for (size_t dim1_stride = 1; dim1_stride <= 2; dim1_stride++) {
+      const size_t dim1_size = (kDim1 - dim1_offset - 1) / dim1_stride + 1;
+      for (size_t dim2_offset = 0; dim2_offset <= 1; dim2_offset++) {
+        for (size_t dim2_stride = 1; dim2_stride <= 2; dim2_stride++) {
+          const size_t dim2_size = (kDim2 - dim2_offset - 1) / dim2_stride + 1;
+          for (size_t dim3_offset = 0; dim3_offset <= 1; dim3_offset++) {
+            for (size_t dim3_stride = 1; dim3_stride <= 2; dim3_stride++) {
+              const size_t dim3_size = (kDim3 - dim3_offset - 1) / dim3_stride + 1;
+              for (size_t dim4_offset = 0; dim4_offset <= 1; dim4_offset++) {
+                for (size_t dim4_stride = 1; dim4_stride <= 2; dim4_stride++) {
+                  const size_t dim4_size = (kDim4 - dim4_offset - 1) / dim4_stride + 1;
+                  for (size_t dim5_offset = 0; dim5_offset <= 1; dim5_offset++) {
+                    for (size_t dim5_stride = 1; dim5_stride <= 2; dim5_stride++) {
+                      const size_t dim5_size = (kDim5 - dim5_offset - 1) / dim5_stride + 1;
+                      for (size_t dim6_offset = 0; dim6_offset <= 1; dim6_offset++) {
+                        for (size_t dim6_stride = 1; dim6_stride <= 2; dim6_stride++) {
+                          const size_t dim6_size = (kDim6 - dim6_offset - 1) / dim6_stride + 1;
+                          SliceOperatorTester()
+                            .input_shape({kDim1, kDim2, kDim3, kDim4, kDim5, kDim6})
+                            .offsets({dim1_offset, dim2_offset, dim3_offset, dim4_offset, dim5_offset, dim6_offset})
+                            .sizes({dim1_size, dim2_size, dim3_size, dim4_size, dim5_size, dim6_size})
+                            .strides({dim1_stride, dim2_stride, dim3_stride, dim4_stride, dim5_stride, dim6_stride})
+                            .TestX16();
+                        }
+                      }
+                    }
+                  }
+                }
+              }
+            }
+          }
+        }
+      }
+    }
+  }
+}
+
+TEST(SLICE_ND_X32, 0d) {
+  SliceOperatorTester()
+    .TestX32();
+}
+
+TEST(SLICE_ND_X32, 1d) {
+  for (size_t dim1_offset = 0; dim1_offset <= 1; dim1_offset++) {
+    for (size_t dim1_size = 1; dim1_size <= kDim1 - dim1_offset; dim1_size += kDim1 - dim1_offset - 1) {
+      SliceOperatorTester()
+        .input_shape({kDim1})
+        .offsets({dim1_offset})
+        .sizes({dim1_size})
+        .TestX32();
+    }
+  }
+}
+
+TEST(SLICE_ND_X32, 2d) {
+  for (size_t dim1_offset = 0; dim1_offset <= 1; dim1_offset++) {
+    for (size_t dim1_size = 1; dim1_size <= kDim1 - dim1_offset; dim1_size += kDim1 - dim1_offset - 1) {
+      for (size_t dim2_offset = 0; dim2_offset <= 1; dim2_offset++) {
+        for (size_t dim2_size = 1; dim2_size <= kDim2 - dim2_offset; dim2_size += kDim2 - dim2_offset - 1) {
+          SliceOperatorTester()
+            .input_shape({kDim1, kDim2})
+            .offsets({dim1_offset, dim2_offset})
+            .sizes({dim1_size, dim2_size})
+            .TestX32();
+        }
+      }
+    }
+  }
+}
+
+TEST(SLICE_ND_X32, 3d) {
+  for (size_t dim1_offset = 0; dim1_offset <= 1; dim1_offset++) {
+    for (size_t dim1_size = 1; dim1_size <= kDim1 - dim1_offset; dim1_size += kDim1 - dim1_offset - 1) {
+      for (size_t dim2_offset = 0; dim2_offset <= 1; dim2_offset++) {
+        for (size_t dim2_size = 1; dim2_size <= kDim2 - dim2_offset; dim2_size += kDim2 - dim2_offset - 1) {
+          for (size_t dim3_offset = 0; dim3_offset <= 1; dim3_offset++) {
+            for (size_t dim3_size = 1; dim3_size <= kDim3 - dim3_offset; dim3_size += kDim3 - dim3_offset - 1) {
+              SliceOperatorTester()
+                .input_shape({kDim1, kDim2, kDim3})
+                .offsets({dim1_offset, dim2_offset, dim3_offset})
+                .sizes({dim1_size, dim2_size, dim3_size})
+                .TestX32();
+            }
+          }
+        }
+      }
+    }
+  }
+}
+
+TEST(SLICE_ND_X32, 4d) {
+  for (size_t dim1_offset = 0; dim1_offset <= 1; dim1_offset++) {
+    for (size_t dim1_size = 1; dim1_size <= kDim1 - dim1_offset; dim1_size += kDim1 - dim1_offset - 1) {
+      for (size_t dim2_offset = 0; dim2_offset <= 1; dim2_offset++) {
+        for (size_t dim2_size = 1; dim2_size <= kDim2 - dim2_offset; dim2_size += kDim2 - dim2_offset - 1) {
+          for (size_t dim3_offset = 0; dim3_offset <= 1; dim3_offset++) {
+            for (size_t dim3_size = 1; dim3_size <= kDim3 - dim3_offset; dim3_size += kDim3 - dim3_offset - 1) {
+              for (size_t dim4_offset = 0; dim4_offset <= 1; dim4_offset++) {
+                for (size_t dim4_size = 1; dim4_size <= kDim4 - dim4_offset; dim4_size += kDim4 - dim4_offset - 1) {
+                  SliceOperatorTester()
+                    .input_shape({kDim1, kDim2, kDim3, kDim4})
+                    .offsets({dim1_offset, dim2_offset, dim3_offset, dim4_offset})
+                    .sizes({dim1_size, dim2_size, dim3_size, dim4_size})
+                    .TestX32();
+                }
+              }
+            }
+          }
+        }
+      }
+    }
+  }
+}
+
+TEST(SLICE_ND_X32, 5d) {
+  for (size_t dim1_offset = 0; dim1_offset <= 1; dim1_offset++) {
+    for (size_t dim1_size = 1; dim1_size <= kDim1 - dim1_offset; dim1_size += kDim1 - dim1_offset - 1) {
+      for (size_t dim2_offset = 0; dim2_offset <= 1; dim2_offset++) {
+        for (size_t dim2_size = 1; dim2_size <= kDim2 - dim2_offset; dim2_size += kDim2 - dim2_offset - 1) {
+          for (size_t dim3_offset = 0; dim3_offset <= 1; dim3_offset++) {
+            for (size_t dim3_size = 1; dim3_size <= kDim3 - dim3_offset; dim3_size += kDim3 - dim3_offset - 1) {
+              for (size_t dim4_offset = 0; dim4_offset <= 1; dim4_offset++) {
+                for (size_t dim4_size = 1; dim4_size <= kDim4 - dim4_offset; dim4_size += kDim4 - dim4_offset - 1) {
+                  for (size_t dim5_offset = 0; dim5_offset <= 1; dim5_offset++) {
+                    for (size_t dim5_size = 1; dim5_size <= kDim5 - dim5_offset; dim5_size += kDim5 - dim5_offset - 1) {
+                      SliceOperatorTester()
+                        .input_shape({kDim1, kDim2, kDim3, kDim4, kDim5})
+                        .offsets({dim1_offset, dim2_offset, dim3_offset, dim4_offset, dim5_offset})
+                        .sizes({dim1_size, dim2_size, dim3_size, dim4_size, dim5_size})
+                        .TestX32();
+                    }
+                  }
+                }
+              }
+            }
+          }
+        }
+      }
+    }
+  }
+}
+
+TEST(SLICE_ND_X32, 6d) {
+  for (size_t dim1_offset = 0; dim1_offset <= 1; dim1_offset++) {
+    for (size_t dim1_size = 1; dim1_size <= kDim1 - dim1_offset; dim1_size += kDim1 - dim1_offset - 1) {
+      for (size_t dim2_offset = 0; dim2_offset <= 1; dim2_offset++) {
+        for (size_t dim2_size = 1; dim2_size <= kDim2 - dim2_offset; dim2_size += kDim2 - dim2_offset - 1) {
+          for (size_t dim3_offset = 0; dim3_offset <= 1; dim3_offset++) {
+            for (size_t dim3_size = 1; dim3_size <= kDim3 - dim3_offset; dim3_size += kDim3 - dim3_offset - 1) {
+              for (size_t dim4_offset = 0; dim4_offset <= 1; dim4_offset++) {
+                for (size_t dim4_size = 1; dim4_size <= kDim4 - dim4_offset; dim4_size += kDim4 - dim4_offset - 1) {
+                  for (size_t dim5_offset = 0; dim5_offset <= 1; dim5_offset++) {
+                    for (size_t dim5_size = 1; dim5_size <= kDim5 - dim5_offset; dim5_size += kDim5 - dim5_offset - 1) {
+                      for (size_t dim6_offset = 0; dim6_offset <= 1; dim6_offset++) {
+                        for (size_t dim6_size = 1; dim6_size <= kDim6 - dim6_offset; dim6_size += kDim6 - dim6_offset - 1) {
+                          SliceOperatorTester()
+                            .input_shape({kDim1, kDim2, kDim3, kDim4, kDim5, kDim6})
+                            .offsets({dim1_offset, dim2_offset, dim3_offset, dim4_offset, dim5_offset, dim6_offset})
+                            .sizes({dim1_size, dim2_size, dim3_size, dim4_size, dim5_size, dim6_size})
+                            .TestX32();
+                        }
+                      }
+                    }
+                  }
+                }
+              }
+            }
+          }
+        }
+      }
+    }
+  }
+}
+
+TEST(SLICE_ND_X32, 1d_strided) {
+  for (size_t dim1_offset = 0; dim1_offset <= 1; dim1_offset++) {
+    for (size_t dim1_stride = 1; dim1_stride <= 2; dim1_stride++) {
+      const size_t dim1_size = (kDim1 - dim1_offset - 1) / dim1_stride + 1;
+      SliceOperatorTester()
+        .input_shape({kDim1})
+        .offsets({dim1_offset})
+        .sizes({dim1_size})
+        .strides({dim1_stride})
+        .TestX32();
+    }
+  }
+}
+
+TEST(SLICE_ND_X32, 2d_strided) {
+  for (size_t dim1_offset = 0; dim1_offset <= 1; dim1_offset++) {
+    for (size_t dim1_stride = 1; dim1_stride <= 2; dim1_stride++) {
+      const size_t dim1_size = (kDim1 - dim1_offset - 1) / dim1_stride + 1;
+      for (size_t dim2_offset = 0; dim2_offset <= 1; dim2_offset++) {
+        for (size_t dim2_stride = 1; dim2_stride <= 2; dim2_stride++) {
+          const size_t dim2_size = (kDim2 - dim2_offset - 1) / dim2_stride + 1;
+          SliceOperatorTester()
+            .input_shape({kDim1, kDim2})
+            .offsets({dim1_offset, dim2_offset})
+            .sizes({dim1_size, dim2_size})
+            .strides({dim1_stride, dim2_stride})
+            .TestX32();
+        }
+      }
+    }
+  }
+}
+
+TEST(SLICE_ND_X32, 3d_strided) {
+  for (size_t dim1_offset = 0; dim1_offset <= 1; dim1_offset++) {
+    for (size_t dim1_stride = 1; dim1_stride <= 2; dim1_stride++) {
+      const size_t dim1_size = (kDim1 - dim1_offset - 1) / dim1_stride + 1;
+      for (size_t dim2_offset = 0; dim2_offset <= 1; dim2_offset++) {
+        for (size_t dim2_stride = 1; dim2_stride <= 2; dim2_stride++) {
+          const size_t dim2_size = (kDim2 - dim2_offset - 1) / dim2_stride + 1;
+          for (size_t dim3_offset = 0; dim3_offset <= 1; dim3_offset++) {
+            for (size_t dim3_stride = 1; dim3_stride <= 2; dim3_stride++) {
+              const size_t dim3_size = (kDim3 - dim3_offset - 1) / dim3_stride + 1;
+              SliceOperatorTester()
+                .input_shape({kDim1, kDim2, kDim3})
+                .offsets({dim1_offset, dim2_offset, dim3_offset})
+                .sizes({dim1_size, dim2_size, dim3_size})
+                .strides({dim1_stride, dim2_stride, dim3_stride})
+                .TestX32();
+            }
+          }
+        }
+      }
+    }
+  }
+}
+
+TEST(SLICE_ND_X32, 4d_strided) {
+  for (size_t dim1_offset = 0; dim1_offset <= 1; dim1_offset++) {
+    for (size_t dim1_stride = 1; dim1_stride <= 2; dim1_stride++) {
+      const size_t dim1_size = (kDim1 - dim1_offset - 1) / dim1_stride + 1;
+      for (size_t dim2_offset = 0; dim2_offset <= 1; dim2_offset++) {
+        for (size_t dim2_stride = 1; dim2_stride <= 2; dim2_stride++) {
+          const size_t dim2_size = (kDim2 - dim2_offset - 1) / dim2_stride + 1;
+          for (size_t dim3_offset = 0; dim3_offset <= 1; dim3_offset++) {
+            for (size_t dim3_stride = 1; dim3_stride <= 2; dim3_stride++) {
+              const size_t dim3_size = (kDim3 - dim3_offset - 1) / dim3_stride + 1;
+              for (size_t dim4_offset = 0; dim4_offset <= 1; dim4_offset++) {
+                for (size_t dim4_stride = 1; dim4_stride <= 2; dim4_stride++) {
+                  const size_t dim4_size = (kDim4 - dim4_offset - 1) / dim4_stride + 1;
+                  SliceOperatorTester()
+                    .input_shape({kDim1, kDim2, kDim3, kDim4})
+                    .offsets({dim1_offset, dim2_offset, dim3_offset, dim4_offset})
+                    .sizes({dim1_size, dim2_size, dim3_size, dim4_size})
+                    .strides({dim1_stride, dim2_stride, dim3_stride, dim4_stride})
+                    .TestX32();
+                }
+              }
+            }
+          }
+        }
+      }
+    }
+  }
+}
+
+TEST(SLICE_ND_X32, 5d_strided) {
+  for (size_t dim1_offset = 0; dim1_offset <= 1; dim1_offset++) {
+    for (size_t dim1_stride = 1; dim1_stride <= 2; dim1_stride++) {
+      const size_t dim1_size = (kDim1 - dim1_offset - 1) / dim1_stride + 1;
+      for (size_t dim2_offset = 0; dim2_offset <= 1; dim2_offset++) {
+        for (size_t dim2_stride = 1; dim2_stride <= 2; dim2_stride++) {
+          const size_t dim2_size = (kDim2 - dim2_offset - 1) / dim2_stride + 1;
+          for (size_t dim3_offset = 0; dim3_offset <= 1; dim3_offset++) {
+            for (size_t dim3_stride = 1; dim3_stride <= 2; dim3_stride++) {
+              const size_t dim3_size = (kDim3 - dim3_offset - 1) / dim3_stride + 1;
+              for (size_t dim4_offset = 0; dim4_offset <= 1; dim4_offset++) {
+                for (size_t dim4_stride = 1; dim4_stride <= 2; dim4_stride++) {
+                  const size_t dim4_size = (kDim4 - dim4_offset - 1) / dim4_stride + 1;
+                  for (size_t dim5_offset = 0; dim5_offset <= 1; dim5_offset++) {
+                    for (size_t dim5_stride = 1; dim5_stride <= 2; dim5_stride++) {
+                      const size_t dim5_size = (kDim5 - dim5_offset - 1) / dim5_stride + 1;
+                      SliceOperatorTester()
+                        .input_shape({kDim1, kDim2, kDim3, kDim4, kDim5})
+                        .offsets({dim1_offset, dim2_offset, dim3_offset, dim4_offset, dim5_offset})
+                        .sizes({dim1_size, dim2_size, dim3_size, dim4_size, dim5_size})
+                        .strides({dim1_stride, dim2_stride, dim3_stride, dim4_stride, dim5_stride})
+                        .TestX32();
+                    }
+                  }
+                }
+              }
+            }
+          }
+        }
+      }
+    }
+  }
+}
+
+TEST(SLICE_ND_X32, 6d_strided) {
+  for (size_t dim1_offset = 0; dim1_offset <= 1; dim1_offset++) {
+    for (size_t dim1_stride = 1; dim1_stride <= 2; dim1_stride++) {
+      const size_t dim1_size = (kDim1 - dim1_offset - 1) / dim1_stride + 1;
+      for (size_t dim2_offset = 0; dim2_offset <= 1; dim2_offset++) {
+        for (size_t dim2_stride = 1; dim2_stride <= 2; dim2_stride++) {
+          const size_t dim2_size = (kDim2 - dim2_offset - 1) / dim2_stride + 1;
+          for (size_t dim3_offset = 0; dim3_offset <= 1; dim3_offset++) {
+            for (size_t dim3_stride = 1; dim3_stride <= 2; dim3_stride++) {
+              const size_t dim3_size = (kDim3 - dim3_offset - 1) / dim3_stride + 1;
+              for (size_t dim4_offset = 0; dim4_offset <= 1; dim4_offset++) {
+                for (size_t dim4_stride = 1; dim4_stride <= 2; dim4_stride++) {
+                  const size_t dim4_size = (kDim4 - dim4_offset - 1) / dim4_stride + 1;
+                  for (size_t dim5_offset = 0; dim5_offset <= 1; dim5_offset++) {
+                    for (size_t dim5_stride = 1; dim5_stride <= 2; dim5_stride++) {
+                      const size_t dim5_size = (kDim5 - dim5_offset - 1) / dim5_stride + 1;
+                      for (size_t dim6_offset = 0; dim6_offset <= 1; dim6_offset++) {
+                        for (size_t dim6_stride = 1; dim6_stride <= 2; dim6_stride++) {
+                          const size_t dim6_size = (kDim6 - dim6_offset - 1) / dim6_stride + 1;
+                          SliceOperatorTester()
+                            .input_shape({kDim1, kDim2, kDim3, kDim4, kDim5, kDim6})
+                            .offsets({dim1_offset, dim2_offset, dim3_offset, dim4_offset, dim5_offset, dim6_offset})
+                            .sizes({dim1_size, dim2_size, dim3_size, dim4_size, dim5_size, dim6_size})
+                            .strides({dim1_stride, dim2_stride, dim3_stride, dim4_stride, dim5_stride, dim6_stride})
+                            .TestX32();
+                        }
+                      }
+                    }
+                  }
+                }
+              }
+            }
+          }
+        }
+      }
+    }
+  }
+}
@@ -0,0 +1,232 @@
+// Copyright 2022 Google LLC
+//
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree.
+
+#pragma once
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <array>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <functional>
+#include <initializer_list>
+#include <limits>
+#include <memory>
+#include <numeric>
+#include <random>
+#include <vector>
+
+#include <xnnpack.h>
+
+
+class SliceOperatorTester {
+ public:
+  inline SliceOperatorTester& input_shape(std::initializer_list<size_t> input_shape) {
+    assert(input_shape.size() <= XNN_MAX_TENSOR_DIMS);
+    input_shape_ = std::vector<size_t>(input_shape);
+    return *this;
+  }
+
+  inline const std::vector<size_t>& input_shape() const {
+    return input_shape_;
+  }
+
+  inline size_t input_dim(size_t i) const {
+    return i < input_shape_.size() ? input_shape_[i] : 1;
+  }
+
+  inline size_t num_dims() const {
+    return input_shape_.size();
+  }
+
+  inline size_t num_input_elements() const {
+    return std::accumulate(
+      input_shape_.cbegin(), input_shape_.cend(), size_t(1), std::multiplies<size_t>());
+  }
+
+  inline SliceOperatorTester& offsets(std::initializer_list<size_t> offsets) {
+    assert(offsets.size() <= XNN_MAX_TENSOR_DIMS);
+    offsets_ = std::vector<size_t>(offsets);
+    return *this;
+  }
+
+  inline const std::vector<size_t>& offsets() const {
+    return offsets_;
+  }
+
+  inline size_t offset(size_t i) const {
+    return i < offsets_.size() ? offsets_[i] : 0;
+  }
+
+  inline size_t num_offsets() const {
+    return offsets_.size();
+  }
+
+  inline SliceOperatorTester& sizes(std::initializer_list<size_t> sizes) {
+    assert(sizes.size() <= XNN_MAX_TENSOR_DIMS);
+    sizes_ = std::vector<size_t>(sizes);
+    return *this;
+  }
+
+  inline const std::vector<size_t>& sizes() const {
+    return sizes_;
+  }
+
+  inline size_t size(size_t i) const {
+    return i < sizes_.size() ? sizes_[i] : 1;
+  }
+
+  inline size_t num_sizes() const {
+    return sizes_.size();
+  }
+
+  inline SliceOperatorTester& strides(std::initializer_list<size_t> strides) {
+    assert(strides.size() <= XNN_MAX_TENSOR_DIMS);
+    strides_ = std::vector<size_t>(strides);
+    return *this;
+  }
+
+  inline const std::vector<size_t>& strides() const {
+    return strides_;
+  }
+
+  inline size_t stride(size_t i) const {
+    return i < strides_.size() ? strides_[i] : 1;
+  }
+
+  inline size_t num_output_elements() const {
+    size_t elements = 1;
+    for (size_t i = 0; i < num_dims(); i++) {
+      elements *= size(i);
+    }
+    return elements;
+  }
+
+  inline SliceOperatorTester& iterations(size_t iterations) {
+    this->iterations_ = iterations;
+    return *this;
+  }
+
+  inline size_t iterations() const {
+    return this->iterations_;
+  }
+
+  void TestX8() const {
+    Test<uint8_t>(xnn_create_slice_nd_x8, xnn_setup_slice_nd_x8);
+  }
+
+  void TestX16() const {
+    Test<uint16_t>(xnn_create_slice_nd_x16, xnn_setup_slice_nd_x16);
+  }
+
+  void TestX32() const {
+    Test<uint32_t>(xnn_create_slice_nd_x32, xnn_setup_slice_nd_x32);
+  }
+
+ private:
+  template<class T, class CreateFunction, class SetupFunction>
+  void Test(CreateFunction create_fn, SetupFunction setup_fn) const {
+    ASSERT_EQ(num_dims(), num_offsets());
+    ASSERT_EQ(num_dims(), num_sizes());
+    if (!strides().empty()) {
+      ASSERT_EQ(num_dims(), strides().size());
+    }
+
+    std::random_device random_device;
+    auto rng = std::mt19937(random_device());
+    auto trng = std::bind(std::uniform_int_distribution<uint32_t>(0, std::numeric_limits<T>::max()), rng);
+
+    // Compute generalized shapes.
+    std::array<size_t, XNN_MAX_TENSOR_DIMS> input_dims;
+    std::array<size_t, XNN_MAX_TENSOR_DIMS> input_offsets;
+    std::array<size_t, XNN_MAX_TENSOR_DIMS> input_steps;
+    std::array<size_t, XNN_MAX_TENSOR_DIMS> output_dims;
+    std::fill(input_dims.begin(), input_dims.end(), 1);
+    std::fill(input_offsets.begin(), input_offsets.end(), 0);
+    std::fill(input_steps.begin(), input_steps.end(), 1);
+    std::fill(output_dims.begin(), output_dims.end(), 1);
+    for (size_t i = 0; i < num_dims(); i++) {
+      input_dims[XNN_MAX_TENSOR_DIMS - num_dims() + i] = input_dim(i);
+      input_offsets[XNN_MAX_TENSOR_DIMS - num_dims() + i] = offset(i);
+      input_steps[XNN_MAX_TENSOR_DIMS - num_dims() + i] = stride(i);
+      output_dims[XNN_MAX_TENSOR_DIMS - num_dims() + i] = size(i);
+    }
+
+    // Compute generalized strides.
+    std::array<size_t, XNN_MAX_TENSOR_DIMS> input_strides;
+    std::array<size_t, XNN_MAX_TENSOR_DIMS> output_strides;
+    size_t input_stride = 1, output_stride = 1;
+    for (size_t i = XNN_MAX_TENSOR_DIMS; i != 0; i--) {
+      input_strides[i - 1] = input_stride;
+      output_strides[i - 1] = output_stride;
+      input_stride *= input_dims[i - 1];
+      output_stride *= output_dims[i - 1];
+    }
+
+    std::vector<T> input(XNN_EXTRA_BYTES / sizeof(T) + num_input_elements());
+    std::vector<T> output(num_output_elements());
+    for (size_t iteration = 0; iteration < iterations(); iteration++) {
+      std::generate(input.begin(), input.end(), [&]() { return T(trng()); });
+      std::fill(output.begin(), output.end(), T(0xA5A5A5A5));
+
+      // Create, setup, run, and destroy Slice operator.
+      ASSERT_EQ(xnn_status_success, xnn_initialize(nullptr /* allocator */));
+      xnn_operator_t slice_op = nullptr;
+
+      ASSERT_EQ(xnn_status_success, create_fn(0, &slice_op));
+      ASSERT_NE(nullptr, slice_op);
+
+      // Smart pointer to automatically delete slice_op.
+      std::unique_ptr<xnn_operator, decltype(&xnn_delete_operator)> auto_slice_op(slice_op, xnn_delete_operator);
+
+      ASSERT_EQ(xnn_status_success,
+        setup_fn(
+          slice_op,
+          num_dims(),
+          input_shape().data(), offsets().data(), sizes().data(),
+          strides().empty() ? nullptr : strides().data(),
+          input.data(), output.data(),
+          nullptr /* thread pool */));
+
+      ASSERT_EQ(xnn_status_success,
+        xnn_run_operator(slice_op, nullptr /* thread pool */));
+
+      // Verify results.
+      for (size_t i = 0; i < output_dims[0]; i++) {
+        for (size_t j = 0; j < output_dims[1]; j++) {
+          for (size_t k = 0; k < output_dims[2]; k++) {
+            for (size_t l = 0; l < output_dims[3]; l++) {
+              for (size_t m = 0; m < output_dims[4]; m++) {
+                for (size_t n = 0; n < output_dims[5]; n++) {
+                  const size_t input_index =
+                    (input_offsets[0] + i * input_steps[0]) * input_strides[0] +
+                    (input_offsets[1] + j * input_steps[1]) * input_strides[1] +
+                    (input_offsets[2] + k * input_steps[2]) * input_strides[2] +
+                    (input_offsets[3] + l * input_steps[3]) * input_strides[3] +
+                    (input_offsets[4] + m * input_steps[4]) * input_strides[4] +
+                    (input_offsets[5] + n * input_steps[5]) * input_strides[5];
+                  const size_t output_index =
+                    i * output_strides[0] + j * output_strides[1] + k * output_strides[2] +
+                    l * output_strides[3] + m * output_strides[4] + n * output_strides[5];
+                  ASSERT_EQ(input[input_index], output[output_index])
+                    << "(i, j, k, l, m, n) = (" << i << ", " << j << ", " << k << ", " << l << ", " << m << ", " << n << ")";
+                }
+              }
+            }
+          }
+        }
+      }
+    }
+  }
+
+  std::vector<size_t> input_shape_;
+  std::vector<size_t> offsets_;
+  std::vector<size_t> sizes_;
+  std::vector<size_t> strides_;
+  size_t iterations_{3};
+};
@@ -0,0 +1,282 @@
+// Copyright 2022 Google LLC
+//
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree.
+
+#include "space-to-depth-operator-tester.h"
+
+#include <gtest/gtest.h>
+
+
+TEST(SPACE_TO_DEPTH_NHWC_X8, one_pixel) {
+  SpaceToDepthOperatorTester()
+    .output_size(1, 1)
+    .block_size(3)
+    .input_channels(17)
+    .TestNHWCxX8();
+}
+
+TEST(SPACE_TO_DEPTH_NHWC_X8, one_column) {
+  for (size_t output_height = 2; output_height <= 7; output_height++) {
+    SpaceToDepthOperatorTester()
+      .output_size(output_height, 1)
+      .block_size(3)
+      .input_channels(17)
+      .TestNHWCxX8();
+  }
+}
+
+TEST(SPACE_TO_DEPTH_NHWC_X8, one_row) {
+  for (size_t output_width = 2; output_width <= 7; output_width++) {
+    SpaceToDepthOperatorTester()
+      .output_size(1, output_width)
+      .block_size(3)
+      .input_channels(17)
+      .TestNHWCxX8();
+  }
+}
+
+TEST(SPACE_TO_DEPTH_NHWC_X8, varying_output_size) {
+  for (size_t output_height = 1; output_height <= 5; output_height++) {
+    for (size_t output_width = 1; output_width <= 5; output_width++) {
+      SpaceToDepthOperatorTester()
+        .output_size(output_height, output_width)
+        .block_size(3)
+        .input_channels(17)
+        .TestNHWCxX8();
+    }
+  }
+}
+
+TEST(SPACE_TO_DEPTH_NHWC_X8, varying_block_size) {
+  for (uint32_t block_size = 2; block_size <= 5; block_size++) {
+    SpaceToDepthOperatorTester()
+      .output_size(7, 5)
+      .block_size(block_size)
+      .input_channels(17)
+      .TestNHWCxX8();
+  }
+}
+
+TEST(SPACE_TO_DEPTH_NHWC_X8, varying_input_channels) {
+  for (size_t input_channels = 1; input_channels <= 15; input_channels++) {
+    SpaceToDepthOperatorTester()
+      .output_size(7, 5)
+      .block_size(3)
+      .input_channels(input_channels)
+      .TestNHWCxX8();
+  }
+}
+
+TEST(SPACE_TO_DEPTH_NHWC_X8, varying_batch_size) {
+  for (size_t batch_size = 2; batch_size <= 3; batch_size++) {
+    SpaceToDepthOperatorTester()
+      .batch_size(batch_size)
+      .output_size(7, 5)
+      .block_size(3)
+      .input_channels(17)
+      .TestNHWCxX8();
+  }
+}
+
+TEST(SPACE_TO_DEPTH_NHWC_X8, input_channels_stride) {
+  SpaceToDepthOperatorTester()
+    .batch_size(2)
+    .output_size(7, 5)
+    .block_size(3)
+    .input_channels_stride(19)
+    .input_channels(17)
+    .TestNHWCxX8();
+}
+
+TEST(SPACE_TO_DEPTH_NHWC_X8, output_channels_stride) {
+  SpaceToDepthOperatorTester()
+    .batch_size(2)
+    .output_size(7, 5)
+    .block_size(3)
+    .output_channels_stride(157)
+    .input_channels(17)
+    .TestNHWCxX8();
+}
+
+TEST(SPACE_TO_DEPTH_NHWC_X16, one_pixel) {
+  SpaceToDepthOperatorTester()
+    .output_size(1, 1)
+    .block_size(3)
+    .input_channels(17)
+    .TestNHWCxX16();
+}
+
+TEST(SPACE_TO_DEPTH_NHWC_X16, one_column) {
+  for (size_t output_height = 2; output_height <= 7; output_height++) {
+    SpaceToDepthOperatorTester()
+      .output_size(output_height, 1)
+      .block_size(3)
+      .input_channels(17)
+      .TestNHWCxX16();
+  }
+}
+
+TEST(SPACE_TO_DEPTH_NHWC_X16, one_row) {
+  for (size_t output_width = 2; output_width <= 7; output_width++) {
+    SpaceToDepthOperatorTester()
+      .output_size(1, output_width)
+      .block_size(3)
+      .input_channels(17)
+      .TestNHWCxX16();
+  }
+}
+
+TEST(SPACE_TO_DEPTH_NHWC_X16, varying_output_size) {
+  for (size_t output_height = 1; output_height <= 5; output_height++) {
+    for (size_t output_width = 1; output_width <= 5; output_width++) {
+      SpaceToDepthOperatorTester()
+        .output_size(output_height, output_width)
+        .block_size(3)
+        .input_channels(17)
+        .TestNHWCxX16();
+    }
+  }
+}
+
+TEST(SPACE_TO_DEPTH_NHWC_X16, varying_block_size) {
+  for (uint32_t block_size = 2; block_size <= 5; block_size++) {
+    SpaceToDepthOperatorTester()
+      .output_size(7, 5)
+      .block_size(block_size)
+      .input_channels(17)
+      .TestNHWCxX16();
+  }
+}
+
+TEST(SPACE_TO_DEPTH_NHWC_X16, varying_input_channels) {
+  for (size_t input_channels = 1; input_channels <= 15; input_channels++) {
+    SpaceToDepthOperatorTester()
+      .output_size(7, 5)
+      .block_size(3)
+      .input_channels(input_channels)
+      .TestNHWCxX16();
+  }
+}
+
+TEST(SPACE_TO_DEPTH_NHWC_X16, varying_batch_size) {
+  for (size_t batch_size = 2; batch_size <= 3; batch_size++) {
+    SpaceToDepthOperatorTester()
+      .batch_size(batch_size)
+      .output_size(7, 5)
+      .block_size(3)
+      .input_channels(17)
+      .TestNHWCxX16();
+  }
+}
+
+TEST(SPACE_TO_DEPTH_NHWC_X16, input_channels_stride) {
+  SpaceToDepthOperatorTester()
+    .batch_size(2)
+    .output_size(7, 5)
+    .block_size(3)
+    .input_channels_stride(19)
+    .input_channels(17)
+    .TestNHWCxX16();
+}
+
+TEST(SPACE_TO_DEPTH_NHWC_X16, output_channels_stride) {
+  SpaceToDepthOperatorTester()
+    .batch_size(2)
+    .output_size(7, 5)
+    .block_size(3)
+    .output_channels_stride(157)
+    .input_channels(17)
+    .TestNHWCxX16();
+}
+
+TEST(SPACE_TO_DEPTH_NHWC_X32, one_pixel) {
+  SpaceToDepthOperatorTester()
+    .output_size(1, 1)
+    .block_size(3)
+    .input_channels(17)
+    .TestNHWCxX32();
+}
+
+TEST(SPACE_TO_DEPTH_NHWC_X32, one_column) {
+  for (size_t output_height = 2; output_height <= 7; output_height++) {
+    SpaceToDepthOperatorTester()
+      .output_size(output_height, 1)
+      .block_size(3)
+      .input_channels(17)
+      .TestNHWCxX32();
+  }
+}
+
+TEST(SPACE_TO_DEPTH_NHWC_X32, one_row) {
+  for (size_t output_width = 2; output_width <= 7; output_width++) {
+    SpaceToDepthOperatorTester()
+      .output_size(1, output_width)
+      .block_size(3)
+      .input_channels(17)
+      .TestNHWCxX32();
+  }
+}
+
+TEST(SPACE_TO_DEPTH_NHWC_X32, varying_output_size) {
+  for (size_t output_height = 1; output_height <= 5; output_height++) {
+    for (size_t output_width = 1; output_width <= 5; output_width++) {
+      SpaceToDepthOperatorTester()
+        .output_size(output_height, output_width)
+        .block_size(3)
+        .input_channels(17)
+        .TestNHWCxX32();
+    }
+  }
+}
+
+TEST(SPACE_TO_DEPTH_NHWC_X32, varying_block_size) {
+  for (uint32_t block_size = 2; block_size <= 5; block_size++) {
+    SpaceToDepthOperatorTester()
+      .output_size(7, 5)
+      .block_size(block_size)
+      .input_channels(17)
+      .TestNHWCxX32();
+  }
+}
+
+TEST(SPACE_TO_DEPTH_NHWC_X32, varying_input_channels) {
+  for (size_t input_channels = 1; input_channels <= 15; input_channels++) {
+    SpaceToDepthOperatorTester()
+      .output_size(7, 5)
+      .block_size(3)
+      .input_channels(input_channels)
+      .TestNHWCxX32();
+  }
+}
+
+TEST(SPACE_TO_DEPTH_NHWC_X32, varying_batch_size) {
+  for (size_t batch_size = 2; batch_size <= 3; batch_size++) {
+    SpaceToDepthOperatorTester()
+      .batch_size(batch_size)
+      .output_size(7, 5)
+      .block_size(3)
+      .input_channels(17)
+      .TestNHWCxX32();
+  }
+}
+
+TEST(SPACE_TO_DEPTH_NHWC_X32, input_channels_stride) {
+  SpaceToDepthOperatorTester()
+    .batch_size(2)
+    .output_size(7, 5)
+    .block_size(3)
+    .input_channels_stride(19)
+    .input_channels(17)
+    .TestNHWCxX32();
+}
+
+TEST(SPACE_TO_DEPTH_NHWC_X32, output_channels_stride) {
+  SpaceToDepthOperatorTester()
+    .batch_size(2)
+    .output_size(7, 5)
+    .block_size(3)
+    .output_channels_stride(157)
+    .input_channels(17)
+    .TestNHWCxX32();
+}
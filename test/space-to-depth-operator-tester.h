@@ -0,0 +1,223 @@
+// Copyright 2022 Google LLC
+//
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree.
+
+#pragma once
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <functional>
+#include <limits>
+#include <memory>
+#include <random>
+#include <vector>
+
+#include <xnnpack.h>
+
+
+class SpaceToDepthOperatorTester {
+ public:
+  inline SpaceToDepthOperatorTester& output_size(size_t output_height, size_t output_width) {
+    assert(output_height >= 1);
+    assert(output_width >= 1);
+    this->output_height_ = output_height;
+    this->output_width_ = output_width;
+    return *this;
+  }
+
+  inline SpaceToDepthOperatorTester& output_height(size_t output_height) {
+    assert(output_height >= 1);
+    this->output_height_ = output_height;
+    return *this;
+  }
+
+  inline size_t output_height() const {
+    return this->output_height_;
+  }
+
+  inline SpaceToDepthOperatorTester& output_width(size_t output_width) {
+    assert(output_width >= 1);
+    this->output_width_ = output_width;
+    return *this;
+  }
+
+  inline size_t output_width() const {
+    return this->output_width_;
+  }
+
+  inline size_t input_height() const {
+    return output_height() * block_size();
+  }
+
+  inline size_t input_width() const {
+    return output_width() * block_size();
+  }
+
+  inline SpaceToDepthOperatorTester& block_size(size_t block_size) {
+    assert(block_size >= 2);
+    this->block_size_ = block_size;
+    return *this;
+  }
+
+  inline size_t block_size() const {
+    return this->block_size_;
+  }
+
+  inline SpaceToDepthOperatorTester& input_channels(size_t input_channels) {
+    assert(input_channels != 0);
+    this->input_channels_ = input_channels;
+    return *this;
+  }
+
+  inline size_t input_channels() const {
+    return this->input_channels_;
+  }
+
+  inline size_t output_channels() const {
+    return input_channels() * block_size() * block_size();
+  }
+
+  inline SpaceToDepthOperatorTester& batch_size(size_t batch_size) {
+    assert(batch_size != 0);
+    this->batch_size_ = batch_size;
+    return *this;
+  }
+
+  inline size_t batch_size() const {
+    return this->batch_size_;
+  }
+
+  inline SpaceToDepthOperatorTester& input_channels_stride(size_t input_channels_stride) {
+    assert(input_channels_stride >= 1);
+    this->input_channels_stride_ = input_channels_stride;
+    return *this;
+  }
+
+  inline size_t input_channels_stride() const {
+    if (this->input_channels_stride_ == 0) {
+      return input_channels();
+    } else {
+      assert(this->input_channels_stride_ >= input_channels());
+      return this->input_channels_stride_;
+    }
+  }
+
+  inline SpaceToDepthOperatorTester& output_channels_stride(size_t output_channels_stride) {
+    assert(output_channels_stride >= 1);
+    this->output_channels_stride_ = output_channels_stride;
+    return *this;
+  }
+
+  inline size_t output_channels_stride() const {
+    if (this->output_channels_stride_ == 0) {
+      return output_channels();
+    } else {
+      assert(this->output_channels_stride_ >= output_channels());
+      return this->output_channels_stride_;
+    }
+  }
+
+  inline SpaceToDepthOperatorTester& iterations(size_t iterations) {
+    this->iterations_ = iterations;
+    return *this;
+  }
+
+  inline size_t iterations() const {
+    return this->iterations_;
+  }
+
+  void TestNHWCxX8() const {
+    Test<uint8_t>(xnn_create_space_to_depth_nhwc_x8, xnn_setup_space_to_depth_nhwc_x8);
+  }
+
+  void TestNHWCxX16() const {
+    Test<uint16_t>(xnn_create_space_to_depth_nhwc_x16, xnn_setup_space_to_depth_nhwc_x16);
+  }
+
+  void TestNHWCxX32() const {
+    Test<uint32_t>(xnn_create_space_to_depth_nhwc_x32, xnn_setup_space_to_depth_nhwc_x32);
+  }
+
+ private:
+  template<class T, class CreateFunction, class SetupFunction>
+  void Test(CreateFunction create_fn, SetupFunction setup_fn) const {
+    std::random_device random_device;
+    auto rng = std::mt19937(random_device());
+    auto trng = std::bind(std::uniform_int_distribution<uint32_t>(0, std::numeric_limits<T>::max()), rng);
+
+    std::vector<T> input(XNN_EXTRA_BYTES / sizeof(T) +
+      (batch_size() * input_height() * input_width() - 1) * input_channels_stride() + input_channels());
+    std::vector<T> output(
+      (batch_size() * output_height() * output_width() - 1) * output_channels_stride() + output_channels());
+    for (size_t iteration = 0; iteration < iterations(); iteration++) {
+      std::generate(input.begin(), input.end(), [&]() { return T(trng()); });
+      std::fill(output.begin(), output.end(), T(0xA5A5A5A5));
+
+      // Create, setup, run, and destroy Space To Depth operator.
+      ASSERT_EQ(xnn_status_success, xnn_initialize(nullptr /* allocator */));
+      xnn_operator_t space_to_depth_op = nullptr;
+
+      ASSERT_EQ(xnn_status_success,
+        create_fn(
+          input_channels(), input_channels_stride(), output_channels_stride(),
+          block_size(), 0, &space_to_depth_op));
+      ASSERT_NE(nullptr, space_to_depth_op);
+
+      // Smart pointer to automatically delete space_to_depth_op.
+      std::unique_ptr<xnn_operator, decltype(&xnn_delete_operator)> auto_space_to_depth_op(space_to_depth_op, xnn_delete_operator);
+
+      ASSERT_EQ(xnn_status_success,
+        setup_fn(
+          space_to_depth_op,
+          batch_size(), input_height(), input_width(),
+          input.data(), output.data(), nullptr /* thread pool */));
+
+      ASSERT_EQ(xnn_status_success,
+        xnn_run_operator(space_to_depth_op, nullptr /* thread pool */));
+
+      // Verify results.
+      for (size_t i = 0; i < batch_size(); i++) {
+        for (size_t oy = 0; oy < output_height(); oy++) {
+          for (size_t by = 0; by < block_size(); by++) {
+            for (size_t ox = 0; ox < output_width(); ox++) {
+              for (size_t bx = 0; bx < block_size(); bx++) {
+                for (size_t ic = 0; ic < input_channels(); ic++) {
+                  const size_t input_index =
+                    ((i * input_height() + oy * block_size() + by) * input_width() + ox * block_size() + bx) *
+                      input_channels_stride() + ic;
+                  const size_t output_index =
+                    ((i * output_height() + oy) * output_width() + ox) * output_channels_stride() +
+                      (by * block_size() + bx) * input_channels() + ic;
+                  ASSERT_EQ(input[input_index], output[output_index])
+                    << "batch: " << i << " / " << batch_size()
+                    << ", output x: " << ox << " / " << output_width()
+                    << ", output y: " << oy << " / " << output_height()
+                    << ", block x: " << bx << " / " << block_size()
+                    << ", block y: " << by << " / " << block_size()
+                    << ", input channel: " << ic << " / " << input_channels()
+                    << ", input stride: " << input_channels_stride()
+                    << ", output stride: " << output_channels_stride();
+                }
+              }
+            }
+          }
+        }
+      }
+    }
+  }
+
+  size_t output_height_{1};
+  size_t output_width_{1};
+  size_t input_channels_{1};
+  size_t block_size_{2};
+  size_t batch_size_{1};
+  size_t input_channels_stride_{0};
+  size_t output_channels_stride_{0};
+  size_t iterations_{1};
+};
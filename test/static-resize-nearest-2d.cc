@@ -0,0 +1,482 @@
+// Copyright 2022 Google LLC
+//
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree.
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <limits>
+#include <memory>
+#include <random>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <fp16.h>
+
+#include <xnnpack.h>
+#include <xnnpack/subgraph.h>
+
+
+namespace {
+
+using SubgraphPtr = std::unique_ptr<xnn_subgraph, decltype(&xnn_delete_subgraph)>;
+using RuntimePtr = std::unique_ptr<xnn_runtime, decltype(&xnn_delete_runtime)>;
+
+constexpr size_t kBatchSize = 2;
+constexpr size_t kInputHeight = 5;
+constexpr size_t kInputWidth = 7;
+constexpr size_t kChannels = 3;
+constexpr uint32_t kInputId = 0;
+constexpr uint32_t kOutputId = 1;
+
+// Index of the input pixel that TensorFlow Lite reads for the output pixel output_index along one dimension.
+size_t NearestInputIndex(size_t output_index, size_t input_size, size_t output_size, uint32_t flags) {
+  double input_index;
+  if ((flags & XNN_FLAG_ALIGN_CORNERS) && output_size > 1) {
+    input_index = std::round(double(output_index * (input_size - 1)) / double(output_size - 1));
+  } else if (flags & (XNN_FLAG_ALIGN_CORNERS | XNN_FLAG_TENSORFLOW_LEGACY_MODE)) {
+    input_index = std::floor(double(output_index * input_size) / double(output_size));
+  } else {
+    input_index = std::floor(double((2 * output_index + 1) * input_size) / double(2 * output_size));
+  }
+  return std::min(size_t(input_index), input_size - 1);
+}
+
+template<class T>
+std::vector<T> ResizeNearestReference(
+  const std::vector<T>& input, size_t output_height, size_t output_width, uint32_t flags)
+{
+  std::vector<T> output(kBatchSize * output_height * output_width * kChannels);
+  for (size_t i = 0; i < kBatchSize; i++) {
+    for (size_t y = 0; y < output_height; y++) {
+      const size_t input_y = NearestInputIndex(y, kInputHeight, output_height, flags);
+      for (size_t x = 0; x < output_width; x++) {
+        const size_t input_x = NearestInputIndex(x, kInputWidth, output_width, flags);
+        for (size_t c = 0; c < kChannels; c++) {
+          output[((i * output_height + y) * output_width + x) * kChannels + c] =
+            input[((i * kInputHeight + input_y) * kInputWidth + input_x) * kChannels + c];
+        }
+      }
+    }
+  }
+  return output;
+}
+
+// Subgraph with a single Resize Nearest Neighbor node between external input and output Values.
+SubgraphPtr CreateResizeSubgraph(
+  xnn_datatype datatype, size_t output_height, size_t output_width, uint32_t flags)
+{
+  xnn_subgraph_t subgraph = nullptr;
+  EXPECT_EQ(xnn_status_success, xnn_create_subgraph(2 /* external value IDs */, 0 /* flags */, &subgraph));
+  SubgraphPtr subgraph_ptr(subgraph, xnn_delete_subgraph);
+
+  const std::array<size_t, 4> input_dims = {{kBatchSize, kInputHeight, kInputWidth, kChannels}};
+  const std::array<size_t, 4> output_dims = {{kBatchSize, output_height, output_width, kChannels}};
+  uint32_t input_id = XNN_INVALID_VALUE_ID;
+  uint32_t output_id = XNN_INVALID_VALUE_ID;
+  if (datatype == xnn_datatype_fp32) {
+    EXPECT_EQ(xnn_status_success, xnn_define_tensor_value(
+      subgraph, datatype, input_dims.size(), input_dims.data(), nullptr,
+      kInputId, XNN_VALUE_FLAG_EXTERNAL_INPUT, &input_id));
+    EXPECT_EQ(xnn_status_success, xnn_define_tensor_value(
+      subgraph, datatype, output_dims.size(), output_dims.data(), nullptr,
+      kOutputId, XNN_VALUE_FLAG_EXTERNAL_OUTPUT, &output_id));
+  } else {
+    EXPECT_EQ(xnn_status_success, xnn_define_quantized_tensor_value(
+      subgraph, datatype, 1 /* zero point */, 0.5f /* scale */, input_dims.size(), input_dims.data(), nullptr,
+      kInputId, XNN_VALUE_FLAG_EXTERNAL_INPUT, &input_id));
+    EXPECT_EQ(xnn_status_success, xnn_define_quantized_tensor_value(
+      subgraph, datatype, 1 /* zero point */, 0.5f /* scale */, output_dims.size(), output_dims.data(), nullptr,
+      kOutputId, XNN_VALUE_FLAG_EXTERNAL_OUTPUT, &output_id));
+  }
+  EXPECT_EQ(xnn_status_success, xnn_define_static_resize_nearest_2d(
+    subgraph, output_height, output_width, input_id, output_id, flags));
+  return subgraph_ptr;
+}
+
+template<class T>
+std::vector<T> RunSubgraph(xnn_subgraph_t subgraph, const std::vector<T>& input, size_t output_size, uint32_t flags) {
+  xnn_runtime_t runtime = nullptr;
+  EXPECT_EQ(xnn_status_success, xnn_create_runtime_v2(subgraph, nullptr /* thread pool */, flags, &runtime));
+  RuntimePtr runtime_ptr(runtime, xnn_delete_runtime);
+  if (runtime == nullptr) {
+    return {};
+  }
+
+  std::vector<T> output(output_size);
+  const std::array<xnn_external_value, 2> external = {{
+    {kInputId, const_cast<T*>(input.data())}, {kOutputId, output.data()}}};
+  EXPECT_EQ(xnn_status_success, xnn_setup_runtime(runtime, external.size(), external.data()));
+  EXPECT_EQ(xnn_status_success, xnn_invoke_runtime(runtime));
+  return output;
+}
+
+std::vector<float> RandomInput(size_t size) {
+  std::random_device random_device;
+  auto rng = std::mt19937(random_device());
+  auto f32rng = std::bind(std::uniform_real_distribution<float>(-1.0f, 1.0f), std::ref(rng));
+
+  std::vector<float> input(size + XNN_EXTRA_BYTES / sizeof(float));
+  std::generate(input.begin(), input.end(), std::ref(f32rng));
+  return input;
+}
+
+void TestRuntimeF32(size_t output_height, size_t output_width, uint32_t flags) {
+  ASSERT_EQ(xnn_status_success, xnn_initialize(nullptr /* allocator */));
+
+  SubgraphPtr subgraph = CreateResizeSubgraph(xnn_datatype_fp32, output_height, output_width, flags);
+  const std::vector<float> input = RandomInput(kBatchSize * kInputHeight * kInputWidth * kChannels);
+  const std::vector<float> output_ref = ResizeNearestReference(input, output_height, output_width, flags);
+  const std::vector<float> output = RunSubgraph(subgraph.get(), input, output_ref.size(), 0 /* flags */);
+  ASSERT_EQ(output_ref, output);
+}
+
+// Conv 3x3s2 -> sparse Conv 1x1 -> Resize Nearest Neighbor -> Depth To Space network, which the NCHW rewrite runs in
+// NCHW layout from the output of the first Convolution to the input of Depth To Space.
+class SparseNetwork {
+ public:
+  static constexpr size_t kHeight = 14;
+  static constexpr size_t kWidth = 10;
+  static constexpr size_t kHiddenChannels = 8;
+  static constexpr size_t kResizedHeight = 11;
+  static constexpr size_t kResizedWidth = 15;
+  static constexpr size_t kBlockSize = 2;
+
+  SparseNetwork() {
+    std::random_device random_device;
+    auto rng = std::mt19937(random_device());
+    auto f32rng = std::bind(std::uniform_real_distribution<float>(-1.0f, 1.0f), std::ref(rng));
+
+    conv1_filter_.resize(kHiddenChannels * 3 * 3 * 3);
+    conv1_bias_.resize(kHiddenChannels);
+    conv2_filter_.resize(kHiddenChannels * kHiddenChannels);
+    conv2_bias_.resize(kHiddenChannels);
+    std::generate(conv1_filter_.begin(), conv1_filter_.end(), std::ref(f32rng));
+    std::generate(conv1_bias_.begin(), conv1_bias_.end(), std::ref(f32rng));
+    std::generate(conv2_bias_.begin(), conv2_bias_.end(), std::ref(f32rng));
+    // 1x1 Convolution filter with 7/8 zeroes, sparse enough for the NCHW rewrite.
+    for (size_t i = 0; i < conv2_filter_.size(); i += 8) {
+      conv2_filter_[i] = f32rng();
+    }
+    std::shuffle(conv2_filter_.begin(), conv2_filter_.end(), rng);
+  }
+
+  size_t input_size() const {
+    return kHeight * kWidth * 3;
+  }
+
+  size_t output_size() const {
+    return kResizedHeight * kResizedWidth * kHiddenChannels;
+  }
+
+  SubgraphPtr CreateSubgraph() {
+    xnn_subgraph_t subgraph = nullptr;
+    EXPECT_EQ(xnn_status_success, xnn_create_subgraph(2 /* external value IDs */, 0 /* flags */, &subgraph));
+    SubgraphPtr subgraph_ptr(subgraph, xnn_delete_subgraph);
+
+    const std::array<size_t, 4> input_dims = {{1, kHeight, kWidth, 3}};
+    const std::array<size_t, 4> hidden_dims = {{1, kHeight / 2, kWidth / 2, kHiddenChannels}};
+    const std::array<size_t, 4> resized_dims = {{1, kResizedHeight, kResizedWidth, kHiddenChannels}};
+    const std::array<size_t, 4> output_dims =
+      {{1, kResizedHeight * kBlockSize, kResizedWidth * kBlockSize, kHiddenChannels / (kBlockSize * kBlockSize)}};
+    const std::array<size_t, 4> conv1_filter_dims = {{kHiddenChannels, 3, 3, 3}};
+    const std::array<size_t, 4> conv2_filter_dims = {{kHiddenChannels, 1, 1, kHiddenChannels}};
+    const std::array<size_t, 1> bias_dims = {{kHiddenChannels}};
+
+    uint32_t input_id = XNN_INVALID_VALUE_ID;
+    EXPECT_EQ(xnn_status_success, xnn_define_tensor_value(
+      subgraph, xnn_datatype_fp32, input_dims.size(), input_dims.data(), nullptr,
+      kInputId, XNN_VALUE_FLAG_EXTERNAL_INPUT, &input_id));
+    uint32_t output_id = XNN_INVALID_VALUE_ID;
+    EXPECT_EQ(xnn_status_success, xnn_define_tensor_value(
+      subgraph, xnn_datatype_fp32, output_dims.size(), output_dims.data(), nullptr,
+      kOutputId, XNN_VALUE_FLAG_EXTERNAL_OUTPUT, &output_id));
+
+    uint32_t conv1_filter_id = XNN_INVALID_VALUE_ID;
+    EXPECT_EQ(xnn_status_success, xnn_define_tensor_value(
+      subgraph, xnn_datatype_fp32, conv1_filter_dims.size(), conv1_filter_dims.data(), conv1_filter_.data(),
+      XNN_INVALID_VALUE_ID, 0 /* flags */, &conv1_filter_id));
+    uint32_t conv1_bias_id = XNN_INVALID_VALUE_ID;
+    EXPECT_EQ(xnn_status_success, xnn_define_tensor_value(
+      subgraph, xnn_datatype_fp32, bias_dims.size(), bias_dims.data(), conv1_bias_.data(),
+      XNN_INVALID_VALUE_ID, 0 /* flags */, &conv1_bias_id));
+    EXPECT_EQ(xnn_status_success, xnn_define_tensor_value(
+      subgraph, xnn_datatype_fp32, hidden_dims.size(), hidden_dims.data(), nullptr,
+      XNN_INVALID_VALUE_ID, 0 /* flags */, &conv1_output_id_));
+    EXPECT_EQ(xnn_status_success, xnn_define_convolution_2d(
+      subgraph,
+      1 /* top padding */, 1 /* right padding */, 1 /* bottom padding */, 1 /* left padding */,
+      3 /* kernel height */, 3 /* kernel width */,
+      2 /* subsampling height */, 2 /* subsampling width */,
+      1 /* dilation_height */, 1 /* dilation_width */,
+      1 /* groups */, 3 /* input channels per group */, kHiddenChannels /* output_channels_per_group */,
+      -std::numeric_limits<float>::infinity(), std::numeric_limits<float>::infinity(),
+      input_id, conv1_filter_id, conv1_bias_id, conv1_output_id_, 0 /* flags */));
+
+    uint32_t conv2_filter_id = XNN_INVALID_VALUE_ID;
+    EXPECT_EQ(xnn_status_success, xnn_define_tensor_value(
+      subgraph, xnn_datatype_fp32, conv2_filter_dims.size(), conv2_filter_dims.data(), conv2_filter_.data(),
+      XNN_INVALID_VALUE_ID, 0 /* flags */, &conv2_filter_id));
+    uint32_t conv2_bias_id = XNN_INVALID_VALUE_ID;
+    EXPECT_EQ(xnn_status_success, xnn_define_tensor_value(
+      subgraph, xnn_datatype_fp32, bias_dims.size(), bias_dims.data(), conv2_bias_.data(),
+      XNN_INVALID_VALUE_ID, 0 /* flags */, &conv2_bias_id));
+    EXPECT_EQ(xnn_status_success, xnn_define_tensor_value(
+      subgraph, xnn_datatype_fp32, hidden_dims.size(), hidden_dims.data(), nullptr,
+      XNN_INVALID_VALUE_ID, 0 /* flags */, &conv2_output_id_));
+    EXPECT_EQ(xnn_status_success, xnn_define_convolution_2d(
+      subgraph,
+      0 /* top padding */, 0 /* right padding */, 0 /* bottom padding */, 0 /* left padding */,
+      1 /* kernel height */, 1 /* kernel width */,
+      1 /* subsampling height */, 1 /* subsampling width */,
+      1 /* dilation_height */, 1 /* dilation_width */,
+      1 /* groups */, kHiddenChannels /* input channels per group */, kHiddenChannels /* output_channels_per_group */,
+      -std::numeric_limits<float>::infinity(), std::numeric_limits<float>::infinity(),
+      conv1_output_id_, conv2_filter_id, conv2_bias_id, conv2_output_id_, 0 /* flags */));
+
+    EXPECT_EQ(xnn_status_success, xnn_define_tensor_value(
+      subgraph, xnn_datatype_fp32, resized_dims.size(), resized_dims.data(), nullptr,
+      XNN_INVALID_VALUE_ID, 0 /* flags */, &resized_id_));
+    EXPECT_EQ(xnn_status_success, xnn_define_static_resize_nearest_2d(
+      subgraph, kResizedHeight, kResizedWidth, conv2_output_id_, resized_id_, 0 /* flags */));
+
+    EXPECT_EQ(xnn_status_success, xnn_define_depth_to_space(
+      subgraph, resized_id_, output_id, kBlockSize, 0 /* flags */));
+
+    return subgraph_ptr;
+  }
+
+  uint32_t conv1_output_id() const {
+    return conv1_output_id_;
+  }
+
+  uint32_t conv2_output_id() const {
+    return conv2_output_id_;
+  }
+
+  uint32_t resized_id() const {
+    return resized_id_;
+  }
+
+ private:
+  std::vector<float> conv1_filter_;
+  std::vector<float> conv1_bias_;
+  std::vector<float> conv2_filter_;
+  std::vector<float> conv2_bias_;
+  uint32_t conv1_output_id_ = XNN_INVALID_VALUE_ID;
+  uint32_t conv2_output_id_ = XNN_INVALID_VALUE_ID;
+  uint32_t resized_id_ = XNN_INVALID_VALUE_ID;
+};
+
+}  // namespace
+
+
+TEST(STATIC_RESIZE_NEAREST_2D, define) {
+  ASSERT_EQ(xnn_status_success, xnn_initialize(nullptr /* allocator */));
+
+  SubgraphPtr subgraph = CreateResizeSubgraph(xnn_datatype_fp32, 10, 9, XNN_FLAG_ALIGN_CORNERS);
+  ASSERT_EQ(1, subgraph->num_nodes);
+  const struct xnn_node* node = &subgraph->nodes[0];
+  ASSERT_EQ(xnn_node_type_static_resize_nearest_2d, node->type);
+  ASSERT_EQ(xnn_compute_type_fp32, node->compute_type);
+  ASSERT_EQ(10, node->params.static_resize.new_height);
+  ASSERT_EQ(9, node->params.static_resize.new_width);
+  ASSERT_EQ(1, node->num_inputs);
+  ASSERT_EQ(kInputId, node->inputs[0]);
+  ASSERT_EQ(1, node->num_outputs);
+  ASSERT_EQ(kOutputId, node->outputs[0]);
+  ASSERT_EQ(XNN_FLAG_ALIGN_CORNERS, node->flags);
+}
+
+TEST(STATIC_RESIZE_NEAREST_2D, define_qs8) {
+  ASSERT_EQ(xnn_status_success, xnn_initialize(nullptr /* allocator */));
+
+  SubgraphPtr subgraph = CreateResizeSubgraph(xnn_datatype_qint8, 10, 14, 0 /* flags */);
+  ASSERT_EQ(1, subgraph->num_nodes);
+  ASSERT_EQ(xnn_compute_type_qs8, subgraph->nodes[0].compute_type);
+}
+
+TEST(STATIC_RESIZE_NEAREST_2D, define_rejects_mismatching_datatypes) {
+  ASSERT_EQ(xnn_status_success, xnn_initialize(nullptr /* allocator */));
+
+  xnn_subgraph_t subgraph = nullptr;
+  ASSERT_EQ(xnn_status_success, xnn_create_subgraph(0 /* external value IDs */, 0 /* flags */, &subgraph));
+  SubgraphPtr subgraph_ptr(subgraph, xnn_delete_subgraph);
+
+  const std::array<size_t, 4> input_dims = {{1, kInputHeight, kInputWidth, kChannels}};
+  const std::array<size_t, 4> output_dims = {{1, 2 * kInputHeight, 2 * kInputWidth, kChannels}};
+  uint32_t fp32_input_id = XNN_INVALID_VALUE_ID;
+  ASSERT_EQ(xnn_status_success, xnn_define_tensor_value(
+    subgraph, xnn_datatype_fp32, input_dims.size(), input_dims.data(), nullptr,
+    XNN_INVALID_VALUE_ID, 0 /* flags */, &fp32_input_id));
+  uint32_t qs8_input_id = XNN_INVALID_VALUE_ID;
+  ASSERT_EQ(xnn_status_success, xnn_define_quantized_tensor_value(
+    subgraph, xnn_datatype_qint8, 0 /* zero point */, 1.0f /* scale */, input_dims.size(), input_dims.data(), nullptr,
+    XNN_INVALID_VALUE_ID, 0 /* flags */, &qs8_input_id));
+  uint32_t qs8_output_id = XNN_INVALID_VALUE_ID;
+  ASSERT_EQ(xnn_status_success, xnn_define_quantized_tensor_value(
+    subgraph, xnn_datatype_qint8, 0 /* zero point */, 1.0f /* scale */, output_dims.size(), output_dims.data(), nullptr,
+    XNN_INVALID_VALUE_ID, 0 /* flags */, &qs8_output_id));
+  uint32_t qu8_output_id = XNN_INVALID_VALUE_ID;
+  ASSERT_EQ(xnn_status_success, xnn_define_quantized_tensor_value(
+    subgraph, xnn_datatype_quint8, 0 /* zero point */, 1.0f /* scale */, output_dims.size(), output_dims.data(), nullptr,
+    XNN_INVALID_VALUE_ID, 0 /* flags */, &qu8_output_id));
+
+  ASSERT_EQ(xnn_status_invalid_parameter, xnn_define_static_resize_nearest_2d(
+    subgraph, output_dims[1], output_dims[2], fp32_input_id, qs8_output_id, 0 /* flags */));
+  ASSERT_EQ(xnn_status_invalid_parameter, xnn_define_static_resize_nearest_2d(
+    subgraph, output_dims[1], output_dims[2], qs8_input_id, qu8_output_id, 0 /* flags */));
+  ASSERT_EQ(0, subgraph->num_nodes);
+
+  ASSERT_EQ(xnn_status_success, xnn_define_static_resize_nearest_2d(
+    subgraph, output_dims[1], output_dims[2], qs8_input_id, qs8_output_id, 0 /* flags */));
+}
+
+TEST(STATIC_RESIZE_NEAREST_2D, define_rejects_mismatching_quantization) {
+  ASSERT_EQ(xnn_status_success, xnn_initialize(nullptr /* allocator */));
+
+  xnn_subgraph_t subgraph = nullptr;
+  ASSERT_EQ(xnn_status_success, xnn_create_subgraph(0 /* external value IDs */, 0 /* flags */, &subgraph));
+  SubgraphPtr subgraph_ptr(subgraph, xnn_delete_subgraph);
+
+  const std::array<size_t, 4> input_dims = {{1, kInputHeight, kInputWidth, kChannels}};
+  const std::array<size_t, 4> output_dims = {{1, 2 * kInputHeight, 2 * kInputWidth, kChannels}};
+  uint32_t input_id = XNN_INVALID_VALUE_ID;
+  ASSERT_EQ(xnn_status_success, xnn_define_quantized_tensor_value(
+    subgraph, xnn_datatype_qint8, 0 /* zero point */, 1.0f /* scale */, input_dims.size(), input_dims.data(), nullptr,
+    XNN_INVALID_VALUE_ID, 0 /* flags */, &input_id));
+  uint32_t output_id = XNN_INVALID_VALUE_ID;
+  ASSERT_EQ(xnn_status_success, xnn_define_quantized_tensor_value(
+    subgraph, xnn_datatype_qint8, 1 /* zero point */, 1.0f /* scale */, output_dims.size(), output_dims.data(), nullptr,
+    XNN_INVALID_VALUE_ID, 0 /* flags */, &output_id));
+
+  ASSERT_EQ(xnn_status_invalid_parameter, xnn_define_static_resize_nearest_2d(
+    subgraph, output_dims[1], output_dims[2], input_id, output_id, 0 /* flags */));
+}
+
+TEST(STATIC_RESIZE_NEAREST_2D, define_rejects_invalid_parameters) {
+  ASSERT_EQ(xnn_status_success, xnn_initialize(nullptr /* allocator */));
+
+  xnn_subgraph_t subgraph = nullptr;
+  ASSERT_EQ(xnn_status_success, xnn_create_subgraph(0 /* external value IDs */, 0 /* flags */, &subgraph));
+  SubgraphPtr subgraph_ptr(subgraph, xnn_delete_subgraph);
+
+  const std::array<size_t, 4> dims = {{1, kInputHeight, kInputWidth, kChannels}};
+  uint32_t input_id = XNN_INVALID_VALUE_ID;
+  ASSERT_EQ(xnn_status_success, xnn_define_tensor_value(
+    subgraph, xnn_datatype_fp32, dims.size(), dims.data(), nullptr, XNN_INVALID_VALUE_ID, 0 /* flags */, &input_id));
+  uint32_t output_id = XNN_INVALID_VALUE_ID;
+  ASSERT_EQ(xnn_status_success, xnn_define_tensor_value(
+    subgraph, xnn_datatype_fp32, dims.size(), dims.data(), nullptr, XNN_INVALID_VALUE_ID, 0 /* flags */, &output_id));
+
+  ASSERT_EQ(xnn_status_invalid_parameter, xnn_define_static_resize_nearest_2d(
+    subgraph, 0, kInputWidth, input_id, output_id, 0 /* flags */));
+  ASSERT_EQ(xnn_status_invalid_parameter, xnn_define_static_resize_nearest_2d(
+    subgraph, kInputHeight, kInputWidth, input_id, output_id,
+    XNN_FLAG_ALIGN_CORNERS | XNN_FLAG_TENSORFLOW_LEGACY_MODE));
+  ASSERT_EQ(xnn_status_invalid_parameter, xnn_define_static_resize_nearest_2d(
+    subgraph, kInputHeight, kInputWidth, input_id, XNN_INVALID_VALUE_ID, 0 /* flags */));
+  ASSERT_EQ(0, subgraph->num_nodes);
+}
+
+TEST(STATIC_RESIZE_NEAREST_2D, upscale_integer_factor) {
+  TestRuntimeF32(2 * kInputHeight, 3 * kInputWidth, 0 /* flags */);
+}
+
+TEST(STATIC_RESIZE_NEAREST_2D, upscale) {
+  TestRuntimeF32(kInputHeight + 4, kInputWidth + 3, 0 /* flags */);
+}
+
+TEST(STATIC_RESIZE_NEAREST_2D, downscale) {
+  TestRuntimeF32(kInputHeight - 2, kInputWidth - 3, 0 /* flags */);
+}
+
+TEST(STATIC_RESIZE_NEAREST_2D, upscale_align_corners) {
+  TestRuntimeF32(kInputHeight + 4, kInputWidth + 3, XNN_FLAG_ALIGN_CORNERS);
+}
+
+TEST(STATIC_RESIZE_NEAREST_2D, upscale_tf_legacy_mode) {
+  TestRuntimeF32(kInputHeight + 4, kInputWidth + 3, XNN_FLAG_TENSORFLOW_LEGACY_MODE);
+}
+
+TEST(STATIC_RESIZE_NEAREST_2D, runtime_qs8) {
+  ASSERT_EQ(xnn_status_success, xnn_initialize(nullptr /* allocator */));
+
+  const size_t output_height = kInputHeight + 4;
+  const size_t output_width = kInputWidth + 3;
+  SubgraphPtr subgraph = CreateResizeSubgraph(xnn_datatype_qint8, output_height, output_width, 0 /* flags */);
+
+  std::random_device random_device;
+  auto rng = std::mt19937(random_device());
+  auto i8rng = std::bind(
+    std::uniform_int_distribution<int32_t>(std::numeric_limits<int8_t>::min(), std::numeric_limits<int8_t>::max()),
+    std::ref(rng));
+  std::vector<int8_t> input(kBatchSize * kInputHeight * kInputWidth * kChannels + XNN_EXTRA_BYTES);
+  std::generate(input.begin(), input.end(), std::ref(i8rng));
+
+  const std::vector<int8_t> output_ref = ResizeNearestReference(input, output_height, output_width, 0 /* flags */);
+  const std::vector<int8_t> output = RunSubgraph(subgraph.get(), input, output_ref.size(), 0 /* flags */);
+  ASSERT_EQ(output_ref, output);
+}
+
+TEST(STATIC_RESIZE_NEAREST_2D, nchw_rewrite) {
+  ASSERT_EQ(xnn_status_success, xnn_initialize(nullptr /* allocator */));
+
+  SparseNetwork network;
+  const std::vector<float> input = RandomInput(network.input_size());
+  SubgraphPtr nhwc_subgraph = network.CreateSubgraph();
+  const std::vector<float> output_ref = RunSubgraph(nhwc_subgraph.get(), input, network.output_size(), 0 /* flags */);
+
+  SubgraphPtr nchw_subgraph = network.CreateSubgraph();
+  ASSERT_EQ(xnn_status_success, xnn_subgraph_optimize(nchw_subgraph.get(), 0 /* flags */));
+  xnn_subgraph_rewrite_for_nchw(nchw_subgraph.get());
+  ASSERT_EQ(xnn_layout_type_nhwc, nchw_subgraph->values[kInputId].layout);
+  ASSERT_EQ(xnn_layout_type_nchw, nchw_subgraph->values[network.conv1_output_id()].layout);
+  ASSERT_EQ(xnn_layout_type_nchw, nchw_subgraph->values[network.conv2_output_id()].layout);
+  ASSERT_EQ(xnn_layout_type_nchw, nchw_subgraph->values[network.resized_id()].layout);
+  ASSERT_EQ(xnn_layout_type_nhwc, nchw_subgraph->values[kOutputId].layout);
+
+  const std::vector<float> output = RunSubgraph(nchw_subgraph.get(), input, network.output_size(), 0 /* flags */);
+  ASSERT_EQ(output_ref.size(), output.size());
+  for (size_t i = 0; i < output_ref.size(); i++) {
+    ASSERT_NEAR(output_ref[i], output[i], 1.0e-5f * std::max(1.0f, std::abs(output_ref[i]))) << "at " << i;
+  }
+}
+
+TEST(STATIC_RESIZE_NEAREST_2D, fp16_rewrite) {
+  ASSERT_EQ(xnn_status_success, xnn_initialize(nullptr /* allocator */));
+
+  const size_t output_height = kInputHeight + 4;
+  const size_t output_width = kInputWidth + 3;
+  SubgraphPtr subgraph = CreateResizeSubgraph(xnn_datatype_fp32, output_height, output_width, 0 /* flags */);
+
+  xnn_runtime_t runtime = nullptr;
+  const xnn_status status =
+    xnn_create_runtime_v2(subgraph.get(), nullptr /* thread pool */, XNN_FLAG_FORCE_FP16_INFERENCE, &runtime);
+  if (status == xnn_status_unsupported_hardware) {
+    GTEST_SKIP();
+  }
+  ASSERT_EQ(xnn_status_success, status);
+  RuntimePtr runtime_ptr(runtime, xnn_delete_runtime);
+  const xnn_node* resize_node = std::find_if(subgraph->nodes, subgraph->nodes + subgraph->num_nodes,
+    [](const xnn_node& node) { return node.type == xnn_node_type_static_resize_nearest_2d; });
+  ASSERT_NE(subgraph->nodes + subgraph->num_nodes, resize_node);
+  ASSERT_EQ(xnn_compute_type_fp16, resize_node->compute_type);
+
+  std::vector<float> input = RandomInput(kBatchSize * kInputHeight * kInputWidth * kChannels);
+  std::vector<float> output(kBatchSize * output_height * output_width * kChannels);
+  const std::array<xnn_external_value, 2> external = {{{kInputId, input.data()}, {kOutputId, output.data()}}};
+  ASSERT_EQ(xnn_status_success, xnn_setup_runtime(runtime, external.size(), external.data()));
+  ASSERT_EQ(xnn_status_success, xnn_invoke_runtime(runtime));
+
+  // Resizing only moves elements around, so the only error comes from the conversion of the input to FP16.
+  for (float& x : input) {
+    x = fp16_ieee_to_fp32_value(fp16_ieee_from_fp32_value(x));
+  }
+  ASSERT_EQ(ResizeNearestReference(input, output_height, output_width, 0 /* flags */), output);
+}
@@ -0,0 +1,1079 @@
+// Copyright 2022 Google LLC
+//
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree.
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <limits>
+#include <map>
+#include <memory>
+#include <random>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <xnnpack.h>
+#include <xnnpack/subgraph.h>
+
+
+namespace {
+
+using SubgraphPtr = std::unique_ptr<xnn_subgraph, decltype(&xnn_delete_subgraph)>;
+using RuntimePtr = std::unique_ptr<xnn_runtime, decltype(&xnn_delete_runtime)>;
+
+// FP32 tensor in NHWC layout, used for reference computations.
+struct Tensor {
+  Tensor(size_t batch, size_t height, size_t width, size_t channels)
+    : batch(batch), height(height), width(width), channels(channels),
+      data(batch * height * width * channels, std::nanf(""))
+  {
+  }
+
+  float& at(size_t n, size_t y, size_t x, size_t c) {
+    return data[((n * height + y) * width + x) * channels + c];
+  }
+
+  float at(size_t n, size_t y, size_t x, size_t c) const {
+    return data[((n * height + y) * width + x) * channels + c];
+  }
+
+  size_t batch;
+  size_t height;
+  size_t width;
+  size_t channels;
+  std::vector<float> data;
+};
+
+// Parameters of a Convolution 2D Node, and its static weights for reference computations.
+struct Convolution {
+  size_t padding_top = 0;
+  size_t padding_right = 0;
+  size_t padding_bottom = 0;
+  size_t padding_left = 0;
+  size_t kernel_height = 1;
+  size_t kernel_width = 1;
+  size_t subsampling = 1;
+  size_t groups = 1;
+  size_t group_input_channels = 1;
+  size_t group_output_channels = 1;
+  float output_min = -std::numeric_limits<float>::infinity();
+  float output_max = std::numeric_limits<float>::infinity();
+  // Depthwise Convolution 2D Node with groups input and output channels, and [1, KH, KW, groups] filter.
+  bool depthwise = false;
+  const std::vector<float>* filter = nullptr;
+  const std::vector<float>* bias = nullptr;
+};
+
+// Builds FP32 Subgraphs with random static weights, which live as long as the builder.
+class SubgraphBuilder {
+ public:
+  explicit SubgraphBuilder(uint32_t external_value_ids)
+    : subgraph_(nullptr, xnn_delete_subgraph), rng_(std::random_device()())
+  {
+    xnn_subgraph_t subgraph = nullptr;
+    EXPECT_EQ(xnn_status_success, xnn_create_subgraph(external_value_ids, 0 /* flags */, &subgraph));
+    subgraph_.reset(subgraph);
+  }
+
+  xnn_subgraph_t subgraph() const {
+    return subgraph_.get();
+  }
+
+  uint32_t ExternalInput(uint32_t external_id, const std::vector<size_t>& dims) {
+    return Value(dims, nullptr, external_id, XNN_VALUE_FLAG_EXTERNAL_INPUT);
+  }
+
+  uint32_t ExternalOutput(uint32_t external_id, const std::vector<size_t>& dims) {
+    return Value(dims, nullptr, external_id, XNN_VALUE_FLAG_EXTERNAL_OUTPUT);
+  }
+
+  uint32_t Internal(const std::vector<size_t>& dims) {
+    return Value(dims, nullptr, XNN_INVALID_VALUE_ID, 0 /* flags */);
+  }
+
+  // Defines a Convolution 2D Node with random weights. The input and output Values are either 4D tensors, or 2D
+  // tensors for a Fully Connected Node when the Convolution is 1x1 and unpadded.
+  Convolution DefineConvolution2D(uint32_t input_id, uint32_t output_id, Convolution convolution, uint32_t flags = 0) {
+    const size_t output_channels = convolution.groups * convolution.group_output_channels;
+    const std::vector<size_t> filter_dims = {{
+      output_channels, convolution.kernel_height, convolution.kernel_width, convolution.group_input_channels}};
+    const uint32_t filter_id = Static(filter_dims, &convolution.filter);
+    const uint32_t bias_id = Static({{output_channels}}, &convolution.bias);
+    EXPECT_EQ(xnn_status_success, xnn_define_convolution_2d(
+      subgraph(),
+      convolution.padding_top, convolution.padding_right, convolution.padding_bottom, convolution.padding_left,
+      convolution.kernel_height, convolution.kernel_width,
+      convolution.subsampling, convolution.subsampling,
+      1 /* dilation height */, 1 /* dilation width */,
+      convolution.groups, convolution.group_input_channels, convolution.group_output_channels,
+      convolution.output_min, convolution.output_max,
+      input_id, filter_id, bias_id, output_id, flags));
+    return convolution;
+  }
+
+  Convolution DefineDepthwiseConvolution2D(
+    uint32_t input_id, uint32_t output_id, Convolution convolution, uint32_t flags = 0)
+  {
+    convolution.depthwise = true;
+    convolution.group_input_channels = convolution.group_output_channels = 1;
+    const std::vector<size_t> filter_dims = {{
+      1, convolution.kernel_height, convolution.kernel_width, convolution.groups}};
+    const uint32_t filter_id = Static(filter_dims, &convolution.filter);
+    const uint32_t bias_id = Static({{convolution.groups}}, &convolution.bias);
+    EXPECT_EQ(xnn_status_success, xnn_define_depthwise_convolution_2d(
+      subgraph(),
+      convolution.padding_top, convolution.padding_right, convolution.padding_bottom, convolution.padding_left,
+      convolution.kernel_height, convolution.kernel_width,
+      convolution.subsampling, convolution.subsampling,
+      1 /* dilation height */, 1 /* dilation width */,
+      1 /* depth multiplier */, convolution.groups,
+      convolution.output_min, convolution.output_max,
+      input_id, filter_id, bias_id, output_id, flags));
+    return convolution;
+  }
+
+  Convolution DefineFullyConnected(
+    uint32_t input_id, uint32_t output_id, size_t input_channels, size_t output_channels)
+  {
+    Convolution convolution;
+    convolution.group_input_channels = input_channels;
+    convolution.group_output_channels = output_channels;
+    const uint32_t filter_id = Static({{output_channels, input_channels}}, &convolution.filter);
+    const uint32_t bias_id = Static({{output_channels}}, &convolution.bias);
+    EXPECT_EQ(xnn_status_success, xnn_define_fully_connected(
+      subgraph(), convolution.output_min, convolution.output_max,
+      input_id, filter_id, bias_id, output_id, 0 /* flags */));
+    return convolution;
+  }
+
+  Tensor RandomTensor(size_t batch, size_t height, size_t width, size_t channels) {
+    Tensor tensor(batch, height, width, channels);
+    std::generate(tensor.data.begin(), tensor.data.end(), [&]() { return distribution_(rng_); });
+    return tensor;
+  }
+
+ private:
+  uint32_t Value(const std::vector<size_t>& dims, const void* data, uint32_t external_id, uint32_t flags) {
+    uint32_t id = XNN_INVALID_VALUE_ID;
+    EXPECT_EQ(xnn_status_success, xnn_define_tensor_value(
+      subgraph(), xnn_datatype_fp32, dims.size(), dims.data(), data, external_id, flags, &id));
+    return id;
+  }
+
+  uint32_t Static(const std::vector<size_t>& dims, const std::vector<float>** data_out) {
+    size_t size = 1;
+    for (size_t dim : dims) {
+      size *= dim;
+    }
+    std::vector<float>& data = static_data_[static_data_.size()];
+    data.resize(size);
+    std::generate(data.begin(), data.end(), [&]() { return distribution_(rng_); });
+    *data_out = &data;
+    return Value(dims, data.data(), XNN_INVALID_VALUE_ID, 0 /* flags */);
+  }
+
+  SubgraphPtr subgraph_;
+  std::mt19937 rng_;
+  std::uniform_real_distribution<float> distribution_{-1.0f, 1.0f};
+  // Elements of std::map are never relocated, so Values can reference the static data.
+  std::map<size_t, std::vector<float>> static_data_;
+};
+
+Tensor ReferenceConvolution(const Tensor& input, const Convolution& convolution) {
+  const size_t output_height = (convolution.padding_top + input.height + convolution.padding_bottom -
+    convolution.kernel_height) / convolution.subsampling + 1;
+  const size_t output_width = (convolution.padding_left + input.width + convolution.padding_right -
+    convolution.kernel_width) / convolution.subsampling + 1;
+  Tensor output(input.batch, output_height, output_width, convolution.groups * convolution.group_output_channels);
+  for (size_t n = 0; n < output.batch; n++) {
+    for (size_t oy = 0; oy < output.height; oy++) {
+      for (size_t ox = 0; ox < output.width; ox++) {
+        for (size_t g = 0; g < convolution.groups; g++) {
+          for (size_t oc = 0; oc < convolution.group_output_channels; oc++) {
+            const size_t output_channel = g * convolution.group_output_channels + oc;
+            float acc = (*convolution.bias)[output_channel];
+            for (size_t ky = 0; ky < convolution.kernel_height; ky++) {
+              const size_t iy = oy * convolution.subsampling + ky - convolution.padding_top;
+              if (iy >= input.height) {
+                continue;
+              }
+              for (size_t kx = 0; kx < convolution.kernel_width; kx++) {
+                const size_t ix = ox * convolution.subsampling + kx - convolution.padding_left;
+                if (ix >= input.width) {
+                  continue;
+                }
+                for (size_t ic = 0; ic < convolution.group_input_channels; ic++) {
+                  const size_t filter_index = convolution.depthwise ?
+                    (ky * convolution.kernel_width + kx) * convolution.groups + output_channel :
+                    ((output_channel * convolution.kernel_height + ky) * convolution.kernel_width + kx) *
+                      convolution.group_input_channels + ic;
+                  acc += input.at(n, iy, ix, g * convolution.group_input_channels + ic) *
+                    (*convolution.filter)[filter_index];
+                }
+              }
+            }
+            output.at(n, oy, ox, output_channel) =
+              std::min(std::max(acc, convolution.output_min), convolution.output_max);
+          }
+        }
+      }
+    }
+  }
+  return output;
+}
+
+Tensor ReferenceAdd(const Tensor& a, const Tensor& b, float output_min, float output_max) {
+  Tensor output = a;
+  for (size_t i = 0; i < output.data.size(); i++) {
+    output.data[i] = std::min(std::max(a.data[i] + b.data[i], output_min), output_max);
+  }
+  return output;
+}
+
+RuntimePtr CreateRuntime(xnn_subgraph_t subgraph, uint32_t flags = 0) {
+  xnn_runtime_t runtime = nullptr;
+  EXPECT_EQ(xnn_status_success, xnn_create_runtime_v2(subgraph, nullptr /* thread pool */, flags, &runtime));
+  return RuntimePtr(runtime, xnn_delete_runtime);
+}
+
+// Invokes the Runtime on the external inputs, and writes the external outputs into tensors of the expected shapes.
+void RunRuntime(
+  xnn_runtime_t runtime,
+  const std::map<uint32_t, const Tensor*>& inputs,
+  const std::map<uint32_t, Tensor*>& outputs)
+{
+  std::vector<std::vector<float>> padded_inputs;
+  std::vector<xnn_external_value> external;
+  for (const auto& input : inputs) {
+    padded_inputs.emplace_back(input.second->data);
+    padded_inputs.back().resize(input.second->data.size() + XNN_EXTRA_BYTES / sizeof(float));
+  }
+  size_t i = 0;
+  for (const auto& input : inputs) {
+    external.push_back(xnn_external_value{input.first, padded_inputs[i++].data()});
+  }
+  for (const auto& output : outputs) {
+    external.push_back(xnn_external_value{output.first, output.second->data.data()});
+  }
+  ASSERT_EQ(xnn_status_success, xnn_setup_runtime(runtime, external.size(), external.data()));
+  ASSERT_EQ(xnn_status_success, xnn_invoke_runtime(runtime));
+}
+
+void ExpectNear(const Tensor& expected, const Tensor& actual) {
+  ASSERT_EQ(expected.data.size(), actual.data.size());
+  for (size_t i = 0; i < expected.data.size(); i++) {
+    ASSERT_NEAR(expected.data[i], actual.data[i], 1.0e-4f * std::max(1.0f, std::abs(expected.data[i])))
+      << "at index " << i << " of " << expected.data.size();
+  }
+}
+
+size_t CountNodes(xnn_subgraph_t subgraph, xnn_node_type type) {
+  size_t count = 0;
+  for (uint32_t i = 0; i < subgraph->num_nodes; i++) {
+    count += static_cast<size_t>(subgraph->nodes[i].type == type);
+  }
+  return count;
+}
+
+// Returns the only Node of the type in the Subgraph.
+const xnn_node* FindNode(xnn_subgraph_t subgraph, xnn_node_type type) {
+  const xnn_node* found = nullptr;
+  for (uint32_t i = 0; i < subgraph->num_nodes; i++) {
+    if (subgraph->nodes[i].type == type) {
+      EXPECT_EQ(nullptr, found);
+      found = &subgraph->nodes[i];
+    }
+  }
+  EXPECT_NE(nullptr, found);
+  return found;
+}
+
+// ResNet block: Convolution 3x3 of the input, and Add of the input as the residual. The Convolution output is
+// additionally an external output, or consumed by a second Add, when the fusion must be rejected.
+enum class ResidualConsumer {
+  kAdd,
+  kAddAndExternalOutput,
+  kTwoAdds,
+};
+
+void TestResidualConvolution(ResidualConsumer consumer, bool residual_first) {
+  ASSERT_EQ(xnn_status_success, xnn_initialize(nullptr /* allocator */));
+
+  const size_t kHeight = 9;
+  const size_t kWidth = 11;
+  const size_t kChannels = 24;
+  const float kOutputMin = -1.5f;
+  const float kOutputMax = 2.0f;
+  SubgraphBuilder builder(4 /* external value IDs */);
+  const std::vector<size_t> dims = {{1, kHeight, kWidth, kChannels}};
+  const uint32_t input_id = builder.ExternalInput(0, dims);
+  const uint32_t output_id = builder.ExternalOutput(1, dims);
+  const uint32_t convolution_output_id = consumer == ResidualConsumer::kAddAndExternalOutput ?
+    builder.ExternalOutput(2, dims) : builder.Internal(dims);
+
+  Convolution convolution;
+  convolution.padding_top = convolution.padding_right = convolution.padding_bottom = convolution.padding_left = 1;
+  convolution.kernel_height = convolution.kernel_width = 3;
+  convolution.group_input_channels = convolution.group_output_channels = kChannels;
+  convolution = builder.DefineConvolution2D(input_id, convolution_output_id, convolution);
+  if (residual_first) {
+    ASSERT_EQ(xnn_status_success, xnn_define_add2(
+      builder.subgraph(), kOutputMin, kOutputMax, input_id, convolution_output_id, output_id, 0 /* flags */));
+  } else {
+    ASSERT_EQ(xnn_status_success, xnn_define_add2(
+      builder.subgraph(), kOutputMin, kOutputMax, convolution_output_id, input_id, output_id, 0 /* flags */));
+  }
+  const uint32_t second_output_id = consumer == ResidualConsumer::kTwoAdds ? builder.ExternalOutput(3, dims) : 0;
+  if (consumer == ResidualConsumer::kTwoAdds) {
+    ASSERT_EQ(xnn_status_success, xnn_define_add2(
+      builder.subgraph(), -std::numeric_limits<float>::infinity(), std::numeric_limits<float>::infinity(),
+      convolution_output_id, input_id, second_output_id, 0 /* flags */));
+  }
+
+  RuntimePtr runtime = CreateRuntime(builder.subgraph());
+  ASSERT_NE(nullptr, runtime);
+  const bool fused = consumer == ResidualConsumer::kAdd;
+  const size_t num_adds = fused ? 0 : consumer == ResidualConsumer::kTwoAdds ? 2 : 1;
+  EXPECT_EQ(num_adds, CountNodes(builder.subgraph(), xnn_node_type_add2));
+  EXPECT_EQ(fused, FindNode(builder.subgraph(), xnn_node_type_convolution_2d)->residual.fused);
+
+  const Tensor input = builder.RandomTensor(1, kHeight, kWidth, kChannels);
+  const Tensor convolution_reference = ReferenceConvolution(input, convolution);
+  Tensor output(1, kHeight, kWidth, kChannels);
+  Tensor second_output(1, kHeight, kWidth, kChannels);
+  std::map<uint32_t, Tensor*> outputs = {{1, &output}};
+  if (consumer == ResidualConsumer::kAddAndExternalOutput) {
+    outputs[2] = &second_output;
+  } else if (consumer == ResidualConsumer::kTwoAdds) {
+    outputs[3] = &second_output;
+  }
+  RunRuntime(runtime.get(), {{0, &input}}, outputs);
+  ExpectNear(ReferenceAdd(convolution_reference, input, kOutputMin, kOutputMax), output);
+  if (consumer == ResidualConsumer::kAddAndExternalOutput) {
+    ExpectNear(convolution_reference, second_output);
+  } else if (consumer == ResidualConsumer::kTwoAdds) {
+    ExpectNear(ReferenceAdd(convolution_reference, input, -std::numeric_limits<float>::infinity(),
+      std::numeric_limits<float>::infinity()), second_output);
+  }
+}
+
+// MobileNetV2 inverted bottleneck block: 1x1 expansion Convolution, 3x3 Depthwise Convolution, and 1x1 projection
+// Convolution. The fusion is rejected when the expanded tensor is small or used outside of the block, and when the
+// projection Convolution isn't a plain 1x1 Convolution.
+struct InvertedBottleneck {
+  size_t height = 56;
+  size_t width = 56;
+  size_t subsampling = 1;
+  bool expanded_is_external_output = false;
+  bool expanded_has_second_consumer = false;
+  bool clamp_output = false;
+  size_t projection_padding = 0;
+  size_t projection_groups = 1;
+  bool fused = true;
+};
+
+void TestInvertedBottleneck(const InvertedBottleneck& block) {
+  ASSERT_EQ(xnn_status_success, xnn_initialize(nullptr /* allocator */));
+
+  const size_t kChannels = 16;
+  const size_t kExpandedChannels = 48;
+  const size_t kOutputChannels = 24;
+  const size_t depthwise_height = (block.height - 1) / block.subsampling + 1;
+  const size_t depthwise_width = (block.width - 1) / block.subsampling + 1;
+  const size_t output_height = depthwise_height + 2 * block.projection_padding;
+  const size_t output_width = depthwise_width + 2 * block.projection_padding;
+  SubgraphBuilder builder(3 /* external value IDs */);
+  const uint32_t input_id = builder.ExternalInput(0, {{1, block.height, block.width, kChannels}});
+  const uint32_t output_id = builder.ExternalOutput(1, {{1, output_height, output_width, kOutputChannels}});
+  const std::vector<size_t> expanded_dims = {{1, block.height, block.width, kExpandedChannels}};
+  const uint32_t expanded_id = block.expanded_is_external_output || block.expanded_has_second_consumer ?
+    builder.ExternalOutput(2, expanded_dims) : builder.Internal(expanded_dims);
+
+  Convolution expansion;
+  expansion.group_input_channels = kChannels;
+  expansion.group_output_channels = kExpandedChannels;
+  expansion.output_min = 0.0f;
+  expansion.output_max = 6.0f;
+  const uint32_t expansion_output_id =
+    block.expanded_has_second_consumer ? builder.Internal(expanded_dims) : expanded_id;
+  expansion = builder.DefineConvolution2D(input_id, expansion_output_id, expansion);
+  if (block.expanded_has_second_consumer) {
+    // The second consumer of the expanded tensor is a Clamp Node producing the external output.
+    ASSERT_EQ(xnn_status_success, xnn_define_clamp(
+      builder.subgraph(), -std::numeric_limits<float>::infinity(), std::numeric_limits<float>::infinity(),
+      expansion_output_id, expanded_id, 0 /* flags */));
+  }
+
+  Convolution depthwise;
+  depthwise.padding_top = depthwise.padding_right = depthwise.padding_bottom = depthwise.padding_left = 1;
+  depthwise.kernel_height = depthwise.kernel_width = 3;
+  depthwise.subsampling = block.subsampling;
+  depthwise.groups = kExpandedChannels;
+  depthwise.output_min = 0.0f;
+  depthwise.output_max = 6.0f;
+  const uint32_t depthwise_output_id = builder.Internal({{1, depthwise_height, depthwise_width, kExpandedChannels}});
+  depthwise = builder.DefineDepthwiseConvolution2D(expansion_output_id, depthwise_output_id, depthwise);
+
+  Convolution projection;
+  projection.padding_top = projection.padding_right = projection.padding_bottom = projection.padding_left =
+    block.projection_padding;
+  projection.groups = block.projection_groups;
+  projection.group_input_channels = kExpandedChannels / block.projection_groups;
+  projection.group_output_channels = kOutputChannels / block.projection_groups;
+  const float kOutputMin = -2.5f;
+  const float kOutputMax = 1.5f;
+  const uint32_t projection_output_id = block.clamp_output ?
+    builder.Internal({{1, output_height, output_width, kOutputChannels}}) : output_id;
+  projection = builder.DefineConvolution2D(depthwise_output_id, projection_output_id, projection);
+  if (block.clamp_output) {
+    ASSERT_EQ(xnn_status_success, xnn_define_clamp(
+      builder.subgraph(), kOutputMin, kOutputMax, projection_output_id, output_id, 0 /* flags */));
+  }
+
+  RuntimePtr runtime = CreateRuntime(builder.subgraph());
+  ASSERT_NE(nullptr, runtime);
+  EXPECT_EQ(block.fused ? 0u : 1u, CountNodes(builder.subgraph(), xnn_node_type_depthwise_convolution_2d));
+  EXPECT_EQ(block.fused ? 1u : 2u, CountNodes(builder.subgraph(), xnn_node_type_convolution_2d));
+  EXPECT_EQ(block.expanded_has_second_consumer ? 1u : 0u, CountNodes(builder.subgraph(), xnn_node_type_clamp));
+  for (uint32_t i = 0; i < builder.subgraph()->num_nodes; i++) {
+    const xnn_node* node = &builder.subgraph()->nodes[i];
+    if (node->type == xnn_node_type_convolution_2d) {
+      EXPECT_EQ(block.fused, node->bottleneck.fused);
+    }
+  }
+
+  const Tensor input = builder.RandomTensor(1, block.height, block.width, kChannels);
+  const Tensor expanded_reference = ReferenceConvolution(input, expansion);
+  Tensor output_reference = ReferenceConvolution(ReferenceConvolution(expanded_reference, depthwise), projection);
+  if (block.clamp_output) {
+    for (float& value : output_reference.data) {
+      value = std::min(std::max(value, kOutputMin), kOutputMax);
+    }
+  }
+  Tensor output(1, output_height, output_width, kOutputChannels);
+  Tensor expanded(1, block.height, block.width, kExpandedChannels);
+  std::map<uint32_t, Tensor*> outputs = {{1, &output}};
+  if (block.expanded_is_external_output || block.expanded_has_second_consumer) {
+    outputs[2] = &expanded;
+  }
+  RunRuntime(runtime.get(), {{0, &input}}, outputs);
+  ExpectNear(output_reference, output);
+  if (block.expanded_is_external_output || block.expanded_has_second_consumer) {
+    ExpectNear(expanded_reference, expanded);
+  }
+}
+
+Tensor ReferenceClamp(const Tensor& input, float output_min, float output_max) {
+  Tensor output = input;
+  for (float& value : output.data) {
+    value = std::min(std::max(value, output_min), output_max);
+  }
+  return output;
+}
+
+struct Slice {
+  std::array<size_t, 4> offsets;
+  std::array<size_t, 4> sizes;
+  std::array<size_t, 4> strides;
+};
+
+Tensor ReferenceSlice(const Tensor& input, const Slice& slice) {
+  Tensor output(slice.sizes[0], slice.sizes[1], slice.sizes[2], slice.sizes[3]);
+  for (size_t n = 0; n < output.batch; n++) {
+    for (size_t y = 0; y < output.height; y++) {
+      for (size_t x = 0; x < output.width; x++) {
+        for (size_t c = 0; c < output.channels; c++) {
+          output.at(n, y, x, c) = input.at(
+            slice.offsets[0] + n * slice.strides[0], slice.offsets[1] + y * slice.strides[1],
+            slice.offsets[2] + x * slice.strides[2], slice.offsets[3] + c * slice.strides[3]);
+        }
+      }
+    }
+  }
+  return output;
+}
+
+enum class SliceSource {
+  kExternalInput,
+  kInternalValue,
+  // Slice of an internal Value produced by another Slice Node, which takes batches 1-3 of the internal Value.
+  kSlice,
+};
+
+// Slices the external input, or an internal Value computed from it by a Clamp Node, and clamps the slice into the
+// external output. When the slice is itself the external output, it is written to the user-provided memory.
+void TestSlice(const Slice& slice, SliceSource source, bool output_is_external, bool alias) {
+  ASSERT_EQ(xnn_status_success, xnn_initialize(nullptr /* allocator */));
+
+  const std::array<size_t, 4> kInputDims = {{4, 6, 6, 8}};
+  const Slice kFirstSlice = {{{1, 0, 0, 0}}, {{3, 6, 6, 8}}, {{1, 1, 1, 1}}};
+  const std::vector<size_t> slice_dims(slice.sizes.begin(), slice.sizes.end());
+  SubgraphBuilder builder(2 /* external value IDs */);
+  const uint32_t input_id = builder.ExternalInput(0, {kInputDims.begin(), kInputDims.end()});
+  const uint32_t output_id = builder.ExternalOutput(1, slice_dims);
+  uint32_t source_id = input_id;
+  std::array<size_t, 4> source_dims = kInputDims;
+  if (source != SliceSource::kExternalInput) {
+    source_id = builder.Internal({kInputDims.begin(), kInputDims.end()});
+    ASSERT_EQ(xnn_status_success, xnn_define_clamp(
+      builder.subgraph(), -0.5f /* output min */, 0.5f /* output max */, input_id, source_id, 0 /* flags */));
+  }
+  // Slices of slices alias the Value which owns the memory.
+  const uint32_t owner_id = source_id;
+  if (source == SliceSource::kSlice) {
+    const uint32_t first_slice_id = builder.Internal({kFirstSlice.sizes.begin(), kFirstSlice.sizes.end()});
+    ASSERT_EQ(xnn_status_success, xnn_define_static_slice(
+      builder.subgraph(), 4, kFirstSlice.offsets.data(), kFirstSlice.sizes.data(), nullptr /* strides */,
+      source_id, first_slice_id, 0 /* flags */));
+    source_id = first_slice_id;
+    source_dims = kFirstSlice.sizes;
+  }
+  const uint32_t slice_id = output_is_external ? output_id : builder.Internal(slice_dims);
+  ASSERT_EQ(xnn_status_success, xnn_define_static_slice(
+    builder.subgraph(), 4, slice.offsets.data(), slice.sizes.data(), slice.strides.data(),
+    source_id, slice_id, 0 /* flags */));
+  if (!output_is_external) {
+    ASSERT_EQ(xnn_status_success, xnn_define_clamp(
+      builder.subgraph(), -0.25f /* output min */, 0.75f /* output max */, slice_id, output_id, 0 /* flags */));
+  }
+
+  RuntimePtr runtime = CreateRuntime(builder.subgraph());
+  ASSERT_NE(nullptr, runtime);
+  const xnn_blob* slice_blob = &runtime->blobs[slice_id];
+  EXPECT_EQ(alias, slice_blob->alias);
+
+  const Tensor input = builder.RandomTensor(kInputDims[0], kInputDims[1], kInputDims[2], kInputDims[3]);
+  Tensor output(slice.sizes[0], slice.sizes[1], slice.sizes[2], slice.sizes[3]);
+  RunRuntime(runtime.get(), {{0, &input}}, {{1, &output}});
+
+  if (alias) {
+    size_t offset = 0;
+    for (size_t i = 0; i < 4; i++) {
+      offset = offset * source_dims[i] + slice.offsets[i];
+    }
+    if (source == SliceSource::kSlice) {
+      offset += kFirstSlice.offsets[0] * kInputDims[1] * kInputDims[2] * kInputDims[3];
+    }
+    EXPECT_EQ(owner_id, slice_blob->alias_id);
+    EXPECT_EQ(static_cast<const void*>(static_cast<const float*>(runtime->blobs[owner_id].data) + offset),
+      slice_blob->data);
+  }
+
+  Tensor reference = source == SliceSource::kExternalInput ? input : ReferenceClamp(input, -0.5f, 0.5f);
+  if (source == SliceSource::kSlice) {
+    reference = ReferenceSlice(reference, kFirstSlice);
+  }
+  reference = ReferenceSlice(reference, slice);
+  if (!output_is_external) {
+    reference = ReferenceClamp(reference, -0.25f, 0.75f);
+  }
+  ExpectNear(reference, output);
+}
+
+// Pads the spatial dimensions with the padding value, or with the reflect, symmetric, or edge padding mode.
+Tensor ReferencePad(
+  const Tensor& input, size_t pre_height, size_t pre_width, size_t post_height, size_t post_width,
+  uint32_t padding_mode, float padding_value)
+{
+  const std::function<ptrdiff_t(ptrdiff_t, ptrdiff_t)> source_index = [&](ptrdiff_t i, ptrdiff_t size) -> ptrdiff_t {
+    switch (padding_mode) {
+      case XNN_FLAG_REFLECT_PADDING:
+        return i < 0 ? -i : i >= size ? 2 * (size - 1) - i : i;
+      case XNN_FLAG_SYMMETRIC_PADDING:
+        return i < 0 ? -i - 1 : i >= size ? 2 * size - 1 - i : i;
+      case XNN_FLAG_EDGE_PADDING:
+        return std::min(std::max<ptrdiff_t>(i, 0), size - 1);
+      default:
+        return i >= 0 && i < size ? i : -1;
+    }
+  };
+  Tensor output(input.batch, pre_height + input.height + post_height, pre_width + input.width + post_width,
+    input.channels);
+  for (size_t n = 0; n < output.batch; n++) {
+    for (size_t y = 0; y < output.height; y++) {
+      const ptrdiff_t iy = source_index(ptrdiff_t(y) - ptrdiff_t(pre_height), ptrdiff_t(input.height));
+      for (size_t x = 0; x < output.width; x++) {
+        const ptrdiff_t ix = source_index(ptrdiff_t(x) - ptrdiff_t(pre_width), ptrdiff_t(input.width));
+        for (size_t c = 0; c < output.channels; c++) {
+          output.at(n, y, x, c) = iy < 0 || ix < 0 ? padding_value : input.at(n, size_t(iy), size_t(ix), c);
+        }
+      }
+    }
+  }
+  return output;
+}
+
+// Pad Node followed by a 3x3 Convolution or Depthwise Convolution. Pad Nodes with zero padding are fused into any
+// Convolution, and Pad Nodes with a padding mode only into Convolutions without padding of their own.
+struct PaddedConvolution {
+  // Padding mode flags, or 0 for a Constant Pad Node.
+  uint32_t padding_mode = 0;
+  float padding_value = 0.0f;
+  bool depthwise = false;
+  size_t convolution_padding = 0;
+  bool padded_is_external_output = false;
+  bool padded_has_second_consumer = false;
+  bool fused = true;
+};
+
+void TestPadConvolution(const PaddedConvolution& block) {
+  ASSERT_EQ(xnn_status_success, xnn_initialize(nullptr /* allocator */));
+
+  const size_t kHeight = 7;
+  const size_t kWidth = 9;
+  const size_t kChannels = 8;
+  const size_t kOutputChannels = block.depthwise ? kChannels : 16;
+  const std::array<size_t, 4> pre_paddings = {{0, 1, 2, 0}};
+  const std::array<size_t, 4> post_paddings = {{0, 2, 1, 0}};
+  const size_t padded_height = kHeight + pre_paddings[1] + post_paddings[1];
+  const size_t padded_width = kWidth + pre_paddings[2] + post_paddings[2];
+  const size_t output_height = padded_height + 2 * block.convolution_padding - 2;
+  const size_t output_width = padded_width + 2 * block.convolution_padding - 2;
+  SubgraphBuilder builder(3 /* external value IDs */);
+  const uint32_t input_id = builder.ExternalInput(0, {{1, kHeight, kWidth, kChannels}});
+  const uint32_t output_id = builder.ExternalOutput(1, {{1, output_height, output_width, kOutputChannels}});
+  const std::vector<size_t> padded_dims = {{1, padded_height, padded_width, kChannels}};
+  const uint32_t padded_id = block.padded_is_external_output ?
+    builder.ExternalOutput(2, padded_dims) : builder.Internal(padded_dims);
+  if (block.padding_mode == 0) {
+    ASSERT_EQ(xnn_status_success, xnn_define_static_constant_pad(
+      builder.subgraph(), pre_paddings.data(), post_paddings.data(), block.padding_value,
+      input_id, padded_id, 0 /* flags */));
+  } else {
+    ASSERT_EQ(xnn_status_success, xnn_define_static_pad(
+      builder.subgraph(), pre_paddings.data(), post_paddings.data(), input_id, padded_id, block.padding_mode));
+  }
+
+  Convolution convolution;
+  convolution.padding_top = convolution.padding_right = convolution.padding_bottom = convolution.padding_left =
+    block.convolution_padding;
+  convolution.kernel_height = convolution.kernel_width = 3;
+  if (block.depthwise) {
+    convolution.groups = kChannels;
+    convolution = builder.DefineDepthwiseConvolution2D(padded_id, output_id, convolution);
+  } else {
+    convolution.group_input_channels = kChannels;
+    convolution.group_output_channels = kOutputChannels;
+    convolution = builder.DefineConvolution2D(padded_id, output_id, convolution);
+  }
+  if (block.padded_has_second_consumer) {
+    ASSERT_EQ(xnn_status_success, xnn_define_clamp(
+      builder.subgraph(), -0.5f /* output min */, 0.5f /* output max */, padded_id,
+      builder.ExternalOutput(2, padded_dims), 0 /* flags */));
+  }
+
+  RuntimePtr runtime = CreateRuntime(builder.subgraph());
+  ASSERT_NE(nullptr, runtime);
+  const xnn_node_type pad_type = block.padding_mode == 0 ? xnn_node_type_static_constant_pad : xnn_node_type_static_pad;
+  EXPECT_EQ(block.fused ? 0u : 1u, CountNodes(builder.subgraph(), pad_type));
+  const xnn_node* node = FindNode(builder.subgraph(),
+    block.depthwise ? xnn_node_type_depthwise_convolution_2d : xnn_node_type_convolution_2d);
+  EXPECT_EQ(block.fused ? input_id : padded_id, node->inputs[0]);
+  const uint32_t padding_mode_flags = XNN_FLAG_REFLECT_PADDING | XNN_FLAG_SYMMETRIC_PADDING | XNN_FLAG_EDGE_PADDING;
+  EXPECT_EQ(block.fused ? block.padding_mode : 0, node->flags & padding_mode_flags);
+
+  const Tensor input = builder.RandomTensor(1, kHeight, kWidth, kChannels);
+  const Tensor padded_reference = ReferencePad(
+    input, pre_paddings[1], pre_paddings[2], post_paddings[1], post_paddings[2], block.padding_mode,
+    block.padding_value);
+  Tensor output(1, output_height, output_width, kOutputChannels);
+  Tensor padded(1, padded_height, padded_width, kChannels);
+  std::map<uint32_t, Tensor*> outputs = {{1, &output}};
+  if (block.padded_is_external_output || block.padded_has_second_consumer) {
+    outputs[2] = &padded;
+  }
+  RunRuntime(runtime.get(), {{0, &input}}, outputs);
+  ExpectNear(ReferenceConvolution(padded_reference, convolution), output);
+  if (block.padded_is_external_output) {
+    ExpectNear(padded_reference, padded);
+  } else if (block.padded_has_second_consumer) {
+    ExpectNear(ReferenceClamp(padded_reference, -0.5f, 0.5f), padded);
+  }
+}
+
+Tensor ReferenceSpaceToDepth(const Tensor& input, size_t block_size) {
+  Tensor output(input.batch, input.height / block_size, input.width / block_size,
+    input.channels * block_size * block_size);
+  for (size_t n = 0; n < output.batch; n++) {
+    for (size_t y = 0; y < output.height; y++) {
+      for (size_t x = 0; x < output.width; x++) {
+        for (size_t by = 0; by < block_size; by++) {
+          for (size_t bx = 0; bx < block_size; bx++) {
+            for (size_t c = 0; c < input.channels; c++) {
+              output.at(n, y, x, (by * block_size + bx) * input.channels + c) =
+                input.at(n, y * block_size + by, x * block_size + bx, c);
+            }
+          }
+        }
+      }
+    }
+  }
+  return output;
+}
+
+// Space To Depth Node followed by a Convolution. Only unpadded and ungrouped 1x1 Convolutions absorb the rearrangement
+// as a block_size x block_size Convolution with block_size stride.
+struct SpaceToDepthConvolution {
+  size_t block_size = 2;
+  size_t kernel_size = 1;
+  size_t padding = 0;
+  size_t groups = 1;
+  bool rearranged_is_external_output = false;
+  bool fused = true;
+};
+
+void TestSpaceToDepthConvolution(const SpaceToDepthConvolution& block) {
+  ASSERT_EQ(xnn_status_success, xnn_initialize(nullptr /* allocator */));
+
+  const size_t kBatchSize = 2;
+  const size_t kHeight = 5;
+  const size_t kWidth = 7;
+  const size_t kChannels = 4;
+  const size_t kOutputChannels = 16;
+  const size_t rearranged_channels = kChannels * block.block_size * block.block_size;
+  const size_t output_height = kHeight + 2 * block.padding - block.kernel_size + 1;
+  const size_t output_width = kWidth + 2 * block.padding - block.kernel_size + 1;
+  SubgraphBuilder builder(3 /* external value IDs */);
+  const uint32_t input_id = builder.ExternalInput(0,
+    {{kBatchSize, kHeight * block.block_size, kWidth * block.block_size, kChannels}});
+  const uint32_t output_id = builder.ExternalOutput(1, {{kBatchSize, output_height, output_width, kOutputChannels}});
+  const std::vector<size_t> rearranged_dims = {{kBatchSize, kHeight, kWidth, rearranged_channels}};
+  const uint32_t rearranged_id = block.rearranged_is_external_output ?
+    builder.ExternalOutput(2, rearranged_dims) : builder.Internal(rearranged_dims);
+  ASSERT_EQ(xnn_status_success, xnn_define_space_to_depth(
+    builder.subgraph(), input_id, rearranged_id, block.block_size, 0 /* flags */));
+
+  Convolution convolution;
+  convolution.padding_top = convolution.padding_right = convolution.padding_bottom = convolution.padding_left =
+    block.padding;
+  convolution.kernel_height = convolution.kernel_width = block.kernel_size;
+  convolution.groups = block.groups;
+  convolution.group_input_channels = rearranged_channels / block.groups;
+  convolution.group_output_channels = kOutputChannels / block.groups;
+  convolution.output_min = -1.0f;
+  convolution.output_max = 1.0f;
+  convolution = builder.DefineConvolution2D(rearranged_id, output_id, convolution);
+
+  RuntimePtr runtime = CreateRuntime(builder.subgraph());
+  ASSERT_NE(nullptr, runtime);
+  EXPECT_EQ(block.fused ? 0u : 1u, CountNodes(builder.subgraph(), xnn_node_type_space_to_depth));
+  const xnn_node* node = FindNode(builder.subgraph(), xnn_node_type_convolution_2d);
+  EXPECT_EQ(block.fused ? input_id : rearranged_id, node->inputs[0]);
+  if (block.fused) {
+    EXPECT_EQ(block.block_size, node->params.convolution_2d.kernel_height);
+    EXPECT_EQ(block.block_size, node->params.convolution_2d.kernel_width);
+    EXPECT_EQ(block.block_size, node->params.convolution_2d.subsampling_height);
+    EXPECT_EQ(block.block_size, node->params.convolution_2d.subsampling_width);
+    EXPECT_EQ(kChannels, node->params.convolution_2d.group_input_channels);
+  }
+
+  const Tensor input =
+    builder.RandomTensor(kBatchSize, kHeight * block.block_size, kWidth * block.block_size, kChannels);
+  const Tensor rearranged_reference = ReferenceSpaceToDepth(input, block.block_size);
+  Tensor output(kBatchSize, output_height, output_width, kOutputChannels);
+  Tensor rearranged(kBatchSize, kHeight, kWidth, rearranged_channels);
+  std::map<uint32_t, Tensor*> outputs = {{1, &output}};
+  if (block.rearranged_is_external_output) {
+    outputs[2] = &rearranged;
+  }
+  RunRuntime(runtime.get(), {{0, &input}}, outputs);
+  ExpectNear(ReferenceConvolution(rearranged_reference, convolution), output);
+  if (block.rearranged_is_external_output) {
+    ExpectNear(rearranged_reference, rearranged);
+  }
+}
+
+}  // namespace
+
+
+TEST(RESIDUAL_ADD_FUSION, convolution) {
+  TestResidualConvolution(ResidualConsumer::kAdd, false /* residual first */);
+}
+
+TEST(RESIDUAL_ADD_FUSION, convolution_residual_first) {
+  TestResidualConvolution(ResidualConsumer::kAdd, true /* residual first */);
+}
+
+TEST(RESIDUAL_ADD_FUSION, fully_connected) {
+  ASSERT_EQ(xnn_status_success, xnn_initialize(nullptr /* allocator */));
+
+  const size_t kBatchSize = 5;
+  const size_t kInputChannels = 37;
+  const size_t kOutputChannels = 19;
+  SubgraphBuilder builder(3 /* external value IDs */);
+  const uint32_t input_id = builder.ExternalInput(0, {{kBatchSize, kInputChannels}});
+  const uint32_t residual_id = builder.ExternalInput(1, {{kBatchSize, kOutputChannels}});
+  const uint32_t output_id = builder.ExternalOutput(2, {{kBatchSize, kOutputChannels}});
+  const uint32_t fully_connected_output_id = builder.Internal({{kBatchSize, kOutputChannels}});
+  const Convolution fully_connected =
+    builder.DefineFullyConnected(input_id, fully_connected_output_id, kInputChannels, kOutputChannels);
+  ASSERT_EQ(xnn_status_success, xnn_define_add2(
+    builder.subgraph(), -0.5f /* output min */, 0.5f /* output max */,
+    fully_connected_output_id, residual_id, output_id, 0 /* flags */));
+
+  RuntimePtr runtime = CreateRuntime(builder.subgraph());
+  ASSERT_NE(nullptr, runtime);
+  EXPECT_EQ(0u, CountNodes(builder.subgraph(), xnn_node_type_add2));
+  EXPECT_TRUE(FindNode(builder.subgraph(), xnn_node_type_fully_connected)->residual.fused);
+
+  // A batch of Fully Connected rows is a 1x1 Convolution over a column of pixels.
+  const Tensor input = builder.RandomTensor(1, kBatchSize, 1, kInputChannels);
+  const Tensor residual = builder.RandomTensor(1, kBatchSize, 1, kOutputChannels);
+  Tensor output(1, kBatchSize, 1, kOutputChannels);
+  RunRuntime(runtime.get(), {{0, &input}, {1, &residual}}, {{2, &output}});
+  ExpectNear(ReferenceAdd(ReferenceConvolution(input, fully_connected), residual, -0.5f, 0.5f), output);
+}
+
+TEST(RESIDUAL_ADD_FUSION, convolution_output_is_external_output) {
+  TestResidualConvolution(ResidualConsumer::kAddAndExternalOutput, false /* residual first */);
+}
+
+TEST(RESIDUAL_ADD_FUSION, convolution_output_has_multiple_consumers) {
+  TestResidualConvolution(ResidualConsumer::kTwoAdds, false /* residual first */);
+}
+
+TEST(INVERTED_BOTTLENECK_FUSION, unit_stride) {
+  TestInvertedBottleneck(InvertedBottleneck());
+}
+
+TEST(INVERTED_BOTTLENECK_FUSION, subsampling) {
+  InvertedBottleneck block;
+  block.subsampling = 2;
+  TestInvertedBottleneck(block);
+}
+
+TEST(INVERTED_BOTTLENECK_FUSION, odd_size_subsampling) {
+  InvertedBottleneck block;
+  block.height = 57;
+  block.width = 59;
+  block.subsampling = 2;
+  TestInvertedBottleneck(block);
+}
+
+TEST(INVERTED_BOTTLENECK_FUSION, clamped_output) {
+  InvertedBottleneck block;
+  block.clamp_output = true;
+  TestInvertedBottleneck(block);
+}
+
+TEST(INVERTED_BOTTLENECK_FUSION, small_expanded_tensor) {
+  // 16x16 pixels of the 48-channel expanded tensor take 48 KB, below the 512 KB threshold.
+  InvertedBottleneck block;
+  block.height = 16;
+  block.width = 16;
+  block.fused = false;
+  TestInvertedBottleneck(block);
+}
+
+TEST(INVERTED_BOTTLENECK_FUSION, expanded_tensor_is_external_output) {
+  InvertedBottleneck block;
+  block.expanded_is_external_output = true;
+  block.fused = false;
+  TestInvertedBottleneck(block);
+}
+
+TEST(INVERTED_BOTTLENECK_FUSION, expanded_tensor_has_multiple_consumers) {
+  InvertedBottleneck block;
+  block.expanded_has_second_consumer = true;
+  block.fused = false;
+  TestInvertedBottleneck(block);
+}
+
+TEST(INVERTED_BOTTLENECK_FUSION, padded_projection) {
+  InvertedBottleneck block;
+  block.projection_padding = 1;
+  block.fused = false;
+  TestInvertedBottleneck(block);
+}
+
+TEST(INVERTED_BOTTLENECK_FUSION, grouped_projection) {
+  InvertedBottleneck block;
+  block.projection_groups = 2;
+  block.fused = false;
+  TestInvertedBottleneck(block);
+}
+
+TEST(ZERO_COPY_SLICE, batches_of_internal_value) {
+  TestSlice({{{1, 0, 0, 0}}, {{2, 6, 6, 8}}, {{1, 1, 1, 1}}},
+    SliceSource::kInternalValue, false /* output is external */, true /* alias */);
+}
+
+TEST(ZERO_COPY_SLICE, rows_of_internal_value) {
+  TestSlice({{{2, 3, 0, 0}}, {{1, 2, 6, 8}}, {{1, 1, 1, 1}}},
+    SliceSource::kInternalValue, false /* output is external */, true /* alias */);
+}
+
+TEST(ZERO_COPY_SLICE, channels_of_single_pixel) {
+  TestSlice({{{3, 5, 4, 2}}, {{1, 1, 1, 5}}, {{1, 1, 1, 1}}},
+    SliceSource::kInternalValue, false /* output is external */, true /* alias */);
+}
+
+TEST(ZERO_COPY_SLICE, rows_of_external_input) {
+  TestSlice({{{1, 2, 0, 0}}, {{1, 3, 6, 8}}, {{1, 1, 1, 1}}},
+    SliceSource::kExternalInput, false /* output is external */, true /* alias */);
+}
+
+TEST(ZERO_COPY_SLICE, rows_of_slice) {
+  TestSlice({{{1, 1, 0, 0}}, {{1, 4, 6, 8}}, {{1, 1, 1, 1}}},
+    SliceSource::kSlice, false /* output is external */, true /* alias */);
+}
+
+TEST(ZERO_COPY_SLICE, output_is_external_output) {
+  TestSlice({{{1, 0, 0, 0}}, {{2, 6, 6, 8}}, {{1, 1, 1, 1}}},
+    SliceSource::kInternalValue, true /* output is external */, false /* alias */);
+}
+
+TEST(ZERO_COPY_SLICE, non_contiguous_window) {
+  TestSlice({{{0, 1, 1, 0}}, {{4, 4, 4, 8}}, {{1, 1, 1, 1}}},
+    SliceSource::kInternalValue, false /* output is external */, false /* alias */);
+}
+
+TEST(ZERO_COPY_SLICE, strided_batches) {
+  TestSlice({{{0, 0, 0, 0}}, {{2, 6, 6, 8}}, {{2, 1, 1, 1}}},
+    SliceSource::kInternalValue, false /* output is external */, false /* alias */);
+}
+
+TEST(PAD_FUSION, zero_padding) {
+  TestPadConvolution(PaddedConvolution());
+}
+
+TEST(PAD_FUSION, zero_padding_into_padded_convolution) {
+  PaddedConvolution block;
+  block.convolution_padding = 1;
+  TestPadConvolution(block);
+}
+
+TEST(PAD_FUSION, zero_padding_into_depthwise_convolution) {
+  PaddedConvolution block;
+  block.depthwise = true;
+  TestPadConvolution(block);
+}
+
+TEST(PAD_FUSION, reflect_padding) {
+  PaddedConvolution block;
+  block.padding_mode = XNN_FLAG_REFLECT_PADDING;
+  TestPadConvolution(block);
+}
+
+TEST(PAD_FUSION, symmetric_padding) {
+  PaddedConvolution block;
+  block.padding_mode = XNN_FLAG_SYMMETRIC_PADDING;
+  TestPadConvolution(block);
+}
+
+TEST(PAD_FUSION, edge_padding) {
+  PaddedConvolution block;
+  block.padding_mode = XNN_FLAG_EDGE_PADDING;
+  TestPadConvolution(block);
+}
+
+TEST(PAD_FUSION, reflect_padding_into_depthwise_convolution) {
+  PaddedConvolution block;
+  block.padding_mode = XNN_FLAG_REFLECT_PADDING;
+  block.depthwise = true;
+  TestPadConvolution(block);
+}
+
+TEST(PAD_FUSION, edge_padding_into_depthwise_convolution) {
+  PaddedConvolution block;
+  block.padding_mode = XNN_FLAG_EDGE_PADDING;
+  block.depthwise = true;
+  TestPadConvolution(block);
+}
+
+TEST(PAD_FUSION, non_zero_padding_value) {
+  PaddedConvolution block;
+  block.padding_value = 0.5f;
+  block.fused = false;
+  TestPadConvolution(block);
+}
+
+TEST(PAD_FUSION, reflect_padding_into_padded_convolution) {
+  PaddedConvolution block;
+  block.padding_mode = XNN_FLAG_REFLECT_PADDING;
+  block.convolution_padding = 1;
+  block.fused = false;
+  TestPadConvolution(block);
+}
+
+TEST(PAD_FUSION, edge_padding_into_padded_depthwise_convolution) {
+  PaddedConvolution block;
+  block.padding_mode = XNN_FLAG_EDGE_PADDING;
+  block.depthwise = true;
+  block.convolution_padding = 1;
+  block.fused = false;
+  TestPadConvolution(block);
+}
+
+TEST(PAD_FUSION, padded_tensor_is_external_output) {
+  PaddedConvolution block;
+  block.padding_mode = XNN_FLAG_REFLECT_PADDING;
+  block.padded_is_external_output = true;
+  block.fused = false;
+  TestPadConvolution(block);
+}
+
+TEST(PAD_FUSION, padded_tensor_has_multiple_consumers) {
+  PaddedConvolution block;
+  block.padded_has_second_consumer = true;
+  block.fused = false;
+  TestPadConvolution(block);
+}
+
+TEST(PAD_FUSION, mode_padded_tensor_has_multiple_consumers) {
+  PaddedConvolution block;
+  block.padding_mode = XNN_FLAG_SYMMETRIC_PADDING;
+  block.padded_has_second_consumer = true;
+  block.fused = false;
+  TestPadConvolution(block);
+}
+
+TEST(SPACE_TO_DEPTH_FUSION, block_size_2) {
+  TestSpaceToDepthConvolution(SpaceToDepthConvolution());
+}
+
+TEST(SPACE_TO_DEPTH_FUSION, block_size_3) {
+  SpaceToDepthConvolution block;
+  block.block_size = 3;
+  TestSpaceToDepthConvolution(block);
+}
+
+TEST(SPACE_TO_DEPTH_FUSION, block_size_4) {
+  SpaceToDepthConvolution block;
+  block.block_size = 4;
+  TestSpaceToDepthConvolution(block);
+}
+
+TEST(SPACE_TO_DEPTH_FUSION, padded_convolution) {
+  SpaceToDepthConvolution block;
+  block.padding = 1;
+  block.fused = false;
+  TestSpaceToDepthConvolution(block);
+}
+
+TEST(SPACE_TO_DEPTH_FUSION, grouped_convolution) {
+  SpaceToDepthConvolution block;
+  block.groups = 2;
+  block.fused = false;
+  TestSpaceToDepthConvolution(block);
+}
+
+TEST(SPACE_TO_DEPTH_FUSION, 3x3_convolution) {
+  SpaceToDepthConvolution block;
+  block.kernel_size = 3;
+  block.padding = 1;
+  block.fused = false;
+  TestSpaceToDepthConvolution(block);
+}
+
+TEST(SPACE_TO_DEPTH_FUSION, rearranged_tensor_is_external_output) {
+  SpaceToDepthConvolution block;
+  block.rearranged_is_external_output = true;
+  block.fused = false;
+  TestSpaceToDepthConvolution(block);
+}
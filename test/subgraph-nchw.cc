@@ -4,6 +4,7 @@
 // LICENSE file in the root directory of this source tree.
 
 #include <xnnpack.h>
+#include <xnnpack/params.h>
 
 #include "subgraph-tester.h"
 #include <gtest/gtest.h>
@@ -100,3 +101,43 @@ TEST(SUBGRAPH_NCHW, bottleneck) {
   ASSERT_EQ(tester.get_layout(13), xnn_layout_type_nchw);
   ASSERT_EQ(tester.get_layout(14), xnn_layout_type_nhwc);
 }
+
+TEST(SUBGRAPH_NCHW, bottleneck_with_dilated_depthwise) {
+  auto tester = SubgraphTester(15);
+  if (xnn_params.f32.dwconv2d_chw_dilated.output_width_tile <= 1) {
+    GTEST_SKIP() << "no vectorized dilated NCHW depthwise convolution micro-kernel on this processor";
+  }
+  tester
+    .add_tensor({1, 256, 256, 3}, kDynamic, 0)
+    .add_tensor({8, 3, 3, 3}, kStaticDense, 1)
+    .add_tensor({8}, kStaticDense, 2)
+    .add_tensor({1, 128, 128, 8}, kDynamic, 3)
+    .add_tensor({4, 1, 1, 8}, kStaticSparse, 4)
+    .add_tensor({4}, kStaticDense, 5)
+    .add_tensor({1, 128, 128, 4}, kDynamic, 6)
+    .add_tensor({1, 3, 3, 4}, kStaticDense, 7)
+    .add_tensor({4}, kStaticDense, 8)
+    .add_tensor({1, 128, 128, 4}, kDynamic, 9)
+    .add_tensor({8, 1, 1, 4}, kStaticSparse, 10)
+    .add_tensor({8}, kStaticDense, 11)
+    .add_tensor({1, 128, 128, 8}, kDynamic, 12)
+    .add_tensor({1, 128, 128, 8}, kDynamic, 13)
+    .add_tensor({1, 128, 128, 8}, kDynamic, 13)
+    .add_tensor({1, 8}, kDynamic, 14)
+    .add_conv(1, 1, 1, 1, 3, 3, 2, 2, 1, 1, 1, 3, 8, 0, 1, 2, 3)
+    .add_conv(0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 8, 4, 3, 4, 5, 6)
+    .add_depthwise_conv(2, 2, 2, 2, 3, 3, 1, 1, 2, 2, 1, 4, 6, 7, 8, 9)
+    .add_conv(0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 8, 4, 9, 10, 11, 12)
+    .add_addition(3, 12, 13)
+    .add_global_average_pooling(13, 14)
+    .optimize()
+    .rewrite();
+
+  ASSERT_EQ(tester.get_layout(0), xnn_layout_type_nhwc);
+  ASSERT_EQ(tester.get_layout(3), xnn_layout_type_nchw);
+  ASSERT_EQ(tester.get_layout(6), xnn_layout_type_nchw);
+  ASSERT_EQ(tester.get_layout(9), xnn_layout_type_nchw);
+  ASSERT_EQ(tester.get_layout(12), xnn_layout_type_nchw);
+  ASSERT_EQ(tester.get_layout(13), xnn_layout_type_nchw);
+  ASSERT_EQ(tester.get_layout(14), xnn_layout_type_nhwc);
+}
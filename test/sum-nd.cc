@@ -0,0 +1,339 @@
+// Copyright 2022 Google LLC
+//
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree.
+
+#include <gtest/gtest.h>
+
+#include <vector>
+
+#include "reduce-operator-tester.h"
+
+constexpr size_t kDim1 = 3;
+constexpr size_t kDim2 = 5;
+constexpr size_t kDim3 = 4;
+constexpr size_t kDim4 = 7;
+constexpr size_t kDim5 = 2;
+constexpr size_t kDim6 = 3;
+
+
+TEST(SUM_ND_F32, reduce_1d) {
+  for (uint32_t axes_mask = 1; axes_mask < (UINT32_C(1) << 1); axes_mask++) {
+    std::vector<size_t> reduction_axes;
+    for (size_t axis = 0; axis < 1; axis++) {
+      if (axes_mask & (UINT32_C(1) << axis)) {
+        reduction_axes.push_back(axis);
+      }
+    }
+    ReduceOperatorTester()
+      .operation_type(ReduceOperatorTester::OperationType::Sum)
+      .input_shape({kDim1})
+      .reduction_axes(reduction_axes)
+      .TestF32();
+  }
+}
+
+TEST(SUM_ND_F32, reduce_2d) {
+  for (uint32_t axes_mask = 1; axes_mask < (UINT32_C(1) << 2); axes_mask++) {
+    std::vector<size_t> reduction_axes;
+    for (size_t axis = 0; axis < 2; axis++) {
+      if (axes_mask & (UINT32_C(1) << axis)) {
+        reduction_axes.push_back(axis);
+      }
+    }
+    ReduceOperatorTester()
+      .operation_type(ReduceOperatorTester::OperationType::Sum)
+      .input_shape({kDim1, kDim2})
+      .reduction_axes(reduction_axes)
+      .TestF32();
+  }
+}
+
+TEST(SUM_ND_F32, reduce_3d) {
+  for (uint32_t axes_mask = 1; axes_mask < (UINT32_C(1) << 3); axes_mask++) {
+    std::vector<size_t> reduction_axes;
+    for (size_t axis = 0; axis < 3; axis++) {
+      if (axes_mask & (UINT32_C(1) << axis)) {
+        reduction_axes.push_back(axis);
+      }
+    }
+    ReduceOperatorTester()
+      .operation_type(ReduceOperatorTester::OperationType::Sum)
+      .input_shape({kDim1, kDim2, kDim3})
+      .reduction_axes(reduction_axes)
+      .TestF32();
+  }
+}
+
+TEST(SUM_ND_F32, reduce_4d) {
+  for (uint32_t axes_mask = 1; axes_mask < (UINT32_C(1) << 4); axes_mask++) {
+    std::vector<size_t> reduction_axes;
+    for (size_t axis = 0; axis < 4; axis++) {
+      if (axes_mask & (UINT32_C(1) << axis)) {
+        reduction_axes.push_back(axis);
+      }
+    }
+    ReduceOperatorTester()
+      .operation_type(ReduceOperatorTester::OperationType::Sum)
+      .input_shape({kDim1, kDim2, kDim3, kDim4})
+      .reduction_axes(reduction_axes)
+      .TestF32();
+  }
+}
+
+TEST(SUM_ND_F32, reduce_5d) {
+  for (uint32_t axes_mask = 1; axes_mask < (UINT32_C(1) << 5); axes_mask++) {
+    std::vector<size_t> reduction_axes;
+    for (size_t axis = 0; axis < 5; axis++) {
+      if (axes_mask & (UINT32_C(1) << axis)) {
+        reduction_axes.push_back(axis);
+      }
+    }
+    ReduceOperatorTester()
+      .operation_type(ReduceOperatorTester::OperationType::Sum)
+      .input_shape({kDim1, kDim2, kDim3, kDim4, kDim5})
+      .reduction_axes(reduction_axes)
+      .TestF32();
+  }
+}
+
+TEST(SUM_ND_F32, reduce_6d) {
+  for (uint32_t axes_mask = 1; axes_mask < (UINT32_C(1) << 6); axes_mask++) {
+    std::vector<size_t> reduction_axes;
+    for (size_t axis = 0; axis < 6; axis++) {
+      if (axes_mask & (UINT32_C(1) << axis)) {
+        reduction_axes.push_back(axis);
+      }
+    }
+    ReduceOperatorTester()
+      .operation_type(ReduceOperatorTester::OperationType::Sum)
+      .input_shape({kDim1, kDim2, kDim3, kDim4, kDim5, kDim6})
+      .reduction_axes(reduction_axes)
+      .TestF32();
+  }
+}
+
+TEST(SUM_ND_F16, reduce_adjacent_1d) {
+  for (size_t first_axis = 0; first_axis < 1; first_axis++) {
+    for (size_t last_axis = first_axis; last_axis < 1; last_axis++) {
+      std::vector<size_t> reduction_axes;
+      for (size_t axis = first_axis; axis <= last_axis; axis++) {
+        reduction_axes.push_back(axis);
+      }
+      ReduceOperatorTester()
+        .operation_type(ReduceOperatorTester::OperationType::Sum)
+        .input_shape({kDim1})
+        .reduction_axes(reduction_axes)
+        .TestF16();
+    }
+  }
+}
+
+TEST(SUM_ND_F16, reduce_adjacent_2d) {
+  for (size_t first_axis = 0; first_axis < 2; first_axis++) {
+    for (size_t last_axis = first_axis; last_axis < 2; last_axis++) {
+      std::vector<size_t> reduction_axes;
+      for (size_t axis = first_axis; axis <= last_axis; axis++) {
+        reduction_axes.push_back(axis);
+      }
+      ReduceOperatorTester()
+        .operation_type(ReduceOperatorTester::OperationType::Sum)
+        .input_shape({kDim1, kDim2})
+        .reduction_axes(reduction_axes)
+        .TestF16();
+    }
+  }
+}
+
+TEST(SUM_ND_F16, reduce_adjacent_3d) {
+  for (size_t first_axis = 0; first_axis < 3; first_axis++) {
+    for (size_t last_axis = first_axis; last_axis < 3; last_axis++) {
+      std::vector<size_t> reduction_axes;
+      for (size_t axis = first_axis; axis <= last_axis; axis++) {
+        reduction_axes.push_back(axis);
+      }
+      ReduceOperatorTester()
+        .operation_type(ReduceOperatorTester::OperationType::Sum)
+        .input_shape({kDim1, kDim2, kDim3})
+        .reduction_axes(reduction_axes)
+        .TestF16();
+    }
+  }
+}
+
+TEST(SUM_ND_F16, reduce_adjacent_4d) {
+  for (size_t first_axis = 0; first_axis < 4; first_axis++) {
+    for (size_t last_axis = first_axis; last_axis < 4; last_axis++) {
+      std::vector<size_t> reduction_axes;
+      for (size_t axis = first_axis; axis <= last_axis; axis++) {
+        reduction_axes.push_back(axis);
+      }
+      ReduceOperatorTester()
+        .operation_type(ReduceOperatorTester::OperationType::Sum)
+        .input_shape({kDim1, kDim2, kDim3, kDim4})
+        .reduction_axes(reduction_axes)
+        .TestF16();
+    }
+  }
+}
+
+TEST(SUM_ND_F16, reduce_adjacent_5d) {
+  for (size_t first_axis = 0; first_axis < 5; first_axis++) {
+    for (size_t last_axis = first_axis; last_axis < 5; last_axis++) {
+      std::vector<size_t> reduction_axes;
+      for (size_t axis = first_axis; axis <= last_axis; axis++) {
+        reduction_axes.push_back(axis);
+      }
+      ReduceOperatorTester()
+        .operation_type(ReduceOperatorTester::OperationType::Sum)
+        .input_shape({kDim1, kDim2, kDim3, kDim4, kDim5})
+        .reduction_axes(reduction_axes)
+        .TestF16();
+    }
+  }
+}
+
+TEST(SUM_ND_F16, reduce_adjacent_6d) {
+  for (size_t first_axis = 0; first_axis < 6; first_axis++) {
+    for (size_t last_axis = first_axis; last_axis < 6; last_axis++) {
+      std::vector<size_t> reduction_axes;
+      for (size_t axis = first_axis; axis <= last_axis; axis++) {
+        reduction_axes.push_back(axis);
+      }
+      ReduceOperatorTester()
+        .operation_type(ReduceOperatorTester::OperationType::Sum)
+        .input_shape({kDim1, kDim2, kDim3, kDim4, kDim5, kDim6})
+        .reduction_axes(reduction_axes)
+        .TestF16();
+    }
+  }
+}
+
+TEST(SUM_ND_QS8, reduce_adjacent_1d) {
+  for (size_t first_axis = 0; first_axis < 1; first_axis++) {
+    for (size_t last_axis = first_axis; last_axis < 1; last_axis++) {
+      std::vector<size_t> reduction_axes;
+      for (size_t axis = first_axis; axis <= last_axis; axis++) {
+        reduction_axes.push_back(axis);
+      }
+      ReduceOperatorTester()
+        .operation_type(ReduceOperatorTester::OperationType::Sum)
+        .input_shape({kDim1})
+        .reduction_axes(reduction_axes)
+        .TestQS8();
+    }
+  }
+}
+
+TEST(SUM_ND_QS8, reduce_adjacent_2d) {
+  for (size_t first_axis = 0; first_axis < 2; first_axis++) {
+    for (size_t last_axis = first_axis; last_axis < 2; last_axis++) {
+      std::vector<size_t> reduction_axes;
+      for (size_t axis = first_axis; axis <= last_axis; axis++) {
+        reduction_axes.push_back(axis);
+      }
+      ReduceOperatorTester()
+        .operation_type(ReduceOperatorTester::OperationType::Sum)
+        .input_shape({kDim1, kDim2})
+        .reduction_axes(reduction_axes)
+        .TestQS8();
+    }
+  }
+}
+
+TEST(SUM_ND_QS8, reduce_adjacent_3d) {
+  for (size_t first_axis = 0; first_axis < 3; first_axis++) {
+    for (size_t last_axis = first_axis; last_axis < 3; last_axis++) {
+      std::vector<size_t> reduction_axes;
+      for (size_t axis = first_axis; axis <= last_axis; axis++) {
+        reduction_axes.push_back(axis);
+      }
+      ReduceOperatorTester()
+        .operation_type(ReduceOperatorTester::OperationType::Sum)
+        .input_shape({kDim1, kDim2, kDim3})
+        .reduction_axes(reduction_axes)
+        .TestQS8();
+    }
+  }
+}
+
+TEST(SUM_ND_QS8, reduce_adjacent_4d) {
+  for (size_t first_axis = 0; first_axis < 4; first_axis++) {
+    for (size_t last_axis = first_axis; last_axis < 4; last_axis++) {
+      std::vector<size_t> reduction_axes;
+      for (size_t axis = first_axis; axis <= last_axis; axis++) {
+        reduction_axes.push_back(axis);
+      }
+      ReduceOperatorTester()
+        .operation_type(ReduceOperatorTester::OperationType::Sum)
+        .input_shape({kDim1, kDim2, kDim3, kDim4})
+        .reduction_axes(reduction_axes)
+        .TestQS8();
+    }
+  }
+}
+
+TEST(SUM_ND_QS8, reduce_adjacent_5d) {
+  for (size_t first_axis = 0; first_axis < 5; first_axis++) {
+    for (size_t last_axis = first_axis; last_axis < 5; last_axis++) {
+      std::vector<size_t> reduction_axes;
+      for (size_t axis = first_axis; axis <= last_axis; axis++) {
+        reduction_axes.push_back(axis);
+      }
+      ReduceOperatorTester()
+        .operation_type(ReduceOperatorTester::OperationType::Sum)
+        .input_shape({kDim1, kDim2, kDim3, kDim4, kDim5})
+        .reduction_axes(reduction_axes)
+        .TestQS8();
+    }
+  }
+}
+
+TEST(SUM_ND_QS8, reduce_adjacent_6d) {
+  for (size_t first_axis = 0; first_axis < 6; first_axis++) {
+    for (size_t last_axis = first_axis; last_axis < 6; last_axis++) {
+      std::vector<size_t> reduction_axes;
+      for (size_t axis = first_axis; axis <= last_axis; axis++) {
+        reduction_axes.push_back(axis);
+      }
+      ReduceOperatorTester()
+        .operation_type(ReduceOperatorTester::OperationType::Sum)
+        .input_shape({kDim1, kDim2, kDim3, kDim4, kDim5, kDim6})
+        .reduction_axes(reduction_axes)
+        .TestQS8();
+    }
+  }
+}
+
+TEST(SUM_ND_QS8, input_zero_point) {
+  for (int32_t input_zero_point = -128; input_zero_point <= 127; input_zero_point += 51) {
+    ReduceOperatorTester()
+      .operation_type(ReduceOperatorTester::OperationType::Sum)
+      .input_shape({kDim1, kDim2, kDim3})
+      .reduction_axes({1, 2})
+      .input_zero_point(int8_t(input_zero_point))
+      .TestQS8();
+  }
+}
+
+TEST(SUM_ND_QS8, output_zero_point) {
+  for (int32_t output_zero_point = -128; output_zero_point <= 127; output_zero_point += 51) {
+    ReduceOperatorTester()
+      .operation_type(ReduceOperatorTester::OperationType::Sum)
+      .input_shape({kDim1, kDim2, kDim3})
+      .reduction_axes({1, 2})
+      .output_zero_point(int8_t(output_zero_point))
+      .TestQS8();
+  }
+}
+
+TEST(SUM_ND_QS8, input_scale) {
+  for (float input_scale = 0.1f; input_scale < 10.0f; input_scale *= 3.14f) {
+    ReduceOperatorTester()
+      .operation_type(ReduceOperatorTester::OperationType::Sum)
+      .input_shape({kDim1, kDim2, kDim3})
+      .reduction_axes({1, 2})
+      .input_scale(input_scale)
+      .TestQS8();
+  }
+}
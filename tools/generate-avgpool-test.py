@@ -27,20 +27,21 @@ parser.set_defaults(defines=list())
 
 
 def split_ukernel_name(name):
-  match = re.match(r"^xnn_(qu8|f16|f32)_[p]?avgpool(_(minmax))?_ukernel_((\d+)p)?(\d+)x__(.+)_c(\d+)$", name)
+  match = re.match(r"^xnn_(qs8|qu8|f16|f32)_[p]?avgpool(_(minmax))?(_(fp32|rndnu))?_ukernel_((\d+)p)?(\d+)x__(.+)_c(\d+)$", name)
   if match is None:
     raise ValueError("Unexpected microkernel name: " + name)
 
-  if match.group(4):
-    primary_tile = int(match.group(5))
-    incremental_tile = int(match.group(6))
+  requantization_type = match.group(5)
+  if match.group(6):
+    primary_tile = int(match.group(7))
+    incremental_tile = int(match.group(8))
   else:
-    primary_tile = int(match.group(6))
+    primary_tile = int(match.group(8))
     incremental_tile = 0
-  channel_tile = int(match.group(8))
+  channel_tile = int(match.group(10))
 
-  arch, isa = xnncommon.parse_target_name(target_name=match.group(7))
-  return primary_tile, incremental_tile, channel_tile, arch, isa
+  arch, isa = xnncommon.parse_target_name(target_name=match.group(9))
+  return requantization_type, primary_tile, incremental_tile, channel_tile, arch, isa
 
 
 AVGPOOL_TEST_TEMPLATE = """\
@@ -80,7 +81,7 @@ $if INCREMENTAL_TILE == 0:
     }
   }
 
-  $if DATATYPE == "qu8":
+  $if DATATYPE in ["qs8", "qu8"]:
     TEST(${TEST_NAME}, channels_eq_${CHANNEL_TILE}_unipass_fulltile_with_input_scale) {
       $if ISA_CHECK:
         ${ISA_CHECK};
@@ -238,7 +239,7 @@ $if INCREMENTAL_TILE == 0:
       }
     }
 
-    $if DATATYPE == "qu8":
+    $if DATATYPE in ["qs8", "qu8"]:
       TEST(${TEST_NAME}, channels_div_${CHANNEL_TILE}_unipass_fulltile_with_input_scale) {
         $if ISA_CHECK:
           ${ISA_CHECK};
@@ -413,7 +414,7 @@ $if INCREMENTAL_TILE == 0:
       }
     }
 
-    $if DATATYPE == "qu8":
+    $if DATATYPE in ["qs8", "qu8"]:
       TEST(${TEST_NAME}, channels_lt_${CHANNEL_TILE}_unipass_fulltile_with_input_scale) {
         $if ISA_CHECK:
           ${ISA_CHECK};
@@ -588,7 +589,7 @@ $if INCREMENTAL_TILE == 0:
     }
   }
 
-  $if DATATYPE == "qu8":
+  $if DATATYPE in ["qs8", "qu8"]:
     TEST(${TEST_NAME}, channels_gt_${CHANNEL_TILE}_unipass_fulltile_with_input_scale) {
       $if ISA_CHECK:
         ${ISA_CHECK};
@@ -778,7 +779,7 @@ $if INCREMENTAL_TILE == 0:
     }
   }
 
-  $if DATATYPE == "qu8":
+  $if DATATYPE in ["qs8", "qu8"]:
     TEST(${TEST_NAME}, few_output_pixels_with_input_scale) {
       $if ISA_CHECK:
         ${ISA_CHECK};
@@ -969,7 +970,7 @@ $else:
     }
   }
 
-  $if DATATYPE == "qu8":
+  $if DATATYPE in ["qs8", "qu8"]:
     TEST(${TEST_NAME}, channels_eq_${CHANNEL_TILE}_twopass_fulltile_with_input_scale) {
       $if ISA_CHECK:
         ${ISA_CHECK};
@@ -1127,7 +1128,7 @@ $else:
       }
     }
 
-    $if DATATYPE == "qu8":
+    $if DATATYPE in ["qs8", "qu8"]:
       TEST(${TEST_NAME}, channels_div_${CHANNEL_TILE}_twopass_fulltile_with_input_scale) {
         $if ISA_CHECK:
           ${ISA_CHECK};
@@ -1302,7 +1303,7 @@ $else:
       }
     }
 
-    $if DATATYPE == "qu8":
+    $if DATATYPE in ["qs8", "qu8"]:
       TEST(${TEST_NAME}, channels_lt_${CHANNEL_TILE}_twopass_fulltile_with_input_scale) {
         $if ISA_CHECK:
           ${ISA_CHECK};
@@ -1477,7 +1478,7 @@ $else:
     }
   }
 
-  $if DATATYPE == "qu8":
+  $if DATATYPE in ["qs8", "qu8"]:
     TEST(${TEST_NAME}, channels_gt_${CHANNEL_TILE}_twopass_fulltile_with_input_scale) {
       $if ISA_CHECK:
         ${ISA_CHECK};
@@ -1652,7 +1653,7 @@ $else:
     }
   }
 
-  $if DATATYPE == "qu8":
+  $if DATATYPE in ["qs8", "qu8"]:
     TEST(${TEST_NAME}, channels_eq_${CHANNEL_TILE}_multipass_with_input_scale) {
       $if ISA_CHECK:
         ${ISA_CHECK};
@@ -1787,7 +1788,7 @@ $else:
       }
     }
 
-    $if DATATYPE == "qu8":
+    $if DATATYPE in ["qs8", "qu8"]:
       TEST(${TEST_NAME}, channels_div_${CHANNEL_TILE}_multipass_with_input_scale) {
         $if ISA_CHECK:
           ${ISA_CHECK};
@@ -1933,7 +1934,7 @@ $else:
       }
     }
 
-    $if DATATYPE == "qu8":
+    $if DATATYPE in ["qs8", "qu8"]:
       TEST(${TEST_NAME}, channels_lt_${CHANNEL_TILE}_multipass_with_input_scale) {
         $if ISA_CHECK:
           ${ISA_CHECK};
@@ -2079,7 +2080,7 @@ $else:
     }
   }
 
-  $if DATATYPE == "qu8":
+  $if DATATYPE in ["qs8", "qu8"]:
     TEST(${TEST_NAME}, channels_gt_${CHANNEL_TILE}_multipass_with_input_scale) {
       $if ISA_CHECK:
         ${ISA_CHECK};
@@ -2234,7 +2235,7 @@ $else:
     }
   }
 
-  $if DATATYPE == "qu8":
+  $if DATATYPE in ["qs8", "qu8"]:
     TEST(${TEST_NAME}, few_output_pixels_with_input_scale) {
       $if ISA_CHECK:
         ${ISA_CHECK};
@@ -2392,13 +2393,14 @@ $else:
 """
 
 
-def generate_test_cases(ukernel, init_fn, primary_tile, incremental_tile,
-                        channel_tile, isa):
+def generate_test_cases(ukernel, init_fn, requantization_type, primary_tile,
+                        incremental_tile, channel_tile, isa):
   """Generates all tests cases for a AVGPOOL micro-kernel.
 
   Args:
     ukernel: C name of the micro-kernel function.
     init_fn: C name of the function to initialize microkernel parameters.
+    requantization_type: Requantization type (FP32/RNDNU).
     primary_tile: Number of rows (pixels) processed per one iteration of the
                   primary outer loop of the micro-kernel.
     incremental_tile: Number of rows (pixels) processed per one iteration of
@@ -2414,6 +2416,9 @@ def generate_test_cases(ukernel, init_fn, primary_tile, incremental_tile,
   _, test_name = ukernel.split("_", 1)
   _, datatype, ukernel_type, _ = ukernel.split("_", 3)
   test_args = [ukernel, init_fn]
+  if requantization_type:
+    test_args.append("xnn_%s_requantize_%s" % \
+      (datatype.lower(), requantization_type.lower()))
   return xngen.preprocess(AVGPOOL_TEST_TEMPLATE, {
       "TEST_NAME": test_name.upper().replace("UKERNEL_", ""),
       "TEST_ARGS": test_args,
@@ -2461,14 +2466,15 @@ def main(args):
     for ukernel_spec in spec_yaml:
       name = ukernel_spec["name"]
       init_fn = ukernel_spec.get("init")
-      primary_tile, incremental_tile, channel_tile, arch, isa = \
-        split_ukernel_name(name)
+      requantization_type, primary_tile, incremental_tile, channel_tile, arch, \
+        isa = split_ukernel_name(name)
 
       # specification can override architecture
       arch = ukernel_spec.get("arch", arch)
 
-      test_case = generate_test_cases(name, init_fn, primary_tile,
-                                      incremental_tile, channel_tile, isa)
+      test_case = generate_test_cases(name, init_fn, requantization_type,
+                                      primary_tile, incremental_tile,
+                                      channel_tile, isa)
       tests += "\n\n" + xnncommon.postprocess_test_case(test_case, arch, isa)
 
     txt_changed = True